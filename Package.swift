@@ -63,6 +63,7 @@ let package = Package(
         "include/grpc/grpc_posix.h",
         "include/grpc/grpc_security.h",
         "include/grpc/grpc_security_constants.h",
+        "include/grpc/grpc_session_ticket_key_provider.h",
         "include/grpc/impl/call.h",
         "include/grpc/impl/channel_arg_names.h",
         "include/grpc/impl/codegen/atm.h",
@@ -118,6 +119,7 @@ let package = Package(
         "include/grpc/support/thd_id.h",
         "include/grpc/support/time.h",
         "include/grpc/support/workaround_list.h",
+        "src/core/call/filter_fusion.h",
         "src/core/call/request_buffer.cc",
         "src/core/call/request_buffer.h",
         "src/core/channelz/channel_trace.cc",
@@ -165,6 +167,8 @@ let package = Package(
         "src/core/client_channel/retry_throttle.h",
         "src/core/client_channel/subchannel.cc",
         "src/core/client_channel/subchannel.h",
+        "src/core/client_channel/subchannel_connect_coordinator.cc",
+        "src/core/client_channel/subchannel_connect_coordinator.h",
         "src/core/client_channel/subchannel_interface_internal.h",
         "src/core/client_channel/subchannel_pool_interface.cc",
         "src/core/client_channel/subchannel_pool_interface.h",
@@ -203,7 +207,9 @@ let package = Package(
         "src/core/ext/filters/http/server/http_server_filter.cc",
         "src/core/ext/filters/http/server/http_server_filter.h",
         "src/core/ext/filters/message_size/message_size_filter.cc",
+        "src/core/ext/filters/method_admission/method_admission_filter.cc",
         "src/core/ext/filters/message_size/message_size_filter.h",
+        "src/core/ext/filters/method_admission/method_admission_filter.h",
         "src/core/ext/filters/rbac/rbac_filter.cc",
         "src/core/ext/filters/rbac/rbac_filter.h",
         "src/core/ext/filters/rbac/rbac_service_config_parser.cc",
@@ -258,8 +264,14 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/hpack_parser.h",
         "src/core/ext/transport/chttp2/transport/hpack_parser_table.cc",
         "src/core/ext/transport/chttp2/transport/hpack_parser_table.h",
+        "src/core/ext/transport/chttp2/transport/http2_client_transport.cc",
+        "src/core/ext/transport/chttp2/transport/http2_client_transport.h",
+        "src/core/ext/transport/chttp2/transport/http2_server_transport.cc",
+        "src/core/ext/transport/chttp2/transport/http2_server_transport.h",
         "src/core/ext/transport/chttp2/transport/http2_settings.cc",
         "src/core/ext/transport/chttp2/transport/http2_settings.h",
+        "src/core/ext/transport/chttp2/transport/http2_transport.cc",
+        "src/core/ext/transport/chttp2/transport/http2_transport.h",
         "src/core/ext/transport/chttp2/transport/huffsyms.cc",
         "src/core/ext/transport/chttp2/transport/huffsyms.h",
         "src/core/ext/transport/chttp2/transport/internal.h",
@@ -271,6 +283,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/ping_callbacks.h",
         "src/core/ext/transport/chttp2/transport/ping_rate_policy.cc",
         "src/core/ext/transport/chttp2/transport/ping_rate_policy.h",
+        "src/core/ext/transport/chttp2/transport/shared_keepalive.cc",
+        "src/core/ext/transport/chttp2/transport/shared_keepalive.h",
         "src/core/ext/transport/chttp2/transport/stream_lists.cc",
         "src/core/ext/transport/chttp2/transport/stream_lists.h",
         "src/core/ext/transport/chttp2/transport/varint.cc",
@@ -1114,6 +1128,8 @@ let package = Package(
         "src/core/handshaker/security/secure_endpoint.h",
         "src/core/handshaker/security/security_handshaker.cc",
         "src/core/handshaker/security/security_handshaker.h",
+        "src/core/handshaker/shm/shm_handshaker.cc",
+        "src/core/handshaker/shm/shm_handshaker.h",
         "src/core/handshaker/tcp_connect/tcp_connect_handshaker.cc",
         "src/core/handshaker/tcp_connect/tcp_connect_handshaker.h",
         "src/core/lib/address_utils/parse_address.cc",
@@ -1143,6 +1159,8 @@ let package = Package(
         "src/core/lib/compression/compression_internal.h",
         "src/core/lib/compression/message_compress.cc",
         "src/core/lib/compression/message_compress.h",
+        "src/core/lib/compression/zstd_dictionary.cc",
+        "src/core/lib/compression/zstd_dictionary.h",
         "src/core/lib/debug/trace.cc",
         "src/core/lib/debug/trace.h",
         "src/core/lib/debug/trace_flags.cc",
@@ -1169,6 +1187,7 @@ let package = Package(
         "src/core/lib/event_engine/extensions/can_track_errors.h",
         "src/core/lib/event_engine/extensions/chaotic_good_extension.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
+        "src/core/lib/event_engine/extensions/supports_shm.h",
         "src/core/lib/event_engine/extensions/tcp_trace.h",
         "src/core/lib/event_engine/forkable.cc",
         "src/core/lib/event_engine/forkable.h",
@@ -1179,7 +1198,9 @@ let package = Package(
         "src/core/lib/event_engine/poller.h",
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1201,6 +1222,10 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/posix_engine_listener.h",
         "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.cc",
         "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.h",
+        "src/core/lib/event_engine/posix_engine/shm_endpoint.cc",
+        "src/core/lib/event_engine/posix_engine/shm_endpoint.h",
+        "src/core/lib/event_engine/posix_engine/shm_ring.cc",
+        "src/core/lib/event_engine/posix_engine/shm_ring.h",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h",
         "src/core/lib/event_engine/posix_engine/timer.cc",
@@ -1257,7 +1282,11 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.cc",
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/mpmc_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h",
+        "src/core/lib/event_engine/work_queue/mpmc_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1436,8 +1465,12 @@ let package = Package(
         "src/core/lib/resource_quota/arena.h",
         "src/core/lib/resource_quota/connection_quota.cc",
         "src/core/lib/resource_quota/connection_quota.h",
+        "src/core/lib/resource_quota/hugepage_slab.cc",
         "src/core/lib/resource_quota/memory_quota.cc",
+        "src/core/lib/resource_quota/method_quota.cc",
+        "src/core/lib/resource_quota/hugepage_slab.h",
         "src/core/lib/resource_quota/memory_quota.h",
+        "src/core/lib/resource_quota/method_quota.h",
         "src/core/lib/resource_quota/periodic_update.cc",
         "src/core/lib/resource_quota/periodic_update.h",
         "src/core/lib/resource_quota/resource_quota.cc",
@@ -1535,6 +1568,8 @@ let package = Package(
         "src/core/lib/security/credentials/tls/grpc_tls_credentials_options.h",
         "src/core/lib/security/credentials/tls/grpc_tls_crl_provider.cc",
         "src/core/lib/security/credentials/tls/grpc_tls_crl_provider.h",
+        "src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.cc",
+        "src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.h",
         "src/core/lib/security/credentials/tls/tls_credentials.cc",
         "src/core/lib/security/credentials/tls/tls_credentials.h",
         "src/core/lib/security/credentials/tls/tls_utils.cc",
@@ -1654,6 +1689,8 @@ let package = Package(
         "src/core/lib/transport/metadata_info.h",
         "src/core/lib/transport/parsed_metadata.cc",
         "src/core/lib/transport/parsed_metadata.h",
+        "src/core/lib/transport/promise_endpoint.cc",
+        "src/core/lib/transport/promise_endpoint.h",
         "src/core/lib/transport/simple_slice_based_metadata.h",
         "src/core/lib/transport/status_conversion.cc",
         "src/core/lib/transport/status_conversion.h",
@@ -1691,14 +1728,18 @@ let package = Package(
         "src/core/load_balancing/lb_policy.h",
         "src/core/load_balancing/lb_policy_factory.h",
         "src/core/load_balancing/lb_policy_registry.cc",
+        "src/core/load_balancing/least_request/least_request.cc",
+        "src/core/load_balancing/locality_aware/locality_aware.cc",
         "src/core/load_balancing/lb_policy_registry.h",
         "src/core/load_balancing/oob_backend_metric.cc",
         "src/core/load_balancing/oob_backend_metric.h",
         "src/core/load_balancing/oob_backend_metric_internal.h",
         "src/core/load_balancing/outlier_detection/outlier_detection.cc",
+        "src/core/load_balancing/peak_ewma/peak_ewma.cc",
         "src/core/load_balancing/outlier_detection/outlier_detection.h",
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
+        "src/core/load_balancing/picker_random.h",
         "src/core/load_balancing/priority/priority.cc",
         "src/core/load_balancing/ring_hash/ring_hash.cc",
         "src/core/load_balancing/ring_hash/ring_hash.h",
@@ -1732,7 +1773,9 @@ let package = Package(
         "src/core/resolver/dns/dns_resolver_plugin.cc",
         "src/core/resolver/dns/dns_resolver_plugin.h",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc",
+        "src/core/resolver/dns/event_engine/hostname_cache.cc",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.h",
+        "src/core/resolver/dns/event_engine/hostname_cache.h",
         "src/core/resolver/dns/event_engine/service_config_helper.cc",
         "src/core/resolver/dns/event_engine/service_config_helper.h",
         "src/core/resolver/dns/native/dns_resolver.cc",
@@ -1765,6 +1808,8 @@ let package = Package(
         "src/core/server/server_config_selector_filter.cc",
         "src/core/server/server_config_selector_filter.h",
         "src/core/server/server_interface.h",
+        "src/core/server/tenant_scheduler.cc",
+        "src/core/server/tenant_scheduler.h",
         "src/core/server/xds_channel_stack_modifier.cc",
         "src/core/server/xds_channel_stack_modifier.h",
         "src/core/server/xds_server_config_fetcher.cc",
@@ -1775,12 +1820,18 @@ let package = Package(
         "src/core/service_config/service_config_impl.h",
         "src/core/service_config/service_config_parser.cc",
         "src/core/service_config/service_config_parser.h",
+        "src/core/telemetry/call_cpu_accounting.cc",
+        "src/core/telemetry/call_cpu_accounting.h",
         "src/core/telemetry/call_tracer.cc",
         "src/core/telemetry/call_tracer.h",
         "src/core/telemetry/histogram_view.cc",
+        "src/core/telemetry/latency_breakdown.cc",
         "src/core/telemetry/histogram_view.h",
+        "src/core/telemetry/latency_breakdown.h",
         "src/core/telemetry/metrics.cc",
         "src/core/telemetry/metrics.h",
+        "src/core/telemetry/slow_call_capture.cc",
+        "src/core/telemetry/slow_call_capture.h",
         "src/core/telemetry/stats.cc",
         "src/core/telemetry/stats.h",
         "src/core/telemetry/stats_data.cc",
@@ -1827,13 +1878,17 @@ let package = Package(
         "src/core/tsi/fake_transport_security.h",
         "src/core/tsi/local_transport_security.cc",
         "src/core/tsi/local_transport_security.h",
+        "src/core/tsi/ssl/handshake_offload/ssl_handshake_offloader.cc",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.cc",
+        "src/core/tsi/ssl/handshake_offload/ssl_handshake_offloader.h",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.h",
         "src/core/tsi/ssl/session_cache/ssl_session.h",
         "src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.h",
         "src/core/tsi/ssl/session_cache/ssl_session_openssl.cc",
+        "src/core/tsi/ssl/verification_cache/ssl_verification_cache.cc",
+        "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h",
         "src/core/tsi/ssl_transport_security.cc",
         "src/core/tsi/ssl_transport_security.h",
         "src/core/tsi/ssl_transport_security_utils.cc",
@@ -1904,6 +1959,8 @@ let package = Package(
         "src/core/util/json/json_util.h",
         "src/core/util/json/json_writer.cc",
         "src/core/util/json/json_writer.h",
+        "src/core/util/latency_sketch.cc",
+        "src/core/util/latency_sketch.h",
         "src/core/util/latent_see.cc",
         "src/core/util/latent_see.h",
         "src/core/util/linux/cpu.cc",
@@ -1959,6 +2016,8 @@ let package = Package(
         "src/core/util/table.h",
         "src/core/util/tchar.cc",
         "src/core/util/tchar.h",
+        "src/core/util/tdigest.cc",
+        "src/core/util/tdigest.h",
         "src/core/util/thd.h",
         "src/core/util/time.cc",
         "src/core/util/time.h",
@@ -17,25 +17,34 @@
 """Dictionary of tags to experiments so we know when to test different experiments."""
 
 EXPERIMENT_ENABLES = {
+    "arena_block_cache": "arena_block_cache",
     "backoff_cap_initial_at_max": "backoff_cap_initial_at_max",
     "call_tracer_in_transport": "call_tracer_in_transport",
     "call_tracer_transport_fix": "call_tracer_transport_fix",
     "callv3_client_auth_filter": "callv3_client_auth_filter",
     "chaotic_good_framing_layer": "chaotic_good_framing_layer",
+    "combiner_batch_drain": "combiner_batch_drain",
+    "cq_next_adaptive_spin": "cq_next_adaptive_spin",
     "disable_buffer_hint_on_high_memory_pressure": "disable_buffer_hint_on_high_memory_pressure",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
     "event_engine_dns_non_client_channel": "event_engine_dns_non_client_channel",
     "event_engine_listener": "event_engine_listener",
     "event_engine_callback_cq": "event_engine_callback_cq,event_engine_client,event_engine_listener",
+    "fork_keeps_resolver_result": "fork_keeps_resolver_result",
     "free_large_allocator": "free_large_allocator",
+    "hpack_encoder_contiguous_output": "hpack_encoder_contiguous_output",
+    "hugepage_slice_slabs": "hugepage_slice_slabs",
     "keep_alive_ping_timer_batch": "keep_alive_ping_timer_batch",
     "local_connector_secure": "local_connector_secure",
     "max_pings_wo_data_throttle": "max_pings_wo_data_throttle",
     "monitoring_experiment": "monitoring_experiment",
     "multiping": "multiping",
+    "per_cpu_memory_quota": "per_cpu_memory_quota",
     "pick_first_new": "pick_first_new",
+    "posix_ee_inline_fd_callbacks": "posix_ee_inline_fd_callbacks",
     "posix_ee_skip_grpc_init": "posix_ee_skip_grpc_init",
+    "posix_ee_timer_wheel": "posix_ee_timer_wheel",
     "promise_based_http2_client_transport": "promise_based_http2_client_transport",
     "promise_based_http2_server_transport": "promise_based_http2_server_transport",
     "promise_based_inproc_transport": "promise_based_inproc_transport",
@@ -43,9 +52,15 @@ EXPERIMENT_ENABLES = {
     "rq_fast_reject": "rq_fast_reject",
     "schedule_cancellation_over_write": "schedule_cancellation_over_write",
     "server_listener": "server_listener",
+    "shared_ares_resolver": "shared_ares_resolver",
     "tcp_frame_size_tuning": "tcp_frame_size_tuning",
     "tcp_rcv_lowat": "tcp_rcv_lowat",
+    "token_fetcher_proactive_refresh": "token_fetcher_proactive_refresh",
+    "tsc_clock": "tsc_clock",
     "unconstrained_max_quota_buffer_size": "unconstrained_max_quota_buffer_size",
+    "work_serializer_urgent_lane": "work_serializer_urgent_lane",
+    "work_stealing_lock_free_queues": "work_stealing_lock_free_queues",
+    "work_stealing_numa_affinity": "work_stealing_numa_affinity",
 }
 
 EXPERIMENT_POLLERS = [
@@ -63,27 +78,48 @@ EXPERIMENTS = {
             "core_end2end_test": [
                 "callv3_client_auth_filter",
                 "chaotic_good_framing_layer",
+                "cq_next_adaptive_spin",
                 "event_engine_dns_non_client_channel",
+                "hpack_encoder_contiguous_output",
                 "local_connector_secure",
                 "posix_ee_skip_grpc_init",
                 "retry_in_callv3",
+                "tsc_clock",
             ],
             "cpp_end2end_test": [
+                "cq_next_adaptive_spin",
                 "posix_ee_skip_grpc_init",
             ],
             "endpoint_test": [
+                "hugepage_slice_slabs",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "event_engine_client_test": [
+                "posix_ee_inline_fd_callbacks",
+                "posix_ee_timer_wheel",
+                "work_stealing_lock_free_queues",
+            ],
+            "event_engine_listener_test": [
+                "posix_ee_inline_fd_callbacks",
+                "posix_ee_timer_wheel",
+                "work_stealing_lock_free_queues",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
             "resource_quota_test": [
+                "arena_block_cache",
                 "free_large_allocator",
+                "hugepage_slice_slabs",
+                "per_cpu_memory_quota",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "timer_test": [
+                "tsc_clock",
+            ],
         },
         "on": {
             "cancel_ares_query_test": [
@@ -122,27 +158,44 @@ EXPERIMENTS = {
             "core_end2end_test": [
                 "callv3_client_auth_filter",
                 "chaotic_good_framing_layer",
+                "cq_next_adaptive_spin",
                 "event_engine_dns_non_client_channel",
+                "hpack_encoder_contiguous_output",
                 "local_connector_secure",
                 "posix_ee_skip_grpc_init",
                 "retry_in_callv3",
+                "tsc_clock",
             ],
             "cpp_end2end_test": [
+                "cq_next_adaptive_spin",
                 "posix_ee_skip_grpc_init",
             ],
             "endpoint_test": [
+                "hugepage_slice_slabs",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "event_engine_client_test": [
+                "work_stealing_lock_free_queues",
+            ],
+            "event_engine_listener_test": [
+                "work_stealing_lock_free_queues",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
             "resource_quota_test": [
+                "arena_block_cache",
                 "free_large_allocator",
+                "hugepage_slice_slabs",
+                "per_cpu_memory_quota",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "timer_test": [
+                "tsc_clock",
+            ],
         },
         "on": {
             "core_end2end_test": [
@@ -167,27 +220,48 @@ EXPERIMENTS = {
             "core_end2end_test": [
                 "callv3_client_auth_filter",
                 "chaotic_good_framing_layer",
+                "cq_next_adaptive_spin",
                 "event_engine_dns_non_client_channel",
+                "hpack_encoder_contiguous_output",
                 "local_connector_secure",
                 "posix_ee_skip_grpc_init",
                 "retry_in_callv3",
+                "tsc_clock",
             ],
             "cpp_end2end_test": [
+                "cq_next_adaptive_spin",
                 "posix_ee_skip_grpc_init",
             ],
             "endpoint_test": [
+                "hugepage_slice_slabs",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "event_engine_client_test": [
+                "posix_ee_inline_fd_callbacks",
+                "posix_ee_timer_wheel",
+                "work_stealing_lock_free_queues",
+            ],
+            "event_engine_listener_test": [
+                "posix_ee_inline_fd_callbacks",
+                "posix_ee_timer_wheel",
+                "work_stealing_lock_free_queues",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
             "resource_quota_test": [
+                "arena_block_cache",
                 "free_large_allocator",
+                "hugepage_slice_slabs",
+                "per_cpu_memory_quota",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "timer_test": [
+                "tsc_clock",
+            ],
         },
         "on": {
             "cancel_ares_query_test": [
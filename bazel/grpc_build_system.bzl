@@ -39,7 +39,7 @@ load("//bazel:experiments.bzl", "EXPERIMENTS", "EXPERIMENT_ENABLES", "EXPERIMENT
 load("//bazel:test_experiments.bzl", "TEST_EXPERIMENTS", "TEST_EXPERIMENT_ENABLES", "TEST_EXPERIMENT_POLLERS")
 
 # The set of pollers to test against if a test exercises polling
-POLLERS = ["epoll1", "poll"]
+POLLERS = ["epoll1", "poll", "io_uring"]
 
 # The set of known EventEngines to test
 EVENT_ENGINES = {"default": {"tags": []}}
@@ -0,0 +1,31 @@
+# Copyright 2025 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+set(gRPC_USE_LZ4 "AUTO" CACHE STRING "Build with liblz4 message compression if available. Can be ON, OFF or AUTO")
+
+if (NOT gRPC_USE_LZ4 STREQUAL "OFF")
+  if (gRPC_USE_LZ4 STREQUAL "ON")
+    find_package(lz4 REQUIRED)
+  elseif (gRPC_USE_LZ4 STREQUAL "AUTO")
+    find_package(lz4)
+  else()
+    message(FATAL_ERROR "Unknown value for gRPC_USE_LZ4 = ${gRPC_USE_LZ4}")
+  endif()
+
+  if(TARGET lz4)
+    set(_gRPC_LZ4_LIBRARIES lz4)
+    add_definitions(-DHAVE_LIBLZ4)
+    set(_gRPC_FIND_LZ4 "if(NOT lz4_FOUND)\n  find_package(lz4)\nendif()")
+  endif()
+endif()
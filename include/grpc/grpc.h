@@ -122,6 +122,23 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** Like grpc_completion_queue_next, but once an event is available, also
+    returns up to max_events - 1 further events that are already queued,
+    without polling again.  max_events must be at least 1.
+
+    Returns the number of events stored in events, which is always at
+    least 1.  Only events[0] may have a type other than GRPC_OP_COMPLETE
+    (i.e., GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN), in which case it is
+    the only event returned.
+
+    Callers must not call grpc_completion_queue_next_batch and
+    grpc_completion_queue_pluck simultaneously on the same completion queue. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
@@ -0,0 +1,96 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_GRPC_SESSION_TICKET_KEY_PROVIDER_H
+#define GRPC_GRPC_SESSION_TICKET_KEY_PROVIDER_H
+
+#include <grpc/credentials.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace experimental {
+
+// A session ticket encryption key (STEK). TLS servers encrypt the session
+// tickets they issue with AES-256-CBC under aes_key and authenticate them with
+// HMAC-SHA256 under hmac_key. The name is sent in the clear with each ticket,
+// so that the server can find the key to decrypt it with.
+struct SessionTicketKey {
+  static constexpr size_t kNameSize = 16;
+  static constexpr size_t kKeySize = 32;
+
+  uint8_t name[kNameSize];
+  uint8_t hmac_key[kKeySize];
+  uint8_t aes_key[kKeySize];
+};
+
+// The base class for session ticket key providers. Servers that get their keys
+// from providers that agree can resume each other's sessions. Providers must
+// be thread safe, and are called on every handshake, so should be fast.
+class SessionTicketKeyProvider {
+ public:
+  virtual ~SessionTicketKeyProvider() = default;
+  // Returns the key to encrypt new tickets with.
+  virtual SessionTicketKey EncryptionKey() = 0;
+  // Returns the key named \a name, or nullopt if tickets encrypted with it
+  // are no longer accepted. Sets \a *renew if the client should be issued a
+  // new ticket, encrypted with the current key.
+  virtual std::optional<SessionTicketKey> DecryptionKey(absl::string_view name,
+                                                        bool* renew) = 0;
+};
+
+// A provider that derives its key from a secret, and that can be rotated to a
+// new secret. Tickets encrypted with the key that was current before the last
+// rotation are still accepted, and renewed.
+class RotatingSessionTicketKeyProvider : public SessionTicketKeyProvider {
+ public:
+  // Makes the key derived from \a secret the current key. Fails if \a secret
+  // is shorter than 32 bytes.
+  virtual absl::Status Rotate(absl::string_view secret) = 0;
+};
+
+// Creates a rotating provider whose current key is derived from \a secret,
+// which has to be at least 32 bytes long. Servers created with the same secret
+// share keys, so a fleet can rotate by distributing a new secret to each of
+// its servers.
+absl::StatusOr<std::shared_ptr<RotatingSessionTicketKeyProvider>>
+CreateRotatingSessionTicketKeyProvider(absl::string_view secret);
+
+}  // namespace experimental
+}  // namespace grpc_core
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets the session ticket key provider in the options. Only applies to server
+ * credentials. If not set, each server encrypts tickets with its own random
+ * key.
+ */
+void grpc_tls_credentials_options_set_session_ticket_key_provider(
+    grpc_tls_credentials_options* options,
+    std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+        provider);
+#endif /* GRPC_GRPC_SESSION_TICKET_KEY_PROVIDER_H */
@@ -59,6 +59,13 @@
  * channel goes back into IDLE state. Int valued, milliseconds. INT_MAX means
  * unlimited. The default value is 30 minutes and the min value is 1 second. */
 #define GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS "grpc.client_idle_timeout_ms"
+/** Experimental Arg. If non-zero, a client channel going IDLE keeps its last
+   resolver result, so that the first call after IDLE connects to the
+   addresses it had before while name resolution starts again. Results that
+   came with a ConfigSelector (e.g. from xds) are not kept. Boolean valued,
+   defaults to false. */
+#define GRPC_ARG_EXPERIMENTAL_CLIENT_CHANNEL_WARM_IDLE \
+  "grpc.experimental.client_channel.warm_idle"
 /** Enable/disable support for per-message compression. Defaults to 1, unless
     GRPC_ARG_MINIMAL_STACK is enabled, in which case it defaults to 0. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION "grpc.per_message_compression"
@@ -67,6 +74,30 @@
    application will see the compressed message in the byte buffer. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION \
   "grpc.per_message_decompression"
+/** Experimental Arg. The id of a registered zstd dictionary to compress
+   messages with, when the call uses zstd and the peer has advertised the
+   dictionary. String valued. Requires gRPC to be built with libzstd. */
+#define GRPC_ARG_ZSTD_COMPRESSION_DICTIONARY "grpc.zstd_compression_dictionary"
+/** Experimental Arg. If non-zero, decide for each message whether compressing
+   it is worthwhile. Messages smaller than
+   GRPC_ARG_ADAPTIVE_COMPRESSION_MIN_MESSAGE_SIZE, messages whose bytes look
+   random (such as images or other already compressed data) and the messages
+   of calls whose previous messages did not compress well are sent
+   uncompressed. Calls started while the server's CPU utilization, as
+   reported to its ServerMetricRecorder, is above 80% compress at the lowest
+   level. Defaults to 0. */
+#define GRPC_ARG_ADAPTIVE_COMPRESSION "grpc.adaptive_compression"
+/** Experimental Arg. The size in bytes below which messages are not compressed
+   when GRPC_ARG_ADAPTIVE_COMPRESSION is set. Int valued, defaults to 512. */
+#define GRPC_ARG_ADAPTIVE_COMPRESSION_MIN_MESSAGE_SIZE \
+  "grpc.adaptive_compression_min_message_size"
+/** Experimental Arg. The size in bytes from which messages compressed with
+   deflate, gzip or zstd are compressed in blocks in parallel on the
+   EventEngine threads, and from which zstd messages made of several frames
+   are decompressed in parallel. Blocks are 256KB for deflate and gzip and
+   1MB for zstd. Int valued, defaults to 0, which disables it. */
+#define GRPC_ARG_PARALLEL_COMPRESSION_MIN_MESSAGE_SIZE \
+  "grpc.parallel_compression_min_message_size"
 /** Initial stream ID for http2 transports. Int valued. */
 #define GRPC_ARG_HTTP2_INITIAL_SEQUENCE_NUMBER \
   "grpc.http2.initial_sequence_number"
@@ -81,12 +112,49 @@
 /** How much memory to use for hpack encoding. Int valued, bytes. */
 #define GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER \
   "grpc.http2.hpack_table_size.encoder"
+/** EXPERIMENTAL. If non-zero, the hpack encoder shares encoded literals for
+    stable headers (:path, :authority, user-agent, ...) with other connections
+    in the process that also set this arg, using static table name indices and
+    huffman coding where that is shorter. This reduces header overhead on the
+    first RPCs of new connections. Defaults to 0 (false). */
+#define GRPC_ARG_HTTP2_HPACK_SHARED_LITERAL_CACHE \
+  "grpc.http2.hpack_shared_literal_cache"
 /** How big a frame are we willing to receive via HTTP2.
     Min 16384, max 16777215. Larger values give lower CPU usage for large
     messages, but more head of line blocking for small messages. */
 #define GRPC_ARG_HTTP2_MAX_FRAME_SIZE "grpc.http2.max_frame_size"
 /** Should BDP probing be performed? */
 #define GRPC_ARG_HTTP2_BDP_PROBE "grpc.http2.bdp_probe"
+/** EXPERIMENTAL. Streams that have received at least this many bytes are
+    treated as bulk transfers: while a reader is waiting they advertise a
+    stream window that grows beyond the usual per-stream limit as it is
+    consumed, bounded by memory pressure. Short RPCs keep the default sizing.
+    Int valued, bytes. Defaults to 0 (disabled). */
+#define GRPC_ARG_HTTP2_BULK_STREAM_THRESHOLD_BYTES \
+  "grpc.http2.bulk_stream_threshold_bytes"
+/** EXPERIMENTAL. How long stream WINDOW_UPDATE frames that would otherwise
+    trigger an immediate write may be held so that updates for several streams
+    go out together, similar to TCP delayed ACK. Updates are still written
+    immediately when the peer is close to stalling on a waiting reader.
+    Int valued, microseconds. Defaults to 0 (no delay). */
+#define GRPC_ARG_HTTP2_WINDOW_UPDATE_DELAY_US "grpc.http2.window_update_delay_us"
+/** EXPERIMENTAL. Write priority class for streams on this connection that
+    are not given one by a filter: 0 (high), 1 (normal) or 2 (bulk). Streams in
+    a higher class are always written before streams in a lower class.
+    Int valued, defaults to 1. */
+#define GRPC_ARG_HTTP2_WRITE_PRIORITY "grpc.http2.write_priority"
+/** EXPERIMENTAL. Write weight for streams on this connection that are not
+    given one by a filter. Streams in the same write priority class share the
+    connection in proportion to their weights. Int valued, 1..255, defaults
+    to 16. */
+#define GRPC_ARG_HTTP2_WRITE_WEIGHT "grpc.http2.write_weight"
+/** EXPERIMENTAL. Received messages at least this large are handed to the
+    layers above the transport from an EventEngine thread rather than from the
+    thread reading the connection, so that their decompression and
+    deserialization can proceed in parallel with reading and parsing further
+    frames. Int valued, bytes. Defaults to 0 (never). */
+#define GRPC_ARG_HTTP2_OFFLOAD_RECV_MESSAGE_BYTES \
+  "grpc.http2.offload_recv_message_bytes"
 /** (DEPRECATED) Does not have any effect.
     Earlier, this arg configured the minimum time between successive ping frames
     without receiving any data/header frame, Int valued, milliseconds. This put
@@ -109,6 +177,43 @@
     before the request is cancelled */
 #define GRPC_ARG_SERVER_MAX_UNREQUESTED_TIME_IN_SERVER_SECONDS \
   "grpc.server_max_unrequested_time_in_server"
+/** For synchronous C++ servers: the longest a call may wait for a thread to
+    run its handler, in milliseconds, counted from when the call arrived at
+    the server. A call that has waited longer is failed with
+    RESOURCE_EXHAUSTED without running the handler. Zero, the default, means
+    no limit. */
+#define GRPC_ARG_SYNC_SERVER_MAX_QUEUE_TIME_MS \
+  "grpc.sync_server_max_queue_time_ms"
+/** For callback C++ servers: if non-zero, new calls are dispatched to their
+    handlers on the EventEngine in earliest-deadline-first order, rather than
+    inline as they arrive. A call whose deadline passes while it is queued is
+    failed with DEADLINE_EXCEEDED without running the handler. Defaults to
+    0. */
+#define GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH \
+  "grpc.callback_server_deadline_ordered_dispatch"
+/** For C++ servers: if non-zero, the handlers of new callback calls are
+    started so that tenants share the CPU in proportion to their weights,
+    which are set with Server::experimental().SetTenantWeight(). The calls of
+    a tenant that has used more than its share of CPU time wait behind those
+    of the others. The tenant of a call is the peer identity of its auth
+    context, unless GRPC_ARG_SERVER_TENANT_METADATA_KEY is set. The handlers of sync methods
+    may block, so they run as they arrive, bounded by the sync server's
+    thread pool. A server cannot have both this and
+    GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH. Defaults to 0. */
+#define GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING \
+  "grpc.server_tenant_fair_scheduling"
+/** For C++ servers with GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING: opts in to
+    taking the tenant of a call from the client's metadata under this key.
+    Since clients choose the value, a call from an authenticated peer goes to
+    the tenant "<peer identity>/<value>", and one from any other peer to the
+    tenant "<value>". Calls without the key go to the peer identity's tenant.
+    Unset by default. */
+#define GRPC_ARG_SERVER_TENANT_METADATA_KEY "grpc.server_tenant_metadata_key"
+/** For C++ servers with GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING: the most
+    callback handlers that are started at once. Defaults to the number of
+    CPUs. */
+#define GRPC_ARG_SERVER_TENANT_MAX_CONCURRENCY \
+  "grpc.server_tenant_max_concurrency"
 /** Channel arg to override the http2 :scheme header */
 #define GRPC_ARG_HTTP2_SCHEME "grpc.http2_scheme"
 /** How many pings can the client send before needing to send a data/header
@@ -146,6 +251,15 @@
    outstanding streams. Int valued, 0(false)/1(true). */
 #define GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS \
   "grpc.keepalive_permit_without_calls"
+/** EXPERIMENTAL. If non-zero, client connections that set this arg share
+   keepalive activity with the other such connections to the same peer
+   address: a connection skips its keepalive ping while another one has read
+   data or had a ping acked within the keepalive time. This saves pings for
+   processes with many channels to one backend, but a connection that fails
+   while others to the same peer stay healthy is not noticed until it is
+   used. Int valued, 0(false)/1(true). Defaults to 0. */
+#define GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE \
+  "grpc.experimental.http2.shared_keepalive"
 /** Default authority to pass if none specified on call construction. A string.
  * */
 #define GRPC_ARG_DEFAULT_AUTHORITY "grpc.default_authority"
@@ -180,10 +294,38 @@
     grpc_ssl_session_cache*). (use grpc_ssl_session_cache_arg_vtable() to fetch
     an appropriate pointer arg vtable) */
 #define GRPC_SSL_SESSION_CACHE_ARG "grpc.ssl_session_cache"
+/** If non-zero and GRPC_SSL_SESSION_CACHE_ARG is not set, resume TLS sessions
+    from a process-wide cache shared by all channels. Sessions are only offered
+    to a server under the same name and with the same root certificates and
+    client identity they were created with. Defaults to false. */
+#define GRPC_ARG_TLS_SHARED_SESSION_CACHE \
+  "grpc.experimental.tls_shared_session_cache"
+/** If non-zero, the CPU-heavy steps of TLS handshakes (signing, key exchange
+    and certificate verification) run on a bounded, process-wide pool of
+    threads instead of the threads that serve I/O, so that bursts of new
+    connections do not stall established ones. Applies to channels and to
+    servers. Defaults to false. */
+#define GRPC_ARG_TLS_HANDSHAKE_OFFLOAD "grpc.experimental.tls_handshake_offload"
+/** If non-zero, when a security handshake ends with a flight to send to the
+    peer (such as the TLS 1.3 client Finished message), that flight is not
+    written on its own, but ahead of the first write on the secure endpoint,
+    which for HTTP/2 carries the connection preface and SETTINGS frame. This
+    saves a write and lets both go out in the same packets. Only applies to
+    channels: servers ignore it, since a client may wait for the server's last
+    flight before it sends anything. Ignored when GRPC_ARG_TLS_KERNEL_OFFLOAD
+    is in effect. Defaults to false. */
+#define GRPC_ARG_SECURITY_HANDSHAKE_COALESCE_FINAL_FLIGHT \
+  "grpc.experimental.security_handshake_coalesce_final_flight"
 /** If non-zero, it will determine the maximum frame size used by TSI's frame
  *  protector.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, after a TLS 1.3 handshake over a TCP socket, have the kernel
+ *  encrypt outgoing data (kernel TLS) when the platform and the negotiated
+ *  cipher support it. Incoming data is still decrypted in user space.
+ *  Ignored when GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED is set. Defaults to false.
+ */
+#define GRPC_ARG_TLS_KERNEL_OFFLOAD "grpc.experimental.tls_kernel_offload"
 /** Maximum metadata size (soft limit), in bytes. Note this limit applies to the
    max sum of all metadata key-value entries in a batch of headers. Some random
    sample of requests between this limit and
@@ -230,6 +372,15 @@
  * level. Disabling channelz naturally disables channel tracing. The default
  * is for channelz to be enabled. */
 #define GRPC_ARG_ENABLE_CHANNELZ "grpc.enable_channelz"
+/** If non-zero, and channelz is enabled, channelz keeps percentiles of the
+ * latency of calls on channels and servers, and servers keep them for each of
+ * their registered methods, too. Defaults to 0. */
+#define GRPC_ARG_CHANNELZ_CALL_LATENCY "grpc.channelz_call_latency"
+/** If non-zero, channelz subchannel and socket nodes are only registered, and
+ * assigned a uuid, once a channelz query reaches them, rather than when they
+ * are created. This makes creating and destroying connections cheaper for
+ * processes that rarely query channelz. Defaults to 0. */
+#define GRPC_ARG_CHANNELZ_LAZY_REGISTRATION "grpc.channelz_lazy_registration"
 /** If non-zero, Cronet transport will coalesce packets to fewer frames
  * when possible. */
 #define GRPC_ARG_USE_CRONET_PACKET_COALESCING \
@@ -259,6 +410,58 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* If non-zero, idle TCP connections hold no read buffer of their own: small
+   reads go through a buffer shared by all the connections serviced by the
+   same thread, and only the bytes actually received are copied out. This
+   trades a copy per read for memory that scales with active rather than total
+   connections. By default, it is disabled. Only supported by the posix
+   EventEngine. */
+#define GRPC_ARG_TCP_SHARED_READ_BUFFER \
+  "grpc.experimental.tcp_shared_read_buffer"
+/* If non-zero, TCP connections give back read buffer space they grew into
+   during a burst once they have gone this many milliseconds without
+   completing a read: spare read slices are freed and the read size estimate
+   falls back to GRPC_ARG_TCP_READ_CHUNK_SIZE. Such connections also drop
+   their spare read space as soon as a read completes under memory pressure,
+   and give it up to the resource quota's idle reclamation pass. By default,
+   it is disabled. Only supported by the posix EventEngine. */
+#define GRPC_ARG_TCP_READ_BUFFER_IDLE_TIMEOUT_MS \
+  "grpc.experimental.tcp_read_buffer_idle_timeout_ms"
+/* Busy poll budget in microseconds for latency sensitive servers. If
+   non-zero, sockets get SO_BUSY_POLL (and SO_PREFER_BUSY_POLL) set to this
+   value, and the epoll1 poller spins on the ready list for up to this long
+   before going to sleep. This trades CPU for wakeup latency. By default, it is
+   disabled. Only supported by the posix EventEngine. */
+#define GRPC_ARG_TCP_BUSY_POLL_USEC "grpc.experimental.tcp_busy_poll_usec"
+/* Number of SO_REUSEPORT listening sockets to open per bound address on
+   servers. If greater than one, the listener opens that many sockets on the
+   same port and attaches a SO_ATTACH_REUSEPORT_CBPF program that picks the
+   socket by the CPU the connection arrived on (SO_INCOMING_CPU), so that with
+   one shard per CPU each accept queue follows the NIC's RSS/RFS steering.
+   Requires SO_REUSEPORT (see GRPC_ARG_ALLOW_REUSEPORT). By default, it is
+   disabled. Only supported by the posix EventEngine on Linux. */
+#define GRPC_ARG_TCP_LISTENER_CPU_SHARDS \
+  "grpc.experimental.tcp_listener_cpu_shards"
+/* If non-zero, TCP connections read their socket's TCP_INFO (smoothed RTT,
+   congestion window, retransmits, delivery rate, and the time limited by the
+   receive window or the send buffer) at most once per this many milliseconds
+   while they are writing. The samples are exported as tcp_info_* stats and,
+   for chttp2 connections, as "grpc.tcp_info.*" channelz socket options. By
+   default, it is disabled. Only supported by the posix EventEngine on Linux. */
+#define GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS \
+  "grpc.experimental.tcp_info_sample_interval_ms"
+/* If set to non-zero, connections over unix domain sockets move their bytes
+   through a pair of shared memory rings instead of the socket. On servers it
+   lets clients ask for the rings; clients ask for them when it is set, which
+   the "shm:" target scheme does for its addresses. A server without it set
+   cannot talk to a client that asks. By default, it is disabled. Only
+   supported by the posix EventEngine on Linux. */
+#define GRPC_ARG_SHM_TRANSPORT "grpc.experimental.shm_transport"
+/* Size in bytes of each of a server's shared memory rings (see
+   GRPC_ARG_SHM_TRANSPORT), rounded up to a power of two number of pages.
+   Defaults to 1 MiB. */
+#define GRPC_ARG_SHM_TRANSPORT_RING_SIZE \
+  "grpc.experimental.shm_transport_ring_size"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
@@ -365,6 +568,45 @@
  * timeouts/backoff/retry logic, and so the actual DNS resolution may time out
  * sooner than the value specified here. */
 #define GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS "grpc.dns_ares_query_timeout"
+/** EXPERIMENTAL. If set to a positive number of milliseconds, hostname
+ * lookups made by the EventEngine DNS resolver are shared with every other
+ * channel in the process that sets it, and their results are reused for
+ * that long, instead of each channel querying DNS on its own. This TTL is
+ * used in place of those of the DNS records, which are not reported by
+ * the resolver. Defaults to 0 (no sharing). */
+#define GRPC_ARG_EXPERIMENTAL_DNS_CACHE_TTL_MS \
+  "grpc.experimental.dns_cache_ttl_ms"
+/** EXPERIMENTAL. How long, in milliseconds, a result shared because of
+ * GRPC_ARG_EXPERIMENTAL_DNS_CACHE_TTL_MS may still be used after its TTL has
+ * passed, while it is refreshed in the background. Defaults to the TTL. */
+#define GRPC_ARG_EXPERIMENTAL_DNS_CACHE_MAX_STALE_MS \
+  "grpc.experimental.dns_cache_max_stale_ms"
+/** EXPERIMENTAL. The maximum number of connections a subchannel may open to
+ * its address. Once every connection carries
+ * GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_STREAMS_PER_CONNECTION calls, another one is
+ * opened, up to this many, and new calls go to the connection with the fewest
+ * calls. Meant for servers whose MAX_CONCURRENT_STREAMS setting would
+ * otherwise queue calls. Defaults to 1. */
+#define GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MAX_CONNECTIONS \
+  "grpc.experimental.subchannel_max_connections"
+/** EXPERIMENTAL. The number of connections a subchannel opens as soon as it
+ * is connected, whatever its load. Capped at
+ * GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MAX_CONNECTIONS. Defaults to 1. */
+#define GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MIN_CONNECTIONS \
+  "grpc.experimental.subchannel_min_connections"
+/** EXPERIMENTAL. How many calls a connection of a subchannel carries before
+ * the subchannel opens another, if
+ * GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MAX_CONNECTIONS allows. Best set to the
+ * server's MAX_CONCURRENT_STREAMS setting, or a bit less. Defaults to 100. */
+#define GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_STREAMS_PER_CONNECTION \
+  "grpc.experimental.subchannel_streams_per_connection"
+/** EXPERIMENTAL. If non-zero, the subchannels connecting to an address make
+ * one connection attempt at a time between them, across all channels in the
+ * process, and share the reconnect backoff after a failure, so that a
+ * recovering server does not get a burst of connection attempts. Boolean
+ * valued, defaults to false. */
+#define GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_SHARED_BACKOFF \
+  "grpc.experimental.subchannel_shared_backoff"
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
@@ -382,6 +624,14 @@
  * channel arg. Int valued, milliseconds. Defaults to 10 minutes.*/
 #define GRPC_ARG_SERVER_CONFIG_CHANGE_DRAIN_GRACE_TIME_MS \
   "grpc.experimental.server_config_change_drain_grace_time_ms"
+/** EXPERIMENTAL. When a server drains its connections because of an update
+ * from its config fetcher, or because the config fetcher told it to stop
+ * serving, spread the GOAWAYs evenly over this window instead of sending them
+ * all at once, so that clients do not all reconnect elsewhere at the same
+ * time. Each connection keeps serving until it is sent its GOAWAY, and then
+ * gets the full drain grace time. Int valued, milliseconds. Defaults to 0. */
+#define GRPC_ARG_SERVER_DRAIN_GOAWAY_STAGGER_WINDOW_MS \
+  "grpc.experimental.server_drain_goaway_stagger_window_ms"
 /** Configure the Differentiated Services Code Point used on outgoing packets.
  *  Integer value ranging from 0 to 63. */
 #define GRPC_ARG_DSCP "grpc.dscp"
@@ -389,6 +639,13 @@
  *  Defaults to 250ms. */
 #define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
   "grpc.happy_eyeballs_connection_attempt_delay_ms"
+/** If true, pick_first adapts the Happy Eyeballs Connection Attempt Delay
+ *  to twice the smoothed time that past connection attempts on the channel
+ *  took to succeed, within [100ms, 2s].  Until an attempt has succeeded,
+ *  GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS is used.  Boolean;
+ *  defaults to false. */
+#define GRPC_ARG_EXPERIMENTAL_HAPPY_EYEBALLS_ADAPTIVE_CONNECTION_ATTEMPT_DELAY \
+  "grpc.experimental.happy_eyeballs_adaptive_connection_attempt_delay"
 /** It accepts a MemoryAllocatorFactory as input and If specified, it forces
  * the default event engine to use memory allocators created using the provided
  * factory. */
@@ -398,10 +655,32 @@
  * If unspecified, it is unlimited */
 #define GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS \
   "grpc.max_allowed_incoming_connections"
+/** Refuse new incoming connections while the server's CPU utilization, as
+ * reported to its ServerMetricRecorder, is above this percentage. If
+ * unspecified, connections are not refused because of CPU utilization. */
+#define GRPC_ARG_MAX_CPU_UTILIZATION_FOR_INCOMING_CONNECTIONS_PERCENT \
+  "grpc.max_cpu_utilization_for_incoming_connections_percent"
 /** Configure per-channel or per-server stats plugins. */
 #define GRPC_ARG_EXPERIMENTAL_STATS_PLUGINS "grpc.experimental.stats_plugins"
 /** If non-zero, allow security frames to be sent and received. */
 #define GRPC_ARG_SECURITY_FRAME_ALLOWED "grpc.security_frame_allowed"
+/** Window within which the client channel coalesces LB picker updates that
+ *  leave its connectivity state unchanged.  The first such update is used
+ *  immediately; of those that follow within the window, only the last is
+ *  used, when the window ends.  Updates that change the connectivity state
+ *  are never delayed.  Int valued, milliseconds; defaults to 0, which
+ *  disables coalescing. */
+#define GRPC_ARG_EXPERIMENTAL_PICKER_UPDATE_COALESCING_WINDOW_MS \
+  "grpc.experimental.picker_update_coalescing_window_ms"
+/** If true, C++ channels created with Server::InProcessChannel() pass message
+ *  objects to the server instead of serializing them, when the method's
+ *  request and response types can be copied, and the server does the same for
+ *  responses to requests that arrived as objects.  Filters and interceptors
+ *  that look at serialized messages see a placeholder, and max message sizes
+ *  are not enforced for such messages.  Ignored by other channels.  Boolean;
+ *  defaults to false. */
+#define GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS \
+  "grpc.experimental.inproc_pass_message_objects"
 /** \} */
 
 #endif /* GRPC_IMPL_CHANNEL_ARG_NAMES_H */
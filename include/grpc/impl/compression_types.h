@@ -42,15 +42,16 @@ extern "C" {
 #define GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM \
   "grpc.default_compression_algorithm"
 /** Default compression level for the channel.
- * Its value is an int from the \a grpc_compression_level enum. */
+ * Its value is an int from the \a grpc_compression_level enum. It also sets
+ * the effort of the algorithms that have several (zstd and lz4). */
 #define GRPC_COMPRESSION_CHANNEL_DEFAULT_LEVEL "grpc.default_compression_level"
 /** Compression algorithms supported by the channel.
  * Its value is a bitset (an int). Bits correspond to algorithms in \a
  * grpc_compression_algorithm. For example, its LSB corresponds to
  * GRPC_COMPRESS_NONE, the next bit to GRPC_COMPRESS_DEFLATE, etc.
- * Unset bits disable support for the algorithm. By default all algorithms are
- * supported. It's not possible to disable GRPC_COMPRESS_NONE (the attempt will
- * be ignored). */
+ * Unset bits disable support for the algorithm. By default all algorithms that
+ * gRPC was built with are supported. It's not possible to disable
+ * GRPC_COMPRESS_NONE (the attempt will be ignored). */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
 /** \} */
@@ -61,6 +62,10 @@ typedef enum {
   GRPC_COMPRESS_NONE = 0,
   GRPC_COMPRESS_DEFLATE,
   GRPC_COMPRESS_GZIP,
+  /** Only available when gRPC is built with libzstd. */
+  GRPC_COMPRESS_ZSTD,
+  /** Only available when gRPC is built with liblz4. */
+  GRPC_COMPRESS_LZ4,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
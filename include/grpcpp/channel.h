@@ -33,6 +33,7 @@
 struct grpc_channel;
 
 namespace grpc {
+class Server;
 namespace testing {
 class ChannelTestPeer;
 }  // namespace testing
@@ -80,6 +81,7 @@ class Channel final : public grpc::ChannelInterface,
           grpc::experimental::ClientInterceptorFactoryInterface>>
           interceptor_creators);
   friend class grpc::internal::InterceptedChannel;
+  friend class grpc::Server;
   Channel(const std::string& host, grpc_channel* c_channel,
           std::vector<std::unique_ptr<
               grpc::experimental::ClientInterceptorFactoryInterface>>
@@ -119,6 +121,10 @@ class Channel final : public grpc::ChannelInterface,
   std::vector<
       std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
       interceptor_creators_;
+
+  // Set by Server::InProcessChannel() when
+  // GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS is given.
+  bool pass_message_objects_ = false;
 };
 
 }  // namespace grpc
@@ -48,6 +48,7 @@
 #include <grpcpp/support/string_ref.h>
 #include <grpcpp/support/time.h>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -169,10 +170,37 @@ class PropagationOptions {
     return *this;
   }
 
+  /// EXPERIMENTAL: With deadline propagation, end the new call \a reserve
+  /// before the server call's deadline. This leaves time for the round trip
+  /// to the downstream server, for queueing there, and for the server call to
+  /// finish once the new call is done.
+  PropagationOptions& set_deadline_reserve(std::chrono::microseconds reserve) {
+    deadline_reserve_ = reserve;
+    return *this;
+  }
+
+  /// EXPERIMENTAL: With deadline propagation, fail the new call right away
+  /// with DEADLINE_EXCEEDED, without sending it, if it would be left less than
+  /// \a min_budget (after the reserve) before its deadline. Meant to be set
+  /// per method, to about the least time in which the method can succeed.
+  PropagationOptions& set_min_deadline_budget(
+      std::chrono::microseconds min_budget) {
+    min_deadline_budget_ = min_budget;
+    return *this;
+  }
+
   uint32_t c_bitmask() const { return propagate_; }
+  std::chrono::microseconds deadline_reserve() const {
+    return deadline_reserve_;
+  }
+  std::chrono::microseconds min_deadline_budget() const {
+    return min_deadline_budget_;
+  }
 
  private:
   uint32_t propagate_;
+  std::chrono::microseconds deadline_reserve_{0};
+  std::chrono::microseconds min_deadline_budget_{0};
 };
 
 /// A ClientContext allows the person implementing a service client to:
@@ -188,7 +216,8 @@ class PropagationOptions {
 /// compression options, can be made persistent at channel construction time
 /// (see \a grpc::CreateCustomChannel).
 ///
-/// \warning ClientContext instances should \em not be reused across rpcs.
+/// \warning ClientContext instances should \em not be reused across rpcs,
+///          unless \a Reset is called between them.
 /// \warning The ClientContext instance used for creating an rpc must remain
 ///          alive and valid for the lifetime of the rpc.
 class ClientContext {
@@ -213,6 +242,18 @@ class ClientContext {
       const grpc::CallbackServerContext& server_context,
       PropagationOptions options = PropagationOptions());
 
+  /// Return this context to the state of a newly constructed one, so that it
+  /// can be used for another rpc. Unlike constructing a new context, this
+  /// keeps the storage for received metadata and interceptors, so that a
+  /// client making many sequential rpcs can keep a context per in-flight rpc
+  /// instead of allocating one per rpc.
+  ///
+  /// \warning This method must only be called once the previous rpc has
+  /// completed (e.g., once \a ClientUnaryReactor::OnDone or the completion
+  /// callback has been invoked, or \a Finish has returned), and not from
+  /// another thread while the context is in use.
+  void Reset();
+
   /// Add the (\a meta_key, \a meta_value) pair to the metadata associated with
   /// a client call. These are made available at the server side by the \a
   /// grpc::ServerContext::client_metadata() method.
@@ -465,8 +506,10 @@ class ClientContext {
       const std::vector<std::unique_ptr<
           grpc::experimental::ClientInterceptorFactoryInterface>>& creators,
       size_t interceptor_pos) {
-    rpc_info_ = grpc::experimental::ClientRpcInfo(this, type, method,
-                                                  suffix_for_stats, channel);
+    // Not a move assignment, which would drop the storage that Reset keeps.
+    rpc_info_.Bind(
+        this, static_cast<grpc::experimental::ClientRpcInfo::Type>(type),
+        method, suffix_for_stats, channel);
     rpc_info_.RegisterInterceptors(creators, interceptor_pos);
     return &rpc_info_;
   }
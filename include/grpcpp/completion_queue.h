@@ -184,6 +184,21 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
             GOT_EVENT);
   }
 
+  /// Like \a Next, but once an event is available, also returns the events
+  /// that are already queued behind it, up to \a max_events in all, without
+  /// blocking again.  This saves a trip through the poller for each event
+  /// when the queue is busy.
+  ///
+  /// \param[out] tags Upon success, the first n entries are set to the tags
+  ///        of the events read.
+  /// \param[out] oks Upon success, the first n entries are set to the \a ok
+  ///        values of the events read.  See \a Next.
+  /// \param[in] max_events The size of \a tags and \a oks; at least 1.
+  ///
+  /// \return The number of events read, n.  0 if the queue is fully drained
+  ///         and shut down.
+  size_t NextBatch(void** tags, bool* oks, size_t max_events);
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
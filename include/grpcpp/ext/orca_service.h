@@ -27,6 +27,7 @@
 #include <grpcpp/support/status.h>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 
 #include "absl/base/thread_annotations.h"
@@ -48,12 +49,28 @@ class OrcaService : public Service {
     // Minimum report interval.  If a client requests an interval lower
     // than this value, this value will be used instead.
     absl::Duration min_report_duration = absl::Seconds(30);
+    // If set, a report is only sent at the end of a report interval if some
+    // metric has changed by more than this fraction of the value last
+    // reported, or a metric has been set or cleared since.  Otherwise,
+    // every report interval gets a report.
+    std::optional<double> change_threshold;
+    // When change_threshold is set, the longest a client goes without a
+    // report, even if no metric has changed significantly.
+    absl::Duration max_report_duration = absl::Minutes(1);
 
     Options() = default;
     Options& set_min_report_duration(absl::Duration duration) {
       min_report_duration = duration;
       return *this;
     }
+    Options& set_change_threshold(double threshold) {
+      change_threshold = threshold;
+      return *this;
+    }
+    Options& set_max_report_duration(absl::Duration duration) {
+      max_report_duration = duration;
+      return *this;
+    }
   };
 
   // ServerMetricRecorder is required.
@@ -71,15 +88,25 @@ class OrcaService : public Service {
   class Reactor;
   friend class testing::OrcaServiceTest;
 
-  Slice GetOrCreateSerializedResponse();
+  // Returns the current metrics, serialized. Sets *generation to a number
+  // that changes only when the metrics change significantly.
+  Slice GetOrCreateSerializedResponse(uint64_t* generation);
 
   const ServerMetricRecorder* const server_metric_recorder_;
   const absl::Duration min_report_duration_;
+  const std::optional<double> change_threshold_;
+  const absl::Duration max_report_duration_;
   grpc::internal::Mutex mu_;
   // Contains the last serialized metrics from server_metric_recorder_.
   std::optional<Slice> response_slice_ ABSL_GUARDED_BY(mu_);
   // The update sequence number of metrics serialized in response_slice_.
   std::optional<uint64_t> response_slice_seq_ ABSL_GUARDED_BY(mu_);
+  // The metrics as of the last significant change, which later metrics are
+  // compared against. Only kept if change_threshold_ is set.
+  std::shared_ptr<const ServerMetricRecorder::BackendMetricDataState>
+      significant_state_ ABSL_GUARDED_BY(mu_);
+  // Incremented on each significant change.
+  uint64_t generation_ ABSL_GUARDED_BY(mu_) = 0;
 };
 
 }  // namespace experimental
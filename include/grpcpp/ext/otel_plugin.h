@@ -153,6 +153,8 @@ class OpenTelemetryPluginBuilder {
       absl::string_view optional_label_key);
   /// EXPERIMENTAL API
   /// If `SetTracerProvider()` is not called, no traces are collected.
+  /// Calls whose parent span is not sampled are not sampled either, and no
+  /// spans are started for them, whatever the sampler of \a tracer_provider.
   OpenTelemetryPluginBuilder& SetTracerProvider(
       std::shared_ptr<opentelemetry::trace::TracerProvider> tracer_provider);
   /// EXPERIMENTAL API
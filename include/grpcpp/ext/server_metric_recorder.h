@@ -22,16 +22,20 @@
 #include <grpcpp/impl/sync.h>
 #include <grpcpp/support/string_ref.h>
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 
 namespace grpc_core {
 struct BackendMetricData;
+class LatencySketch;
 }  // namespace grpc_core
 
 namespace grpc {
 class BackendMetricState;
+class ServerCpuUtilizationSource;
 
 namespace experimental {
 /// Records server wide metrics to be reported to the client.
@@ -43,6 +47,7 @@ class ServerMetricRecorder {
  public:
   // Factory method. Use this to create.
   static std::unique_ptr<ServerMetricRecorder> Create();
+  ~ServerMetricRecorder();
   /// Records the server CPU utilization in the range [0, infy).
   /// Values may be larger than 1.0 when the usage exceeds the reporter
   /// dependent notion of soft limits. Values outside of the valid range are
@@ -76,6 +81,26 @@ class ServerMetricRecorder {
   /// in this recorder. It is assumed that strings are common names that are
   /// global constants.
   void SetAllNamedUtilization(std::map<string_ref, double> named_utilization);
+  /// Enables reporting percentiles of call latencies. Latencies are kept in a
+  /// streaming sketch, and their 50th, 90th and 99th percentiles are reported
+  /// in seconds as the named metrics "grpc.server.call_latency.p50",
+  /// "grpc.server.call_latency.p90" and "grpc.server.call_latency.p99".
+  /// The percentiles are refreshed at most once a second.
+  /// Should be called before the recorder is passed to a server.
+  void EnableCallLatencyPercentiles();
+  /// Records the latency of a call in seconds, if call latency percentiles
+  /// are enabled. Servers that record call metrics with this recorder (see
+  /// ServerBuilder::EnableCallMetricRecording()) record the latency of each
+  /// of their calls automatically.
+  void RecordCallLatency(double seconds);
+  /// Enables filling in the CPU utilization from the CPU time that the
+  /// process's server calls use, both in gRPC and in their method handlers,
+  /// divided by the wall time and the number of cores. This turns on CPU
+  /// accounting for all server calls in the process. The utilization is
+  /// refreshed at most once a second, as calls that record call metrics with
+  /// this recorder end, and overrides values set with SetCpuUtilization().
+  /// Should be called before the recorder is passed to a server.
+  void EnableCallCpuUtilization();
 
   /// Clears the server CPU utilization if recorded.
   void ClearCpuUtilization();
@@ -93,6 +118,7 @@ class ServerMetricRecorder {
  private:
   // To access GetMetrics().
   friend class grpc::BackendMetricState;
+  friend class grpc::ServerCpuUtilizationSource;
   friend class OrcaService;
 
   struct BackendMetricDataState;
@@ -109,10 +135,27 @@ class ServerMetricRecorder {
   // Returned metric data is guaranteed to be identical between two calls if the
   // sequence numbers match.
   std::shared_ptr<const BackendMetricDataState> GetMetricsIfChanged() const;
+  // Recomputes the CPU utilization from the CPU time of calls, if enabled
+  // and due.
+  void MaybeRefreshCallCpuUtilization();
 
   mutable grpc::internal::Mutex mu_;
   std::shared_ptr<const BackendMetricDataState> metric_state_
       ABSL_GUARDED_BY(mu_);
+  // Set once by EnableCallLatencyPercentiles(); owned by this.
+  std::atomic<grpc_core::LatencySketch*> call_latency_{nullptr};
+  // The monotonic time, in milliseconds, at which the call latency
+  // percentiles should next be written to metric_state_.
+  std::atomic<int64_t> next_call_latency_refresh_ms_{0};
+  // Set once by EnableCallCpuUtilization().
+  std::atomic<bool> call_cpu_utilization_{false};
+  // The monotonic time, in milliseconds, at which the CPU utilization should
+  // next be computed from the CPU time of calls.
+  std::atomic<int64_t> next_call_cpu_refresh_ms_{0};
+  // The CPU time of calls and the monotonic time, both in nanoseconds, when
+  // the CPU utilization was last computed.
+  int64_t last_call_cpu_nanos_ ABSL_GUARDED_BY(mu_) = 0;
+  int64_t last_call_cpu_time_nanos_ ABSL_GUARDED_BY(mu_) = 0;
 };
 
 }  // namespace experimental
@@ -0,0 +1,103 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_GENERIC_BATCHING_GENERIC_SERVICE_H
+#define GRPCPP_GENERIC_BATCHING_GENERIC_SERVICE_H
+
+#include <grpcpp/generic/callback_generic_service.h>
+#include <grpcpp/impl/sync.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace grpc {
+
+class AuthContext;
+class Channel;
+class ServerContextBase;
+
+namespace experimental {
+
+/// Options for a \a BatchingGenericService.
+struct BatchingGenericServiceOptions {
+  /// The most calls of one batch stream that run at the same time. Once a
+  /// stream reaches it, the service stops reading the stream until some of
+  /// its calls complete.
+  size_t max_outstanding_calls = 1000;
+};
+
+/// Serves the batch streams of \a BatchingStub. Each call in a batch is run
+/// as a unary call on the server's own handler for its method, over an
+/// in-process channel, so services need no changes to be called in batches.
+/// The handlers see the deadline, cancellation and client metadata of the
+/// batch stream. Their own peer and auth context are those of the
+/// in-process channel: \a CallerPeer and \a CallerAuthContext return the
+/// batch stream's.
+///
+/// Register it with \a ServerBuilder::RegisterCallbackGenericService. Calls
+/// to other unregistered methods fail with UNIMPLEMENTED, so it cannot be
+/// combined with another generic service.
+class BatchingGenericService final : public CallbackGenericService {
+ public:
+  explicit BatchingGenericService(
+      BatchingGenericServiceOptions options = BatchingGenericServiceOptions());
+  ~BatchingGenericService() override;
+
+  ServerGenericBidiReactor* CreateReactor(
+      GenericCallbackServerContext* ctx) override;
+
+  /// Returns the peer of the client that sent the call of \a ctx: for a
+  /// call run from a batch stream, the peer of the stream, and otherwise
+  /// ctx.peer().
+  std::string CallerPeer(const grpc::ServerContextBase& ctx);
+  /// Returns the auth context of the client that sent the call of \a ctx,
+  /// as \a CallerPeer does for the peer.
+  std::shared_ptr<const grpc::AuthContext> CallerAuthContext(
+      const grpc::ServerContextBase& ctx);
+
+ private:
+  class Reactor;
+
+  // The client of a batch stream.
+  struct Caller {
+    std::string peer;
+    std::shared_ptr<const grpc::AuthContext> auth_context;
+  };
+
+  std::shared_ptr<grpc::Channel> InProcessChannel();
+  // Registers the client of a batch stream, and returns the tag that the
+  // calls of the stream carry.
+  uint64_t AddCaller(std::string peer,
+                     std::shared_ptr<const grpc::AuthContext> auth_context);
+  void RemoveCaller(uint64_t tag);
+  const Caller* FindCallerLocked(const grpc::ServerContextBase& ctx)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const BatchingGenericServiceOptions options_;
+  grpc::internal::Mutex mu_;
+  std::shared_ptr<grpc::Channel> channel_;
+  std::map<uint64_t, Caller> callers_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_GENERIC_BATCHING_GENERIC_SERVICE_H
@@ -0,0 +1,114 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_GENERIC_BATCHING_STUB_H
+#define GRPCPP_GENERIC_BATCHING_STUB_H
+
+#include <grpcpp/generic/generic_stub_callback.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/status.h>
+#include <stddef.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace grpc {
+
+class ChannelInterface;
+
+namespace experimental {
+
+/// Options for a \a BatchingStub.
+struct BatchingStubOptions {
+  /// The most calls sent to the server in one message of a batch stream.
+  size_t max_batch_calls = 64;
+  /// The most request bytes sent in one message of a batch stream. A
+  /// request larger than this is sent in a message of its own.
+  size_t max_batch_bytes = 64 * 1024;
+  /// The most calls sent on one batch stream. Later calls go to a new
+  /// stream, which the channel may send to another backend, so that a
+  /// long-lived stub keeps spreading its calls as backends come and go. Must
+  /// be at least 1.
+  size_t max_stream_calls = 10000;
+};
+
+/// A \a BatchingStub makes unary calls by name, like \a GenericStubCallback,
+/// but sends the calls to each method on one long-lived bidi stream, replaced
+/// by a new one every \a BatchingStubOptions::max_stream_calls calls. A call
+/// made while the previous message of the stream is being written waits for
+/// that write, and is sent together with the other calls made meanwhile.
+/// Many small calls thus share the cost of the stream and its headers,
+/// without adding latency when there is nothing to batch with.
+///
+/// The server must register a \a BatchingGenericService, which runs each
+/// call in a batch as a unary call on the server's own handler. If it has
+/// not, the batch stream fails with UNIMPLEMENTED, and the stub sends the
+/// calls to that method as ordinary unary calls from then on.
+///
+/// The calls in a batch have no \a ClientContext of their own: they are
+/// sent without metadata, deadline or call credentials, and should only be
+/// used for methods that do not need them. The server sees the channel's
+/// peer and credentials through \a BatchingGenericService::CallerPeer and
+/// \a BatchingGenericService::CallerAuthContext.
+class BatchingStub final {
+ public:
+  explicit BatchingStub(std::shared_ptr<grpc::ChannelInterface> channel,
+                        BatchingStubOptions options = BatchingStubOptions());
+
+  /// Closes the batch streams, waiting for the calls on them to complete.
+  ~BatchingStub();
+
+  BatchingStub(const BatchingStub&) = delete;
+  BatchingStub& operator=(const BatchingStub&) = delete;
+
+  /// Makes a unary call to \a method, the full method name as in
+  /// "/package.Service/Method". \a request and \a response must stay valid
+  /// until \a on_completion is called.
+  void UnaryCall(const std::string& method, const grpc::ByteBuffer* request,
+                 grpc::ByteBuffer* response,
+                 std::function<void(grpc::Status)> on_completion);
+
+ private:
+  struct Call;
+  class Stream;
+
+  // Sends a call as an ordinary unary call.
+  void SendUnbatched(const std::string& method, Call call);
+  // Called by a stream when it is done, to complete or resend the calls
+  // that got no result on it.
+  void StreamDone(Stream* stream, const grpc::Status& status);
+
+  GenericStubCallback generic_stub_;
+  const BatchingStubOptions options_;
+  grpc::internal::Mutex mu_;
+  grpc::internal::CondVar cv_;
+  // The stream that new calls to each method go to.
+  std::map<std::string, Stream*> streams_;
+  // Methods that the server does not serve batch streams for.
+  std::set<std::string> unbatched_methods_;
+  size_t live_streams_ = 0;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_GENERIC_BATCHING_STUB_H
@@ -28,6 +28,10 @@ struct grpc_server;
 
 namespace grpc {
 
+namespace experimental {
+class BatchingGenericService;
+}  // namespace experimental
+
 /// \a ServerGenericBidiReactor is the reactor class for bidi streaming RPCs
 /// invoked on a CallbackGenericService. It is just a ServerBidi reactor with
 /// ByteBuffer arguments.
@@ -68,6 +72,7 @@ class CallbackGenericService {
 
  private:
   friend class grpc::Server;
+  friend class experimental::BatchingGenericService;
 
   internal::CallbackBidiHandler<ByteBuffer, ByteBuffer>* Handler() {
     return new internal::CallbackBidiHandler<ByteBuffer, ByteBuffer>(
@@ -0,0 +1,72 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_GENERIC_GENERIC_PROXY_H
+#define GRPCPP_GENERIC_GENERIC_PROXY_H
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/generic/callback_generic_service.h>
+#include <grpcpp/generic/generic_stub_callback.h>
+#include <grpcpp/support/string_ref.h>
+
+#include <functional>
+#include <map>
+#include <string>
+
+namespace grpc {
+namespace experimental {
+
+/// Hooks to adjust the calls forwarded by a generic proxy reactor.
+struct GenericProxyOptions {
+  /// Sets the metadata of the upstream call from the downstream call. If
+  /// unset, the client's metadata is forwarded, except for reserved keys
+  /// such as "grpc-*", "content-type" and "user-agent". The deadline and
+  /// cancellation of the downstream call propagate either way.
+  std::function<void(const GenericCallbackServerContext& downstream,
+                     ClientContext* upstream)>
+      rewrite_request_metadata;
+  /// Adds the upstream server's initial or trailing metadata to the
+  /// downstream call, with AddInitialMetadata or AddTrailingMetadata. If
+  /// unset, all of it is forwarded, except for reserved keys.
+  using ResponseMetadataRewriter = std::function<void(
+      const std::multimap<grpc::string_ref, grpc::string_ref>& upstream,
+      GenericCallbackServerContext* downstream)>;
+  ResponseMetadataRewriter rewrite_initial_metadata;
+  ResponseMetadataRewriter rewrite_trailing_metadata;
+  /// The method called upstream. If empty, the downstream call's method.
+  std::string method;
+};
+
+/// Returns a reactor that serves the call of \a context by forwarding it
+/// through \a stub, for a \a CallbackGenericService used as a proxy.
+///
+/// Messages are moved between the two calls without being copied or
+/// parsed, and without a completion queue: the buffer read from one call is
+/// the one written to the other. Each direction has at most one message in
+/// flight, so a slow reader on either side stops the proxy from reading
+/// from the other. The upstream call's status is the downstream call's.
+///
+/// \a stub must outlive the call.
+ServerGenericBidiReactor* NewGenericProxyReactor(
+    GenericCallbackServerContext* context, GenericStubCallback* stub,
+    GenericProxyOptions options = GenericProxyOptions());
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_GENERIC_GENERIC_PROXY_H
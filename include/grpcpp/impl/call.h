@@ -80,6 +80,11 @@ class Call final {
     return server_rpc_info_;
   }
 
+  /// Whether messages sent on this call can be passed as objects, because
+  /// the other end is in this process and reads them with the C++ API.
+  bool pass_message_objects() const { return pass_message_objects_; }
+  void set_pass_message_objects(bool pass) { pass_message_objects_ = pass; }
+
  private:
   CallHook* call_hook_;
   grpc::CompletionQueue* cq_;
@@ -87,6 +92,7 @@ class Call final {
   int max_receive_message_size_;
   experimental::ClientRpcInfo* client_rpc_info_ = nullptr;
   experimental::ServerRpcInfo* server_rpc_info_ = nullptr;
+  bool pass_message_objects_ = false;
 };
 }  // namespace internal
 }  // namespace grpc
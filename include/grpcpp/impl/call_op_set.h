@@ -32,6 +32,7 @@
 #include <grpcpp/impl/codegen/intercepted_channel.h>
 #include <grpcpp/impl/completion_queue_tag.h>
 #include <grpcpp/impl/interceptor_common.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/impl/serialization_traits.h>
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/config.h>
@@ -41,6 +42,7 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <type_traits>
 
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
@@ -315,15 +317,22 @@ class CallOpSendMessage {
     if (msg_ == nullptr && !send_buf_.Valid()) return;
     if (hijacked_) {
       serializer_ = nullptr;
+      wrapper_ = nullptr;
       return;
     }
-    if (msg_ != nullptr) {
+    uint32_t flags = write_options_.flags();
+    if (msg_ != nullptr && pass_message_objects_ && wrapper_ != nullptr) {
+      // There are no bytes to compress.
+      send_buf_.set_buffer(wrapper_(msg_));
+      flags |= GRPC_WRITE_NO_COMPRESS;
+    } else if (msg_ != nullptr) {
       ABSL_CHECK(serializer_(msg_).ok());
     }
     serializer_ = nullptr;
+    wrapper_ = nullptr;
     grpc_op* op = &ops[(*nops)++];
     op->op = GRPC_OP_SEND_MESSAGE;
-    op->flags = write_options_.flags();
+    op->flags = flags;
     op->reserved = nullptr;
     op->data.send_message.send_message = send_buf_.c_buffer();
     // Flags are per-message: clear them after use.
@@ -368,13 +377,19 @@ class CallOpSendMessage {
     hijacked_ = true;
   }
 
+  // Set from Call::pass_message_objects() before the op is added.
+  void set_pass_message_objects(bool pass) { pass_message_objects_ = pass; }
+
  private:
   const void* msg_ = nullptr;  // The original non-serialized message
   bool hijacked_ = false;
   bool failed_send_ = false;
+  bool pass_message_objects_ = false;
   ByteBuffer send_buf_;
   WriteOptions write_options_;
   std::function<Status(const void*)> serializer_;
+  // Set by SendMessagePtr() for types that can be passed as objects.
+  grpc_byte_buffer* (*wrapper_)(const void*) = nullptr;
 };
 
 template <class M>
@@ -414,6 +429,9 @@ Status CallOpSendMessage::SendMessagePtr(const M* message,
     }
     return result;
   };
+  if constexpr (MessageObjects::kSupported<M>) {
+    wrapper_ = &MessageObjects::Wrap<M>;
+  }
   return Status();
 }
 
@@ -447,8 +465,7 @@ class CallOpRecvMessage {
     if (recv_buf_.Valid()) {
       if (*status) {
         got_message = *status =
-            SerializationTraits<R>::Deserialize(recv_buf_.bbuf_ptr(), message_)
-                .ok();
+            MessageObjects::Deserialize(recv_buf_.bbuf_ptr(), message_).ok();
         recv_buf_.Release();
       } else {
         got_message = false;
@@ -516,7 +533,7 @@ class DeserializeFuncType final : public DeserializeFunc {
  public:
   explicit DeserializeFuncType(R* message) : message_(message) {}
   Status Deserialize(ByteBuffer* buf) override {
-    return SerializationTraits<R>::Deserialize(buf->bbuf_ptr(), message_);
+    return MessageObjects::Deserialize(buf->bbuf_ptr(), message_);
   }
 
   ~DeserializeFuncType() override {}
@@ -897,6 +914,10 @@ class CallOpSet : public CallOpSetInterface,
     grpc_call_ref(call->call());
     call_ =
         *call;  // It's fine to create a copy of call since it's just pointers
+    if constexpr (std::is_base_of<CallOpSendMessage, CallOpSet>::value) {
+      this->CallOpSendMessage::set_pass_message_objects(
+          call->pass_message_objects());
+    }
 
     if (RunInterceptors()) {
       ContinueFillOpsAfterInterception();
@@ -1023,7 +1044,16 @@ class CallOpSet : public CallOpSetInterface,
     this->Op4::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op5::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op6::SetFinishInterceptionHookPoint(&interceptor_methods_);
-    return interceptor_methods_.RunInterceptors();
+    if (interceptor_methods_.InterceptorsListEmpty()) {
+      return true;
+    }
+    if (interceptor_methods_.RunInterceptors()) {
+      // None of the interceptors intercepts these hook points, so this batch
+      // is done without the extra round trip through the core.
+      call_.cq()->CompleteAvalanching();
+      return true;
+    }
+    return false;
   }
 
   void* core_cq_tag_;
@@ -45,7 +45,11 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
                 "::protobuf::io::ZeroCopyOutputStream");
   *own_buffer = true;
   int byte_size = static_cast<int>(msg.ByteSizeLong());
-  if (static_cast<size_t>(byte_size) <= GRPC_SLICE_INLINED_SIZE) {
+  // A message that fits in one block (which is most of them) goes into a
+  // single slice of exactly its size, inlined if it is small enough.  This
+  // skips the writer and the CodedOutputStream, whose buffering is only
+  // needed to spread larger messages over several slices.
+  if (byte_size <= kProtoBufferWriterMaxBufferLength) {
     Slice slice(byte_size);
     // We serialize directly into the allocated slices memory
     ABSL_CHECK(slice.end() == msg.SerializeWithCachedSizesToArray(
@@ -26,6 +26,8 @@
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/server_interceptor.h>
 
+#include <stdint.h>
+
 #include <array>
 #include <functional>
 
@@ -37,20 +39,13 @@ namespace internal {
 class InterceptorBatchMethodsImpl
     : public experimental::InterceptorBatchMethods {
  public:
-  InterceptorBatchMethodsImpl() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  InterceptorBatchMethodsImpl() {}
 
   ~InterceptorBatchMethodsImpl() override {}
 
   bool QueryInterceptionHookPoint(
       experimental::InterceptionHookPoints type) override {
-    return hooks_[static_cast<size_t>(type)];
+    return (hook_points_ & HookPointBit(type)) != 0;
   }
 
   void Proceed() override {
@@ -77,7 +72,7 @@ class InterceptorBatchMethodsImpl
   }
 
   void AddInterceptionHookPoint(experimental::InterceptionHookPoints type) {
-    hooks_[static_cast<size_t>(type)] = true;
+    hook_points_ |= HookPointBit(type);
   }
 
   ByteBuffer* GetSerializedSendMessage() override {
@@ -130,8 +125,8 @@ class InterceptorBatchMethodsImpl
   Status* GetRecvStatus() override { return recv_status_; }
 
   void FailHijackedSendMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE)]);
+    ABSL_CHECK(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE));
     *fail_send_message_ = true;
   }
 
@@ -193,8 +188,8 @@ class InterceptorBatchMethodsImpl
   }
 
   void FailHijackedRecvMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE)]);
+    ABSL_CHECK(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE));
     *hijacked_recv_message_failed_ = true;
   }
 
@@ -235,12 +230,14 @@ class InterceptorBatchMethodsImpl
   // SetCallOpSetInterface should have been called before this. After all the
   // interceptors are done running, either ContinueFillOpsAfterInterception or
   // ContinueFinalizeOpsAfterInterception will be called. Note that neither of
-  // them is invoked if there were no interceptors registered.
+  // them is invoked if there were no interceptors registered, or if none of
+  // them intercepts the hook points of this batch.
   bool RunInterceptors() {
     ABSL_CHECK(ops_);
     auto* client_rpc_info = call_->client_rpc_info();
     if (client_rpc_info != nullptr) {
-      if (client_rpc_info->interceptors_.empty()) {
+      if (!client_rpc_info->hijacked_ &&
+          (client_rpc_info->any_hook_points_ & hook_points_) == 0) {
         return true;
       } else {
         RunClientInterceptors();
@@ -249,7 +246,8 @@ class InterceptorBatchMethodsImpl
     }
 
     auto* server_rpc_info = call_->server_rpc_info();
-    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty()) {
+    if (server_rpc_info == nullptr ||
+        (server_rpc_info->any_hook_points_ & hook_points_) == 0) {
       return true;
     }
     RunServerInterceptors();
@@ -265,7 +263,8 @@ class InterceptorBatchMethodsImpl
     ABSL_CHECK_EQ(reverse_, true);
     ABSL_CHECK_EQ(call_->client_rpc_info(), nullptr);
     auto* server_rpc_info = call_->server_rpc_info();
-    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty()) {
+    if (server_rpc_info == nullptr ||
+        (server_rpc_info->any_hook_points_ & hook_points_) == 0) {
       return true;
     }
     callback_ = std::move(f);
@@ -285,7 +284,7 @@ class InterceptorBatchMethodsImpl
         current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
       }
     }
-    rpc_info->RunInterceptor(this, current_interceptor_index_);
+    RunClientInterceptor(rpc_info);
   }
 
   void RunServerInterceptors() {
@@ -295,7 +294,7 @@ class InterceptorBatchMethodsImpl
     } else {
       current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
     }
-    rpc_info->RunInterceptor(this, current_interceptor_index_);
+    RunServerInterceptor(rpc_info);
   }
 
   void ProceedClient() {
@@ -319,7 +318,7 @@ class InterceptorBatchMethodsImpl
           // This is a hijacked RPC and we are done with hijacking
           ops_->ContinueFillOpsAfterInterception();
         } else {
-          rpc_info->RunInterceptor(this, current_interceptor_index_);
+          RunClientInterceptor(rpc_info);
         }
       } else {
         // we are done running all the interceptors without any hijacking
@@ -330,7 +329,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        rpc_info->RunInterceptor(this, current_interceptor_index_);
+        RunClientInterceptor(rpc_info);
       } else {
         // we are done running all the interceptors without any hijacking
         ops_->ContinueFinalizeResultAfterInterception();
@@ -343,7 +342,7 @@ class InterceptorBatchMethodsImpl
     if (!reverse_) {
       current_interceptor_index_++;
       if (current_interceptor_index_ < rpc_info->interceptors_.size()) {
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunServerInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFillOpsAfterInterception();
       }
@@ -352,7 +351,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunServerInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFinalizeResultAfterInterception();
       }
@@ -361,19 +360,30 @@ class InterceptorBatchMethodsImpl
     callback_();
   }
 
-  void ClearHookPoints() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
+  // Runs the interceptor at current_interceptor_index_, unless it does not
+  // intercept any hook point of this batch, in which case the batch just
+  // proceeds past it.  Nothing is skipped once the RPC has been hijacked,
+  // since the hijacking interceptor then has to see every batch.
+  void RunClientInterceptor(experimental::ClientRpcInfo* rpc_info) {
+    if (!rpc_info->hijacked_ &&
+        (rpc_info->hook_points_[current_interceptor_index_] & hook_points_) ==
+            0) {
+      return ProceedClient();
+    }
+    rpc_info->RunInterceptor(this, current_interceptor_index_);
+  }
+
+  void RunServerInterceptor(experimental::ServerRpcInfo* rpc_info) {
+    if ((rpc_info->hook_points_[current_interceptor_index_] & hook_points_) ==
+        0) {
+      return ProceedServer();
     }
+    rpc_info->RunInterceptor(this, current_interceptor_index_);
   }
 
-  std::array<bool,
-             static_cast<size_t>(
-                 experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS)>
-      hooks_;
+  void ClearHookPoints() { hook_points_ = 0; }
+
+  uint32_t hook_points_ = 0;  // Mask of the hook points of this batch
 
   size_t current_interceptor_index_ = 0;  // Current iterator
   bool reverse_ = false;
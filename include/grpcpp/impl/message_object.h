@@ -0,0 +1,124 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_IMPL_MESSAGE_OBJECT_H
+#define GRPCPP_IMPL_MESSAGE_OBJECT_H
+
+#include <grpc/byte_buffer.h>
+#include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/status.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace grpc {
+namespace internal {
+
+// Type-erased operations on a message object carried in a byte buffer.
+// Objects are of the same C++ type iff their ops tables are the same.
+struct MessageObjectOps {
+  void (*destroy)(void* object);
+  Status (*serialize)(const void* object, grpc_byte_buffer** bytes);
+};
+
+// Returns a byte buffer that carries \a object instead of its serialized
+// bytes, taking ownership of it. Only for calls where both ends are in this
+// process.
+grpc_byte_buffer* WrapMessageObject(void* object, const MessageObjectOps* ops);
+
+// Whether \a buffer was returned by WrapMessageObject().
+bool IsMessageObject(grpc_byte_buffer* buffer);
+
+// If \a buffer carries an object with the given \a ops, takes the object out
+// of it and returns it. Otherwise returns nullptr.
+void* TakeMessageObject(grpc_byte_buffer* buffer, const MessageObjectOps* ops);
+
+// If \a buffer carries an object, replaces the object with its serialized
+// bytes, so that \a buffer can be read like any other.
+Status MaterializeMessageObject(grpc_byte_buffer* buffer);
+
+/// Passes message objects through byte buffers, for channels created with
+/// GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS.
+class MessageObjects {
+ public:
+  // Types that can be passed as objects. The sender keeps its message, so
+  // it has to be copied.
+  template <class M>
+  static constexpr bool kSupported = std::is_copy_constructible<M>::value &&
+                                     std::is_move_assignable<M>::value &&
+                                     !std::is_same<M, ByteBuffer>::value;
+
+  // Returns a byte buffer carrying a copy of \a message.
+  template <class M>
+  static grpc_byte_buffer* Wrap(const void* message) {
+    return WrapMessageObject(new M(*static_cast<const M*>(message)),
+                             &kOps<M>);
+  }
+
+  // The counterpart of SerializationTraits<M>::Deserialize(), which also
+  // accepts buffers returned by Wrap(). Like it, consumes \a buffer.
+  template <class M>
+  static Status Deserialize(ByteBuffer* buffer, M* message) {
+    grpc_byte_buffer* bytes = buffer->c_buffer();
+    if (bytes != nullptr && IsMessageObject(bytes)) {
+      if constexpr (kSupported<M>) {
+        void* object = TakeMessageObject(bytes, &kOps<M>);
+        if (object != nullptr) {
+          *message = std::move(*static_cast<M*>(object));
+          Destroy<M>(object);
+          buffer->Clear();
+          return Status::OK;
+        }
+      }
+      // Received by a different type, or as raw bytes.
+      Status status = MaterializeMessageObject(bytes);
+      if (!status.ok()) {
+        buffer->Clear();
+        return status;
+      }
+    }
+    return SerializationTraits<M>::Deserialize(buffer, message);
+  }
+
+ private:
+  template <class M>
+  static void Destroy(void* object) {
+    delete static_cast<M*>(object);
+  }
+
+  template <class M>
+  static Status Serialize(const void* object, grpc_byte_buffer** bytes) {
+    ByteBuffer buffer;
+    bool own_buffer;
+    Status status = SerializationTraits<M>::Serialize(
+        *static_cast<const M*>(object), &buffer, &own_buffer);
+    if (!own_buffer) buffer.Duplicate();
+    *bytes = buffer.c_buffer();
+    buffer.Release();
+    return status;
+  }
+
+  template <class M>
+  static constexpr MessageObjectOps kOps = {&Destroy<M>, &Serialize<M>};
+};
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPCPP_IMPL_MESSAGE_OBJECT_H
@@ -28,9 +28,13 @@
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/proto_buffer_reader.h>
 #include <grpcpp/support/proto_buffer_writer.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 
+#include <stddef.h>
+
+#include <new>
 #include <type_traits>
 
 /// This header provides serialization and deserialization between gRPC
@@ -57,6 +61,57 @@ class SerializationTraits<
   }
 };
 
+namespace internal {
+
+// Holds the messages of a callback unary method in a protobuf arena, so
+// that parsing the request and filling in the response do not allocate
+// each nested message separately.  The arena starts out in a block of
+// the call arena, and so only touches the heap for large messages.
+template <class Request, class Response>
+class ProtoArenaMessageHolder : public MessageHolder<Request, Response> {
+ public:
+  static constexpr size_t kInitialBlockSize = 1024;
+
+  explicit ProtoArenaMessageHolder(char* initial_block)
+      : arena_(MakeArenaOptions(initial_block)) {
+    this->set_request(grpc::protobuf::Arena::Create<Request>(&arena_));
+    this->set_response(grpc::protobuf::Arena::Create<Response>(&arena_));
+  }
+
+  void Release() override {
+    // Both this object and the arena's initial block are in the call arena.
+    this->~ProtoArenaMessageHolder<Request, Response>();
+  }
+
+ private:
+  static grpc::protobuf::ArenaOptions MakeArenaOptions(char* initial_block) {
+    grpc::protobuf::ArenaOptions options;
+    options.initial_block = initial_block;
+    options.initial_block_size = kInitialBlockSize;
+    return options;
+  }
+
+  grpc::protobuf::Arena arena_;
+};
+
+template <class Request, class Response>
+class DefaultMessageHolderFactory<
+    Request, Response,
+    typename std::enable_if<
+        std::is_base_of<grpc::protobuf::MessageLite, Request>::value &&
+        std::is_base_of<grpc::protobuf::MessageLite, Response>::value>::type> {
+ public:
+  static MessageHolder<Request, Response>* Create(grpc_call* call) {
+    char* initial_block = static_cast<char*>(grpc_call_arena_alloc(
+        call, ProtoArenaMessageHolder<Request, Response>::kInitialBlockSize));
+    return new (grpc_call_arena_alloc(
+        call, sizeof(ProtoArenaMessageHolder<Request, Response>)))
+        ProtoArenaMessageHolder<Request, Response>(initial_block);
+  }
+};
+
+}  // namespace internal
+
 }  // namespace grpc
 
 #endif  // GRPCPP_IMPL_PROTO_UTILS_H
@@ -28,6 +28,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "absl/log/absl_check.h"
@@ -51,15 +52,24 @@ class MethodHandler {
     /// \param requester : used only by the callback API. It is a function
     ///        called by the RPC Controller to request another RPC (and also
     ///        to set up the state required to make that request possible)
+    /// \param is_non_blocking : used only by the callback API. Whether the
+    ///        method was marked non-blocking, so that its reactions may be
+    ///        run inline.
+    /// \param key : used only by the callback API. The serialized request,
+    ///        if the method was marked coalesced; nullptr otherwise.
     HandlerParameter(Call* c, grpc::ServerContextBase* context, void* req,
                      Status req_status, void* handler_data,
-                     std::function<void()> requester)
+                     std::function<void()> requester,
+                     bool is_non_blocking = false,
+                     const std::string* key = nullptr)
         : call(c),
           server_context(context),
           request(req),
           status(req_status),
           internal_data(handler_data),
-          call_requester(std::move(requester)) {}
+          call_requester(std::move(requester)),
+          non_blocking(is_non_blocking),
+          coalescing_key(key) {}
     ~HandlerParameter() {}
     Call* const call;
     grpc::ServerContextBase* const server_context;
@@ -67,6 +77,8 @@ class MethodHandler {
     const Status status;
     void* const internal_data;
     const std::function<void()> call_requester;
+    const bool non_blocking;
+    const std::string* const coalescing_key;
   };
   virtual void RunHandler(const HandlerParameter& param) = 0;
 
@@ -107,6 +119,14 @@ class RpcServiceMethod : public RpcMethod {
   MethodHandler* handler() const { return handler_.get(); }
   ApiType api_type() const { return api_type_; }
   void SetHandler(MethodHandler* handler) { handler_.reset(handler); }
+  /// Whether the reactions of this callback method may be run inline; see
+  /// Service::MarkMethodNonBlocking().
+  bool non_blocking() const { return non_blocking_; }
+  void set_non_blocking(bool non_blocking) { non_blocking_ = non_blocking; }
+  /// Whether calls with identical requests share one response; see
+  /// Service::MarkMethodCoalesced().
+  bool coalesced() const { return coalesced_; }
+  void set_coalesced(bool coalesced) { coalesced_ = coalesced; }
   void SetServerApiType(RpcServiceMethod::ApiType type) {
     if ((api_type_ == ApiType::SYNC) &&
         (type == ApiType::ASYNC || type == ApiType::RAW)) {
@@ -129,6 +149,8 @@ class RpcServiceMethod : public RpcMethod {
  private:
   void* server_tag_;
   ApiType api_type_;
+  bool non_blocking_ = false;
+  bool coalesced_ = false;
   std::unique_ptr<MethodHandler> handler_;
 
   const char* TypeToString(RpcServiceMethod::ApiType type) {
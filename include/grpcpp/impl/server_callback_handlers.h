@@ -20,12 +20,19 @@
 
 #include <grpc/grpc.h>
 #include <grpc/impl/call.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/impl/sync.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/support/message_allocator.h>
 #include <grpcpp/support/server_callback.h>
 #include <grpcpp/support/status.h>
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "absl/log/absl_check.h"
 
 namespace grpc {
@@ -57,11 +64,17 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
         ServerCallbackUnaryImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, allocator_state, param.call_requester);
+    call->set_inline_reactions(param.non_blocking);
     param.server_context->BeginCompletionOp(
         param.call, [call](bool) { call->MaybeDone(); }, call);
 
     ServerUnaryReactor* reactor = nullptr;
-    if (param.status.ok()) {
+    if (param.status.ok() && param.coalescing_key != nullptr &&
+        JoinInFlightCall(*param.coalescing_key, call)) {
+      // The response will be that of the call already running the handler
+      // for the same request.
+      reactor = call->waiter_reactor_;
+    } else if (param.status.ok()) {
       reactor = grpc::internal::CatchingReactorGetter<ServerUnaryReactor>(
           get_reactor_,
           static_cast<grpc::CallbackServerContext*>(param.server_context),
@@ -89,14 +102,12 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
     if (allocator_ != nullptr) {
       allocator_state = allocator_->AllocateMessages();
     } else {
-      allocator_state = new (grpc_call_arena_alloc(
-          call, sizeof(DefaultMessageHolder<RequestType, ResponseType>)))
-          DefaultMessageHolder<RequestType, ResponseType>();
+      allocator_state =
+          DefaultMessageHolderFactory<RequestType, ResponseType>::Create(call);
     }
     *handler_data = allocator_state;
     request = allocator_state->request();
-    *status =
-        grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
+    *status = grpc::internal::MessageObjects::Deserialize(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
@@ -105,14 +116,174 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
   }
 
  private:
+  class ServerCallbackUnaryImpl;
+
+  // The reactor of a call whose request is identical to that of a call that
+  // is already running the handler. It is finished with a copy of the other
+  // call's response and status, unless that call is cancelled, in which case
+  // it may run the handler itself. Reactions are then passed on to the
+  // handler's reactor.
+  class CoalescedUnaryReactor : public ServerUnaryReactor {
+   public:
+    explicit CoalescedUnaryReactor(ServerCallbackUnaryImpl* call)
+        : call_(call) {}
+
+    void FinishWith(const ResponseType& response, const grpc::Status& s) {
+      if (s.ok()) *call_->response() = response;
+      this->Finish(s);
+    }
+
+    bool IsCancelled() { return call_->ctx_->IsCancelled(); }
+
+    // Runs the handler for this call, which becomes the one running it on
+    // behalf of the calls still waiting for key.
+    void RunHandler(CallbackUnaryHandler* handler, const std::string* key) {
+      call_->coalescing_handler_ = handler;
+      call_->coalescing_key_ = key;
+      ServerUnaryReactor* reactor =
+          grpc::internal::CatchingReactorGetter<ServerUnaryReactor>(
+              handler->get_reactor_, call_->ctx_, call_->request(),
+              call_->response());
+      if (reactor == nullptr) {
+        reactor = new (grpc_call_arena_alloc(call_->call(),
+                                             sizeof(UnimplementedUnaryReactor)))
+            UnimplementedUnaryReactor(
+                grpc::Status(grpc::StatusCode::UNIMPLEMENTED, ""));
+      }
+      bool cancelled;
+      {
+        grpc::internal::MutexLock lock(&mu_);
+        handler_reactor_ = reactor;
+        cancelled = cancelled_;
+      }
+      call_->BindReactor(reactor);
+      if (cancelled) reactor->OnCancel();
+    }
+
+    void OnSendInitialMetadataDone(bool ok) override {
+      ServerUnaryReactor* reactor = handler_reactor();
+      if (reactor != nullptr) reactor->OnSendInitialMetadataDone(ok);
+    }
+
+    void OnCancel() override {
+      ServerUnaryReactor* reactor;
+      {
+        grpc::internal::MutexLock lock(&mu_);
+        cancelled_ = true;
+        reactor = handler_reactor_;
+      }
+      if (reactor != nullptr) reactor->OnCancel();
+    }
+
+    void OnDone() override {
+      ServerUnaryReactor* reactor = handler_reactor();
+      if (reactor != nullptr) reactor->OnDone();
+      this->~CoalescedUnaryReactor();
+    }
+
+   private:
+    ServerUnaryReactor* handler_reactor() {
+      grpc::internal::MutexLock lock(&mu_);
+      return handler_reactor_;
+    }
+
+    ServerCallbackUnaryImpl* const call_;
+    grpc::internal::Mutex mu_;
+    // Set if this call ended up running the handler.
+    ServerUnaryReactor* handler_reactor_ = nullptr;
+    bool cancelled_ = false;
+  };
+
+  // If a call with the same serialized request is already running the
+  // handler, queues call to be finished with its response and returns true.
+  // Otherwise records call as the one running the handler for key.
+  bool JoinInFlightCall(const std::string& key, ServerCallbackUnaryImpl* call) {
+    grpc::internal::MutexLock lock(&coalescing_mu_);
+    auto it = in_flight_.find(key);
+    if (it == in_flight_.end()) {
+      it = in_flight_.emplace(key, std::vector<CoalescedUnaryReactor*>()).first;
+      call->coalescing_handler_ = this;
+      call->coalescing_key_ = &it->first;
+      return false;
+    }
+    call->waiter_reactor_ =
+        new (grpc_call_arena_alloc(call->call(), sizeof(CoalescedUnaryReactor)))
+            CoalescedUnaryReactor(call);
+    it->second.push_back(call->waiter_reactor_);
+    return true;
+  }
+
+  // Finishes the calls waiting for the response to key.
+  void FinishWaitingCalls(const std::string* key, const ResponseType& response,
+                          const grpc::Status& s) {
+    std::vector<CoalescedUnaryReactor*> waiters;
+    {
+      grpc::internal::MutexLock lock(&coalescing_mu_);
+      auto it = in_flight_.find(*key);
+      waiters = std::move(it->second);
+      in_flight_.erase(it);
+    }
+    for (CoalescedUnaryReactor* waiter : waiters) {
+      waiter->FinishWith(response, s);
+    }
+  }
+
+  // Called instead of FinishWaitingCalls() when the call running the handler
+  // for key was cancelled, so that its status says nothing about the calls
+  // waiting for it. The first of those that is not cancelled itself runs the
+  // handler in its place; the cancelled ones are finished as such.
+  void RerunForWaitingCalls(const std::string* key) {
+    std::vector<CoalescedUnaryReactor*> cancelled;
+    CoalescedUnaryReactor* next = nullptr;
+    {
+      grpc::internal::MutexLock lock(&coalescing_mu_);
+      auto it = in_flight_.find(*key);
+      std::vector<CoalescedUnaryReactor*> waiters = std::move(it->second);
+      it->second.clear();
+      for (CoalescedUnaryReactor* waiter : waiters) {
+        if (waiter->IsCancelled()) {
+          cancelled.push_back(waiter);
+        } else if (next == nullptr) {
+          next = waiter;
+        } else {
+          it->second.push_back(waiter);
+        }
+      }
+      if (next == nullptr) in_flight_.erase(it);
+    }
+    for (CoalescedUnaryReactor* waiter : cancelled) {
+      waiter->Finish(grpc::Status::CANCELLED);
+    }
+    if (next != nullptr) next->RunHandler(this, key);
+  }
+
   std::function<ServerUnaryReactor*(grpc::CallbackServerContext*,
                                     const RequestType*, ResponseType*)>
       get_reactor_;
   MessageAllocator<RequestType, ResponseType>* allocator_ = nullptr;
+  grpc::internal::Mutex coalescing_mu_;
+  // The calls running the handler for a method marked coalesced, keyed by
+  // serialized request, with the calls waiting for their responses.
+  std::unordered_map<std::string, std::vector<CoalescedUnaryReactor*>>
+      in_flight_;
 
   class ServerCallbackUnaryImpl : public ServerCallbackUnary {
    public:
     void Finish(grpc::Status s) override {
+      if (coalescing_key_ != nullptr) {
+        // Only a result of the handler itself is shared. A call cancelled by
+        // its own client, or that ran out of its own deadline, leaves the
+        // calls waiting for it to run the handler again.
+        const std::string* key = coalescing_key_;
+        coalescing_key_ = nullptr;
+        if (ctx_->IsCancelled() ||
+            s.error_code() == grpc::StatusCode::CANCELLED ||
+            s.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED) {
+          coalescing_handler_->RerunForWaitingCalls(key);
+        } else {
+          coalescing_handler_->FinishWaitingCalls(key, *response(), s);
+        }
+      }
       // A callback that only contains a call to MaybeDone can be run as an
       // inline callback regardless of whether or not OnDone is inlineable
       // because if the actual OnDone callback needs to be scheduled, MaybeDone
@@ -163,7 +334,7 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -234,6 +405,12 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
     grpc::internal::Call call_;
     MessageHolder<RequestType, ResponseType>* const allocator_state_;
     std::function<void()> call_requester_;
+    // Set if this call is running the handler on behalf of other calls with
+    // the same request, which Finish must finish too.
+    CallbackUnaryHandler* coalescing_handler_ = nullptr;
+    const std::string* coalescing_key_ = nullptr;
+    // Set if this call is waiting for another call's response.
+    CoalescedUnaryReactor* waiter_reactor_ = nullptr;
     // reactor_ can always be loaded/stored with relaxed memory ordering because
     // its value is only set once, independently of other data in the object,
     // and the loads that use it will always actually come provably later even
@@ -268,6 +445,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
         ServerCallbackReaderImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, param.call_requester);
+    reader->set_inline_reactions(param.non_blocking);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no read reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -349,7 +527,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -390,7 +568,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, /*can_inline=*/this->inline_reactions());
       read_ops_.set_core_cq_tag(&read_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -462,6 +640,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, static_cast<RequestType*>(param.request),
             param.call_requester);
+    writer->set_inline_reactions(param.non_blocking);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no write reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -495,8 +674,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
     buf.set_buffer(req);
     auto* request =
         new (grpc_call_arena_alloc(call, sizeof(RequestType))) RequestType();
-    *status =
-        grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
+    *status = grpc::internal::MessageObjects::Deserialize(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
@@ -553,7 +731,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -614,7 +792,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, /*can_inline=*/this->inline_reactions());
       write_ops_.set_core_cq_tag(&write_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -688,6 +866,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
         ServerCallbackReaderWriterImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, param.call_requester);
+    stream->set_inline_reactions(param.non_blocking);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no bidi reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -765,7 +944,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -828,7 +1007,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, /*can_inline=*/this->inline_reactions());
       write_ops_.set_core_cq_tag(&write_tag_);
       read_tag_.Set(
           call_.call(),
@@ -839,7 +1018,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, /*can_inline=*/this->inline_reactions());
       read_ops_.set_core_cq_tag(&read_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
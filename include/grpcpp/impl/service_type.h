@@ -216,6 +216,40 @@ class Service {
         internal::RpcServiceMethod::ApiType::RAW_CALL_BACK);
   }
 
+  // Declares that the reactor of callback method \a index never blocks, so
+  // its reactions (OnReadDone, OnWriteDone, OnDone, ...) are run inline on
+  // the thread that completed the operation rather than being handed off to
+  // the executor. Has no effect on methods that are not callback methods.
+  void MarkMethodNonBlocking(int index) {
+    size_t idx = static_cast<size_t>(index);
+    ABSL_CHECK_NE(methods_[idx].get(), nullptr)
+        << "Cannot mark the method as 'non-blocking' because it has already "
+           "been marked as 'generic'.";
+    methods_[idx]->set_non_blocking(true);
+  }
+
+  // As MarkMethodNonBlocking(), for every method of the service.
+  void MarkAllMethodsNonBlocking() {
+    for (auto& method : methods_) {
+      if (method != nullptr) method->set_non_blocking(true);
+    }
+  }
+
+  // Declares that the unary callback method \a index returns the same
+  // response for identical requests, whatever the caller and its metadata.
+  // While a call is running the handler, calls to the method with the same
+  // serialized request do not run it: they wait and are finished with a copy
+  // of its response and status. Neither initial nor trailing metadata set by
+  // the handler is copied. Has no effect on methods that are not callback
+  // methods.
+  void MarkMethodCoalesced(int index) {
+    size_t idx = static_cast<size_t>(index);
+    ABSL_CHECK(methods_[idx] &&
+               methods_[idx]->method_type() == internal::RpcMethod::NORMAL_RPC)
+        << "Only unary methods can be marked 'coalesced'.";
+    methods_[idx]->set_coalesced(true);
+  }
+
   internal::MethodHandler* GetHandler(int index) {
     size_t idx = static_cast<size_t>(index);
     return methods_[idx]->handler();
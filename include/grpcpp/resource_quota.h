@@ -54,6 +54,27 @@ class ResourceQuota final : private grpc::internal::GrpcLibrary {
   /// normal course.
   ResourceQuota& SetMaxThreads(int new_max_threads);
 
+  /// Priorities of the methods given a budget with SetMethodBudget().
+  enum class MethodPriority {
+    /// Shed first as the memory of this ResourceQuota runs short.
+    kLow,
+    kNormal,
+    /// Never shed for lack of memory, but still held to its budget.
+    kHigh,
+  };
+
+  /// Limit the memory used by the calls in flight to \a method on servers
+  /// using this ResourceQuota to about \a max_bytes. \a method is either
+  /// "/package.Service/Method", or "/package.Service/" for the methods of the
+  /// service that have no budget of their own. Calls over budget, and calls
+  /// to methods of low or normal priority once the ResourceQuota as a whole
+  /// runs short of memory, fail with RESOURCE_EXHAUSTED before any of their
+  /// messages are read. Budgets must be set before a server using this
+  /// ResourceQuota is started.
+  ResourceQuota& SetMethodBudget(
+      const std::string& method, size_t max_bytes,
+      MethodPriority priority = MethodPriority::kNormal);
+
   grpc_resource_quota* c_resource_quota() const { return impl_; }
 
  private:
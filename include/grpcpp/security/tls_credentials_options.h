@@ -21,6 +21,7 @@
 
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
+#include <grpc/grpc_session_ticket_key_provider.h>
 #include <grpc/status.h>
 #include <grpcpp/security/tls_certificate_provider.h>
 #include <grpcpp/security/tls_certificate_verifier.h>
@@ -33,6 +34,15 @@
 namespace grpc {
 namespace experimental {
 
+using grpc_core::experimental::
+    CreateRotatingSessionTicketKeyProvider;  // NOLINT(misc-unused-using-decls)
+using grpc_core::experimental::
+    RotatingSessionTicketKeyProvider;  // NOLINT(misc-unused-using-decls)
+using grpc_core::experimental::
+    SessionTicketKey;  // NOLINT(misc-unused-using-decls)
+using grpc_core::experimental::
+    SessionTicketKeyProvider;  // NOLINT(misc-unused-using-decls)
+
 // Base class of configurable options specified by users to configure their
 // certain security features supported in TLS. It is used for experimental
 // purposes for now and it is subject to change.
@@ -190,6 +200,13 @@ class TlsServerCredentialsOptions final : public TlsCredentialsOptions {
   // Deprecated: This function will be removed in the 1.66 release.
   void set_send_client_ca_list(bool send_client_ca_list);
 
+  // Sets the provider of the keys that session tickets are encrypted with.
+  // Servers that share keys can resume each other's sessions, and rotating
+  // the keys limits how long a leaked key can decrypt recorded traffic.
+  // If not set, each server uses its own random key.
+  void set_session_ticket_key_provider(
+      std::shared_ptr<SessionTicketKeyProvider> session_ticket_key_provider);
+
  private:
 };
 
@@ -35,8 +35,11 @@
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/status.h>
 
+#include <stdint.h>
+
 #include <list>
 #include <memory>
+#include <string>
 #include <vector>
 
 struct grpc_server;
@@ -119,6 +122,32 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
             std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
             interceptor_creators);
 
+    /// Per-tenant stats of a server with
+    /// GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING.
+    struct TenantStats {
+      std::string tenant;
+      double weight;
+      /// Calls whose handlers have been started.
+      uint64_t calls_started;
+      /// Calls waiting for their handlers to be started.
+      size_t calls_queued;
+      /// CPU time used by the handlers on the threads that started them.
+      int64_t cpu_time_nanos;
+      /// Total time the started calls waited to be started.
+      int64_t queue_time_millis;
+    };
+
+    /// Sets the share of the CPU that the calls of \a tenant get, relative to
+    /// other tenants, when GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING is set.
+    /// Tenants default to a weight of 1. \a weight must be positive.
+    void SetTenantWeight(const std::string& tenant, double weight);
+
+    /// Returns the stats of the tenants tracked, ordered by tenant: those
+    /// with a weight, those with calls queued or running, and as many idle
+    /// ones as there is room for. Empty unless
+    /// GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING is set.
+    std::vector<TenantStats> GetTenantStats();
+
    private:
     Server* server_;
   };
@@ -231,6 +260,14 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   /// interface)
   class SyncRequestThreadManager;
 
+  /// Runs new callback calls in earliest-deadline-first order, when enabled
+  /// by GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH.
+  class CallbackDispatchQueue;
+
+  /// Starts the handlers of new calls fairly across tenants, when enabled by
+  /// GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING.
+  class TenantDispatcher;
+
   /// Register a generic service. This call does not take ownership of the
   /// service. The service must exist for the lifetime of the Server instance.
   void RegisterAsyncGenericService(AsyncGenericService* service) override;
@@ -336,6 +373,12 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   // Handler for callback generic service, if any
   std::unique_ptr<internal::MethodHandler> generic_handler_;
 
+  // Queue of new callback calls, if they are dispatched in deadline order.
+  std::unique_ptr<CallbackDispatchQueue> callback_dispatch_queue_;
+
+  // Schedules the handlers of new calls by tenant, if enabled.
+  std::unique_ptr<TenantDispatcher> tenant_dispatcher_;
+
   // callback_cq_ references the callbackable completion queue associated
   // with this server (if any). It is set on the first call to CallbackCQ().
   // It is _not owned_ by the server; ownership belongs with its internal
@@ -228,10 +228,15 @@ class ServerBuilder {
 
   /// Options for synchronous servers.
   enum SyncServerOption {
-    NUM_CQS,         ///< Number of completion queues.
-    MIN_POLLERS,     ///< Minimum number of polling threads.
-    MAX_POLLERS,     ///< Maximum number of polling threads.
-    CQ_TIMEOUT_MSEC  ///< Completion queue timeout in milliseconds.
+    NUM_CQS,          ///< Number of completion queues.
+    MIN_POLLERS,      ///< Minimum number of polling threads.
+    MAX_POLLERS,      ///< Maximum number of polling threads.
+    CQ_TIMEOUT_MSEC,  ///< Completion queue timeout in milliseconds.
+    /// Longest time in milliseconds a call may wait for a thread before it
+    /// is failed with RESOURCE_EXHAUSTED; 0 for no limit. Together with
+    /// ResourceQuota::SetMaxThreads(), this bounds the work a sync server
+    /// takes on under overload.
+    MAX_QUEUE_TIME_MSEC
   };
 
   /// Only useful if this is a Synchronous server.
@@ -393,7 +398,11 @@ class ServerBuilder {
 
   struct SyncServerSettings {
     SyncServerSettings()
-        : num_cqs(1), min_pollers(1), max_pollers(2), cq_timeout_msec(10000) {}
+        : num_cqs(1),
+          min_pollers(1),
+          max_pollers(2),
+          cq_timeout_msec(10000),
+          max_queue_time_msec(0) {}
 
     /// Number of server completion queues to create to listen to incoming RPCs.
     int num_cqs;
@@ -408,6 +417,9 @@ class ServerBuilder {
 
     /// The timeout for server completion queue's AsyncNext call.
     int cq_timeout_msec;
+
+    /// How long a call may wait for a thread, or 0 for no limit.
+    int max_queue_time_msec;
   };
 
   int max_receive_message_size_;
@@ -27,6 +27,7 @@
 #include <grpcpp/impl/call_hook.h>
 #include <grpcpp/impl/codegen/interceptor_common.h>
 #include <grpcpp/impl/completion_queue_tag.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/support/byte_buffer.h>
@@ -210,6 +211,7 @@ class ServerInterface : public internal::CallHook {
           call_, server_, call_cq_, server_->max_receive_message_size(),
           context_->set_server_rpc_info(name_, type_,
                                         *server_->interceptor_creators()));
+      call_wrapper_.set_pass_message_objects(pass_message_objects_);
       return BaseAsyncRequest::FinalizeResult(tag, status);
     }
 
@@ -218,6 +220,9 @@ class ServerInterface : public internal::CallHook {
                       grpc::ServerCompletionQueue* notification_cq);
     const char* name_;
     const internal::RpcMethod::RpcType type_;
+    // Set if the request arrived as a message object, so the client can
+    // take the response as one too.
+    bool pass_message_objects_ = false;
   };
 
   class NoPayloadAsyncRequest final : public RegisteredAsyncRequest {
@@ -265,7 +270,9 @@ class ServerInterface : public internal::CallHook {
         return RegisteredAsyncRequest::FinalizeResult(tag, status);
       }
       if (*status) {
-        if (!payload_.Valid() || !SerializationTraits<Message>::Deserialize(
+        pass_message_objects_ =
+            payload_.Valid() && internal::IsMessageObject(payload_.bbuf_ptr());
+        if (!payload_.Valid() || !internal::MessageObjects::Deserialize(
                                       payload_.bbuf_ptr(), request_)
                                       .ok()) {
           // If deserialization fails, we cancel the call and instantiate
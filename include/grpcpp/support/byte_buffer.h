@@ -28,6 +28,8 @@
 
 #include <vector>
 
+#include "absl/strings/cord.h"
+
 namespace grpc {
 
 class ServerInterface;
@@ -53,6 +55,7 @@ class ExternalConnectionAcceptorImpl;
 template <class R>
 class DeserializeFuncType;
 class GrpcByteBufferPeer;
+class MessageObjects;
 
 }  // namespace internal
 /// A sequence of bytes.
@@ -117,9 +120,15 @@ class ByteBuffer final {
   // slice referencing that array.
   Status TrySingleSlice(Slice* slice) const;
 
-  /// Dump (read) the buffer contents into \a slics.
+  /// Dump (read) the buffer contents into \a slics. Does not copy if the
+  /// buffer is a single uncompressed slice.
   Status DumpToSingleSlice(Slice* slice) const;
 
+  /// If this ByteBuffer is uncompressed, sets \a cord to its contents. The
+  /// cord references, rather than copies, all but the smallest slices of the
+  /// buffer.
+  Status TryGetCord(absl::Cord* cord) const;
+
   /// Dump (read) the buffer contents into \a slices.
   Status Dump(std::vector<Slice>* slices) const;
 
@@ -181,6 +190,7 @@ class ByteBuffer final {
   friend class ProtoBufferWriter;
   friend class internal::GrpcByteBufferPeer;
   friend class internal::ExternalConnectionAcceptorImpl;
+  friend class internal::MessageObjects;
 
   grpc_byte_buffer* buffer_;
 
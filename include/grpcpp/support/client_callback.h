@@ -432,6 +432,10 @@ class ClientWriteReactor : public internal::ClientReactor {
 /// call (that is part of the unary call itself) and there is no reactor object
 /// being created as a result of this call, we keep a consistent 2-phase
 /// initiation API among all the reactor flavors.
+/// Once OnDone has been called, the reactor may be passed to another unary
+/// RPC, together with its ClientContext after a call to ClientContext::Reset.
+/// A client can thus keep a pool of reactors and contexts, and make unary
+/// RPCs on the callback API without allocating either per RPC.
 class ClientUnaryReactor : public internal::ClientReactor {
  public:
   void StartCall() { call_->StartCall(); }
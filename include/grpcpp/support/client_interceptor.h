@@ -133,6 +133,29 @@ class ClientRpcInfo {
         suffix_for_stats_(suffix_for_stats),
         channel_(channel) {}
 
+  // Returns this object to its default-constructed state so that it can be
+  // reused for another rpc, keeping the storage of the interceptor vectors.
+  // Should only be used by ClientContext.
+  void Reset() {
+    interceptors_.clear();
+    hook_points_.clear();
+    any_hook_points_ = 0;
+    hijacked_ = false;
+    hijacked_interceptor_ = 0;
+    Bind(nullptr, Type::UNKNOWN, nullptr, nullptr, nullptr);
+  }
+
+  // Sets what the constructor sets, on a default-constructed or reset
+  // object. Should only be used by ClientContext.
+  void Bind(grpc::ClientContext* ctx, Type type, const char* method,
+            const char* suffix_for_stats, grpc::ChannelInterface* channel) {
+    ctx_ = ctx;
+    type_ = type;
+    method_ = method;
+    suffix_for_stats_ = suffix_for_stats;
+    channel_ = channel;
+  }
+
   // Move assignment should only be used by ClientContext
   // TODO(yashykt): Delete move assignment
   ClientRpcInfo& operator=(ClientRpcInfo&&) = default;
@@ -179,6 +202,11 @@ class ClientRpcInfo {
           internal::g_global_client_interceptor_factory
               ->CreateClientInterceptor(this)));
     }
+    hook_points_.reserve(interceptors_.size());
+    for (const auto& interceptor : interceptors_) {
+      hook_points_.push_back(internal::InterceptedHookPoints(interceptor.get()));
+      any_hook_points_ |= hook_points_.back();
+    }
   }
 
   grpc::ClientContext* ctx_ = nullptr;
@@ -188,6 +216,9 @@ class ClientRpcInfo {
   const char* suffix_for_stats_ = nullptr;
   grpc::ChannelInterface* channel_ = nullptr;
   std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  // The hook points each interceptor intercepts, and their union.
+  std::vector<uint32_t> hook_points_;
+  uint32_t any_hook_points_ = 0;
   bool hijacked_ = false;
   size_t hijacked_interceptor_ = 0;
 
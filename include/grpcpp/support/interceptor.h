@@ -25,6 +25,9 @@
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/string_ref.h>
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <map>
 #include <memory>
 #include <string>
@@ -222,9 +225,50 @@ class Interceptor {
   /// The one public method of an Interceptor interface. Override this to
   /// trigger the desired actions at the hook points described above.
   virtual void Intercept(InterceptorBatchMethods* methods) = 0;
+
+  /// Returns whether \a Intercept needs to see batches with hook point \a
+  /// type. Called once per RPC, right after the interceptor is created.
+  /// Batches with none of the hook points an interceptor intercepts skip
+  /// it, as if it had just called Proceed(), and if no interceptor of the
+  /// RPC intercepts them, they skip interception altogether. Interceptors
+  /// that only act on a few hook points should override this. A hijacking
+  /// interceptor must intercept PRE_SEND_INITIAL_METADATA; once an RPC is
+  /// hijacked, all of its batches go through all of its interceptors.
+  /// PRE_SEND_CANCEL is always delivered.
+  virtual bool InterceptsHookPoint(InterceptionHookPoints /*type*/) {
+    return true;
+  }
 };
 
 }  // namespace experimental
+
+namespace internal {
+
+static_assert(static_cast<size_t>(
+                  experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS) <=
+                  32,
+              "hook points must fit in a uint32_t mask");
+
+inline uint32_t HookPointBit(experimental::InterceptionHookPoints type) {
+  return uint32_t{1} << static_cast<size_t>(type);
+}
+
+// Returns the mask of hook points that \a interceptor intercepts.
+inline uint32_t InterceptedHookPoints(experimental::Interceptor* interceptor) {
+  uint32_t hook_points = 0;
+  for (size_t i = 0;
+       i < static_cast<size_t>(
+               experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS);
+       ++i) {
+    auto type = static_cast<experimental::InterceptionHookPoints>(i);
+    if (interceptor->InterceptsHookPoint(type)) {
+      hook_points |= HookPointBit(type);
+    }
+  }
+  return hook_points;
+}
+
+}  // namespace internal
 }  // namespace grpc
 
 #endif  // GRPCPP_SUPPORT_INTERCEPTOR_H
@@ -0,0 +1,84 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_MAPPED_FILE_H
+#define GRPCPP_SUPPORT_MAPPED_FILE_H
+
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+#include <grpcpp/support/status.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace grpc {
+namespace experimental {
+
+/// A read-only file mapped into memory, for sending large files without
+/// copying them into message buffers.
+///
+/// Slices returned by \a Region reference the mapped pages directly. Each
+/// slice holds a reference on the mapping, so the file stays mapped until
+/// the last slice is released, even after the MappedFile is destroyed. A
+/// streaming handler can map a file once and write one region per message:
+///
+///   auto file = MappedFile::Open(path, &status);
+///   for (size_t offset = 0; offset < file->size(); offset += kChunkSize) {
+///     ByteBuffer chunk = file->RegionBuffer(offset, kChunkSize);
+///     ...
+///   }
+///
+/// On platforms without mmap the file is read into memory instead.
+/// The file must not be truncated while it is mapped.
+class MappedFile final {
+ public:
+  /// Maps the file at \a path. Returns nullptr and sets \a status if the file
+  /// cannot be opened or mapped.
+  static std::unique_ptr<MappedFile> Open(const std::string& path,
+                                          Status* status);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  /// Size of the file, in bytes.
+  size_t size() const;
+
+  /// Returns a slice of the \a length bytes at \a offset, clamped to the end
+  /// of the file. No data is copied.
+  Slice Region(size_t offset, size_t length) const;
+
+  /// Returns a byte buffer holding \a Region(offset, length).
+  ByteBuffer RegionBuffer(size_t offset, size_t length) const;
+
+ private:
+  class Mapping;
+
+  explicit MappedFile(Mapping* mapping);
+
+  // Destroy callback of the slices returned by Region.
+  static void UnrefMapping(void* mapping);
+
+  Mapping* const mapping_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_MAPPED_FILE_H
@@ -20,6 +20,7 @@
 #define GRPCPP_SUPPORT_METHOD_HANDLER_H
 
 #include <grpc/byte_buffer.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/sync_stream.h>
@@ -83,7 +84,7 @@ void* UnaryDeserializeHelper(grpc_byte_buffer* req, grpc::Status* status,
                              RequestType* request) {
   grpc::ByteBuffer buf;
   buf.set_buffer(req);
-  *status = grpc::SerializationTraits<RequestType>::Deserialize(
+  *status = grpc::internal::MessageObjects::Deserialize(
       &buf, static_cast<RequestType*>(request));
   buf.Release();
   if (status->ok()) {
@@ -233,8 +234,7 @@ class ServerStreamingHandler : public grpc::internal::MethodHandler {
     buf.set_buffer(req);
     auto* request =
         new (grpc_call_arena_alloc(call, sizeof(RequestType))) RequestType();
-    *status =
-        grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
+    *status = grpc::internal::MessageObjects::Deserialize(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
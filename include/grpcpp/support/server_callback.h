@@ -95,7 +95,7 @@ class ServerCallbackCall {
 
   void MaybeDone() {
     if (GPR_UNLIKELY(Unref() == 1)) {
-      ScheduleOnDone(reactor()->InternalInlineable());
+      ScheduleOnDone(inline_reactions_ || reactor()->InternalInlineable());
     }
   }
 
@@ -127,6 +127,14 @@ class ServerCallbackCall {
   /// Increases the reference count
   void Ref() { callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed); }
 
+  // Whether the method was marked non-blocking, in which case every reaction
+  // is run inline rather than on an executor. Must be set before the call
+  // has any operations in flight.
+  bool inline_reactions() const { return inline_reactions_; }
+  void set_inline_reactions(bool inline_reactions) {
+    inline_reactions_ = inline_reactions;
+  }
+
  private:
   virtual ServerReactor* reactor() = 0;
 
@@ -161,6 +169,7 @@ class ServerCallbackCall {
     return callbacks_outstanding_.fetch_sub(1, std::memory_order_acq_rel);
   }
 
+  bool inline_reactions_ = false;
   std::atomic_int on_cancel_conditions_remaining_{2};
   std::atomic_int callbacks_outstanding_{
       3};  // reserve for start, Finish, and CompletionOp
@@ -183,6 +192,19 @@ class DefaultMessageHolder : public MessageHolder<Request, Response> {
   Response response_obj_;
 };
 
+// Creates the messages for a callback unary method that has no
+// MessageAllocator set.  proto_utils.h specializes this for protobuf
+// messages, so that they are parsed into a protobuf arena.
+template <class Request, class Response, class = void>
+class DefaultMessageHolderFactory {
+ public:
+  static MessageHolder<Request, Response>* Create(grpc_call* call) {
+    return new (grpc_call_arena_alloc(
+        call, sizeof(DefaultMessageHolder<Request, Response>)))
+        DefaultMessageHolder<Request, Response>();
+  }
+};
+
 }  // namespace internal
 
 // Forward declarations
@@ -116,6 +116,11 @@ class ServerRpcInfo {
             std::unique_ptr<experimental::Interceptor>(interceptor));
       }
     }
+    hook_points_.reserve(interceptors_.size());
+    for (const auto& interceptor : interceptors_) {
+      hook_points_.push_back(internal::InterceptedHookPoints(interceptor.get()));
+      any_hook_points_ |= hook_points_.back();
+    }
   }
 
   void Ref() { ref_.fetch_add(1, std::memory_order_relaxed); }
@@ -130,6 +135,9 @@ class ServerRpcInfo {
   const Type type_;
   std::atomic<intptr_t> ref_{1};
   std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  // The hook points each interceptor intercepts, and their union.
+  std::vector<uint32_t> hook_points_;
+  uint32_t any_hook_points_ = 0;
 
   friend class internal::InterceptorBatchMethodsImpl;
   friend class grpc::ServerContextBase;
@@ -16,9 +16,18 @@
 #define GRPC_SRC_CORE_CALL_FILTER_FUSION_H
 #include <grpc/impl/grpc_types.h>
 
+#include <memory>
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+#include "src/core/filter/filter_args.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/transport/call_filters.h"
 #include "src/core/lib/transport/call_final_info.h"
 #include "src/core/lib/transport/metadata.h"
@@ -73,7 +82,7 @@ class AdaptMethod<T, const NoInterceptor*, method> {
   auto operator()(Hdl<T> x) {
     return Immediate(ServerMetadataOrHandle<T>::Ok(std::move(x)));
   }
-  void operator()(T* /*x*/) {}
+  void operator()(const T* /*x*/) {}
 };
 
 // Overrides for Filter methods with void Return types.
@@ -141,7 +150,7 @@ class AdaptMethod<
  public:
   explicit AdaptMethod(Call* call, Derived* filter)
       : call_(call), filter_(filter) {}
-  void operator()(A* arg) { (call_->*method)(arg, filter_); }
+  void operator()(const A* arg) { (call_->*method)(arg, filter_); }
 
  private:
   Call* call_;
@@ -171,7 +180,7 @@ class AdaptMethod<A, void (Call::*)(const A*), method,
                   std::enable_if_t<!kHasCallMember<A>, void>> {
  public:
   explicit AdaptMethod(Call* call, void* /*filter*/) : call_(call) {}
-  void operator()(A* arg) { (call_->*method)(arg); }
+  void operator()(const A* arg) { (call_->*method)(arg); }
 
  private:
   Call* call_;
@@ -262,8 +271,8 @@ class AdaptMethod<
     if (IsStatusOk(result)) {
       return Immediate(ServerMetadataOrHandle<T>::Ok(std::move(x)));
     }
-    return Immediate(
-        ServerMetadataOrHandle<T>::Failure(ServerMetadataFromStatus(result)));
+    return Immediate(ServerMetadataOrHandle<T>::Failure(
+        CancelledServerMetadataFromStatus(result)));
   }
 
  private:
@@ -280,8 +289,8 @@ class AdaptMethod<T, R (Call::*)(), method,
     if (IsStatusOk(result)) {
       return Immediate(ServerMetadataOrHandle<T>::Ok(std::move(x)));
     };
-    return Immediate(
-        ServerMetadataOrHandle<T>::Failure(ServerMetadataFromStatus(result)));
+    return Immediate(ServerMetadataOrHandle<T>::Failure(
+        CancelledServerMetadataFromStatus(result)));
   }
 
  private:
@@ -302,8 +311,8 @@ class AdaptMethod<
     if (IsStatusOk(result)) {
       return Immediate(ServerMetadataOrHandle<T>::Ok(std::move(x)));
     }
-    return Immediate(
-        ServerMetadataOrHandle<T>::Failure(ServerMetadataFromStatus(result)));
+    return Immediate(ServerMetadataOrHandle<T>::Failure(
+        CancelledServerMetadataFromStatus(result)));
   }
 
  private:
@@ -328,7 +337,7 @@ class AdaptMethod<
           ServerMetadataOrHandle<T>::Ok(TakeValue(std::move(result))));
     }
     return Immediate(ServerMetadataOrHandle<T>::Failure(
-        ServerMetadataFromStatus(std::move(result.status()))));
+        CancelledServerMetadataFromStatus(std::move(result.status()))));
   }
 
  private:
@@ -347,7 +356,7 @@ class AdaptMethod<T, R (Call::*)(), method,
           ServerMetadataOrHandle<T>::Ok(TakeValue(std::move(result))));
     }
     return Immediate(ServerMetadataOrHandle<T>::Failure(
-        ServerMetadataFromStatus(std::move(result.status()))));
+        CancelledServerMetadataFromStatus(std::move(result.status()))));
   }
 
  private:
@@ -372,7 +381,7 @@ class AdaptMethod<
           ServerMetadataOrHandle<T>::Ok(TakeValue(std::move(result))));
     }
     return Immediate(ServerMetadataOrHandle<T>::Failure(
-        ServerMetadataFromStatus(std::move(result.status()))));
+        CancelledServerMetadataFromStatus(std::move(result.status()))));
   }
 
  private:
@@ -394,7 +403,7 @@ class AdaptMethod<T, R (Call::*)(Hdl<T>), method,
     }
 
     return Immediate(ServerMetadataOrHandle<T>::Failure(
-        ServerMetadataFromStatus(result.status())));
+        CancelledServerMetadataFromStatus(result.status())));
   }
 
  private:
@@ -413,7 +422,7 @@ class AdaptMethod<T, R (Call::*)(), method,
     }
 
     return Immediate(ServerMetadataOrHandle<T>::Failure(
-        ServerMetadataFromStatus(result.status())));
+        CancelledServerMetadataFromStatus(result.status())));
   }
 
  private:
@@ -434,7 +443,37 @@ class AdaptMethod<T, R (Call::*)(Hdl<T>, Derived*), method,
     }
 
     return Immediate(ServerMetadataOrHandle<T>::Failure(
-        ServerMetadataFromStatus(result.status())));
+        CancelledServerMetadataFromStatus(result.status())));
+  }
+
+ private:
+  Call* call_;
+  Derived* filter_;
+};
+
+// Overrides for infallible filter methods which take and return a Hdl<T>.
+template <typename T, typename Call, Hdl<T> (Call::*method)(Hdl<T>)>
+class AdaptMethod<T, Hdl<T> (Call::*)(Hdl<T>), method> {
+ public:
+  explicit AdaptMethod(Call* call, void* /*filter*/ = nullptr) : call_(call) {}
+  auto operator()(Hdl<T> x) {
+    return Immediate(
+        ServerMetadataOrHandle<T>::Ok((call_->*method)(std::move(x))));
+  }
+
+ private:
+  Call* call_;
+};
+
+template <typename T, typename Call, typename Derived,
+          Hdl<T> (Call::*method)(Hdl<T>, Derived*)>
+class AdaptMethod<T, Hdl<T> (Call::*)(Hdl<T>, Derived*), method> {
+ public:
+  explicit AdaptMethod(Call* call, Derived* filter)
+      : call_(call), filter_(filter) {}
+  auto operator()(Hdl<T> x) {
+    return Immediate(ServerMetadataOrHandle<T>::Ok(
+        (call_->*method)(std::move(x), filter_)));
   }
 
  private:
@@ -507,12 +546,6 @@ struct FilterMethods {
   using Idxs = std::make_index_sequence<sizeof...(filter_methods)>;
 };
 
-template <typename... Filters>
-struct FilterTypes {
-  using Types = Typelist<Filters...>;
-  using Idxs = std::make_index_sequence<sizeof...(Filters)>;
-};
-
 template <std::size_t, typename>
 struct make_reverse_index_sequence_helper;
 
@@ -531,14 +564,6 @@ struct ReverseFilterMethods {
   using Idxs = make_reverse_index_sequence<sizeof...(filter_methods)>;
 };
 
-template <typename... Filters>
-struct ReverseFilterTypes {
-  using Types = Reverse<Filters...>;
-  using Idxs = make_reverse_index_sequence<sizeof...(Filters)>;
-  template <bool forward, auto... filter_methods>
-  struct ForwardOrReverse;
-};
-
 template <bool forward, auto... filter_methods>
 struct ForwardOrReverse;
 
@@ -552,19 +577,6 @@ struct ForwardOrReverse<false, filter_methods...> {
   using OrderMethod = ReverseFilterMethods<filter_methods...>;
 };
 
-template <bool forward, typename... filter_types>
-struct ForwardOrReverseTypes;
-
-template <typename... filter_types>
-struct ForwardOrReverseTypes<true, filter_types...> {
-  using OrderMethod = FilterTypes<filter_types...>;
-};
-
-template <typename... filter_types>
-struct ForwardOrReverseTypes<false, filter_types...> {
-  using OrderMethod = ReverseFilterTypes<filter_types...>;
-};
-
 // Combine the result of a series of filter methods into a single method.
 template <typename Call, typename T, auto filter_method_0,
           auto... filter_methods, size_t I0, size_t... Is>
@@ -584,53 +596,68 @@ auto ExecuteCombined(Call* call, Hdl<T> hdl) {
                          typename FilterMethods::Idxs());
 }
 
+// Combine the result of a series of OnFinalize filter methods into a single
+// method.
+template <typename Call, typename T, auto... filter_methods, size_t... Is>
+void ExecuteCombinedOnFinalize(Call* call, const T* call_final_info,
+                               Valuelist<filter_methods...>,
+                               std::index_sequence<Is...>) {
+  (AdaptMethod<T, decltype(filter_methods), filter_methods>(
+       call->template fused_child<Is>(), nullptr)(call_final_info),
+   ...);
+}
+
+template <typename FilterMethods, typename Call, typename T>
+void ExecuteCombined(Call* call, const T* call_final_info) {
+  ExecuteCombinedOnFinalize(call, call_final_info,
+                            typename FilterMethods::Methods(),
+                            typename FilterMethods::Idxs());
+}
+
 // Combine the result of a series of filter methods into a single method.
-template <typename Call, typename Derived, typename T, typename Filter0,
-          typename... Filters, auto filter_method_0, auto... filter_methods,
-          size_t I0, size_t... Is>
+// Each filter method is handed its own filter, which the fused filter owns.
+template <typename Call, typename Derived, typename T, auto filter_method_0,
+          auto... filter_methods, size_t I0, size_t... Is>
 auto ExecuteCombinedWithChannelAccess(
-    Call* call, Derived* channel, Hdl<T> hdl, Typelist<Filter0, Filters...>,
+    Call* call, Derived* channel, Hdl<T> hdl,
     Valuelist<filter_method_0, filter_methods...>,
     std::index_sequence<I0, Is...>) {
   return TrySeq(AdaptMethod<T, decltype(filter_method_0), filter_method_0>(
                     call->template fused_child<I0>(),
-                    reinterpret_cast<Filter0*>(channel))(std::move(hdl)),
+                    channel->template fused_child<I0>())(std::move(hdl)),
                 AdaptMethod<T, decltype(filter_methods), filter_methods>(
                     call->template fused_child<Is>(),
-                    reinterpret_cast<Filters*>(channel))...);
+                    channel->template fused_child<Is>())...);
 }
 
-template <typename FilterMethods, typename FilterTypes, typename Call,
-          typename Derived, typename T>
+template <typename FilterMethods, typename Call, typename Derived, typename T>
 auto ExecuteCombinedWithChannelAccess(Call* call, Derived* channel,
                                       Hdl<T> hdl) {
-  return ExecuteCombinedWithChannelAccess(
-      call, channel, std::move(hdl), typename FilterTypes::Types(),
-      typename FilterMethods::Methods(), typename FilterMethods::Idxs());
+  return ExecuteCombinedWithChannelAccess(call, channel, std::move(hdl),
+                                          typename FilterMethods::Methods(),
+                                          typename FilterMethods::Idxs());
 }
 
 // Combine the result of a series of OnFinalize filter methods into a single
 // method.
-template <typename Call, typename Derived, typename T, typename... Filters,
-          auto... filter_methods, size_t... Is>
+template <typename Call, typename Derived, typename T, auto... filter_methods,
+          size_t... Is>
 void ExecuteCombinedOnFinalizeWithChannelAccess(Call* call, Derived* channel,
-                                                T* call_final_info,
-                                                Typelist<Filters...>,
+                                                const T* call_final_info,
                                                 Valuelist<filter_methods...>,
                                                 std::index_sequence<Is...>) {
   (AdaptMethod<T, decltype(filter_methods), filter_methods>(
        call->template fused_child<Is>(),
-       reinterpret_cast<Filters*>(channel))(call_final_info),
+       channel->template fused_child<Is>())(call_final_info),
    ...);
 }
 
-template <typename FilterMethods, typename FilterTypes, typename Call,
-          typename Derived, typename T>
+template <typename FilterMethods, typename Call, typename Derived, typename T>
 void ExecuteCombinedWithChannelAccess(Call* call, Derived* channel,
-                                      T* call_final_info) {
+                                      const T* call_final_info) {
   ExecuteCombinedOnFinalizeWithChannelAccess(
-      call, channel, call_final_info, typename FilterTypes::Types(),
-      typename FilterMethods::Methods(), typename FilterMethods::Idxs());
+      call, channel, call_final_info, typename FilterMethods::Methods(),
+      typename FilterMethods::Idxs());
 }
 
 #define GRPC_FUSE_METHOD(name, type, forward)                                 \
@@ -654,10 +681,8 @@ void ExecuteCombinedWithChannelAccess(Call* call, Derived* channel,
   class FuseImpl##name<MethodVariant::kChannelAccess, Derived, Filters...> {  \
    public:                                                                    \
     auto name(type x, Derived* channel) {                                     \
-      return ExecuteCombinedWithChannelAccess<                                \
-          typename ForwardOrReverse<forward,                                  \
-                                    &Filters::Call::name...>::OrderMethod,    \
-          typename ForwardOrReverseTypes<forward, Filters...>::OrderMethod>(  \
+      return ExecuteCombinedWithChannelAccess<typename ForwardOrReverse<      \
+          forward, &Filters::Call::name...>::OrderMethod>(                    \
           static_cast<typename Derived::Call*>(this), channel, std::move(x)); \
     }                                                                         \
   };                                                                          \
@@ -670,14 +695,214 @@ GRPC_FUSE_METHOD(OnClientInitialMetadata, ClientMetadataHandle, true);
 GRPC_FUSE_METHOD(OnServerInitialMetadata, ServerMetadataHandle, false);
 GRPC_FUSE_METHOD(OnClientToServerMessage, MessageHandle, true);
 GRPC_FUSE_METHOD(OnServerToClientMessage, MessageHandle, false);
-GRPC_FUSE_METHOD(OnServerTrailingMetadata, ServerMetadataHandle, false);
-GRPC_FUSE_METHOD(OnClientToServerHalfClose, ServerMetadataHandle, true);
-GRPC_FUSE_METHOD(OnFinalize, grpc_call_final_info*, true);
+GRPC_FUSE_METHOD(OnFinalize, const grpc_call_final_info*, true);
 
 #undef GRPC_FUSE_METHOD
 
+// CallFilters runs server trailing metadata and half close interceptors
+// synchronously, so their fused versions call each filter in turn instead of
+// returning a promise.
+
+// Resolves a promise returned by an AdaptMethod. Only synchronous filter
+// methods can be fused into these interception points, and their adapted
+// promises are always Immediate.
+template <typename P>
+ServerMetadataHandle RunSynchronously(P promise) {
+  static_assert(
+      std::is_same_v<P, promise_detail::Immediate<
+                            ServerMetadataOrHandle<ServerMetadata>>>,
+      "server trailing metadata interceptors must be synchronous");
+  auto p = promise();
+  auto& r = p.value();
+  if (r.ok()) return std::move(*r);
+  return std::move(r.metadata());
+}
+
+// Each filter sees the trailing metadata left by the one before it,
+// including any that a failing filter replaced it with, as they would in
+// CallFilters.
+template <typename Call, auto... filter_methods, size_t... Is>
+ServerMetadataHandle ExecuteCombinedServerTrailingMetadata(
+    Call* call, ServerMetadataHandle md, Valuelist<filter_methods...>,
+    std::index_sequence<Is...>) {
+  ((md = RunSynchronously(
+        AdaptMethod<ServerMetadata, decltype(filter_methods), filter_methods>(
+            call->template fused_child<Is>())(std::move(md)))),
+   ...);
+  return md;
+}
+
+template <typename Call, typename Derived, auto... filter_methods,
+          size_t... Is>
+ServerMetadataHandle ExecuteCombinedServerTrailingMetadataWithChannelAccess(
+    Call* call, Derived* channel, ServerMetadataHandle md,
+    Valuelist<filter_methods...>, std::index_sequence<Is...>) {
+  ((md = RunSynchronously(
+        AdaptMethod<ServerMetadata, decltype(filter_methods), filter_methods>(
+            call->template fused_child<Is>(),
+            channel->template fused_child<Is>())(std::move(md)))),
+   ...);
+  return md;
+}
+
+template <MethodVariant variant, typename Derived, typename... Filters>
+class FuseImplOnServerTrailingMetadata;
+
+template <typename Derived, typename... Filters>
+class FuseImplOnServerTrailingMetadata<MethodVariant::kNoInterceptor, Derived,
+                                       Filters...> {
+ public:
+  static inline const NoInterceptor OnServerTrailingMetadata;
+};
+
+template <typename Derived, typename... Filters>
+class FuseImplOnServerTrailingMetadata<MethodVariant::kSimple, Derived,
+                                       Filters...> {
+ public:
+  ServerMetadataHandle OnServerTrailingMetadata(ServerMetadataHandle md) {
+    using Order =
+        ReverseFilterMethods<&Filters::Call::OnServerTrailingMetadata...>;
+    return ExecuteCombinedServerTrailingMetadata(
+        static_cast<typename Derived::Call*>(this), std::move(md),
+        typename Order::Methods(), typename Order::Idxs());
+  }
+};
+
+template <typename Derived, typename... Filters>
+class FuseImplOnServerTrailingMetadata<MethodVariant::kChannelAccess, Derived,
+                                       Filters...> {
+ public:
+  ServerMetadataHandle OnServerTrailingMetadata(ServerMetadataHandle md,
+                                                Derived* channel) {
+    using Order =
+        ReverseFilterMethods<&Filters::Call::OnServerTrailingMetadata...>;
+    return ExecuteCombinedServerTrailingMetadataWithChannelAccess(
+        static_cast<typename Derived::Call*>(this), channel, std::move(md),
+        typename Order::Methods(), typename Order::Idxs());
+  }
+};
+
+template <typename Derived, typename... Filters>
+using FuseOnServerTrailingMetadata = FuseImplOnServerTrailingMetadata<
+    MethodVariantForFilters<&Filters::Call::OnServerTrailingMetadata...>(),
+    Derived, Filters...>;
+
+// Half close interceptors return nothing, so there is no result to lose.
+template <auto method, typename Call, typename Filter>
+void RunHalfClose(Call* call, Filter* filter) {
+  using Method = decltype(method);
+  if constexpr (std::is_same_v<Method, const NoInterceptor*>) {
+    return;
+  } else if constexpr (std::is_invocable_v<Method, Call*>) {
+    static_assert(std::is_void_v<std::invoke_result_t<Method, Call*>>,
+                  "half close interceptors cannot fail");
+    (call->*method)();
+  } else {
+    static_assert(std::is_void_v<std::invoke_result_t<Method, Call*, Filter*>>,
+                  "half close interceptors cannot fail");
+    (call->*method)(filter);
+  }
+}
+
+template <typename Call, auto... filter_methods, size_t... Is>
+void ExecuteCombinedHalfClose(Call* call, Valuelist<filter_methods...>,
+                              std::index_sequence<Is...>) {
+  (RunHalfClose<filter_methods>(call->template fused_child<Is>(),
+                                static_cast<void*>(nullptr)),
+   ...);
+}
+
+template <typename Call, typename Derived, auto... filter_methods,
+          size_t... Is>
+void ExecuteCombinedHalfCloseWithChannelAccess(Call* call, Derived* channel,
+                                               Valuelist<filter_methods...>,
+                                               std::index_sequence<Is...>) {
+  (RunHalfClose<filter_methods>(call->template fused_child<Is>(),
+                                channel->template fused_child<Is>()),
+   ...);
+}
+
+template <MethodVariant variant, typename Derived, typename... Filters>
+class FuseImplOnClientToServerHalfClose;
+
+template <typename Derived, typename... Filters>
+class FuseImplOnClientToServerHalfClose<MethodVariant::kNoInterceptor,
+                                        Derived, Filters...> {
+ public:
+  static inline const NoInterceptor OnClientToServerHalfClose;
+};
+
+template <typename Derived, typename... Filters>
+class FuseImplOnClientToServerHalfClose<MethodVariant::kSimple, Derived,
+                                        Filters...> {
+ public:
+  void OnClientToServerHalfClose() {
+    using Order = FilterMethods<&Filters::Call::OnClientToServerHalfClose...>;
+    ExecuteCombinedHalfClose(static_cast<typename Derived::Call*>(this),
+                             typename Order::Methods(),
+                             typename Order::Idxs());
+  }
+};
+
+template <typename Derived, typename... Filters>
+class FuseImplOnClientToServerHalfClose<MethodVariant::kChannelAccess,
+                                        Derived, Filters...> {
+ public:
+  void OnClientToServerHalfClose(Derived* channel) {
+    using Order = FilterMethods<&Filters::Call::OnClientToServerHalfClose...>;
+    ExecuteCombinedHalfCloseWithChannelAccess(
+        static_cast<typename Derived::Call*>(this), channel,
+        typename Order::Methods(), typename Order::Idxs());
+  }
+};
+
+// Half close interceptors take no value, so the only argument one can have is
+// its filter.
+template <typename T>
+constexpr bool HalfCloseHasChannelAccess = false;
+
+template <typename T, typename R, typename C>
+constexpr bool HalfCloseHasChannelAccess<R (T::*)(C*)> = true;
+
+template <auto... Ts>
+constexpr MethodVariant HalfCloseVariantForFilters() {
+  if constexpr (AllNoInterceptor<decltype(Ts)...>) {
+    return MethodVariant::kNoInterceptor;
+  } else if constexpr ((HalfCloseHasChannelAccess<decltype(Ts)> || ...)) {
+    return MethodVariant::kChannelAccess;
+  } else {
+    return MethodVariant::kSimple;
+  }
+}
+
+template <typename Derived, typename... Filters>
+using FuseOnClientToServerHalfClose = FuseImplOnClientToServerHalfClose<
+    HalfCloseVariantForFilters<&Filters::Call::OnClientToServerHalfClose...>(),
+    Derived, Filters...>;
+
+// The per-call state of one of the filters in a FusedFilter. Filters whose
+// Call is constructed from the filter get it, as they would in CallFilters.
+template <typename Filter, typename = void>
+class FusedChildCall : public Filter::Call {
+ public:
+  explicit FusedChildCall(Filter* /*filter*/) {}
+};
+
+template <typename Filter>
+class FusedChildCall<
+    Filter, std::enable_if_t<
+                std::is_constructible<typename Filter::Call, Filter*>::value>>
+    : public Filter::Call {
+ public:
+  explicit FusedChildCall(Filter* filter) : Filter::Call(filter) {}
+};
+
+// Combines a list of filters into one, so that a CallFilters stack runs a
+// single operation per interception point for all of them instead of one per
+// filter. NoInterceptor hooks are fused away entirely, and synchronous hooks
+// are inlined into one promise.
 template <typename... Filters>
-class FusedFilter : public Filters... {
+class FusedFilter {
  public:
   class Call : public FuseOnClientInitialMetadata<FusedFilter, Filters...>,
                public FuseOnServerInitialMetadata<FusedFilter, Filters...>,
@@ -687,6 +912,12 @@ class FusedFilter : public Filters... {
                public FuseOnClientToServerHalfClose<FusedFilter, Filters...>,
                public FuseOnFinalize<FusedFilter, Filters...> {
    public:
+    // Child calls are not given their filter here, so this is only usable
+    // when none of them need it.
+    Call() : filter_calls_(static_cast<Filters*>(nullptr)...) {}
+    explicit Call(FusedFilter* filter)
+        : Call(filter, std::index_sequence_for<Filters...>()) {}
+
     template <size_t I>
     auto* fused_child() {
       return &std::get<I>(filter_calls_);
@@ -707,31 +938,70 @@ class FusedFilter : public Filters... {
     using FuseOnFinalize<FusedFilter, Filters...>::OnFinalize;
 
    private:
-    std::tuple<typename Filters::Call...> filter_calls_;
+    template <size_t... Is>
+    Call(FusedFilter* filter, std::index_sequence<Is...>)
+        : filter_calls_(filter->template fused_child<Is>()...) {}
+
+    std::tuple<FusedChildCall<Filters>...> filter_calls_;
   };
 
+  // Names the fused filter after its children, e.g. "http-client+compression".
+  static absl::string_view TypeName() {
+    static const std::string* const name =
+        new std::string(absl::StrJoin({Filters::TypeName()...}, "+"));
+    return *name;
+  }
+
+  FusedFilter() : filters_(std::make_unique<Filters>()...) {}
+  explicit FusedFilter(std::unique_ptr<Filters>... filters)
+      : filters_(std::move(filters)...) {}
+
+  // Creates each of the filters in turn, failing if any of them fail.
+  static absl::StatusOr<std::unique_ptr<FusedFilter>> Create(
+      const ChannelArgs& args, FilterArgs filter_args) {
+    absl::Status status;
+    std::tuple<std::unique_ptr<Filters>...> filters{
+        CreateChild<Filters>(args, filter_args, status)...};
+    if (!status.ok()) return status;
+    return std::apply(
+        [](std::unique_ptr<Filters>&... filters) {
+          return std::make_unique<FusedFilter>(std::move(filters)...);
+        },
+        filters);
+  }
+
+  template <size_t I>
+  auto* fused_child() {
+    return std::get<I>(filters_).get();
+  }
+
   bool StartTransportOp(grpc_transport_op* op) {
-    return StartTransportOpInternal(op, Typelist<Filters...>());
+    return (
+        std::get<std::unique_ptr<Filters>>(filters_)->StartTransportOp(op) ||
+        ...);
   }
 
   bool GetChannelInfo(const grpc_channel_info* info) {
-    return GetChannelInfoInternal(info, Typelist<Filters...>());
+    return (
+        std::get<std::unique_ptr<Filters>>(filters_)->GetChannelInfo(info) ||
+        ...);
   }
 
  private:
-  template <typename... FilterTypes>
-  bool StartTransportOpInternal(grpc_transport_op* op,
-                                Typelist<FilterTypes...>) {
-    return (std::get<FilterTypes>(filters_).StartTransportOp(op) || ...);
-  }
-
-  template <typename... FilterTypes>
-  bool GetChannelInfoInternal(const grpc_channel_info* info,
-                              Typelist<FilterTypes...>) {
-    return (std::get<FilterTypes>(filters_).GetChannelInfo(info) || ...);
+  template <typename Filter>
+  static std::unique_ptr<Filter> CreateChild(const ChannelArgs& args,
+                                             FilterArgs filter_args,
+                                             absl::Status& status) {
+    if (!status.ok()) return nullptr;
+    auto filter = Filter::Create(args, filter_args);
+    if (!filter.ok()) {
+      status = filter.status();
+      return nullptr;
+    }
+    return std::move(*filter);
   }
 
-  std::tuple<Filters...> filters_;
+  std::tuple<std::unique_ptr<Filters>...> filters_;
 };
 
 }  // namespace filters_detail
@@ -74,6 +74,8 @@ class RequestBuffer {
       return Arena::MakePooled<ClientMetadata>(md->Copy());
     }
 
+    // Takes refs on the message's slices rather than copying their bytes,
+    // so every attempt shares the payload with the transport writes.
     MessageHandle CopyObject(const MessageHandle& msg) {
       return Arena::MakePooled<Message>(msg->payload()->Copy(), msg->flags());
     }
@@ -25,11 +25,14 @@
 #include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
 #include "absl/strings/strip.h"
 #include "src/core/channelz/channelz_registry.h"
 #include "src/core/lib/address_utils/parse_address.h"
@@ -49,13 +52,22 @@ namespace channelz {
 // BaseNode
 //
 
-BaseNode::BaseNode(EntityType type, std::string name)
-    : type_(type), uuid_(-1), name_(std::move(name)) {
-  // The registry will set uuid_ under its lock.
-  ChannelzRegistry::Register(this);
+BaseNode::BaseNode(EntityType type, std::string name,
+                   Registration registration)
+    : type_(type), name_(std::move(name)) {
+  // The registry will set uuid_.
+  if (registration == Registration::kEager) ChannelzRegistry::Register(this);
+}
+
+BaseNode::~BaseNode() {
+  intptr_t uuid = uuid_.load(std::memory_order_acquire);
+  if (uuid > 0) ChannelzRegistry::Unregister(uuid);
 }
 
-BaseNode::~BaseNode() { ChannelzRegistry::Unregister(uuid_); }
+intptr_t BaseNode::RegisterLazily() {
+  ChannelzRegistry::Register(this);
+  return uuid_.load(std::memory_order_acquire);
+}
 
 std::string BaseNode::RenderJsonString() {
   Json json = RenderJson();
@@ -150,6 +162,69 @@ void PerCpuCallCountingHelper::PopulateCallCounts(Json::Object* json) {
   }
 }
 
+//
+// CallLatencyHelper
+//
+
+namespace {
+
+Json::Object RenderLatencySummary(const LatencySketch::Summary& summary) {
+  auto seconds = [](double value) {
+    return Json::FromString(absl::StrFormat("%.6fs", value));
+  };
+  return Json::Object{
+      {"count", Json::FromString(absl::StrCat(summary.count))},
+      {"p50", seconds(summary.p50)},
+      {"p90", seconds(summary.p90)},
+      {"p99", seconds(summary.p99)},
+      {"max", seconds(summary.max)},
+  };
+}
+
+}  // namespace
+
+void CallLatencyHelper::TrackMethods(const std::vector<std::string>& methods) {
+  if (methods.empty()) return;
+  auto sketches = std::make_unique<MethodSketches>();
+  for (const std::string& method : methods) {
+    sketches->emplace(method, std::make_unique<LatencySketch>());
+  }
+  const MethodSketches* previous =
+      methods_.exchange(sketches.release(), std::memory_order_acq_rel);
+  CHECK_EQ(previous, nullptr);
+}
+
+void CallLatencyHelper::RecordCall(absl::string_view method, double seconds) {
+  if (!enabled()) return;
+  all_calls_.Record(seconds);
+  // Only methods the server registered are tracked, so that clients can't
+  // grow this by calling made up methods.
+  const MethodSketches* methods = methods_.load(std::memory_order_acquire);
+  if (methods == nullptr) return;
+  auto it = methods->find(method);
+  if (it != methods->end()) it->second->Record(seconds);
+}
+
+void CallLatencyHelper::PopulateCallLatency(Json::Object* json) {
+  LatencySketch::Summary summary = all_calls_.Summarize();
+  if (summary.count == 0) return;
+  (*json)["callLatency"] = Json::FromObject(RenderLatencySummary(summary));
+  Json::Array methods;
+  const MethodSketches* sketches = methods_.load(std::memory_order_acquire);
+  if (sketches != nullptr) {
+    for (const auto& [method, sketch] : *sketches) {
+      LatencySketch::Summary method_summary = sketch->Summarize();
+      if (method_summary.count == 0) continue;
+      Json::Object method_json = RenderLatencySummary(method_summary);
+      method_json["method"] = Json::FromString(method);
+      methods.emplace_back(Json::FromObject(std::move(method_json)));
+    }
+  }
+  if (!methods.empty()) {
+    (*json)["methodCallLatency"] = Json::FromArray(std::move(methods));
+  }
+}
+
 //
 // ChannelNode
 //
@@ -200,6 +275,7 @@ Json ChannelNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  call_latency_.PopulateCallLatency(&data);
   // Construct outer object.
   Json::Object json = {
       {"ref", Json::FromObject({
@@ -216,8 +292,15 @@ Json ChannelNode::RenderJson() {
 void ChannelNode::PopulateChildRefs(Json::Object* json) {
   MutexLock lock(&child_mu_);
   if (!child_subchannels_.empty()) {
+    // Getting the uuids registers any lazily registered subchannels.
+    std::vector<intptr_t> subchannel_uuids;
+    subchannel_uuids.reserve(child_subchannels_.size());
+    for (auto& p : child_subchannels_) {
+      subchannel_uuids.push_back(p.second->uuid());
+    }
+    std::sort(subchannel_uuids.begin(), subchannel_uuids.end());
     Json::Array array;
-    for (intptr_t subchannel_uuid : child_subchannels_) {
+    for (intptr_t subchannel_uuid : subchannel_uuids) {
       array.emplace_back(Json::FromObject({
           {"subchannelId", Json::FromString(absl::StrCat(subchannel_uuid))},
       }));
@@ -251,14 +334,15 @@ void ChannelNode::RemoveChildChannel(intptr_t child_uuid) {
   child_channels_.erase(child_uuid);
 }
 
-void ChannelNode::AddChildSubchannel(intptr_t child_uuid) {
+void ChannelNode::AddChildSubchannel(RefCountedPtr<SubchannelNode> child) {
   MutexLock lock(&child_mu_);
-  child_subchannels_.insert(child_uuid);
+  SubchannelNode* key = child.get();
+  child_subchannels_.emplace(key, std::move(child));
 }
 
-void ChannelNode::RemoveChildSubchannel(intptr_t child_uuid) {
+void ChannelNode::RemoveChildSubchannel(SubchannelNode* child) {
   MutexLock lock(&child_mu_);
-  child_subchannels_.erase(child_uuid);
+  child_subchannels_.erase(child);
 }
 
 //
@@ -266,8 +350,9 @@ void ChannelNode::RemoveChildSubchannel(intptr_t child_uuid) {
 //
 
 SubchannelNode::SubchannelNode(std::string target_address,
-                               size_t channel_tracer_max_nodes)
-    : BaseNode(EntityType::kSubchannel, target_address),
+                               size_t channel_tracer_max_nodes,
+                               Registration registration)
+    : BaseNode(EntityType::kSubchannel, target_address, registration),
       target_(std::move(target_address)),
       trace_(channel_tracer_max_nodes) {}
 
@@ -312,7 +397,7 @@ Json SubchannelNode::RenderJson() {
     MutexLock lock(&socket_mu_);
     child_socket = child_socket_;
   }
-  if (child_socket != nullptr && child_socket->uuid() != 0) {
+  if (child_socket != nullptr) {
     object["socketRef"] = Json::FromArray({
         Json::FromObject({
             {"socketId", Json::FromString(absl::StrCat(child_socket->uuid()))},
@@ -334,12 +419,13 @@ ServerNode::~ServerNode() {}
 
 void ServerNode::AddChildSocket(RefCountedPtr<SocketNode> node) {
   MutexLock lock(&child_mu_);
-  child_sockets_.insert(std::pair(node->uuid(), std::move(node)));
+  SocketNode* key = node.get();
+  child_sockets_.emplace(key, std::move(node));
 }
 
-void ServerNode::RemoveChildSocket(intptr_t child_uuid) {
+void ServerNode::RemoveChildSocket(SocketNode* node) {
   MutexLock lock(&child_mu_);
-  child_sockets_.erase(child_uuid);
+  child_sockets_.erase(node);
 }
 
 void ServerNode::AddChildListenSocket(RefCountedPtr<ListenSocketNode> node) {
@@ -361,19 +447,23 @@ std::string ServerNode::RenderServerSockets(intptr_t start_socket_id,
   Json::Object object;
   {
     MutexLock lock(&child_mu_);
-    size_t sockets_rendered = 0;
+    // Getting the uuids registers any lazily registered sockets.
+    std::vector<std::pair<intptr_t, SocketNode*>> sockets;
+    for (auto& p : child_sockets_) {
+      intptr_t uuid = p.second->uuid();
+      if (uuid >= start_socket_id) sockets.emplace_back(uuid, p.first);
+    }
+    std::sort(sockets.begin(), sockets.end());
     // Create list of socket refs.
     Json::Array array;
-    auto it = child_sockets_.lower_bound(start_socket_id);
-    for (; it != child_sockets_.end() && sockets_rendered < pagination_limit;
-         ++it, ++sockets_rendered) {
+    for (size_t i = 0; i < sockets.size() && i < pagination_limit; ++i) {
       array.emplace_back(Json::FromObject({
-          {"socketId", Json::FromString(absl::StrCat(it->first))},
-          {"name", Json::FromString(it->second->name())},
+          {"socketId", Json::FromString(absl::StrCat(sockets[i].first))},
+          {"name", Json::FromString(sockets[i].second->name())},
       }));
     }
     object["socketRef"] = Json::FromArray(std::move(array));
-    if (it == child_sockets_.end()) {
+    if (sockets.size() <= pagination_limit) {
       object["end"] = Json::FromBool(true);
     }
   }
@@ -389,6 +479,7 @@ Json ServerNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  call_latency_.PopulateCallLatency(&data);
   // Construct top-level object.
   Json::Object object = {
       {"ref", Json::FromObject({
@@ -538,12 +629,89 @@ void PopulateSocketAddressJson(Json::Object* json, const char* name,
 }  // namespace
 
 SocketNode::SocketNode(std::string local, std::string remote, std::string name,
-                       RefCountedPtr<Security> security)
-    : BaseNode(EntityType::kSocket, std::move(name)),
+                       RefCountedPtr<Security> security,
+                       Registration registration)
+    : BaseNode(EntityType::kSocket, std::move(name), registration),
       local_(std::move(local)),
       remote_(std::move(remote)),
       security_(std::move(security)) {}
 
+void SocketNode::AddMemoryOwner(absl::string_view tag,
+                                const MemoryOwner& owner) {
+  MutexLock lock(&memory_mu_);
+  memory_owners_.push_back(
+      MemoryOwnerReport{std::string(tag), owner.allocator_for_reporting()});
+}
+
+void SocketNode::SetCallArenaAllocator(
+    RefCountedPtr<CallArenaAllocator> allocator) {
+  MutexLock lock(&memory_mu_);
+  call_arena_allocator_ = std::move(allocator);
+}
+
+Json::Array SocketNode::RenderMemoryOptions() {
+  // The channelz proto has no fields for memory usage, so it is reported
+  // through the free form socket options instead.
+  Json::Array options;
+  auto add_option = [&options](absl::string_view name, size_t value) {
+    options.emplace_back(Json::FromObject({
+        {"name", Json::FromString(std::string(name))},
+        {"value", Json::FromString(absl::StrCat(value))},
+    }));
+  };
+  MutexLock lock(&memory_mu_);
+  for (const MemoryOwnerReport& report : memory_owners_) {
+    auto allocator = report.allocator.lock();
+    if (allocator == nullptr) continue;
+    const size_t taken = allocator->GetTakenBytes();
+    const size_t free = std::min(taken, allocator->GetFreeBytes());
+    add_option(absl::StrCat("grpc.memory.", report.tag, ".reserved_bytes"),
+               taken - free);
+    add_option(absl::StrCat("grpc.memory.", report.tag, ".cached_bytes"),
+               free);
+  }
+  if (call_arena_allocator_ != nullptr) {
+    add_option("grpc.memory.call_arena.estimate_bytes",
+               call_arena_allocator_->CallSizeEstimate());
+    add_option("grpc.memory.call_arena.high_water_bytes",
+               call_arena_allocator_->MaxCallSize());
+  }
+  return options;
+}
+
+void SocketNode::SetTcpInfo(
+    const TcpTracerInterface::ConnectionMetrics& metrics) {
+  MutexLock lock(&tcp_info_mu_);
+  tcp_info_ = metrics;
+}
+
+void SocketNode::RenderTcpInfoOptions(Json::Array& options) {
+  auto add_option = [&options](absl::string_view name, const auto& value) {
+    if (!value.has_value()) return;
+    options.emplace_back(Json::FromObject({
+        {"name", Json::FromString(absl::StrCat("grpc.tcp_info.", name))},
+        {"value", Json::FromString(absl::StrCat(*value))},
+    }));
+  };
+  MutexLock lock(&tcp_info_mu_);
+  if (!tcp_info_.has_value()) return;
+  add_option("srtt_usec", tcp_info_->srtt);
+  add_option("min_rtt_usec", tcp_info_->min_rtt);
+  add_option("congestion_window", tcp_info_->congestion_window);
+  add_option("snd_ssthresh", tcp_info_->snd_ssthresh);
+  add_option("packet_retx", tcp_info_->packet_retx);
+  add_option("delivery_rate", tcp_info_->delivery_rate);
+  add_option("delivery_rate_app_limited",
+             tcp_info_->is_delivery_rate_app_limited);
+  add_option("pacing_rate", tcp_info_->pacing_rate);
+  add_option("data_notsent_bytes", tcp_info_->data_notsent);
+  add_option("data_sent_bytes", tcp_info_->data_sent);
+  add_option("data_retx_bytes", tcp_info_->data_retx);
+  add_option("busy_usec", tcp_info_->busy_usec);
+  add_option("rwnd_limited_usec", tcp_info_->rwnd_limited_usec);
+  add_option("sndbuf_limited_usec", tcp_info_->sndbuf_limited_usec);
+}
+
 void SocketNode::RecordStreamStartedFromLocal() {
   streams_started_.fetch_add(1, std::memory_order_relaxed);
   last_local_stream_created_cycle_.store(gpr_get_cycle_counter(),
@@ -630,6 +798,9 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = Json::FromString(absl::StrCat(keepalives_sent));
   }
+  Json::Array options = RenderMemoryOptions();
+  RenderTcpInfoOptions(options);
+  if (!options.empty()) data["option"] = Json::FromArray(std::move(options));
   // Create and fill the parent object.
   Json::Object object = {
       {"ref", Json::FromObject({
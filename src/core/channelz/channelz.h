@@ -27,16 +27,23 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "src/core/channelz/channel_trace.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/transport/call_arena_allocator.h"
+#include "src/core/telemetry/tcp_tracer.h"
 #include "src/core/util/json/json.h"
+#include "src/core/util/latency_sketch.h"
 #include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -65,6 +72,7 @@ namespace grpc_core {
 
 namespace channelz {
 
+class SubchannelNode;
 class SocketNode;
 class ListenSocketNode;
 
@@ -87,8 +95,20 @@ class BaseNode : public RefCounted<BaseNode> {
     kSocket,
   };
 
+  // When a node is registered with the ChannelzRegistry, which is also when
+  // it is assigned a uuid.
+  enum class Registration {
+    // When the node is created.
+    kEager,
+    // The first time the node's uuid is needed, which is usually when a
+    // channelz query renders a reference to it. Until then, the node is not
+    // in the registry, and so does not slow down registry lookups.
+    kLazy,
+  };
+
  protected:
-  BaseNode(EntityType type, std::string name);
+  BaseNode(EntityType type, std::string name,
+           Registration registration = Registration::kEager);
 
  public:
   ~BaseNode() override;
@@ -101,14 +121,24 @@ class BaseNode : public RefCounted<BaseNode> {
   std::string RenderJsonString();
 
   EntityType type() const { return type_; }
-  intptr_t uuid() const { return uuid_; }
+  // Registers the node first if it was created with Registration::kLazy and
+  // has not been registered yet.
+  intptr_t uuid() {
+    intptr_t uuid = uuid_.load(std::memory_order_acquire);
+    if (GPR_LIKELY(uuid > 0)) return uuid;
+    return RegisterLazily();
+  }
   const std::string& name() const { return name_; }
 
  private:
-  // to allow the ChannelzRegistry to set uuid_ under its lock.
+  // to allow the ChannelzRegistry to set uuid_.
   friend class ChannelzRegistry;
+
+  intptr_t RegisterLazily();
+
   const EntityType type_;
-  intptr_t uuid_;
+  // 0 until the node is registered.
+  std::atomic<intptr_t> uuid_{0};
   std::string name_;
 };
 
@@ -161,6 +191,47 @@ class PerCpuCallCountingHelper final {
   PerCpu<PerCpuData> per_cpu_data_{PerCpuOptions().SetCpusPerShard(4)};
 };
 
+// Tracks the latency of calls for a channelz entity, both overall and, for
+// the methods given to TrackMethods(), per method. Latencies are kept in
+// per-CPU streaming sketches, so that percentiles can be rendered at any time.
+//
+// Recording is off unless enabled, with GRPC_ARG_CHANNELZ_CALL_LATENCY.
+class CallLatencyHelper final {
+ public:
+  CallLatencyHelper() = default;
+  ~CallLatencyHelper() { delete methods_.load(std::memory_order_relaxed); }
+
+  CallLatencyHelper(const CallLatencyHelper&) = delete;
+  CallLatencyHelper& operator=(const CallLatencyHelper&) = delete;
+
+  void Enable() { enabled_.store(true, std::memory_order_relaxed); }
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Gives each of \a methods a sketch of its own. Called at most once, before
+  // any call to those methods is recorded, so that finding a method's sketch
+  // takes no lock.
+  void TrackMethods(const std::vector<std::string>& methods);
+
+  // Records the latency of a call.
+  void RecordCall(double seconds) {
+    if (enabled()) all_calls_.Record(seconds);
+  }
+  // Records the latency of a call to \a method.
+  void RecordCall(absl::string_view method, double seconds);
+
+  // Renders the call latency percentiles, if any call has been recorded.
+  void PopulateCallLatency(Json::Object* json);
+
+ private:
+  using MethodSketches =
+      std::map<std::string, std::unique_ptr<LatencySketch>, std::less<>>;
+
+  std::atomic<bool> enabled_{false};
+  LatencySketch all_calls_;
+  // Set once by TrackMethods(), and not changed after that.
+  std::atomic<const MethodSketches*> methods_{nullptr};
+};
+
 // Handles channelz bookkeeping for channels
 class ChannelNode final : public BaseNode {
  public:
@@ -193,6 +264,9 @@ class ChannelNode final : public BaseNode {
   void RecordCallStarted() { call_counter_.RecordCallStarted(); }
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
+  void EnableCallLatency() { call_latency_.Enable(); }
+  bool call_latency_enabled() const { return call_latency_.enabled(); }
+  void RecordCallLatency(double seconds) { call_latency_.RecordCall(seconds); }
 
   void SetConnectivityState(grpc_connectivity_state state);
 
@@ -201,31 +275,33 @@ class ChannelNode final : public BaseNode {
   void AddChildChannel(intptr_t child_uuid);
   void RemoveChildChannel(intptr_t child_uuid);
 
-  // TODO(roth): take in a RefCountedPtr to the child subchannel so we can
-  // retrieve the human-readable name.
-  void AddChildSubchannel(intptr_t child_uuid);
-  void RemoveChildSubchannel(intptr_t child_uuid);
+  // Child subchannels are tracked by node rather than by uuid, so that adding
+  // a lazily registered subchannel does not register it.
+  void AddChildSubchannel(RefCountedPtr<SubchannelNode> child);
+  void RemoveChildSubchannel(SubchannelNode* child);
 
  private:
   void PopulateChildRefs(Json::Object* json);
 
   std::string target_;
-  CallCountingHelper call_counter_;
+  PerCpuCallCountingHelper call_counter_;
+  CallLatencyHelper call_latency_;
   ChannelTrace trace_;
 
   // Least significant bit indicates whether the value is set.  Remaining
   // bits are a grpc_connectivity_state value.
   std::atomic<int> connectivity_state_{0};
 
-  Mutex child_mu_;  // Guards sets below.
+  Mutex child_mu_;  // Guards maps below.
   std::set<intptr_t> child_channels_;
-  std::set<intptr_t> child_subchannels_;
+  std::map<SubchannelNode*, RefCountedPtr<SubchannelNode>> child_subchannels_;
 };
 
 // Handles channelz bookkeeping for subchannels
 class SubchannelNode final : public BaseNode {
  public:
-  SubchannelNode(std::string target_address, size_t channel_tracer_max_nodes);
+  SubchannelNode(std::string target_address, size_t channel_tracer_max_nodes,
+                 Registration registration = Registration::kEager);
   ~SubchannelNode() override;
 
   // Sets the subchannel's connectivity state without health checking.
@@ -260,7 +336,7 @@ class SubchannelNode final : public BaseNode {
   Mutex socket_mu_;
   RefCountedPtr<SocketNode> child_socket_ ABSL_GUARDED_BY(socket_mu_);
   std::string target_;
-  CallCountingHelper call_counter_;
+  PerCpuCallCountingHelper call_counter_;
   ChannelTrace trace_;
 };
 
@@ -278,7 +354,7 @@ class ServerNode final : public BaseNode {
 
   void AddChildSocket(RefCountedPtr<SocketNode> node);
 
-  void RemoveChildSocket(intptr_t child_uuid);
+  void RemoveChildSocket(SocketNode* node);
 
   void AddChildListenSocket(RefCountedPtr<ListenSocketNode> node);
 
@@ -297,12 +373,24 @@ class ServerNode final : public BaseNode {
   void RecordCallStarted() { call_counter_.RecordCallStarted(); }
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
+  void EnableCallLatency() { call_latency_.Enable(); }
+  bool call_latency_enabled() const { return call_latency_.enabled(); }
+  // Keeps the latency of the calls to each of \a methods apart, as well.
+  void TrackMethodCallLatency(const std::vector<std::string>& methods) {
+    call_latency_.TrackMethods(methods);
+  }
+  void RecordCallLatency(absl::string_view method, double seconds) {
+    call_latency_.RecordCall(method, seconds);
+  }
 
  private:
   PerCpuCallCountingHelper call_counter_;
+  CallLatencyHelper call_latency_;
   ChannelTrace trace_;
   Mutex child_mu_;  // Guards child maps below.
-  std::map<intptr_t, RefCountedPtr<SocketNode>> child_sockets_;
+  // Keyed by node rather than by uuid, so that adding a lazily registered
+  // socket does not register it.
+  std::map<SocketNode*, RefCountedPtr<SocketNode>> child_sockets_;
   std::map<intptr_t, RefCountedPtr<ListenSocketNode>> child_listen_sockets_;
 };
 
@@ -347,7 +435,8 @@ class SocketNode final : public BaseNode {
   };
 
   SocketNode(std::string local, std::string remote, std::string name,
-             RefCountedPtr<Security> security);
+             RefCountedPtr<Security> security,
+             Registration registration = Registration::kEager);
   ~SocketNode() override {}
 
   Json RenderJson() override;
@@ -368,7 +457,25 @@ class SocketNode final : public BaseNode {
 
   const std::string& remote() { return remote_; }
 
+  // Report the memory held by owner as "grpc.memory.<tag>.*" socket options.
+  // The owner may be destroyed before this node.
+  void AddMemoryOwner(absl::string_view tag, const MemoryOwner& owner);
+  // Report the sizes of the arenas of calls on this socket as
+  // "grpc.memory.call_arena.*" socket options.
+  void SetCallArenaAllocator(RefCountedPtr<CallArenaAllocator> allocator);
+  // Report the latest TCP_INFO sample of the connection as "grpc.tcp_info.*"
+  // socket options.
+  void SetTcpInfo(const TcpTracerInterface::ConnectionMetrics& metrics);
+
  private:
+  struct MemoryOwnerReport {
+    std::string tag;
+    std::weak_ptr<const GrpcMemoryAllocatorImpl> allocator;
+  };
+
+  Json::Array RenderMemoryOptions();
+  void RenderTcpInfoOptions(Json::Array& options);
+
   std::atomic<int64_t> streams_started_{0};
   std::atomic<int64_t> streams_succeeded_{0};
   std::atomic<int64_t> streams_failed_{0};
@@ -382,6 +489,13 @@ class SocketNode final : public BaseNode {
   std::string local_;
   std::string remote_;
   RefCountedPtr<Security> const security_;
+  Mutex memory_mu_;
+  std::vector<MemoryOwnerReport> memory_owners_ ABSL_GUARDED_BY(memory_mu_);
+  RefCountedPtr<CallArenaAllocator> call_arena_allocator_
+      ABSL_GUARDED_BY(memory_mu_);
+  Mutex tcp_info_mu_;
+  std::optional<TcpTracerInterface::ConnectionMetrics> tcp_info_
+      ABSL_GUARDED_BY(tcp_info_mu_);
 };
 
 // Handles channelz bookkeeping for listen sockets
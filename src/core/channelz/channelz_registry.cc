@@ -41,7 +41,7 @@ namespace grpc_core {
 namespace channelz {
 namespace {
 
-const int kPaginationLimit = 100;
+const size_t kPaginationLimit = 100;
 
 }  // anonymous namespace
 
@@ -51,58 +51,84 @@ ChannelzRegistry* ChannelzRegistry::Default() {
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
-  MutexLock lock(&mu_);
-  node->uuid_ = ++uuid_generator_;
-  node_map_[node->uuid_] = node;
+  const intptr_t uuid =
+      uuid_generator_.fetch_add(1, std::memory_order_relaxed) + 1;
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  // Lazily registered nodes may race to register themselves; only the first
+  // registration sticks. The uuid allocated by the loser is simply skipped.
+  intptr_t expected = 0;
+  if (!node->uuid_.compare_exchange_strong(expected, uuid,
+                                           std::memory_order_acq_rel)) {
+    return;
+  }
+  shard.node_map[uuid] = node;
 }
 
 void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
   CHECK_GE(uuid, 1);
-  MutexLock lock(&mu_);
-  CHECK(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+  CHECK(uuid <= uuid_generator_.load(std::memory_order_relaxed));
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  shard.node_map.erase(uuid);
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
-  MutexLock lock(&mu_);
-  if (uuid < 1 || uuid > uuid_generator_) {
+  if (uuid < 1 || uuid > uuid_generator_.load(std::memory_order_relaxed)) {
     return nullptr;
   }
-  auto it = node_map_.find(uuid);
-  if (it == node_map_.end()) return nullptr;
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  auto it = shard.node_map.find(uuid);
+  if (it == shard.node_map.end()) return nullptr;
   // Found node.  Return only if its refcount is not zero (i.e., when we
   // know that there is no other thread about to destroy it).
   BaseNode* node = it->second;
   return node->RefIfNonZero();
 }
 
-std::string ChannelzRegistry::InternalGetTopChannels(
-    intptr_t start_channel_id) {
-  std::vector<RefCountedPtr<BaseNode>> top_level_channels;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
+std::vector<RefCountedPtr<BaseNode>> ChannelzRegistry::InternalGetNodes(
+    BaseNode::EntityType type, intptr_t start_id, size_t max_results) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (Shard& shard : shards_) {
+    // No shard can contribute more than max_results + 1 nodes to the result,
+    // so stop there.
+    size_t found = 0;
+    MutexLock lock(&shard.mu);
+    for (auto it = shard.node_map.lower_bound(start_id);
+         it != shard.node_map.end() && found <= max_results; ++it) {
       BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (top_level_channels.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        top_level_channels.emplace_back(std::move(node_ref));
-      }
+      if (node->type() != type) continue;
+      RefCountedPtr<BaseNode> node_ref = node->RefIfNonZero();
+      if (node_ref == nullptr) continue;
+      nodes.emplace_back(std::move(node_ref));
+      ++found;
     }
   }
+  // The nodes beyond the limit are unreffed here rather than under a shard
+  // lock, since unreffing may destroy a node, which would deadlock when it
+  // unregisters itself.
+  std::sort(nodes.begin(), nodes.end(),
+            [](const RefCountedPtr<BaseNode>& a,
+               const RefCountedPtr<BaseNode>& b) {
+              return a->uuid() < b->uuid();
+            });
+  if (nodes.size() > max_results + 1) nodes.resize(max_results + 1);
+  return nodes;
+}
+
+std::string ChannelzRegistry::InternalGetTopChannels(
+    intptr_t start_channel_id) {
+  std::vector<RefCountedPtr<BaseNode>> top_level_channels = InternalGetNodes(
+      BaseNode::EntityType::kTopLevelChannel, start_channel_id,
+      kPaginationLimit);
   Json::Object object;
+  // If there is a node beyond the pagination limit, this is not the end.
+  if (top_level_channels.size() > kPaginationLimit) {
+    top_level_channels.resize(kPaginationLimit);
+  } else {
+    object["end"] = Json::FromBool(true);
+  }
   if (!top_level_channels.empty()) {
     // Create list of channels.
     Json::Array array;
@@ -111,38 +137,19 @@ std::string ChannelzRegistry::InternalGetTopChannels(
     }
     object["channel"] = Json::FromArray(std::move(array));
   }
-  if (node_after_pagination_limit == nullptr) {
-    object["end"] = Json::FromBool(true);
-  }
   return JsonDump(Json::FromObject(std::move(object)));
 }
 
 std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
-  std::vector<RefCountedPtr<BaseNode>> servers;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (servers.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        servers.emplace_back(std::move(node_ref));
-      }
-    }
-  }
+  std::vector<RefCountedPtr<BaseNode>> servers = InternalGetNodes(
+      BaseNode::EntityType::kServer, start_server_id, kPaginationLimit);
   Json::Object object;
+  // If there is a node beyond the pagination limit, this is not the end.
+  if (servers.size() > kPaginationLimit) {
+    servers.resize(kPaginationLimit);
+  } else {
+    object["end"] = Json::FromBool(true);
+  }
   if (!servers.empty()) {
     // Create list of servers.
     Json::Array array;
@@ -151,17 +158,14 @@ std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
     }
     object["server"] = Json::FromArray(std::move(array));
   }
-  if (node_after_pagination_limit == nullptr) {
-    object["end"] = Json::FromBool(true);
-  }
   return JsonDump(Json::FromObject(std::move(object)));
 }
 
 void ChannelzRegistry::InternalLogAllEntities() {
   std::vector<RefCountedPtr<BaseNode>> nodes;
-  {
-    MutexLock lock(&mu_);
-    for (auto& p : node_map_) {
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (auto& p : shard.node_map) {
       RefCountedPtr<BaseNode> node = p.second->RefIfNonZero();
       if (node != nullptr) {
         nodes.emplace_back(std::move(node));
@@ -21,9 +21,11 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/channelz/channelz.h"
@@ -35,6 +37,11 @@ namespace channelz {
 
 // singleton registry object to track all objects that are needed to support
 // channelz bookkeeping. All objects share globally distributed uuids.
+//
+// Uuids are allocated without taking a lock, and nodes are spread over
+// several shards by uuid, each with its own lock, so that creating and
+// destroying channels, subchannels and sockets on different threads does not
+// serialize on a single mutex.
 class ChannelzRegistry final {
  public:
   static void Register(BaseNode* node) {
@@ -64,15 +71,26 @@ class ChannelzRegistry final {
   // Test only helper function to reset to initial state.
   static void TestOnlyReset() {
     auto* p = Default();
-    MutexLock lock(&p->mu_);
-    p->node_map_.clear();
-    p->uuid_generator_ = 0;
+    for (auto& shard : p->shards_) {
+      MutexLock lock(&shard.mu);
+      shard.node_map.clear();
+    }
+    p->uuid_generator_.store(0, std::memory_order_relaxed);
   }
 
  private:
+  static constexpr size_t kNumShards = 16;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    Mutex mu;
+    std::map<intptr_t, BaseNode*> node_map ABSL_GUARDED_BY(mu);
+  };
+
   // Returned the singleton instance of ChannelzRegistry;
   static ChannelzRegistry* Default();
 
+  Shard& ShardFor(intptr_t uuid) { return shards_[uuid % kNumShards]; }
+
   // globally registers an Entry. Returns its unique uuid
   void InternalRegister(BaseNode* node);
 
@@ -84,15 +102,19 @@ class ChannelzRegistry final {
   // returns the void* associated with that uuid. Else returns nullptr.
   RefCountedPtr<BaseNode> InternalGet(intptr_t uuid);
 
+  // Returns up to \a max_results + 1 nodes of type \a type with a uuid of at
+  // least \a start_id, in uuid order. The extra node tells the caller that
+  // the results were truncated.
+  std::vector<RefCountedPtr<BaseNode>> InternalGetNodes(
+      BaseNode::EntityType type, intptr_t start_id, size_t max_results);
+
   std::string InternalGetTopChannels(intptr_t start_channel_id);
   std::string InternalGetServers(intptr_t start_server_id);
 
   void InternalLogAllEntities();
 
-  // protects members
-  Mutex mu_;
-  std::map<intptr_t, BaseNode*> node_map_ ABSL_GUARDED_BY(mu_);
-  intptr_t uuid_generator_ ABSL_GUARDED_BY(mu_) = 0;
+  Shard shards_[kNumShards];
+  std::atomic<intptr_t> uuid_generator_{0};
 };
 
 }  // namespace channelz
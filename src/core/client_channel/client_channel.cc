@@ -61,6 +61,7 @@
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
@@ -87,6 +88,7 @@
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/resolver/resolver_registry.h"
 #include "src/core/service_config/service_config_impl.h"
+#include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/metrics.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
@@ -238,7 +240,7 @@ class ClientChannel::SubchannelWrapper::WatcherWrapper
         << subchannel_wrapper_->subchannel_.get()
         << "; hopping into work_serializer";
     self.release();  // Held by callback.
-    subchannel_wrapper_->client_channel_->work_serializer_->Run(
+    subchannel_wrapper_->client_channel_->work_serializer_->RunUrgent(
         [this, state, status]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
             *subchannel_wrapper_->client_channel_->work_serializer_) {
           ApplyUpdateInControlPlaneWorkSerializer(state, status);
@@ -325,7 +327,7 @@ ClientChannel::SubchannelWrapper::SubchannelWrapper(
           client_channel_->subchannel_refcount_map_.find(subchannel_.get());
       if (it == client_channel_->subchannel_refcount_map_.end()) {
         client_channel_->channelz_node_->AddChildSubchannel(
-            subchannel_node->uuid());
+            subchannel_node->RefAsSubclass<channelz::SubchannelNode>());
         it = client_channel_->subchannel_refcount_map_
                  .emplace(subchannel_.get(), 0)
                  .first;
@@ -361,7 +363,7 @@ void ClientChannel::SubchannelWrapper::Orphaned() {
             --it->second;
             if (it->second == 0) {
               self->client_channel_->channelz_node_->RemoveChildSubchannel(
-                  subchannel_node->uuid());
+                  subchannel_node);
               self->client_channel_->subchannel_refcount_map_.erase(it);
             }
           }
@@ -467,6 +469,19 @@ class ClientChannel::ClientChannelControlHelper
   void RequestReresolution() override
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*client_channel_->work_serializer_) {
     if (client_channel_->resolver_ == nullptr) return;  // Shutting down.
+    // A forked child inherits the parent's channels but none of its
+    // connections, so the LB policy asks for re-resolution as they all fail.
+    // The addresses have not changed: keep the resolver result, and the
+    // service config and LB config that came with it, and just reconnect.
+    const uint64_t fork_generation = Fork::ForkGeneration();
+    if (std::exchange(client_channel_->reresolution_fork_generation_,
+                      fork_generation) != fork_generation &&
+        IsForkKeepsResolverResultEnabled()) {
+      GRPC_TRACE_LOG(client_channel, INFO)
+          << "client_channel=" << client_channel_.get()
+          << ": not re-resolving after fork";
+      return;
+    }
     GRPC_TRACE_LOG(client_channel, INFO)
         << "client_channel=" << client_channel_.get()
         << ": started name re-resolving";
@@ -611,6 +626,9 @@ ClientChannel::ClientChannel(
       uri_to_resolve_(std::move(uri_to_resolve)),
       service_config_parser_index_(
           internal::ClientChannelServiceConfigParser::ParserIndex()),
+      warm_idle_(
+          channel_args_.GetBool(GRPC_ARG_EXPERIMENTAL_CLIENT_CHANNEL_WARM_IDLE)
+              .value_or(false)),
       default_service_config_(std::move(default_service_config)),
       client_channel_factory_(client_channel_factory),
       default_authority_(
@@ -621,6 +639,12 @@ ClientChannel::ClientChannel(
       picker_(nullptr),
       call_destination_(
           call_destination_factory->CreateCallDestination(picker_)),
+      picker_update_coalescing_window_(std::max(
+          Duration::Zero(),
+          channel_args_
+              .GetDurationFromIntMillis(
+                  GRPC_ARG_EXPERIMENTAL_PICKER_UPDATE_COALESCING_WINDOW_MS)
+              .value_or(Duration::Zero()))),
       work_serializer_(std::make_shared<WorkSerializer>(event_engine_)),
       state_tracker_("client_channel", GRPC_CHANNEL_IDLE),
       subchannel_pool_(GetSubchannelPool(channel_args_)) {
@@ -658,6 +682,7 @@ void ClientChannel::Orphaned() {
   work_serializer_->Run(
       [self]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*self->work_serializer_) {
         self->DestroyResolverAndLbPolicyLocked();
+        self->warm_idle_result_.reset();
       });
   // IncreaseCallCount() introduces a phony call and prevents the idle
   // timer from being reset by other threads.
@@ -904,7 +929,7 @@ void ClientChannel::StartCall(UnstartedCallHandler unstarted_handler) {
                     MaybeGetContext<CallTracerAnnotationInterface>();
                 if (call_tracer != nullptr) {
                   call_tracer->RecordAnnotation(
-                      "Delayed name resolution complete.");
+                      kDelayedNameResolutionCompleteAnnotation);
                 }
               }
               // Start the call on the destination provided by the
@@ -929,6 +954,17 @@ void ClientChannel::CreateResolverLocked() {
   CHECK(resolver_ != nullptr);
   UpdateStateLocked(GRPC_CHANNEL_CONNECTING, absl::Status(),
                     "started resolving");
+  // Coming out of warm idle, start connecting to the previous addresses
+  // right away.  This happens before starting the resolver, so that any
+  // result it returns synchronously takes precedence.
+  if (warm_idle_result_.has_value()) {
+    GRPC_TRACE_LOG(client_channel, INFO)
+        << "client_channel=" << this
+        << ": reusing resolver result from before IDLE";
+    Resolver::Result result = std::move(*warm_idle_result_);
+    warm_idle_result_.reset();
+    OnResolverResultChangedLocked(std::move(result));
+  }
   resolver_->StartLocked();
   GRPC_TRACE_LOG(client_channel, INFO)
       << "client_channel=" << this << ": created resolver=" << resolver_.get();
@@ -949,6 +985,7 @@ void ClientChannel::DestroyResolverAndLbPolicyLocked() {
           << "client_channel=" << this
           << ": shutting down lb_policy=" << lb_policy_.get();
       lb_policy_.reset();
+      CancelPickerCoalescingTimerLocked();
       picker_.Set(MakeRefCounted<LoadBalancingPolicy::DropPicker>(
           absl::UnavailableError("Channel shutdown")));
     }
@@ -1100,6 +1137,22 @@ void ClientChannel::OnResolverResultChangedLocked(Resolver::Result result) {
   // unnecessary refs that cause it to be destroyed somewhere other than in
   // the WorkSerializer.
   result.args = result.args.Remove(GRPC_ARG_CONFIG_SELECTOR);
+  // In warm idle mode, keep what the channel needs to get going again
+  // after IDLE without waiting for the resolver.  A ConfigSelector may
+  // depend on the resolver that made it, so such results are not kept.
+  if (warm_idle_) {
+    warm_idle_result_.reset();
+    if (service_config != nullptr && config_selector == nullptr &&
+        resolution_contains_addresses) {
+      warm_idle_result_.emplace();
+      warm_idle_result_->addresses = result.addresses;
+      if (service_config != default_service_config_) {
+        warm_idle_result_->service_config = service_config;
+      }
+      warm_idle_result_->resolution_note = result.resolution_note;
+      warm_idle_result_->args = result.args;
+    }
+  }
   // Note: The only case in which service_config is null here is if the
   // resolver returned a service config error and we don't have a previous
   // service config to fall back to.
@@ -1324,10 +1377,63 @@ void ClientChannel::UpdateStateAndPickerLocked(
     grpc_connectivity_state state, const absl::Status& status,
     const char* reason,
     RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) {
+  const bool state_changed = state != state_tracker_.state();
   UpdateStateLocked(state, status, reason);
+  // If enabled, coalesce picker updates that do not change the channel's
+  // state, so that a burst of them (e.g., from health status changes for
+  // many endpoints) does not make every queued pick get re-processed
+  // once per update.  The first update in a burst is used right away.
+  if (picker_update_coalescing_window_ > Duration::Zero() && !state_changed &&
+      picker != nullptr) {
+    if (picker_coalescing_timer_handle_.has_value()) {
+      GRPC_TRACE_LOG(client_channel, INFO)
+          << "client_channel=" << this
+          << ": holding picker update until coalescing timer fires";
+      pending_picker_ = std::move(picker);
+      return;
+    }
+    StartPickerCoalescingTimerLocked();
+  } else {
+    CancelPickerCoalescingTimerLocked();
+  }
   picker_.Set(std::move(picker));
 }
 
+void ClientChannel::StartPickerCoalescingTimerLocked() {
+  picker_coalescing_timer_handle_ = event_engine_->RunAfter(
+      picker_update_coalescing_window_,
+      [self = WeakRefAsSubclass<ClientChannel>()]() mutable {
+        ExecCtx exec_ctx;
+        auto* self_ptr = self.get();
+        self_ptr->work_serializer_->Run(
+            [self = std::move(self)]()
+                ABSL_EXCLUSIVE_LOCKS_REQUIRED(*self->work_serializer_) {
+                  self->OnPickerCoalescingTimerLocked();
+                });
+      });
+}
+
+void ClientChannel::OnPickerCoalescingTimerLocked() {
+  // The timer may have been cancelled after it had already fired.
+  if (!picker_coalescing_timer_handle_.has_value()) return;
+  picker_coalescing_timer_handle_.reset();
+  if (pending_picker_ == nullptr) return;
+  GRPC_TRACE_LOG(client_channel, INFO)
+      << "client_channel=" << this << ": using coalesced picker update";
+  picker_.Set(std::move(pending_picker_));
+  pending_picker_.reset();
+  // Keep coalescing for another window, in case the burst continues.
+  StartPickerCoalescingTimerLocked();
+}
+
+void ClientChannel::CancelPickerCoalescingTimerLocked() {
+  if (picker_coalescing_timer_handle_.has_value()) {
+    event_engine_->Cancel(*picker_coalescing_timer_handle_);
+    picker_coalescing_timer_handle_.reset();
+  }
+  pending_picker_.reset();
+}
+
 void ClientChannel::StartIdleTimer() {
   GRPC_TRACE_LOG(client_channel, INFO)
       << "client_channel=" << this << ": idle timer started";
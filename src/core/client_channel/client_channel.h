@@ -17,8 +17,13 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_CLIENT_CHANNEL_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_CLIENT_CHANNEL_H
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
+#include <optional>
+
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
@@ -33,6 +38,7 @@
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/resolver/resolver.h"
 #include "src/core/service_config/service_config.h"
+#include "src/core/util/fork.h"
 #include "src/core/util/single_set_ptr.h"
 
 namespace grpc_core {
@@ -164,6 +170,13 @@ class ClientChannel : public Channel {
 
   void StartIdleTimer();
 
+  void StartPickerCoalescingTimerLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+  void OnPickerCoalescingTimerLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+  void CancelPickerCoalescingTimerLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+
   // Applies service config settings from config_selector to the call.
   // May modify call context and client_initial_metadata.
   absl::Status ApplyServiceConfigToCall(
@@ -175,6 +188,7 @@ class ClientChannel : public Channel {
       event_engine_;
   const std::string uri_to_resolve_;
   const size_t service_config_parser_index_;
+  const bool warm_idle_;
   const RefCountedPtr<ServiceConfig> default_service_config_;
   ClientChannelFactory* const client_channel_factory_;
   const std::string default_authority_;
@@ -202,6 +216,8 @@ class ClientChannel : public Channel {
   //
   PickerObservable picker_;
   const RefCountedPtr<UnstartedCallDestination> call_destination_;
+  // Zero if picker updates are not coalesced.
+  const Duration picker_update_coalescing_window_;
 
   //
   // Fields used in the control plane.  Guarded by work_serializer.
@@ -211,10 +227,17 @@ class ClientChannel : public Channel {
   OrphanablePtr<Resolver> resolver_ ABSL_GUARDED_BY(*work_serializer_);
   bool previous_resolution_contained_addresses_
       ABSL_GUARDED_BY(*work_serializer_) = false;
+  // Fork::ForkGeneration() when re-resolution was last requested, to tell
+  // the first request in a forked child (see RequestReresolution()).
+  uint64_t reresolution_fork_generation_ ABSL_GUARDED_BY(*work_serializer_) =
+      Fork::ForkGeneration();
   RefCountedPtr<ServiceConfig> saved_service_config_
       ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<ConfigSelector> saved_config_selector_
       ABSL_GUARDED_BY(*work_serializer_);
+  // In warm idle mode, the last resolver result, replayed when leaving IDLE.
+  std::optional<Resolver::Result> warm_idle_result_
+      ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<const Blackboard> blackboard_
       ABSL_GUARDED_BY(*work_serializer_);
   OrphanablePtr<LoadBalancingPolicy> lb_policy_
@@ -229,6 +252,12 @@ class ClientChannel : public Channel {
   // work_serializer when the SubchannelWrappers are created and destroyed.
   absl::flat_hash_set<SubchannelWrapper*> subchannel_wrappers_
       ABSL_GUARDED_BY(*work_serializer_);
+  // Set while picker updates are being coalesced.
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      picker_coalescing_timer_handle_ ABSL_GUARDED_BY(*work_serializer_);
+  // The most recent picker held back while the timer is pending, if any.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> pending_picker_
+      ABSL_GUARDED_BY(*work_serializer_);
   int keepalive_time_ ABSL_GUARDED_BY(*work_serializer_) = -1;
   absl::Status disconnect_error_ ABSL_GUARDED_BY(*work_serializer_);
 
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <new>
 #include <optional>
 #include <set>
@@ -94,6 +95,7 @@
 #include "src/core/resolver/resolver_registry.h"
 #include "src/core/service_config/service_config_call_data.h"
 #include "src/core/service_config/service_config_impl.h"
+#include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/json/json.h"
@@ -112,6 +114,9 @@ namespace grpc_core {
 
 using internal::ClientChannelMethodParsedConfig;
 
+// Queued picks are retried in batches of this many when there are more.
+constexpr size_t kQueuedPickBatchSize = 64;
+
 //
 // ClientChannelFilter::CallData definition
 //
@@ -507,7 +512,8 @@ class ClientChannelFilter::SubchannelWrapper final
       if (subchannel_node != nullptr) {
         auto it = chand_->subchannel_refcount_map_.find(subchannel_.get());
         if (it == chand_->subchannel_refcount_map_.end()) {
-          chand_->channelz_node_->AddChildSubchannel(subchannel_node->uuid());
+          chand_->channelz_node_->AddChildSubchannel(
+              subchannel_node->RefAsSubclass<channelz::SubchannelNode>());
           it = chand_->subchannel_refcount_map_.emplace(subchannel_.get(), 0)
                    .first;
         }
@@ -539,8 +545,7 @@ class ClientChannelFilter::SubchannelWrapper final
           CHECK(it != chand_->subchannel_refcount_map_.end());
           --it->second;
           if (it->second == 0) {
-            chand_->channelz_node_->RemoveChildSubchannel(
-                subchannel_node->uuid());
+            chand_->channelz_node_->RemoveChildSubchannel(subchannel_node);
             chand_->subchannel_refcount_map_.erase(it);
           }
         }
@@ -574,6 +579,10 @@ class ClientChannelFilter::SubchannelWrapper final
     return subchannel_->connected_subchannel();
   }
 
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannel() const {
+    return subchannel_->PickConnectedSubchannel();
+  }
+
   void RequestConnection() override { subchannel_->RequestConnection(); }
 
   void ResetBackoff() override { subchannel_->ResetBackoff(); }
@@ -632,7 +641,7 @@ class ClientChannelFilter::SubchannelWrapper final
           << " subchannel " << parent_->subchannel_.get()
           << "hopping into work_serializer";
       self.release();  // Held by callback.
-      parent_->chand_->work_serializer_->Run(
+      parent_->chand_->work_serializer_->RunUrgent(
           [this, state, status]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
               *parent_->chand_->work_serializer_) {
             ApplyUpdateInControlPlaneWorkSerializer(state, status);
@@ -960,6 +969,18 @@ class ClientChannelFilter::ClientChannelControlHelper final
   void RequestReresolution() override
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*chand_->work_serializer_) {
     if (chand_->resolver_ == nullptr) return;  // Shutting down.
+    // A forked child inherits the parent's channels but none of its
+    // connections, so the LB policy asks for re-resolution as they all fail.
+    // The addresses have not changed: keep the resolver result, and the
+    // service config and LB config that came with it, and just reconnect.
+    const uint64_t fork_generation = Fork::ForkGeneration();
+    if (std::exchange(chand_->reresolution_fork_generation_, fork_generation) !=
+            fork_generation &&
+        IsForkKeepsResolverResultEnabled()) {
+      GRPC_TRACE_LOG(client_channel, INFO)
+          << "chand=" << chand_ << ": not re-resolving after fork";
+      return;
+    }
     GRPC_TRACE_LOG(client_channel, INFO)
         << "chand=" << chand_ << ": started name re-resolving";
     chand_->resolver_->RequestReresolutionLocked();
@@ -1049,6 +1070,9 @@ ClientChannelFilter::ClientChannelFilter(grpc_channel_element_args* args,
       interested_parties_(grpc_pollset_set_create()),
       service_config_parser_index_(
           internal::ClientChannelServiceConfigParser::ParserIndex()),
+      warm_idle_(
+          channel_args_.GetBool(GRPC_ARG_EXPERIMENTAL_CLIENT_CHANNEL_WARM_IDLE)
+              .value_or(false)),
       work_serializer_(
           std::make_shared<WorkSerializer>(*args->channel_stack->event_engine)),
       state_tracker_("client_channel", GRPC_CHANNEL_IDLE),
@@ -1287,6 +1311,22 @@ void ClientChannelFilter::OnResolverResultChangedLocked(
   // unnecessary refs that cause it to be destroyed somewhere other than in the
   // WorkSerializer.
   result.args = result.args.Remove(GRPC_ARG_CONFIG_SELECTOR);
+  // In warm idle mode, keep what the channel needs to get going again
+  // after IDLE without waiting for the resolver.  A ConfigSelector may
+  // depend on the resolver that made it, so such results are not kept.
+  if (warm_idle_) {
+    warm_idle_result_.reset();
+    if (service_config != nullptr && config_selector == nullptr &&
+        resolution_contains_addresses) {
+      warm_idle_result_.emplace();
+      warm_idle_result_->addresses = result.addresses;
+      if (service_config != default_service_config_) {
+        warm_idle_result_->service_config = service_config;
+      }
+      warm_idle_result_->resolution_note = result.resolution_note;
+      warm_idle_result_->args = result.args;
+    }
+  }
   // Note: The only case in which service_config is null here is if the resolver
   // returned a service config error and we don't have a previous service
   // config to fall back to.
@@ -1472,11 +1512,31 @@ void ClientChannelFilter::UpdateServiceConfigInDataPlaneLocked(
   } else {
     filters.push_back(&DynamicTerminationFilter::kFilterVtable);
   }
-  auto new_blackboard = MakeRefCounted<Blackboard>();
-  RefCountedPtr<DynamicFilters> dynamic_filters = DynamicFilters::Create(
-      new_args, std::move(filters), blackboard_.get(), new_blackboard.get());
-  CHECK(dynamic_filters != nullptr);
-  blackboard_ = std::move(new_blackboard);
+  // Reuse the current stack if the new one would have the same filters
+  // with the same args and service config, as for a ConfigSelector update
+  // that changes only the routes.  Calls get their per-route config from
+  // the ConfigSelector, not from the stack.
+  RefCountedPtr<DynamicFilters> dynamic_filters;
+  if (dynamic_filters_cache_.has_value() &&
+      dynamic_filters_cache_->filters == filters &&
+      dynamic_filters_cache_->args == args &&
+      dynamic_filters_cache_->service_config_json ==
+          service_config->json_string()) {
+    GRPC_TRACE_LOG(client_channel, INFO)
+        << "chand=" << this << ": reusing dynamic filter stack "
+        << dynamic_filters_cache_->dynamic_filters.get();
+    dynamic_filters = dynamic_filters_cache_->dynamic_filters;
+  } else {
+    auto new_blackboard = MakeRefCounted<Blackboard>();
+    dynamic_filters = DynamicFilters::Create(new_args, filters,
+                                             blackboard_.get(),
+                                             new_blackboard.get());
+    CHECK(dynamic_filters != nullptr);
+    blackboard_ = std::move(new_blackboard);
+    dynamic_filters_cache_ = DynamicFiltersCacheEntry{
+        std::move(filters), args, std::string(service_config->json_string()),
+        dynamic_filters};
+  }
   // Grab data plane lock to update service config.
   //
   // We defer unreffing the old values (and deallocating memory) until
@@ -1509,6 +1569,16 @@ void ClientChannelFilter::CreateResolverLocked() {
   CHECK(resolver_ != nullptr);
   UpdateStateLocked(GRPC_CHANNEL_CONNECTING, absl::Status(),
                     "started resolving");
+  // Coming out of warm idle, start connecting to the previous addresses
+  // right away.  This happens before starting the resolver, so that any
+  // result it returns synchronously takes precedence.
+  if (warm_idle_result_.has_value()) {
+    GRPC_TRACE_LOG(client_channel, INFO)
+        << "chand=" << this << ": reusing resolver result from before IDLE";
+    Resolver::Result result = std::move(*warm_idle_result_);
+    warm_idle_result_.reset();
+    OnResolverResultChangedLocked(std::move(result));
+  }
   resolver_->StartLocked();
   GRPC_TRACE_LOG(client_channel, INFO)
       << "chand=" << this << ": created resolver=" << resolver_.get();
@@ -1522,6 +1592,7 @@ void ClientChannelFilter::DestroyResolverAndLbPolicyLocked() {
     // Clear resolution state.
     saved_service_config_.reset();
     saved_config_selector_.reset();
+    dynamic_filters_cache_.reset();
     // Acquire resolution lock to update config selector and associated state.
     // To minimize lock contention, we wait to unref these objects until
     // after we release the lock.
@@ -1570,17 +1641,66 @@ void ClientChannelFilter::UpdateStateAndPickerLocked(
     const char* reason,
     RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) {
   UpdateStateLocked(state, status, reason);
-  // Grab the LB lock to update the picker and trigger reprocessing of the
-  // queued picks.
-  // Old picker will be unreffed after releasing the lock.
-  MutexLock lock(&lb_mu_);
-  picker_.swap(picker);
+  // Grab the LB lock to update the picker and take the queued picks off
+  // the queue.
+  // Old pickers will be unreffed after releasing the lock.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> displaced_picker;
+  std::vector<RefCountedPtr<LoadBalancedCall>> queued_calls;
+  {
+    MutexLock lock(&lb_mu_);
+    displaced_picker = PublishPickerLocked(picker);
+    picker_.swap(picker);
+    queued_calls.reserve(lb_queued_calls_.size());
+    for (auto& call : lb_queued_calls_) {
+      call->RemoveCallFromLbQueuedCallsLocked();
+      call->RetryPickLocked();
+      queued_calls.push_back(call);
+    }
+    lb_queued_calls_.clear();
+  }
   // Reprocess queued picks.
-  for (auto& call : lb_queued_calls_) {
-    call->RemoveCallFromLbQueuedCallsLocked();
-    call->RetryPickLocked();
+  RetryQueuedPicks(std::move(queued_calls));
+}
+
+RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+ClientChannelFilter::GetPicker() {
+  return published_picker_.Get();
+}
+
+RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+ClientChannelFilter::PublishPickerLocked(
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) {
+  return published_picker_.Exchange(std::move(picker));
+}
+
+void ClientChannelFilter::RetryQueuedPicks(
+    std::vector<RefCountedPtr<LoadBalancedCall>> calls) {
+  // Do an async callback to resume call processing, so that we're not
+  // doing it while holding the channel's LB mutex.  When a picker update
+  // releases many calls at once, each closure resumes a batch of them, so
+  // that other closures on the ExecCtx get to run in between.
+  // TODO(roth): We should really be using EventEngine::Run() here
+  // instead of ExecCtx::Run().  Unfortunately, doing that seems to cause
+  // a flaky TSAN failure for reasons that I do not fully understand.
+  // However, given that we are working toward eliminating this code as
+  // part of the promise conversion, it doesn't seem worth further
+  // investigation right now.
+  if (calls.size() > kQueuedPickBatchSize) {
+    GRPC_TRACE_LOG(client_channel, INFO)
+        << "chand=" << this << ": retrying " << calls.size()
+        << " queued picks in batches of " << kQueuedPickBatchSize;
+  }
+  for (size_t start = 0; start < calls.size(); start += kQueuedPickBatchSize) {
+    const size_t end = std::min(start + kQueuedPickBatchSize, calls.size());
+    std::vector<RefCountedPtr<LoadBalancedCall>> batch(
+        std::make_move_iterator(calls.begin() + start),
+        std::make_move_iterator(calls.begin() + end));
+    ExecCtx::Run(DEBUG_LOCATION,
+                 NewClosure([batch = std::move(batch)](grpc_error_handle) {
+                   for (auto& call : batch) call->RetryPick();
+                 }),
+                 absl::OkStatus());
   }
-  lb_queued_calls_.clear();
 }
 
 namespace {
@@ -1705,6 +1825,7 @@ void ClientChannelFilter::StartTransportOpLocked(grpc_transport_op* op) {
     } else {
       // Disconnect.
       CHECK(disconnect_error_.ok());
+      warm_idle_result_.reset();
       disconnect_error_ = op->disconnect_with_error;
       UpdateStateAndPickerLocked(
           GRPC_CHANNEL_SHUTDOWN, absl::Status(), "shutdown from API",
@@ -1886,7 +2007,7 @@ std::optional<absl::Status> ClientChannelFilter::CallData::CheckResolution(
   if (was_queued) {
     auto* call_tracer = arena()->GetContext<CallTracerAnnotationInterface>();
     if (call_tracer != nullptr) {
-      call_tracer->RecordAnnotation("Delayed name resolution complete.");
+      call_tracer->RecordAnnotation(kDelayedNameResolutionCompleteAnnotation);
     }
   }
   return absl::OkStatus();
@@ -2476,10 +2597,7 @@ ClientChannelFilter::LoadBalancedCall::PickSubchannel(bool was_queued) {
   GRPC_TRACE_LOG(client_channel_lb_call, INFO)
       << "chand=" << chand_ << " lb_call=" << this
       << ": grabbing LB mutex to get picker";
-  {
-    MutexLock lock(&chand_->lb_mu_);
-    picker = chand_->picker_;
-  }
+  picker = chand_->GetPicker();
   while (true) {
     // TODO(roth): Fix race condition in channel_idle filter and any
     // other possible causes of this.
@@ -2515,7 +2633,7 @@ ClientChannelFilter::LoadBalancedCall::PickSubchannel(bool was_queued) {
     // Pick is complete.
     // If it was queued, add a trace annotation.
     if (was_queued && call_attempt_tracer() != nullptr) {
-      call_attempt_tracer()->RecordAnnotation("Delayed LB pick complete.");
+      call_attempt_tracer()->RecordAnnotation(kDelayedLbPickCompleteAnnotation);
     }
     // If the pick failed, fail the call.
     if (!error.ok()) {
@@ -2556,7 +2674,7 @@ bool ClientChannelFilter::LoadBalancedCall::PickSubchannelImpl(
         // holding the data plane mutex.
         SubchannelWrapper* subchannel =
             static_cast<SubchannelWrapper*>(complete_pick->subchannel.get());
-        connected_subchannel_ = subchannel->connected_subchannel();
+        connected_subchannel_ = subchannel->PickConnectedSubchannel();
         // If the subchannel has no connected subchannel (e.g., if the
         // subchannel has moved out of state READY but the LB policy hasn't
         // yet seen that change and given us a new picker), then just
@@ -3015,30 +3133,20 @@ void ClientChannelFilter::FilterBasedLoadBalancedCall::OnAddToQueueLocked() {
 void ClientChannelFilter::FilterBasedLoadBalancedCall::RetryPickLocked() {
   // Lame the call combiner canceller.
   lb_call_canceller_ = nullptr;
-  // Do an async callback to resume call processing, so that we're not
-  // doing it while holding the channel's LB mutex.
-  // TODO(roth): We should really be using EventEngine::Run() here
-  // instead of ExecCtx::Run().  Unfortunately, doing that seems to cause
-  // a flaky TSAN failure for reasons that I do not fully understand.
-  // However, given that we are working toward eliminating this code as
-  // part of the promise conversion, it doesn't seem worth further
-  // investigation right now.
-  ExecCtx::Run(DEBUG_LOCATION, NewClosure([this](grpc_error_handle) {
-                 // If there are a lot of queued calls here, resuming them
-                 // all may cause us to stay inside C-core for a long period
-                 // of time. All of that work would be done using the same
-                 // ExecCtx instance and therefore the same cached value of
-                 // "now". The longer it takes to finish all of this work
-                 // and exit from C-core, the more stale the cached value of
-                 // "now" may become. This can cause problems whereby (e.g.)
-                 // we calculate a timer deadline based on the stale value,
-                 // which results in the timer firing too early. To avoid
-                 // this, we invalidate the cached value for each call we
-                 // process.
-                 ExecCtx::Get()->InvalidateNow();
-                 TryPick(/*was_queued=*/true);
-               }),
-               absl::OkStatus());
+}
+
+void ClientChannelFilter::FilterBasedLoadBalancedCall::RetryPick() {
+  // If there are a lot of queued calls here, resuming them all may cause
+  // us to stay inside C-core for a long period of time. All of that work
+  // would be done using the same ExecCtx instance and therefore the same
+  // cached value of "now". The longer it takes to finish all of this work
+  // and exit from C-core, the more stale the cached value of "now" may
+  // become. This can cause problems whereby (e.g.) we calculate a timer
+  // deadline based on the stale value, which results in the timer firing
+  // too early. To avoid this, we invalidate the cached value for each call
+  // we process.
+  ExecCtx::Get()->InvalidateNow();
+  TryPick(/*was_queued=*/true);
 }
 
 void ClientChannelFilter::FilterBasedLoadBalancedCall::CreateSubchannelCall() {
@@ -21,6 +21,7 @@
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
 #include <map>
@@ -28,6 +29,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -60,7 +62,9 @@
 #include "src/core/resolver/resolver.h"
 #include "src/core/service_config/service_config.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/fork.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/rcu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
@@ -258,6 +262,17 @@ class ClientChannelFilter final {
 
   void TryToConnectLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
 
+  // Returns a ref to the current picker, without taking lb_mu_.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetPicker();
+  // Makes picker the one returned by GetPicker().  Returns the previous
+  // picker, which must be unreffed after releasing lb_mu_.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> PublishPickerLocked(
+      RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(lb_mu_);
+
+  // Retries the picks of calls taken off lb_queued_calls_.
+  void RetryQueuedPicks(std::vector<RefCountedPtr<LoadBalancedCall>> calls);
+
   //
   // Fields set at construction and never modified.
   //
@@ -271,6 +286,7 @@ class ClientChannelFilter final {
   channelz::ChannelNode* channelz_node_;
   grpc_pollset_set* interested_parties_;
   const size_t service_config_parser_index_;
+  const bool warm_idle_;
 
   //
   // Fields related to name resolution.  Guarded by resolution_mu_.
@@ -299,6 +315,10 @@ class ClientChannelFilter final {
                       RefCountedPtrHash<LoadBalancedCall>,
                       RefCountedPtrEq<LoadBalancedCall>>
       lb_queued_calls_ ABSL_GUARDED_BY(lb_mu_);
+  // picker_ is also published RCU-style, so that picks only take lb_mu_
+  // when they have to queue.  Only written with lb_mu_ held.
+  Rcu<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>
+      published_picker_;
 
   //
   // Fields used in the control plane.  Guarded by work_serializer.
@@ -308,12 +328,29 @@ class ClientChannelFilter final {
   OrphanablePtr<Resolver> resolver_ ABSL_GUARDED_BY(*work_serializer_);
   bool previous_resolution_contained_addresses_
       ABSL_GUARDED_BY(*work_serializer_) = false;
+  // Fork::ForkGeneration() when re-resolution was last requested, to tell
+  // the first request in a forked child (see RequestReresolution()).
+  uint64_t reresolution_fork_generation_ ABSL_GUARDED_BY(*work_serializer_) =
+      Fork::ForkGeneration();
   RefCountedPtr<ServiceConfig> saved_service_config_
       ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<ConfigSelector> saved_config_selector_
       ABSL_GUARDED_BY(*work_serializer_);
+  // In warm idle mode, the last resolver result, replayed when leaving IDLE.
+  std::optional<Resolver::Result> warm_idle_result_
+      ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<const Blackboard> blackboard_
       ABSL_GUARDED_BY(*work_serializer_);
+  // What dynamic_filters_ was last built from, so that it can be reused
+  // for later updates that would build the same stack.
+  struct DynamicFiltersCacheEntry {
+    std::vector<const grpc_channel_filter*> filters;
+    ChannelArgs args;
+    std::string service_config_json;
+    RefCountedPtr<DynamicFilters> dynamic_filters;
+  };
+  std::optional<DynamicFiltersCacheEntry> dynamic_filters_cache_
+      ABSL_GUARDED_BY(*work_serializer_);
   OrphanablePtr<LoadBalancingPolicy> lb_policy_
       ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_
@@ -367,10 +404,14 @@ class ClientChannelFilter::LoadBalancedCall
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
 
   // Called by the channel for each queued call when a new picker
-  // becomes available.
+  // becomes available, before it calls RetryPick().
   virtual void RetryPickLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_) = 0;
 
+  // Called by the channel, without holding lb_mu_, to redo the pick of a
+  // call taken off the queue.  Must be called under an ExecCtx.
+  virtual void RetryPick() = 0;
+
  protected:
   ClientChannelFilter* chand() const { return chand_; }
   ClientCallTracer::CallAttemptTracer* call_attempt_tracer() const {
@@ -528,6 +569,7 @@ class ClientChannelFilter::FilterBasedLoadBalancedCall final
 
   void RetryPickLocked() override
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
+  void RetryPick() override;
 
   void CreateSubchannelCall();
 
@@ -20,7 +20,9 @@
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_GLOBAL_SUBCHANNEL_POOL_H
 
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 
+#include <array>
 #include <map>
 
 #include "absl/base/thread_annotations.h"
@@ -39,22 +41,31 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
 
   // Implements interface methods.
   RefCountedPtr<Subchannel> RegisterSubchannel(
-      const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) override
-      ABSL_LOCKS_EXCLUDED(mu_);
+      const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) override;
   void UnregisterSubchannel(const SubchannelKey& key,
-                            Subchannel* subchannel) override
-      ABSL_LOCKS_EXCLUDED(mu_);
-  RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override
-      ABSL_LOCKS_EXCLUDED(mu_);
+                            Subchannel* subchannel) override;
+  RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override;
 
  private:
+  // Keys are spread over shards by hash, so that channels creating many
+  // subchannels at once do not all contend on one lock.
+  static constexpr size_t kNumShards = 32;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    // To protect subchannel_map.
+    Mutex mu;
+    // A map from subchannel key to subchannel.
+    std::map<SubchannelKey, Subchannel*> subchannel_map ABSL_GUARDED_BY(mu);
+  };
+
   GlobalSubchannelPool() {}
   ~GlobalSubchannelPool() override {}
 
-  // A map from subchannel key to subchannel.
-  std::map<SubchannelKey, Subchannel*> subchannel_map_ ABSL_GUARDED_BY(mu_);
-  // To protect subchannel_map_.
-  Mutex mu_;
+  Shard& ShardFor(const SubchannelKey& key) {
+    return shards_[key.hash() % kNumShards];
+  }
+
+  std::array<Shard, kNumShards> shards_;
 };
 
 }  // namespace grpc_core
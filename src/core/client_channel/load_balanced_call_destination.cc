@@ -242,7 +242,7 @@ void LoadBalancedCallDestination::StartCall(
                 auto* tracer =
                     MaybeGetContext<ClientCallTracer::CallAttemptTracer>();
                 if (tracer != nullptr) {
-                  tracer->RecordAnnotation("Delayed LB pick complete.");
+                  tracer->RecordAnnotation(kDelayedLbPickCompleteAnnotation);
                 }
               }
               // Delegate to connected subchannel.
@@ -32,6 +32,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/service_config/service_config.h"
 #include "src/core/service_config/service_config_call_data.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -97,8 +98,13 @@ RetryFilter::RetryFilter(const ChannelArgs& args, grpc_error_handle* error)
     : client_channel_(args.GetObject<ClientChannelFilter>()),
       event_engine_(args.GetObject<EventEngine>()),
       per_rpc_retry_buffer_size_(GetMaxPerRpcRetryBufferSize(args)),
+      memory_quota_(args.GetObject<ResourceQuota>() != nullptr
+                        ? args.GetObject<ResourceQuota>()->memory_quota()
+                        : ResourceQuota::Default()->memory_quota()),
       service_config_parser_index_(
-          internal::RetryServiceConfigParser::ParserIndex()) {
+          internal::RetryServiceConfigParser::ParserIndex()),
+      hedging_service_config_parser_index_(
+          internal::HedgingServiceConfigParser::ParserIndex()) {
   // Get retry throttling parameters from service config.
   auto* service_config = args.GetObject<ServiceConfig>();
   if (service_config == nullptr) return;
@@ -121,6 +127,14 @@ RetryFilter::RetryFilter(const ChannelArgs& args, grpc_error_handle* error)
   }
   std::string server_name(absl::StripPrefix(uri->path(), "/"));
   // Get throttling config for server_name.
+  if (config->budget_percent() != 0) {
+    retry_throttle_data_ =
+        internal::ServerRetryThrottleMap::Get()->GetBudgetForServer(
+            server_name,
+            {config->budget_percent(), config->min_retries_per_second(),
+             config->budget_window()});
+    return;
+  }
   retry_throttle_data_ =
       internal::ServerRetryThrottleMap::Get()->GetDataForServer(
           server_name, config->max_milli_tokens(), config->milli_token_ratio());
@@ -133,6 +147,13 @@ const RetryMethodConfig* RetryFilter::GetRetryPolicy(Arena* arena) {
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
 }
 
+bool RetryFilter::HasHedgingPolicy(Arena* arena) {
+  auto* svc_cfg_call_data = arena->GetContext<ServiceConfigCallData>();
+  if (svc_cfg_call_data == nullptr) return false;
+  return svc_cfg_call_data->GetMethodParsedConfig(
+             hedging_service_config_parser_index_) != nullptr;
+}
+
 const grpc_channel_filter RetryFilter::kVtable = {
     RetryFilter::LegacyCallData::StartTransportStreamOpBatch,
     RetryFilter::StartTransportOp,
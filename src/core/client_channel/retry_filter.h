@@ -35,6 +35,7 @@
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/useful.h"
@@ -59,6 +60,8 @@ class RetryFilter final {
   static double BackoffJitter() { return 0.2; }
 
   const internal::RetryMethodConfig* GetRetryPolicy(Arena* arena);
+  // Only the retry interceptor of the v3 call stack implements hedging.
+  bool HasHedgingPolicy(Arena* arena);
 
   RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data() const {
     return retry_throttle_data_;
@@ -66,8 +69,10 @@ class RetryFilter final {
 
   ClientChannelFilter* client_channel() const { return client_channel_; }
 
+  // The configured retry buffer size, as scaled down by memory pressure.
   size_t per_rpc_retry_buffer_size() const {
-    return per_rpc_retry_buffer_size_;
+    return internal::RetryBufferSizeUnderMemoryPressure(
+        per_rpc_retry_buffer_size_, memory_quota_->GetPressure());
   }
 
   static size_t GetMaxPerRpcRetryBufferSize(const ChannelArgs& args) {
@@ -105,8 +110,10 @@ class RetryFilter final {
   ClientChannelFilter* client_channel_;
   grpc_event_engine::experimental::EventEngine* const event_engine_;
   size_t per_rpc_retry_buffer_size_;
+  MemoryQuotaRefPtr memory_quota_;
   RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
   const size_t service_config_parser_index_;
+  const size_t hedging_service_config_parser_index_;
 };
 
 }  // namespace grpc_core
@@ -598,7 +598,10 @@ bool RetryFilter::LegacyCallData::CallAttempt::ShouldRetry(
           << server_pushback->millis() << " ms";
     }
   }
-  // We should retry.
+  // We should retry.  Only now is the retry charged to a retry budget.
+  if (calld_->retry_throttle_data_ != nullptr) {
+    calld_->retry_throttle_data_->RecordRetry();
+  }
   return true;
 }
 
@@ -1428,6 +1431,11 @@ grpc_error_handle RetryFilter::LegacyCallData::Init(
   new (elem->call_data) RetryFilter::LegacyCallData(chand, *args);
   GRPC_TRACE_LOG(retry, INFO)
       << "chand=" << chand << " calld=" << elem->call_data << ": created call";
+  // Rather than silently sending a hedged call as an unhedged one, fail it.
+  if (GPR_UNLIKELY(chand->HasHedgingPolicy(args->arena))) {
+    return absl::UnimplementedError(
+        "hedgingPolicy is only supported by the v3 call stack");
+  }
   return absl::OkStatus();
 }
 
@@ -14,10 +14,14 @@
 
 #include "src/core/client_channel/retry_interceptor.h"
 
+#include <algorithm>
+
 #include "src/core/lib/promise/cancel_callback.h"
 #include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/sleep.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/service_config/service_config_call_data.h"
 
 namespace grpc_core {
@@ -31,6 +35,14 @@ size_t GetMaxPerRpcRetryBufferSize(const ChannelArgs& args) {
                    .value_or(kDefaultPerRpcRetryBufferSize),
                0, INT_MAX);
 }
+
+MemoryQuotaRefPtr MemoryQuotaFromChannelArgs(const ChannelArgs& args) {
+  auto* resource_quota = args.GetObject<ResourceQuota>();
+  if (resource_quota == nullptr) {
+    return ResourceQuota::Default()->memory_quota();
+  }
+  return resource_quota->memory_quota();
+}
 }  // namespace
 
 namespace retry_detail {
@@ -116,7 +128,8 @@ std::optional<Duration> RetryState::ShouldRetry(
                                 << " not retrying due to server push-back";
     return std::nullopt;
   }
-  // We should retry.
+  // We should retry.  Only now is the retry charged to a retry budget.
+  if (retry_throttle_data_ != nullptr) retry_throttle_data_->RecordRetry();
   Duration next_attempt_timeout;
   if (server_pushback.has_value()) {
     CHECK_GE(*server_pushback, Duration::Zero());
@@ -131,6 +144,65 @@ std::optional<Duration> RetryState::ShouldRetry(
   return next_attempt_timeout;
 }
 
+HedgingState::HedgingState(
+    const internal::HedgingMethodConfig* hedging_policy,
+    RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data)
+    : hedging_policy_(hedging_policy),
+      retry_throttle_data_(std::move(retry_throttle_data)) {}
+
+HedgingState::NextHedge HedgingState::ShouldSendHedge(bool committed) {
+  if (committed || stopped_by_server_ ||
+      num_attempts_started_ >= hedging_policy_->max_attempts()) {
+    return NextHedge::kDone;
+  }
+  // Hedges beyond the first attempt are subject to retry throttling.  Unlike
+  // a retry, a hedge is not sent in response to a failure, so checking does
+  // not use up a token.
+  if (num_attempts_started_ > 0 && retry_throttle_data_ != nullptr &&
+      retry_throttle_data_->IsThrottled()) {
+    return NextHedge::kThrottled;
+  }
+  if (num_attempts_started_ > 0 && retry_throttle_data_ != nullptr) {
+    retry_throttle_data_->RecordRetry();
+  }
+  ++num_attempts_started_;
+  return NextHedge::kSend;
+}
+
+std::optional<Duration> HedgingState::AttemptFinished(
+    const ServerMetadata& md,
+    absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+  const auto status = md.get(GrpcStatusMetadata());
+  if (status == GRPC_STATUS_OK) {
+    if (retry_throttle_data_ != nullptr) retry_throttle_data_->RecordSuccess();
+    return std::nullopt;
+  }
+  if (status.has_value() &&
+      !hedging_policy_->non_fatal_status_codes().Contains(*status)) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string() << ": status "
+        << grpc_status_code_to_string(*status) << " is fatal for hedging";
+    return std::nullopt;
+  }
+  if (retry_throttle_data_ != nullptr) retry_throttle_data_->RecordFailure();
+  const auto server_pushback = md.get(GrpcRetryPushbackMsMetadata());
+  if (!server_pushback.has_value()) {
+    // A non-fatal failure sends the next hedge right away, rather than
+    // waiting out the rest of the hedging delay.
+    return Duration::Zero();
+  }
+  if (*server_pushback < Duration::Zero()) {
+    GRPC_TRACE_LOG(retry, INFO) << lazy_attempt_debug_string()
+                                << " no more hedges due to server push-back";
+    stopped_by_server_ = true;
+    return Duration::Infinity();
+  }
+  GRPC_TRACE_LOG(retry, INFO) << lazy_attempt_debug_string()
+                              << " server push-back: next hedge in "
+                              << *server_pushback;
+  return *server_pushback;
+}
+
 absl::StatusOr<RefCountedPtr<internal::ServerRetryThrottleData>>
 ServerRetryThrottleDataFromChannelArgs(const ChannelArgs& args) {
   // Get retry throttling parameters from service config.
@@ -153,6 +225,12 @@ ServerRetryThrottleDataFromChannelArgs(const ChannelArgs& args) {
   }
   std::string server_name(absl::StripPrefix(uri->path(), "/"));
   // Get throttling config for server_name.
+  if (config->budget_percent() != 0) {
+    return internal::ServerRetryThrottleMap::Get()->GetBudgetForServer(
+        server_name,
+        {config->budget_percent(), config->min_retries_per_second(),
+         config->budget_window()});
+  }
   return internal::ServerRetryThrottleMap::Get()->GetDataForServer(
       server_name, config->max_milli_tokens(), config->milli_token_ratio());
 }
@@ -177,8 +255,11 @@ RetryInterceptor::RetryInterceptor(
     const ChannelArgs& args,
     RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data)
     : per_rpc_retry_buffer_size_(GetMaxPerRpcRetryBufferSize(args)),
+      memory_quota_(MemoryQuotaFromChannelArgs(args)),
       service_config_parser_index_(
           internal::RetryServiceConfigParser::ParserIndex()),
+      hedging_service_config_parser_index_(
+          internal::HedgingServiceConfigParser::ParserIndex()),
       retry_throttle_data_(std::move(retry_throttle_data)) {}
 
 void RetryInterceptor::InterceptCall(
@@ -198,6 +279,14 @@ const internal::RetryMethodConfig* RetryInterceptor::GetRetryPolicy() {
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
 }
 
+const internal::HedgingMethodConfig* RetryInterceptor::GetHedgingPolicy() {
+  auto* svc_cfg_call_data = MaybeGetContext<ServiceConfigCallData>();
+  if (svc_cfg_call_data == nullptr) return nullptr;
+  return static_cast<const internal::HedgingMethodConfig*>(
+      svc_cfg_call_data->GetMethodParsedConfig(
+          hedging_service_config_parser_index_));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Call
 
@@ -206,9 +295,12 @@ RetryInterceptor::Call::Call(RefCountedPtr<RetryInterceptor> interceptor,
     : call_handler_(std::move(call_handler)),
       interceptor_(std::move(interceptor)),
       retry_state_(interceptor_->GetRetryPolicy(),
-                   interceptor_->retry_throttle_data_) {
+                   interceptor_->retry_throttle_data_),
+      hedging_state_(interceptor_->GetHedgingPolicy(),
+                     interceptor_->retry_throttle_data_) {
   GRPC_TRACE_LOG(retry, INFO)
-      << DebugTag() << " retry call created: " << retry_state_;
+      << DebugTag() << " retry call created: " << retry_state_
+      << " hedging:" << hedging_state_.enabled();
 }
 
 auto RetryInterceptor::Call::ClientToBuffer() {
@@ -254,18 +346,148 @@ void RetryInterceptor::Call::Start() {
 }
 
 void RetryInterceptor::Call::StartAttempt() {
+  if (hedging()) {
+    StartHedgedAttempts();
+    return;
+  }
   if (current_attempt_ != nullptr) {
     current_attempt_->Cancel();
   }
-  auto current_attempt = call_handler_.arena()->MakeRefCounted<Attempt>(Ref());
+  auto current_attempt = call_handler_.arena()->MakeRefCounted<Attempt>(
+      Ref(), retry_state_.num_attempts_completed());
   current_attempt_ = current_attempt.get();
   current_attempt->Start();
 }
 
+void RetryInterceptor::Call::StartHedgedAttempts() {
+  using NextHedge = retry_detail::HedgingState::NextHedge;
+  // With no delay, every attempt is sent at once.
+  if (hedging_state_.hedging_delay() == Duration::Zero()) {
+    while (MaybeStartHedgedAttempt() == NextHedge::kSend) {
+    }
+    return;
+  }
+  if (MaybeStartHedgedAttempt() != NextHedge::kDone) {
+    ScheduleNextHedge(hedging_state_.hedging_delay());
+  }
+}
+
+void RetryInterceptor::Call::ScheduleNextHedge(Duration delay) {
+  const uint64_t generation = ++hedge_timer_generation_;
+  if (delay == Duration::Infinity()) return;
+  call_handler_.SpawnGuardedUntilCallCompletes(
+      "hedging_delay", [self = Ref(), delay, generation]() {
+        return Map(Sleep(delay), [self, generation](absl::Status) {
+          if (self->hedge_timer_generation_ != generation) {
+            return absl::OkStatus();
+          }
+          const auto next = self->MaybeStartHedgedAttempt();
+          if (next != retry_detail::HedgingState::NextHedge::kSend &&
+              self->hedged_attempts_.empty()) {
+            // The server pushed back the hedge that was to follow the last
+            // failure, and it can no longer be sent.
+            if (self->pending_failure_ != nullptr) {
+              self->call_handler_.SpawnPushServerTrailingMetadata(
+                  std::move(self->pending_failure_));
+            }
+            return absl::OkStatus();
+          }
+          // A throttled hedge is skipped, but the timer keeps running so that
+          // later hedges can go out once throttling lifts.
+          if (next != retry_detail::HedgingState::NextHedge::kDone &&
+              self->hedging_state_.hedging_delay() != Duration::Zero()) {
+            self->ScheduleNextHedge(self->hedging_state_.hedging_delay());
+          }
+          return absl::OkStatus();
+        });
+      });
+}
+
+retry_detail::HedgingState::NextHedge
+RetryInterceptor::Call::MaybeStartHedgedAttempt() {
+  const auto next =
+      hedging_state_.ShouldSendHedge(request_buffer_.committed());
+  if (next == retry_detail::HedgingState::NextHedge::kThrottled) {
+    GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " hedging throttled";
+  }
+  if (next != retry_detail::HedgingState::NextHedge::kSend) return next;
+  auto attempt = call_handler_.arena()->MakeRefCounted<Attempt>(
+      Ref(), hedging_state_.num_attempts_started() - 1);
+  hedged_attempts_.push_back(attempt.get());
+  attempt->Start();
+  return next;
+}
+
+void RetryInterceptor::Call::RemoveAttempt(Attempt* attempt) {
+  if (current_attempt_ == attempt) current_attempt_ = nullptr;
+  auto it = std::find(hedged_attempts_.begin(), hedged_attempts_.end(),
+                      attempt);
+  if (it != hedged_attempts_.end()) hedged_attempts_.erase(it);
+}
+
+bool RetryInterceptor::Call::TryCommitAttempt(Attempt* attempt) {
+  CHECK(attempt != nullptr);
+  if (!hedging()) {
+    if (current_attempt_ != attempt) return false;
+    request_buffer_.Commit(attempt->reader());
+    return true;
+  }
+  if (request_buffer_.committed()) return false;
+  request_buffer_.Commit(attempt->reader());
+  // The first hedged attempt to commit wins; the others are no longer needed.
+  std::vector<Attempt*> losers;
+  losers.swap(hedged_attempts_);
+  for (Attempt* loser : losers) {
+    if (loser == attempt) {
+      hedged_attempts_.push_back(attempt);
+    } else {
+      loser->Cancel();
+    }
+  }
+  return true;
+}
+
+bool RetryInterceptor::Call::HedgedAttemptFinished(Attempt* attempt,
+                                                   ServerMetadataHandle& md) {
+  RemoveAttempt(attempt);
+  const auto next_hedge_delay = hedging_state_.AttemptFinished(
+      *md, [attempt]() { return attempt->DebugTag(); });
+  if (!next_hedge_delay.has_value()) return true;
+  if (*next_hedge_delay == Duration::Zero()) {
+    if (MaybeStartHedgedAttempt() !=
+            retry_detail::HedgingState::NextHedge::kDone &&
+        hedging_state_.hedging_delay() != Duration::Zero()) {
+      ScheduleNextHedge(hedging_state_.hedging_delay());
+    }
+  } else {
+    ScheduleNextHedge(*next_hedge_delay);
+  }
+  if (!hedged_attempts_.empty()) return false;
+  // Nothing is left in flight, so unless the server asked for the next hedge
+  // to be sent later, this failure is the call's result.
+  if (*next_hedge_delay == Duration::Zero() ||
+      *next_hedge_delay == Duration::Infinity()) {
+    return true;
+  }
+  pending_failure_ = std::move(md);
+  return false;
+}
+
 void RetryInterceptor::Call::MaybeCommit(size_t buffered) {
+  const size_t limit = internal::RetryBufferSizeUnderMemoryPressure(
+      interceptor_->per_rpc_retry_buffer_size_,
+      interceptor_->memory_quota_->GetPressure());
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " buffered:" << buffered << "/"
-                              << interceptor_->per_rpc_retry_buffer_size_;
-  if (buffered >= interceptor_->per_rpc_retry_buffer_size_) {
+                              << limit;
+  if (buffered >= limit) {
+    if (hedging()) {
+      // Too much has been sent to keep buffering for further hedges, so
+      // settle on the attempt that has been running the longest.
+      if (!hedged_attempts_.empty()) {
+        std::ignore = hedged_attempts_.front()->Commit();
+      }
+      return;
+    }
     std::ignore = current_attempt_->Commit();
   }
 }
@@ -277,8 +499,11 @@ std::string RetryInterceptor::Call::DebugTag() {
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Attempt
 
-RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call)
-    : call_(std::move(call)), reader_(call_->request_buffer()) {
+RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call,
+                                   int num_previous_attempts)
+    : call_(std::move(call)),
+      reader_(call_->request_buffer()),
+      num_previous_attempts_(num_previous_attempts) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " retry attempt created";
 }
 
@@ -324,9 +549,16 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
         GRPC_TRACE_LOG(retry, INFO)
             << self->DebugTag()
             << " got server trailing metadata: " << md->DebugString();
-        auto delay = self->call_->ShouldRetry(
-            *md,
-            [self = self.get()]() -> std::string { return self->DebugTag(); });
+        std::optional<Duration> delay;
+        bool forward = true;
+        if (self->call_->hedging()) {
+          forward = self->call_->HedgedAttemptFinished(self.get(), md);
+        } else {
+          delay = self->call_->ShouldRetry(
+              *md, [self = self.get()]() -> std::string {
+                return self->DebugTag();
+              });
+        }
         return If(
             delay.has_value(),
             [self, delay]() {
@@ -335,8 +567,8 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
                 return absl::OkStatus();
               });
             },
-            [self, md = std::move(md)]() mutable {
-              if (!self->Commit()) return absl::CancelledError();
+            [self, forward, md = std::move(md)]() mutable {
+              if (!forward || !self->Commit()) return absl::CancelledError();
               self->call_->call_handler()->SpawnPushServerTrailingMetadata(
                   std::move(md));
               return absl::OkStatus();
@@ -364,9 +596,8 @@ bool RetryInterceptor::Attempt::Commit(SourceLocation whence) {
   if (committed_) return true;
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " commit attempt from "
                               << whence.file() << ":" << whence.line();
-  if (!call_->IsCurrentAttempt(this)) return false;
+  if (!call_->TryCommitAttempt(this)) return false;
   committed_ = true;
-  call_->request_buffer()->Commit(reader());
   return true;
 }
 
@@ -374,15 +605,15 @@ auto RetryInterceptor::Attempt::ClientToServer() {
   return TrySeq(
       reader_.PullClientInitialMetadata(),
       [self = Ref()](ClientMetadataHandle metadata) {
-        int num_attempts_completed = self->call_->num_attempts_completed();
-        if (GPR_UNLIKELY(num_attempts_completed > 0)) {
+        if (GPR_UNLIKELY(self->num_previous_attempts_ > 0)) {
           metadata->Set(GrpcPreviousRpcAttemptsMetadata(),
-                        num_attempts_completed);
+                        self->num_previous_attempts_);
         } else {
           metadata->Remove(GrpcPreviousRpcAttemptsMetadata());
         }
         self->initiator_ = self->call_->interceptor()->MakeChildCall(
             std::move(metadata), self->call_->call_handler()->arena()->Ref());
+        self->started_child_call_ = true;
         self->call_->call_handler()->AddChildCall(self->initiator_);
         self->initiator_.SpawnGuarded(
             "server_to_client", [self]() { return self->ServerToClient(); });
@@ -396,10 +627,23 @@ auto RetryInterceptor::Attempt::ClientToServer() {
 
 void RetryInterceptor::Attempt::Start() {
   call_->call_handler()->SpawnGuardedUntilCallCompletes(
-      "buffer_to_server", [self = Ref()]() { return self->ClientToServer(); });
+      "buffer_to_server", [self = Ref()]() {
+        return Map(self->ClientToServer(), [self](StatusFlag status) {
+          // A hedged attempt that lost to another one sees its reads from the
+          // request buffer fail, but that must not fail the call.
+          if (!status.ok() && self->call_->hedging() && !self->committed_) {
+            return StatusFlag(Success{});
+          }
+          return status;
+        });
+      });
 }
 
-void RetryInterceptor::Attempt::Cancel() { initiator_.SpawnCancel(); }
+void RetryInterceptor::Attempt::Cancel() {
+  // A hedged attempt may be cancelled before its child call was started.
+  if (!started_child_call_) return;
+  initiator_.SpawnCancel();
+}
 
 std::string RetryInterceptor::Attempt::DebugTag() const {
   return absl::StrFormat("%s attempt:%p", call_->DebugTag(), this);
@@ -15,11 +15,16 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 
+#include <cstdint>
+#include <optional>
+#include <vector>
+
 #include "src/core/call/request_buffer.h"
 #include "src/core/client_channel/client_channel_args.h"
 #include "src/core/client_channel/retry_service_config.h"
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/filter/filter_args.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/transport/interception_chain.h"
 #include "src/core/util/backoff.h"
 
@@ -56,6 +61,47 @@ class RetryState {
   BackOff retry_backoff_;
 };
 
+// Decides when the attempts of a hedged call are sent (gRFC A6).
+class HedgingState {
+ public:
+  enum class NextHedge {
+    // Send the next hedge now.
+    kSend,
+    // Retry throttling is active: skip this hedge, but later ones may still
+    // be sent once it lifts.
+    kThrottled,
+    // No further hedges will be sent.
+    kDone,
+  };
+
+  HedgingState(
+      const internal::HedgingMethodConfig* hedging_policy,
+      RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data);
+
+  bool enabled() const { return hedging_policy_ != nullptr; }
+  Duration hedging_delay() const { return hedging_policy_->hedging_delay(); }
+  int num_attempts_started() const { return num_attempts_started_; }
+
+  // Counts the attempt as started if the result is kSend.  The first attempt
+  // is never throttled.
+  NextHedge ShouldSendHedge(bool committed);
+
+  // Called when an attempt gets a trailers-only response.
+  // if nullopt --> md is final and is returned to the application
+  // if duration --> the failure is non-fatal; send the next hedge after
+  //                 duration, or never if it is infinite
+  std::optional<Duration> AttemptFinished(
+      const ServerMetadata& md,
+      absl::FunctionRef<std::string()> lazy_attempt_debug_string);
+
+ private:
+  const internal::HedgingMethodConfig* const hedging_policy_;
+  RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
+  int num_attempts_started_ = 0;
+  // Set once the server pushes back with a negative delay.
+  bool stopped_by_server_ = false;
+};
+
 absl::StatusOr<RefCountedPtr<internal::ServerRetryThrottleData>>
 ServerRetryThrottleDataFromChannelArgs(const ChannelArgs& args);
 }  // namespace retry_detail
@@ -99,31 +145,50 @@ class RetryInterceptor : public Interceptor {
     int num_attempts_completed() const {
       return retry_state_.num_attempts_completed();
     }
-    void RemoveAttempt(Attempt* attempt) {
-      if (current_attempt_ == attempt) current_attempt_ = nullptr;
-    }
-    bool IsCurrentAttempt(Attempt* attempt) {
-      CHECK(attempt != nullptr);
-      return current_attempt_ == attempt;
-    }
+    bool hedging() const { return hedging_state_.enabled(); }
+    void RemoveAttempt(Attempt* attempt);
+    // Returns true if attempt may become the one attempt whose response is
+    // returned to the application, and commits the request buffer to it.
+    // When hedging, any other attempts still in flight are cancelled.
+    bool TryCommitAttempt(Attempt* attempt);
+    // Called when a hedged attempt receives a trailers-only response.
+    // Returns true if md should be returned to the application, or false if
+    // the failure is non-fatal and another attempt is still in flight or
+    // about to be sent.  In the latter case md may be taken, to be returned
+    // if that attempt never goes out.
+    bool HedgedAttemptFinished(Attempt* attempt, ServerMetadataHandle& md);
 
     std::string DebugTag();
 
    private:
     void MaybeCommit(size_t buffered);
     auto ClientToBuffer();
+    void StartHedgedAttempts();
+    retry_detail::HedgingState::NextHedge MaybeStartHedgedAttempt();
+    // Sends the next hedge after delay, superseding any hedge already
+    // scheduled.
+    void ScheduleNextHedge(Duration delay);
 
     RequestBuffer request_buffer_;
     CallHandler call_handler_;
     RefCountedPtr<RetryInterceptor> interceptor_;
     Attempt* current_attempt_ = nullptr;
     retry_detail::RetryState retry_state_;
+    retry_detail::HedgingState hedging_state_;
+    // Hedged attempts that have not yet finished, oldest first.
+    std::vector<Attempt*> hedged_attempts_;
+    // Bumped by ScheduleNextHedge(), so that timers it replaced do nothing
+    // when they fire.
+    uint64_t hedge_timer_generation_ = 0;
+    // The last non-fatal failure, held while the hedge the server pushed back
+    // is pending with no other attempt in flight.
+    ServerMetadataHandle pending_failure_;
   };
 
   class Attempt final
       : public RefCounted<Attempt, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
-    explicit Attempt(RefCountedPtr<Call> call);
+    Attempt(RefCountedPtr<Call> call, int num_previous_attempts);
     ~Attempt();
 
     void Start();
@@ -142,13 +207,18 @@ class RetryInterceptor : public Interceptor {
     RefCountedPtr<Call> call_;
     RequestBuffer::Reader reader_;
     CallInitiator initiator_;
+    const int num_previous_attempts_;
+    bool started_child_call_ = false;
     bool committed_ = false;
   };
 
   const internal::RetryMethodConfig* GetRetryPolicy();
+  const internal::HedgingMethodConfig* GetHedgingPolicy();
 
   const size_t per_rpc_retry_buffer_size_;
+  const MemoryQuotaRefPtr memory_quota_;
   const size_t service_config_parser_index_;
+  const size_t hedging_service_config_parser_index_;
   const RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
 };
 
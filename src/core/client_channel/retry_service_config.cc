@@ -54,6 +54,11 @@ const JsonLoaderInterface* RetryGlobalConfig::JsonLoader(const JsonArgs&) {
 
 void RetryGlobalConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
                                      ValidationErrors* errors) {
+  // A retry budget replaces the token bucket.
+  if (json.object().find("budgetPercent") != json.object().end()) {
+    LoadBudget(json, args, errors);
+    return;
+  }
   // Parse maxTokens.
   auto max_tokens =
       LoadJsonObjectField<uint32_t>(json.object(), args, "maxTokens", errors);
@@ -111,6 +116,45 @@ void RetryGlobalConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+void RetryGlobalConfig::LoadBudget(const Json& json, const JsonArgs& args,
+                                   ValidationErrors* errors) {
+  for (absl::string_view field_name : {"maxTokens", "tokenRatio"}) {
+    if (json.object().find(std::string(field_name)) != json.object().end()) {
+      ValidationErrors::ScopedField field(errors,
+                                          absl::StrCat(".", field_name));
+      errors->AddError("cannot be combined with budgetPercent");
+    }
+  }
+  // Parse budgetPercent.
+  auto percent = LoadJsonObjectField<uint32_t>(json.object(), args,
+                                               "budgetPercent", errors);
+  if (percent.has_value()) {
+    if (*percent == 0) {
+      ValidationErrors::ScopedField field(errors, ".budgetPercent");
+      errors->AddError("must be greater than 0");
+    } else {
+      budget_percent_ = *percent;
+    }
+  }
+  // Parse minRetriesPerSecond.
+  auto min_retries_per_second = LoadJsonObjectField<uint32_t>(
+      json.object(), args, "minRetriesPerSecond", errors, /*required=*/false);
+  if (min_retries_per_second.has_value()) {
+    min_retries_per_second_ = *min_retries_per_second;
+  }
+  // Parse budgetWindow.
+  auto window = LoadJsonObjectField<Duration>(
+      json.object(), args, "budgetWindow", errors, /*required=*/false);
+  if (window.has_value()) {
+    ValidationErrors::ScopedField field(errors, ".budgetWindow");
+    if (*window < Duration::Seconds(1) || *window > Duration::Minutes(1)) {
+      errors->AddError("must be between 1s and 60s");
+    } else {
+      budget_window_ = *window;
+    }
+  }
+}
+
 //
 // RetryMethodConfig
 //
@@ -213,6 +257,55 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+//
+// HedgingMethodConfig
+//
+
+const JsonLoaderInterface* HedgingMethodConfig::JsonLoader(const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<HedgingMethodConfig>()
+          // Note: The "nonFatalStatusCodes" field requires custom parsing,
+          // so it's handled in JsonPostLoad() instead.
+          .Field("maxAttempts", &HedgingMethodConfig::max_attempts_)
+          .OptionalField("hedgingDelay", &HedgingMethodConfig::hedging_delay_)
+          .Finish();
+  return loader;
+}
+
+void HedgingMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
+                                       ValidationErrors* errors) {
+  // Validate maxAttempts.
+  {
+    ValidationErrors::ScopedField field(errors, ".maxAttempts");
+    if (!errors->FieldHasErrors()) {
+      if (max_attempts_ <= 1) {
+        errors->AddError("must be at least 2");
+      } else if (max_attempts_ > MAX_MAX_RETRY_ATTEMPTS) {
+        LOG(ERROR) << "service config: clamped hedgingPolicy.maxAttempts at "
+                   << MAX_MAX_RETRY_ATTEMPTS;
+        max_attempts_ = MAX_MAX_RETRY_ATTEMPTS;
+      }
+    }
+  }
+  // Parse nonFatalStatusCodes.
+  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
+      json.object(), args, "nonFatalStatusCodes", errors,
+      /*required=*/false);
+  if (status_code_list.has_value()) {
+    for (size_t i = 0; i < status_code_list->size(); ++i) {
+      ValidationErrors::ScopedField field(
+          errors, absl::StrCat(".nonFatalStatusCodes[", i, "]"));
+      grpc_status_code status;
+      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
+                                        &status)) {
+        errors->AddError("failed to parse status code");
+      } else {
+        non_fatal_status_codes_.Add(status);
+      }
+    }
+  }
+}
+
 //
 // RetryServiceConfigParser
 //
@@ -276,5 +369,60 @@ RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
   return std::move(method_params.retry_policy);
 }
 
+//
+// HedgingServiceConfigParser
+//
+
+size_t HedgingServiceConfigParser::ParserIndex() {
+  return CoreConfiguration::Get().service_config_parser().GetParserIndex(
+      parser_name());
+}
+
+void HedgingServiceConfigParser::Register(CoreConfiguration::Builder* builder) {
+  builder->service_config_parser()->RegisterParser(
+      std::make_unique<HedgingServiceConfigParser>());
+}
+
+namespace {
+
+struct HedgingConfig {
+  std::unique_ptr<HedgingMethodConfig> hedging_policy;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<HedgingConfig>()
+            .OptionalField("hedgingPolicy", &HedgingConfig::hedging_policy)
+            .Finish();
+    return loader;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+HedgingServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
+                                                 const Json& json,
+                                                 ValidationErrors* errors) {
+  if (!args.GetBool(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING).value_or(false)) {
+    return nullptr;
+  }
+  auto method_params =
+      LoadFromJson<HedgingConfig>(json, JsonChannelArgs(args), errors);
+  if (method_params.hedging_policy != nullptr &&
+      json.object().find("retryPolicy") != json.object().end()) {
+    ValidationErrors::ScopedField field(errors, ".hedgingPolicy");
+    errors->AddError("may not be specified together with retryPolicy");
+    return nullptr;
+  }
+  return std::move(method_params.hedging_policy);
+}
+
+size_t RetryBufferSizeUnderMemoryPressure(size_t size,
+                                          double memory_pressure) {
+  if (memory_pressure <= 0.5) return size;
+  if (memory_pressure >= 1.0) return 0;
+  return static_cast<size_t>(size * (1.0 - memory_pressure) * 2);
+}
+
 }  // namespace internal
 }  // namespace grpc_core
@@ -42,14 +42,24 @@ class RetryGlobalConfig final : public ServiceConfigParser::ParsedConfig {
  public:
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
+  // Non-zero if retries are limited by a retry budget instead of tokens.
+  uint32_t budget_percent() const { return budget_percent_; }
+  uint32_t min_retries_per_second() const { return min_retries_per_second_; }
+  Duration budget_window() const { return budget_window_; }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs& args,
                     ValidationErrors* errors);
 
  private:
+  void LoadBudget(const Json& json, const JsonArgs& args,
+                  ValidationErrors* errors);
+
   uintptr_t max_milli_tokens_ = 0;
   uintptr_t milli_token_ratio_ = 0;
+  uint32_t budget_percent_ = 0;
+  uint32_t min_retries_per_second_ = 10;
+  Duration budget_window_ = Duration::Seconds(10);
 };
 
 class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
@@ -91,6 +101,34 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   std::optional<Duration> per_attempt_recv_timeout_;
 };
 
+// A per-method hedgingPolicy, as described in gRFC A6.  Only parsed when
+// GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING is set.
+class HedgingMethodConfig final : public ServiceConfigParser::ParsedConfig {
+ public:
+  int max_attempts() const { return max_attempts_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors);
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, const HedgingMethodConfig& config) {
+    sink.Append(absl::StrCat(
+        "max_attempts:", config.max_attempts_,
+        " hedging_delay:", config.hedging_delay_, " non_fatal_status_codes:",
+        config.non_fatal_status_codes_.ToString()));
+  }
+
+ private:
+  int max_attempts_ = 0;
+  Duration hedging_delay_;
+  StatusCodeSet non_fatal_status_codes_;
+};
+
 class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
  public:
   absl::string_view name() const override { return parser_name(); }
@@ -110,6 +148,29 @@ class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
   static absl::string_view parser_name() { return "retry"; }
 };
 
+class HedgingServiceConfigParser final : public ServiceConfigParser::Parser {
+ public:
+  absl::string_view name() const override { return parser_name(); }
+
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
+      const ChannelArgs& args, const Json& json,
+      ValidationErrors* errors) override;
+
+  static size_t ParserIndex();
+  static void Register(CoreConfiguration::Builder* builder);
+
+ private:
+  static absl::string_view parser_name() { return "hedging"; }
+};
+
+// Returns how many bytes a call may buffer for retries, given the
+// configured per-RPC retry buffer size and the channel's memory pressure.
+// Buffering for retries is the first thing to give up when memory runs
+// short: past 50% memory pressure, the buffer shrinks linearly, down to
+// nothing at 100%, where calls commit as soon as they send a message.
+size_t RetryBufferSizeUnderMemoryPressure(size_t size,
+                                          double memory_pressure);
+
 }  // namespace internal
 }  // namespace grpc_core
 
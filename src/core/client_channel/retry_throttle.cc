@@ -20,6 +20,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <limits>
@@ -27,6 +29,7 @@
 #include <string>
 #include <utility>
 
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_core {
@@ -45,6 +48,89 @@ T ClampedAdd(std::atomic<T>& value, T delta, T min, T max) {
 }
 }  // namespace
 
+//
+// ServerRetryThrottleData::RetryBudget
+//
+
+// Counts the successes and retries of the last window in kNumBuckets
+// buckets, each covering window / kNumBuckets, and sharded per CPU so that
+// recording a success does not bounce a cache line between CPUs.
+class ServerRetryThrottleData::RetryBudget final {
+ public:
+  explicit RetryBudget(const BudgetParams& params)
+      : params_(params),
+        bucket_millis_(
+            std::max<int64_t>(1, params.window.millis() / kNumBuckets)) {}
+
+  const BudgetParams& params() const { return params_; }
+
+  void RecordSuccess() { Record(shards_.this_cpu().successes, Interval()); }
+
+  // Retries are checked with IsExhausted() and counted separately, once
+  // they are sent, so concurrent callers may overdraw the budget slightly.
+  void RecordRetry() { Record(shards_.this_cpu().retries, Interval()); }
+
+  bool IsExhausted() { return !CanRetry(Interval()); }
+
+ private:
+  // A power of two, so that bucket indexes stay consistent when interval
+  // numbers wrap around.
+  static constexpr uint32_t kNumBuckets = 8;
+
+  // Each counter holds the number of the interval it counts for in the top
+  // 32 bits, and the count in the bottom 32 bits, so that a stale bucket
+  // can be reset and incremented in one step.
+  using Buckets = std::array<std::atomic<uint64_t>, kNumBuckets>;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    Buckets successes{};
+    Buckets retries{};
+  };
+
+  uint32_t Interval() const {
+    return static_cast<uint32_t>(
+        Timestamp::Now().milliseconds_after_process_epoch() / bucket_millis_);
+  }
+
+  static void Record(Buckets& buckets, uint32_t interval) {
+    std::atomic<uint64_t>& bucket = buckets[interval % kNumBuckets];
+    uint64_t prev = bucket.load(std::memory_order_relaxed);
+    const uint64_t first = (static_cast<uint64_t>(interval) << 32) | 1;
+    uint64_t next;
+    do {
+      next = (prev >> 32) == interval ? prev + 1 : first;
+    } while (!bucket.compare_exchange_weak(prev, next,
+                                           std::memory_order_relaxed));
+  }
+
+  // Sums the counts of the buckets in the window ending with interval.
+  uint64_t Count(Buckets Shard::* buckets, uint32_t interval) {
+    uint64_t count = 0;
+    for (Shard& shard : shards_) {
+      for (const std::atomic<uint64_t>& bucket : shard.*buckets) {
+        const uint64_t value = bucket.load(std::memory_order_relaxed);
+        if (interval - static_cast<uint32_t>(value >> 32) < kNumBuckets) {
+          count += value & 0xffffffff;
+        }
+      }
+    }
+    return count;
+  }
+
+  bool CanRetry(uint32_t interval) {
+    // Compare in hundredths of a retry.
+    const uint64_t budget =
+        Count(&Shard::successes, interval) * params_.percent +
+        static_cast<uint64_t>(params_.min_retries_per_second) *
+            params_.window.millis() / 10;
+    return Count(&Shard::retries, interval) * 100 < budget;
+  }
+
+  const BudgetParams params_;
+  const int64_t bucket_millis_;
+  PerCpu<Shard> shards_{PerCpuOptions().SetMaxShards(16)};
+};
+
 //
 // ServerRetryThrottleData
 //
@@ -59,7 +145,7 @@ ServerRetryThrottleData::ServerRetryThrottleData(
   // the token count by scaling proportionately to the old data.  This
   // ensures that if we're already throttling retries on the old scale,
   // we will start out doing the same thing on the new one.
-  if (old_throttle_data != nullptr) {
+  if (old_throttle_data != nullptr && old_throttle_data->budget_ == nullptr) {
     double token_fraction =
         static_cast<double>(
             old_throttle_data->milli_tokens_.load(std::memory_order_relaxed)) /
@@ -68,12 +154,19 @@ ServerRetryThrottleData::ServerRetryThrottleData(
         static_cast<uintptr_t>(token_fraction * max_milli_tokens);
   }
   milli_tokens_.store(initial_milli_tokens, std::memory_order_relaxed);
-  // If there was a pre-existing entry, mark it as stale and give it a
-  // pointer to the new entry, which is its replacement.
-  if (old_throttle_data != nullptr) {
-    Ref().release();  // Ref held by pre-existing entry.
-    old_throttle_data->replacement_.store(this, std::memory_order_release);
-  }
+  ReplaceOldThrottleData(old_throttle_data);
+}
+
+ServerRetryThrottleData::ServerRetryThrottleData(
+    const BudgetParams& budget_params,
+    ServerRetryThrottleData* old_throttle_data)
+    : max_milli_tokens_(0),
+      milli_token_ratio_(0),
+      milli_tokens_(0),
+      budget_(std::make_unique<RetryBudget>(budget_params)) {
+  // The budget starts out empty: unlike tokens, counts of recent calls
+  // cannot be carried over from a different kind of throttle.
+  ReplaceOldThrottleData(old_throttle_data);
 }
 
 ServerRetryThrottleData::~ServerRetryThrottleData() {
@@ -84,6 +177,21 @@ ServerRetryThrottleData::~ServerRetryThrottleData() {
   }
 }
 
+const ServerRetryThrottleData::BudgetParams*
+ServerRetryThrottleData::budget_params() const {
+  return budget_ == nullptr ? nullptr : &budget_->params();
+}
+
+void ServerRetryThrottleData::ReplaceOldThrottleData(
+    ServerRetryThrottleData* old_throttle_data) {
+  // If there was a pre-existing entry, mark it as stale and give it a
+  // pointer to the new entry, which is its replacement.
+  if (old_throttle_data != nullptr) {
+    Ref().release();  // Ref held by pre-existing entry.
+    old_throttle_data->replacement_.store(this, std::memory_order_release);
+  }
+}
+
 void ServerRetryThrottleData::GetReplacementThrottleDataIfNeeded(
     ServerRetryThrottleData** throttle_data) {
   while (true) {
@@ -98,6 +206,11 @@ bool ServerRetryThrottleData::RecordFailure() {
   // First, check if we are stale and need to be replaced.
   ServerRetryThrottleData* throttle_data = this;
   GetReplacementThrottleDataIfNeeded(&throttle_data);
+  if (throttle_data->budget_ != nullptr) {
+    // A failure costs nothing; the retry it leads to, if any, is counted by
+    // RecordRetry().
+    return !throttle_data->budget_->IsExhausted();
+  }
   // We decrement milli_tokens by 1000 (1 token) for each failure.
   const uintptr_t new_value = ClampedAdd<intptr_t>(
       throttle_data->milli_tokens_, -1000, 0,
@@ -112,6 +225,10 @@ void ServerRetryThrottleData::RecordSuccess() {
   // First, check if we are stale and need to be replaced.
   ServerRetryThrottleData* throttle_data = this;
   GetReplacementThrottleDataIfNeeded(&throttle_data);
+  if (throttle_data->budget_ != nullptr) {
+    throttle_data->budget_->RecordSuccess();
+    return;
+  }
   // We increment milli_tokens by milli_token_ratio for each success.
   ClampedAdd<intptr_t>(
       throttle_data->milli_tokens_, throttle_data->milli_token_ratio_, 0,
@@ -120,6 +237,26 @@ void ServerRetryThrottleData::RecordSuccess() {
                                  std::numeric_limits<intptr_t>::max())));
 }
 
+void ServerRetryThrottleData::RecordRetry() {
+  // First, check if we are stale and need to be replaced.
+  ServerRetryThrottleData* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  if (throttle_data->budget_ != nullptr) throttle_data->budget_->RecordRetry();
+}
+
+bool ServerRetryThrottleData::IsThrottled() {
+  // First, check if we are stale and need to be replaced.
+  ServerRetryThrottleData* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  if (throttle_data->budget_ != nullptr) {
+    return throttle_data->budget_->IsExhausted();
+  }
+  const intptr_t milli_tokens =
+      throttle_data->milli_tokens_.load(std::memory_order_relaxed);
+  return static_cast<uintptr_t>(milli_tokens) <=
+         throttle_data->max_milli_tokens_ / 2;
+}
+
 //
 // ServerRetryThrottleMap
 //
@@ -136,13 +273,34 @@ RefCountedPtr<ServerRetryThrottleData> ServerRetryThrottleMap::GetDataForServer(
   auto it = map_.find(server_name);
   ServerRetryThrottleData* throttle_data =
       it == map_.end() ? nullptr : it->second.get();
-  if (throttle_data == nullptr ||
+  if (throttle_data == nullptr || throttle_data->budget_params() != nullptr ||
       throttle_data->max_milli_tokens() != max_milli_tokens ||
       throttle_data->milli_token_ratio() != milli_token_ratio) {
     // Entry not found, or found with old parameters.  Create a new one.
-    it = map_.emplace(server_name,
-                      MakeRefCounted<ServerRetryThrottleData>(
-                          max_milli_tokens, milli_token_ratio, throttle_data))
+    it = map_.insert_or_assign(
+                 server_name,
+                 MakeRefCounted<ServerRetryThrottleData>(
+                     max_milli_tokens, milli_token_ratio, throttle_data))
+             .first;
+    throttle_data = it->second.get();
+  }
+  return throttle_data->Ref();
+}
+
+RefCountedPtr<ServerRetryThrottleData>
+ServerRetryThrottleMap::GetBudgetForServer(
+    const std::string& server_name,
+    const ServerRetryThrottleData::BudgetParams& budget_params) {
+  MutexLock lock(&mu_);
+  auto it = map_.find(server_name);
+  ServerRetryThrottleData* throttle_data =
+      it == map_.end() ? nullptr : it->second.get();
+  if (throttle_data == nullptr || throttle_data->budget_params() == nullptr ||
+      !(*throttle_data->budget_params() == budget_params)) {
+    // Entry not found, or found with other parameters.  Create a new one.
+    it = map_.insert_or_assign(server_name,
+                               MakeRefCounted<ServerRetryThrottleData>(
+                                   budget_params, throttle_data))
              .first;
     throttle_data = it->second.get();
   }
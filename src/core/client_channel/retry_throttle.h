@@ -24,41 +24,80 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 #include <string>
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 namespace internal {
 
 /// Tracks retry throttling data for an individual server name.
+///
+/// Retries are limited either by the token bucket described in gRFC A6, or
+/// by a retry budget, which allows retries for up to a percentage of the
+/// calls that succeeded recently, as in Finagle and Envoy.
 class ServerRetryThrottleData final
     : public RefCounted<ServerRetryThrottleData> {
  public:
+  /// Parameters of a retry budget: retries may be up to \a percent percent
+  /// of the calls that succeeded during the last \a window, plus
+  /// \a min_retries_per_second.
+  struct BudgetParams {
+    uint32_t percent;
+    uint32_t min_retries_per_second;
+    Duration window;
+
+    bool operator==(const BudgetParams& other) const {
+      return percent == other.percent &&
+             min_retries_per_second == other.min_retries_per_second &&
+             window == other.window;
+    }
+  };
+
   ServerRetryThrottleData(uintptr_t max_milli_tokens,
                           uintptr_t milli_token_ratio,
                           ServerRetryThrottleData* old_throttle_data);
+  ServerRetryThrottleData(const BudgetParams& budget_params,
+                          ServerRetryThrottleData* old_throttle_data);
   ~ServerRetryThrottleData() override;
 
   /// Records a failure.  Returns true if it's okay to send a retry.
+  /// A retry budget is not charged until RecordRetry() is called.
   bool RecordFailure();
 
+  /// Records that a retry (or hedge) is being sent, which counts against a
+  /// retry budget.  No-op for the token bucket.
+  void RecordRetry();
+
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if retries (and hedges) are currently being throttled,
+  /// without recording anything.
+  bool IsThrottled();
+
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
+  /// Returns nullptr unless this is a retry budget.
+  const BudgetParams* budget_params() const;
 
  private:
+  class RetryBudget;
+
+  void ReplaceOldThrottleData(ServerRetryThrottleData* old_throttle_data);
   void GetReplacementThrottleDataIfNeeded(
       ServerRetryThrottleData** throttle_data);
 
   const uintptr_t max_milli_tokens_;
   const uintptr_t milli_token_ratio_;
   std::atomic<intptr_t> milli_tokens_;
+  // Set for a retry budget, in which case the token fields are unused.
+  const std::unique_ptr<RetryBudget> budget_;
   // A pointer to the replacement for this ServerRetryThrottleData entry.
   // If non-nullptr, then this entry is stale and must not be used.
   // We hold a reference to the replacement.
@@ -76,6 +115,12 @@ class ServerRetryThrottleMap final {
       const std::string& server_name, uintptr_t max_milli_tokens,
       uintptr_t milli_token_ratio);
 
+  /// Returns the retry budget for \a server_name, creating a new entry if
+  /// needed.
+  RefCountedPtr<ServerRetryThrottleData> GetBudgetForServer(
+      const std::string& server_name,
+      const ServerRetryThrottleData::BudgetParams& budget_params);
+
  private:
   using StringToDataMap =
       std::map<std::string, RefCountedPtr<ServerRetryThrottleData>>;
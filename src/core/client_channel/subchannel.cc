@@ -24,6 +24,7 @@
 #include <limits.h>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <new>
 #include <optional>
@@ -160,9 +161,20 @@ class LegacyConnectedSubchannel : public ConnectedSubchannel {
     elem->filter->start_transport_op(elem, op);
   }
 
+  size_t active_calls() const override {
+    return active_calls_.load(std::memory_order_relaxed);
+  }
+
+  // Called by SubchannelCall.
+  void CallStarted() { active_calls_.fetch_add(1, std::memory_order_relaxed); }
+  void CallFinished() {
+    active_calls_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
  private:
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   RefCountedPtr<grpc_channel_stack> channel_stack_;
+  std::atomic<size_t> active_calls_{0};
 };
 
 //
@@ -178,7 +190,18 @@ class NewConnectedSubchannel : public ConnectedSubchannel {
 
     ClientTransport* transport() { return transport_.get(); }
 
+    size_t active_calls() const {
+      return active_calls_.load(std::memory_order_relaxed);
+    }
+
     void HandleCall(CallHandler handler) override {
+      active_calls_.fetch_add(1, std::memory_order_relaxed);
+      if (!handler.OnDone(
+              [self = WeakRefAsSubclass<TransportCallDestination>()](bool) {
+                self->active_calls_.fetch_sub(1, std::memory_order_relaxed);
+              })) {
+        active_calls_.fetch_sub(1, std::memory_order_relaxed);
+      }
       transport_->StartCall(std::move(handler));
     }
 
@@ -186,6 +209,7 @@ class NewConnectedSubchannel : public ConnectedSubchannel {
 
    private:
     OrphanablePtr<ClientTransport> transport_;
+    std::atomic<size_t> active_calls_{0};
   };
 
   NewConnectedSubchannel(
@@ -220,6 +244,8 @@ class NewConnectedSubchannel : public ConnectedSubchannel {
     Crash("legacy ping method called in call v3 impl");
   }
 
+  size_t active_calls() const override { return transport_->active_calls(); }
+
  private:
   RefCountedPtr<UnstartedCallDestination> call_destination_;
   RefCountedPtr<TransportCallDestination> transport_;
@@ -242,6 +268,7 @@ SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     : connected_subchannel_(args.connected_subchannel
                                 .TakeAsSubclass<LegacyConnectedSubchannel>()),
       deadline_(args.deadline) {
+  connected_subchannel_->CallStarted();
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,              // call_stack
@@ -310,6 +337,7 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   SubchannelCall* self = static_cast<SubchannelCall*>(arg);
   // Keep some members before destroying the subchannel call.
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
+  self->connected_subchannel_->CallFinished();
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
   // Destroy the subchannel call.
@@ -420,15 +448,25 @@ class Subchannel::ConnectedSubchannelStateWatcher final
             << " reports " << ConnectivityStateName(new_state) << ": "
             << status;
         c->connected_subchannel_.reset();
+        c->pooled_connections_.clear();
         if (c->channelz_node() != nullptr) {
           c->channelz_node()->SetChildSocket(nullptr);
         }
+        c->backoff_.Reset();
+        // If a pooled connection attempt is in progress, the connector is
+        // busy, so carry on with that attempt as a regular one.
+        if (c->connecting_pooled_) {
+          c->connecting_pooled_ = false;
+          c->next_attempt_time_ =
+              Timestamp::Now() + c->backoff_.NextAttemptDelay();
+          c->SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, status);
+          return;
+        }
         // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
         // pass along the status from the transport, since it may have
         // keepalive info attached to it that the channel needs.
         // TODO(roth): Consider whether there's a cleaner way to do this.
         c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
-        c->backoff_.Reset();
       }
     }
   }
@@ -436,6 +474,50 @@ class Subchannel::ConnectedSubchannelStateWatcher final
   WeakRefCountedPtr<Subchannel> subchannel_;
 };
 
+//
+// Subchannel::PooledConnectionStateWatcher
+//
+
+class Subchannel::PooledConnectionStateWatcher final
+    : public AsyncConnectivityStateWatcherInterface {
+ public:
+  // Must be instantiated while holding c->mu.
+  PooledConnectionStateWatcher(WeakRefCountedPtr<Subchannel> c, uint64_t id)
+      : subchannel_(std::move(c)), id_(id) {}
+
+  ~PooledConnectionStateWatcher() override {
+    subchannel_.reset(DEBUG_LOCATION, "pooled_state_watcher");
+  }
+
+ private:
+  void OnConnectivityStateChange(grpc_connectivity_state new_state,
+                                 const absl::Status& status) override {
+    if (new_state != GRPC_CHANNEL_TRANSIENT_FAILURE &&
+        new_state != GRPC_CHANNEL_SHUTDOWN) {
+      return;
+    }
+    Subchannel* c = subchannel_.get();
+    MutexLock lock(&c->mu_);
+    // The connection may already have been dropped, either because we saw
+    // an earlier failure or because connected_subchannel_ went away.
+    auto it = std::find_if(
+        c->pooled_connections_.begin(), c->pooled_connections_.end(),
+        [this](const PooledConnection& pooled) { return pooled.id == id_; });
+    if (it == c->pooled_connections_.end()) return;
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "subchannel " << c << " " << c->key_.ToString()
+        << ": pooled connection " << it->connected_subchannel.get()
+        << " reports " << ConnectivityStateName(new_state) << ": " << status;
+    c->pooled_connections_.erase(it);
+    if (c->num_connections() < c->min_connections_) {
+      c->StartPooledConnectingLocked();
+    }
+  }
+
+  WeakRefCountedPtr<Subchannel> subchannel_;
+  const uint64_t id_;
+};
+
 //
 // Subchannel::ConnectivityStateWatcherList
 //
@@ -519,6 +601,16 @@ Subchannel::Subchannel(SubchannelKey key,
       work_serializer_(args_.GetObjectRef<EventEngine>()),
       backoff_(ParseArgsForBackoffValues(args_, &min_connect_timeout_)),
       event_engine_(args_.GetObjectRef<EventEngine>()) {
+  max_connections_ = std::max(
+      1, args_.GetInt(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MAX_CONNECTIONS)
+             .value_or(1));
+  min_connections_ = Clamp(
+      args_.GetInt(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MIN_CONNECTIONS)
+          .value_or(1),
+      1, static_cast<int>(max_connections_));
+  streams_per_connection_ = std::max(
+      1, args_.GetInt(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_STREAMS_PER_CONNECTION)
+             .value_or(100));
   // A grpc_init is added here to ensure that grpc_shutdown does not happen
   // until the subchannel is destroyed. Subchannels can persist longer than
   // channels because they maybe reused/shared among multiple channels. As a
@@ -537,6 +629,17 @@ Subchannel::Subchannel(SubchannelKey key,
                              .proxy_mapper_registry()
                              .MapAddress(key_.address(), &args_)
                              .value_or(key_.address());
+  // Join the other subchannels connecting to the same address.
+  if (args_.GetBool(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_SHARED_BACKOFF)
+          .value_or(false)) {
+    auto address = grpc_sockaddr_to_uri(&key_.address());
+    if (address.ok()) {
+      Duration unused_min_connect_timeout;
+      connect_coordinator_ = SubchannelConnectCoordinator::ForAddress(
+          *address,
+          ParseArgsForBackoffValues(args_, &unused_min_connect_timeout));
+    }
+  }
   // Initialize channelz.
   const bool channelz_enabled = args_.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
                                     .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
@@ -548,7 +651,10 @@ Subchannel::Subchannel(SubchannelKey key,
     channelz_node_ = MakeRefCounted<channelz::SubchannelNode>(
         grpc_sockaddr_to_uri(&key_.address())
             .value_or("<unknown address type>"),
-        channel_tracer_max_memory);
+        channel_tracer_max_memory,
+        args_.GetBool(GRPC_ARG_CHANNELZ_LAZY_REGISTRATION).value_or(false)
+            ? channelz::BaseNode::Registration::kLazy
+            : channelz::BaseNode::Registration::kEager);
     channelz_node_->AddTraceEvent(
         channelz::ChannelTrace::Severity::Info,
         grpc_slice_from_static_string("subchannel created"));
@@ -646,6 +752,7 @@ void Subchannel::ResetBackoff() {
   auto self = WeakRef(DEBUG_LOCATION, "ResetBackoff");
   MutexLock lock(&mu_);
   backoff_.Reset();
+  if (connect_coordinator_ != nullptr) connect_coordinator_->ResetBackoff();
   if (state_ == GRPC_CHANNEL_TRANSIENT_FAILURE &&
       event_engine_->Cancel(retry_timer_handle_)) {
     OnRetryTimerLocked();
@@ -666,6 +773,23 @@ void Subchannel::Orphaned() {
   shutdown_ = true;
   connector_.reset();
   connected_subchannel_.reset();
+  pooled_connections_.clear();
+}
+
+RefCountedPtr<ConnectedSubchannel> Subchannel::PickConnectedSubchannel() {
+  MutexLock lock(&mu_);
+  if (connected_subchannel_ == nullptr) return nullptr;
+  ConnectedSubchannel* picked = connected_subchannel_.get();
+  size_t picked_calls = picked->active_calls();
+  for (const PooledConnection& pooled : pooled_connections_) {
+    const size_t calls = pooled.connected_subchannel->active_calls();
+    if (calls < picked_calls) {
+      picked = pooled.connected_subchannel.get();
+      picked_calls = calls;
+    }
+  }
+  if (picked_calls >= streams_per_connection_) StartPooledConnectingLocked();
+  return picked->Ref();
 }
 
 void Subchannel::GetOrAddDataProducer(
@@ -730,8 +854,34 @@ void Subchannel::OnRetryTimerLocked() {
 }
 
 void Subchannel::StartConnectingLocked() {
-  // Set next attempt time.
   const Timestamp now = Timestamp::Now();
+  // Wait if another subchannel is connecting to the same address, or if
+  // the last attempt to it failed not long ago.
+  if (connect_coordinator_ != nullptr) {
+    if (!connect_coordinator_->TryStartAttempt(
+            now, [self = WeakRef(DEBUG_LOCATION, "ConnectCoordinator")](
+                     Duration delay) mutable {
+              auto* event_engine = self->event_engine_.get();
+              event_engine->RunAfter(delay, [self = std::move(self)]() mutable {
+                ExecCtx exec_ctx;
+                self->OnConnectCoordinatorRetry();
+                // Make sure the subchannel is destroyed with an ExecCtx,
+                // as in the retry timer.
+                self.reset();
+              });
+            })) {
+      GRPC_TRACE_LOG(subchannel, INFO)
+          << "subchannel " << this << " " << key_.ToString()
+          << ": waiting for other connection attempts to the address";
+      waiting_for_connect_coordinator_ = true;
+      if (state_ != GRPC_CHANNEL_CONNECTING) {
+        SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+      }
+      return;
+    }
+    coordinated_attempt_ = true;
+  }
+  // Set next attempt time.
   const Timestamp min_deadline = now + min_connect_timeout_;
   next_attempt_time_ = now + backoff_.NextAttemptDelay();
   // Report CONNECTING.
@@ -746,6 +896,13 @@ void Subchannel::StartConnectingLocked() {
   connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
 }
 
+void Subchannel::OnConnectCoordinatorRetry() {
+  MutexLock lock(&mu_);
+  if (shutdown_ || !waiting_for_connect_coordinator_) return;
+  waiting_for_connect_coordinator_ = false;
+  StartConnectingLocked();
+}
+
 void Subchannel::OnConnectingFinished(void* arg, grpc_error_handle error) {
   WeakRefCountedPtr<Subchannel> c(static_cast<Subchannel*>(arg));
   {
@@ -756,10 +913,19 @@ void Subchannel::OnConnectingFinished(void* arg, grpc_error_handle error) {
 }
 
 void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
+  // Let the other subchannels for the address go ahead.
+  if (std::exchange(coordinated_attempt_, false)) {
+    connect_coordinator_->AttemptFinished(
+        Timestamp::Now(), connecting_result_.transport != nullptr);
+  }
   if (shutdown_) {
     connecting_result_.Reset();
     return;
   }
+  if (connecting_pooled_) {
+    OnPooledConnectingFinishedLocked(error);
+    return;
+  }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
   // Note that if the connection attempt took longer than the backoff
@@ -792,8 +958,59 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
   }
 }
 
-bool Subchannel::PublishTransportLocked() {
-  auto socket_node = std::move(connecting_result_.socket_node);
+void Subchannel::StartPooledConnectingLocked() {
+  if (shutdown_ || state_ != GRPC_CHANNEL_READY || connecting_pooled_ ||
+      num_connections() >= max_connections_) {
+    return;
+  }
+  const Timestamp now = Timestamp::Now();
+  if (now < next_pooled_attempt_time_) return;
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": opening pooled connection " << num_connections() + 1 << " of "
+      << max_connections_;
+  connecting_pooled_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = now + min_connect_timeout_;
+  args.channel_args = args_;
+  WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
+void Subchannel::OnPooledConnectingFinishedLocked(grpc_error_handle error) {
+  connecting_pooled_ = false;
+  // Unlike connected_subchannel_, a pooled connection that cannot be
+  // established does not affect the subchannel's state.  Just hold off
+  // on trying again for a while.
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+  if (connecting_result_.transport != nullptr) {
+    connected_subchannel = MakeConnectedSubchannelLocked();
+  }
+  connecting_result_.Reset();
+  if (connected_subchannel == nullptr) {
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "subchannel " << this << " " << key_.ToString()
+        << ": pooled connect failed (" << StatusToString(error)
+        << "), not retrying for " << min_connect_timeout_.millis() << " ms";
+    next_pooled_attempt_time_ = Timestamp::Now() + min_connect_timeout_;
+    return;
+  }
+  const uint64_t id = next_pooled_connection_id_++;
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": new pooled connection at " << connected_subchannel.get();
+  connected_subchannel->StartWatch(
+      pollset_set_,
+      MakeOrphanable<PooledConnectionStateWatcher>(
+          WeakRef(DEBUG_LOCATION, "pooled_state_watcher"), id));
+  pooled_connections_.push_back({id, std::move(connected_subchannel)});
+  if (num_connections() < min_connections_) StartPooledConnectingLocked();
+}
+
+RefCountedPtr<ConnectedSubchannel>
+Subchannel::MakeConnectedSubchannelLocked() {
   if (connecting_result_.transport->filter_stack_transport() != nullptr) {
     // Construct channel stack.
     // Builder takes ownership of transport.
@@ -802,57 +1019,61 @@ bool Subchannel::PublishTransportLocked() {
         connecting_result_.channel_args.SetObject(
             std::exchange(connecting_result_.transport, nullptr)));
     if (!CoreConfiguration::Get().channel_init().CreateStack(&builder)) {
-      return false;
+      return nullptr;
     }
     absl::StatusOr<RefCountedPtr<grpc_channel_stack>> stack = builder.Build();
     if (!stack.ok()) {
       connecting_result_.Reset();
       LOG(ERROR) << "subchannel " << this << " " << key_.ToString()
                  << ": error initializing subchannel stack: " << stack.status();
-      return false;
-    }
-    connected_subchannel_ = MakeRefCounted<LegacyConnectedSubchannel>(
-        std::move(*stack), args_, channelz_node_);
-  } else {
-    OrphanablePtr<ClientTransport> transport(
-        std::exchange(connecting_result_.transport, nullptr)
-            ->client_transport());
-    InterceptionChainBuilder builder(
-        connecting_result_.channel_args.SetObject(transport.get()));
-    if (channelz_node_ != nullptr) {
-      // TODO(ctiller): If/when we have a good way to access the subchannel
-      // from a filter (maybe GetContext<Subchannel>?), consider replacing
-      // these two hooks with a filter so that we can avoid storing two
-      // separate refs to the channelz node in each connection.
-      builder.AddOnClientInitialMetadata(
-          [channelz_node = channelz_node_](ClientMetadata&) {
-            channelz_node->RecordCallStarted();
-          });
-      builder.AddOnServerTrailingMetadata(
-          [channelz_node = channelz_node_](ServerMetadata& metadata) {
-            if (IsStatusOk(metadata)) {
-              channelz_node->RecordCallSucceeded();
-            } else {
-              channelz_node->RecordCallFailed();
-            }
-          });
-    }
-    CoreConfiguration::Get().channel_init().AddToInterceptionChainBuilder(
-        GRPC_CLIENT_SUBCHANNEL, builder);
-    auto transport_destination =
-        MakeRefCounted<NewConnectedSubchannel::TransportCallDestination>(
-            std::move(transport));
-    auto call_destination = builder.Build(transport_destination);
-    if (!call_destination.ok()) {
-      connecting_result_.Reset();
-      LOG(ERROR) << "subchannel " << this << " " << key_.ToString()
-                 << ": error initializing subchannel stack: "
-                 << call_destination.status();
-      return false;
+      return nullptr;
     }
-    connected_subchannel_ = MakeRefCounted<NewConnectedSubchannel>(
-        std::move(*call_destination), std::move(transport_destination), args_);
+    return MakeRefCounted<LegacyConnectedSubchannel>(std::move(*stack), args_,
+                                                     channelz_node_);
   }
+  OrphanablePtr<ClientTransport> transport(
+      std::exchange(connecting_result_.transport, nullptr)->client_transport());
+  InterceptionChainBuilder builder(
+      connecting_result_.channel_args.SetObject(transport.get()));
+  if (channelz_node_ != nullptr) {
+    // TODO(ctiller): If/when we have a good way to access the subchannel
+    // from a filter (maybe GetContext<Subchannel>?), consider replacing
+    // these two hooks with a filter so that we can avoid storing two
+    // separate refs to the channelz node in each connection.
+    builder.AddOnClientInitialMetadata(
+        [channelz_node = channelz_node_](ClientMetadata&) {
+          channelz_node->RecordCallStarted();
+        });
+    builder.AddOnServerTrailingMetadata(
+        [channelz_node = channelz_node_](ServerMetadata& metadata) {
+          if (IsStatusOk(metadata)) {
+            channelz_node->RecordCallSucceeded();
+          } else {
+            channelz_node->RecordCallFailed();
+          }
+        });
+  }
+  CoreConfiguration::Get().channel_init().AddToInterceptionChainBuilder(
+      GRPC_CLIENT_SUBCHANNEL, builder);
+  auto transport_destination =
+      MakeRefCounted<NewConnectedSubchannel::TransportCallDestination>(
+          std::move(transport));
+  auto call_destination = builder.Build(transport_destination);
+  if (!call_destination.ok()) {
+    connecting_result_.Reset();
+    LOG(ERROR) << "subchannel " << this << " " << key_.ToString()
+               << ": error initializing subchannel stack: "
+               << call_destination.status();
+    return nullptr;
+  }
+  return MakeRefCounted<NewConnectedSubchannel>(
+      std::move(*call_destination), std::move(transport_destination), args_);
+}
+
+bool Subchannel::PublishTransportLocked() {
+  auto socket_node = std::move(connecting_result_.socket_node);
+  connected_subchannel_ = MakeConnectedSubchannelLocked();
+  if (connected_subchannel_ == nullptr) return false;
   connecting_result_.Reset();
   // Publish.
   GRPC_TRACE_LOG(subchannel, INFO)
@@ -867,6 +1088,7 @@ bool Subchannel::PublishTransportLocked() {
                         WeakRef(DEBUG_LOCATION, "state_watcher")));
   // Report initial state.
   SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+  if (num_connections() < min_connections_) StartPooledConnectingLocked();
   return true;
 }
 
@@ -21,15 +21,18 @@
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/status/status.h"
 #include "src/core/client_channel/connector.h"
+#include "src/core/client_channel/subchannel_connect_coordinator.h"
 #include "src/core/client_channel/subchannel_pool_interface.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -80,6 +83,9 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   virtual size_t GetInitialCallSizeEstimate() const = 0;
   virtual void Ping(grpc_closure* on_initiate, grpc_closure* on_ack) = 0;
 
+  // Number of calls currently running on this connection.
+  virtual size_t active_calls() const = 0;
+
  protected:
   explicit ConnectedSubchannel(const ChannelArgs& args);
 
@@ -240,10 +246,19 @@ class Subchannel final : public DualRefCounted<Subchannel> {
     return connected_subchannel_;
   }
 
+  // Returns the connection a new call should use: the one with the fewest
+  // active calls, if the subchannel has more than one (see
+  // GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MAX_CONNECTIONS).  If even that one is
+  // saturated, starts opening another connection for later calls.
+  // Returns null if the subchannel is not connected.
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannel()
+      ABSL_LOCKS_EXCLUDED(mu_);
+
   RefCountedPtr<UnstartedCallDestination> call_destination() {
-    MutexLock lock(&mu_);
-    if (connected_subchannel_ == nullptr) return nullptr;
-    return connected_subchannel_->unstarted_call_destination();
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel =
+        PickConnectedSubchannel();
+    if (connected_subchannel == nullptr) return nullptr;
+    return connected_subchannel->unstarted_call_destination();
   }
 
   // Attempt to connect to the backend.  Has no effect if already connected.
@@ -315,6 +330,13 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   };
 
   class ConnectedSubchannelStateWatcher;
+  class PooledConnectionStateWatcher;
+
+  // A connection opened in addition to connected_subchannel_.
+  struct PooledConnection {
+    uint64_t id;
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+  };
 
   // Sets the subchannel's connectivity state to \a state.
   void SetConnectivityStateLocked(grpc_connectivity_state state,
@@ -330,6 +352,20 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Builds a connected subchannel on top of the transport in
+  // connecting_result_.  Returns null on failure.
+  RefCountedPtr<ConnectedSubchannel> MakeConnectedSubchannelLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Methods for connection pooling.
+  size_t num_connections() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return 1 + pooled_connections_.size();
+  }
+  // Invoked when the connect coordinator lets a waiting attempt go ahead.
+  void OnConnectCoordinatorRetry();
+  void StartPooledConnectingLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnPooledConnectingFinishedLocked(grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -346,6 +382,15 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   // Minimum connection timeout.
   Duration min_connect_timeout_;
+  // Shared with the other subchannels for the same address, if
+  // GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_SHARED_BACKOFF is set.
+  RefCountedPtr<SubchannelConnectCoordinator> connect_coordinator_;
+  // Connection pooling limits.  See
+  // GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_{MIN,MAX}_CONNECTIONS and
+  // GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_STREAMS_PER_CONNECTION.
+  size_t min_connections_;
+  size_t max_connections_;
+  size_t streams_per_connection_;
 
   // Connection state.
   OrphanablePtr<SubchannelConnector> connector_;
@@ -374,11 +419,29 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
 
+  // Connections opened while READY, alongside connected_subchannel_, for
+  // when calls saturate it.  The subchannel's connectivity state follows
+  // connected_subchannel_ alone: these are dropped when it goes away.
+  std::vector<PooledConnection> pooled_connections_ ABSL_GUARDED_BY(mu_);
+  uint64_t next_pooled_connection_id_ ABSL_GUARDED_BY(mu_) = 0;
+  // Whether the connection attempt in progress is for a pooled connection.
+  // The connector handles one attempt at a time, so there is at most one.
+  bool connecting_pooled_ ABSL_GUARDED_BY(mu_) = false;
+  // Pooled connection attempts are not started before this time, after
+  // one fails.
+  Timestamp next_pooled_attempt_time_ ABSL_GUARDED_BY(mu_);
+
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
   Timestamp next_attempt_time_ ABSL_GUARDED_BY(mu_);
   grpc_event_engine::experimental::EventEngine::TaskHandle retry_timer_handle_
       ABSL_GUARDED_BY(mu_);
+  // Whether the subchannel is CONNECTING but waiting for
+  // connect_coordinator_ before actually connecting.
+  bool waiting_for_connect_coordinator_ ABSL_GUARDED_BY(mu_) = false;
+  // Whether the connection attempt in progress was allowed by
+  // connect_coordinator_, which then needs to hear how it ends.
+  bool coordinated_attempt_ ABSL_GUARDED_BY(mu_) = false;
 
   // Keepalive time period (-1 for unset)
   int keepalive_time_ ABSL_GUARDED_BY(mu_) = -1;
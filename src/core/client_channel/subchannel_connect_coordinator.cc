@@ -0,0 +1,119 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/client_channel/subchannel_connect_coordinator.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/log/log.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Subchannels coming back after a hold are spread over this fraction of
+// the hold.
+constexpr double kHoldJitter = 0.2;
+
+struct Registry {
+  Mutex mu;
+  absl::flat_hash_map<std::string, SubchannelConnectCoordinator*> coordinators
+      ABSL_GUARDED_BY(mu);
+};
+
+Registry& GetRegistry() {
+  static NoDestruct<Registry> registry;
+  return *registry;
+}
+
+}  // namespace
+
+RefCountedPtr<SubchannelConnectCoordinator>
+SubchannelConnectCoordinator::ForAddress(
+    absl::string_view address, const BackOff::Options& backoff_options) {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  auto it = registry.coordinators.find(address);
+  if (it != registry.coordinators.end()) {
+    // The last subchannel may be destroying the entry right now.
+    auto coordinator = it->second->RefIfNonZero();
+    if (coordinator != nullptr) return coordinator;
+  }
+  RefCountedPtr<SubchannelConnectCoordinator> coordinator(
+      new SubchannelConnectCoordinator(std::string(address), backoff_options));
+  registry.coordinators.insert_or_assign(coordinator->address_,
+                                         coordinator.get());
+  return coordinator;
+}
+
+SubchannelConnectCoordinator::~SubchannelConnectCoordinator() {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  auto it = registry.coordinators.find(address_);
+  if (it != registry.coordinators.end() && it->second == this) {
+    registry.coordinators.erase(it);
+  }
+}
+
+bool SubchannelConnectCoordinator::TryStartAttempt(Timestamp now,
+                                                   RetryCallback retry) {
+  MutexLock lock(&mu_);
+  if (attempt_in_flight_) {
+    waiters_.push_back(std::move(retry));
+    return false;
+  }
+  if (now < hold_end_) {
+    retry(HoldDelayLocked(now));
+    return false;
+  }
+  attempt_in_flight_ = true;
+  return true;
+}
+
+void SubchannelConnectCoordinator::AttemptFinished(Timestamp now,
+                                                   bool connected) {
+  MutexLock lock(&mu_);
+  attempt_in_flight_ = false;
+  if (connected) {
+    backoff_.Reset();
+    hold_end_ = Timestamp::InfPast();
+  } else {
+    hold_start_ = now;
+    hold_end_ = now + backoff_.NextAttemptDelay();
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "connect coordinator for " << address_
+        << ": attempt failed, holding off for "
+        << (hold_end_ - now).millis() << " ms";
+  }
+  for (RetryCallback& waiter : waiters_) {
+    waiter(connected ? Duration::Zero() : HoldDelayLocked(now));
+  }
+  waiters_.clear();
+}
+
+void SubchannelConnectCoordinator::ResetBackoff() {
+  MutexLock lock(&mu_);
+  backoff_.Reset();
+  hold_end_ = Timestamp::InfPast();
+}
+
+Duration SubchannelConnectCoordinator::HoldDelayLocked(Timestamp now) {
+  const Duration spread = (hold_end_ - hold_start_) * kHoldJitter;
+  return (hold_end_ - now) + spread * absl::Uniform(rand_gen_, 0.0, 1.0);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,91 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_SUBCHANNEL_CONNECT_COORDINATOR_H
+#define GRPC_SRC_CORE_CLIENT_CHANNEL_SUBCHANNEL_CONNECT_COORDINATOR_H
+
+#include <grpc/support/port_platform.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/random/random.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/backoff.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Coordinates the connection attempts of all subchannels in the process
+// that connect to the same address and set
+// GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_SHARED_BACKOFF, whichever channel or
+// subchannel pool they belong to.  One of them connects at a time, and the
+// others wait for the outcome.  After a failure, all of them hold off for
+// a backoff delay kept for the address, and then come back spread out over
+// a fraction of that delay instead of all at once.
+class SubchannelConnectCoordinator final
+    : public RefCounted<SubchannelConnectCoordinator> {
+ public:
+  // Called with how long to wait before asking again.
+  using RetryCallback = absl::AnyInvocable<void(Duration)>;
+
+  // Returns the coordinator for \a address, creating it with
+  // \a backoff_options if no other subchannel uses it.
+  static RefCountedPtr<SubchannelConnectCoordinator> ForAddress(
+      absl::string_view address, const BackOff::Options& backoff_options);
+
+  ~SubchannelConnectCoordinator() override;
+
+  // Returns true if the caller may start a connection attempt now, in
+  // which case it must call AttemptFinished() once the attempt is over.
+  // Otherwise \a retry is invoked, possibly before this returns, once the
+  // caller should call TryStartAttempt() again.  \a retry must not block.
+  bool TryStartAttempt(Timestamp now, RetryCallback retry);
+
+  // Reports the outcome of an attempt allowed by TryStartAttempt().
+  void AttemptFinished(Timestamp now, bool connected);
+
+  // Ends the hold after a failure, as grpc_channel_reset_connect_backoff()
+  // does for a single subchannel.
+  void ResetBackoff();
+
+ private:
+  SubchannelConnectCoordinator(std::string address,
+                               const BackOff::Options& backoff_options)
+      : address_(std::move(address)), backoff_(backoff_options) {}
+
+  // How long a subchannel asking at \a now waits for the hold to end.
+  Duration HoldDelayLocked(Timestamp now) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const std::string address_;
+  Mutex mu_;
+  BackOff backoff_ ABSL_GUARDED_BY(mu_);
+  absl::BitGen rand_gen_ ABSL_GUARDED_BY(mu_);
+  bool attempt_in_flight_ ABSL_GUARDED_BY(mu_) = false;
+  // After a failed attempt, no attempt starts before hold_end_.
+  Timestamp hold_start_ ABSL_GUARDED_BY(mu_) = Timestamp::InfPast();
+  Timestamp hold_end_ ABSL_GUARDED_BY(mu_) = Timestamp::InfPast();
+  // Subchannels waiting for the attempt in flight.
+  std::vector<RetryCallback> waiters_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_CLIENT_CHANNEL_SUBCHANNEL_CONNECT_COORDINATOR_H
@@ -21,9 +21,11 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 
@@ -36,9 +38,13 @@ namespace grpc_core {
 
 SubchannelKey::SubchannelKey(const grpc_resolved_address& address,
                              const ChannelArgs& args)
-    : address_(address), args_(args) {}
+    : address_(address),
+      args_(args),
+      hash_(absl::HashOf(
+          absl::string_view(address_.addr, address_.len), args_.Hash())) {}
 
 bool SubchannelKey::operator<(const SubchannelKey& other) const {
+  if (hash_ != other.hash_) return hash_ < other.hash_;
   if (address_.len < other.address_.len) return true;
   if (address_.len > other.address_.len) return false;
   int r = memcmp(address_.addr, other.address_.addr, address_.len);
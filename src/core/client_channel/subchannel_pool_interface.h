@@ -20,6 +20,7 @@
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_SUBCHANNEL_POOL_INTERFACE_H
 
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 
 #include <string>
 
@@ -45,10 +46,14 @@ class SubchannelKey final {
   SubchannelKey(SubchannelKey&& other) noexcept = default;
   SubchannelKey& operator=(SubchannelKey&& other) noexcept = default;
 
+  // Orders keys by hash first, so that comparing different keys is
+  // usually cheap.
   bool operator<(const SubchannelKey& other) const;
 
   const grpc_resolved_address& address() const { return address_; }
   const ChannelArgs& args() const { return args_; }
+  // A hash of the address and args, computed at construction.
+  size_t hash() const { return hash_; }
 
   // Human-readable string suitable for logging.
   std::string ToString() const;
@@ -56,6 +61,7 @@ class SubchannelKey final {
  private:
   grpc_resolved_address address_;
   ChannelArgs args_;
+  size_t hash_;
 };
 
 // Interface for subchannel pool.
@@ -18,10 +18,13 @@
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 #include <stddef.h>
+#include <string.h>
 
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 
 #include "absl/log/log.h"
@@ -45,10 +48,10 @@
 namespace grpc_core {
 
 namespace {
-std::optional<std::string> MaybeSerializeBackendMetrics(
-    BackendMetricProvider* provider) {
-  if (provider == nullptr) return std::nullopt;
-  BackendMetricData data = provider->GetBackendMetricData();
+// Returns an empty string if there is nothing to report. Map entries of
+// serializations concatenated to this one take precedence, but scalars only
+// do when they are non-zero, since zeros are not serialized.
+std::string SerializeBackendMetrics(const BackendMetricData& data) {
   upb::Arena arena;
   xds_data_orca_v3_OrcaLoadReport* response =
       xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
@@ -97,14 +100,44 @@ std::optional<std::string> MaybeSerializeBackendMetrics(
         p.second, arena.ptr());
     has_data = true;
   }
-  if (!has_data) {
-    return std::nullopt;
-  }
+  if (!has_data) return std::string();
   size_t len;
   char* buf =
       xds_data_orca_v3_OrcaLoadReport_serialize(response, arena.ptr(), &len);
   return std::string(buf, len);
 }
+
+bool HasScalarMetrics(const BackendMetricData& data) {
+  return data.cpu_utilization != -1 || data.mem_utilization != -1 ||
+         data.application_utilization != -1 || data.qps != -1 ||
+         data.eps != -1;
+}
+
+// Overrides the metrics in data with those set in call_data, as
+// BackendMetricState::GetBackendMetricData() does.
+void MergeCallMetrics(const BackendMetricData& call_data,
+                      BackendMetricData* data) {
+  if (call_data.cpu_utilization != -1) {
+    data->cpu_utilization = call_data.cpu_utilization;
+  }
+  if (call_data.mem_utilization != -1) {
+    data->mem_utilization = call_data.mem_utilization;
+  }
+  if (call_data.application_utilization != -1) {
+    data->application_utilization = call_data.application_utilization;
+  }
+  if (call_data.qps != -1) data->qps = call_data.qps;
+  if (call_data.eps != -1) data->eps = call_data.eps;
+  for (const auto& p : call_data.request_cost) {
+    data->request_cost.insert_or_assign(p.first, p.second);
+  }
+  for (const auto& p : call_data.utilization) {
+    data->utilization.insert_or_assign(p.first, p.second);
+  }
+  for (const auto& p : call_data.named_metrics) {
+    data->named_metrics.insert_or_assign(p.first, p.second);
+  }
+}
 }  // namespace
 
 const grpc_channel_filter BackendMetricFilter::kFilter =
@@ -115,7 +148,8 @@ BackendMetricFilter::Create(const ChannelArgs&, ChannelFilter::Args) {
   return std::make_unique<BackendMetricFilter>();
 }
 
-void BackendMetricFilter::Call::OnServerTrailingMetadata(ServerMetadata& md) {
+void BackendMetricFilter::Call::OnServerTrailingMetadata(
+    ServerMetadata& md, BackendMetricFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "BackendMetricFilter::Call::OnServerTrailingMetadata");
   if (md.get(GrpcCallWasCancelled()).value_or(false)) return;
@@ -125,19 +159,70 @@ void BackendMetricFilter::Call::OnServerTrailingMetadata(ServerMetadata& md) {
         << "[" << this << "] No BackendMetricProvider.";
     return;
   }
-  std::optional<std::string> serialized = MaybeSerializeBackendMetrics(ctx);
-  if (serialized.has_value() && !serialized->empty()) {
+  BackendMetricData call_data;
+  std::shared_ptr<const BackendMetricData> shared_data =
+      ctx->GetSplitBackendMetricData(&call_data);
+  Slice serialized;
+  if (shared_data != nullptr && HasScalarMetrics(call_data)) {
+    // A per-call scalar that is zero would not override the shared one in
+    // a concatenation, so merge the metrics before serializing them.
+    BackendMetricData data = *shared_data;
+    MergeCallMetrics(call_data, &data);
+    serialized = Slice::FromCopiedString(SerializeBackendMetrics(data));
+  } else {
+    if (shared_data != nullptr) {
+      serialized = filter->SerializeSharedMetrics(std::move(shared_data));
+    }
+    // Per-call map entries are appended to the shared metrics, which they
+    // override.
+    std::string call_serialized = SerializeBackendMetrics(call_data);
+    if (call_serialized.empty()) {
+      // Nothing to append.
+    } else if (serialized.empty()) {
+      serialized = Slice::FromCopiedString(std::move(call_serialized));
+    } else {
+      auto joined = MutableSlice::CreateUninitialized(serialized.size() +
+                                                      call_serialized.size());
+      memcpy(joined.data(), serialized.data(), serialized.size());
+      memcpy(joined.data() + serialized.size(), call_serialized.data(),
+             call_serialized.size());
+      serialized = Slice(std::move(joined));
+    }
+  }
+  if (!serialized.empty()) {
     GRPC_TRACE_LOG(backend_metric_filter, INFO)
         << "[" << this
-        << "] Backend metrics serialized. size: " << serialized->size();
-    md.Set(EndpointLoadMetricsBinMetadata(),
-           Slice::FromCopiedString(std::move(*serialized)));
+        << "] Backend metrics serialized. size: " << serialized.size();
+    md.Set(EndpointLoadMetricsBinMetadata(), std::move(serialized));
   } else {
     GRPC_TRACE_LOG(backend_metric_filter, INFO)
         << "[" << this << "] No backend metrics.";
   }
 }
 
+Slice BackendMetricFilter::SerializeSharedMetrics(
+    std::shared_ptr<const BackendMetricData> data) {
+  std::optional<Slice> cached = serialized_shared_metrics_.Read(
+      [&](const std::shared_ptr<const SerializedMetrics>& current)
+          -> std::optional<Slice> {
+        if (current == nullptr || current->data != data) return std::nullopt;
+        return current->serialized.Ref();
+      });
+  if (cached.has_value()) return std::move(*cached);
+  auto serialized = std::make_shared<const SerializedMetrics>(
+      SerializedMetrics{data, Slice::FromCopiedString(
+                                  SerializeBackendMetrics(*data))});
+  Slice result = serialized->serialized.Ref();
+  std::shared_ptr<const SerializedMetrics> retired;
+  {
+    MutexLock lock(&mu_);
+    // Calls racing with an update may publish an older version, which just
+    // costs the next call another serialization.
+    retired = serialized_shared_metrics_.Exchange(std::move(serialized));
+  }
+  return result;
+}
+
 void RegisterBackendMetricFilter(CoreConfiguration::Builder* builder) {
   builder->channel_init()
       ->RegisterFilter<BackendMetricFilter>(GRPC_SERVER_CHANNEL)
@@ -17,16 +17,22 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <memory>
 #include <optional>
 #include <string>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/statusor.h"
 #include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/util/rcu.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -43,12 +49,30 @@ class BackendMetricFilter : public ImplementChannelFilter<BackendMetricFilter> {
    public:
     static inline const NoInterceptor OnClientInitialMetadata;
     static inline const NoInterceptor OnServerInitialMetadata;
-    void OnServerTrailingMetadata(ServerMetadata& md);
+    void OnServerTrailingMetadata(ServerMetadata& md,
+                                  BackendMetricFilter* filter);
     static inline const NoInterceptor OnClientToServerMessage;
     static inline const NoInterceptor OnClientToServerHalfClose;
     static inline const NoInterceptor OnServerToClientMessage;
     static inline const NoInterceptor OnFinalize;
   };
+
+ private:
+  struct SerializedMetrics {
+    // Holding the data keeps its address from being reused by a later
+    // version.
+    std::shared_ptr<const BackendMetricData> data;
+    Slice serialized;
+  };
+
+  // Returns the serialization of the metrics shared by all calls, which is
+  // only redone when they are replaced.
+  Slice SerializeSharedMetrics(std::shared_ptr<const BackendMetricData> data);
+
+  // Serializes the publication of serialized_shared_metrics_. Calls only
+  // take it when the shared metrics have been replaced.
+  Mutex mu_;
+  Rcu<std::shared_ptr<const SerializedMetrics>> serialized_shared_metrics_;
 };
 
 }  // namespace grpc_core
@@ -15,15 +15,27 @@
 #ifndef GRPC_SRC_CORE_EXT_FILTERS_BACKEND_METRICS_BACKEND_METRIC_PROVIDER_H
 #define GRPC_SRC_CORE_EXT_FILTERS_BACKEND_METRICS_BACKEND_METRIC_PROVIDER_H
 
+#include <memory>
+
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/load_balancing/backend_metric_data.h"
 
 namespace grpc_core {
 
-struct BackendMetricData;
 class BackendMetricProvider {
  public:
   virtual ~BackendMetricProvider() = default;
   virtual BackendMetricData GetBackendMetricData() = 0;
+  // Like GetBackendMetricData(), but returns the metrics shared by all calls
+  // on the server, if any, separately from the metrics recorded for this
+  // call, which are stored in *call_data and take precedence. The shared
+  // metrics are replaced by a new object whenever they change, so that their
+  // serialization can be cached.
+  virtual std::shared_ptr<const BackendMetricData> GetSplitBackendMetricData(
+      BackendMetricData* call_data) {
+    *call_data = GetBackendMetricData();
+    return nullptr;
+  }
 };
 
 template <>
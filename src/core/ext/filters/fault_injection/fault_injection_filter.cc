@@ -30,6 +30,8 @@
 
 #include "absl/log/log.h"
 #include "absl/meta/type_traits.h"
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/numbers.h"
@@ -41,6 +43,7 @@
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/metadata_batch.h"
@@ -64,14 +67,15 @@ auto AsInt(absl::string_view s) -> std::optional<T> {
   return std::nullopt;
 }
 
-inline bool UnderFraction(absl::InsecureBitGen* rand_generator,
-                          const uint32_t numerator,
+inline bool UnderFraction(const uint32_t numerator,
                           const uint32_t denominator) {
   if (numerator <= 0) return false;
   if (numerator >= denominator) return true;
+  // One generator per thread, so that concurrent calls do not contend.
+  thread_local absl::InsecureBitGen rand_generator;
   // Generate a random number in [0, denominator).
   const uint32_t random_number =
-      absl::Uniform(absl::IntervalClosedOpen, *rand_generator, 0u, denominator);
+      absl::Uniform(absl::IntervalClosedOpen, rand_generator, 0u, denominator);
   return random_number < numerator;
 }
 
@@ -112,6 +116,10 @@ class FaultInjectionFilter::InjectionDecision {
         delay_time_(delay_time),
         abort_request_(abort_request) {}
 
+  // Whether the call may be delayed or aborted at all.
+  bool active() const {
+    return delay_time_ != Duration::Zero() || abort_request_.has_value();
+  }
   std::string ToString() const;
   Timestamp DelayUntil();
   absl::Status MaybeAbort() const;
@@ -140,6 +148,7 @@ FaultInjectionFilter::FaultInjectionFilter(ChannelFilter::Args filter_args)
 ArenaPromise<absl::Status> FaultInjectionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, FaultInjectionFilter* filter) {
   auto decision = filter->MakeInjectionDecision(md);
+  if (!decision.active()) return ImmediateOkStatus();
   GRPC_TRACE_LOG(fault_injection_filter, INFO)
       << "chand=" << this << ": Fault injection triggered "
       << decision.ToString();
@@ -164,8 +173,9 @@ FaultInjectionFilter::MakeInjectionDecision(
     fi_policy = method_params->fault_injection_policy(index_);
   }
 
-  // Shouldn't ever be null, but just in case, return a no-op decision.
-  if (fi_policy == nullptr) {
+  // Shouldn't ever be null, but just in case, return a no-op decision. The
+  // same goes for a policy that can never inject a fault.
+  if (fi_policy == nullptr || !fi_policy->may_inject_faults) {
     return InjectionDecision(/*max_faults=*/0, /*delay_time=*/Duration::Zero(),
                              /*abort_request=*/std::nullopt);
   }
@@ -217,18 +227,13 @@ FaultInjectionFilter::MakeInjectionDecision(
   // Roll the dice
   bool delay_request = delay != Duration::Zero();
   bool abort_request = abort_code != GRPC_STATUS_OK;
-  if (delay_request || abort_request) {
-    MutexLock lock(&mu_);
-    if (delay_request) {
-      delay_request =
-          UnderFraction(&delay_rand_generator_, delay_percentage_numerator,
-                        fi_policy->delay_percentage_denominator);
-    }
-    if (abort_request) {
-      abort_request =
-          UnderFraction(&abort_rand_generator_, abort_percentage_numerator,
-                        fi_policy->abort_percentage_denominator);
-    }
+  if (delay_request) {
+    delay_request = UnderFraction(delay_percentage_numerator,
+                                  fi_policy->delay_percentage_denominator);
+  }
+  if (abort_request) {
+    abort_request = UnderFraction(abort_percentage_numerator,
+                                  fi_policy->abort_percentage_denominator);
   }
 
   return InjectionDecision(
@@ -77,6 +77,12 @@ void FaultInjectionMethodParsedConfig::FaultInjectionPolicy::JsonPostLoad(
     ValidationErrors::ScopedField field(errors, ".delayPercentageDenominator");
     errors->AddError("must be one of 100, 10000, or 1000000");
   }
+  const bool may_abort =
+      (abort_code != GRPC_STATUS_OK || !abort_code_header.empty()) &&
+      abort_percentage_numerator > 0;
+  const bool may_delay = (delay != Duration::Zero() || !delay_header.empty()) &&
+                         delay_percentage_numerator > 0;
+  may_inject_faults = may_abort || may_delay;
 }
 
 const JsonLoaderInterface* FaultInjectionMethodParsedConfig::JsonLoader(
@@ -63,6 +63,11 @@ class FaultInjectionMethodParsedConfig
     // By default, the max allowed active faults are unlimited.
     uint32_t max_faults = std::numeric_limits<uint32_t>::max();
 
+    // Precomputed at parse time: false if no call can be delayed or aborted,
+    // whatever its headers say, so that the filter can skip the call.
+    // Header values only ever lower the configured percentages.
+    bool may_inject_faults = false;
+
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json& json, const JsonArgs&,
                       ValidationErrors* errors);
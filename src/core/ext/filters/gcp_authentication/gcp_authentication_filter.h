@@ -33,7 +33,6 @@
 #include "src/core/resolver/xds/xds_config.h"
 #include "src/core/util/lru_cache.h"
 #include "src/core/util/ref_counted_ptr.h"
-#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -73,9 +72,9 @@ class GcpAuthenticationFilter
     RefCountedPtr<grpc_call_credentials> Get(const std::string& audience);
 
    private:
-    Mutex mu_;
-    LruCache<std::string /*audience*/, RefCountedPtr<grpc_call_credentials>>
-        cache_ ABSL_GUARDED_BY(&mu_);
+    ShardedLruCache<std::string /*audience*/,
+                    RefCountedPtr<grpc_call_credentials>>
+        cache_;
   };
 
   GcpAuthenticationFilter(
@@ -19,6 +19,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "absl/strings/match.h"
+#include "src/core/call/filter_fusion.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/filters/http/client/http_client_filter.h"
 #include "src/core/ext/filters/http/message_compress/compression_filter.h"
@@ -27,10 +28,15 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/lib/transport/interception_chain.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/unique_type_name.h"
 
 namespace grpc_core {
 namespace {
+using HttpClientFusedFilter =
+    FusedFilter<HttpClientFilter, ClientCompressionFilter>;
+
 bool IsBuildingHttpLikeTransport(const ChannelArgs& args) {
   auto* t = args.GetObject<Transport>();
   return t != nullptr && absl::StrContains(t->GetTransportName(), "http");
@@ -38,29 +44,36 @@ bool IsBuildingHttpLikeTransport(const ChannelArgs& args) {
 }  // namespace
 
 void RegisterHttpFilters(CoreConfiguration::Builder* builder) {
-  builder->channel_init()
-      ->RegisterFilter<ClientCompressionFilter>(GRPC_CLIENT_SUBCHANNEL)
-      .If(IsBuildingHttpLikeTransport)
-      .After<HttpClientFilter>()
-      .After<ClientMessageSizeFilter>();
-  builder->channel_init()
-      ->RegisterFilter<ClientCompressionFilter>(GRPC_CLIENT_DIRECT_CHANNEL)
-      .If(IsBuildingHttpLikeTransport)
-      .After<HttpClientFilter>()
-      .After<ClientMessageSizeFilter>();
+  // The v3 stack runs the client filters as one, since none of their
+  // interceptors suspend.
+  for (grpc_channel_stack_type type :
+       {GRPC_CLIENT_SUBCHANNEL, GRPC_CLIENT_DIRECT_CHANNEL}) {
+    builder->channel_init()
+        ->RegisterFilter<ClientCompressionFilter>(type)
+        .If(IsBuildingHttpLikeTransport)
+        .After<HttpClientFilter>()
+        .After<ClientMessageSizeFilter>()
+        .SkipV3();
+    builder->channel_init()
+        ->RegisterFilter<HttpClientFilter>(type)
+        .If(IsBuildingHttpLikeTransport)
+        .After<ClientMessageSizeFilter>()
+        .SkipV3();
+    builder->channel_init()
+        ->RegisterFilter(type, UniqueTypeNameFor<HttpClientFusedFilter>(),
+                         nullptr,
+                         [](InterceptionChainBuilder& chain) {
+                           chain.Add<HttpClientFusedFilter>();
+                         })
+        .If(IsBuildingHttpLikeTransport)
+        .After<ClientMessageSizeFilter>()
+        .SkipV2();
+  }
   builder->channel_init()
       ->RegisterFilter<ServerCompressionFilter>(GRPC_SERVER_CHANNEL)
       .If(IsBuildingHttpLikeTransport)
       .After<HttpServerFilter>()
       .After<ServerMessageSizeFilter>();
-  builder->channel_init()
-      ->RegisterFilter<HttpClientFilter>(GRPC_CLIENT_SUBCHANNEL)
-      .If(IsBuildingHttpLikeTransport)
-      .After<ClientMessageSizeFilter>();
-  builder->channel_init()
-      ->RegisterFilter<HttpClientFilter>(GRPC_CLIENT_DIRECT_CHANNEL)
-      .If(IsBuildingHttpLikeTransport)
-      .After<ClientMessageSizeFilter>();
   builder->channel_init()
       ->RegisterFilter<HttpServerFilter>(GRPC_SERVER_CHANNEL)
       .If(IsBuildingHttpLikeTransport)
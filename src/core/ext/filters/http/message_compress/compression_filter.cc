@@ -21,21 +21,26 @@
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <utility>
 
 #include "absl/log/check.h"
+#include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
 #include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/compression/zstd_dictionary.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
@@ -73,6 +78,30 @@ ServerCompressionFilter::Create(const ChannelArgs& args, ChannelFilter::Args) {
   return std::make_unique<ServerCompressionFilter>(args);
 }
 
+namespace {
+
+// Adaptive compression sends messages that sample as more random than this,
+// in bits per byte, uncompressed. Deflate, zstd and lz4 all save little once
+// a sample gets close to the 8 bits of random data.
+constexpr double kAdaptiveMaxEntropy = 7.5;
+// After kAdaptivePoorResults messages in a row that do not save at least
+// kAdaptiveMinSavings of their size, adaptive compression stops compressing
+// the messages of the call, trying again every kAdaptiveRetryInterval.
+constexpr double kAdaptiveMinSavings = 0.1;
+constexpr uint8_t kAdaptivePoorResults = 3;
+constexpr uint8_t kAdaptiveRetryInterval = 16;
+// Calls started with the CPU busier than this compress at the lowest level.
+constexpr double kAdaptiveMaxCpuUtilization = 0.8;
+
+grpc_compression_level DefaultCompressionLevelFromChannelArgs(
+    const ChannelArgs& args) {
+  grpc_compression_options options = CompressionOptionsFromChannelArgs(args);
+  return options.default_level.is_set ? options.default_level.level
+                                      : GRPC_COMPRESS_LEVEL_MED;
+}
+
+}  // namespace
+
 ChannelCompression::ChannelCompression(const ChannelArgs& args)
     : max_recv_size_(GetMaxRecvSizeFromChannelArgs(args)),
       message_size_service_config_parser_index_(
@@ -82,11 +111,40 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
               GRPC_COMPRESS_NONE)),
       enabled_compression_algorithms_(
           CompressionAlgorithmSet::FromChannelArgs(args)),
+      compression_level_(DefaultCompressionLevelFromChannelArgs(args)),
+      adaptive_(args.GetBool(GRPC_ARG_ADAPTIVE_COMPRESSION).value_or(false)),
+      adaptive_min_message_size_(std::max(
+          0,
+          args.GetInt(GRPC_ARG_ADAPTIVE_COMPRESSION_MIN_MESSAGE_SIZE)
+              .value_or(512))),
+      cpu_utilization_source_(
+          adaptive_ ? args.GetObjectRef<CpuUtilizationSource>() : nullptr),
+      parallel_min_message_size_(std::max(
+          0, args.GetInt(GRPC_ARG_PARALLEL_COMPRESSION_MIN_MESSAGE_SIZE)
+                 .value_or(0))),
+      event_engine_(
+          parallel_min_message_size_ == 0
+              ? nullptr
+              : args.GetObjectRef<
+                    grpc_event_engine::experimental::EventEngine>()),
       enable_compression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
               .value_or(true)) {
+  if (enabled_compression_algorithms_.IsSet(GRPC_COMPRESS_ZSTD)) {
+    accepted_zstd_dictionaries_ = RegisteredZstdDictionaryIds();
+    auto dictionary_id = args.GetString(GRPC_ARG_ZSTD_COMPRESSION_DICTIONARY);
+    if (dictionary_id.has_value()) {
+      zstd_dictionary_ = FindZstdDictionary(*dictionary_id);
+      if (zstd_dictionary_ == nullptr) {
+        LOG(ERROR) << "zstd compression dictionary " << *dictionary_id
+                   << " not registered: compressing without it";
+      } else {
+        zstd_dictionary_id_ = Slice::FromCopiedString(*dictionary_id);
+      }
+    }
+  }
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
@@ -100,9 +158,27 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
   }
 }
 
+bool ChannelCompression::ShouldCompressAdaptively(SliceBuffer* payload,
+                                                  CompressArgs& args) const {
+  if (payload->Length() < adaptive_min_message_size_) return false;
+  if (args.poorly_compressed >= kAdaptivePoorResults) {
+    if (++args.skipped < kAdaptiveRetryInterval) return false;
+    args.skipped = 0;
+  }
+  if (grpc_msg_sample_entropy(payload->c_slice_buffer()) >
+      kAdaptiveMaxEntropy) {
+    GRPC_TRACE_LOG(compression, INFO)
+        << "Adaptive compression: skipping incompressible message of "
+        << payload->Length() << " bytes";
+    return false;
+  }
+  return true;
+}
+
 MessageHandle ChannelCompression::CompressMessage(
-    MessageHandle message, grpc_compression_algorithm algorithm,
+    MessageHandle message, CompressArgs& args,
     CallTracerInterface* call_tracer) const {
+  const grpc_compression_algorithm algorithm = args.algorithm;
   GRPC_TRACE_LOG(compression, INFO)
       << "CompressMessage: len=" << message->payload()->Length()
       << " alg=" << algorithm << " flags=" << message->flags();
@@ -117,11 +193,34 @@ MessageHandle ChannelCompression::CompressMessage(
       (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
     return message;
   }
+  SliceBuffer* payload = message->payload();
+  if (adaptive_ && !ShouldCompressAdaptively(payload, args)) return message;
   // Try to compress the payload.
   SliceBuffer tmp;
-  SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  bool did_compress;
+  if (args.zstd_dictionary != nullptr) {
+    did_compress = grpc_msg_compress_zstd_with_dictionary(
+        *args.zstd_dictionary, args.level, payload->c_slice_buffer(),
+        tmp.c_slice_buffer());
+  } else if (event_engine_ != nullptr &&
+             payload->Length() >= parallel_min_message_size_) {
+    did_compress = grpc_msg_compress_parallel(
+        algorithm, args.level, payload->c_slice_buffer(), tmp.c_slice_buffer(),
+        event_engine_.get());
+  } else {
+    did_compress = grpc_msg_compress_with_level(algorithm, args.level,
+                                                payload->c_slice_buffer(),
+                                                tmp.c_slice_buffer());
+  }
+  if (adaptive_) {
+    if (!did_compress ||
+        tmp.Length() > payload->Length() * (1 - kAdaptiveMinSavings)) {
+      args.poorly_compressed =
+          std::min<uint8_t>(args.poorly_compressed + 1, kAdaptivePoorResults);
+    } else {
+      args.poorly_compressed = 0;
+    }
+  }
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -179,10 +278,36 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
       (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) == 0) {
     return std::move(message);
   }
-  // Try to decompress the payload.
+  // Try to decompress the payload, within the same limit, so that a small
+  // message cannot inflate to any size.
+  const size_t max_length =
+      args.max_recv_message_length.has_value()
+          ? static_cast<size_t>(*args.max_recv_message_length)
+          : SIZE_MAX;
   SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  grpc_slice_buffer* payload = message->payload()->c_slice_buffer();
+  int did_decompress;
+  if (args.algorithm == GRPC_COMPRESS_ZSTD && args.zstd_dictionary != nullptr) {
+    did_decompress = grpc_msg_decompress_zstd_with_dictionary(
+        *args.zstd_dictionary, payload, decompressed_slices.c_slice_buffer(),
+        max_length);
+  } else if (event_engine_ != nullptr &&
+             payload->length >= parallel_min_message_size_) {
+    did_decompress = grpc_msg_decompress_parallel(
+        args.algorithm, payload, decompressed_slices.c_slice_buffer(),
+        max_length, event_engine_.get());
+  } else {
+    did_decompress = grpc_msg_decompress_with_limit(
+        args.algorithm, payload, decompressed_slices.c_slice_buffer(),
+        max_length);
+  }
+  if (did_decompress == -1) {
+    return absl::ResourceExhaustedError(absl::StrFormat(
+        "%s: Received message larger than max when decompressed (more than "
+        "%d)",
+        is_client ? "CLIENT" : "SERVER", *args.max_recv_message_length));
+  }
+  if (did_decompress == 0) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
                      CompressionAlgorithmAsString(args.algorithm)));
@@ -197,17 +322,47 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
   return std::move(message);
 }
 
-grpc_compression_algorithm ChannelCompression::HandleOutgoingMetadata(
-    grpc_metadata_batch& outgoing_metadata) {
+ChannelCompression::CompressArgs ChannelCompression::HandleOutgoingMetadata(
+    grpc_metadata_batch& outgoing_metadata, bool peer_accepts_zstd_dictionary) {
   const auto algorithm = outgoing_metadata.Take(GrpcInternalEncodingRequest())
                              .value_or(default_compression_algorithm());
   // Convey supported compression algorithms.
   outgoing_metadata.Set(GrpcAcceptEncodingMetadata(),
                         enabled_compression_algorithms());
+  if (!accepted_zstd_dictionaries_.empty()) {
+    outgoing_metadata.Set(GrpcAcceptZstdDictionaryMetadata(),
+                          accepted_zstd_dictionaries_.Ref());
+  }
+  CompressArgs args{algorithm};
+  args.level = compression_level_;
   if (algorithm != GRPC_COMPRESS_NONE) {
+    if (cpu_utilization_source_ != nullptr &&
+        cpu_utilization_source_->CpuUtilization() >
+            kAdaptiveMaxCpuUtilization) {
+      args.level = GRPC_COMPRESS_LEVEL_LOW;
+    }
     outgoing_metadata.Set(GrpcEncodingMetadata(), algorithm);
+    if (algorithm == GRPC_COMPRESS_ZSTD && zstd_dictionary_ != nullptr &&
+        peer_accepts_zstd_dictionary) {
+      outgoing_metadata.Set(GrpcZstdDictionaryMetadata(),
+                            zstd_dictionary_id_.Ref());
+      args.zstd_dictionary = zstd_dictionary_.get();
+    }
   }
-  return algorithm;
+  return args;
+}
+
+bool ChannelCompression::PeerAcceptsZstdDictionary(
+    const grpc_metadata_batch& incoming_metadata) const {
+  if (zstd_dictionary_ == nullptr) return false;
+  const Slice* accepted =
+      incoming_metadata.get_pointer(GrpcAcceptZstdDictionaryMetadata());
+  if (accepted == nullptr) return false;
+  for (absl::string_view id :
+       absl::StrSplit(accepted->as_string_view(), ',')) {
+    if (absl::StripAsciiWhitespace(id) == zstd_dictionary_->id()) return true;
+  }
+  return false;
 }
 
 ChannelCompression::DecompressArgs ChannelCompression::HandleIncomingMetadata(
@@ -222,17 +377,29 @@ ChannelCompression::DecompressArgs ChannelCompression::HandleIncomingMetadata(
        *limits->max_recv_size() < *max_recv_message_length)) {
     max_recv_message_length = limits->max_recv_size();
   }
-  return DecompressArgs{incoming_metadata.get(GrpcEncodingMetadata())
-                            .value_or(GRPC_COMPRESS_NONE),
-                        max_recv_message_length};
+  DecompressArgs args{incoming_metadata.get(GrpcEncodingMetadata())
+                          .value_or(GRPC_COMPRESS_NONE),
+                      max_recv_message_length};
+  const Slice* dictionary_id =
+      incoming_metadata.get_pointer(GrpcZstdDictionaryMetadata());
+  if (dictionary_id != nullptr && args.algorithm == GRPC_COMPRESS_ZSTD) {
+    // Without it, the messages of the call fail to decompress.
+    args.zstd_dictionary = FindZstdDictionary(dictionary_id->as_string_view());
+    if (args.zstd_dictionary == nullptr) {
+      LOG_EVERY_N_SEC(ERROR, 10)
+          << "peer compresses with unknown zstd dictionary "
+          << dictionary_id->as_string_view();
+    }
+  }
+  return args;
 }
 
 void ClientCompressionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnClientInitialMetadata");
-  compression_algorithm_ =
-      filter->compression_engine_.HandleOutgoingMetadata(md);
+  compress_args_ = filter->compression_engine_.HandleOutgoingMetadata(
+      md, filter->compression_engine_.server_accepts_zstd_dictionary());
   call_tracer_ = MaybeGetContext<CallTracerInterface>();
 }
 
@@ -241,7 +408,7 @@ MessageHandle ClientCompressionFilter::Call::OnClientToServerMessage(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnClientToServerMessage");
   return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_, call_tracer_);
+      std::move(message), compress_args_, call_tracer_);
 }
 
 void ClientCompressionFilter::Call::OnServerInitialMetadata(
@@ -249,6 +416,9 @@ void ClientCompressionFilter::Call::OnServerInitialMetadata(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnServerInitialMetadata");
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  // Later calls on the channel use the dictionary if this server has it.
+  filter->compression_engine_.set_server_accepts_zstd_dictionary(
+      filter->compression_engine_.PeerAcceptsZstdDictionary(md));
 }
 
 absl::StatusOr<MessageHandle>
@@ -265,6 +435,8 @@ void ServerCompressionFilter::Call::OnClientInitialMetadata(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnClientInitialMetadata");
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  client_accepts_zstd_dictionary_ =
+      filter->compression_engine_.PeerAcceptsZstdDictionary(md);
 }
 
 absl::StatusOr<MessageHandle>
@@ -281,8 +453,8 @@ void ServerCompressionFilter::Call::OnServerInitialMetadata(
     ServerMetadata& md, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnServerInitialMetadata");
-  compression_algorithm_ =
-      filter->compression_engine_.HandleOutgoingMetadata(md);
+  compress_args_ = filter->compression_engine_.HandleOutgoingMetadata(
+      md, client_accepts_zstd_dictionary_);
 }
 
 MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
@@ -290,7 +462,7 @@ MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnServerToClientMessage");
   return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_,
+      std::move(message), compress_args_,
       MaybeGetContext<CallTracerInterface>());
 }
 
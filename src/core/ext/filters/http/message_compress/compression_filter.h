@@ -19,11 +19,14 @@
 #ifndef GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_COMPRESSION_FILTER_H
 #define GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_COMPRESSION_FILTER_H
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
+#include <memory>
 #include <optional>
 
 #include "absl/status/statusor.h"
@@ -32,9 +35,14 @@
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/zstd_dictionary.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/resource_quota/connection_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted_ptr.h"
 
 namespace grpc_core {
 
@@ -59,14 +67,41 @@ namespace grpc_core {
 /// to incorporate GRPC_WRITE_INTERNAL_COMPRESS. Otherwise, and regardless of
 /// the aforementioned 'grpc-encoding' metadata value, data will pass through
 /// uncompressed.
+///
+/// Messages compressed with zstd are compressed against the dictionary named
+/// by GRPC_ARG_ZSTD_COMPRESSION_DICTIONARY once the peer has advertised it
+/// (see zstd_dictionary.h).
+///
+/// With GRPC_ARG_ADAPTIVE_COMPRESSION set, messages that are small, look
+/// incompressible, or belong to calls whose previous messages did not
+/// compress well are sent uncompressed, and calls started while the server
+/// is short of CPU compress at the lowest level.
+///
+/// With GRPC_ARG_PARALLEL_COMPRESSION_MIN_MESSAGE_SIZE set, large messages are
+/// compressed in blocks in parallel on the EventEngine threads.
 
 class ChannelCompression {
  public:
   explicit ChannelCompression(const ChannelArgs& args);
 
+  struct CompressArgs {
+    grpc_compression_algorithm algorithm;
+    // If set, messages compressed with zstd are compressed against it.
+    const ZstdDictionary* zstd_dictionary = nullptr;
+    grpc_compression_level level = GRPC_COMPRESS_LEVEL_MED;
+    // For adaptive compression: the number of messages in a row that did not
+    // compress well, and the number skipped since, to try again once in a
+    // while in case the payloads change.
+    uint8_t poorly_compressed = 0;
+    uint8_t skipped = 0;
+  };
+
   struct DecompressArgs {
     grpc_compression_algorithm algorithm;
     std::optional<uint32_t> max_recv_message_length;
+    // The dictionary that messages compressed with zstd are compressed
+    // against, if the peer named one.
+    RefCountedPtr<ZstdDictionary> zstd_dictionary;
   };
 
   grpc_compression_algorithm default_compression_algorithm() const {
@@ -77,14 +112,30 @@ class ChannelCompression {
     return enabled_compression_algorithms_;
   }
 
-  grpc_compression_algorithm HandleOutgoingMetadata(
-      grpc_metadata_batch& outgoing_metadata);
+  // \a peer_accepts_zstd_dictionary tells whether the peer has advertised the
+  // dictionary of the channel.
+  CompressArgs HandleOutgoingMetadata(grpc_metadata_batch& outgoing_metadata,
+                                      bool peer_accepts_zstd_dictionary);
   DecompressArgs HandleIncomingMetadata(
       const grpc_metadata_batch& incoming_metadata);
 
-  // Compress one message synchronously.
-  MessageHandle CompressMessage(MessageHandle message,
-                                grpc_compression_algorithm algorithm,
+  // Returns true if \a incoming_metadata advertises the dictionary of the
+  // channel.
+  bool PeerAcceptsZstdDictionary(
+      const grpc_metadata_batch& incoming_metadata) const;
+
+  // What the server of a client channel last advertised, for the calls that
+  // start before its response.
+  bool server_accepts_zstd_dictionary() const {
+    return server_accepts_zstd_dictionary_.load(std::memory_order_relaxed);
+  }
+  void set_server_accepts_zstd_dictionary(bool accepts) {
+    server_accepts_zstd_dictionary_.store(accepts, std::memory_order_relaxed);
+  }
+
+  // Compress one message synchronously. \a args carries what adaptive
+  // compression learns from one message of the call to the next.
+  MessageHandle CompressMessage(MessageHandle message, CompressArgs& args,
                                 CallTracerInterface* call_tracer) const;
   // Decompress one message synchronously.
   absl::StatusOr<MessageHandle> DecompressMessage(
@@ -92,6 +143,9 @@ class ChannelCompression {
       CallTracerInterface* call_tracer) const;
 
  private:
+  // For adaptive compression, whether compressing \a payload is worthwhile.
+  bool ShouldCompressAdaptively(SliceBuffer* payload, CompressArgs& args) const;
+
   // Max receive message length, if set.
   std::optional<uint32_t> max_recv_size_;
   size_t message_size_service_config_parser_index_;
@@ -99,6 +153,23 @@ class ChannelCompression {
   grpc_compression_algorithm default_compression_algorithm_;
   // Enabled compression algorithms.
   CompressionAlgorithmSet enabled_compression_algorithms_;
+  // The effort to compress with, for the algorithms that have several levels.
+  grpc_compression_level compression_level_;
+  // The dictionary to compress with zstd against, if any, and its id.
+  RefCountedPtr<ZstdDictionary> zstd_dictionary_;
+  Slice zstd_dictionary_id_;
+  // The ids of the dictionaries to advertise, or empty.
+  Slice accepted_zstd_dictionaries_;
+  std::atomic<bool> server_accepts_zstd_dictionary_{false};
+  // Set for GRPC_ARG_ADAPTIVE_COMPRESSION.
+  bool adaptive_;
+  size_t adaptive_min_message_size_;
+  // Where adaptive compression learns how busy the CPU is, if anywhere.
+  RefCountedPtr<CpuUtilizationSource> cpu_utilization_source_;
+  // Messages from this size are compressed and decompressed in parallel on
+  // event_engine_, if it is set.
+  size_t parallel_min_message_size_;
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
   // Is compression enabled?
   bool enable_compression_;
   // Is decompression enabled?
@@ -136,7 +207,7 @@ class ClientCompressionFilter final
     static inline const NoInterceptor OnFinalize;
 
    private:
-    grpc_compression_algorithm compression_algorithm_;
+    ChannelCompression::CompressArgs compress_args_;
     ChannelCompression::DecompressArgs decompress_args_;
     // TODO(yashykt): Remove call_tracer_ after migration to call v3 stack. (See
     // https://github.com/grpc/grpc/pull/38729 for more information.)
@@ -179,7 +250,8 @@ class ServerCompressionFilter final
 
    private:
     ChannelCompression::DecompressArgs decompress_args_;
-    grpc_compression_algorithm compression_algorithm_;
+    ChannelCompression::CompressArgs compress_args_;
+    bool client_accepts_zstd_dictionary_ = false;
   };
 
  private:
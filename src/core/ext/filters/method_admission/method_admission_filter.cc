@@ -0,0 +1,78 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/method_admission/method_admission_filter.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/util/latent_see.h"
+
+namespace grpc_core {
+
+namespace {
+ResourceQuotaRefPtr ResourceQuotaFromChannelArgs(const ChannelArgs& args) {
+  auto resource_quota = args.GetObjectRef<ResourceQuota>();
+  if (resource_quota == nullptr) return ResourceQuota::Default();
+  return resource_quota;
+}
+
+bool HasMethodBudgets(const ChannelArgs& args) {
+  return ResourceQuotaFromChannelArgs(args)->method_quotas()->has_budgets();
+}
+}  // namespace
+
+const grpc_channel_filter MethodAdmissionFilter::kFilter =
+    MakePromiseBasedFilter<MethodAdmissionFilter, FilterEndpoint::kServer>();
+
+absl::StatusOr<std::unique_ptr<MethodAdmissionFilter>>
+MethodAdmissionFilter::Create(const ChannelArgs& args, ChannelFilter::Args) {
+  auto resource_quota = ResourceQuotaFromChannelArgs(args);
+  return std::make_unique<MethodAdmissionFilter>(
+      resource_quota->memory_quota(), resource_quota->method_quotas());
+}
+
+absl::Status MethodAdmissionFilter::Call::OnClientInitialMetadata(
+    ClientMetadata& md, MethodAdmissionFilter* filter) {
+  GRPC_LATENT_SEE_INNER_SCOPE(
+      "MethodAdmissionFilter::Call::OnClientInitialMetadata");
+  const Slice* path = md.get_pointer(HttpPathMetadata());
+  if (path == nullptr) return absl::OkStatus();
+  auto admission = filter->method_quotas_->Admit(
+      path->as_string_view(), filter->memory_quota_->GetPressure());
+  if (!admission.ok()) return admission.status();
+  arena_ = GetContext<Arena>();
+  admission_ = std::move(*admission);
+  return absl::OkStatus();
+}
+
+void MethodAdmissionFilter::Call::OnFinalize(const grpc_call_final_info*) {
+  if (arena_ == nullptr) return;
+  admission_.ReportUsage(arena_->TotalUsedBytes());
+}
+
+void RegisterMethodAdmissionFilter(CoreConfiguration::Builder* builder) {
+  builder->channel_init()
+      ->RegisterFilter<MethodAdmissionFilter>(GRPC_SERVER_CHANNEL)
+      .ExcludeFromMinimalStack()
+      .If(HasMethodBudgets);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,80 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_METHOD_ADMISSION_METHOD_ADMISSION_FILTER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_METHOD_ADMISSION_METHOD_ADMISSION_FILTER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/method_quota.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+// Admits or rejects calls against the per-method budgets of the server's
+// resource quota as soon as their initial metadata arrives.
+// Only installed if budgets were set before the server was started.
+class MethodAdmissionFilter final
+    : public ImplementChannelFilter<MethodAdmissionFilter> {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::string_view TypeName() { return "method_admission"; }
+
+  static absl::StatusOr<std::unique_ptr<MethodAdmissionFilter>> Create(
+      const ChannelArgs& args, ChannelFilter::Args filter_args);
+
+  MethodAdmissionFilter(MemoryQuotaRefPtr memory_quota,
+                        RefCountedPtr<MethodQuotas> method_quotas)
+      : memory_quota_(std::move(memory_quota)),
+        method_quotas_(std::move(method_quotas)) {}
+
+  class Call {
+   public:
+    absl::Status OnClientInitialMetadata(ClientMetadata& md,
+                                         MethodAdmissionFilter* filter);
+    static inline const NoInterceptor OnServerInitialMetadata;
+    static inline const NoInterceptor OnServerTrailingMetadata;
+    static inline const NoInterceptor OnClientToServerMessage;
+    static inline const NoInterceptor OnClientToServerHalfClose;
+    static inline const NoInterceptor OnServerToClientMessage;
+    void OnFinalize(const grpc_call_final_info*);
+
+   private:
+    Arena* arena_ = nullptr;
+    MethodQuotas::Admission admission_;
+  };
+
+ private:
+  const MemoryQuotaRefPtr memory_quota_;
+  const RefCountedPtr<MethodQuotas> method_quotas_;
+};
+
+void RegisterMethodAdmissionFilter(CoreConfiguration::Builder* builder);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_METHOD_ADMISSION_METHOD_ADMISSION_FILTER_H
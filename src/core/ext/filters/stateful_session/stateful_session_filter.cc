@@ -161,25 +161,21 @@ absl::string_view GetClusterToUse(
   return absl::StripPrefix(arena_allocated_cluster, kClusterPrefix);
 }
 
-std::string GetCookieValue(const ClientMetadata& client_initial_metadata,
-                           absl::string_view cookie_name) {
+// Returns the still-encoded value of the cookie, which points into either
+// the metadata or buffer.
+absl::string_view GetCookieValue(const ClientMetadata& client_initial_metadata,
+                                 absl::string_view cookie_name,
+                                 std::string* buffer) {
   // Check to see if the cookie header is present.
-  std::string buffer;
-  auto header_value = client_initial_metadata.GetStringValue("cookie", &buffer);
+  auto header_value = client_initial_metadata.GetStringValue("cookie", buffer);
   if (!header_value.has_value()) return "";
   // Parse cookie header.
-  std::vector<absl::string_view> values;
+  // TODO(roth): Figure out the right behavior for multiple cookies.
+  // For now, just choose the first value.
   for (absl::string_view cookie : absl::StrSplit(*header_value, "; ")) {
     std::pair<absl::string_view, absl::string_view> kv =
         absl::StrSplit(cookie, absl::MaxSplits('=', 1));
-    if (kv.first == cookie_name) values.push_back(kv.second);
-  }
-  if (values.empty()) return "";
-  // TODO(roth): Figure out the right behavior for multiple cookies.
-  // For now, just choose the first value.
-  std::string decoded;
-  if (absl::Base64Unescape(values.front(), &decoded)) {
-    return decoded;
+    if (kv.first == cookie_name) return kv.second;
   }
   return "";
 }
@@ -209,8 +205,31 @@ bool IsConfiguredPath(absl::string_view configured_path,
   return path.length() == configured_path.length() ||
          configured_path.back() == '/' || path[configured_path.length()] == '/';
 }
+// Maximum number of decoded cookie values cached per shard.  The shard is
+// cleared when it fills up.
+constexpr size_t kMaxCachedCookiesPerShard = 256;
+
 }  // namespace
 
+absl::string_view StatefulSessionFilter::DecodeCookieValue(
+    absl::string_view encoded_value) {
+  if (encoded_value.empty()) return absl::string_view();
+  CookieCacheShard& shard = cookie_cache_.this_cpu();
+  MutexLock lock(&shard.mu);
+  auto it = shard.decoded_values.find(encoded_value);
+  if (it == shard.decoded_values.end()) {
+    std::string decoded;
+    // Invalid values are cached as empty strings.
+    if (!absl::Base64Unescape(encoded_value, &decoded)) decoded.clear();
+    if (shard.decoded_values.size() >= kMaxCachedCookiesPerShard) {
+      shard.decoded_values.clear();
+    }
+    it = shard.decoded_values.emplace(encoded_value, std::move(decoded)).first;
+  }
+  // Copy the value to the arena, so that it has the right lifetime.
+  return AllocateStringOnArena(it->second);
+}
+
 void StatefulSessionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, StatefulSessionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
@@ -229,14 +248,14 @@ void StatefulSessionFilter::Call::OnClientInitialMetadata(
     return;
   }
   // Base64-decode cookie value.
-  std::string cookie_value = GetCookieValue(md, *cookie_config_->name);
+  std::string buffer;
+  absl::string_view cookie_value = filter->DecodeCookieValue(
+      GetCookieValue(md, *cookie_config_->name, &buffer));
   // Cookie format is "host;cluster"
   std::pair<absl::string_view, absl::string_view> host_cluster =
       absl::StrSplit(cookie_value, absl::MaxSplits(';', 1));
-  // Allocate the string on the arena, so that it has the right lifetime.
-  if (!host_cluster.first.empty()) {
-    cookie_address_list_ = AllocateStringOnArena(host_cluster.first);
-  }
+  // The decoded value is on the arena, so it lives as long as the call.
+  if (!host_cluster.first.empty()) cookie_address_list_ = host_cluster.first;
   // Set override host attribute.
   override_host_attribute_ =
       GetContext<Arena>()->ManagedNew<XdsOverrideHostAttribute>(
@@ -20,8 +20,11 @@
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
+#include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "src/core/ext/filters/stateful_session/stateful_session_service_config_parser.h"
@@ -31,7 +34,9 @@
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/service_config/service_config_call_data.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted_string.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/unique_type_name.h"
 
 namespace grpc_core {
@@ -100,10 +105,25 @@ class StatefulSessionFilter
   };
 
  private:
+  // Decoded cookie values, keyed by their base64 encoding.  Session
+  // affinity sends the same few cookies over and over, so this saves
+  // decoding them on every call.  Sharded per CPU to keep calls on
+  // different CPUs from contending.
+  struct alignas(GPR_CACHELINE_SIZE) CookieCacheShard {
+    Mutex mu;
+    absl::flat_hash_map<std::string, std::string> decoded_values
+        ABSL_GUARDED_BY(mu);
+  };
+
+  // Returns the decoded cookie value, allocated on the call's arena, or an
+  // empty string if the value is not valid base64.
+  absl::string_view DecodeCookieValue(absl::string_view encoded_value);
+
   // The relative index of instances of the same filter.
   const size_t index_;
   // Index of the service config parser.
   const size_t service_config_parser_index_;
+  PerCpu<CookieCacheShard> cookie_cache_{PerCpuOptions().SetMaxShards(16)};
 };
 
 }  // namespace grpc_core
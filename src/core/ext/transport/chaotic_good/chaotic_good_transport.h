@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/strings/escaping.h"
 #include "src/core/ext/transport/chaotic_good/control_endpoint.h"
@@ -38,6 +39,7 @@
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/call_spine.h"
 #include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/util/match.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -84,6 +86,26 @@ class IncomingFrame {
   size_t remove_padding_;
 };
 
+// Outgoing frames are charged against the outgoing frame queue by the bytes
+// they will put on the wire, so that a few large messages get the same
+// backpressure as many small ones.
+template <typename Frame>
+uint64_t OutgoingFrameBytes(const Frame& frame) {
+  return FrameHeader::kFrameHeaderSize +
+         Match(
+             frame,
+             [](const MessageFrame& frame) -> uint64_t {
+               return frame.message->payload()->Length();
+             },
+             [](const MessageChunkFrame& frame) -> uint64_t {
+               return frame.payload.Length();
+             },
+             [](const auto&) -> uint64_t { return 0; });
+}
+
+// Bytes to buffer in the outgoing frame queue of a transport.
+inline constexpr size_t kOutgoingFrameQueueBytes = 1024 * 1024;
+
 class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
  public:
   struct Options {
@@ -155,12 +177,17 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
   auto TransportWriteLoop(MpscReceiver<Frame>& outgoing_frames) {
     return Loop([self = Ref(), &outgoing_frames] {
       return TrySeq(
-          // Get next outgoing frame.
-          outgoing_frames.Next(),
-          // Serialize and write it out.
-          [self = self.get()](Frame client_frame) {
-            return self->WriteFrame(
-                absl::ConvertVariantTo<FrameInterface&>(client_frame));
+          // Get every outgoing frame that's ready.
+          outgoing_frames.NextBatch(),
+          // Serialize and write them out: the control endpoint coalesces the
+          // writes of the whole batch.
+          [self = self.get()](std::vector<Frame> frames) {
+            return TrySeqContainer(
+                std::move(frames), Empty{},
+                [self](Frame& frame, Empty) {
+                  return self->WriteFrame(
+                      absl::ConvertVariantTo<FrameInterface&>(frame));
+                });
           },
           []() -> LoopCtl<absl::Status> {
             // The write failures will be caught in TrySeq and exit loop.
@@ -247,6 +274,21 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
 };
 
 }  // namespace chaotic_good
+
+template <>
+struct MpscTokens<chaotic_good::ClientFrame> {
+  static uint64_t Of(const chaotic_good::ClientFrame& frame) {
+    return chaotic_good::OutgoingFrameBytes(frame);
+  }
+};
+
+template <>
+struct MpscTokens<chaotic_good::ServerFrame> {
+  static uint64_t Of(const chaotic_good::ServerFrame& frame) {
+    return chaotic_good::OutgoingFrameBytes(frame);
+  }
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHAOTIC_GOOD_TRANSPORT_H
@@ -32,6 +32,7 @@
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
@@ -40,6 +41,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/party.h"
 #include "src/core/lib/promise/switch.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -212,7 +214,8 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
     : allocator_(args.GetObject<ResourceQuota>()
                      ->memory_quota()
                      ->CreateMemoryAllocator("chaotic-good")),
-      outgoing_frames_(4),
+      max_recv_message_length_(GetMaxRecvSizeFromChannelArgs(args)),
+      outgoing_frames_(kOutgoingFrameQueueBytes),
       message_chunker_(config.MakeMessageChunker()) {
   auto event_engine =
       args.GetObjectRef<grpc_event_engine::experimental::EventEngine>();
@@ -228,10 +231,12 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
       GRPC_LATENT_SEE_PROMISE("ClientTransportWriteLoop",
                               transport->TransportWriteLoop(outgoing_frames_)),
       OnTransportActivityDone("write_loop"));
+  // A read can complete frames for many calls: wake their parties together.
   party_->Spawn(
       "client-chaotic-reader",
-      GRPC_LATENT_SEE_PROMISE("ClientTransportReadLoop",
-                              TransportReadLoop(std::move(transport))),
+      GRPC_LATENT_SEE_PROMISE(
+          "ClientTransportReadLoop",
+          WithWakeupBatch(TransportReadLoop(std::move(transport)))),
       OnTransportActivityDone("read_loop"));
 }
 
@@ -276,7 +281,8 @@ uint32_t ChaoticGoodClientTransport::MakeStream(CallHandler call_handler) {
       });
   if (!on_done_added) return 0;
   stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_handler)));
+                      MakeRefCounted<Stream>(std::move(call_handler),
+                                             max_recv_message_length_));
   return stream_id;
 }
 
@@ -85,7 +85,8 @@ class ChaoticGoodClientTransport final : public ClientTransport {
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallHandler call) : call(std::move(call)) {}
+    Stream(CallHandler call, std::optional<uint32_t> max_recv_message_length)
+        : call(std::move(call)), message_reassembly(max_recv_message_length) {}
     CallHandler call;
     MessageReassembly message_reassembly;
   };
@@ -109,6 +110,7 @@ class ChaoticGoodClientTransport final : public ClientTransport {
   auto PushFrameIntoCall(MessageChunkFrame frame, RefCountedPtr<Stream> stream);
 
   grpc_event_engine::experimental::MemoryAllocator allocator_;
+  const std::optional<uint32_t> max_recv_message_length_;
   // Max buffer is set to 4, so that for stream writes each time it will queue
   // at most 2 frames.
   MpscReceiver<ClientFrame> outgoing_frames_;
@@ -152,8 +152,10 @@ class Config {
   }
 
   // Factory: create a message chunker based on negotiated settings.
+  // Must be called before TakePendingDataEndpoints().
   MessageChunker MakeMessageChunker() const {
-    return MessageChunker(max_send_chunk_size_, encode_alignment_);
+    return MessageChunker(max_send_chunk_size_, encode_alignment_,
+                          pending_data_endpoints_.size());
   }
 
   bool tracing_enabled() const { return tracing_enabled_; }
@@ -14,9 +14,11 @@
 
 #include "src/core/ext/transport/chaotic_good/data_endpoints.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/strings/escaping.h"
@@ -26,6 +28,7 @@
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_seq.h"
 
@@ -38,14 +41,31 @@ namespace data_endpoints_detail {
 // OutputBuffer
 
 bool OutputBuffer::Accept(SliceBuffer& buffer) {
-  if (pending_.Length() != 0 &&
-      pending_.Length() + buffer.Length() > pending_max_) {
-    return false;
-  }
+  if (!CanAccept(buffer.Length())) return false;
   pending_.Append(buffer);
   return true;
 }
 
+SliceBuffer OutputBuffer::TakePending(Timestamp now) {
+  in_flight_bytes_ = pending_.Length();
+  write_started_ = now;
+  return std::move(pending_);
+}
+
+void OutputBuffer::WriteCompleted(Timestamp now) {
+  // Weight of the latest write in the throughput estimate.
+  constexpr double kSampleWeight = 0.25;
+  const double seconds =
+      std::max(now - write_started_, Duration::Milliseconds(1)).seconds();
+  const double sample = in_flight_bytes_ / seconds;
+  in_flight_bytes_ = 0;
+  if (bytes_per_second_ == 0) {
+    bytes_per_second_ = sample;
+  } else {
+    bytes_per_second_ += kSampleWeight * (sample - bytes_per_second_);
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // OutputBuffers
 
@@ -54,15 +74,39 @@ Poll<uint32_t> OutputBuffers::PollWrite(SliceBuffer& output_buffer) {
   auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
   const auto length = output_buffer.Length();
   MutexLock lock(&mu_);
+  // Queue onto the endpoint expected to finish writing these bytes first, so
+  // that one slow endpoint does not hold up reassembly on the peer. Endpoints
+  // that have not been measured yet are assumed to be as fast as the fastest
+  // one; if none has been, this picks the one with the fewest bytes queued.
+  double fastest = 0;
+  for (const auto& buffer : buffers_) {
+    if (buffer.has_value()) {
+      fastest = std::max(fastest, buffer->bytes_per_second());
+    }
+  }
+  std::optional<size_t> best;
+  double best_completion = 0;
   for (size_t i = 0; i < buffers_.size(); ++i) {
-    if (buffers_[i].has_value() && buffers_[i]->Accept(output_buffer)) {
-      GRPC_TRACE_LOG(chaotic_good, INFO)
-          << "CHAOTIC_GOOD: Queue " << length << " data onto endpoint " << i
-          << " queue " << this;
-      waker = buffers_[i]->TakeWaker();
-      return i;
+    if (!buffers_[i].has_value() || !buffers_[i]->CanAccept(length)) continue;
+    double bytes_per_second = buffers_[i]->bytes_per_second();
+    if (bytes_per_second == 0) bytes_per_second = fastest;
+    if (bytes_per_second == 0) bytes_per_second = 1;
+    const double completion =
+        (buffers_[i]->outstanding_bytes() + length) / bytes_per_second;
+    if (!best.has_value() || completion < best_completion) {
+      best = i;
+      best_completion = completion;
     }
   }
+  if (best.has_value()) {
+    const size_t i = *best;
+    CHECK(buffers_[i]->Accept(output_buffer));
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Queue " << length << " data onto endpoint " << i
+        << " queue " << this;
+    waker = buffers_[i]->TakeWaker();
+    return i;
+  }
   GRPC_TRACE_LOG(chaotic_good, INFO)
       << "CHAOTIC_GOOD: No data endpoint ready for " << length
       << " bytes on queue " << this;
@@ -78,7 +122,7 @@ Poll<SliceBuffer> OutputBuffers::PollNext(uint32_t connection_id) {
   CHECK(buffer.has_value());
   if (buffer->HavePending()) {
     waker = std::move(write_waker_);
-    return buffer->TakePending();
+    return buffer->TakePending(Timestamp::Now());
   }
   buffer->SetWaker();
   return Pending{};
@@ -97,6 +141,13 @@ void OutputBuffers::AddEndpoint(uint32_t connection_id) {
   ready_endpoints_.fetch_add(1, std::memory_order_relaxed);
 }
 
+void OutputBuffers::WriteCompleted(uint32_t connection_id) {
+  MutexLock lock(&mu_);
+  auto& buffer = buffers_[connection_id];
+  CHECK(buffer.has_value());
+  buffer->WriteCompleted(Timestamp::Now());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // InputQueues
 
@@ -190,11 +241,15 @@ auto Endpoint::WriteLoop(uint32_t id,
                output_buffers = std::move(output_buffers)]() {
     return TrySeq(
         output_buffers->Next(id),
-        [endpoint, id](SliceBuffer buffer) {
+        [endpoint, id, output_buffers](SliceBuffer buffer) {
           GRPC_TRACE_LOG(chaotic_good, INFO)
               << "CHAOTIC_GOOD: Write " << buffer.Length()
               << "b to data endpoint #" << id;
-          return endpoint->Write(std::move(buffer));
+          return Map(endpoint->Write(std::move(buffer)),
+                     [id, output_buffers](absl::Status status) {
+                       output_buffers->WriteCompleted(id);
+                       return status;
+                     });
         },
         []() -> LoopCtl<absl::Status> { return Continue{}; });
   });
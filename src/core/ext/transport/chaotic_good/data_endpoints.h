@@ -23,6 +23,7 @@
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -32,18 +33,35 @@ namespace data_endpoints_detail {
 // Buffered writes for one data endpoint
 class OutputBuffer {
  public:
+  bool CanAccept(size_t length) const {
+    return pending_.Length() == 0 || pending_.Length() + length <= pending_max_;
+  }
   bool Accept(SliceBuffer& buffer);
   Waker TakeWaker() { return std::move(flush_waker_); }
   void SetWaker() {
     flush_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
   }
   bool HavePending() const { return pending_.Length() > 0; }
-  SliceBuffer TakePending() { return std::move(pending_); }
+  // Hands the pending bytes to the endpoint to be written, starting at `now`.
+  SliceBuffer TakePending(Timestamp now);
+  // The write of the bytes last taken finished at `now`.
+  void WriteCompleted(Timestamp now);
+
+  // Bytes per second this endpoint has been writing at recently, or 0 if no
+  // write has been measured yet.
+  double bytes_per_second() const { return bytes_per_second_; }
+  // Bytes queued or being written.
+  size_t outstanding_bytes() const {
+    return pending_.Length() + in_flight_bytes_;
+  }
 
  private:
   Waker flush_waker_;
   size_t pending_max_ = 1024 * 1024;
   SliceBuffer pending_;
+  size_t in_flight_bytes_ = 0;
+  Timestamp write_started_;
+  double bytes_per_second_ = 0;
 };
 
 // The set of output buffers for all connected data endpoints
@@ -61,6 +79,10 @@ class OutputBuffers : public RefCounted<OutputBuffers> {
 
   void AddEndpoint(uint32_t connection_id);
 
+  // Called by the write loop of `connection_id` when the bytes it took with
+  // Next() have been written.
+  void WriteCompleted(uint32_t connection_id);
+
   uint32_t ReadyEndpoints() const {
     return ready_endpoints_.load(std::memory_order_relaxed);
   }
@@ -187,6 +209,10 @@ class Endpoint final {
 }  // namespace data_endpoints_detail
 
 // Collection of data connections.
+// The connections are plain EventEngine endpoints, obtained from the same
+// EventEngine Connect() and Listen() as the control connection, so an
+// EventEngine can carry them over something other than TCP (e.g. RDMA)
+// without changes here.
 class DataEndpoints {
  public:
   using ReadTicket = data_endpoints_detail::InputQueues::ReadTicket;
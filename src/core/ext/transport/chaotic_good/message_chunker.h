@@ -15,6 +15,7 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_CHUNKER_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_CHUNKER_H
 
+#include <algorithm>
 #include <cstdint>
 
 #include "src/core/ext/transport/chaotic_good/frame.h"
@@ -87,20 +88,30 @@ class PayloadChunker {
 // Helper to send message payloads (possibly chunked!) between client & server.
 class MessageChunker {
  public:
-  MessageChunker(uint32_t max_chunk_size, uint32_t alignment)
-      : max_chunk_size_(max_chunk_size), alignment_(alignment) {}
+  // Messages are never split into chunks smaller than this just to spread
+  // them over the data endpoints.
+  static constexpr uint32_t kMinSpreadChunkSize = 64 * 1024;
+
+  // If there are several data endpoints, messages are split so that their
+  // chunks go to all of them, even if the message is below max_chunk_size.
+  MessageChunker(uint32_t max_chunk_size, uint32_t alignment,
+                 uint32_t data_endpoints = 1)
+      : max_chunk_size_(max_chunk_size),
+        alignment_(alignment),
+        data_endpoints_(std::max<uint32_t>(data_endpoints, 1)) {}
 
   template <typename Output>
   auto Send(MessageHandle message, uint32_t stream_id, Output& output) {
+    const uint32_t chunk_size = ChunkSize(message->payload()->Length());
     return If(
-        ShouldChunk(*message),
+        chunk_size != 0,
         [&]() {
           BeginMessageFrame begin;
           begin.body.set_length(message->payload()->Length());
           begin.stream_id = stream_id;
           return Seq(output.Send(std::move(begin)),
                      Loop([chunker = message_chunker_detail::PayloadChunker(
-                               max_chunk_size_, alignment_, stream_id,
+                               chunk_size, alignment_, stream_id,
                                std::move(*message->payload())),
                            &output]() mutable {
                        auto next = chunker.NextChunk();
@@ -121,15 +132,38 @@ class MessageChunker {
 
   uint32_t max_chunk_size() const { return max_chunk_size_; }
   uint32_t alignment() const { return alignment_; }
+  uint32_t data_endpoints() const { return data_endpoints_; }
 
- private:
-  bool ShouldChunk(Message& message) {
-    return max_chunk_size_ != 0 &&
-           message.payload()->Length() > max_chunk_size_;
+  // Returns the size of the chunks to split a message of `length` bytes into,
+  // or 0 if it should be sent whole.
+  uint32_t ChunkSize(uint64_t length) const {
+    if (max_chunk_size_ == 0) return 0;
+    uint64_t chunks = (length + max_chunk_size_ - 1) / max_chunk_size_;
+    if (data_endpoints_ > 1) {
+      // Use as many chunks as there are endpoints, or a multiple of that, so
+      // that every endpoint carries about the same share of the message.
+      const uint64_t spread =
+          std::min<uint64_t>(data_endpoints_, length / kMinSpreadChunkSize);
+      const uint64_t balanced =
+          (chunks + data_endpoints_ - 1) / data_endpoints_ * data_endpoints_;
+      if (chunks < spread) {
+        chunks = spread;
+      } else if (length / balanced >= kMinSpreadChunkSize) {
+        chunks = balanced;
+      }
+    }
+    if (chunks <= 1) return 0;
+    uint64_t chunk_size = (length + chunks - 1) / chunks;
+    if (alignment_ > 1 && chunk_size % alignment_ != 0) {
+      chunk_size += alignment_ - chunk_size % alignment_;
+    }
+    return std::min<uint64_t>(chunk_size, max_chunk_size_);
   }
 
+ private:
   const uint32_t max_chunk_size_;
   const uint32_t alignment_;
+  const uint32_t data_endpoints_;
 };
 
 }  // namespace chaotic_good
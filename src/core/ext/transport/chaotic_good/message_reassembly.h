@@ -15,7 +15,12 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 
+#include <stdint.h>
+
+#include <optional>
+
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/lib/transport/call_spine.h"
 
@@ -26,6 +31,12 @@ namespace chaotic_good {
 // never having two messages in flight on the same stream.
 class MessageReassembly {
  public:
+  MessageReassembly() = default;
+  // Messages longer than `max_recv_message_length` fail the call as soon as
+  // their length is known, before any of a chunked message is buffered.
+  explicit MessageReassembly(std::optional<uint32_t> max_recv_message_length)
+      : max_recv_message_length_(max_recv_message_length) {}
+
   void FailCall(CallInitiator& call, absl::string_view msg) {
     LOG_EVERY_N_SEC(INFO, 10) << "Call failed during reassembly: " << msg;
     call.Cancel();
@@ -35,16 +46,32 @@ class MessageReassembly {
     call.PushServerTrailingMetadata(
         CancelledServerMetadataFromStatus(GRPC_STATUS_INTERNAL, msg));
   }
+  void FailCallMessageTooLarge(CallInitiator& call, uint64_t length) {
+    call.Cancel(absl::ResourceExhaustedError(
+        absl::StrCat("SERVER: Received message larger than max (", length,
+                     " vs. ", *max_recv_message_length_, ")")));
+  }
+  void FailCallMessageTooLarge(CallHandler& call, uint64_t length) {
+    call.PushServerTrailingMetadata(CancelledServerMetadataFromStatus(
+        GRPC_STATUS_RESOURCE_EXHAUSTED,
+        absl::StrCat("CLIENT: Received message larger than max (", length,
+                     " vs. ", *max_recv_message_length_, ")")));
+  }
 
   template <typename Sink>
   auto PushFrameInto(MessageFrame frame, Sink& sink) {
+    const size_t length = frame.message->payload()->Length();
     return If(
-        in_message_boundary(),
+        in_message_boundary() && !TooLarge(length),
         [&]() { return sink.PushMessage(std::move(frame.message)); },
         [&]() {
-          FailCall(sink,
-                   "Received full message without completing previous chunked "
-                   "message");
+          if (!in_message_boundary()) {
+            FailCall(sink,
+                     "Received full message without completing previous "
+                     "chunked message");
+          } else {
+            FailCallMessageTooLarge(sink, length);
+          }
           return Immediate(StatusFlag(Failure{}));
         });
   }
@@ -61,6 +88,8 @@ class MessageReassembly {
                "Received begin message for an empty message (not allowed)");
     } else if (frame.body.length() > std::numeric_limits<size_t>::max() / 2) {
       FailCall(sink, "Received too large begin message");
+    } else if (TooLarge(frame.body.length())) {
+      FailCallMessageTooLarge(sink, frame.body.length());
     } else {
       GRPC_TRACE_LOG(chaotic_good, INFO)
           << this << " begin message " << frame.body.ShortDebugString();
@@ -105,11 +134,17 @@ class MessageReassembly {
   bool in_message_boundary() { return chunk_receiver_ == nullptr; }
 
  private:
+  bool TooLarge(uint64_t length) const {
+    return max_recv_message_length_.has_value() &&
+           length > *max_recv_message_length_;
+  }
+
   struct ChunkReceiver {
     size_t bytes_remaining;
     SliceBuffer incoming;
   };
   std::unique_ptr<ChunkReceiver> chunk_receiver_;
+  std::optional<uint32_t> max_recv_message_length_;
 };
 
 }  // namespace chaotic_good
@@ -30,6 +30,7 @@
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
@@ -339,7 +340,8 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
           1024)),
       event_engine_(
           args.GetObjectRef<grpc_event_engine::experimental::EventEngine>()),
-      outgoing_frames_(4),
+      max_recv_message_length_(GetMaxRecvSizeFromChannelArgs(args)),
+      outgoing_frames_(kOutgoingFrameQueueBytes),
       message_chunker_(config.MakeMessageChunker()) {
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
       std::move(control_endpoint), config.TakePendingDataEndpoints(),
@@ -353,10 +355,12 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
       GRPC_LATENT_SEE_PROMISE("ServerTransportWriteLoop",
                               transport->TransportWriteLoop(outgoing_frames_)),
       OnTransportActivityDone("writer"));
-  party_->Spawn("server-chaotic-reader",
-                GRPC_LATENT_SEE_PROMISE("ServerTransportReadLoop",
-                                        TransportReadLoop(transport)),
-                OnTransportActivityDone("reader"));
+  // A read can complete frames for many calls: wake their parties together.
+  party_->Spawn(
+      "server-chaotic-reader",
+      GRPC_LATENT_SEE_PROMISE("ServerTransportReadLoop",
+                              WithWakeupBatch(TransportReadLoop(transport))),
+      OnTransportActivityDone("reader"));
 }
 
 void ChaoticGoodServerTransport::SetCallDestination(
@@ -453,7 +457,8 @@ absl::Status ChaoticGoodServerTransport::NewStream(
     return absl::CancelledError();
   }
   stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_initiator)));
+                      MakeRefCounted<Stream>(std::move(call_initiator),
+                                             max_recv_message_length_));
   return absl::OkStatus();
 }
 
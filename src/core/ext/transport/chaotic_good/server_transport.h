@@ -96,7 +96,8 @@ class ChaoticGoodServerTransport final : public ServerTransport {
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallInitiator call) : call(std::move(call)) {}
+    Stream(CallInitiator call, std::optional<uint32_t> max_recv_message_length)
+        : call(std::move(call)), message_reassembly(max_recv_message_length) {}
     CallInitiator call;
     MessageReassembly message_reassembly;
   };
@@ -139,6 +140,7 @@ class ChaoticGoodServerTransport final : public ServerTransport {
   const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
+  const std::optional<uint32_t> max_recv_message_length_;
   InterActivityLatch<void> got_acceptor_;
   MpscReceiver<ServerFrame> outgoing_frames_;
   Mutex mu_;
@@ -44,6 +44,7 @@
 #include "src/core/client_channel/subchannel.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/http2_client_transport.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/handshaker/handshaker_registry.h"
 #include "src/core/handshaker/tcp_connect/tcp_connect_handshaker.h"
@@ -52,7 +53,9 @@
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/security/credentials/credentials.h"
@@ -62,6 +65,7 @@
 #include "src/core/lib/surface/channel_create.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/resolver/resolver_registry.h"
 #include "src/core/util/debug_location.h"
@@ -141,6 +145,23 @@ void Chttp2Connector::OnHandshakeDone(absl::StatusOr<HandshakerArgs*> result) {
     }
     result_->Reset();
     NullThenSchedClosure(DEBUG_LOCATION, &notify_, result.status());
+  } else if ((*result)->endpoint != nullptr &&
+             IsPromiseBasedHttp2ClientTransportEnabled() &&
+             grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+                 (*result)->endpoint.get())) {
+    // The promise based transport can take calls before the peer's SETTINGS
+    // arrive, so the connection is ready as soon as the handshake is done.
+    auto event_engine = (*result)->args.GetObjectRef<
+        grpc_event_engine::experimental::EventEngine>();
+    result_->transport = new http2::Http2ClientTransport(
+        PromiseEndpoint(
+            grpc_event_engine::experimental::
+                grpc_take_wrapped_event_engine_endpoint(
+                    (*result)->endpoint.release()),
+            std::move((*result)->read_buffer)),
+        (*result)->args, std::move(event_engine));
+    result_->channel_args = std::move((*result)->args);
+    NullThenSchedClosure(DEBUG_LOCATION, &notify_, absl::OkStatus());
   } else if ((*result)->endpoint != nullptr) {
     result_->transport = grpc_create_chttp2_transport(
         (*result)->args, std::move((*result)->endpoint), true);
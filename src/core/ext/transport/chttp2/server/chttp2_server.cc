@@ -49,6 +49,7 @@
 #include "src/core/channelz/channelz.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/http2_server_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/handshaker/handshaker.h"
@@ -62,6 +63,7 @@
 #include "src/core/lib/event_engine/resolved_address_internal.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/utils.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
@@ -79,6 +81,7 @@
 #include "src/core/lib/security/credentials/insecure/insecure_credentials.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server.h"
 #include "src/core/util/debug_location.h"
@@ -789,6 +792,15 @@ Chttp2ServerListener::Chttp2ServerListener(
     connection_quota_->SetMaxIncomingConnections(
         max_allowed_incoming_connections.value());
   }
+  auto cpu_utilization_source = args.GetObjectRef<CpuUtilizationSource>();
+  auto max_cpu_utilization_percent = args.GetInt(
+      GRPC_ARG_MAX_CPU_UTILIZATION_FOR_INCOMING_CONNECTIONS_PERCENT);
+  if (cpu_utilization_source != nullptr &&
+      max_cpu_utilization_percent.has_value()) {
+    connection_quota_->SetMaxCpuUtilization(
+        std::move(cpu_utilization_source),
+        *max_cpu_utilization_percent / 100.0);
+  }
   GRPC_CLOSURE_INIT(&tcp_server_shutdown_complete_, TcpServerShutdownComplete,
                     this, grpc_schedule_on_exec_ctx);
 }
@@ -1069,7 +1081,30 @@ void NewChttp2ServerListener::ActiveConnection::HandshakingState::
   // handshaker may have handed off the connection to some external
   // code, so we can just clean up here without creating a transport.
   if (!connection_->shutdown_ && result.ok() &&
-      (*result)->endpoint != nullptr) {
+      (*result)->endpoint != nullptr &&
+      IsPromiseBasedHttp2ServerTransportEnabled() &&
+      grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          (*result)->endpoint.get())) {
+    // The server owns the promise based transport and tracks its lifetime,
+    // so this connection needs no tracking once the transport is set up.
+    auto event_engine = (*result)->args.GetObjectRef<
+        grpc_event_engine::experimental::EventEngine>();
+    grpc_error_handle channel_init_err =
+        connection_->listener_state_->server()->SetupTransport(
+            new http2::Http2ServerTransport(
+                PromiseEndpoint(
+                    grpc_event_engine::experimental::
+                        grpc_take_wrapped_event_engine_endpoint(
+                            (*result)->endpoint.release()),
+                    std::move((*result)->read_buffer)),
+                (*result)->args, std::move(event_engine)),
+            nullptr, (*result)->args, nullptr);
+    if (!channel_init_err.ok()) {
+      LOG(ERROR) << "Failed to create channel: "
+                 << StatusToString(channel_init_err);
+    }
+  } else if (!connection_->shutdown_ && result.ok() &&
+             (*result)->endpoint != nullptr) {
     RefCountedPtr<Transport> transport =
         grpc_create_chttp2_transport((*result)->args,
                                      std::move((*result)->endpoint), false)
@@ -25,9 +25,22 @@
 #include "absl/log/check.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 
-static const char alphabet[] =
+static constexpr char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+// Maps 12 bits of input to the two base64 characters encoding them, so that
+// a triplet is encoded with two lookups rather than four.
+struct b64_pair_table {
+  char pairs[4096][2];
+  constexpr b64_pair_table() : pairs() {
+    for (int i = 0; i < 4096; i++) {
+      pairs[i][0] = alphabet[i >> 6];
+      pairs[i][1] = alphabet[i & 0x3f];
+    }
+  }
+};
+static constexpr b64_pair_table b64_pairs;
+
 struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
@@ -59,10 +72,10 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
 
   // encode full triplets
   for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    memcpy(out, b64_pairs.pairs[triplet >> 12], 2);
+    memcpy(out + 2, b64_pairs.pairs[triplet & 0xfff], 2);
     out += 4;
     in += 3;
   }
@@ -91,33 +104,57 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
+size_t grpc_chttp2_huffman_compressed_length(const uint8_t* input,
+                                             size_t length) {
+  // Sum code lengths in four independent accumulators so that the table
+  // lookups are not serialized behind a single add chain.
+  size_t nbits0 = 0;
+  size_t nbits1 = 0;
+  size_t nbits2 = 0;
+  size_t nbits3 = 0;
+  const uint8_t* in = input;
+  const uint8_t* const end = input + length;
+  for (; end - in >= 4; in += 4) {
+    nbits0 += grpc_chttp2_huffsyms[in[0]].length;
+    nbits1 += grpc_chttp2_huffsyms[in[1]].length;
+    nbits2 += grpc_chttp2_huffsyms[in[2]].length;
+    nbits3 += grpc_chttp2_huffsyms[in[3]].length;
+  }
+  for (; in != end; ++in) {
+    nbits0 += grpc_chttp2_huffsyms[*in].length;
+  }
+  const size_t nbits = nbits0 + nbits1 + nbits2 + nbits3;
+  return nbits / 8 + (nbits % 8 != 0);
+}
+
+uint8_t* grpc_chttp2_huffman_compress_into(const uint8_t* input,
+                                           size_t length, uint8_t* out) {
+  const uint8_t* in = input;
+  const uint8_t* const in_end = input + length;
   uint64_t temp = 0;
   uint32_t temp_length = 0;
 
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
+  // The longest code for an input byte is 30 bits, so with fewer than 32
+  // pending bits another symbol always fits in temp: accumulate codes and
+  // emit four bytes at a time rather than testing after every byte.
+  for (; in != in_end; ++in) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    temp = (temp << sym.length) | sym.bits;
+    temp_length += sym.length;
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp >> temp_length);
+      out[0] = static_cast<uint8_t>(word >> 24);
+      out[1] = static_cast<uint8_t>(word >> 16);
+      out[2] = static_cast<uint8_t>(word >> 8);
+      out[3] = static_cast<uint8_t>(word);
+      out += 4;
+    }
   }
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
-    }
+  while (temp_length >= 8) {
+    temp_length -= 8;
+    *out++ = static_cast<uint8_t>(temp >> temp_length);
   }
 
   if (temp_length) {
@@ -130,20 +167,36 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
                              static_cast<uint8_t>(0xffu >> temp_length));
   }
 
-  CHECK(out == GRPC_SLICE_END_PTR(output));
+  return out;
+}
 
+grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
+  const uint8_t* in = GRPC_SLICE_START_PTR(input);
+  const size_t length = GRPC_SLICE_LENGTH(input);
+  grpc_slice output =
+      GRPC_SLICE_MALLOC(grpc_chttp2_huffman_compressed_length(in, length));
+  uint8_t* out = grpc_chttp2_huffman_compress_into(
+      in, length, GRPC_SLICE_START_PTR(output));
+  CHECK(out == GRPC_SLICE_END_PTR(output));
   return output;
 }
 
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
+// Two symbols take at most 22 bits, so with fewer than 32 pending bits they
+// always fit in temp: flush four bytes at a time once 32 bits are pending.
 static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+  if (out->temp_length >= 32) {
+    out->temp_length -= 32;
+    const uint32_t word = static_cast<uint32_t>(out->temp >> out->temp_length);
+    out->out[0] = static_cast<uint8_t>(word >> 24);
+    out->out[1] = static_cast<uint8_t>(word >> 16);
+    out->out[2] = static_cast<uint8_t>(word >> 8);
+    out->out[3] = static_cast<uint8_t>(word);
+    out->out += 4;
   }
 }
 
@@ -152,7 +205,7 @@ static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
   b64_huff_sym sa = huff_alphabet[a];
   b64_huff_sym sb = huff_alphabet[b];
   out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
+              (static_cast<uint64_t>(sa.bits) << sb.length) | sb.bits;
   out->temp_length +=
       static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
   enc_flush_some(out);
@@ -216,6 +269,11 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     }
   }
 
+  while (out.temp_length >= 8) {
+    out.temp_length -= 8;
+    *out.out++ = static_cast<uint8_t>(out.temp >> out.temp_length);
+  }
+
   if (out.temp_length) {
     // NB: the following integer arithmetic operation needs to be in its
     // expanded form due to the "integral promotion" performed (see section
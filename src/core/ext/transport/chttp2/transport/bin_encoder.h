@@ -21,6 +21,7 @@
 
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // base64 encode a slice. Returns a new slice, does not take ownership of the
@@ -31,6 +32,19 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input);
 // standard. Returns a new slice, does not take ownership of the input
 grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input);
 
+// Returns the number of bytes grpc_chttp2_huffman_compress would produce for
+// input, without encoding it. This is cheap enough to be used to decide
+// whether huffman coding a value is worthwhile at all.
+size_t grpc_chttp2_huffman_compressed_length(const uint8_t* input,
+                                             size_t length);
+
+// Huffman compresses input straight into out, which must have room for
+// grpc_chttp2_huffman_compressed_length(input, length) bytes. Returns the end
+// of the output. Lets callers that have already sized the value with
+// grpc_chttp2_huffman_compressed_length encode it in place.
+uint8_t* grpc_chttp2_huffman_compress_into(const uint8_t* input,
+                                           size_t length, uint8_t* out);
+
 // equivalent to:
 // grpc_slice x = grpc_chttp2_base64_encode(input);
 // grpc_slice y = grpc_chttp2_huffman_compress(x);
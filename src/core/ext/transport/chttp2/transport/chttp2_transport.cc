@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -56,6 +57,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 #include "src/core/config/config_vars.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
 #include "src/core/ext/transport/chttp2/transport/context_list_entry.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
@@ -203,6 +205,9 @@ static void send_ping_locked(grpc_chttp2_transport* t,
 static void retry_initiate_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     GRPC_UNUSED grpc_error_handle error);
+static void flush_delayed_window_updates_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error);
 
 // keepalive-relevant functions
 static void init_keepalive_ping(
@@ -391,6 +396,7 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
   for (i = 0; i < STREAM_LIST_COUNT; i++) {
     CHECK_EQ(lists[i].head, nullptr);
     CHECK_EQ(lists[i].tail, nullptr);
+    CHECK_EQ(lists[i].count, 0u);
   }
 
   CHECK(stream_map.empty());
@@ -428,6 +434,10 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  if (channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_SHARED_LITERAL_CACHE)
+          .value_or(false)) {
+    t->hpack_compressor.EnableSharedLiteralCache();
+  }
 
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
@@ -459,6 +469,13 @@ static void read_channel_args(grpc_chttp2_transport* t,
         channel_args.GetBool(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS)
             .value_or(g_default_server_keepalive_permit_without_calls);
   }
+  if (t->is_client &&
+      t->keepalive_time != grpc_core::Duration::Infinity() &&
+      channel_args.GetBool(GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE)
+          .value_or(false)) {
+    t->shared_keepalive =
+        grpc_core::SharedKeepalive::ForPeer(t->peer_string.as_string_view());
+  }
 
   t->settings_timeout =
       channel_args.GetDurationFromIntMillis(GRPC_ARG_SETTINGS_TIMEOUT)
@@ -491,7 +508,27 @@ static void read_channel_args(grpc_chttp2_transport* t,
             absl::StrCat(t->GetTransportName(), " ",
                          t->peer_string.as_string_view()),
             channel_args
-                .GetObjectRef<grpc_core::channelz::SocketNode::Security>());
+                .GetObjectRef<grpc_core::channelz::SocketNode::Security>(),
+            channel_args.GetBool(GRPC_ARG_CHANNELZ_LAZY_REGISTRATION)
+                    .value_or(false)
+                ? grpc_core::channelz::BaseNode::Registration::kLazy
+                : grpc_core::channelz::BaseNode::Registration::kEager);
+    t->channelz_socket->AddMemoryOwner("transport", t->memory_owner);
+    if (channel_args.GetInt(GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS).value_or(0) >
+            0 &&
+        grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+            t->ep.get())) {
+      auto* tcp_info = grpc_event_engine::experimental::QueryExtension<
+          grpc_event_engine::experimental::TcpInfoExtension>(
+          grpc_event_engine::experimental::
+              grpc_get_wrapped_event_engine_endpoint(t->ep.get()));
+      if (tcp_info != nullptr) {
+        tcp_info->SetTcpInfoSampleCallback(
+            [socket_node = t->channelz_socket](
+                const grpc_core::TcpTracerInterface::ConnectionMetrics&
+                    metrics) { socket_node->SetTcpInfo(metrics); });
+      }
+    }
   }
 
   t->ack_pings = channel_args.GetBool("grpc.http2.ack_pings").value_or(true);
@@ -510,6 +547,8 @@ static void read_channel_args(grpc_chttp2_transport* t,
           .millis();
   t->max_header_list_size_soft_limit =
       grpc_core::GetSoftLimitFromChannelArgs(channel_args);
+  t->max_recv_message_length =
+      grpc_core::GetMaxRecvSizeFromChannelArgs(channel_args);
 
   int value;
   if (!is_client) {
@@ -549,6 +588,23 @@ static void read_channel_args(grpc_chttp2_transport* t,
   t->settings.mutable_local().SetAllowSecurityFrame(
       channel_args.GetBool(GRPC_ARG_SECURITY_FRAME_ALLOWED).value_or(false));
 
+  t->flow_control.set_bulk_stream_threshold(std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_BULK_STREAM_THRESHOLD_BYTES)
+             .value_or(0)));
+  t->window_update_delay = std::chrono::microseconds(std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_WINDOW_UPDATE_DELAY_US)
+             .value_or(0)));
+
+  t->default_write_priority.priority_class =
+      static_cast<grpc_core::GrpcWritePriority::Class>(grpc_core::Clamp(
+          channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_PRIORITY).value_or(1), 0,
+          2));
+  t->default_write_priority.weight = grpc_core::Clamp(
+      channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_WEIGHT).value_or(16), 1, 255);
+  t->offload_recv_message_bytes = std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_OFFLOAD_RECV_MESSAGE_BYTES)
+             .value_or(0));
+
   t->ping_on_rst_stream_percent = grpc_core::Clamp(
       channel_args.GetInt(GRPC_ARG_HTTP2_PING_ON_RST_STREAM_PERCENT)
           .value_or(1),
@@ -772,6 +828,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->event_engine->Cancel(t->delayed_ping_timer_handle)) {
       t->delayed_ping_timer_handle = TaskHandle::kInvalid;
     }
+    if (t->delayed_window_update_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->delayed_window_update_timer_handle)) {
+      t->delayed_window_update_timer_handle = TaskHandle::kInvalid;
+    }
     if (t->next_bdp_ping_timer_handle != TaskHandle::kInvalid &&
         t->event_engine->Cancel(t->next_bdp_ping_timer_handle)) {
       t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
@@ -862,6 +922,7 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
       flow_control(&t->flow_control),
       call_tracer_wrapper(this) {
   t->streams_allocated.fetch_add(1, std::memory_order_relaxed);
+  write_priority = t->default_write_priority;
   if (server_data) {
     id = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(server_data));
     GRPC_TRACE_VLOG(http, 2)
@@ -1056,6 +1117,12 @@ static void write_action_begin_locked(
                     r.partial ? GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE
                               : GRPC_CHTTP2_WRITE_STATE_WRITING,
                     begin_writing_desc(r.partial));
+    // Any window updates held back for coalescing went out with this write.
+    if (!r.partial &&
+        t->delayed_window_update_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->delayed_window_update_timer_handle)) {
+      t->delayed_window_update_timer_handle = TaskHandle::kInvalid;
+    }
     write_action(t.get());
     if (t->reading_paused_on_pending_induced_frames) {
       CHECK_EQ(t->num_pending_induced_frames, 0u);
@@ -1424,6 +1491,11 @@ static void send_initial_metadata_locked(
   if (contains_non_ok_status(s->send_initial_metadata)) {
     s->seen_error = true;
   }
+  if (auto write_priority =
+          s->send_initial_metadata->get(grpc_core::GrpcWritePriority())) {
+    s->write_priority = *write_priority;
+    s->write_priority.weight = std::max<uint8_t>(s->write_priority.weight, 1);
+  }
   if (!s->write_closed) {
     if (t->is_client) {
       if (t->closed_with_error.ok()) {
@@ -1619,6 +1691,11 @@ static void recv_message_locked(
   s->recv_message_flags = op_payload->recv_message.flags;
   s->call_failed_before_recv_message =
       op_payload->recv_message.call_failed_before_recv_message;
+  grpc_error_handle error = grpc_chttp2_check_incoming_message_length(t, s);
+  if (!error.ok()) {
+    grpc_chttp2_cancel_stream(t, s, std::move(error), /*tarpit=*/true);
+    return;
+  }
   grpc_chttp2_maybe_complete_recv_trailing_metadata(t, s);
 }
 
@@ -2131,6 +2208,32 @@ void grpc_chttp2_maybe_complete_recv_initial_metadata(grpc_chttp2_transport* t,
   }
 }
 
+// Run recv_message_ready on an EventEngine thread, so that whatever the layers
+// above do with the message (decompress it, deserialize it...) doesn't hold up
+// reading the rest of the connection.
+//
+// The application may ask for the next message from recv_message_ready, so a
+// second offload can start before the first has come back to the combiner:
+// each offload gets its own closure, and recv_trailing_metadata is held back
+// until none are pending.
+static void offload_recv_message_ready(grpc_chttp2_transport* t,
+                                       grpc_chttp2_stream* s) {
+  grpc_closure* c = std::exchange(s->recv_message_ready, nullptr);
+  ++s->recv_message_offloads_pending;
+  GRPC_CHTTP2_STREAM_REF(s, "offload_recv_message");
+  t->event_engine->Run([s, c]() {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_core::Closure::Run(DEBUG_LOCATION, c, absl::OkStatus());
+    grpc_closure* offloaded = grpc_core::NewClosure([s](grpc_error_handle) {
+      CHECK_GT(s->recv_message_offloads_pending, 0u);
+      --s->recv_message_offloads_pending;
+      grpc_chttp2_maybe_complete_recv_trailing_metadata(s->t.get(), s);
+      GRPC_CHTTP2_STREAM_UNREF(s, "offload_recv_message");
+    });
+    s->t->combiner->Run(offloaded, absl::OkStatus());
+  });
+}
+
 void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s) {
   if (s->recv_message_ready == nullptr) return;
@@ -2193,7 +2296,12 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
     // save the length of the buffer before handing control back to application
     // threads. Needed to support correct flow control bookkeeping
     if (error.ok() && s->recv_message->has_value()) {
-      null_then_sched_closure(&s->recv_message_ready);
+      if (t->offload_recv_message_bytes > 0 &&
+          (*s->recv_message)->Length() >= t->offload_recv_message_bytes) {
+        offload_recv_message_ready(t, s);
+      } else {
+        null_then_sched_closure(&s->recv_message_ready);
+      }
     } else if (s->published_metadata[1] != GRPC_METADATA_NOT_PUBLISHED) {
       if (s->call_failed_before_recv_message != nullptr) {
         *s->call_failed_before_recv_message =
@@ -2217,7 +2325,7 @@ void grpc_chttp2_maybe_complete_recv_trailing_metadata(grpc_chttp2_transport* t,
                            << " write_closed=" << s->write_closed << " "
                            << s->frame_storage.length;
   if (s->recv_trailing_metadata_finished != nullptr && s->read_closed &&
-      s->write_closed) {
+      s->write_closed && s->recv_message_offloads_pending == 0) {
     if (s->seen_error || !t->is_client) {
       grpc_slice_buffer_reset_and_unref(&s->frame_storage);
     }
@@ -2689,10 +2797,46 @@ static void WithUrgency(grpc_chttp2_transport* t,
   }
 }
 
+// Arrange for a write within t->window_update_delay so that stream window
+// updates queued in the meantime share it.
+static void schedule_delayed_window_update_locked(grpc_chttp2_transport* t) {
+  if (t->delayed_window_update_timer_handle != TaskHandle::kInvalid) return;
+  t->delayed_window_update_timer_handle = t->event_engine->RunAfter(
+      t->window_update_delay, [t = t->Ref()]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        grpc_chttp2_transport* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<
+                flush_delayed_window_updates_locked>(
+                std::move(t), &tp->flush_delayed_window_updates_locked),
+            absl::OkStatus());
+      });
+}
+
+static void flush_delayed_window_updates_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  t->delayed_window_update_timer_handle = TaskHandle::kInvalid;
+  if (!t->closed_with_error.ok()) return;
+  grpc_chttp2_initiate_write(t.get(),
+                             GRPC_CHTTP2_INITIATE_WRITE_STREAM_FLOW_CONTROL);
+}
+
 void grpc_chttp2_act_on_flowctl_action(
     const grpc_core::chttp2::FlowControlAction& action,
     grpc_chttp2_transport* t, grpc_chttp2_stream* s) {
-  WithUrgency(t, action.send_stream_update(),
+  auto stream_update_urgency = action.send_stream_update();
+  if (stream_update_urgency ==
+          grpc_core::chttp2::FlowControlAction::Urgency::UPDATE_IMMEDIATELY &&
+      t->window_update_delay.count() > 0 && s != nullptr &&
+      !s->flow_control.StallLikely()) {
+    // Delayed ack: queue the update and flush it with whatever else is ready
+    // once the delay budget runs out (or sooner, if another write starts).
+    stream_update_urgency =
+        grpc_core::chttp2::FlowControlAction::Urgency::QUEUE_UPDATE;
+    schedule_delayed_window_update_locked(t);
+  }
+  WithUrgency(t, stream_update_urgency,
               GRPC_CHTTP2_INITIATE_WRITE_STREAM_FLOW_CONTROL, [t, s]() {
                 if (s->id != 0 && !s->read_closed) {
                   grpc_chttp2_mark_stream_writable(t, s);
@@ -2825,6 +2969,9 @@ static void read_action_parse_loop_locked(
     if (t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING) {
       maybe_reset_keepalive_ping_timer_locked(t.get());
     }
+    if (t->shared_keepalive != nullptr) {
+      t->shared_keepalive->RecordActivity(grpc_core::Timestamp::Now());
+    }
   }
   grpc_slice_buffer_reset_and_unref(&t->read_buffer);
 
@@ -2940,6 +3087,8 @@ static void finish_bdp_ping_locked(
   t->bdp_ping_started = false;
   grpc_core::Timestamp next_ping =
       t->flow_control.bdp_estimator()->CompletePing();
+  t->write_size_policy.SetPacingRate(
+      t->flow_control.bdp_estimator()->PacingRate());
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t.get(),
                                     nullptr);
   CHECK(t->next_bdp_ping_timer_handle == TaskHandle::kInvalid);
@@ -3037,25 +3186,33 @@ static void init_keepalive_ping_locked(
       t->next_adjusted_keepalive_timestamp, grpc_core::Timestamp::InfPast());
   bool delay_callback = grpc_core::IsKeepAlivePingTimerBatchEnabled() &&
                         adjusted_keepalive_timestamp > now;
+  // If another connection to the peer heard from it within the keepalive
+  // time, there is no need to ping it until a keepalive time after that.
+  grpc_core::Timestamp shared_keepalive_due = grpc_core::Timestamp::InfPast();
+  if (t->shared_keepalive != nullptr) {
+    shared_keepalive_due =
+        t->shared_keepalive->last_activity() + t->keepalive_time;
+  }
   if (t->destroying || !t->closed_with_error.ok()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_DYING;
   } else {
-    if (!delay_callback &&
+    if (!delay_callback && shared_keepalive_due <= now &&
         (t->keepalive_permit_without_calls || !t->stream_map.empty())) {
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_PINGING;
       send_keepalive_ping_locked(t);
       grpc_chttp2_initiate_write(t.get(),
                                  GRPC_CHTTP2_INITIATE_WRITE_KEEPALIVE_PING);
     } else {
-      grpc_core::Duration extend = grpc_core::Duration::Zero();
+      grpc_core::Duration delay = t->keepalive_time;
       if (delay_callback) {
-        extend = adjusted_keepalive_timestamp - now;
+        delay += adjusted_keepalive_timestamp - now;
+      } else if (shared_keepalive_due > now) {
+        delay = shared_keepalive_due - now;
       }
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time + extend, [t] {
-            grpc_core::ExecCtx exec_ctx;
-            init_keepalive_ping(t);
-          });
+      t->keepalive_ping_timer_handle = t->event_engine->RunAfter(delay, [t] {
+        grpc_core::ExecCtx exec_ctx;
+        init_keepalive_ping(t);
+      });
     }
   }
 }
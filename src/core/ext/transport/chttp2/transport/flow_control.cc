@@ -134,6 +134,8 @@ absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
                                         -incoming_frame_size);
     sfc_->min_progress_size_ -=
         std::min(sfc_->min_progress_size_, incoming_frame_size);
+    sfc_->received_bytes_ += incoming_frame_size;
+    sfc_->UpdateBulkWindow();
     return absl::OkStatus();
   });
 }
@@ -225,6 +227,19 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   }
 }
 
+int64_t TransportFlowControl::MaxBulkStreamWindowDelta() const {
+  if (bulk_stream_threshold_ == 0) return 0;
+  const double memory_pressure =
+      memory_owner_->GetPressureInfo().pressure_control_value;
+  // Same broad regions as the initial window computation above: bulk streams
+  // get the large window only while memory is plentiful, are held to what a
+  // unary stream could be granted under moderate pressure, and lose their
+  // boost entirely past 50%.
+  if (memory_pressure < 0.2) return kMaxBulkStreamWindowDelta;
+  if (memory_pressure < 0.5) return kMaxWindowDelta;
+  return 0;
+}
+
 void TransportFlowControl::UpdateSetting(
     absl::string_view name, int64_t* desired_value, uint32_t new_desired_value,
     FlowControlAction* action,
@@ -346,7 +361,8 @@ uint32_t StreamFlowControl::DesiredAnnounceSize() const {
         return announced_window_delta_;
       }
     } else {
-      return std::min(min_progress_size_, kMaxWindowDelta);
+      return std::max(std::min(min_progress_size_, kMaxWindowDelta),
+                      bulk_window_delta_);
     }
   }();
   return Clamp(desired_window_delta - announced_window_delta_, int64_t{0},
@@ -380,6 +396,22 @@ FlowControlAction StreamFlowControl::UpdateAction(FlowControlAction action) {
   return action;
 }
 
+void StreamFlowControl::UpdateBulkWindow() {
+  const int64_t threshold = tfc_->bulk_stream_threshold();
+  if (threshold == 0 || received_bytes_ < threshold) return;
+  if (bulk_window_delta_ == 0) {
+    bulk_window_delta_ = kMaxWindowDelta;
+    next_bulk_window_growth_ = received_bytes_ + bulk_window_delta_;
+  } else if (received_bytes_ >= next_bulk_window_growth_) {
+    // The whole window was consumed since the last growth: the reader is
+    // keeping up, so double the window (like slow start) to fill the pipe.
+    bulk_window_delta_ *= 2;
+    next_bulk_window_growth_ = received_bytes_ + bulk_window_delta_;
+  }
+  bulk_window_delta_ =
+      std::min(bulk_window_delta_, tfc_->MaxBulkStreamWindowDelta());
+}
+
 void StreamFlowControl::IncomingUpdateContext::SetPendingSize(
     int64_t pending_size) {
   CHECK_GE(pending_size, 0);
@@ -390,7 +422,8 @@ std::string StreamFlowControl::Stats::ToString() const {
   return absl::StrCat("min_progress_size: ", min_progress_size,
                       " remote_window_delta: ", remote_window_delta,
                       " announced_window_delta: ", announced_window_delta,
-                      pending_size.has_value() ? *pending_size : -1);
+                      pending_size.has_value() ? *pending_size : -1,
+                      " bulk_window_delta: ", bulk_window_delta);
 }
 
 }  // namespace chttp2
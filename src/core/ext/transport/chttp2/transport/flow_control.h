@@ -55,6 +55,9 @@ static constexpr uint32_t kMinPositiveInitialWindowSize = 1024;
 static constexpr const uint32_t kMaxInitialWindowSize = (1u << 30);
 // The maximum per-stream flow control window delta to advertise.
 static constexpr const int64_t kMaxWindowDelta = (1u << 20);
+// The maximum per-stream flow control window delta to advertise for streams
+// classified as bulk (see TransportFlowControl::set_bulk_stream_threshold).
+static constexpr const int64_t kMaxBulkStreamWindowDelta = (1u << 24);
 static constexpr const int kDefaultPreferredRxCryptoFrameSize = INT_MAX;
 
 // TODO(ctiller): clean up when flow_control_fixes is enabled by default
@@ -263,6 +266,19 @@ class TransportFlowControl final {
 
   BdpEstimator* bdp_estimator() { return &bdp_estimator_; }
 
+  // Streams that have received at least this many bytes are treated as bulk
+  // streams: they advertise a window larger than kMaxWindowDelta that doubles
+  // as it is consumed, up to MaxBulkStreamWindowDelta(). Zero (the default)
+  // disables the classification, so all streams are sized alike.
+  void set_bulk_stream_threshold(int64_t threshold) {
+    bulk_stream_threshold_ = threshold;
+  }
+  int64_t bulk_stream_threshold() const { return bulk_stream_threshold_; }
+  // The largest window delta a bulk stream may currently grow to. Shrinks
+  // with memory pressure so that bulk streams fall back to the unary sizing
+  // before the resource quota is exhausted.
+  int64_t MaxBulkStreamWindowDelta() const;
+
   uint32_t acked_init_window() const { return acked_init_window_; }
   uint32_t queued_init_window() const { return target_initial_window_size_; }
   uint32_t sent_init_window() const { return sent_init_window_; }
@@ -348,6 +364,8 @@ class TransportFlowControl final {
   /// should we probe bdp?
   const bool enable_bdp_probe_;
 
+  int64_t bulk_stream_threshold_ = 0;
+
   // bdp estimation
   BdpEstimator bdp_estimator_;
 
@@ -434,6 +452,15 @@ class StreamFlowControl final {
   int64_t remote_window_delta() const { return remote_window_delta_; }
   int64_t announced_window_delta() const { return announced_window_delta_; }
   int64_t min_progress_size() const { return min_progress_size_; }
+  bool is_bulk() const { return bulk_window_delta_ > 0; }
+  // True if a reader is waiting and the peer has less than a frame of window
+  // left to satisfy it: an update that is held back now would stall the
+  // stream.
+  bool StallLikely() const {
+    return min_progress_size_ > 0 &&
+           announced_window_delta_ + tfc_->acked_init_window() <
+               kDefaultFrameSize;
+  }
 
   // A snapshot of the flow control stats to export.
   struct Stats {
@@ -441,6 +468,7 @@ class StreamFlowControl final {
     int64_t remote_window_delta;
     int64_t announced_window_delta;
     std::optional<int64_t> pending_size;
+    int64_t bulk_window_delta;
 
     std::string ToString() const;
   };
@@ -451,6 +479,7 @@ class StreamFlowControl final {
     stats.remote_window_delta = remote_window_delta();
     stats.announced_window_delta = announced_window_delta();
     stats.pending_size = pending_size_;
+    stats.bulk_window_delta = bulk_window_delta_;
     return stats;
   }
 
@@ -460,8 +489,16 @@ class StreamFlowControl final {
   int64_t remote_window_delta_ = 0;
   int64_t announced_window_delta_ = 0;
   std::optional<int64_t> pending_size_;
+  // Bytes received on this stream, used to classify it as bulk.
+  int64_t received_bytes_ = 0;
+  // Received bytes at which bulk_window_delta_ next doubles.
+  int64_t next_bulk_window_growth_ = 0;
+  // Window delta advertised while a reader is waiting, once classified as
+  // bulk; zero for streams that are not (or no longer) bulk.
+  int64_t bulk_window_delta_ = 0;
 
   FlowControlAction UpdateAction(FlowControlAction action);
+  void UpdateBulkWindow();
 };
 
 class TestOnlyTransportTargetWindowEstimatesMocker {
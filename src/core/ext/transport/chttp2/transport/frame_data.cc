@@ -22,6 +22,8 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <utility>
+
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
@@ -78,12 +80,10 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   call_tracer->RecordOutgoingBytes({header_size, 0, 0});
 }
 
-grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
-    grpc_chttp2_stream* s, int64_t* min_progress_size,
-    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags) {
-  grpc_slice_buffer* slices = &s->frame_storage;
-  grpc_error_handle error;
-
+grpc_core::Poll<grpc_error_handle> grpc_chttp2_deframe_message(
+    grpc_slice_buffer* slices, int64_t* min_progress_size,
+    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags,
+    size_t* message_length) {
   if (slices->length < GRPC_HEADER_SIZE_IN_BYTES) {
     if (min_progress_size != nullptr) {
       *min_progress_size = GRPC_HEADER_SIZE_IN_BYTES - slices->length;
@@ -91,9 +91,15 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
     return grpc_core::Pending{};
   }
 
-  uint8_t header[GRPC_HEADER_SIZE_IN_BYTES];
-  grpc_slice_buffer_copy_first_into_buffer(slices, GRPC_HEADER_SIZE_IN_BYTES,
-                                           header);
+  // Every DATA frame of a large message re-checks the header, so read it in
+  // place when (as is almost always the case) it sits in one read slice.
+  uint8_t header_copy[GRPC_HEADER_SIZE_IN_BYTES];
+  const uint8_t* header = GRPC_SLICE_START_PTR(slices->slices[0]);
+  if (GRPC_SLICE_LENGTH(slices->slices[0]) < GRPC_HEADER_SIZE_IN_BYTES) {
+    grpc_slice_buffer_copy_first_into_buffer(slices, GRPC_HEADER_SIZE_IN_BYTES,
+                                             header_copy);
+    header = header_copy;
+  }
 
   switch (header[0]) {
     case 0:
@@ -105,11 +111,8 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
       }
       break;
     default:
-      error = GRPC_ERROR_CREATE(
+      return GRPC_ERROR_CREATE(
           absl::StrFormat("Bad GRPC frame type 0x%02x", header[0]));
-      error = grpc_error_set_int(error, grpc_core::StatusIntProperty::kStreamId,
-                                 static_cast<intptr_t>(s->id));
-      return error;
   }
 
   size_t length = (static_cast<uint32_t>(header[1]) << 24) |
@@ -125,18 +128,63 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
   }
 
   if (min_progress_size != nullptr) *min_progress_size = 0;
+  if (message_length != nullptr) *message_length = length;
 
   if (stream_out != nullptr) {
-    s->call_tracer_wrapper.RecordIncomingBytes(
-        {GRPC_HEADER_SIZE_IN_BYTES, length, 0});
+    // `header` may point into a slice released here, so it is not used again.
     grpc_slice_buffer_move_first_into_buffer(slices, GRPC_HEADER_SIZE_IN_BYTES,
-                                             header);
+                                             header_copy);
     grpc_slice_buffer_move_first(slices, length, stream_out->c_slice_buffer());
   }
 
   return absl::OkStatus();
 }
 
+grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
+    grpc_chttp2_stream* s, int64_t* min_progress_size,
+    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags) {
+  size_t length;
+  auto r = grpc_chttp2_deframe_message(&s->frame_storage, min_progress_size,
+                                       stream_out, message_flags, &length);
+  grpc_error_handle* error = r.value_if_ready();
+  if (error == nullptr) return grpc_core::Pending{};
+  if (!error->ok()) {
+    return grpc_error_set_int(std::move(*error),
+                              grpc_core::StatusIntProperty::kStreamId,
+                              static_cast<intptr_t>(s->id));
+  }
+  if (stream_out != nullptr) {
+    s->call_tracer_wrapper.RecordIncomingBytes(
+        {GRPC_HEADER_SIZE_IN_BYTES, length, 0});
+  }
+  return absl::OkStatus();
+}
+
+grpc_error_handle grpc_chttp2_check_incoming_message_length(
+    grpc_chttp2_transport* t, grpc_chttp2_stream* s) {
+  if (!t->max_recv_message_length.has_value() ||
+      s->frame_storage.length < GRPC_HEADER_SIZE_IN_BYTES) {
+    return absl::OkStatus();
+  }
+  uint8_t header[GRPC_HEADER_SIZE_IN_BYTES];
+  grpc_slice_buffer_copy_first_into_buffer(&s->frame_storage,
+                                           GRPC_HEADER_SIZE_IN_BYTES, header);
+  const uint32_t length = (static_cast<uint32_t>(header[1]) << 24) |
+                          (static_cast<uint32_t>(header[2]) << 16) |
+                          (static_cast<uint32_t>(header[3]) << 8) |
+                          static_cast<uint32_t>(header[4]);
+  if (length <= *t->max_recv_message_length) return absl::OkStatus();
+  return grpc_error_set_int(
+      grpc_error_set_int(
+          GRPC_ERROR_CREATE(absl::StrFormat(
+              "%s: Received message larger than max (%u vs. %u)",
+              t->is_client ? "CLIENT" : "SERVER", length,
+              *t->max_recv_message_length)),
+          grpc_core::StatusIntProperty::kRpcStatus,
+          GRPC_STATUS_RESOURCE_EXHAUSTED),
+      grpc_core::StatusIntProperty::kStreamId, static_cast<intptr_t>(s->id));
+}
+
 grpc_error_handle grpc_chttp2_data_parser_parse(void* /*parser*/,
                                                 grpc_chttp2_transport* t,
                                                 grpc_chttp2_stream* s,
@@ -144,6 +192,12 @@ grpc_error_handle grpc_chttp2_data_parser_parse(void* /*parser*/,
                                                 int is_last) {
   grpc_core::CSliceRef(slice);
   grpc_slice_buffer_add(&s->frame_storage, slice);
+  // Only a pending read opens the flow control window up to the length of
+  // the message, so that is when an oversized one has to be stopped.
+  if (s->recv_message_ready != nullptr) {
+    grpc_error_handle error = grpc_chttp2_check_incoming_message_length(t, s);
+    if (!error.ok()) return error;
+  }
   grpc_chttp2_maybe_complete_recv_message(t, s);
 
   if (is_last && s->received_last_frame) {
@@ -51,8 +51,29 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              grpc_core::CallTracerInterface* call_tracer,
                              grpc_slice_buffer* outbuf);
 
+// Remove one complete length-prefixed gRPC message from the front of `slices`
+// and append its payload to `stream_out` without copying it: whole read slices
+// are moved across and a slice straddling the end of the message is split by
+// reference, so large payloads keep pointing into the transport's read
+// buffers. Returns Pending, with *min_progress_size set to the number of bytes
+// still needed, if `slices` does not hold a complete message yet. With a null
+// `stream_out` this only checks for a complete message.
+grpc_core::Poll<grpc_error_handle> grpc_chttp2_deframe_message(
+    grpc_slice_buffer* slices, int64_t* min_progress_size,
+    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags,
+    size_t* message_length);
+
+// grpc_chttp2_deframe_message() on a stream's frame storage, recording the
+// bytes with the stream's call tracer.
 grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
     grpc_chttp2_stream* s, int64_t* min_progress_size,
     grpc_core::SliceBuffer* stream_out, uint32_t* message_flags);
 
+// Returns a RESOURCE_EXHAUSTED stream error if the length prefix of the next
+// message in the stream's frame storage exceeds the transport's receive
+// limit, so that the stream is reset before the rest of the message is
+// buffered.
+grpc_error_handle grpc_chttp2_check_incoming_message_length(
+    grpc_chttp2_transport* t, grpc_chttp2_stream* s);
+
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_FRAME_DATA_H
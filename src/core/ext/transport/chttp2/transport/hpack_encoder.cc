@@ -21,21 +21,31 @@
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/port_platform.h>
+#include <string.h>
 
 #include <algorithm>
 #include <cstdint>
+#include <string>
+#include <utility>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/string_view.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/ext/transport/chttp2/transport/varint.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 #include "src/core/util/crash.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -239,51 +249,189 @@ class StringKey {
 }  // namespace
 
 namespace hpack_encoder_detail {
+
+namespace {
+// Static table name indices (RFC 7541 appendix A) for the keys gRPC emits as
+// literals with incremental indexing. Returns 0 if key has no static entry.
+uint32_t StaticTableNameIndex(absl::string_view key) {
+  static const auto* const kIndices =
+      new absl::flat_hash_map<absl::string_view, uint32_t>({
+          {":authority", 1},
+          {":method", 2},
+          {":path", 4},
+          {":scheme", 6},
+          {":status", 8},
+          {"accept-encoding", 16},
+          {"authorization", 23},
+          {"content-encoding", 26},
+          {"content-type", 31},
+          {"user-agent", 58},
+      });
+  auto it = kIndices->find(key);
+  return it == kIndices->end() ? 0 : it->second;
+}
+}  // namespace
+
+SharedLiteralCache* SharedLiteralCache::Get() {
+  static SharedLiteralCache* const cache = new SharedLiteralCache();
+  return cache;
+}
+
+Slice SharedLiteralCache::Encode(absl::string_view key,
+                                 absl::string_view value) {
+  const uint32_t name_index = StaticTableNameIndex(key);
+  VarintWriter<2> name_index_writer(name_index);
+  VarintWriter<1> key_len(key.length());
+  const size_t name_length =
+      name_index != 0 ? name_index_writer.length()
+                      : 1 + key_len.length() + key.length();
+  const auto* value_data = reinterpret_cast<const uint8_t*>(value.data());
+  const size_t huffman_length =
+      grpc_chttp2_huffman_compressed_length(value_data, value.length());
+  const bool use_huffman = huffman_length < value.length();
+  VarintWriter<1> value_len(use_huffman ? huffman_length : value.length());
+  const size_t length =
+      name_length + value_len.length() + value_len.value();
+  MutableSlice out = MutableSlice::CreateUninitialized(length);
+  uint8_t* p = out.data();
+  if (name_index != 0) {
+    name_index_writer.Write(0x40, p);
+  } else {
+    p[0] = 0x40;
+    key_len.Write(0x00, p + 1);
+    memcpy(p + 1 + key_len.length(), key.data(), key.length());
+  }
+  p += name_length;
+  value_len.Write(use_huffman ? 0x80 : 0x00, p);
+  p += value_len.length();
+  if (use_huffman) {
+    grpc_chttp2_huffman_compress_into(value_data, value.length(), p);
+  } else {
+    memcpy(p, value.data(), value.length());
+  }
+  return Slice(std::move(out));
+}
+
+bool SharedLiteralCache::IsCacheable(absl::string_view key,
+                                     absl::string_view value) {
+  if (value.length() > kMaxValueLength) return false;
+  static const auto* const kUncacheable =
+      new absl::flat_hash_set<absl::string_view>(
+          {"authorization", "cookie", "grpc-previous-rpc-attempts",
+           "grpc-retry-pushback-ms", "grpc-timeout", "proxy-authorization",
+           "set-cookie"});
+  return !kUncacheable->contains(key);
+}
+
+Slice SharedLiteralCache::Lookup(absl::string_view key, const Slice& value) {
+  if (!IsCacheable(key, value.as_string_view())) return Slice();
+  const EntryKey entry_key(key, value.as_string_view());
+  // Salt the shard's hash, so that all the keys of a shard do not share the
+  // low bits its map hashes them to.
+  Shard& shard = shards_[absl::HashOf(kShards, entry_key) % kShards];
+  {
+    MutexLock lock(&shard.mu);
+    auto it = shard.index.find(entry_key);
+    if (it != shard.index.end()) {
+      shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+      return it->second->encoded.Ref();
+    }
+  }
+  // Encode outside the lock; if another thread raced us to it, either
+  // encoding is equally valid.
+  Slice encoded = Encode(key, value.as_string_view());
+  MutexLock lock(&shard.mu);
+  if (shard.index.contains(entry_key)) return encoded;
+  if (shard.lru.size() >= kMaxEntries / kShards) {
+    const Entry& oldest = shard.lru.back();
+    shard.index.erase(EntryKey(oldest.key, oldest.value));
+    shard.lru.pop_back();
+  }
+  shard.lru.push_front(Entry{std::string(key),
+                             std::string(value.as_string_view()),
+                             encoded.Ref()});
+  const Entry& entry = shard.lru.front();
+  shard.index.emplace(EntryKey(entry.key, entry.value), shard.lru.begin());
+  return encoded;
+}
+
+size_t SharedLiteralCache::TestOnlySize() {
+  size_t size = 0;
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    size += shard.lru.size();
+  }
+  return size;
+}
+
+uint8_t* Encoder::AddTiny(size_t n) {
+  return contiguous_output_ ? output_.AddContiguous(n) : output_.AddTiny(n);
+}
+
+void Encoder::AppendLiteral(Slice slice) {
+  if (contiguous_output_ && slice.length() <= kMaxPackedLiteralSize) {
+    output_.AppendCopied(slice.as_string_view());
+  } else {
+    output_.Append(std::move(slice));
+  }
+}
+
 void Encoder::EmitIndexed(uint32_t elem_index) {
   VarintWriter<1> w(elem_index);
-  w.Write(0x80, output_.AddTiny(w.length()));
+  w.Write(0x80, AddTiny(w.length()));
 }
 
 uint32_t Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice key_slice,
                                                          Slice value_slice) {
   auto key_len = key_slice.length();
   auto value_len = value_slice.length();
+  if (compressor_->use_shared_literal_cache_) {
+    Slice encoded = SharedLiteralCache::Get()->Lookup(
+        key_slice.as_string_view(), value_slice);
+    if (!encoded.empty()) {
+      AppendLiteral(std::move(encoded));
+      // Table accounting is in terms of the decoded sizes, so is unaffected
+      // by how the literal was encoded.
+      return compressor_->table_.AllocateIndex(key_len + value_len +
+                                               hpack_constants::kEntryOverhead);
+    }
+  }
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x40, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x40, AddTiny(key.prefix_length()));
+  AppendLiteral(key.key());
   NonBinaryStringValue emit(std::move(value_slice));
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  emit.WritePrefix(AddTiny(emit.prefix_length()));
   // Allocate an index in the hpack table for this newly emitted entry.
   // (we do so here because we know the length of the key and value)
   uint32_t index = compressor_->table_.AllocateIndex(
       key_len + value_len + hpack_constants::kEntryOverhead);
-  output_.Append(emit.data());
+  AppendLiteral(emit.data());
   return index;
 }
 
 void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(Slice key_slice,
                                                   Slice value_slice) {
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x00, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x00, AddTiny(key.prefix_length()));
+  AppendLiteral(key.key());
   BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
-  output_.Append(emit.data());
+  emit.WritePrefix(AddTiny(emit.prefix_length()));
+  AppendLiteral(emit.data());
 }
 
 uint32_t Encoder::EmitLitHdrWithBinaryStringKeyIncIdx(Slice key_slice,
                                                       Slice value_slice) {
   auto key_len = key_slice.length();
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x40, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x40, AddTiny(key.prefix_length()));
+  AppendLiteral(key.key());
   BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  emit.WritePrefix(AddTiny(emit.prefix_length()));
   // Allocate an index in the hpack table for this newly emitted entry.
   // (we do so here because we know the length of the key and value)
   uint32_t index = compressor_->table_.AllocateIndex(
       key_len + emit.hpack_length() + hpack_constants::kEntryOverhead);
-  output_.Append(emit.data());
+  AppendLiteral(emit.data());
   return index;
 }
 
@@ -291,25 +439,25 @@ void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(uint32_t key_index,
                                                   Slice value_slice) {
   BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
   VarintWriter<4> key(key_index);
-  uint8_t* data = output_.AddTiny(key.length() + emit.prefix_length());
+  uint8_t* data = AddTiny(key.length() + emit.prefix_length());
   key.Write(0x00, data);
   emit.WritePrefix(data + key.length());
-  output_.Append(emit.data());
+  AppendLiteral(emit.data());
 }
 
 void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                                      Slice value_slice) {
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x00, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x00, AddTiny(key.prefix_length()));
+  AppendLiteral(key.key());
   NonBinaryStringValue emit(std::move(value_slice));
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
-  output_.Append(emit.data());
+  emit.WritePrefix(AddTiny(emit.prefix_length()));
+  AppendLiteral(emit.data());
 }
 
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
-  w.Write(0x20, output_.AddTiny(w.length()));
+  w.Write(0x20, AddTiny(w.length()));
 }
 
 void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
@@ -498,6 +646,7 @@ void TimeoutCompressorImpl::EncodeWith(absl::string_view key,
 Encoder::Encoder(HPackCompressor* compressor, bool use_true_binary_metadata,
                  SliceBuffer& output)
     : use_true_binary_metadata_(use_true_binary_metadata),
+      contiguous_output_(IsHpackEncoderContiguousOutputEnabled()),
       compressor_(compressor),
       output_(output) {
   if (std::exchange(compressor_->advertise_table_size_change_, false)) {
@@ -24,9 +24,13 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <list>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -40,6 +44,7 @@
 #include "src/core/lib/transport/timeout_encoding.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -49,6 +54,61 @@ class HPackCompressor;
 
 namespace hpack_encoder_detail {
 
+// Process wide cache of encoded "literal header field with incremental
+// indexing" representations (RFC 7541 section 6.2.1).
+// Until a connection's dynamic table is warm, every stable header (:path,
+// :authority, user-agent, ...) has to be sent as a literal. Compressors that
+// opt in share these encodings across connections: the name is emitted as a
+// static table index where there is one, the value is huffman coded when
+// that is shorter, and the work is done once per process rather than once
+// per connection.
+class SharedLiteralCache {
+ public:
+  static constexpr size_t kMaxEntries = 4096;
+  static constexpr size_t kMaxValueLength = 1024;
+
+  static SharedLiteralCache* Get();
+
+  // Returns the encoded representation of key: value, or an empty slice if
+  // the pair is not cacheable (see IsCacheable()).
+  Slice Lookup(absl::string_view key, const Slice& value);
+
+  // Encode key: value as Lookup() would, without consulting the cache.
+  static Slice Encode(absl::string_view key, absl::string_view value);
+
+  // Whether key: value may be cached. Values that are too long are not, and
+  // neither are the values of keys that change from call to call (timeouts,
+  // retry attempts), which would only push out stable entries, or that carry
+  // credentials (authorization, cookies), which must not outlive their calls.
+  static bool IsCacheable(absl::string_view key, absl::string_view value);
+
+  size_t TestOnlySize();
+
+ private:
+  // Each shard is an LRU cache of kMaxEntries / kShards entries, so that
+  // encoders on different connections rarely contend for a lock.
+  static constexpr size_t kShards = 16;
+
+  // Points into the strings of an Entry, so that lookups need not allocate.
+  using EntryKey = std::pair<absl::string_view, absl::string_view>;
+
+  struct Entry {
+    std::string key;
+    std::string value;
+    Slice encoded;
+  };
+
+  struct Shard {
+    Mutex mu;
+    // Most recently used first.
+    std::list<Entry> lru ABSL_GUARDED_BY(mu);
+    absl::flat_hash_map<EntryKey, std::list<Entry>::iterator> index
+        ABSL_GUARDED_BY(mu);
+  };
+
+  Shard shards_[kShards];
+};
+
 class Encoder {
  public:
   Encoder(HPackCompressor* compressor, bool use_true_binary_metadata,
@@ -87,7 +147,18 @@ class Encoder {
   HPackEncoderTable& hpack_table();
 
  private:
+  // With the hpack_encoder_contiguous_output experiment, literals up to this
+  // size are copied next to the prefix before them rather than appended as a
+  // slice of their own.
+  static constexpr size_t kMaxPackedLiteralSize = 128;
+
+  // Add n bytes of encoding to output_, for the caller to fill in.
+  uint8_t* AddTiny(size_t n);
+  // Append an encoded key or value to output_.
+  void AppendLiteral(Slice slice);
+
   const bool use_true_binary_metadata_;
+  const bool contiguous_output_;
   bool saw_encoding_errors_ = false;
   HPackCompressor* const compressor_;
   SliceBuffer& output_;
@@ -342,6 +413,8 @@ class HPackCompressor {
 
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
+  // Emit new literals from the process-wide SharedLiteralCache.
+  void EnableSharedLiteralCache() { use_shared_literal_cache_ = true; }
 
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
@@ -387,6 +460,7 @@ class HPackCompressor {
   // if non-zero, advertise to the decoder that we'll start using a table
   // of this size
   bool advertise_table_size_change_ = false;
+  bool use_shared_literal_cache_ = false;
   HPackEncoderTable table_;
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
@@ -995,17 +995,31 @@ class HPackParser::Parser {
       }
     }
     auto value_slice = value.value.Take();
-    const auto transport_size =
-        key_string.size() + value.wire_size + hpack_constants::kEntryOverhead;
-    auto md = grpc_metadata_batch::Parse(
-        key_string, std::move(value_slice), state_.add_to_table, transport_size,
-        [key_string, this](absl::string_view message, const Slice&) {
-          if (!state_.field_error.ok()) return;
-          input_->SetErrorAndContinueParsing(
-              HpackParseResult::MetadataParseError(key_string));
-          LOG(ERROR) << "Error parsing '" << key_string
-                     << "' metadata: " << message;
-        });
+    auto on_error = [key_string, this](absl::string_view message,
+                                       const Slice&) {
+      if (!state_.field_error.ok()) return;
+      input_->SetErrorAndContinueParsing(
+          HpackParseResult::MetadataParseError(key_string));
+      LOG(ERROR) << "Error parsing '" << key_string
+                 << "' metadata: " << message;
+    };
+    ParsedMetadata<grpc_metadata_batch> md;
+    if (const auto* const* memento =
+            std::get_if<const HPackTable::Memento*>(&state_.key)) {
+      // The key came from the table, so it has already been validated and
+      // matched to its trait (or interned, for unknown keys): just parse the
+      // new value. gRPC's own per-call headers (grpc-timeout, te,
+      // content-type...) mostly arrive this way.
+      md = (*memento)->md.WithNewValue(std::move(value_slice),
+                                       state_.add_to_table, value.wire_size,
+                                       on_error);
+    } else {
+      const auto transport_size = key_string.size() + value.wire_size +
+                                  hpack_constants::kEntryOverhead;
+      md = grpc_metadata_batch::Parse(key_string, std::move(value_slice),
+                                      state_.add_to_table, transport_size,
+                                      on_error);
+    }
     HPackTable::Memento memento{
         std::move(md), state_.field_error.PersistentStreamErrorOrNullptr()};
     input_->UpdateFrontier();
@@ -18,26 +18,313 @@
 
 #include "src/core/ext/transport/chttp2/transport/http2_client_transport.h"
 
-#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
-#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
-#include "src/core/lib/transport/transport.h"
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <variant>
+
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/transport/call_spine.h"
+#include "src/core/lib/transport/http2_errors.h"
+#include "src/core/lib/transport/metadata.h"
+#include "src/core/lib/transport/status_conversion.h"
+#include "src/core/util/down_cast.h"
 
 namespace grpc_core {
 namespace http2 {
 
-// Experimental : This is just the initial skeleton of class
-// and it is functions. The code will be written iteratively.
-// Do not use or edit any of these functions unless you are
-// familiar with the PH2 project (Moving chttp2 to promises.)
-// TODO(tjagtap) : [PH2][P3] : Delete this comment when http2
-// rollout begins
-void Http2ClientTransport::StartCall(GRPC_UNUSED CallHandler call_handler) {}
+namespace {
+// Client stream ids are odd and at most 2^31-1.
+constexpr uint32_t kMaxClientStreamId = 0x7fffffffu;
+}  // namespace
+
+Http2ClientTransport::Http2ClientTransport(
+    PromiseEndpoint endpoint, const ChannelArgs& channel_args,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine)
+    : Http2Transport(std::move(endpoint), channel_args, std::move(event_engine),
+                     /*is_client=*/true) {
+  auto party_arena = SimpleArenaAllocator(0)->MakeArena();
+  party_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+      event_engine_.get());
+  RefCountedPtr<Party> party = Party::Make(std::move(party_arena));
+  SpawnWriteAndKeepaliveLoops(party.get(), Ref());
+  SpawnReadLoop(party.get(), Ref());
+  MutexLock lock(&mu_);
+  party_ = std::move(party);
+}
+
+Http2ClientTransport::~Http2ClientTransport() { party_.reset(); }
+
+void Http2ClientTransport::Orphan() {
+  AbortWithError();
+  RefCountedPtr<Party> party;
+  {
+    MutexLock lock(&mu_);
+    party = std::move(party_);
+  }
+  party.reset();
+  Unref();
+}
+
+void Http2ClientTransport::AbortWithError() {
+  outgoing_frames_.MarkClosed();
+  StreamMap streams = TakeStreams();
+  {
+    MutexLock lock(&mu_);
+    state_tracker_.SetState(GRPC_CHANNEL_SHUTDOWN,
+                            absl::UnavailableError("transport closed"),
+                            "transport closed");
+  }
+  for (auto& [stream_id, stream] : streams) {
+    auto& call = DownCast<Stream&>(*stream).call;
+    call.SpawnInfallible("cancel", [stream = std::move(stream)]() mutable {
+      DownCast<Stream&>(*stream).call.PushServerTrailingMetadata(
+          ServerMetadataFromStatus(
+              absl::UnavailableError("Transport closed.")));
+    });
+  }
+}
+
+void Http2ClientTransport::PerformOp(grpc_transport_op* op) {
+  MutexLock lock(&mu_);
+  bool did_stuff = false;
+  if (op->start_connectivity_watch != nullptr) {
+    state_tracker_.AddWatcher(op->start_connectivity_watch_state,
+                              std::move(op->start_connectivity_watch));
+    did_stuff = true;
+  }
+  if (op->stop_connectivity_watch != nullptr) {
+    state_tracker_.RemoveWatcher(op->stop_connectivity_watch);
+    did_stuff = true;
+  }
+  if (op->set_accept_stream) {
+    Crash("set_accept_stream not supported on clients");
+  }
+  if (!did_stuff) {
+    Crash(absl::StrCat("unimplemented transport perform op: ",
+                       grpc_transport_op_string(op)));
+  }
+  ExecCtx::Run(DEBUG_LOCATION, op->on_consumed, absl::OkStatus());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Calls
+
+Poll<absl::Status> Http2ClientTransport::PollOpenStream(
+    Stream& stream, ClientMetadataHandle& metadata) {
+  MutexLock open_stream_lock(&open_stream_mu_);
+  {
+    MutexLock lock(&mu_);
+    if (goaway_received_ ||
+        state_tracker_.state() == GRPC_CHANNEL_SHUTDOWN) {
+      return absl::UnavailableError("Transport closed.");
+    }
+    if (stream_count() >= peer_settings().max_concurrent_streams()) {
+      stream_slot_waiters_[&stream] =
+          GetContext<Activity>()->MakeNonOwningWaker();
+      return Pending{};
+    }
+    if (next_stream_id_ > kMaxClientStreamId) {
+      return absl::UnavailableError("Transport ran out of stream ids.");
+    }
+    stream.stream_id = next_stream_id_;
+    next_stream_id_ += 2;
+    AddStreamLocked(stream.Ref());
+  }
+  GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+      << "PH2: Client stream " << stream.stream_id << " sends "
+      << metadata->DebugString();
+  if (!outgoing_frames_.MakeSender().UnbufferedImmediateSend(
+          Http2OutgoingHeaders{stream.stream_id, /*end_stream=*/false,
+                               std::move(metadata)})) {
+    return absl::UnavailableError("Transport closed.");
+  }
+  return absl::OkStatus();
+}
+
+auto Http2ClientTransport::CallOutboundLoop(RefCountedPtr<Stream> stream) {
+  return TrySeq(
+      stream->call.PullClientInitialMetadata(),
+      [this, stream](ClientMetadataHandle metadata) {
+        return [this, stream, metadata = std::move(metadata)]() mutable {
+          return PollOpenStream(*stream, metadata);
+        };
+      },
+      ForEach(MessagesFrom(stream->call),
+              [this, stream](MessageHandle message) {
+                return SendMessage(stream, std::move(message));
+              }),
+      [this, stream]() {
+        {
+          MutexLock lock(&mu_);
+          stream->sent_end_stream = true;
+        }
+        Http2DataFrame frame;
+        frame.stream_id = stream->stream_id;
+        frame.end_stream = true;
+        return SendFrame(Http2Frame(std::move(frame)));
+      },
+      [stream]() {
+        return Map(stream->call.WasCancelled(), [](bool cancelled) {
+          if (cancelled) return absl::CancelledError();
+          return absl::OkStatus();
+        });
+      });
+}
+
+LoopCtl<absl::Status> Http2ClientTransport::PushEventIntoCall(
+    Stream& stream, IncomingEvent event) {
+  if (std::holds_alternative<IncomingEndOfStream>(event)) {
+    stream.call.PushServerTrailingMetadata(CancelledServerMetadataFromStatus(
+        GRPC_STATUS_INTERNAL, "Stream ended without trailers."));
+    return absl::OkStatus();
+  }
+  auto& headers = std::get<IncomingHeaders>(event);
+  if (headers.end_stream) {
+    stream.call.PushServerTrailingMetadata(std::move(headers.metadata));
+    return absl::OkStatus();
+  }
+  if (stream.received_initial_metadata) {
+    stream.call.PushServerTrailingMetadata(CancelledServerMetadataFromStatus(
+        GRPC_STATUS_INTERNAL, "Received initial metadata twice."));
+    return absl::OkStatus();
+  }
+  stream.received_initial_metadata = true;
+  if (!stream.call.PushServerInitialMetadata(std::move(headers.metadata))
+           .ok()) {
+    return absl::CancelledError();
+  }
+  return Continue{};
+}
+
+auto Http2ClientTransport::CallInboundLoop(RefCountedPtr<Stream> stream) {
+  return Loop([this, stream = std::move(stream)]() {
+    return TrySeq(
+        Map(stream->incoming.Next(),
+            [](ValueOrFailure<IncomingEvent> event)
+                -> absl::StatusOr<IncomingEvent> {
+              if (!event.ok()) return absl::CancelledError("Stream closed.");
+              return std::move(event.value());
+            }),
+        [this, stream](IncomingEvent event) {
+          auto* message = std::get_if<IncomingMessage>(&event);
+          return If(
+              message != nullptr,
+              [this, &stream, message]() {
+                return Map(
+                    stream->call.PushMessage(std::move(message->message)),
+                    [this, stream, window_bytes = message->window_bytes](
+                        StatusFlag pushed) -> LoopCtl<absl::Status> {
+                      OnMessageConsumed(*stream, window_bytes);
+                      if (!pushed.ok()) return absl::CancelledError();
+                      return Continue{};
+                    });
+              },
+              [this, &stream, &event]() {
+                return PushEventIntoCall(*stream, std::move(event));
+              });
+        });
+  });
+}
+
+void Http2ClientTransport::StartCall(CallHandler call_handler) {
+  auto stream = MakeRefCounted<Stream>(call_handler);
+  const bool on_done_added = call_handler.OnDone(
+      [self = RefAsSubclass<Http2ClientTransport>(), stream](bool cancelled) {
+        uint32_t stream_id;
+        {
+          MutexLock lock(&self->mu_);
+          stream_id = stream->stream_id;
+        }
+        GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+            << "PH2: Client call " << self.get() << " id=" << stream_id
+            << " done: cancelled=" << cancelled;
+        if (stream_id == 0) return;
+        if (self->RemoveStream(stream_id) != nullptr && cancelled) {
+          self->SendRstStream(stream_id, GRPC_HTTP2_CANCEL);
+        }
+      });
+  if (!on_done_added) return;
+  call_handler.SpawnGuarded(
+      "inbound_loop",
+      [self = RefAsSubclass<Http2ClientTransport>(), stream]() mutable {
+        return self->CallInboundLoop(std::move(stream));
+      });
+  call_handler.SpawnGuarded(
+      "outbound_loop", [self = RefAsSubclass<Http2ClientTransport>(),
+                        stream = std::move(stream)]() mutable {
+        return self->CallOutboundLoop(std::move(stream));
+      });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Read loop callbacks
 
-void Http2ClientTransport::PerformOp(GRPC_UNUSED grpc_transport_op* op) {}
+absl::Status Http2ClientTransport::OnIncomingHeaders(
+    uint32_t stream_id, Arena::PoolPtr<grpc_metadata_batch> metadata,
+    bool end_stream) {
+  if (stream_id % 2 == 0) {
+    return absl::InternalError(
+        absl::StrCat("Server opened stream ", stream_id));
+  }
+  auto stream = LookupStream(stream_id);
+  // Headers of a stream that is gone already are dropped.
+  if (stream == nullptr) return absl::OkStatus();
+  if (end_stream) {
+    MutexLock lock(&mu_);
+    stream->received_end_stream = true;
+  }
+  stream->incoming.MakeSender().UnbufferedImmediateSend(
+      IncomingHeaders{std::move(metadata), end_stream});
+  return absl::OkStatus();
+}
 
-void Http2ClientTransport::Orphan() {}
+void Http2ClientTransport::OnStreamReset(RefCountedPtr<StreamState> stream,
+                                         uint32_t error_code) {
+  const grpc_status_code status = grpc_http2_error_to_grpc_status(
+      static_cast<grpc_http2_error_code>(error_code), Timestamp::InfFuture());
+  auto& call = DownCast<Stream&>(*stream).call;
+  call.SpawnInfallible(
+      "reset", [stream = std::move(stream), status, error_code]() mutable {
+        DownCast<Stream&>(*stream).call.PushServerTrailingMetadata(
+            CancelledServerMetadataFromStatus(
+                status, absl::StrCat("Stream reset by peer with error ",
+                                     error_code)));
+      });
+}
 
-void Http2ClientTransport::AbortWithError() {}
+void Http2ClientTransport::OnGoaway(uint32_t last_stream_id) {
+  {
+    MutexLock lock(&mu_);
+    goaway_received_ = true;
+    state_tracker_.SetState(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                            absl::UnavailableError("GOAWAY received"),
+                            "GOAWAY received");
+  }
+  // The peer did not process these: they fail as unavailable, so that they
+  // can be retried on another connection.
+  for (auto& stream : RemoveStreamsAbove(last_stream_id)) {
+    auto& call = DownCast<Stream&>(*stream).call;
+    call.SpawnInfallible("goaway", [stream = std::move(stream)]() mutable {
+      DownCast<Stream&>(*stream).call.PushServerTrailingMetadata(
+          ServerMetadataFromStatus(
+              absl::UnavailableError("GOAWAY received.")));
+    });
+  }
+}
 
 }  // namespace http2
 }  // namespace grpc_core
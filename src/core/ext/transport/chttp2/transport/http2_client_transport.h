@@ -19,10 +19,21 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_CLIENT_TRANSPORT_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_CLIENT_TRANSPORT_H
 
-#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
-#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "src/core/ext/transport/chttp2/transport/http2_transport.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/promise/poll.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 namespace http2 {
@@ -47,14 +58,14 @@ namespace http2 {
 // familiar with the PH2 project (Moving chttp2 to promises.)
 // TODO(tjagtap) : [PH2][P3] : Update the experimental status of the code before
 // http2 rollout begins.
-class Http2ClientTransport final : public ClientTransport {
+class Http2ClientTransport final : public ClientTransport,
+                                   private Http2Transport {
  public:
   Http2ClientTransport(
-      GRPC_UNUSED PromiseEndpoint endpoint,
-      GRPC_UNUSED const ChannelArgs& channel_args,
-      GRPC_UNUSED std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-          event_engine) {}
-  ~Http2ClientTransport() override {};
+      PromiseEndpoint endpoint, const ChannelArgs& channel_args,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  ~Http2ClientTransport() override;
 
   FilterStackTransport* filter_stack_transport() override { return nullptr; }
   ClientTransport* client_transport() override { return this; }
@@ -68,7 +79,42 @@ class Http2ClientTransport final : public ClientTransport {
   void PerformOp(grpc_transport_op*) override;
 
   void Orphan() override;
-  void AbortWithError();
+  void AbortWithError() override;
+
+ private:
+  struct Stream final : public StreamState {
+    explicit Stream(CallHandler call) : call(std::move(call)) {}
+    CallHandler call;
+    // Only touched by the call's inbound loop.
+    bool received_initial_metadata = false;
+  };
+
+  // Resolves once the peer allows another stream, after giving the stream its
+  // id and queueing its HEADERS.
+  Poll<absl::Status> PollOpenStream(Stream& stream,
+                                    ClientMetadataHandle& metadata)
+      ABSL_LOCKS_EXCLUDED(open_stream_mu_, mu_);
+  auto CallOutboundLoop(RefCountedPtr<Stream> stream);
+  auto CallInboundLoop(RefCountedPtr<Stream> stream);
+  // Hands what the read loop read for stream, other than a message, to the
+  // call.
+  LoopCtl<absl::Status> PushEventIntoCall(Stream& stream, IncomingEvent event);
+
+  absl::Status OnIncomingHeaders(uint32_t stream_id,
+                                 Arena::PoolPtr<grpc_metadata_batch> metadata,
+                                 bool end_stream) override;
+  void OnStreamReset(RefCountedPtr<StreamState> stream,
+                     uint32_t error_code) override;
+  void OnGoaway(uint32_t last_stream_id) override;
+
+  // Stream ids must go on the wire in increasing order, so a stream takes its
+  // id and queues its HEADERS under this. Unlike mu_, it may be held while
+  // queueing, as the write loop never takes it.
+  Mutex open_stream_mu_ ABSL_ACQUIRED_BEFORE(mu_);
+  uint32_t next_stream_id_ ABSL_GUARDED_BY(open_stream_mu_) = 1;
+  // Set once the peer sent GOAWAY: no new streams from then on.
+  bool goaway_received_ ABSL_GUARDED_BY(mu_) = false;
+  RefCountedPtr<Party> party_ ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace http2
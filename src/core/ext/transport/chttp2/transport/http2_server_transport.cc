@@ -18,27 +18,341 @@
 
 #include "src/core/ext/transport/chttp2/transport/http2_server_transport.h"
 
-#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
-#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
-#include "src/core/lib/transport/transport.h"
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <variant>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/call_spine.h"
+#include "src/core/lib/transport/http2_errors.h"
+#include "src/core/lib/transport/metadata.h"
+#include "src/core/lib/transport/status_conversion.h"
+#include "src/core/util/down_cast.h"
 
 namespace grpc_core {
 namespace http2 {
 
-// Experimental : This is just the initial skeleton of class
-// and it is functions. The code will be written iteratively.
-// Do not use or edit any of these functions unless you are
-// familiar with the PH2 project (Moving chttp2 to promises.)
-// TODO(tjagtap) : [PH2][P3] : Delete this comment when http2
-// rollout begins
+namespace {
+RefCountedPtr<CallArenaAllocator> MakeCallArenaAllocator(
+    const ChannelArgs& channel_args) {
+  auto* resource_quota = channel_args.GetObject<ResourceQuota>();
+  if (resource_quota == nullptr) {
+    resource_quota = ResourceQuota::Default().get();
+  }
+  return MakeRefCounted<CallArenaAllocator>(
+      resource_quota->memory_quota()->CreateMemoryAllocator("http2"), 1024);
+}
+}  // namespace
+
+Http2ServerTransport::Http2ServerTransport(
+    PromiseEndpoint endpoint, const ChannelArgs& channel_args,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine)
+    : Http2Transport(std::move(endpoint), channel_args, std::move(event_engine),
+                     /*is_client=*/false),
+      call_arena_allocator_(MakeCallArenaAllocator(channel_args)) {
+  auto party_arena = SimpleArenaAllocator(0)->MakeArena();
+  party_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+      event_engine_.get());
+  RefCountedPtr<Party> party = Party::Make(std::move(party_arena));
+  // The read loop waits for SetCallDestination(): nothing can be done with
+  // the client's streams before then.
+  SpawnWriteAndKeepaliveLoops(party.get(), Ref());
+  MutexLock lock(&mu_);
+  party_ = std::move(party);
+}
+
+Http2ServerTransport::~Http2ServerTransport() { party_.reset(); }
+
 void Http2ServerTransport::SetCallDestination(
-    GRPC_UNUSED RefCountedPtr<UnstartedCallDestination> call_destination) {}
+    RefCountedPtr<UnstartedCallDestination> call_destination) {
+  CHECK(call_destination_ == nullptr);
+  CHECK(call_destination != nullptr);
+  call_destination_ = std::move(call_destination);
+  RefCountedPtr<Party> party;
+  {
+    MutexLock lock(&mu_);
+    party = party_;
+  }
+  if (party != nullptr) SpawnReadLoop(party.get(), Ref());
+}
+
+void Http2ServerTransport::Orphan() {
+  AbortWithError();
+  RefCountedPtr<Party> party;
+  {
+    MutexLock lock(&mu_);
+    party = std::move(party_);
+  }
+  party.reset();
+  Unref();
+}
+
+void Http2ServerTransport::AbortWithError() {
+  outgoing_frames_.MarkClosed();
+  StreamMap streams = TakeStreams();
+  {
+    MutexLock lock(&mu_);
+    state_tracker_.SetState(GRPC_CHANNEL_SHUTDOWN,
+                            absl::UnavailableError("transport closed"),
+                            "transport closed");
+  }
+  for (auto& [stream_id, stream] : streams) {
+    DownCast<Stream&>(*stream).call.SpawnCancel();
+  }
+}
+
+void Http2ServerTransport::PerformOp(grpc_transport_op* op) {
+  RefCountedPtr<Party> cancelled_party;
+  bool abort = false;
+  {
+    SendingLock lock(this);
+    bool did_stuff = false;
+    if (op->start_connectivity_watch != nullptr) {
+      state_tracker_.AddWatcher(op->start_connectivity_watch_state,
+                                std::move(op->start_connectivity_watch));
+      did_stuff = true;
+    }
+    if (op->stop_connectivity_watch != nullptr) {
+      state_tracker_.RemoveWatcher(op->stop_connectivity_watch);
+      did_stuff = true;
+    }
+    if (op->set_accept_stream) {
+      if (op->set_accept_stream_fn != nullptr) {
+        Crash(absl::StrCat(
+            "set_accept_stream not supported on http2 promise transports: ",
+            grpc_transport_op_string(op)));
+      }
+      did_stuff = true;
+    }
+    if (!op->goaway_error.ok()) {
+      // Streams the client already opened are served; GOAWAY tells it not to
+      // open more.
+      Http2GoawayFrame goaway;
+      goaway.last_stream_id = last_stream_id_;
+      goaway.error_code = GRPC_HTTP2_NO_ERROR;
+      goaway.debug_data = Slice::FromCopiedString(op->goaway_error.message());
+      QueueFrameLocked(std::move(goaway));
+      did_stuff = true;
+    }
+    if (!op->disconnect_with_error.ok()) {
+      cancelled_party = std::move(party_);
+      abort = true;
+      did_stuff = true;
+    }
+    if (!did_stuff) {
+      Crash(absl::StrCat("unimplemented transport perform op: ",
+                         grpc_transport_op_string(op)));
+    }
+  }
+  if (abort) AbortWithError();
+  ExecCtx::Run(DEBUG_LOCATION, op->on_consumed, absl::OkStatus());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Calls
+
+auto Http2ServerTransport::CallInboundLoop(RefCountedPtr<Stream> stream) {
+  return Loop([this, stream = std::move(stream)]() {
+    return TrySeq(
+        Map(stream->incoming.Next(),
+            [](ValueOrFailure<IncomingEvent> event)
+                -> absl::StatusOr<IncomingEvent> {
+              if (!event.ok()) return absl::CancelledError("Stream closed.");
+              return std::move(event.value());
+            }),
+        [this, stream](IncomingEvent event) {
+          auto* message = std::get_if<IncomingMessage>(&event);
+          return If(
+              message != nullptr,
+              [this, &stream, message]() {
+                return Map(
+                    stream->call.PushMessage(std::move(message->message)),
+                    [this, stream, window_bytes = message->window_bytes](
+                        StatusFlag pushed) -> LoopCtl<absl::Status> {
+                      OnMessageConsumed(*stream, window_bytes);
+                      if (!pushed.ok()) return absl::CancelledError();
+                      return Continue{};
+                    });
+              },
+              // The client closed its side, with DATA or with trailers.
+              [&stream]() -> LoopCtl<absl::Status> {
+                stream->call.FinishSends();
+                return absl::OkStatus();
+              });
+        });
+  });
+}
+
+auto Http2ServerTransport::CallOutboundLoop(RefCountedPtr<Stream> stream) {
+  return Seq(
+      Map(TrySeq(stream->call.PullServerInitialMetadata(),
+                 [this, stream](std::optional<ServerMetadataHandle> metadata) {
+                   return If(
+                       metadata.has_value(),
+                       [this, &stream, &metadata]() {
+                         stream->sent_initial_metadata = true;
+                         return TrySeq(
+                             SendFrame(Http2OutgoingHeaders{
+                                 stream->stream_id, /*end_stream=*/false,
+                                 std::move(*metadata)}),
+                             ForEach(MessagesFrom(stream->call),
+                                     [this, stream](MessageHandle message) {
+                                       return SendMessage(stream,
+                                                          std::move(message));
+                                     }));
+                       },
+                       []() { return absl::OkStatus(); });
+                 }),
+          [stream](absl::Status status) {
+            GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+                << "PH2: Server stream " << stream->stream_id
+                << " sent its body: " << status;
+            return Empty{};
+          }),
+      stream->call.PullServerTrailingMetadata(),
+      [this, stream](ServerMetadataHandle trailers) {
+        const uint32_t stream_id = stream->stream_id;
+        if (trailers->get(GrpcCallWasCancelled()).value_or(false)) {
+          SendRstStream(stream_id, GRPC_HTTP2_CANCEL);
+          return absl::CancelledError();
+        }
+        // A call without initial metadata answers with trailers only, which
+        // are the stream's one header block.
+        if (!stream->sent_initial_metadata) {
+          trailers->Set(HttpStatusMetadata(), 200);
+        }
+        bool client_closed;
+        {
+          MutexLock lock(&mu_);
+          stream->sent_end_stream = true;
+          client_closed = stream->received_end_stream;
+        }
+        if (!outgoing_frames_.MakeSender().UnbufferedImmediateSend(
+                Http2OutgoingHeaders{stream_id, /*end_stream=*/true,
+                                     std::move(trailers)})) {
+          return absl::UnavailableError("Transport closed.");
+        }
+        // The response is complete: the client has nothing more to send.
+        if (!client_closed) SendRstStream(stream_id, GRPC_HTTP2_NO_ERROR);
+        return absl::OkStatus();
+      });
+}
+
+absl::Status Http2ServerTransport::NewStream(uint32_t stream_id,
+                                             ClientMetadataHandle metadata,
+                                             bool end_stream) {
+  RefCountedPtr<Arena> arena(call_arena_allocator_->MakeArena());
+  arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+      event_engine_.get());
+  auto call = MakeCallPair(std::move(metadata), std::move(arena));
+  auto stream = MakeRefCounted<Stream>(call.initiator);
+  stream->stream_id = stream_id;
+  {
+    SendingLock lock(this);
+    if (state_tracker_.state() == GRPC_CHANNEL_SHUTDOWN) {
+      return absl::UnavailableError("Transport closed.");
+    }
+    last_stream_id_ = stream_id;
+    if (stream_count() >= local_settings().max_concurrent_streams()) {
+      GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+          << "PH2: Refusing stream " << stream_id;
+      QueueFrameLocked(
+          Http2RstStreamFrame{stream_id, GRPC_HTTP2_REFUSED_STREAM});
+      return absl::OkStatus();
+    }
+    stream->received_end_stream = end_stream;
+    AddStreamLocked(stream);
+  }
+  const bool on_done_added = call.initiator.OnDone(
+      [self = RefAsSubclass<Http2ServerTransport>(),
+       stream_id](bool cancelled) {
+        GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+            << "PH2: Server call " << self.get() << " id=" << stream_id
+            << " done: cancelled=" << cancelled;
+        if (self->RemoveStream(stream_id) != nullptr && cancelled) {
+          self->SendRstStream(stream_id, GRPC_HTTP2_CANCEL);
+        }
+      });
+  if (!on_done_added) {
+    RemoveStream(stream_id);
+    return absl::OkStatus();
+  }
+  if (end_stream) {
+    stream->incoming.MakeSender().UnbufferedImmediateSend(
+        IncomingEndOfStream{});
+  }
+  call.initiator.SpawnGuarded(
+      "server-read",
+      [self = RefAsSubclass<Http2ServerTransport>(), stream]() mutable {
+        return self->CallInboundLoop(std::move(stream));
+      });
+  call.initiator.SpawnGuarded(
+      "server-write",
+      [self = RefAsSubclass<Http2ServerTransport>(), stream = std::move(stream),
+       call_handler = std::move(call.handler)]() mutable {
+        self->call_destination_->StartCall(std::move(call_handler));
+        return self->CallOutboundLoop(std::move(stream));
+      });
+  return absl::OkStatus();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Read loop callbacks
 
-void Http2ServerTransport::PerformOp(GRPC_UNUSED grpc_transport_op*) {}
+absl::Status Http2ServerTransport::OnIncomingHeaders(
+    uint32_t stream_id, Arena::PoolPtr<grpc_metadata_batch> metadata,
+    bool end_stream) {
+  if (auto stream = LookupStream(stream_id); stream != nullptr) {
+    // Trailers: gRPC clients send none, but they still end the stream.
+    if (!end_stream) {
+      return absl::InternalError(absl::StrCat(
+          "Unexpected header block without END_STREAM on stream ", stream_id));
+    }
+    {
+      MutexLock lock(&mu_);
+      stream->received_end_stream = true;
+    }
+    stream->incoming.MakeSender().UnbufferedImmediateSend(
+        IncomingEndOfStream{});
+    return absl::OkStatus();
+  }
+  uint32_t last_stream_id;
+  {
+    MutexLock lock(&mu_);
+    last_stream_id = last_stream_id_;
+  }
+  if (stream_id % 2 == 0 || stream_id <= last_stream_id) {
+    return absl::InternalError(
+        absl::StrCat("Invalid stream id ", stream_id, " for a new stream"));
+  }
+  return NewStream(stream_id, std::move(metadata), end_stream);
+}
 
-void Http2ServerTransport::Orphan() {}
+uint32_t Http2ServerTransport::LastPeerStreamId() {
+  MutexLock lock(&mu_);
+  return last_stream_id_;
+}
 
-void Http2ServerTransport::AbortWithError() {}
+void Http2ServerTransport::OnStreamReset(RefCountedPtr<StreamState> stream,
+                                         uint32_t /*error_code*/) {
+  DownCast<Stream&>(*stream).call.SpawnCancel();
+}
 
 }  // namespace http2
 }  // namespace grpc_core
@@ -19,10 +19,21 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_SERVER_TRANSPORT_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_SERVER_TRANSPORT_H
 
-#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
-#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "src/core/ext/transport/chttp2/transport/http2_transport.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/transport/call_arena_allocator.h"
+#include "src/core/lib/transport/call_destination.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted_ptr.h"
 
 namespace grpc_core {
 namespace http2 {
@@ -33,13 +44,14 @@ namespace http2 {
 // familiar with the PH2 project (Moving chttp2 to promises.)
 // TODO(tjagtap) : [PH2][P3] : Delete this comment when http2
 // rollout begins
-class Http2ServerTransport final : public ServerTransport {
+class Http2ServerTransport final : public ServerTransport,
+                                   private Http2Transport {
  public:
   Http2ServerTransport(
-      GRPC_UNUSED PromiseEndpoint endpoint, GRPC_UNUSED const ChannelArgs& args,
-      GRPC_UNUSED std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-          event_engine) {}
-  ~Http2ServerTransport() override {};
+      PromiseEndpoint endpoint, const ChannelArgs& channel_args,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  ~Http2ServerTransport() override;
 
   FilterStackTransport* filter_stack_transport() override { return nullptr; }
   ClientTransport* client_transport() override { return nullptr; }
@@ -54,7 +66,34 @@ class Http2ServerTransport final : public ServerTransport {
   void PerformOp(grpc_transport_op*) override;
 
   void Orphan() override;
-  void AbortWithError();
+  void AbortWithError() override;
+
+ private:
+  struct Stream final : public StreamState {
+    explicit Stream(CallInitiator call) : call(std::move(call)) {}
+    CallInitiator call;
+    // Only touched by the call's outbound loop.
+    bool sent_initial_metadata = false;
+  };
+
+  auto CallOutboundLoop(RefCountedPtr<Stream> stream);
+  auto CallInboundLoop(RefCountedPtr<Stream> stream);
+  // Starts a call for a stream the client opened.
+  absl::Status NewStream(uint32_t stream_id, ClientMetadataHandle metadata,
+                         bool end_stream);
+
+  absl::Status OnIncomingHeaders(uint32_t stream_id,
+                                 Arena::PoolPtr<grpc_metadata_batch> metadata,
+                                 bool end_stream) override;
+  void OnStreamReset(RefCountedPtr<StreamState> stream,
+                     uint32_t error_code) override;
+  uint32_t LastPeerStreamId() override;
+
+  const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
+  // The largest stream id the client opened.
+  uint32_t last_stream_id_ ABSL_GUARDED_BY(mu_) = 0;
+  RefCountedPtr<UnstartedCallDestination> call_destination_;
+  RefCountedPtr<Party> party_ ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace http2
@@ -0,0 +1,864 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/ext/transport/chttp2/transport/http2_transport.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "absl/log/log.h"
+#include "absl/random/bit_gen_ref.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/race.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/sleep.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/http2_errors.h"
+#include "src/core/lib/transport/message.h"
+#include "src/core/lib/transport/metadata_info.h"
+#include "src/core/lib/transport/status_conversion.h"
+#include "src/core/util/match.h"
+#include "src/core/util/status_helper.h"
+
+namespace grpc_core {
+namespace http2 {
+
+namespace {
+
+// The connection preface a client starts with (RFC9113 section 3.4).
+constexpr absl::string_view kConnectionPreface =
+    "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+// gRPC messages are prefixed with a flags byte and a 32 bit length.
+constexpr size_t kGrpcMessageHeaderSize = 5;
+// Header blocks may be compressed, but not to the point of being much larger
+// than the metadata they carry.
+constexpr uint32_t kHeaderBlockToMetadataRatio = 2;
+
+// A connection error (RFC9113 section 5.4.1): the read loop ends, and the peer
+// is sent GOAWAY with error_code.
+absl::Status ConnectionError(grpc_http2_error_code error_code,
+                             absl::string_view message) {
+  return grpc_error_set_int(absl::InternalError(message),
+                            StatusIntProperty::kHttp2Error, error_code);
+}
+
+MemoryOwner MakeMemoryOwner(const ChannelArgs& args) {
+  auto* resource_quota = args.GetObject<ResourceQuota>();
+  if (resource_quota == nullptr) {
+    return ResourceQuota::Default()->memory_quota()->CreateMemoryOwner();
+  }
+  return resource_quota->memory_quota()->CreateMemoryOwner();
+}
+
+}  // namespace
+
+uint64_t OutgoingFrameBytes(const Http2OutgoingFrame& frame) {
+  return kFrameHeaderSize +
+         Match(
+             frame,
+             [](const Http2Frame& frame) -> uint64_t {
+               const auto* data = std::get_if<Http2DataFrame>(&frame);
+               return data == nullptr ? 0 : data->payload.Length();
+             },
+             [](const Http2OutgoingHeaders&) -> uint64_t { return 0; });
+}
+
+Http2Transport::Http2Transport(
+    PromiseEndpoint endpoint, const ChannelArgs& channel_args,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    bool is_client)
+    : is_client_(is_client),
+      event_engine_(std::move(event_engine)),
+      outgoing_frames_(kOutgoingFrameQueueBytes),
+      state_tracker_(is_client ? "http2_client" : "http2_server",
+                     GRPC_CHANNEL_READY),
+      endpoint_(std::move(endpoint)),
+      memory_owner_(MakeMemoryOwner(channel_args)),
+      metadata_soft_limit_(GetSoftLimitFromChannelArgs(channel_args)),
+      metadata_hard_limit_(GetHardLimitFromChannelArgs(channel_args)),
+      keepalive_time_(
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
+              .value_or(is_client ? Duration::Infinity() : Duration::Hours(2))),
+      keepalive_timeout_(
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIMEOUT_MS)
+              .value_or(Duration::Seconds(20))),
+      keepalive_permit_without_calls_(
+          channel_args.GetBool(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS)
+              .value_or(false)),
+      ping_abuse_policy_(channel_args),
+      flow_control_(is_client ? "http2_client" : "http2_server",
+                    /*enable_bdp_probe=*/false, &memory_owner_) {
+  if (auto size =
+          channel_args.GetInt(GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER);
+      size.has_value()) {
+    encoder_.SetMaxUsableSize(std::max(0, *size));
+  }
+  SendingLock lock(this);
+  Http2Settings& local = settings_.mutable_local();
+  local.SetInitialWindowSize(flow_control_.queued_init_window());
+  local.SetMaxHeaderListSize(metadata_hard_limit_);
+  local.SetAllowTrueBinaryMetadata(true);
+  if (is_client) local.SetEnablePush(false);
+  if (auto size = channel_args.GetInt(GRPC_ARG_HTTP2_MAX_FRAME_SIZE);
+      size.has_value()) {
+    local.SetMaxFrameSize(std::max(0, *size));
+  }
+  if (auto size =
+          channel_args.GetInt(GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_DECODER);
+      size.has_value()) {
+    local.SetHeaderTableSize(std::max(0, *size));
+  }
+  if (auto streams = channel_args.GetInt(GRPC_ARG_MAX_CONCURRENT_STREAMS);
+      !is_client && streams.has_value()) {
+    local.SetMaxConcurrentStreams(std::max(0, *streams));
+  }
+  // The first SETTINGS frame goes out ahead of anything else.
+  MaybeSendSettingsLocked();
+}
+
+auto Http2Transport::OnLoopDone(absl::string_view what,
+                                RefCountedPtr<Transport> transport) {
+  return [this, what, transport = std::move(transport)](absl::Status status) {
+    GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+        << "PH2: " << (is_client_ ? "Client" : "Server") << " transport "
+        << transport.get() << " closed (via " << what << "): " << status;
+    AbortWithError();
+  };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Writing
+
+auto Http2Transport::WriteLoop() {
+  return Loop([this]() {
+    return TrySeq(
+        // Everything queued since the last write goes out in one write.
+        outgoing_frames_.NextBatch(),
+        [this](std::vector<Http2OutgoingFrame> frames) {
+          return endpoint_.Write(SerializeFrames(std::move(frames)));
+        },
+        []() -> LoopCtl<absl::Status> { return Continue{}; });
+  });
+}
+
+SliceBuffer Http2Transport::SerializeFrames(
+    std::vector<Http2OutgoingFrame> frames) {
+  SliceBuffer output;
+  if (is_client_ && !sent_preface_) {
+    output.Append(Slice::FromStaticString(kConnectionPreface));
+    sent_preface_ = true;
+  }
+  uint32_t max_frame_size;
+  bool use_true_binary_metadata;
+  std::optional<uint32_t> encoder_table_size;
+  {
+    MutexLock lock(&mu_);
+    max_frame_size = settings_.peer().max_frame_size();
+    use_true_binary_metadata = settings_.peer().allow_true_binary_metadata();
+    encoder_table_size =
+        std::exchange(pending_encoder_table_size_, std::nullopt);
+  }
+  if (encoder_table_size.has_value()) {
+    encoder_.SetMaxTableSize(*encoder_table_size);
+  }
+  bool sends_headers_or_data = false;
+  std::vector<Http2Frame> run;
+  auto flush_run = [&run, &output]() {
+    if (run.empty()) return;
+    Serialize(absl::MakeSpan(run), output);
+    run.clear();
+  };
+  for (auto& frame : frames) {
+    MatchMutable(
+        &frame,
+        [&](Http2Frame* frame) {
+          if (std::holds_alternative<Http2DataFrame>(*frame)) {
+            sends_headers_or_data = true;
+          }
+          run.push_back(std::move(*frame));
+        },
+        [&](Http2OutgoingHeaders* headers) {
+          sends_headers_or_data = true;
+          flush_run();
+          encoder_.EncodeHeaders(
+              HPackCompressor::EncodeHeaderOptions{
+                  headers->stream_id, headers->end_stream,
+                  use_true_binary_metadata, max_frame_size, nullptr},
+              *headers->metadata, output.c_slice_buffer());
+        });
+  }
+  {
+    // Window updates that could wait ride along with this write.
+    MutexLock lock(&mu_);
+    if (!is_client_ && sends_headers_or_data) {
+      ping_abuse_policy_.ResetPingStrikes();
+    }
+    for (uint32_t stream_id : queued_window_updates_) {
+      auto it = streams_.find(stream_id);
+      if (it == streams_.end() || it->second->closed) continue;
+      const uint32_t announce = it->second->flow_control->MaybeSendUpdate();
+      if (announce > 0) {
+        run.push_back(Http2WindowUpdateFrame{stream_id, announce});
+      }
+    }
+    queued_window_updates_.clear();
+    const uint32_t announce = flow_control_.MaybeSendUpdate(true);
+    if (announce > 0) run.push_back(Http2WindowUpdateFrame{0, announce});
+  }
+  flush_run();
+  return output;
+}
+
+void Http2Transport::QueueFrame(Http2Frame frame) {
+  outgoing_frames_.MakeSender().UnbufferedImmediateSend(std::move(frame));
+}
+
+void Http2Transport::QueueFrameLocked(Http2Frame frame) {
+  frames_to_queue_.push_back(std::move(frame));
+}
+
+Http2Transport::SendingLock::SendingLock(Http2Transport* transport)
+    : transport_(transport) {
+  transport_->mu_.Lock();
+}
+
+Http2Transport::SendingLock::~SendingLock() {
+  std::vector<Http2Frame> frames = std::move(transport_->frames_to_queue_);
+  transport_->frames_to_queue_.clear();
+  transport_->mu_.Unlock();
+  for (auto& frame : frames) transport_->QueueFrame(std::move(frame));
+}
+
+void Http2Transport::SendRstStream(uint32_t stream_id, uint32_t error_code) {
+  QueueFrame(Http2RstStreamFrame{stream_id, error_code});
+}
+
+void Http2Transport::MaybeSendSettingsLocked() {
+  auto frame = settings_.MaybeSendUpdate();
+  if (!frame.has_value()) return;
+  flow_control_.FlushedSettings();
+  QueueFrameLocked(std::move(*frame));
+}
+
+SliceBuffer Http2Transport::FrameMessage(MessageHandle message) {
+  SliceBuffer framed;
+  const uint32_t length = message->payload()->Length();
+  uint8_t* header = framed.AddTiny(kGrpcMessageHeaderSize);
+  header[0] = (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) ? 1 : 0;
+  header[1] = static_cast<uint8_t>(length >> 24);
+  header[2] = static_cast<uint8_t>(length >> 16);
+  header[3] = static_cast<uint8_t>(length >> 8);
+  header[4] = static_cast<uint8_t>(length);
+  framed.TakeAndAppend(*message->payload());
+  return framed;
+}
+
+Poll<absl::StatusOr<uint32_t>> Http2Transport::PollSendWindow(
+    StreamState& stream, size_t wanted) {
+  MutexLock lock(&mu_);
+  if (stream.closed) return absl::UnavailableError("Stream closed.");
+  const int64_t stream_window =
+      static_cast<int64_t>(settings_.peer().initial_window_size()) +
+      stream.flow_control->remote_window_delta();
+  const int64_t window = std::min(stream_window, flow_control_.remote_window());
+  if (window <= 0) {
+    Waker waker = GetContext<Activity>()->MakeNonOwningWaker();
+    if (stream_window <= 0) {
+      stream.send_window_waker = std::move(waker);
+    } else {
+      transport_window_waiters_[&stream] = std::move(waker);
+    }
+    return Pending{};
+  }
+  const uint32_t allowed = static_cast<uint32_t>(
+      std::min({window, static_cast<int64_t>(wanted),
+                static_cast<int64_t>(settings_.peer().max_frame_size())}));
+  chttp2::StreamFlowControl::OutgoingUpdateContext(&*stream.flow_control)
+      .SentData(allowed);
+  return allowed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reading
+
+auto Http2Transport::ReadPreface() {
+  return If(
+      is_client_, []() { return absl::OkStatus(); },
+      [this]() {
+        return TrySeq(endpoint_.ReadSlice(kConnectionPreface.size()),
+                      [](Slice preface) -> absl::Status {
+                        if (preface.as_string_view() != kConnectionPreface) {
+                          return absl::InternalError(
+                              "Bad HTTP2 connection preface");
+                        }
+                        return absl::OkStatus();
+                      });
+      });
+}
+
+auto Http2Transport::MaybeSendGoawayForError(absl::Status status) {
+  intptr_t error_code = GRPC_HTTP2_NO_ERROR;
+  const bool connection_error =
+      !status.ok() &&
+      grpc_error_get_int(status, StatusIntProperty::kHttp2Error, &error_code);
+  return If(
+      connection_error,
+      [this, status, error_code]() {
+        Http2GoawayFrame goaway;
+        goaway.last_stream_id = LastPeerStreamId();
+        goaway.error_code = static_cast<uint32_t>(error_code);
+        goaway.debug_data = Slice::FromCopiedString(status.message());
+        // The transport aborts once the read loop ends, dropping whatever the
+        // write loop has not taken yet, so wait for it to take the GOAWAY.
+        return Map(outgoing_frames_.MakeSender().SendAcked(
+                       Http2Frame(std::move(goaway))),
+                   [status](bool) { return status; });
+      },
+      [status]() { return status; });
+}
+
+auto Http2Transport::ReadLoop() {
+  auto read_frames = Loop([this]() {
+    return TrySeq(
+        endpoint_.ReadSlice(kFrameHeaderSize),
+        [this](Slice header) -> absl::Status {
+          read_header_ = Http2FrameHeader::Parse(header.begin());
+          MutexLock lock(&mu_);
+          if (read_header_.length > settings_.local().max_frame_size()) {
+            return absl::InternalError(
+                absl::StrCat("Frame larger than SETTINGS_MAX_FRAME_SIZE: ",
+                             read_header_.ToString()));
+          }
+          return absl::OkStatus();
+        },
+        [this]() { return endpoint_.Read(read_header_.length); },
+        [this](SliceBuffer payload) {
+          auto frame = ParseFramePayload(read_header_, std::move(payload));
+          if (!frame.ok()) return frame.status();
+          return ProcessFrame(std::move(*frame));
+        },
+        []() -> LoopCtl<absl::Status> { return Continue{}; });
+  });
+  return Seq(TrySeq(ReadPreface(), std::move(read_frames)),
+             [this](absl::Status status) {
+               return MaybeSendGoawayForError(std::move(status));
+             });
+}
+
+absl::Status Http2Transport::ProcessFrame(Http2Frame frame) {
+  if (pending_header_block_.has_value() &&
+      !std::holds_alternative<Http2ContinuationFrame>(frame)) {
+    return absl::InternalError("Expected a CONTINUATION frame");
+  }
+  return MatchMutable(
+      &frame,
+      [this](Http2DataFrame* frame) { return ProcessData(std::move(*frame)); },
+      [this](Http2HeaderFrame* frame) {
+        if (frame->end_headers) {
+          return ProcessHeaderBlock(frame->stream_id,
+                                    std::move(frame->payload),
+                                    frame->end_stream);
+        }
+        pending_header_block_.emplace(PendingHeaderBlock{
+            frame->stream_id, frame->end_stream, std::move(frame->payload)});
+        return absl::OkStatus();
+      },
+      [this](Http2ContinuationFrame* frame) {
+        if (!pending_header_block_.has_value() ||
+            pending_header_block_->stream_id != frame->stream_id) {
+          return absl::InternalError("Unexpected CONTINUATION frame");
+        }
+        pending_header_block_->block.TakeAndAppend(frame->payload);
+        if (pending_header_block_->block.Length() >
+            static_cast<size_t>(metadata_hard_limit_) *
+                kHeaderBlockToMetadataRatio) {
+          return absl::InternalError("Header block too large");
+        }
+        if (!frame->end_headers) return absl::OkStatus();
+        PendingHeaderBlock block = std::move(*pending_header_block_);
+        pending_header_block_.reset();
+        return ProcessHeaderBlock(block.stream_id, std::move(block.block),
+                                  block.end_stream);
+      },
+      [this](Http2RstStreamFrame* frame) { return ProcessRstStream(*frame); },
+      [this](Http2SettingsFrame* frame) {
+        return ProcessSettings(std::move(*frame));
+      },
+      [this](Http2PingFrame* frame) { return ProcessPing(*frame); },
+      [this](Http2GoawayFrame* frame) {
+        return ProcessGoaway(std::move(*frame));
+      },
+      [this](Http2WindowUpdateFrame* frame) {
+        return ProcessWindowUpdate(*frame);
+      },
+      [](Http2SecurityFrame*) { return absl::OkStatus(); },
+      [](Http2UnknownFrame*) { return absl::OkStatus(); });
+}
+
+absl::Status Http2Transport::ProcessData(Http2DataFrame frame) {
+  const int64_t length = frame.payload.Length();
+  std::vector<IncomingEvent> events;
+  RefCountedPtr<StreamState> stream;
+  absl::Status status;
+  {
+    SendingLock lock(this);
+    auto it = streams_.find(frame.stream_id);
+    if (it == streams_.end() || it->second->received_end_stream) {
+      // The stream is gone, but its bytes still count against the
+      // connection window.
+      chttp2::TransportFlowControl::IncomingUpdateContext update(
+          &flow_control_);
+      status = update.RecvData(length);
+      ActOnFlowControlActionLocked(update.MakeAction(), nullptr);
+      return status;
+    }
+    stream = it->second;
+    chttp2::StreamFlowControl::IncomingUpdateContext update(
+        &*stream->flow_control);
+    status = update.RecvData(length);
+    if (status.ok()) {
+      stream->partial_message.TakeAndAppend(frame.payload);
+      while (true) {
+        if (!stream->partial_message_length.has_value()) {
+          if (stream->partial_message.Length() < kGrpcMessageHeaderSize) break;
+          uint8_t header[kGrpcMessageHeaderSize];
+          stream->partial_message.MoveFirstNBytesIntoBuffer(
+              kGrpcMessageHeaderSize, header);
+          stream->partial_message_flags = header[0];
+          stream->partial_message_length =
+              (static_cast<uint32_t>(header[1]) << 24) |
+              (static_cast<uint32_t>(header[2]) << 16) |
+              (static_cast<uint32_t>(header[3]) << 8) |
+              static_cast<uint32_t>(header[4]);
+        }
+        const uint32_t message_length = *stream->partial_message_length;
+        if (stream->partial_message.Length() < message_length) break;
+        SliceBuffer payload;
+        stream->partial_message.MoveFirstNBytesIntoSliceBuffer(message_length,
+                                                               payload);
+        stream->partial_message_length.reset();
+        // The window of a message is only returned once the call took it, so
+        // a call that stops reading stops its peer. Bytes of a message that is
+        // still incomplete are returned right away, or a message larger than
+        // the window could never complete.
+        const uint32_t window_bytes = kGrpcMessageHeaderSize + message_length;
+        stream->unconsumed_bytes += window_bytes;
+        events.emplace_back(IncomingMessage{
+            Arena::MakePooled<Message>(
+                std::move(payload), (stream->partial_message_flags & 1)
+                                        ? GRPC_WRITE_INTERNAL_COMPRESS
+                                        : 0u),
+            window_bytes});
+      }
+      if (frame.end_stream) {
+        stream->received_end_stream = true;
+        events.emplace_back(IncomingEndOfStream{});
+      }
+    }
+    update.SetPendingSize(stream->unconsumed_bytes);
+    ActOnFlowControlActionLocked(update.MakeAction(), stream.get());
+  }
+  for (auto& event : events) {
+    stream->incoming.MakeSender().UnbufferedImmediateSend(std::move(event));
+  }
+  return status;
+}
+
+absl::Status Http2Transport::ProcessHeaderBlock(uint32_t stream_id,
+                                                SliceBuffer block,
+                                                bool end_stream) {
+  auto metadata = Arena::MakePooledForOverwrite<grpc_metadata_batch>();
+  parser_.BeginFrame(
+      metadata.get(), metadata_soft_limit_, metadata_hard_limit_,
+      end_stream ? HPackParser::Boundary::EndOfStream
+                 : HPackParser::Boundary::EndOfHeaders,
+      HPackParser::Priority::None,
+      HPackParser::LogInfo{stream_id,
+                           is_client_ ? HPackParser::LogInfo::kDontKnow
+                                      : HPackParser::LogInfo::kHeaders,
+                           is_client_});
+  // The whole block is parsed even after an error, to keep the HPACK table in
+  // step with the peer's.
+  absl::Status error;
+  if (block.Count() == 0) {
+    error = parser_.Parse(grpc_empty_slice(), true, absl::BitGenRef(bitgen_),
+                          nullptr);
+  }
+  for (size_t i = 0; i < block.Count(); ++i) {
+    absl::Status slice_error =
+        parser_.Parse(block.c_slice_at(i), i + 1 == block.Count(),
+                      absl::BitGenRef(bitgen_), nullptr);
+    if (error.ok()) error = std::move(slice_error);
+  }
+  parser_.FinishFrame();
+  if (!error.ok()) {
+    intptr_t unused;
+    if (!grpc_error_get_int(error, StatusIntProperty::kStreamId, &unused)) {
+      return error;
+    }
+    // A stream error, for instance metadata over the hard limit: only this
+    // stream goes.
+    GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+        << "PH2: Resetting stream " << stream_id << ": " << error;
+    const uint32_t error_code =
+        grpc_status_to_http2_error(static_cast<grpc_status_code>(error.code()));
+    SendRstStream(stream_id, error_code);
+    auto stream = RemoveStream(stream_id);
+    if (stream != nullptr) OnStreamReset(std::move(stream), error_code);
+    return absl::OkStatus();
+  }
+  return OnIncomingHeaders(stream_id, std::move(metadata), end_stream);
+}
+
+absl::Status Http2Transport::ProcessSettings(Http2SettingsFrame frame) {
+  std::vector<Waker> wakers;
+  {
+    SendingLock lock(this);
+    if (frame.ack) {
+      if (!settings_.AckLastSend()) {
+        return absl::InternalError("Unexpected SETTINGS ACK");
+      }
+      parser_.hpack_table()->SetMaxBytes(settings_.acked().header_table_size());
+      ActOnFlowControlActionLocked(
+          flow_control_.SetAckedInitialWindow(
+              settings_.acked().initial_window_size()),
+          nullptr);
+      return absl::OkStatus();
+    }
+    const Http2Settings old = settings_.peer();
+    for (const auto& setting : frame.settings) {
+      const grpc_http2_error_code error =
+          settings_.mutable_peer().Apply(setting.id, setting.value);
+      if (error != GRPC_HTTP2_NO_ERROR) {
+        return absl::InternalError(absl::StrCat(
+            "Invalid value ", setting.value, " for setting ", setting.id));
+      }
+    }
+    const Http2Settings& peer = settings_.peer();
+    if (peer.header_table_size() != old.header_table_size()) {
+      pending_encoder_table_size_ = peer.header_table_size();
+    }
+    // A new initial window resizes the window of every stream.
+    if (peer.initial_window_size() != old.initial_window_size()) {
+      for (auto& [stream_id, stream] : streams_) {
+        wakers.push_back(std::move(stream->send_window_waker));
+      }
+    }
+    if (peer.max_concurrent_streams() != old.max_concurrent_streams()) {
+      TakeWakers(stream_slot_waiters_, wakers);
+    }
+    Http2SettingsFrame ack;
+    ack.ack = true;
+    QueueFrameLocked(std::move(ack));
+  }
+  for (auto& waker : wakers) waker.Wakeup();
+  return absl::OkStatus();
+}
+
+absl::Status Http2Transport::ProcessPing(Http2PingFrame frame) {
+  if (!frame.ack) {
+    if (!is_client_) {
+      MutexLock lock(&mu_);
+      const bool transport_idle =
+          !keepalive_permit_without_calls_ && streams_.empty();
+      GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+          << "PH2: Server received ping " << frame.opaque << ": "
+          << ping_abuse_policy_.GetDebugString(transport_idle);
+      if (ping_abuse_policy_.ReceivedOnePing(transport_idle)) {
+        return ConnectionError(GRPC_HTTP2_ENHANCE_YOUR_CALM, "too_many_pings");
+      }
+    }
+    QueueFrame(Http2PingFrame{true, frame.opaque});
+    return absl::OkStatus();
+  }
+  Waker waker;
+  {
+    MutexLock lock(&mu_);
+    if (frame.opaque != keepalive_ping_ || keepalive_ping_acked_) {
+      return absl::OkStatus();
+    }
+    keepalive_ping_acked_ = true;
+    waker = std::move(keepalive_waker_);
+  }
+  waker.Wakeup();
+  return absl::OkStatus();
+}
+
+absl::Status Http2Transport::ProcessWindowUpdate(Http2WindowUpdateFrame frame) {
+  // RFC9113 section 6.9: an increment of 0 is a PROTOCOL_ERROR, and a window
+  // over 2^31-1 a FLOW_CONTROL_ERROR. Both are stream errors for a stream's
+  // window.
+  std::vector<Waker> wakers;
+  grpc_http2_error_code stream_error = GRPC_HTTP2_NO_ERROR;
+  {
+    MutexLock lock(&mu_);
+    if (frame.stream_id == 0) {
+      if (frame.increment == 0) {
+        return ConnectionError(GRPC_HTTP2_PROTOCOL_ERROR,
+                               "WINDOW_UPDATE with an increment of 0");
+      }
+      chttp2::TransportFlowControl::OutgoingUpdateContext(&flow_control_)
+          .RecvUpdate(frame.increment);
+      if (flow_control_.remote_window() > chttp2::kMaxWindow) {
+        return ConnectionError(GRPC_HTTP2_FLOW_CONTROL_ERROR,
+                               "Connection window over 2^31-1");
+      }
+      if (flow_control_.remote_window() > 0) {
+        TakeWakers(transport_window_waiters_, wakers);
+      }
+    } else {
+      auto it = streams_.find(frame.stream_id);
+      if (it != streams_.end() && !it->second->closed) {
+        StreamState& stream = *it->second;
+        if (frame.increment == 0) {
+          stream_error = GRPC_HTTP2_PROTOCOL_ERROR;
+        } else {
+          chttp2::StreamFlowControl::OutgoingUpdateContext(
+              &*stream.flow_control)
+              .RecvUpdate(frame.increment);
+          if (static_cast<int64_t>(settings_.peer().initial_window_size()) +
+                  stream.flow_control->remote_window_delta() >
+              chttp2::kMaxWindow) {
+            stream_error = GRPC_HTTP2_FLOW_CONTROL_ERROR;
+          } else {
+            wakers.push_back(std::move(stream.send_window_waker));
+          }
+        }
+      }
+    }
+  }
+  for (auto& waker : wakers) waker.Wakeup();
+  if (stream_error != GRPC_HTTP2_NO_ERROR) {
+    GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+        << "PH2: Resetting stream " << frame.stream_id
+        << " for WINDOW_UPDATE increment " << frame.increment;
+    SendRstStream(frame.stream_id, stream_error);
+    auto stream = RemoveStream(frame.stream_id);
+    if (stream != nullptr) OnStreamReset(std::move(stream), stream_error);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status Http2Transport::ProcessRstStream(Http2RstStreamFrame frame) {
+  auto stream = RemoveStream(frame.stream_id);
+  if (stream != nullptr) OnStreamReset(std::move(stream), frame.error_code);
+  return absl::OkStatus();
+}
+
+absl::Status Http2Transport::ProcessGoaway(Http2GoawayFrame frame) {
+  GRPC_TRACE_LOG(http2_ph2_transport, INFO)
+      << "PH2: GOAWAY last_stream_id=" << frame.last_stream_id
+      << " error_code=" << frame.error_code
+      << " debug_data=" << frame.debug_data.as_string_view();
+  OnGoaway(frame.last_stream_id);
+  return absl::OkStatus();
+}
+
+void Http2Transport::ActOnFlowControlActionLocked(
+    const chttp2::FlowControlAction& action, StreamState* stream) {
+  using Urgency = chttp2::FlowControlAction::Urgency;
+  if (stream != nullptr && !stream->closed) {
+    switch (action.send_stream_update()) {
+      case Urgency::NO_ACTION_NEEDED:
+        break;
+      case Urgency::QUEUE_UPDATE:
+        queued_window_updates_.insert(stream->stream_id);
+        break;
+      case Urgency::UPDATE_IMMEDIATELY: {
+        const uint32_t announce = stream->flow_control->MaybeSendUpdate();
+        if (announce > 0) {
+          QueueFrameLocked(Http2WindowUpdateFrame{stream->stream_id, announce});
+        }
+        break;
+      }
+    }
+  }
+  if (action.send_transport_update() == Urgency::UPDATE_IMMEDIATELY) {
+    const uint32_t announce = flow_control_.MaybeSendUpdate(false);
+    if (announce > 0) QueueFrameLocked(Http2WindowUpdateFrame{0, announce});
+  }
+  if (action.send_initial_window_update() != Urgency::NO_ACTION_NEEDED) {
+    settings_.mutable_local().SetInitialWindowSize(
+        action.initial_window_size());
+  }
+  if (action.send_max_frame_size_update() != Urgency::NO_ACTION_NEEDED) {
+    settings_.mutable_local().SetMaxFrameSize(action.max_frame_size());
+  }
+  MaybeSendSettingsLocked();
+}
+
+void Http2Transport::OnMessageConsumed(StreamState& stream,
+                                       uint32_t window_bytes) {
+  SendingLock lock(this);
+  if (stream.closed) return;
+  stream.unconsumed_bytes -= window_bytes;
+  chttp2::StreamFlowControl::IncomingUpdateContext update(
+      &*stream.flow_control);
+  update.SetPendingSize(stream.unconsumed_bytes);
+  ActOnFlowControlActionLocked(update.MakeAction(), &stream);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Keepalive
+
+auto Http2Transport::KeepaliveLoop() {
+  return Loop([this]() {
+    return TrySeq(
+        Sleep(keepalive_time_),
+        [this]() {
+          uint64_t ping;
+          {
+            MutexLock lock(&mu_);
+            ping = ++keepalive_ping_;
+            keepalive_ping_acked_ = false;
+          }
+          QueueFrame(Http2PingFrame{false, ping});
+          return Race([this]() { return PollKeepaliveAck(); },
+                      Map(Sleep(keepalive_timeout_), [](absl::Status) {
+                        return absl::UnavailableError("Keepalive timeout");
+                      }));
+        },
+        []() -> LoopCtl<absl::Status> { return Continue{}; });
+  });
+}
+
+Poll<absl::Status> Http2Transport::PollKeepaliveAck() {
+  MutexLock lock(&mu_);
+  if (keepalive_ping_acked_) return absl::OkStatus();
+  keepalive_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
+  return Pending{};
+}
+
+void Http2Transport::SpawnWriteAndKeepaliveLoops(
+    Party* party, RefCountedPtr<Transport> transport) {
+  party->Spawn(
+      "http2-writer", [this]() { return WriteLoop(); },
+      OnLoopDone("write_loop", transport));
+  if (keepalive_time_ != Duration::Infinity()) {
+    party->Spawn(
+        "http2-keepalive", [this]() { return KeepaliveLoop(); },
+        OnLoopDone("keepalive_loop", transport));
+  }
+}
+
+void Http2Transport::SpawnReadLoop(Party* party,
+                                   RefCountedPtr<Transport> transport) {
+  // A read can complete frames for many calls: wake their parties together.
+  party->Spawn(
+      "http2-reader", [this]() { return WithWakeupBatch(ReadLoop()); },
+      OnLoopDone("read_loop", std::move(transport)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Streams
+
+void Http2Transport::AddStreamLocked(RefCountedPtr<StreamState> stream) {
+  stream->flow_control.emplace(&flow_control_);
+  const uint32_t stream_id = stream->stream_id;
+  streams_.emplace(stream_id, std::move(stream));
+}
+
+RefCountedPtr<Http2Transport::StreamState> Http2Transport::LookupStream(
+    uint32_t stream_id) {
+  MutexLock lock(&mu_);
+  auto it = streams_.find(stream_id);
+  if (it == streams_.end()) return nullptr;
+  return it->second;
+}
+
+void Http2Transport::TakeWakers(WaiterMap& waiters,
+                                std::vector<Waker>& wakers) {
+  for (auto& [stream, waker] : waiters) wakers.push_back(std::move(waker));
+  waiters.clear();
+}
+
+void Http2Transport::CloseStreamLocked(StreamState& stream,
+                                       std::vector<Waker>& wakers) {
+  stream.closed = true;
+  // The flow control of a stream points at the transport's, so it goes with
+  // the stream's place on the transport rather than with the stream.
+  stream.flow_control.reset();
+  wakers.push_back(std::move(stream.send_window_waker));
+}
+
+RefCountedPtr<Http2Transport::StreamState> Http2Transport::RemoveStream(
+    uint32_t stream_id) {
+  RefCountedPtr<StreamState> stream;
+  std::vector<Waker> wakers;
+  {
+    MutexLock lock(&mu_);
+    auto it = streams_.find(stream_id);
+    if (it == streams_.end()) return nullptr;
+    stream = std::move(it->second);
+    streams_.erase(it);
+    CloseStreamLocked(*stream, wakers);
+    TakeWakers(stream_slot_waiters_, wakers);
+  }
+  for (auto& waker : wakers) waker.Wakeup();
+  return stream;
+}
+
+Http2Transport::StreamMap Http2Transport::TakeStreams() {
+  StreamMap streams;
+  std::vector<Waker> wakers;
+  {
+    MutexLock lock(&mu_);
+    streams = std::move(streams_);
+    streams_.clear();
+    for (auto& [stream_id, stream] : streams) {
+      CloseStreamLocked(*stream, wakers);
+    }
+    TakeWakers(transport_window_waiters_, wakers);
+    TakeWakers(stream_slot_waiters_, wakers);
+  }
+  for (auto& waker : wakers) waker.Wakeup();
+  return streams;
+}
+
+std::vector<RefCountedPtr<Http2Transport::StreamState>>
+Http2Transport::RemoveStreamsAbove(uint32_t last_stream_id) {
+  std::vector<RefCountedPtr<StreamState>> removed;
+  std::vector<Waker> wakers;
+  {
+    MutexLock lock(&mu_);
+    for (auto it = streams_.begin(); it != streams_.end();) {
+      if (it->first <= last_stream_id) {
+        ++it;
+        continue;
+      }
+      CloseStreamLocked(*it->second, wakers);
+      removed.push_back(std::move(it->second));
+      streams_.erase(it++);
+    }
+    TakeWakers(stream_slot_waiters_, wakers);
+  }
+  for (auto& waker : wakers) waker.Wakeup();
+  return removed;
+}
+
+}  // namespace http2
+}  // namespace grpc_core
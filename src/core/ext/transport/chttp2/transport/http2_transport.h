@@ -0,0 +1,368 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_TRANSPORT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_TRANSPORT_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/ext/transport/chttp2/transport/http2_settings.h"
+#include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/mpsc.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/lib/transport/http2_errors.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace http2 {
+
+// Experimental : The connection level half of the promise based HTTP2
+// transport, shared by Http2ClientTransport and Http2ServerTransport.
+// TODO(tjagtap) : [PH2][P3] : Update the experimental status of the code before
+// http2 rollout begins.
+
+// A header block waiting in the outgoing frame queue. Header blocks are queued
+// as metadata and HPACK encoded by the write loop, so that they reach the
+// encoder's dynamic table in the order they go on the wire.
+struct Http2OutgoingHeaders {
+  uint32_t stream_id;
+  bool end_stream;
+  Arena::PoolPtr<grpc_metadata_batch> metadata;
+};
+
+using Http2OutgoingFrame = std::variant<Http2Frame, Http2OutgoingHeaders>;
+
+// Outgoing frames are charged against the outgoing frame queue by the bytes
+// they will put on the wire, so that a few large messages get the same
+// backpressure as many small ones.
+uint64_t OutgoingFrameBytes(const Http2OutgoingFrame& frame);
+
+// Bytes to buffer in the outgoing frame queue of a transport.
+inline constexpr size_t kOutgoingFrameQueueBytes = 1024 * 1024;
+
+}  // namespace http2
+
+template <>
+struct MpscTokens<http2::Http2OutgoingFrame> {
+  static uint64_t Of(const http2::Http2OutgoingFrame& frame) {
+    return http2::OutgoingFrameBytes(frame);
+  }
+};
+
+namespace http2 {
+
+// Reads, writes and keeps alive one HTTP2 connection: the frame loops, flow
+// control, SETTINGS, PING and HPACK state of the connection live here, and the
+// client and server transports map streams onto calls.
+class Http2Transport {
+ public:
+  Http2Transport(const Http2Transport&) = delete;
+  Http2Transport& operator=(const Http2Transport&) = delete;
+
+ protected:
+  // A gRPC message read from the DATA frames of a stream.
+  struct IncomingMessage {
+    MessageHandle message;
+    // Bytes of flow control window the message took, returned to the peer
+    // once the call has taken the message.
+    uint32_t window_bytes;
+  };
+  // A header block read for a stream.
+  struct IncomingHeaders {
+    Arena::PoolPtr<grpc_metadata_batch> metadata;
+    bool end_stream;
+  };
+  // The peer closed its side of the stream with a DATA frame.
+  struct IncomingEndOfStream {};
+  using IncomingEvent =
+      std::variant<IncomingMessage, IncomingHeaders, IncomingEndOfStream>;
+
+  // A stream of the connection. Unless noted, fields are guarded by the mu_
+  // of the transport the stream belongs to.
+  struct StreamState : public RefCounted<StreamState> {
+    StreamState() : incoming(1) {}
+
+    uint32_t stream_id = 0;
+    // Set while the stream is open on the transport.
+    std::optional<chttp2::StreamFlowControl> flow_control;
+    // The sender of the stream's DATA, while it waits for window.
+    Waker send_window_waker;
+    // Received bytes of a gRPC message that is not complete yet.
+    SliceBuffer partial_message;
+    std::optional<uint32_t> partial_message_length;
+    uint8_t partial_message_flags = 0;
+    // Window taken by messages that the call has not taken yet.
+    int64_t unconsumed_bytes = 0;
+    bool sent_end_stream = false;
+    bool received_end_stream = false;
+    bool closed = false;
+    // What the read loop read for the stream, in order. Drained by the call.
+    // Not guarded: the read loop sends and the call receives.
+    MpscReceiver<IncomingEvent> incoming;
+  };
+  using StreamMap = absl::flat_hash_map<uint32_t, RefCountedPtr<StreamState>>;
+  // Wakers of streams waiting for something, one per stream: a stream that
+  // is polled again while it waits replaces its waker.
+  using WaiterMap = absl::flat_hash_map<const StreamState*, Waker>;
+
+  Http2Transport(PromiseEndpoint endpoint, const ChannelArgs& channel_args,
+                 std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+                     event_engine,
+                 bool is_client);
+  virtual ~Http2Transport() = default;
+
+  // Spawns the write, read and keepalive loops of the connection on party.
+  // Each loop holds transport, and calls AbortWithError() when it ends. A
+  // server spawns its read loop separately, once it can accept calls.
+  void SpawnWriteAndKeepaliveLoops(Party* party,
+                                   RefCountedPtr<Transport> transport);
+  void SpawnReadLoop(Party* party, RefCountedPtr<Transport> transport);
+
+  virtual void AbortWithError() = 0;
+  // A header block arrived for stream_id. Runs on the read loop without mu_
+  // held. Errors are connection errors.
+  virtual absl::Status OnIncomingHeaders(
+      uint32_t stream_id, Arena::PoolPtr<grpc_metadata_batch> metadata,
+      bool end_stream) = 0;
+  // The peer reset stream, which has already been closed.
+  virtual void OnStreamReset(RefCountedPtr<StreamState> stream,
+                             uint32_t error_code) = 0;
+  // The peer sent GOAWAY.
+  virtual void OnGoaway(uint32_t /*last_stream_id*/) {}
+  // The last stream the peer opened, for the GOAWAY of a connection error.
+  virtual uint32_t LastPeerStreamId() ABSL_LOCKS_EXCLUDED(mu_) { return 0; }
+
+  // Registers stream under stream->stream_id.
+  void AddStreamLocked(RefCountedPtr<StreamState> stream)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  RefCountedPtr<StreamState> LookupStream(uint32_t stream_id)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  // Closes the stream and forgets it. Returns nullptr if it was gone already.
+  RefCountedPtr<StreamState> RemoveStream(uint32_t stream_id)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  // Closes and returns all streams, so that the transport can fail them.
+  StreamMap TakeStreams() ABSL_LOCKS_EXCLUDED(mu_);
+  // Closes and returns the streams that the peer will not process after a
+  // GOAWAY naming last_stream_id.
+  std::vector<RefCountedPtr<StreamState>> RemoveStreamsAbove(
+      uint32_t last_stream_id) ABSL_LOCKS_EXCLUDED(mu_);
+  // Sends RST_STREAM for stream_id.
+  void SendRstStream(uint32_t stream_id, uint32_t error_code);
+  // The call took a message of window_bytes from stream: give the window back.
+  void OnMessageConsumed(StreamState& stream, uint32_t window_bytes)
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Returns a promise that sends message on stream as DATA frames, as fast as
+  // flow control lets it. Resolves to an error if the stream or transport
+  // closes first.
+  auto SendMessage(RefCountedPtr<StreamState> stream, MessageHandle message) {
+    return Loop([this, stream = std::move(stream),
+                 payload = FrameMessage(std::move(message)),
+                 sender = outgoing_frames_.MakeSender()]() mutable {
+      return TrySeq(
+          [this, &stream, &payload]() {
+            return PollSendWindow(*stream, payload.Length());
+          },
+          [&stream, &payload, &sender](uint32_t allowed) {
+            Http2DataFrame frame;
+            frame.stream_id = stream->stream_id;
+            payload.MoveFirstNBytesIntoSliceBuffer(allowed, frame.payload);
+            return Map(sender.Send(Http2Frame(std::move(frame))),
+                       [&payload](bool sent) -> LoopCtl<absl::Status> {
+                         if (!sent) {
+                           return absl::UnavailableError("Transport closed.");
+                         }
+                         if (payload.Length() == 0) return absl::OkStatus();
+                         return Continue{};
+                       });
+          });
+    });
+  }
+  // Returns a promise that queues frame, resolving once the queue takes it.
+  auto SendFrame(Http2OutgoingFrame frame) {
+    return Map(outgoing_frames_.MakeSender().Send(std::move(frame)),
+               [](bool sent) {
+                 return sent ? absl::OkStatus()
+                             : absl::UnavailableError("Transport closed.");
+               });
+  }
+
+  // Holds mu_, and queues the frames of QueueFrameLocked() after releasing
+  // it: queueing a frame can run the write loop right away, which takes mu_.
+  class ABSL_SCOPED_LOCKABLE SendingLock {
+   public:
+    explicit SendingLock(Http2Transport* transport)
+        ABSL_EXCLUSIVE_LOCK_FUNCTION(transport->mu_);
+    ~SendingLock() ABSL_UNLOCK_FUNCTION();
+
+    SendingLock(const SendingLock&) = delete;
+    SendingLock& operator=(const SendingLock&) = delete;
+
+   private:
+    Http2Transport* const transport_;
+  };
+
+  void QueueFrame(Http2Frame frame) ABSL_LOCKS_EXCLUDED(mu_);
+  // Queues frame once mu_ is released, see SendingLock.
+  void QueueFrameLocked(Http2Frame frame) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const Http2Settings& peer_settings() const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return settings_.peer();
+  }
+  const Http2Settings& local_settings() const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return settings_.local();
+  }
+  size_t stream_count() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return streams_.size();
+  }
+
+  const bool is_client_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  MpscReceiver<Http2OutgoingFrame> outgoing_frames_;
+  Mutex mu_;
+  ConnectivityStateTracker state_tracker_ ABSL_GUARDED_BY(mu_);
+  // Calls waiting for the peer to allow another stream. Woken whenever a
+  // stream closes or the peer changes SETTINGS_MAX_CONCURRENT_STREAMS.
+  WaiterMap stream_slot_waiters_ ABSL_GUARDED_BY(mu_);
+
+ private:
+  auto OnLoopDone(absl::string_view what, RefCountedPtr<Transport> transport);
+  auto WriteLoop();
+  auto ReadLoop();
+  auto ReadPreface();
+  auto KeepaliveLoop();
+
+  // Adds the gRPC message prefix to the payload of message.
+  static SliceBuffer FrameMessage(MessageHandle message);
+  // Resolves to the number of bytes of the next DATA frame of stream, at most
+  // wanted, once the peer has window for at least one.
+  Poll<absl::StatusOr<uint32_t>> PollSendWindow(StreamState& stream,
+                                                size_t wanted)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  Poll<absl::Status> PollKeepaliveAck() ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Moves the wakers of waiters into wakers.
+  static void TakeWakers(WaiterMap& waiters, std::vector<Waker>& wakers);
+  // Returns a promise that sends GOAWAY for status if it is a connection
+  // error, and resolves to status once the write loop has taken the GOAWAY.
+  auto MaybeSendGoawayForError(absl::Status status);
+
+  // Turns a batch of queued frames into the bytes of one endpoint write.
+  SliceBuffer SerializeFrames(std::vector<Http2OutgoingFrame> frames);
+  absl::Status ProcessFrame(Http2Frame frame);
+  absl::Status ProcessData(Http2DataFrame frame);
+  absl::Status ProcessHeaderBlock(uint32_t stream_id, SliceBuffer block,
+                                  bool end_stream);
+  absl::Status ProcessSettings(Http2SettingsFrame frame);
+  absl::Status ProcessPing(Http2PingFrame frame);
+  absl::Status ProcessWindowUpdate(Http2WindowUpdateFrame frame);
+  absl::Status ProcessRstStream(Http2RstStreamFrame frame);
+  absl::Status ProcessGoaway(Http2GoawayFrame frame);
+
+  // Queues whatever frames action asks for.
+  void ActOnFlowControlActionLocked(const chttp2::FlowControlAction& action,
+                                    StreamState* stream)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void MaybeSendSettingsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void CloseStreamLocked(StreamState& stream, std::vector<Waker>& wakers)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  PromiseEndpoint endpoint_;
+  MemoryOwner memory_owner_;
+  const uint32_t metadata_soft_limit_;
+  const uint32_t metadata_hard_limit_;
+  const Duration keepalive_time_;
+  const Duration keepalive_timeout_;
+  const bool keepalive_permit_without_calls_;
+
+  Http2SettingsManager settings_ ABSL_GUARDED_BY(mu_);
+  chttp2::TransportFlowControl flow_control_ ABSL_GUARDED_BY(mu_);
+  StreamMap streams_ ABSL_GUARDED_BY(mu_);
+  std::vector<Http2Frame> frames_to_queue_ ABSL_GUARDED_BY(mu_);
+  // Streams whose WINDOW_UPDATE can wait for the next write.
+  absl::flat_hash_set<uint32_t> queued_window_updates_ ABSL_GUARDED_BY(mu_);
+  // Senders waiting for the peer to open the connection window.
+  WaiterMap transport_window_waiters_ ABSL_GUARDED_BY(mu_);
+  // Only used by servers, as in chttp2: strikes are reset whenever HEADERS or
+  // DATA go out.
+  Chttp2PingAbusePolicy ping_abuse_policy_ ABSL_GUARDED_BY(mu_);
+  // A HEADER_TABLE_SIZE from the peer that the encoder has yet to apply.
+  std::optional<uint32_t> pending_encoder_table_size_ ABSL_GUARDED_BY(mu_);
+  // The keepalive PING in flight.
+  uint64_t keepalive_ping_ ABSL_GUARDED_BY(mu_) = 0;
+  bool keepalive_ping_acked_ ABSL_GUARDED_BY(mu_) = false;
+  Waker keepalive_waker_ ABSL_GUARDED_BY(mu_);
+
+  // Write loop state.
+  HPackCompressor encoder_;
+  bool sent_preface_ = false;
+
+  // Read loop state.
+  HPackParser parser_;
+  absl::BitGen bitgen_;
+  Http2FrameHeader read_header_;
+  // A header block that waits for its CONTINUATION frames.
+  struct PendingHeaderBlock {
+    uint32_t stream_id;
+    bool end_stream;
+    SliceBuffer block;
+  };
+  std::optional<PendingHeaderBlock> pending_header_block_;
+};
+
+}  // namespace http2
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_TRANSPORT_H
@@ -55,6 +55,7 @@
 #include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
 #include "src/core/ext/transport/chttp2/transport/ping_callbacks.h"
 #include "src/core/ext/transport/chttp2/transport/ping_rate_policy.h"
+#include "src/core/ext/transport/chttp2/transport/shared_keepalive.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
@@ -91,9 +92,13 @@
 // streams are kept in various linked lists depending on what things need to
 // happen to them... this enum labels each list
 typedef enum {
-  // If a stream is in the following two lists, an explicit ref is associated
+  // If a stream is in the following lists, an explicit ref is associated
   // with the stream
+  /// writable streams, one list per grpc_core::GrpcWritePriority::Class; a
+  /// stream is in at most one of them
+  GRPC_CHTTP2_LIST_WRITABLE_HIGH_PRIORITY,
   GRPC_CHTTP2_LIST_WRITABLE,
+  GRPC_CHTTP2_LIST_WRITABLE_BULK,
   GRPC_CHTTP2_LIST_WRITING,
   // No additional ref is taken for the following refs. Make sure to remove the
   // stream from these lists when the stream is removed.
@@ -197,6 +202,7 @@ typedef enum {
 struct grpc_chttp2_stream_list {
   grpc_chttp2_stream* head;
   grpc_chttp2_stream* tail;
+  size_t count;
 };
 struct grpc_chttp2_stream_link {
   grpc_chttp2_stream* next;
@@ -390,6 +396,24 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
           grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
   grpc_closure retry_initiate_ping_locked;
 
+  /// delayed stream window update coalescing
+  /// (GRPC_ARG_HTTP2_WINDOW_UPDATE_DELAY_US); zero disables it
+  grpc_event_engine::experimental::EventEngine::Duration window_update_delay{
+      0};
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      delayed_window_update_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  grpc_closure flush_delayed_window_updates_locked;
+
+  /// write priority given to streams that don't carry a GrpcWritePriority
+  /// annotation (GRPC_ARG_HTTP2_WRITE_PRIORITY, GRPC_ARG_HTTP2_WRITE_WEIGHT)
+  grpc_core::GrpcWritePriority::ValueType default_write_priority;
+
+  /// received messages at least this large complete recv_message on an
+  /// EventEngine thread (GRPC_ARG_HTTP2_OFFLOAD_RECV_MESSAGE_BYTES); zero
+  /// disables it
+  uint32_t offload_recv_message_bytes = 0;
+
   /// ping acks
   size_t ping_ack_count = 0;
   size_t ping_ack_capacity = 0;
@@ -428,6 +452,11 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   int max_tarpit_duration_ms;
   bool allow_tarpit;
 
+  /// The channel's receive message size limit. A stream whose next message
+  /// declares a larger length is reset as soon as the length prefix arrives,
+  /// rather than after the whole message has been buffered.
+  std::optional<uint32_t> max_recv_message_length;
+
   grpc_chttp2_stream* incoming_stream = nullptr;
   // active parser
   struct Parser {
@@ -485,6 +514,9 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   std::atomic<size_t> streams_allocated{0};
   /// keep-alive state machine state
   grpc_chttp2_keepalive_state keepalive_state;
+  /// keepalive activity shared with other connections to the same peer, if
+  /// GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE is set
+  grpc_core::RefCountedPtr<grpc_core::SharedKeepalive> shared_keepalive;
   // Soft limit on max header size.
   uint32_t max_header_list_size_soft_limit = 0;
   grpc_core::ContextList* context_list = nullptr;
@@ -615,6 +647,10 @@ struct grpc_chttp2_stream {
   grpc_closure* recv_message_ready = nullptr;
   grpc_metadata_batch* recv_trailing_metadata;
   grpc_closure* recv_trailing_metadata_finished = nullptr;
+  /// recv_message_ready calls handed to an EventEngine thread that have not
+  /// yet come back to the combiner: recv_trailing_metadata is held back until
+  /// there are none
+  uint32_t recv_message_offloads_pending = 0;
 
   grpc_transport_stream_stats* collecting_stats = nullptr;
   grpc_transport_stream_stats stats = grpc_transport_stream_stats();
@@ -637,6 +673,9 @@ struct grpc_chttp2_stream {
   bool eos_sent = false;
 
   grpc_core::BitSet<STREAM_LIST_COUNT> included;
+  /// which writable list this stream queues on, and its share of each write
+  /// relative to other streams on that list
+  grpc_core::GrpcWritePriority::ValueType write_priority;
 
   /// the error that resulted in this stream being read-closed
   grpc_error_handle read_closed_error;
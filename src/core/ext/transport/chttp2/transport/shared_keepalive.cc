@@ -0,0 +1,81 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/shared_keepalive.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Activity is recorded at most this often, so that connections reading from
+// the same peer do not keep writing to one cache line.
+constexpr int64_t kRecordGranularityMillis = 100;
+
+struct Registry {
+  Mutex mu;
+  absl::flat_hash_map<std::string, SharedKeepalive*> peers ABSL_GUARDED_BY(mu);
+};
+
+Registry& GetRegistry() {
+  static NoDestruct<Registry> registry;
+  return *registry;
+}
+
+}  // namespace
+
+RefCountedPtr<SharedKeepalive> SharedKeepalive::ForPeer(
+    absl::string_view peer) {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  auto it = registry.peers.find(peer);
+  if (it != registry.peers.end()) {
+    // The last connection may be destroying the entry right now.
+    auto shared = it->second->RefIfNonZero();
+    if (shared != nullptr) return shared;
+  }
+  auto shared = RefCountedPtr<SharedKeepalive>(
+      new SharedKeepalive(std::string(peer)));
+  registry.peers.insert_or_assign(shared->peer_, shared.get());
+  return shared;
+}
+
+SharedKeepalive::~SharedKeepalive() {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  auto it = registry.peers.find(peer_);
+  if (it != registry.peers.end() && it->second == this) {
+    registry.peers.erase(it);
+  }
+}
+
+void SharedKeepalive::RecordActivity(Timestamp now) {
+  const int64_t millis =
+      static_cast<int64_t>(now.milliseconds_after_process_epoch());
+  if (millis < last_activity_millis_.load(std::memory_order_relaxed) +
+                   kRecordGranularityMillis) {
+    return;
+  }
+  last_activity_millis_.store(millis, std::memory_order_relaxed);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,65 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SHARED_KEEPALIVE_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SHARED_KEEPALIVE_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// When the connections to one peer last heard from it, for connections that
+// set GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE: a connection skips its
+// keepalive ping while another connection to the same peer address has read
+// data or had a ping acked within the keepalive time.
+class SharedKeepalive final : public RefCounted<SharedKeepalive> {
+ public:
+  // Returns the state shared by the connections to \a peer, creating it if
+  // this is the only one.
+  static RefCountedPtr<SharedKeepalive> ForPeer(absl::string_view peer);
+
+  ~SharedKeepalive() override;
+
+  // Records that a connection to the peer has heard from it at \a now.
+  void RecordActivity(Timestamp now);
+
+  // When a connection to the peer last heard from it.
+  Timestamp last_activity() const {
+    return Timestamp::FromMillisecondsAfterProcessEpoch(
+        last_activity_millis_.load(std::memory_order_relaxed));
+  }
+
+ private:
+  explicit SharedKeepalive(std::string peer) : peer_(std::move(peer)) {}
+
+  const std::string peer_;
+  // Starts out as Timestamp::InfPast().
+  std::atomic<int64_t> last_activity_millis_{
+      std::numeric_limits<int64_t>::min()};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SHARED_KEEPALIVE_H
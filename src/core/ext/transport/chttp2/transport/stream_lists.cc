@@ -30,8 +30,12 @@
 
 static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
   switch (id) {
+    case GRPC_CHTTP2_LIST_WRITABLE_HIGH_PRIORITY:
+      return "writable_high_priority";
     case GRPC_CHTTP2_LIST_WRITABLE:
       return "writable";
+    case GRPC_CHTTP2_LIST_WRITABLE_BULK:
+      return "writable_bulk";
     case GRPC_CHTTP2_LIST_WRITING:
       return "writing";
     case GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT:
@@ -67,6 +71,7 @@ static bool stream_list_pop(grpc_chttp2_transport* t,
       t->lists[id].head = nullptr;
       t->lists[id].tail = nullptr;
     }
+    --t->lists[id].count;
     s->included.clear(id);
   }
   *stream = s;
@@ -81,6 +86,7 @@ static void stream_list_remove(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                                grpc_chttp2_stream_list_id id) {
   CHECK(s->included.is_set(id));
   s->included.clear(id);
+  --t->lists[id].count;
   if (s->links[id].prev) {
     s->links[id].prev->links[id].next = s->links[id].next;
   } else {
@@ -122,6 +128,7 @@ static void stream_list_add_tail(grpc_chttp2_transport* t,
     t->lists[id].head = s;
   }
   t->lists[id].tail = s;
+  ++t->lists[id].count;
   s->included.set(id);
   GRPC_TRACE_LOG(http2_stream_state, INFO)
       << t << "[" << s->id << "][" << (t->is_client ? "cli" : "svr")
@@ -139,20 +146,58 @@ static bool stream_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 
 // wrappers for specializations
 
+// Writable streams are scheduled in strict priority order: one list per
+// grpc_core::GrpcWritePriority::Class, highest first. Within a list streams
+// are served round robin, and the writer bounds each visit by the stream's
+// weight (see WriteContext::NextStream), which gives weighted fair queuing
+// between the streams of a class.
+static constexpr grpc_chttp2_stream_list_id kWritableLists[] = {
+    GRPC_CHTTP2_LIST_WRITABLE_HIGH_PRIORITY,
+    GRPC_CHTTP2_LIST_WRITABLE,
+    GRPC_CHTTP2_LIST_WRITABLE_BULK,
+};
+
+static grpc_chttp2_stream_list_id writable_list_for(grpc_chttp2_stream* s) {
+  return kWritableLists[static_cast<size_t>(s->write_priority.priority_class)];
+}
+
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream* s) {
   CHECK_NE(s->id, 0u);
-  return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  for (grpc_chttp2_stream_list_id id : kWritableLists) {
+    if (s->included.is_set(id)) return false;
+  }
+  stream_list_add_tail(t, s, writable_list_for(s));
+  return true;
 }
 
 bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  for (grpc_chttp2_stream_list_id id : kWritableLists) {
+    if (stream_list_pop(t, s, id)) return true;
+  }
+  return false;
 }
 
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s) {
-  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  for (grpc_chttp2_stream_list_id id : kWritableLists) {
+    if (stream_list_maybe_remove(t, s, id)) return true;
+  }
+  return false;
+}
+
+size_t grpc_chttp2_list_writable_stream_count(grpc_chttp2_transport* t) {
+  size_t count = 0;
+  for (grpc_chttp2_stream_list_id id : kWritableLists) {
+    count += t->lists[id].count;
+  }
+  return count;
+}
+
+bool grpc_chttp2_list_have_writable_peers(grpc_chttp2_transport* t,
+                                          grpc_chttp2_stream* s) {
+  return !stream_list_empty(t, writable_list_for(s));
 }
 
 bool grpc_chttp2_list_add_writing_stream(grpc_chttp2_transport* t,
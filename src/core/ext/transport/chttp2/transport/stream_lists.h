@@ -29,6 +29,11 @@ bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream** s);
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s);
+/// Number of streams currently queued on the writable lists
+size_t grpc_chttp2_list_writable_stream_count(grpc_chttp2_transport* t);
+/// Are other streams queued to write in the same priority class as s?
+bool grpc_chttp2_list_have_writable_peers(grpc_chttp2_transport* t,
+                                          grpc_chttp2_stream* s);
 
 bool grpc_chttp2_list_add_writing_stream(grpc_chttp2_transport* t,
                                          grpc_chttp2_stream* s);
@@ -44,7 +44,8 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
     --state_;
     if (state_ == -2) {
       state_ = 0;
-      current_target_ = std::min(current_target_ * 3 / 2, MaxTarget());
+      current_target_ = std::min(
+          std::max(current_target_ * 3 / 2, pacing_target_), MaxTarget());
     }
   } else if (elapsed > SlowWrite()) {
     ++state_;
@@ -57,4 +58,15 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
   }
 }
 
+void Chttp2WriteSizePolicy::SetPacingRate(double bytes_per_second) {
+  if (bytes_per_second <= 0) {
+    pacing_target_ = 0;
+    return;
+  }
+  pacing_target_ = static_cast<size_t>(
+      std::clamp(bytes_per_second * TargetWriteTime().seconds(),
+                 static_cast<double>(MinTarget()),
+                 static_cast<double>(MaxTarget())));
+}
+
 }  // namespace grpc_core
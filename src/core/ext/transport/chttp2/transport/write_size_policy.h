@@ -46,9 +46,16 @@ class Chttp2WriteSizePolicy {
   void BeginWrite(size_t size);
   // Notify the policy that a write of some size has ended.
   void EndWrite(bool success);
+  // Provide a pacing rate recommendation (bytes per second, zero if unknown)
+  // from the transport's path model. When fast writes open the target up, it
+  // jumps straight to what the link can carry in TargetWriteTime() instead of
+  // growing in small steps.
+  void SetPacingRate(double bytes_per_second);
 
  private:
   size_t current_target_ = 128 * 1024;
+  // Write size the pacing rate supports in TargetWriteTime(), or zero.
+  size_t pacing_target_ = 0;
   Timestamp experiment_start_time_ = Timestamp::InfFuture();
   // State varies from -2...2
   // Every time we do a write faster than kFastWrite, we decrement
@@ -276,6 +276,25 @@ class WriteContext {
     }
   }
 
+  // Size the outgoing slice array for the whole write before we start
+  // framing streams into it. The endpoint takes ownership of the outbuf's
+  // slice array on every write, so without this, a write touching many
+  // streams regrows the array (and copies every slice) a large number of
+  // times.
+  void ReserveOutbuf() {
+    // A typical stream contributes a frame header and payload for each of
+    // its headers and data frames.
+    static constexpr size_t kEstimatedSlicesPerStream = 4;
+    // Bound the up front reservation: NextStream() stops well before this
+    // many slices for any realistic target write size.
+    static constexpr size_t kMaxReservedSlices = 16384;
+    const size_t estimate =
+        t_->qbuf.count + grpc_chttp2_list_writable_stream_count(t_) *
+                             kEstimatedSlicesPerStream;
+    grpc_slice_buffer_reserve_slices(t_->outbuf.c_slice_buffer(),
+                                     std::min(estimate, kMaxReservedSlices));
+  }
+
   void FlushQueuedBuffers() {
     // simple writes are queued to qbuf, and flushed here
     grpc_slice_buffer_move_into(&t_->qbuf, t_->outbuf.c_slice_buffer());
@@ -334,9 +353,22 @@ class WriteContext {
       return nullptr;
     }
 
+    // A stream that has its priority class to itself may fill the write. When
+    // others of its class are waiting, it gets a weighted share and goes to
+    // the back of the queue, so that one bulk stream cannot hold up the rest.
+    stream_write_budget_ =
+        grpc_chttp2_list_have_writable_peers(t_, s)
+            ? int64_t{s->write_priority.weight} * kStreamWriteQuantum
+            : std::numeric_limits<int64_t>::max();
+
     return s;
   }
 
+  int64_t stream_write_budget() const { return stream_write_budget_; }
+  void ConsumeStreamWriteBudget(uint32_t bytes) {
+    stream_write_budget_ -= bytes;
+  }
+
   void IncInitialMetadataWrites() { ++initial_metadata_writes_; }
   void IncWindowUpdateWrites() { ++flow_control_writes_; }
   void IncMessageWrites() { ++message_writes_; }
@@ -354,8 +386,13 @@ class WriteContext {
   size_t target_write_size() const { return target_write_size_; }
 
  private:
+  // DATA bytes per unit of GrpcWritePriority weight that a stream sharing its
+  // priority class may send each time it is scheduled.
+  static constexpr int64_t kStreamWriteQuantum = 1024;
+
   grpc_chttp2_transport* const t_;
   size_t target_write_size_ = t_->write_size_policy.WriteTargetSize();
+  int64_t stream_write_budget_ = std::numeric_limits<int64_t>::max();
 
   // stats histogram counters: we increment these throughout this function,
   // and at the end publish to the central stats histograms
@@ -387,7 +424,8 @@ class DataSendContext {
         std::min<int64_t>(
             {t_->settings.peer().max_frame_size(), stream_remote_window(),
              t_->flow_control.remote_window(),
-             static_cast<int64_t>(write_context_->target_write_size())}),
+             static_cast<int64_t>(write_context_->target_write_size()),
+             write_context_->stream_write_budget()}),
         0, std::numeric_limits<uint32_t>::max());
   }
 
@@ -404,6 +442,7 @@ class DataSendContext {
                             is_last_frame_, &s_->call_tracer_wrapper,
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
+    write_context_->ConsumeStreamWriteBudget(send_bytes);
     s_->sending_bytes += send_bytes;
   }
 
@@ -670,6 +709,7 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   int64_t outbuf_relative_start_pos = 0;
   WriteContext ctx(t);
+  ctx.ReserveOutbuf();
   ctx.FlushSettings();
   ctx.FlushPingAcks();
   ctx.FlushQueuedBuffers();
@@ -71,7 +71,8 @@ struct secure_endpoint : public grpc_endpoint {
                   grpc_core::OrphanablePtr<grpc_endpoint> endpoint,
                   grpc_slice* leftover_slices,
                   const grpc_channel_args* channel_args,
-                  size_t leftover_nslices)
+                  size_t leftover_nslices,
+                  grpc_slice_buffer* handshake_bytes_to_send)
       : wrapped_ep(std::move(endpoint)),
         protector(protector),
         zero_copy_protector(zero_copy_protector) {
@@ -86,6 +87,11 @@ struct secure_endpoint : public grpc_endpoint {
                             grpc_core::CSliceRef(leftover_slices[i]));
     }
     grpc_slice_buffer_init(&output_buffer);
+    grpc_slice_buffer_init(&pending_handshake_bytes);
+    if (handshake_bytes_to_send != nullptr) {
+      grpc_slice_buffer_move_into(handshake_bytes_to_send,
+                                  &pending_handshake_bytes);
+    }
     memory_owner = grpc_core::ResourceQuotaFromChannelArgs(channel_args)
                        ->memory_quota()
                        ->CreateMemoryOwner();
@@ -113,6 +119,7 @@ struct secure_endpoint : public grpc_endpoint {
     grpc_core::CSliceUnref(read_staging_buffer);
     grpc_core::CSliceUnref(write_staging_buffer);
     grpc_slice_buffer_destroy(&output_buffer);
+    grpc_slice_buffer_destroy(&pending_handshake_bytes);
     grpc_slice_buffer_destroy(&protector_staging_buffer);
     gpr_mu_destroy(&protector_mu);
   }
@@ -136,6 +143,8 @@ struct secure_endpoint : public grpc_endpoint {
   grpc_slice read_staging_buffer ABSL_GUARDED_BY(read_mu);
   grpc_slice write_staging_buffer ABSL_GUARDED_BY(write_mu);
   grpc_slice_buffer output_buffer;
+  // The end of the handshake, which goes out with the first write.
+  grpc_slice_buffer pending_handshake_bytes ABSL_GUARDED_BY(write_mu);
   grpc_core::MemoryOwner memory_owner;
   grpc_core::MemoryAllocator::Reservation self_reservation;
   std::atomic<bool> has_posted_reclaimer;
@@ -404,6 +413,9 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
     uint8_t* end = GRPC_SLICE_END_PTR(ep->write_staging_buffer);
 
     grpc_slice_buffer_reset_and_unref(&ep->output_buffer);
+    // Protected data can only be sent after the handshake bytes.
+    grpc_slice_buffer_move_into(&ep->pending_handshake_bytes,
+                                &ep->output_buffer);
 
     if (GRPC_TRACE_FLAG_ENABLED(secure_endpoint) && ABSL_VLOG_IS_ON(2)) {
       for (i = 0; i < slices->count; i++) {
@@ -571,8 +583,9 @@ grpc_core::OrphanablePtr<grpc_endpoint> grpc_secure_endpoint_create(
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
     grpc_core::OrphanablePtr<grpc_endpoint> to_wrap,
     grpc_slice* leftover_slices, const grpc_channel_args* channel_args,
-    size_t leftover_nslices) {
+    size_t leftover_nslices, grpc_slice_buffer* handshake_bytes_to_send) {
   return grpc_core::MakeOrphanable<secure_endpoint>(
       &vtable, protector, zero_copy_protector, std::move(to_wrap),
-      leftover_slices, channel_args, leftover_nslices);
+      leftover_slices, channel_args, leftover_nslices,
+      handshake_bytes_to_send);
 }
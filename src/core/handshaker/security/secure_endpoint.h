@@ -21,6 +21,7 @@
 
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
@@ -30,12 +31,14 @@
 
 // Takes ownership of protector, zero_copy_protector, and to_wrap, and refs
 // leftover_slices. If zero_copy_protector is not NULL, protector will never be
-// used.
+// used. If handshake_bytes_to_send is not NULL, its slices are moved out of it
+// and sent unprotected ahead of the data of the first write.
 grpc_core::OrphanablePtr<grpc_endpoint> grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
     grpc_core::OrphanablePtr<grpc_endpoint> to_wrap,
     grpc_slice* leftover_slices, const grpc_channel_args* channel_args,
-    size_t leftover_nslices);
+    size_t leftover_nslices,
+    grpc_slice_buffer* handshake_bytes_to_send = nullptr);
 
 #endif  // GRPC_SRC_CORE_HANDSHAKER_SECURITY_SECURE_ENDPOINT_H
@@ -125,6 +125,15 @@ class SecurityHandshaker : public Handshaker {
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
+  // Whether to try to let the kernel encrypt outgoing data.
+  const bool kernel_tls_offload_;
+  // Whether to send the last flight of the handshake with the first write on
+  // the secure endpoint, instead of on its own. Only set for clients: a
+  // server's last flight may be what the client waits for before it writes,
+  // so holding it back until the server writes could stall the connection.
+  const bool coalesce_final_flight_;
+  // The last flight of the handshake, if coalesce_final_flight_ is set.
+  SliceBuffer final_flight_;
   std::string tsi_handshake_error_;
   grpc_closure* on_peer_checked_ ABSL_GUARDED_BY(mu_) = nullptr;
 };
@@ -138,7 +147,17 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
       handshake_buffer_(
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
       max_frame_size_(
-          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {}
+          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))),
+      // Kernel TLS cannot send with MSG_ZEROCOPY.
+      kernel_tls_offload_(
+          args.GetBool(GRPC_ARG_TLS_KERNEL_OFFLOAD).value_or(false) &&
+          !args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)),
+      // With kernel TLS, whatever is written on the socket after the
+      // handshake is encrypted by the kernel.
+      coalesce_final_flight_(
+          !kernel_tls_offload_ &&
+          args.GetBool(GRPC_ARG_SECURITY_HANDSHAKE_COALESCE_FINAL_FLIGHT)
+              .value_or(false)) {}
 
 SecurityHandshaker::~SecurityHandshaker() {
   tsi_handshaker_destroy(handshaker_);
@@ -241,37 +260,51 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
                      tsi_result_to_string(result), ")")));
     return;
   }
+  size_t* max_frame_size = max_frame_size_ == 0 ? nullptr : &max_frame_size_;
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_frame_protector* protector = nullptr;
-  switch (frame_protector_type) {
-    case TSI_FRAME_PROTECTOR_ZERO_COPY:
-      [[fallthrough]];
-    case TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY:
-      // Create zero-copy frame protector.
-      result = tsi_handshaker_result_create_zero_copy_grpc_protector(
-          handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
-          &zero_copy_protector);
-      if (result != TSI_OK) {
+  if (kernel_tls_offload_ && frame_protector_type != TSI_FRAME_PROTECTOR_NONE) {
+    int fd = grpc_endpoint_get_fd(args_->endpoint.get());
+    if (fd >= 0) {
+      result = tsi_handshaker_result_create_kernel_tls_protector(
+          handshaker_result_, fd, max_frame_size, &zero_copy_protector);
+      if (result != TSI_OK && result != TSI_UNIMPLEMENTED) {
         HandshakeFailedLocked(GRPC_ERROR_CREATE(
-            absl::StrCat("Zero-copy frame protector creation failed (",
+            absl::StrCat("Kernel TLS protector creation failed (",
                          tsi_result_to_string(result), ")")));
         return;
       }
-      break;
-    case TSI_FRAME_PROTECTOR_NORMAL:
-      // Create normal frame protector.
-      result = tsi_handshaker_result_create_frame_protector(
-          handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
-          &protector);
-      if (result != TSI_OK) {
-        HandshakeFailedLocked(
-            GRPC_ERROR_CREATE(absl::StrCat("Frame protector creation failed (",
-                                           tsi_result_to_string(result), ")")));
-        return;
-      }
-      break;
-    case TSI_FRAME_PROTECTOR_NONE:
-      break;
+    }
+  }
+  if (zero_copy_protector == nullptr) {
+    switch (frame_protector_type) {
+      case TSI_FRAME_PROTECTOR_ZERO_COPY:
+        [[fallthrough]];
+      case TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY:
+        // Create zero-copy frame protector.
+        result = tsi_handshaker_result_create_zero_copy_grpc_protector(
+            handshaker_result_, max_frame_size, &zero_copy_protector);
+        if (result != TSI_OK) {
+          HandshakeFailedLocked(GRPC_ERROR_CREATE(
+              absl::StrCat("Zero-copy frame protector creation failed (",
+                           tsi_result_to_string(result), ")")));
+          return;
+        }
+        break;
+      case TSI_FRAME_PROTECTOR_NORMAL:
+        // Create normal frame protector.
+        result = tsi_handshaker_result_create_frame_protector(
+            handshaker_result_, max_frame_size, &protector);
+        if (result != TSI_OK) {
+          HandshakeFailedLocked(GRPC_ERROR_CREATE(
+              absl::StrCat("Frame protector creation failed (",
+                           tsi_result_to_string(result), ")")));
+          return;
+        }
+        break;
+      case TSI_FRAME_PROTECTOR_NONE:
+        break;
+    }
   }
   bool has_frame_protector =
       zero_copy_protector != nullptr || protector != nullptr;
@@ -282,12 +315,12 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
           reinterpret_cast<const char*>(unused_bytes), unused_bytes_size);
       args_->endpoint = grpc_secure_endpoint_create(
           protector, zero_copy_protector, std::move(args_->endpoint), &slice,
-          args_->args.ToC().get(), 1);
+          args_->args.ToC().get(), 1, final_flight_.c_slice_buffer());
       CSliceUnref(slice);
     } else {
       args_->endpoint = grpc_secure_endpoint_create(
           protector, zero_copy_protector, std::move(args_->endpoint), nullptr,
-          args_->args.ToC().get(), 0);
+          args_->args.ToC().get(), 0, final_flight_.c_slice_buffer());
     }
   } else if (unused_bytes_size > 0) {
     // Not wrapping the endpoint, so just pass along unused bytes.
@@ -368,6 +401,19 @@ grpc_error_handle SecurityHandshaker::OnHandshakeNextDoneLocked(
     CHECK_EQ(handshaker_result_, nullptr);
     handshaker_result_ = handshaker_result;
   }
+  if (bytes_to_send_size > 0 && handshaker_result != nullptr &&
+      coalesce_final_flight_) {
+    // The last flight can only go out with the first write on the secure
+    // endpoint if there will be one.
+    tsi_frame_protector_type frame_protector_type;
+    if (tsi_handshaker_result_get_frame_protector_type(
+            handshaker_result, &frame_protector_type) == TSI_OK &&
+        frame_protector_type != TSI_FRAME_PROTECTOR_NONE) {
+      final_flight_.Append(Slice::FromCopiedBuffer(
+          reinterpret_cast<const char*>(bytes_to_send), bytes_to_send_size));
+      return CheckPeerLocked();
+    }
+  }
   if (bytes_to_send_size > 0) {
     // Send data to peer, if needed.
     outgoing_.Clear();
@@ -580,8 +626,10 @@ class ServerSecurityHandshakerFactory : public HandshakerFactory {
                       HandshakeManager* handshake_mgr) override {
     auto* security_connector = args.GetObject<grpc_server_security_connector>();
     if (security_connector) {
-      security_connector->add_handshakers(args, interested_parties,
-                                          handshake_mgr);
+      // Only clients hold back the last flight of the handshake.
+      security_connector->add_handshakers(
+          args.Remove(GRPC_ARG_SECURITY_HANDSHAKE_COALESCE_FINAL_FLIGHT),
+          interested_parties, handshake_mgr);
     }
   }
   HandshakerPriority Priority() override {
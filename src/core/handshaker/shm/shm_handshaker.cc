@@ -0,0 +1,557 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/handshaker/shm/shm_handshaker.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_EVENTFD
+
+#include <errno.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/handshaker/handshaker.h"
+#include "src/core/handshaker/handshaker_factory.h"
+#include "src/core/handshaker/handshaker_registry.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/supports_shm.h"
+#include "src/core/lib/event_engine/posix_engine/shm_ring.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+#endif  // GRPC_LINUX_EVENTFD
+
+namespace grpc_core {
+
+#ifdef GRPC_LINUX_EVENTFD
+
+namespace {
+
+using ::grpc_event_engine::experimental::EndpointSupportsFdExtension;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::EventEngineSupportsShmExtension;
+using ::grpc_event_engine::experimental::QueryExtension;
+using ::grpc_event_engine::experimental::ShmRing;
+
+// Sent by the client as soon as it has connected.
+constexpr absl::string_view kPreface = "GRPC-SHM/1\n";
+// The server's one byte answer to the preface. kAccept carries the
+// descriptors of the rings, kDecline keeps the connection on the socket.
+constexpr char kAccept = 'Y';
+constexpr absl::string_view kDecline = "N";
+// The memfd, data eventfd and space eventfd of the client-to-server ring,
+// followed by those of the server-to-client ring.
+constexpr size_t kNumFds = 6;
+constexpr int kDefaultRingSize = 1024 * 1024;
+// The answer is read straight off the socket, since the endpoint would drop
+// the descriptors, so the client polls for it.
+constexpr std::chrono::milliseconds kInitialAnswerPollDelay(1);
+constexpr std::chrono::milliseconds kMaxAnswerPollDelay(50);
+
+// Returns the descriptor of the unix domain socket under \a endpoint, or -1
+// if the endpoint is not one that a shm endpoint can be built on.
+int UnixSocketFd(grpc_endpoint* endpoint) {
+  EventEngine::Endpoint* ee_endpoint =
+      grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+          endpoint);
+  if (ee_endpoint == nullptr) return -1;
+  auto* supports_fd =
+      QueryExtension<EndpointSupportsFdExtension>(ee_endpoint);
+  if (supports_fd == nullptr) return -1;
+  const int fd = supports_fd->GetWrappedFd();
+  if (fd < 0) return -1;
+  sockaddr_storage addr;
+  socklen_t len = sizeof(addr);
+  if (getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0 ||
+      addr.ss_family != AF_UNIX) {
+    return -1;
+  }
+  return fd;
+}
+
+EventEngineSupportsShmExtension* ShmSupport(EventEngine* engine) {
+  return QueryExtension<EventEngineSupportsShmExtension>(engine);
+}
+
+// Replaces args->endpoint with one that reads from \a read_ring and writes to
+// \a write_ring, keeping the old endpoint as its socket.
+absl::Status SwitchToShm(HandshakerArgs* args,
+                         std::unique_ptr<ShmRing> read_ring,
+                         std::unique_ptr<ShmRing> write_ring) {
+  std::unique_ptr<EventEngine::Endpoint> socket =
+      grpc_event_engine::experimental::grpc_take_wrapped_event_engine_endpoint(
+          args->endpoint.release());
+  ResourceQuotaRefPtr resource_quota = args->args.GetObjectRef<ResourceQuota>();
+  if (resource_quota == nullptr) resource_quota = ResourceQuota::Default();
+  auto endpoint = ShmSupport(args->event_engine)
+                      ->CreateShmEndpoint(
+                          std::move(read_ring), std::move(write_ring),
+                          std::move(socket),
+                          resource_quota->memory_quota()->CreateMemoryAllocator(
+                              "shm_endpoint"));
+  if (!endpoint.ok()) return endpoint.status();
+  args->endpoint.reset(
+      grpc_event_engine::experimental::grpc_event_engine_endpoint_create(
+          std::move(*endpoint)));
+  return absl::OkStatus();
+}
+
+// State and helpers shared by the client and server handshakers.
+class ShmHandshaker : public Handshaker {
+ public:
+  void Shutdown(absl::Status /*error*/) override {
+    MutexLock lock(&mu_);
+    if (on_handshake_done_ != nullptr) args_->endpoint.reset();
+  }
+
+ protected:
+  void HandshakeFailedLocked(absl::Status error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (error.ok()) {
+      // Shut down after an endpoint operation succeeded but before its
+      // callback ran.
+      error = GRPC_ERROR_CREATE("Handshaker shutdown");
+    }
+    LOG_EVERY_N_SEC(ERROR, 60) << "shm handshake failed: " << error;
+    FinishLocked(std::move(error));
+  }
+
+  void FinishLocked(absl::Status error) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    InvokeOnHandshakeDone(args_, std::move(on_handshake_done_),
+                          std::move(error));
+  }
+
+  // Writes write_buffer_ and then calls OnWriteDone(), which inherits the
+  // caller's ref to the handshaker.
+  void WriteLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    grpc_endpoint_write(
+        args_->endpoint.get(), write_buffer_.c_slice_buffer(),
+        GRPC_CLOSURE_INIT(&on_write_done_scheduler_,
+                          &ShmHandshaker::OnWriteDoneScheduler, this,
+                          grpc_schedule_on_exec_ctx),
+        nullptr, /*max_frame_size=*/INT_MAX);
+  }
+
+  virtual void OnWriteDone(absl::Status error) = 0;
+
+  Mutex mu_;
+  HandshakerArgs* args_ = nullptr;
+  absl::AnyInvocable<void(absl::Status)> on_handshake_done_
+      ABSL_GUARDED_BY(mu_);
+  SliceBuffer write_buffer_ ABSL_GUARDED_BY(mu_);
+
+ private:
+  // Endpoint callbacks can be invoked inline while the mutex is held, so hop
+  // onto the EventEngine before taking it.
+  static void OnWriteDoneScheduler(void* arg, grpc_error_handle error) {
+    auto* handshaker = static_cast<ShmHandshaker*>(arg);
+    handshaker->args_->event_engine->Run(
+        [handshaker, error = std::move(error)]() mutable {
+          ExecCtx exec_ctx;
+          handshaker->OnWriteDone(std::move(error));
+        });
+  }
+
+  grpc_closure on_write_done_scheduler_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// Server side
+//
+
+class ShmServerHandshaker : public ShmHandshaker {
+ public:
+  absl::string_view name() const override { return "shm_server"; }
+
+  void DoHandshake(
+      HandshakerArgs* args,
+      absl::AnyInvocable<void(absl::Status)> on_handshake_done) override {
+    bool done;
+    {
+      MutexLock lock(&mu_);
+      args_ = args;
+      on_handshake_done_ = std::move(on_handshake_done);
+      // Held by the endpoint operations until the handshake is done.
+      Ref().release();
+      done = CheckPrefaceLocked();
+    }
+    if (done) Unref();
+  }
+
+ private:
+  // Looks for the preface in args_->read_buffer, reading more if it may still
+  // arrive. Returns true once the handshake is done.
+  bool CheckPrefaceLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    const size_t length =
+        std::min(args_->read_buffer.Length(), kPreface.size());
+    std::string prefix(length, '\0');
+    grpc_slice_buffer_copy_first_into_buffer(
+        args_->read_buffer.c_slice_buffer(), length, prefix.data());
+    if (prefix != kPreface.substr(0, length)) {
+      // Not a shm client. Leave its bytes for the next handshaker.
+      FinishLocked(absl::OkStatus());
+      return true;
+    }
+    if (length < kPreface.size()) {
+      // The read callback inherits our ref to the handshaker.
+      grpc_endpoint_read(
+          args_->endpoint.get(), read_buffer_.c_slice_buffer(),
+          GRPC_CLOSURE_INIT(&on_read_done_scheduler_,
+                            &ShmServerHandshaker::OnReadDoneScheduler, this,
+                            grpc_schedule_on_exec_ctx),
+          /*urgent=*/true, /*min_progress_size=*/1);
+      return false;
+    }
+    if (args_->read_buffer.Length() > kPreface.size()) {
+      HandshakeFailedLocked(absl::InternalError(
+          "shm client sent data before the answer to its preface"));
+      return true;
+    }
+    args_->read_buffer.Clear();
+    return AnswerLocked();
+  }
+
+  // Answers the preface, with the rings if they can be set up. Returns true
+  // once the handshake is done.
+  bool AnswerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    const int fd = UnixSocketFd(args_->endpoint.get());
+    if (fd < 0 || ShmSupport(args_->event_engine) == nullptr) {
+      return DeclineLocked(absl::UnimplementedError(
+          "endpoint or EventEngine does not support shm"));
+    }
+    const int ring_size = std::max(
+        1, args_->args.GetInt(GRPC_ARG_SHM_TRANSPORT_RING_SIZE)
+               .value_or(kDefaultRingSize));
+    auto client_to_server = ShmRing::Create(ring_size);
+    if (!client_to_server.ok()) {
+      return DeclineLocked(client_to_server.status());
+    }
+    auto server_to_client = ShmRing::Create(ring_size);
+    if (!server_to_client.ok()) {
+      return DeclineLocked(server_to_client.status());
+    }
+    const int fds[kNumFds] = {
+        (*client_to_server)->memfd(), (*client_to_server)->data_fd(),
+        (*client_to_server)->space_fd(), (*server_to_client)->memfd(),
+        (*server_to_client)->data_fd(), (*server_to_client)->space_fd()};
+    absl::Status status = SendAccept(fd, fds);
+    if (!status.ok()) {
+      HandshakeFailedLocked(std::move(status));
+      return true;
+    }
+    FinishLocked(SwitchToShm(args_, std::move(*client_to_server),
+                             std::move(*server_to_client)));
+    return true;
+  }
+
+  bool DeclineLocked(absl::Status why) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    VLOG(2) << "declining shm transport: " << why;
+    write_buffer_.Append(Slice::FromStaticString(kDecline));
+    WriteLocked();
+    return false;
+  }
+
+  static absl::Status SendAccept(int fd, const int (&fds)[kNumFds]) {
+    char answer = kAccept;
+    iovec iov = {&answer, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fds))];
+    memset(control, 0, sizeof(control));
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    ssize_t sent;
+    do {
+      sent = sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    if (sent < 0) {
+      return absl::UnavailableError(
+          absl::StrCat("sendmsg of shm rings: ", StrError(errno)));
+    }
+    return absl::OkStatus();
+  }
+
+  void OnWriteDone(absl::Status error) override {
+    {
+      MutexLock lock(&mu_);
+      if (!error.ok() || args_->endpoint == nullptr) {
+        HandshakeFailedLocked(std::move(error));
+      } else {
+        FinishLocked(absl::OkStatus());
+      }
+    }
+    Unref();
+  }
+
+  static void OnReadDoneScheduler(void* arg, grpc_error_handle error) {
+    auto* handshaker = static_cast<ShmServerHandshaker*>(arg);
+    handshaker->args_->event_engine->Run(
+        [handshaker, error = std::move(error)]() mutable {
+          ExecCtx exec_ctx;
+          handshaker->OnReadDone(std::move(error));
+        });
+  }
+
+  void OnReadDone(absl::Status error) {
+    bool done;
+    {
+      MutexLock lock(&mu_);
+      if (!error.ok() || args_->endpoint == nullptr) {
+        HandshakeFailedLocked(std::move(error));
+        done = true;
+      } else {
+        // grpc_endpoint_read() clears the buffer it reads into, so read into
+        // our own and append.
+        args_->read_buffer.TakeAndAppend(read_buffer_);
+        done = CheckPrefaceLocked();
+      }
+    }
+    if (done) Unref();
+  }
+
+  SliceBuffer read_buffer_ ABSL_GUARDED_BY(mu_);
+  grpc_closure on_read_done_scheduler_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// Client side
+//
+
+class ShmClientHandshaker : public ShmHandshaker {
+ public:
+  absl::string_view name() const override { return "shm_client"; }
+
+  void DoHandshake(
+      HandshakerArgs* args,
+      absl::AnyInvocable<void(absl::Status)> on_handshake_done) override {
+    const int fd = UnixSocketFd(args->endpoint.get());
+    if (fd < 0 || ShmSupport(args->event_engine) == nullptr) {
+      // Stay on the socket.
+      InvokeOnHandshakeDone(args, std::move(on_handshake_done),
+                            absl::OkStatus());
+      return;
+    }
+    MutexLock lock(&mu_);
+    args_ = args;
+    on_handshake_done_ = std::move(on_handshake_done);
+    fd_ = fd;
+    write_buffer_.Append(Slice::FromStaticString(kPreface));
+    // Held by the endpoint operations and poll timers until the handshake is
+    // done.
+    Ref().release();
+    WriteLocked();
+  }
+
+  void Shutdown(absl::Status error) override {
+    bool cancelled = false;
+    {
+      MutexLock lock(&mu_);
+      if (on_handshake_done_ == nullptr) return;
+      if (poll_timer_.has_value() &&
+          args_->event_engine->Cancel(*poll_timer_)) {
+        poll_timer_.reset();
+        HandshakeFailedLocked(std::move(error));
+        cancelled = true;
+      } else {
+        args_->endpoint.reset();
+      }
+    }
+    if (cancelled) Unref();
+  }
+
+ private:
+  void OnWriteDone(absl::Status error) override {
+    bool done;
+    {
+      MutexLock lock(&mu_);
+      if (!error.ok() || args_->endpoint == nullptr) {
+        HandshakeFailedLocked(std::move(error));
+        done = true;
+      } else {
+        done = ReadAnswerLocked();
+      }
+    }
+    if (done) Unref();
+  }
+
+  void OnPollTimer() {
+    bool done;
+    {
+      MutexLock lock(&mu_);
+      poll_timer_.reset();
+      if (args_->endpoint == nullptr) {
+        HandshakeFailedLocked(absl::OkStatus());
+        done = true;
+      } else {
+        done = ReadAnswerLocked();
+      }
+    }
+    if (done) Unref();
+  }
+
+  // Reads the server's answer, or arranges to try again if it has not arrived
+  // yet. Returns true once the handshake is done.
+  bool ReadAnswerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    char answer;
+    iovec iov = {&answer, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kNumFds)];
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    ssize_t received;
+    do {
+      received = recvmsg(fd_, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    } while (received < 0 && errno == EINTR);
+    if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      poll_delay_ = std::min(std::max(poll_delay_ * 2, kInitialAnswerPollDelay),
+                             kMaxAnswerPollDelay);
+      poll_timer_ = args_->event_engine->RunAfter(poll_delay_, [this]() {
+        ExecCtx exec_ctx;
+        OnPollTimer();
+      });
+      return false;
+    }
+    if (received < 0) {
+      HandshakeFailedLocked(absl::UnavailableError(
+          absl::StrCat("recvmsg of shm answer: ", StrError(errno))));
+      return true;
+    }
+    if (received == 0) {
+      HandshakeFailedLocked(absl::UnavailableError(
+          "connection closed before the shm answer arrived"));
+      return true;
+    }
+    std::vector<int> fds;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+      if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+        continue;
+      }
+      const size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      for (size_t i = 0; i < count; ++i) {
+        int fd;
+        memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+        fds.push_back(fd);
+      }
+    }
+    if (answer == kDecline[0] && fds.empty()) {
+      FinishLocked(absl::OkStatus());
+      return true;
+    }
+    if (answer != kAccept || fds.size() != kNumFds ||
+        (msg.msg_flags & MSG_CTRUNC) != 0) {
+      for (int fd : fds) close(fd);
+      HandshakeFailedLocked(
+          absl::InternalError("malformed answer to shm preface"));
+      return true;
+    }
+    // Attach() owns the descriptors whether or not it succeeds.
+    auto write_ring = ShmRing::Attach(fds[0], fds[1], fds[2]);
+    auto read_ring = ShmRing::Attach(fds[3], fds[4], fds[5]);
+    if (!write_ring.ok()) {
+      HandshakeFailedLocked(write_ring.status());
+      return true;
+    }
+    if (!read_ring.ok()) {
+      HandshakeFailedLocked(read_ring.status());
+      return true;
+    }
+    FinishLocked(
+        SwitchToShm(args_, std::move(*read_ring), std::move(*write_ring)));
+    return true;
+  }
+
+  int fd_ ABSL_GUARDED_BY(mu_) = -1;
+  std::chrono::milliseconds poll_delay_ ABSL_GUARDED_BY(mu_){0};
+  std::optional<EventEngine::TaskHandle> poll_timer_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// handshaker factory
+//
+
+template <typename HandshakerType>
+class ShmHandshakerFactory : public HandshakerFactory {
+ public:
+  void AddHandshakers(const ChannelArgs& args,
+                      grpc_pollset_set* /*interested_parties*/,
+                      HandshakeManager* handshake_mgr) override {
+    if (!args.GetBool(GRPC_ARG_SHM_TRANSPORT).value_or(false)) return;
+    handshake_mgr->Add(MakeRefCounted<HandshakerType>());
+  }
+  HandshakerPriority Priority() override {
+    // After the connection is made, and before the security handshakers,
+    // which then run over the rings.
+    return HandshakerPriority::kReadAheadSecurityHandshakers;
+  }
+  ~ShmHandshakerFactory() override = default;
+};
+
+}  // namespace
+
+#endif  // GRPC_LINUX_EVENTFD
+
+void RegisterShmHandshaker(
+    [[maybe_unused]] CoreConfiguration::Builder* builder) {
+#ifdef GRPC_LINUX_EVENTFD
+  builder->handshaker_registry()->RegisterHandshakerFactory(
+      HANDSHAKER_CLIENT,
+      std::make_unique<ShmHandshakerFactory<ShmClientHandshaker>>());
+  builder->handshaker_registry()->RegisterHandshakerFactory(
+      HANDSHAKER_SERVER,
+      std::make_unique<ShmHandshakerFactory<ShmServerHandshaker>>());
+#endif  // GRPC_LINUX_EVENTFD
+}
+
+}  // namespace grpc_core
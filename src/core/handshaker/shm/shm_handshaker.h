@@ -0,0 +1,37 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_HANDSHAKER_SHM_SHM_HANDSHAKER_H
+#define GRPC_SRC_CORE_HANDSHAKER_SHM_SHM_HANDSHAKER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/config/core_configuration.h"
+
+namespace grpc_core {
+
+// Register the shared memory handshakers into the configuration builder.
+//
+// When GRPC_ARG_SHM_TRANSPORT is set, a client connected over a unix domain
+// socket sends a short preface, and a server that also has the arg set
+// answers it by passing a pair of shared memory rings (see ShmRing) over the
+// socket. Both sides then replace the endpoint with one that moves bytes over
+// the rings, keeping the socket only to notice when the peer goes away. A
+// server that cannot create the rings declines, and the connection carries on
+// over the socket.
+void RegisterShmHandshaker(CoreConfiguration::Builder* builder);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_HANDSHAKER_SHM_SHM_HANDSHAKER_H
@@ -32,6 +32,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
@@ -119,8 +120,25 @@ bool ChannelArgs::operator!=(const ChannelArgs& other) const {
   return !(*this == other);
 }
 
+size_t ChannelArgs::Hash() const {
+  size_t hash = 0;
+  args_.ForEach([&hash](const RefCountedStringValue& key, const Value& value) {
+    size_t value_hash;
+    if (auto n = value.GetIfInt(); n.has_value()) {
+      value_hash = absl::HashOf(*n);
+    } else if (auto s = value.GetIfStringView(); s.has_value()) {
+      value_hash = absl::HashOf(*s);
+    } else {
+      value_hash = absl::HashOf(value.GetIfPointer()->c_vtable());
+    }
+    hash = absl::HashOf(hash, key.as_string_view(), value_hash);
+  });
+  return hash;
+}
+
 bool ChannelArgs::WantMinimalStack() const {
-  return GetBool(GRPC_ARG_MINIMAL_STACK).value_or(false);
+  static const ChannelArgKey<bool> kMinimalStack(GRPC_ARG_MINIMAL_STACK);
+  return Get(kMinimalStack).value_or(false);
 }
 
 ChannelArgs::ChannelArgs(AVL<RefCountedStringValue, Value> args)
@@ -218,28 +236,58 @@ ChannelArgs ChannelArgs::RemoveAllKeysWithPrefix(
   return ChannelArgs(std::move(args));
 }
 
-std::optional<int> ChannelArgs::GetInt(absl::string_view name) const {
-  auto* v = Get(name);
+namespace {
+std::optional<int> IntFromValue(const ChannelArgs::Value* v) {
   if (v == nullptr) return std::nullopt;
   return v->GetIfInt();
 }
 
-std::optional<Duration> ChannelArgs::GetDurationFromIntMillis(
-    absl::string_view name) const {
-  auto ms = GetInt(name);
+std::optional<Duration> DurationFromValue(const ChannelArgs::Value* v) {
+  auto ms = IntFromValue(v);
   if (!ms.has_value()) return std::nullopt;
   if (*ms == INT_MAX) return Duration::Infinity();
   if (*ms == INT_MIN) return Duration::NegativeInfinity();
   return Duration::Milliseconds(*ms);
 }
 
+std::optional<absl::string_view> StringFromValue(const ChannelArgs::Value* v) {
+  if (v == nullptr) return std::nullopt;
+  return v->GetIfStringView();
+}
+
+std::optional<bool> BoolFromValue(absl::string_view name,
+                                  const ChannelArgs::Value* v) {
+  if (v == nullptr) return std::nullopt;
+  auto i = v->GetIfInt();
+  if (!i.has_value()) {
+    LOG(ERROR) << name << " ignored: it must be an integer";
+    return std::nullopt;
+  }
+  switch (*i) {
+    case 0:
+      return false;
+    case 1:
+      return true;
+    default:
+      LOG(ERROR) << name << " treated as bool but set to " << *i
+                 << " (assuming true)";
+      return true;
+  }
+}
+}  // namespace
+
+std::optional<int> ChannelArgs::GetInt(absl::string_view name) const {
+  return IntFromValue(Get(name));
+}
+
+std::optional<Duration> ChannelArgs::GetDurationFromIntMillis(
+    absl::string_view name) const {
+  return DurationFromValue(Get(name));
+}
+
 std::optional<absl::string_view> ChannelArgs::GetString(
     absl::string_view name) const {
-  auto* v = Get(name);
-  if (v == nullptr) return std::nullopt;
-  const auto s = v->GetIfString();
-  if (s == nullptr) return std::nullopt;
-  return s->as_string_view();
+  return StringFromValue(Get(name));
 }
 
 std::optional<std::string> ChannelArgs::GetOwnedString(
@@ -258,23 +306,53 @@ void* ChannelArgs::GetVoidPointer(absl::string_view name) const {
 }
 
 std::optional<bool> ChannelArgs::GetBool(absl::string_view name) const {
-  auto* v = Get(name);
-  if (v == nullptr) return std::nullopt;
-  auto i = v->GetIfInt();
-  if (!i.has_value()) {
-    LOG(ERROR) << name << " ignored: it must be an integer";
-    return std::nullopt;
-  }
-  switch (*i) {
-    case 0:
-      return false;
-    case 1:
-      return true;
-    default:
-      LOG(ERROR) << name << " treated as bool but set to " << *i
-                 << " (assuming true)";
-      return true;
+  return BoolFromValue(name, Get(name));
+}
+
+std::optional<int> ChannelArgs::Get(const ChannelArgKey<int>& key) const {
+  return IntFromValue(args_.Lookup(key.interned_name()));
+}
+
+std::optional<bool> ChannelArgs::Get(const ChannelArgKey<bool>& key) const {
+  return BoolFromValue(key.name(), args_.Lookup(key.interned_name()));
+}
+
+std::optional<Duration> ChannelArgs::Get(
+    const ChannelArgKey<Duration>& key) const {
+  return DurationFromValue(args_.Lookup(key.interned_name()));
+}
+
+std::optional<absl::string_view> ChannelArgs::Get(
+    const ChannelArgKey<absl::string_view>& key) const {
+  return StringFromValue(args_.Lookup(key.interned_name()));
+}
+
+template <typename T>
+ChannelArgs ChannelArgs::Set(const ChannelArgKey<T>& key, Value value) const {
+  if (const auto* p = args_.Lookup(key.interned_name())) {
+    if (*p == value) return *this;  // already have this value for this key
   }
+  return ChannelArgs(args_.Add(key.MakeKey(), std::move(value)));
+}
+
+ChannelArgs ChannelArgs::Set(const ChannelArgKey<int>& key, int value) const {
+  return Set(key, Value(value));
+}
+
+ChannelArgs ChannelArgs::Set(const ChannelArgKey<bool>& key,
+                             bool value) const {
+  return Set(key, Value(static_cast<int>(value)));
+}
+
+ChannelArgs ChannelArgs::Set(const ChannelArgKey<Duration>& key,
+                             Duration value) const {
+  return Set(key, Value(static_cast<int>(
+                      Clamp<int64_t>(value.millis(), INT_MIN, INT_MAX))));
+}
+
+ChannelArgs ChannelArgs::Set(const ChannelArgKey<absl::string_view>& key,
+                             absl::string_view value) const {
+  return Set(key, Value(std::string(value)));
 }
 
 absl::string_view ChannelArgs::Value::ToString(
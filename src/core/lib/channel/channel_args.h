@@ -287,6 +287,54 @@ struct ChannelArgNameTraits<grpc_event_engine::experimental::EventEngine> {
   }
 };
 
+namespace channel_args_detail {
+// The name held by a ChannelArgKey, as used to look it up in ChannelArgs.
+struct InternedName {
+  const RefCountedString* name;
+};
+
+inline int QsortCompare(const RefCountedStringValue& lhs, InternedName rhs) {
+  if (lhs.SameIdentity(rhs.name)) return 0;
+  return lhs.as_string_view().compare(rhs.name->as_string_view());
+}
+}  // namespace channel_args_detail
+
+// A channel arg name, bound to the type of its value.
+//
+// Keys are meant to be created once, as constants, and then used for every
+// access to their arg. Args set through a key share the key's copy of the
+// name: setting them does not allocate a new copy, and looking them up
+// through the same key recognizes their entry by identity rather than by
+// comparing characters.
+template <typename T>
+class ChannelArgKey {
+  static_assert(std::is_same<T, int>::value || std::is_same<T, bool>::value ||
+                    std::is_same<T, Duration>::value ||
+                    std::is_same<T, absl::string_view>::value,
+                "ChannelArgKey supports int, bool, Duration and string args");
+
+ public:
+  explicit ChannelArgKey(absl::string_view name)
+      : name_(RefCountedString::Make(name).release()) {}
+
+  // Keys (and so their names) are never destroyed, so that they are safe to
+  // use as globals.
+  ChannelArgKey(const ChannelArgKey&) = delete;
+  ChannelArgKey& operator=(const ChannelArgKey&) = delete;
+
+  absl::string_view name() const { return name_->as_string_view(); }
+
+ private:
+  friend class ChannelArgs;
+
+  channel_args_detail::InternedName interned_name() const { return {name_}; }
+  RefCountedStringValue MakeKey() const {
+    return RefCountedStringValue(name_->Ref());
+  }
+
+  RefCountedString* const name_;
+};
+
 class ChannelArgs {
  public:
   class Pointer {
@@ -361,6 +409,12 @@ class ChannelArgs {
       if (rep_.c_vtable() != &string_vtable_) return nullptr;
       return static_cast<RefCountedString*>(rep_.c_pointer())->Ref();
     }
+    // As GetIfString, but without taking a ref: the result is valid for as
+    // long as this value is.
+    std::optional<absl::string_view> GetIfStringView() const {
+      if (rep_.c_vtable() != &string_vtable_) return std::nullopt;
+      return static_cast<RefCountedString*>(rep_.c_pointer())->as_string_view();
+    }
     const Pointer* GetIfPointer() const {
       if (rep_.c_vtable() == &int_vtable_) return nullptr;
       if (rep_.c_vtable() == &string_vtable_) return nullptr;
@@ -512,6 +566,27 @@ class ChannelArgs {
       absl::string_view name) const;
   std::optional<bool> GetBool(absl::string_view name) const;
 
+  // Typed access through a ChannelArgKey (see above).
+  std::optional<int> Get(const ChannelArgKey<int>& key) const;
+  std::optional<bool> Get(const ChannelArgKey<bool>& key) const;
+  std::optional<Duration> Get(const ChannelArgKey<Duration>& key) const;
+  std::optional<absl::string_view> Get(
+      const ChannelArgKey<absl::string_view>& key) const;
+  GRPC_MUST_USE_RESULT ChannelArgs Set(const ChannelArgKey<int>& key,
+                                       int value) const;
+  GRPC_MUST_USE_RESULT ChannelArgs Set(const ChannelArgKey<bool>& key,
+                                       bool value) const;
+  // Stored as integer milliseconds, as GetDurationFromIntMillis expects.
+  GRPC_MUST_USE_RESULT ChannelArgs Set(const ChannelArgKey<Duration>& key,
+                                       Duration value) const;
+  GRPC_MUST_USE_RESULT ChannelArgs Set(
+      const ChannelArgKey<absl::string_view>& key,
+      absl::string_view value) const;
+  template <typename T>
+  bool Contains(const ChannelArgKey<T>& key) const {
+    return args_.Lookup(key.interned_name()) != nullptr;
+  }
+
   // Object based get/set.
   // Deal with the common case that we set a pointer to an object under
   // the same name in every usage.
@@ -550,6 +625,11 @@ class ChannelArgs {
   bool operator!=(const ChannelArgs& other) const;
   bool operator<(const ChannelArgs& other) const;
   bool operator==(const ChannelArgs& other) const;
+  // A hash of the args, equal for args that compare equal.  Pointer values
+  // contribute only their type, since comparing them may compare what they
+  // point to.  Walks all the args, so callers that need it often should
+  // keep it.
+  size_t Hash() const;
 
   // Helpers for commonly accessed things
 
@@ -566,6 +646,9 @@ class ChannelArgs {
 
   GRPC_MUST_USE_RESULT ChannelArgs Set(absl::string_view name,
                                        Value value) const;
+  template <typename T>
+  GRPC_MUST_USE_RESULT ChannelArgs Set(const ChannelArgKey<T>& key,
+                                       Value value) const;
 
   AVL<RefCountedStringValue, Value> args_;
 };
@@ -45,6 +45,10 @@ const char* CompressionAlgorithmAsString(grpc_compression_algorithm algorithm) {
       return "deflate";
     case GRPC_COMPRESS_GZIP:
       return "gzip";
+    case GRPC_COMPRESS_ZSTD:
+      return "zstd";
+    case GRPC_COMPRESS_LZ4:
+      return "lz4";
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
     default:
       return nullptr;
@@ -85,7 +89,7 @@ class CommaSeparatedLists {
  private:
   static constexpr size_t kNumLists = 1 << GRPC_COMPRESS_ALGORITHMS_COUNT;
   // Experimentally determined (tweak things until it runs).
-  static constexpr size_t kTextBufferSize = 86;
+  static constexpr size_t kTextBufferSize = 514;
   absl::string_view lists_[kNumLists];
   char text_buffer_[kTextBufferSize];
 };
@@ -101,6 +105,10 @@ std::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
     return GRPC_COMPRESS_DEFLATE;
   } else if (algorithm == "gzip") {
     return GRPC_COMPRESS_GZIP;
+  } else if (algorithm == "zstd") {
+    return GRPC_COMPRESS_ZSTD;
+  } else if (algorithm == "lz4") {
+    return GRPC_COMPRESS_LZ4;
   } else {
     return std::nullopt;
   }
@@ -120,6 +128,14 @@ CompressionAlgorithmSet::CompressionAlgorithmForLevel(
 
   CHECK_GT(level, 0);
 
+  // zstd compresses better than gzip and deflate at the same speed, so it is
+  // used at every level, and the level sets its effort instead. Like lz4, it
+  // is only picked if this build can compress with it.
+  const CompressionAlgorithmSet supported = Supported();
+  if (set_.is_set(GRPC_COMPRESS_ZSTD) && supported.IsSet(GRPC_COMPRESS_ZSTD)) {
+    return GRPC_COMPRESS_ZSTD;
+  }
+
   // Establish a "ranking" or compression algorithms in increasing order of
   // compression.
   // This is simplistic and we will probably want to introduce other dimensions
@@ -134,7 +150,11 @@ CompressionAlgorithmSet::CompressionAlgorithmForLevel(
   }
 
   if (algos.empty()) {
-    return GRPC_COMPRESS_NONE;
+    // lz4 trades ratio for speed, so it is only used when the peer does not
+    // accept anything else.
+    return set_.is_set(GRPC_COMPRESS_LZ4) && supported.IsSet(GRPC_COMPRESS_LZ4)
+               ? GRPC_COMPRESS_LZ4
+               : GRPC_COMPRESS_NONE;
   }
 
   switch (level) {
@@ -163,12 +183,25 @@ CompressionAlgorithmSet CompressionAlgorithmSet::FromUint32(uint32_t value) {
 
 CompressionAlgorithmSet CompressionAlgorithmSet::FromChannelArgs(
     const ChannelArgs& args) {
-  CompressionAlgorithmSet set;
-  static const uint32_t kEverything =
-      (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
   return CompressionAlgorithmSet::FromUint32(
       args.GetInt(GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET)
-          .value_or(kEverything));
+          .value_or(Supported().ToLegacyBitmask()) &
+      Supported().ToLegacyBitmask());
+}
+
+CompressionAlgorithmSet CompressionAlgorithmSet::Supported() {
+  static const CompressionAlgorithmSet kSupported{
+      GRPC_COMPRESS_NONE,
+      GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_GZIP,
+#ifdef HAVE_LIBZSTD
+      GRPC_COMPRESS_ZSTD,
+#endif
+#ifdef HAVE_LIBLZ4
+      GRPC_COMPRESS_LZ4,
+#endif
+  };
+  return kSupported;
 }
 
 CompressionAlgorithmSet::CompressionAlgorithmSet() = default;
@@ -266,6 +299,10 @@ grpc_compression_options CompressionOptionsFromChannelArgs(
     compression_options.enabled_algorithms_bitset =
         *enabled_algorithms_bitset | 1 /* always support no compression */;
   }
+  // Algorithms this build cannot decompress are never enabled, so that
+  // messages using them are rejected as disabled.
+  compression_options.enabled_algorithms_bitset &=
+      CompressionAlgorithmSet::Supported().ToLegacyBitmask();
   return compression_options;
 }
 
@@ -53,6 +53,8 @@ class CompressionAlgorithmSet {
   static CompressionAlgorithmSet FromUint32(uint32_t value);
   // Locate in channel args and construct from the found value.
   static CompressionAlgorithmSet FromChannelArgs(const ChannelArgs& args);
+  // Return the algorithms this build of gRPC can compress and decompress.
+  static CompressionAlgorithmSet Supported();
   // Parse a string of comma-separated compression algorithms.
   static CompressionAlgorithmSet FromString(absl::string_view str);
   // Construct an empty set.
@@ -18,25 +18,58 @@
 
 #include "src/core/lib/compression/message_compress.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
+#include <stdint.h>
 #include <string.h>
 #include <zconf.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "src/core/lib/compression/zstd_dictionary.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/sync.h"
+
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#endif
+#ifdef HAVE_LIBLZ4
+#include <lz4frame.h>
+#include <lz4hc.h>
+#endif
 
 #define OUTPUT_BLOCK_SIZE 1024
+// zstd and lz4 are used for large messages, so their output blocks grow with
+// the output, up to this size, rather than staying at OUTPUT_BLOCK_SIZE.
+#define MAX_OUTPUT_BLOCK_SIZE (128 * 1024)
 
+// Runs all of 'input' through 'flate', with 'last_flush' for its last slice:
+// Z_FINISH to end the stream, or Z_SYNC_FLUSH for a block of a stream that
+// goes on, to end it on a byte boundary. Returns -1 as soon as more than
+// 'max_output' bytes come out.
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     int last_flush = Z_FINISH,
+                     size_t max_output = SIZE_MAX) {
   int r = Z_STREAM_END;  // Do not fail on an empty input.
+  int result = 0;
   int flush;
   size_t i;
+  const size_t length_before = output->length;
   grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
   const uInt uint_max = ~uInt{0};
 
@@ -45,7 +78,7 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
   zs->next_out = GRPC_SLICE_START_PTR(outbuf);
   flush = Z_NO_FLUSH;
   for (i = 0; i < input->count; i++) {
-    if (i == input->count - 1) flush = Z_FINISH;
+    if (i == input->count - 1) flush = last_flush;
     CHECK(GRPC_SLICE_LENGTH(input->slices[i]) <= uint_max);
     zs->avail_in = static_cast<uInt> GRPC_SLICE_LENGTH(input->slices[i]);
     zs->next_in = GRPC_SLICE_START_PTR(input->slices[i]);
@@ -62,13 +95,20 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
         VLOG(2) << "zlib error (" << r << ")";
         goto error;
       }
+      if (output->length - length_before + GRPC_SLICE_LENGTH(outbuf) -
+              zs->avail_out >
+          max_output) {
+        VLOG(2) << "zlib: output larger than " << max_output;
+        result = -1;
+        goto error;
+      }
     } while (zs->avail_out == 0);
     if (zs->avail_in) {
       VLOG(2) << "zlib: not all input consumed";
       goto error;
     }
   }
-  if (r != Z_STREAM_END) {
+  if (last_flush == Z_FINISH && r != Z_STREAM_END) {
     VLOG(2) << "zlib: Data error";
     goto error;
   }
@@ -81,7 +121,7 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
 
 error:
   grpc_core::CSliceUnref(outbuf);
-  return 0;
+  return result;
 }
 
 static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
@@ -91,55 +131,711 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
+namespace {
+
+// Compression state is expensive to set up (deflate allocates about 256KB),
+// so each thread keeps one initialized stream of each kind and resets it for
+// every message instead of creating a new one.
+class ThreadZlibStreams {
+ public:
+  ~ThreadZlibStreams() {
+    for (int kind = 0; kind < kKinds; kind++) {
+      if (deflate_initialized_[kind]) deflateEnd(&deflate_[kind]);
+      if (inflate_initialized_[kind]) inflateEnd(&inflate_[kind]);
+    }
+  }
+
+  z_stream* Deflate(int gzip) { return DeflateStream(gzip ? kGzip : kZlib); }
+  // For blocks of a deflate stream, without header or trailer.
+  z_stream* RawDeflate() { return DeflateStream(kRaw); }
+
+  z_stream* Inflate(int gzip) {
+    const int kind = gzip ? kGzip : kZlib;
+    z_stream* zs = &inflate_[kind];
+    if (inflate_initialized_[kind]) {
+      CHECK_EQ(inflateReset(zs), Z_OK);
+      return zs;
+    }
+    Prepare(zs);
+    CHECK_EQ(inflateInit2(zs, WindowBits(kind)), Z_OK);
+    inflate_initialized_[kind] = true;
+    return zs;
+  }
+
+ private:
+  enum { kZlib, kGzip, kRaw, kKinds };
+
+  static int WindowBits(int kind) {
+    switch (kind) {
+      case kGzip:
+        return 15 | 16;
+      case kRaw:
+        return -15;
+      default:
+        return 15;
+    }
+  }
+
+  static void Prepare(z_stream* zs) {
+    memset(zs, 0, sizeof(*zs));
+    zs->zalloc = zalloc_gpr;
+    zs->zfree = zfree_gpr;
+  }
+
+  z_stream* DeflateStream(int kind) {
+    z_stream* zs = &deflate_[kind];
+    if (deflate_initialized_[kind]) {
+      CHECK_EQ(deflateReset(zs), Z_OK);
+      return zs;
+    }
+    Prepare(zs);
+    CHECK_EQ(deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                          WindowBits(kind), 8, Z_DEFAULT_STRATEGY),
+             Z_OK);
+    deflate_initialized_[kind] = true;
+    return zs;
+  }
+
+  // Only deflate uses kRaw.
+  z_stream deflate_[kKinds];
+  z_stream inflate_[kKinds];
+  bool deflate_initialized_[kKinds] = {};
+  bool inflate_initialized_[kKinds] = {};
+};
+
+thread_local ThreadZlibStreams g_zlib_streams;
+
+}  // namespace
+
+// Drops the slices appended to 'output' since it had 'count_before' slices and
+// 'length_before' bytes.
+static void truncate_output(grpc_slice_buffer* output, size_t count_before,
+                            size_t length_before) {
+  for (size_t i = count_before; i < output->count; i++) {
+    grpc_core::CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                          int gzip) {
-  z_stream zs;
   int r;
-  size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
-  deflateEnd(&zs);
+  z_stream* zs = g_zlib_streams.Deflate(gzip);
+  r = zlib_body(zs, input, output, deflate) && output->length < input->length;
+  if (!r) truncate_output(output, count_before, length_before);
   return r;
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
-  z_stream zs;
+                           int gzip, size_t max_length) {
   int r;
-  size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
-  inflateEnd(&zs);
+  z_stream* zs = g_zlib_streams.Inflate(gzip);
+  r = zlib_body(zs, input, output, inflate, Z_FINISH, max_length);
+  if (r != 1) truncate_output(output, count_before, length_before);
+  return r;
+}
+
+#if defined(HAVE_LIBZSTD) || defined(HAVE_LIBLZ4)
+
+// Returns the size of the next output block, doubling the output produced so
+// far.
+static size_t next_output_block_size(size_t produced) {
+  return std::clamp<size_t>(produced, OUTPUT_BLOCK_SIZE,
+                            MAX_OUTPUT_BLOCK_SIZE);
+}
+
+// Appends the filled part of 'outbuf' to 'output', or drops it if it is empty.
+static void add_output_block(grpc_slice_buffer* output, grpc_slice outbuf,
+                             size_t filled) {
+  if (filled == 0) {
+    grpc_core::CSliceUnref(outbuf);
+    return;
+  }
+  outbuf.data.refcounted.length = filled;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+}
+#endif
+
+#ifdef HAVE_LIBZSTD
+namespace {
+
+// Like ThreadZlibStreams, for zstd.
+class ThreadZstdContexts {
+ public:
+  ~ThreadZstdContexts() {
+    ZSTD_freeCCtx(cctx_);
+    ZSTD_freeDCtx(dctx_);
+  }
+
+  // Returns the compression context with the parameters and dictionary of
+  // the previous message cleared.
+  ZSTD_CCtx* Compression() {
+    if (cctx_ == nullptr) {
+      cctx_ = ZSTD_createCCtx();
+      CHECK_NE(cctx_, nullptr);
+    } else {
+      ZSTD_CCtx_reset(cctx_, ZSTD_reset_session_and_parameters);
+    }
+    return cctx_;
+  }
+
+  ZSTD_DCtx* Decompression() {
+    if (dctx_ == nullptr) {
+      dctx_ = ZSTD_createDCtx();
+      CHECK_NE(dctx_, nullptr);
+    } else {
+      ZSTD_DCtx_reset(dctx_, ZSTD_reset_session_and_parameters);
+    }
+    return dctx_;
+  }
+
+ private:
+  ZSTD_CCtx* cctx_ = nullptr;
+  ZSTD_DCtx* dctx_ = nullptr;
+};
+
+thread_local ThreadZstdContexts g_zstd_contexts;
+
+}  // namespace
+
+// Writes 'input' as one zstd frame, compressed against 'dictionary' if not
+// null, even if it gets larger.
+static int zstd_write_frame(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                            grpc_compression_level level,
+                            const grpc_core::ZstdDictionary* dictionary) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  ZSTD_CCtx* cctx = g_zstd_contexts.Compression();
+  if (dictionary != nullptr) {
+    const ZSTD_CDict* cdict = dictionary->CompressionDictionary(level);
+    if (cdict == nullptr) return 0;
+    ZSTD_CCtx_refCDict(cctx, cdict);
+  } else {
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel,
+                           grpc_core::ZstdCompressionLevel(level));
+  }
+  ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(std::min<size_t>(
+      ZSTD_compressBound(input->length), MAX_OUTPUT_BLOCK_SIZE));
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf),
+                        GRPC_SLICE_LENGTH(outbuf), 0};
+  size_t produced = 0;
+  int r = 1;
+  // An empty input still needs a frame to be written.
+  for (size_t i = 0; r && (i < input->count || i == 0); i++) {
+    const bool last = input->count == 0 || i == input->count - 1;
+    ZSTD_inBuffer in = {nullptr, 0, 0};
+    if (input->count != 0) {
+      in.src = GRPC_SLICE_START_PTR(input->slices[i]);
+      in.size = GRPC_SLICE_LENGTH(input->slices[i]);
+    }
+    while (true) {
+      if (out.pos == out.size) {
+        produced += out.pos;
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(next_output_block_size(produced));
+        out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf), 0};
+      }
+      const size_t remaining = ZSTD_compressStream2(
+          cctx, &out, &in, last ? ZSTD_e_end : ZSTD_e_continue);
+      if (ZSTD_isError(remaining)) {
+        VLOG(2) << "zstd error: " << ZSTD_getErrorName(remaining);
+        r = 0;
+        break;
+      }
+      // Until the end, zstd is done with a slice once it has consumed it;
+      // at the end, once it has flushed the whole frame.
+      if (last ? remaining == 0 : in.pos == in.size) break;
+    }
+  }
+  if (r) {
+    add_output_block(output, outbuf, out.pos);
+  } else {
+    grpc_core::CSliceUnref(outbuf);
+    truncate_output(output, count_before, length_before);
+  }
+  return r;
+}
+
+// Compresses with 'dictionary', if not null.
+static int zstd_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                         grpc_compression_level level,
+                         const grpc_core::ZstdDictionary* dictionary) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r = zstd_write_frame(input, output, level, dictionary) &&
+          output->length - length_before < input->length;
+  if (!r) truncate_output(output, count_before, length_before);
+  return r;
+}
+
+// Decompresses with 'dictionary', if not null. Returns -1 as soon as more than
+// 'max_length' bytes come out.
+static int zstd_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                           const grpc_core::ZstdDictionary* dictionary,
+                           size_t max_length) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  ZSTD_DCtx* dctx = g_zstd_contexts.Decompression();
+  if (dictionary != nullptr) {
+    ZSTD_DCtx_refDDict(dctx, dictionary->DecompressionDictionary());
+  }
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(next_output_block_size(input->length));
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf),
+                        GRPC_SLICE_LENGTH(outbuf), 0};
+  size_t produced = 0;
+  // Nonzero until a whole frame has been decoded and flushed.
+  size_t remaining = 1;
+  int r = 1;
+  for (size_t i = 0; r == 1 && i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    // Keep going while there is input, or while the output is full before
+    // the end of the frame, since zstd may then hold decoded data back.
+    while (in.pos < in.size || (out.pos == out.size && remaining != 0)) {
+      if (out.pos == out.size) {
+        produced += out.pos;
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(next_output_block_size(produced));
+        out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf), 0};
+      }
+      const size_t out_before = out.pos;
+      const size_t in_before = in.pos;
+      remaining = ZSTD_decompressStream(dctx, &out, &in);
+      if (ZSTD_isError(remaining)) {
+        VLOG(2) << "zstd error: " << ZSTD_getErrorName(remaining);
+        r = 0;
+        break;
+      }
+      if (produced + out.pos > max_length) {
+        VLOG(2) << "zstd: output larger than " << max_length;
+        r = -1;
+        break;
+      }
+      if (out.pos == out_before && in.pos == in_before) {
+        // No progress with room to spare means the input is bad.
+        if (in.pos < in.size) r = 0;
+        break;
+      }
+    }
+  }
+  if (r == 1 && remaining != 0) {
+    VLOG(2) << "zstd: truncated frame";
+    r = 0;
+  }
+  if (r == 1) {
+    add_output_block(output, outbuf, out.pos);
+  } else {
+    grpc_core::CSliceUnref(outbuf);
+    truncate_output(output, count_before, length_before);
+  }
+  return r;
+}
+#endif  // HAVE_LIBZSTD
+
+#ifdef HAVE_LIBLZ4
+static int lz4_level(grpc_compression_level level) {
+  // Levels below LZ4HC_CLEVEL_MIN use the fast compressor.
+  return level == GRPC_COMPRESS_LEVEL_HIGH ? LZ4HC_CLEVEL_DEFAULT : 0;
+}
+
+static int lz4_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                        grpc_compression_level level) {
+  LZ4F_compressionContext_t cctx;
+  if (LZ4F_isError(LZ4F_createCompressionContext(&cctx, LZ4F_VERSION))) {
+    return 0;
+  }
+  LZ4F_preferences_t prefs;
+  memset(&prefs, 0, sizeof(prefs));
+  prefs.frameInfo.contentSize = input->length;
+  prefs.compressionLevel = lz4_level(level);
+  // The frame bound covers the header, every block and the end mark, so the
+  // whole frame is written into one slice.
+  grpc_slice outbuf =
+      GRPC_SLICE_MALLOC(LZ4F_compressFrameBound(input->length, &prefs));
+  uint8_t* out = GRPC_SLICE_START_PTR(outbuf);
+  const size_t capacity = GRPC_SLICE_LENGTH(outbuf);
+  size_t pos = LZ4F_compressBegin(cctx, out, capacity, &prefs);
+  int r = !LZ4F_isError(pos);
+  for (size_t i = 0; r && i < input->count; i++) {
+    const size_t n = LZ4F_compressUpdate(
+        cctx, out + pos, capacity - pos, GRPC_SLICE_START_PTR(input->slices[i]),
+        GRPC_SLICE_LENGTH(input->slices[i]), nullptr);
+    if (LZ4F_isError(n)) {
+      VLOG(2) << "lz4 error: " << LZ4F_getErrorName(n);
+      r = 0;
+    } else {
+      pos += n;
+    }
+  }
+  if (r) {
+    const size_t n = LZ4F_compressEnd(cctx, out + pos, capacity - pos, nullptr);
+    if (LZ4F_isError(n)) {
+      VLOG(2) << "lz4 error: " << LZ4F_getErrorName(n);
+      r = 0;
+    } else {
+      pos += n;
+    }
+  }
+  LZ4F_freeCompressionContext(cctx);
+  r = r && pos < input->length;
+  if (r) {
+    add_output_block(output, outbuf, pos);
+  } else {
+    grpc_core::CSliceUnref(outbuf);
+  }
   return r;
 }
 
+// Returns -1 as soon as more than 'max_length' bytes come out.
+static int lz4_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                          size_t max_length) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  LZ4F_decompressionContext_t dctx;
+  if (LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION))) {
+    return 0;
+  }
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(next_output_block_size(input->length));
+  size_t out_pos = 0;
+  size_t produced = 0;
+  // Nonzero until a whole frame has been decoded and flushed.
+  size_t hint = 1;
+  int r = 1;
+  for (size_t i = 0; r == 1 && i <= input->count; i++) {
+    // After the last slice, go round once more without input to flush what
+    // lz4 holds back when the output is full.
+    const uint8_t* src =
+        i < input->count ? GRPC_SLICE_START_PTR(input->slices[i]) : nullptr;
+    size_t src_left =
+        i < input->count ? GRPC_SLICE_LENGTH(input->slices[i]) : 0;
+    while (src_left > 0 || (out_pos == GRPC_SLICE_LENGTH(outbuf) && hint)) {
+      if (out_pos == GRPC_SLICE_LENGTH(outbuf)) {
+        produced += out_pos;
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(next_output_block_size(produced));
+        out_pos = 0;
+      }
+      size_t dst_size = GRPC_SLICE_LENGTH(outbuf) - out_pos;
+      size_t src_size = src_left;
+      hint = LZ4F_decompress(dctx, GRPC_SLICE_START_PTR(outbuf) + out_pos,
+                             &dst_size, src, &src_size, nullptr);
+      if (LZ4F_isError(hint)) {
+        VLOG(2) << "lz4 error: " << LZ4F_getErrorName(hint);
+        r = 0;
+        break;
+      }
+      out_pos += dst_size;
+      src += src_size;
+      src_left -= src_size;
+      if (produced + out_pos > max_length) {
+        VLOG(2) << "lz4: output larger than " << max_length;
+        r = -1;
+        break;
+      }
+      if (dst_size == 0 && src_size == 0) {
+        // No progress with room to spare means the input is bad.
+        if (src_left > 0) r = 0;
+        break;
+      }
+    }
+  }
+  if (r == 1 && hint != 0) {
+    VLOG(2) << "lz4: truncated frame";
+    r = 0;
+  }
+  if (r == 1) {
+    add_output_block(output, outbuf, out_pos);
+  } else {
+    grpc_core::CSliceUnref(outbuf);
+    truncate_output(output, count_before, length_before);
+  }
+  LZ4F_freeDecompressionContext(dctx);
+  return r;
+}
+#endif  // HAVE_LIBLZ4
+
+// Large messages are compressed in blocks of these sizes in parallel. Deflate
+// blocks start from the window of the previous one, so they can be small;
+// zstd frames are independent, so they are larger to lose less.
+#define DEFLATE_PARALLEL_BLOCK_SIZE (256 * 1024)
+#define ZSTD_PARALLEL_BLOCK_SIZE (1024 * 1024)
+// The deflate window, carried from one block to the next.
+#define DEFLATE_WINDOW_SIZE (32 * 1024)
+
+namespace {
+
+// The blocks of a message processed in parallel. Threads claim blocks until
+// none are left, so the calling thread never waits for a thread that has not
+// started: it processes whatever the others have not claimed.
+struct ParallelBlocks {
+  ParallelBlocks(size_t count, absl::FunctionRef<void(size_t)> process)
+      : count(count), process(process) {}
+
+  void Work() {
+    for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+         i = next.fetch_add(1, std::memory_order_relaxed)) {
+      process(i);
+      grpc_core::MutexLock lock(&mu);
+      if (++done == count) cv.Signal();
+    }
+  }
+
+  const size_t count;
+  // Only called for claimed blocks, so it need not outlive the calling
+  // thread's wait for threads that start late.
+  absl::FunctionRef<void(size_t)> process;
+  std::atomic<size_t> next{0};
+  grpc_core::Mutex mu;
+  grpc_core::CondVar cv;
+  size_t done ABSL_GUARDED_BY(mu) = 0;
+};
+
+}  // namespace
+
+// Runs 'process' for each of 'count' blocks, on the calling thread and on
+// 'event_engine' threads, up to one per core, and returns once all are done.
+static void run_in_parallel(
+    size_t count, grpc_event_engine::experimental::EventEngine* event_engine,
+    absl::FunctionRef<void(size_t)> process) {
+  auto blocks = std::make_shared<ParallelBlocks>(count, process);
+  const size_t threads =
+      std::min<size_t>(count, std::max(1u, gpr_cpu_num_cores()));
+  for (size_t i = 1; i < threads; i++) {
+    event_engine->Run([blocks]() { blocks->Work(); });
+  }
+  blocks->Work();
+  grpc_core::MutexLock lock(&blocks->mu);
+  while (blocks->done < count) blocks->cv.Wait(&blocks->mu);
+}
+
+// Splits 'input' into blocks of 'block_size' bytes, the last one possibly
+// shorter, referencing its slices.
+static std::vector<grpc_core::SliceBuffer> split_blocks(
+    grpc_slice_buffer* input, size_t block_size) {
+  std::vector<grpc_core::SliceBuffer> blocks;
+  size_t offset = 0;
+  for (size_t i = 0; i < input->count;) {
+    grpc_core::SliceBuffer& block = blocks.emplace_back();
+    while (block.Length() < block_size && i < input->count) {
+      const grpc_slice slice = input->slices[i];
+      const size_t n = std::min(block_size - block.Length(),
+                                GRPC_SLICE_LENGTH(slice) - offset);
+      if (n > 0) {
+        grpc_slice_buffer_add(block.c_slice_buffer(),
+                              grpc_slice_sub(slice, offset, offset + n));
+      }
+      offset += n;
+      if (offset == GRPC_SLICE_LENGTH(slice)) {
+        i++;
+        offset = 0;
+      }
+    }
+  }
+  return blocks;
+}
+
+// Copies the last bytes of 'buffer', up to 'n', to 'dst'. Returns how many.
+static size_t copy_tail(grpc_slice_buffer* buffer, uint8_t* dst, size_t n) {
+  n = std::min(n, buffer->length);
+  size_t skip = buffer->length - n;
+  size_t pos = 0;
+  for (size_t i = 0; i < buffer->count; i++) {
+    const size_t length = GRPC_SLICE_LENGTH(buffer->slices[i]);
+    if (skip >= length) {
+      skip -= length;
+      continue;
+    }
+    memcpy(dst + pos, GRPC_SLICE_START_PTR(buffer->slices[i]) + skip,
+           length - skip);
+    pos += length - skip;
+    skip = 0;
+  }
+  return n;
+}
+
+// Like pigz: compresses the blocks of 'input' as parts of one deflate stream,
+// each ending on a byte boundary and starting from the window of the one
+// before, then wraps them in the zlib or gzip header and trailer. Any inflate
+// reads the result.
+static int zlib_compress_parallel(
+    grpc_slice_buffer* input, grpc_slice_buffer* output, int gzip,
+    grpc_event_engine::experimental::EventEngine* event_engine) {
+  std::vector<grpc_core::SliceBuffer> blocks =
+      split_blocks(input, DEFLATE_PARALLEL_BLOCK_SIZE);
+  std::vector<grpc_core::SliceBuffer> compressed(blocks.size());
+  std::vector<uLong> checks(blocks.size());
+  std::atomic<bool> ok{true};
+  run_in_parallel(blocks.size(), event_engine, [&](size_t i) {
+    grpc_slice_buffer* block = blocks[i].c_slice_buffer();
+    z_stream* zs = g_zlib_streams.RawDeflate();
+    if (i > 0) {
+      std::unique_ptr<uint8_t[]> window(new uint8_t[DEFLATE_WINDOW_SIZE]);
+      const size_t n = copy_tail(blocks[i - 1].c_slice_buffer(), window.get(),
+                                 DEFLATE_WINDOW_SIZE);
+      CHECK_EQ(deflateSetDictionary(zs, window.get(), static_cast<uInt>(n)),
+               Z_OK);
+    }
+    uLong check = gzip ? crc32(0, Z_NULL, 0) : adler32(0, Z_NULL, 0);
+    for (size_t j = 0; j < block->count; j++) {
+      const grpc_slice slice = block->slices[j];
+      const uInt length = static_cast<uInt>(GRPC_SLICE_LENGTH(slice));
+      check = gzip ? crc32(check, GRPC_SLICE_START_PTR(slice), length)
+                   : adler32(check, GRPC_SLICE_START_PTR(slice), length);
+    }
+    checks[i] = check;
+    if (!zlib_body(zs, block, compressed[i].c_slice_buffer(), deflate,
+                   i + 1 == blocks.size() ? Z_FINISH : Z_SYNC_FLUSH)) {
+      ok.store(false, std::memory_order_relaxed);
+    }
+  });
+  if (!ok.load(std::memory_order_relaxed)) return 0;
+  uLong check = checks[0];
+  size_t length = 0;
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (i > 0) {
+      const z_off_t block_length = static_cast<z_off_t>(blocks[i].Length());
+      check = gzip ? crc32_combine(check, checks[i], block_length)
+                   : adler32_combine(check, checks[i], block_length);
+    }
+    length += compressed[i].Length();
+  }
+  // The gzip header has no name, time or extra flags, and an unknown OS.
+  static const uint8_t kGzipHeader[] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+  // Deflate with a 32KB window and the default level.
+  static const uint8_t kZlibHeader[] = {0x78, 0x9c};
+  const size_t header_size = gzip ? sizeof(kGzipHeader) : sizeof(kZlibHeader);
+  const size_t trailer_size = gzip ? 8 : 4;
+  if (header_size + length + trailer_size >= input->length) return 0;
+  grpc_slice_buffer_add(
+      output, grpc_slice_from_copied_buffer(
+                  reinterpret_cast<const char*>(gzip ? kGzipHeader
+                                                     : kZlibHeader),
+                  header_size));
+  for (grpc_core::SliceBuffer& block : compressed) {
+    grpc_slice_buffer_move_into(block.c_slice_buffer(), output);
+  }
+  uint8_t trailer[8];
+  if (gzip) {
+    // CRC-32 and length modulo 2^32, little-endian.
+    const uint32_t input_length = static_cast<uint32_t>(input->length);
+    for (int i = 0; i < 4; i++) {
+      trailer[i] = static_cast<uint8_t>(check >> (8 * i));
+      trailer[4 + i] = static_cast<uint8_t>(input_length >> (8 * i));
+    }
+  } else {
+    // Adler-32, big-endian.
+    for (int i = 0; i < 4; i++) {
+      trailer[i] = static_cast<uint8_t>(check >> (24 - 8 * i));
+    }
+  }
+  grpc_slice_buffer_add(
+      output, grpc_slice_from_copied_buffer(
+                  reinterpret_cast<const char*>(trailer), trailer_size));
+  return 1;
+}
+
+#ifdef HAVE_LIBZSTD
+// Compresses the blocks of 'input' as independent zstd frames, which zstd
+// decompresses as their concatenation.
+static int zstd_compress_parallel(
+    grpc_slice_buffer* input, grpc_slice_buffer* output,
+    grpc_compression_level level,
+    grpc_event_engine::experimental::EventEngine* event_engine) {
+  std::vector<grpc_core::SliceBuffer> blocks =
+      split_blocks(input, ZSTD_PARALLEL_BLOCK_SIZE);
+  std::vector<grpc_core::SliceBuffer> compressed(blocks.size());
+  std::atomic<bool> ok{true};
+  run_in_parallel(blocks.size(), event_engine, [&](size_t i) {
+    if (!zstd_write_frame(blocks[i].c_slice_buffer(),
+                          compressed[i].c_slice_buffer(), level, nullptr)) {
+      ok.store(false, std::memory_order_relaxed);
+    }
+  });
+  if (!ok.load(std::memory_order_relaxed)) return 0;
+  size_t length = 0;
+  for (grpc_core::SliceBuffer& frame : compressed) length += frame.Length();
+  if (length >= input->length) return 0;
+  for (grpc_core::SliceBuffer& frame : compressed) {
+    grpc_slice_buffer_move_into(frame.c_slice_buffer(), output);
+  }
+  return 1;
+}
+
+// Decompresses each frame of a message made of several in parallel, and
+// anything else like zstd_decompress().
+static int zstd_decompress_parallel(
+    grpc_slice_buffer* input, grpc_slice_buffer* output, size_t max_length,
+    grpc_event_engine::experimental::EventEngine* event_engine) {
+  if (input->length < 2 * ZSTD_PARALLEL_BLOCK_SIZE) {
+    return zstd_decompress(input, output, nullptr, max_length);
+  }
+  // Frames are only found in contiguous bytes.
+  grpc_slice flat;
+  if (input->count == 1) {
+    flat = grpc_core::CSliceRef(input->slices[0]);
+  } else {
+    flat = GRPC_SLICE_MALLOC(input->length);
+    grpc_slice_buffer_copy_first_into_buffer(input, input->length,
+                                             GRPC_SLICE_START_PTR(flat));
+  }
+  std::vector<grpc_core::SliceBuffer> frames;
+  // The content size that each frame declares, which zstd holds it to.
+  std::vector<size_t> frame_lengths;
+  size_t total_length = 0;
+  const uint8_t* bytes = GRPC_SLICE_START_PTR(flat);
+  for (size_t pos = 0; pos < input->length;) {
+    const size_t size =
+        ZSTD_findFrameCompressedSize(bytes + pos, input->length - pos);
+    const unsigned long long content_size =
+        ZSTD_isError(size)
+            ? ZSTD_CONTENTSIZE_ERROR
+            : ZSTD_getFrameContentSize(bytes + pos, input->length - pos);
+    if (content_size == ZSTD_CONTENTSIZE_ERROR ||
+        content_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+      frames.clear();
+      break;
+    }
+    // Every frame is decompressed at once, so the limit is checked first.
+    if (content_size > max_length - total_length) {
+      VLOG(2) << "zstd: output larger than " << max_length;
+      grpc_core::CSliceUnref(flat);
+      return -1;
+    }
+    grpc_slice_buffer_add(frames.emplace_back().c_slice_buffer(),
+                          grpc_slice_sub(flat, pos, pos + size));
+    frame_lengths.push_back(content_size);
+    total_length += content_size;
+    pos += size;
+  }
+  grpc_core::CSliceUnref(flat);
+  // With one frame there is nothing to parallelize, and bad input or frames
+  // of unknown size get the errors and limits of the usual path.
+  if (frames.size() < 2) {
+    return zstd_decompress(input, output, nullptr, max_length);
+  }
+  std::vector<grpc_core::SliceBuffer> decompressed(frames.size());
+  std::atomic<bool> ok{true};
+  run_in_parallel(frames.size(), event_engine, [&](size_t i) {
+    if (zstd_decompress(frames[i].c_slice_buffer(),
+                        decompressed[i].c_slice_buffer(), nullptr,
+                        frame_lengths[i]) != 1) {
+      ok.store(false, std::memory_order_relaxed);
+    }
+  });
+  if (!ok.load(std::memory_order_relaxed)) return 0;
+  for (grpc_core::SliceBuffer& frame : decompressed) {
+    grpc_slice_buffer_move_into(frame.c_slice_buffer(), output);
+  }
+  return 1;
+}
+#endif  // HAVE_LIBZSTD
+
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   size_t i;
   for (i = 0; i < input->count; i++) {
@@ -149,6 +845,7 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
 }
 
 static int compress_inner(grpc_compression_algorithm algorithm,
+                          grpc_compression_level level,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
@@ -159,6 +856,18 @@ static int compress_inner(grpc_compression_algorithm algorithm,
       return zlib_compress(input, output, 0);
     case GRPC_COMPRESS_GZIP:
       return zlib_compress(input, output, 1);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef HAVE_LIBZSTD
+      return zstd_compress(input, output, level, nullptr);
+#else
+      return 0;
+#endif
+    case GRPC_COMPRESS_LZ4:
+#ifdef HAVE_LIBLZ4
+      return lz4_compress(input, output, level);
+#else
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -168,7 +877,15 @@ static int compress_inner(grpc_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress_with_level(algorithm, GRPC_COMPRESS_LEVEL_MED,
+                                      input, output);
+}
+
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 grpc_compression_level level,
+                                 grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output) {
+  if (!compress_inner(algorithm, level, input, output)) {
     copy(input, output);
     return 0;
   }
@@ -177,16 +894,143 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  return grpc_msg_decompress_with_limit(algorithm, input, output, SIZE_MAX);
+}
+
+int grpc_msg_decompress_with_limit(grpc_compression_algorithm algorithm,
+                                   grpc_slice_buffer* input,
+                                   grpc_slice_buffer* output,
+                                   size_t max_length) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
+      if (input->length > max_length) return -1;
       return copy(input, output);
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, max_length);
     case GRPC_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(input, output, 1, max_length);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef HAVE_LIBZSTD
+      return zstd_decompress(input, output, nullptr, max_length);
+#else
+      return 0;
+#endif
+    case GRPC_COMPRESS_LZ4:
+#ifdef HAVE_LIBLZ4
+      return lz4_decompress(input, output, max_length);
+#else
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
   LOG(ERROR) << "invalid compression algorithm " << algorithm;
   return 0;
 }
+
+int grpc_msg_compress_parallel(
+    grpc_compression_algorithm algorithm, grpc_compression_level level,
+    grpc_slice_buffer* input, grpc_slice_buffer* output,
+    grpc_event_engine::experimental::EventEngine* event_engine) {
+  int r;
+  switch (algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+    case GRPC_COMPRESS_GZIP:
+      if (input->length < 2 * DEFLATE_PARALLEL_BLOCK_SIZE) break;
+      r = zlib_compress_parallel(input, output,
+                                 algorithm == GRPC_COMPRESS_GZIP, event_engine);
+      if (!r) copy(input, output);
+      return r;
+#ifdef HAVE_LIBZSTD
+    case GRPC_COMPRESS_ZSTD:
+      if (input->length < 2 * ZSTD_PARALLEL_BLOCK_SIZE) break;
+      r = zstd_compress_parallel(input, output, level, event_engine);
+      if (!r) copy(input, output);
+      return r;
+#endif
+    default:
+      break;
+  }
+  return grpc_msg_compress_with_level(algorithm, level, input, output);
+}
+
+int grpc_msg_decompress_parallel(
+    grpc_compression_algorithm algorithm, grpc_slice_buffer* input,
+    grpc_slice_buffer* output, size_t max_length,
+    grpc_event_engine::experimental::EventEngine* event_engine) {
+#ifdef HAVE_LIBZSTD
+  if (algorithm == GRPC_COMPRESS_ZSTD) {
+    return zstd_decompress_parallel(input, output, max_length, event_engine);
+  }
+#else
+  (void)event_engine;
+#endif
+  return grpc_msg_decompress_with_limit(algorithm, input, output, max_length);
+}
+
+double grpc_msg_sample_entropy(grpc_slice_buffer* input) {
+  // Up to kSampleBlocks blocks spread over the message, so that a header or
+  // a trailer does not decide for the whole of it.
+  constexpr size_t kSampleBlocks = 8;
+  constexpr size_t kSampleBlockSize = 512;
+  const size_t length = input->length;
+  if (length == 0) return 0;
+  size_t counts[256] = {};
+  size_t sampled = 0;
+  const size_t blocks =
+      length <= kSampleBlocks * kSampleBlockSize ? 1 : kSampleBlocks;
+  const size_t block_size = blocks == 1 ? length : kSampleBlockSize;
+  size_t slice_index = 0;
+  size_t slice_start = 0;
+  for (size_t b = 0; b < blocks; b++) {
+    size_t begin = blocks == 1 ? 0 : b * (length - block_size) / (blocks - 1);
+    const size_t end = begin + block_size;
+    while (begin < end) {
+      size_t slice_length = GRPC_SLICE_LENGTH(input->slices[slice_index]);
+      while (begin >= slice_start + slice_length) {
+        slice_start += slice_length;
+        slice_index++;
+        slice_length = GRPC_SLICE_LENGTH(input->slices[slice_index]);
+      }
+      const uint8_t* bytes = GRPC_SLICE_START_PTR(input->slices[slice_index]);
+      const size_t stop = std::min(end, slice_start + slice_length);
+      for (size_t i = begin; i < stop; i++) counts[bytes[i - slice_start]]++;
+      sampled += stop - begin;
+      begin = stop;
+    }
+  }
+  double entropy = 0;
+  for (size_t count : counts) {
+    if (count == 0) continue;
+    const double p = static_cast<double>(count) / sampled;
+    entropy -= p * std::log2(p);
+  }
+  return entropy;
+}
+
+int grpc_msg_compress_zstd_with_dictionary(
+    const grpc_core::ZstdDictionary& dictionary, grpc_compression_level level,
+    grpc_slice_buffer* input, grpc_slice_buffer* output) {
+#ifdef HAVE_LIBZSTD
+  if (zstd_compress(input, output, level, &dictionary)) return 1;
+#else
+  (void)dictionary;
+  (void)level;
+#endif
+  copy(input, output);
+  return 0;
+}
+
+int grpc_msg_decompress_zstd_with_dictionary(
+    const grpc_core::ZstdDictionary& dictionary, grpc_slice_buffer* input,
+    grpc_slice_buffer* output, size_t max_length) {
+#ifdef HAVE_LIBZSTD
+  return zstd_decompress(input, output, &dictionary, max_length);
+#else
+  (void)dictionary;
+  (void)input;
+  (void)output;
+  (void)max_length;
+  return 0;
+#endif
+}
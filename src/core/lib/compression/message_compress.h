@@ -22,6 +22,17 @@
 #include <grpc/impl/compression_types.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+namespace grpc_core {
+class ZstdDictionary;
+}  // namespace grpc_core
+
+namespace grpc_event_engine {
+namespace experimental {
+class EventEngine;
+}  // namespace experimental
+}  // namespace grpc_event_engine
 
 // compress 'input' to 'output' using 'algorithm'.
 // On success, appends compressed slices to output and returns 1.
@@ -29,10 +40,61 @@
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// Like grpc_msg_compress(), which uses GRPC_COMPRESS_LEVEL_MED, with 'level'
+// setting the effort of the algorithms that have several (zstd and lz4).
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 grpc_compression_level level,
+                                 grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output);
+
 // decompress 'input' to 'output' using 'algorithm'.
 // On success, appends slices to output and returns 1.
 // On failure, output is unchanged, and returns 0.
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// Like grpc_msg_decompress(), giving up as soon as more than 'max_length'
+// bytes come out, so that a small message cannot inflate to any size before
+// its decompressed size is checked. The output is produced in bounded
+// slices rather than one contiguous block.
+// Returns -1, with output unchanged, if the message is larger.
+int grpc_msg_decompress_with_limit(grpc_compression_algorithm algorithm,
+                                   grpc_slice_buffer* input,
+                                   grpc_slice_buffer* output,
+                                   size_t max_length);
+
+// Like grpc_msg_compress_with_level(), compressing large deflate, gzip and
+// zstd messages in blocks, in parallel on the calling thread and on threads
+// of 'event_engine'. The result is an ordinary message of the algorithm
+// (several frames for zstd), which any peer decompresses.
+int grpc_msg_compress_parallel(
+    grpc_compression_algorithm algorithm, grpc_compression_level level,
+    grpc_slice_buffer* input, grpc_slice_buffer* output,
+    grpc_event_engine::experimental::EventEngine* event_engine);
+
+// Like grpc_msg_decompress_with_limit(), decompressing the frames of large
+// zstd messages made of several in parallel, as grpc_msg_compress_parallel()
+// writes them.
+int grpc_msg_decompress_parallel(
+    grpc_compression_algorithm algorithm, grpc_slice_buffer* input,
+    grpc_slice_buffer* output, size_t max_length,
+    grpc_event_engine::experimental::EventEngine* event_engine);
+
+// Estimates how compressible 'input' is from a sample of its bytes, as their
+// entropy in bits per byte: from 0 for a single repeated byte to 8 for
+// random (or already compressed) data.
+double grpc_msg_sample_entropy(grpc_slice_buffer* input);
+
+// Like grpc_msg_compress_with_level() with GRPC_COMPRESS_ZSTD, compressing
+// against 'dictionary'.
+int grpc_msg_compress_zstd_with_dictionary(
+    const grpc_core::ZstdDictionary& dictionary, grpc_compression_level level,
+    grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+// Like grpc_msg_decompress_with_limit() with GRPC_COMPRESS_ZSTD, for messages
+// compressed against 'dictionary'.
+int grpc_msg_decompress_zstd_with_dictionary(
+    const grpc_core::ZstdDictionary& dictionary, grpc_slice_buffer* input,
+    grpc_slice_buffer* output, size_t max_length);
+
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
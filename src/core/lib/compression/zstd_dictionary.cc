@@ -0,0 +1,196 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/lib/compression/zstd_dictionary.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <map>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+
+#ifdef HAVE_LIBZSTD
+#include <zdict.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+constexpr size_t kMaxIdLength = 64;
+
+bool IsValidId(absl::string_view id) {
+  if (id.empty() || id.size() > kMaxIdLength) return false;
+  for (char c : id) {
+    if (!absl::ascii_isalnum(c) && c != '-' && c != '_' && c != '.') {
+      return false;
+    }
+  }
+  return true;
+}
+
+struct Registry {
+  Mutex mu;
+  // Ordered, so that the advertised ids do not change from run to run.
+  std::map<std::string, RefCountedPtr<ZstdDictionary>, std::less<>>
+      dictionaries ABSL_GUARDED_BY(mu);
+  Slice ids ABSL_GUARDED_BY(mu);
+};
+
+Registry& GetRegistry() {
+  static NoDestruct<Registry> registry;
+  return *registry;
+}
+
+}  // namespace
+
+ZstdDictionary::ZstdDictionary(absl::string_view id, std::string content)
+    : id_(id), content_(std::move(content)) {}
+
+absl::StatusOr<RefCountedPtr<ZstdDictionary>> ZstdDictionary::Create(
+    absl::string_view id, std::string content) {
+  if (!IsValidId(id)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("invalid zstd dictionary id '", id, "'"));
+  }
+#ifdef HAVE_LIBZSTD
+  if (content.empty()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("zstd dictionary '", id, "' is empty"));
+  }
+  RefCountedPtr<ZstdDictionary> dictionary(
+      new ZstdDictionary(id, std::move(content)));
+  dictionary->ddict_ = ZSTD_createDDict(dictionary->content_.data(),
+                                        dictionary->content_.size());
+  if (dictionary->ddict_ == nullptr) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("zstd dictionary '", id, "' cannot be loaded"));
+  }
+  return dictionary;
+#else
+  return absl::UnimplementedError("gRPC was built without zstd");
+#endif
+}
+
+absl::StatusOr<RefCountedPtr<ZstdDictionary>> ZstdDictionary::Train(
+    absl::string_view id, const std::vector<std::string>& samples,
+    size_t max_size) {
+#ifdef HAVE_LIBZSTD
+  std::string concatenated;
+  std::vector<size_t> sizes;
+  sizes.reserve(samples.size());
+  for (const std::string& sample : samples) {
+    concatenated.append(sample);
+    sizes.push_back(sample.size());
+  }
+  std::string content(max_size, '\0');
+  const size_t size = ZDICT_trainFromBuffer(
+      content.data(), content.size(), concatenated.data(), sizes.data(),
+      static_cast<unsigned>(sizes.size()));
+  if (ZDICT_isError(size)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("cannot train zstd dictionary '", id,
+                     "': ", ZDICT_getErrorName(size)));
+  }
+  content.resize(size);
+  return Create(id, std::move(content));
+#else
+  (void)samples;
+  (void)max_size;
+  return Create(id, std::string());
+#endif
+}
+
+ZstdDictionary::~ZstdDictionary() {
+#ifdef HAVE_LIBZSTD
+  for (auto& cdict : cdicts_) {
+    ZSTD_freeCDict(cdict.load(std::memory_order_relaxed));
+  }
+  ZSTD_freeDDict(ddict_);
+#endif
+}
+
+#ifdef HAVE_LIBZSTD
+const ZSTD_CDict* ZstdDictionary::CompressionDictionary(
+    grpc_compression_level level) const {
+  std::atomic<ZSTD_CDict*>& slot = cdicts_[level];
+  ZSTD_CDict* cdict = slot.load(std::memory_order_acquire);
+  if (cdict != nullptr) return cdict;
+  // Calls racing to digest the dictionary keep the first one done.
+  ZSTD_CDict* created = ZSTD_createCDict(content_.data(), content_.size(),
+                                         ZstdCompressionLevel(level));
+  if (created == nullptr) return nullptr;
+  if (slot.compare_exchange_strong(cdict, created, std::memory_order_acq_rel,
+                                   std::memory_order_acquire)) {
+    return created;
+  }
+  ZSTD_freeCDict(created);
+  return cdict;
+}
+
+int ZstdCompressionLevel(grpc_compression_level level) {
+  switch (level) {
+    case GRPC_COMPRESS_LEVEL_LOW:
+      return 1;
+    case GRPC_COMPRESS_LEVEL_HIGH:
+      return 9;
+    default:
+      return ZSTD_CLEVEL_DEFAULT;
+  }
+}
+#endif
+
+void RegisterZstdDictionary(RefCountedPtr<ZstdDictionary> dictionary) {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  std::string id(dictionary->id());
+  registry.dictionaries[std::move(id)] = std::move(dictionary);
+  registry.ids = Slice::FromCopiedString(absl::StrJoin(
+      registry.dictionaries, ",",
+      [](std::string* out, const auto& entry) { out->append(entry.first); }));
+}
+
+RefCountedPtr<ZstdDictionary> FindZstdDictionary(absl::string_view id) {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  auto it = registry.dictionaries.find(id);
+  if (it == registry.dictionaries.end()) return nullptr;
+  return it->second;
+}
+
+Slice RegisteredZstdDictionaryIds() {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  return registry.ids.Ref();
+}
+
+void ResetZstdDictionariesForTesting() {
+  Registry& registry = GetRegistry();
+  MutexLock lock(&registry.mu);
+  registry.dictionaries.clear();
+  registry.ids = Slice();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,120 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_ZSTD_DICTIONARY_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_ZSTD_DICTIONARY_H
+
+#include <grpc/impl/compression_types.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#endif
+
+// Shared dictionaries for zstd message compression.
+//
+// Small messages that look alike compress poorly on their own, since each one
+// is compressed from scratch. Compressing them against a dictionary of the
+// content they usually share fixes that. Dictionaries are registered with the
+// process by id, on both the client and the server. Then:
+// - Channels and servers advertise the ids of the registered dictionaries in
+//   grpc-accept-zstd-dictionary, in the initial metadata of each call.
+// - A channel with GRPC_ARG_ZSTD_COMPRESSION_DICTIONARY set compresses the
+//   messages it sends with zstd against that dictionary, once the peer has
+//   advertised it, and names it in grpc-zstd-dictionary.
+// A client learns what the server accepts from the responses of earlier calls
+// on the same channel, so the dictionary is used from the second call on.
+
+namespace grpc_core {
+
+// A zstd dictionary, kept digested for compression and decompression.
+class ZstdDictionary final : public RefCounted<ZstdDictionary> {
+ public:
+  // Creates a dictionary from \a content, which is either a dictionary
+  // trained by zstd or raw content that messages are expected to share.
+  // Ids are tokens of letters, digits, '-', '_' and '.', of up to 64
+  // characters. Fails if gRPC was built without libzstd.
+  static absl::StatusOr<RefCountedPtr<ZstdDictionary>> Create(
+      absl::string_view id, std::string content);
+
+  // Trains a dictionary of up to \a max_size bytes from \a samples of the
+  // messages it will be used for.
+  static absl::StatusOr<RefCountedPtr<ZstdDictionary>> Train(
+      absl::string_view id, const std::vector<std::string>& samples,
+      size_t max_size);
+
+  ~ZstdDictionary() override;
+
+  ZstdDictionary(const ZstdDictionary&) = delete;
+  ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+  absl::string_view id() const { return id_; }
+  absl::string_view content() const { return content_; }
+
+#ifdef HAVE_LIBZSTD
+  // Returns the dictionary digested for compression at \a level. Digesting
+  // is done on first use at each level.
+  const ZSTD_CDict* CompressionDictionary(grpc_compression_level level) const;
+  const ZSTD_DDict* DecompressionDictionary() const { return ddict_; }
+#endif
+
+ private:
+  ZstdDictionary(absl::string_view id, std::string content);
+
+  const std::string id_;
+  const std::string content_;
+#ifdef HAVE_LIBZSTD
+  mutable std::atomic<ZSTD_CDict*> cdicts_[GRPC_COMPRESS_LEVEL_COUNT] = {};
+  ZSTD_DDict* ddict_ = nullptr;
+#endif
+};
+
+#ifdef HAVE_LIBZSTD
+// The zstd level that \a level maps to.
+int ZstdCompressionLevel(grpc_compression_level level);
+#endif
+
+// Registers \a dictionary with the process, replacing any registered with the
+// same id. Channels and servers only advertise the dictionaries registered
+// before they are created.
+void RegisterZstdDictionary(RefCountedPtr<ZstdDictionary> dictionary);
+
+// Returns the registered dictionary with \a id, or null.
+RefCountedPtr<ZstdDictionary> FindZstdDictionary(absl::string_view id);
+
+// Returns the comma separated ids of the registered dictionaries, or an empty
+// slice if there are none.
+Slice RegisteredZstdDictionaryIds();
+
+// Forgets all registered dictionaries. For tests.
+void ResetZstdDictionariesForTesting();
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_ZSTD_DICTIONARY_H
@@ -93,10 +93,13 @@ extern TraceFlag http2_ping_trace;
 extern TraceFlag http2_stream_state_trace;
 extern TraceFlag http_keepalive_trace;
 extern TraceFlag inproc_trace;
+extern TraceFlag least_request_lb_trace;
+extern TraceFlag locality_aware_lb_trace;
 extern TraceFlag metadata_query_trace;
 extern TraceFlag op_failure_trace;
 extern TraceFlag orca_client_trace;
 extern TraceFlag outlier_detection_lb_trace;
+extern TraceFlag peak_ewma_lb_trace;
 extern TraceFlag pick_first_trace;
 extern TraceFlag plugin_credentials_trace;
 extern TraceFlag priority_lb_trace;
@@ -0,0 +1,53 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_SUPPORTS_SHM_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_SUPPORTS_SHM_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+class ShmRing;
+
+class EventEngineSupportsShmExtension {
+ public:
+  virtual ~EventEngineSupportsShmExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.event_engine_supports_shm";
+  }
+
+  /// Creates an Endpoint that reads from \a read_ring and writes to
+  /// \a write_ring, which the peer process has attached the other ends of.
+  ///
+  /// \a socket is the connection that the rings were exchanged over. The
+  /// Endpoint keeps it open, takes the addresses from it, and fails once the
+  /// peer closes it. Nothing may be sent on it after this call.
+  virtual absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+  CreateShmEndpoint(std::unique_ptr<ShmRing> read_ring,
+                    std::unique_ptr<ShmRing> write_ring,
+                    std::unique_ptr<EventEngine::Endpoint> socket,
+                    MemoryAllocator memory_allocator) = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_SUPPORTS_SHM_H
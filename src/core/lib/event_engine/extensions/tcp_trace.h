@@ -17,6 +17,7 @@
 
 #include <memory>
 
+#include "absl/functional/any_invocable.h"
 #include "absl/strings/string_view.h"
 #include "src/core/telemetry/tcp_tracer.h"
 
@@ -35,6 +36,23 @@ class TcpTraceExtension {
   InitializeAndReturnTcpTracer() = 0;
 };
 
+/// Implemented by endpoints that sample the TCP_INFO of their socket, when
+/// GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS is set.
+class TcpInfoExtension {
+ public:
+  virtual ~TcpInfoExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.tcp_info";
+  }
+  /// Sets \a on_sample to be called with each TCP_INFO sample that the
+  /// endpoint takes from now on, replacing any callback set before. It is
+  /// called from the endpoint's write path, so it must not block.
+  virtual void SetTcpInfoSampleCallback(
+      absl::AnyInvocable<
+          void(const grpc_core::TcpTracerInterface::ConnectionMetrics&)>
+          on_sample) = 0;
+};
+
 }  // namespace grpc_event_engine::experimental
 
 #endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_TRACE_H
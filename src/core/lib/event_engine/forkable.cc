@@ -28,6 +28,7 @@
 
 #include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/util/fork.h"
 
 namespace grpc_event_engine::experimental {
 
@@ -99,6 +100,7 @@ void ObjectGroupForkHandler::PostforkChild() {
       }
     }
     is_forking_ = false;
+    grpc_core::Fork::NoteForkedChild();
   }
 }
 
@@ -23,6 +23,8 @@
 #include "src/core/lib/event_engine/extensions/can_track_errors.h"
 #include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/supports_shm.h"
+#include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 
 namespace grpc_event_engine::experimental {
@@ -38,7 +40,8 @@ class PosixEndpointWithChaoticGoodSupport
 /// may implement to support additional file descriptor related functionality.
 class PosixEndpointWithFdSupport
     : public ExtendedType<EventEngine::Endpoint, EndpointSupportsFdExtension,
-                          EndpointCanTrackErrorsExtension> {};
+                          EndpointCanTrackErrorsExtension, TcpInfoExtension> {
+};
 
 /// Defines an interface that posix EventEngine listeners may implement to
 /// support additional file descriptor related functionality.
@@ -47,9 +50,11 @@ class PosixListenerWithFdSupport
 };
 
 /// Defines an interface that posix EventEngines may implement to
-/// support additional file descriptor related functionality.
+/// support additional file descriptor related functionality, including
+/// endpoints over shared memory rings.
 class PosixEventEngineWithFdSupport
-    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension> {};
+    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension,
+                          EventEngineSupportsShmExtension> {};
 
 }  // namespace grpc_event_engine::experimental
 
@@ -19,7 +19,9 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "absl/log/check.h"
@@ -422,6 +424,28 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
   int r;
+  const std::chrono::microseconds busy_poll_budget(
+      busy_poll_budget_us_.load(std::memory_order_relaxed));
+  if (busy_poll_budget.count() > 0 && timeout > EventEngine::Duration::zero()) {
+    // Spin on the ready list instead of sleeping, so that neither the kernel
+    // wakeup nor the wakeup fd is on the latency path. Sockets with
+    // SO_BUSY_POLL set also get their device queue polled by each of these
+    // calls.
+    const auto spin_for = std::min<EventEngine::Duration>(busy_poll_budget,
+                                                          timeout);
+    const auto spin_until = std::chrono::steady_clock::now() + spin_for;
+    do {
+      r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
+                     0);
+    } while ((r == 0 || (r < 0 && errno == EINTR)) &&
+             std::chrono::steady_clock::now() < spin_until);
+    if (r > 0) {
+      g_epoll_set_.num_events = r;
+      g_epoll_set_.cursor = 0;
+      return r;
+    }
+    timeout -= spin_for;
+  }
   do {
     r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
                    static_cast<int>(
@@ -516,6 +540,14 @@ void Epoll1Poller::Kick() {
   CHECK(wakeup_fd_->Wakeup().ok());
 }
 
+void Epoll1Poller::RequestBusyPoll(std::chrono::microseconds budget) {
+  int64_t current = busy_poll_budget_us_.load(std::memory_order_relaxed);
+  while (current < budget.count() &&
+         !busy_poll_budget_us_.compare_exchange_weak(
+             current, budget.count(), std::memory_order_relaxed)) {
+  }
+}
+
 std::shared_ptr<Epoll1Poller> MakeEpoll1Poller(Scheduler* scheduler) {
   static bool kEpoll1PollerSupported = InitEpoll1PollerLinux();
   if (kEpoll1PollerSupported) {
@@ -572,6 +604,10 @@ Poller::WorkResult Epoll1Poller::Work(
 
 void Epoll1Poller::Kick() { grpc_core::Crash("unimplemented"); }
 
+void Epoll1Poller::RequestBusyPoll(std::chrono::microseconds /*budget*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 // If GRPC_LINUX_EPOLL is not defined, it means epoll is not available. Return
 // nullptr.
 std::shared_ptr<Epoll1Poller> MakeEpoll1Poller(Scheduler* /*scheduler*/) {
@@ -17,6 +17,8 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <string>
@@ -53,6 +55,7 @@ class Epoll1Poller : public PosixEventPoller {
       absl::FunctionRef<void()> schedule_poll_again) override;
   std::string Name() override { return "epoll1"; }
   void Kick() override;
+  void RequestBusyPoll(std::chrono::microseconds budget) override;
   Scheduler* GetScheduler() { return scheduler_; }
   void Shutdown() override;
   bool CanTrackErrors() const override {
@@ -120,6 +123,8 @@ class Epoll1Poller : public PosixEventPoller {
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // How long DoEpollWait() spins on the ready list before blocking.
+  std::atomic<int64_t> busy_poll_budget_us_{0};
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
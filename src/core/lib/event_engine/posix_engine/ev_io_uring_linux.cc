@@ -0,0 +1,1286 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/sync.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_format.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/time_util.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+// This polling engine is only relevant on linux kernels whose headers define
+// multishot poll and the extended io_uring_enter() argument. Whether the
+// running kernel supports them is checked at runtime.
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+#if defined(GRPC_LINUX_IO_URING) && defined(IORING_POLL_ADD_MULTI) && \
+    defined(IORING_FEAT_EXT_ARG)
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <utility>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/util/fork.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+#define MAX_IO_URING_COMPLETIONS_HANDLED_PER_ITERATION 1
+
+// Headers recent enough for multishot receive (Linux 6.0) also know about
+// multishot accept and provided buffer rings.
+#ifdef IORING_RECV_MULTISHOT
+#define GRPC_IO_URING_MULTISHOT_IO 1
+#endif
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Submission queue size. Polls are long lived, so the submission queue only
+// needs to hold what is armed or cancelled between two calls to Work().
+constexpr unsigned kSubmissionQueueEntries = 256;
+// Completion queue size. Every readiness notification of every handle lands
+// here, so make it generously larger than the submission queue.
+constexpr unsigned kCompletionQueueEntries = 4096;
+
+// Registered receive buffers. The kernel fills one per completion of a
+// multishot receive, and gets it back once the owner copied the data out.
+constexpr unsigned kRecvBufferCount = 256;  // Must be a power of 2.
+constexpr size_t kRecvBufferSize = 16 * 1024;
+constexpr uint16_t kRecvBufferGroup = 0;
+// Most iovecs handed to a single sendmsg.
+constexpr size_t kMaxSendIovecs = 64;
+
+// user_data tags. Handle tags are the handle address, with the least
+// significant bit holding track_err, the next two the kind of request, and
+// the upper 16 bits the handle's generation, so that completions of an
+// orphaned handle's requests can be told apart from completions of the
+// requests of the handle that reused it. Sends are tagged with the address of
+// their IoUringSendOp instead.
+constexpr uint64_t kWakeupTag = 0;
+constexpr uint64_t kIgnoreTag = 2;
+constexpr int kGenerationShift = 48;
+constexpr uint64_t kHandleMask = (uint64_t{1} << kGenerationShift) - 1;
+constexpr uint64_t kKindMask = 6;
+constexpr uint64_t kPollKind = 0;
+constexpr uint64_t kAcceptKind = 2;
+constexpr uint64_t kRecvKind = 4;
+constexpr uint64_t kSendKind = 6;
+
+constexpr uint32_t kPollEvents = POLLIN | POLLOUT | EPOLLET;
+
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, const void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+#ifdef GRPC_IO_URING_MULTISHOT_IO
+int IoUringRegister(int ring_fd, unsigned opcode, void* arg,
+                    unsigned nr_args) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+#endif  // GRPC_IO_URING_MULTISHOT_IO
+
+// The poller whose submissions the calling thread holds back until its
+// callback batch ends, see IoUringPoller::BeginCallbackBatch().
+thread_local IoUringPoller* g_batching_poller = nullptr;
+
+}  // namespace
+
+class IoUringEventHandle;
+
+// A sendmsg handed to the kernel. It owns the slices being sent, so that
+// they outlive a shutdown of the handle's owner, and is freed once the
+// kernel is done with it.
+struct IoUringSendOp {
+  IoUringEventHandle* handle;
+  SliceBuffer data;
+  size_t sent = 0;
+  struct iovec iov[kMaxSendIovecs];
+  struct msghdr msg;
+};
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, IoUringPoller* poller)
+      : fd_(fd),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  void ReInit(int fd) {
+    fd_ = fd;
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these are atomics.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  // Arm the poll of a new (or reused) handle.
+  void Arm(bool track_err) {
+    grpc_core::MutexLock lock(&mu_);
+    poll_tag_ = reinterpret_cast<uintptr_t>(this) | (track_err ? 1 : 0) |
+                (uint64_t{generation_.load(std::memory_order_relaxed)}
+                 << kGenerationShift);
+    poller_->ArmPoll(fd_, poll_tag_, /*submit=*/true);
+  }
+  // Called when the kernel terminated the multishot poll tagged with tag.
+  // If tag is still current, queue a new poll for the next Work().
+  void ReArm(uint64_t tag) {
+    grpc_core::MutexLock lock(&mu_);
+    if (tag != poll_tag_) return;
+    poller_->ArmPoll(fd_, poll_tag_, /*submit=*/false);
+  }
+  uint16_t generation() const {
+    return generation_.load(std::memory_order_acquire);
+  }
+
+  bool StartMultishotAccept() override;
+  int TakeAcceptedFd() override;
+  bool StartMultishotRecv() override;
+  int64_t RecvMsg(struct msghdr* msg) override;
+  bool CanSendAsync() override { return true; }
+  bool SendAsync(SliceBuffer& data) override;
+  bool TakeSendResult(int64_t* result) override;
+  // Completions of the kernel's accepts, receives and sends for this handle.
+  // They return true if the handle has pending actions.
+  bool OnAcceptComplete(uint64_t tag, int res, bool more);
+  bool OnRecvComplete(uint64_t tag, int res, uint32_t flags);
+  bool OnSendComplete(IoUringSendOp* op, int res);
+  // Readiness reported by the poll is left out while the kernel accepts or
+  // receives on the handle's behalf, or sends for it: their completions say
+  // when there is something to do.
+  bool IgnorePollReadable() const {
+    return accept_io_.load(std::memory_order_relaxed) == RingIo::kArmed ||
+           recv_io_.load(std::memory_order_relaxed) == RingIo::kArmed;
+  }
+  bool IgnorePollWritable() const {
+    return send_in_flight_.load(std::memory_order_relaxed);
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  // State of the kernel's accepts or receives for the handle.
+  enum class RingIo : uint8_t {
+    // Not in use, the owner makes the syscalls.
+    kOff,
+    // The kernel accepts or receives, and queues the results.
+    kArmed,
+    // The kernel stopped. Once the queue is drained the owner makes the
+    // syscalls, and the kernel takes over again when they run dry.
+    kStopped,
+  };
+
+  uint64_t Tag(uint64_t kind) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return reinterpret_cast<uintptr_t>(this) | kind |
+           (uint64_t{generation_.load(std::memory_order_relaxed)}
+            << kGenerationShift);
+  }
+  void SubmitSend(IoUringSendOp* op, bool submit)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Cancel the kernel's requests for the handle and drop what they queued.
+  void CancelRingIo() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void HandleShutdownInternal(absl::Status why);
+  // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+  // required. It also orders ReArm() against the poll's removal.
+  grpc_core::Mutex mu_;
+  int fd_;
+  // Tag of the armed poll, or 0 once the handle is orphaned.
+  uint64_t poll_tag_ ABSL_GUARDED_BY(mu_) = 0;
+  std::atomic<uint16_t> generation_{0};
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  // Multishot accept.
+  std::atomic<RingIo> accept_io_{RingIo::kOff};
+  uint64_t accept_tag_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<int> accepted_fds_ ABSL_GUARDED_BY(mu_);
+  // Multishot receive.
+  struct RecvChunk {
+    uint16_t buffer_id;
+    uint32_t offset;
+    uint32_t length;
+  };
+  std::atomic<RingIo> recv_io_{RingIo::kOff};
+  uint64_t recv_tag_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<RecvChunk> recv_chunks_ ABSL_GUARDED_BY(mu_);
+  bool recv_eof_ ABSL_GUARDED_BY(mu_) = false;
+  int recv_errno_ ABSL_GUARDED_BY(mu_) = 0;
+  // Send in flight, if any, and the result of the last one.
+  IoUringSendOp* send_op_ ABSL_GUARDED_BY(mu_) = nullptr;
+  std::atomic<bool> send_in_flight_{false};
+  bool send_done_ ABSL_GUARDED_BY(mu_) = false;
+  int64_t send_result_ ABSL_GUARDED_BY(mu_) = 0;
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+namespace {
+
+// Only used when GRPC_ENABLE_FORK_SUPPORT=1
+std::list<IoUringPoller*> fork_poller_list;
+
+gpr_mu fork_fd_list_mu;
+
+void ForkPollerListAddPoller(IoUringPoller* poller) {
+  if (grpc_core::Fork::Enabled()) {
+    gpr_mu_lock(&fork_fd_list_mu);
+    fork_poller_list.push_back(poller);
+    gpr_mu_unlock(&fork_fd_list_mu);
+  }
+}
+
+void ForkPollerListRemovePoller(IoUringPoller* poller) {
+  if (grpc_core::Fork::Enabled()) {
+    gpr_mu_lock(&fork_fd_list_mu);
+    fork_poller_list.remove(poller);
+    gpr_mu_unlock(&fork_fd_list_mu);
+  }
+}
+
+bool InitIoUringPollerLinux();
+
+// Called by the child process's post-fork handler to close open fds,
+// including the ring fd of each poller. This allows gRPC to shutdown in the
+// child process without interfering with connections or RPCs ongoing in the
+// parent.
+void ResetEventManagerOnFork() {
+  gpr_mu_lock(&fork_fd_list_mu);
+  while (!fork_poller_list.empty()) {
+    IoUringPoller* poller = fork_poller_list.front();
+    fork_poller_list.pop_front();
+    poller->Close();
+  }
+  gpr_mu_unlock(&fork_fd_list_mu);
+  InitIoUringPollerLinux();
+}
+
+// The headers may know about io_uring while the kernel doesn't, or has it
+// disabled (kernel.io_uring_disabled, seccomp). Set up a ring to make sure it
+// is usable and has the features this poller relies on.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  io_uring_params params{};
+  int fd = IoUringSetup(1, &params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup unavailable: " << grpc_core::StrError(errno);
+    return false;
+  }
+  close(fd);
+  if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0 ||
+      (params.features & IORING_FEAT_EXT_ARG) == 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring lacks required features: " << params.features;
+    return false;
+  }
+  if (grpc_core::Fork::Enabled()) {
+    if (grpc_core::Fork::RegisterResetChildPollingEngineFunc(
+            ResetEventManagerOnFork)) {
+      gpr_mu_init(&fork_fd_list_mu);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  bool is_release_fd = (release_fd != nullptr);
+  bool release_failed = false;
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+
+  {
+    // Unlike epoll, closing the fd does not drop its registration: the poll,
+    // and whatever the kernel accepts, receives or sends for the handle, hold
+    // a reference to the file. Always cancel them, and move on to a new
+    // generation so completions still in flight for them are ignored.
+    grpc_core::MutexLock lock(&mu_);
+    // Bytes the multishot receive already took off the socket can't be put
+    // back. They go away with the socket when the fd is closed, but handing
+    // the fd over would give its new owner a stream with a hole in it, so
+    // close it instead and report that nothing was released.
+    release_failed = is_release_fd && !recv_chunks_.empty();
+    CancelRingIo();
+    poller_->CancelPoll(poll_tag_);
+    poll_tag_ = 0;
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (is_release_fd && !release_failed) {
+    *release_fd = fd_;
+  } else {
+    if (is_release_fd) *release_fd = -1;
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+
+  {
+    // See IoUringEventHandle::ShutdownHandle for explanation on why a mutex
+    // is required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  {
+    grpc_core::MutexLock lock(&poller_->mu_);
+    poller_->free_io_uring_handles_list_.push_back(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+void IoUringEventHandle::CancelRingIo() {
+  if (accept_io_.load(std::memory_order_relaxed) == RingIo::kArmed) {
+    poller_->CancelRequest(accept_tag_);
+  }
+  for (int fd : accepted_fds_) close(fd);
+  accepted_fds_.clear();
+  accept_tag_ = 0;
+  accept_io_.store(RingIo::kOff, std::memory_order_relaxed);
+  if (recv_io_.load(std::memory_order_relaxed) == RingIo::kArmed) {
+    poller_->CancelRequest(recv_tag_);
+  }
+  for (const RecvChunk& chunk : recv_chunks_) {
+    poller_->ReturnRecvBuffers(&chunk.buffer_id, 1);
+  }
+  recv_chunks_.clear();
+  recv_tag_ = 0;
+  recv_eof_ = false;
+  recv_errno_ = 0;
+  recv_io_.store(RingIo::kOff, std::memory_order_relaxed);
+  // The kernel may still be reading the op's iovecs, so the poller keeps it
+  // until its completion arrives, or until the ring is closed.
+  if (send_op_ != nullptr) {
+    poller_->AdoptOrphanedSend(send_op_);
+    poller_->CancelRequest(reinterpret_cast<uintptr_t>(send_op_) | kSendKind);
+    send_op_ = nullptr;
+  }
+  send_in_flight_.store(false, std::memory_order_relaxed);
+  send_done_ = false;
+}
+
+bool IoUringEventHandle::StartMultishotAccept() {
+#ifdef GRPC_IO_URING_MULTISHOT_IO
+  grpc_core::MutexLock lock(&mu_);
+  if (poll_tag_ == 0) return false;
+  accept_tag_ = Tag(kAcceptKind);
+  accept_io_.store(RingIo::kArmed, std::memory_order_relaxed);
+  poller_->ArmAccept(fd_, accept_tag_);
+  return true;
+#else
+  return false;
+#endif
+}
+
+int IoUringEventHandle::TakeAcceptedFd() {
+  grpc_core::MutexLock lock(&mu_);
+  if (!accepted_fds_.empty()) {
+    int fd = accepted_fds_.front();
+    accepted_fds_.pop_front();
+    return fd;
+  }
+  const RingIo io = accept_io_.load(std::memory_order_relaxed);
+  if (io == RingIo::kArmed) {
+    errno = EAGAIN;
+    return -1;
+  }
+  int fd = accept4(fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+  if (fd < 0 && errno == EAGAIN && io == RingIo::kStopped && poll_tag_ != 0) {
+    accept_io_.store(RingIo::kArmed, std::memory_order_relaxed);
+    poller_->ArmAccept(fd_, accept_tag_);
+    errno = EAGAIN;
+  }
+  return fd;
+}
+
+bool IoUringEventHandle::OnAcceptComplete(uint64_t tag, int res, bool more) {
+  grpc_core::MutexLock lock(&mu_);
+  if (tag != accept_tag_ ||
+      accept_io_.load(std::memory_order_relaxed) != RingIo::kArmed) {
+    if (res >= 0) close(res);
+    return false;
+  }
+  if (res >= 0) accepted_fds_.push_back(res);
+  if (!more) {
+    // Kernels without multishot accept reject it; the owner accepts by itself
+    // from then on. Errors (e.g. EMFILE) end it too, and the owner's next
+    // accept4() reports them.
+    accept_io_.store(res == -EINVAL ? RingIo::kOff : RingIo::kStopped,
+                     std::memory_order_relaxed);
+  }
+  return SetPendingActions(true, false, false);
+}
+
+bool IoUringEventHandle::StartMultishotRecv() {
+#ifdef GRPC_IO_URING_MULTISHOT_IO
+  grpc_core::MutexLock lock(&mu_);
+  if (poll_tag_ == 0 || !poller_->CanRecv()) return false;
+  recv_tag_ = Tag(kRecvKind);
+  recv_io_.store(RingIo::kArmed, std::memory_order_relaxed);
+  poller_->ArmRecv(fd_, recv_tag_);
+  return true;
+#else
+  return false;
+#endif
+}
+
+int64_t IoUringEventHandle::RecvMsg(struct msghdr* msg) {
+  absl::InlinedVector<uint16_t, 8> drained;
+  int64_t copied = 0;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (recv_chunks_.empty()) {
+      if (recv_errno_ != 0) {
+        errno = std::exchange(recv_errno_, 0);
+        return -1;
+      }
+      if (recv_eof_) return 0;
+      const RingIo io = recv_io_.load(std::memory_order_relaxed);
+      if (io == RingIo::kArmed) {
+        errno = EAGAIN;
+        return -1;
+      }
+      ssize_t read_bytes = recvmsg(fd_, msg, 0);
+      if (read_bytes < 0 && errno == EAGAIN && io == RingIo::kStopped &&
+          poll_tag_ != 0) {
+        recv_io_.store(RingIo::kArmed, std::memory_order_relaxed);
+        poller_->ArmRecv(fd_, recv_tag_);
+        errno = EAGAIN;
+      }
+      return read_bytes;
+    }
+    size_t iov_idx = 0;
+    size_t iov_offset = 0;
+    while (!recv_chunks_.empty() &&
+           iov_idx < static_cast<size_t>(msg->msg_iovlen)) {
+      RecvChunk& chunk = recv_chunks_.front();
+      const struct iovec& iov = msg->msg_iov[iov_idx];
+      const size_t n = std::min<size_t>(chunk.length, iov.iov_len - iov_offset);
+      memcpy(static_cast<char*>(iov.iov_base) + iov_offset,
+             poller_->RecvBuffer(chunk.buffer_id) + chunk.offset, n);
+      copied += n;
+      chunk.offset += n;
+      chunk.length -= n;
+      iov_offset += n;
+      if (iov_offset == iov.iov_len) {
+        ++iov_idx;
+        iov_offset = 0;
+      }
+      if (chunk.length == 0) {
+        drained.push_back(chunk.buffer_id);
+        recv_chunks_.pop_front();
+      }
+    }
+  }
+  if (!drained.empty()) {
+    poller_->ReturnRecvBuffers(drained.data(), drained.size());
+  }
+  msg->msg_controllen = 0;
+  msg->msg_flags = 0;
+  return copied;
+}
+
+bool IoUringEventHandle::OnRecvComplete(uint64_t tag, int res,
+                                        uint32_t flags) {
+  const bool has_buffer = (flags & IORING_CQE_F_BUFFER) != 0;
+  const uint16_t buffer_id = flags >> IORING_CQE_BUFFER_SHIFT;
+  grpc_core::MutexLock lock(&mu_);
+  if (tag != recv_tag_ ||
+      recv_io_.load(std::memory_order_relaxed) != RingIo::kArmed) {
+    if (has_buffer) poller_->ReturnRecvBuffers(&buffer_id, 1);
+    return false;
+  }
+  if (res > 0 && has_buffer) {
+    recv_chunks_.push_back({buffer_id, 0, static_cast<uint32_t>(res)});
+  } else {
+    if (has_buffer) poller_->ReturnRecvBuffers(&buffer_id, 1);
+    if (res == 0) {
+      recv_eof_ = true;
+    } else if (res == -EINVAL) {
+      // The kernel has no multishot receive. Nothing was received, so the
+      // owner reads the socket itself from now on.
+      poller_->SetRecvUnsupported();
+      recv_io_.store(RingIo::kOff, std::memory_order_relaxed);
+      return SetPendingActions(true, false, false);
+    } else if (res != -ENOBUFS) {
+      // Anything but running out of buffers is reported once the queue is
+      // drained. Out of buffers, the owner reads the socket until it runs
+      // dry.
+      recv_errno_ = -res;
+    }
+  }
+  if ((flags & IORING_CQE_F_MORE) == 0) {
+    recv_io_.store(RingIo::kStopped, std::memory_order_relaxed);
+  }
+  return SetPendingActions(true, false, false);
+}
+
+bool IoUringEventHandle::SendAsync(SliceBuffer& data) {
+  grpc_core::MutexLock lock(&mu_);
+  if (send_op_ != nullptr || poll_tag_ == 0) return false;
+  send_op_ = new IoUringSendOp();
+  send_op_->handle = this;
+  send_op_->data.Swap(data);
+  send_done_ = false;
+  send_in_flight_.store(true, std::memory_order_relaxed);
+  SubmitSend(send_op_, /*submit=*/true);
+  return true;
+}
+
+void IoUringEventHandle::SubmitSend(IoUringSendOp* op, bool submit) {
+  const size_t iov_len = std::min(kMaxSendIovecs, op->data.Count());
+  for (size_t i = 0; i < iov_len; ++i) {
+    const Slice& slice = op->data[i];
+    op->iov[i].iov_base = const_cast<uint8_t*>(slice.begin());
+    op->iov[i].iov_len = slice.length();
+  }
+  memset(&op->msg, 0, sizeof(op->msg));
+  op->msg.msg_iov = op->iov;
+  op->msg.msg_iovlen = iov_len;
+  poller_->QueueSendMsg(fd_, &op->msg,
+                        reinterpret_cast<uintptr_t>(op) | kSendKind, submit);
+}
+
+bool IoUringEventHandle::OnSendComplete(IoUringSendOp* op, int res) {
+  grpc_core::MutexLock lock(&mu_);
+  if (op != send_op_) {
+    // The handle was orphaned while the send was in flight.
+    poller_->FreeOrphanedSend(op);
+    return false;
+  }
+  if (res > 0) {
+    op->sent += res;
+    SliceBuffer sent;
+    op->data.MoveFirstNBytesIntoSliceBuffer(res, sent);
+    if (op->data.Length() > 0) {
+      // Short write, or more slices than fit a single sendmsg. The rest goes
+      // out with the poller's next submission.
+      SubmitSend(op, /*submit=*/false);
+      return false;
+    }
+  }
+  send_result_ = res < 0 ? res : static_cast<int64_t>(op->sent);
+  send_done_ = true;
+  send_op_ = nullptr;
+  send_in_flight_.store(false, std::memory_order_relaxed);
+  delete op;
+  return SetPendingActions(false, true, false);
+}
+
+bool IoUringEventHandle::TakeSendResult(int64_t* result) {
+  grpc_core::MutexLock lock(&mu_);
+  if (!send_done_) return false;
+  send_done_ = false;
+  *result = send_result_;
+  return true;
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  io_uring_params params{};
+  params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  params.cq_entries = kCompletionQueueEntries;
+  int fd = IoUringSetup(kSubmissionQueueEntries, &params);
+  if (fd < 0) {
+    LOG(ERROR) << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return;
+  }
+  // With IORING_FEAT_SINGLE_MMAP both rings share one mapping.
+  ring_mem_size_ =
+      std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+               params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+  ring_mem_ = mmap(nullptr, ring_mem_size_, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  sqes_mem_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = mmap(nullptr, sqes_mem_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (ring_mem_ == MAP_FAILED || sqes == MAP_FAILED) {
+    LOG(ERROR) << "io_uring mmap failed: " << grpc_core::StrError(errno);
+    if (ring_mem_ != MAP_FAILED) munmap(ring_mem_, ring_mem_size_);
+    if (sqes != MAP_FAILED) munmap(sqes, sqes_mem_size_);
+    ring_mem_ = nullptr;
+    close(fd);
+    return;
+  }
+  char* ring = static_cast<char*>(ring_mem_);
+  sq_head_ = reinterpret_cast<unsigned*>(ring + params.sq_off.head);
+  sq_tail_ = reinterpret_cast<unsigned*>(ring + params.sq_off.tail);
+  sq_mask_ = *reinterpret_cast<unsigned*>(ring + params.sq_off.ring_mask);
+  sq_entries_ = params.sq_entries;
+  sq_array_ = reinterpret_cast<unsigned*>(ring + params.sq_off.array);
+  sqes_ = static_cast<io_uring_sqe*>(sqes);
+  cq_head_ = reinterpret_cast<unsigned*>(ring + params.cq_off.head);
+  cq_tail_ = reinterpret_cast<unsigned*>(ring + params.cq_off.tail);
+  cq_mask_ = *reinterpret_cast<unsigned*>(ring + params.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+  // Submission queue entries are used in ring order, so the indirection array
+  // can be set up once.
+  for (unsigned i = 0; i < sq_entries_; ++i) sq_array_[i] = i;
+  ring_fd_ = fd;
+  GRPC_TRACE_LOG(event_engine_poller, INFO) << "grpc io_uring fd: " << fd;
+
+  wakeup_fd_ = *CreateWakeupFd();
+  CHECK(wakeup_fd_ != nullptr);
+  ArmPoll(wakeup_fd_->ReadFd(), kWakeupTag, /*submit=*/true);
+  // Kernels without multishot poll reject the request right away; they post
+  // the failure before io_uring_enter() returns.
+  if (CompletionsReady() > 0) {
+    const io_uring_cqe& cqe = cqes_[*cq_head_ & cq_mask_];
+    if (cqe.user_data == kWakeupTag && cqe.res < 0) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "io_uring multishot poll unsupported: "
+          << grpc_core::StrError(-cqe.res);
+      Close();
+      return;
+    }
+  }
+  if (!SetupRecvBuffers()) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring provided buffer rings unavailable, receiving with "
+           "recvmsg";
+  }
+  ForkPollerListAddPoller(this);
+}
+
+void IoUringPoller::Shutdown() { ForkPollerListRemovePoller(this); }
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+
+  if (ring_fd_ >= 0) {
+    munmap(sqes_, sqes_mem_size_);
+    munmap(ring_mem_, ring_mem_size_);
+    close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  if (buf_ring_ != nullptr) {
+    munmap(buf_ring_, buf_ring_size_);
+    munmap(recv_buffers_, kRecvBufferCount * kRecvBufferSize);
+    buf_ring_ = nullptr;
+    recv_buffers_ = nullptr;
+  }
+  {
+    // Closing the ring cancelled whatever the kernel still had, so the sends
+    // of orphaned handles won't see a completion anymore.
+    grpc_core::MutexLock sends_lock(&orphaned_sends_mu_);
+    for (IoUringSendOp* op : orphaned_sends_) delete op;
+    orphaned_sends_.clear();
+  }
+
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+io_uring_sqe* IoUringPoller::NextSqe() {
+  unsigned tail = *sq_tail_;
+  if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_entries_) {
+    SubmitLocked();
+    if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_entries_) {
+      grpc_core::Crash(absl::StrFormat(
+          "(event_engine) IoUringPoller:%p submission queue is stuck full",
+          this));
+    }
+  }
+  io_uring_sqe* sqe = &sqes_[tail & sq_mask_];
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+void IoUringPoller::SubmitLocked() {
+  // The kernel submits no more than what is queued, so it is fine for a
+  // concurrent SubmitAndWait() to race with this and take some of it.
+  unsigned to_submit;
+  while ((to_submit = *sq_tail_ -
+                      __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE)) > 0) {
+    int r = IoUringEnter(ring_fd_, to_submit, 0, 0, nullptr, 0);
+    if (r < 0 && errno == EINTR) continue;
+    if (r < 0 && (errno == EAGAIN || errno == EBUSY)) {
+      // The completion ring is backed up. Leave the rest for the next
+      // SubmitAndWait(), which runs after the backlog is drained.
+      return;
+    }
+    if (r < 0) {
+      grpc_core::Crash(absl::StrFormat(
+          "(event_engine) IoUringPoller:%p encountered io_uring_enter error: "
+          "%s",
+          this, grpc_core::StrError(errno).c_str()));
+    }
+    if (r == 0) return;
+  }
+}
+
+void IoUringPoller::ArmPoll(int fd, uint64_t user_data, bool submit) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->poll32_events = user_data == kWakeupTag ? POLLIN | EPOLLET : kPollEvents;
+  sqe->user_data = user_data;
+  __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+  if (submit) SubmitLocked();
+}
+
+void IoUringPoller::CancelPoll(uint64_t user_data) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = kIgnoreTag;
+  __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+  SubmitLocked();
+}
+
+void IoUringPoller::ArmAccept(int fd, uint64_t user_data) {
+#ifdef GRPC_IO_URING_MULTISHOT_IO
+  grpc_core::MutexLock lock(&sq_mu_);
+  io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_ACCEPT;
+  sqe->fd = fd;
+  sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+  sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+  sqe->user_data = user_data;
+  __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+  MaybeSubmitLocked();
+#endif  // GRPC_IO_URING_MULTISHOT_IO
+}
+
+void IoUringPoller::ArmRecv(int fd, uint64_t user_data) {
+#ifdef GRPC_IO_URING_MULTISHOT_IO
+  grpc_core::MutexLock lock(&sq_mu_);
+  io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_RECV;
+  sqe->fd = fd;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = kRecvBufferGroup;
+  sqe->user_data = user_data;
+  __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+  MaybeSubmitLocked();
+#endif  // GRPC_IO_URING_MULTISHOT_IO
+}
+
+void IoUringPoller::QueueSendMsg(int fd, const struct msghdr* msg,
+                                 uint64_t user_data, bool submit) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_SENDMSG;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uintptr_t>(msg);
+  sqe->len = 1;
+  sqe->msg_flags = MSG_NOSIGNAL;
+  sqe->user_data = user_data;
+  __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+  if (submit) MaybeSubmitLocked();
+}
+
+void IoUringPoller::CancelRequest(uint64_t user_data) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = kIgnoreTag;
+  __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+}
+
+void IoUringPoller::MaybeSubmitLocked() {
+  if (g_batching_poller != this) SubmitLocked();
+}
+
+void IoUringPoller::BeginCallbackBatch() { g_batching_poller = this; }
+
+void IoUringPoller::EndCallbackBatch() {
+  g_batching_poller = nullptr;
+  grpc_core::MutexLock lock(&sq_mu_);
+  SubmitLocked();
+}
+
+bool IoUringPoller::SetupRecvBuffers() {
+#ifdef GRPC_IO_URING_MULTISHOT_IO
+  buf_ring_size_ = kRecvBufferCount * sizeof(io_uring_buf);
+  void* ring = mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+  void* buffers =
+      mmap(nullptr, kRecvBufferCount * kRecvBufferSize, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ring == MAP_FAILED || buffers == MAP_FAILED) {
+    if (ring != MAP_FAILED) munmap(ring, buf_ring_size_);
+    if (buffers != MAP_FAILED) {
+      munmap(buffers, kRecvBufferCount * kRecvBufferSize);
+    }
+    return false;
+  }
+  io_uring_buf_reg reg{};
+  reg.ring_addr = reinterpret_cast<uintptr_t>(ring);
+  reg.ring_entries = kRecvBufferCount;
+  reg.bgid = kRecvBufferGroup;
+  if (IoUringRegister(ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+    munmap(ring, buf_ring_size_);
+    munmap(buffers, kRecvBufferCount * kRecvBufferSize);
+    return false;
+  }
+  buf_ring_ = ring;
+  recv_buffers_ = static_cast<char*>(buffers);
+  for (unsigned i = 0; i < kRecvBufferCount; ++i) {
+    const uint16_t buffer_id = i;
+    ReturnRecvBuffers(&buffer_id, 1);
+  }
+  return true;
+#else
+  return false;
+#endif  // GRPC_IO_URING_MULTISHOT_IO
+}
+
+char* IoUringPoller::RecvBuffer(uint16_t buffer_id) const {
+  return recv_buffers_ + size_t{buffer_id} * kRecvBufferSize;
+}
+
+void IoUringPoller::AdoptOrphanedSend(IoUringSendOp* op) {
+  grpc_core::MutexLock lock(&orphaned_sends_mu_);
+  orphaned_sends_.insert(op);
+}
+
+void IoUringPoller::FreeOrphanedSend(IoUringSendOp* op) {
+  {
+    grpc_core::MutexLock lock(&orphaned_sends_mu_);
+    orphaned_sends_.erase(op);
+  }
+  delete op;
+}
+
+void IoUringPoller::ReturnRecvBuffers(const uint16_t* buffer_ids,
+                                      size_t count) {
+#ifdef GRPC_IO_URING_MULTISHOT_IO
+  grpc_core::MutexLock lock(&buf_mu_);
+  // Index the entries directly: in C++, io_uring_buf_ring's flexible array
+  // does not start at offset 0 as it does in C.
+  io_uring_buf* bufs = static_cast<io_uring_buf*>(buf_ring_);
+  for (size_t i = 0; i < count; ++i) {
+    io_uring_buf& buf = bufs[buf_ring_tail_ & (kRecvBufferCount - 1)];
+    buf.addr = reinterpret_cast<uintptr_t>(RecvBuffer(buffer_ids[i]));
+    buf.len = kRecvBufferSize;
+    buf.bid = buffer_ids[i];
+    ++buf_ring_tail_;
+  }
+  // The tail overlays the reserved field of the first entry.
+  __atomic_store_n(&bufs[0].resv, buf_ring_tail_, __ATOMIC_RELEASE);
+#else
+  (void)buffer_ids;
+  (void)count;
+#endif  // GRPC_IO_URING_MULTISHOT_IO
+}
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, this);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd);
+    }
+  }
+  new_handle->Arm(track_err);
+  return new_handle;
+}
+
+unsigned IoUringPoller::CompletionsReady() const {
+  return __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE) - *cq_head_;
+}
+
+// Process the completions posted to the completion ring, up to
+// max_completions_to_handle of them. It returns true, if there was a Kick
+// that forced invocation of this function. It also returns the list of
+// handles to take action on.
+bool IoUringPoller::ProcessCompletions(int max_completions_to_handle,
+                                       Events& pending_events) {
+  unsigned head = *cq_head_;
+  const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  bool was_kicked = false;
+  for (int idx = 0; (idx < max_completions_to_handle) && head != tail; idx++) {
+    const io_uring_cqe& cqe = cqes_[head++ & cq_mask_];
+    const uint64_t tag = cqe.user_data;
+    const bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+    if (tag == kIgnoreTag) continue;
+    if (tag == kWakeupTag) {
+      if (cqe.res >= 0) {
+        CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (!more) ArmPoll(wakeup_fd_->ReadFd(), kWakeupTag, /*submit=*/false);
+      continue;
+    }
+    const uint64_t kind = tag & kKindMask;
+    if (kind == kSendKind) {
+      IoUringSendOp* op = reinterpret_cast<IoUringSendOp*>(tag & ~kKindMask);
+      IoUringEventHandle* handle = op->handle;
+      if (handle->OnSendComplete(op, cqe.res)) {
+        pending_events.push_back(handle);
+      }
+      continue;
+    }
+    // Handles are never freed while the poller is alive, so looking at a
+    // handle sitting in the free list is fine.
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        tag & kHandleMask & ~(kKindMask | 1));
+    if (kind == kAcceptKind) {
+      if (handle->OnAcceptComplete(tag, cqe.res, more)) {
+        pending_events.push_back(handle);
+      }
+      continue;
+    }
+    if (kind == kRecvKind) {
+      if (handle->OnRecvComplete(tag, cqe.res, cqe.flags)) {
+        pending_events.push_back(handle);
+      }
+      continue;
+    }
+    DCHECK_EQ(kind, kPollKind);
+    if (static_cast<uint16_t>(tag >> kGenerationShift) !=
+        handle->generation()) {
+      continue;
+    }
+    bool track_err = (tag & 1) != 0;
+    // A failed poll is reported as every event on the fd so that its owner
+    // finds out on the next syscall.
+    uint32_t events = cqe.res >= 0 ? static_cast<uint32_t>(cqe.res) : POLLHUP;
+    bool cancel = (events & POLLHUP) != 0;
+    bool error = (events & POLLERR) != 0;
+    bool read_ev =
+        (events & (POLLIN | POLLPRI)) != 0 && !handle->IgnorePollReadable();
+    bool write_ev = (events & POLLOUT) != 0 && !handle->IgnorePollWritable();
+    bool err_fallback = error && !track_err;
+    if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                  write_ev || cancel || err_fallback,
+                                  error && !err_fallback)) {
+      pending_events.push_back(handle);
+    }
+    // The kernel ends a multishot poll when it couldn't post a completion,
+    // e.g. because the completion ring overflowed.
+    if (!more && cqe.res >= 0) handle->ReArm(tag);
+  }
+  __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+  return was_kicked;
+}
+
+// Submit the polls queued since the last call and wait for completions, in a
+// single io_uring_enter(). This does not "process" any of the completions;
+// that is done in ProcessCompletions().
+unsigned IoUringPoller::SubmitAndWait(EventEngine::Duration timeout) {
+  unsigned to_submit;
+  {
+    grpc_core::MutexLock lock(&sq_mu_);
+    to_submit = *sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+  }
+  if (timeout < EventEngine::Duration::zero()) {
+    timeout = EventEngine::Duration::zero();
+  }
+  auto secs = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  __kernel_timespec ts{};
+  ts.tv_sec = secs.count();
+  ts.tv_nsec =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - secs)
+          .count();
+  io_uring_getevents_arg arg{};
+  arg.sigmask_sz = _NSIG / 8;
+  arg.ts = reinterpret_cast<uintptr_t>(&ts);
+  int r;
+  do {
+    r = IoUringEnter(ring_fd_, to_submit, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+    if (r > 0) to_submit -= std::min<unsigned>(r, to_submit);
+  } while (r < 0 && errno == EINTR);
+  // Whatever the kernel didn't take (the completion ring may be backed up)
+  // stays queued for the next call.
+  if (r < 0 && errno != ETIME && errno != EBUSY) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  return CompletionsReady();
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  // See Epoll1EventHandle::ShutdownHandle for why a mutex is required here.
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  // Unlike epoll, the ring may hold completions that carry no event for
+  // anyone (poll removals, polls of orphaned handles). Keep going until
+  // there is something to do, since returning kKicked ends the poll loop.
+  // Each wait only gets what is left of the timeout.
+  while (pending_events.empty() && !was_kicked_ext) {
+    if (CompletionsReady() == 0) {
+      if (SubmitAndWait(deadline - std::chrono::steady_clock::now()) == 0) {
+        return Poller::WorkResult::kDeadlineExceeded;
+      }
+    }
+    grpc_core::MutexLock lock(&mu_);
+    // If was_kicked_ is true, collect all pending events in this iteration.
+    if (ProcessCompletions(
+            was_kicked_ ? INT_MAX
+                        : MAX_IO_URING_COMPLETIONS_HANDLED_PER_ITERATION,
+            pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+  }
+  if (pending_events.empty()) {
+    return Poller::WorkResult::kKicked;
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    auto poller = std::make_shared<IoUringPoller>(scheduler);
+    if (poller->ok()) return poller;
+  }
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() { Kick(); }
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // io_uring multishot poll is not available
+
+#if defined(GRPC_POSIX_SOCKET_EV_EPOLL1)
+
+namespace grpc_event_engine::experimental {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Shutdown() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::Close() { grpc_core::Crash("unimplemented"); }
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(int /*fd*/, absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::BeginCallbackBatch() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::EndCallbackBatch() { grpc_core::Crash("unimplemented"); }
+
+// If io_uring multishot poll is not available, return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() {}
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // defined(GRPC_POSIX_SOCKET_EV_EPOLL1)
+#endif  // io_uring multishot poll is not available
@@ -0,0 +1,198 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/sync.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct msghdr;
+
+namespace grpc_event_engine::experimental {
+
+class IoUringEventHandle;
+struct IoUringSendOp;
+
+// Poller that waits for fd readiness with io_uring rather than epoll.
+//
+// Each handle arms one multishot IORING_OP_POLL_ADD, which behaves like an
+// edge triggered epoll registration. Poll requests that need re-arming are
+// queued on the submission ring and submitted together with the next wait,
+// so that a busy poller makes a single io_uring_enter() per iteration.
+// This needs Linux 5.13 or later (multishot poll); MakeIoUringPoller() returns
+// nullptr when the kernel doesn't support it.
+//
+// Handles can also have the kernel do their I/O (see EventHandle):
+// listeners get a multishot IORING_OP_ACCEPT, connections a multishot
+// IORING_OP_RECV into a ring of buffers registered with the kernel
+// (IORING_REGISTER_PBUF_RING), and sends go out as IORING_OP_SENDMSG, held
+// back while fd callbacks run so that one io_uring_enter() submits the writes
+// of all of them. Each of these falls back to the plain syscall on kernels
+// that reject it.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  // Forkable
+  void PrepareFork() override;
+  void PostforkParent() override;
+  void PostforkChild() override;
+
+  void Close();
+
+  // Did the ring get set up, and does the kernel support everything we need?
+  bool ok() const { return ring_fd_ >= 0; }
+
+  void BeginCallbackBatch() override;
+  void EndCallbackBatch() override;
+
+ private:
+  friend class IoUringEventHandle;
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+
+  // Queue a multishot poll of fd, tagged with user_data. If submit is true,
+  // submit it right away, otherwise it goes out with the next wait.
+  void ArmPoll(int fd, uint64_t user_data, bool submit);
+  // Submit the removal of the poll tagged with user_data.
+  void CancelPoll(uint64_t user_data);
+  // Queue a multishot accept on the listening socket fd.
+  void ArmAccept(int fd, uint64_t user_data);
+  // Queue a multishot receive on fd into the registered buffers.
+  void ArmRecv(int fd, uint64_t user_data);
+  // Queue a sendmsg of msg on fd. If submit is true, submit it (subject to
+  // callback batching), otherwise it goes out with the next submission.
+  void QueueSendMsg(int fd, const struct msghdr* msg, uint64_t user_data,
+                    bool submit);
+  // Queue the cancellation of the request tagged with user_data. It goes out
+  // with the next submission.
+  void CancelRequest(uint64_t user_data);
+  // Submit what's queued, unless this thread is running a callback batch,
+  // which submits it when it ends.
+  void MaybeSubmitLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Set up the registered receive buffers. Returns false if the kernel can't
+  // provide buffers from a ring.
+  bool SetupRecvBuffers();
+  // Is receiving into the registered buffers available?
+  bool CanRecv() const {
+    return recv_buffers_ != nullptr &&
+           !recv_unsupported_.load(std::memory_order_relaxed);
+  }
+  void SetRecvUnsupported() {
+    recv_unsupported_.store(true, std::memory_order_relaxed);
+  }
+  char* RecvBuffer(uint16_t buffer_id) const;
+  // Hand receive buffers back to the kernel.
+  void ReturnRecvBuffers(const uint16_t* buffer_ids, size_t count);
+  // Take over a send whose handle was orphaned while the kernel still had
+  // it. It is freed by its completion, or by Close() if none ever comes.
+  void AdoptOrphanedSend(IoUringSendOp* op);
+  // Free an orphaned send once its completion arrives.
+  void FreeOrphanedSend(IoUringSendOp* op);
+  // Get the next free submission queue entry, submitting what's queued if
+  // the ring is full.
+  io_uring_sqe* NextSqe() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Submit everything queued on the submission ring.
+  void SubmitLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Submit anything queued and wait up to timeout for completions. Returns the
+  // number of completions ready to be processed.
+  unsigned SubmitAndWait(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  unsigned CompletionsReady() const;
+  // Process up to max_completions_to_handle completions, the io_uring
+  // analogue of Epoll1Poller::ProcessEpollEvents.
+  bool ProcessCompletions(int max_completions_to_handle, Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  grpc_core::Mutex mu_;
+  Scheduler* scheduler_;
+  int ring_fd_ = -1;
+  // Submission ring, shared with the kernel.
+  grpc_core::Mutex sq_mu_;
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned sq_entries_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  // Completion ring, shared with the kernel.
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+  // Ring mappings, for Close().
+  void* ring_mem_ = nullptr;
+  size_t ring_mem_size_ = 0;
+  size_t sqes_mem_size_ = 0;
+  // Registered receive buffers, and the ring the kernel picks them from.
+  grpc_core::Mutex buf_mu_;
+  void* buf_ring_ = nullptr;
+  size_t buf_ring_size_ = 0;
+  char* recv_buffers_ = nullptr;
+  uint16_t buf_ring_tail_ ABSL_GUARDED_BY(buf_mu_) = 0;
+  std::atomic<bool> recv_unsupported_{false};
+  // Sends of orphaned handles still owned by the kernel. The lock is taken
+  // under a handle's mu_, so it is never held while taking any other.
+  grpc_core::Mutex orphaned_sends_mu_;
+  absl::flat_hash_set<IoUringSendOp*> orphaned_sends_
+      ABSL_GUARDED_BY(orphaned_sends_mu_);
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  bool closed_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified event
+// engine, or nullptr if io_uring is not usable on this system.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
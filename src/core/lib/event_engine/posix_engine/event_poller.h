@@ -15,8 +15,12 @@
 #ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EVENT_POLLER_H
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EVENT_POLLER_H
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
 #include <string>
 
 #include "absl/functional/any_invocable.h"
@@ -26,6 +30,8 @@
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 
+struct msghdr;
+
 namespace grpc_event_engine::experimental {
 
 class Scheduler {
@@ -45,7 +51,9 @@ class EventHandle {
   // after the operation is complete. After this operation, NotifyXXX and SetXXX
   // operations cannot be performed on the handle. In general, this method
   // should only be called after ShutdownHandle and after all existing NotifyXXX
-  // closures have run and there is no waiting NotifyXXX closure.
+  // closures have run and there is no waiting NotifyXXX closure. A poller
+  // that reads ahead of its owner sets *release_fd to -1, and closes the fd,
+  // if releasing it would lose data it had already read.
   virtual void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
                             absl::string_view reason) = 0;
   // Shutdown a handle. If there is an attempt to call NotifyXXX operations
@@ -81,6 +89,42 @@ class EventHandle {
   virtual bool IsHandleShutdown() = 0;
   // Returns the poller which was used to create this handle.
   virtual PosixEventPoller* Poller() = 0;
+
+  // Pollers that can perform I/O on their own (io_uring) take the accept,
+  // recvmsg and sendmsg syscalls off the owner's path with the methods below.
+  // The defaults say the poller can't, and the owner keeps using the fd.
+  //
+  // Ask the poller to accept connections on this listening socket. If it
+  // returns true, the read closure fires once connections are queued, and
+  // TakeAcceptedFd() must be used instead of accept4().
+  virtual bool StartMultishotAccept() { return false; }
+  // Returns the next connection accepted on this socket, non-blocking and
+  // close-on-exec, or -1 with errno set like accept4() does.
+  virtual int TakeAcceptedFd() {
+    errno = EAGAIN;
+    return -1;
+  }
+  // Ask the poller to receive on this connected socket, into buffers it has
+  // registered with the kernel. If it returns true, the read closure fires
+  // once data is queued, and RecvMsg() must be used instead of recvmsg().
+  virtual bool StartMultishotRecv() { return false; }
+  // Like recvmsg(fd, msg, 0). Control messages are only returned when the
+  // data did not go through the poller's buffers.
+  virtual int64_t RecvMsg(struct msghdr* /*msg*/) {
+    errno = EAGAIN;
+    return -1;
+  }
+  // Returns true if the poller can send on this socket, see SendAsync().
+  virtual bool CanSendAsync() { return false; }
+  // Hand the slices of data over to the poller, which sends all of them with
+  // its next submission. The write closure fires once they are sent or the
+  // send failed, and TakeSendResult() returns what happened. Returns false
+  // while the previous send is still in flight.
+  virtual bool SendAsync(SliceBuffer& /*data*/) { return false; }
+  // If the last SendAsync() is done, sets result to the number of bytes sent,
+  // or to -errno, and returns true.
+  virtual bool TakeSendResult(int64_t* /*result*/) { return false; }
+
   virtual ~EventHandle() = default;
 };
 
@@ -92,6 +136,15 @@ class PosixEventPoller : public grpc_event_engine::experimental::Poller,
                                     bool track_err) = 0;
   virtual bool CanTrackErrors() const = 0;
   virtual std::string Name() = 0;
+  // Ask the poller to busy poll for up to budget before blocking in Work(...).
+  // The poller keeps the largest budget requested so far. Pollers that can't
+  // busy poll ignore this.
+  virtual void RequestBusyPoll(std::chrono::microseconds /*budget*/) {}
+  // Called around a run of fd callbacks on the calling thread. Pollers that
+  // submit I/O for their handles may hold it back until the run ends, so that
+  // it all goes to the kernel at once.
+  virtual void BeginCallbackBatch() {}
+  virtual void EndCallbackBatch() {}
   // Shuts down and deletes the poller. It is legal to call this function
   // only when no other poller method is in progress. For instance, it is
   // not safe to call this method, while a thread is blocked on Work(...).
@@ -24,6 +24,8 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -81,6 +83,15 @@
 #define SENDMSG_FLAGS 0
 #endif
 
+// Passed on every sendmsg of a write but the last one, so that the kernel
+// packs the data of a write that needs several sendmsg calls into full
+// segments rather than pushing out a short one at each call.
+#ifdef MSG_MORE
+#define SENDMSG_MORE_FLAG MSG_MORE
+#else
+#define SENDMSG_MORE_FLAG 0
+#endif
+
 // TCP zero copy sendmsg flag.
 // NB: We define this here as a fallback in case we're using an older set of
 // library headers that has not defined MSG_ZEROCOPY. Since this constant is
@@ -90,6 +101,12 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// Set in the ee_code of a zerocopy completion when the kernel copied the data
+// after all. Defined here for the same reason as MSG_ZEROCOPY.
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
+
 #define MAX_READ_IOVEC 64
 
 namespace grpc_event_engine::experimental {
@@ -216,6 +233,21 @@ absl::Status PosixOSError(int error_no, absl::string_view call_name) {
       call_name, ": ", grpc_core::StrError(error_no), " (", error_no, ")"));
 }
 
+// Size of the read buffer shared between the endpoints using
+// tcp_shared_read_buffer.
+constexpr size_t kSharedReadBufferSize = 64 * 1024;
+
+// The shared read buffer of the calling thread. Endpoints only read from
+// poller or executor threads, so this bounds read buffer memory by the number
+// of threads rather than the number of connections.
+char* SharedReadBuffer() {
+  static thread_local std::unique_ptr<char[]> buffer;
+  if (buffer == nullptr) {
+    buffer = std::make_unique<char[]>(kSharedReadBufferSize);
+  }
+  return buffer.get();
+}
+
 }  // namespace
 
 #if defined(IOV_MAX) && IOV_MAX < 260
@@ -300,14 +332,23 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   constexpr size_t cmsg_alloc_space = 24;  // CMSG_SPACE(sizeof(int))
 #endif  // GRPC_LINUX_ERRQUEUE
   char cmsgbuf[cmsg_alloc_space];
-  for (size_t i = 0; i < iov_len; i++) {
+  // With no read space of its own (see MaybeMakeReadSlices), the endpoint
+  // reads into the thread's shared buffer and copies out what it got.
+  char* shared_buffer = nullptr;
+  if (shared_read_buffer_ && incoming_buffer_->Length() == 0) {
+    shared_buffer = SharedReadBuffer();
+    iov[0].iov_base = shared_buffer;
+    iov[0].iov_len = kSharedReadBufferSize;
+    iov_len = 1;
+  }
+  for (size_t i = 0; shared_buffer == nullptr && i < iov_len; i++) {
     MutableSlice& slice =
         internal::SliceCast<MutableSlice>(incoming_buffer_->MutableSliceAt(i));
     iov[i].iov_base = slice.begin();
     iov[i].iov_len = slice.length();
   }
 
-  CHECK_NE(incoming_buffer_->Length(), 0u);
+  CHECK(shared_buffer != nullptr || incoming_buffer_->Length() != 0u);
   DCHECK_GT(min_progress_size_, 0);
 
   do {
@@ -329,12 +370,18 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     }
     msg.msg_flags = 0;
 
-    grpc_core::global_stats().IncrementTcpReadOffer(incoming_buffer_->Length());
+    grpc_core::global_stats().IncrementTcpReadOffer(
+        shared_buffer != nullptr ? kSharedReadBufferSize
+                                 : incoming_buffer_->Length());
     grpc_core::global_stats().IncrementTcpReadOfferIovSize(
-        incoming_buffer_->Count());
+        shared_buffer != nullptr ? 1 : incoming_buffer_->Count());
     do {
-      grpc_core::global_stats().IncrementSyscallRead();
-      read_bytes = recvmsg(fd_, &msg, 0);
+      if (poller_recv_) {
+        read_bytes = handle_->RecvMsg(&msg);
+      } else {
+        grpc_core::global_stats().IncrementSyscallRead();
+        read_bytes = recvmsg(fd_, &msg, 0);
+      }
     } while (read_bytes < 0 && errno == EINTR);
 
     if (read_bytes < 0 && errno == EAGAIN) {
@@ -345,6 +392,11 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
       }
       FinishEstimate();
       inq_ = 0;
+      if (shared_read_buffer_) {
+        // Going idle: don't hold on to read space until the next edge.
+        // Whatever is in incoming_buffer_ at this point is unused space.
+        incoming_buffer_->Clear();
+      }
       return false;
     }
 
@@ -368,7 +420,8 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
 
     grpc_core::global_stats().IncrementTcpReadSize(read_bytes);
     AddToEstimate(static_cast<size_t>(read_bytes));
-    DCHECK((size_t)read_bytes <= incoming_buffer_->Length() - total_read_bytes);
+    DCHECK(shared_buffer != nullptr ||
+           (size_t)read_bytes <= incoming_buffer_->Length() - total_read_bytes);
 
 #ifdef GRPC_HAVE_TCP_INQ
     if (inq_capable_) {
@@ -385,6 +438,21 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
 #endif  // GRPC_HAVE_TCP_INQ
 
     total_read_bytes += read_bytes;
+    if (shared_buffer != nullptr) {
+      Slice slice(memory_owner_.MakeSlice(read_bytes));
+      memcpy(internal::SliceCast<MutableSlice>(slice).begin(), shared_buffer,
+             read_bytes);
+      incoming_buffer_->Append(std::move(slice));
+      // Keep reading into the shared buffer while more is pending, up to
+      // what a read would normally have allocated.
+      if (inq_ == 0 ||
+          total_read_bytes >= std::max<size_t>(
+                                  min_progress_size_,
+                                  static_cast<size_t>(target_length_))) {
+        break;
+      }
+      continue;
+    }
     if (inq_ == 0 || total_read_bytes == incoming_buffer_->Length()) {
       break;
     }
@@ -479,6 +547,86 @@ void PosixEndpointImpl::MaybePostReclaimer() {
   }
 }
 
+void PosixEndpointImpl::MaybeShrinkReadBuffers() {
+  if (read_buffer_idle_timeout_ == EventEngine::Duration::zero() ||
+      !memory_owner_.is_valid()) {
+    return;
+  }
+  // A read just completed: whatever is left in last_read_buffer_ is spare read
+  // space held for the next read.
+  last_read_time_ = std::chrono::steady_clock::now();
+  if (memory_owner_.GetPressureInfo().pressure_control_value >= 0.8) {
+    last_read_buffer_.Clear();
+    target_length_ = std::min(target_length_, initial_target_length_);
+    return;
+  }
+  if (last_read_buffer_.Length() == 0 &&
+      target_length_ <= initial_target_length_) {
+    return;
+  }
+  MaybePostIdleReclaimer();
+  MaybeStartIdleTimer(read_buffer_idle_timeout_);
+}
+
+void PosixEndpointImpl::TrimReadBuffers() {
+  // With a read pending, its unused read space is in incoming_buffer_ (bytes
+  // already read towards min_progress_size_ wait in last_read_buffer_).
+  // Otherwise last_read_buffer_ only holds spare space.
+  if (incoming_buffer_ != nullptr) {
+    incoming_buffer_->Clear();
+  } else {
+    last_read_buffer_.Clear();
+  }
+  target_length_ = std::min(target_length_, initial_target_length_);
+}
+
+void PosixEndpointImpl::MaybePostIdleReclaimer() {
+  if (!has_posted_idle_reclaimer_) {
+    has_posted_idle_reclaimer_ = true;
+    memory_owner_.PostReclaimer(
+        grpc_core::ReclamationPass::kIdle,
+        [self = Ref(DEBUG_LOCATION, "Posix Idle Reclaimer")](
+            std::optional<grpc_core::ReclamationSweep> sweep) {
+          if (sweep.has_value()) {
+            self->PerformIdleReclamation();
+          }
+        });
+  }
+}
+
+void PosixEndpointImpl::PerformIdleReclamation() {
+  grpc_core::MutexLock lock(&read_mu_);
+  has_posted_idle_reclaimer_ = false;
+  TrimReadBuffers();
+}
+
+void PosixEndpointImpl::MaybeStartIdleTimer(EventEngine::Duration delay) {
+  if (idle_timer_handle_ != EventEngine::TaskHandle::kInvalid) return;
+  idle_timer_handle_ = engine_->RunAfter(
+      delay, [self = Ref(DEBUG_LOCATION, "Posix Idle Timer")]() {
+        self->OnIdleTimer();
+      });
+}
+
+void PosixEndpointImpl::OnIdleTimer() {
+  grpc_core::EnsureRunInExecCtx([this]() {
+    grpc_core::MutexLock lock(&read_mu_);
+    idle_timer_handle_ = EventEngine::TaskHandle::kInvalid;
+    if (!memory_owner_.is_valid()) return;
+    const auto idle_for = std::chrono::steady_clock::now() - last_read_time_;
+    if (idle_for < read_buffer_idle_timeout_) {
+      // Reads kept completing since the timer was set: check again once the
+      // last of them has been idle for long enough.
+      MaybeStartIdleTimer(std::chrono::duration_cast<EventEngine::Duration>(
+          read_buffer_idle_timeout_ - idle_for));
+      return;
+    }
+    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+        << "Endpoint[" << this << "]: Trimming idle read buffers";
+    TrimReadBuffers();
+  });
+}
+
 void PosixEndpointImpl::UpdateRcvLowat() {
   if (!grpc_core::IsTcpRcvLowatEnabled()) return;
 
@@ -521,6 +669,11 @@ void PosixEndpointImpl::UpdateRcvLowat() {
 void PosixEndpointImpl::MaybeMakeReadSlices() {
   static const int kBigAlloc = 64 * 1024;
   static const int kSmallAlloc = 8 * 1024;
+  // Reads that fit in the shared read buffer don't need space of their own.
+  if (shared_read_buffer_ && incoming_buffer_->Length() == 0 &&
+      static_cast<size_t>(min_progress_size_) <= kSharedReadBufferSize) {
+    return;
+  }
   if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1)) {
     size_t allocate_length = min_progress_size_;
     const size_t target_length = static_cast<size_t>(target_length_);
@@ -561,6 +714,7 @@ bool PosixEndpointImpl::HandleReadLocked(absl::Status& status) {
       // We've consumed the edge, request a new one.
       return false;
     }
+    if (status.ok()) MaybeShrinkReadBuffers();
   } else {
     if (!memory_owner_.is_valid() && status.ok()) {
       status = TcpAnnotateError(absl::UnknownError("Shutting down endpoint"));
@@ -649,6 +803,7 @@ bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
     }
     // Read succeeded immediately. Return true and don't run the on_read
     // callback.
+    MaybeShrinkReadBuffers();
     incoming_buffer_ = nullptr;
     Unref();
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
@@ -664,7 +819,7 @@ TcpZerocopySendRecord* PosixEndpointImpl::TcpGetSendZerocopyRecord(
   TcpZerocopySendRecord* zerocopy_send_record = nullptr;
   const bool use_zerocopy =
       tcp_zerocopy_send_ctx_->Enabled() &&
-      tcp_zerocopy_send_ctx_->ThresholdBytes() < buf.Length();
+      tcp_zerocopy_send_ctx_->ShouldSendZerocopy(buf.Length());
   if (use_zerocopy) {
     zerocopy_send_record = tcp_zerocopy_send_ctx_->GetSendRecord();
     if (zerocopy_send_record == nullptr) {
@@ -767,16 +922,33 @@ void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg) {
   DCHECK(serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY);
   const uint32_t lo = serr->ee_info;
   const uint32_t hi = serr->ee_data;
-  for (uint32_t seq = lo; seq <= hi; ++seq) {
+  const bool copied = (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+  // The kernel coalesces consecutive completions into [lo, hi], which wraps
+  // around once the 32 bit sequence number does.
+  const uint32_t count = hi - lo + 1;
+  const auto now = std::chrono::steady_clock::now();
+  for (uint32_t seq = lo; seq != hi + 1; ++seq) {
     // TODO(arjunroy): It's likely that lo and hi refer to zerocopy sequence
     // numbers that are generated by a single call to grpc_endpoint_write; ie.
     // we can batch the unref operation. So, check if record is the same for
     // both; if so, batch the unref/put.
+    std::chrono::steady_clock::time_point sent_at;
     TcpZerocopySendRecord* record =
-        tcp_zerocopy_send_ctx_->ReleaseSendRecord(seq);
+        tcp_zerocopy_send_ctx_->ReleaseSendRecord(seq, &sent_at);
     DCHECK(record);
+    grpc_core::global_stats().IncrementTcpZerocopyCompletions();
+    if (copied) grpc_core::global_stats().IncrementTcpZerocopyCopied();
+    grpc_core::global_stats().IncrementTcpZerocopyCompletionLatency(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - sent_at)
+            .count());
     UnrefMaybePutZerocopySendRecord(record);
   }
+  if (tcp_zerocopy_send_ctx_->NoteCompletions(count, copied)) {
+    grpc_core::global_stats().IncrementTcpZerocopyThresholdChanges();
+    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+        << "Endpoint[" << this << "]: zerocopy send threshold is now "
+        << tcp_zerocopy_send_ctx_->ThresholdBytes() << " bytes";
+  }
   if (tcp_zerocopy_send_ctx_->UpdateZeroCopyOptMemStateAfterFree()) {
     handle_->SetWritable();
   }
@@ -941,6 +1113,7 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
     sending_length = 0;
     iov_size = record->PopulateIovs(&unwind_slice_idx, &unwind_byte_idx,
                                     &sending_length, iov);
+    const int more_flag = record->AllSlicesSent() ? 0 : SENDMSG_MORE_FLAG;
     msg.msg_name = nullptr;
     msg.msg_namelen = 0;
     msg.msg_iov = iov;
@@ -955,7 +1128,7 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
     if (outgoing_buffer_arg_ != nullptr) {
       if (!ts_capable_ ||
           !WriteWithTimestamps(&msg, sending_length, &sent_length, &saved_errno,
-                               MSG_ZEROCOPY)) {
+                               MSG_ZEROCOPY | more_flag)) {
         // We could not set socket options to collect Fathom timestamps.
         // Fallback on writing without timestamps.
         ts_capable_ = false;
@@ -969,7 +1142,8 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
       msg.msg_controllen = 0;
       grpc_core::global_stats().IncrementTcpWriteSize(sending_length);
       grpc_core::global_stats().IncrementTcpWriteIovSize(iov_size);
-      sent_length = TcpSend(fd_, &msg, &saved_errno, MSG_ZEROCOPY);
+      sent_length =
+          TcpSend(fd_, &msg, &saved_errno, MSG_ZEROCOPY | more_flag);
     }
     if (tcp_zerocopy_send_ctx_->UpdateZeroCopyOptMemStateAfterSend(
             saved_errno == ENOBUFS, constrained) ||
@@ -1043,6 +1217,10 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
   int saved_errno;
   status = absl::OkStatus();
 
+  if (send_in_flight_ || (poller_send_ && outgoing_buffer_arg_ == nullptr)) {
+    return TcpFlushAsync(status);
+  }
+
   // We always start at zero, because we eagerly unref and trim the slice
   // buffer as we write
   size_t outgoing_slice_idx = 0;
@@ -1064,6 +1242,9 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
       outgoing_byte_idx_ = 0;
     }
     CHECK_GT(iov_size, 0u);
+    const int more_flag = outgoing_slice_idx != outgoing_buffer_->Count()
+                              ? SENDMSG_MORE_FLAG
+                              : 0;
 
     msg.msg_name = nullptr;
     msg.msg_namelen = 0;
@@ -1073,8 +1254,9 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
     bool tried_sending_message = false;
     saved_errno = 0;
     if (outgoing_buffer_arg_ != nullptr) {
-      if (!ts_capable_ || !WriteWithTimestamps(&msg, sending_length,
-                                               &sent_length, &saved_errno, 0)) {
+      if (!ts_capable_ ||
+          !WriteWithTimestamps(&msg, sending_length, &sent_length, &saved_errno,
+                               more_flag)) {
         // We could not set socket options to collect Fathom timestamps.
         // Fallback on writing without timestamps.
         ts_capable_ = false;
@@ -1088,7 +1270,7 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
       msg.msg_controllen = 0;
       grpc_core::global_stats().IncrementTcpWriteSize(sending_length);
       grpc_core::global_stats().IncrementTcpWriteIovSize(iov_size);
-      sent_length = TcpSend(fd_, &msg, &saved_errno);
+      sent_length = TcpSend(fd_, &msg, &saved_errno, more_flag);
     }
 
     if (sent_length < 0) {
@@ -1129,10 +1311,37 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
   }
 }
 
+bool PosixEndpointImpl::TcpFlushAsync(absl::Status& status) {
+  if (!send_in_flight_) {
+    grpc_core::global_stats().IncrementTcpWriteSize(outgoing_buffer_->Length());
+    grpc_core::global_stats().IncrementTcpWriteIovSize(
+        outgoing_buffer_->Count());
+    SliceBuffer data;
+    data.Swap(*outgoing_buffer_);
+    if (!handle_->SendAsync(data)) {
+      // A send abandoned by an earlier failed write is still in flight.
+      status = TcpAnnotateError(absl::UnavailableError("send in flight"));
+      return true;
+    }
+    send_in_flight_ = true;
+    return false;
+  }
+  int64_t result;
+  if (!handle_->TakeSendResult(&result)) return false;
+  send_in_flight_ = false;
+  if (result < 0) {
+    status = TcpAnnotateError(PosixOSError(-result, "sendmsg"));
+    return true;
+  }
+  bytes_counter_ += result;
+  return true;
+}
+
 void PosixEndpointImpl::HandleWrite(absl::Status status) {
   if (!status.ok()) {
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
         << "Endpoint[" << this << "]: Write failed: " << status;
+    send_in_flight_ = false;
     absl::AnyInvocable<void(absl::Status)> cb_ = std::move(write_cb_);
     write_cb_ = nullptr;
     if (current_zerocopy_send_ != nullptr) {
@@ -1160,6 +1369,73 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
   }
 }
 
+void PosixEndpointImpl::SetTcpInfoSampleCallback(
+    absl::AnyInvocable<
+        void(const grpc_core::TcpTracerInterface::ConnectionMetrics&)>
+        on_sample) {
+  grpc_core::MutexLock lock(&tcp_info_mu_);
+  tcp_info_sample_cb_ = std::move(on_sample);
+}
+
+void PosixEndpointImpl::MaybeSampleTcpInfo() {
+#ifdef GRPC_LINUX_ERRQUEUE
+  if (tcp_info_sample_interval_ == EventEngine::Duration::zero()) return;
+  const auto now = std::chrono::steady_clock::now();
+  if (now < next_tcp_info_sample_) return;
+  next_tcp_info_sample_ = now + tcp_info_sample_interval_;
+  tcp_info info;
+  if (GetSocketTcpInfo(&info, fd_) != 0) return;
+  auto& stats = grpc_core::global_stats();
+  stats.IncrementTcpInfoSamples();
+  grpc_core::TcpTracerInterface::ConnectionMetrics metrics;
+  metrics.srtt = info.tcpi_rtt;
+  metrics.congestion_window = info.tcpi_snd_cwnd;
+  metrics.snd_ssthresh = info.tcpi_snd_ssthresh;
+  metrics.packet_retx = info.tcpi_total_retrans;
+  stats.IncrementTcpInfoSrtt(info.tcpi_rtt);
+  stats.IncrementTcpInfoRetransmits(info.tcpi_total_retrans -
+                                    tcp_info_total_retrans_);
+  tcp_info_total_retrans_ = info.tcpi_total_retrans;
+  // Older kernels return a shorter struct.
+  if (info.length > offsetof(tcp_info, tcpi_sndbuf_limited)) {
+    metrics.is_delivery_rate_app_limited =
+        static_cast<bool>(info.tcpi_delivery_rate_app_limited);
+    metrics.pacing_rate = info.tcpi_pacing_rate;
+    metrics.data_notsent = info.tcpi_notsent_bytes;
+    if (info.tcpi_min_rtt != UINT32_MAX) {
+      metrics.min_rtt = info.tcpi_min_rtt;
+    }
+    metrics.delivery_rate = info.tcpi_delivery_rate;
+    metrics.busy_usec = info.tcpi_busy_time;
+    metrics.rwnd_limited_usec = info.tcpi_rwnd_limited;
+    metrics.sndbuf_limited_usec = info.tcpi_sndbuf_limited;
+    if (info.tcpi_delivery_rate_app_limited) {
+      stats.IncrementTcpInfoAppLimitedSamples();
+    }
+    const uint64_t busy_usec = info.tcpi_busy_time - tcp_info_busy_usec_;
+    if (busy_usec > 0) {
+      stats.IncrementTcpInfoRwndLimitedPercent(static_cast<int>(
+          std::min<uint64_t>(100, 100 * (info.tcpi_rwnd_limited -
+                                         tcp_info_rwnd_limited_usec_) /
+                                      busy_usec)));
+      stats.IncrementTcpInfoSndbufLimitedPercent(static_cast<int>(
+          std::min<uint64_t>(100, 100 * (info.tcpi_sndbuf_limited -
+                                         tcp_info_sndbuf_limited_usec_) /
+                                      busy_usec)));
+    }
+    tcp_info_busy_usec_ = info.tcpi_busy_time;
+    tcp_info_rwnd_limited_usec_ = info.tcpi_rwnd_limited;
+    tcp_info_sndbuf_limited_usec_ = info.tcpi_sndbuf_limited;
+  }
+  if (info.length > offsetof(tcp_info, tcpi_dsack_dups)) {
+    metrics.data_sent = info.tcpi_bytes_sent;
+    metrics.data_retx = info.tcpi_bytes_retrans;
+  }
+  grpc_core::MutexLock lock(&tcp_info_mu_);
+  if (tcp_info_sample_cb_ != nullptr) tcp_info_sample_cb_(metrics);
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
 bool PosixEndpointImpl::Write(
     absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data,
     const EventEngine::Endpoint::WriteArgs* args) {
@@ -1190,6 +1466,8 @@ bool PosixEndpointImpl::Write(
     return true;
   }
 
+  MaybeSampleTcpInfo();
+
   zerocopy_send_record = TcpGetSendZerocopyRecord(*data);
   if (zerocopy_send_record == nullptr) {
     // Either not enough bytes, or couldn't allocate a zerocopy context.
@@ -1245,6 +1523,10 @@ void PosixEndpointImpl::MaybeShutdown(
   handle_->ShutdownHandle(why);
   read_mu_.Lock();
   memory_owner_.Reset();
+  if (idle_timer_handle_ != EventEngine::TaskHandle::kInvalid &&
+      engine_->Cancel(idle_timer_handle_)) {
+    idle_timer_handle_ = EventEngine::TaskHandle::kInvalid;
+  }
   read_mu_.Unlock();
   Unref();
 }
@@ -1254,8 +1536,16 @@ PosixEndpointImpl ::~PosixEndpointImpl() {
   handle_->OrphanHandle(on_done_,
                         on_release_fd_ == nullptr ? nullptr : &release_fd, "");
   if (on_release_fd_ != nullptr) {
+    absl::StatusOr<int> result = release_fd;
+    if (release_fd < 0) {
+      // The poller had already read data off the fd, and closed it rather
+      // than hand over a truncated stream.
+      result = absl::DataLossError("Unread data was lost releasing the fd");
+    }
     engine_->Run([on_release_fd = std::move(on_release_fd_),
-                  release_fd]() mutable { on_release_fd(release_fd); });
+                  result = std::move(result)]() mutable {
+      on_release_fd(std::move(result));
+    });
   }
   delete on_read_;
   delete on_write_;
@@ -1289,9 +1579,15 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
     peer_address_ = *peer_address;
   }
   target_length_ = static_cast<double>(options.tcp_read_chunk_size);
+  initial_target_length_ = target_length_;
+  read_buffer_idle_timeout_ =
+      std::chrono::milliseconds(options.tcp_read_buffer_idle_timeout_ms);
   bytes_read_this_round_ = 0;
   min_read_chunk_size_ = options.tcp_min_read_chunk_size;
   max_read_chunk_size_ = options.tcp_max_read_chunk_size;
+  shared_read_buffer_ = options.tcp_shared_read_buffer;
+  tcp_info_sample_interval_ =
+      std::chrono::milliseconds(options.tcp_info_sample_interval_ms);
   bool zerocopy_enabled =
       options.tcp_tx_zero_copy_enabled && poller_->CanTrackErrors();
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -1325,6 +1621,23 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
       options.tcp_tx_zerocopy_send_bytes_threshold);
+  // Pollers that do I/O themselves only take plain TCP traffic: the receive
+  // path drops control messages (the shared memory handshake passes fds over
+  // unix sockets), and zerocopy needs the syscalls on this thread.
+  const int family =
+      reinterpret_cast<const sockaddr*>(local_address_.address())->sa_family;
+  if (family == AF_INET || family == AF_INET6) {
+    poller_recv_ = handle_->StartMultishotRecv();
+    poller_send_ = !zerocopy_enabled && handle_->CanSendAsync();
+  }
+  if (options.tcp_busy_poll_usec > 0) {
+    auto status = sock_.SetSocketBusyPoll(options.tcp_busy_poll_usec);
+    if (!status.ok()) {
+      VLOG(2) << "cannot set busy poll fd=" << fd_ << ": " << status;
+    }
+    poller_->RequestBusyPoll(
+        std::chrono::microseconds(options.tcp_busy_poll_usec));
+  }
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
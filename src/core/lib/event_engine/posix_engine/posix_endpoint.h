@@ -24,7 +24,9 @@
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <new>
@@ -39,6 +41,7 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
@@ -167,12 +170,21 @@ class TcpZerocopySendCtx {
  public:
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;  // 16KB
+  // The threshold adapts between the configured one and this.
+  static constexpr size_t kMaxSendBytesThreshold = 16 * 1024 * 1024;  // 16MB
+  // Number of completions over which the copy fallback rate is measured.
+  static constexpr uint32_t kAdaptWindow = 64;
+  // While the threshold is raised, one in this many writes between the
+  // configured and the current threshold still uses zerocopy, so that the
+  // fallback rate keeps being measured for them.
+  static constexpr uint32_t kProbeInterval = 16;
 
   explicit TcpZerocopySendCtx(
       bool zerocopy_enabled, int max_sends = kDefaultMaxSends,
       size_t send_bytes_threshold = kDefaultSendBytesThreshold)
       : max_sends_(max_sends),
         free_send_records_size_(max_sends),
+        base_threshold_bytes_(send_bytes_threshold),
         threshold_bytes_(send_bytes_threshold) {
     send_records_ = static_cast<TcpZerocopySendRecord*>(
         gpr_malloc(max_sends * sizeof(*send_records_)));
@@ -244,7 +256,8 @@ class TcpZerocopySendCtx {
   void AssociateSeqWithSendRecordLocked(uint32_t seq,
                                         TcpZerocopySendRecord* record)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
-    ctx_lookup_.emplace(seq, record);
+    ctx_lookup_.emplace(seq,
+                        InflightSend{record, std::chrono::steady_clock::now()});
   }
 
   // Get a send record for a send that we wish to do with zerocopy.
@@ -261,10 +274,13 @@ class TcpZerocopySendCtx {
   // single sequence number. This is called either when we receive the relevant
   // error queue notification (saying that we can discard the underlying
   // buffers for this sendmsg()) is received from the kernel - or, in case
-  // sendmsg() was unsuccessful to begin with.
-  TcpZerocopySendRecord* ReleaseSendRecord(uint32_t seq) {
+  // sendmsg() was unsuccessful to begin with. If sent_at is given, it is set
+  // to the time of the sendmsg().
+  TcpZerocopySendRecord* ReleaseSendRecord(
+      uint32_t seq,
+      std::chrono::steady_clock::time_point* sent_at = nullptr) {
     grpc_core::MutexLock lock(&mu_);
-    return ReleaseSendRecordLocked(seq);
+    return ReleaseSendRecordLocked(seq, sent_at);
   }
 
   // After all the references to a TcpZerocopySendRecord are released, we can
@@ -292,8 +308,48 @@ class TcpZerocopySendCtx {
 
   // Only use zerocopy if we are sending at least this many bytes. The
   // additional overhead of reading the error queue for notifications means that
-  // zerocopy is not useful for small transfers.
-  size_t ThresholdBytes() const { return threshold_bytes_; }
+  // zerocopy is not useful for small transfers. This starts at the configured
+  // threshold and is raised while the kernel keeps falling back to copying
+  // (see NoteCompletions()).
+  size_t ThresholdBytes() const {
+    return threshold_bytes_.load(std::memory_order_relaxed);
+  }
+
+  // Whether a write of send_bytes should use zerocopy.
+  bool ShouldSendZerocopy(size_t send_bytes) {
+    if (send_bytes > ThresholdBytes()) return true;
+    if (send_bytes <= base_threshold_bytes_) return false;
+    return probe_count_.fetch_add(1, std::memory_order_relaxed) %
+               kProbeInterval ==
+           0;
+  }
+
+  // Record the completion of count zerocopy sends, as reported by one error
+  // queue notification. copied is set if the kernel fell back to copying the
+  // data (SO_EE_CODE_ZEROCOPY_COPIED), in which case the send paid for both
+  // the copy and the notification. Every kAdaptWindow completions, the
+  // threshold is doubled if more than half of them were copied, and halved
+  // back towards the configured threshold if fewer than one in eight were.
+  // Returns true if the threshold changed.
+  bool NoteCompletions(uint32_t count, bool copied) {
+    grpc_core::MutexLock lock(&mu_);
+    window_completions_ += count;
+    if (copied) window_copied_ += count;
+    if (window_completions_ < kAdaptWindow) return false;
+    const size_t threshold = ThresholdBytes();
+    size_t new_threshold = threshold;
+    if (window_copied_ * 2 > window_completions_) {
+      new_threshold = std::min(std::max<size_t>(threshold, 1) * 2,
+                               std::max(kMaxSendBytesThreshold,
+                                        base_threshold_bytes_));
+    } else if (window_copied_ * 8 < window_completions_) {
+      new_threshold = std::max(threshold / 2, base_threshold_bytes_);
+    }
+    window_completions_ = 0;
+    window_copied_ = 0;
+    threshold_bytes_.store(new_threshold, std::memory_order_relaxed);
+    return new_threshold != threshold;
+  }
 
   // Expected to be called by handler reading messages from the err queue.
   // It is used to indicate that some optmem memory is now available. It returns
@@ -418,11 +474,19 @@ class TcpZerocopySendCtx {
              // check this state after the sendmsg.
   };
 
-  TcpZerocopySendRecord* ReleaseSendRecordLocked(uint32_t seq)
+  // A zerocopy sendmsg() waiting for its completion notification.
+  struct InflightSend {
+    TcpZerocopySendRecord* record;
+    std::chrono::steady_clock::time_point sent_at;
+  };
+
+  TcpZerocopySendRecord* ReleaseSendRecordLocked(
+      uint32_t seq, std::chrono::steady_clock::time_point* sent_at)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
     auto iter = ctx_lookup_.find(seq);
     DCHECK(iter != ctx_lookup_.end());
-    TcpZerocopySendRecord* record = iter->second;
+    TcpZerocopySendRecord* record = iter->second.record;
+    if (sent_at != nullptr) *sent_at = iter->second.sent_at;
     ctx_lookup_.erase(iter);
     return record;
   }
@@ -454,9 +518,12 @@ class TcpZerocopySendCtx {
   uint32_t last_send_ = 0;
   std::atomic<bool> shutdown_{false};
   bool enabled_ = false;
-  size_t threshold_bytes_ = kDefaultSendBytesThreshold;
-  absl::flat_hash_map<uint32_t, TcpZerocopySendRecord*> ctx_lookup_
-      ABSL_GUARDED_BY(mu_);
+  const size_t base_threshold_bytes_;
+  std::atomic<size_t> threshold_bytes_;
+  std::atomic<uint32_t> probe_count_{0};
+  uint32_t window_completions_ ABSL_GUARDED_BY(mu_) = 0;
+  uint32_t window_copied_ ABSL_GUARDED_BY(mu_) = 0;
+  absl::flat_hash_map<uint32_t, InflightSend> ctx_lookup_ ABSL_GUARDED_BY(mu_);
   bool memory_limited_ = false;
   bool is_in_write_ ABSL_GUARDED_BY(mu_) = false;
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
@@ -493,6 +560,11 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  void SetTcpInfoSampleCallback(
+      absl::AnyInvocable<
+          void(const grpc_core::TcpTracerInterface::ConnectionMetrics&)>
+          on_sample);
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -510,12 +582,27 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void PerformReclamation() ABSL_LOCKS_EXCLUDED(read_mu_);
+  // Read buffer shrink-on-idle policy (see
+  // GRPC_ARG_TCP_READ_BUFFER_IDLE_TIMEOUT_MS).
+  void MaybeShrinkReadBuffers() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void TrimReadBuffers() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void MaybePostIdleReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void PerformIdleReclamation() ABSL_LOCKS_EXCLUDED(read_mu_);
+  void MaybeStartIdleTimer(EventEngine::Duration delay)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void OnIdleTimer() ABSL_LOCKS_EXCLUDED(read_mu_);
+  // Samples the TCP_INFO of the socket, if at least
+  // GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS passed since the previous sample.
+  void MaybeSampleTcpInfo();
   // Zero copy related helper methods.
   TcpZerocopySendRecord* TcpGetSendZerocopyRecord(
       grpc_event_engine::experimental::SliceBuffer& buf);
   bool DoFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlush(absl::Status& status);
+  // Flush by handing the outgoing buffer to the poller. Returns true once the
+  // poller reports the send done.
+  bool TcpFlushAsync(absl::Status& status);
   void TcpShutdownTracedBufferList();
   void UnrefMaybePutZerocopySendRecord(TcpZerocopySendRecord* record);
   void ZerocopyDisableAndWaitForRemaining();
@@ -535,9 +622,23 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int fd_;
   bool is_first_read_ = true;
   bool has_posted_reclaimer_ ABSL_GUARDED_BY(read_mu_) = false;
+  bool has_posted_idle_reclaimer_ ABSL_GUARDED_BY(read_mu_) = false;
   double target_length_;
+  // What target_length_ starts at, and falls back to once read buffers are
+  // trimmed.
+  double initial_target_length_;
+  // Zero unless read buffers are trimmed after this long without a completed
+  // read.
+  EventEngine::Duration read_buffer_idle_timeout_{0};
+  std::chrono::steady_clock::time_point last_read_time_
+      ABSL_GUARDED_BY(read_mu_);
+  EventEngine::TaskHandle idle_timer_handle_ ABSL_GUARDED_BY(read_mu_) =
+      EventEngine::TaskHandle::kInvalid;
   int min_read_chunk_size_;
   int max_read_chunk_size_;
+  // Read through the thread's shared read buffer rather than holding read
+  // space per endpoint.
+  bool shared_read_buffer_ = false;
   int set_rcvlowat_ = 0;
   double bytes_read_this_round_ = 0;
   std::atomic<int> ref_count_{1};
@@ -586,6 +687,14 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 #endif  // GRPC_LINUX_ERRQUEUE
   // Cache whether we can set timestamping options
   bool ts_capable_ = true;
+  // True if the poller receives on the socket for us, see
+  // EventHandle::StartMultishotRecv().
+  bool poller_recv_ = false;
+  // True if writes without timestamps are handed to the poller, see
+  // EventHandle::SendAsync().
+  bool poller_send_ = false;
+  // True while a write handed to the poller is in flight.
+  bool send_in_flight_ = false;
   // Set to 1 if we do not want to be notified on errors anymore.
   std::atomic<bool> stop_error_notification_{false};
   std::unique_ptr<TcpZerocopySendCtx> tcp_zerocopy_send_ctx_;
@@ -594,6 +703,19 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
   TracedBufferList traced_buffers_;
+  // Zero unless TCP_INFO is sampled. The sample state is only touched by
+  // Write(), which callers never run concurrently.
+  EventEngine::Duration tcp_info_sample_interval_{0};
+  std::chrono::steady_clock::time_point next_tcp_info_sample_;
+  // Cumulative values of the previous sample.
+  uint32_t tcp_info_total_retrans_ = 0;
+  uint64_t tcp_info_busy_usec_ = 0;
+  uint64_t tcp_info_rwnd_limited_usec_ = 0;
+  uint64_t tcp_info_sndbuf_limited_usec_ = 0;
+  grpc_core::Mutex tcp_info_mu_;
+  absl::AnyInvocable<void(
+      const grpc_core::TcpTracerInterface::ConnectionMetrics&)>
+      tcp_info_sample_cb_ ABSL_GUARDED_BY(tcp_info_mu_);
   // The handle is owned by the PosixEndpointImpl object.
   EventHandle* handle_;
   PosixEventPoller* poller_;
@@ -639,6 +761,13 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  void SetTcpInfoSampleCallback(
+      absl::AnyInvocable<
+          void(const grpc_core::TcpTracerInterface::ConnectionMetrics&)>
+          on_sample) override {
+    impl_->SetTcpInfoSampleCallback(std::move(on_sample));
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
@@ -700,6 +829,15 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
         "PosixEndpoint::CanTrackErrors not supported on this platform");
   }
 
+  void SetTcpInfoSampleCallback(
+      absl::AnyInvocable<
+          void(const grpc_core::TcpTracerInterface::ConnectionMetrics&)>
+      /*on_sample*/) override {
+    grpc_core::Crash(
+        "PosixEndpoint::SetTcpInfoSampleCallback not supported on this "
+        "platform");
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     grpc_core::Crash("PosixEndpoint::Shutdown not supported on this platform");
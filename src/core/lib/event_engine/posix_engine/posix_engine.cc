@@ -28,6 +28,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/functional/any_invocable.h"
@@ -38,12 +39,14 @@
 #include "absl/strings/str_cat.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/ares_resolver.h"
+#include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/grpc_polled_fd.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/grpc_polled_fd_posix.h"
 #include "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.h"
+#include "src/core/lib/event_engine/posix_engine/shm_ring.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/posix_engine/timer.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
@@ -63,6 +66,7 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener.h"
+#include "src/core/lib/event_engine/posix_engine/shm_endpoint.h"
 #endif  // GRPC_POSIX_SOCKET_TCP
 
 // IWYU pragma: no_include <ratio>
@@ -328,19 +332,56 @@ PosixEnginePollerManager::PosixEnginePollerManager(
   DCHECK_NE(poller_, nullptr);
 }
 
+namespace {
+// The poller manager this thread is deferring closures for, and the closures
+// deferred so far. See PosixEnginePollerManager::DeferClosuresOnThisThread().
+thread_local PosixEnginePollerManager* g_deferring_poller_manager = nullptr;
+thread_local std::vector<EventEngine::Closure*>* g_deferred_closures = nullptr;
+}  // namespace
+
 void PosixEnginePollerManager::Run(
     experimental::EventEngine::Closure* closure) {
-  if (executor_ != nullptr) {
+  if (g_deferring_poller_manager == this) {
+    g_deferred_closures->push_back(closure);
+  } else if (executor_ != nullptr) {
     executor_->Run(closure);
   }
 }
 
 void PosixEnginePollerManager::Run(absl::AnyInvocable<void()> cb) {
-  if (executor_ != nullptr) {
+  if (g_deferring_poller_manager == this) {
+    g_deferred_closures->push_back(SelfDeletingClosure::Create(std::move(cb)));
+  } else if (executor_ != nullptr) {
     executor_->Run(std::move(cb));
   }
 }
 
+void PosixEnginePollerManager::DeferClosuresOnThisThread(
+    std::vector<EventEngine::Closure*>* closures) {
+  DCHECK_EQ(g_deferring_poller_manager, nullptr);
+  g_deferring_poller_manager = this;
+  g_deferred_closures = closures;
+}
+
+void PosixEnginePollerManager::RunDeferredClosures() {
+  if (g_deferring_poller_manager != this) return;
+  std::vector<EventEngine::Closure*>* closures = g_deferred_closures;
+  g_deferring_poller_manager = nullptr;
+  g_deferred_closures = nullptr;
+  size_t num_inline = closures->size();
+  if (executor_ != nullptr) {
+    num_inline = std::min(num_inline, kMaxInlineClosures);
+    // Queue the overflow first, so that other threads can start on it while
+    // this one works through its share.
+    for (size_t i = num_inline; i < closures->size(); ++i) {
+      executor_->Run((*closures)[i]);
+    }
+  }
+  for (size_t i = 0; i < num_inline; ++i) {
+    (*closures)[i]->Run();
+  }
+}
+
 void PosixEnginePollerManager::TriggerShutdown() {
   DCHECK(trigger_shutdown_called_ == false);
   trigger_shutdown_called_ = true;
@@ -403,11 +444,24 @@ void PosixEventEngine::PollerWorkInternal(
   // this can be improved by setting the timeout to the next expiring timer.
   PosixEventPoller* poller = poller_manager->Poller();
   ThreadPool* executor = poller_manager->Executor();
-  auto result = poller->Work(24h, [executor, &poller_manager]() {
+  const bool inline_fd_callbacks =
+      grpc_core::IsPosixEeInlineFdCallbacksEnabled();
+  std::vector<EventEngine::Closure*> deferred_closures;
+  auto result = poller->Work(24h, [&]() {
     executor->Run([poller_manager]() mutable {
       PollerWorkInternal(std::move(poller_manager));
     });
+    // Polling has moved on to another thread, so the callbacks for the
+    // events found by this Work() call can run here without a handoff.
+    if (inline_fd_callbacks) {
+      poller_manager->DeferClosuresOnThisThread(&deferred_closures);
+    }
   });
+  // I/O that the callbacks hand to the poller goes to the kernel together
+  // once they are done.
+  poller->BeginCallbackBatch();
+  poller_manager->RunDeferredClosures();
+  poller->EndCallbackBatch();
   if (result == Poller::WorkResult::kDeadlineExceeded) {
     // The EventEngine is not shutting down but the next asynchronous
     // PollerWorkInternal did not get scheduled. Schedule it now.
@@ -522,6 +576,13 @@ EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
 
 PosixEventEngine::PosixDNSResolver::PosixDNSResolver(
     grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> dns_resolver)
+    : dns_resolver_(dns_resolver.release(),
+                    [](RefCountedDNSResolverInterface* resolver) {
+                      resolver->Orphan();
+                    }) {}
+
+PosixEventEngine::PosixDNSResolver::PosixDNSResolver(
+    std::shared_ptr<RefCountedDNSResolverInterface> dns_resolver)
     : dns_resolver_(std::move(dns_resolver)) {}
 
 void PosixEventEngine::PosixDNSResolver::LookupHostname(
@@ -550,17 +611,47 @@ PosixEventEngine::GetDNSResolver(
   // configuration.
   if (ShouldUseAresDnsResolver()) {
 #if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_ARES_EV_DRIVER)
-    GRPC_TRACE_LOG(event_engine_dns, INFO)
-        << "PosixEventEngine::" << this << " creating AresResolver";
-    auto ares_resolver = AresResolver::CreateAresResolver(
-        options.dns_server,
-        std::make_unique<GrpcPolledFdFactoryPosix>(poller_manager_->Poller()),
-        shared_from_this());
-    if (!ares_resolver.ok()) {
-      return ares_resolver.status();
+    if (!grpc_core::IsSharedAresResolverEnabled()) {
+      GRPC_TRACE_LOG(event_engine_dns, INFO)
+          << "PosixEventEngine::" << this << " creating AresResolver";
+      auto ares_resolver = AresResolver::CreateAresResolver(
+          options.dns_server,
+          std::make_unique<GrpcPolledFdFactoryPosix>(poller_manager_->Poller()),
+          shared_from_this());
+      if (!ares_resolver.ok()) {
+        return ares_resolver.status();
+      }
+      return std::make_unique<PosixEventEngine::PosixDNSResolver>(
+          std::move(*ares_resolver));
+    }
+    // Reuse the resolver, and so the c-ares channel and its open sockets to
+    // the nameservers, of any other lookups in flight to the same server.
+    grpc_core::MutexLock lock(&shared_dns_resolvers_mu_);
+    auto& shared = shared_dns_resolvers_[options.dns_server];
+    std::shared_ptr<RefCountedDNSResolverInterface> dns_resolver =
+        shared.lock();
+    if (dns_resolver == nullptr) {
+      GRPC_TRACE_LOG(event_engine_dns, INFO)
+          << "PosixEventEngine::" << this << " creating shared AresResolver";
+      auto ares_resolver = AresResolver::CreateAresResolver(
+          options.dns_server,
+          std::make_unique<GrpcPolledFdFactoryPosix>(poller_manager_->Poller()),
+          shared_from_this());
+      if (!ares_resolver.ok()) {
+        shared_dns_resolvers_.erase(options.dns_server);
+        return ares_resolver.status();
+      }
+      dns_resolver = std::shared_ptr<RefCountedDNSResolverInterface>(
+          ares_resolver->release(),
+          [](RefCountedDNSResolverInterface* resolver) { resolver->Orphan(); });
+      shared = dns_resolver;
+      // Drop the entries of resolvers that are gone.
+      absl::erase_if(shared_dns_resolvers_, [](const auto& entry) {
+        return entry.second.expired();
+      });
     }
     return std::make_unique<PosixEventEngine::PosixDNSResolver>(
-        std::move(*ares_resolver));
+        std::move(dns_resolver));
 #endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_ARES_EV_DRIVER)
   }
   GRPC_TRACE_LOG(event_engine_dns, INFO)
@@ -700,6 +791,22 @@ std::unique_ptr<EventEngine::Endpoint> PosixEventEngine::CreateEndpointFromFd(
           absl::StrCat("allocator:", fd)));
 }
 
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+PosixEventEngine::CreateShmEndpoint(
+    std::unique_ptr<ShmRing> read_ring, std::unique_ptr<ShmRing> write_ring,
+    std::unique_ptr<EventEngine::Endpoint> socket,
+    MemoryAllocator memory_allocator) {
+#if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+  return grpc_event_engine::experimental::CreateShmEndpoint(
+      std::move(read_ring), std::move(write_ring), std::move(socket),
+      poller_manager_->Poller(), shared_from_this(),
+      std::move(memory_allocator));
+#else   // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+  return absl::UnimplementedError(
+      "shared memory endpoints are not supported on this platform");
+#endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+}
+
 absl::StatusOr<std::unique_ptr<EventEngine::Listener>>
 PosixEventEngine::CreateListener(
     Listener::AcceptCallback on_accept,
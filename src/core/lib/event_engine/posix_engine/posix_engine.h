@@ -19,6 +19,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -112,6 +113,19 @@ class PosixEnginePollerManager
   void Run(experimental::EventEngine::Closure* closure) override;
   void Run(absl::AnyInvocable<void()>) override;
 
+  // Called on a polling thread once the next poll has been handed to another
+  // thread. Until RunDeferredClosures(), closures that the poller schedules
+  // from this thread are appended to closures rather than queued on the
+  // executor, so that fd callbacks run where their events were polled.
+  void DeferClosuresOnThisThread(
+      std::vector<experimental::EventEngine::Closure*>* closures);
+  // Stops deferring and runs the closures deferred on this thread. Only the
+  // first kMaxInlineClosures run here; the rest are queued on the executor,
+  // so that a poll that found many ready fds does not line all of their
+  // callbacks up behind each other on one thread.
+  void RunDeferredClosures();
+  static constexpr size_t kMaxInlineClosures = 16;
+
   bool IsShuttingDown() {
     return poller_state_.load(std::memory_order_acquire) ==
            PollerState::kShuttingDown;
@@ -138,6 +152,10 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
    public:
     explicit PosixDNSResolver(
         grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> dns_resolver);
+    // Shares dns_resolver with other PosixDNSResolvers. It is orphaned, which
+    // cancels any lookups still pending on it, when the last one is destroyed.
+    explicit PosixDNSResolver(
+        std::shared_ptr<RefCountedDNSResolverInterface> dns_resolver);
     void LookupHostname(LookupHostnameCallback on_resolve,
                         absl::string_view name,
                         absl::string_view default_port) override;
@@ -147,7 +165,7 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
                    absl::string_view name) override;
 
    private:
-    grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> dns_resolver_;
+    std::shared_ptr<RefCountedDNSResolverInterface> dns_resolver_;
   };
 
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -176,6 +194,11 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
       const EventEngine::ResolvedAddress& addr, const EndpointConfig& config,
       MemoryAllocator memory_allocator, EventEngine::Duration timeout) override;
 
+  absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> CreateShmEndpoint(
+      std::unique_ptr<ShmRing> read_ring, std::unique_ptr<ShmRing> write_ring,
+      std::unique_ptr<EventEngine::Endpoint> socket,
+      MemoryAllocator memory_allocator) override;
+
   absl::StatusOr<std::unique_ptr<Listener>> CreateListener(
       Listener::AcceptCallback on_accept,
       absl::AnyInvocable<void(absl::Status)> on_shutdown,
@@ -257,6 +280,14 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
 #ifdef GRPC_POSIX_SOCKET_TCP
   std::shared_ptr<PosixEnginePollerManager> poller_manager_;
 #endif  // GRPC_POSIX_SOCKET_TCP
+  // With the shared_ares_resolver experiment: the c-ares resolver in use for
+  // each DNS server, so that concurrent lookups share one c-ares channel and
+  // its nameserver sockets. Only weak references are kept here, since each
+  // resolver holds a strong reference to this engine.
+  grpc_core::Mutex shared_dns_resolvers_mu_;
+  absl::flat_hash_map<std::string,
+                      std::weak_ptr<RefCountedDNSResolverInterface>>
+      shared_dns_resolvers_ ABSL_GUARDED_BY(shared_dns_resolvers_mu_);
 };
 
 }  // namespace grpc_event_engine::experimental
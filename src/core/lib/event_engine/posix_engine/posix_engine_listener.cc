@@ -117,8 +117,50 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   return result->port;
 }
 
+void PosixEngineListenerImpl::ListenerAsyncAcceptors::Append(
+    ListenerSocket socket) {
+  AddAcceptor(socket);
+  const int shards = listener_->options_.listener_cpu_shards;
+  const int family = socket.addr.address()->sa_family;
+  if (shards <= 1 || !listener_->options_.allow_reuse_port ||
+      (family != AF_INET && family != AF_INET6)) {
+    return;
+  }
+  // The socket returned by PrepareSocket is listening already, so it is the
+  // first member of its SO_REUSEPORT group. Open the others on the port it
+  // was given; their index in the group is the order they start listening.
+  EventEngine::ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  int group_size = 1;
+  for (; group_size < shards; ++group_size) {
+    auto shard = CreateAndPrepareListenerSocket(listener_->options_, addr);
+    if (!shard.ok()) {
+      LOG(ERROR) << "Failed to open listener shard " << group_size << " of "
+                 << shards << ": " << shard.status();
+      break;
+    }
+    AddAcceptor(*shard);
+  }
+  auto status = socket.sock.SetSocketReusePortCpuSteering(group_size);
+  if (!status.ok()) {
+    // The kernel hashes connections across the group instead.
+    LOG(ERROR) << "Failed to steer listener shards by incoming CPU: "
+               << status;
+  }
+}
+
+void PosixEngineListenerImpl::ListenerAsyncAcceptors::AddAcceptor(
+    ListenerSocket socket) {
+  acceptors_.push_back(new AsyncConnectionAcceptor(
+      listener_->engine_, listener_->shared_from_this(), socket));
+  if (on_append_) {
+    on_append_(socket.sock.Fd());
+  }
+}
+
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
   Ref();
+  multishot_accept_ = handle_->StartMultishotAccept();
   handle_->NotifyOnRead(notify_on_accept_);
 }
 
@@ -138,7 +180,8 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
     memset(const_cast<sockaddr*>(addr.address()), 0, addr.size());
     // Note: If we ever decide to return this address to the user, remember to
     // strip off the ::ffff:0.0.0.0/96 prefix first.
-    int fd = Accept4(handle_->WrappedFd(), addr, 1, 1);
+    int fd = multishot_accept_ ? handle_->TakeAcceptedFd()
+                               : Accept4(handle_->WrappedFd(), addr, 1, 1);
     if (fd < 0) {
       switch (errno) {
         case EINTR:
@@ -185,7 +228,8 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
 
     // For UNIX sockets, the accept call might not fill up the member
     // sun_path of sockaddr_un, so explicitly call getpeername to get it.
-    if (addr.address()->sa_family == AF_UNIX) {
+    // Connections accepted by the poller come without an address at all.
+    if (multishot_accept_ || addr.address()->sa_family == AF_UNIX) {
       socklen_t len = EventEngine::ResolvedAddress::MAX_SIZE_BYTES;
       if (getpeername(fd, const_cast<sockaddr*>(addr.address()), &len) < 0) {
         auto listener_addr_uri = ResolvedAddressToURI(socket_.addr);
@@ -122,6 +122,9 @@ class PosixEngineListenerImpl
     ListenerSocketsContainer::ListenerSocket socket_;
     EventHandle* handle_;
     PosixEngineClosure* notify_on_accept_;
+    // True if the poller accepts connections for us, see
+    // EventHandle::StartMultishotAccept().
+    bool multishot_accept_ = false;
     // Tracks the status of a backup timer to retry accept4 calls after file
     // descriptor exhaustion.
     std::atomic<bool> retry_timer_armed_{false};
@@ -136,13 +139,10 @@ class PosixEngineListenerImpl
       on_append_ = std::move(on_append);
     }
 
-    void Append(ListenerSocket socket) override {
-      acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
-      if (on_append_) {
-        on_append_(socket.sock.Fd());
-      }
-    }
+    // Adds an acceptor for the socket. When options_.listener_cpu_shards
+    // asks for it, also opens the rest of the socket's SO_REUSEPORT group and
+    // steers connections across the group by incoming CPU.
+    void Append(ListenerSocket socket) override;
 
     absl::StatusOr<ListenerSocket> Find(
         const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
@@ -167,6 +167,8 @@ class PosixEngineListenerImpl
     }
 
    private:
+    void AddAcceptor(ListenerSocket socket);
+
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
@@ -0,0 +1,345 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/shm_endpoint.h"
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <atomic>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/types/span.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+#ifdef GRPC_LINUX_EVENTFD
+
+namespace {
+
+// The state of a ShmEndpoint, which is kept alive by the callbacks waiting on
+// it.
+class ShmEndpointImpl final : public grpc_core::RefCounted<ShmEndpointImpl> {
+ public:
+  ShmEndpointImpl(std::unique_ptr<ShmRing> read_ring,
+                  std::unique_ptr<ShmRing> write_ring,
+                  std::unique_ptr<EventEngine::Endpoint> socket,
+                  PosixEventPoller* poller, std::shared_ptr<EventEngine> engine,
+                  MemoryAllocator memory_allocator)
+      : read_ring_(std::move(read_ring)),
+        write_ring_(std::move(write_ring)),
+        data_handle_(
+            poller->CreateHandle(read_ring_->data_fd(), "shm-data", false)),
+        space_handle_(
+            poller->CreateHandle(write_ring_->space_fd(), "shm-space", false)),
+        on_data_(PosixEngineClosure::ToPermanentClosure(
+            [this](absl::Status status) { OnData(std::move(status)); })),
+        on_space_(PosixEngineClosure::ToPermanentClosure(
+            [this](absl::Status status) { OnSpace(std::move(status)); })),
+        engine_(std::move(engine)),
+        memory_allocator_(std::move(memory_allocator)),
+        peer_address_(socket->GetPeerAddress()),
+        local_address_(socket->GetLocalAddress()),
+        socket_(std::move(socket)) {}
+
+  ~ShmEndpointImpl() override {
+    // The rings own the eventfds, and close them.
+    int release_fd;
+    data_handle_->OrphanHandle(nullptr, &release_fd, "");
+    space_handle_->OrphanHandle(nullptr, &release_fd, "");
+    delete on_data_;
+    delete on_space_;
+  }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            SliceBuffer* buffer);
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             SliceBuffer* data);
+
+  // Starts watching the socket for the peer closing it.
+  void WatchSocket();
+
+  // Fails the pending operations, closes the socket, and drops the
+  // ShmEndpoint's ref.
+  void Shutdown();
+
+  const EventEngine::ResolvedAddress& peer_address() const {
+    return peer_address_;
+  }
+  const EventEngine::ResolvedAddress& local_address() const {
+    return local_address_;
+  }
+
+ private:
+  // Moves the readable bytes into buffer. Returns false if there were none, so
+  // that the read has to wait.
+  absl::StatusOr<bool> TryReadLocked(SliceBuffer* buffer)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Writes as much of data as fits, removing it from data. Returns false if
+  // some of it did not fit, so that the write has to wait.
+  absl::StatusOr<bool> TryWriteLocked(SliceBuffer* data)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(write_mu_);
+
+  void OnData(absl::Status status);
+  void OnSpace(absl::Status status);
+  void OnSocketDone();
+
+  // Runs the callback of an operation that failed before it had to wait, so
+  // that it does not run within Read() or Write().
+  void FailLater(absl::AnyInvocable<void(absl::Status)> cb,
+                 absl::Status status) {
+    engine_->Run([cb = std::move(cb), status = std::move(status)]() mutable {
+      cb(std::move(status));
+    });
+  }
+
+  const std::unique_ptr<ShmRing> read_ring_;
+  const std::unique_ptr<ShmRing> write_ring_;
+  // Readable when read_ring_ has new bytes, and when write_ring_ has new
+  // space, respectively.
+  EventHandle* const data_handle_;
+  EventHandle* const space_handle_;
+  PosixEngineClosure* const on_data_;
+  PosixEngineClosure* const on_space_;
+  const std::shared_ptr<EventEngine> engine_;
+  MemoryAllocator memory_allocator_;
+  const EventEngine::ResolvedAddress peer_address_;
+  const EventEngine::ResolvedAddress local_address_;
+  std::unique_ptr<EventEngine::Endpoint> socket_;
+  // Read into by socket_, which the peer sends nothing more on.
+  SliceBuffer socket_buffer_;
+  std::atomic<bool> peer_closed_{false};
+
+  grpc_core::Mutex read_mu_;
+  absl::AnyInvocable<void(absl::Status)> on_read_ ABSL_GUARDED_BY(read_mu_);
+  SliceBuffer* read_buffer_ ABSL_GUARDED_BY(read_mu_) = nullptr;
+
+  grpc_core::Mutex write_mu_;
+  absl::AnyInvocable<void(absl::Status)> on_write_ ABSL_GUARDED_BY(write_mu_);
+  SliceBuffer* write_buffer_ ABSL_GUARDED_BY(write_mu_) = nullptr;
+};
+
+absl::Status PeerClosedError() {
+  return absl::UnavailableError("shared memory peer closed the connection");
+}
+
+bool ShmEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
+                           SliceBuffer* buffer) {
+  grpc_core::ReleasableMutexLock lock(&read_mu_);
+  CHECK(on_read_ == nullptr);
+  absl::StatusOr<bool> done = TryReadLocked(buffer);
+  if (!done.ok()) {
+    lock.Release();
+    FailLater(std::move(on_read), done.status());
+    return false;
+  }
+  if (*done) return true;
+  on_read_ = std::move(on_read);
+  read_buffer_ = buffer;
+  Ref().release();
+  data_handle_->NotifyOnRead(on_data_);
+  return false;
+}
+
+absl::StatusOr<bool> ShmEndpointImpl::TryReadLocked(SliceBuffer* buffer) {
+  // Checked before the ring: the peer writes its last bytes before it closes
+  // the socket, so if it has closed it they are in the ring by now.
+  const bool peer_closed = peer_closed_.load(std::memory_order_acquire);
+  absl::StatusOr<absl::Span<const uint8_t>> bytes = read_ring_->Peek();
+  if (!bytes.ok()) return bytes.status();
+  if (bytes->empty()) {
+    if (peer_closed) return PeerClosedError();
+    return false;
+  }
+  grpc_slice slice = memory_allocator_.MakeSlice(bytes->size());
+  memcpy(GRPC_SLICE_START_PTR(slice), bytes->data(), bytes->size());
+  read_ring_->Consume(bytes->size());
+  buffer->Append(Slice(slice));
+  return true;
+}
+
+void ShmEndpointImpl::OnData(absl::Status status) {
+  absl::AnyInvocable<void(absl::Status)> on_read;
+  {
+    grpc_core::MutexLock lock(&read_mu_);
+    // Clear the wakeup before looking at the ring, so that bytes written
+    // after the look signal again.
+    if (status.ok()) status = read_ring_->ConsumeDataWakeup();
+    if (status.ok()) {
+      absl::StatusOr<bool> done = TryReadLocked(read_buffer_);
+      if (done.ok() && !*done) {
+        data_handle_->NotifyOnRead(on_data_);
+        return;
+      }
+      status = done.status();
+    }
+    on_read = std::move(on_read_);
+    read_buffer_ = nullptr;
+  }
+  on_read(std::move(status));
+  Unref();
+}
+
+bool ShmEndpointImpl::Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+                            SliceBuffer* data) {
+  grpc_core::ReleasableMutexLock lock(&write_mu_);
+  CHECK(on_write_ == nullptr);
+  absl::StatusOr<bool> done = TryWriteLocked(data);
+  if (!done.ok()) {
+    lock.Release();
+    FailLater(std::move(on_writable), done.status());
+    return false;
+  }
+  if (*done) return true;
+  on_write_ = std::move(on_writable);
+  write_buffer_ = data;
+  Ref().release();
+  space_handle_->NotifyOnRead(on_space_);
+  return false;
+}
+
+absl::StatusOr<bool> ShmEndpointImpl::TryWriteLocked(SliceBuffer* data) {
+  if (peer_closed_.load(std::memory_order_acquire)) return PeerClosedError();
+  while (data->Length() > 0) {
+    const Slice& front = (*data)[0];
+    absl::StatusOr<size_t> written =
+        write_ring_->Write(absl::MakeConstSpan(front.begin(), front.size()));
+    if (!written.ok()) return written.status();
+    if (*written == front.size()) {
+      data->TakeFirst();
+      continue;
+    }
+    if (*written == 0) return false;
+    SliceBuffer done;
+    data->MoveFirstNBytesIntoSliceBuffer(*written, done);
+  }
+  return true;
+}
+
+void ShmEndpointImpl::OnSpace(absl::Status status) {
+  absl::AnyInvocable<void(absl::Status)> on_write;
+  {
+    grpc_core::MutexLock lock(&write_mu_);
+    if (status.ok()) status = write_ring_->ConsumeSpaceWakeup();
+    if (status.ok()) {
+      absl::StatusOr<bool> done = TryWriteLocked(write_buffer_);
+      if (done.ok() && !*done) {
+        space_handle_->NotifyOnRead(on_space_);
+        return;
+      }
+      status = done.status();
+    }
+    on_write = std::move(on_write_);
+    write_buffer_ = nullptr;
+  }
+  on_write(std::move(status));
+  Unref();
+}
+
+void ShmEndpointImpl::WatchSocket() {
+  // Nothing more is sent on the socket, so the read only completes when the
+  // peer closes it (or misbehaves, which is treated the same way).
+  Ref().release();
+  if (socket_->Read([this](absl::Status) { OnSocketDone(); }, &socket_buffer_,
+                    nullptr)) {
+    OnSocketDone();
+  }
+}
+
+void ShmEndpointImpl::OnSocketDone() {
+  peer_closed_.store(true, std::memory_order_release);
+  // Wake any pending operation, so that it sees the peer has gone.
+  data_handle_->SetReadable();
+  space_handle_->SetReadable();
+  Unref();
+}
+
+void ShmEndpointImpl::Shutdown() {
+  absl::Status why = absl::FailedPreconditionError("Endpoint closing");
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  data_handle_->ShutdownHandle(why);
+  space_handle_->ShutdownHandle(why);
+  // Closing the socket tells the peer that we are gone, and fails our read of
+  // it.
+  socket_.reset();
+  Unref();
+}
+
+class ShmEndpoint final : public EventEngine::Endpoint {
+ public:
+  explicit ShmEndpoint(ShmEndpointImpl* impl) : impl_(impl) {}
+  ~ShmEndpoint() override { impl_->Shutdown(); }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read, SliceBuffer* buffer,
+            const ReadArgs* /*args*/) override {
+    return impl_->Read(std::move(on_read), buffer);
+  }
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             SliceBuffer* data, const WriteArgs* /*args*/) override {
+    return impl_->Write(std::move(on_writable), data);
+  }
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return impl_->peer_address();
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return impl_->local_address();
+  }
+
+ private:
+  ShmEndpointImpl* const impl_;
+};
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> CreateShmEndpoint(
+    std::unique_ptr<ShmRing> read_ring, std::unique_ptr<ShmRing> write_ring,
+    std::unique_ptr<EventEngine::Endpoint> socket, PosixEventPoller* poller,
+    std::shared_ptr<EventEngine> engine, MemoryAllocator memory_allocator) {
+  CHECK(read_ring != nullptr);
+  CHECK(write_ring != nullptr);
+  CHECK(socket != nullptr);
+  auto* impl = new ShmEndpointImpl(std::move(read_ring), std::move(write_ring),
+                                   std::move(socket), poller, std::move(engine),
+                                   std::move(memory_allocator));
+  impl->WatchSocket();
+  return std::make_unique<ShmEndpoint>(impl);
+}
+
+#else  // GRPC_LINUX_EVENTFD
+
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> CreateShmEndpoint(
+    std::unique_ptr<ShmRing> /*read_ring*/,
+    std::unique_ptr<ShmRing> /*write_ring*/,
+    std::unique_ptr<EventEngine::Endpoint> /*socket*/,
+    PosixEventPoller* /*poller*/, std::shared_ptr<EventEngine> /*engine*/,
+    MemoryAllocator /*memory_allocator*/) {
+  return absl::UnimplementedError(
+      "shared memory endpoints are not supported on this platform");
+}
+
+#endif  // GRPC_LINUX_EVENTFD
+
+}  // namespace grpc_event_engine::experimental
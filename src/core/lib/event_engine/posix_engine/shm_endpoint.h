@@ -0,0 +1,43 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHM_ENDPOINT_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHM_ENDPOINT_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+
+#include "absl/status/statusor.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/shm_ring.h"
+
+namespace grpc_event_engine::experimental {
+
+// Creates an Endpoint that moves bytes over a pair of shared memory rings, and
+// waits for their eventfds on \a poller. See
+// EventEngineSupportsShmExtension::CreateShmEndpoint().
+//
+// Reads copy the bytes out of the ring, so that the peer cannot change them
+// while they are parsed, and so that the ring space is freed at once.
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> CreateShmEndpoint(
+    std::unique_ptr<ShmRing> read_ring, std::unique_ptr<ShmRing> write_ring,
+    std::unique_ptr<EventEngine::Endpoint> socket, PosixEventPoller* poller,
+    std::shared_ptr<EventEngine> engine, MemoryAllocator memory_allocator);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHM_ENDPOINT_H
@@ -0,0 +1,277 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/shm_ring.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"  // IWYU pragma: keep
+
+#ifdef GRPC_LINUX_EVENTFD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "src/core/util/strerror.h"
+#endif
+
+namespace grpc_event_engine::experimental {
+
+// Lives in the first page of the memfd. head and tail only ever increase;
+// each is written by one side and read by the other. The peer can write
+// anything here, so they are validated whenever they are read.
+struct ShmRing::Control {
+  alignas(64) std::atomic<uint64_t> head;
+  alignas(64) std::atomic<uint64_t> tail;
+};
+
+#ifdef GRPC_LINUX_EVENTFD
+
+namespace {
+
+absl::Status ErrnoStatus(absl::string_view what) {
+  return absl::InternalError(
+      absl::StrCat(what, ": ", grpc_core::StrError(errno)));
+}
+
+size_t PageSize() { return static_cast<size_t>(sysconf(_SC_PAGESIZE)); }
+
+bool IsPowerOfTwo(size_t n) { return n != 0 && (n & (n - 1)) == 0; }
+
+// The peer must not be able to resize the memfd: shrinking it would make our
+// accesses to the ring fault.
+constexpr int kRequiredSeals = F_SEAL_SHRINK | F_SEAL_GROW;
+
+// Maps the control page and the data pages, followed by a second mapping of
+// the data pages.
+absl::StatusOr<void*> MapRing(int memfd, size_t capacity) {
+  const size_t page = PageSize();
+  void* base = mmap(nullptr, page + 2 * capacity, PROT_NONE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED) return ErrnoStatus("mmap");
+  uint8_t* p = static_cast<uint8_t*>(base);
+  if (mmap(p, page + capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+           memfd, 0) == MAP_FAILED ||
+      mmap(p + page + capacity, capacity, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_FIXED, memfd, page) == MAP_FAILED) {
+    absl::Status status = ErrnoStatus("mmap");
+    munmap(base, page + 2 * capacity);
+    return status;
+  }
+  return base;
+}
+
+void Signal(int fd) {
+  int err;
+  do {
+    err = eventfd_write(fd, 1);
+  } while (err < 0 && errno == EINTR);
+}
+
+absl::Status ConsumeWakeup(int fd) {
+  eventfd_t value;
+  int err;
+  do {
+    err = eventfd_read(fd, &value);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0 && errno != EAGAIN) return ErrnoStatus("eventfd_read");
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<ShmRing>> ShmRing::Create(size_t capacity) {
+  const size_t page = PageSize();
+  size_t rounded = page;
+  while (rounded < capacity) rounded *= 2;
+  int memfd = memfd_create("grpc_shm_ring", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (memfd < 0) return ErrnoStatus("memfd_create");
+  // A new memfd reads as zeroes, so head and tail start out at 0.
+  if (ftruncate(memfd, page + rounded) < 0) {
+    absl::Status status = ErrnoStatus("ftruncate");
+    close(memfd);
+    return status;
+  }
+  if (fcntl(memfd, F_ADD_SEALS, kRequiredSeals | F_SEAL_SEAL) < 0) {
+    absl::Status status = ErrnoStatus("fcntl(F_ADD_SEALS)");
+    close(memfd);
+    return status;
+  }
+  int data_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  int space_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (data_fd < 0 || space_fd < 0) {
+    absl::Status status = ErrnoStatus("eventfd");
+    close(memfd);
+    if (data_fd >= 0) close(data_fd);
+    if (space_fd >= 0) close(space_fd);
+    return status;
+  }
+  return Attach(memfd, data_fd, space_fd);
+}
+
+absl::StatusOr<std::unique_ptr<ShmRing>> ShmRing::Attach(int memfd,
+                                                         int data_fd,
+                                                         int space_fd) {
+  auto close_fds = [&]() {
+    close(memfd);
+    close(data_fd);
+    close(space_fd);
+  };
+  const int seals = fcntl(memfd, F_GET_SEALS);
+  if (seals < 0 || (seals & kRequiredSeals) != kRequiredSeals) {
+    close_fds();
+    return absl::InvalidArgumentError(
+        "shared memory ring is not sealed against resizing");
+  }
+  struct stat st;
+  if (fstat(memfd, &st) < 0) {
+    absl::Status status = ErrnoStatus("fstat");
+    close_fds();
+    return status;
+  }
+  const size_t page = PageSize();
+  const size_t size = static_cast<size_t>(st.st_size);
+  if (size <= page || !IsPowerOfTwo(size - page) ||
+      (size - page) % page != 0) {
+    close_fds();
+    return absl::InvalidArgumentError(
+        absl::StrCat("shared memory ring has bad size ", size));
+  }
+  const size_t capacity = size - page;
+  auto mapping = MapRing(memfd, capacity);
+  if (!mapping.ok()) {
+    close_fds();
+    return mapping.status();
+  }
+  return std::unique_ptr<ShmRing>(
+      new ShmRing(memfd, data_fd, space_fd, capacity, *mapping));
+}
+
+ShmRing::ShmRing(int memfd, int data_fd, int space_fd, size_t capacity,
+                 void* mapping)
+    : memfd_(memfd),
+      data_fd_(data_fd),
+      space_fd_(space_fd),
+      capacity_(capacity),
+      mapping_(mapping),
+      control_(static_cast<Control*>(mapping)),
+      data_(static_cast<uint8_t*>(mapping) + PageSize()) {}
+
+ShmRing::~ShmRing() {
+  munmap(mapping_, PageSize() + 2 * capacity_);
+  close(memfd_);
+  close(data_fd_);
+  close(space_fd_);
+}
+
+// Each side publishes its position and then loads the other's, and all four
+// accesses are seq_cst, so that the wakeups cannot be lost: of a producer
+// publishing a new tail and a consumer that finds the ring empty, at least one
+// sees the other's store (so either the consumer sees the bytes, or the
+// producer sees that the ring was empty and signals). The same holds for a
+// consumer publishing a new head and a producer that finds the ring full.
+
+absl::StatusOr<size_t> ShmRing::Write(absl::Span<const uint8_t> data) {
+  const uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+  const uint64_t head = control_->head.load(std::memory_order_seq_cst);
+  absl::StatusOr<size_t> used = Used(head, tail);
+  if (!used.ok()) return used.status();
+  const size_t n = std::min<size_t>(data.size(), capacity_ - *used);
+  if (n == 0) return 0;
+  memcpy(data_ + tail % capacity_, data.data(), n);
+  control_->tail.store(tail + n, std::memory_order_seq_cst);
+  if (control_->head.load(std::memory_order_seq_cst) == tail) {
+    Signal(data_fd_);
+  }
+  return n;
+}
+
+absl::StatusOr<absl::Span<const uint8_t>> ShmRing::Peek() {
+  const uint64_t head = control_->head.load(std::memory_order_relaxed);
+  const uint64_t tail = control_->tail.load(std::memory_order_seq_cst);
+  absl::StatusOr<size_t> used = Used(head, tail);
+  if (!used.ok()) return used.status();
+  return absl::MakeConstSpan(data_ + head % capacity_, *used);
+}
+
+void ShmRing::Consume(size_t n) {
+  if (n == 0) return;
+  const uint64_t head = control_->head.load(std::memory_order_relaxed);
+  control_->head.store(head + n, std::memory_order_seq_cst);
+  // If the ring was full the producer may be waiting for space.
+  if (control_->tail.load(std::memory_order_seq_cst) - head == capacity_) {
+    Signal(space_fd_);
+  }
+}
+
+absl::StatusOr<size_t> ShmRing::Used(uint64_t head, uint64_t tail) {
+  // Also catches tail < head, which wraps around to a huge size.
+  if (!failed_.load(std::memory_order_relaxed) && tail - head <= capacity_) {
+    return tail - head;
+  }
+  failed_.store(true, std::memory_order_relaxed);
+  return absl::DataLossError(absl::StrCat(
+      "shared memory ring is corrupt: head ", head, ", tail ", tail));
+}
+
+absl::Status ShmRing::ConsumeDataWakeup() { return ConsumeWakeup(data_fd_); }
+
+absl::Status ShmRing::ConsumeSpaceWakeup() { return ConsumeWakeup(space_fd_); }
+
+#else  // GRPC_LINUX_EVENTFD
+
+absl::StatusOr<std::unique_ptr<ShmRing>> ShmRing::Create(size_t /*capacity*/) {
+  return absl::UnimplementedError("shared memory rings are not supported");
+}
+
+absl::StatusOr<std::unique_ptr<ShmRing>> ShmRing::Attach(int /*memfd*/,
+                                                         int /*data_fd*/,
+                                                         int /*space_fd*/) {
+  return absl::UnimplementedError("shared memory rings are not supported");
+}
+
+ShmRing::~ShmRing() { grpc_core::Crash("unimplemented"); }
+
+absl::StatusOr<size_t> ShmRing::Write(absl::Span<const uint8_t> /*data*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+absl::StatusOr<absl::Span<const uint8_t>> ShmRing::Peek() {
+  grpc_core::Crash("unimplemented");
+}
+
+void ShmRing::Consume(size_t /*n*/) { grpc_core::Crash("unimplemented"); }
+
+absl::Status ShmRing::ConsumeDataWakeup() {
+  grpc_core::Crash("unimplemented");
+}
+
+absl::Status ShmRing::ConsumeSpaceWakeup() {
+  grpc_core::Crash("unimplemented");
+}
+
+#endif  // GRPC_LINUX_EVENTFD
+
+}  // namespace grpc_event_engine::experimental
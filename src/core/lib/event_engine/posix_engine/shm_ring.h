@@ -0,0 +1,110 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHM_RING_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHM_RING_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/span.h"
+
+namespace grpc_event_engine::experimental {
+
+// A single-producer single-consumer byte ring in shared memory, for moving
+// bytes between two processes on the same host without going through the
+// kernel's socket buffers.
+//
+// The ring lives in a memfd, so it can be handed to another process (along
+// with the two eventfds) over a unix socket, and attached there. The data
+// pages are mapped twice back to back, so readable and writable regions are
+// always contiguous and the consumer can use the bytes in place.
+//
+// The eventfds are only signalled when the other side may be waiting: the
+// data fd when bytes are written into an empty ring, and the space fd when
+// bytes are consumed from a full one. So the consumer must drain the ring
+// before waiting for data_fd() to become readable, and the producer must
+// fill it before waiting for space_fd().
+//
+// The other process is not trusted to keep the ring consistent. The memfd is
+// sealed against resizing, and once either side sees positions that no valid
+// peer could have written, the ring fails: that and every later Write() or
+// Peek() returns an error.
+//
+// Only available on Linux; elsewhere Create() and Attach() fail.
+class ShmRing {
+ public:
+  // Creates a ring holding at least `capacity` bytes. The capacity is
+  // rounded up to a power of two number of pages.
+  static absl::StatusOr<std::unique_ptr<ShmRing>> Create(size_t capacity);
+  // Attaches to a ring created by another process, taking ownership of the
+  // file descriptors.
+  static absl::StatusOr<std::unique_ptr<ShmRing>> Attach(int memfd,
+                                                         int data_fd,
+                                                         int space_fd);
+
+  ~ShmRing();
+  ShmRing(const ShmRing&) = delete;
+  ShmRing& operator=(const ShmRing&) = delete;
+
+  int memfd() const { return memfd_; }
+  // Readable when there may be new bytes to consume.
+  int data_fd() const { return data_fd_; }
+  // Readable when there may be new space to write into.
+  int space_fd() const { return space_fd_; }
+  size_t capacity() const { return capacity_; }
+
+  // Producer side: copies as much of `data` as fits, and returns the number
+  // of bytes written.
+  absl::StatusOr<size_t> Write(absl::Span<const uint8_t> data);
+
+  // Consumer side: returns every byte written but not yet consumed. The
+  // bytes stay valid until they are consumed, but the producer could still
+  // change them, so they must be copied before they are parsed.
+  absl::StatusOr<absl::Span<const uint8_t>> Peek();
+  // Consumes the first `n` bytes returned by the last Peek().
+  void Consume(size_t n);
+
+  // Clears a wakeup on data_fd() or space_fd() respectively.
+  absl::Status ConsumeDataWakeup();
+  absl::Status ConsumeSpaceWakeup();
+
+ private:
+  struct Control;
+
+  ShmRing(int memfd, int data_fd, int space_fd, size_t capacity, void* mapping);
+
+  // Returns the number of bytes in the ring, or an error if `tail` and `head`
+  // are not positions the ring could be in.
+  absl::StatusOr<size_t> Used(uint64_t head, uint64_t tail);
+
+  const int memfd_;
+  const int data_fd_;
+  const int space_fd_;
+  const size_t capacity_;
+  void* const mapping_;
+  Control* const control_;
+  uint8_t* const data_;
+  std::atomic<bool> failed_{false};
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHM_RING_H
@@ -33,6 +33,9 @@
 
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
 #include <arpa/inet.h>  // IWYU pragma: keep
+#ifdef GPR_LINUX
+#include <linux/filter.h>
+#endif
 #ifdef GRPC_LINUX_TCP_H
 #include <linux/tcp.h>
 #else
@@ -187,6 +190,23 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_shared_read_buffer =
+      (AdjustValue(PosixTcpOptions::kSharedReadBufferDefault, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_SHARED_READ_BUFFER)) != 0);
+  options.tcp_read_buffer_idle_timeout_ms = AdjustValue(
+      PosixTcpOptions::kReadBufferIdleTimeoutMsDefault, 0, INT_MAX,
+      config.GetInt(GRPC_ARG_TCP_READ_BUFFER_IDLE_TIMEOUT_MS));
+  options.tcp_busy_poll_usec =
+      AdjustValue(PosixTcpOptions::kBusyPollUsecDefault, 0,
+                  PosixTcpOptions::kMaxBusyPollUsec,
+                  config.GetInt(GRPC_ARG_TCP_BUSY_POLL_USEC));
+  options.tcp_info_sample_interval_ms =
+      AdjustValue(PosixTcpOptions::kTcpInfoSampleIntervalMsDefault, 0, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS));
+  options.listener_cpu_shards =
+      AdjustValue(PosixTcpOptions::kListenerCpuShardsDefault, 0,
+                  PosixTcpOptions::kMaxListenerCpuShards,
+                  config.GetInt(GRPC_ARG_TCP_LISTENER_CPU_SHARDS));
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -333,6 +353,28 @@ absl::Status PosixSocketWrapper::SetSocketZeroCopy() {
 #endif
 }
 
+// Set a socket to busy poll
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int usec) {
+#ifdef SO_BUSY_POLL
+  if (setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec)) != 0) {
+    return absl::Status(
+        absl::StatusCode::kInternal,
+        absl::StrCat("setsockopt(SO_BUSY_POLL): ", grpc_core::StrError(errno)));
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  // Best effort: needs Linux 5.11.
+  const int prefer = 1;
+  setsockopt(fd_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer));
+#endif
+  return absl::OkStatus();
+#else
+  (void)usec;
+  return absl::Status(absl::StatusCode::kInternal,
+                      absl::StrCat("setsockopt(SO_BUSY_POLL): ",
+                                   grpc_core::StrError(ENOSYS).c_str()));
+#endif
+}
+
 // Set a socket to non blocking mode
 absl::Status PosixSocketWrapper::SetSocketNonBlocking(int non_blocking) {
   int oldflags = fcntl(fd_, F_GETFL, 0);
@@ -495,6 +537,39 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int reuse) {
 #endif
 }
 
+// steer connections across a SO_REUSEPORT group by incoming cpu
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int num_sockets) {
+#if defined(GPR_LINUX) && defined(SO_ATTACH_REUSEPORT_CBPF)
+  if (num_sockets <= 0) {
+    return absl::InvalidArgumentError(
+        "SO_ATTACH_REUSEPORT_CBPF needs at least one socket");
+  }
+  // A = cpu the packet was received on; A %= num_sockets; return A.
+  struct sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<uint32_t>(num_sockets)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  struct sock_fprog prog;
+  prog.len = sizeof(code) / sizeof(code[0]);
+  prog.filter = code;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog,
+                      sizeof(prog))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_ATTACH_REUSEPORT_CBPF): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#else
+  (void)num_sockets;
+  return absl::Status(absl::StatusCode::kInternal,
+                      "SO_ATTACH_REUSEPORT_CBPF unavailable on compiling "
+                      "system");
+#endif
+}
+
 bool PosixSocketWrapper::IsSocketReusePortSupported() {
   static bool kSupportSoReusePort = []() -> bool {
     int s = socket(AF_INET, SOCK_STREAM, 0);
@@ -834,6 +909,10 @@ absl::Status PosixSocketWrapper::SetSocketZeroCopy() {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int /*usec*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketNonBlocking(int /*non_blocking*/) {
   grpc_core::Crash("unimplemented");
 }
@@ -854,6 +933,11 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int /*reuse*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int /*num_sockets*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketDscp(int /*dscp*/) {
   grpc_core::Crash("unimplemented");
 }
@@ -53,6 +53,13 @@ struct PosixTcpOptions {
   static constexpr int kDefaultMinReadChunksize = 256;
   static constexpr int kDefaultMaxReadChunksize = 4 * 1024 * 1024;
   static constexpr int kZerocpTxEnabledDefault = 0;
+  static constexpr int kSharedReadBufferDefault = 0;
+  static constexpr int kReadBufferIdleTimeoutMsDefault = 0;
+  static constexpr int kBusyPollUsecDefault = 0;
+  static constexpr int kMaxBusyPollUsec = 1000000;
+  static constexpr int kListenerCpuShardsDefault = 0;
+  static constexpr int kMaxListenerCpuShards = 1024;
+  static constexpr int kTcpInfoSampleIntervalMsDefault = 0;
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
@@ -66,10 +73,15 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  bool tcp_shared_read_buffer = kSharedReadBufferDefault;
+  int tcp_read_buffer_idle_timeout_ms = kReadBufferIdleTimeoutMsDefault;
+  int tcp_busy_poll_usec = kBusyPollUsecDefault;
+  int tcp_info_sample_interval_ms = kTcpInfoSampleIntervalMsDefault;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  int listener_cpu_shards = kListenerCpuShardsDefault;
   int dscp = kDscpNotSet;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
@@ -137,10 +149,15 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_shared_read_buffer = other.tcp_shared_read_buffer;
+    tcp_read_buffer_idle_timeout_ms = other.tcp_read_buffer_idle_timeout_ms;
+    tcp_busy_poll_usec = other.tcp_busy_poll_usec;
+    tcp_info_sample_interval_ms = other.tcp_info_sample_interval_ms;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listener_cpu_shards = other.listener_cpu_shards;
     dscp = other.dscp;
   }
 };
@@ -174,6 +191,12 @@ class PosixSocketWrapper {
   // Set socket to use zerocopy
   absl::Status SetSocketZeroCopy();
 
+  // Set SO_BUSY_POLL, and SO_PREFER_BUSY_POLL where supported, so that
+  // blocking and epoll waits on this socket busy poll the device queue for up
+  // to usec microseconds. Raising the value above net.core.busy_read needs
+  // CAP_NET_ADMIN.
+  absl::Status SetSocketBusyPoll(int usec);
+
   // Set socket to non blocking mode
   absl::Status SetSocketNonBlocking(int non_blocking);
 
@@ -189,6 +212,12 @@ class PosixSocketWrapper {
   // Set SO_REUSEPORT
   absl::Status SetSocketReusePort(int reuse);
 
+  // Attach a SO_ATTACH_REUSEPORT_CBPF program to the socket's SO_REUSEPORT
+  // group that hands each connection to socket number (incoming CPU %
+  // num_sockets) of the group, i.e. to the num_sockets sockets in the order
+  // they started listening.
+  absl::Status SetSocketReusePortCpuSteering(int num_sockets);
+
   // Set Differentiated Services Code Point (DSCP)
   absl::Status SetSocketDscp(int dscp);
 
@@ -24,8 +24,10 @@
 #include <algorithm>
 #include <atomic>
 #include <limits>
+#include <memory>
 #include <utility>
 
+#include "absl/numeric/bits.h"
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
 #include "src/core/util/time.h"
 #include "src/core/util/useful.h"
@@ -305,4 +307,211 @@ TimerList::TimerCheck(grpc_core::Timestamp* next) {
   return std::move(run);
 }
 
+namespace {
+constexpr int64_t kNoTimers = std::numeric_limits<int64_t>::max();
+}  // namespace
+
+TimerWheel::Shard::Shard(int64_t now)
+    : current_tick(now), min_deadline(kNoTimers) {}
+
+void TimerWheel::Shard::Add(Timer* timer) {
+  const int64_t deadline = timer->deadline;
+  size_t slot = kOverflowSlot;
+  if (deadline <= current_tick) {
+    slot = kExpiredSlot;
+  } else {
+    // Use the lowest level whose range, starting from the current tick's
+    // block on the level above, covers the deadline.
+    for (int level = 0; level < kNumLevels; ++level) {
+      const int parent_shift = (level + 1) * kLevelBits;
+      if ((deadline >> parent_shift) == (current_tick >> parent_shift)) {
+        const size_t index =
+            (deadline >> (level * kLevelBits)) & (kSlotsPerLevel - 1);
+        occupied[level] |= uint64_t{1} << index;
+        slot = level * kSlotsPerLevel + index;
+        break;
+      }
+    }
+  }
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = slots[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots[slot] = timer;
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  const size_t slot = timer->heap_index;
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots[slot] = timer->next;
+  }
+  if (slots[slot] == nullptr && slot < kExpiredSlot) {
+    occupied[slot / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (slot % kSlotsPerLevel));
+  }
+}
+
+void TimerWheel::Shard::Requeue(size_t slot) {
+  Timer* timer = slots[slot];
+  slots[slot] = nullptr;
+  if (slot < kExpiredSlot) {
+    occupied[slot / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (slot % kSlotsPerLevel));
+  }
+  while (timer != nullptr) {
+    Timer* next = timer->next;
+    Add(timer);
+    timer = next;
+  }
+}
+
+int64_t TimerWheel::Shard::NextTick() {
+  // Every occupied slot on a level comes after the current tick's slot, and
+  // lies within the current tick's block on the level above; so the first
+  // occupied slot on the lowest non-empty level is the next one due.
+  for (int level = 0; level < kNumLevels; ++level) {
+    const int shift = level * kLevelBits;
+    const size_t index = (current_tick >> shift) & (kSlotsPerLevel - 1);
+    const uint64_t later =
+        index == kSlotsPerLevel - 1
+            ? 0
+            : occupied[level] & (~uint64_t{0} << (index + 1));
+    if (later != 0) {
+      const int parent_shift = shift + kLevelBits;
+      return ((current_tick >> parent_shift) << parent_shift) +
+             (static_cast<int64_t>(absl::countr_zero(later)) << shift);
+    }
+  }
+  if (slots[kOverflowSlot] != nullptr) {
+    constexpr int kTopShift = kNumLevels * kLevelBits;
+    const int64_t top_block = current_tick >> kTopShift;
+    if (top_block < (kNoTimers >> kTopShift)) {
+      return (top_block + 1) << kTopShift;
+    }
+  }
+  return kNoTimers;
+}
+
+void TimerWheel::Shard::Advance(
+    int64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  for (int64_t tick = NextTick(); tick != kNoTimers && tick <= now;
+       tick = NextTick()) {
+    current_tick = tick;
+    if ((tick & ((int64_t{1} << (kNumLevels * kLevelBits)) - 1)) == 0) {
+      Requeue(kOverflowSlot);
+    }
+    // Cascade from the top, so that timers land in the slots below before
+    // those are looked at.
+    for (int level = kNumLevels - 1; level >= 0; --level) {
+      const int shift = level * kLevelBits;
+      if ((tick & ((int64_t{1} << shift) - 1)) != 0) continue;
+      const size_t index = (tick >> shift) & (kSlotsPerLevel - 1);
+      if ((occupied[level] & (uint64_t{1} << index)) != 0) {
+        Requeue(level * kSlotsPerLevel + index);
+      }
+    }
+  }
+  current_tick = std::max(current_tick, now);
+  for (Timer* timer = slots[kExpiredSlot]; timer != nullptr;
+       timer = timer->next) {
+    timer->pending = false;
+    out->push_back(timer->closure);
+  }
+  slots[kExpiredSlot] = nullptr;
+}
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(kNoTimers) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  shards_.reserve(num_shards_);
+  for (size_t i = 0; i < num_shards_; i++) {
+    shards_.push_back(std::make_unique<Shard>(now));
+  }
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard* shard = shards_[grpc_core::HashPointer(timer, num_shards_)].get();
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  bool is_first_timer = false;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    shard->Add(timer);
+    if (timer->deadline < shard->min_deadline) {
+      shard->min_deadline = timer->deadline;
+      is_first_timer = true;
+    }
+  }
+
+  // A TimerCheck that has already visited this shard holds mu_ until it has
+  // published its new min_timer_, so taking mu_ here orders this update
+  // after that one.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (timer->deadline < min_timer_.load(std::memory_order_relaxed)) {
+      min_timer_.store(timer->deadline, std::memory_order_relaxed);
+      host_->Kick();
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = shards_[grpc_core::HashPointer(timer, num_shards_)].get();
+  grpc_core::MutexLock lock(&shard->mu);
+  if (timer->pending) {
+    timer->pending = false;
+    shard->Remove(timer);
+    return true;
+  }
+  return false;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  int64_t min_timer = min_timer_.load(std::memory_order_relaxed);
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = std::min(
+          *next, grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                     min_timer));
+    }
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> done;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    min_timer = kNoTimers;
+    for (auto& shard : shards_) {
+      grpc_core::MutexLock shard_lock(&shard->mu);
+      shard->Advance(now, &done);
+      shard->min_deadline = shard->NextTick();
+      min_timer = std::min(min_timer, shard->min_deadline);
+    }
+    min_timer_.store(min_timer, std::memory_order_relaxed);
+  }
+  checker_mu_.Unlock();
+
+  if (next != nullptr) {
+    *next = std::min(
+        *next,
+        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(min_timer));
+  }
+  return std::move(done);
+}
+
 }  // namespace grpc_event_engine::experimental
@@ -66,26 +66,24 @@ class TimerListHost {
   ~TimerListHost() = default;
 };
 
-class TimerList {
+// Interface shared by the timer list implementations.
+class TimerListInterface {
  public:
-  explicit TimerList(TimerListHost* host);
-
-  TimerList(const TimerList&) = delete;
-  TimerList& operator=(const TimerList&) = delete;
+  virtual ~TimerListInterface() = default;
 
   // Initialize a Timer.
   // When expired, the closure will be run. If the timer is canceled, the
   // closure will not be run. Behavior is undefined for a deadline of
   // grpc_core::Timestamp::InfFuture().
-  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
-                 experimental::EventEngine::Closure* closure);
+  virtual void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                         experimental::EventEngine::Closure* closure) = 0;
 
   // Cancel a Timer.
   // Returns false if the timer cannot be canceled. This will happen if the
   // timer has already fired, or if its closure is currently running. The
   // closure is guaranteed to run eventually if this method returns false.
   // Otherwise, this returns true, and the closure will not be run.
-  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer);
+  GRPC_MUST_USE_RESULT virtual bool TimerCancel(Timer* timer) = 0;
 
   // Check for timers to be run, and return them.
   // Return nullopt if timers could not be checked due to contention with
@@ -96,8 +94,22 @@ class TimerList {
   // *next is never guaranteed to be updated on any given execution; however,
   // with high probability at least one thread in the system will see an update
   // at any time slice.
+  virtual std::optional<std::vector<experimental::EventEngine::Closure*>>
+  TimerCheck(grpc_core::Timestamp* next) = 0;
+};
+
+class TimerList final : public TimerListInterface {
+ public:
+  explicit TimerList(TimerListHost* host);
+
+  TimerList(const TimerList&) = delete;
+  TimerList& operator=(const TimerList&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
   std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
-      grpc_core::Timestamp* next);
+      grpc_core::Timestamp* next) override;
 
  private:
   // A "timer shard". Contains a 'heap' and a 'list' of timers. All timers with
@@ -157,6 +169,79 @@ class TimerList {
   const std::unique_ptr<Shard*[]> shard_queue_ ABSL_GUARDED_BY(mu_);
 };
 
+// A hierarchical timing wheel with a one millisecond tick.
+//
+// Level 0 has a slot per tick for the next 64 ticks, and each level above it
+// has 64 slots that are each as wide as the whole level below. Inserting and
+// cancelling a timer are O(1) list operations; timers are moved down a level
+// when the wheel reaches their slot, and those in a level 0 slot all expire
+// together. Timers beyond the top level are kept on an overflow list that is
+// reconsidered each time the top level wraps around.
+//
+// Like TimerList, timers are spread over shards by address so that timers
+// started and cancelled from different threads don't contend.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr size_t kSlotsPerLevel = size_t{1} << kLevelBits;
+  static constexpr int kNumLevels = 6;
+  // Timers that are due at the next TimerCheck.
+  static constexpr size_t kExpiredSlot = kNumLevels * kSlotsPerLevel;
+  // Timers beyond the range of the top level.
+  static constexpr size_t kOverflowSlot = kExpiredSlot + 1;
+  static constexpr size_t kNumSlots = kOverflowSlot + 1;
+
+  // A wheel. Timer::heap_index holds the slot a timer is in, and the slots
+  // are doubly linked lists through Timer::next and Timer::prev.
+  struct Shard {
+    explicit Shard(int64_t now);
+
+    void Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Re-add all the timers in a slot, relative to the current tick.
+    void Requeue(size_t slot) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // The next tick at which a slot needs processing, or the maximum int64_t
+    // if the wheel is empty. Timers in the expired slot are not considered.
+    int64_t NextTick() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Turn the wheel up to now, and move the timers that are due to the out.
+    void Advance(int64_t now,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // All timers with deadlines <= this tick are in the expired slot.
+    int64_t current_tick ABSL_GUARDED_BY(mu);
+    // A lower bound on the deadlines of the timers in this shard, as last
+    // reported to TimerWheel::min_timer_.
+    int64_t min_deadline ABSL_GUARDED_BY(mu);
+    // Bit i of occupied[level] is set iff slot i of that level is non-empty.
+    uint64_t occupied[kNumLevels] ABSL_GUARDED_BY(mu) = {};
+    Timer* slots[kNumSlots] ABSL_GUARDED_BY(mu) = {};
+  };
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  // Held while min_timer_ is recomputed from the shards.
+  grpc_core::Mutex mu_;
+  // A lower bound on the deadline of the next timer due across all shards.
+  std::atomic<int64_t> min_timer_;
+  // Allow only one TimerCheck to turn the wheels at once.
+  grpc_core::Mutex checker_mu_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
 }  // namespace grpc_event_engine::experimental
 
 #endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_H
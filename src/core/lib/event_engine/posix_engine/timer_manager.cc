@@ -29,6 +29,7 @@
 #include "absl/log/log.h"
 #include "absl/time/time.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 
 static thread_local bool g_timer_thread;
 
@@ -85,7 +86,11 @@ bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 TimerManager::TimerManager(
     std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
     : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  if (grpc_core::IsPosixEeTimerWheelEnabled()) {
+    timer_list_ = std::make_unique<TimerWheel>(&host_);
+  } else {
+    timer_list_ = std::make_unique<TimerList>(&host_);
+  }
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
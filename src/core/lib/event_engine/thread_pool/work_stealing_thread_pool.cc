@@ -20,31 +20,49 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/thd_id.h>
 #include <inttypes.h>
+#include <stdio.h>
 
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/mpmc_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
 #include "src/core/util/examine_stack.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/strerror.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #ifdef GPR_POSIX_SYNC
 #include <csignal>
 #elif defined(GPR_WINDOWS)
@@ -162,6 +180,69 @@ void DumpSignalHandler(int /* sig */) {
   grpc_core::Thread::Kill(gpr_thd_currentid());
 }
 
+#ifdef GPR_LINUX
+// Returns the contents of a (small) sysfs file.
+std::optional<std::string> ReadSysfsFile(const std::string& path) {
+  FILE* file = fopen(path.c_str(), "r");
+  if (file == nullptr) return std::nullopt;
+  char buf[4096];
+  size_t n = fread(buf, 1, sizeof(buf), file);
+  fclose(file);
+  return std::string(buf, n);
+}
+#endif
+
+WorkStealingThreadPool::NumaTopology ReadNumaTopology() {
+  WorkStealingThreadPool::NumaTopology topology;
+#ifdef GPR_LINUX
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  const bool have_mask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+  std::optional<std::vector<int>> nodes;
+  if (auto online = ReadSysfsFile("/sys/devices/system/node/online")) {
+    nodes = WorkStealingThreadPool::NumaTopology::ParseCpuList(*online);
+  }
+  for (int node : nodes.value_or(std::vector<int>())) {
+    auto list = ReadSysfsFile(
+        absl::StrCat("/sys/devices/system/node/node", node, "/cpulist"));
+    if (!list.has_value()) continue;
+    auto cpus = WorkStealingThreadPool::NumaTopology::ParseCpuList(*list);
+    if (!cpus.has_value()) continue;
+    std::vector<int> usable;
+    for (int cpu : *cpus) {
+      if (cpu < CPU_SETSIZE && (!have_mask || CPU_ISSET(cpu, &allowed))) {
+        usable.push_back(cpu);
+      }
+    }
+    // Nodes with only memory, or none of our CPUs, get no workers.
+    if (!usable.empty()) topology.node_cpus.push_back(std::move(usable));
+  }
+#endif
+  if (topology.node_cpus.empty()) topology.node_cpus.emplace_back();
+  return topology;
+}
+
+// Restrict the calling thread to the CPUs of a NUMA node.
+void PinThreadToNode(const WorkStealingThreadPool::NumaTopology& topology,
+                     size_t node) {
+#ifdef GPR_LINUX
+  const std::vector<int>& cpus = topology.node_cpus[node];
+  if (cpus.empty()) return;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) CPU_SET(cpu, &set);
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  if (err != 0) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "Failed to pin thread pool worker to NUMA node " << node << ": "
+        << grpc_core::StrError(err);
+  }
+#else
+  (void)topology;
+  (void)node;
+#endif
+}
+
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
@@ -191,24 +272,60 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
   pool_->Run(closure);
 }
 
+// -------- WorkStealingThreadPool::NumaTopology --------
+
+const WorkStealingThreadPool::NumaTopology&
+WorkStealingThreadPool::NumaTopology::Get() {
+  static const grpc_core::NoDestruct<NumaTopology> topology(ReadNumaTopology());
+  return *topology;
+}
+
+std::optional<std::vector<int>>
+WorkStealingThreadPool::NumaTopology::ParseCpuList(absl::string_view list) {
+  std::vector<int> cpus;
+  list = absl::StripAsciiWhitespace(list);
+  if (list.empty()) return cpus;
+  for (absl::string_view range : absl::StrSplit(list, ',')) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(bounds.first, &first)) return std::nullopt;
+    if (range.find('-') == absl::string_view::npos) {
+      last = first;
+    } else if (!absl::SimpleAtoi(bounds.second, &last)) {
+      return std::nullopt;
+    }
+    if (first < 0 || last < first) return std::nullopt;
+    for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
+void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue,
+                                                   size_t node) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+  queues_[node].emplace(queue);
 }
 
-void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
+void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue,
+                                                     size_t node) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+  queues_[node].erase(queue);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne(
+    size_t node) {
   grpc_core::MutexLock lock(&mu_);
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
-    if (closure != nullptr) return closure;
+  // Cross-node theft is the last resort.
+  for (size_t i = 0; i < queues_.size(); ++i) {
+    for (auto* queue : queues_[(node + i) % queues_.size()]) {
+      closure = steal_oldest_ ? queue->PopOldest() : queue->PopMostRecent();
+      if (closure != nullptr) return closure;
+    }
   }
   return nullptr;
 }
@@ -223,7 +340,24 @@ void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
     size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    : reserve_threads_(reserve_threads),
+      numa_topology_(grpc_core::IsWorkStealingNumaAffinityEnabled() &&
+                             NumaTopology::Get().num_nodes() > 1
+                         ? &NumaTopology::Get()
+                         : nullptr),
+      use_lock_free_queues_(grpc_core::IsWorkStealingLockFreeQueuesEnabled()),
+      theft_registry_(
+          numa_topology_ == nullptr ? 1 : numa_topology_->num_nodes(),
+          use_lock_free_queues_),
+      queue_(use_lock_free_queues_
+                 ? std::unique_ptr<WorkQueue>(new MpmcWorkQueue(this))
+                 : std::unique_ptr<WorkQueue>(new BasicWorkQueue(this))) {}
+
+std::unique_ptr<WorkQueue>
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::MakeLocalQueue() {
+  if (use_lock_free_queues_) return std::make_unique<ChaseLevWorkQueue>(this);
+  return std::make_unique<BasicWorkQueue>(this);
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -239,13 +373,19 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
-    queue_.Add(closure);
+    queue_->Add(closure);
   }
   // Signal a worker in any case, even if work was added to a local queue. This
   // improves performance on 32-core streaming benchmarks with small payloads.
   work_signal_.Signal();
 }
 
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::NextNode() {
+  if (numa_topology_ == nullptr) return 0;
+  return next_node_.fetch_add(1, std::memory_order_relaxed) %
+         numa_topology_->num_nodes();
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
   last_started_thread_.store(
       grpc_core::Timestamp::Now().milliseconds_after_process_epoch(),
@@ -277,7 +417,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
     DumpStacksAndCrash();
   }
-  CHECK(queue_.Empty());
+  CHECK(queue_->Empty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -430,7 +570,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->queue_->Empty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
@@ -470,7 +610,8 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      node_(pool_->NextNode()) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -481,8 +622,11 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
-  g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  if (pool_->numa_topology() != nullptr) {
+    PinThreadToNode(*pool_->numa_topology(), node_);
+  }
+  g_local_queue = pool_->MakeLocalQueue().release();
+  pool_->theft_registry()->Enroll(g_local_queue, node_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -501,7 +645,7 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->theft_registry()->Unenroll(g_local_queue, node_);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -543,7 +687,7 @@ bool WorkStealingThreadPool::ThreadState::Step() {
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->theft_registry()->StealOne(node_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
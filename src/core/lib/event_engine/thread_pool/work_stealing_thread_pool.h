@@ -26,13 +26,15 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
-#include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/notification.h"
@@ -59,6 +61,22 @@ class WorkStealingThreadPool final : public ThreadPool {
   void PostforkParent() override;
   void PostforkChild() override;
 
+  // The NUMA nodes that this process can run on, and their CPUs.
+  struct NumaTopology {
+    // The CPUs of each node, limited to those in the process's affinity mask.
+    // Hosts without NUMA information are reported as a single node with no
+    // CPUs listed.
+    std::vector<std::vector<int>> node_cpus;
+
+    size_t num_nodes() const { return node_cpus.size(); }
+
+    // The topology of this host, read once from sysfs on Linux.
+    static const NumaTopology& Get();
+    // Parses a sysfs cpulist, e.g. "0-3,8,10-11". Returns nullopt if the list
+    // is malformed.
+    static std::optional<std::vector<int>> ParseCpuList(absl::string_view list);
+  };
+
  private:
   // A basic communication mechanism to signal waiting threads that work is
   // available.
@@ -78,20 +96,26 @@ class WorkStealingThreadPool final : public ThreadPool {
   //
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
-  // unavailable.
+  // unavailable. Queues are grouped by the NUMA node of their thread, and
+  // thieves look on their own node before trying the others.
   class TheftRegistry {
    public:
+    // If steal_oldest is set, thieves take the oldest closure of a queue
+    // rather than the most recent one, as ChaseLevWorkQueue requires.
+    TheftRegistry(size_t num_nodes, bool steal_oldest)
+        : steal_oldest_(steal_oldest), queues_(num_nodes) {}
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Enroll(WorkQueue* queue, size_t node) ABSL_LOCKS_EXCLUDED(mu_);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
-    // Returns one closure from another thread, or nullptr if none are
-    // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue, size_t node) ABSL_LOCKS_EXCLUDED(mu_);
+    // Returns one closure from another thread, preferably one on the given
+    // node, or nullptr if none are available.
+    EventEngine::Closure* StealOne(size_t node) ABSL_LOCKS_EXCLUDED(mu_);
 
    private:
+    const bool steal_oldest_;
     grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    std::vector<absl::flat_hash_set<WorkQueue*>> queues_ ABSL_GUARDED_BY(mu_);
   };
 
   // An implementation of the ThreadPool
@@ -137,10 +161,17 @@ class WorkStealingThreadPool final : public ThreadPool {
     bool IsForking();
     bool IsQuiesced();
     size_t reserve_threads() { return reserve_threads_; }
+    // The NUMA topology workers are spread over, or nullptr if workers are not
+    // NUMA aware.
+    const NumaTopology* numa_topology() { return numa_topology_; }
+    // The node the next worker should run on, round robin.
+    size_t NextNode();
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
-    WorkQueue* queue() { return &queue_; }
+    WorkQueue* queue() { return queue_.get(); }
+    // Create the thread-local queue for a new worker thread.
+    std::unique_ptr<WorkQueue> MakeLocalQueue();
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -171,10 +202,13 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const NumaTopology* const numa_topology_;
+    std::atomic<size_t> next_node_{0};
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
+    const bool use_lock_free_queues_;
     TheftRegistry theft_registry_;
-    BasicWorkQueue queue_;
+    const std::unique_ptr<WorkQueue> queue_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -214,6 +248,7 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    const size_t node_;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
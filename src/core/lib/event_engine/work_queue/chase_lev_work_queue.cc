@@ -0,0 +1,111 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "src/core/lib/event_engine/common_closures.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+constexpr size_t kInitialBufferSize = 64;
+}  // namespace
+
+ChaseLevWorkQueue::ChaseLevWorkQueue(void* owner) : owner_(owner) {
+  buffers_.push_back(std::make_unique<Buffer>(kInitialBufferSize));
+  buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+}
+
+bool ChaseLevWorkQueue::Empty() const { return Size() == 0; }
+
+size_t ChaseLevWorkQueue::Size() const {
+  int64_t bottom = bottom_.load(std::memory_order_acquire);
+  int64_t top = top_.load(std::memory_order_acquire);
+  return static_cast<size_t>(std::max<int64_t>(bottom - top, 0));
+}
+
+ChaseLevWorkQueue::Buffer* ChaseLevWorkQueue::Grow(Buffer* buffer, int64_t top,
+                                                   int64_t bottom) {
+  auto grown = std::make_unique<Buffer>(buffer->size() * 2);
+  for (int64_t i = top; i < bottom; ++i) {
+    grown->at(i).store(buffer->at(i).load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+  }
+  Buffer* result = grown.get();
+  buffers_.push_back(std::move(grown));
+  buffer_.store(result, std::memory_order_release);
+  return result;
+}
+
+void ChaseLevWorkQueue::Add(EventEngine::Closure* closure) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_acquire);
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top > static_cast<int64_t>(buffer->size()) - 1) {
+    buffer = Grow(buffer, top, bottom);
+  }
+  buffer->at(bottom).store(closure, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+void ChaseLevWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopMostRecent() {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t top = top_.load(std::memory_order_relaxed);
+  if (top > bottom) {
+    // Empty.
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  EventEngine::Closure* closure =
+      buffer->at(bottom).load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // The last element: race the thieves for it.
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      closure = nullptr;
+    }
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopOldest() {
+  int64_t top = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t bottom = bottom_.load(std::memory_order_acquire);
+  if (top >= bottom) return nullptr;
+  Buffer* buffer = buffer_.load(std::memory_order_acquire);
+  EventEngine::Closure* closure =
+      buffer->at(top).load(std::memory_order_relaxed);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    // Lost to the owner or another thief.
+    return nullptr;
+  }
+  return closure;
+}
+
+}  // namespace grpc_event_engine::experimental
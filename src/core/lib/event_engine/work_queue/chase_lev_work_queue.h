@@ -0,0 +1,90 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+
+namespace grpc_event_engine::experimental {
+
+// A lock-free work-stealing deque (Chase & Lev, "Dynamic Circular
+// Work-Stealing Deque", with the memory orderings from Lê et al., "Correct and
+// Efficient Work-Stealing for Weak Memory Models").
+//
+// The queue has a single owner thread that adds closures and takes the most
+// recent one back, and any number of thieves that take the oldest.
+//  * Add and PopMostRecent must only be called from the owner thread.
+//  * PopOldest, Empty and Size may be called from any thread.
+// The buffer grows as needed. Outgrown buffers are kept until the queue is
+// destroyed, since a thief may still be reading from one.
+class ChaseLevWorkQueue : public WorkQueue {
+ public:
+  ChaseLevWorkQueue() : ChaseLevWorkQueue(nullptr) {}
+  explicit ChaseLevWorkQueue(void* owner);
+  // Returns whether the queue is empty. Racy if called by a thief.
+  bool Empty() const override;
+  // Returns the size of the queue. Racy if called by a thief.
+  size_t Size() const override;
+  // Returns the most recent element from the queue. Owner only.
+  EventEngine::Closure* PopMostRecent() override;
+  // Steals the oldest element from the queue, or returns nullptr if it is
+  // empty or another thread got to it first.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue. Owner only.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue. Owner only.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  // A circular buffer of closures, indexed modulo its power of two size.
+  struct Buffer {
+    explicit Buffer(size_t size)
+        : mask(size - 1),
+          closures(new std::atomic<EventEngine::Closure*>[size]) {}
+    std::atomic<EventEngine::Closure*>& at(int64_t i) {
+      return closures[static_cast<size_t>(i) & mask];
+    }
+    size_t size() const { return mask + 1; }
+
+    const size_t mask;
+    const std::unique_ptr<std::atomic<EventEngine::Closure*>[]> closures;
+  };
+
+  // Replace the buffer with one twice the size, holding elements [top,
+  // bottom). Owner only.
+  Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  // The index thieves take from.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+  // The index the owner adds at.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_;
+  // All buffers this queue has used, including the current one. Owner only.
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+  const void* const owner_ = nullptr;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
@@ -0,0 +1,141 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/mpmc_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/numeric/bits.h"
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+// The most closures moved from the overflow queue back into the ring per pop.
+constexpr size_t kRefillBatchSize = 16;
+}  // namespace
+
+MpmcWorkQueue::MpmcWorkQueue(void* owner, size_t capacity)
+    : mask_(absl::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+      cells_(new Cell[mask_ + 1]),
+      owner_(owner) {
+  for (size_t i = 0; i <= mask_; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool MpmcWorkQueue::Empty() const { return Size() == 0; }
+
+size_t MpmcWorkQueue::Size() const {
+  size_t dequeue_pos = dequeue_pos_.load(std::memory_order_relaxed);
+  size_t enqueue_pos = enqueue_pos_.load(std::memory_order_relaxed);
+  // Positions claimed but not yet filled or emptied still count.
+  size_t in_ring = enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+  return in_ring + overflow_size_.load(std::memory_order_relaxed);
+}
+
+bool MpmcWorkQueue::TryPush(EventEngine::Closure* closure) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  while (true) {
+    cell = &cells_[pos & mask_];
+    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(sequence) -
+                    static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Full.
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  cell->closure.store(closure, std::memory_order_relaxed);
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+EventEngine::Closure* MpmcWorkQueue::TryPop() {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  while (true) {
+    cell = &cells_[pos & mask_];
+    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(sequence) -
+                    static_cast<intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Empty.
+      return nullptr;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  EventEngine::Closure* closure =
+      cell->closure.load(std::memory_order_relaxed);
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return closure;
+}
+
+void MpmcWorkQueue::RefillFromOverflow() {
+  grpc_core::MutexLock lock(&overflow_mu_);
+  for (size_t i = 0; i < kRefillBatchSize && !overflow_.empty(); ++i) {
+    if (!TryPush(overflow_.front())) return;
+    overflow_.pop_front();
+    overflow_size_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+EventEngine::Closure* MpmcWorkQueue::Pop() {
+  EventEngine::Closure* closure = TryPop();
+  if (overflow_size_.load(std::memory_order_relaxed) != 0) {
+    RefillFromOverflow();
+    if (closure == nullptr) closure = TryPop();
+  }
+  return closure;
+}
+
+EventEngine::Closure* MpmcWorkQueue::PopMostRecent() { return Pop(); }
+
+EventEngine::Closure* MpmcWorkQueue::PopOldest() { return Pop(); }
+
+void MpmcWorkQueue::Add(EventEngine::Closure* closure) {
+  // Once closures have spilled over, keep adding behind them until the ring
+  // has taken them back.
+  if (overflow_size_.load(std::memory_order_relaxed) == 0 &&
+      TryPush(closure)) {
+    return;
+  }
+  grpc_core::MutexLock lock(&overflow_mu_);
+  overflow_.push_back(closure);
+  overflow_size_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MpmcWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+}  // namespace grpc_event_engine::experimental
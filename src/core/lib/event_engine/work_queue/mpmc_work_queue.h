@@ -0,0 +1,86 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_MPMC_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_MPMC_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+// A WorkQueue for many producers and many consumers, built on a bounded
+// lock-free ring (D. Vyukov's bounded MPMC queue).
+//
+// Closures come out in roughly the order they went in: both PopMostRecent and
+// PopOldest return the oldest closure in the ring. If the ring fills up,
+// further closures spill to a mutex-guarded overflow queue, which is moved
+// back into the ring as consumers make room.
+class MpmcWorkQueue : public WorkQueue {
+ public:
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  MpmcWorkQueue() : MpmcWorkQueue(nullptr) {}
+  // capacity is rounded up to a power of two.
+  explicit MpmcWorkQueue(void* owner, size_t capacity = kDefaultCapacity);
+  // Returns whether the queue is empty.
+  bool Empty() const override;
+  // Returns the approximate size of the queue.
+  size_t Size() const override;
+  // Returns the oldest element from the queue, or nullptr if it is empty.
+  EventEngine::Closure* PopMostRecent() override;
+  // Returns the oldest element from the queue, or nullptr if it is empty.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  struct Cell {
+    // Equal to the enqueue position this cell is ready for when it's free,
+    // and one past the position it was filled at when it holds a closure.
+    std::atomic<size_t> sequence;
+    std::atomic<EventEngine::Closure*> closure;
+  };
+
+  bool TryPush(EventEngine::Closure* closure);
+  EventEngine::Closure* TryPop();
+  // Move closures from the overflow queue into the ring while there's room.
+  void RefillFromOverflow();
+  EventEngine::Closure* Pop();
+
+  const size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+  alignas(GPR_CACHELINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+  alignas(GPR_CACHELINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+  // Closures that didn't fit in the ring, and how many there are.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<size_t> overflow_size_{0};
+  grpc_core::Mutex overflow_mu_;
+  std::deque<EventEngine::Closure*> overflow_ ABSL_GUARDED_BY(overflow_mu_);
+  const void* const owner_ = nullptr;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_MPMC_WORK_QUEUE_H
@@ -23,6 +23,11 @@
 
 #if defined(GRPC_CFSTREAM)
 namespace {
+const char* const description_arena_block_cache =
+    "Back call arenas and their zones with blocks from a per-cpu cache, so "
+    "that a finished call's arena memory is reused by the next call instead of "
+    "being freed.";
+const char* const additional_constraints_arena_block_cache = "{}";
 const char* const description_backoff_cap_initial_at_max =
     "Backoff library applies max_backoff even on initial_backoff.";
 const char* const additional_constraints_backoff_cap_initial_at_max = "{}";
@@ -38,6 +43,14 @@ const char* const additional_constraints_callv3_client_auth_filter = "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_combiner_batch_drain =
+    "When a contended combiner would offload its queue, keep draining it on "
+    "the current thread until a closure or time budget is spent.";
+const char* const additional_constraints_combiner_batch_drain = "{}";
+const char* const description_cq_next_adaptive_spin =
+    "Before grpc_completion_queue_next polls, spin on the queue for a budget "
+    "derived from the recent time between its events.";
+const char* const additional_constraints_cq_next_adaptive_spin = "{}";
 const char* const description_disable_buffer_hint_on_high_memory_pressure =
     "Disable buffer hint flag parsing in the transport under high memory "
     "pressure.";
@@ -63,9 +76,22 @@ const char* const additional_constraints_event_engine_callback_cq = "{}";
 const uint8_t required_experiments_event_engine_callback_cq[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_fork_keeps_resolver_result =
+    "In a forked child, keep the resolver result, service config and LB config "
+    "that channels carried over from the parent, and reconnect without first "
+    "re-resolving.";
+const char* const additional_constraints_fork_keeps_resolver_result = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_encoder_contiguous_output =
+    "Pack the small pieces of an encoded header block (prefixes, short keys "
+    "and values) into shared contiguous blocks rather than a slice each.";
+const char* const additional_constraints_hpack_encoder_contiguous_output = "{}";
+const char* const description_hugepage_slice_slabs =
+    "Serve large MemoryAllocator::MakeSlice buffers from 2MB slabs backed by "
+    "huge pages.";
+const char* const additional_constraints_hugepage_slice_slabs = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -85,13 +111,27 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_per_cpu_memory_quota =
+    "Cache free quota bytes per cpu so that allocators on different cores "
+    "don't contend on a single counter when taking from and returning to a "
+    "MemoryQuota.";
+const char* const additional_constraints_per_cpu_memory_quota = "{}";
 const char* const description_pick_first_new =
     "New pick_first impl with memory reduction.";
 const char* const additional_constraints_pick_first_new = "{}";
+const char* const description_posix_ee_inline_fd_callbacks =
+    "Run the fd readiness callbacks found by a PosixEventEngine poller on the "
+    "thread that polled them, after handing polling over to another thread, "
+    "instead of queueing them on the thread pool.";
+const char* const additional_constraints_posix_ee_inline_fd_callbacks = "{}";
 const char* const description_posix_ee_skip_grpc_init =
     "Prevent the PosixEventEngine from calling grpc_init & grpc_shutdown on "
     "creation and destruction.";
 const char* const additional_constraints_posix_ee_skip_grpc_init = "{}";
+const char* const description_posix_ee_timer_wheel =
+    "Keep PosixEventEngine timers in a hierarchical timing wheel instead of "
+    "the sharded timer heap.";
+const char* const additional_constraints_posix_ee_timer_wheel = "{}";
 const char* const description_promise_based_http2_client_transport =
     "Use promises for the http2 client transport. We have kept client and "
     "server transport experiments separate to help with smoother roll outs and "
@@ -120,6 +160,11 @@ const char* const additional_constraints_schedule_cancellation_over_write =
 const char* const description_server_listener =
     "If set, the new server listener classes are used.";
 const char* const additional_constraints_server_listener = "{}";
+const char* const description_shared_ares_resolver =
+    "Share one c-ares resolver, and so one c-ares channel and its nameserver "
+    "sockets, between all the DNS resolvers a PosixEventEngine hands out for "
+    "the same DNS server.";
+const char* const additional_constraints_shared_ares_resolver = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -129,15 +174,39 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_token_fetcher_proactive_refresh =
+    "Refresh the tokens of TokenFetcherCredentials in the background, part way "
+    "through their lifetime, and share them between credentials with the same "
+    "configuration.";
+const char* const additional_constraints_token_fetcher_proactive_refresh = "{}";
+const char* const description_tsc_clock =
+    "Read Timestamp::Now() from the CPU's invariant timestamp counter, "
+    "calibrated against and periodically re-synced to the monotonic clock, "
+    "instead of calling clock_gettime.";
+const char* const additional_constraints_tsc_clock = "{}";
 const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_work_serializer_urgent_lane =
+    "Let WorkSerializer run urgent callbacks, such as subchannel connectivity "
+    "state changes, ahead of callbacks that were queued before them.";
+const char* const additional_constraints_work_serializer_urgent_lane = "{}";
+const char* const description_work_stealing_lock_free_queues =
+    "Back the EventEngine thread pool with lock-free work queues, a Chase-Lev "
+    "deque per worker and a bounded MPMC ring for the global queue.";
+const char* const additional_constraints_work_stealing_lock_free_queues = "{}";
+const char* const description_work_stealing_numa_affinity =
+    "Group EventEngine thread pool workers by NUMA node, pin them to their "
+    "node's CPUs, and steal work from the same node before other nodes.";
+const char* const additional_constraints_work_stealing_numa_affinity = "{}";
 }  // namespace
 
 namespace grpc_core {
 
 const ExperimentMetadata g_experiment_metadata[] = {
+    {"arena_block_cache", description_arena_block_cache,
+     additional_constraints_arena_block_cache, nullptr, 0, false, true},
     {"backoff_cap_initial_at_max", description_backoff_cap_initial_at_max,
      additional_constraints_backoff_cap_initial_at_max, nullptr, 0, true, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
@@ -149,6 +218,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, false,
      true},
+    {"combiner_batch_drain", description_combiner_batch_drain,
+     additional_constraints_combiner_batch_drain, nullptr, 0, false, true},
+    {"cq_next_adaptive_spin", description_cq_next_adaptive_spin,
+     additional_constraints_cq_next_adaptive_spin, nullptr, 0, false, true},
     {"disable_buffer_hint_on_high_memory_pressure",
      description_disable_buffer_hint_on_high_memory_pressure,
      additional_constraints_disable_buffer_hint_on_high_memory_pressure,
@@ -166,8 +239,17 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"event_engine_callback_cq", description_event_engine_callback_cq,
      additional_constraints_event_engine_callback_cq,
      required_experiments_event_engine_callback_cq, 2, true, true},
+    {"fork_keeps_resolver_result", description_fork_keeps_resolver_result,
+     additional_constraints_fork_keeps_resolver_result, nullptr, 0, false,
+     true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_encoder_contiguous_output",
+     description_hpack_encoder_contiguous_output,
+     additional_constraints_hpack_encoder_contiguous_output, nullptr, 0, false,
+     true},
+    {"hugepage_slice_slabs", description_hugepage_slice_slabs,
+     additional_constraints_hugepage_slice_slabs, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -179,10 +261,17 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"per_cpu_memory_quota", description_per_cpu_memory_quota,
+     additional_constraints_per_cpu_memory_quota, nullptr, 0, false, true},
     {"pick_first_new", description_pick_first_new,
      additional_constraints_pick_first_new, nullptr, 0, true, true},
+    {"posix_ee_inline_fd_callbacks", description_posix_ee_inline_fd_callbacks,
+     additional_constraints_posix_ee_inline_fd_callbacks, nullptr, 0, false,
+     true},
     {"posix_ee_skip_grpc_init", description_posix_ee_skip_grpc_init,
      additional_constraints_posix_ee_skip_grpc_init, nullptr, 0, false, true},
+    {"posix_ee_timer_wheel", description_posix_ee_timer_wheel,
+     additional_constraints_posix_ee_timer_wheel, nullptr, 0, false, true},
     {"promise_based_http2_client_transport",
      description_promise_based_http2_client_transport,
      additional_constraints_promise_based_http2_client_transport, nullptr, 0,
@@ -205,20 +294,43 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true},
     {"server_listener", description_server_listener,
      additional_constraints_server_listener, nullptr, 0, true, true},
+    {"shared_ares_resolver", description_shared_ares_resolver,
+     additional_constraints_shared_ares_resolver, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"token_fetcher_proactive_refresh",
+     description_token_fetcher_proactive_refresh,
+     additional_constraints_token_fetcher_proactive_refresh, nullptr, 0, false,
+     true},
+    {"tsc_clock", description_tsc_clock, additional_constraints_tsc_clock,
+     nullptr, 0, false, true},
     {"unconstrained_max_quota_buffer_size",
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"work_serializer_urgent_lane", description_work_serializer_urgent_lane,
+     additional_constraints_work_serializer_urgent_lane, nullptr, 0, false,
+     true},
+    {"work_stealing_lock_free_queues",
+     description_work_stealing_lock_free_queues,
+     additional_constraints_work_stealing_lock_free_queues, nullptr, 0, false,
+     true},
+    {"work_stealing_numa_affinity", description_work_stealing_numa_affinity,
+     additional_constraints_work_stealing_numa_affinity, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
 
 #elif defined(GPR_WINDOWS)
 namespace {
+const char* const description_arena_block_cache =
+    "Back call arenas and their zones with blocks from a per-cpu cache, so "
+    "that a finished call's arena memory is reused by the next call instead of "
+    "being freed.";
+const char* const additional_constraints_arena_block_cache = "{}";
 const char* const description_backoff_cap_initial_at_max =
     "Backoff library applies max_backoff even on initial_backoff.";
 const char* const additional_constraints_backoff_cap_initial_at_max = "{}";
@@ -234,6 +346,14 @@ const char* const additional_constraints_callv3_client_auth_filter = "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_combiner_batch_drain =
+    "When a contended combiner would offload its queue, keep draining it on "
+    "the current thread until a closure or time budget is spent.";
+const char* const additional_constraints_combiner_batch_drain = "{}";
+const char* const description_cq_next_adaptive_spin =
+    "Before grpc_completion_queue_next polls, spin on the queue for a budget "
+    "derived from the recent time between its events.";
+const char* const additional_constraints_cq_next_adaptive_spin = "{}";
 const char* const description_disable_buffer_hint_on_high_memory_pressure =
     "Disable buffer hint flag parsing in the transport under high memory "
     "pressure.";
@@ -259,9 +379,22 @@ const char* const additional_constraints_event_engine_callback_cq = "{}";
 const uint8_t required_experiments_event_engine_callback_cq[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_fork_keeps_resolver_result =
+    "In a forked child, keep the resolver result, service config and LB config "
+    "that channels carried over from the parent, and reconnect without first "
+    "re-resolving.";
+const char* const additional_constraints_fork_keeps_resolver_result = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_encoder_contiguous_output =
+    "Pack the small pieces of an encoded header block (prefixes, short keys "
+    "and values) into shared contiguous blocks rather than a slice each.";
+const char* const additional_constraints_hpack_encoder_contiguous_output = "{}";
+const char* const description_hugepage_slice_slabs =
+    "Serve large MemoryAllocator::MakeSlice buffers from 2MB slabs backed by "
+    "huge pages.";
+const char* const additional_constraints_hugepage_slice_slabs = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -281,13 +414,27 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_per_cpu_memory_quota =
+    "Cache free quota bytes per cpu so that allocators on different cores "
+    "don't contend on a single counter when taking from and returning to a "
+    "MemoryQuota.";
+const char* const additional_constraints_per_cpu_memory_quota = "{}";
 const char* const description_pick_first_new =
     "New pick_first impl with memory reduction.";
 const char* const additional_constraints_pick_first_new = "{}";
+const char* const description_posix_ee_inline_fd_callbacks =
+    "Run the fd readiness callbacks found by a PosixEventEngine poller on the "
+    "thread that polled them, after handing polling over to another thread, "
+    "instead of queueing them on the thread pool.";
+const char* const additional_constraints_posix_ee_inline_fd_callbacks = "{}";
 const char* const description_posix_ee_skip_grpc_init =
     "Prevent the PosixEventEngine from calling grpc_init & grpc_shutdown on "
     "creation and destruction.";
 const char* const additional_constraints_posix_ee_skip_grpc_init = "{}";
+const char* const description_posix_ee_timer_wheel =
+    "Keep PosixEventEngine timers in a hierarchical timing wheel instead of "
+    "the sharded timer heap.";
+const char* const additional_constraints_posix_ee_timer_wheel = "{}";
 const char* const description_promise_based_http2_client_transport =
     "Use promises for the http2 client transport. We have kept client and "
     "server transport experiments separate to help with smoother roll outs and "
@@ -316,6 +463,11 @@ const char* const additional_constraints_schedule_cancellation_over_write =
 const char* const description_server_listener =
     "If set, the new server listener classes are used.";
 const char* const additional_constraints_server_listener = "{}";
+const char* const description_shared_ares_resolver =
+    "Share one c-ares resolver, and so one c-ares channel and its nameserver "
+    "sockets, between all the DNS resolvers a PosixEventEngine hands out for "
+    "the same DNS server.";
+const char* const additional_constraints_shared_ares_resolver = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -325,15 +477,39 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_token_fetcher_proactive_refresh =
+    "Refresh the tokens of TokenFetcherCredentials in the background, part way "
+    "through their lifetime, and share them between credentials with the same "
+    "configuration.";
+const char* const additional_constraints_token_fetcher_proactive_refresh = "{}";
+const char* const description_tsc_clock =
+    "Read Timestamp::Now() from the CPU's invariant timestamp counter, "
+    "calibrated against and periodically re-synced to the monotonic clock, "
+    "instead of calling clock_gettime.";
+const char* const additional_constraints_tsc_clock = "{}";
 const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_work_serializer_urgent_lane =
+    "Let WorkSerializer run urgent callbacks, such as subchannel connectivity "
+    "state changes, ahead of callbacks that were queued before them.";
+const char* const additional_constraints_work_serializer_urgent_lane = "{}";
+const char* const description_work_stealing_lock_free_queues =
+    "Back the EventEngine thread pool with lock-free work queues, a Chase-Lev "
+    "deque per worker and a bounded MPMC ring for the global queue.";
+const char* const additional_constraints_work_stealing_lock_free_queues = "{}";
+const char* const description_work_stealing_numa_affinity =
+    "Group EventEngine thread pool workers by NUMA node, pin them to their "
+    "node's CPUs, and steal work from the same node before other nodes.";
+const char* const additional_constraints_work_stealing_numa_affinity = "{}";
 }  // namespace
 
 namespace grpc_core {
 
 const ExperimentMetadata g_experiment_metadata[] = {
+    {"arena_block_cache", description_arena_block_cache,
+     additional_constraints_arena_block_cache, nullptr, 0, false, true},
     {"backoff_cap_initial_at_max", description_backoff_cap_initial_at_max,
      additional_constraints_backoff_cap_initial_at_max, nullptr, 0, true, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
@@ -345,6 +521,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, false,
      true},
+    {"combiner_batch_drain", description_combiner_batch_drain,
+     additional_constraints_combiner_batch_drain, nullptr, 0, false, true},
+    {"cq_next_adaptive_spin", description_cq_next_adaptive_spin,
+     additional_constraints_cq_next_adaptive_spin, nullptr, 0, false, true},
     {"disable_buffer_hint_on_high_memory_pressure",
      description_disable_buffer_hint_on_high_memory_pressure,
      additional_constraints_disable_buffer_hint_on_high_memory_pressure,
@@ -362,8 +542,17 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"event_engine_callback_cq", description_event_engine_callback_cq,
      additional_constraints_event_engine_callback_cq,
      required_experiments_event_engine_callback_cq, 2, true, true},
+    {"fork_keeps_resolver_result", description_fork_keeps_resolver_result,
+     additional_constraints_fork_keeps_resolver_result, nullptr, 0, false,
+     true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_encoder_contiguous_output",
+     description_hpack_encoder_contiguous_output,
+     additional_constraints_hpack_encoder_contiguous_output, nullptr, 0, false,
+     true},
+    {"hugepage_slice_slabs", description_hugepage_slice_slabs,
+     additional_constraints_hugepage_slice_slabs, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -375,10 +564,17 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"per_cpu_memory_quota", description_per_cpu_memory_quota,
+     additional_constraints_per_cpu_memory_quota, nullptr, 0, false, true},
     {"pick_first_new", description_pick_first_new,
      additional_constraints_pick_first_new, nullptr, 0, true, true},
+    {"posix_ee_inline_fd_callbacks", description_posix_ee_inline_fd_callbacks,
+     additional_constraints_posix_ee_inline_fd_callbacks, nullptr, 0, false,
+     true},
     {"posix_ee_skip_grpc_init", description_posix_ee_skip_grpc_init,
      additional_constraints_posix_ee_skip_grpc_init, nullptr, 0, false, true},
+    {"posix_ee_timer_wheel", description_posix_ee_timer_wheel,
+     additional_constraints_posix_ee_timer_wheel, nullptr, 0, false, true},
     {"promise_based_http2_client_transport",
      description_promise_based_http2_client_transport,
      additional_constraints_promise_based_http2_client_transport, nullptr, 0,
@@ -401,20 +597,43 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true},
     {"server_listener", description_server_listener,
      additional_constraints_server_listener, nullptr, 0, true, true},
+    {"shared_ares_resolver", description_shared_ares_resolver,
+     additional_constraints_shared_ares_resolver, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"token_fetcher_proactive_refresh",
+     description_token_fetcher_proactive_refresh,
+     additional_constraints_token_fetcher_proactive_refresh, nullptr, 0, false,
+     true},
+    {"tsc_clock", description_tsc_clock, additional_constraints_tsc_clock,
+     nullptr, 0, false, true},
     {"unconstrained_max_quota_buffer_size",
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"work_serializer_urgent_lane", description_work_serializer_urgent_lane,
+     additional_constraints_work_serializer_urgent_lane, nullptr, 0, false,
+     true},
+    {"work_stealing_lock_free_queues",
+     description_work_stealing_lock_free_queues,
+     additional_constraints_work_stealing_lock_free_queues, nullptr, 0, false,
+     true},
+    {"work_stealing_numa_affinity", description_work_stealing_numa_affinity,
+     additional_constraints_work_stealing_numa_affinity, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
 
 #else
 namespace {
+const char* const description_arena_block_cache =
+    "Back call arenas and their zones with blocks from a per-cpu cache, so "
+    "that a finished call's arena memory is reused by the next call instead of "
+    "being freed.";
+const char* const additional_constraints_arena_block_cache = "{}";
 const char* const description_backoff_cap_initial_at_max =
     "Backoff library applies max_backoff even on initial_backoff.";
 const char* const additional_constraints_backoff_cap_initial_at_max = "{}";
@@ -430,6 +649,14 @@ const char* const additional_constraints_callv3_client_auth_filter = "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_combiner_batch_drain =
+    "When a contended combiner would offload its queue, keep draining it on "
+    "the current thread until a closure or time budget is spent.";
+const char* const additional_constraints_combiner_batch_drain = "{}";
+const char* const description_cq_next_adaptive_spin =
+    "Before grpc_completion_queue_next polls, spin on the queue for a budget "
+    "derived from the recent time between its events.";
+const char* const additional_constraints_cq_next_adaptive_spin = "{}";
 const char* const description_disable_buffer_hint_on_high_memory_pressure =
     "Disable buffer hint flag parsing in the transport under high memory "
     "pressure.";
@@ -455,9 +682,22 @@ const char* const additional_constraints_event_engine_callback_cq = "{}";
 const uint8_t required_experiments_event_engine_callback_cq[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_fork_keeps_resolver_result =
+    "In a forked child, keep the resolver result, service config and LB config "
+    "that channels carried over from the parent, and reconnect without first "
+    "re-resolving.";
+const char* const additional_constraints_fork_keeps_resolver_result = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_encoder_contiguous_output =
+    "Pack the small pieces of an encoded header block (prefixes, short keys "
+    "and values) into shared contiguous blocks rather than a slice each.";
+const char* const additional_constraints_hpack_encoder_contiguous_output = "{}";
+const char* const description_hugepage_slice_slabs =
+    "Serve large MemoryAllocator::MakeSlice buffers from 2MB slabs backed by "
+    "huge pages.";
+const char* const additional_constraints_hugepage_slice_slabs = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -477,13 +717,27 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_per_cpu_memory_quota =
+    "Cache free quota bytes per cpu so that allocators on different cores "
+    "don't contend on a single counter when taking from and returning to a "
+    "MemoryQuota.";
+const char* const additional_constraints_per_cpu_memory_quota = "{}";
 const char* const description_pick_first_new =
     "New pick_first impl with memory reduction.";
 const char* const additional_constraints_pick_first_new = "{}";
+const char* const description_posix_ee_inline_fd_callbacks =
+    "Run the fd readiness callbacks found by a PosixEventEngine poller on the "
+    "thread that polled them, after handing polling over to another thread, "
+    "instead of queueing them on the thread pool.";
+const char* const additional_constraints_posix_ee_inline_fd_callbacks = "{}";
 const char* const description_posix_ee_skip_grpc_init =
     "Prevent the PosixEventEngine from calling grpc_init & grpc_shutdown on "
     "creation and destruction.";
 const char* const additional_constraints_posix_ee_skip_grpc_init = "{}";
+const char* const description_posix_ee_timer_wheel =
+    "Keep PosixEventEngine timers in a hierarchical timing wheel instead of "
+    "the sharded timer heap.";
+const char* const additional_constraints_posix_ee_timer_wheel = "{}";
 const char* const description_promise_based_http2_client_transport =
     "Use promises for the http2 client transport. We have kept client and "
     "server transport experiments separate to help with smoother roll outs and "
@@ -512,6 +766,11 @@ const char* const additional_constraints_schedule_cancellation_over_write =
 const char* const description_server_listener =
     "If set, the new server listener classes are used.";
 const char* const additional_constraints_server_listener = "{}";
+const char* const description_shared_ares_resolver =
+    "Share one c-ares resolver, and so one c-ares channel and its nameserver "
+    "sockets, between all the DNS resolvers a PosixEventEngine hands out for "
+    "the same DNS server.";
+const char* const additional_constraints_shared_ares_resolver = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -521,15 +780,39 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_token_fetcher_proactive_refresh =
+    "Refresh the tokens of TokenFetcherCredentials in the background, part way "
+    "through their lifetime, and share them between credentials with the same "
+    "configuration.";
+const char* const additional_constraints_token_fetcher_proactive_refresh = "{}";
+const char* const description_tsc_clock =
+    "Read Timestamp::Now() from the CPU's invariant timestamp counter, "
+    "calibrated against and periodically re-synced to the monotonic clock, "
+    "instead of calling clock_gettime.";
+const char* const additional_constraints_tsc_clock = "{}";
 const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_work_serializer_urgent_lane =
+    "Let WorkSerializer run urgent callbacks, such as subchannel connectivity "
+    "state changes, ahead of callbacks that were queued before them.";
+const char* const additional_constraints_work_serializer_urgent_lane = "{}";
+const char* const description_work_stealing_lock_free_queues =
+    "Back the EventEngine thread pool with lock-free work queues, a Chase-Lev "
+    "deque per worker and a bounded MPMC ring for the global queue.";
+const char* const additional_constraints_work_stealing_lock_free_queues = "{}";
+const char* const description_work_stealing_numa_affinity =
+    "Group EventEngine thread pool workers by NUMA node, pin them to their "
+    "node's CPUs, and steal work from the same node before other nodes.";
+const char* const additional_constraints_work_stealing_numa_affinity = "{}";
 }  // namespace
 
 namespace grpc_core {
 
 const ExperimentMetadata g_experiment_metadata[] = {
+    {"arena_block_cache", description_arena_block_cache,
+     additional_constraints_arena_block_cache, nullptr, 0, false, true},
     {"backoff_cap_initial_at_max", description_backoff_cap_initial_at_max,
      additional_constraints_backoff_cap_initial_at_max, nullptr, 0, true, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
@@ -541,6 +824,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, false,
      true},
+    {"combiner_batch_drain", description_combiner_batch_drain,
+     additional_constraints_combiner_batch_drain, nullptr, 0, false, true},
+    {"cq_next_adaptive_spin", description_cq_next_adaptive_spin,
+     additional_constraints_cq_next_adaptive_spin, nullptr, 0, false, true},
     {"disable_buffer_hint_on_high_memory_pressure",
      description_disable_buffer_hint_on_high_memory_pressure,
      additional_constraints_disable_buffer_hint_on_high_memory_pressure,
@@ -558,8 +845,17 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"event_engine_callback_cq", description_event_engine_callback_cq,
      additional_constraints_event_engine_callback_cq,
      required_experiments_event_engine_callback_cq, 2, true, true},
+    {"fork_keeps_resolver_result", description_fork_keeps_resolver_result,
+     additional_constraints_fork_keeps_resolver_result, nullptr, 0, false,
+     true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_encoder_contiguous_output",
+     description_hpack_encoder_contiguous_output,
+     additional_constraints_hpack_encoder_contiguous_output, nullptr, 0, false,
+     true},
+    {"hugepage_slice_slabs", description_hugepage_slice_slabs,
+     additional_constraints_hugepage_slice_slabs, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -571,10 +867,17 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"per_cpu_memory_quota", description_per_cpu_memory_quota,
+     additional_constraints_per_cpu_memory_quota, nullptr, 0, false, true},
     {"pick_first_new", description_pick_first_new,
      additional_constraints_pick_first_new, nullptr, 0, true, true},
+    {"posix_ee_inline_fd_callbacks", description_posix_ee_inline_fd_callbacks,
+     additional_constraints_posix_ee_inline_fd_callbacks, nullptr, 0, false,
+     true},
     {"posix_ee_skip_grpc_init", description_posix_ee_skip_grpc_init,
      additional_constraints_posix_ee_skip_grpc_init, nullptr, 0, false, true},
+    {"posix_ee_timer_wheel", description_posix_ee_timer_wheel,
+     additional_constraints_posix_ee_timer_wheel, nullptr, 0, false, true},
     {"promise_based_http2_client_transport",
      description_promise_based_http2_client_transport,
      additional_constraints_promise_based_http2_client_transport, nullptr, 0,
@@ -597,14 +900,32 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true},
     {"server_listener", description_server_listener,
      additional_constraints_server_listener, nullptr, 0, true, true},
+    {"shared_ares_resolver", description_shared_ares_resolver,
+     additional_constraints_shared_ares_resolver, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"token_fetcher_proactive_refresh",
+     description_token_fetcher_proactive_refresh,
+     additional_constraints_token_fetcher_proactive_refresh, nullptr, 0, false,
+     true},
+    {"tsc_clock", description_tsc_clock, additional_constraints_tsc_clock,
+     nullptr, 0, false, true},
     {"unconstrained_max_quota_buffer_size",
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"work_serializer_urgent_lane", description_work_serializer_urgent_lane,
+     additional_constraints_work_serializer_urgent_lane, nullptr, 0, false,
+     true},
+    {"work_stealing_lock_free_queues",
+     description_work_stealing_lock_free_queues,
+     additional_constraints_work_stealing_lock_free_queues, nullptr, 0, false,
+     true},
+    {"work_stealing_numa_affinity", description_work_stealing_numa_affinity,
+     additional_constraints_work_stealing_numa_affinity, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
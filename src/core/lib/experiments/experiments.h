@@ -57,6 +57,7 @@ namespace grpc_core {
 #ifdef GRPC_EXPERIMENTS_ARE_FINAL
 
 #if defined(GRPC_CFSTREAM)
+inline bool IsArenaBlockCacheEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
@@ -65,6 +66,8 @@ inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallTracerTransportFixEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
 inline bool IsChaoticGoodFramingLayerEnabled() { return false; }
+inline bool IsCombinerBatchDrainEnabled() { return false; }
+inline bool IsCqNextAdaptiveSpinEnabled() { return false; }
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() { return false; }
 inline bool IsEventEngineClientEnabled() { return false; }
 inline bool IsEventEngineDnsEnabled() { return false; }
@@ -72,7 +75,10 @@ inline bool IsEventEngineDnsNonClientChannelEnabled() { return false; }
 inline bool IsEventEngineListenerEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
+inline bool IsForkKeepsResolverResultEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
+inline bool IsHpackEncoderContiguousOutputEnabled() { return false; }
+inline bool IsHugepageSliceSlabsEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
@@ -80,9 +86,12 @@ inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPerCpuMemoryQuotaEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() { return true; }
+inline bool IsPosixEeInlineFdCallbacksEnabled() { return false; }
 inline bool IsPosixEeSkipGrpcInitEnabled() { return false; }
+inline bool IsPosixEeTimerWheelEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
@@ -91,11 +100,18 @@ inline bool IsRqFastRejectEnabled() { return false; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_LISTENER
 inline bool IsServerListenerEnabled() { return true; }
+inline bool IsSharedAresResolverEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTokenFetcherProactiveRefreshEnabled() { return false; }
+inline bool IsTscClockEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsWorkSerializerUrgentLaneEnabled() { return false; }
+inline bool IsWorkStealingLockFreeQueuesEnabled() { return false; }
+inline bool IsWorkStealingNumaAffinityEnabled() { return false; }
 
 #elif defined(GPR_WINDOWS)
+inline bool IsArenaBlockCacheEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
@@ -104,6 +120,8 @@ inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallTracerTransportFixEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
 inline bool IsChaoticGoodFramingLayerEnabled() { return false; }
+inline bool IsCombinerBatchDrainEnabled() { return false; }
+inline bool IsCqNextAdaptiveSpinEnabled() { return false; }
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
@@ -114,7 +132,10 @@ inline bool IsEventEngineDnsNonClientChannelEnabled() { return false; }
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
+inline bool IsForkKeepsResolverResultEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
+inline bool IsHpackEncoderContiguousOutputEnabled() { return false; }
+inline bool IsHugepageSliceSlabsEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
@@ -122,9 +143,12 @@ inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPerCpuMemoryQuotaEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() { return true; }
+inline bool IsPosixEeInlineFdCallbacksEnabled() { return false; }
 inline bool IsPosixEeSkipGrpcInitEnabled() { return false; }
+inline bool IsPosixEeTimerWheelEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
@@ -133,11 +157,18 @@ inline bool IsRqFastRejectEnabled() { return false; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_LISTENER
 inline bool IsServerListenerEnabled() { return true; }
+inline bool IsSharedAresResolverEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTokenFetcherProactiveRefreshEnabled() { return false; }
+inline bool IsTscClockEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsWorkSerializerUrgentLaneEnabled() { return false; }
+inline bool IsWorkStealingLockFreeQueuesEnabled() { return false; }
+inline bool IsWorkStealingNumaAffinityEnabled() { return false; }
 
 #else
+inline bool IsArenaBlockCacheEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
@@ -146,6 +177,8 @@ inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallTracerTransportFixEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
 inline bool IsChaoticGoodFramingLayerEnabled() { return false; }
+inline bool IsCombinerBatchDrainEnabled() { return false; }
+inline bool IsCqNextAdaptiveSpinEnabled() { return false; }
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
@@ -156,7 +189,10 @@ inline bool IsEventEngineDnsNonClientChannelEnabled() { return false; }
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
+inline bool IsForkKeepsResolverResultEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
+inline bool IsHpackEncoderContiguousOutputEnabled() { return false; }
+inline bool IsHugepageSliceSlabsEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
@@ -164,9 +200,12 @@ inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPerCpuMemoryQuotaEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() { return true; }
+inline bool IsPosixEeInlineFdCallbacksEnabled() { return false; }
 inline bool IsPosixEeSkipGrpcInitEnabled() { return false; }
+inline bool IsPosixEeTimerWheelEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
@@ -175,32 +214,47 @@ inline bool IsRqFastRejectEnabled() { return false; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_LISTENER
 inline bool IsServerListenerEnabled() { return true; }
+inline bool IsSharedAresResolverEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTokenFetcherProactiveRefreshEnabled() { return false; }
+inline bool IsTscClockEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsWorkSerializerUrgentLaneEnabled() { return false; }
+inline bool IsWorkStealingLockFreeQueuesEnabled() { return false; }
+inline bool IsWorkStealingNumaAffinityEnabled() { return false; }
 #endif
 
 #else
 enum ExperimentIds {
+  kExperimentIdArenaBlockCache,
   kExperimentIdBackoffCapInitialAtMax,
   kExperimentIdCallTracerInTransport,
   kExperimentIdCallTracerTransportFix,
   kExperimentIdCallv3ClientAuthFilter,
   kExperimentIdChaoticGoodFramingLayer,
+  kExperimentIdCombinerBatchDrain,
+  kExperimentIdCqNextAdaptiveSpin,
   kExperimentIdDisableBufferHintOnHighMemoryPressure,
   kExperimentIdEventEngineClient,
   kExperimentIdEventEngineDns,
   kExperimentIdEventEngineDnsNonClientChannel,
   kExperimentIdEventEngineListener,
   kExperimentIdEventEngineCallbackCq,
+  kExperimentIdForkKeepsResolverResult,
   kExperimentIdFreeLargeAllocator,
+  kExperimentIdHpackEncoderContiguousOutput,
+  kExperimentIdHugepageSliceSlabs,
   kExperimentIdKeepAlivePingTimerBatch,
   kExperimentIdLocalConnectorSecure,
   kExperimentIdMaxPingsWoDataThrottle,
   kExperimentIdMonitoringExperiment,
   kExperimentIdMultiping,
+  kExperimentIdPerCpuMemoryQuota,
   kExperimentIdPickFirstNew,
+  kExperimentIdPosixEeInlineFdCallbacks,
   kExperimentIdPosixEeSkipGrpcInit,
+  kExperimentIdPosixEeTimerWheel,
   kExperimentIdPromiseBasedHttp2ClientTransport,
   kExperimentIdPromiseBasedHttp2ServerTransport,
   kExperimentIdPromiseBasedInprocTransport,
@@ -208,11 +262,21 @@ enum ExperimentIds {
   kExperimentIdRqFastReject,
   kExperimentIdScheduleCancellationOverWrite,
   kExperimentIdServerListener,
+  kExperimentIdSharedAresResolver,
   kExperimentIdTcpFrameSizeTuning,
   kExperimentIdTcpRcvLowat,
+  kExperimentIdTokenFetcherProactiveRefresh,
+  kExperimentIdTscClock,
   kExperimentIdUnconstrainedMaxQuotaBufferSize,
+  kExperimentIdWorkSerializerUrgentLane,
+  kExperimentIdWorkStealingLockFreeQueues,
+  kExperimentIdWorkStealingNumaAffinity,
   kNumExperiments
 };
+#define GRPC_EXPERIMENT_IS_INCLUDED_ARENA_BLOCK_CACHE
+inline bool IsArenaBlockCacheEnabled() {
+  return IsExperimentEnabled<kExperimentIdArenaBlockCache>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() {
   return IsExperimentEnabled<kExperimentIdBackoffCapInitialAtMax>();
@@ -233,6 +297,14 @@ inline bool IsCallv3ClientAuthFilterEnabled() {
 inline bool IsChaoticGoodFramingLayerEnabled() {
   return IsExperimentEnabled<kExperimentIdChaoticGoodFramingLayer>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_COMBINER_BATCH_DRAIN
+inline bool IsCombinerBatchDrainEnabled() {
+  return IsExperimentEnabled<kExperimentIdCombinerBatchDrain>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CQ_NEXT_ADAPTIVE_SPIN
+inline bool IsCqNextAdaptiveSpinEnabled() {
+  return IsExperimentEnabled<kExperimentIdCqNextAdaptiveSpin>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_DISABLE_BUFFER_HINT_ON_HIGH_MEMORY_PRESSURE
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() {
   return IsExperimentEnabled<
@@ -258,10 +330,22 @@ inline bool IsEventEngineListenerEnabled() {
 inline bool IsEventEngineCallbackCqEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineCallbackCq>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_FORK_KEEPS_RESOLVER_RESULT
+inline bool IsForkKeepsResolverResultEnabled() {
+  return IsExperimentEnabled<kExperimentIdForkKeepsResolverResult>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_FREE_LARGE_ALLOCATOR
 inline bool IsFreeLargeAllocatorEnabled() {
   return IsExperimentEnabled<kExperimentIdFreeLargeAllocator>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_ENCODER_CONTIGUOUS_OUTPUT
+inline bool IsHpackEncoderContiguousOutputEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackEncoderContiguousOutput>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_HUGEPAGE_SLICE_SLABS
+inline bool IsHugepageSliceSlabsEnabled() {
+  return IsExperimentEnabled<kExperimentIdHugepageSliceSlabs>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_KEEP_ALIVE_PING_TIMER_BATCH
 inline bool IsKeepAlivePingTimerBatchEnabled() {
   return IsExperimentEnabled<kExperimentIdKeepAlivePingTimerBatch>();
@@ -282,14 +366,26 @@ inline bool IsMonitoringExperimentEnabled() {
 inline bool IsMultipingEnabled() {
   return IsExperimentEnabled<kExperimentIdMultiping>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_PER_CPU_MEMORY_QUOTA
+inline bool IsPerCpuMemoryQuotaEnabled() {
+  return IsExperimentEnabled<kExperimentIdPerCpuMemoryQuota>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() {
   return IsExperimentEnabled<kExperimentIdPickFirstNew>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_EE_INLINE_FD_CALLBACKS
+inline bool IsPosixEeInlineFdCallbacksEnabled() {
+  return IsExperimentEnabled<kExperimentIdPosixEeInlineFdCallbacks>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_EE_SKIP_GRPC_INIT
 inline bool IsPosixEeSkipGrpcInitEnabled() {
   return IsExperimentEnabled<kExperimentIdPosixEeSkipGrpcInit>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_EE_TIMER_WHEEL
+inline bool IsPosixEeTimerWheelEnabled() {
+  return IsExperimentEnabled<kExperimentIdPosixEeTimerWheel>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_PROMISE_BASED_HTTP2_CLIENT_TRANSPORT
 inline bool IsPromiseBasedHttp2ClientTransportEnabled() {
   return IsExperimentEnabled<kExperimentIdPromiseBasedHttp2ClientTransport>();
@@ -318,6 +414,10 @@ inline bool IsScheduleCancellationOverWriteEnabled() {
 inline bool IsServerListenerEnabled() {
   return IsExperimentEnabled<kExperimentIdServerListener>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SHARED_ARES_RESOLVER
+inline bool IsSharedAresResolverEnabled() {
+  return IsExperimentEnabled<kExperimentIdSharedAresResolver>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_TCP_FRAME_SIZE_TUNING
 inline bool IsTcpFrameSizeTuningEnabled() {
   return IsExperimentEnabled<kExperimentIdTcpFrameSizeTuning>();
@@ -326,10 +426,30 @@ inline bool IsTcpFrameSizeTuningEnabled() {
 inline bool IsTcpRcvLowatEnabled() {
   return IsExperimentEnabled<kExperimentIdTcpRcvLowat>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_TOKEN_FETCHER_PROACTIVE_REFRESH
+inline bool IsTokenFetcherProactiveRefreshEnabled() {
+  return IsExperimentEnabled<kExperimentIdTokenFetcherProactiveRefresh>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_TSC_CLOCK
+inline bool IsTscClockEnabled() {
+  return IsExperimentEnabled<kExperimentIdTscClock>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_UNCONSTRAINED_MAX_QUOTA_BUFFER_SIZE
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() {
   return IsExperimentEnabled<kExperimentIdUnconstrainedMaxQuotaBufferSize>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_WORK_SERIALIZER_URGENT_LANE
+inline bool IsWorkSerializerUrgentLaneEnabled() {
+  return IsExperimentEnabled<kExperimentIdWorkSerializerUrgentLane>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_WORK_STEALING_LOCK_FREE_QUEUES
+inline bool IsWorkStealingLockFreeQueuesEnabled() {
+  return IsExperimentEnabled<kExperimentIdWorkStealingLockFreeQueues>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_WORK_STEALING_NUMA_AFFINITY
+inline bool IsWorkStealingNumaAffinityEnabled() {
+  return IsExperimentEnabled<kExperimentIdWorkStealingNumaAffinity>();
+}
 
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
@@ -29,12 +29,19 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/mpscq.h"
 
 #define STATE_UNORPHANED 1
 #define STATE_ELEM_COUNT_LOW_BIT 2
 
+// Budget for draining a contended combiner on the current thread with the
+// combiner_batch_drain experiment.
+#define BATCH_MAX_CLOSURES 64
+#define BATCH_MAX_MICROS 1000
+
 static void combiner_exec(grpc_core::Combiner* lock, grpc_closure* closure,
                           grpc_error_handle error);
 static void combiner_finally_exec(grpc_core::Combiner* lock,
@@ -155,10 +162,13 @@ static void move_next() {
 
 static void queue_offload(grpc_core::Combiner* lock) {
   move_next();
+  lock->batch_closures = 0;
+  lock->force_offload = false;
   // Make the combiner look uncontended by storing a non-null value here, so
   // that we don't immediately offload again.
   gpr_atm_no_barrier_store(&lock->initiating_exec_ctx_or_null, 1);
   GRPC_TRACE_LOG(combiner, INFO) << "C:" << lock << " queue_offload";
+  grpc_core::global_stats().IncrementCombinerOffloads();
   lock->event_engine->Run([lock] {
     grpc_core::ExecCtx exec_ctx(0);
     push_last_on_exec_ctx(lock);
@@ -182,15 +192,31 @@ bool grpc_combiner_continue_exec_ctx() {
       << grpc_core::ExecCtx::Get()->IsReadyToFinish()
       << " time_to_execute_final_list=" << lock->time_to_execute_final_list;
 
+  if (lock->batch_closures == 0) lock->batch_start = gpr_get_cycle_counter();
+
   // offload only if both (1) the combiner is contended and has more than one
   // closure to execute, and (2) the current execution context needs to finish
   // as soon as possible
   if (contended && grpc_core::ExecCtx::Get()->IsReadyToFinish()) {
-    // this execution context wants to move on: schedule remaining work to be
-    // picked up on the executor
-    queue_offload(lock);
-    return true;
+    if (!grpc_core::IsCombinerBatchDrainEnabled() || lock->force_offload) {
+      // this execution context wants to move on: schedule remaining work to be
+      // picked up on the executor
+      queue_offload(lock);
+      return true;
+    }
+    // keep the transport's state hot in this thread's cache for a while
+    // rather than bouncing it to another thread after every closure
+    if (lock->batch_closures >= BATCH_MAX_CLOSURES ||
+        gpr_time_cmp(
+            gpr_cycle_counter_sub(gpr_get_cycle_counter(), lock->batch_start),
+            gpr_time_from_micros(BATCH_MAX_MICROS, GPR_TIMESPAN)) >= 0) {
+      grpc_core::global_stats().IncrementCombinerBudgetOffloads();
+      queue_offload(lock);
+      return true;
+    }
+    grpc_core::global_stats().IncrementCombinerBatchDeferrals();
   }
+  ++lock->batch_closures;
 
   if (!lock->time_to_execute_final_list ||
       // peek to see if something new has shown up, and execute that with
@@ -259,6 +285,8 @@ bool grpc_combiner_continue_exec_ctx() {
       break;
     case OLD_STATE_WAS(false, 1):
       // had one count, one unorphaned --> unlocked unorphaned
+      lock->batch_closures = 0;
+      lock->force_offload = false;
       return true;
     case OLD_STATE_WAS(true, 1):
       // and one count, one orphaned --> unlocked and orphaned
@@ -316,6 +344,7 @@ void Combiner::FinallyRun(grpc_closure* closure, grpc_error_handle error) {
 
 void Combiner::ForceOffload() {
   gpr_atm_no_barrier_store(&initiating_exec_ctx_or_null, 0);
+  force_offload = true;
   ExecCtx::Get()->SetReadyToFinishFlag();
 }
 
@@ -25,6 +25,7 @@
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/util/time_precise.h"
 
 namespace grpc_core {
 // TODO(yashkt) : Remove this class and replace it with a class that does not
@@ -49,6 +50,13 @@ class Combiner {
   gpr_atm state;
   bool time_to_execute_final_list = false;
   grpc_closure_list final_list;
+  // With the combiner_batch_drain experiment: the number of closures (or
+  // final lists) run since the combiner last started running on a thread, and
+  // when that was. A contended combiner only offloads once these exceed the
+  // batch budget, or when ForceOffload() was called.
+  int batch_closures = 0;
+  gpr_cycle_counter batch_start = 0;
+  bool force_offload = false;
   // TODO(ctiller): delete this when the combiner_offload_to_event_engine
   // experiment is removed.
   grpc_closure offload;
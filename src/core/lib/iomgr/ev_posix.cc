@@ -81,7 +81,10 @@ static const grpc_event_engine_vtable* g_vtables[] = {
 };
 
 static bool is(absl::string_view want, absl::string_view have) {
-  return want == "all" || want == have;
+  // The io_uring poller only exists in the EventEngine; iomgr uses epoll1 in
+  // its place.
+  return want == "all" || want == have ||
+         (want == "io_uring" && have == "epoll1");
 }
 
 static void try_engine(absl::string_view engine) {
@@ -26,6 +26,8 @@
 #include "absl/strings/str_format.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 
 static void exec_ctx_run(grpc_closure* closure) {
@@ -46,6 +48,17 @@ static void exec_ctx_run(grpc_closure* closure) {
 #endif
 }
 
+// Start pulling the next closure into cache while the current one runs: the
+// closures on the list live in their owning objects, scattered over the heap,
+// so each hop along the list is otherwise a likely cache miss.
+static void exec_ctx_prefetch(grpc_closure* closure) {
+#if GRPC_HAS_BUILTIN(__builtin_prefetch)
+  if (closure != nullptr) __builtin_prefetch(closure);
+#else
+  (void)closure;
+#endif
+}
+
 static void exec_ctx_sched(grpc_closure* closure) {
   grpc_closure_list_append(grpc_core::ExecCtx::Get()->closure_list(), closure);
 }
@@ -63,14 +76,17 @@ ExecCtx*& ExecCtx::exec_ctx() {
 #endif  // _WIN32
 
 bool ExecCtx::Flush() {
-  bool did_something = false;
+  int closures_run = 0;
+  int depth = 0;
   for (;;) {
     if (!grpc_closure_list_empty(closure_list_)) {
       grpc_closure* c = closure_list_.head;
       closure_list_.head = closure_list_.tail = nullptr;
+      ++depth;
       while (c != nullptr) {
         grpc_closure* next = c->next_data.next;
-        did_something = true;
+        exec_ctx_prefetch(next);
+        ++closures_run;
         exec_ctx_run(c);
         c = next;
       }
@@ -79,7 +95,11 @@ bool ExecCtx::Flush() {
     }
   }
   CHECK_EQ(combiner_data_.active_combiner, nullptr);
-  return did_something;
+  if (closures_run == 0) return false;
+  global_stats().IncrementExecCtxFlushes();
+  global_stats().IncrementExecCtxClosuresPerFlush(closures_run);
+  global_stats().IncrementExecCtxFlushDepth(depth);
+  return true;
 }
 
 void ExecCtx::Run(const DebugLocation& location, grpc_closure* closure,
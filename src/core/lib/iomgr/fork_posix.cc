@@ -104,6 +104,7 @@ void grpc_postfork_child() {
     }
     grpc_timer_manager_set_threading(true);
     grpc_core::Executor::SetThreadingAll(true);
+    grpc_core::Fork::NoteForkedChild();
   }
 }
 
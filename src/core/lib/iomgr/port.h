@@ -105,6 +105,14 @@
 #ifndef GRPC_LINUX_SOCKETUTILS
 #define GRPC_POSIX_SOCKETUTILS
 #endif
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#if __has_include(<linux/tls.h>)
+#define GRPC_LINUX_KTLS 1
+#endif
+#endif
 #elif defined(GPR_APPLE)
 #define GRPC_HAVE_ARPA_NAMESER 1
 #define GRPC_HAVE_IFADDRS 1
@@ -19,24 +19,32 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
-#include <limits>
+#include <iterator>
 #include <utility>
 #include <vector>
 
-#include "absl/base/thread_annotations.h"
 #include "absl/log/check.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/status_flag.h"
-#include "src/core/lib/promise/wait_set.h"
 #include "src/core/util/dump_args.h"
+#include "src/core/util/manual_constructor.h"
+#include "src/core/util/mpscq.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
-#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
+// Every item sent through an mpsc pipe is charged some tokens against the
+// receiver's buffer size. By default each item costs one token; specialize
+// this to charge by size instead (for instance, bytes of payload).
+template <typename T>
+struct MpscTokens {
+  static uint64_t Of(const T&) { return 1; }
+};
+
 namespace mpscpipe_detail {
 
 // Multi Producer Single Consumer (MPSC) inter-activity communications.
@@ -47,97 +55,281 @@ namespace mpscpipe_detail {
 
 // "Center" of the communication pipe.
 // Contains sent but not received messages, and open/close state.
+// Senders and the receiver never take a lock: items are pushed onto an
+// intrusive lock-free queue, and the buffered size is tracked in an atomic.
+// Neither do they allocate in steady state: items are reused, and the
+// receiver's waker is kept inline.
 template <typename T>
 class Center : public RefCounted<Center<T>> {
  public:
-  // Construct the center with a maximum queue size.
-  explicit Center(size_t max_queued) : max_queued_(max_queued) {}
+  // One sent item. Owned by the queue until received (or dropped), and also
+  // by a sender that waits for it to be received. Items the receiver is
+  // done with are kept for reuse by later sends.
+  class Item final : public MultiProducerSingleConsumerQueue::Node {
+   public:
+    // Resolves to true once received, or false if the receiver was closed
+    // first.
+    Poll<bool> PollReceived() const {
+      switch (state_.load(std::memory_order_acquire)) {
+        case State::kQueued:
+          return Pending{};
+        case State::kReceived:
+          return true;
+        case State::kDropped:
+          return false;
+      }
+      GPR_UNREACHABLE_CODE(return false);
+    }
+
+    // For RefCountedPtr<Item>, held by waiting senders.
+    void IncrementRefCount() { refs_.fetch_add(1, std::memory_order_relaxed); }
+    void Unref() {
+      if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+    }
+
+   private:
+    friend class Center;
+    enum class State : uint8_t { kQueued, kReceived, kDropped };
 
-  static constexpr const uint64_t kClosedBatch =
-      std::numeric_limits<uint64_t>::max();
+    Item(T value, uint64_t tokens) : tokens_(tokens) {
+      value_.Init(std::move(value));
+    }
+
+    // Constructed while the item is queued.
+    ManualConstructor<T> value_;
+    uint64_t tokens_;
+    // Set before the item is queued, for senders that wait on it.
+    Waker waker_;
+    std::atomic<State> state_{State::kQueued};
+    std::atomic<uint32_t> refs_{1};
+  };
+
+  enum class SendResult { kClosed, kSent, kAwaitReceipt };
+
+  // Construct the center with a maximum number of queued tokens.
+  explicit Center(uint64_t max_tokens) : max_tokens_(max_tokens) {}
+
+  ~Center() {
+    bool empty;
+    while (auto* item = static_cast<Item*>(queue_.PopAndCheckEnd(&empty))) {
+      Complete(item, Item::State::kDropped);
+    }
+    DCHECK(empty);
+    for (auto& spare : spare_items_) {
+      delete spare.load(std::memory_order_relaxed);
+    }
+  }
 
   // Poll for new items.
-  // - Returns true if new items were obtained, in which case they are contained
-  //   in dest in the order they were added. Wakes up all pending senders since
-  //   there will now be space to send.
+  // - Returns true if new items were obtained, in which case they replace the
+  //   contents of dest in the order they were added. Wakes up the senders
+  //   waiting for those items to be received.
   // - If receives have been closed, returns false.
   // - If no new items are available, returns
   //   Pending and sets up a waker to be awoken when more items are available.
-  // TODO(ctiller): consider the problem of thundering herds here. There may be
-  // more senders than there are queue spots, and so the strategy of waking up
-  // all senders is ill-advised.
-  // That said, some senders may have been cancelled by the time we wake them,
-  // and so waking a subset could cause starvation.
   Poll<bool> PollReceiveBatch(std::vector<T>& dest) {
-    ReleasableMutexLock lock(&mu_);
-    GRPC_TRACE_LOG(promise_primitives, INFO)
-        << "MPSC::PollReceiveBatch: "
-        << GRPC_DUMP_ARGS(this, batch_, queue_.size());
-    if (queue_.empty()) {
-      if (batch_ == kClosedBatch) return false;
-      receive_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
-      return Pending{};
+    dest.clear();
+    // popping_ is only ever contended once the pipe is closed.
+    if (popping_.exchange(true, std::memory_order_acquire)) return false;
+    if (closed_.load(std::memory_order_acquire)) {
+      ReleasePopping();
+      return false;
     }
-    dest.swap(queue_);
-    queue_.clear();
-    if (batch_ != kClosedBatch) ++batch_;
-    auto wakeups = send_wakers_.TakeWakeupSet();
-    lock.Release();
-    wakeups.Wakeup();
+    PopInto(dest);
+    if (dest.empty()) {
+      // Publish a waker, then check again: any sender that pushed before the
+      // waker went up is now visible, and any sender that pushes after will
+      // find the waker.
+      ArmReceiveWaker();
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      PopInto(dest);
+    }
+    GRPC_TRACE_LOG(promise_primitives, INFO)
+        << "MPSC::PollReceiveBatch: " << GRPC_DUMP_ARGS(this, dest.size());
+    ReleasePopping();
+    if (dest.empty()) return Pending{};
     return true;
   }
 
-  // Return value:
-  //  - if the pipe is closed, returns kClosedBatch
-  //  - if await_receipt is false, returns the batch number the item was sent
-  //  in.
-  //  - if await_receipt is true, returns the first sending batch number that
-  //  guarantees the item has been received.
-  uint64_t Send(T t, bool await_receipt) {
-    ReleasableMutexLock lock(&mu_);
-    if (batch_ == kClosedBatch) return kClosedBatch;
-    queue_.push_back(std::move(t));
-    auto receive_waker = std::move(receive_waker_);
-    const uint64_t batch =
-        (!await_receipt && queue_.size() <= max_queued_) ? batch_ : batch_ + 1;
-    lock.Release();
-    receive_waker.Wakeup();
-    return batch;
-  }
-
-  // Poll until a particular batch number is received.
-  Poll<Empty> PollReceiveBatch(uint64_t batch) {
-    ReleasableMutexLock lock(&mu_);
-    GRPC_TRACE_LOG(promise_primitives, INFO)
-        << "MPSC::PollReceiveBatch: " << GRPC_DUMP_ARGS(this, batch_, batch);
-    if (batch_ >= batch) return Empty{};
-    send_wakers_.AddPending(GetContext<Activity>()->MakeNonOwningWaker());
-    return Pending{};
+  // Queue an item.
+  // Returns kClosed if the pipe is closed, kSent if the send is complete, or
+  // kAwaitReceipt if the sender should wait for *receipt to be received -
+  // either because it asked to, or because the buffer is full. The latter
+  // needs an activity context; an unbuffered send never waits.
+  SendResult Send(T t, bool await_receipt, bool unbuffered,
+                  RefCountedPtr<Item>* receipt) {
+    if (closed_.load(std::memory_order_acquire)) return SendResult::kClosed;
+    const uint64_t tokens = MpscTokens<T>::Of(t);
+    const uint64_t queued =
+        queued_tokens_.fetch_add(tokens, std::memory_order_relaxed);
+    Item* item = NewItem(std::move(t), tokens);
+    // An item always fits into an empty buffer, however big it is.
+    const bool fits = queued == 0 || queued + tokens <= max_tokens_;
+    SendResult result = SendResult::kSent;
+    if (!unbuffered && (await_receipt || !fits)) {
+      item->waker_ = GetContext<Activity>()->MakeNonOwningWaker();
+      item->IncrementRefCount();
+      *receipt = RefCountedPtr<Item>(item);
+      result = SendResult::kAwaitReceipt;
+    }
+    queue_.Push(item);
+    // Paired with the fence in PollReceiveBatch(): either we see the waker,
+    // or the receiver sees our item. Also paired with the fence in
+    // DrainClosed(): either we see the close, or the closer sees our item.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    WakeReceiver(true);
+    if (closed_.load(std::memory_order_relaxed)) DrainClosed();
+    return result;
   }
 
   // Mark that the receiver is closed.
+  // Queued items are dropped, and their waiting senders resolve to false.
   void ReceiverClosed(bool wake_receiver) {
-    ReleasableMutexLock lock(&mu_);
+    if (closed_.exchange(true, std::memory_order_seq_cst)) return;
     GRPC_TRACE_LOG(promise_primitives, INFO)
-        << "MPSC::ReceiverClosed: " << GRPC_DUMP_ARGS(this, batch_);
-    if (batch_ == kClosedBatch) return;
-    batch_ = kClosedBatch;
-    auto wakeups = send_wakers_.TakeWakeupSet();
-    auto receive_waker = std::move(receive_waker_);
-    lock.Release();
-    if (wake_receiver) receive_waker.Wakeup();
-    wakeups.Wakeup();
+        << "MPSC::ReceiverClosed: " << GRPC_DUMP_ARGS(this);
+    DrainClosed();
+    WakeReceiver(wake_receiver);
   }
 
  private:
-  Mutex mu_;
-  const size_t max_queued_;
-  std::vector<T> queue_ ABSL_GUARDED_BY(mu_);
-  // Every time we give queue_ to the receiver, we increment batch_.
-  // When the receiver is closed we set batch_ to kClosedBatch.
-  uint64_t batch_ ABSL_GUARDED_BY(mu_) = 1;
-  Waker receive_waker_ ABSL_GUARDED_BY(mu_);
-  WaitSet send_wakers_ ABSL_GUARDED_BY(mu_);
+  // How many items the receiver is done with may be kept for reuse.
+  static constexpr size_t kMaxSpareItems = 8;
+
+  // States of receive_waker_. Only the receiver writes the waker, in
+  // kWriting, and only one sender (or the closer) takes it, in kTaking.
+  enum class WakerState : uint8_t { kEmpty, kWriting, kArmed, kTaking };
+
+  Item* NewItem(T value, uint64_t tokens) {
+    Item* item = nullptr;
+    for (auto& spare : spare_items_) {
+      if (spare.load(std::memory_order_relaxed) == nullptr) continue;
+      item = spare.exchange(nullptr, std::memory_order_acquire);
+      if (item != nullptr) break;
+    }
+    if (item == nullptr) {
+      item = new Item(std::move(value), tokens);
+    } else {
+      item->value_.Init(std::move(value));
+      item->tokens_ = tokens;
+      item->state_.store(Item::State::kQueued, std::memory_order_relaxed);
+      item->refs_.store(1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  // Drops the queue's ref to an item that was received or dropped, and wakes
+  // up its sender if it waits for it.
+  void Complete(Item* item, typename Item::State state) {
+    Waker waker = std::move(item->waker_);
+    item->value_.Destroy();
+    item->state_.store(state, std::memory_order_release);
+    if (item->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      RecycleItem(item);
+    }
+    waker.Wakeup();
+  }
+
+  void RecycleItem(Item* item) {
+    for (auto& spare : spare_items_) {
+      Item* expected = nullptr;
+      if (spare.load(std::memory_order_relaxed) == nullptr &&
+          spare.compare_exchange_strong(expected, item,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+        return;
+      }
+    }
+    delete item;
+  }
+
+  // Called by the receiver, which holds popping_.
+  void ArmReceiveWaker() {
+    WakerState state = receive_waker_state_.load(std::memory_order_acquire);
+    do {
+      // A sender is taking the waker to wake us up, so there is no need for
+      // a new one.
+      if (state == WakerState::kTaking) return;
+    } while (!receive_waker_state_.compare_exchange_weak(
+        state, WakerState::kWriting, std::memory_order_acquire,
+        std::memory_order_acquire));
+    receive_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
+    receive_waker_state_.store(WakerState::kArmed, std::memory_order_release);
+  }
+
+  void WakeReceiver(bool wakeup) {
+    WakerState state = WakerState::kArmed;
+    if (receive_waker_state_.load(std::memory_order_relaxed) !=
+            WakerState::kArmed ||
+        !receive_waker_state_.compare_exchange_strong(
+            state, WakerState::kTaking, std::memory_order_acquire,
+            std::memory_order_relaxed)) {
+      return;
+    }
+    Waker waker = std::move(receive_waker_);
+    receive_waker_state_.store(WakerState::kEmpty, std::memory_order_release);
+    if (wakeup) waker.Wakeup();
+  }
+
+  // Move everything that's ready out of queue_. Requires popping_.
+  // Returns false if a push was caught half way through, so that not
+  // everything could be popped.
+  template <typename Sink>
+  bool PopAll(Sink sink) {
+    bool empty;
+    uint64_t tokens = 0;
+    while (auto* item = static_cast<Item*>(queue_.PopAndCheckEnd(&empty))) {
+      tokens += item->tokens_;
+      sink(item);
+    }
+    if (tokens != 0) {
+      queued_tokens_.fetch_sub(tokens, std::memory_order_relaxed);
+    }
+    return empty;
+  }
+
+  void PopInto(std::vector<T>& dest) {
+    PopAll([this, &dest](Item* item) {
+      dest.push_back(std::move(*item->value_));
+      Complete(item, Item::State::kReceived);
+    });
+  }
+
+  void ReleasePopping() {
+    popping_.store(false, std::memory_order_seq_cst);
+    if (drain_requested_.load(std::memory_order_seq_cst)) DrainClosed();
+  }
+
+  // Drop everything queued after the pipe closed. Whoever fails to get
+  // popping_ leaves the work to its holder via drain_requested_, and whoever
+  // leaves an item half pushed drains it themselves once the push completes.
+  void DrainClosed() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    drain_requested_.store(true, std::memory_order_seq_cst);
+    while (drain_requested_.load(std::memory_order_seq_cst)) {
+      if (popping_.exchange(true, std::memory_order_seq_cst)) return;
+      drain_requested_.store(false, std::memory_order_seq_cst);
+      const bool empty = PopAll(
+          [this](Item* item) { Complete(item, Item::State::kDropped); });
+      popping_.store(false, std::memory_order_seq_cst);
+      if (!empty) return;
+    }
+  }
+
+  MultiProducerSingleConsumerQueue queue_;
+  const uint64_t max_tokens_;
+  // Tokens of every item sent but not yet received.
+  std::atomic<uint64_t> queued_tokens_{0};
+  // Waker for the receiver, set while it waits for items.
+  Waker receive_waker_;
+  std::atomic<WakerState> receive_waker_state_{WakerState::kEmpty};
+  std::atomic<bool> closed_{false};
+  // Held by whoever is popping from queue_: while the pipe is open, that is
+  // only ever the receiver.
+  std::atomic<bool> popping_{false};
+  std::atomic<bool> drain_requested_{false};
+  // Items no longer in use, taken by senders before allocating new ones.
+  std::atomic<Item*> spare_items_[kMaxSpareItems] = {};
 };
 
 }  // namespace mpscpipe_detail
@@ -171,41 +363,50 @@ class MpscSender {
   // until the item has been received by the receiver.
   auto SendAcked(T t) { return SendGeneric<true>(std::move(t)); }
 
+  // Send an item right away, ignoring the receiver's buffer size. Returns
+  // false if the receiver was closed.
   bool UnbufferedImmediateSend(T t) {
-    return center_->Send(std::move(t), false) !=
-           mpscpipe_detail::Center<T>::kClosedBatch;
+    return center_->Send(std::move(t), false, true, nullptr) !=
+           Center::SendResult::kClosed;
   }
 
  private:
+  using Center = mpscpipe_detail::Center<T>;
+
   template <bool kAwaitReceipt>
   auto SendGeneric(T t) {
     return [center = center_, t = std::move(t),
-            batch = uint64_t(0)]() mutable -> Poll<bool> {
+            receipt = RefCountedPtr<typename Center::Item>()]() mutable
+               -> Poll<bool> {
       if (center == nullptr) return false;
-      if (batch == 0) {
-        batch = center->Send(std::move(t), kAwaitReceipt);
-        CHECK_NE(batch, 0u);
-        if (batch == mpscpipe_detail::Center<T>::kClosedBatch) return false;
+      if (receipt == nullptr) {
+        switch (center->Send(std::move(t), kAwaitReceipt, false, &receipt)) {
+          case Center::SendResult::kClosed:
+            return false;
+          case Center::SendResult::kSent:
+            return true;
+          case Center::SendResult::kAwaitReceipt:
+            break;
+        }
       }
-      auto p = center->PollReceiveBatch(batch);
-      if (p.pending()) return Pending{};
-      return true;
+      return receipt->PollReceived();
     };
   }
 
   friend class MpscReceiver<T>;
-  explicit MpscSender(RefCountedPtr<mpscpipe_detail::Center<T>> center)
+  explicit MpscSender(RefCountedPtr<Center> center)
       : center_(std::move(center)) {}
-  RefCountedPtr<mpscpipe_detail::Center<T>> center_;
+  RefCountedPtr<Center> center_;
 };
 
 // Receive half of an mpsc pipe.
 template <typename T>
 class MpscReceiver {
  public:
-  // max_buffer_hint is the maximum number of elements we'd like to buffer.
+  // max_buffer_hint is the maximum number of tokens (see MpscTokens above)
+  // we'd like to buffer.
   // We half this before passing to Center so that the number there is the
-  // maximum number of elements that can be queued in the center of the pipe.
+  // maximum number of tokens that can be queued in the center of the pipe.
   // The receiver also holds some of the buffered elements (up to half of them!)
   // so the total outstanding is equal to max_buffer_hint (unless it's 1 in
   // which case instantaneosly we may have two elements buffered).
@@ -249,19 +450,40 @@ class MpscReceiver {
         return Poll<ValueOrFailure<T>>(std::move(*buffer_it_++));
       }
       auto p = center_->PollReceiveBatch(buffer_);
+      buffer_it_ = buffer_.begin();
       if (bool* r = p.value_if_ready()) {
         if (!*r) return Failure{};
-        buffer_it_ = buffer_.begin();
         return Poll<ValueOrFailure<T>>(std::move(*buffer_it_++));
       }
       return Pending{};
     };
   }
 
+  // Returns a promise that will resolve to ValueOrFailure<std::vector<T>>.
+  // Like Next(), but resolves to every item available at once (in the order
+  // they were sent), so that a consumer can handle them together.
+  auto NextBatch() {
+    return [this]() -> Poll<ValueOrFailure<std::vector<T>>> {
+      if (buffer_it_ != buffer_.end()) {
+        std::vector<T> batch(std::make_move_iterator(buffer_it_),
+                             std::make_move_iterator(buffer_.end()));
+        buffer_it_ = buffer_.end();
+        return Poll<ValueOrFailure<std::vector<T>>>(std::move(batch));
+      }
+      std::vector<T> batch;
+      auto p = center_->PollReceiveBatch(batch);
+      if (bool* r = p.value_if_ready()) {
+        if (!*r) return Failure{};
+        return Poll<ValueOrFailure<std::vector<T>>>(std::move(batch));
+      }
+      return Pending{};
+    };
+  }
+
  private:
   // Received items. We move out of here one by one, but don't resize the
   // vector. Instead, when we run out of items, we poll the center for more -
-  // which swaps this buffer in for the new receive queue and clears it.
+  // which refills this buffer in place.
   // In this way, upon hitting a steady state the queue ought to be allocation
   // free.
   std::vector<T> buffer_;
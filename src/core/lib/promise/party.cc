@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <limits>
 
 #include "absl/base/thread_annotations.h"
@@ -27,6 +28,8 @@
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/latent_see.h"
 #include "src/core/util/sync.h"
 
@@ -182,16 +185,68 @@ void Party::SpawnSerializer::Destroy() {
   Destruct(this);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Party::WakeupBatch
+
+namespace {
+thread_local Party::WakeupBatch* g_wakeup_batch = nullptr;
+}  // namespace
+
+Party::WakeupBatch::WakeupBatch() {
+  if (g_wakeup_batch == nullptr) g_wakeup_batch = this;
+}
+
+Party::WakeupBatch::~WakeupBatch() {
+  if (g_wakeup_batch != this) return;
+  g_wakeup_batch = nullptr;
+  if (parties_.empty()) return;
+  event_engine_->Run([parties = std::move(parties_)]() {
+    GRPC_LATENT_SEE_PARENT_SCOPE("Party::WakeupBatch");
+    ExecCtx exec_ctx;
+    for (const auto& [party, prev_state] : parties) {
+      RunLockedAndUnref(party, prev_state);
+    }
+  });
+}
+
+Party::WakeupBatch* Party::WakeupBatch::Current() { return g_wakeup_batch; }
+
+bool Party::WakeupBatch::Add(Party* party, uint64_t prev_state) {
+  auto* event_engine =
+      party->arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
+  if (event_engine_ == nullptr) {
+    event_engine_ = event_engine;
+  } else if (event_engine_ != event_engine) {
+    return false;
+  }
+  parties_.emplace_back(party, prev_state);
+  return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Party
 
+struct Party::Overflow {
+  Mutex mu;
+  std::deque<Participant*> participants ABSL_GUARDED_BY(mu);
+};
+
 Party::~Party() {}
 
 void Party::CancelRemainingParticipants() {
   uint64_t prev_state = state_.load(std::memory_order_relaxed);
-  if ((prev_state & kAllocatedMask) == 0) return;
+  Overflow* overflow = overflow_.load(std::memory_order_acquire);
+  if ((prev_state & kAllocatedMask) == 0 && overflow == nullptr) return;
   ScopedActivity activity(this);
   promise_detail::Context<Arena> arena_ctx(arena_.get());
+  if (overflow != nullptr) {
+    std::deque<Participant*> participants;
+    {
+      MutexLock lock(&overflow->mu);
+      participants.swap(overflow->participants);
+    }
+    for (Participant* p : participants) p->Destroy();
+  }
   uint64_t clear_state = 0;
   do {
     for (size_t i = 0; i < party_detail::kMaxParticipants; i++) {
@@ -233,6 +288,7 @@ void Party::ForceImmediateRepoll(WakeupMask mask) {
 
 void Party::RunLockedAndUnref(Party* party, uint64_t prev_state) {
   GRPC_LATENT_SEE_PARENT_SCOPE("Party::RunLocked");
+  global_stats().IncrementPartyWakeups();
 #ifdef GRPC_MAXIMIZE_THREADYNESS
   Thread thd(
       "RunParty",
@@ -290,6 +346,12 @@ void Party::RunLockedAndUnref(Party* party, uint64_t prev_state) {
       // gets held for a really long time.
       auto wakeup =
           std::exchange(g_run_state->next, PartyWakeup{party, prev_state});
+      // If the caller is batching wakeups, leave it to the batch.
+      WakeupBatch* batch = WakeupBatch::Current();
+      if (batch != nullptr && batch->Add(wakeup.party, wakeup.prev_state)) {
+        return;
+      }
+      global_stats().IncrementPartyWakeupOffloads();
       auto arena = party->arena_.get();
       auto* event_engine =
           arena->GetContext<grpc_event_engine::experimental::EventEngine>();
@@ -322,6 +384,10 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
   ScopedTimeCache time_cache;
 #endif
   for (;;) {
+    if (GPR_UNLIKELY(drain_overflow_)) {
+      drain_overflow_ = false;
+      DrainOverflow();
+    }
     uint64_t keep_allocated_mask = kAllocatedMask;
     // For each wakeup bit...
     while (wakeup_mask_ != 0) {
@@ -352,6 +418,10 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
       }
     }
     currently_polling_ = kNotPolling;
+    // If a participant completed while others wait for a slot, go around
+    // again once its slot is freed so that the next one gets it.
+    const bool retry_overflow =
+        keep_allocated_mask != kAllocatedMask && HasOverflow();
     // Try to CAS the state we expected to have (with no wakeups or adds)
     // back to unlocked (by masking in only the ref mask - sans locked bit).
     // If this succeeds then no wakeups were added, no adds were added, and we
@@ -363,7 +433,8 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
     // TODO(ctiller): consider mitigations for the accidental wakeup on owning
     // waker creation case -- I currently expect this will be more expensive
     // than this quick loop.
-    if (state_.compare_exchange_weak(
+    if (!retry_overflow &&
+        state_.compare_exchange_weak(
             prev_state,
             (prev_state & (kRefMask | keep_allocated_mask)) - kOneRef,
             std::memory_order_acq_rel, std::memory_order_acquire)) {
@@ -388,6 +459,9 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
     DCHECK_GE(prev_state & kRefMask, kOneRef);
     // From the previous state, extract which participants we're to wakeup.
     wakeup_mask_ |= prev_state & kWakeupMask;
+    if (retry_overflow || (prev_state & kOverflowPending) != 0) {
+      drain_overflow_ = true;
+    }
     // Now update prev_state to be what we want the CAS to see once wakeups
     // complete next iteration.
     prev_state &= kRefMask | kLocked | keep_allocated_mask;
@@ -470,15 +544,70 @@ void Party::MaybeAsyncAddParticipant(Participant* participant) {
   const size_t slot = AddParticipant(participant);
   if (slot != std::numeric_limits<size_t>::max()) return;
   // We need to delay the addition of participants.
-  IncrementRefCount();
   VLOG_EVERY_N_SEC(2, 10) << "Delaying addition of participant to party "
                           << this << " because it is full.";
-  arena_->GetContext<grpc_event_engine::experimental::EventEngine>()->Run(
-      [this, participant]() mutable {
-        ExecCtx exec_ctx;
-        MaybeAsyncAddParticipant(participant);
-        Unref();
-      });
+  AddOverflowParticipant(participant);
+}
+
+void Party::AddOverflowParticipant(Participant* participant) {
+  Overflow* overflow = overflow_.load(std::memory_order_acquire);
+  if (overflow == nullptr) {
+    Overflow* created = arena_->New<Overflow>();
+    if (overflow_.compare_exchange_strong(overflow, created,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire)) {
+      overflow = created;
+    } else {
+      Destruct(created);
+    }
+  }
+  {
+    MutexLock lock(&overflow->mu);
+    overflow->participants.push_back(participant);
+  }
+  // A slot may have been freed since we failed to get one: if the party is
+  // running, have it drain the queue before it unlocks; otherwise lock it and
+  // run it ourselves.
+  uint64_t state = state_.load(std::memory_order_relaxed);
+  while (true) {
+    if (state & kLocked) {
+      if (state_.compare_exchange_weak(state, state | kOverflowPending,
+                                       std::memory_order_release)) {
+        LogStateChange("AddOverflowParticipant", state,
+                       state | kOverflowPending);
+        return;
+      }
+    } else {
+      if (state_.compare_exchange_weak(state, (state | kLocked) + kOneRef,
+                                       std::memory_order_acq_rel)) {
+        LogStateChange("AddOverflowParticipantAndRun", state,
+                       (state | kLocked) + kOneRef);
+        drain_overflow_ = true;
+        RunLockedAndUnref(this, state);
+        return;
+      }
+    }
+  }
+}
+
+void Party::DrainOverflow() {
+  Overflow* overflow = overflow_.load(std::memory_order_acquire);
+  if (overflow == nullptr) return;
+  MutexLock lock(&overflow->mu);
+  while (!overflow->participants.empty()) {
+    if (AddParticipant(overflow->participants.front()) ==
+        std::numeric_limits<size_t>::max()) {
+      return;
+    }
+    overflow->participants.pop_front();
+  }
+}
+
+bool Party::HasOverflow() {
+  Overflow* overflow = overflow_.load(std::memory_order_acquire);
+  if (overflow == nullptr) return false;
+  MutexLock lock(&overflow->mu);
+  return !overflow->participants.empty();
 }
 
 void Party::WakeupAsync(WakeupMask wakeup_mask) {
@@ -493,6 +622,8 @@ void Party::WakeupAsync(WakeupMask wakeup_mask) {
                                        std::memory_order_acquire)) {
         LogStateChange("WakeupAsync", prev_state, prev_state | kLocked);
         wakeup_mask_ |= wakeup_mask;
+        WakeupBatch* batch = WakeupBatch::Current();
+        if (batch != nullptr && batch->Add(this, prev_state)) return;
         arena_->GetContext<grpc_event_engine::experimental::EventEngine>()->Run(
             [this, prev_state]() {
               GRPC_LATENT_SEE_PARENT_SCOPE("Party::WakeupAsync");
@@ -516,6 +647,9 @@ void Party::Drop(WakeupMask) { Unref(); }
 
 void Party::PartyIsOver() {
   CancelRemainingParticipants();
+  if (Overflow* overflow = overflow_.load(std::memory_order_acquire)) {
+    Destruct(overflow);
+  }
   auto arena = std::move(arena_);
   this->~Party();
 }
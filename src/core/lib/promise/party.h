@@ -24,6 +24,7 @@
 #include <limits>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/log/check.h"
@@ -126,7 +127,9 @@ namespace grpc_core {
 // 7. You can re-use the same party to spawn new Participants as long as the
 // older Participants have been resolved.
 // 8. We guarantee safe working of up to 16 un-resolved participants
-// on a party at a time.
+// on a party at a time. Participants spawned beyond that wait in an overflow
+// queue, allocated on the party's arena when first needed, and take the
+// first slot that frees up.
 //
 // Non-Guarantees of a Party
 // 1. Promises spawned on one party are not guaranteed to execute in the same
@@ -232,6 +235,35 @@ class Party : public Activity, private Wakeable {
     uint64_t prev_state_;
   };
 
+  // While a WakeupBatch is in scope on a thread, parties that would each be
+  // handed to the EventEngine in a closure of their own - by WakeupAsync, or
+  // because another party is already queued to run on this thread - are
+  // collected instead, and all run in one closure when the batch goes out of
+  // scope.
+  // Transports use this while a read is dispatched to many calls, where the
+  // per-party closures would otherwise dominate.
+  // Nested batches join the outermost one.
+  class WakeupBatch {
+   public:
+    WakeupBatch();
+    ~WakeupBatch();
+    WakeupBatch(const WakeupBatch&) = delete;
+    WakeupBatch& operator=(const WakeupBatch&) = delete;
+
+   private:
+    friend class Party;
+
+    // Returns the batch in scope on this thread, or nullptr.
+    static WakeupBatch* Current();
+    // Takes over running `party`, which must be locked and reffed. Returns
+    // false if it runs on a different EventEngine from the parties already
+    // in the batch.
+    bool Add(Party* party, uint64_t prev_state);
+
+    grpc_event_engine::experimental::EventEngine* event_engine_ = nullptr;
+    std::vector<std::pair<Party*, uint64_t>> parties_;
+  };
+
   // SpawnSerializer is a helper class to serialize the execution of multiple
   // promises on a party.
   //
@@ -532,6 +564,9 @@ class Party : public Activity, private Wakeable {
   static constexpr uint64_t kWakeupMask    = 0x0000'0000'0000'ffff;
   // Bits used to store 16 bits of allocated participant slots.
   static constexpr uint64_t kAllocatedMask = 0x0000'0000'ffff'0000;
+  // Bit indicating participants were queued in the overflow queue while
+  // locked
+  static constexpr uint64_t kOverflowPending = 0x0000'0001'0000'0000;
   // Bit indicating locked or not
   static constexpr uint64_t kLocked        = 0x0000'0008'0000'0000;
   // Bits used to store 24 bits of ref counts
@@ -545,6 +580,9 @@ class Party : public Activity, private Wakeable {
   // One ref count
   static constexpr uint64_t kOneRef = 1ull << kRefShift;
 
+  // Participants waiting for a free slot.
+  struct Overflow;
+
   // Destroy any remaining participants.
   // Needs to have normal context setup before calling.
   void CancelRemainingParticipants();
@@ -612,6 +650,12 @@ class Party : public Activity, private Wakeable {
   // Add a participant (backs Spawn, after type erasure to ParticipantFactory).
   size_t AddParticipant(Participant* participant);
   void MaybeAsyncAddParticipant(Participant* participant);
+  // Queue a participant until a slot frees up, and make sure the party runs
+  // to pick it up.
+  void AddOverflowParticipant(Participant* participant);
+  // Move queued participants into free slots. Must be locked.
+  void DrainOverflow();
+  bool HasOverflow();
 
   static uint64_t NextAllocationMask(uint64_t current_allocation_mask);
 
@@ -630,10 +674,13 @@ class Party : public Activity, private Wakeable {
   std::atomic<uint64_t> state_{kOneRef};
   uint8_t currently_polling_ = kNotPolling;
   WakeupMask wakeup_mask_ = 0;
+  // Set when the run loop should try to drain the overflow queue.
+  bool drain_overflow_ = false;
   // All current participants, using a tagged format.
   // If the lower bit is unset, then this is a Participant*.
   // If the lower bit is set, then this is a ParticipantFactory*.
   std::atomic<Participant*> participants_[party_detail::kMaxParticipants] = {};
+  std::atomic<Overflow*> overflow_{nullptr};
   RefCountedPtr<Arena> arena_;
 };
 
@@ -642,6 +689,15 @@ struct ContextSubclass<Party> {
   using Base = Activity;
 };
 
+// Wraps `promise` so that each poll of it runs under a Party::WakeupBatch.
+template <typename Promise>
+auto WithWakeupBatch(Promise promise) {
+  return [promise = std::move(promise)]() mutable {
+    Party::WakeupBatch batch;
+    return promise();
+  };
+}
+
 template <typename Factory, typename OnComplete>
 void Party::Spawn(absl::string_view name, Factory promise_factory,
                   OnComplete on_complete) {
@@ -22,31 +22,106 @@
 #include <grpc/support/port_platform.h>
 
 #include <atomic>
+#include <cstdint>
 #include <new>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/log/log.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/alloc.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
 namespace grpc_core {
 
 namespace {
 
-void* ArenaStorage(size_t& initial_size) {
+constexpr size_t kArenaAlignment =
+    (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
+     GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
+        ? GPR_CACHELINE_SIZE
+        : GPR_MAX_ALIGNMENT;
+
+arena_detail::ArenaBlockCache& BlockCache() {
+  static NoDestruct<arena_detail::ArenaBlockCache> cache(
+      PerCpuOptions().SetMaxShards(16));
+  return *cache;
+}
+
+void* AllocArenaBlock(size_t size, bool use_block_cache) {
+  if (use_block_cache) return BlockCache().Alloc(size);
+  return gpr_malloc_aligned(size, kArenaAlignment);
+}
+
+void FreeArenaBlock(void* p, size_t size, bool use_block_cache) {
+  if (use_block_cache) {
+    BlockCache().Free(p, size);
+  } else {
+    gpr_free_aligned(p);
+  }
+}
+
+void* ArenaStorage(size_t& initial_size, bool use_block_cache) {
   size_t base_size = Arena::ArenaOverhead() +
                      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
                          arena_detail::BaseArenaContextTraits::ContextSize());
   initial_size =
       std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
-  static constexpr size_t alignment =
-      (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
-       GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
-          ? GPR_CACHELINE_SIZE
-          : GPR_MAX_ALIGNMENT;
-  return gpr_malloc_aligned(initial_size, alignment);
+  return AllocArenaBlock(initial_size, use_block_cache);
 }
 
 }  // namespace
 
+namespace arena_detail {
+
+ArenaBlockCache::~ArenaBlockCache() {
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (size_t size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+      for (uint8_t i = 0; i < shard.counts[size_class]; ++i) {
+        gpr_free_aligned(shard.blocks[size_class][i]);
+      }
+    }
+  }
+}
+
+void* ArenaBlockCache::Alloc(size_t size) {
+  if (size > kMaxBlockSize) return gpr_malloc_aligned(size, kArenaAlignment);
+  const size_t size_class = SizeClass(size);
+  Shard& shard = shards_.this_cpu();
+  {
+    MutexLock lock(&shard.mu);
+    uint8_t& count = shard.counts[size_class];
+    if (count > 0) return shard.blocks[size_class][--count];
+  }
+  return gpr_malloc_aligned(ClassSize(size_class), kArenaAlignment);
+}
+
+void ArenaBlockCache::Free(void* p, size_t size) {
+  if (size <= kMaxBlockSize) {
+    const size_t size_class = SizeClass(size);
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    uint8_t& count = shard.counts[size_class];
+    if (count < kMaxBlocksPerClass) {
+      shard.blocks[size_class][count++] = p;
+      return;
+    }
+  }
+  gpr_free_aligned(p);
+}
+
+size_t ArenaBlockCache::SizeClass(size_t size) {
+  size_t size_class = 0;
+  while (ClassSize(size_class) < size) ++size_class;
+  return size_class;
+}
+
+}  // namespace arena_detail
+
 Arena::~Arena() {
   for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
        ++i) {
@@ -59,21 +134,25 @@ Arena::~Arena() {
   Zone* z = last_zone_;
   while (z) {
     Zone* prev_z = z->prev;
+    const size_t size = z->size;
     Destruct(z);
-    gpr_free_aligned(z);
+    FreeArenaBlock(z, size, use_block_cache_);
     z = prev_z;
   }
 }
 
 RefCountedPtr<Arena> Arena::Create(size_t initial_size,
                                    RefCountedPtr<ArenaFactory> arena_factory) {
-  void* p = ArenaStorage(initial_size);
+  const bool use_block_cache = IsArenaBlockCacheEnabled();
+  void* p = ArenaStorage(initial_size, use_block_cache);
   return RefCountedPtr<Arena>(
-      new (p) Arena(initial_size, std::move(arena_factory)));
+      new (p) Arena(initial_size, use_block_cache, std::move(arena_factory)));
 }
 
-Arena::Arena(size_t initial_size, RefCountedPtr<ArenaFactory> arena_factory)
+Arena::Arena(size_t initial_size, bool use_block_cache,
+             RefCountedPtr<ArenaFactory> arena_factory)
     : initial_zone_size_(initial_size),
+      use_block_cache_(use_block_cache),
       total_used_(ArenaOverhead() +
                   GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
                       arena_detail::BaseArenaContextTraits::ContextSize())),
@@ -100,8 +179,10 @@ void Arena::DestroyManagedNewObjects() {
 }
 
 void Arena::Destroy() const {
+  const size_t size = initial_zone_size_;
+  const bool use_block_cache = use_block_cache_;
   this->~Arena();
-  gpr_free_aligned(const_cast<Arena*>(this));
+  FreeArenaBlock(const_cast<Arena*>(this), size, use_block_cache);
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -115,7 +196,12 @@ void* Arena::AllocZone(size_t size) {
   size_t alloc_size = zone_base_size + size;
   arena_factory_->allocator().Reserve(alloc_size);
   total_allocated_.fetch_add(alloc_size, std::memory_order_relaxed);
-  Zone* z = new (gpr_malloc_aligned(alloc_size, GPR_MAX_ALIGNMENT)) Zone();
+  global_stats().IncrementArenaZoneAllocations();
+  Zone* z = new (use_block_cache_ ? BlockCache().Alloc(alloc_size)
+                                  : gpr_malloc_aligned(alloc_size,
+                                                       GPR_MAX_ALIGNMENT))
+      Zone();
+  z->size = alloc_size;
   auto* prev = last_zone_.load(std::memory_order_relaxed);
   do {
     z->prev = prev;
@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <utility>
 
 #include "absl/log/check.h"
 
@@ -32,6 +33,13 @@ void ConnectionQuota::SetMaxIncomingConnections(int max_incoming_connections) {
             max_incoming_connections, std::memory_order_release) == INT_MAX);
 }
 
+void ConnectionQuota::SetMaxCpuUtilization(
+    RefCountedPtr<CpuUtilizationSource> source, double max_cpu_utilization) {
+  CHECK(cpu_utilization_source_ == nullptr);
+  cpu_utilization_source_ = std::move(source);
+  max_cpu_utilization_ = max_cpu_utilization;
+}
+
 // Returns true if the incoming connection is allowed to be accepted on the
 // server.
 bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
@@ -40,6 +48,13 @@ bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
     return false;
   }
 
+  // Refuse the connection before its handshake, which is the expensive part
+  // of taking it on.
+  if (cpu_utilization_source_ != nullptr &&
+      cpu_utilization_source_->CpuUtilization() > max_cpu_utilization_) {
+    return false;
+  }
+
   if (max_incoming_connections_.load(std::memory_order_relaxed) == INT_MAX) {
     return true;
   }
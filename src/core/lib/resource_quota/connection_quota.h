@@ -21,13 +21,32 @@
 #include <limits>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 
+// Reports how busy the server's CPU is, so that the server can stop taking
+// on new connections when it is overloaded. Passed to the server as a
+// channel arg.
+class CpuUtilizationSource : public RefCounted<CpuUtilizationSource> {
+ public:
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.cpu_utilization_source";
+  }
+  static int ChannelArgsCompare(const CpuUtilizationSource* a,
+                                const CpuUtilizationSource* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns the current CPU utilization, where 1 means fully busy.
+  virtual double CpuUtilization() = 0;
+};
+
 // Tracks the amount of threads in a resource quota.
 class ConnectionQuota : public RefCounted<ConnectionQuota> {
  public:
@@ -40,6 +59,12 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
   // Set the maximum number of allowed incoming connections on the server.
   void SetMaxIncomingConnections(int max_incoming_connections);
 
+  // Refuse incoming connections while source reports a CPU utilization above
+  // max_cpu_utilization. Like the maximum number of connections, this can
+  // only be configured once, before the quota is used.
+  void SetMaxCpuUtilization(RefCountedPtr<CpuUtilizationSource> source,
+                            double max_cpu_utilization);
+
   // Returns true if the incoming connection is allowed to be accepted on the
   // server.
   bool AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
@@ -55,6 +80,8 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
  private:
   std::atomic<int> active_incoming_connections_{0};
   std::atomic<int> max_incoming_connections_{std::numeric_limits<int>::max()};
+  RefCountedPtr<CpuUtilizationSource> cpu_utilization_source_;
+  double max_cpu_utilization_ = 0;
 };
 
 using ConnectionQuotaRefPtr = RefCountedPtr<ConnectionQuota>;
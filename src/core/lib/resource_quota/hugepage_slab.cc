@@ -0,0 +1,211 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/hugepage_slab.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/log/check.h"
+#include "src/core/util/alloc.h"
+#include "src/core/util/no_destruct.h"
+
+#ifdef GPR_LINUX
+#include <sys/mman.h>
+#endif
+
+namespace grpc_core {
+
+HugePageSlabAllocator& HugePageSlabAllocator::Get() {
+  static NoDestruct<HugePageSlabAllocator> allocator;
+  return *allocator;
+}
+
+size_t HugePageSlabAllocator::SizeClass(size_t payload_size) {
+  size_t size_class = 0;
+  while ((kMinChunkPayload << size_class) < payload_size) ++size_class;
+  return size_class;
+}
+
+size_t HugePageSlabAllocator::ChunkPayloadSize(size_t payload_size) {
+  if (payload_size < kMinChunkPayload || payload_size > kMaxChunkPayload) {
+    return 0;
+  }
+  return kMinChunkPayload << SizeClass(payload_size);
+}
+
+size_t HugePageSlabAllocator::ChunkStride(size_t size_class) {
+  return kChunkHeaderSize + (kMinChunkPayload << size_class);
+}
+
+char* HugePageSlabAllocator::ChunkAt(Slab* slab, size_t index) {
+  return reinterpret_cast<char*>(slab) + kSlabHeaderSize +
+         index * ChunkStride(slab->size_class);
+}
+
+void* HugePageSlabAllocator::MapSlab() {
+#ifdef GPR_LINUX
+#ifdef MAP_HUGETLB
+  // Explicit huge pages, if any have been reserved. Once that fails, don't
+  // keep asking.
+  static std::atomic<bool> hugetlb_failed{false};
+  if (!hugetlb_failed.load(std::memory_order_relaxed)) {
+    void* p = mmap(nullptr, kSlabSize, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED) return p;
+    hugetlb_failed.store(true, std::memory_order_relaxed);
+  }
+#endif
+  // Otherwise map twice the size, trim to an aligned slab, and ask for
+  // transparent huge pages.
+  char* region = static_cast<char*>(mmap(nullptr, 2 * kSlabSize,
+                                         PROT_READ | PROT_WRITE,
+                                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  if (region == MAP_FAILED) return nullptr;
+  char* slab = reinterpret_cast<char*>(
+      (reinterpret_cast<uintptr_t>(region) + kSlabSize - 1) &
+      ~(uintptr_t{kSlabSize} - 1));
+  if (slab != region) munmap(region, slab - region);
+  munmap(slab + kSlabSize, region + kSlabSize - slab);
+#ifdef MADV_HUGEPAGE
+  madvise(slab, kSlabSize, MADV_HUGEPAGE);
+#endif
+  return slab;
+#else
+  return gpr_malloc_aligned(kSlabSize, kSlabSize);
+#endif
+}
+
+void HugePageSlabAllocator::UnmapSlab(void* p) {
+#ifdef GPR_LINUX
+  munmap(p, kSlabSize);
+#else
+  gpr_free_aligned(p);
+#endif
+}
+
+void HugePageSlabAllocator::Link(Slab** head, Slab* slab) {
+  slab->prev = nullptr;
+  slab->next = *head;
+  if (*head != nullptr) (*head)->prev = slab;
+  *head = slab;
+}
+
+void HugePageSlabAllocator::Unlink(Slab** head, Slab* slab) {
+  if (slab->prev != nullptr) {
+    slab->prev->next = slab->next;
+  } else {
+    *head = slab->next;
+  }
+  if (slab->next != nullptr) slab->next->prev = slab->prev;
+  slab->prev = slab->next = nullptr;
+}
+
+void HugePageSlabAllocator::FormatSlab(Slab* slab, size_t size_class) {
+  slab->prev = slab->next = nullptr;
+  slab->size_class = static_cast<uint8_t>(size_class);
+  slab->num_chunks = static_cast<uint8_t>((kSlabSize - kSlabHeaderSize) /
+                                          ChunkStride(size_class));
+  slab->num_free = slab->num_chunks;
+  // Hand out the lowest chunks first.
+  for (size_t i = 0; i < slab->num_chunks; ++i) {
+    slab->free_chunks[i] = static_cast<uint8_t>(slab->num_chunks - 1 - i);
+  }
+}
+
+void* HugePageSlabAllocator::Alloc(size_t payload_size) {
+  if (ChunkPayloadSize(payload_size) == 0) return nullptr;
+  const size_t size_class = SizeClass(payload_size);
+  MutexLock lock(&mu_);
+  Slab* slab = partial_slabs_[size_class];
+  if (slab == nullptr) {
+    if (empty_slabs_ != nullptr) {
+      slab = empty_slabs_;
+      Unlink(&empty_slabs_, slab);
+      --num_empty_slabs_;
+    } else {
+      slab = static_cast<Slab*>(MapSlab());
+      if (slab == nullptr) return nullptr;
+      ++num_slabs_;
+    }
+    FormatSlab(slab, size_class);
+    Link(&partial_slabs_[size_class], slab);
+  }
+  char* chunk = ChunkAt(slab, slab->free_chunks[--slab->num_free]);
+  if (slab->num_free == 0) Unlink(&partial_slabs_[size_class], slab);
+  return chunk;
+}
+
+void HugePageSlabAllocator::Free(void* chunk) {
+  Slab* slab = reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(chunk) &
+                                       ~(uintptr_t{kSlabSize} - 1));
+  const size_t offset =
+      static_cast<char*>(chunk) - reinterpret_cast<char*>(slab);
+  DCHECK_GE(offset, kSlabHeaderSize);
+  const size_t index =
+      (offset - kSlabHeaderSize) / ChunkStride(slab->size_class);
+  DCHECK_LT(index, slab->num_chunks);
+  void* to_unmap = nullptr;
+  {
+    MutexLock lock(&mu_);
+    Slab** partial = &partial_slabs_[slab->size_class];
+    if (slab->num_free == 0) Link(partial, slab);
+    slab->free_chunks[slab->num_free++] = static_cast<uint8_t>(index);
+    if (slab->num_free == slab->num_chunks) {
+      Unlink(partial, slab);
+      if (num_empty_slabs_ < kMaxEmptySlabs) {
+        Link(&empty_slabs_, slab);
+        ++num_empty_slabs_;
+      } else {
+        --num_slabs_;
+        to_unmap = slab;
+      }
+    }
+  }
+  if (to_unmap != nullptr) UnmapSlab(to_unmap);
+}
+
+size_t HugePageSlabAllocator::ReleaseEmptySlabs() {
+  Slab* slabs;
+  size_t released;
+  {
+    MutexLock lock(&mu_);
+    slabs = empty_slabs_;
+    released = num_empty_slabs_ * kSlabSize;
+    num_slabs_ -= num_empty_slabs_;
+    empty_slabs_ = nullptr;
+    num_empty_slabs_ = 0;
+  }
+  while (slabs != nullptr) {
+    Slab* next = slabs->next;
+    UnmapSlab(slabs);
+    slabs = next;
+  }
+  return released;
+}
+
+size_t HugePageSlabAllocator::NumSlabs() {
+  MutexLock lock(&mu_);
+  return num_slabs_;
+}
+
+size_t HugePageSlabAllocator::NumEmptySlabs() {
+  MutexLock lock(&mu_);
+  return num_empty_slabs_;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,116 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_HUGEPAGE_SLAB_H
+#define GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_HUGEPAGE_SLAB_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Carves the large buffers behind MemoryAllocator::MakeSlice out of 2MB slabs
+// backed by huge pages, to cut the TLB misses of bulk streaming.
+//
+// Slabs are explicit huge pages (MAP_HUGETLB) when the system has some
+// reserved, and otherwise ordinary memory advised for transparent huge pages.
+// Each slab is cut into equal chunks of one size class: a power of two payload
+// between kMinChunkPayload and kMaxChunkPayload, preceded by kChunkHeaderSize
+// bytes for the owner's bookkeeping (the slice refcount). Requests outside
+// that range aren't served from slabs.
+//
+// Slabs whose chunks are all free are kept, up to kMaxEmptySlabs, to be
+// reformatted for whichever size class needs a slab next. ReleaseEmptySlabs()
+// returns them to the system; memory quotas do this when they come under
+// pressure.
+class HugePageSlabAllocator {
+ public:
+  static constexpr size_t kSlabSize = 2 * 1024 * 1024;
+  static constexpr size_t kChunkHeaderSize = 64;
+  static constexpr size_t kMinChunkPayloadLog2 = 14;
+  static constexpr size_t kMaxChunkPayloadLog2 = 18;
+  static constexpr size_t kMinChunkPayload = size_t{1}
+                                             << kMinChunkPayloadLog2;
+  static constexpr size_t kMaxChunkPayload = size_t{1}
+                                             << kMaxChunkPayloadLog2;
+  static constexpr size_t kMaxEmptySlabs = 8;
+
+  static HugePageSlabAllocator& Get();
+
+  // The payload size of the chunk that would hold payload_size bytes, or 0 if
+  // allocations of that size aren't served from slabs.
+  static size_t ChunkPayloadSize(size_t payload_size);
+
+  // Return a chunk of kChunkHeaderSize + ChunkPayloadSize(payload_size)
+  // bytes, or nullptr if payload_size isn't served from slabs or no slab could
+  // be allocated.
+  void* Alloc(size_t payload_size);
+  // Return a chunk from Alloc().
+  void Free(void* chunk);
+
+  // Return all empty slabs to the system. Returns the number of bytes
+  // released.
+  size_t ReleaseEmptySlabs();
+
+  // Number of slabs currently allocated, and of those, how many are empty.
+  size_t NumSlabs();
+  size_t NumEmptySlabs();
+
+ private:
+  static constexpr size_t kNumSizeClasses =
+      kMaxChunkPayloadLog2 - kMinChunkPayloadLog2 + 1;
+  static constexpr size_t kSlabHeaderSize = 256;
+  static constexpr size_t kMaxChunksPerSlab =
+      (kSlabSize - kSlabHeaderSize) / (kMinChunkPayload + kChunkHeaderSize);
+
+  // Lives in the first kSlabHeaderSize bytes of each slab.
+  struct Slab {
+    // Links in partial_slabs_[size_class] or empty_slabs_.
+    Slab* prev;
+    Slab* next;
+    uint8_t size_class;
+    uint8_t num_chunks;
+    uint8_t num_free;
+    // Indices of the free chunks; the first num_free are valid.
+    uint8_t free_chunks[kMaxChunksPerSlab];
+  };
+  static_assert(sizeof(Slab) <= kSlabHeaderSize, "slab header too big");
+  static_assert(kMaxChunksPerSlab <= 255, "chunk indices must fit uint8_t");
+
+  static size_t SizeClass(size_t payload_size);
+  static size_t ChunkStride(size_t size_class);
+  static char* ChunkAt(Slab* slab, size_t index);
+  static void* MapSlab();
+  static void UnmapSlab(void* p);
+
+  void FormatSlab(Slab* slab, size_t size_class);
+  static void Link(Slab** head, Slab* slab);
+  static void Unlink(Slab** head, Slab* slab);
+
+  Mutex mu_;
+  // Slabs with both used and free chunks, by size class. Slabs with no free
+  // chunk aren't on any list.
+  Slab* partial_slabs_[kNumSizeClasses] ABSL_GUARDED_BY(mu_) = {};
+  Slab* empty_slabs_ ABSL_GUARDED_BY(mu_) = nullptr;
+  size_t num_empty_slabs_ ABSL_GUARDED_BY(mu_) = 0;
+  size_t num_slabs_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_HUGEPAGE_SLAB_H
@@ -38,6 +38,7 @@
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/lib/resource_quota/hugepage_slab.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/util/mpscq.h"
 #include "src/core/util/useful.h"
@@ -52,6 +53,12 @@ constexpr size_t kMaxReplenishBytes = 1024 * 1024;
 // Minimum number of bytes an allocator will request from a quota in one step.
 constexpr size_t kMinReplenishBytes = 4096;
 
+// Most free bytes a per-cpu shard of a quota will hold.
+constexpr intptr_t kMaxFreeBytesPerShard = 1024 * 1024;
+// If the quota is too small to give each shard at least this much, shards
+// aren't used at all.
+constexpr intptr_t kMinFreeBytesPerShard = 16 * 1024;
+
 class MemoryQuotaTracker {
  public:
   static MemoryQuotaTracker& Get() {
@@ -100,14 +107,16 @@ class MemoryQuotaTracker {
 
 // Reference count for a slice allocated by MemoryAllocator::MakeSlice.
 // Takes care of releasing memory back when the slice is destroyed.
+// If in_slab, the slice lives in a HugePageSlabAllocator chunk rather than a
+// malloc()ed block.
 class SliceRefCount : public grpc_slice_refcount {
  public:
   SliceRefCount(
       std::shared_ptr<
           grpc_event_engine::experimental::internal::MemoryAllocatorImpl>
           allocator,
-      size_t size)
-      : grpc_slice_refcount(Destroy),
+      size_t size, bool in_slab = false)
+      : grpc_slice_refcount(in_slab ? DestroyInSlab : Destroy),
         allocator_(std::move(allocator)),
         size_(size) {
     // Nothing to do here.
@@ -124,12 +133,21 @@ class SliceRefCount : public grpc_slice_refcount {
     free(rc);
   }
 
+  static void DestroyInSlab(grpc_slice_refcount* p) {
+    auto* rc = static_cast<SliceRefCount*>(p);
+    rc->~SliceRefCount();
+    HugePageSlabAllocator::Get().Free(rc);
+  }
+
   std::shared_ptr<
       grpc_event_engine::experimental::internal::MemoryAllocatorImpl>
       allocator_;
   size_t size_;
 };
 
+static_assert(sizeof(SliceRefCount) <= HugePageSlabAllocator::kChunkHeaderSize,
+              "SliceRefCount must fit in a slab chunk header");
+
 std::atomic<double> container_memory_pressure{0.0};
 
 }  // namespace
@@ -387,6 +405,27 @@ void GrpcMemoryAllocatorImpl::Replenish() {
 }
 
 grpc_slice GrpcMemoryAllocatorImpl::MakeSlice(MemoryRequest request) {
+  if (IsHugepageSliceSlabsEnabled()) {
+    const size_t chunk_payload =
+        HugePageSlabAllocator::ChunkPayloadSize(request.min());
+    void* chunk = chunk_payload == 0
+                      ? nullptr
+                      : HugePageSlabAllocator::Get().Alloc(request.min());
+    if (chunk != nullptr) {
+      // Account for the refcount as the malloc path does, so that quota usage
+      // doesn't depend on where the slice came from.
+      auto size = Reserve(
+          MemoryRequest(request.min(), std::min(request.max(), chunk_payload))
+              .Increase(sizeof(SliceRefCount)));
+      new (chunk) SliceRefCount(shared_from_this(), size, /*in_slab=*/true);
+      grpc_slice slice;
+      slice.refcount = static_cast<SliceRefCount*>(chunk);
+      slice.data.refcounted.bytes = static_cast<uint8_t*>(chunk) +
+                                    HugePageSlabAllocator::kChunkHeaderSize;
+      slice.data.refcounted.length = size - sizeof(SliceRefCount);
+      return slice;
+    }
+  }
   auto size = Reserve(request.Increase(sizeof(SliceRefCount)));
   void* p = malloc(size);
   new (p) SliceRefCount(shared_from_this(), size);
@@ -422,7 +461,9 @@ class BasicMemoryQuota::WaitForSweepPromise {
   uint64_t token_;
 };
 
-BasicMemoryQuota::BasicMemoryQuota(std::string name) : name_(std::move(name)) {}
+BasicMemoryQuota::BasicMemoryQuota(std::string name) : name_(std::move(name)) {
+  UpdateFreeBytesShardLimit(kInitialSize);
+}
 
 void BasicMemoryQuota::Start() {
   auto self = shared_from_this();
@@ -440,9 +481,23 @@ void BasicMemoryQuota::Start() {
           if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
             return Pending{};
           }
+          // Don't reclaim memory that's only parked on a shard.
+          if (IsPerCpuMemoryQuotaEnabled()) {
+            self->ReconcileFreeBytes();
+            if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
+              return Pending{};
+            }
+          }
           return 0;
         },
         [self]() {
+          // Empty huge page slabs are the cheapest memory to give back.
+          // They aren't charged to any quota, so this alone won't end the
+          // overcommit, but it shrinks the process before anything else is
+          // asked to.
+          if (IsHugepageSliceSlabsEnabled()) {
+            HugePageSlabAllocator::Get().ReleaseEmptySlabs();
+          }
           // Race biases to the first thing that completes... so this will
           // choose the highest priority/least destructive thing to do that's
           // available.
@@ -497,6 +552,7 @@ void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
+  UpdateFreeBytesShardLimit(new_size);
   if (old_size < new_size) {
     // We're growing the quota.
     Return(new_size - old_size);
@@ -510,11 +566,13 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   DCHECK(amount <= std::numeric_limits<intptr_t>::max());
-  // Grab memory from the quota.
-  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  if (!IsPerCpuMemoryQuotaEnabled() || !TakeFromShard(amount)) {
+    // Grab memory from the quota.
+    auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
+    // If we push into overcommit, awake the reclaimer.
+    if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
+      if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+    }
   }
 
   if (IsFreeLargeAllocatorEnabled()) {
@@ -555,9 +613,76 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  if (IsPerCpuMemoryQuotaEnabled() && ReturnToShard(amount)) return;
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
+bool BasicMemoryQuota::TakeFromShard(size_t amount) {
+  const intptr_t limit =
+      free_bytes_shard_limit_.load(std::memory_order_relaxed);
+  const intptr_t want = static_cast<intptr_t>(amount);
+  if (want > limit) return false;
+  std::atomic<intptr_t>& shard = free_bytes_shards_.this_cpu().free_bytes;
+  intptr_t available = shard.load(std::memory_order_relaxed);
+  while (available >= want) {
+    if (shard.compare_exchange_weak(available, available - want,
+                                    std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  // Take this request plus enough to bring the shard up to half its limit,
+  // but only if that leaves the quota out of overcommit: otherwise let the
+  // caller take just what it needs, and wake the reclaimer if need be.
+  const intptr_t refill = std::max(intptr_t{0}, limit / 2 - available);
+  intptr_t free = free_bytes_.load(std::memory_order_relaxed);
+  while (free >= want + refill) {
+    if (free_bytes_.compare_exchange_weak(free, free - want - refill,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed)) {
+      if (refill > 0) shard.fetch_add(refill, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BasicMemoryQuota::ReturnToShard(size_t amount) {
+  const intptr_t limit =
+      free_bytes_shard_limit_.load(std::memory_order_relaxed);
+  const intptr_t give = static_cast<intptr_t>(amount);
+  if (give > limit) return false;
+  // While in overcommit returned memory must be visible to the reclaimer.
+  if (free_bytes_.load(std::memory_order_relaxed) <= 0) return false;
+  std::atomic<intptr_t>& shard = free_bytes_shards_.this_cpu().free_bytes;
+  intptr_t parked = shard.fetch_add(give, std::memory_order_relaxed) + give;
+  while (parked > limit) {
+    if (shard.compare_exchange_weak(parked, limit / 2,
+                                    std::memory_order_relaxed)) {
+      free_bytes_.fetch_add(parked - limit / 2, std::memory_order_relaxed);
+      break;
+    }
+  }
+  return true;
+}
+
+void BasicMemoryQuota::ReconcileFreeBytes() {
+  for (FreeBytesShard& shard : free_bytes_shards_) {
+    intptr_t parked = shard.free_bytes.exchange(0, std::memory_order_relaxed);
+    if (parked != 0) free_bytes_.fetch_add(parked, std::memory_order_relaxed);
+  }
+}
+
+void BasicMemoryQuota::UpdateFreeBytesShardLimit(size_t quota_size) {
+  const size_t shards = free_bytes_shards_.end() - free_bytes_shards_.begin();
+  intptr_t limit = static_cast<intptr_t>(
+      std::min<size_t>(quota_size / 64 / shards, kMaxFreeBytesPerShard));
+  if (limit < kMinFreeBytesPerShard) limit = 0;
+  free_bytes_shard_limit_.store(limit, std::memory_order_relaxed);
+  // Anything over the new limit would otherwise stay parked until the next
+  // return to that shard.
+  ReconcileFreeBytes();
+}
+
 void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
   GRPC_TRACE_LOG(resource_quota, INFO) << "Adding allocator " << allocator;
 
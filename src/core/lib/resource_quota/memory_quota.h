@@ -41,6 +41,7 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/periodic_update.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
@@ -348,8 +349,26 @@ class BasicMemoryQuota final
     std::array<Shard, 16> shards;
   };
 
+  // Free bytes parked on one shard of the quota (see per_cpu_memory_quota).
+  struct alignas(GPR_CACHELINE_SIZE) FreeBytesShard {
+    std::atomic<intptr_t> free_bytes{0};
+  };
+
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
 
+  // Take amount from this cpu's shard, refilling it from free_bytes_ if the
+  // quota can spare it. Returns false if the caller must take from
+  // free_bytes_ directly.
+  bool TakeFromShard(size_t amount);
+  // Return amount to this cpu's shard, spilling to free_bytes_ whatever takes
+  // the shard over its limit. Returns false if the caller must return to
+  // free_bytes_ directly.
+  bool ReturnToShard(size_t amount);
+  // Move everything parked on the shards back to free_bytes_.
+  void ReconcileFreeBytes();
+  // Recompute free_bytes_shard_limit_ for a quota of quota_size bytes.
+  void UpdateFreeBytesShardLimit(size_t quota_size);
+
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
   // Move allocator from small bucket to big bucket.
@@ -361,6 +380,14 @@ class BasicMemoryQuota final
   std::atomic<intptr_t> free_bytes_{kInitialSize};
   // The total number of bytes in this quota.
   std::atomic<size_t> quota_size_{kInitialSize};
+  // Free bytes parked per cpu, so that allocators on different cores don't
+  // all contend on free_bytes_. Each shard holds at most
+  // free_bytes_shard_limit_ bytes, which is sized so that all shards together
+  // can't hold more than 1/64th of the quota: memory pressure is computed
+  // from free_bytes_ alone, and is off by at most that much.
+  PerCpu<FreeBytesShard> free_bytes_shards_{
+      PerCpuOptions().SetCpusPerShard(2).SetMaxShards(32)};
+  std::atomic<intptr_t> free_bytes_shard_limit_{0};
 
   // Reclaimer queues.
   ReclaimerQueue reclaimers_[kNumReclamationPasses];
@@ -451,6 +478,11 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
     return free_bytes_.load(std::memory_order_relaxed);
   }
 
+  // Bytes taken from the quota, including those cached in free bytes.
+  size_t GetTakenBytes() const {
+    return taken_bytes_.load(std::memory_order_relaxed);
+  }
+
   size_t IncrementShardIndex() {
     return chosen_shard_idx_.fetch_add(1, std::memory_order_relaxed);
   }
@@ -530,6 +562,14 @@ class MemoryOwner final : public MemoryAllocator {
   // Is this object valid (ie has not been moved out of or reset)
   bool is_valid() const { return impl() != nullptr; }
 
+  // A handle for reporting on the memory held by this owner, that does not
+  // keep the underlying allocator alive.
+  std::weak_ptr<const GrpcMemoryAllocatorImpl> allocator_for_reporting() const {
+    if (!is_valid()) return {};
+    return std::static_pointer_cast<const GrpcMemoryAllocatorImpl>(
+        impl()->shared_from_this());
+  }
+
   static double memory_pressure_high_threshold() { return 0.99; }
 
   // Return true if the controlled memory pressure is high.
@@ -576,6 +616,11 @@ class MemoryQuota final
            MemoryOwner::memory_pressure_high_threshold();
   }
 
+  // Current pressure on the quota, between 0 and 1.
+  double GetPressure() const {
+    return memory_quota_->GetPressureInfo().pressure_control_value;
+  }
+
  private:
   friend class MemoryOwner;
   std::shared_ptr<BasicMemoryQuota> memory_quota_;
@@ -0,0 +1,131 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/method_quota.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/util/random_early_detection.h"
+
+namespace grpc_core {
+
+namespace {
+// Memory pressure is fed to RandomEarlyDetection scaled by this much.
+constexpr double kPressureScale = 1000;
+
+// The range of memory pressure over which calls to methods of each priority
+// go from never to always being shed.
+RandomEarlyDetection PressureShedding(MethodQuotas::Priority priority) {
+  switch (priority) {
+    case MethodQuotas::Priority::kLow:
+      return RandomEarlyDetection(800, 900);
+    case MethodQuotas::Priority::kNormal:
+      return RandomEarlyDetection(900, 980);
+    case MethodQuotas::Priority::kHigh:
+      break;
+  }
+  return RandomEarlyDetection();
+}
+}  // namespace
+
+void MethodQuotas::Admission::ReportUsage(size_t bytes) {
+  if (method_ == nullptr) return;
+  // Exponentially weighted, so that the estimate follows changes in the
+  // workload without being thrown by any one unusual call.
+  const size_t estimate =
+      method_->call_estimate.load(std::memory_order_relaxed);
+  method_->call_estimate.store(std::max<size_t>(1, (estimate * 7 + bytes) / 8),
+                               std::memory_order_relaxed);
+}
+
+void MethodQuotas::Admission::Release() {
+  if (method_ == nullptr) return;
+  method_->in_flight_bytes.fetch_sub(charge_, std::memory_order_relaxed);
+  method_.reset();
+}
+
+void MethodQuotas::SetBudget(absl::string_view name, Budget budget) {
+  std::shared_ptr<const MethodMap> retired;
+  {
+    MutexLock lock(&mu_);
+    std::shared_ptr<const MethodMap> current = methods_.Get();
+    auto methods = current == nullptr ? std::make_shared<MethodMap>()
+                                      : std::make_shared<MethodMap>(*current);
+    (*methods)[name] = MakeRefCounted<Method>(budget);
+    retired = methods_.Exchange(std::move(methods));
+    has_budgets_.store(true, std::memory_order_relaxed);
+  }
+}
+
+RefCountedPtr<MethodQuotas::Method> MethodQuotas::Find(
+    const MethodMap& methods, absl::string_view path) {
+  auto it = methods.find(path);
+  if (it != methods.end()) return it->second;
+  // Fall back to the budget of the method's service.
+  const size_t slash = path.rfind('/');
+  if (slash == absl::string_view::npos || slash + 1 == path.size()) {
+    return nullptr;
+  }
+  it = methods.find(path.substr(0, slash + 1));
+  if (it != methods.end()) return it->second;
+  return nullptr;
+}
+
+absl::StatusOr<MethodQuotas::Admission> MethodQuotas::Admit(
+    absl::string_view path, double memory_pressure) {
+  if (!has_budgets()) return Admission();
+  RefCountedPtr<Method> method =
+      methods_.Read([path](const std::shared_ptr<const MethodMap>& methods) {
+        return methods == nullptr ? nullptr : Find(*methods, path);
+      });
+  if (method == nullptr) return Admission();
+  thread_local absl::InsecureBitGen bitgen;
+  const Budget& budget = method->budget;
+  if (PressureShedding(budget.priority)
+          .Reject(static_cast<uint64_t>(memory_pressure * kPressureScale),
+                  bitgen)) {
+    return absl::ResourceExhaustedError(
+        absl::StrCat("Shedding ", path, " under memory pressure"));
+  }
+  const size_t charge = method->call_estimate.load(std::memory_order_relaxed);
+  const size_t in_flight =
+      method->in_flight_bytes.fetch_add(charge, std::memory_order_relaxed) +
+      charge;
+  Admission admission(std::move(method), charge);
+  // Start shedding calls once three quarters of the budget is in use, so that
+  // the budget is approached gradually rather than hit all at once.
+  if (in_flight > budget.max_bytes ||
+      RandomEarlyDetection(budget.max_bytes - budget.max_bytes / 4,
+                           budget.max_bytes)
+          .Reject(in_flight, bitgen)) {
+    return absl::ResourceExhaustedError(
+        absl::StrCat("Memory budget for ", path, " exhausted"));
+  }
+  return admission;
+}
+
+size_t MethodQuotas::TestOnlyInFlightBytes(absl::string_view name) {
+  std::shared_ptr<const MethodMap> methods = methods_.Get();
+  if (methods == nullptr) return 0;
+  auto it = methods->find(name);
+  if (it == methods->end()) return 0;
+  return it->second->in_flight_bytes.load(std::memory_order_relaxed);
+}
+
+}  // namespace grpc_core
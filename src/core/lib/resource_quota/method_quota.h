@@ -0,0 +1,152 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_METHOD_QUOTA_H
+#define GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_METHOD_QUOTA_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/rcu.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Per-method (or per-service) memory budgets carved out of a resource quota.
+// Servers consult these when a call's initial metadata arrives, before any of
+// its messages are read, so that a burst of calls to one expensive method
+// cannot starve every other method of memory, and so that low priority
+// methods are shed first as the quota as a whole comes under pressure.
+//
+// Calls are charged by an estimate of how much memory they will use, which is
+// learned from the memory used by previous calls to the same method.
+class MethodQuotas : public RefCounted<MethodQuotas> {
+ private:
+  struct Method;
+
+ public:
+  enum class Priority : uint8_t {
+    // Shed first as memory pressure rises.
+    kLow,
+    kNormal,
+    // Never shed because of memory pressure; still subject to max_bytes.
+    kHigh,
+  };
+
+  struct Budget {
+    // Upper bound on the estimated memory of all in flight calls.
+    size_t max_bytes = std::numeric_limits<size_t>::max();
+    Priority priority = Priority::kNormal;
+  };
+
+  // What a call was charged on admission. Returns the charge to its method
+  // when destroyed.
+  class Admission {
+   public:
+    Admission() = default;
+    ~Admission() { Release(); }
+
+    Admission(const Admission&) = delete;
+    Admission& operator=(const Admission&) = delete;
+    Admission(Admission&& other) noexcept
+        : method_(std::move(other.method_)), charge_(other.charge_) {}
+    Admission& operator=(Admission&& other) noexcept {
+      Release();
+      method_ = std::move(other.method_);
+      charge_ = other.charge_;
+      return *this;
+    }
+
+    // Report how much memory the call actually used, to refine the estimate
+    // charged to later calls to the same method.
+    void ReportUsage(size_t bytes);
+
+    size_t charge() const { return method_ == nullptr ? 0 : charge_; }
+
+   private:
+    friend class MethodQuotas;
+
+    Admission(RefCountedPtr<Method> method, size_t charge)
+        : method_(std::move(method)), charge_(charge) {}
+
+    void Release();
+
+    RefCountedPtr<Method> method_;
+    size_t charge_ = 0;
+  };
+
+  // The estimate charged to calls to a method before any have completed.
+  static constexpr size_t kInitialCallEstimate = 8 * 1024;
+
+  MethodQuotas() = default;
+
+  MethodQuotas(const MethodQuotas&) = delete;
+  MethodQuotas& operator=(const MethodQuotas&) = delete;
+
+  // Set the budget for a method ("/package.Service/Method") or for all methods
+  // of a service that have no budget of their own ("/package.Service/").
+  // Calls already admitted remain charged against the previous budget.
+  void SetBudget(absl::string_view name, Budget budget);
+
+  bool has_budgets() const {
+    return has_budgets_.load(std::memory_order_relaxed);
+  }
+
+  // Decide whether a call to path may proceed, given the overall pressure
+  // (between 0 and 1) on the memory quota. Calls to methods without a budget
+  // are always admitted. Takes no lock: budgets are read through an Rcu and
+  // charged with atomics.
+  absl::StatusOr<Admission> Admit(absl::string_view path,
+                                  double memory_pressure);
+
+  size_t TestOnlyInFlightBytes(absl::string_view name);
+
+ private:
+  struct Method : public RefCounted<Method> {
+    explicit Method(Budget budget) : budget(budget) {}
+
+    const Budget budget;
+    std::atomic<size_t> in_flight_bytes{0};
+    std::atomic<size_t> call_estimate{kInitialCallEstimate};
+  };
+
+  // Budgets are set rarely, and usually before the server starts, so each
+  // SetBudget() publishes a new copy of the map.
+  using MethodMap = absl::flat_hash_map<std::string, RefCountedPtr<Method>>;
+
+  static RefCountedPtr<Method> Find(const MethodMap& methods,
+                                    absl::string_view path);
+
+  // Serializes SetBudget() calls.
+  Mutex mu_;
+  Rcu<std::shared_ptr<const MethodMap>> methods_;
+  std::atomic<bool> has_budgets_{false};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_METHOD_QUOTA_H
@@ -24,6 +24,7 @@
 
 #include "absl/strings/string_view.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/method_quota.h"
 #include "src/core/lib/resource_quota/thread_quota.h"
 #include "src/core/util/cpp_impl_of.h"
 #include "src/core/util/ref_counted.h"
@@ -51,6 +52,8 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
 
   const RefCountedPtr<ThreadQuota>& thread_quota() { return thread_quota_; }
 
+  const RefCountedPtr<MethodQuotas>& method_quotas() { return method_quotas_; }
+
   // The default global resource quota
   static ResourceQuotaRefPtr Default();
 
@@ -62,6 +65,7 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
  private:
   MemoryQuotaRefPtr memory_quota_;
   RefCountedPtr<ThreadQuota> thread_quota_;
+  RefCountedPtr<MethodQuotas> method_quotas_;
 };
 
 inline ResourceQuotaRefPtr MakeResourceQuota(std::string name) {
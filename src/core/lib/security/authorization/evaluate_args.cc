@@ -28,6 +28,7 @@
 #include "src/core/lib/security/credentials/tls/tls_utils.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/util/host_port.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/uri.h"
 
 namespace grpc_core {
@@ -130,6 +131,16 @@ std::optional<absl::string_view> EvaluateArgs::GetHeaderValue(
   return metadata_->GetStringValue(key, concatenated_value);
 }
 
+std::optional<absl::string_view> EvaluateArgs::GetHeaderValue(
+    absl::string_view key) const {
+  auto it = header_values_.find(key);
+  if (it == header_values_.end()) {
+    it = header_values_.emplace(std::string(key), HeaderValue()).first;
+    it->second.value = GetHeaderValue(key, &it->second.concatenated_value);
+  }
+  return it->second.value;
+}
+
 grpc_resolved_address EvaluateArgs::GetLocalAddress() const {
   if (channel_args_ == nullptr) {
     return {};
@@ -186,16 +197,18 @@ absl::string_view EvaluateArgs::GetSpiffeId() const {
   return channel_args_->spiffe_id;
 }
 
-std::vector<absl::string_view> EvaluateArgs::GetUriSans() const {
+const std::vector<absl::string_view>& EvaluateArgs::GetUriSans() const {
+  static const NoDestruct<std::vector<absl::string_view>> kEmpty;
   if (channel_args_ == nullptr) {
-    return {};
+    return *kEmpty;
   }
   return channel_args_->uri_sans;
 }
 
-std::vector<absl::string_view> EvaluateArgs::GetDnsSans() const {
+const std::vector<absl::string_view>& EvaluateArgs::GetDnsSans() const {
+  static const NoDestruct<std::vector<absl::string_view>> kEmpty;
   if (channel_args_ == nullptr) {
-    return {};
+    return *kEmpty;
   }
   return channel_args_->dns_sans;
 }
@@ -18,6 +18,8 @@
 #include <grpc/grpc_security.h>
 #include <grpc/support/port_platform.h>
 
+#include <functional>
+#include <map>
 #include <optional>
 #include <string>
 #include <vector>
@@ -57,6 +59,10 @@ class EvaluateArgs final {
   EvaluateArgs(grpc_metadata_batch* metadata, PerChannelArgs* channel_args)
       : metadata_(metadata), channel_args_(channel_args) {}
 
+  // Not copyable, since memoized values may point into this object.
+  EvaluateArgs(const EvaluateArgs&) = delete;
+  EvaluateArgs& operator=(const EvaluateArgs&) = delete;
+
   absl::string_view GetPath() const;
   absl::string_view GetAuthority() const;
   absl::string_view GetMethod() const;
@@ -69,6 +75,10 @@ class EvaluateArgs final {
   // string_view of that string.
   std::optional<absl::string_view> GetHeaderValue(
       absl::string_view key, std::string* concatenated_value) const;
+  // Same as above, but memoizes the value of each key, so that the matchers of
+  // a policy that look up the same header only extract it from the batch
+  // once. The returned value is valid for as long as this object is.
+  std::optional<absl::string_view> GetHeaderValue(absl::string_view key) const;
 
   grpc_resolved_address GetLocalAddress() const;
   absl::string_view GetLocalAddressString() const;
@@ -78,14 +88,23 @@ class EvaluateArgs final {
   int GetPeerPort() const;
   absl::string_view GetTransportSecurityType() const;
   absl::string_view GetSpiffeId() const;
-  std::vector<absl::string_view> GetUriSans() const;
-  std::vector<absl::string_view> GetDnsSans() const;
+  const std::vector<absl::string_view>& GetUriSans() const;
+  const std::vector<absl::string_view>& GetDnsSans() const;
   absl::string_view GetCommonName() const;
   absl::string_view GetSubject() const;
 
  private:
+  struct HeaderValue {
+    std::optional<absl::string_view> value;
+    // Backs value when the key is present more than once.
+    std::string concatenated_value;
+  };
+
   grpc_metadata_batch* metadata_;
   PerChannelArgs* channel_args_;
+  // Memoized by GetHeaderValue(). A node-based map, so that values do not move
+  // when other keys are added.
+  mutable std::map<std::string, HeaderValue, std::less<>> header_values_;
 };
 
 }  // namespace grpc_core
@@ -42,6 +42,42 @@ bool ShouldLog(const Decision& decision,
           condition == Rbac::AuditCondition::kOnDeny);
 }
 
+// Adds to paths the values of :path that a request must have for permission to
+// match it. Returns false if permission can also match other paths, in which
+// case paths is left unchanged.
+bool CollectRequiredPaths(const Rbac::Permission& permission,
+                          std::vector<std::string>* paths) {
+  switch (permission.type) {
+    case Rbac::Permission::RuleType::kPath: {
+      const StringMatcher& matcher = permission.string_matcher;
+      if (matcher.type() != StringMatcher::Type::kExact ||
+          !matcher.case_sensitive()) {
+        return false;
+      }
+      paths->push_back(matcher.string_matcher());
+      return true;
+    }
+    case Rbac::Permission::RuleType::kOr: {
+      // Only matches if one of the rules does, so every rule has to be
+      // restricted to a set of paths.
+      std::vector<std::string> rule_paths;
+      for (const auto& rule : permission.permissions) {
+        if (!CollectRequiredPaths(*rule, &rule_paths)) return false;
+      }
+      for (auto& path : rule_paths) paths->push_back(std::move(path));
+      return true;
+    }
+    case Rbac::Permission::RuleType::kAnd:
+      // Only matches if all the rules do, so any restricted rule will do.
+      for (const auto& rule : permission.permissions) {
+        if (CollectRequiredPaths(*rule, paths)) return true;
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
@@ -49,6 +85,18 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
       action_(policy.action),
       audit_condition_(policy.audit_condition) {
   for (auto& sub_policy : policy.policies) {
+    const size_t index = policies_.size();
+    std::vector<std::string> paths;
+    if (CollectRequiredPaths(sub_policy.second.permissions, &paths)) {
+      for (auto& path : paths) {
+        std::vector<size_t>& indices = policies_by_path_[std::move(path)];
+        if (indices.empty() || indices.back() != index) {
+          indices.push_back(index);
+        }
+      }
+    } else {
+      unindexed_policies_.push_back(index);
+    }
     Policy policy;
     policy.name = sub_policy.first;
     policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
@@ -68,6 +116,8 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     : name_(std::move(other.name_)),
       action_(other.action_),
       policies_(std::move(other.policies_)),
+      policies_by_path_(std::move(other.policies_by_path_)),
+      unindexed_policies_(std::move(other.unindexed_policies_)),
       audit_condition_(other.audit_condition_),
       audit_loggers_(std::move(other.audit_loggers_)) {}
 
@@ -76,6 +126,8 @@ GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
   name_ = std::move(other.name_);
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  policies_by_path_ = std::move(other.policies_by_path_);
+  unindexed_policies_ = std::move(other.unindexed_policies_);
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
   return *this;
@@ -85,7 +137,26 @@ AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
   bool matches = false;
-  for (const auto& policy : policies_) {
+  const std::vector<size_t>* indexed_policies = nullptr;
+  if (!policies_by_path_.empty()) {
+    auto it = policies_by_path_.find(args.GetPath());
+    if (it != policies_by_path_.end()) indexed_policies = &it->second;
+  }
+  // Merges the candidates in policy order, so that the matching policy is the
+  // first one in the whole list.
+  size_t i = 0;
+  size_t j = 0;
+  const size_t num_indexed =
+      indexed_policies == nullptr ? 0 : indexed_policies->size();
+  while (i < unindexed_policies_.size() || j < num_indexed) {
+    size_t index;
+    if (j < num_indexed && (i == unindexed_policies_.size() ||
+                            (*indexed_policies)[j] < unindexed_policies_[i])) {
+      index = (*indexed_policies)[j++];
+    } else {
+      index = unindexed_policies_[i++];
+    }
+    const Policy& policy = policies_[index];
     if (policy.matcher->Matches(args)) {
       matches = true;
       decision.matching_policy_name = policy.name;
@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/authorization/matchers.h"
@@ -38,6 +39,10 @@ using experimental::AuditLogger;
 // engine type. This engine ignores condition field in RBAC config. It is the
 // caller's responsibility to provide RBAC policies that are compatible with
 // this engine.
+//
+// Policies whose permissions only match a set of exact paths are indexed by
+// path when the engine is built, so that requests are only evaluated against
+// those policies when their :path is in that set.
 class GrpcAuthorizationEngine : public AuthorizationEngine {
  public:
   // Builds GrpcAuthorizationEngine without any policies.
@@ -75,6 +80,12 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
   std::string name_;
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  // Indices into policies_ of the policies that can only match requests with
+  // that :path, in increasing order.
+  absl::flat_hash_map<std::string, std::vector<size_t>> policies_by_path_;
+  // Indices into policies_ of the policies that are not in policies_by_path_,
+  // in increasing order.
+  std::vector<size_t> unindexed_policies_;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
 };
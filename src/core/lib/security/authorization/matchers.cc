@@ -145,9 +145,7 @@ bool NotAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
 }
 
 bool HeaderAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
-  std::string concatenated_value;
-  return matcher_.Match(
-      args.GetHeaderValue(matcher_.name(), &concatenated_value));
+  return matcher_.Match(args.GetHeaderValue(matcher_.name()));
 }
 
 IpAuthorizationMatcher::IpAuthorizationMatcher(Type type, Rbac::CidrRange range)
@@ -198,7 +196,7 @@ bool AuthenticatedAuthorizationMatcher::Matches(
     // Allows any authenticated user.
     return true;
   }
-  std::vector<absl::string_view> uri_sans = args.GetUriSans();
+  const std::vector<absl::string_view>& uri_sans = args.GetUriSans();
   if (!uri_sans.empty()) {
     for (const auto& uri : uri_sans) {
       if (matcher_->Match(uri)) {
@@ -206,7 +204,7 @@ bool AuthenticatedAuthorizationMatcher::Matches(
       }
     }
   }
-  std::vector<absl::string_view> dns_sans = args.GetDnsSans();
+  const std::vector<absl::string_view>& dns_sans = args.GetDnsSans();
   if (!dns_sans.empty()) {
     for (const auto& dns : dns_sans) {
       if (matcher_->Match(dns)) {
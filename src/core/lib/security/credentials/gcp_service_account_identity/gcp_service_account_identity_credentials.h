@@ -23,6 +23,7 @@
 #include <string>
 #include <utility>
 
+#include "absl/strings/str_cat.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/security/credentials/credentials.h"
@@ -73,6 +74,10 @@ class GcpServiceAccountIdentityCallCredentials
   absl::string_view audience() const { return audience_; }
 
  private:
+  std::string TokenCacheKey() const override {
+    return absl::StrCat(Type().name(), "\n", audience_);
+  }
+
   OrphanablePtr<HttpRequest> StartHttpRequest(
       grpc_polling_entity* pollent, Timestamp deadline,
       grpc_http_response* response, grpc_closure* on_complete) override;
@@ -47,6 +47,13 @@
 
 using grpc_core::Json;
 
+namespace {
+
+// Maximum number of service urls to cache jwts for.
+constexpr size_t kMaxCachedJwts = 64;
+
+}  // namespace
+
 grpc_service_account_jwt_access_credentials::
     ~grpc_service_account_jwt_access_credentials() {
   grpc_auth_json_key_destruct(&key_);
@@ -71,11 +78,12 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
   std::optional<grpc_core::Slice> jwt_value;
   {
     gpr_mu_lock(&cache_mu_);
-    if (cached_.has_value() && cached_->service_url == *uri &&
-        (gpr_time_cmp(
-             gpr_time_sub(cached_->jwt_expiration, gpr_now(GPR_CLOCK_REALTIME)),
-             refresh_threshold) > 0)) {
-      jwt_value = cached_->jwt_value.Ref();
+    auto it = cached_.find(*uri);
+    if (it != cached_.end() &&
+        (gpr_time_cmp(gpr_time_sub(it->second.jwt_expiration,
+                                   gpr_now(GPR_CLOCK_REALTIME)),
+                      refresh_threshold) > 0)) {
+      jwt_value = it->second.jwt_value.Ref();
     }
     gpr_mu_unlock(&cache_mu_);
   }
@@ -84,14 +92,16 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
     char* jwt = nullptr;
     // Generate a new jwt.
     gpr_mu_lock(&cache_mu_);
-    cached_.reset();
+    cached_.erase(*uri);
     jwt = grpc_jwt_encode_and_sign(&key_, uri->c_str(), jwt_lifetime_, nullptr);
     if (jwt != nullptr) {
       std::string md_value = absl::StrCat("Bearer ", jwt);
       gpr_free(jwt);
       jwt_value = grpc_core::Slice::FromCopiedString(md_value);
-      cached_ = {jwt_value->Ref(), std::move(*uri),
-                 gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), jwt_lifetime_)};
+      MakeRoomInCacheLocked();
+      cached_[std::move(*uri)] = {
+          jwt_value->Ref(),
+          gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), jwt_lifetime_)};
     }
     gpr_mu_unlock(&cache_mu_);
   }
@@ -107,6 +117,24 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
   return grpc_core::Immediate(std::move(initial_metadata));
 }
 
+void grpc_service_account_jwt_access_credentials::MakeRoomInCacheLocked() {
+  if (cached_.size() < kMaxCachedJwts) return;
+  gpr_timespec now = gpr_now(GPR_CLOCK_REALTIME);
+  absl::erase_if(cached_, [now](const auto& entry) {
+    return gpr_time_cmp(entry.second.jwt_expiration, now) <= 0;
+  });
+  while (cached_.size() >= kMaxCachedJwts) {
+    auto oldest = cached_.begin();
+    for (auto it = cached_.begin(); it != cached_.end(); ++it) {
+      if (gpr_time_cmp(it->second.jwt_expiration,
+                       oldest->second.jwt_expiration) < 0) {
+        oldest = it;
+      }
+    }
+    cached_.erase(oldest);
+  }
+}
+
 grpc_service_account_jwt_access_credentials::
     grpc_service_account_jwt_access_credentials(grpc_auth_json_key key,
                                                 gpr_timespec token_lifetime)
@@ -29,6 +29,7 @@
 #include <optional>
 #include <string>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
@@ -76,15 +77,18 @@ class grpc_service_account_jwt_access_credentials
         static_cast<const grpc_call_credentials*>(this), other);
   }
 
-  // Have a simple cache for now with just 1 entry. We could have a map based on
-  // the service_url for a more sophisticated one.
+  // Drops expired jwts, and then the ones closest to expiring, until there is
+  // room for a new one.
+  void MakeRoomInCacheLocked();
+
+  // Signed jwts, by service_url, so that channels to different services do
+  // not evict each other's jwt.
   gpr_mu cache_mu_;
   struct Cache {
     grpc_core::Slice jwt_value;
-    std::string service_url;
     gpr_timespec jwt_expiration;
   };
-  std::optional<Cache> cached_;
+  absl::flat_hash_map<std::string, Cache> cached_;
 
   grpc_auth_json_key key_;
   gpr_timespec jwt_lifetime_;
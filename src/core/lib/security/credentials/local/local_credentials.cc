@@ -33,7 +33,7 @@ grpc_local_credentials::create_security_connector(
       this->Ref(), std::move(request_metadata_creds), *args, target_name);
 }
 
-grpc_core::UniqueTypeName grpc_local_credentials::type() const {
+grpc_core::UniqueTypeName grpc_local_credentials::Type() {
   static grpc_core::UniqueTypeName::Factory kFactory("Local");
   return kFactory.Create();
 }
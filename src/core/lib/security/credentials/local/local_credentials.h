@@ -43,7 +43,9 @@ class grpc_local_credentials final : public grpc_channel_credentials {
       grpc_core::RefCountedPtr<grpc_call_credentials> request_metadata_creds,
       const char* target_name, grpc_core::ChannelArgs* args) override;
 
-  grpc_core::UniqueTypeName type() const override;
+  static grpc_core::UniqueTypeName Type();
+
+  grpc_core::UniqueTypeName type() const override { return Type(); }
 
   grpc_local_connect_type connect_type() const { return connect_type_; }
 
@@ -301,6 +301,9 @@ class grpc_compute_engine_token_fetcher_credentials
   }
 
  private:
+  // All instances get the token of the VM's default service account.
+  std::string TokenCacheKey() const override { return "ComputeEngine"; }
+
   grpc_core::OrphanablePtr<grpc_core::HttpRequest> StartHttpRequest(
       grpc_polling_entity* pollent, grpc_core::Timestamp deadline,
       grpc_http_response* response, grpc_closure* on_complete) override {
@@ -404,6 +407,14 @@ grpc_core::UniqueTypeName grpc_google_refresh_token_credentials::type() const {
   return kFactory.Create();
 }
 
+std::string grpc_google_refresh_token_credentials::TokenCacheKey() const {
+  return absl::StrJoin({type().name(),
+                        absl::string_view(refresh_token_.client_id),
+                        absl::string_view(refresh_token_.client_secret),
+                        absl::string_view(refresh_token_.refresh_token)},
+                       "\n");
+}
+
 static std::string create_loggable_refresh_token(
     grpc_auth_refresh_token* token) {
   if (strcmp(token->type, GRPC_AUTH_JSON_TYPE_INVALID) == 0) {
@@ -474,6 +485,19 @@ class StsTokenFetcherCredentials : public Oauth2TokenFetcherCredentials {
   }
 
  private:
+  std::string TokenCacheKey() const override {
+    auto field = [](const UniquePtr<char>& value) {
+      return value == nullptr ? absl::string_view() : value.get();
+    };
+    return absl::StrJoin(
+        {absl::string_view("Sts"), absl::string_view(sts_url_.ToString()),
+         field(resource_), field(audience_), field(scope_),
+         field(requested_token_type_), field(subject_token_path_),
+         field(subject_token_type_), field(actor_token_path_),
+         field(actor_token_type_)},
+        "\n");
+  }
+
   OrphanablePtr<HttpRequest> StartHttpRequest(
       grpc_polling_entity* pollent, Timestamp deadline,
       grpc_http_response* response, grpc_closure* on_complete) override {
@@ -134,6 +134,8 @@ class grpc_google_refresh_token_credentials final
   grpc_core::UniqueTypeName type() const override;
 
  private:
+  std::string TokenCacheKey() const override;
+
   grpc_core::OrphanablePtr<grpc_core::HttpRequest> StartHttpRequest(
       grpc_polling_entity* pollent, grpc_core::Timestamp deadline,
       grpc_http_response* response, grpc_closure* on_complete) override;
@@ -89,6 +89,10 @@ grpc_ssl_credentials::create_security_connector(
   std::optional<std::string> overridden_target_name =
       args->GetOwnedString(GRPC_SSL_TARGET_NAME_OVERRIDE_ARG);
   auto* ssl_session_cache = args->GetObject<tsi::SslSessionLRUCache>();
+  if (ssl_session_cache == nullptr &&
+      args->GetBool(GRPC_ARG_TLS_SHARED_SESSION_CACHE).value_or(false)) {
+    ssl_session_cache = tsi::SslSessionLRUCache::Shared();
+  }
   tsi_ssl_session_cache* session_cache =
       ssl_session_cache == nullptr ? nullptr : ssl_session_cache->c_ptr();
 
@@ -19,9 +19,11 @@
 #include "src/core/lib/security/credentials/tls/grpc_tls_credentials_options.h"
 
 #include <grpc/grpc_crl_provider.h>
+#include <grpc/grpc_session_ticket_key_provider.h>
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <utility>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -148,6 +150,14 @@ void grpc_tls_credentials_options_set_crl_provider(
   options->set_crl_provider(provider);
 }
 
+void grpc_tls_credentials_options_set_session_ticket_key_provider(
+    grpc_tls_credentials_options* options,
+    std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+        provider) {
+  CHECK_NE(options, nullptr);
+  options->set_session_ticket_key_provider(std::move(provider));
+}
+
 void grpc_tls_credentials_options_set_min_tls_version(
     grpc_tls_credentials_options* options, grpc_tls_version min_tls_version) {
   CHECK_NE(options, nullptr);
@@ -65,6 +65,8 @@ struct grpc_tls_credentials_options
   const std::string& crl_directory() const { return crl_directory_; }
   // Returns the CRL Provider
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider() const { return crl_provider_; }
+  // Returns the provider of the keys that the server encrypts session tickets with. Only used on the server side.
+  std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider> session_ticket_key_provider() const { return session_ticket_key_provider_; }
   bool send_client_ca_list() const { return send_client_ca_list_; }
 
   // Setters for member fields.
@@ -87,6 +89,7 @@ struct grpc_tls_credentials_options
   //  gRPC will enforce CRLs on all handshakes from all hashed CRL files inside of the crl_directory. If not set, an empty string will be used, which will not enable CRL checking. Only supported for OpenSSL version > 1.1.
   void set_crl_directory(std::string crl_directory) { crl_directory_ = std::move(crl_directory); }
   void set_crl_provider(std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider) { crl_provider_ = std::move(crl_provider); }
+  void set_session_ticket_key_provider(std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider> session_ticket_key_provider) { session_ticket_key_provider_ = std::move(session_ticket_key_provider); }
   void set_send_client_ca_list(bool send_client_ca_list) { send_client_ca_list_ = send_client_ca_list; }
 
   bool operator==(const grpc_tls_credentials_options& other) const {
@@ -104,6 +107,7 @@ struct grpc_tls_credentials_options
       tls_session_key_log_file_path_ == other.tls_session_key_log_file_path_ &&
       crl_directory_ == other.crl_directory_ &&
       (crl_provider_ == other.crl_provider_) &&
+      (session_ticket_key_provider_ == other.session_ticket_key_provider_) &&
       send_client_ca_list_ == other.send_client_ca_list_;
   }
 
@@ -122,6 +126,7 @@ struct grpc_tls_credentials_options
       tls_session_key_log_file_path_(other.tls_session_key_log_file_path_),
       crl_directory_(other.crl_directory_),
       crl_provider_(other.crl_provider_),
+      session_ticket_key_provider_(other.session_ticket_key_provider_),
       send_client_ca_list_(other.send_client_ca_list_)  {}
 
  private:
@@ -139,6 +144,7 @@ struct grpc_tls_credentials_options
   std::string tls_session_key_log_file_path_;
   std::string crl_directory_;
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider_;
+  std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider> session_ticket_key_provider_;
   bool send_client_ca_list_ = false;
 };
 
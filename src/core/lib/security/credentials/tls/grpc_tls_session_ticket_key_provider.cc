@@ -0,0 +1,136 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.h"
+
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <memory>
+
+// IWYU pragma: no_include <openssl/mem.h>
+#include <openssl/crypto.h>  // IWYU pragma: keep
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace experimental {
+
+namespace {
+
+constexpr size_t kMinSecretSize = 32;
+
+// Writes HMAC-SHA256(secret, label), truncated to \a size bytes, to \a out.
+bool DeriveBytes(absl::string_view secret, absl::string_view label,
+                 uint8_t* out, size_t size) {
+  uint8_t digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size = 0;
+  if (HMAC(EVP_sha256(), secret.data(), static_cast<int>(secret.size()),
+           reinterpret_cast<const uint8_t*>(label.data()), label.size(),
+           digest, &digest_size) == nullptr ||
+      digest_size < size) {
+    return false;
+  }
+  memcpy(out, digest, size);
+  OPENSSL_cleanse(digest, sizeof(digest));
+  return true;
+}
+
+}  // namespace
+
+absl::StatusOr<SessionTicketKey>
+RotatingSessionTicketKeyProviderImpl::DeriveKey(absl::string_view secret) {
+  if (secret.size() < kMinSecretSize) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("session ticket key secret must be at least ",
+                     kMinSecretSize, " bytes"));
+  }
+  SessionTicketKey key;
+  if (!DeriveBytes(secret, "grpc session ticket key name", key.name,
+                   sizeof(key.name)) ||
+      !DeriveBytes(secret, "grpc session ticket key hmac", key.hmac_key,
+                   sizeof(key.hmac_key)) ||
+      !DeriveBytes(secret, "grpc session ticket key aes", key.aes_key,
+                   sizeof(key.aes_key))) {
+    OPENSSL_cleanse(&key, sizeof(key));
+    return absl::InternalError("failed to derive session ticket key");
+  }
+  return key;
+}
+
+RotatingSessionTicketKeyProviderImpl::~RotatingSessionTicketKeyProviderImpl() {
+  OPENSSL_cleanse(&current_, sizeof(current_));
+  if (previous_.has_value()) OPENSSL_cleanse(&*previous_, sizeof(*previous_));
+}
+
+SessionTicketKey RotatingSessionTicketKeyProviderImpl::EncryptionKey() {
+  MutexLock lock(&mu_);
+  return current_;
+}
+
+std::optional<SessionTicketKey>
+RotatingSessionTicketKeyProviderImpl::DecryptionKey(absl::string_view name,
+                                                    bool* renew) {
+  MutexLock lock(&mu_);
+  *renew = false;
+  if (name == absl::string_view(reinterpret_cast<const char*>(current_.name),
+                                sizeof(current_.name))) {
+    return current_;
+  }
+  if (previous_.has_value() &&
+      name == absl::string_view(reinterpret_cast<const char*>(previous_->name),
+                                sizeof(previous_->name))) {
+    *renew = true;
+    return previous_;
+  }
+  return std::nullopt;
+}
+
+absl::Status RotatingSessionTicketKeyProviderImpl::Rotate(
+    absl::string_view secret) {
+  absl::StatusOr<SessionTicketKey> key = DeriveKey(secret);
+  if (!key.ok()) return key.status();
+  MutexLock lock(&mu_);
+  // Rotating to the current secret must not retire the previous key.
+  if (memcmp(key->name, current_.name, sizeof(current_.name)) != 0) {
+    if (previous_.has_value()) {
+      OPENSSL_cleanse(&*previous_, sizeof(*previous_));
+    }
+    previous_ = current_;
+    current_ = *key;
+  }
+  OPENSSL_cleanse(&*key, sizeof(*key));
+  return absl::OkStatus();
+}
+
+absl::StatusOr<std::shared_ptr<RotatingSessionTicketKeyProvider>>
+CreateRotatingSessionTicketKeyProvider(absl::string_view secret) {
+  absl::StatusOr<SessionTicketKey> key =
+      RotatingSessionTicketKeyProviderImpl::DeriveKey(secret);
+  if (!key.ok()) return key.status();
+  auto provider = std::make_shared<RotatingSessionTicketKeyProviderImpl>(*key);
+  OPENSSL_cleanse(&*key, sizeof(*key));
+  return provider;
+}
+
+}  // namespace experimental
+}  // namespace grpc_core
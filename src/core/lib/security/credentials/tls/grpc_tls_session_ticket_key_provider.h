@@ -0,0 +1,60 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_SESSION_TICKET_KEY_PROVIDER_H
+#define GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_SESSION_TICKET_KEY_PROVIDER_H
+
+#include <grpc/grpc_session_ticket_key_provider.h>
+#include <grpc/support/port_platform.h>
+
+#include <optional>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+namespace experimental {
+
+class RotatingSessionTicketKeyProviderImpl
+    : public RotatingSessionTicketKeyProvider {
+ public:
+  // Derives the name and keys of the session ticket key for \a secret.
+  static absl::StatusOr<SessionTicketKey> DeriveKey(absl::string_view secret);
+
+  explicit RotatingSessionTicketKeyProviderImpl(const SessionTicketKey& key)
+      : current_(key) {}
+  ~RotatingSessionTicketKeyProviderImpl() override;
+
+  SessionTicketKey EncryptionKey() override;
+  std::optional<SessionTicketKey> DecryptionKey(absl::string_view name,
+                                                bool* renew) override;
+  absl::Status Rotate(absl::string_view secret) override;
+
+ private:
+  Mutex mu_;
+  SessionTicketKey current_ ABSL_GUARDED_BY(mu_);
+  std::optional<SessionTicketKey> previous_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace experimental
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_SESSION_TICKET_KEY_PROVIDER_H
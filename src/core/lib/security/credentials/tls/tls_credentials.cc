@@ -106,6 +106,10 @@ TlsCredentials::create_security_connector(
   std::optional<std::string> overridden_target_name =
       args->GetOwnedString(GRPC_SSL_TARGET_NAME_OVERRIDE_ARG);
   auto* ssl_session_cache = args->GetObject<tsi::SslSessionLRUCache>();
+  if (ssl_session_cache == nullptr &&
+      args->GetBool(GRPC_ARG_TLS_SHARED_SESSION_CACHE).value_or(false)) {
+    ssl_session_cache = tsi::SslSessionLRUCache::Shared();
+  }
   grpc_core::RefCountedPtr<grpc_channel_security_connector> sc =
       grpc_core::TlsChannelSecurityConnector::CreateTlsChannelSecurityConnector(
           this->Ref(), options_, std::move(call_creds), target_name,
@@ -18,12 +18,17 @@
 
 #include "src/core/lib/security/credentials/token_fetcher/token_fetcher_credentials.h"
 
+#include <algorithm>
+
+#include "absl/container/flat_hash_map.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
+#include "src/core/util/no_destruct.h"
 
 namespace grpc_core {
 
@@ -171,6 +176,10 @@ void TokenFetcherCredentials::FetchState::TokenFetchComplete(
         << "[TokenFetcherCredentials " << creds_.get()
         << "]: fetch_state=" << this << ": token fetch succeeded";
     creds_->token_ = *token;
+    // Calls that waited for this fetch count as using the token.
+    creds_->token_used_ = !queued_calls_.empty();
+    creds_->MaybeShareTokenLocked();
+    creds_->ScheduleRefreshLocked();
     creds_->fetch_state_.reset();  // Orphan ourselves.
   } else {
     GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
@@ -222,12 +231,16 @@ TokenFetcherCredentials::FetchState::QueueCall(
 
 TokenFetcherCredentials::TokenFetcherCredentials(
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
-    bool test_only_use_backoff_jitter)
+    bool test_only_use_backoff_jitter,
+    TokenFetcherRefreshOptions refresh_options)
     : event_engine_(
           event_engine == nullptr
               ? grpc_event_engine::experimental::GetDefaultEventEngine()
               : std::move(event_engine)),
       test_only_use_backoff_jitter_(test_only_use_backoff_jitter),
+      refresh_options_(refresh_options),
+      proactive_refresh_(refresh_options.enabled.value_or(
+          IsTokenFetcherProactiveRefreshEnabled())),
       pollent_(grpc_polling_entity_create_from_pollset_set(
           grpc_pollset_set_create())) {}
 
@@ -237,15 +250,131 @@ TokenFetcherCredentials::~TokenFetcherCredentials() {
 
 void TokenFetcherCredentials::Orphaned() {
   MutexLock lock(&mu_);
+  if (refresh_timer_handle_.has_value()) {
+    event_engine_->Cancel(*refresh_timer_handle_);
+    refresh_timer_handle_.reset();
+  }
   fetch_state_.reset();
 }
 
+std::shared_ptr<TokenFetcherCredentials::SharedToken>
+TokenFetcherCredentials::GetSharedToken(const std::string& key) {
+  static NoDestruct<Mutex> mu;
+  using SharedTokenMap =
+      absl::flat_hash_map<std::string, std::weak_ptr<SharedToken>>;
+  static NoDestruct<SharedTokenMap> shared_tokens;
+  MutexLock lock(mu.get());
+  // Forget the tokens of credentials that are all gone.
+  absl::erase_if(*shared_tokens,
+                 [](const auto& entry) { return entry.second.expired(); });
+  std::weak_ptr<SharedToken>& entry = (*shared_tokens)[key];
+  std::shared_ptr<SharedToken> shared_token = entry.lock();
+  if (shared_token == nullptr) {
+    shared_token = std::make_shared<SharedToken>();
+    entry = shared_token;
+  }
+  return shared_token;
+}
+
+bool TokenFetcherCredentials::MaybeUseSharedTokenLocked() {
+  if (!proactive_refresh_) return false;
+  if (!shared_token_initialized_) {
+    shared_token_initialized_ = true;
+    std::string key = TokenCacheKey();
+    if (!key.empty()) shared_token_ = GetSharedToken(key);
+  }
+  if (shared_token_ == nullptr) return false;
+  RefCountedPtr<Token> token;
+  {
+    MutexLock lock(&shared_token_->mu);
+    token = shared_token_->token;
+  }
+  if (token == nullptr || token == token_ ||
+      (token_ != nullptr &&
+       token->ExpirationTime() <= token_->ExpirationTime())) {
+    return false;
+  }
+  GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+      << "[TokenFetcherCredentials " << this << "]: using shared token";
+  token_ = std::move(token);
+  return true;
+}
+
+void TokenFetcherCredentials::MaybeShareTokenLocked() {
+  if (shared_token_ == nullptr) return;
+  MutexLock lock(&shared_token_->mu);
+  if (shared_token_->token == nullptr ||
+      shared_token_->token->ExpirationTime() < token_->ExpirationTime()) {
+    shared_token_->token = token_;
+  }
+}
+
+void TokenFetcherCredentials::ScheduleRefreshLocked() {
+  if (!proactive_refresh_) return;
+  if (refresh_timer_handle_.has_value()) {
+    event_engine_->Cancel(*refresh_timer_handle_);
+    refresh_timer_handle_.reset();
+  }
+  const Duration lifetime = token_->ExpirationTime() - Timestamp::Now();
+  // Tokens that never expire need no refresh, and tokens about to expire are
+  // refreshed by the next call.
+  if (lifetime == Duration::Infinity() || lifetime <= kTokenRefreshDuration) {
+    return;
+  }
+  Duration delay =
+      lifetime * refresh_options_.lifetime_fraction *
+      absl::Uniform(bit_gen_, 1 - refresh_options_.jitter,
+                    1 + refresh_options_.jitter);
+  // Refresh before calls would start a fetch themselves.
+  delay = std::min(delay, lifetime - kTokenRefreshDuration);
+  GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+      << "[TokenFetcherCredentials " << this << "]: refreshing token in "
+      << delay;
+  refresh_timer_handle_ = event_engine_->RunAfter(
+      delay, [self = WeakRefAsSubclass<TokenFetcherCredentials>()]() mutable {
+        ExecCtx exec_ctx;
+        self->OnRefreshTimer();
+        self.reset();
+      });
+}
+
+void TokenFetcherCredentials::OnRefreshTimer() {
+  MutexLock lock(&mu_);
+  if (!refresh_timer_handle_.has_value()) return;
+  refresh_timer_handle_.reset();
+  // Leave tokens that no call needs to expire. If a call comes later, it
+  // fetches a new one.
+  if (!token_used_) {
+    GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+        << "[TokenFetcherCredentials " << this
+        << "]: token unused since fetched; not refreshing";
+    return;
+  }
+  // Another credentials object with the same key may have refreshed already.
+  if (MaybeUseSharedTokenLocked()) {
+    token_used_ = false;
+    ScheduleRefreshLocked();
+    return;
+  }
+  if (fetch_state_ == nullptr) {
+    GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+        << "[TokenFetcherCredentials " << this
+        << "]: refresh timer fired; triggering new token fetch";
+    fetch_state_ = OrphanablePtr<FetchState>(
+        new FetchState(WeakRefAsSubclass<TokenFetcherCredentials>()));
+  }
+}
+
 ArenaPromise<absl::StatusOr<ClientMetadataHandle>>
 TokenFetcherCredentials::GetRequestMetadata(
     ClientMetadataHandle initial_metadata, const GetRequestMetadataArgs*) {
   RefCountedPtr<QueuedCall> queued_call;
   {
     MutexLock lock(&mu_);
+    if (MaybeUseSharedTokenLocked()) {
+      token_used_ = false;
+      ScheduleRefreshLocked();
+    }
     // If we don't have a cached token or the token is within the
     // refresh duration, start a new fetch if there isn't a pending one.
     if ((token_ == nullptr || (token_->ExpirationTime() - Timestamp::Now()) <=
@@ -265,6 +394,7 @@ TokenFetcherCredentials::GetRequestMetadata(
           << "[TokenFetcherCredentials " << this
           << "]: " << GetContext<Activity>()->DebugTag()
           << " using cached token";
+      token_used_ = true;
       token_->AddTokenToClientInitialMetadata(*initial_metadata);
       return Immediate(std::move(initial_metadata));
     }
@@ -21,11 +21,14 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <variant>
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/random/random.h"
 #include "absl/status/statusor.h"
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/promise/arena_promise.h"
@@ -42,6 +45,20 @@
 
 namespace grpc_core {
 
+// Controls when TokenFetcherCredentials refreshes a token that calls still
+// use.
+struct TokenFetcherRefreshOptions {
+  // Whether tokens are refreshed in the background and shared between
+  // credentials with the same TokenCacheKey(). Defaults to whether the
+  // token_fetcher_proactive_refresh experiment is enabled.
+  std::optional<bool> enabled;
+  // The fraction of a token's lifetime after which it is refreshed.
+  double lifetime_fraction = 0.8;
+  // Up to this fraction of the delay is added or removed at random, so that
+  // processes started at the same time do not all refresh at the same time.
+  double jitter = 0.1;
+};
+
 // A base class for credentials that fetch tokens via an HTTP request.
 // Subclasses must implement FetchToken().
 class TokenFetcherCredentials : public grpc_call_credentials {
@@ -77,7 +94,8 @@ class TokenFetcherCredentials : public grpc_call_credentials {
   explicit TokenFetcherCredentials(
       std::shared_ptr<grpc_event_engine::experimental::EventEngine>
           event_engine = nullptr,
-      bool test_only_use_backoff_jitter = true);
+      bool test_only_use_backoff_jitter = true,
+      TokenFetcherRefreshOptions refresh_options = {});
 
   // Fetches a token.  The on_done callback will be invoked when complete.
   virtual OrphanablePtr<FetchRequest> FetchToken(
@@ -85,6 +103,11 @@ class TokenFetcherCredentials : public grpc_call_credentials {
       absl::AnyInvocable<void(absl::StatusOr<RefCountedPtr<Token>>)>
           on_done) = 0;
 
+  // Credentials that return the same non-empty key fetch tokens for the same
+  // identity, and share them if proactive refresh is enabled. The key must
+  // include everything that determines the token.
+  virtual std::string TokenCacheKey() const { return ""; }
+
   grpc_event_engine::experimental::EventEngine& event_engine() const {
     return *event_engine_;
   }
@@ -159,19 +182,48 @@ class TokenFetcherCredentials : public grpc_call_credentials {
     BackOff backoff_ ABSL_GUARDED_BY(&TokenFetcherCredentials::mu_);
   };
 
+  // The latest token fetched by any of the credentials with a given
+  // TokenCacheKey().
+  struct SharedToken {
+    Mutex mu;
+    RefCountedPtr<Token> token ABSL_GUARDED_BY(&mu);
+  };
+
+  static std::shared_ptr<SharedToken> GetSharedToken(const std::string& key);
+
   int cmp_impl(const grpc_call_credentials* other) const override {
     // TODO(yashykt): Check if we can do something better here
     return QsortCompare(static_cast<const grpc_call_credentials*>(this), other);
   }
 
+  // Replaces token_ with the shared token, if that one expires later.
+  // Returns true if token_ was replaced.
+  bool MaybeUseSharedTokenLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+  // Makes token_ the shared token, if it expires later than that one.
+  void MaybeShareTokenLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+  // Starts the timer to refresh token_ before it is needed.
+  void ScheduleRefreshLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+  void OnRefreshTimer();
+
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
   const bool test_only_use_backoff_jitter_;
+  const TokenFetcherRefreshOptions refresh_options_;
+  const bool proactive_refresh_;
 
   Mutex mu_;
   // Cached token, if any.
   RefCountedPtr<Token> token_ ABSL_GUARDED_BY(&mu_);
+  // Whether a call used token_ since it was fetched.
+  bool token_used_ ABSL_GUARDED_BY(&mu_) = false;
   // Fetch state, if any.
   OrphanablePtr<FetchState> fetch_state_ ABSL_GUARDED_BY(&mu_);
+  // Timer to refresh token_, if any.
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      refresh_timer_handle_ ABSL_GUARDED_BY(&mu_);
+  absl::BitGen bit_gen_ ABSL_GUARDED_BY(&mu_);
+  // Shared token, set on first use if TokenCacheKey() is non-empty.
+  bool shared_token_initialized_ ABSL_GUARDED_BY(&mu_) = false;
+  std::shared_ptr<SharedToken> shared_token_ ABSL_GUARDED_BY(&mu_);
 
   grpc_polling_entity pollent_ ABSL_GUARDED_BY(&mu_);
 };
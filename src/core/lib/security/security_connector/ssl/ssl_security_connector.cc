@@ -114,6 +114,7 @@ class grpc_ssl_channel_security_connector final
                  << tsi_result_to_string(result);
       return;
     }
+    grpc_ssl_maybe_offload_handshaker(args, tsi_hs);
     // Create handshakers.
     handshake_mgr->Add(grpc_core::SecurityHandshakerCreate(tsi_hs, this, args));
   }
@@ -255,6 +256,7 @@ class grpc_ssl_server_security_connector
                  << tsi_result_to_string(result);
       return;
     }
+    grpc_ssl_maybe_offload_handshaker(args, tsi_hs);
     // Create handshakers.
     handshake_mgr->Add(grpc_core::SecurityHandshakerCreate(tsi_hs, this, args));
   }
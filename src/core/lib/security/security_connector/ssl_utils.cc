@@ -410,6 +410,7 @@ void grpc_shallow_peer_destruct(tsi_peer* peer) {
 
 grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
     tsi_ssl_pem_key_cert_pair* pem_key_cert_pair, const char* pem_root_certs,
+    const tsi_ssl_root_certs_store* root_store,
     bool skip_server_certificate_verification, tsi_tls_version min_tls_version,
     tsi_tls_version max_tls_version, tsi_ssl_session_cache* ssl_session_cache,
     tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger* tls_session_key_logger,
@@ -417,7 +418,6 @@ grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
     std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider,
     tsi_ssl_client_handshaker_factory** handshaker_factory) {
   const char* root_certs;
-  const tsi_ssl_root_certs_store* root_store;
   if (pem_root_certs == nullptr && !skip_server_certificate_verification) {
     GRPC_TRACE_LOG(tsi, INFO)
         << "No root certificates specified; use ones stored in system "
@@ -431,7 +431,7 @@ grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
     root_store = grpc_core::DefaultSslRootStore::GetRootStore();
   } else {
     root_certs = pem_root_certs;
-    root_store = nullptr;
+    if (pem_root_certs == nullptr) root_store = nullptr;
   }
   bool has_key_cert_pair = pem_key_cert_pair != nullptr &&
                            pem_key_cert_pair->private_key != nullptr &&
@@ -467,12 +467,14 @@ grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
 
 grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     tsi_ssl_pem_key_cert_pair* pem_key_cert_pairs, size_t num_key_cert_pairs,
-    const char* pem_root_certs,
+    const char* pem_root_certs, const tsi_ssl_root_certs_store* root_store,
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_tls_version min_tls_version, tsi_tls_version max_tls_version,
     tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger* tls_session_key_logger,
     const char* crl_directory, bool send_client_ca_list,
     std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider,
+    std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+        session_ticket_key_provider,
     tsi_ssl_server_handshaker_factory** handshaker_factory) {
   size_t num_alpn_protocols = 0;
   const char** alpn_protocol_strings =
@@ -481,6 +483,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
   options.pem_key_cert_pairs = pem_key_cert_pairs;
   options.num_key_cert_pairs = num_key_cert_pairs;
   options.pem_client_root_certs = pem_root_certs;
+  options.client_root_store = root_store;
   options.client_certificate_request =
       grpc_get_tsi_client_certificate_request_type(client_certificate_request);
   options.cipher_suites = grpc_get_ssl_cipher_suites();
@@ -491,6 +494,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
   options.key_logger = tls_session_key_logger;
   options.crl_directory = crl_directory;
   options.crl_provider = std::move(crl_provider);
+  options.session_ticket_key_provider = std::move(session_ticket_key_provider);
   options.send_client_ca_list = send_client_ca_list;
   const tsi_result result =
       tsi_create_ssl_server_handshaker_factory_with_options(&options,
@@ -504,6 +508,16 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
   return GRPC_SECURITY_OK;
 }
 
+void grpc_ssl_maybe_offload_handshaker(const grpc_core::ChannelArgs& args,
+                                       tsi_handshaker* handshaker) {
+  if (handshaker == nullptr ||
+      !args.GetBool(GRPC_ARG_TLS_HANDSHAKE_OFFLOAD).value_or(false)) {
+    return;
+  }
+  tsi_ssl_handshaker_set_offloader(handshaker,
+                                   tsi::SslHandshakeOffloader::Shared());
+}
+
 // --- Ssl cache implementation. ---
 
 grpc_ssl_session_cache* grpc_ssl_session_cache_create_lru(size_t capacity) {
@@ -22,6 +22,7 @@
 #include <grpc/grpc_crl_provider.h>
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
+#include <grpc/grpc_session_ticket_key_provider.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
@@ -33,6 +34,7 @@
 
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
@@ -77,9 +79,12 @@ tsi_tls_version grpc_get_tsi_tls_version(grpc_tls_version tls_version);
 // Return an array of strings containing alpn protocols.
 const char** grpc_fill_alpn_protocol_strings(size_t* num_alpn_protocols);
 
-// Initialize TSI SSL server/client handshaker factory.
+// Initialize TSI SSL server/client handshaker factory. If \a root_store is
+// set, it holds the parsed \a pem_root_certs, and the factory shares it
+// instead of parsing them again.
 grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
     tsi_ssl_pem_key_cert_pair* key_cert_pair, const char* pem_root_certs,
+    const tsi_ssl_root_certs_store* root_store,
     bool skip_server_certificate_verification, tsi_tls_version min_tls_version,
     tsi_tls_version max_tls_version, tsi_ssl_session_cache* ssl_session_cache,
     tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger* tls_session_key_logger,
@@ -89,14 +94,21 @@ grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
 
 grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     tsi_ssl_pem_key_cert_pair* key_cert_pairs, size_t num_key_cert_pairs,
-    const char* pem_root_certs,
+    const char* pem_root_certs, const tsi_ssl_root_certs_store* root_store,
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_tls_version min_tls_version, tsi_tls_version max_tls_version,
     tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger* tls_session_key_logger,
     const char* crl_directory, bool send_client_ca_list,
     std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider,
+    std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+        session_ticket_key_provider,
     tsi_ssl_server_handshaker_factory** handshaker_factory);
 
+// Makes \a handshaker run on the shared handshake offloader if \a args set
+// GRPC_ARG_TLS_HANDSHAKE_OFFLOAD.
+void grpc_ssl_maybe_offload_handshaker(const grpc_core::ChannelArgs& args,
+                                       tsi_handshaker* handshaker);
+
 // Free the memory occupied by key cert pairs.
 void grpc_tsi_ssl_pem_key_cert_pairs_destroy(tsi_ssl_pem_key_cert_pair* kp,
                                              size_t num_key_cert_pairs);
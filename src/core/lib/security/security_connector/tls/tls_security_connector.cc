@@ -233,6 +233,25 @@ tsi_ssl_pem_key_cert_pair* ConvertToTsiPemKeyCertPair(
   return tsi_pairs;
 }
 
+// Keeps |*root_store| holding the parsed |root_certs|, so that a large trust
+// bundle is parsed once per change rather than on every factory update. The
+// SSL contexts take their own refs on the underlying X509_STORE, so replacing
+// |*root_store| does not affect the factories built with it. The store is not
+// used if |shareable| is false, e.g. when CRLs would be loaded into it.
+void UpdateRootStore(const char* root_certs, bool root_certs_changed,
+                     bool shareable, tsi_ssl_root_certs_store** root_store) {
+  if (*root_store != nullptr &&
+      (root_certs_changed || root_certs == nullptr || !shareable)) {
+    tsi_ssl_root_certs_store_destroy(*root_store);
+    *root_store = nullptr;
+  }
+  if (*root_store == nullptr && root_certs != nullptr && shareable) {
+    // If parsing fails, the factory parses the PEM roots itself and reports
+    // the error.
+    *root_store = tsi_ssl_root_certs_store_create(root_certs);
+  }
+}
+
 }  // namespace
 
 // -------------------channel security connector-------------------
@@ -333,17 +352,22 @@ TlsChannelSecurityConnector::~TlsChannelSecurityConnector() {
   if (client_handshaker_factory_ != nullptr) {
     tsi_ssl_client_handshaker_factory_unref(client_handshaker_factory_);
   }
+  tsi_ssl_root_certs_store_destroy(root_store_);
 }
 
 void TlsChannelSecurityConnector::add_handshakers(
     const ChannelArgs& args, grpc_pollset_set* /*interested_parties*/,
     HandshakeManager* handshake_mgr) {
-  MutexLock lock(&mu_);
+  tsi_ssl_client_handshaker_factory* factory;
+  {
+    MutexLock lock(&mu_);
+    factory = tsi_ssl_client_handshaker_factory_ref(client_handshaker_factory_);
+  }
   tsi_handshaker* tsi_hs = nullptr;
-  if (client_handshaker_factory_ != nullptr) {
+  if (factory != nullptr) {
     // Instantiate TSI handshaker.
     tsi_result result = tsi_ssl_client_handshaker_factory_create_handshaker(
-        client_handshaker_factory_,
+        factory,
         overridden_target_name_.empty() ? target_name_.c_str()
                                         : overridden_target_name_.c_str(),
         /*network_bio_buf_size=*/0,
@@ -352,6 +376,8 @@ void TlsChannelSecurityConnector::add_handshakers(
       LOG(ERROR) << "Handshaker creation failed with error "
                  << tsi_result_to_string(result);
     }
+    grpc_ssl_maybe_offload_handshaker(args, tsi_hs);
+    tsi_ssl_client_handshaker_factory_unref(factory);
   }
   // If tsi_hs is null, this will add a failing handshaker.
   handshake_mgr->Add(SecurityHandshakerCreate(tsi_hs, this, args));
@@ -431,23 +457,31 @@ void TlsChannelSecurityConnector::TlsChannelCertificateWatcher::
     OnCertificatesChanged(std::optional<absl::string_view> root_certs,
                           std::optional<PemKeyCertPairList> key_cert_pairs) {
   CHECK_NE(security_connector_, nullptr);
-  MutexLock lock(&security_connector_->mu_);
-  if (root_certs.has_value()) {
-    security_connector_->pem_root_certs_ = root_certs;
-  }
-  if (key_cert_pairs.has_value()) {
-    security_connector_->pem_key_cert_pair_list_ = std::move(key_cert_pairs);
-  }
-  const bool root_ready = !security_connector_->options_->watch_root_cert() ||
-                          security_connector_->pem_root_certs_.has_value();
-  const bool identity_ready =
-      !security_connector_->options_->watch_identity_pair() ||
-      security_connector_->pem_key_cert_pair_list_.has_value();
-  if (root_ready && identity_ready) {
-    if (security_connector_->UpdateHandshakerFactoryLocked() !=
-        GRPC_SECURITY_OK) {
-      LOG(ERROR) << "Update handshaker factory failed.";
+  MutexLock update_lock(&security_connector_->update_mu_);
+  std::optional<absl::string_view> pem_root_certs;
+  std::optional<PemKeyCertPairList> pem_key_cert_pair_list;
+  {
+    MutexLock lock(&security_connector_->mu_);
+    if (root_certs.has_value()) {
+      security_connector_->pem_root_certs_ = root_certs;
+    }
+    if (key_cert_pairs.has_value()) {
+      security_connector_->pem_key_cert_pair_list_ = std::move(key_cert_pairs);
     }
+    const bool root_ready =
+        !security_connector_->options_->watch_root_cert() ||
+        security_connector_->pem_root_certs_.has_value();
+    const bool identity_ready =
+        !security_connector_->options_->watch_identity_pair() ||
+        security_connector_->pem_key_cert_pair_list_.has_value();
+    if (!root_ready || !identity_ready) return;
+    pem_root_certs = security_connector_->pem_root_certs_;
+    pem_key_cert_pair_list = security_connector_->pem_key_cert_pair_list_;
+  }
+  if (security_connector_->UpdateHandshakerFactory(
+          pem_root_certs, pem_key_cert_pair_list, root_certs.has_value()) !=
+      GRPC_SECURITY_OK) {
+    LOG(ERROR) << "Update handshaker factory failed.";
   }
 }
 
@@ -517,37 +551,46 @@ void TlsChannelSecurityConnector::ChannelPendingVerifierRequest::OnVerifyDone(
 
 // TODO(ZhenLian): implement the logic to signal waiting handshakers once
 // BlockOnInitialCredentialHandshaker is implemented.
-grpc_security_status
-TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
+grpc_security_status TlsChannelSecurityConnector::UpdateHandshakerFactory(
+    std::optional<absl::string_view> pem_root_certs_view,
+    const std::optional<PemKeyCertPairList>& pem_key_cert_pair_list,
+    bool root_certs_changed) {
   bool skip_server_certificate_verification = !options_->verify_server_cert();
-  // Free the client handshaker factory if exists.
-  if (client_handshaker_factory_ != nullptr) {
-    tsi_ssl_client_handshaker_factory_unref(client_handshaker_factory_);
-  }
   std::string pem_root_certs;
-  if (pem_root_certs_.has_value()) {
+  if (pem_root_certs_view.has_value()) {
     // TODO(ZhenLian): update the underlying TSI layer to use C++ types like
     // std::string and absl::string_view to avoid making another copy here.
-    pem_root_certs = std::string(*pem_root_certs_);
+    pem_root_certs = std::string(*pem_root_certs_view);
   }
   tsi_ssl_pem_key_cert_pair* pem_key_cert_pair = nullptr;
-  if (pem_key_cert_pair_list_.has_value()) {
-    pem_key_cert_pair = ConvertToTsiPemKeyCertPair(*pem_key_cert_pair_list_);
+  if (pem_key_cert_pair_list.has_value()) {
+    pem_key_cert_pair = ConvertToTsiPemKeyCertPair(*pem_key_cert_pair_list);
   }
   bool use_default_roots = !options_->watch_root_cert();
+  const char* root_certs = pem_root_certs.empty() || use_default_roots
+                               ? nullptr
+                               : pem_root_certs.c_str();
+  UpdateRootStore(root_certs, root_certs_changed,
+                  options_->crl_directory().empty(), &root_store_);
+  tsi_ssl_client_handshaker_factory* factory = nullptr;
   grpc_security_status status = grpc_ssl_tsi_client_handshaker_factory_init(
-      pem_key_cert_pair,
-      pem_root_certs.empty() || use_default_roots ? nullptr
-                                                  : pem_root_certs.c_str(),
+      pem_key_cert_pair, root_certs, root_store_,
       skip_server_certificate_verification,
       grpc_get_tsi_tls_version(options_->min_tls_version()),
       grpc_get_tsi_tls_version(options_->max_tls_version()), ssl_session_cache_,
       tls_session_key_logger_.get(), options_->crl_directory().c_str(),
-      options_->crl_provider(), &client_handshaker_factory_);
+      options_->crl_provider(), &factory);
   // Free memory.
   if (pem_key_cert_pair != nullptr) {
     grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pair, 1);
   }
+  // Handshakers hold their own refs, so the old factory is freed once the
+  // handshakes it started are done.
+  {
+    MutexLock lock(&mu_);
+    std::swap(client_handshaker_factory_, factory);
+  }
+  if (factory != nullptr) tsi_ssl_client_handshaker_factory_unref(factory);
   return status;
 }
 
@@ -610,22 +653,29 @@ TlsServerSecurityConnector::~TlsServerSecurityConnector() {
   if (server_handshaker_factory_ != nullptr) {
     tsi_ssl_server_handshaker_factory_unref(server_handshaker_factory_);
   }
+  tsi_ssl_root_certs_store_destroy(root_store_);
 }
 
 void TlsServerSecurityConnector::add_handshakers(
     const ChannelArgs& args, grpc_pollset_set* /*interested_parties*/,
     HandshakeManager* handshake_mgr) {
-  MutexLock lock(&mu_);
+  tsi_ssl_server_handshaker_factory* factory;
+  {
+    MutexLock lock(&mu_);
+    factory = tsi_ssl_server_handshaker_factory_ref(server_handshaker_factory_);
+  }
   tsi_handshaker* tsi_hs = nullptr;
-  if (server_handshaker_factory_ != nullptr) {
+  if (factory != nullptr) {
     // Instantiate TSI handshaker.
     tsi_result result = tsi_ssl_server_handshaker_factory_create_handshaker(
-        server_handshaker_factory_, /*network_bio_buf_size=*/0,
+        factory, /*network_bio_buf_size=*/0,
         /*ssl_bio_buf_size=*/0, &tsi_hs);
     if (result != TSI_OK) {
       LOG(ERROR) << "Handshaker creation failed with error "
                  << tsi_result_to_string(result);
     }
+    grpc_ssl_maybe_offload_handshaker(args, tsi_hs);
+    tsi_ssl_server_handshaker_factory_unref(factory);
   }
   // If tsi_hs is null, this will add a failing handshaker.
   handshake_mgr->Add(SecurityHandshakerCreate(tsi_hs, this, args));
@@ -691,27 +741,37 @@ void TlsServerSecurityConnector::TlsServerCertificateWatcher::
     OnCertificatesChanged(std::optional<absl::string_view> root_certs,
                           std::optional<PemKeyCertPairList> key_cert_pairs) {
   CHECK_NE(security_connector_, nullptr);
-  MutexLock lock(&security_connector_->mu_);
-  if (root_certs.has_value()) {
-    security_connector_->pem_root_certs_ = root_certs;
-  }
-  if (key_cert_pairs.has_value()) {
-    security_connector_->pem_key_cert_pair_list_ = std::move(key_cert_pairs);
-  }
-  bool root_being_watched = security_connector_->options_->watch_root_cert();
-  bool root_has_value = security_connector_->pem_root_certs_.has_value();
-  bool identity_being_watched =
-      security_connector_->options_->watch_identity_pair();
-  bool identity_has_value =
-      security_connector_->pem_key_cert_pair_list_.has_value();
-  if ((root_being_watched && root_has_value && identity_being_watched &&
-       identity_has_value) ||
-      (root_being_watched && root_has_value && !identity_being_watched) ||
-      (!root_being_watched && identity_being_watched && identity_has_value)) {
-    if (security_connector_->UpdateHandshakerFactoryLocked() !=
-        GRPC_SECURITY_OK) {
-      LOG(ERROR) << "Update handshaker factory failed.";
+  MutexLock update_lock(&security_connector_->update_mu_);
+  std::optional<absl::string_view> pem_root_certs;
+  std::optional<PemKeyCertPairList> pem_key_cert_pair_list;
+  {
+    MutexLock lock(&security_connector_->mu_);
+    if (root_certs.has_value()) {
+      security_connector_->pem_root_certs_ = root_certs;
+    }
+    if (key_cert_pairs.has_value()) {
+      security_connector_->pem_key_cert_pair_list_ = std::move(key_cert_pairs);
+    }
+    bool root_being_watched = security_connector_->options_->watch_root_cert();
+    bool root_has_value = security_connector_->pem_root_certs_.has_value();
+    bool identity_being_watched =
+        security_connector_->options_->watch_identity_pair();
+    bool identity_has_value =
+        security_connector_->pem_key_cert_pair_list_.has_value();
+    if (!(root_being_watched && root_has_value && identity_being_watched &&
+          identity_has_value) &&
+        !(root_being_watched && root_has_value && !identity_being_watched) &&
+        !(!root_being_watched && identity_being_watched &&
+          identity_has_value)) {
+      return;
     }
+    pem_root_certs = security_connector_->pem_root_certs_;
+    pem_key_cert_pair_list = security_connector_->pem_key_cert_pair_list_;
+  }
+  if (security_connector_->UpdateHandshakerFactory(
+          pem_root_certs, pem_key_cert_pair_list, root_certs.has_value()) !=
+      GRPC_SECURITY_OK) {
+    LOG(ERROR) << "Update handshaker factory failed.";
   }
 }
 
@@ -780,36 +840,49 @@ void TlsServerSecurityConnector::ServerPendingVerifierRequest::OnVerifyDone(
 
 // TODO(ZhenLian): implement the logic to signal waiting handshakers once
 // BlockOnInitialCredentialHandshaker is implemented.
-grpc_security_status
-TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
-  // Free the server handshaker factory if exists.
-  if (server_handshaker_factory_ != nullptr) {
-    tsi_ssl_server_handshaker_factory_unref(server_handshaker_factory_);
-  }
+grpc_security_status TlsServerSecurityConnector::UpdateHandshakerFactory(
+    std::optional<absl::string_view> pem_root_certs_view,
+    const std::optional<PemKeyCertPairList>& pem_key_cert_pair_list,
+    bool root_certs_changed) {
   // The identity certs on the server side shouldn't be empty.
-  CHECK(pem_key_cert_pair_list_.has_value());
-  CHECK(!(*pem_key_cert_pair_list_).empty());
+  CHECK(pem_key_cert_pair_list.has_value());
+  CHECK(!(*pem_key_cert_pair_list).empty());
   std::string pem_root_certs;
-  if (pem_root_certs_.has_value()) {
+  if (pem_root_certs_view.has_value()) {
     // TODO(ZhenLian): update the underlying TSI layer to use C++ types like
     // std::string and absl::string_view to avoid making another copy here.
-    pem_root_certs = std::string(*pem_root_certs_);
-  }
+    pem_root_certs = std::string(*pem_root_certs_view);
+  }
+  const char* root_certs =
+      pem_root_certs.empty() ? nullptr : pem_root_certs.c_str();
+  // The CA list sent to clients is read from the PEM roots, so there is
+  // nothing to share when it is sent.
+  UpdateRootStore(root_certs, root_certs_changed,
+                  options_->crl_directory().empty() &&
+                      !options_->send_client_ca_list(),
+                  &root_store_);
   tsi_ssl_pem_key_cert_pair* pem_key_cert_pairs = nullptr;
-  pem_key_cert_pairs = ConvertToTsiPemKeyCertPair(*pem_key_cert_pair_list_);
-  size_t num_key_cert_pairs = (*pem_key_cert_pair_list_).size();
+  pem_key_cert_pairs = ConvertToTsiPemKeyCertPair(*pem_key_cert_pair_list);
+  size_t num_key_cert_pairs = (*pem_key_cert_pair_list).size();
+  tsi_ssl_server_handshaker_factory* factory = nullptr;
   grpc_security_status status = grpc_ssl_tsi_server_handshaker_factory_init(
-      pem_key_cert_pairs, num_key_cert_pairs,
-      pem_root_certs.empty() ? nullptr : pem_root_certs.c_str(),
+      pem_key_cert_pairs, num_key_cert_pairs, root_certs, root_store_,
       options_->cert_request_type(),
       grpc_get_tsi_tls_version(options_->min_tls_version()),
       grpc_get_tsi_tls_version(options_->max_tls_version()),
       tls_session_key_logger_.get(), options_->crl_directory().c_str(),
       options_->send_client_ca_list(), options_->crl_provider(),
-      &server_handshaker_factory_);
+      options_->session_ticket_key_provider(), &factory);
   // Free memory.
   grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pairs,
                                           num_key_cert_pairs);
+  // Handshakers hold their own refs, so the old factory is freed once the
+  // handshakes it started are done.
+  {
+    MutexLock lock(&mu_);
+    std::swap(server_handshaker_factory_, factory);
+  }
+  if (factory != nullptr) tsi_ssl_server_handshaker_factory_unref(factory);
   return status;
 }
 
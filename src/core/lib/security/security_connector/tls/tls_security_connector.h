@@ -148,10 +148,15 @@ class TlsChannelSecurityConnector final
   };
 
   // Updates |client_handshaker_factory_| when the certificates that
-  // |certificate_watcher_| is watching get updated.
-  grpc_security_status UpdateHandshakerFactoryLocked()
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
-
+  // |certificate_watcher_| is watching get updated. The new factory is built
+  // without holding |mu_|, so handshakes started meanwhile use the old one.
+  grpc_security_status UpdateHandshakerFactory(
+      std::optional<absl::string_view> pem_root_certs,
+      const std::optional<PemKeyCertPairList>& pem_key_cert_pair_list,
+      bool root_certs_changed) ABSL_EXCLUSIVE_LOCKS_REQUIRED(update_mu_);
+
+  // Serializes the updates of |client_handshaker_factory_|.
+  Mutex update_mu_;
   Mutex mu_;
   // We need a separate mutex for |pending_verifier_requests_|, otherwise there
   // would be deadlock errors.
@@ -163,7 +168,9 @@ class TlsChannelSecurityConnector final
   std::string overridden_target_name_;
   tsi_ssl_client_handshaker_factory* client_handshaker_factory_
       ABSL_GUARDED_BY(mu_) = nullptr;
-  tsi_ssl_session_cache* ssl_session_cache_ ABSL_GUARDED_BY(mu_) = nullptr;
+  // The parsed root certs, shared by the factories built until they change.
+  tsi_ssl_root_certs_store* root_store_ ABSL_GUARDED_BY(update_mu_) = nullptr;
+  tsi_ssl_session_cache* ssl_session_cache_ = nullptr;
   RefCountedPtr<TlsSessionKeyLogger> tls_session_key_logger_;
   std::optional<absl::string_view> pem_root_certs_ ABSL_GUARDED_BY(mu_);
   std::optional<PemKeyCertPairList> pem_key_cert_pair_list_
@@ -259,10 +266,15 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
   };
 
   // Updates |server_handshaker_factory_| when the certificates that
-  // |certificate_watcher_| is watching get updated.
-  grpc_security_status UpdateHandshakerFactoryLocked()
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
-
+  // |certificate_watcher_| is watching get updated. The new factory is built
+  // without holding |mu_|, so handshakes started meanwhile use the old one.
+  grpc_security_status UpdateHandshakerFactory(
+      std::optional<absl::string_view> pem_root_certs,
+      const std::optional<PemKeyCertPairList>& pem_key_cert_pair_list,
+      bool root_certs_changed) ABSL_EXCLUSIVE_LOCKS_REQUIRED(update_mu_);
+
+  // Serializes the updates of |server_handshaker_factory_|.
+  Mutex update_mu_;
   Mutex mu_;
   // We need a separate mutex for |pending_verifier_requests_|, otherwise there
   // would be deadlock errors.
@@ -272,6 +284,8 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
       certificate_watcher_ = nullptr;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory_
       ABSL_GUARDED_BY(mu_) = nullptr;
+  // The parsed root certs, shared by the factories built until they change.
+  tsi_ssl_root_certs_store* root_store_ ABSL_GUARDED_BY(update_mu_) = nullptr;
   std::optional<absl::string_view> pem_root_certs_ ABSL_GUARDED_BY(mu_);
   std::optional<PemKeyCertPairList> pem_key_cert_pair_list_
       ABSL_GUARDED_BY(mu_);
@@ -24,13 +24,54 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <new>
 #include <utility>
 
 #include "absl/log/check.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/util/debug_location.h"
 
 namespace grpc_core {
 
+namespace {
+
+// Backing store for SliceBuffer::AddContiguous: a refcounted block whose bytes
+// are handed out front to back. Only the SliceBuffer filling the block hands
+// out its free space, so used_ needs no synchronization; slices into the block
+// only ever cover bytes below used_, wherever they end up.
+class ContiguousBlock final : public grpc_slice_refcount {
+ public:
+  static ContiguousBlock* Make(size_t capacity) {
+    return new (gpr_malloc(sizeof(ContiguousBlock) + capacity))
+        ContiguousBlock(capacity);
+  }
+
+  uint8_t* begin() { return reinterpret_cast<uint8_t*>(this + 1); }
+  uint8_t* free_begin() { return begin() + used_; }
+
+  // Claim the next n free bytes, if there's room.
+  bool Claim(size_t n) {
+    if (n > capacity_ - used_) return false;
+    used_ += n;
+    return true;
+  }
+
+ private:
+  explicit ContiguousBlock(size_t capacity)
+      : grpc_slice_refcount(Destroy), capacity_(capacity) {}
+
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* block = static_cast<ContiguousBlock*>(p);
+    block->~ContiguousBlock();
+    gpr_free(block);
+  }
+
+  const size_t capacity_;
+  size_t used_ = 0;
+};
+
+}  // namespace
+
 void SliceBuffer::Append(Slice slice) {
   grpc_slice_buffer_add(&slice_buffer_, slice.TakeCSlice());
 }
@@ -45,6 +86,42 @@ size_t SliceBuffer::AppendIndexed(Slice slice) {
   return grpc_slice_buffer_add_indexed(&slice_buffer_, slice.TakeCSlice());
 }
 
+uint8_t* SliceBuffer::AddContiguous(size_t n, size_t block_size) {
+  if (n > block_size / 2) {
+    const size_t index =
+        grpc_slice_buffer_add_indexed(&slice_buffer_, GRPC_SLICE_MALLOC(n));
+    return GRPC_SLICE_START_PTR(slice_buffer_.slices[index]);
+  }
+  auto* block = static_cast<ContiguousBlock*>(contiguous_block_);
+  // Extend the last slice if it leads up to the block's free space.
+  if (block != nullptr && slice_buffer_.count != 0) {
+    grpc_slice& back = slice_buffer_.slices[slice_buffer_.count - 1];
+    uint8_t* out = block->free_begin();
+    if (back.refcount == block && GRPC_SLICE_END_PTR(back) == out &&
+        block->Claim(n)) {
+      back.data.refcounted.length += n;
+      slice_buffer_.length += n;
+      return out;
+    }
+  }
+  // Otherwise start a new slice, in a new block if this one is full.
+  uint8_t* out = block == nullptr ? nullptr : block->free_begin();
+  if (block == nullptr || !block->Claim(n)) {
+    if (block != nullptr) block->Unref(DEBUG_LOCATION);
+    block = ContiguousBlock::Make(block_size);
+    contiguous_block_ = block;
+    out = block->free_begin();
+    CHECK(block->Claim(n));
+  }
+  block->Ref(DEBUG_LOCATION);
+  grpc_slice slice;
+  slice.refcount = block;
+  slice.data.refcounted.bytes = out;
+  slice.data.refcounted.length = n;
+  grpc_slice_buffer_add_indexed(&slice_buffer_, slice);
+  return out;
+}
+
 Slice SliceBuffer::TakeFirst() {
   return Slice(grpc_slice_buffer_take_first(&slice_buffer_));
 }
@@ -184,6 +261,29 @@ size_t grpc_slice_buffer_add_indexed(grpc_slice_buffer* sb, grpc_slice s) {
   return out;
 }
 
+void grpc_slice_buffer_reserve_slices(grpc_slice_buffer* sb, size_t n) {
+  size_t slice_offset = static_cast<size_t>(sb->slices - sb->base_slices);
+  if (sb->capacity - slice_offset - sb->count >= n) return;
+  const size_t new_capacity = sb->count + n;
+  if (new_capacity <= sb->capacity) {
+    // Enough room once the slices are moved back to the start of the array.
+    memmove(sb->base_slices, sb->slices, sb->count * sizeof(grpc_slice));
+  } else if (sb->base_slices == sb->inlined) {
+    sb->base_slices = static_cast<grpc_slice*>(
+        gpr_malloc(new_capacity * sizeof(grpc_slice)));
+    memcpy(sb->base_slices, sb->slices, sb->count * sizeof(grpc_slice));
+    sb->capacity = new_capacity;
+  } else {
+    if (slice_offset != 0) {
+      memmove(sb->base_slices, sb->slices, sb->count * sizeof(grpc_slice));
+    }
+    sb->base_slices = static_cast<grpc_slice*>(
+        gpr_realloc(sb->base_slices, new_capacity * sizeof(grpc_slice)));
+    sb->capacity = new_capacity;
+  }
+  sb->slices = sb->base_slices;
+}
+
 void grpc_slice_buffer_add(grpc_slice_buffer* sb, grpc_slice s) {
   size_t n = sb->count;
   grpc_slice* back = nullptr;
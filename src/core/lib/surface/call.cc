@@ -90,6 +90,7 @@
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
+#include "src/core/telemetry/call_cpu_accounting.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
@@ -471,6 +472,11 @@ grpc_call_error grpc_call_start_batch(grpc_call* call, const grpc_op* ops,
   if (reserved != nullptr || call == nullptr) {
     return GRPC_CALL_ERROR;
   } else {
+    // Declared before the ExecCtx, so that the closures run when it is
+    // flushed are accounted to the call as well.
+    grpc_core::CallCpuAccounting::Scope cpu_scope(
+        grpc_call_get_arena(call)->GetContext<grpc_core::CallCpuAccounting>(),
+        grpc_core::CallCpuAccounting::Phase::kCore);
     grpc_core::ExecCtx exec_ctx;
     return grpc_core::Call::FromC(call)->StartBatch(ops, nops, tag, false);
   }
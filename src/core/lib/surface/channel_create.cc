@@ -69,6 +69,9 @@ absl::StatusOr<RefCountedPtr<Channel>> ChannelCreate(
     std::string channelz_node_target{target.empty() ? "unknown" : target};
     auto channelz_node = MakeRefCounted<channelz::ChannelNode>(
         channelz_node_target, channel_tracer_max_memory, is_internal_channel);
+    if (args.GetBool(GRPC_ARG_CHANNELZ_CALL_LATENCY).value_or(false)) {
+      channelz_node->EnableCallLatency();
+    }
     channelz_node->AddTraceEvent(
         channelz::ChannelTrace::Severity::Info,
         grpc_slice_from_static_string("Channel created"));
@@ -39,6 +39,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/executor.h"
@@ -54,8 +55,9 @@
 #include "src/core/util/status_helper.h"
 #include "src/core/util/time.h"
 
-#ifdef GPR_WINDOWS
-#include "src/core/lib/experiments/experiments.h"
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#include <immintrin.h>
 #endif
 
 namespace {
@@ -272,6 +274,13 @@ struct cq_next_data {
 
   /// 0 initially. 1 once we initiated shutdown
   bool shutdown_called = false;
+
+  /// Smoothed time between events returned by cq_next, and when the last
+  /// one was returned, in nanoseconds.  Only maintained when the
+  /// cq_next_adaptive_spin experiment is enabled.  Updated without
+  /// synchronization between concurrent callers, since it is only a hint.
+  std::atomic<int64_t> smoothed_event_interval_ns{INT64_MAX};
+  std::atomic<int64_t> last_event_ns{0};
 };
 
 struct cq_pluck_data {
@@ -924,6 +933,73 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
+namespace {
+
+// Spin for no longer than this before polling, however frequent events are.
+constexpr int64_t kMaxCqSpinNs = 50000;
+// Pause instructions between checks of the queue grow up to this many.
+constexpr int kMaxCqSpinPausesPerCheck = 64;
+
+int64_t CqSpinNowNs() {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  return static_cast<int64_t>(now.tv_sec) * GPR_NS_PER_SEC + now.tv_nsec;
+}
+
+// Tells the CPU that we are busy-waiting.
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+// Folds the time since the previous event into the smoothed interval.
+void CqRecordEventTime(cq_next_data* cqd) {
+  const int64_t now = CqSpinNowNs();
+  const int64_t last =
+      cqd->last_event_ns.exchange(now, std::memory_order_relaxed);
+  if (last == 0 || now <= last) return;
+  const int64_t interval = now - last;
+  const int64_t smoothed =
+      cqd->smoothed_event_interval_ns.load(std::memory_order_relaxed);
+  cqd->smoothed_event_interval_ns.store(
+      smoothed == INT64_MAX ? interval : smoothed + (interval - smoothed) / 8,
+      std::memory_order_relaxed);
+}
+
+// If events have recently been arriving faster than the cost of going to
+// sleep in the poller and being woken up again, waits for the next one by
+// spinning on the queue, for up to twice the smoothed time between events.
+// Backs off exponentially between checks, to stay off the queue's cache
+// line.  Returns nullptr if nothing arrived in time.  Events that only this
+// thread's polling would produce never turn up while spinning, but then the
+// time spent spinning lengthens the measured interval until spinning stops.
+grpc_cq_completion* CqSpinForCompletion(cq_next_data* cqd) {
+  const int64_t smoothed =
+      cqd->smoothed_event_interval_ns.load(std::memory_order_relaxed);
+  if (smoothed > kMaxCqSpinNs / 2) return nullptr;
+  const int64_t spin_deadline = CqSpinNowNs() + 2 * smoothed;
+  intptr_t last_seen =
+      cqd->things_queued_ever.load(std::memory_order_relaxed);
+  int pauses = 1;
+  do {
+    for (int i = 0; i < pauses; ++i) CpuRelax();
+    pauses = std::min(pauses * 2, kMaxCqSpinPausesPerCheck);
+    const intptr_t queued =
+        cqd->things_queued_ever.load(std::memory_order_relaxed);
+    if (queued != last_seen) {
+      last_seen = queued;
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c != nullptr) return c;
+    }
+  } while (CqSpinNowNs() < spin_deadline);
+  return nullptr;
+}
+
+}  // namespace
+
 static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
                           void* reserved) {
   grpc_event ret;
@@ -1009,6 +1085,19 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
       break;
     }
 
+    if (grpc_core::IsCqNextAdaptiveSpinEnabled() &&
+        iteration_deadline > grpc_core::Timestamp::ProcessEpoch() &&
+        deadline_millis > grpc_core::Timestamp::Now()) {
+      c = CqSpinForCompletion(cqd);
+      if (c != nullptr) {
+        ret.type = GRPC_OP_COMPLETE;
+        ret.success = c->next & 1u;
+        ret.tag = c->tag;
+        c->done(c->done_arg, c);
+        break;
+      }
+    }
+
     // The main polling work happens in grpc_pollset_work
     gpr_mu_lock(cq->mu);
     cq->num_polls++;
@@ -1038,6 +1127,11 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
+  if (ret.type == GRPC_OP_COMPLETE &&
+      grpc_core::IsCqNextAdaptiveSpinEnabled()) {
+    CqRecordEventTime(cqd);
+  }
+
   GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
@@ -1093,6 +1187,40 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline,
+                                        void* reserved) {
+  GRPC_TRACE_LOG(api, INFO)
+      << "grpc_completion_queue_next_batch(cq=" << cq
+      << ", max_events=" << max_events << ")";
+  CHECK_EQ(cq->vtable->cq_completion_type, GRPC_CQ_NEXT);
+  CHECK_GT(max_events, 0u);
+  events[0] = cq->vtable->next(cq, deadline, reserved);
+  if (events[0].type != GRPC_OP_COMPLETE) return 1;
+  // Take whatever else is already queued, without polling again.  Pop()
+  // may miss an event that is being pushed concurrently; that one is left
+  // for the next call.
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+  GRPC_CQ_INTERNAL_REF(cq, "next_batch");
+  size_t num_events = 1;
+  {
+    grpc_core::ExecCtx exec_ctx;
+    while (num_events < max_events) {
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c == nullptr) break;
+      grpc_event& ev = events[num_events++];
+      ev.type = GRPC_OP_COMPLETE;
+      ev.success = c->next & 1u;
+      ev.tag = c->tag;
+      c->done(c->done_arg, c);
+      GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ev);
+    }
+  }
+  GRPC_CQ_INTERNAL_UNREF(cq, "next_batch");
+  return num_events;
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -61,6 +61,9 @@
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/call_cpu_accounting.h"
+#include "src/core/telemetry/latency_breakdown.h"
+#include "src/core/telemetry/slow_call_capture.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
 #include "src/core/util/alloc.h"
@@ -138,6 +141,10 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
     // properties (tracing included) from the parent.
     channel_stack->stats_plugin_group->AddClientCallTracers(
         Slice(CSliceRef(path)), args->registered_method, arena.get());
+    MaybeAddLatencyBreakdownClientCallTracer(
+        *channel_stack->stats_plugin_group, arena.get());
+    MaybeAddSlowCallCaptureClientCallTracer(Slice(CSliceRef(path)),
+                                            arena.get());
   } else {
     global_stats().IncrementServerCallsCreated();
     call->final_op_.server.cancelled = nullptr;
@@ -165,6 +172,11 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
       }
     }
     channel_stack->stats_plugin_group->AddServerCallTracers(arena.get());
+    MaybeAddLatencyBreakdownServerCallTracer(
+        *channel_stack->stats_plugin_group, arena.get());
+    MaybeAddCallCpuAccounting(*channel_stack->stats_plugin_group,
+                              arena.get());
+    MaybeAddSlowCallCaptureServerCallTracer(arena.get());
   }
 
   // initial refcount dropped by grpc_call_unref
@@ -374,6 +386,12 @@ void FilterStackCall::SetFinalStatus(grpc_error_handle error) {
       } else {
         channelz_channel->RecordCallSucceeded();
       }
+      if (channelz_channel->call_latency_enabled()) {
+        channelz_channel->RecordCallLatency(
+            gpr_timespec_to_micros(gpr_cycle_counter_sub(
+                gpr_get_cycle_counter(), start_time())) /
+            GPR_US_PER_SEC);
+      }
     }
   } else {
     *final_op_.server.cancelled =
@@ -49,6 +49,7 @@
 #include "src/core/util/fork.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/thd.h"
+#include "src/core/util/time.h"
 
 // Remnants of the old plugin system
 void grpc_resolver_dns_ares_init(void);
@@ -108,6 +109,10 @@ static void do_basic_init(void) {
   g_shutting_down_cv = new grpc_core::CondVar();
   gpr_time_init();
   grpc_core::PrintExperimentsList();
+  if (grpc_core::IsTscClockEnabled() && !grpc_core::EnableTscClock()) {
+    LOG(INFO) << "The CPU has no invariant TSC: the tsc_clock experiment has "
+                 "no effect";
+  }
   grpc_core::Fork::GlobalInit();
   grpc_fork_handlers_auto_register();
   grpc_tracer_init();
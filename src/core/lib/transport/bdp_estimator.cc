@@ -23,6 +23,7 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <cstdlib>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -37,7 +38,11 @@ BdpEstimator::BdpEstimator(absl::string_view name)
       stable_estimate_count_(0),
       ping_state_(PingState::UNSCHEDULED),
       bw_est_(0),
-      name_(name) {}
+      name_(name),
+      min_rtt_us_(0),
+      min_rtt_stamp_(gpr_time_0(GPR_CLOCK_MONOTONIC)),
+      smoothed_rtt_us_(0),
+      rtt_variance_us_(0) {}
 
 Timestamp BdpEstimator::CompletePing() {
   gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
@@ -51,6 +56,11 @@ Timestamp BdpEstimator::CompletePing() {
       << " est=" << estimate_ << " dt=" << dt << " bw=" << bw / 125000.0
       << "Mbs bw_est=" << bw_est_ / 125000.0 << "Mbs";
   CHECK(ping_state_ == PingState::STARTED);
+  if (dt > 0) {
+    UpdatePathModel(now, dt_ts.tv_sec * GPR_US_PER_SEC +
+                             dt_ts.tv_nsec / GPR_NS_PER_US,
+                    bw);
+  }
   if (accumulator_ > 2 * estimate_ / 3 && bw > bw_est_) {
     estimate_ = std::max(accumulator_, estimate_ * 2);
     bw_est_ = bw;
@@ -77,4 +87,34 @@ Timestamp BdpEstimator::CompletePing() {
   return Timestamp::Now() + inter_ping_delay_;
 }
 
+double BdpEstimator::DeliveryRate() const {
+  return *std::max_element(delivery_rates_.begin(), delivery_rates_.end());
+}
+
+void BdpEstimator::UpdatePathModel(gpr_timespec now, int64_t rtt_us,
+                                   double delivery_rate) {
+  // Take any sample that is lower, or the latest one once the current minimum
+  // is stale, so that route changes to a longer path are eventually noticed.
+  if (min_rtt_us_ == 0 || rtt_us <= min_rtt_us_ ||
+      Duration::FromTimespec(gpr_time_sub(now, min_rtt_stamp_)) >
+          kMinRttWindow) {
+    min_rtt_us_ = rtt_us;
+    min_rtt_stamp_ = now;
+  }
+  if (smoothed_rtt_us_ == 0) {
+    smoothed_rtt_us_ = rtt_us;
+    rtt_variance_us_ = rtt_us / 2;
+  } else {
+    rtt_variance_us_ =
+        (rtt_variance_us_ * 3 + std::abs(smoothed_rtt_us_ - rtt_us)) / 4;
+    smoothed_rtt_us_ = (smoothed_rtt_us_ * 7 + rtt_us) / 8;
+  }
+  delivery_rates_[next_delivery_rate_] = delivery_rate;
+  next_delivery_rate_ = (next_delivery_rate_ + 1) % kDeliveryRateWindow;
+  GRPC_TRACE_LOG(bdp_estimator, INFO)
+      << "bdp[" << name_ << "]:path min_rtt=" << min_rtt_us_
+      << "us srtt=" << smoothed_rtt_us_ << "us rttvar=" << rtt_variance_us_
+      << "us delivery_rate=" << DeliveryRate() / 125000.0 << "Mbs";
+}
+
 }  // namespace grpc_core
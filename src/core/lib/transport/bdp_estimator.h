@@ -23,6 +23,7 @@
 #include <grpc/support/time.h>
 #include <inttypes.h>
 
+#include <array>
 #include <string>
 
 #include "absl/log/check.h"
@@ -72,7 +73,37 @@ class BdpEstimator {
 
   int64_t accumulator() const { return accumulator_; }
 
+  // Path model derived from ping round trips, in the style of BBR: each
+  // completed ping yields an RTT sample and a delivery rate sample (bytes
+  // received while the ping was outstanding divided by its RTT).
+  // RTTs are kept in microseconds, since pings on a local network often
+  // complete in well under a millisecond.
+  // Minimum RTT observed within the last kMinRttWindow; zero until sampled.
+  int64_t min_rtt_us() const { return min_rtt_us_; }
+  // RFC 6298 smoothed RTT and RTT variance; zero until sampled.
+  int64_t smoothed_rtt_us() const { return smoothed_rtt_us_; }
+  int64_t rtt_variance_us() const { return rtt_variance_us_; }
+  // Maximum delivery rate over the last kDeliveryRateWindow pings, in bytes
+  // per second; zero until sampled.
+  double DeliveryRate() const;
+  // Bandwidth-delay product implied by DeliveryRate() and min_rtt_us(), in
+  // bytes.
+  int64_t DeliveryRateBdp() const {
+    return static_cast<int64_t>(DeliveryRate() *
+                                static_cast<double>(min_rtt_us_) / 1e6);
+  }
+  // Recommended send pacing rate in bytes per second, or zero if there is no
+  // estimate yet. Paces slightly above the measured bottleneck rate so that
+  // an increase in available bandwidth is discovered.
+  double PacingRate() const { return kPacingGain * DeliveryRate(); }
+
  private:
+  static constexpr Duration kMinRttWindow = Duration::Seconds(10);
+  static constexpr size_t kDeliveryRateWindow = 10;
+  static constexpr double kPacingGain = 1.25;
+
+  void UpdatePathModel(gpr_timespec now, int64_t rtt_us, double delivery_rate);
+
   enum class PingState { UNSCHEDULED, SCHEDULED, STARTED };
 
   int64_t accumulator_;
@@ -84,6 +115,12 @@ class BdpEstimator {
   PingState ping_state_;
   double bw_est_;
   absl::string_view name_;
+  int64_t min_rtt_us_;
+  gpr_timespec min_rtt_stamp_;
+  int64_t smoothed_rtt_us_;
+  int64_t rtt_variance_us_;
+  std::array<double, kDeliveryRateWindow> delivery_rates_{};
+  size_t next_delivery_rate_ = 0;
 };
 
 }  // namespace grpc_core
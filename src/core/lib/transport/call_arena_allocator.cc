@@ -18,10 +18,26 @@
 
 #include <algorithm>
 
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
 namespace grpc_core {
 
+RefCountedPtr<Arena> CallArenaAllocator::MakeArena() {
+  const size_t initial_size = call_size_estimator_.CallSizeEstimate();
+  global_stats().IncrementCallInitialSize(initial_size);
+  return Arena::Create(initial_size, Ref());
+}
+
 void CallArenaAllocator::FinalizeArena(Arena* arena) {
-  call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
+  const size_t used = arena->TotalUsedBytes();
+  global_stats().IncrementCallFinalSize(used);
+  call_size_estimator_.UpdateCallSizeEstimate(used);
+  size_t max = max_call_size_.load(std::memory_order_relaxed);
+  while (max < used && !max_call_size_.compare_exchange_weak(
+                           max, used, std::memory_order_relaxed,
+                           std::memory_order_relaxed)) {
+  }
 }
 
 }  // namespace grpc_core
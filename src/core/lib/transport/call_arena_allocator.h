@@ -74,16 +74,20 @@ class CallArenaAllocator final : public ArenaFactory {
       : ArenaFactory(std::move(allocator)),
         call_size_estimator_(initial_size) {}
 
-  RefCountedPtr<Arena> MakeArena() override {
-    return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
-  }
+  RefCountedPtr<Arena> MakeArena() override;
 
   void FinalizeArena(Arena* arena) override;
 
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
 
+  // The most memory used by any one call's arena so far.
+  size_t MaxCallSize() const {
+    return max_call_size_.load(std::memory_order_relaxed);
+  }
+
  private:
   CallSizeEstimator call_size_estimator_;
+  std::atomic<size_t> max_call_size_{0};
 };
 
 }  // namespace grpc_core
@@ -461,6 +461,21 @@ void AddServerTrailingMetadata(
       }});
 }
 
+template <typename FilterType>
+void AddServerTrailingMetadata(
+    FilterType* channel_data, size_t call_offset,
+    ServerMetadataHandle (FilterType::Call::*)(ServerMetadataHandle,
+                                               FilterType*),
+    std::vector<ServerTrailingMetadataOperator>& to) {
+  to.push_back(ServerTrailingMetadataOperator{
+      channel_data, call_offset,
+      [](void* call_data, void* channel_data, ServerMetadataHandle metadata) {
+        return static_cast<typename FilterType::Call*>(call_data)
+            ->OnServerTrailingMetadata(std::move(metadata),
+                                       static_cast<FilterType*>(channel_data));
+      }});
+}
+
 template <typename FilterType>
 void AddServerTrailingMetadata(FilterType*, size_t, const NoInterceptor*,
                                std::vector<ServerTrailingMetadataOperator>&) {}
@@ -993,6 +1008,107 @@ struct AddOpImpl<FilterType, T, R (FilterType::Call::*)(T, FilterType*), impl,
   }
 };
 
+// PROMISE_RETURNING(ServerMetadataOrHandle<$VALUE_TYPE>)
+// $INTERCEPTOR_NAME($VALUE_HANDLE)
+// As declared by fused filters on a base class of FilterType::Call.
+template <typename FilterType, typename T, typename R, typename Base,
+          R (Base::*impl)(T)>
+struct AddOpImpl<
+    FilterType, T, R (Base::*)(T), impl,
+    absl::enable_if_t<
+        std::is_same<ServerMetadataOrHandle<typename T::element_type>,
+                     PromiseResult<R>>::value>> {
+  static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
+    class Promise {
+     public:
+      Promise(T value, typename FilterType::Call* call_data, FilterType*)
+          : impl_((call_data->*impl)(std::move(value))) {}
+
+      Poll<ResultOr<T>> PollOnce() {
+        auto p = impl_();
+        auto* r = p.value_if_ready();
+        if (r == nullptr) return Pending{};
+        this->~Promise();
+        if (r->ok()) return ResultOr<T>{std::move(**r), nullptr};
+        return ResultOr<T>{nullptr, std::move(r->metadata())};
+      }
+
+     private:
+      GPR_NO_UNIQUE_ADDRESS R impl_;
+    };
+    to.Add(sizeof(Promise), alignof(Promise),
+           Operator<T>{
+               channel_data,
+               call_offset,
+               [](void* promise_data, void* call_data, void* channel_data,
+                  T value) -> Poll<ResultOr<T>> {
+                 auto* promise = new (promise_data)
+                     Promise(std::move(value),
+                             static_cast<typename FilterType::Call*>(call_data),
+                             static_cast<FilterType*>(channel_data));
+                 return promise->PollOnce();
+               },
+               [](void* promise_data) {
+                 return static_cast<Promise*>(promise_data)->PollOnce();
+               },
+               [](void* promise_data) {
+                 static_cast<Promise*>(promise_data)->~Promise();
+               },
+           });
+  }
+};
+
+// PROMISE_RETURNING(ServerMetadataOrHandle<$VALUE_TYPE>)
+// $INTERCEPTOR_NAME($VALUE_HANDLE, FilterType*)
+// As declared by fused filters on a base class of FilterType::Call.
+template <typename FilterType, typename T, typename R, typename Base,
+          R (Base::*impl)(T, FilterType*)>
+struct AddOpImpl<
+    FilterType, T, R (Base::*)(T, FilterType*), impl,
+    absl::enable_if_t<
+        std::is_same<ServerMetadataOrHandle<typename T::element_type>,
+                     PromiseResult<R>>::value>> {
+  static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
+    class Promise {
+     public:
+      Promise(T value, typename FilterType::Call* call_data,
+              FilterType* channel_data)
+          : impl_((call_data->*impl)(std::move(value), channel_data)) {}
+
+      Poll<ResultOr<T>> PollOnce() {
+        auto p = impl_();
+        auto* r = p.value_if_ready();
+        if (r == nullptr) return Pending{};
+        this->~Promise();
+        if (r->ok()) return ResultOr<T>{std::move(**r), nullptr};
+        return ResultOr<T>{nullptr, std::move(r->metadata())};
+      }
+
+     private:
+      GPR_NO_UNIQUE_ADDRESS R impl_;
+    };
+    to.Add(sizeof(Promise), alignof(Promise),
+           Operator<T>{
+               channel_data,
+               call_offset,
+               [](void* promise_data, void* call_data, void* channel_data,
+                  T value) -> Poll<ResultOr<T>> {
+                 auto* promise = new (promise_data)
+                     Promise(std::move(value),
+                             static_cast<typename FilterType::Call*>(call_data),
+                             static_cast<FilterType*>(channel_data));
+                 return promise->PollOnce();
+               },
+               [](void* promise_data) {
+                 return static_cast<Promise*>(promise_data)->PollOnce();
+               },
+               [](void* promise_data) {
+                 static_cast<Promise*>(promise_data)->~Promise();
+               },
+           });
+  }
+};
+
 struct ChannelDataDestructor {
   void (*destroy)(void* channel_data);
   void* channel_data;
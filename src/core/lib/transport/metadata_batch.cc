@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
 
 #include "absl/base/no_destructor.h"
 #include "absl/container/flat_hash_set.h"
@@ -62,6 +63,8 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
         allow_list.insert(std::string(ContentTypeMetadata::key()));
         allow_list.insert(std::string(EndpointLoadMetricsBinMetadata::key()));
         allow_list.insert(std::string(GrpcAcceptEncodingMetadata::key()));
+        allow_list.insert(
+            std::string(GrpcAcceptZstdDictionaryMetadata::key()));
         allow_list.insert(std::string(GrpcEncodingMetadata::key()));
         allow_list.insert(std::string(GrpcInternalEncodingRequest::key()));
         allow_list.insert(std::string(GrpcLbClientStatsMetadata::key()));
@@ -73,6 +76,7 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
         allow_list.insert(std::string(GrpcTagsBinMetadata::key()));
         allow_list.insert(std::string(GrpcTimeoutMetadata::key()));
         allow_list.insert(std::string(GrpcTraceBinMetadata::key()));
+        allow_list.insert(std::string(GrpcZstdDictionaryMetadata::key()));
         allow_list.insert(std::string(HostMetadata::key()));
         allow_list.insert(std::string(HttpAuthorityMetadata::key()));
         allow_list.insert(std::string(HttpMethodMetadata::key()));
@@ -103,7 +107,11 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
 }
 
 void UnknownMap::Append(absl::string_view key, Slice value) {
-  unknown_.emplace_back(Slice::FromCopiedString(key), value.Ref());
+  unknown_.emplace_back(Slice::FromCopiedString(key), std::move(value));
+}
+
+void UnknownMap::Append(Slice key, Slice value) {
+  unknown_.emplace_back(std::move(key), std::move(value));
 }
 
 void UnknownMap::Remove(absl::string_view key) {
@@ -380,4 +388,20 @@ std::string WaitForReady::DisplayValue(ValueType x) {
                       x.explicitly_set ? " (explicit)" : "");
 }
 
+std::string GrpcWritePriority::DisplayValue(ValueType x) {
+  absl::string_view priority_class;
+  switch (x.priority_class) {
+    case Class::kHigh:
+      priority_class = "high";
+      break;
+    case Class::kNormal:
+      priority_class = "normal";
+      break;
+    case Class::kBulk:
+      priority_class = "bulk";
+      break;
+  }
+  return absl::StrCat(priority_class, " weight=", static_cast<int>(x.weight));
+}
+
 }  // namespace grpc_core
@@ -24,7 +24,10 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -45,7 +48,6 @@
 #include "src/core/lib/transport/parsed_metadata.h"
 #include "src/core/lib/transport/simple_slice_based_metadata.h"
 #include "src/core/util/chunked_vector.h"
-#include "src/core/util/if_list.h"
 #include "src/core/util/packed_table.h"
 #include "src/core/util/time.h"
 #include "src/core/util/type_list.h"
@@ -262,6 +264,26 @@ struct GrpcAcceptEncodingMetadata {
   }
 };
 
+// grpc-zstd-dictionary metadata trait: the id of the dictionary that messages
+// compressed with zstd are compressed against.
+struct GrpcZstdDictionaryMetadata : public SimpleSliceBasedMetadata {
+  static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
+  static constexpr bool kTransferOnTrailersOnly = false;
+  using CompressionTraits = SmallSetOfValuesCompressor;
+  static absl::string_view key() { return "grpc-zstd-dictionary"; }
+};
+
+// grpc-accept-zstd-dictionary metadata trait: the comma separated ids of the
+// zstd dictionaries that the sender can decompress with.
+struct GrpcAcceptZstdDictionaryMetadata : public SimpleSliceBasedMetadata {
+  static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
+  static constexpr bool kTransferOnTrailersOnly = false;
+  using CompressionTraits = StableValueCompressor;
+  static absl::string_view key() { return "grpc-accept-zstd-dictionary"; }
+};
+
 // user-agent metadata trait.
 struct UserAgentMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
@@ -273,6 +295,7 @@ struct UserAgentMetadata : public SimpleSliceBasedMetadata {
 // grpc-message metadata trait.
 struct GrpcMessageMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
   static absl::string_view key() { return "grpc-message"; }
@@ -281,6 +304,7 @@ struct GrpcMessageMetadata : public SimpleSliceBasedMetadata {
 // host metadata trait.
 struct HostMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
   static absl::string_view key() { return "host"; }
@@ -289,6 +313,7 @@ struct HostMetadata : public SimpleSliceBasedMetadata {
 // endpoint-load-metrics-bin metadata trait.
 struct EndpointLoadMetricsBinMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
   static absl::string_view key() { return "endpoint-load-metrics-bin"; }
@@ -297,6 +322,7 @@ struct EndpointLoadMetricsBinMetadata : public SimpleSliceBasedMetadata {
 // grpc-server-stats-bin metadata trait.
 struct GrpcServerStatsBinMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
   static absl::string_view key() { return "grpc-server-stats-bin"; }
@@ -313,6 +339,7 @@ struct GrpcTraceBinMetadata : public SimpleSliceBasedMetadata {
 // grpc-tags-bin metadata trait.
 struct GrpcTagsBinMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = FrequentKeyWithNoValueCompressionCompressor;
   static absl::string_view key() { return "grpc-tags-bin"; }
@@ -321,6 +348,7 @@ struct GrpcTagsBinMetadata : public SimpleSliceBasedMetadata {
 // XEnvoyPeerMetadata
 struct XEnvoyPeerMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = true;
   using CompressionTraits = StableValueCompressor;
   static absl::string_view key() { return "x-envoy-peer-metadata"; }
@@ -479,6 +507,7 @@ class GrpcLbClientStats;
 
 struct GrpcLbClientStatsMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   static absl::string_view key() { return "grpclb_client_stats"; }
   using ValueType = GrpcLbClientStats*;
@@ -504,6 +533,7 @@ inline size_t EncodedSizeOfKey(GrpcLbClientStatsMetadata,
 // lb-token metadata
 struct LbTokenMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
   static absl::string_view key() { return "lb-token"; }
@@ -512,6 +542,7 @@ struct LbTokenMetadata : public SimpleSliceBasedMetadata {
 // lb-cost-bin metadata
 struct LbCostBinMetadata {
   static constexpr bool kRepeatable = true;
+  static constexpr bool kRarelySet = true;
   static constexpr bool kTransferOnTrailersOnly = false;
   static absl::string_view key() { return "lb-cost-bin"; }
   struct ValueType {
@@ -562,6 +593,7 @@ struct PeerString {
 struct GrpcStatusContext {
   static absl::string_view DebugKey() { return "GrpcStatusContext"; }
   static constexpr bool kRepeatable = true;
+  static constexpr bool kRarelySet = true;
   using ValueType = std::string;
   static const std::string& DisplayValue(const std::string& x);
 };
@@ -630,6 +662,21 @@ struct GrpcTarPit {
   static absl::string_view DisplayValue(Empty) { return "tarpit"; }
 };
 
+// Annotation added by filters to ask the transport to schedule this call's
+// outgoing frames in a strict priority class: calls in a higher class are
+// written first, and calls within a class share the connection in proportion
+// to their weight.
+struct GrpcWritePriority {
+  enum class Class : uint8_t { kHigh, kNormal, kBulk };
+  struct ValueType {
+    Class priority_class = Class::kNormal;
+    uint8_t weight = 16;
+  };
+  static absl::string_view DebugKey() { return "GrpcWritePriority"; }
+  static constexpr bool kRepeatable = false;
+  static std::string DisplayValue(ValueType x);
+};
+
 namespace metadata_detail {
 
 // Build a key/value formatted debug string.
@@ -687,24 +734,84 @@ struct EncodableTraits<void> {
   using List = Typelist<>;
 };
 
-template <typename Trait>
-struct EncodableNameLookupKeyComparison {
-  bool operator()(absl::string_view key) { return key == Trait::key(); }
+// Maps the keys of a list of encodable traits to their positions in the
+// list. Keys are hashed on their length and first and last characters, which
+// tells all of the known keys apart, so a lookup is one probe and one string
+// comparison rather than a comparison against every key in turn.
+template <typename... Traits>
+class NameLookupTable {
+ public:
+  static constexpr size_t kNotFound = sizeof...(Traits);
+
+  static size_t Find(absl::string_view key) {
+    static const NameLookupTable table;
+    return table.FindIndex(key);
+  }
+
+ private:
+  static_assert(sizeof...(Traits) < 255, "Too many traits");
+  // A power of two with at least four slots per key, which keeps collisions
+  // rare and probe sequences short when they happen.
+  static constexpr size_t kSlots = []() {
+    size_t slots = 8;
+    while (slots < 4 * sizeof...(Traits)) slots *= 2;
+    return slots;
+  }();
+  static constexpr uint8_t kEmpty = 255;
+
+  NameLookupTable() : keys_{Traits::key()...} {
+    std::fill(std::begin(slots_), std::end(slots_), kEmpty);
+    for (size_t i = 0; i < sizeof...(Traits); i++) {
+      size_t slot = Hash(keys_[i]);
+      while (slots_[slot] != kEmpty) slot = (slot + 1) & (kSlots - 1);
+      slots_[slot] = static_cast<uint8_t>(i);
+    }
+  }
+
+  static size_t Hash(absl::string_view key) {
+    if (key.empty()) return 0;
+    return (key.size() * 31 + static_cast<uint8_t>(key.front()) * 3 +
+            static_cast<uint8_t>(key.back())) &
+           (kSlots - 1);
+  }
+
+  size_t FindIndex(absl::string_view key) const {
+    for (size_t slot = Hash(key); slots_[slot] != kEmpty;
+         slot = (slot + 1) & (kSlots - 1)) {
+      if (keys_[slots_[slot]] == key) return slots_[slot];
+    }
+    return kNotFound;
+  }
+
+  const absl::string_view keys_[sizeof...(Traits)];
+  uint8_t slots_[kSlots];
 };
 
 template <typename Trait, typename Op>
 struct EncodableNameLookupOnFound {
-  auto operator()(Op* op) { return op->Found(Trait()); }
+  static auto Call(Op* op) { return op->Found(Trait()); }
 };
 
 template <typename... Traits>
 struct EncodableNameLookup {
   template <typename Op>
   static auto Lookup(absl::string_view key, Op* op) {
-    return IfList(
-        key, op, [key](Op* op) { return op->NotFound(key); },
-        EncodableNameLookupKeyComparison<Traits>()...,
-        EncodableNameLookupOnFound<Traits, Op>()...);
+    using Result = decltype(op->NotFound(key));
+    static constexpr Result (*kOnFound[])(Op*) = {
+        &EncodableNameLookupOnFound<Traits, Op>::Call...};
+    const size_t index = NameLookupTable<Traits...>::Find(key);
+    if (index == NameLookupTable<Traits...>::kNotFound) {
+      return op->NotFound(key);
+    }
+    return kOnFound[index](op);
+  }
+};
+
+template <>
+struct EncodableNameLookup<> {
+  template <typename Op>
+  static auto Lookup(absl::string_view key, Op* op) {
+    return op->NotFound(key);
   }
 };
 
@@ -1167,12 +1274,44 @@ class TransportSizeEncoder {
   uint32_t size_ = 0;
 };
 
+// Is Which declared kRarelySet (see MetadataMap)?
+template <typename Which, typename = void>
+struct IsRarelySetTrait : std::false_type {};
+template <typename Which>
+struct IsRarelySetTrait<Which, absl::void_t<decltype(Which::kRarelySet)>>
+    : std::integral_constant<bool, Which::kRarelySet> {};
+
+// PackedTable of Value<Trait> for each of Traits that is (or, for
+// kRarelySet false, is not) kRarelySet.
+template <bool kRarelySet, typename Kept, typename... Traits>
+struct TraitTableStruct;
+
+template <bool kRarelySet, typename Kept>
+struct TraitTableStruct<kRarelySet, Kept> {
+  using Type = typename Kept::template Instantiate<PackedTable>;
+};
+
+template <bool kRarelySet, typename Kept, typename Trait, typename... Traits>
+struct TraitTableStruct<kRarelySet, Kept, Trait, Traits...>
+    : TraitTableStruct<
+          kRarelySet,
+          absl::conditional_t<IsRarelySetTrait<Trait>::value == kRarelySet,
+                              typename Kept::template PushBack<Value<Trait>>,
+                              Kept>,
+          Traits...> {};
+
+template <bool kRarelySet, typename... Traits>
+using TraitTable =
+    typename TraitTableStruct<kRarelySet, Typelist<>, Traits...>::Type;
+
 // Handle unknown (non-trait-based) fields in the metadata map.
 class UnknownMap {
  public:
   using BackingType = std::vector<std::pair<Slice, Slice>>;
 
   void Append(absl::string_view key, Slice value);
+  // As above, but shares the caller's key rather than copying it.
+  void Append(Slice key, Slice value);
   void Remove(absl::string_view key);
   std::optional<absl::string_view> GetStringValue(absl::string_view key,
                                                   std::string* backing) const;
@@ -1279,6 +1418,10 @@ MetadataValueAsSlice(typename Which::ValueType value) {
 // struct GrpcXyzMetadata {
 //   // Can this metadata field be repeated?
 //   static constexpr bool kRepeatable = ...;
+//   // Optional: set to true for fields that only a small fraction of calls
+//   // carry. Their values live in a separately allocated table, so that they
+//   // only cost the MetadataMap a pointer until one of them is set.
+//   static constexpr bool kRarelySet = ...;
 //   // Should this metadata be transferred from server headers to trailers on
 //   // Trailers-Only response?
 //   static constexpr bool kTransferOnTrailersOnly = ...;
@@ -1384,9 +1527,8 @@ class MetadataMap {
   //    void Encode(string_view key, Slice value);
   template <typename Encoder>
   void Encode(Encoder* encoder) const {
-    table_.template ForEachIn<metadata_detail::EncodeWrapper<Encoder>,
-                              Value<Traits>...>(
-        metadata_detail::EncodeWrapper<Encoder>{encoder});
+    metadata_detail::EncodeWrapper<Encoder> wrapper{encoder};
+    (CallIfPresent<Traits>(&wrapper), ...);
     for (const auto& unk : unknown_) {
       encoder->Encode(unk.first, unk.second);
     }
@@ -1396,6 +1538,9 @@ class MetadataMap {
   template <typename Encoder>
   void ForEach(Encoder* encoder) const {
     table_.ForEach(metadata_detail::ForEachWrapper<Encoder>{encoder});
+    if (rare_table_ != nullptr) {
+      rare_table_->ForEach(metadata_detail::ForEachWrapper<Encoder>{encoder});
+    }
     for (const auto& unk : unknown_) {
       encoder->Encode(unk.first, unk.second);
     }
@@ -1405,6 +1550,9 @@ class MetadataMap {
   // call f(key, value) as absl::string_views.
   void Log(metadata_detail::LogFn log_fn) const {
     table_.ForEach(metadata_detail::LogWrapper{log_fn});
+    if (rare_table_ != nullptr) {
+      rare_table_->ForEach(metadata_detail::LogWrapper{log_fn});
+    }
     for (const auto& unk : unknown_) {
       log_fn(unk.first.as_string_view(), unk.second.as_string_view());
     }
@@ -1415,9 +1563,8 @@ class MetadataMap {
   // for each of them. If the function returns true, the header is kept.
   template <typename Filterer>
   void Filter(Filterer filter_fn) {
-    table_.template FilterIn<metadata_detail::FilterWrapper<Filterer>,
-                             Value<Traits>...>(
-        metadata_detail::FilterWrapper<Filterer>{filter_fn});
+    metadata_detail::FilterWrapper<Filterer> wrapper{filter_fn};
+    (RemoveIfFiltered<Traits>(&wrapper), ...);
     unknown_.Filter<Filterer>(&filter_fn);
   }
 
@@ -1440,7 +1587,7 @@ class MetadataMap {
   template <typename Which>
   const typename metadata_detail::Value<Which>::StorageType* get_pointer(
       Which) const {
-    if (auto* p = table_.template get<Value<Which>>()) return &p->value;
+    if (auto* p = GetValue<Which>()) return &p->value;
     return nullptr;
   }
 
@@ -1449,7 +1596,7 @@ class MetadataMap {
   // Causes a compilation error if Which is not an element of Traits.
   template <typename Which>
   typename metadata_detail::Value<Which>::StorageType* get_pointer(Which) {
-    if (auto* p = table_.template get<Value<Which>>()) return &p->value;
+    if (auto* p = GetValue<Which>()) return &p->value;
     return nullptr;
   }
 
@@ -1459,7 +1606,7 @@ class MetadataMap {
   template <typename Which>
   typename metadata_detail::Value<Which>::StorageType* GetOrCreatePointer(
       Which) {
-    return &table_.template get_or_create<Value<Which>>()->value;
+    return &TableFor<Which>().template get_or_create<Value<Which>>()->value;
   }
 
   // Get the value of some known metadata.
@@ -1467,7 +1614,7 @@ class MetadataMap {
   // Causes a compilation error if Which is not an element of Traits.
   template <typename Which>
   std::optional<typename Which::ValueType> get(Which) const {
-    if (auto* p = table_.template get<Value<Which>>()) return p->value;
+    if (auto* p = GetValue<Which>()) return p->value;
     return std::nullopt;
   }
 
@@ -1476,7 +1623,7 @@ class MetadataMap {
   template <typename Which, typename... Args>
   absl::enable_if_t<Which::kRepeatable == false, void> Set(Which,
                                                            Args&&... args) {
-    table_.template set<Value<Which>>(std::forward<Args>(args)...);
+    TableFor<Which>().template set<Value<Which>>(std::forward<Args>(args)...);
   }
   template <typename Which, typename... Args>
   absl::enable_if_t<Which::kRepeatable == true, void> Set(Which,
@@ -1487,7 +1634,11 @@ class MetadataMap {
   // Remove a specific piece of known metadata.
   template <typename Which>
   void Remove(Which) {
-    table_.template clear<Value<Which>>();
+    if constexpr (metadata_detail::IsRarelySetTrait<Which>::value) {
+      if (rare_table_ != nullptr) rare_table_->template clear<Value<Which>>();
+    } else {
+      table_.template clear<Value<Which>>();
+    }
   }
 
   // Remove some metadata by name
@@ -1565,8 +1716,15 @@ class MetadataMap {
   void Clear();
   size_t TransportSize() const;
   Derived Copy() const;
-  bool empty() const { return table_.empty() && unknown_.empty(); }
-  size_t count() const { return table_.count() + unknown_.size(); }
+  bool empty() const {
+    return table_.empty() && (rare_table_ == nullptr || rare_table_->empty()) &&
+           unknown_.empty();
+  }
+  size_t count() const {
+    return table_.count() +
+           (rare_table_ == nullptr ? 0 : rare_table_->count()) +
+           unknown_.size();
+  }
 
  private:
   friend class metadata_detail::AppendHelper<Derived>;
@@ -1578,8 +1736,53 @@ class MetadataMap {
   template <typename Which>
   using Value = metadata_detail::Value<Which>;
 
-  // Table of known metadata types.
-  PackedTable<Value<Traits>...> table_;
+  using CommonTable = metadata_detail::TraitTable<false, Traits...>;
+  using RareTable = metadata_detail::TraitTable<true, Traits...>;
+
+  // The table holding Which, creating the rare table if need be.
+  template <typename Which>
+  auto& TableFor() {
+    if constexpr (metadata_detail::IsRarelySetTrait<Which>::value) {
+      if (rare_table_ == nullptr) rare_table_ = std::make_unique<RareTable>();
+      return *rare_table_;
+    } else {
+      return table_;
+    }
+  }
+
+  template <typename Which>
+  const Value<Which>* GetValue() const {
+    if constexpr (metadata_detail::IsRarelySetTrait<Which>::value) {
+      if (rare_table_ == nullptr) return nullptr;
+      return rare_table_->template get<Value<Which>>();
+    } else {
+      return table_.template get<Value<Which>>();
+    }
+  }
+
+  template <typename Which>
+  Value<Which>* GetValue() {
+    return const_cast<Value<Which>*>(
+        static_cast<const MetadataMap*>(this)->template GetValue<Which>());
+  }
+
+  template <typename Which, typename F>
+  void CallIfPresent(F* f) const {
+    if (auto* p = GetValue<Which>()) (*f)(*p);
+  }
+
+  template <typename Which, typename F>
+  void RemoveIfFiltered(F* f) {
+    if (auto* p = GetValue<Which>()) {
+      if (!(*f)(*p)) Remove(Which());
+    }
+  }
+
+  // Table of known metadata types, less the kRarelySet ones.
+  CommonTable table_;
+  // Table of the kRarelySet metadata types: allocated the first time one of
+  // them is set, so that most maps never pay for their storage.
+  std::unique_ptr<RareTable> rare_table_;
   metadata_detail::UnknownMap unknown_;
 };
 
@@ -1593,7 +1796,9 @@ inline bool IsStatusOk(const MetadataMap<Derived, Args...>& m) {
 
 template <typename Derived, typename... Traits>
 MetadataMap<Derived, Traits...>::MetadataMap(MetadataMap&& other) noexcept
-    : table_(std::move(other.table_)), unknown_(std::move(other.unknown_)) {}
+    : table_(std::move(other.table_)),
+      rare_table_(std::move(other.rare_table_)),
+      unknown_(std::move(other.unknown_)) {}
 
 // We never create MetadataMap directly, instead we create Derived, but we
 // want to be able to move it without redeclaring this.
@@ -1602,6 +1807,7 @@ template <typename Derived, typename... Traits>
 Derived& MetadataMap<Derived, Traits...>::operator=(
     MetadataMap&& other) noexcept {
   table_ = std::move(other.table_);
+  rare_table_ = std::move(other.rare_table_);
   unknown_ = std::move(other.unknown_);
   return static_cast<Derived&>(*this);
 }
@@ -1612,6 +1818,7 @@ MetadataMap<Derived, Traits...>::~MetadataMap() = default;
 template <typename Derived, typename... Traits>
 void MetadataMap<Derived, Traits...>::Clear() {
   table_.ClearAll();
+  if (rare_table_ != nullptr) rare_table_->ClearAll();
   unknown_.Clear();
 }
 
@@ -1652,12 +1859,14 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     grpc_core::GrpcTagsBinMetadata, grpc_core::GrpcLbClientStatsMetadata,
     grpc_core::LbCostBinMetadata, grpc_core::LbTokenMetadata,
     grpc_core::XEnvoyPeerMetadata, grpc_core::W3CTraceParentMetadata,
+    grpc_core::GrpcZstdDictionaryMetadata,
+    grpc_core::GrpcAcceptZstdDictionaryMetadata,
     // Non-encodable things
     grpc_core::GrpcStreamNetworkState, grpc_core::PeerString,
     grpc_core::GrpcStatusContext, grpc_core::GrpcStatusFromWire,
     grpc_core::GrpcCallWasCancelled, grpc_core::WaitForReady,
     grpc_core::IsTransparentRetry, grpc_core::GrpcTrailersOnly,
-    grpc_core::GrpcTarPit,
+    grpc_core::GrpcTarPit, grpc_core::GrpcWritePriority,
     grpc_core::GrpcRegisteredMethod GRPC_CUSTOM_CLIENT_METADATA
         GRPC_CUSTOM_SERVER_METADATA>;
 
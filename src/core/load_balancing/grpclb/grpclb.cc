@@ -1870,7 +1870,7 @@ class GrpcLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterGrpcLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<GrpcLbFactory>());
+      kGrpclb, [] { return std::make_unique<GrpcLbFactory>(); });
   builder->channel_init()
       ->RegisterFilter<ClientLoadReportingFilter>(GRPC_CLIENT_SUBCHANNEL)
       .IfChannelArg(GRPC_ARG_GRPCLB_ENABLE_LOAD_REPORTING_FILTER, false);
@@ -280,6 +280,11 @@ class LoadBalancingPolicy : public InternallyRefCounted<LoadBalancingPolicy> {
    public:
     SubchannelPicker();
 
+    /// Called for every call made on the channel.  Implementations should
+    /// not allocate on the way to a complete pick, other than for a
+    /// subchannel call tracker when one is needed; in particular, metadata
+    /// and config lookups should use absl::string_view keys rather than
+    /// building a std::string per pick.
     virtual PickResult Pick(PickArgs args) = 0;
 
    protected:
@@ -36,6 +36,21 @@
 
 namespace grpc_core {
 
+//
+// LoadBalancingPolicyRegistry::Entry
+//
+
+LoadBalancingPolicyFactory* LoadBalancingPolicyRegistry::Entry::Get() {
+  absl::call_once(once_, [this]() {
+    if (factory_ != nullptr) return;
+    VLOG(2) << "creating LB policy factory for \"" << name_ << "\"";
+    factory_ = std::exchange(create_, nullptr)();
+    CHECK(factory_ != nullptr);
+    CHECK(factory_->name() == name_);
+  });
+  return factory_.get();
+}
+
 //
 // LoadBalancingPolicyRegistry::Builder
 //
@@ -44,7 +59,15 @@ void LoadBalancingPolicyRegistry::Builder::RegisterLoadBalancingPolicyFactory(
     std::unique_ptr<LoadBalancingPolicyFactory> factory) {
   VLOG(2) << "registering LB policy factory for \"" << factory->name() << "\"";
   CHECK(factories_.find(factory->name()) == factories_.end());
-  factories_.emplace(factory->name(), std::move(factory));
+  absl::string_view name = factory->name();
+  factories_.emplace(name, std::make_unique<Entry>(std::move(factory)));
+}
+
+void LoadBalancingPolicyRegistry::Builder::RegisterLoadBalancingPolicyFactory(
+    absl::string_view name, FactoryCreator create) {
+  VLOG(2) << "registering lazy LB policy factory for \"" << name << "\"";
+  CHECK(factories_.find(name) == factories_.end());
+  factories_.emplace(name, std::make_unique<Entry>(name, std::move(create)));
 }
 
 LoadBalancingPolicyRegistry LoadBalancingPolicyRegistry::Builder::Build() {
@@ -62,7 +85,7 @@ LoadBalancingPolicyRegistry::GetLoadBalancingPolicyFactory(
     absl::string_view name) const {
   auto it = factories_.find(name);
   if (it == factories_.end()) return nullptr;
-  return it->second.get();
+  return it->second->Get();
 }
 
 OrphanablePtr<LoadBalancingPolicy>
@@ -77,13 +100,15 @@ LoadBalancingPolicyRegistry::CreateLoadBalancingPolicy(
 
 bool LoadBalancingPolicyRegistry::LoadBalancingPolicyExists(
     absl::string_view name, bool* requires_config) const {
+  // Checking for existence alone does not create a lazy factory.
+  if (requires_config == nullptr) {
+    return factories_.find(name) != factories_.end();
+  }
   auto* factory = GetLoadBalancingPolicyFactory(name);
   if (factory == nullptr) return false;
-  // If requested, check if the load balancing policy allows an empty config.
-  if (requires_config != nullptr) {
-    auto config = factory->ParseLoadBalancingConfig(Json::FromObject({}));
-    *requires_config = !config.ok();
-  }
+  // Check if the load balancing policy allows an empty config.
+  auto config = factory->ParseLoadBalancingConfig(Json::FromObject({}));
+  *requires_config = !config.ok();
   return true;
 }
 
@@ -21,7 +21,10 @@
 
 #include <map>
 #include <memory>
+#include <utility>
 
+#include "absl/base/call_once.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "src/core/load_balancing/lb_policy.h"
@@ -33,6 +36,30 @@
 namespace grpc_core {
 
 class LoadBalancingPolicyRegistry final {
+ public:
+  /// Creates an LB policy factory that was registered lazily.
+  using FactoryCreator =
+      absl::AnyInvocable<std::unique_ptr<LoadBalancingPolicyFactory>()>;
+
+ private:
+  // A registered factory, created on first lookup if registered lazily.
+  class Entry final {
+   public:
+    explicit Entry(std::unique_ptr<LoadBalancingPolicyFactory> factory)
+        : name_(factory->name()), factory_(std::move(factory)) {}
+    Entry(absl::string_view name, FactoryCreator create)
+        : name_(name), create_(std::move(create)) {}
+
+    // Thread-safe.
+    LoadBalancingPolicyFactory* Get();
+
+   private:
+    const absl::string_view name_;
+    absl::once_flag once_;
+    FactoryCreator create_;
+    std::unique_ptr<LoadBalancingPolicyFactory> factory_;
+  };
+
  public:
   /// Methods used to create and populate the LoadBalancingPolicyRegistry.
   /// NOT THREAD SAFE -- to be used only during global gRPC
@@ -44,11 +71,18 @@ class LoadBalancingPolicyRegistry final {
     void RegisterLoadBalancingPolicyFactory(
         std::unique_ptr<LoadBalancingPolicyFactory> factory);
 
+    /// Registers an LB policy factory that is not created until a policy
+    /// named \a name is first looked up, so that policies a process never
+    /// uses cost nothing at startup.  \a name must remain valid for the
+    /// lifetime of the registry and must match the name of the created
+    /// factory.
+    void RegisterLoadBalancingPolicyFactory(absl::string_view name,
+                                            FactoryCreator create);
+
     LoadBalancingPolicyRegistry Build();
 
    private:
-    std::map<absl::string_view, std::unique_ptr<LoadBalancingPolicyFactory>>
-        factories_;
+    std::map<absl::string_view, std::unique_ptr<Entry>> factories_;
   };
 
   /// Creates an LB policy of the type specified by \a name.
@@ -72,8 +106,7 @@ class LoadBalancingPolicyRegistry final {
   absl::StatusOr<Json::Object::const_iterator> ParseLoadBalancingConfigHelper(
       const Json& lb_config_array) const;
 
-  std::map<absl::string_view, std::unique_ptr<LoadBalancingPolicyFactory>>
-      factories_;
+  std::map<absl::string_view, std::unique_ptr<Entry>> factories_;
 };
 
 }  // namespace grpc_core
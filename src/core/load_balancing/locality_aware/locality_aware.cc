@@ -0,0 +1,622 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/load_balancing/picker_random.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kLocalityAware = "locality_aware";
+
+// Config for locality_aware LB policy.
+class LocalityAwareConfig final : public LoadBalancingPolicy::Config {
+ public:
+  // Maps addresses to a zone by subnet, for resolvers (such as DNS) that
+  // cannot say which zone each address is in.
+  struct Zone {
+    struct Subnet {
+      grpc_resolved_address address;
+      uint32_t prefix_len;
+    };
+
+    std::string name;
+    std::vector<std::string> address_prefixes;
+    // Parsed from address_prefixes.
+    std::vector<Subnet> subnets;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader =
+          JsonObjectLoader<Zone>()
+              .Field("name", &Zone::name)
+              .Field("addressPrefixes", &Zone::address_prefixes)
+              .Finish();
+      return loader;
+    }
+
+    void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+      for (size_t i = 0; i < address_prefixes.size(); ++i) {
+        std::pair<absl::string_view, absl::string_view> parts = absl::StrSplit(
+            address_prefixes[i], absl::MaxSplits('/', 1));
+        auto address = StringToSockaddr(parts.first, 0);
+        uint32_t prefix_len = 0;
+        if (!address.ok() || !absl::SimpleAtoi(parts.second, &prefix_len) ||
+            prefix_len > 128) {
+          ValidationErrors::ScopedField field(
+              errors, absl::StrCat(".addressPrefixes[", i, "]"));
+          errors->AddError("not a valid CIDR range");
+          continue;
+        }
+        grpc_sockaddr_mask_bits(&*address, prefix_len);
+        subnets.push_back({*address, prefix_len});
+      }
+    }
+  };
+
+  LocalityAwareConfig() = default;
+
+  LocalityAwareConfig(const LocalityAwareConfig&) = delete;
+  LocalityAwareConfig& operator=(const LocalityAwareConfig&) = delete;
+
+  LocalityAwareConfig(LocalityAwareConfig&&) = delete;
+  LocalityAwareConfig& operator=(LocalityAwareConfig&&) = delete;
+
+  absl::string_view name() const override { return kLocalityAware; }
+
+  const std::string& local_zone() const { return local_zone_; }
+
+  // Returns the zone of an endpoint: the GRPC_ARG_ADDRESS_ZONE attribute
+  // set by the resolver if there is one, or else the first zone with a
+  // subnet containing one of its addresses.  Empty if the zone is unknown.
+  std::string ZoneForEndpoint(const EndpointAddresses& endpoint) const {
+    std::optional<absl::string_view> zone =
+        endpoint.args().GetString(GRPC_ARG_ADDRESS_ZONE);
+    if (zone.has_value()) return std::string(*zone);
+    for (const grpc_resolved_address& address : endpoint.addresses()) {
+      for (const Zone& candidate : zones_) {
+        for (const Zone::Subnet& subnet : candidate.subnets) {
+          if (grpc_sockaddr_match_subnet(&address, &subnet.address,
+                                         subnet.prefix_len)) {
+            return candidate.name;
+          }
+        }
+      }
+    }
+    return "";
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<LocalityAwareConfig>()
+            .Field("localZone", &LocalityAwareConfig::local_zone_)
+            .OptionalField("zones", &LocalityAwareConfig::zones_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (local_zone_.empty()) {
+      ValidationErrors::ScopedField field(errors, ".localZone");
+      errors->AddError("must be non-empty");
+    }
+  }
+
+ private:
+  std::string local_zone_;
+  std::vector<Zone> zones_;
+};
+
+// locality_aware LB policy: round robins over the endpoints in the
+// channel's own zone, spilling over to endpoints in other zones only as
+// local capacity is lost.  This gives plain DNS deployments the
+// same-zone preference that xDS gets from its locality weights, without
+// paying cross-zone latency and egress for every call.
+//
+// The capacity of an endpoint is its GRPC_ARG_ADDRESS_WEIGHT (1 if unset).
+// Calls go to the local zone in proportion to the share of its capacity
+// that is READY, and the rest go to READY endpoints in other zones.
+class LocalityAware final : public LoadBalancingPolicy {
+ public:
+  explicit LocalityAware(Args args);
+
+  absl::string_view name() const override { return kLocalityAware; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  class LocalityAwareEndpointList final : public EndpointList {
+   public:
+    LocalityAwareEndpointList(RefCountedPtr<LocalityAware> locality_aware,
+                              EndpointAddressesIterator* endpoints,
+                              const ChannelArgs& args,
+                              std::string resolution_note,
+                              std::vector<std::string>* errors)
+        : EndpointList(std::move(locality_aware), std::move(resolution_note),
+                       GRPC_TRACE_FLAG_ENABLED(locality_aware_lb)
+                           ? "LocalityAwareEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<LocalityAwareEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<LocalityAware>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    class LocalityAwareEndpoint final : public Endpoint {
+     public:
+      LocalityAwareEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                            const EndpointAddresses& addresses,
+                            const ChannelArgs& args,
+                            std::shared_ptr<WorkSerializer> work_serializer,
+                            std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)),
+            is_local_(policy<LocalityAware>()->config_->ZoneForEndpoint(
+                          addresses) ==
+                      policy<LocalityAware>()->config_->local_zone()),
+            weight_(std::max(
+                1, addresses.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT).value_or(
+                       1))) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      bool is_local() const { return is_local_; }
+      uint32_t weight() const { return weight_; }
+
+     private:
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      const bool is_local_;
+      const uint32_t weight_;
+    };
+
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<LocalityAware>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        std::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdateLocalityAwareConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    // local_fraction is the share of picks to send to local_pickers when
+    // there are READY endpoints in both groups.
+    Picker(LocalityAware* parent,
+           std::vector<RefCountedPtr<SubchannelPicker>> local_pickers,
+           std::vector<RefCountedPtr<SubchannelPicker>> remote_pickers,
+           double local_fraction);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Round robins over the pickers of one group of endpoints.
+    struct Group {
+      std::vector<RefCountedPtr<SubchannelPicker>> pickers;
+      std::atomic<size_t> last_picked_index{0};
+    };
+
+    // Returns true if a pick should go to the local group.
+    bool PickLocal();
+
+    // Using pointer value only, no ref held -- do not dereference!
+    LocalityAware* parent_;
+
+    Group local_;
+    Group remote_;
+    const double local_fraction_;
+    PickerRandom random_;
+  };
+
+  ~LocalityAware() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<LocalityAwareConfig> config_;
+
+  // Current child list.
+  OrphanablePtr<LocalityAwareEndpointList> endpoint_list_;
+  // Latest pending child list.
+  // When we get an updated address list, we create a new child list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<LocalityAwareEndpointList> latest_pending_endpoint_list_;
+
+  bool shutdown_ = false;
+
+  absl::BitGen bit_gen_;
+};
+
+//
+// LocalityAware::Picker
+//
+
+LocalityAware::Picker::Picker(
+    LocalityAware* parent,
+    std::vector<RefCountedPtr<SubchannelPicker>> local_pickers,
+    std::vector<RefCountedPtr<SubchannelPicker>> remote_pickers,
+    double local_fraction)
+    : parent_(parent),
+      local_fraction_(local_fraction),
+      random_(absl::Uniform<uint64_t>(parent->bit_gen_)) {
+  local_.pickers = std::move(local_pickers);
+  remote_.pickers = std::move(remote_pickers);
+  // For discussion on why we generate a random starting index for
+  // the picker, see https://github.com/grpc/grpc-go/issues/2580.
+  for (Group* group : {&local_, &remote_}) {
+    if (group->pickers.empty()) continue;
+    group->last_picked_index.store(
+        absl::Uniform<size_t>(parent->bit_gen_, 0, group->pickers.size()),
+        std::memory_order_relaxed);
+  }
+  GRPC_TRACE_LOG(locality_aware_lb, INFO)
+      << "[LA " << parent_ << " picker " << this
+      << "] created picker from endpoint_list=" << parent_->endpoint_list_.get()
+      << " with " << local_.pickers.size() << " local and "
+      << remote_.pickers.size()
+      << " remote READY children; local_fraction=" << local_fraction_;
+}
+
+bool LocalityAware::Picker::PickLocal() {
+  if (local_.pickers.empty()) return false;
+  if (remote_.pickers.empty() || local_fraction_ >= 1) return true;
+  return random_.Fraction() < local_fraction_;
+}
+
+LocalityAware::PickResult LocalityAware::Picker::Pick(PickArgs args) {
+  Group& group = PickLocal() ? local_ : remote_;
+  size_t index =
+      group.last_picked_index.fetch_add(1, std::memory_order_relaxed) %
+      group.pickers.size();
+  GRPC_TRACE_LOG(locality_aware_lb, INFO)
+      << "[LA " << parent_ << " picker " << this << "] using "
+      << (&group == &local_ ? "local" : "remote") << " picker index " << index
+      << ", picker=" << group.pickers[index].get();
+  return group.pickers[index]->Pick(args);
+}
+
+//
+// LocalityAware
+//
+
+LocalityAware::LocalityAware(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(locality_aware_lb, INFO) << "[LA " << this << "] Created";
+}
+
+LocalityAware::~LocalityAware() {
+  GRPC_TRACE_LOG(locality_aware_lb, INFO)
+      << "[LA " << this << "] Destroying locality_aware policy";
+  CHECK(endpoint_list_ == nullptr);
+  CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void LocalityAware::ShutdownLocked() {
+  GRPC_TRACE_LOG(locality_aware_lb, INFO)
+      << "[LA " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void LocalityAware::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status LocalityAware::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<LocalityAwareConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(locality_aware_lb, INFO)
+        << "[LA " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(locality_aware_lb, INFO)
+        << "[LA " << this
+        << "] received update with address error: " << args.addresses.status();
+    // If we already have a child list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new child list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(locality_aware_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[LA " << this << "] replacing previous pending child list "
+              << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<LocalityAwareEndpointList>(
+      RefAsSubclass<LocalityAware>(DEBUG_LOCATION,
+                                   "LocalityAwareEndpointList"),
+      addresses, args.args, std::move(args.resolution_note), &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(locality_aware_lb) &&
+        endpoint_list_ != nullptr) {
+      LOG(INFO) << "[LA " << this << "] replacing previous child list "
+                << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status = args.addresses.ok()
+                              ? absl::UnavailableError("empty address list")
+                              : args.addresses.status();
+    endpoint_list_->ReportTransientFailure(status);
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+//
+// LocalityAware::LocalityAwareEndpointList::LocalityAwareEndpoint
+//
+
+void LocalityAware::LocalityAwareEndpointList::LocalityAwareEndpoint::
+    OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                  grpc_connectivity_state new_state,
+                  const absl::Status& status) {
+  auto* la_endpoint_list = endpoint_list<LocalityAwareEndpointList>();
+  auto* locality_aware = policy<LocalityAware>();
+  GRPC_TRACE_LOG(locality_aware_lb, INFO)
+      << "[LA " << locality_aware << "] connectivity changed for child "
+      << this << " (" << (is_local_ ? "local" : "remote") << "), endpoint_list "
+      << la_endpoint_list << " (index " << Index() << " of "
+      << la_endpoint_list->size() << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(locality_aware_lb, INFO)
+        << "[LA " << locality_aware << "] child " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    la_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  la_endpoint_list->MaybeUpdateLocalityAwareConnectivityStateLocked(status);
+}
+
+//
+// LocalityAware::LocalityAwareEndpointList
+//
+
+void LocalityAware::LocalityAwareEndpointList::UpdateStateCountersLocked(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void LocalityAware::LocalityAwareEndpointList::
+    MaybeUpdateLocalityAwareConnectivityStateLocked(
+        absl::Status status_for_tf) {
+  auto* locality_aware = policy<LocalityAware>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (locality_aware->latest_pending_endpoint_list_.get() == this &&
+      (locality_aware->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(locality_aware_lb)) {
+      LOG(INFO) << "[LA " << locality_aware << "] swapping out child list "
+                << locality_aware->endpoint_list_.get() << " ("
+                << locality_aware->endpoint_list_->CountersString()
+                << ") in favor of " << this << " (" << CountersString() << ")";
+    }
+    locality_aware->endpoint_list_ =
+        std::move(locality_aware->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current child list.
+  if (locality_aware->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(locality_aware_lb, INFO)
+        << "[LA " << locality_aware << "] reporting READY with child list "
+        << this;
+    std::vector<RefCountedPtr<SubchannelPicker>> local_pickers;
+    std::vector<RefCountedPtr<SubchannelPicker>> remote_pickers;
+    uint64_t local_weight = 0;
+    uint64_t local_ready_weight = 0;
+    for (const auto& endpoint : endpoints()) {
+      const auto* la_endpoint =
+          static_cast<const LocalityAwareEndpoint*>(endpoint.get());
+      if (la_endpoint->is_local()) local_weight += la_endpoint->weight();
+      auto state = endpoint->connectivity_state();
+      if (!state.has_value() || *state != GRPC_CHANNEL_READY) continue;
+      if (la_endpoint->is_local()) {
+        local_ready_weight += la_endpoint->weight();
+        local_pickers.push_back(endpoint->picker());
+      } else {
+        remote_pickers.push_back(endpoint->picker());
+      }
+    }
+    CHECK(!local_pickers.empty() || !remote_pickers.empty());
+    const double local_fraction =
+        local_weight == 0 ? 0
+                          : static_cast<double>(local_ready_weight) /
+                                static_cast<double>(local_weight);
+    locality_aware->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(locality_aware, std::move(local_pickers),
+                               std::move(remote_pickers), local_fraction));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(locality_aware_lb, INFO)
+        << "[LA " << locality_aware
+        << "] reporting CONNECTING with child list " << this;
+    locality_aware->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(locality_aware_lb, INFO)
+        << "[LA " << locality_aware
+        << "] reporting TRANSIENT_FAILURE with child list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    ReportTransientFailure(last_failure_);
+  }
+}
+
+//
+// factory
+//
+
+class LocalityAwareFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<LocalityAware>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kLocalityAware; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<LocalityAwareConfig>>(
+        json, JsonArgs(), "errors validating locality_aware LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterLocalityAwareLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      kLocalityAware, [] { return std::make_unique<LocalityAwareFactory>(); });
+}
+
+}  // namespace grpc_core
@@ -241,11 +241,16 @@ void OrcaProducer::RemoveWatcher(OrcaWatcher* watcher) {
   MutexLock lock(&mu_);
   watchers_.erase(watcher);
   if (watchers_.empty()) {
+    // The next watcher renegotiates the interval from scratch.
+    report_interval_ = Duration::Infinity();
     stream_client_.reset();
     return;
   }
+  // If the removed watcher wanted the shortest interval, restart the stream
+  // with the longer one, so that the backend stops sending reports that no
+  // one asked for.
   Duration new_interval = GetMinIntervalLocked();
-  if (new_interval < report_interval_) {
+  if (new_interval != report_interval_) {
     report_interval_ = new_interval;
     stream_client_.reset();
     MaybeStartStreamLocked();
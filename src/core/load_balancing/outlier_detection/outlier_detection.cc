@@ -1146,7 +1146,8 @@ void OutlierDetectionConfig::JsonPostLoad(const Json& json, const JsonArgs&,
 
 void RegisterOutlierDetectionLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<OutlierDetectionLbFactory>());
+      kOutlierDetection,
+      [] { return std::make_unique<OutlierDetectionLbFactory>(); });
 }
 
 }  // namespace grpc_core
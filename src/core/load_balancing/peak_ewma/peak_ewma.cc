@@ -0,0 +1,644 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/load_balancing/picker_random.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kPeakEwma = "peak_ewma";
+
+// Config for peak_ewma LB policy.
+class PeakEwmaConfig final : public LoadBalancingPolicy::Config {
+ public:
+  // Larger choice counts are clamped to this: beyond it, picks become more
+  // expensive without spreading load noticeably better.
+  static constexpr uint32_t kMaxChoiceCount = 10;
+
+  PeakEwmaConfig() = default;
+
+  PeakEwmaConfig(const PeakEwmaConfig&) = delete;
+  PeakEwmaConfig& operator=(const PeakEwmaConfig&) = delete;
+
+  PeakEwmaConfig(PeakEwmaConfig&&) = delete;
+  PeakEwmaConfig& operator=(PeakEwmaConfig&&) = delete;
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  uint32_t choice_count() const { return choice_count_; }
+  Duration decay_time() const { return decay_time_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<PeakEwmaConfig>()
+            .OptionalField("choiceCount", &PeakEwmaConfig::choice_count_)
+            .OptionalField("decayTime", &PeakEwmaConfig::decay_time_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (choice_count_ < 2) {
+      ValidationErrors::ScopedField field(errors, ".choiceCount");
+      errors->AddError("must be at least 2");
+    }
+    choice_count_ = std::min(choice_count_, kMaxChoiceCount);
+    if (decay_time_ <= Duration::Zero()) {
+      ValidationErrors::ScopedField field(errors, ".decayTime");
+      errors->AddError("must be greater than zero");
+    }
+  }
+
+ private:
+  uint32_t choice_count_ = 2;
+  Duration decay_time_ = Duration::Seconds(10);
+};
+
+// peak_ewma LB policy: picks the endpoint with the lowest expected latency
+// out of choice_count endpoints chosen at random.  Latency is learned from
+// how long calls take, so unlike weighted_round_robin it needs no ORCA
+// reports from backends.
+class PeakEwma final : public LoadBalancingPolicy {
+ public:
+  explicit PeakEwma(Args args);
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // The latency of an endpoint, shared between the endpoint, its pickers and
+  // the calls routed to it.  This is a peak-sensitive exponentially weighted
+  // moving average of call round trip times: a call slower than the average
+  // raises it immediately, while faster calls only pull it down gradually.
+  // So that an endpoint that was once slow gets tried again, the average
+  // also decays towards zero while the endpoint gets no calls.
+  class EndpointLatency final : public RefCounted<EndpointLatency> {
+   public:
+    explicit EndpointLatency(Duration decay_time)
+        : decay_nanos_(static_cast<double>(decay_time.millis()) * 1e6) {}
+
+    void CallStarted() { in_flight_.fetch_add(1, std::memory_order_relaxed); }
+    // Records a call that started at start_nanos and just finished.
+    void CallFinished(int64_t start_nanos, int64_t now_nanos, bool failed);
+
+    // The cost of sending one more call to this endpoint: its expected
+    // latency scaled by the calls it already has queued up.
+    double Cost(int64_t now_nanos) const;
+
+    double ewma_nanos() const {
+      return ewma_nanos_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    double DecayFactor(int64_t last_update_nanos, int64_t now_nanos) const {
+      const double elapsed = static_cast<double>(
+          std::max<int64_t>(0, now_nanos - last_update_nanos));
+      return std::exp(-elapsed / decay_nanos_);
+    }
+
+    const double decay_nanos_;
+    std::atomic<uint64_t> in_flight_{0};
+    // Written only with mu_ held, so that concurrent samples are not lost.
+    // Read without it by picks.
+    Mutex mu_;
+    std::atomic<double> ewma_nanos_{0};
+    std::atomic<int64_t> last_update_nanos_{0};
+  };
+
+  class PeakEwmaEndpointList final : public EndpointList {
+   public:
+    PeakEwmaEndpointList(RefCountedPtr<PeakEwma> peak_ewma,
+                         EndpointAddressesIterator* endpoints,
+                         const ChannelArgs& args, std::string resolution_note,
+                         std::vector<std::string>* errors)
+        : EndpointList(std::move(peak_ewma), std::move(resolution_note),
+                       GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb)
+                           ? "PeakEwmaEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<PeakEwmaEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<PeakEwma>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    class PeakEwmaEndpoint final : public Endpoint {
+     public:
+      PeakEwmaEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                       const EndpointAddresses& addresses,
+                       const ChannelArgs& args,
+                       std::shared_ptr<WorkSerializer> work_serializer,
+                       std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)),
+            latency_(MakeRefCounted<EndpointLatency>(
+                policy<PeakEwma>()->config_->decay_time())) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<EndpointLatency> latency() const { return latency_; }
+
+     private:
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      RefCountedPtr<EndpointLatency> latency_;
+    };
+
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<PeakEwma>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        std::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdatePeakEwmaConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    struct EndpointInfo {
+      RefCountedPtr<SubchannelPicker> picker;
+      RefCountedPtr<EndpointLatency> latency;
+    };
+
+    Picker(PeakEwma* parent, std::vector<EndpointInfo> endpoints);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Counts the calls in flight to an endpoint and records how long each
+    // of them takes.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<EndpointLatency> latency,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : latency_(std::move(latency)),
+            child_tracker_(std::move(child_tracker)) {}
+
+      void Start() override;
+
+      void Finish(FinishArgs args) override;
+
+     private:
+      RefCountedPtr<EndpointLatency> latency_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+      int64_t start_nanos_ = 0;
+    };
+
+    // Using pointer value only, no ref held -- do not dereference!
+    PeakEwma* parent_;
+
+    const uint32_t choice_count_;
+    PickerRandom random_;
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  ~PeakEwma() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<PeakEwmaConfig> config_;
+
+  // Current child list.
+  OrphanablePtr<PeakEwmaEndpointList> endpoint_list_;
+  // Latest pending child list.
+  // When we get an updated address list, we create a new child list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<PeakEwmaEndpointList> latest_pending_endpoint_list_;
+
+  bool shutdown_ = false;
+
+  absl::BitGen bit_gen_;
+};
+
+//
+// PeakEwma::EndpointLatency
+//
+
+// The cost of an endpoint that has calls in flight but no latency samples
+// yet.  Large enough that such endpoints are avoided until their first call
+// completes, so that a new endpoint is not flooded before anything is known
+// about it.
+constexpr double kPenaltyNanos = 1e15;
+
+// The least latency recorded for a failed call.  Failures are often faster
+// than successes, so without this an endpoint that fails every call would
+// look like the fastest one and attract even more of them.
+constexpr double kFailedCallNanos = 1e9;
+
+int64_t NowNanos() {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  return now.tv_sec * GPR_NS_PER_SEC + now.tv_nsec;
+}
+
+void PeakEwma::EndpointLatency::CallFinished(int64_t start_nanos,
+                                             int64_t now_nanos, bool failed) {
+  in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  double rtt_nanos =
+      static_cast<double>(std::max<int64_t>(0, now_nanos - start_nanos));
+  MutexLock lock(&mu_);
+  const double ewma = ewma_nanos_.load(std::memory_order_relaxed);
+  // A failure counts as at least twice as slow as the average, so that an
+  // endpoint that keeps failing keeps getting more expensive.
+  if (failed) rtt_nanos = std::max({rtt_nanos, kFailedCallNanos, 2 * ewma});
+  if (rtt_nanos > ewma) {
+    ewma_nanos_.store(rtt_nanos, std::memory_order_relaxed);
+  } else {
+    const double weight = DecayFactor(
+        last_update_nanos_.load(std::memory_order_relaxed), now_nanos);
+    ewma_nanos_.store(ewma * weight + rtt_nanos * (1 - weight),
+                      std::memory_order_relaxed);
+  }
+  last_update_nanos_.store(now_nanos, std::memory_order_relaxed);
+}
+
+double PeakEwma::EndpointLatency::Cost(int64_t now_nanos) const {
+  const double ewma =
+      ewma_nanos_.load(std::memory_order_relaxed) *
+      DecayFactor(last_update_nanos_.load(std::memory_order_relaxed),
+                  now_nanos);
+  const double in_flight = in_flight_.load(std::memory_order_relaxed);
+  if (ewma == 0 && in_flight > 0) return kPenaltyNanos + in_flight;
+  return ewma * (in_flight + 1);
+}
+
+//
+// PeakEwma::Picker::SubchannelCallTracker
+//
+
+void PeakEwma::Picker::SubchannelCallTracker::Start() {
+  start_nanos_ = NowNanos();
+  latency_->CallStarted();
+  if (child_tracker_ != nullptr) child_tracker_->Start();
+}
+
+void PeakEwma::Picker::SubchannelCallTracker::Finish(FinishArgs args) {
+  // Calls cancelled by the application say nothing about the endpoint.
+  const bool failed = !args.status.ok() &&
+                      args.status.code() != absl::StatusCode::kCancelled;
+  if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+  latency_->CallFinished(start_nanos_, NowNanos(), failed);
+}
+
+//
+// PeakEwma::Picker
+//
+
+PeakEwma::Picker::Picker(PeakEwma* parent, std::vector<EndpointInfo> endpoints)
+    : parent_(parent),
+      choice_count_(parent->config_->choice_count()),
+      random_(absl::Uniform<uint64_t>(parent->bit_gen_)),
+      endpoints_(std::move(endpoints)) {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << parent_ << " picker " << this
+      << "] created picker from endpoint_list=" << parent_->endpoint_list_.get()
+      << " with " << endpoints_.size() << " READY children";
+}
+
+PeakEwma::PickResult PeakEwma::Picker::Pick(PickArgs args) {
+  const int64_t now_nanos = NowNanos();
+  const size_t index = ChooseLowestCost(
+      random_, endpoints_.size(), choice_count_,
+      [&](size_t i) { return endpoints_[i].latency->Cost(now_nanos); });
+  auto& endpoint = endpoints_[index];
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << parent_ << " picker " << this << "] using picker index "
+      << index << " (latency estimate " << endpoint.latency->ewma_nanos()
+      << "ns), picker=" << endpoint.picker.get();
+  auto result = endpoint.picker->Pick(args);
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker = std::make_unique<SubchannelCallTracker>(
+        endpoint.latency, std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// PeakEwma
+//
+
+PeakEwma::PeakEwma(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO) << "[PE " << this << "] Created";
+}
+
+PeakEwma::~PeakEwma() {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << this << "] Destroying peak_ewma policy";
+  CHECK(endpoint_list_ == nullptr);
+  CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void PeakEwma::ShutdownLocked() {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO) << "[PE " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void PeakEwma::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status PeakEwma::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<PeakEwmaConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << this
+        << "] received update with address error: " << args.addresses.status();
+    // If we already have a child list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new child list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[PE " << this << "] replacing previous pending child list "
+              << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<PeakEwmaEndpointList>(
+      RefAsSubclass<PeakEwma>(DEBUG_LOCATION, "PeakEwmaEndpointList"),
+      addresses, args.args, std::move(args.resolution_note), &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb) && endpoint_list_ != nullptr) {
+      LOG(INFO) << "[PE " << this << "] replacing previous child list "
+                << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status = args.addresses.ok()
+                              ? absl::UnavailableError("empty address list")
+                              : args.addresses.status();
+    endpoint_list_->ReportTransientFailure(status);
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+//
+// PeakEwma::PeakEwmaEndpointList::PeakEwmaEndpoint
+//
+
+void PeakEwma::PeakEwmaEndpointList::PeakEwmaEndpoint::OnStateUpdate(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state, const absl::Status& status) {
+  auto* pe_endpoint_list = endpoint_list<PeakEwmaEndpointList>();
+  auto* peak_ewma = policy<PeakEwma>();
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << peak_ewma << "] connectivity changed for child "
+      << this << ", endpoint_list " << pe_endpoint_list << " (index "
+      << Index() << " of " << pe_endpoint_list->size() << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma << "] child " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    pe_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  pe_endpoint_list->MaybeUpdatePeakEwmaConnectivityStateLocked(status);
+}
+
+//
+// PeakEwma::PeakEwmaEndpointList
+//
+
+void PeakEwma::PeakEwmaEndpointList::UpdateStateCountersLocked(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void PeakEwma::PeakEwmaEndpointList::MaybeUpdatePeakEwmaConnectivityStateLocked(
+    absl::Status status_for_tf) {
+  auto* peak_ewma = policy<PeakEwma>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (peak_ewma->latest_pending_endpoint_list_.get() == this &&
+      (peak_ewma->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb)) {
+      LOG(INFO) << "[PE " << peak_ewma << "] swapping out child list "
+                << peak_ewma->endpoint_list_.get() << " ("
+                << peak_ewma->endpoint_list_->CountersString()
+                << ") in favor of " << this << " (" << CountersString() << ")";
+    }
+    peak_ewma->endpoint_list_ =
+        std::move(peak_ewma->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current child list.
+  if (peak_ewma->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma << "] reporting READY with child list " << this;
+    std::vector<Picker::EndpointInfo> endpoints;
+    for (const auto& endpoint : this->endpoints()) {
+      auto state = endpoint->connectivity_state();
+      if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+        endpoints.push_back(
+            {endpoint->picker(),
+             static_cast<const PeakEwmaEndpoint*>(endpoint.get())->latency()});
+      }
+    }
+    CHECK(!endpoints.empty());
+    peak_ewma->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(peak_ewma, std::move(endpoints)));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma << "] reporting CONNECTING with child list "
+        << this;
+    peak_ewma->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma
+        << "] reporting TRANSIENT_FAILURE with child list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    ReportTransientFailure(last_failure_);
+  }
+}
+
+//
+// factory
+//
+
+class PeakEwmaFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<PeakEwma>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<PeakEwmaConfig>>(
+        json, JsonArgs(), "errors validating peak_ewma LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterPeakEwmaLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      kPeakEwma, [] { return std::make_unique<PeakEwmaFactory>(); });
+}
+
+}  // namespace grpc_core
@@ -226,6 +226,12 @@ class PickFirst final : public LoadBalancingPolicy {
       bool seen_transient_failure() const { return seen_transient_failure_; }
       void set_seen_transient_failure() { seen_transient_failure_ = true; }
 
+      // When RequestConnectionWithTimer() started a connection attempt,
+      // if it did.
+      std::optional<Timestamp> connection_attempt_start() const {
+        return connection_attempt_start_;
+      }
+
      private:
       // This method will be invoked once soon after instantiation to report
       // the current connectivity state, and it will then be invoked again
@@ -243,6 +249,7 @@ class PickFirst final : public LoadBalancingPolicy {
       std::optional<grpc_connectivity_state> connectivity_state_;
       absl::Status connectivity_status_;
       bool seen_transient_failure_ = false;
+      std::optional<Timestamp> connection_attempt_start_;
     };
 
     SubchannelList(RefCountedPtr<PickFirst> policy,
@@ -379,12 +386,23 @@ class PickFirst final : public LoadBalancingPolicy {
     return state_ == GRPC_CHANNEL_IDLE && subchannel_list_ == nullptr;
   }
 
+  // Returns the Connection Attempt Delay to use for Happy Eyeballs.
+  Duration ConnectionAttemptDelay() const;
+
+  // Records how long a successful connection attempt took.
+  void RecordConnectionTime(Duration connection_time);
+
   // Whether we should enable health watching.
   const bool enable_health_watch_;
   // Whether we should omit our status message prefix.
   const bool omit_status_message_prefix_;
   // Connection Attempt Delay for Happy Eyeballs.
   const Duration connection_attempt_delay_;
+  // Whether to adapt the Connection Attempt Delay to past connection times.
+  const bool adaptive_connection_attempt_delay_;
+  // Smoothed time taken by successful connection attempts.  Unset until
+  // an attempt started by the Happy Eyeballs pass succeeds.
+  std::optional<Duration> smoothed_connection_time_;
 
   // Lateset update args.
   UpdateArgs latest_update_args_;
@@ -423,7 +441,12 @@ PickFirst::PickFirst(Args args)
           Clamp(channel_args()
                     .GetInt(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS)
                     .value_or(250),
-                100, 2000))) {
+                100, 2000))),
+      adaptive_connection_attempt_delay_(
+          channel_args()
+              .GetBool(
+                  GRPC_ARG_EXPERIMENTAL_HAPPY_EYEBALLS_ADAPTIVE_CONNECTION_ATTEMPT_DELAY)
+              .value_or(false)) {
   GRPC_TRACE_LOG(pick_first, INFO) << "Pick First " << this << " created.";
 }
 
@@ -432,6 +455,25 @@ PickFirst::~PickFirst() {
   CHECK_EQ(subchannel_list_.get(), nullptr);
 }
 
+Duration PickFirst::ConnectionAttemptDelay() const {
+  if (!smoothed_connection_time_.has_value()) return connection_attempt_delay_;
+  return Clamp(*smoothed_connection_time_ * 2, Duration::Milliseconds(100),
+               Duration::Seconds(2));
+}
+
+void PickFirst::RecordConnectionTime(Duration connection_time) {
+  if (!adaptive_connection_attempt_delay_) return;
+  // Same smoothing as TCP's SRTT (RFC 6298).
+  smoothed_connection_time_ =
+      smoothed_connection_time_.has_value()
+          ? *smoothed_connection_time_ * 0.875 + connection_time * 0.125
+          : connection_time;
+  GRPC_TRACE_LOG(pick_first, INFO)
+      << "Pick First " << this << " connection took "
+      << connection_time.ToString() << "; Connection Attempt Delay is now "
+      << ConnectionAttemptDelay().ToString();
+}
+
 void PickFirst::ShutdownLocked() {
   GRPC_TRACE_LOG(pick_first, INFO) << "Pick First " << this << " Shutting down";
   shutdown_ = true;
@@ -731,6 +773,10 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::Select() {
     stats_plugins.AddCounter(
         kMetricConnectionAttemptsSucceeded, 1,
         {pick_first_->channel_control_helper()->GetTarget()}, {});
+    const auto start = subchannel_data_->connection_attempt_start();
+    if (start.has_value()) {
+      pick_first_->RecordConnectionTime(Timestamp::Now() - *start);
+    }
   }
   // Drop our pointer to subchannel_data_, so that we know not to
   // interact with it on subsequent connectivity state updates.
@@ -943,19 +989,21 @@ void PickFirst::SubchannelList::SubchannelData::RequestConnectionWithTimer() {
   CHECK(connectivity_state_.has_value());
   if (connectivity_state_ == GRPC_CHANNEL_IDLE) {
     subchannel_state_->RequestConnection();
+    connection_attempt_start_ = Timestamp::Now();
   } else {
     CHECK_EQ(connectivity_state_.value(), GRPC_CHANNEL_CONNECTING);
   }
   // If this is not the last subchannel in the list, start the timer.
   if (index_ != subchannel_list_->size() - 1) {
     PickFirst* p = subchannel_list_->policy_.get();
+    const Duration delay = p->ConnectionAttemptDelay();
     GRPC_TRACE_LOG(pick_first, INFO)
         << "Pick First " << p << " subchannel list " << subchannel_list_
-        << ": starting Connection Attempt Delay timer for "
-        << p->connection_attempt_delay_.millis() << "ms for index " << index_;
+        << ": starting Connection Attempt Delay timer for " << delay.millis()
+        << "ms for index " << index_;
     subchannel_list_->timer_handle_ =
         p->channel_control_helper()->GetEventEngine()->RunAfter(
-            p->connection_attempt_delay_,
+            delay,
             [subchannel_list =
                  subchannel_list_->Ref(DEBUG_LOCATION, "timer")]() mutable {
               ExecCtx exec_ctx;
@@ -2085,7 +2133,7 @@ class PickFirstFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterPickFirstLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<PickFirstFactory>());
+      kPickFirst, [] { return std::make_unique<PickFirstFactory>(); });
 }
 
 }  // namespace grpc_core
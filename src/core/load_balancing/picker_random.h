@@ -0,0 +1,79 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_PICKER_RANDOM_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_PICKER_RANDOM_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+namespace grpc_core {
+
+/// Random numbers for pickers, which run concurrently on any number of
+/// threads.  This is splitmix64 over a shared counter: each call gets a
+/// distinct, well mixed value without a lock around a random number
+/// generator.  Not suitable for anything but spreading load.
+class PickerRandom {
+ public:
+  explicit PickerRandom(uint64_t seed) : state_(seed) {}
+
+  PickerRandom(const PickerRandom&) = delete;
+  PickerRandom& operator=(const PickerRandom&) = delete;
+
+  uint64_t Next() {
+    uint64_t z =
+        state_.fetch_add(0x9e3779b97f4a7c15, std::memory_order_relaxed);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  }
+
+  /// Returns an index in [0, size).  \a size must not be 0.
+  size_t Index(size_t size) { return Next() % size; }
+
+  /// Returns a number in [0, 1).
+  double Fraction() { return static_cast<double>(Next() >> 11) * 0x1.0p-53; }
+
+ private:
+  std::atomic<uint64_t> state_;
+};
+
+/// Picks \a choice_count of \a size endpoints at random and returns the
+/// index of the one for which \a cost returns the least ("power of two
+/// choices", when \a choice_count is 2).  \a size must not be 0.
+template <typename CostFn>
+size_t ChooseLowestCost(PickerRandom& random, size_t size,
+                        uint32_t choice_count, CostFn cost) {
+  size_t index = random.Index(size);
+  if (size == 1) return index;
+  auto lowest_cost = cost(index);
+  for (uint32_t i = 1; i < choice_count; ++i) {
+    const size_t candidate = random.Index(size);
+    auto candidate_cost = cost(candidate);
+    if (candidate_cost < lowest_cost) {
+      index = candidate;
+      lowest_cost = candidate_cost;
+    }
+  }
+  return index;
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_PICKER_RANDOM_H
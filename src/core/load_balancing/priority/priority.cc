@@ -851,7 +851,7 @@ class PriorityLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterPriorityLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<PriorityLbFactory>());
+      kPriority, [] { return std::make_unique<PriorityLbFactory>(); });
 }
 
 }  // namespace grpc_core
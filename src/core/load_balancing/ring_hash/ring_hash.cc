@@ -25,6 +25,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -33,6 +35,7 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -109,10 +112,19 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
   RingHashLbConfig(RingHashLbConfig&& other) = delete;
   RingHashLbConfig& operator=(RingHashLbConfig&& other) = delete;
 
+  // The largest Maglev table allowed, and the size used by default.  Both
+  // are prime, as the Maglev algorithm requires.
+  static constexpr uint64_t kMaxMaglevTableSize = 5000011;
+  static constexpr uint64_t kDefaultMaglevTableSize = 65537;
+
   absl::string_view name() const override { return kRingHash; }
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
   absl::string_view request_hash_header() const { return request_hash_header_; }
+  // If true, endpoints are found through a Maglev lookup table instead of
+  // by searching the ring.
+  bool use_maglev() const { return lookup_table_ == "maglev"; }
+  size_t maglev_table_size() const { return maglev_table_size_; }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
@@ -122,6 +134,9 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
             .OptionalField("requestHashHeader",
                            &RingHashLbConfig::request_hash_header_,
                            "request_hash_header")
+            .OptionalField("lookupTable", &RingHashLbConfig::lookup_table_)
+            .OptionalField("maglevTableSize",
+                           &RingHashLbConfig::maglev_table_size_)
             .Finish();
     return loader;
   }
@@ -144,12 +159,35 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
     if (min_ring_size_ > max_ring_size_) {
       errors->AddError("maxRingSize cannot be smaller than minRingSize");
     }
+    if (lookup_table_ != "ring" && lookup_table_ != "maglev") {
+      ValidationErrors::ScopedField field(errors, ".lookupTable");
+      errors->AddError("must be \"ring\" or \"maglev\"");
+    }
+    {
+      ValidationErrors::ScopedField field(errors, ".maglevTableSize");
+      if (!errors->FieldHasErrors() &&
+          (maglev_table_size_ > kMaxMaglevTableSize ||
+           !IsPrime(maglev_table_size_))) {
+        errors->AddError(absl::StrCat("must be a prime no larger than ",
+                                      kMaxMaglevTableSize));
+      }
+    }
   }
 
  private:
+  static bool IsPrime(uint64_t n) {
+    if (n < 2) return false;
+    for (uint64_t i = 2; i * i <= n; ++i) {
+      if (n % i == 0) return false;
+    }
+    return true;
+  }
+
   uint64_t min_ring_size_ = 1024;
   uint64_t max_ring_size_ = 4096;
   std::string request_hash_header_;
+  std::string lookup_table_ = "ring";
+  uint64_t maglev_table_size_ = kDefaultMaglevTableSize;
 };
 
 //
@@ -168,20 +206,70 @@ class RingHash final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
-  // A ring computed based on a config and address list.
+  // A lookup table computed based on a config and address list: either a
+  // ring of hashes, or a Maglev table.  Picks start at the entry for the
+  // request's hash and fall back to the entries after it.
   class Ring final : public RefCounted<Ring> {
    public:
     struct RingEntry {
       uint64_t hash;
       size_t endpoint_index;  // Index into RingHash::endpoints_.
+      uint32_t replica;       // Which of the endpoint's points this is.
     };
 
-    Ring(RingHash* ring_hash, RingHashLbConfig* config);
+    // If previous is non-null, points that previous already has for the
+    // same endpoints are reused rather than hashed and sorted again.
+    Ring(RingHash* ring_hash, RingHashLbConfig* config, const Ring* previous);
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    size_t size() const {
+      return maglev_table_.empty() ? ring_.size() : maglev_table_.size();
+    }
+
+    // Returns the index into RingHash::endpoints_ of the endpoint at the
+    // specified table entry.
+    size_t endpoint_index(size_t entry) const {
+      return maglev_table_.empty() ? ring_[entry].endpoint_index
+                                   : maglev_table_[entry];
+    }
+
+    // Returns the table entry to start from for request_hash.
+    size_t FindEntry(uint64_t request_hash) const;
 
    private:
+    struct EndpointWeight {
+      std::string hash_key;  // By default, endpoint's first address.
+      // Default weight is 1 for the cases where a weight is not provided,
+      // each occurrence of the address will be counted a weight value of 1.
+      uint32_t weight = 1;
+      double normalized_weight;
+    };
+
+    // The points an endpoint has on the ring are the hashes of
+    // "<hash_key>_0" through "<hash_key>_<num_points - 1>".
+    struct EndpointPoints {
+      std::string hash_key;
+      uint32_t num_points;
+    };
+
+    void BuildRing(RingHash* ring_hash, RingHashLbConfig* config,
+                   const std::vector<EndpointWeight>& endpoint_weights,
+                   double min_normalized_weight, const Ring* previous);
+    // Adds points [begin, end) of the endpoint at endpoint_index to entries.
+    void AddPoints(size_t endpoint_index, uint32_t begin, uint32_t end,
+                   std::vector<RingEntry>* entries) const;
+    // Builds ring_ from the points of previous that are still wanted and the
+    // points that previous lacks.  Returns false if the endpoints' hash keys
+    // are not unique, in which case the ring must be built from scratch.
+    bool MergeFromPrevious(const Ring& previous);
+    void BuildMaglevTable(RingHashLbConfig* config,
+                          const std::vector<EndpointWeight>& endpoint_weights,
+                          double max_normalized_weight);
+
     std::vector<RingEntry> ring_;
+    // Indexed like RingHash::endpoints_.  Empty if using Maglev.
+    std::vector<EndpointPoints> endpoint_points_;
+    // Indexes into RingHash::endpoints_.  Non-empty iff using Maglev.
+    std::vector<uint32_t> maglev_table_;
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -354,40 +442,14 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
       using_random_hash = true;
     }
   }
-  // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
-  const auto& ring = ring_->ring();
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
-    }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
-    }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
+  // Find the entry in the table to use for this RPC.
+  const Ring& ring = *ring_;
+  const size_t index = ring.FindEntry(request_hash);
   // Find the first endpoint we can use from the selected index.
   if (!using_random_hash) {
     for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+      const auto& endpoint_info =
+          endpoints_[ring.endpoint_index((index + i) % ring.size())];
       switch (endpoint_info.state) {
         case GRPC_CHANNEL_READY:
           return endpoint_info.picker->Pick(args);
@@ -407,8 +469,8 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     // find, triggering at most one endpoint to attempt connecting.
     bool requested_connection = has_endpoint_in_connecting_state_;
     for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+      const auto& endpoint_info =
+          endpoints_[ring.endpoint_index((index + i) % ring.size())];
       if (endpoint_info.state == GRPC_CHANNEL_READY) {
         return endpoint_info.picker->Pick(args);
       }
@@ -423,7 +485,7 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   std::string message = absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message());
+      endpoints_[ring.endpoint_index(index)].status.message());
   if (!resolution_note_.empty()) {
     absl::StrAppend(&message, " (", resolution_note_, ")");
   }
@@ -434,15 +496,41 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
 // RingHash::Ring
 //
 
-RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
+size_t RingHash::Ring::FindEntry(uint64_t request_hash) const {
+  if (!maglev_table_.empty()) return request_hash % maglev_table_.size();
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and index. Do not change them!
+  int64_t lowp = 0;
+  int64_t highp = ring_.size();
+  int64_t index = 0;
+  while (true) {
+    index = (lowp + highp) / 2;
+    if (index == static_cast<int64_t>(ring_.size())) {
+      index = 0;
+      break;
+    }
+    uint64_t midval = ring_[index].hash;
+    uint64_t midval1 = index == 0 ? 0 : ring_[index - 1].hash;
+    if (request_hash <= midval && request_hash > midval1) {
+      break;
+    }
+    if (midval < request_hash) {
+      lowp = index + 1;
+    } else {
+      highp = index - 1;
+    }
+    if (lowp > highp) {
+      index = 0;
+      break;
+    }
+  }
+  return index;
+}
+
+RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config,
+                     const Ring* previous) {
   // Store the weights while finding the sum.
-  struct EndpointWeight {
-    std::string hash_key;  // By default, endpoint's first address.
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
   std::vector<EndpointWeight> endpoint_weights;
   size_t sum = 0;
   const EndpointAddressesList& endpoints = ring_hash->endpoints_;
@@ -477,6 +565,18 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
     max_normalized_weight =
         std::max(endpoint_weight.normalized_weight, max_normalized_weight);
   }
+  if (config->use_maglev()) {
+    BuildMaglevTable(config, endpoint_weights, max_normalized_weight);
+  } else {
+    BuildRing(ring_hash, config, endpoint_weights, min_normalized_weight,
+              previous);
+  }
+}
+
+void RingHash::Ring::BuildRing(
+    RingHash* ring_hash, RingHashLbConfig* config,
+    const std::vector<EndpointWeight>& endpoint_weights,
+    double min_normalized_weight, const Ring* previous) {
   // Scale up the number of hashes per host such that the least-weighted host
   // gets a whole number of hashes on the ring. Other hosts might not end up
   // with whole numbers, and that's fine (the ring-building algorithm below can
@@ -492,41 +592,33 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
   const double scale = std::min(
       std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
       static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
+  // Work out how many points each endpoint gets by walking through the
+  // (host, weight) pairs in normalized_host_weights, giving (scale * weight)
+  // points to each host. Since these aren't necessarily whole numbers, we
+  // maintain running sums -- current_hashes and target_hashes -- which allows
+  // us to populate the ring in a mostly stable way.
+  endpoint_points_.reserve(endpoint_weights.size());
   double current_hashes = 0.0;
   double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < endpoints.size(); ++i) {
-    const std::string& hash_key = endpoint_weights[i].hash_key;
-    hash_key_buffer.assign(hash_key.begin(), hash_key.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * endpoint_weights[i].normalized_weight;
-    size_t count = 0;
+  for (const auto& endpoint_weight : endpoint_weights) {
+    target_hashes += scale * endpoint_weight.normalized_weight;
+    uint32_t num_points = 0;
     while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
-      ++count;
+      ++num_points;
       ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
     }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
+    endpoint_points_.push_back({endpoint_weight.hash_key, num_points});
+  }
+  // On endpoint churn, most points are the same as on the previous ring, so
+  // reuse them instead of hashing and sorting everything again.
+  if (previous != nullptr && !previous->endpoint_points_.empty() &&
+      MergeFromPrevious(*previous)) {
+    return;
+  }
+  // Reserve memory for the entire ring up front.
+  ring_.reserve(static_cast<uint64_t>(std::ceil(scale)));
+  for (size_t i = 0; i < endpoint_points_.size(); ++i) {
+    AddPoints(i, 0, endpoint_points_[i].num_points, &ring_);
   }
   std::sort(ring_.begin(), ring_.end(),
             [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
@@ -534,6 +626,124 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
             });
 }
 
+void RingHash::Ring::AddPoints(size_t endpoint_index, uint32_t begin,
+                               uint32_t end,
+                               std::vector<RingEntry>* entries) const {
+  const std::string& hash_key = endpoint_points_[endpoint_index].hash_key;
+  absl::InlinedVector<char, 196> hash_key_buffer;
+  hash_key_buffer.assign(hash_key.begin(), hash_key.end());
+  hash_key_buffer.emplace_back('_');
+  const size_t prefix_size = hash_key_buffer.size();
+  for (uint32_t replica = begin; replica < end; ++replica) {
+    const std::string count_str = absl::StrCat(replica);
+    hash_key_buffer.insert(hash_key_buffer.end(), count_str.begin(),
+                           count_str.end());
+    const uint64_t hash =
+        XXH64(hash_key_buffer.data(), hash_key_buffer.size(), 0);
+    entries->push_back({hash, endpoint_index, replica});
+    hash_key_buffer.resize(prefix_size);
+  }
+}
+
+bool RingHash::Ring::MergeFromPrevious(const Ring& previous) {
+  absl::flat_hash_map<absl::string_view, size_t> new_indexes;
+  for (size_t i = 0; i < endpoint_points_.size(); ++i) {
+    if (!new_indexes.emplace(endpoint_points_[i].hash_key, i).second) {
+      return false;
+    }
+  }
+  absl::flat_hash_map<absl::string_view, uint32_t> previous_num_points;
+  for (const auto& points : previous.endpoint_points_) {
+    if (!previous_num_points.emplace(points.hash_key, points.num_points)
+             .second) {
+      return false;
+    }
+  }
+  // Hash the points that the previous ring lacks.
+  std::vector<RingEntry> added;
+  for (size_t i = 0; i < endpoint_points_.size(); ++i) {
+    uint32_t begin = 0;
+    auto it = previous_num_points.find(endpoint_points_[i].hash_key);
+    if (it != previous_num_points.end()) {
+      begin = std::min(it->second, endpoint_points_[i].num_points);
+    }
+    AddPoints(i, begin, endpoint_points_[i].num_points, &added);
+  }
+  auto by_hash = [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
+    return lhs.hash < rhs.hash;
+  };
+  std::sort(added.begin(), added.end(), by_hash);
+  // Keep the previous ring's points that are still wanted, which stay in
+  // sorted order, and merge the new ones in.
+  std::vector<RingEntry> kept;
+  kept.reserve(previous.ring_.size());
+  for (const RingEntry& entry : previous.ring_) {
+    auto it = new_indexes.find(
+        previous.endpoint_points_[entry.endpoint_index].hash_key);
+    if (it == new_indexes.end() ||
+        entry.replica >= endpoint_points_[it->second].num_points) {
+      continue;
+    }
+    kept.push_back({entry.hash, it->second, entry.replica});
+  }
+  ring_.reserve(kept.size() + added.size());
+  std::merge(kept.begin(), kept.end(), added.begin(), added.end(),
+             std::back_inserter(ring_), by_hash);
+  GRPC_TRACE_LOG(ring_hash_lb, INFO)
+      << "ring of " << ring_.size() << " points reused " << kept.size()
+      << " points and hashed " << added.size();
+  return true;
+}
+
+void RingHash::Ring::BuildMaglevTable(
+    RingHashLbConfig* config,
+    const std::vector<EndpointWeight>& endpoint_weights,
+    double max_normalized_weight) {
+  // Each endpoint has its own permutation of the table entries, given by
+  // an offset and a skip derived from its hash key.  Endpoints take turns
+  // claiming the next free entry in their permutation, the most heavily
+  // weighted endpoint taking a turn every round and others proportionally
+  // less often, until the table is full.  See "Maglev: A Fast and Reliable
+  // Software Network Load Balancer" (NSDI '16); weighting follows Envoy.
+  if (endpoint_weights.empty()) return;
+  const uint64_t table_size = config->maglev_table_size();
+  struct Permutation {
+    uint64_t offset;
+    uint64_t skip;
+    uint64_t next = 0;
+    double target_weight = 0;
+  };
+  std::vector<Permutation> permutations;
+  permutations.reserve(endpoint_weights.size());
+  for (const auto& endpoint_weight : endpoint_weights) {
+    const std::string& key = endpoint_weight.hash_key;
+    permutations.push_back(
+        {XXH64(key.data(), key.size(), 0) % table_size,
+         XXH64(key.data(), key.size(), 1) % (table_size - 1) + 1});
+  }
+  constexpr uint32_t kUnset = std::numeric_limits<uint32_t>::max();
+  maglev_table_.assign(table_size, kUnset);
+  uint64_t filled = 0;
+  for (uint64_t round = 1; filled < table_size; ++round) {
+    for (size_t i = 0; i < permutations.size() && filled < table_size; ++i) {
+      Permutation& permutation = permutations[i];
+      if (round * endpoint_weights[i].normalized_weight <
+          permutation.target_weight) {
+        continue;
+      }
+      permutation.target_weight += max_normalized_weight;
+      uint64_t entry;
+      do {
+        entry = (permutation.offset + permutation.next * permutation.skip) %
+                table_size;
+        ++permutation.next;
+      } while (maglev_table_[entry] != kUnset);
+      maglev_table_[entry] = i;
+      ++filled;
+    }
+  }
+}
+
 //
 // RingHash::RingHashEndpoint::Helper
 //
@@ -732,8 +942,8 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   // Save config.
   auto* config = DownCast<RingHashLbConfig*>(args.config.get());
   request_hash_header_ = RefCountedStringValue(config->request_hash_header());
-  // Build new ring.
-  ring_ = MakeRefCounted<Ring>(this, config);
+  // Build new ring, starting from the previous one if there was one.
+  ring_ = MakeRefCounted<Ring>(this, config, ring_.get());
   // Update endpoint map.
   std::map<EndpointAddressSet, OrphanablePtr<RingHashEndpoint>> endpoint_map;
   std::vector<std::string> errors;
@@ -917,7 +1127,7 @@ class RingHashFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<RingHashFactory>());
+      kRingHash, [] { return std::make_unique<RingHashFactory>(); });
 }
 
 }  // namespace grpc_core
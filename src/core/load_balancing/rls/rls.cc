@@ -39,6 +39,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <iterator>
 #include <list>
 #include <map>
 #include <memory>
@@ -47,11 +48,11 @@
 #include <set>
 #include <string>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -62,6 +63,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/client_channel/client_channel_filter.h"
 #include "src/core/config/core_configuration.h"
@@ -184,6 +186,17 @@ const int kDefaultThrottlePadding = 8;
 const Duration kCacheCleanupTimerInterval = Duration::Minutes(1);
 const int64_t kMaxCacheSizeBytes = 5 * 1024 * 1024;
 
+// Hashes an RLS request key map, so that keys with the same keys and
+// values hash the same whether or not they own their strings.
+template <typename H, typename KeyMap>
+H HashKeyMap(H h, const KeyMap& key_map) {
+  for (const auto& [key, value] : key_map) {
+    h = H::combine(std::move(h), absl::string_view(key),
+                   absl::string_view(value));
+  }
+  return H::combine(std::move(h), key_map.size());
+}
+
 // RLS LB policy.
 class RlsLb final : public LoadBalancingPolicy {
  public:
@@ -195,21 +208,38 @@ class RlsLb final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
+  // The key built for a pick.  Does not own its strings, which belong to
+  // the config, the call's metadata or the call's arena, so that picks
+  // that find a cache entry do not allocate.  Sorted by key.
+  struct RequestKeyView {
+    absl::Span<const std::pair<absl::string_view, absl::string_view>> key_map;
+
+    template <typename H>
+    friend H AbslHashValue(H h, const RequestKeyView& key) {
+      return HashKeyMap(std::move(h), key.key_map);
+    }
+
+    std::string ToString() const {
+      return absl::StrCat(
+          "{", absl::StrJoin(key_map, ",", absl::PairFormatter("=")), "}");
+    }
+  };
+
   // Key to access entries in the cache and the request map.
   struct RequestKey {
     std::map<std::string, std::string> key_map;
 
+    RequestKey() = default;
+    explicit RequestKey(RequestKeyView view)
+        : key_map(view.key_map.begin(), view.key_map.end()) {}
+
     bool operator==(const RequestKey& rhs) const {
       return key_map == rhs.key_map;
     }
 
     template <typename H>
     friend H AbslHashValue(H h, const RequestKey& key) {
-      std::hash<std::string> string_hasher;
-      for (auto& [key, value] : key.key_map) {
-        h = H::combine(std::move(h), string_hasher(key), string_hasher(value));
-      }
-      return h;
+      return HashKeyMap(std::move(h), key.key_map);
     }
 
     size_t Size() const {
@@ -226,6 +256,31 @@ class RlsLb final : public LoadBalancingPolicy {
     }
   };
 
+  // Lets the cache and the request map be looked up by RequestKeyView.
+  struct RequestKeyHash {
+    using is_transparent = void;
+
+    size_t operator()(const RequestKey& key) const {
+      return absl::HashOf(key);
+    }
+    size_t operator()(const RequestKeyView& key) const {
+      return absl::HashOf(key);
+    }
+  };
+  struct RequestKeyEq {
+    using is_transparent = void;
+
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      return std::equal(
+          a.key_map.begin(), a.key_map.end(), b.key_map.begin(),
+          b.key_map.end(), [](const auto& x, const auto& y) {
+            return absl::string_view(x.first) == absl::string_view(y.first) &&
+                   absl::string_view(x.second) == absl::string_view(y.second);
+          });
+    }
+  };
+
   // Data from an RLS response.
   struct ResponseInfo {
     absl::Status status;
@@ -487,7 +542,7 @@ class RlsLb final : public LoadBalancingPolicy {
     // Finds an entry from the cache that corresponds to a key. If an entry is
     // not found, nullptr is returned. Otherwise, the entry is considered
     // recently used and its order in the LRU list of the cache is updated.
-    Entry* Find(const RequestKey& key)
+    Entry* Find(const RequestKeyView& key)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
     // Finds an entry from the cache that corresponds to a key. If an entry is
@@ -539,7 +594,8 @@ class RlsLb final : public LoadBalancingPolicy {
     size_t size_ ABSL_GUARDED_BY(&RlsLb::mu_) = 0;
 
     std::list<RequestKey> lru_list_ ABSL_GUARDED_BY(&RlsLb::mu_);
-    std::unordered_map<RequestKey, OrphanablePtr<Entry>, absl::Hash<RequestKey>>
+    absl::flat_hash_map<RequestKey, OrphanablePtr<Entry>, RequestKeyHash,
+                        RequestKeyEq>
         map_ ABSL_GUARDED_BY(&RlsLb::mu_);
     std::optional<EventEngine::TaskHandle> cleanup_timer_handle_;
   };
@@ -704,8 +760,8 @@ class RlsLb final : public LoadBalancingPolicy {
   Cache cache_ ABSL_GUARDED_BY(mu_);
   // Maps an RLS request key to an RlsRequest object that represents a pending
   // RLS request.
-  std::unordered_map<RequestKey, OrphanablePtr<RlsRequest>,
-                     absl::Hash<RequestKey>>
+  absl::flat_hash_map<RequestKey, OrphanablePtr<RlsRequest>, RequestKeyHash,
+                      RequestKeyEq>
       request_map_ ABSL_GUARDED_BY(mu_);
   // The channel on which RLS requests are sent.
   // Note that this channel may be swapped out when the RLS policy gets
@@ -885,25 +941,35 @@ void RlsLb::ChildPolicyWrapper::ChildPolicyHelper::UpdateState(
 //
 
 // Builds the key to be used for a request based on path and initial_metadata.
-std::map<std::string, std::string> BuildKeyMap(
-    const RlsLbConfig::KeyBuilderMap& key_builder_map, absl::string_view path,
-    absl::string_view host,
-    const LoadBalancingPolicy::MetadataInterface* initial_metadata) {
+// The key is allocated on the call's arena.
+absl::Span<const std::pair<absl::string_view, absl::string_view>>
+BuildKeyMap(const RlsLbConfig::KeyBuilderMap& key_builder_map,
+            absl::string_view path, absl::string_view host,
+            const LoadBalancingPolicy::MetadataInterface* initial_metadata,
+            LoadBalancingPolicy::CallState* call_state) {
+  using KeyValue = std::pair<absl::string_view, absl::string_view>;
   size_t last_slash_pos = path.npos;  // May need this a few times, so cache it.
   // Find key builder for this path.
-  auto it = key_builder_map.find(std::string(path));
+  auto it = key_builder_map.find(path);
   if (it == key_builder_map.end()) {
     // Didn't find exact match, try method wildcard.
     last_slash_pos = path.rfind('/');
     DCHECK(last_slash_pos != path.npos);
     if (GPR_UNLIKELY(last_slash_pos == path.npos)) return {};
-    std::string service(path.substr(0, last_slash_pos + 1));
-    it = key_builder_map.find(service);
+    it = key_builder_map.find(path.substr(0, last_slash_pos + 1));
     if (it == key_builder_map.end()) return {};
   }
   const RlsLbConfig::KeyBuilder* key_builder = &it->second;
-  // Construct key map using key builder.
-  std::map<std::string, std::string> key_map;
+  // Construct key map using key builder.  The config is rejected if a key
+  // is used twice, so keys are simply appended, then sorted.
+  const size_t max_size =
+      key_builder->header_keys.size() + key_builder->constant_keys.size() + 3;
+  KeyValue* key_map =
+      static_cast<KeyValue*>(call_state->Alloc(sizeof(KeyValue) * max_size));
+  size_t size = 0;
+  auto add = [&](absl::string_view key, absl::string_view value) {
+    new (&key_map[size++]) KeyValue(key, value);
+  };
   // Add header keys.
   for (const auto& [key, header_names] : key_builder->header_keys) {
     for (const std::string& header_name : header_names) {
@@ -911,18 +977,24 @@ std::map<std::string, std::string> BuildKeyMap(
       std::optional<absl::string_view> value =
           initial_metadata->Lookup(header_name, &buffer);
       if (value.has_value()) {
-        key_map[key] = std::string(*value);
+        if (!buffer.empty()) {
+          // The value was joined from several headers into the buffer, so
+          // it needs to be kept on the arena.
+          char* copy = static_cast<char*>(call_state->Alloc(value->size()));
+          memcpy(copy, value->data(), value->size());
+          value = absl::string_view(copy, value->size());
+        }
+        add(key, *value);
         break;
       }
     }
   }
   // Add constant keys.
-  key_map.insert(key_builder->constant_keys.begin(),
-                 key_builder->constant_keys.end());
-  // Add host key.
-  if (!key_builder->host_key.empty()) {
-    key_map[key_builder->host_key] = std::string(host);
+  for (const auto& [key, value] : key_builder->constant_keys) {
+    add(key, value);
   }
+  // Add host key.
+  if (!key_builder->host_key.empty()) add(key_builder->host_key, host);
   // Add service key.
   if (!key_builder->service_key.empty()) {
     if (last_slash_pos == path.npos) {
@@ -930,8 +1002,7 @@ std::map<std::string, std::string> BuildKeyMap(
       DCHECK(last_slash_pos != path.npos);
       if (GPR_UNLIKELY(last_slash_pos == path.npos)) return {};
     }
-    key_map[key_builder->service_key] =
-        std::string(path.substr(1, last_slash_pos - 1));
+    add(key_builder->service_key, path.substr(1, last_slash_pos - 1));
   }
   // Add method key.
   if (!key_builder->method_key.empty()) {
@@ -940,10 +1011,12 @@ std::map<std::string, std::string> BuildKeyMap(
       DCHECK(last_slash_pos != path.npos);
       if (GPR_UNLIKELY(last_slash_pos == path.npos)) return {};
     }
-    key_map[key_builder->method_key] =
-        std::string(path.substr(last_slash_pos + 1));
+    add(key_builder->method_key, path.substr(last_slash_pos + 1));
   }
-  return key_map;
+  std::sort(key_map, key_map + size, [](const KeyValue& a, const KeyValue& b) {
+    return a.first < b.first;
+  });
+  return absl::MakeConstSpan(key_map, size);
 }
 
 RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy)
@@ -956,10 +1029,10 @@ RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy)
 
 LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
   // Construct key for request.
-  RequestKey key = {
+  RequestKeyView key = {
       BuildKeyMap(config_->key_builder_map(), args.path,
                   lb_policy_->channel_control_helper()->GetAuthority(),
-                  args.initial_metadata)};
+                  args.initial_metadata, args.call_state)};
   GRPC_TRACE_LOG(rls_lb, INFO)
       << "[rlslb " << lb_policy_.get() << "] picker=" << this
       << ": request keys: " << key.ToString();
@@ -990,8 +1063,9 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
     }
     // Start the RLS call.
     lb_policy_->rls_channel_->StartRlsCall(
-        key, (entry == nullptr || entry->data_expiration_time() < now) ? nullptr
-                                                                       : entry);
+        RequestKey(key),
+        (entry == nullptr || entry->data_expiration_time() < now) ? nullptr
+                                                                  : entry);
   }
   // If the cache entry exists, see if it has usable data.
   if (entry != nullptr) {
@@ -1195,10 +1269,11 @@ bool RlsLb::Cache::Entry::CanEvict() const {
 }
 
 void RlsLb::Cache::Entry::MarkUsed() {
+  // This runs on every pick, so relink the existing node rather than
+  // copying the key into a new one.  splice() leaves lru_iterator_ valid.
   auto& lru_list = lb_policy_->cache_.lru_list_;
-  auto new_it = lru_list.insert(lru_list.end(), *lru_iterator_);
-  lru_list.erase(lru_iterator_);
-  lru_iterator_ = new_it;
+  if (std::next(lru_iterator_) == lru_list.end()) return;
+  lru_list.splice(lru_list.end(), lru_list, lru_iterator_);
 }
 
 std::vector<RlsLb::ChildPolicyWrapper*>
@@ -1296,7 +1371,7 @@ RlsLb::Cache::Cache(RlsLb* lb_policy) : lb_policy_(lb_policy) {
   StartCleanupTimer();
 }
 
-RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKey& key) {
+RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKeyView& key) {
   auto it = map_.find(key);
   if (it == map_.end()) return nullptr;
   it->second->MarkUsed();
@@ -1404,7 +1479,7 @@ void RlsLb::Cache::OnCleanupTimer() {
     if (GPR_UNLIKELY(entry->ShouldRemove() && entry->CanEvict())) {
       size_ -= entry->Size();
       entry->TakeChildPolicyWrappers(&child_policy_wrappers_to_delete);
-      it = map_.erase(it);
+      map_.erase(it++);
     } else {
       ++it;
     }
@@ -2492,7 +2567,7 @@ class RlsLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterRlsLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<RlsLbFactory>());
+      RlsLbConfig::Name(), [] { return std::make_unique<RlsLbFactory>(); });
 }
 
 }  // namespace grpc_core
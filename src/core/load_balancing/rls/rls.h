@@ -19,9 +19,9 @@
 
 #include <map>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_object_loader.h"
@@ -47,7 +47,8 @@ class RlsLbConfig final : public LoadBalancingPolicy::Config {
     std::string method_key;
     std::map<std::string /*key*/, std::string /*value*/> constant_keys;
   };
-  using KeyBuilderMap = std::unordered_map<std::string /*path*/, KeyBuilder>;
+  // Looked up by path on every pick, so supports lookup by string_view.
+  using KeyBuilderMap = absl::flat_hash_map<std::string /*path*/, KeyBuilder>;
 
   RlsLbConfig() = default;
 
@@ -21,8 +21,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -42,11 +45,16 @@
 #include "src/core/load_balancing/endpoint_list.h"
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/load_balancing/picker_random.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
 #include "src/core/util/work_serializer.h"
 
 namespace grpc_core {
@@ -55,6 +63,73 @@ namespace {
 
 constexpr absl::string_view kRoundRobin = "round_robin";
 
+// Config for round_robin LB policy.
+class RoundRobinConfig final : public LoadBalancingPolicy::Config {
+ public:
+  // Gradually ramps up the traffic sent to endpoints that have just become
+  // READY, so that they can warm up (connection windows, caches, JIT) before
+  // taking their full share.  Like Envoy's slow_start_config.
+  struct SlowStartConfig {
+    // How long the ramp up lasts.
+    Duration slow_start_window = Duration::Zero();
+    // How non-linear the ramp up is.  1 is linear; larger values send more
+    // traffic sooner.
+    double aggression = 1.0;
+    // The smallest share of its traffic an endpoint gets while warming up.
+    double min_weight_percent = 10;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader =
+          JsonObjectLoader<SlowStartConfig>()
+              .OptionalField("slowStartWindow",
+                             &SlowStartConfig::slow_start_window)
+              .OptionalField("aggression", &SlowStartConfig::aggression)
+              .OptionalField("minWeightPercent",
+                             &SlowStartConfig::min_weight_percent)
+              .Finish();
+      return loader;
+    }
+
+    void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+      if (slow_start_window < Duration::Zero()) {
+        ValidationErrors::ScopedField field(errors, ".slowStartWindow");
+        errors->AddError("must be non-negative");
+      }
+      if (aggression <= 0) {
+        ValidationErrors::ScopedField field(errors, ".aggression");
+        errors->AddError("must be greater than zero");
+      }
+      if (min_weight_percent < 0 || min_weight_percent > 100) {
+        ValidationErrors::ScopedField field(errors, ".minWeightPercent");
+        errors->AddError("must be between 0 and 100");
+      }
+    }
+  };
+
+  absl::string_view name() const override { return kRoundRobin; }
+
+  // Returns null if slow start is disabled.
+  const SlowStartConfig* slow_start_config() const {
+    if (!slow_start_config_.has_value() ||
+        slow_start_config_->slow_start_window == Duration::Zero()) {
+      return nullptr;
+    }
+    return &*slow_start_config_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<RoundRobinConfig>()
+            .OptionalField("slowStartConfig",
+                           &RoundRobinConfig::slow_start_config_)
+            .Finish();
+    return loader;
+  }
+
+ private:
+  std::optional<SlowStartConfig> slow_start_config_;
+};
+
 class RoundRobin final : public LoadBalancingPolicy {
  public:
   explicit RoundRobin(Args args);
@@ -92,7 +167,8 @@ class RoundRobin final : public LoadBalancingPolicy {
                          const ChannelArgs& args,
                          std::shared_ptr<WorkSerializer> work_serializer,
                          std::vector<std::string>* errors)
-          : Endpoint(std::move(endpoint_list)) {
+          : Endpoint(std::move(endpoint_list)),
+            address_set_(addresses.addresses()) {
         absl::Status status = Init(addresses, args, std::move(work_serializer));
         if (!status.ok()) {
           errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
@@ -100,11 +176,15 @@ class RoundRobin final : public LoadBalancingPolicy {
         }
       }
 
+      const EndpointAddressSet& address_set() const { return address_set_; }
+
      private:
       // Called when the child policy reports a connectivity state update.
       void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
                          grpc_connectivity_state new_state,
                          const absl::Status& status) override;
+
+      const EndpointAddressSet address_set_;
     };
 
     LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
@@ -139,24 +219,51 @@ class RoundRobin final : public LoadBalancingPolicy {
 
   class Picker final : public SubchannelPicker {
    public:
-    Picker(RoundRobin* parent,
-           std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>
-               pickers);
+    struct EndpointInfo {
+      RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+      // When the endpoint started warming up, or InfPast() if it is warm.
+      Timestamp warm_up_start;
+    };
+
+    Picker(RoundRobin* parent, std::vector<EndpointInfo> endpoints);
 
     PickResult Pick(PickArgs args) override;
 
    private:
+    // Returns true if a pick that landed on endpoint should go ahead.
+    // Endpoints that are warming up only take a fraction of their picks.
+    bool AcceptPick(const EndpointInfo& endpoint, Timestamp now);
+
     // Using pointer value only, no ref held -- do not dereference!
     RoundRobin* parent_;
 
     std::atomic<size_t> last_picked_index_;
-    std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>> pickers_;
+    std::vector<EndpointInfo> endpoints_;
+    // Set only if some endpoint was warming up when the picker was created.
+    std::optional<RoundRobinConfig::SlowStartConfig> slow_start_config_;
+    PickerRandom random_;
   };
 
   ~RoundRobin() override;
 
   void ShutdownLocked() override;
 
+  // Records that the endpoint with address_set became READY, starting its
+  // warm-up if slow start is enabled and other endpoints can take the
+  // traffic meanwhile.
+  void EndpointReadyLocked(const EndpointAddressSet& address_set,
+                           bool other_endpoints_ready);
+  // Returns when the endpoint's warm-up started, or InfPast() if it is warm.
+  Timestamp WarmUpStartLocked(const EndpointAddressSet& address_set) const;
+
+  // Returns null if slow start is disabled.
+  const RoundRobinConfig::SlowStartConfig* slow_start_config() const {
+    return config_ == nullptr ? nullptr : config_->slow_start_config();
+  }
+
+  // May be null, for parents that do not pass a config.
+  RefCountedPtr<RoundRobinConfig> config_;
+
   // Current child list.
   OrphanablePtr<RoundRobinEndpointList> endpoint_list_;
   // Latest pending child list.
@@ -168,34 +275,77 @@ class RoundRobin final : public LoadBalancingPolicy {
   bool shutdown_ = false;
 
   absl::BitGen bit_gen_;
+
+  // With slow start enabled, when each READY endpoint started warming up,
+  // or InfPast() if it did not need to.  Kept by address, since the
+  // endpoints of a new endpoint list are the same as those in the previous
+  // one if they have the same addresses.
+  std::map<EndpointAddressSet, Timestamp> warm_up_start_;
 };
 
 //
 // RoundRobin::Picker
 //
 
-RoundRobin::Picker::Picker(
-    RoundRobin* parent,
-    std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>> pickers)
-    : parent_(parent), pickers_(std::move(pickers)) {
+RoundRobin::Picker::Picker(RoundRobin* parent,
+                           std::vector<EndpointInfo> endpoints)
+    : parent_(parent),
+      endpoints_(std::move(endpoints)),
+      random_(absl::Uniform<uint64_t>(parent->bit_gen_)) {
   // For discussion on why we generate a random starting index for
   // the picker, see https://github.com/grpc/grpc-go/issues/2580.
-  size_t index = absl::Uniform<size_t>(parent->bit_gen_, 0, pickers_.size());
+  size_t index = absl::Uniform<size_t>(parent->bit_gen_, 0, endpoints_.size());
   last_picked_index_.store(index, std::memory_order_relaxed);
+  const RoundRobinConfig::SlowStartConfig* slow_start_config =
+      parent->slow_start_config();
+  if (slow_start_config != nullptr &&
+      std::any_of(endpoints_.begin(), endpoints_.end(),
+                  [](const EndpointInfo& endpoint) {
+                    return endpoint.warm_up_start != Timestamp::InfPast();
+                  })) {
+    slow_start_config_ = *slow_start_config;
+  }
   GRPC_TRACE_LOG(round_robin, INFO)
       << "[RR " << parent_ << " picker " << this
       << "] created picker from endpoint_list=" << parent_->endpoint_list_.get()
-      << " with " << pickers_.size()
+      << " with " << endpoints_.size()
       << " READY children; last_picked_index_=" << index;
 }
 
+bool RoundRobin::Picker::AcceptPick(const EndpointInfo& endpoint,
+                                    Timestamp now) {
+  const Duration elapsed = now - endpoint.warm_up_start;
+  if (elapsed >= slow_start_config_->slow_start_window) return true;
+  // As in Envoy, the endpoint's share of traffic is
+  // (elapsed / window) ^ (1 / aggression), but at least minWeightPercent.
+  const double time_factor =
+      std::max(0.0, elapsed.seconds() /
+                        slow_start_config_->slow_start_window.seconds());
+  const double weight =
+      std::max(std::pow(time_factor, 1 / slow_start_config_->aggression),
+               slow_start_config_->min_weight_percent / 100);
+  return random_.Fraction() < weight;
+}
+
 RoundRobin::PickResult RoundRobin::Picker::Pick(PickArgs args) {
   size_t index = last_picked_index_.fetch_add(1, std::memory_order_relaxed) %
-                 pickers_.size();
+                 endpoints_.size();
+  if (slow_start_config_.has_value()) {
+    // Move on from endpoints that are warming up for the picks they should
+    // not take yet.  Give up after going round once, so that a pick always
+    // completes even if every endpoint is warming up.
+    const Timestamp now = Timestamp::Now();
+    for (size_t i = 1; i < endpoints_.size() &&
+                       !AcceptPick(endpoints_[index], now);
+         ++i) {
+      index = last_picked_index_.fetch_add(1, std::memory_order_relaxed) %
+              endpoints_.size();
+    }
+  }
   GRPC_TRACE_LOG(round_robin, INFO)
       << "[RR " << parent_ << " picker " << this << "] using picker index "
-      << index << ", picker=" << pickers_[index].get();
-  return pickers_[index]->Pick(args);
+      << index << ", picker=" << endpoints_[index].picker.get();
+  return endpoints_[index].picker->Pick(args);
 }
 
 //
@@ -227,11 +377,55 @@ void RoundRobin::ResetBackoffLocked() {
   }
 }
 
+void RoundRobin::EndpointReadyLocked(const EndpointAddressSet& address_set,
+                                     bool other_endpoints_ready) {
+  if (slow_start_config() == nullptr) return;
+  // When nothing else is READY, there is nowhere to shift traffic to while
+  // the endpoint warms up.  If the endpoint is already READY in another
+  // endpoint list, its warm-up carries on where it is.
+  auto [it, inserted] = warm_up_start_.emplace(
+      address_set,
+      other_endpoints_ready ? Timestamp::Now() : Timestamp::InfPast());
+  if (inserted && other_endpoints_ready) {
+    GRPC_TRACE_LOG(round_robin, INFO)
+        << "[RR " << this << "] starting warm-up of " << address_set.ToString();
+  }
+}
+
+Timestamp RoundRobin::WarmUpStartLocked(
+    const EndpointAddressSet& address_set) const {
+  auto it = warm_up_start_.find(address_set);
+  if (it == warm_up_start_.end()) return Timestamp::InfPast();
+  const RoundRobinConfig::SlowStartConfig* slow_start = slow_start_config();
+  if (slow_start == nullptr ||
+      Timestamp::Now() - it->second >= slow_start->slow_start_window) {
+    return Timestamp::InfPast();
+  }
+  return it->second;
+}
+
 absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<RoundRobinConfig>();
   EndpointAddressesIterator* addresses = nullptr;
   if (args.addresses.ok()) {
     GRPC_TRACE_LOG(round_robin, INFO) << "[RR " << this << "] received update";
     addresses = args.addresses->get();
+    // Forget about endpoints that are gone.  Endpoints in the first update
+    // do not warm up: there is nothing else to send their traffic to.
+    std::set<EndpointAddressSet> address_sets;
+    const bool initial_update =
+        endpoint_list_ == nullptr && slow_start_config() != nullptr;
+    addresses->ForEach([&](const EndpointAddresses& endpoint) {
+      auto it = address_sets.emplace(endpoint.addresses()).first;
+      if (initial_update) warm_up_start_.emplace(*it, Timestamp::InfPast());
+    });
+    for (auto it = warm_up_start_.begin(); it != warm_up_start_.end();) {
+      if (address_sets.count(it->first) == 0) {
+        it = warm_up_start_.erase(it);
+      } else {
+        ++it;
+      }
+    }
   } else {
     GRPC_TRACE_LOG(round_robin, INFO)
         << "[RR " << this
@@ -300,6 +494,14 @@ void RoundRobin::RoundRobinEndpointList::RoundRobinEndpoint::OnStateUpdate(
   }
   // If state changed, update state counters.
   if (!old_state.has_value() || *old_state != new_state) {
+    if (new_state == GRPC_CHANNEL_READY) {
+      round_robin->EndpointReadyLocked(
+          address_set_, round_robin->endpoint_list_ != nullptr &&
+                            round_robin->endpoint_list_->num_ready_ > 0);
+    } else if (old_state == GRPC_CHANNEL_READY) {
+      // The endpoint warms up again next time it becomes READY.
+      round_robin->warm_up_start_.erase(address_set_);
+    }
     rr_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
   }
   // Update the policy state.
@@ -374,11 +576,15 @@ void RoundRobin::RoundRobinEndpointList::
     GRPC_TRACE_LOG(round_robin, INFO)
         << "[RR " << round_robin << "] reporting READY with child list "
         << this;
-    std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>> pickers;
+    std::vector<Picker::EndpointInfo> pickers;
     for (const auto& endpoint : endpoints()) {
       auto state = endpoint->connectivity_state();
       if (state.has_value() && *state == GRPC_CHANNEL_READY) {
-        pickers.push_back(endpoint->picker());
+        pickers.push_back(
+            {endpoint->picker(),
+             round_robin->WarmUpStartLocked(
+                 static_cast<const RoundRobinEndpoint*>(endpoint.get())
+                     ->address_set())});
       }
     }
     CHECK(!pickers.empty());
@@ -410,11 +616,6 @@ void RoundRobin::RoundRobinEndpointList::
 // factory
 //
 
-class RoundRobinConfig final : public LoadBalancingPolicy::Config {
- public:
-  absl::string_view name() const override { return kRoundRobin; }
-};
-
 class RoundRobinFactory final : public LoadBalancingPolicyFactory {
  public:
   OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
@@ -425,8 +626,9 @@ class RoundRobinFactory final : public LoadBalancingPolicyFactory {
   absl::string_view name() const override { return kRoundRobin; }
 
   absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
-  ParseLoadBalancingConfig(const Json& /*json*/) const override {
-    return MakeRefCounted<RoundRobinConfig>();
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<RoundRobinConfig>>(
+        json, JsonArgs(), "errors validating round_robin LB policy config");
   }
 };
 
@@ -434,7 +636,7 @@ class RoundRobinFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterRoundRobinLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<RoundRobinFactory>());
+      kRoundRobin, [] { return std::make_unique<RoundRobinFactory>(); });
 }
 
 }  // namespace grpc_core
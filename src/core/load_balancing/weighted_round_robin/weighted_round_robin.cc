@@ -66,6 +66,8 @@
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/rcu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
@@ -374,15 +376,19 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     void BuildSchedulerAndStartTimerLocked()
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&timer_mu_);
 
+    // Makes scheduler the one used by picks.  Waits for any picks still
+    // using the scheduler it overwrites.
+    void PublishSchedulerLocked(std::unique_ptr<StaticStrideScheduler> scheduler)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&timer_mu_);
+
     RefCountedPtr<WeightedRoundRobin> wrr_;
     RefCountedPtr<WeightedRoundRobinConfig> config_;
     std::vector<EndpointInfo> endpoints_;
 
-    Mutex scheduler_mu_;
-    std::shared_ptr<StaticStrideScheduler> scheduler_
-        ABSL_GUARDED_BY(&scheduler_mu_);
+    // Schedulers are published RCU-style, so that picks never take a lock.
+    Rcu<std::unique_ptr<StaticStrideScheduler>> scheduler_;
 
-    Mutex timer_mu_ ABSL_ACQUIRED_BEFORE(&scheduler_mu_);
+    Mutex timer_mu_;
     std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
         timer_handle_ ABSL_GUARDED_BY(&timer_mu_);
 
@@ -417,8 +423,13 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
 
   absl::BitGen bit_gen_;
 
-  // Accessed by picker.
-  std::atomic<uint32_t> scheduler_state_{absl::Uniform<uint32_t>(bit_gen_)};
+  // Accessed by picker.  Picks on different CPUs advance different
+  // sequences, each starting at a random offset, so that they do not all
+  // contend for one cache line.
+  struct alignas(GPR_CACHELINE_SIZE) SchedulerSequence {
+    std::atomic<uint32_t> value{0};
+  };
+  PerCpu<SchedulerSequence> scheduler_state_{PerCpuOptions().SetMaxShards(32)};
 };
 
 //
@@ -594,14 +605,14 @@ WeightedRoundRobin::PickResult WeightedRoundRobin::Picker::Pick(PickArgs args) {
 }
 
 size_t WeightedRoundRobin::Picker::PickIndex() {
-  // Grab a ref to the scheduler.
-  std::shared_ptr<StaticStrideScheduler> scheduler;
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler = scheduler_;
-  }
   // If we have a scheduler, use it to do a WRR pick.
-  if (scheduler != nullptr) return scheduler->Pick();
+  std::optional<size_t> index = scheduler_.Read(
+      [](const std::unique_ptr<StaticStrideScheduler>& scheduler)
+          -> std::optional<size_t> {
+        if (scheduler == nullptr) return std::nullopt;
+        return scheduler->Pick();
+      });
+  if (index.has_value()) return *index;
   // We don't have a scheduler (i.e., either all of the weights are 0 or
   // there is only one subchannel), so fall back to RR.
   return last_picked_index_.fetch_add(1) % endpoints_.size();
@@ -633,12 +644,14 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
       << "[WRR " << wrr_.get() << " picker " << this
       << "] new weights: " << absl::StrJoin(weights, " ");
-  auto scheduler_or = StaticStrideScheduler::Make(
-      weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
-  std::shared_ptr<StaticStrideScheduler> scheduler;
+  auto scheduler_or = StaticStrideScheduler::Make(weights, [this]() {
+    return wrr_->scheduler_state_.this_cpu().value.fetch_add(
+        1, std::memory_order_relaxed);
+  });
+  std::unique_ptr<StaticStrideScheduler> scheduler;
   if (scheduler_or.has_value()) {
     scheduler =
-        std::make_shared<StaticStrideScheduler>(std::move(*scheduler_or));
+        std::make_unique<StaticStrideScheduler>(std::move(*scheduler_or));
     GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
         << "[WRR " << wrr_.get() << " picker " << this
         << "] new scheduler: " << scheduler.get();
@@ -650,10 +663,7 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
                              {wrr_->channel_control_helper()->GetTarget()},
                              {wrr_->locality_name_});
   }
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler_ = std::move(scheduler);
-  }
+  PublishSchedulerLocked(std::move(scheduler));
   // Start timer.
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
       << "[WRR " << wrr_.get() << " picker " << this
@@ -681,6 +691,13 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
       });
 }
 
+void WeightedRoundRobin::Picker::PublishSchedulerLocked(
+    std::unique_ptr<StaticStrideScheduler> scheduler) {
+  // Picks only hold the scheduler for the duration of a scheduler pick, so
+  // this does not wait long.
+  scheduler_.Exchange(std::move(scheduler));
+}
+
 //
 // WeightedRoundRobin
 //
@@ -690,6 +707,10 @@ WeightedRoundRobin::WeightedRoundRobin(Args args)
       locality_name_(channel_args()
                          .GetString(GRPC_ARG_LB_WEIGHTED_TARGET_CHILD)
                          .value_or("")) {
+  for (SchedulerSequence& sequence : scheduler_state_) {
+    sequence.value.store(absl::Uniform<uint32_t>(bit_gen_),
+                         std::memory_order_relaxed);
+  }
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
       << "[WRR " << this << "] Created -- locality_name=\""
       << std::string(locality_name_) << "\"";
@@ -1002,7 +1023,8 @@ class WeightedRoundRobinFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterWeightedRoundRobinLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<WeightedRoundRobinFactory>());
+      kWeightedRoundRobin,
+      [] { return std::make_unique<WeightedRoundRobinFactory>(); });
 }
 
 }  // namespace grpc_core
@@ -708,7 +708,8 @@ class WeightedTargetLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterWeightedTargetLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<WeightedTargetLbFactory>());
+      kWeightedTarget,
+      [] { return std::make_unique<WeightedTargetLbFactory>(); });
 }
 
 }  // namespace grpc_core
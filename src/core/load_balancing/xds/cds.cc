@@ -270,6 +270,30 @@ class PriorityEndpointIterator final : public EndpointAddressesIterator {
   std::vector<size_t /*child_number*/> priority_child_numbers_;
 };
 
+// Returns true if the leaf clusters of cluster_config, if it is an
+// aggregate cluster, have the same config in both old_xds_config and
+// new_xds_config.  Always true for a leaf cluster.
+bool LeafClustersUnchanged(const XdsConfig::ClusterConfig& cluster_config,
+                           const XdsConfig& old_xds_config,
+                           const XdsConfig& new_xds_config) {
+  const auto* aggregate_config =
+      std::get_if<XdsConfig::ClusterConfig::AggregateConfig>(
+          &cluster_config.children);
+  if (aggregate_config == nullptr) return true;
+  for (absl::string_view leaf_cluster : aggregate_config->leaf_clusters) {
+    auto old_it = old_xds_config.clusters.find(leaf_cluster);
+    if (old_it == old_xds_config.clusters.end() || !old_it->second.ok()) {
+      return false;
+    }
+    auto new_it = new_xds_config.clusters.find(leaf_cluster);
+    if (new_it == new_xds_config.clusters.end() || !new_it->second.ok()) {
+      return false;
+    }
+    if (!(*old_it->second == *new_it->second)) return false;
+  }
+  return true;
+}
+
 absl::Status CdsLb::UpdateLocked(UpdateArgs args) {
   // Get new config.
   auto new_config = args.config.TakeAsSubclass<CdsLbConfig>();
@@ -342,12 +366,16 @@ absl::Status CdsLb::UpdateLocked(UpdateArgs args) {
     auto it_old = xds_config_->clusters.find(cluster_name_);
     if (it_old != xds_config_->clusters.end() && it_old->second.ok()) {
       old_cluster_config = &*it_old->second;
-      // If nothing changed for a leaf cluster, then ignore the update.
-      // Can't do this for an aggregate cluster, because even if the aggregate
-      // cluster itself didn't change, the leaf clusters may have changed.
+      // If nothing changed, then ignore the update, so that the child
+      // policy tree does not rebuild its endpoint lists.  For an aggregate
+      // cluster, this requires that none of its leaf clusters changed
+      // either.
       if (*new_cluster_config == *old_cluster_config &&
-          std::holds_alternative<XdsConfig::ClusterConfig::EndpointConfig>(
-              new_cluster_config->children)) {
+          LeafClustersUnchanged(*new_cluster_config, *xds_config_,
+                                *new_xds_config)) {
+        GRPC_TRACE_LOG(cds_lb, INFO)
+            << "[cdslb " << this << "] cluster " << cluster_name_
+            << " unchanged, ignoring update";
         return absl::OkStatus();
       }
     }
@@ -730,7 +758,7 @@ class CdsLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterCdsLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<CdsLbFactory>());
+      kCds, [] { return std::make_unique<CdsLbFactory>(); });
 }
 
 }  // namespace grpc_core
@@ -923,7 +923,8 @@ class XdsClusterImplLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterXdsClusterImplLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterImplLbFactory>());
+      kXdsClusterImpl,
+      [] { return std::make_unique<XdsClusterImplLbFactory>(); });
 }
 
 }  // namespace grpc_core
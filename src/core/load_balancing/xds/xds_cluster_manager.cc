@@ -605,7 +605,8 @@ class XdsClusterManagerLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterXdsClusterManagerLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterManagerLbFactory>());
+      kXdsClusterManager,
+      [] { return std::make_unique<XdsClusterManagerLbFactory>(); });
 }
 
 }  // namespace grpc_core
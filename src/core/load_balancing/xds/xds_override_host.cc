@@ -22,6 +22,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -35,6 +36,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/function_ref.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -74,6 +76,7 @@
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/match.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/rcu.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/ref_counted_string.h"
 #include "src/core/util/sync.h"
@@ -144,10 +147,7 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
       return subchannel_entry_->address_list();
     }
 
-    void set_last_used_time()
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
-      subchannel_entry_->set_last_used_time();
-    }
+    void set_last_used_time() { subchannel_entry_->set_last_used_time(); }
 
     XdsOverrideHostLb* policy() const { return policy_.get(); }
 
@@ -286,13 +286,12 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
       address_list_ = std::move(address_list);
     }
 
-    Timestamp last_used_time() const
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
-      return last_used_time_;
+    // Atomic, so that pickers can update it without holding the lock.
+    Timestamp last_used_time() const {
+      return last_used_time_.load(std::memory_order_relaxed);
     }
-    void set_last_used_time()
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
-      last_used_time_ = Timestamp::Now();
+    void set_last_used_time() {
+      last_used_time_.store(Timestamp::Now(), std::memory_order_relaxed);
     }
 
    private:
@@ -304,9 +303,20 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
         &XdsOverrideHostLb::mu_) = XdsHealthStatus(XdsHealthStatus::kUnknown);
     RefCountedStringValue address_list_
         ABSL_GUARDED_BY(&XdsOverrideHostLb::mu_);
-    Timestamp last_used_time_ ABSL_GUARDED_BY(&XdsOverrideHostLb::mu_) =
-        Timestamp::InfPast();
+    std::atomic<Timestamp> last_used_time_{Timestamp::InfPast()};
+  };
+
+  // A READY subchannel that a cookie can point to.  Published for the
+  // pickers, so that the common case of a cookie naming a READY host does
+  // not need to take mu_.
+  struct ReadyHost {
+    RefCountedPtr<SubchannelEntry> entry;
+    // The unwrapped subchannel, as returned by picks.
+    RefCountedPtr<SubchannelInterface> subchannel;
+    RefCountedStringValue address_list;
+    XdsHealthStatus eds_health_status;
   };
+  using ReadyHostMap = absl::flat_hash_map<std::string, ReadyHost>;
 
   // A picker that wraps the picker from the child for cases when cookie is
   // present.
@@ -400,6 +410,15 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
 
   void CleanupSubchannels();
 
+  // Must be called whenever the READY entries of subchannel_map_ may have
+  // changed.  ready_hosts_ is rebuilt once for each batch of changes: on the
+  // next WorkSerializer callback, or before a new picker is returned if that
+  // comes first, so that pickers never see READY hosts older than themselves.
+  void InvalidateReadyHostsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Republishes the READY entries of subchannel_map_ to ready_hosts_ if they
+  // may have changed since they were last published.
+  void MaybePublishReadyHosts() ABSL_LOCKS_EXCLUDED(mu_);
+
   // State from most recent resolver update.
   ChannelArgs args_;
   XdsHealthStatusSet override_host_status_set_;
@@ -417,6 +436,9 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
   Mutex mu_;
   std::map<std::string, RefCountedPtr<SubchannelEntry>, std::less<>>
       subchannel_map_ ABSL_GUARDED_BY(mu_);
+  // Read by pickers without a lock.  Published while holding mu_.
+  Rcu<std::shared_ptr<const ReadyHostMap>> ready_hosts_;
+  bool ready_hosts_stale_ ABSL_GUARDED_BY(mu_) = false;
 
   // Timer handle for periodic subchannel sweep.
   OrphanablePtr<IdleTimer> idle_timer_;
@@ -444,6 +466,30 @@ XdsOverrideHostLb::Picker::PickOverriddenHost(
   CHECK_NE(override_host_attr, nullptr);
   auto cookie_address_list = override_host_attr->cookie_address_list();
   if (cookie_address_list.empty()) return std::nullopt;
+  // Fast path: if the cookie names a READY host, pick it without taking the
+  // lock.  This returns the same host as the search below would.
+  auto ready_pick = policy_->ready_hosts_.Read(
+      [&](const std::shared_ptr<const ReadyHostMap>& ready_hosts)
+          -> std::optional<PickResult> {
+        if (ready_hosts == nullptr) return std::nullopt;
+        for (absl::string_view address :
+             absl::StrSplit(cookie_address_list, ',')) {
+          auto it = ready_hosts->find(address);
+          if (it == ready_hosts->end()) continue;
+          const ReadyHost& host = it->second;
+          if (!override_host_health_status_set_.Contains(
+                  host.eds_health_status)) {
+            continue;
+          }
+          GRPC_TRACE_LOG(xds_override_host_lb, INFO)
+              << "Picker override found READY subchannel " << address;
+          host.entry->set_last_used_time();
+          override_host_attr->set_actual_address_list(host.address_list);
+          return PickResult::Complete(host.subchannel);
+        }
+        return std::nullopt;
+      });
+  if (ready_pick.has_value()) return ready_pick;
   // The cookie has an address list, so look through the addresses in order.
   absl::string_view address_with_no_subchannel;
   RefCountedPtr<SubchannelWrapper> idle_subchannel;
@@ -629,7 +675,9 @@ void XdsOverrideHostLb::ResetState() {
       subchannel_entry->UnsetSubchannel(&subchannel_refs_to_drop);
     }
     subchannel_map_.clear();
+    InvalidateReadyHostsLocked();
   }
+  MaybePublishReadyHosts();
   // Cancel timer, if any.
   idle_timer_.reset();
   // Remove the child policy's interested_parties pollset_set from the
@@ -754,6 +802,7 @@ absl::Status XdsOverrideHostLb::UpdateLocked(UpdateArgs args) {
 
 void XdsOverrideHostLb::MaybeUpdatePickerLocked() {
   if (picker_ != nullptr) {
+    MaybePublishReadyHosts();
     auto xds_override_host_picker = MakeRefCounted<Picker>(
         RefAsSubclass<XdsOverrideHostLb>(), picker_, override_host_status_set_);
     GRPC_TRACE_LOG(xds_override_host_lb, INFO)
@@ -876,6 +925,7 @@ void XdsOverrideHostLb::UpdateAddressMap(
         next_time = std::min(next_time, next_time_for_entry);
       }
     }
+    InvalidateReadyHostsLocked();
   }
   idle_timer_ =
       MakeOrphanable<IdleTimer>(RefAsSubclass<XdsOverrideHostLb>(), next_time);
@@ -897,6 +947,7 @@ XdsOverrideHostLb::AdoptSubchannel(
     if (it != subchannel_map_.end()) {
       wrapper->set_subchannel_entry(it->second);
       subchannel_ref_to_drop = it->second->SetUnownedSubchannel(wrapper.get());
+      InvalidateReadyHostsLocked();
     }
   }
   return wrapper;
@@ -929,6 +980,7 @@ void XdsOverrideHostLb::CreateSubchannelForAddress(absl::string_view address) {
     if (it->second->HasOwnedSubchannel()) return;
     wrapper->set_subchannel_entry(it->second);
     it->second->SetOwnedSubchannel(std::move(wrapper));
+    InvalidateReadyHostsLocked();
   }
   MaybeUpdatePickerLocked();
 }
@@ -958,11 +1010,45 @@ void XdsOverrideHostLb::CleanupSubchannels() {
         next_time = std::min(next_time, next_time_for_entry);
       }
     }
+    if (!subchannel_refs_to_drop.empty()) {
+      InvalidateReadyHostsLocked();
+    }
   }
   idle_timer_ =
       MakeOrphanable<IdleTimer>(RefAsSubclass<XdsOverrideHostLb>(), next_time);
 }
 
+void XdsOverrideHostLb::InvalidateReadyHostsLocked() {
+  if (ready_hosts_stale_) return;
+  ready_hosts_stale_ = true;
+  // All changes are made in the WorkSerializer, so this runs once the
+  // callbacks already queued, which often carry more changes, are done.
+  work_serializer()->Run([self = RefAsSubclass<XdsOverrideHostLb>()]() {
+    self->MaybePublishReadyHosts();
+  });
+}
+
+void XdsOverrideHostLb::MaybePublishReadyHosts() {
+  // Drop the old map after releasing the lock.
+  std::shared_ptr<const ReadyHostMap> retired;
+  MutexLock lock(&mu_);
+  if (!ready_hosts_stale_) return;
+  ready_hosts_stale_ = false;
+  auto ready_hosts = std::make_shared<ReadyHostMap>();
+  for (const auto& [address, subchannel_entry] : subchannel_map_) {
+    if (subchannel_entry->connectivity_state() != GRPC_CHANNEL_READY) {
+      continue;
+    }
+    auto* subchannel = subchannel_entry->GetSubchannel();
+    if (subchannel == nullptr) continue;
+    ready_hosts->emplace(
+        address, ReadyHost{subchannel_entry, subchannel->wrapped_subchannel(),
+                           subchannel_entry->address_list(),
+                           subchannel_entry->eds_health_status()});
+  }
+  retired = ready_hosts_.Exchange(std::move(ready_hosts));
+}
+
 //
 // XdsOverrideHostLb::Helper
 //
@@ -1032,6 +1118,7 @@ void XdsOverrideHostLb::SubchannelWrapper::Orphaned() {
           MutexLock lock(&self->policy()->mu_);
           self->subchannel_entry_->OnSubchannelWrapperOrphan(
               self.get(), self->policy()->connection_idle_timeout_);
+          self->policy()->InvalidateReadyHostsLocked();
         }
       });
 }
@@ -1045,6 +1132,7 @@ void XdsOverrideHostLb::SubchannelWrapper::UpdateConnectivityState(
       subchannel_entry_->set_connectivity_state(state);
       update_picker = subchannel_entry_->HasOwnedSubchannel() &&
                       subchannel_entry_->GetSubchannel() == this;
+      policy()->InvalidateReadyHostsLocked();
     }
   }
   // Sending connectivity state notifications to the watchers may cause the set
@@ -1122,7 +1210,7 @@ void XdsOverrideHostLb::SubchannelEntry::OnSubchannelWrapperOrphan(
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
   auto* subchannel = GetSubchannel();
   if (subchannel != wrapper) return;
-  if (last_used_time_ < (Timestamp::Now() - connection_idle_timeout)) {
+  if (last_used_time() < (Timestamp::Now() - connection_idle_timeout)) {
     GRPC_TRACE_LOG(xds_override_host_lb, INFO)
         << "[xds_override_host_lb] removing unowned subchannel "
            "wrapper "
@@ -1167,7 +1255,8 @@ class XdsOverrideHostLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterXdsOverrideHostLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsOverrideHostLbFactory>());
+      XdsOverrideHostLbConfig::Name(),
+      [] { return std::make_unique<XdsOverrideHostLbFactory>(); });
 }
 
 //
@@ -282,7 +282,8 @@ class XdsWrrLocalityLbFactory final : public LoadBalancingPolicyFactory {
 
 void RegisterXdsWrrLocalityLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsWrrLocalityLbFactory>());
+      kXdsWrrLocality,
+      [] { return std::make_unique<XdsWrrLocalityLbFactory>(); });
 }
 
 }  // namespace grpc_core
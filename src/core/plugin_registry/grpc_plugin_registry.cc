@@ -22,6 +22,7 @@
 #include "src/core/config/core_configuration.h"
 #include "src/core/handshaker/endpoint_info/endpoint_info_handshaker.h"
 #include "src/core/handshaker/http_connect/http_connect_handshaker.h"
+#include "src/core/handshaker/shm/shm_handshaker.h"
 #include "src/core/handshaker/tcp_connect/tcp_connect_handshaker.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/surface/lame_client.h"
@@ -47,6 +48,8 @@ extern void RegisterLegacyChannelIdleFilters(
 extern void RegisterGrpcLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterHttpFilters(CoreConfiguration::Builder* builder);
 extern void RegisterMessageSizeFilter(CoreConfiguration::Builder* builder);
+extern void RegisterMethodAdmissionFilter(
+    CoreConfiguration::Builder* builder);
 extern void RegisterSecurityFilters(CoreConfiguration::Builder* builder);
 extern void RegisterServiceConfigChannelArgFilter(
     CoreConfiguration::Builder* builder);
@@ -63,6 +66,9 @@ extern void RegisterOutlierDetectionLbPolicy(
 extern void RegisterWeightedTargetLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterPickFirstLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterRoundRobinLbPolicy(CoreConfiguration::Builder* builder);
+extern void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder);
+extern void RegisterLocalityAwareLbPolicy(CoreConfiguration::Builder* builder);
+extern void RegisterPeakEwmaLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterWeightedRoundRobinLbPolicy(
     CoreConfiguration::Builder* builder);
 extern void RegisterHttpProxyMapper(CoreConfiguration::Builder* builder);
@@ -96,12 +102,16 @@ void BuildCoreConfiguration(CoreConfiguration::Builder* builder) {
   // to the start of the handshaker list.
   RegisterEndpointInfoHandshaker(builder);
   RegisterHttpConnectHandshaker(builder);
+  RegisterShmHandshaker(builder);
   RegisterTCPConnectHandshaker(builder);
   RegisterPriorityLbPolicy(builder);
   RegisterOutlierDetectionLbPolicy(builder);
   RegisterWeightedTargetLbPolicy(builder);
   RegisterPickFirstLbPolicy(builder);
   RegisterRoundRobinLbPolicy(builder);
+  RegisterLeastRequestLbPolicy(builder);
+  RegisterLocalityAwareLbPolicy(builder);
+  RegisterPeakEwmaLbPolicy(builder);
   RegisterWeightedRoundRobinLbPolicy(builder);
   BuildClientChannelConfiguration(builder);
   SecurityRegisterHandshakerFactories(builder);
@@ -111,6 +121,7 @@ void BuildCoreConfiguration(CoreConfiguration::Builder* builder) {
   RegisterGrpcLbPolicy(builder);
   RegisterHttpFilters(builder);
   RegisterMessageSizeFilter(builder);
+  RegisterMethodAdmissionFilter(builder);
   RegisterServiceConfigChannelArgFilter(builder);
   RegisterResourceQuota(builder);
   FaultInjectionFilterRegister(builder);
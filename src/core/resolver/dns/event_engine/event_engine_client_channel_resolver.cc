@@ -42,6 +42,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/load_balancing/grpclb/grpclb_balancer_addresses.h"
+#include "src/core/resolver/dns/event_engine/hostname_cache.h"
 #include "src/core/resolver/dns/event_engine/service_config_helper.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/resolver/polling_resolver.h"
@@ -157,9 +158,36 @@ class EventEngineClientChannelDNSResolver final : public PollingResolver {
   const bool enable_srv_queries_;
   // timeout in milliseconds for active DNS queries
   EventEngine::Duration query_timeout_ms_;
+  // set if hostname lookups go through the process-wide HostnameCache
+  std::optional<HostnameCache::Options> hostname_cache_options_;
   std::shared_ptr<EventEngine> event_engine_;
 };
 
+std::optional<HostnameCache::Options> HostnameCacheOptionsFromChannelArgs(
+    const ChannelArgs& args) {
+  const Duration ttl =
+      args.GetDurationFromIntMillis(GRPC_ARG_EXPERIMENTAL_DNS_CACHE_TTL_MS)
+          .value_or(Duration::Zero());
+  if (ttl <= Duration::Zero()) return std::nullopt;
+  HostnameCache::Options options;
+  options.ttl = ttl;
+  options.max_stale =
+      std::max(Duration::Zero(),
+               args.GetDurationFromIntMillis(
+                       GRPC_ARG_EXPERIMENTAL_DNS_CACHE_MAX_STALE_MS)
+                   .value_or(ttl));
+  // Other channels may be waiting on the same query, so it is always bounded,
+  // even when this channel disables its own query timeout.
+  options.query_timeout =
+      args.GetDurationFromIntMillis(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
+          .value_or(Duration::Zero());
+  if (options.query_timeout <= Duration::Zero()) {
+    options.query_timeout =
+        Duration::Milliseconds(GRPC_DNS_DEFAULT_QUERY_TIMEOUT_MS);
+  }
+  return options;
+}
+
 EventEngineClientChannelDNSResolver::EventEngineClientChannelDNSResolver(
     ResolverArgs args, Duration min_time_between_resolutions)
     : PollingResolver(std::move(args), min_time_between_resolutions,
@@ -183,6 +211,8 @@ EventEngineClientChannelDNSResolver::EventEngineClientChannelDNSResolver(
           std::max(0, channel_args()
                           .GetInt(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
                           .value_or(GRPC_DNS_DEFAULT_QUERY_TIMEOUT_MS)))),
+      hostname_cache_options_(
+          HostnameCacheOptionsFromChannelArgs(channel_args())),
       event_engine_(channel_args().GetObjectRef<EventEngine>()) {}
 
 OrphanablePtr<Orphanable> EventEngineClientChannelDNSResolver::StartRequest() {
@@ -218,15 +248,27 @@ EventEngineClientChannelDNSResolver::EventEngineDNSRequestWrapper::
       << resolver_.get() << " Starting hostname resolution for "
       << resolver_->name_to_resolve();
   is_hostname_inflight_ = true;
-  event_engine_resolver_->LookupHostname(
+  auto on_hostname_resolved =
       [self = Ref(DEBUG_LOCATION, "OnHostnameResolved")](
           absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
               addresses) mutable {
         ExecCtx exec_ctx;
         self->OnHostnameResolved(std::move(addresses));
         self.reset();
-      },
-      resolver_->name_to_resolve(), kDefaultSecurePort);
+      };
+  if (resolver_->hostname_cache_options_.has_value()) {
+    // The query is shared with other channels, so it is not cancelled by
+    // this request timing out or being orphaned; the result is then dropped
+    // by OnHostnameResolved().
+    HostnameCache::Get()->LookupHostname(
+        resolver_->event_engine_, resolver_->authority(),
+        resolver_->name_to_resolve(), kDefaultSecurePort,
+        *resolver_->hostname_cache_options_, std::move(on_hostname_resolved));
+  } else {
+    event_engine_resolver_->LookupHostname(std::move(on_hostname_resolved),
+                                           resolver_->name_to_resolve(),
+                                           kDefaultSecurePort);
+  }
   if (resolver_->enable_srv_queries_) {
     GRPC_TRACE_VLOG(event_engine_client_channel_resolver, 2)
         << "(event_engine client channel resolver) DNSResolver::"
@@ -0,0 +1,180 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/resolver/dns/event_engine/hostname_cache.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "absl/status/status.h"
+
+namespace grpc_core {
+
+namespace {
+using grpc_event_engine::experimental::EventEngine;
+
+// How often to look for entries that can be dropped.
+constexpr Duration kSweepInterval = Duration::Minutes(1);
+}  // namespace
+
+HostnameCache* HostnameCache::Get() {
+  static HostnameCache* cache = new HostnameCache();
+  return cache;
+}
+
+void HostnameCache::LookupHostname(std::shared_ptr<EventEngine> event_engine,
+                                   absl::string_view dns_server,
+                                   absl::string_view name,
+                                   absl::string_view default_port,
+                                   const Options& options,
+                                   Callback on_resolve) {
+  Key key(dns_server, name, default_port);
+  const Timestamp now = Timestamp::Now();
+  std::optional<ResolvedAddresses> cached;
+  std::shared_ptr<EventEngine::DNSResolver> resolver;
+  uint64_t query_id = 0;
+  {
+    MutexLock lock(&mu_);
+    MaybeSweepLocked(now);
+    Entry& entry = entries_[key];
+    const bool fresh = entry.addresses.has_value() &&
+                       now < entry.resolved_at + options.ttl;
+    if (entry.addresses.has_value() &&
+        now < entry.resolved_at + options.ttl + options.max_stale) {
+      cached = *entry.addresses;
+    } else {
+      entry.waiters.push_back(std::move(on_resolve));
+    }
+    if (!fresh) {
+      resolver = MaybeStartQueryLocked(key, entry, options, event_engine);
+      query_id = entry.query_id;
+    }
+  }
+  if (cached.has_value()) {
+    event_engine->Run([on_resolve = std::move(on_resolve),
+                       addresses = std::move(*cached)]() mutable {
+      on_resolve(std::move(addresses));
+    });
+  }
+  if (resolver != nullptr) {
+    resolver->LookupHostname(
+        [this, key = std::move(key), query_id, options, event_engine](
+            absl::StatusOr<ResolvedAddresses> addresses) mutable {
+          OnQueryDone(key, query_id, options, std::move(event_engine),
+                      std::move(addresses));
+        },
+        name, default_port);
+  }
+}
+
+std::shared_ptr<EventEngine::DNSResolver> HostnameCache::MaybeStartQueryLocked(
+    const Key& key, Entry& entry, const Options& options,
+    const std::shared_ptr<EventEngine>& event_engine) {
+  if (entry.resolver != nullptr) return nullptr;
+  auto resolver = event_engine->GetDNSResolver({std::get<0>(key)});
+  if (!resolver.ok()) {
+    for (Callback& waiter : entry.waiters) {
+      event_engine->Run(
+          [waiter = std::move(waiter), status = resolver.status()]() mutable {
+            waiter(status);
+          });
+    }
+    entry.waiters.clear();
+    return nullptr;
+  }
+  entry.resolver = std::move(*resolver);
+  entry.query_id = next_query_id_++;
+  entry.query_timer = event_engine->RunAfter(
+      options.query_timeout, [this, key, query_id = entry.query_id]() {
+        OnQueryTimeout(key, query_id);
+      });
+  return entry.resolver;
+}
+
+void HostnameCache::OnQueryDone(const Key& key, uint64_t query_id,
+                                const Options& options,
+                                std::shared_ptr<EventEngine> event_engine,
+                                absl::StatusOr<ResolvedAddresses> addresses) {
+  std::shared_ptr<EventEngine::DNSResolver> resolver;
+  std::vector<Callback> waiters;
+  {
+    MutexLock lock(&mu_);
+    auto it = entries_.find(key);
+    // The query timed out, and its waiters have already been failed.
+    if (it == entries_.end() || it->second.resolver == nullptr ||
+        it->second.query_id != query_id) {
+      return;
+    }
+    Entry& entry = it->second;
+    resolver = std::move(entry.resolver);
+    waiters.swap(entry.waiters);
+    if (entry.query_timer.has_value()) {
+      event_engine->Cancel(*entry.query_timer);
+      entry.query_timer.reset();
+    }
+    if (addresses.ok()) {
+      const Timestamp now = Timestamp::Now();
+      entry.addresses = *addresses;
+      entry.resolved_at = now;
+      entry.expires_at = now + options.ttl + options.max_stale;
+    }
+  }
+  // We are running in the resolver's callback, so it must outlive us.
+  event_engine->Run([resolver = std::move(resolver)]() {});
+  for (Callback& waiter : waiters) waiter(addresses);
+}
+
+void HostnameCache::OnQueryTimeout(const Key& key, uint64_t query_id) {
+  std::shared_ptr<EventEngine::DNSResolver> resolver;
+  std::vector<Callback> waiters;
+  {
+    MutexLock lock(&mu_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.resolver == nullptr ||
+        it->second.query_id != query_id) {
+      return;
+    }
+    Entry& entry = it->second;
+    // Dropping the resolver cancels the query, and frees the key for the
+    // next lookup to query again.
+    resolver = std::move(entry.resolver);
+    waiters.swap(entry.waiters);
+    entry.query_timer.reset();
+  }
+  resolver.reset();
+  const absl::Status status =
+      absl::DeadlineExceededError("hostname lookup timed out");
+  for (Callback& waiter : waiters) waiter(status);
+}
+
+void HostnameCache::MaybeSweepLocked(Timestamp now) {
+  if (now < next_sweep_) return;
+  next_sweep_ = now + kSweepInterval;
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    const Entry& entry = it->second;
+    if (entry.resolver == nullptr && entry.expires_at <= now) {
+      entries_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+size_t HostnameCache::TestOnlySize() {
+  MutexLock lock(&mu_);
+  return entries_.size();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,132 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_HOSTNAME_CACHE_H
+#define GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_HOSTNAME_CACHE_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// A cache of hostname lookups that can be shared by every channel in the
+// process, so that many channels to the same target do not each query DNS.
+//
+// - Identical lookups that are in flight at the same time share one query.
+// - A result is fresh for the TTL given by the caller.  Once it is stale,
+//   it is still returned for up to max_stale, while a query to refresh it
+//   runs in the background.
+// - Failures are not cached.  A failed refresh leaves the stale result in
+//   place until it is too old to use.
+// - A query that takes longer than its timeout is abandoned, and every
+//   lookup waiting on it fails with DEADLINE_EXCEEDED.
+class HostnameCache {
+ public:
+  using ResolvedAddresses =
+      std::vector<grpc_event_engine::experimental::EventEngine::ResolvedAddress>;
+  using Callback =
+      absl::AnyInvocable<void(absl::StatusOr<ResolvedAddresses>)>;
+
+  struct Options {
+    Duration ttl;
+    Duration max_stale;
+    // How long the lookup that starts a query lets it run.
+    Duration query_timeout;
+  };
+
+  // The cache shared by all channels.
+  static HostnameCache* Get();
+
+  HostnameCache() = default;
+
+  HostnameCache(const HostnameCache&) = delete;
+  HostnameCache& operator=(const HostnameCache&) = delete;
+
+  // Looks up name with the DNS server dns_server (the system's default if
+  // empty), as EventEngine::DNSResolver::LookupHostname() would.
+  // on_resolve is always called asynchronously, on event_engine.
+  void LookupHostname(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine,
+      absl::string_view dns_server, absl::string_view name,
+      absl::string_view default_port, const Options& options,
+      Callback on_resolve);
+
+  size_t TestOnlySize();
+
+ private:
+  // dns_server, name, default_port.
+  using Key = std::tuple<std::string, std::string, std::string>;
+
+  struct Entry {
+    std::optional<ResolvedAddresses> addresses;
+    Timestamp resolved_at;
+    // When the entry may be dropped, according to the options of the
+    // lookup that filled it in.
+    Timestamp expires_at;
+    // Set while a query is in flight.
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine::DNSResolver>
+        resolver;
+    // Identifies the query in flight, so that a query that timed out cannot
+    // complete the one started after it.
+    uint64_t query_id = 0;
+    std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+        query_timer;
+    std::vector<Callback> waiters;
+  };
+
+  // Starts a query for key, if there is not one in flight already.
+  // Returns the resolver to query with, which the caller must use once mu_
+  // has been released.
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine::DNSResolver>
+  MaybeStartQueryLocked(
+      const Key& key, Entry& entry, const Options& options,
+      const std::shared_ptr<grpc_event_engine::experimental::EventEngine>&
+          event_engine) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  void OnQueryDone(
+      const Key& key, uint64_t query_id, const Options& options,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine,
+      absl::StatusOr<ResolvedAddresses> addresses);
+
+  void OnQueryTimeout(const Key& key, uint64_t query_id);
+
+  // Drops entries that have expired and have no query in flight.
+  void MaybeSweepLocked(Timestamp now) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  Mutex mu_;
+  absl::flat_hash_map<Key, Entry> entries_ ABSL_GUARDED_BY(mu_);
+  Timestamp next_sweep_ ABSL_GUARDED_BY(mu_) = Timestamp::InfPast();
+  uint64_t next_query_id_ ABSL_GUARDED_BY(mu_) = 1;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_HOSTNAME_CACHE_H
@@ -39,6 +39,10 @@
 // A channel arg indicating the weight of an address.
 #define GRPC_ARG_ADDRESS_WEIGHT GRPC_ARG_NO_SUBCHANNEL_PREFIX "address.weight"
 
+// A channel arg indicating the zone an address is in, for resolvers that
+// know it.  Used by the locality_aware LB policy.
+#define GRPC_ARG_ADDRESS_ZONE GRPC_ARG_NO_SUBCHANNEL_PREFIX "address.zone"
+
 // Name associated with individual address, if available (e.g., DNS name).
 #define GRPC_ARG_ADDRESS_NAME "grpc.address_name"
 
@@ -28,6 +28,12 @@
 
 namespace grpc_core {
 
+namespace {
+// Bound on ResolverRegistry's lookup cache. It is emptied when full, which
+// only happens in processes that see an unusual number of distinct targets.
+constexpr size_t kMaxLookupCacheEntries = 1024;
+}  // namespace
+
 //
 // ResolverRegistry::Builder
 //
@@ -126,13 +132,42 @@ ResolverFactory* ResolverRegistry::LookupResolverFactory(
   return it->second.get();
 }
 
+size_t ResolverRegistry::TestOnlyLookupCacheSize() const {
+  MutexLock lock(&lookup_cache_->mu);
+  return lookup_cache_->entries.size();
+}
+
+ResolverFactory* ResolverRegistry::FindResolverFactory(
+    absl::string_view target, URI* uri, std::string* canonical_target) const {
+  CHECK_NE(uri, nullptr);
+  {
+    MutexLock lock(&lookup_cache_->mu);
+    auto it = lookup_cache_->entries.find(target);
+    if (it != lookup_cache_->entries.end()) {
+      *uri = it->second.uri;
+      *canonical_target = it->second.canonical_target;
+      return it->second.factory;
+    }
+  }
+  ResolverFactory* factory =
+      FindResolverFactoryUncached(target, uri, canonical_target);
+  if (factory != nullptr) {
+    MutexLock lock(&lookup_cache_->mu);
+    if (lookup_cache_->entries.size() >= kMaxLookupCacheEntries) {
+      lookup_cache_->entries.clear();
+    }
+    lookup_cache_->entries.emplace(
+        target, FactoryLookup{factory, *uri, *canonical_target});
+  }
+  return factory;
+}
+
 // Returns the factory for the scheme of \a target.  If \a target does
 // not parse as a URI, prepends \a default_prefix_ and tries again.
 // If URI parsing is successful (in either attempt), sets \a uri to
 // point to the parsed URI.
-ResolverFactory* ResolverRegistry::FindResolverFactory(
+ResolverFactory* ResolverRegistry::FindResolverFactoryUncached(
     absl::string_view target, URI* uri, std::string* canonical_target) const {
-  CHECK_NE(uri, nullptr);
   absl::StatusOr<URI> tmp_uri = URI::Parse(target);
   ResolverFactory* factory =
       tmp_uri.ok() ? LookupResolverFactory(tmp_uri->scheme()) : nullptr;
@@ -24,12 +24,15 @@
 #include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/resolver/resolver.h"
 #include "src/core/resolver/resolver_factory.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/uri.h"
 
 namespace grpc_core {
@@ -106,6 +109,9 @@ class ResolverRegistry final {
   /// Caller does NOT own the return value.
   ResolverFactory* LookupResolverFactory(absl::string_view scheme) const;
 
+  /// Returns the number of targets whose lookups are cached.
+  size_t TestOnlyLookupCacheSize() const;
+
  private:
   explicit ResolverRegistry(State state) : state_(std::move(state)) {}
 
@@ -113,8 +119,25 @@ class ResolverRegistry final {
   // removed, and replaced with uri.ToString().
   ResolverFactory* FindResolverFactory(absl::string_view target, URI* uri,
                                        std::string* canonical_target) const;
+  ResolverFactory* FindResolverFactoryUncached(
+      absl::string_view target, URI* uri, std::string* canonical_target) const;
+
+  // Successful FindResolverFactory() results by target. Creating a channel
+  // looks its target up several times, and processes tend to create many
+  // channels to the same few targets.
+  struct FactoryLookup {
+    ResolverFactory* factory;
+    URI uri;
+    std::string canonical_target;
+  };
+  struct LookupCache {
+    Mutex mu;
+    absl::flat_hash_map<std::string, FactoryLookup> entries
+        ABSL_GUARDED_BY(mu);
+  };
 
   State state_;
+  std::unique_ptr<LookupCache> lookup_cache_ = std::make_unique<LookupCache>();
 };
 
 }  // namespace grpc_core
@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
@@ -73,7 +74,8 @@ void SockaddrResolver::StartLocked() {
 
 bool ParseUri(const URI& uri,
               bool parse(const URI& uri, grpc_resolved_address* dst),
-              EndpointAddressesList* addresses) {
+              EndpointAddressesList* addresses,
+              const ChannelArgs& address_args = ChannelArgs()) {
   if (!uri.authority().empty()) {
     LOG(ERROR) << "authority-based URIs not supported by the " << uri.scheme()
                << " scheme";
@@ -93,16 +95,17 @@ bool ParseUri(const URI& uri,
       break;
     }
     if (addresses != nullptr) {
-      addresses->emplace_back(addr, ChannelArgs());
+      addresses->emplace_back(addr, address_args);
     }
   }
   return !errors_found;
 }
 
 OrphanablePtr<Resolver> CreateSockaddrResolver(
-    ResolverArgs args, bool parse(const URI& uri, grpc_resolved_address* dst)) {
+    ResolverArgs args, bool parse(const URI& uri, grpc_resolved_address* dst),
+    const ChannelArgs& address_args = ChannelArgs()) {
   EndpointAddressesList addresses;
-  if (!ParseUri(args.uri, parse, &addresses)) return nullptr;
+  if (!ParseUri(args.uri, parse, &addresses, address_args)) return nullptr;
   // Instantiate resolver.
   return MakeOrphanable<SockaddrResolver>(std::move(addresses),
                                           std::move(args));
@@ -160,6 +163,28 @@ class UnixAbstractResolverFactory final : public ResolverFactory {
     return CreateSockaddrResolver(std::move(args), grpc_parse_unix_abstract);
   }
 };
+
+// Unix domain socket addresses whose connections move their bytes over shared
+// memory rings. See GRPC_ARG_SHM_TRANSPORT.
+bool ParseShm(const URI& uri, grpc_resolved_address* dst) {
+  auto unix_uri = URI::Create("unix", "", uri.path(), {}, "");
+  return unix_uri.ok() && grpc_parse_unix(*unix_uri, dst);
+}
+
+class ShmResolverFactory final : public ResolverFactory {
+ public:
+  absl::string_view scheme() const override { return "shm"; }
+
+  bool IsValidUri(const URI& uri) const override {
+    return ParseUri(uri, ParseShm, nullptr);
+  }
+
+  OrphanablePtr<Resolver> CreateResolver(ResolverArgs args) const override {
+    return CreateSockaddrResolver(
+        std::move(args), ParseShm,
+        ChannelArgs().Set(GRPC_ARG_SHM_TRANSPORT, true));
+  }
+};
 #endif  // GRPC_HAVE_UNIX_SOCKET
 
 #ifdef GRPC_HAVE_VSOCK
@@ -190,6 +215,8 @@ void RegisterSockaddrResolver(CoreConfiguration::Builder* builder) {
       std::make_unique<UnixResolverFactory>());
   builder->resolver_registry()->RegisterResolverFactory(
       std::make_unique<UnixAbstractResolverFactory>());
+  builder->resolver_registry()->RegisterResolverFactory(
+      std::make_unique<ShmResolverFactory>());
 #endif
 #ifdef GRPC_HAVE_VSOCK
   builder->resolver_registry()->RegisterResolverFactory(
@@ -251,6 +251,7 @@ class XdsResolver final : public Resolver {
 
     std::map<absl::string_view, RefCountedPtr<ClusterRef>> clusters_;
     std::vector<RouteEntry> routes_;
+    XdsRouting::RouteTable route_table_;
   };
 
   class XdsConfigSelector final : public ConfigSelector {
@@ -369,6 +370,10 @@ class XdsResolver final : public Resolver {
 
   OrphanablePtr<XdsDependencyManager> dependency_mgr_;
   RefCountedPtr<const XdsConfig> current_config_;
+  // The HTTP filters of current_config_ that are not no-ops for all of its
+  // routes. Only these are added to the filter stack.
+  std::vector<XdsListenerResource::HttpConnectionManager::HttpFilter>
+      http_filters_;
   std::map<absl::string_view, WeakRefCountedPtr<ClusterRef>> cluster_ref_map_;
 };
 
@@ -416,14 +421,15 @@ XdsResolver::RouteConfigData::Create(
       return status;
     }
   }
+  data->route_table_ = XdsRouting::RouteTable(RouteListIterator(data.get()));
   return data;
 }
 
 XdsResolver::RouteConfigData::RouteEntry*
 XdsResolver::RouteConfigData::GetRouteForRequest(
     absl::string_view path, grpc_metadata_batch* initial_metadata) {
-  auto route_index = XdsRouting::GetRouteForRequest(RouteListIterator(this),
-                                                    path, initial_metadata);
+  auto route_index = route_table_.GetRouteForRequest(RouteListIterator(this),
+                                                     path, initial_metadata);
   if (!route_index.has_value()) {
     return nullptr;
   }
@@ -483,13 +489,11 @@ XdsResolver::RouteConfigData::CreateMethodConfig(
                         route_action.max_stream_duration->ToJsonString()));
   }
   // Handle xDS HTTP filters.
-  const auto& hcm = std::get<XdsListenerResource::HttpConnectionManager>(
-      resolver->current_config_->listener->listener);
   auto result = XdsRouting::GeneratePerHTTPFilterConfigsForMethodConfig(
       DownCast<const GrpcXdsBootstrap&>(resolver->xds_client_->bootstrap())
           .http_filter_registry(),
-      hcm.http_filters, *resolver->current_config_->virtual_host, route,
-      cluster_weight, resolver->args_);
+      resolver->http_filters_, *resolver->current_config_->virtual_host,
+      route, cluster_weight, resolver->args_);
   if (!result.ok()) return result.status();
   for (const auto& [name, config] : result->per_filter_configs) {
     fields.emplace_back(absl::StrCat("    \"", name, "\": [\n",
@@ -612,9 +616,7 @@ XdsResolver::XdsConfigSelector::XdsConfigSelector(
   const auto& http_filter_registry =
       static_cast<const GrpcXdsBootstrap&>(resolver_->xds_client_->bootstrap())
           .http_filter_registry();
-  const auto& hcm = std::get<XdsListenerResource::HttpConnectionManager>(
-      resolver_->current_config_->listener->listener);
-  for (const auto& http_filter : hcm.http_filters) {
+  for (const auto& http_filter : resolver_->http_filters_) {
     // Find filter.  This is guaranteed to succeed, because it's checked
     // at config validation time in the XdsApi code.
     const XdsHttpFilterImpl* filter_impl =
@@ -957,6 +959,13 @@ void XdsResolver::OnUpdate(
     return;
   }
   current_config_ = std::move(*config);
+  http_filters_ = XdsRouting::ActiveHttpFilters(
+      static_cast<const GrpcXdsBootstrap&>(xds_client_->bootstrap())
+          .http_filter_registry(),
+      std::get<XdsListenerResource::HttpConnectionManager>(
+          current_config_->listener->listener)
+          .http_filters,
+      *current_config_->virtual_host);
   GenerateResult();
 }
 
@@ -995,13 +1004,11 @@ XdsResolver::CreateServiceConfig() {
                    "    }\n"
                    "    } }\n"
                    "  ]"));
-  auto& hcm = std::get<XdsListenerResource::HttpConnectionManager>(
-      current_config_->listener->listener);
   auto filter_configs =
       XdsRouting::GeneratePerHTTPFilterConfigsForServiceConfig(
           static_cast<const GrpcXdsBootstrap&>(xds_client_->bootstrap())
               .http_filter_registry(),
-          hcm.http_filters, args_);
+          http_filters_, args_);
   if (!filter_configs.ok()) return filter_configs.status();
   for (const auto& [name, config] : filter_configs->per_filter_configs) {
     config_parts.emplace_back(absl::StrCat(
@@ -44,6 +44,7 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "src/core/channelz/channel_trace.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/config/core_configuration.h"
@@ -135,6 +136,16 @@ Server::ListenerState::ListenerState(RefCountedPtr<Server> server,
     connection_quota_->SetMaxIncomingConnections(
         max_allowed_incoming_connections.value());
   }
+  auto cpu_utilization_source =
+      server_->channel_args().GetObjectRef<CpuUtilizationSource>();
+  auto max_cpu_utilization_percent = server_->channel_args().GetInt(
+      GRPC_ARG_MAX_CPU_UTILIZATION_FOR_INCOMING_CONNECTIONS_PERCENT);
+  if (cpu_utilization_source != nullptr &&
+      max_cpu_utilization_percent.has_value()) {
+    connection_quota_->SetMaxCpuUtilization(
+        std::move(cpu_utilization_source),
+        *max_cpu_utilization_percent / 100.0);
+  }
 }
 
 void Server::ListenerState::Start() {
@@ -284,23 +295,94 @@ void Server::ListenerState::DrainConnectionsLocked() {
   if (connections_.empty()) {
     return;
   }
-  // Send GOAWAYs on the transports so that they disconnect when existing
-  // RPCs finish.
-  for (auto& connection : connections_) {
-    connection->SendGoAway();
-  }
+  const Duration stagger_window = std::max(
+      Duration::Zero(), server_->channel_args()
+                            .GetDurationFromIntMillis(
+                                GRPC_ARG_SERVER_DRAIN_GOAWAY_STAGGER_WINDOW_MS)
+                            .value_or(Duration::Zero()));
+  const Timestamp now = Timestamp::Now();
   connections_to_be_drained_list_.emplace_back();
   auto& connections_to_be_drained = connections_to_be_drained_list_.back();
+  if (stagger_window == Duration::Zero()) {
+    // Send GOAWAYs on the transports so that they disconnect when existing
+    // RPCs finish.
+    for (auto& connection : connections_) {
+      connection->SendGoAway();
+    }
+  } else {
+    // Spread the GOAWAYs out, so that the clients do not all reconnect
+    // elsewhere at once. The connections keep serving until theirs is sent.
+    for (auto& connection : connections_) {
+      connections_to_be_drained.pending_goaways.push_back(connection.get());
+    }
+    connections_to_be_drained.next_goaway = now;
+    connections_to_be_drained.goaway_interval =
+        stagger_window / connections_.size();
+    channelz::ServerNode* channelz_node = server_->channelz_node();
+    if (channelz_node != nullptr) {
+      channelz_node->AddTraceEvent(
+          channelz::ChannelTrace::Severity::Info,
+          grpc_slice_from_cpp_string(absl::StrCat(
+              "Draining ", connections_.size(), " connections, one every ",
+              connections_to_be_drained.goaway_interval.ToString())));
+    }
+  }
   connections_to_be_drained.connections = std::move(connections_);
   connections_.clear();
+  // The last connections to be sent a GOAWAY get the full grace period too.
   connections_to_be_drained.timestamp =
-      Timestamp::Now() +
+      now + stagger_window +
       std::max(Duration::Zero(),
                server_->channel_args()
                    .GetDurationFromIntMillis(
                        GRPC_ARG_SERVER_CONFIG_CHANGE_DRAIN_GRACE_TIME_MS)
                    .value_or(Duration::Minutes(10)));
   MaybeStartNewGraceTimerLocked();
+  if (stagger_window != Duration::Zero()) {
+    // If the timer for an older drain has already fired, it will send this
+    // drain's GOAWAYs too.
+    if (goaway_timer_handle_.has_value() &&
+        event_engine()->Cancel(*goaway_timer_handle_)) {
+      goaway_timer_handle_.reset();
+    }
+    if (!goaway_timer_handle_.has_value()) SendDueGoAwaysLocked();
+  }
+}
+
+void Server::ListenerState::SendDueGoAwaysLocked() {
+  const Timestamp now = Timestamp::Now();
+  std::optional<Timestamp> next_goaway;
+  for (auto& connections_to_be_drained : connections_to_be_drained_list_) {
+    auto& pending_goaways = connections_to_be_drained.pending_goaways;
+    while (!pending_goaways.empty() &&
+           connections_to_be_drained.next_goaway <= now) {
+      ListenerInterface::LogicalConnection* connection =
+          pending_goaways.front();
+      pending_goaways.pop_front();
+      if (connections_to_be_drained.connections.contains(connection)) {
+        connection->SendGoAway();
+      }
+      connections_to_be_drained.next_goaway +=
+          connections_to_be_drained.goaway_interval;
+    }
+    if (!pending_goaways.empty() &&
+        (!next_goaway.has_value() ||
+         connections_to_be_drained.next_goaway < *next_goaway)) {
+      next_goaway = connections_to_be_drained.next_goaway;
+    }
+  }
+  if (!next_goaway.has_value()) return;
+  goaway_timer_handle_ =
+      event_engine()->RunAfter(*next_goaway - now, [self = Ref()]() mutable {
+        ExecCtx exec_ctx;
+        {
+          MutexLock lock(&self->mu_);
+          self->goaway_timer_handle_.reset();
+          self->SendDueGoAwaysLocked();
+        }
+        // resetting within an active ExecCtx
+        self.reset();
+      });
 }
 
 void Server::ListenerState::OnDrainGraceTimer() {
@@ -563,6 +645,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     }
     CHECK(pending_filter_stack_.empty());
     CHECK(pending_promises_.empty());
+    CHECK_EQ(num_pending_calls_.load(std::memory_order_relaxed), 0u);
   }
 
   void ZombifyPending() override {
@@ -570,11 +653,11 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       pending_filter_stack_.front().calld->SetState(
           CallData::CallState::ZOMBIED);
       pending_filter_stack_.front().calld->KillZombie();
-      pending_filter_stack_.pop();
+      PopPendingFilterStack();
     }
     while (!pending_promises_.empty()) {
       pending_promises_.front()->Finish(absl::InternalError("Server closed"));
-      pending_promises_.pop();
+      PopPendingPromise();
     }
     zombified_ = true;
   }
@@ -597,7 +680,11 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
       // this was the first queued request: we need to lock and start
-      // matching calls
+      // matching calls, unless there are none pending.  The fence pairs
+      // with the one in AnnouncePendingCallLocked(): either we see the
+      // call being queued, or its thread sees this request.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (num_pending_calls_.load(std::memory_order_relaxed) == 0) return;
       struct NextPendingCall {
         RequestedCall* rc = nullptr;
         CallData* pending_filter_stack = nullptr;
@@ -613,7 +700,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             pending_filter_stack_.front().calld->SetState(
                 CallData::CallState::ZOMBIED);
             pending_filter_stack_.front().calld->KillZombie();
-            pending_filter_stack_.pop();
+            PopPendingFilterStack();
           }
           if (!pending_promises_.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
@@ -621,7 +708,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             if (pending_call.rc != nullptr) {
               pending_call.pending_promise =
                   std::move(pending_promises_.front());
-              pending_promises_.pop();
+              PopPendingPromise();
             }
           } else if (!pending_filter_stack_.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
@@ -629,7 +716,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             if (pending_call.rc != nullptr) {
               pending_call.pending_filter_stack =
                   pending_filter_stack_.front().calld;
-              pending_filter_stack_.pop();
+              PopPendingFilterStack();
             }
           }
         }
@@ -677,6 +764,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     size_t loop_count;
     {
       MutexLock lock(&server_->mu_call_);
+      AnnouncePendingCallLocked();
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -690,6 +778,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         pending_filter_stack_.push(PendingCallFilterStack{calld});
         return;
       }
+      num_pending_calls_.fetch_sub(1, std::memory_order_relaxed);
     }
     calld->SetState(CallData::CallState::ACTIVATED);
     calld->Publish(cq_idx, rc);
@@ -720,8 +809,9 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
              pending_promises_.front()->Age() >
                  server_->max_time_in_pending_queue_) {
         removed_pending.push_back(std::move(pending_promises_.front()));
-        pending_promises_.pop();
+        PopPendingPromise();
       }
+      AnnouncePendingCallLocked();
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -731,10 +821,12 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       if (rc == nullptr) {
         if (server_->pending_backlog_protector_.Reject(pending_promises_.size(),
                                                        server_->bitgen_)) {
+          num_pending_calls_.fetch_sub(1, std::memory_order_relaxed);
           return Immediate(absl::ResourceExhaustedError(
               "Too many pending requests for this server"));
         }
         if (zombified_) {
+          num_pending_calls_.fetch_sub(1, std::memory_order_relaxed);
           return Immediate(absl::InternalError("Server closed"));
         }
         auto w = std::make_shared<ActivityWaiter>(
@@ -749,6 +841,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             },
             [w]() { w->Finish(absl::CancelledError()); });
       }
+      num_pending_calls_.fetch_sub(1, std::memory_order_relaxed);
     }
     return Immediate(MatchResult(server(), cq_idx, rc));
   }
@@ -756,6 +849,25 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   Server* server() const final { return server_; }
 
  private:
+  // Called with mu_call_ held, before checking the request queues for a
+  // call that will be added to a pending queue if they are all empty.
+  // The caller must decrement num_pending_calls_ again if the call is not
+  // added.
+  void AnnouncePendingCallLocked() {
+    num_pending_calls_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  void PopPendingFilterStack() {
+    pending_filter_stack_.pop();
+    num_pending_calls_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  void PopPendingPromise() {
+    pending_promises_.pop();
+    num_pending_calls_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
   Server* const server_;
   struct PendingCallFilterStack {
     CallData* calld;
@@ -801,6 +913,10 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   using PendingCallPromises = std::shared_ptr<ActivityWaiter>;
   std::queue<PendingCallFilterStack> pending_filter_stack_;
   std::queue<PendingCallPromises> pending_promises_;
+  // The number of calls in the pending queues, plus the calls that are
+  // about to be added to them.  Lets RequestCallWithPossiblePublish() skip
+  // mu_call_ when there is nothing to match.
+  std::atomic<size_t> num_pending_calls_{0};
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
   bool zombified_ = false;
 };
@@ -1062,6 +1178,9 @@ RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
                .value_or(GRPC_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE_DEFAULT));
     channelz_node =
         MakeRefCounted<channelz::ServerNode>(channel_tracer_max_memory);
+    if (args.GetBool(GRPC_ARG_CHANNELZ_CALL_LATENCY).value_or(false)) {
+      channelz_node->EnableCallLatency();
+    }
     channelz_node->AddTraceEvent(
         channelz::ChannelTrace::Severity::Info,
         grpc_slice_from_static_string("Server created"));
@@ -1218,6 +1337,14 @@ void Server::Start() {
       rm.second->matcher = std::make_unique<RealRequestMatcher>(this);
     }
   }
+  if (channelz_node_ != nullptr && channelz_node_->call_latency_enabled()) {
+    std::vector<std::string> methods;
+    methods.reserve(registered_methods_.size());
+    for (const auto& rm : registered_methods_) {
+      methods.push_back(rm.first.second);
+    }
+    channelz_node_->TrackMethodCallLatency(methods);
+  }
   {
     MutexLock lock(&mu_global_);
     starting_ = true;
@@ -1289,14 +1416,16 @@ grpc_error_handle Server::SetupTransport(
       // Completion queue not found.  Pick a random one to publish new calls to.
       cq_idx = static_cast<size_t>(rand()) % std::max<size_t>(1, cqs_.size());
     }
-    intptr_t channelz_socket_uuid = 0;
     if (socket_node != nullptr) {
-      channelz_socket_uuid = socket_node->uuid();
+      socket_node->SetCallArenaAllocator(
+          (*channel)
+              ->call_arena_allocator()
+              ->RefAsSubclass<CallArenaAllocator>());
       channelz_node_->AddChildSocket(socket_node);
     }
     // Initialize chand.
     chand->InitTransport(Ref(), std::move(*channel), cq_idx, transport,
-                         channelz_socket_uuid);
+                         socket_node.get());
   }
   return absl::OkStatus();
 }
@@ -1646,8 +1775,8 @@ class Server::ChannelData::ConnectivityWatcher
 
 Server::ChannelData::~ChannelData() {
   if (server_ != nullptr) {
-    if (server_->channelz_node_ != nullptr && channelz_socket_uuid_ != 0) {
-      server_->channelz_node_->RemoveChildSocket(channelz_socket_uuid_);
+    if (server_->channelz_node_ != nullptr && channelz_socket_ != nullptr) {
+      server_->channelz_node_->RemoveChildSocket(channelz_socket_);
     }
     {
       MutexLock lock(&server_->mu_global_);
@@ -1663,11 +1792,11 @@ Server::ChannelData::~ChannelData() {
 void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
                                         RefCountedPtr<Channel> channel,
                                         size_t cq_idx, Transport* transport,
-                                        intptr_t channelz_socket_uuid) {
+                                        channelz::SocketNode* channelz_socket) {
   server_ = std::move(server);
   channel_ = std::move(channel);
   cq_idx_ = cq_idx;
-  channelz_socket_uuid_ = channelz_socket_uuid;
+  channelz_socket_ = channelz_socket;
   // Publish channel.
   {
     MutexLock lock(&server_->mu_global_);
@@ -1981,6 +2110,17 @@ void Server::CallData::StartTransportStreamOpBatchImpl(
     batch->payload->recv_trailing_metadata.recv_trailing_metadata_ready =
         &recv_trailing_metadata_ready_;
   }
+  if (batch->send_trailing_metadata && path_.has_value()) {
+    // The handler is done with the call once it sends its status.
+    channelz::ServerNode* channelz_node = server_->channelz_node();
+    if (channelz_node != nullptr && channelz_node->call_latency_enabled()) {
+      channelz_node->RecordCallLatency(
+          path_->as_string_view(),
+          gpr_timespec_to_micros(gpr_cycle_counter_sub(
+              gpr_get_cycle_counter(), Call::FromC(call_)->start_time())) /
+              GPR_US_PER_SEC);
+    }
+  }
   grpc_call_next_op(elem, batch);
 }
 
@@ -280,10 +280,21 @@ class Server : public ServerInterface,
       absl::flat_hash_set<OrphanablePtr<ListenerInterface::LogicalConnection>>
           connections;
       grpc_core::Timestamp timestamp;
+      // When GOAWAYs are staggered, the connections that have yet to be sent
+      // one, in the order they will be sent, and when the next one is due.
+      // Connections may have been closed and removed from `connections`
+      // since.
+      std::deque<ListenerInterface::LogicalConnection*> pending_goaways;
+      grpc_core::Timestamp next_goaway;
+      Duration goaway_interval;
     };
 
     void DrainConnectionsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+    // Sends the staggered GOAWAYs that are due, and starts a timer for the
+    // next one.
+    void SendDueGoAwaysLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
     void OnDrainGraceTimer();
 
     void MaybeStartNewGraceTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
@@ -313,6 +324,8 @@ class Server : public ServerInterface,
     grpc_event_engine::experimental::EventEngine::TaskHandle
         drain_grace_timer_handle_ ABSL_GUARDED_BY(mu_) =
             grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+    std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+        goaway_timer_handle_ ABSL_GUARDED_BY(mu_);
   };
 
   explicit Server(const ChannelArgs& args);
@@ -427,7 +440,8 @@ class Server : public ServerInterface,
 
     void InitTransport(RefCountedPtr<Server> server,
                        RefCountedPtr<Channel> channel, size_t cq_idx,
-                       Transport* transport, intptr_t channelz_socket_uuid);
+                       Transport* transport,
+                       channelz::SocketNode* channelz_socket);
 
     RefCountedPtr<Server> server() const { return server_; }
     Channel* channel() const { return channel_.get(); }
@@ -455,7 +469,8 @@ class Server : public ServerInterface,
     size_t cq_idx_;
     std::optional<std::list<ChannelData*>::iterator> list_position_;
     grpc_closure finish_destroy_channel_closure_;
-    intptr_t channelz_socket_uuid_;
+    // Owned by server_->channelz_node_ until this is destroyed.
+    channelz::SocketNode* channelz_socket_ = nullptr;
   };
 
   class CallData {
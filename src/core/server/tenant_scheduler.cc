@@ -0,0 +1,184 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/server/tenant_scheduler.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "src/core/telemetry/call_cpu_accounting.h"
+
+namespace grpc_core {
+
+namespace {
+
+// How much each measured cost moves the average cost of a tenant's items.
+constexpr double kAverageCostWeight = 0.2;
+
+}  // namespace
+
+TenantScheduler::TenantScheduler(size_t max_concurrency, CpuClock cpu_clock)
+    : cpu_clock_(std::move(cpu_clock)),
+      thread_quota_(MakeRefCounted<ThreadQuota>()) {
+  thread_quota_->SetMax(std::max<size_t>(max_concurrency, 1));
+}
+
+TenantScheduler::CpuClock TenantScheduler::DefaultCpuClock() {
+  return ThreadCpuTimeNanos;
+}
+
+void TenantScheduler::SetWeight(absl::string_view tenant, double weight) {
+  CHECK_GT(weight, 0);
+  MutexLock lock(&mu_);
+  auto it = tenants_.find(tenant);
+  // Weighted tenants are always tracked on their own, even past kMaxTenants.
+  Tenant* t = it == tenants_.end() ? CreateTenantLocked(tenant) : &it->second;
+  MarkBusyLocked(t);
+  t->weight = weight;
+  t->weighted = true;
+}
+
+void TenantScheduler::Add(absl::string_view tenant, WorkItem work) {
+  MutexLock lock(&mu_);
+  Tenant* t = GetTenantLocked(tenant);
+  MarkBusyLocked(t);
+  if (t->queue.empty()) {
+    t->virtual_time = std::max(t->virtual_time, virtual_time_);
+    active_.push_back(t);
+  }
+  t->queue.push_back(QueuedItem{std::move(work), Timestamp::Now()});
+}
+
+void TenantScheduler::RunNext() {
+  while (true) {
+    Tenant* tenant;
+    double estimated_cost;
+    QueuedItem item;
+    {
+      MutexLock lock(&mu_);
+      if (!thread_quota_->Reserve(1)) {
+        // A running call holds the quota, since no one else uses it, and runs
+        // this item once it is done.
+        ++deferred_runs_;
+        return;
+      }
+      tenant = PopNextLocked(&item);
+      estimated_cost = tenant->average_cost;
+    }
+    const int64_t start = cpu_clock_();
+    item.work();
+    // Charge for destroying the work item's captures too.
+    item.work = nullptr;
+    const int64_t end = cpu_clock_();
+    MutexLock lock(&mu_);
+    thread_quota_->Release(1);
+    ChargeLocked(tenant, estimated_cost,
+                 start >= 0 && end >= start ? end - start : 1);
+    if (deferred_runs_ == 0) return;
+    --deferred_runs_;
+  }
+}
+
+std::vector<TenantScheduler::TenantStats> TenantScheduler::GetStats() {
+  MutexLock lock(&mu_);
+  std::vector<TenantStats> stats;
+  stats.reserve(tenants_.size());
+  for (const auto& p : tenants_) {
+    const Tenant& t = p.second;
+    stats.push_back(TenantStats{p.first, t.weight, t.items_run, t.queue.size(),
+                                t.cpu_time_nanos, t.queue_time});
+  }
+  return stats;
+}
+
+TenantScheduler::Tenant* TenantScheduler::GetTenantLocked(
+    absl::string_view name) {
+  auto it = tenants_.find(name);
+  if (it != tenants_.end()) return &it->second;
+  if (tenants_.size() >= kMaxTenants && !idle_.empty()) {
+    // The tenant idle the longest has most likely been caught up with by the
+    // others, so forgetting its virtual time forgives it little if anything.
+    Tenant* evicted = idle_.front();
+    idle_.pop_front();
+    tenants_.erase(tenants_.find(evicted->name));
+  }
+  if (tenants_.size() >= kMaxTenants) {
+    name = "";
+    it = tenants_.find(name);
+    if (it != tenants_.end()) return &it->second;
+  }
+  return CreateTenantLocked(name);
+}
+
+TenantScheduler::Tenant* TenantScheduler::CreateTenantLocked(
+    absl::string_view name) {
+  auto it = tenants_.emplace(std::string(name), Tenant()).first;
+  it->second.name = it->first;
+  return &it->second;
+}
+
+void TenantScheduler::MarkBusyLocked(Tenant* tenant) {
+  if (!tenant->idle) return;
+  idle_.erase(tenant->idle_position);
+  tenant->idle = false;
+}
+
+TenantScheduler::Tenant* TenantScheduler::PopNextLocked(QueuedItem* item) {
+  // Each queued item has a RunNext() call of its own, either pending or
+  // deferred, so there is one to pop.
+  CHECK(!active_.empty());
+  auto next = active_.begin();
+  for (auto it = active_.begin() + 1; it != active_.end(); ++it) {
+    Tenant* t = *it;
+    if (t->virtual_time < (*next)->virtual_time ||
+        (t->virtual_time == (*next)->virtual_time &&
+         t->queue.front().queued_at < (*next)->queue.front().queued_at)) {
+      next = it;
+    }
+  }
+  Tenant* tenant = *next;
+  *item = std::move(tenant->queue.front());
+  tenant->queue.pop_front();
+  if (tenant->queue.empty()) {
+    *next = active_.back();
+    active_.pop_back();
+  }
+  virtual_time_ = std::max(virtual_time_, tenant->virtual_time);
+  tenant->virtual_time += tenant->average_cost / tenant->weight;
+  ++tenant->running;
+  ++tenant->items_run;
+  tenant->queue_time += Timestamp::Now() - item->queued_at;
+  return tenant;
+}
+
+void TenantScheduler::ChargeLocked(Tenant* tenant, double estimated_cost,
+                                   int64_t cost) {
+  tenant->virtual_time += (cost - estimated_cost) / tenant->weight;
+  tenant->cpu_time_nanos += cost;
+  tenant->average_cost += kAverageCostWeight * (cost - tenant->average_cost);
+  --tenant->running;
+  if (tenant->running == 0 && tenant->queue.empty() && !tenant->weighted) {
+    tenant->idle_position = idle_.insert(idle_.end(), tenant);
+    tenant->idle = true;
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,179 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_SERVER_TENANT_SCHEDULER_H
+#define GRPC_SRC_CORE_SERVER_TENANT_SCHEDULER_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/resource_quota/thread_quota.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Runs server work items, such as the handlers of new calls, so that tenants
+// share the CPU in proportion to their weights.
+//
+// Each work item belongs to a tenant, and each tenant has a virtual time: the
+// CPU time its items have used, divided by its weight. The next item to run is
+// always the oldest one of the tenant with the smallest virtual time, so a
+// tenant that has used more than its share waits behind the others until they
+// catch up. A tenant that has been idle starts again from the virtual time of
+// the tenants being served, rather than from where it stopped, so it cannot
+// bank credit while idle.
+//
+// Tenants are tracked while they have items queued or running, and for as
+// long as there is room after that. Once kMaxTenants are tracked, a new tenant
+// replaces the one that has been idle the longest. Tenants given a weight are
+// never replaced.
+//
+// An item is charged the CPU time the thread that runs it uses until it
+// returns. Work it hands off to other threads is not charged. Where thread CPU
+// time cannot be measured, every item costs the same, and tenants share the
+// items run rather than the CPU.
+//
+// Each Add() must be followed by one RunNext(), on the thread that should run
+// the work. At most max_concurrency items run at once, tracked by a
+// ThreadQuota: a RunNext() that finds the quota used up returns at once, and
+// its item is run by one of the running RunNext() calls when its item is done.
+class TenantScheduler final {
+ public:
+  using WorkItem = absl::AnyInvocable<void()>;
+
+  // Returns the CPU time used by the calling thread, in nanoseconds, or -1 if
+  // it cannot be measured.
+  using CpuClock = std::function<int64_t()>;
+
+  // The most tenants tracked. When all of them have items queued or running,
+  // or have a weight, further tenants share the stats and the queue of the
+  // default tenant, "", so that a client cannot grow the scheduler without
+  // bound by making up tenants.
+  static constexpr size_t kMaxTenants = 1024;
+
+  struct TenantStats {
+    std::string tenant;
+    double weight;
+    // Items that have started running.
+    uint64_t items_run;
+    // Items waiting to run.
+    size_t items_queued;
+    // Total CPU time charged to the items run.
+    int64_t cpu_time_nanos;
+    // Total time the items run spent queued.
+    Duration queue_time;
+  };
+
+  explicit TenantScheduler(size_t max_concurrency,
+                           CpuClock cpu_clock = DefaultCpuClock());
+
+  TenantScheduler(const TenantScheduler&) = delete;
+  TenantScheduler& operator=(const TenantScheduler&) = delete;
+
+  // Sets the share of the CPU that \a tenant gets, relative to the other
+  // tenants. Tenants default to a weight of 1. \a weight must be positive.
+  void SetWeight(absl::string_view tenant, double weight);
+
+  // Queues \a work for \a tenant.
+  void Add(absl::string_view tenant, WorkItem work);
+
+  // Runs the next work item, and any items whose RunNext() found the quota
+  // used up in the meantime.
+  void RunNext();
+
+  // Returns the stats of each tenant tracked, ordered by tenant.
+  std::vector<TenantStats> GetStats();
+
+ private:
+  struct QueuedItem {
+    WorkItem work;
+    Timestamp queued_at;
+  };
+
+  struct Tenant {
+    // The key of this tenant in tenants_.
+    absl::string_view name;
+    double weight = 1;
+    // Whether SetWeight() was called for this tenant.
+    bool weighted = false;
+    // Items popped that have not finished running.
+    size_t running = 0;
+    // Where this tenant is in idle_, if it is there.
+    std::list<Tenant*>::iterator idle_position;
+    bool idle = false;
+    // CPU nanoseconds used, divided by the weight.
+    double virtual_time = 0;
+    // Moving average of the CPU nanoseconds used by an item, which is charged
+    // when an item starts and corrected when it is done.
+    double average_cost = 0;
+    std::deque<QueuedItem> queue;
+    uint64_t items_run = 0;
+    int64_t cpu_time_nanos = 0;
+    Duration queue_time;
+  };
+
+  static CpuClock DefaultCpuClock();
+
+  // Returns the tenant to queue an item of \a name on, making room for it if
+  // needed.
+  Tenant* GetTenantLocked(absl::string_view name)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  Tenant* CreateTenantLocked(absl::string_view name)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Takes \a tenant off idle_, if it is there.
+  void MarkBusyLocked(Tenant* tenant) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Takes the next item to run from the tenant with the smallest virtual time,
+  // and charges that tenant its estimated cost.
+  Tenant* PopNextLocked(QueuedItem* item) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Replaces the estimated cost of an item charged by PopNextLocked() with
+  // the \a cost it measured.
+  void ChargeLocked(Tenant* tenant, double estimated_cost, int64_t cost)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const CpuClock cpu_clock_;
+  const ThreadQuotaPtr thread_quota_;
+  Mutex mu_;
+  // Only idle tenants are removed, so pointers to the others stay valid.
+  std::map<std::string, Tenant, std::less<>> tenants_ ABSL_GUARDED_BY(mu_);
+  // The tenants without a weight and without items queued or running, the
+  // one idle the longest first. These are removed to make room for new ones.
+  std::list<Tenant*> idle_ ABSL_GUARDED_BY(mu_);
+  // The tenants with queued items.
+  std::vector<Tenant*> active_ ABSL_GUARDED_BY(mu_);
+  // The largest virtual time at which an item has started running.
+  double virtual_time_ ABSL_GUARDED_BY(mu_) = 0;
+  // The RunNext() calls that found the quota used up, and left their items
+  // for the running calls.
+  size_t deferred_runs_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_SERVER_TENANT_SCHEDULER_H
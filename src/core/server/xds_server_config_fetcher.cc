@@ -350,6 +350,7 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
 
     std::vector<std::string> domains;
     std::vector<Route> routes;
+    XdsRouting::RouteTable route_table;
   };
 
   class VirtualHostListIterator final
@@ -1142,6 +1143,8 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             ServiceConfigImpl::Create(result->args, json.c_str()).value();
       }
     }
+    virtual_host.route_table = XdsRouting::RouteTable(
+        VirtualHost::RouteListIterator(&virtual_host.routes));
   }
   return config_selector;
 }
@@ -1168,7 +1171,7 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
                      " in RouteConfiguration"));
   }
   auto& virtual_host = virtual_hosts_[vhost_index.value()];
-  auto route_index = XdsRouting::GetRouteForRequest(
+  auto route_index = virtual_host.route_table.GetRouteForRequest(
       VirtualHost::RouteListIterator(&virtual_host.routes), path, metadata);
   if (route_index.has_value()) {
     auto& route = virtual_host.routes[route_index.value()];
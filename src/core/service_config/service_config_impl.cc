@@ -17,7 +17,6 @@
 #include "src/core/service_config/service_config_impl.h"
 
 #include <grpc/support/port_platform.h>
-#include <string.h>
 
 #include <optional>
 #include <string>
@@ -35,7 +34,6 @@
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/json/json_reader.h"
 #include "src/core/util/json/json_writer.h"
-#include "src/core/util/memory.h"
 #include "src/core/util/validation_errors.h"
 
 namespace grpc_core {
@@ -146,18 +144,11 @@ RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
           }
           service_config->default_method_config_vector_ = vector_ptr;
         } else {
-          grpc_slice key = grpc_slice_from_cpp_string(std::move(path));
-          // If the key is not already present in the map, this will
-          // store a ref to the key in the map.
-          auto& value = service_config->parsed_method_configs_map_[key];
-          if (value != nullptr) {
+          auto result = service_config->parsed_method_configs_map_.emplace(
+              std::move(path), vector_ptr);
+          if (!result.second) {
             errors->AddError(absl::StrCat("multiple method configs for path ",
-                                          StringViewFromSlice(key)));
-            // The map entry already existed, so we need to unref the
-            // key we just created.
-            CSliceUnref(key);
-          } else {
-            value = vector_ptr;
+                                          result.first->first));
           }
         }
       }
@@ -166,28 +157,20 @@ RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
   return service_config;
 }
 
-ServiceConfigImpl::~ServiceConfigImpl() {
-  for (auto& p : parsed_method_configs_map_) {
-    CSliceUnref(p.first);
-  }
-}
-
 const ServiceConfigParser::ParsedConfigVector*
 ServiceConfigImpl::GetMethodParsedConfigVector(const grpc_slice& path) const {
   if (parsed_method_configs_map_.empty()) {
     return default_method_config_vector_;
   }
   // Try looking up the full path in the map.
-  auto it = parsed_method_configs_map_.find(path);
+  absl::string_view path_view = StringViewFromSlice(path);
+  auto it = parsed_method_configs_map_.find(path_view);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // If we didn't find a match for the path, try looking for a wildcard
   // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
-  it = parsed_method_configs_map_.find(wildcard_path);
+  size_t sep = path_view.rfind('/');
+  if (sep == absl::string_view::npos) return nullptr;  // Shouldn't ever happen.
+  it = parsed_method_configs_map_.find(path_view.substr(0, sep + 1));
   if (it != parsed_method_configs_map_.end()) return it->second;
   // Try default method config, if set.
   return default_method_config_vector_;
@@ -23,9 +23,9 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
@@ -78,8 +78,6 @@ class ServiceConfigImpl final : public ServiceConfig {
                                              const Json& json,
                                              ValidationErrors* errors);
 
-  ~ServiceConfigImpl() override;
-
   absl::string_view json_string() const override { return json_string_; }
 
   /// Retrieves the global parsed config at index \a index. The
@@ -104,9 +102,10 @@ class ServiceConfigImpl final : public ServiceConfig {
   ServiceConfigParser::ParsedConfigVector parsed_global_configs_;
   // A map from the method name to the parsed config vector. Note that we are
   // using a raw pointer and not a unique pointer so that we can use the same
-  // vector for multiple names.
-  std::unordered_map<grpc_slice, const ServiceConfigParser::ParsedConfigVector*,
-                     SliceHash>
+  // vector for multiple names.  Lookups are done with a string_view into the
+  // call's path, so they do not allocate.
+  absl::flat_hash_map<std::string,
+                      const ServiceConfigParser::ParsedConfigVector*>
       parsed_method_configs_map_;
   // Default method config.
   const ServiceConfigParser::ParsedConfigVector* default_method_config_vector_ =
@@ -0,0 +1,195 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/telemetry/call_cpu_accounting.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+#include <time.h>
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/telemetry/call_tracer.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kMetricLabelMethod = "grpc.method";
+
+const auto kMetricServerCallCoreCpuTime =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.core_cpu_time",
+        "EXPERIMENTAL.  CPU time used by gRPC on behalf of a call while its "
+        "batches were started.",
+        "s", false)
+        .Labels(kMetricLabelMethod)
+        .Build();
+
+const auto kMetricServerCallHandlerCpuTime =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.handler_cpu_time",
+        "EXPERIMENTAL.  CPU time used by the method handler of a call, "
+        "excluding the CPU time used by gRPC.",
+        "s", false)
+        .Labels(kMetricLabelMethod)
+        .Build();
+
+std::atomic<bool> g_enabled_for_all_server_calls{false};
+
+thread_local CallCpuAccounting::Scope* g_current_scope = nullptr;
+
+// The accounting of a server call. It is a call tracer so that the totals
+// can be recorded, with the call's method, when the call ends.
+class CallCpuAccountingServerCallTracer final : public ServerCallTracer,
+                                                public CallCpuAccounting {
+ public:
+  explicit CallCpuAccountingServerCallTracer(
+      GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group)
+      : stats_plugin_group_(stats_plugin_group) {}
+
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* /*send_initial_metadata*/) override {}
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* /*send_trailing_metadata*/) override {}
+  void RecordSendMessage(const Message& /*send_message*/) override {}
+  void RecordSendCompressedMessage(
+      const Message& /*send_compressed_message*/) override {}
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* recv_initial_metadata) override {
+    // Unregistered methods share one label value, so that clients cannot
+    // blow up the cardinality of the histograms.
+    if (recv_initial_metadata->get(GrpcRegisteredMethod()).value_or(nullptr) ==
+        nullptr) {
+      return;
+    }
+    const Slice* path = recv_initial_metadata->get_pointer(HttpPathMetadata());
+    if (path != nullptr) method_ = path->Ref();
+  }
+  void RecordReceivedMessage(const Message& /*recv_message*/) override {}
+  void RecordReceivedDecompressedMessage(
+      const Message& /*recv_decompressed_message*/) override {}
+  void RecordReceivedTrailingMetadata(
+      grpc_metadata_batch* /*recv_trailing_metadata*/) override {}
+  void RecordCancel(grpc_error_handle /*cancel_error*/) override {}
+  void RecordEnd(const grpc_call_final_info* /*final_info*/) override {
+    const absl::string_view method =
+        method_.empty() ? "other" : method_.as_string_view();
+    stats_plugin_group_.RecordHistogram(
+        kMetricServerCallCoreCpuTime,
+        static_cast<double>(core_nanos()) / GPR_NS_PER_SEC, {method}, {});
+    stats_plugin_group_.RecordHistogram(
+        kMetricServerCallHandlerCpuTime,
+        static_cast<double>(handler_nanos()) / GPR_NS_PER_SEC, {method}, {});
+  }
+  void RecordIncomingBytes(
+      const TransportByteSize& /*transport_byte_size*/) override {}
+  void RecordOutgoingBytes(
+      const TransportByteSize& /*transport_byte_size*/) override {}
+  void RecordAnnotation(absl::string_view /*annotation*/) override {}
+  void RecordAnnotation(const Annotation& /*annotation*/) override {}
+  std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
+    return nullptr;
+  }
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+ private:
+  GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group_;
+  Slice method_;
+};
+
+}  // namespace
+
+int64_t ThreadCpuTimeNanos() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return -1;
+  return static_cast<int64_t>(ts.tv_sec) * GPR_NS_PER_SEC + ts.tv_nsec;
+#else
+  return -1;
+#endif
+}
+
+//
+// CallCpuAccounting::Scope
+//
+
+CallCpuAccounting::Scope::Scope(CallCpuAccounting* accounting, Phase phase)
+    : accounting_(accounting),
+      phase_(phase),
+      parent_(accounting == nullptr ? nullptr : g_current_scope),
+      start_(accounting == nullptr ? 0 : ThreadCpuTimeNanos()) {
+  if (accounting_ == nullptr) return;
+  // Pause the enclosing scope, so that the time spent in this one is not
+  // accounted twice.
+  if (parent_ != nullptr) {
+    parent_->accounting_->Add(parent_->phase_, start_ - parent_->start_);
+  }
+  g_current_scope = this;
+}
+
+CallCpuAccounting::Scope::~Scope() {
+  if (accounting_ == nullptr) return;
+  const int64_t now = ThreadCpuTimeNanos();
+  accounting_->Add(phase_, now - start_);
+  // Resume the enclosing scope.
+  if (parent_ != nullptr) parent_->start_ = now;
+  g_current_scope = parent_;
+}
+
+//
+// CallCpuAccounting
+//
+
+std::atomic<int64_t> CallCpuAccounting::total_nanos_{0};
+
+void CallCpuAccounting::EnableForAllServerCalls() {
+  g_enabled_for_all_server_calls.store(true, std::memory_order_relaxed);
+}
+
+void CallCpuAccounting::Add(Phase phase, int64_t nanos) {
+  if (nanos <= 0) return;
+  total_nanos_.fetch_add(nanos, std::memory_order_relaxed);
+  (phase == Phase::kCore ? core_nanos_ : handler_nanos_)
+      .fetch_add(nanos, std::memory_order_relaxed);
+}
+
+void MaybeAddCallCpuAccounting(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    Arena* arena) {
+  if (!g_enabled_for_all_server_calls.load(std::memory_order_relaxed) &&
+      !stats_plugin_group.IsInstrumentEnabled(kMetricServerCallCoreCpuTime) &&
+      !stats_plugin_group.IsInstrumentEnabled(
+          kMetricServerCallHandlerCpuTime)) {
+    return;
+  }
+  static const bool supported = ThreadCpuTimeNanos() >= 0;
+  if (!supported) return;
+  auto* tracer =
+      arena->ManagedNew<CallCpuAccountingServerCallTracer>(stats_plugin_group);
+  AddServerCallTracerToContext(arena, tracer);
+  arena->SetContext<CallCpuAccounting>(tracer);
+}
+
+}  // namespace grpc_core
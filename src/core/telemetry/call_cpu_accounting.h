@@ -0,0 +1,119 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_CALL_CPU_ACCOUNTING_H
+#define GRPC_SRC_CORE_TELEMETRY_CALL_CPU_ACCOUNTING_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/telemetry/metrics.h"
+
+// Opt-in accounting of the CPU time that server calls use, split into:
+//   core: work done by gRPC on behalf of the call inside
+//     grpc_call_start_batch(), which includes the filters, the transport and
+//     whatever closures run before the batch returns.
+//   handler: work done by the application while a C++ method handler runs,
+//     minus any core time spent in it.
+// CPU time is that of the calling thread (CLOCK_THREAD_CPUTIME_ID), so work
+// done on other threads, such as reading from the network in a poller, is
+// not attributed to any call.
+//
+// The per-method totals are recorded to the disabled-by-default histograms
+//   grpc.server.call.core_cpu_time
+//   grpc.server.call.handler_cpu_time
+// with a grpc.method label, at the end of each call.
+
+namespace grpc_core {
+
+// Returns the CPU time used by the calling thread so far, in nanoseconds, or
+// -1 if the platform cannot measure it.
+int64_t ThreadCpuTimeNanos();
+
+class CallCpuAccounting {
+ public:
+  enum class Phase { kCore, kHandler };
+
+  // Accounts the CPU time the calling thread uses until the scope ends to
+  // \a phase of \a accounting, which may be null. When scopes nest on a
+  // thread, the time of the inner scope is only accounted to it.
+  class Scope {
+   public:
+    Scope(CallCpuAccounting* accounting, Phase phase);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    CallCpuAccounting* const accounting_;
+    const Phase phase_;
+    Scope* const parent_;
+    int64_t start_;
+  };
+
+  // Turns accounting on for all server calls, whether or not a stats plugin
+  // enables the histograms. Used to derive the CPU utilization reported
+  // through ORCA.
+  static void EnableForAllServerCalls();
+
+  // Returns the CPU time accounted to all server calls in the process so far,
+  // in nanoseconds.
+  static int64_t TotalNanos() {
+    return total_nanos_.load(std::memory_order_relaxed);
+  }
+
+  void Add(Phase phase, int64_t nanos);
+
+  int64_t core_nanos() const {
+    return core_nanos_.load(std::memory_order_relaxed);
+  }
+  int64_t handler_nanos() const {
+    return handler_nanos_.load(std::memory_order_relaxed);
+  }
+
+ protected:
+  ~CallCpuAccounting() = default;
+
+ private:
+  static std::atomic<int64_t> total_nanos_;
+
+  // A call's batches may be started from several threads at once.
+  std::atomic<int64_t> core_nanos_{0};
+  std::atomic<int64_t> handler_nanos_{0};
+};
+
+template <>
+struct ArenaContextType<CallCpuAccounting> {
+  static void Destroy(CallCpuAccounting*) {}
+};
+
+// Adds CPU accounting to a server call, if a stats plugin in
+// \a stats_plugin_group enables one of its histograms or
+// CallCpuAccounting::EnableForAllServerCalls() was called, and the platform
+// can measure thread CPU time.
+void MaybeAddCallCpuAccounting(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    Arena* arena);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_CALL_CPU_ACCOUNTING_H
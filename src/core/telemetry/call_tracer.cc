@@ -21,10 +21,12 @@
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "absl/log/check.h"
+#include "absl/time/time.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/telemetry/tcp_tracer.h"
 
@@ -78,6 +80,48 @@ absl::string_view ServerCallTracerFactory::ChannelArgName() {
   return kServerCallTracerFactoryChannelArgName;
 }
 
+namespace {
+
+// Forwards the events of a TCP trace to the TCP tracers of several call
+// tracers.
+class DelegatingTcpTracer : public TcpTracerInterface {
+ public:
+  explicit DelegatingTcpTracer(
+      std::vector<std::shared_ptr<TcpTracerInterface>> tracers)
+      : tracers_(std::move(tracers)) {}
+
+  void RecordEvent(Type type, absl::Time time, size_t byte_offset,
+                   std::optional<ConnectionMetrics> metrics) override {
+    for (auto& tracer : tracers_) {
+      tracer->RecordEvent(type, time, byte_offset, metrics);
+    }
+  }
+  void RecordConnectionMetrics(ConnectionMetrics metrics) override {
+    for (auto& tracer : tracers_) {
+      tracer->RecordConnectionMetrics(metrics);
+    }
+  }
+
+ private:
+  std::vector<std::shared_ptr<TcpTracerInterface>> tracers_;
+};
+
+// Starts a TCP trace for each of \a tracers that wants one.
+template <typename Tracer>
+std::shared_ptr<TcpTracerInterface> StartDelegatingTcpTrace(
+    const std::vector<Tracer*>& tracers) {
+  std::vector<std::shared_ptr<TcpTracerInterface>> tcp_tracers;
+  for (auto* tracer : tracers) {
+    auto tcp_tracer = tracer->StartNewTcpTrace();
+    if (tcp_tracer != nullptr) tcp_tracers.push_back(std::move(tcp_tracer));
+  }
+  if (tcp_tracers.empty()) return nullptr;
+  if (tcp_tracers.size() == 1) return std::move(tcp_tracers[0]);
+  return std::make_shared<DelegatingTcpTracer>(std::move(tcp_tracers));
+}
+
+}  // namespace
+
 class DelegatingClientCallTracer : public ClientCallTracer {
  public:
   class DelegatingClientCallAttemptTracer
@@ -170,7 +214,7 @@ class DelegatingClientCallTracer : public ClientCallTracer {
       }
     }
     std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
-      return nullptr;
+      return StartDelegatingTcpTrace(tracers_);
     }
     void SetOptionalLabel(OptionalLabelKey key,
                           RefCountedStringValue value) override {
@@ -314,7 +358,7 @@ class DelegatingServerCallTracer : public ServerCallTracer {
     }
   }
   std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
-    return nullptr;
+    return StartDelegatingTcpTrace(tracers_);
   }
   std::string TraceId() override { return tracers_[0]->TraceId(); }
   std::string SpanId() override { return tracers_[0]->SpanId(); }
@@ -41,6 +41,14 @@
 
 namespace grpc_core {
 
+// Annotations that the client channel records on a call that had to wait for
+// name resolution, and on an attempt that had to wait for an LB pick, once the
+// wait is over.
+inline constexpr absl::string_view kDelayedNameResolutionCompleteAnnotation =
+    "Delayed name resolution complete.";
+inline constexpr absl::string_view kDelayedLbPickCompleteAnnotation =
+    "Delayed LB pick complete.";
+
 // The interface hierarchy is as follows -
 //                 CallTracerAnnotationInterface
 //                    |                  |
@@ -0,0 +1,380 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/telemetry/latency_breakdown.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/tcp_tracer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc_core {
+
+namespace {
+
+const auto kMetricClientCallSetupDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.client.call.setup_duration",
+        "EXPERIMENTAL.  Time from the creation of a call to the start of its "
+        "first attempt.",
+        "s", false)
+        .Build();
+
+const auto kMetricClientAttemptPickDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.client.attempt.pick_duration",
+        "EXPERIMENTAL.  Time an attempt waited for an LB pick, including the "
+        "time waiting for a subchannel to connect.",
+        "s", false)
+        .Build();
+
+const auto kMetricClientAttemptWriteQueueDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.client.attempt.write_queue_duration",
+        "EXPERIMENTAL.  Time from an attempt being handed to the transport to "
+        "sendmsg() returning for its first byte.",
+        "s", false)
+        .Build();
+
+const auto kMetricClientAttemptWireDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.client.attempt.wire_duration",
+        "EXPERIMENTAL.  Time from sendmsg() returning for the first byte of "
+        "an attempt to the byte being sent by the NIC.",
+        "s", false)
+        .Build();
+
+const auto kMetricClientAttemptResponseDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.client.attempt.response_duration",
+        "EXPERIMENTAL.  Time from an attempt being handed to the transport to "
+        "its trailing metadata being received.",
+        "s", false)
+        .Build();
+
+const auto kMetricServerCallFilterDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.filter_duration",
+        "EXPERIMENTAL.  Time from the creation of a call to its initial "
+        "metadata having gone through the filters.",
+        "s", false)
+        .Build();
+
+const auto kMetricServerCallHandlerDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.handler_duration",
+        "EXPERIMENTAL.  Time from a call's initial metadata having gone "
+        "through the filters to its trailing metadata being sent, including "
+        "queueing before the handler runs.",
+        "s", false)
+        .Build();
+
+const auto kMetricServerCallWriteDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.write_duration",
+        "EXPERIMENTAL.  Time from a call's trailing metadata being sent to "
+        "the end of the call.",
+        "s", false)
+        .Build();
+
+double SecondsBetween(gpr_cycle_counter start, gpr_cycle_counter end) {
+  gpr_timespec elapsed = gpr_cycle_counter_sub(end, start);
+  return static_cast<double>(elapsed.tv_sec) +
+         static_cast<double>(elapsed.tv_nsec) / GPR_NS_PER_SEC;
+}
+
+void RecordSeconds(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<
+        GlobalInstrumentsRegistry::ValueType::kDouble,
+        GlobalInstrumentsRegistry::InstrumentType::kHistogram, 0, 0>
+        handle,
+    double seconds) {
+  stats_plugin_group.RecordHistogram(handle, seconds, {}, {});
+}
+
+// Keeps the times of the first sendmsg() and NIC timestamps of an attempt.
+// The transport may hold on to it after the attempt has ended.
+class FirstByteTcpTracer final : public TcpTracerInterface {
+ public:
+  void RecordEvent(Type type, absl::Time time, size_t /*byte_offset*/,
+                   std::optional<ConnectionMetrics> /*metrics*/) override {
+    MutexLock lock(&mu_);
+    if (type == Type::kSendMsg && !send_msg_time_.has_value()) {
+      send_msg_time_ = time;
+    } else if (type == Type::kSent && !sent_time_.has_value()) {
+      sent_time_ = time;
+    }
+  }
+  void RecordConnectionMetrics(ConnectionMetrics /*metrics*/) override {}
+
+  std::optional<absl::Time> send_msg_time() {
+    MutexLock lock(&mu_);
+    return send_msg_time_;
+  }
+  std::optional<absl::Time> sent_time() {
+    MutexLock lock(&mu_);
+    return sent_time_;
+  }
+
+ private:
+  Mutex mu_;
+  std::optional<absl::Time> send_msg_time_ ABSL_GUARDED_BY(mu_);
+  std::optional<absl::Time> sent_time_ ABSL_GUARDED_BY(mu_);
+};
+
+class LatencyBreakdownClientCallTracer final : public ClientCallTracer {
+ public:
+  class CallAttemptTracer final : public ClientCallTracer::CallAttemptTracer {
+   public:
+    CallAttemptTracer(
+        GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+        bool trace_tcp)
+        : stats_plugin_group_(stats_plugin_group),
+          trace_tcp_(trace_tcp),
+          start_(gpr_get_cycle_counter()),
+          pick_complete_(start_) {}
+
+    void RecordSendInitialMetadata(
+        grpc_metadata_batch* /*send_initial_metadata*/) override {
+      MarkHandedToTransport();
+    }
+    void RecordSendTrailingMetadata(
+        grpc_metadata_batch* /*send_trailing_metadata*/) override {}
+    void RecordSendMessage(const Message& /*send_message*/) override {}
+    void RecordSendCompressedMessage(
+        const Message& /*send_compressed_message*/) override {}
+    void RecordReceivedInitialMetadata(
+        grpc_metadata_batch* /*recv_initial_metadata*/) override {}
+    void RecordReceivedMessage(const Message& /*recv_message*/) override {}
+    void RecordReceivedDecompressedMessage(
+        const Message& /*recv_decompressed_message*/) override {}
+    void RecordReceivedTrailingMetadata(
+        absl::Status /*status*/,
+        grpc_metadata_batch* /*recv_trailing_metadata*/,
+        const grpc_transport_stream_stats* /*transport_stream_stats*/)
+        override {
+      if (handed_to_transport_.has_value()) {
+        RecordSeconds(
+            stats_plugin_group_, kMetricClientAttemptResponseDuration,
+            SecondsBetween(*handed_to_transport_, gpr_get_cycle_counter()));
+      }
+    }
+    void RecordCancel(grpc_error_handle /*cancel_error*/) override {}
+    void RecordEnd(const gpr_timespec& /*latency*/) override {
+      RecordSeconds(stats_plugin_group_, kMetricClientAttemptPickDuration,
+                    SecondsBetween(start_, pick_complete_));
+      if (tcp_tracer_ == nullptr || !handed_to_transport_time_.has_value()) {
+        return;
+      }
+      std::optional<absl::Time> send_msg_time = tcp_tracer_->send_msg_time();
+      if (!send_msg_time.has_value()) return;
+      RecordSeconds(
+          stats_plugin_group_, kMetricClientAttemptWriteQueueDuration,
+          absl::ToDoubleSeconds(*send_msg_time - *handed_to_transport_time_));
+      std::optional<absl::Time> sent_time = tcp_tracer_->sent_time();
+      if (!sent_time.has_value()) return;
+      RecordSeconds(stats_plugin_group_, kMetricClientAttemptWireDuration,
+                    absl::ToDoubleSeconds(*sent_time - *send_msg_time));
+    }
+    void RecordIncomingBytes(
+        const TransportByteSize& /*transport_byte_size*/) override {}
+    void RecordOutgoingBytes(
+        const TransportByteSize& /*transport_byte_size*/) override {}
+    void SetOptionalLabel(OptionalLabelKey /*key*/,
+                          RefCountedStringValue /*value*/) override {}
+    void RecordAnnotation(absl::string_view annotation) override {
+      if (annotation == kDelayedLbPickCompleteAnnotation) {
+        pick_complete_ = gpr_get_cycle_counter();
+        MarkHandedToTransport();
+      }
+    }
+    void RecordAnnotation(const Annotation& /*annotation*/) override {}
+    std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
+      if (!trace_tcp_) return nullptr;
+      // Only the first TCP trace covers the first byte of the attempt.
+      if (tcp_tracer_ == nullptr) {
+        tcp_tracer_ = std::make_shared<FirstByteTcpTracer>();
+      }
+      return tcp_tracer_;
+    }
+    std::string TraceId() override { return ""; }
+    std::string SpanId() override { return ""; }
+    bool IsSampled() override { return trace_tcp_; }
+
+   private:
+    // The attempt is handed to the transport once it has both sent its
+    // initial metadata and got its LB pick, in whichever order those happen.
+    void MarkHandedToTransport() {
+      handed_to_transport_ = gpr_get_cycle_counter();
+      if (trace_tcp_) handed_to_transport_time_ = absl::Now();
+    }
+
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group_;
+    const bool trace_tcp_;
+    const gpr_cycle_counter start_;
+    gpr_cycle_counter pick_complete_;
+    std::optional<gpr_cycle_counter> handed_to_transport_;
+    std::optional<absl::Time> handed_to_transport_time_;
+    std::shared_ptr<FirstByteTcpTracer> tcp_tracer_;
+  };
+
+  LatencyBreakdownClientCallTracer(
+      GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+      Arena* arena)
+      : stats_plugin_group_(stats_plugin_group),
+        arena_(arena),
+        trace_tcp_(stats_plugin_group.IsInstrumentEnabled(
+                       kMetricClientAttemptWriteQueueDuration) ||
+                   stats_plugin_group.IsInstrumentEnabled(
+                       kMetricClientAttemptWireDuration)),
+        start_(gpr_get_cycle_counter()) {}
+
+  CallAttemptTracer* StartNewAttempt(bool /*is_transparent_retry*/) override {
+    if (!attempted_) {
+      attempted_ = true;
+      RecordSeconds(stats_plugin_group_, kMetricClientCallSetupDuration,
+                    SecondsBetween(start_, gpr_get_cycle_counter()));
+    }
+    return arena_->ManagedNew<CallAttemptTracer>(stats_plugin_group_,
+                                                 trace_tcp_);
+  }
+  void RecordAnnotation(absl::string_view /*annotation*/) override {}
+  void RecordAnnotation(const Annotation& /*annotation*/) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return trace_tcp_; }
+
+ private:
+  GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group_;
+  Arena* const arena_;
+  const bool trace_tcp_;
+  const gpr_cycle_counter start_;
+  bool attempted_ = false;
+};
+
+class LatencyBreakdownServerCallTracer final : public ServerCallTracer {
+ public:
+  explicit LatencyBreakdownServerCallTracer(
+      GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group)
+      : stats_plugin_group_(stats_plugin_group),
+        start_(gpr_get_cycle_counter()) {}
+
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* /*send_initial_metadata*/) override {}
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* /*send_trailing_metadata*/) override {
+    send_trailing_metadata_ = gpr_get_cycle_counter();
+    if (received_initial_metadata_.has_value()) {
+      RecordSeconds(stats_plugin_group_, kMetricServerCallHandlerDuration,
+                    SecondsBetween(*received_initial_metadata_,
+                                   *send_trailing_metadata_));
+    }
+  }
+  void RecordSendMessage(const Message& /*send_message*/) override {}
+  void RecordSendCompressedMessage(
+      const Message& /*send_compressed_message*/) override {}
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* /*recv_initial_metadata*/) override {
+    received_initial_metadata_ = gpr_get_cycle_counter();
+    RecordSeconds(stats_plugin_group_, kMetricServerCallFilterDuration,
+                  SecondsBetween(start_, *received_initial_metadata_));
+  }
+  void RecordReceivedMessage(const Message& /*recv_message*/) override {}
+  void RecordReceivedDecompressedMessage(
+      const Message& /*recv_decompressed_message*/) override {}
+  void RecordReceivedTrailingMetadata(
+      grpc_metadata_batch* /*recv_trailing_metadata*/) override {}
+  void RecordCancel(grpc_error_handle /*cancel_error*/) override {}
+  void RecordEnd(const grpc_call_final_info* /*final_info*/) override {
+    if (send_trailing_metadata_.has_value()) {
+      RecordSeconds(
+          stats_plugin_group_, kMetricServerCallWriteDuration,
+          SecondsBetween(*send_trailing_metadata_, gpr_get_cycle_counter()));
+    }
+  }
+  void RecordIncomingBytes(
+      const TransportByteSize& /*transport_byte_size*/) override {}
+  void RecordOutgoingBytes(
+      const TransportByteSize& /*transport_byte_size*/) override {}
+  void RecordAnnotation(absl::string_view /*annotation*/) override {}
+  void RecordAnnotation(const Annotation& /*annotation*/) override {}
+  std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
+    return nullptr;
+  }
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+ private:
+  GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group_;
+  const gpr_cycle_counter start_;
+  std::optional<gpr_cycle_counter> received_initial_metadata_;
+  std::optional<gpr_cycle_counter> send_trailing_metadata_;
+};
+
+}  // namespace
+
+void MaybeAddLatencyBreakdownClientCallTracer(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    Arena* arena) {
+  if (!stats_plugin_group.IsInstrumentEnabled(kMetricClientCallSetupDuration) &&
+      !stats_plugin_group.IsInstrumentEnabled(
+          kMetricClientAttemptPickDuration) &&
+      !stats_plugin_group.IsInstrumentEnabled(
+          kMetricClientAttemptWriteQueueDuration) &&
+      !stats_plugin_group.IsInstrumentEnabled(
+          kMetricClientAttemptWireDuration) &&
+      !stats_plugin_group.IsInstrumentEnabled(
+          kMetricClientAttemptResponseDuration)) {
+    return;
+  }
+  AddClientCallTracerToContext(
+      arena,
+      arena->ManagedNew<LatencyBreakdownClientCallTracer>(stats_plugin_group,
+                                                          arena));
+}
+
+void MaybeAddLatencyBreakdownServerCallTracer(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    Arena* arena) {
+  if (!stats_plugin_group.IsInstrumentEnabled(
+          kMetricServerCallFilterDuration) &&
+      !stats_plugin_group.IsInstrumentEnabled(
+          kMetricServerCallHandlerDuration) &&
+      !stats_plugin_group.IsInstrumentEnabled(
+          kMetricServerCallWriteDuration)) {
+    return;
+  }
+  AddServerCallTracerToContext(
+      arena,
+      arena->ManagedNew<LatencyBreakdownServerCallTracer>(stats_plugin_group));
+}
+
+}  // namespace grpc_core
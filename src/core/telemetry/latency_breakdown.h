@@ -0,0 +1,75 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_LATENCY_BREAKDOWN_H
+#define GRPC_SRC_CORE_TELEMETRY_LATENCY_BREAKDOWN_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/telemetry/metrics.h"
+
+// Call tracers that break the latency of a call down into the stages it goes
+// through inside gRPC, and record the time spent in each stage to histograms
+// in the stats plugins. The histograms are disabled by default; the tracers
+// are only added to calls for which a stats plugin enables one of them.
+//
+// On clients, per call:
+//   grpc.client.call.setup_duration: from the creation of the call to the
+//     start of its first attempt (name resolution, config selection and the
+//     filters above the load balanced call).
+// and per attempt:
+//   grpc.client.attempt.pick_duration: waiting for an LB pick, which includes
+//     waiting for a subchannel to connect.
+//   grpc.client.attempt.write_queue_duration: from the attempt being handed
+//     to the transport to sendmsg() returning for its first byte.
+//   grpc.client.attempt.wire_duration: from sendmsg() returning for the first
+//     byte to the byte being sent by the NIC.
+//   grpc.client.attempt.response_duration: from the attempt being handed to
+//     the transport to its trailing metadata being received.
+// The write queue and wire durations come from TCP timestamps
+// (SO_TIMESTAMPING), and so are only recorded when the endpoint supports
+// them.
+//
+// On servers, per call:
+//   grpc.server.call.filter_duration: from the creation of the call to its
+//     initial metadata having gone through the filters.
+//   grpc.server.call.handler_duration: from there to the trailing metadata
+//     being sent, which includes queueing on the completion queue or executor
+//     before the handler runs.
+//   grpc.server.call.write_duration: from the trailing metadata being sent to
+//     the end of the call.
+
+namespace grpc_core {
+
+// Adds a latency breakdown tracer to a client call, if a stats plugin in
+// \a stats_plugin_group enables one of the client histograms. Must be called
+// after the stats plugins have added their own call tracers.
+void MaybeAddLatencyBreakdownClientCallTracer(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    Arena* arena);
+
+// Adds a latency breakdown tracer to a server call, if a stats plugin in
+// \a stats_plugin_group enables one of the server histograms.
+void MaybeAddLatencyBreakdownServerCallTracer(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    Arena* arena);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_LATENCY_BREAKDOWN_H
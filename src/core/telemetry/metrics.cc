@@ -16,6 +16,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 
@@ -99,6 +100,147 @@ RegisteredMetricCallback::~RegisteredMetricCallback() {
   }
 }
 
+PreAggregatedMetric::PreAggregatedMetric(
+    GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+    GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+    absl::Span<const absl::string_view> label_values,
+    absl::Span<const absl::string_view> optional_values,
+    absl::Span<const double> bucket_boundaries)
+    : stats_plugin_group_(stats_plugin_group),
+      handle_(handle),
+      bucket_boundaries_(bucket_boundaries.begin(), bucket_boundaries.end()) {
+  DCHECK(std::is_sorted(bucket_boundaries_.begin(), bucket_boundaries_.end()));
+  const auto& descriptor =
+      GlobalInstrumentsRegistry::GetInstrumentDescriptor(handle);
+  value_type_ = descriptor.value_type;
+  instrument_type_ = descriptor.instrument_type;
+  // Copy the label values first, so that the views into them stay valid.
+  label_storage_.reserve(label_values.size() + optional_values.size());
+  for (absl::string_view value : label_values) {
+    label_storage_.emplace_back(value);
+  }
+  for (absl::string_view value : optional_values) {
+    label_storage_.emplace_back(value);
+  }
+  label_values_.assign(label_storage_.begin(),
+                       label_storage_.begin() + label_values.size());
+  optional_label_values_.assign(label_storage_.begin() + label_values.size(),
+                                label_storage_.end());
+  if (instrument_type_ ==
+      GlobalInstrumentsRegistry::InstrumentType::kHistogram) {
+    for (Shard& shard : shards_) {
+      shard.bucket_counts.reset(
+          new std::atomic<uint64_t>[bucket_boundaries_.size() + 1]);
+      for (size_t i = 0; i <= bucket_boundaries_.size(); ++i) {
+        shard.bucket_counts[i].store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+  for (auto& state : stats_plugin_group_.plugins_state_) {
+    if (state.plugin->AddPreAggregatedMetric(this)) {
+      aggregated_ = true;
+    } else {
+      unaggregated_plugins_.push_back(state.plugin.get());
+    }
+  }
+}
+
+PreAggregatedMetric::~PreAggregatedMetric() {
+  for (auto& state : stats_plugin_group_.plugins_state_) {
+    if (std::find(unaggregated_plugins_.begin(), unaggregated_plugins_.end(),
+                  state.plugin.get()) == unaggregated_plugins_.end()) {
+      state.plugin->RemovePreAggregatedMetric(this);
+    }
+  }
+}
+
+void PreAggregatedMetric::Add(uint64_t value) {
+  DCHECK(instrument_type_ ==
+             GlobalInstrumentsRegistry::InstrumentType::kCounter &&
+         value_type_ == GlobalInstrumentsRegistry::ValueType::kUInt64);
+  if (aggregated_) {
+    shards_.this_cpu().uint64_value.fetch_add(value,
+                                              std::memory_order_relaxed);
+  }
+  for (StatsPlugin* plugin : unaggregated_plugins_) {
+    plugin->AddCounter(handle_, value, label_values_, optional_label_values_);
+  }
+}
+
+void PreAggregatedMetric::Add(double value) {
+  DCHECK(instrument_type_ ==
+             GlobalInstrumentsRegistry::InstrumentType::kCounter &&
+         value_type_ == GlobalInstrumentsRegistry::ValueType::kDouble);
+  if (aggregated_) AddDouble(shards_.this_cpu().double_value, value);
+  for (StatsPlugin* plugin : unaggregated_plugins_) {
+    plugin->AddCounter(handle_, value, label_values_, optional_label_values_);
+  }
+}
+
+void PreAggregatedMetric::Record(uint64_t value) {
+  DCHECK(instrument_type_ ==
+             GlobalInstrumentsRegistry::InstrumentType::kHistogram &&
+         value_type_ == GlobalInstrumentsRegistry::ValueType::kUInt64);
+  if (aggregated_) RecordInBucket(static_cast<double>(value));
+  for (StatsPlugin* plugin : unaggregated_plugins_) {
+    plugin->RecordHistogram(handle_, value, label_values_,
+                            optional_label_values_);
+  }
+}
+
+void PreAggregatedMetric::Record(double value) {
+  DCHECK(instrument_type_ ==
+             GlobalInstrumentsRegistry::InstrumentType::kHistogram &&
+         value_type_ == GlobalInstrumentsRegistry::ValueType::kDouble);
+  if (aggregated_) RecordInBucket(value);
+  for (StatsPlugin* plugin : unaggregated_plugins_) {
+    plugin->RecordHistogram(handle_, value, label_values_,
+                            optional_label_values_);
+  }
+}
+
+void PreAggregatedMetric::RecordInBucket(double value) {
+  // Buckets include their upper bound.
+  size_t bucket = std::lower_bound(bucket_boundaries_.begin(),
+                                   bucket_boundaries_.end(), value) -
+                  bucket_boundaries_.begin();
+  Shard& shard = shards_.this_cpu();
+  shard.bucket_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+  AddDouble(shard.double_value, value);
+}
+
+uint64_t PreAggregatedMetric::UInt64CounterValue() const {
+  uint64_t total = 0;
+  for (const Shard& shard : shards_) {
+    total += shard.uint64_value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+double PreAggregatedMetric::DoubleCounterValue() const {
+  double total = 0;
+  for (const Shard& shard : shards_) {
+    total += shard.double_value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+PreAggregatedMetric::HistogramData PreAggregatedMetric::GetHistogramData()
+    const {
+  HistogramData data;
+  data.bucket_boundaries = bucket_boundaries_;
+  data.bucket_counts.resize(bucket_boundaries_.size() + 1);
+  for (const Shard& shard : shards_) {
+    for (size_t i = 0; i < data.bucket_counts.size(); ++i) {
+      data.bucket_counts[i] +=
+          shard.bucket_counts[i].load(std::memory_order_relaxed);
+    }
+    data.sum += shard.double_value.load(std::memory_order_relaxed);
+  }
+  for (uint64_t bucket_count : data.bucket_counts) data.count += bucket_count;
+  return data;
+}
+
 void GlobalStatsPluginRegistry::StatsPluginGroup::AddClientCallTracers(
     const Slice& path, bool registered_method, Arena* arena) {
   for (auto& state : plugins_state_) {
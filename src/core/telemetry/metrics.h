@@ -18,8 +18,10 @@
 #include <grpc/support/metrics.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -31,6 +33,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/no_destruct.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 
@@ -266,6 +269,7 @@ class CallbackMetricReporter {
 };
 
 class RegisteredMetricCallback;
+class PreAggregatedMetric;
 
 // The StatsPlugin interface.
 class StatsPlugin {
@@ -336,6 +340,17 @@ class StatsPlugin {
   // Removes a callback previously added via AddCallback().  The stats
   // plugin may not use the callback after this method returns.
   virtual void RemoveCallback(RegisteredMetricCallback* callback) = 0;
+  // Adds a label set of a counter or histogram whose measurements are
+  // aggregated in \a metric, for the stats plugin to read when it collects
+  // metrics instead of getting each of them through AddCounter() or
+  // RecordHistogram(). Returns false if the stats plugin does not read
+  // pre-aggregated metrics, in which case it still gets every measurement.
+  virtual bool AddPreAggregatedMetric(PreAggregatedMetric* /*metric*/) {
+    return false;
+  }
+  // Removes a metric previously accepted by AddPreAggregatedMetric(). The
+  // stats plugin may not use the metric after this method returns.
+  virtual void RemovePreAggregatedMetric(PreAggregatedMetric* /*metric*/) {}
   // Returns true if instrument \a handle is enabled.
   virtual bool IsInstrumentEnabled(
       GlobalInstrumentsRegistry::GlobalInstrumentHandle handle) const = 0;
@@ -463,6 +478,25 @@ class GlobalStatsPluginRegistry {
     RegisterCallback(absl::AnyInvocable<void(CallbackMetricReporter&)> callback,
                      Duration min_interval, Args... args);
 
+    // Binds a label set of a counter or histogram ahead of time, for code that
+    // records to it often. Measurements recorded to the returned object only
+    // update per-CPU state for the stats plugins that read pre-aggregated
+    // metrics when they collect; the other stats plugins get each of them as
+    // with AddCounter() and RecordHistogram(). Histogram values are counted in
+    // buckets whose upper bounds are \a bucket_boundaries, in increasing
+    // order, plus an unbounded last bucket.
+    //
+    // The returned object must not outlive the StatsPluginGroup object that
+    // created it.
+    template <GlobalInstrumentsRegistry::ValueType V,
+              GlobalInstrumentsRegistry::InstrumentType I, size_t M, size_t N>
+    GRPC_MUST_USE_RESULT std::unique_ptr<PreAggregatedMetric> BindLabels(
+        GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<V, I, M, N>
+            handle,
+        std::array<absl::string_view, M> label_values,
+        std::array<absl::string_view, N> optional_values,
+        absl::Span<const double> bucket_boundaries = {});
+
     // Adds all available client call tracers associated with the stats plugins
     // within the group to \a call_context.
     void AddClientCallTracers(const Slice& path, bool registered_method,
@@ -473,6 +507,7 @@ class GlobalStatsPluginRegistry {
 
    private:
     friend class RegisteredMetricCallback;
+    friend class PreAggregatedMetric;
 
     struct PluginState {
       std::shared_ptr<StatsPlugin::ScopeConfig> scope_config;
@@ -546,6 +581,107 @@ class RegisteredMetricCallback {
   Duration min_interval_;
 };
 
+// A label set of a counter or histogram, bound ahead of time by
+// StatsPluginGroup::BindLabels(). Recording to it adds to per-CPU totals, which
+// stats plugins that accepted it in AddPreAggregatedMetric() read when they
+// collect metrics.
+class PreAggregatedMetric {
+ public:
+  // The state of a histogram, summed across CPUs.
+  struct HistogramData {
+    // Upper bounds of every bucket but the last, which is unbounded.
+    absl::Span<const double> bucket_boundaries;
+    // The number of values in each bucket.
+    std::vector<uint64_t> bucket_counts;
+    uint64_t count = 0;
+    double sum = 0;
+  };
+
+  PreAggregatedMetric(
+      GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group,
+      GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+      absl::Span<const absl::string_view> label_values,
+      absl::Span<const absl::string_view> optional_values,
+      absl::Span<const double> bucket_boundaries);
+
+  ~PreAggregatedMetric();
+
+  PreAggregatedMetric(const PreAggregatedMetric&) = delete;
+  PreAggregatedMetric& operator=(const PreAggregatedMetric&) = delete;
+
+  // Adds \a value to a counter. The type of \a value must match the value
+  // type of the counter.
+  void Add(uint64_t value);
+  void Add(double value);
+  // Records \a value to a histogram. The type of \a value must match the
+  // value type of the histogram.
+  void Record(uint64_t value);
+  void Record(double value);
+
+  GlobalInstrumentsRegistry::GlobalInstrumentHandle handle() const {
+    return handle_;
+  }
+  absl::Span<const absl::string_view> label_values() const {
+    return label_values_;
+  }
+  absl::Span<const absl::string_view> optional_label_values() const {
+    return optional_label_values_;
+  }
+
+  // Returns the total of a uint64 counter.
+  uint64_t UInt64CounterValue() const;
+  // Returns the total of a double counter.
+  double DoubleCounterValue() const;
+  // Returns the state of a histogram.
+  HistogramData GetHistogramData() const;
+
+ private:
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    std::atomic<uint64_t> uint64_value{0};
+    std::atomic<double> double_value{0};
+    std::unique_ptr<std::atomic<uint64_t>[]> bucket_counts;
+  };
+
+  static void AddDouble(std::atomic<double>& total, double value) {
+    double current = total.load(std::memory_order_relaxed);
+    while (!total.compare_exchange_weak(current, current + value,
+                                        std::memory_order_relaxed)) {
+    }
+  }
+
+  void RecordInBucket(double value);
+
+  GlobalStatsPluginRegistry::StatsPluginGroup& stats_plugin_group_;
+  const GlobalInstrumentsRegistry::GlobalInstrumentHandle handle_;
+  GlobalInstrumentsRegistry::ValueType value_type_;
+  GlobalInstrumentsRegistry::InstrumentType instrument_type_;
+  std::vector<std::string> label_storage_;
+  std::vector<absl::string_view> label_values_;
+  std::vector<absl::string_view> optional_label_values_;
+  std::vector<double> bucket_boundaries_;
+  // Stats plugins that do not read pre-aggregated metrics, and so get each
+  // measurement as it is recorded.
+  std::vector<StatsPlugin*> unaggregated_plugins_;
+  // Whether any stats plugin reads the per-CPU totals.
+  bool aggregated_ = false;
+  PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
+};
+
+template <GlobalInstrumentsRegistry::ValueType V,
+          GlobalInstrumentsRegistry::InstrumentType I, size_t M, size_t N>
+inline std::unique_ptr<PreAggregatedMetric>
+GlobalStatsPluginRegistry::StatsPluginGroup::BindLabels(
+    GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<V, I, M, N> handle,
+    std::array<absl::string_view, M> label_values,
+    std::array<absl::string_view, N> optional_values,
+    absl::Span<const double> bucket_boundaries) {
+  static_assert(I == GlobalInstrumentsRegistry::InstrumentType::kCounter ||
+                    I == GlobalInstrumentsRegistry::InstrumentType::kHistogram,
+                "InstrumentType must be kCounter or kHistogram");
+  return std::make_unique<PreAggregatedMetric>(
+      *this, handle, label_values, optional_values, bucket_boundaries);
+}
+
 template <typename... Args>
 inline std::unique_ptr<RegisteredMetricCallback>
 GlobalStatsPluginRegistry::StatsPluginGroup::RegisterCallback(
@@ -0,0 +1,384 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/telemetry/slow_call_capture.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/transport/message.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Limits the memory a call with many messages can use for its timeline.
+constexpr size_t kMaxEventsPerCall = 64;
+
+std::atomic<bool> g_enabled{false};
+
+struct SinkConfig {
+  Mutex mu;
+  std::shared_ptr<SlowCallSink> sink ABSL_GUARDED_BY(mu);
+  Duration threshold ABSL_GUARDED_BY(mu);
+};
+
+SinkConfig& GetSinkConfig() {
+  static NoDestruct<SinkConfig> config;
+  return *config;
+}
+
+// Returns the sink and threshold that apply to a call created now, or a null
+// sink if capture is off.
+std::pair<std::shared_ptr<SlowCallSink>, Duration> CurrentSink() {
+  if (!g_enabled.load(std::memory_order_relaxed)) return {nullptr, Duration()};
+  SinkConfig& config = GetSinkConfig();
+  MutexLock lock(&config.mu);
+  return {config.sink, config.threshold};
+}
+
+Duration DurationBetween(gpr_cycle_counter start, gpr_cycle_counter end) {
+  return Duration::FromTimespec(gpr_cycle_counter_sub(end, start));
+}
+
+// The events of a call. The methods of a call tracer may be called from
+// several threads at once, so everything is kept under a lock.
+class Timeline {
+ public:
+  Timeline(std::shared_ptr<SlowCallSink> sink, Duration threshold,
+           bool is_client)
+      : sink_(std::move(sink)),
+        threshold_(threshold),
+        start_(gpr_get_cycle_counter()) {
+    report_.is_client = is_client;
+  }
+
+  void Add(absl::string_view prefix, std::string description) {
+    const gpr_cycle_counter now = gpr_get_cycle_counter();
+    MutexLock lock(&mu_);
+    if (report_.events.size() >= kMaxEventsPerCall) {
+      ++report_.dropped_events;
+      return;
+    }
+    report_.events.push_back(SlowCallSink::Event{
+        DurationBetween(start_, now),
+        prefix.empty() ? std::move(description)
+                       : absl::StrCat(prefix, description)});
+  }
+
+  void AddBytes(uint64_t outgoing_bytes, uint64_t incoming_bytes) {
+    MutexLock lock(&mu_);
+    report_.outgoing_bytes += outgoing_bytes;
+    report_.incoming_bytes += incoming_bytes;
+  }
+
+  void SetMethod(absl::string_view method) {
+    MutexLock lock(&mu_);
+    report_.method = std::string(method);
+  }
+
+  void MaybeSetPeer(grpc_metadata_batch* metadata) {
+    const Slice* peer = metadata->get_pointer(PeerString());
+    if (peer == nullptr) return;
+    MutexLock lock(&mu_);
+    report_.peer = std::string(peer->as_string_view());
+  }
+
+  // Marks the end of the call, or of an attempt of a client call, so far.
+  void End(absl::Status status) {
+    const gpr_cycle_counter now = gpr_get_cycle_counter();
+    MutexLock lock(&mu_);
+    end_ = now;
+    report_.status = std::move(status);
+  }
+
+  // Writes the report to the sink if the call was slow. Called once the
+  // call has ended.
+  void MaybeReport() {
+    std::optional<SlowCallSink::Report> report;
+    {
+      MutexLock lock(&mu_);
+      if (!end_.has_value()) return;
+      const Duration duration = DurationBetween(start_, *end_);
+      if (duration < threshold_) return;
+      report_.duration = duration;
+      report = std::move(report_);
+    }
+    sink_->OnSlowCall(std::move(*report));
+  }
+
+ private:
+  const std::shared_ptr<SlowCallSink> sink_;
+  const Duration threshold_;
+  const gpr_cycle_counter start_;
+  Mutex mu_;
+  std::optional<gpr_cycle_counter> end_ ABSL_GUARDED_BY(mu_);
+  SlowCallSink::Report report_ ABSL_GUARDED_BY(mu_);
+};
+
+std::string MessageDescription(absl::string_view what,
+                               const Message& message) {
+  return absl::StrCat(what, " (", message.payload()->Length(), " bytes)");
+}
+
+uint64_t TotalBytes(const CallTracerInterface::TransportByteSize& size) {
+  return size.framing_bytes + size.data_bytes + size.header_bytes;
+}
+
+class SlowCallCaptureClientCallTracer final : public ClientCallTracer {
+ public:
+  class CallAttemptTracer final : public ClientCallTracer::CallAttemptTracer {
+   public:
+    CallAttemptTracer(Timeline* timeline, std::string prefix)
+        : timeline_(timeline), prefix_(std::move(prefix)) {}
+
+    void RecordSendInitialMetadata(
+        grpc_metadata_batch* /*send_initial_metadata*/) override {
+      timeline_->Add(prefix_, "sent initial metadata");
+    }
+    void RecordSendTrailingMetadata(
+        grpc_metadata_batch* /*send_trailing_metadata*/) override {
+      timeline_->Add(prefix_, "half-closed");
+    }
+    void RecordSendMessage(const Message& send_message) override {
+      timeline_->Add(prefix_, MessageDescription("sent message", send_message));
+    }
+    void RecordSendCompressedMessage(
+        const Message& send_compressed_message) override {
+      timeline_->Add(prefix_, MessageDescription("compressed message",
+                                                 send_compressed_message));
+    }
+    void RecordReceivedInitialMetadata(
+        grpc_metadata_batch* recv_initial_metadata) override {
+      timeline_->MaybeSetPeer(recv_initial_metadata);
+      timeline_->Add(prefix_, "received initial metadata");
+    }
+    void RecordReceivedMessage(const Message& recv_message) override {
+      timeline_->Add(prefix_,
+                     MessageDescription("received message", recv_message));
+    }
+    void RecordReceivedDecompressedMessage(
+        const Message& recv_decompressed_message) override {
+      timeline_->Add(prefix_, MessageDescription("decompressed message",
+                                                 recv_decompressed_message));
+    }
+    void RecordReceivedTrailingMetadata(
+        absl::Status status, grpc_metadata_batch* /*recv_trailing_metadata*/,
+        const grpc_transport_stream_stats* /*transport_stream_stats*/)
+        override {
+      timeline_->Add(prefix_, absl::StrCat("received trailing metadata: ",
+                                           StatusToString(status)));
+      status_ = std::move(status);
+    }
+    void RecordCancel(grpc_error_handle cancel_error) override {
+      timeline_->Add(prefix_,
+                     absl::StrCat("cancelled: ", StatusToString(cancel_error)));
+      if (status_.ok()) status_ = std::move(cancel_error);
+    }
+    void RecordEnd(const gpr_timespec& /*latency*/) override {
+      timeline_->Add(prefix_, "ended");
+      timeline_->End(status_);
+    }
+    void RecordIncomingBytes(
+        const TransportByteSize& transport_byte_size) override {
+      timeline_->AddBytes(0, TotalBytes(transport_byte_size));
+    }
+    void RecordOutgoingBytes(
+        const TransportByteSize& transport_byte_size) override {
+      timeline_->AddBytes(TotalBytes(transport_byte_size), 0);
+    }
+    void SetOptionalLabel(OptionalLabelKey /*key*/,
+                          RefCountedStringValue /*value*/) override {}
+    void RecordAnnotation(absl::string_view annotation) override {
+      timeline_->Add(prefix_, std::string(annotation));
+    }
+    void RecordAnnotation(const Annotation& annotation) override {
+      timeline_->Add(prefix_, annotation.ToString());
+    }
+    std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
+      return nullptr;
+    }
+    std::string TraceId() override { return ""; }
+    std::string SpanId() override { return ""; }
+    bool IsSampled() override { return false; }
+
+   private:
+    Timeline* const timeline_;
+    const std::string prefix_;
+    absl::Status status_;
+  };
+
+  SlowCallCaptureClientCallTracer(std::shared_ptr<SlowCallSink> sink,
+                                  Duration threshold, absl::string_view method,
+                                  Arena* arena)
+      : timeline_(std::move(sink), threshold, /*is_client=*/true),
+        arena_(arena) {
+    timeline_.SetMethod(method);
+  }
+
+  // The call has ended once the arena is destroyed, so this is the first
+  // point where no more attempts can be started.
+  ~SlowCallCaptureClientCallTracer() override { timeline_.MaybeReport(); }
+
+  CallAttemptTracer* StartNewAttempt(bool is_transparent_retry) override {
+    const uint32_t attempt = attempts_.fetch_add(1, std::memory_order_relaxed);
+    timeline_.Add("", absl::StrCat("started attempt ", attempt,
+                                   is_transparent_retry
+                                       ? " (transparent retry)"
+                                       : ""));
+    return arena_->ManagedNew<CallAttemptTracer>(
+        &timeline_, absl::StrCat("attempt ", attempt, ": "));
+  }
+  void RecordAnnotation(absl::string_view annotation) override {
+    timeline_.Add("", std::string(annotation));
+  }
+  void RecordAnnotation(const Annotation& annotation) override {
+    timeline_.Add("", annotation.ToString());
+  }
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+ private:
+  Timeline timeline_;
+  Arena* const arena_;
+  std::atomic<uint32_t> attempts_{0};
+};
+
+class SlowCallCaptureServerCallTracer final : public ServerCallTracer {
+ public:
+  SlowCallCaptureServerCallTracer(std::shared_ptr<SlowCallSink> sink,
+                                  Duration threshold)
+      : timeline_(std::move(sink), threshold, /*is_client=*/false) {}
+
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* /*send_initial_metadata*/) override {
+    timeline_.Add("", "sent initial metadata");
+  }
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* /*send_trailing_metadata*/) override {
+    timeline_.Add("", "sent trailing metadata");
+  }
+  void RecordSendMessage(const Message& send_message) override {
+    timeline_.Add("", MessageDescription("sent message", send_message));
+  }
+  void RecordSendCompressedMessage(
+      const Message& send_compressed_message) override {
+    timeline_.Add(
+        "", MessageDescription("compressed message", send_compressed_message));
+  }
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* recv_initial_metadata) override {
+    const Slice* path = recv_initial_metadata->get_pointer(HttpPathMetadata());
+    if (path != nullptr) timeline_.SetMethod(path->as_string_view());
+    timeline_.MaybeSetPeer(recv_initial_metadata);
+    timeline_.Add("", "received initial metadata");
+  }
+  void RecordReceivedMessage(const Message& recv_message) override {
+    timeline_.Add("", MessageDescription("received message", recv_message));
+  }
+  void RecordReceivedDecompressedMessage(
+      const Message& recv_decompressed_message) override {
+    timeline_.Add("", MessageDescription("decompressed message",
+                                         recv_decompressed_message));
+  }
+  void RecordReceivedTrailingMetadata(
+      grpc_metadata_batch* /*recv_trailing_metadata*/) override {
+    timeline_.Add("", "half-closed");
+  }
+  void RecordCancel(grpc_error_handle cancel_error) override {
+    timeline_.Add("",
+                  absl::StrCat("cancelled: ", StatusToString(cancel_error)));
+  }
+  void RecordEnd(const grpc_call_final_info* final_info) override {
+    absl::Status status;
+    if (final_info != nullptr && final_info->final_status != GRPC_STATUS_OK) {
+      status = absl::Status(
+          static_cast<absl::StatusCode>(final_info->final_status),
+          final_info->error_string == nullptr ? "" : final_info->error_string);
+    }
+    timeline_.Add("", "ended");
+    timeline_.End(std::move(status));
+    timeline_.MaybeReport();
+  }
+  void RecordIncomingBytes(
+      const TransportByteSize& transport_byte_size) override {
+    timeline_.AddBytes(0, TotalBytes(transport_byte_size));
+  }
+  void RecordOutgoingBytes(
+      const TransportByteSize& transport_byte_size) override {
+    timeline_.AddBytes(TotalBytes(transport_byte_size), 0);
+  }
+  void RecordAnnotation(absl::string_view annotation) override {
+    timeline_.Add("", std::string(annotation));
+  }
+  void RecordAnnotation(const Annotation& annotation) override {
+    timeline_.Add("", annotation.ToString());
+  }
+  std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
+    return nullptr;
+  }
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+ private:
+  Timeline timeline_;
+};
+
+}  // namespace
+
+void SetSlowCallSink(std::shared_ptr<SlowCallSink> sink, Duration threshold) {
+  SinkConfig& config = GetSinkConfig();
+  MutexLock lock(&config.mu);
+  g_enabled.store(sink != nullptr, std::memory_order_relaxed);
+  config.sink = std::move(sink);
+  config.threshold = threshold;
+}
+
+void MaybeAddSlowCallCaptureClientCallTracer(const Slice& path, Arena* arena) {
+  auto sink = CurrentSink();
+  if (sink.first == nullptr) return;
+  AddClientCallTracerToContext(
+      arena, arena->ManagedNew<SlowCallCaptureClientCallTracer>(
+                 std::move(sink.first), sink.second, path.as_string_view(),
+                 arena));
+}
+
+void MaybeAddSlowCallCaptureServerCallTracer(Arena* arena) {
+  auto sink = CurrentSink();
+  if (sink.first == nullptr) return;
+  AddServerCallTracerToContext(
+      arena, arena->ManagedNew<SlowCallCaptureServerCallTracer>(
+                 std::move(sink.first), sink.second));
+}
+
+}  // namespace grpc_core
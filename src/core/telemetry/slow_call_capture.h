@@ -0,0 +1,94 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_SLOW_CALL_CAPTURE_H
+#define GRPC_SRC_CORE_TELEMETRY_SLOW_CALL_CAPTURE_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/time.h"
+
+// Opt-in capture of what happened during calls that turn out to be slow.
+//
+// Once a sink is set with SetSlowCallSink(), every call keeps a timeline of
+// its events: metadata and messages going each way, cancellation, and the
+// annotations recorded by the channel and the transport (chttp2 annotations
+// carry the transport and stream flow control windows and the target write
+// size at the time they are recorded). When a call takes at least the
+// threshold, its timeline is written to the sink. Timelines of faster calls
+// are dropped without being formatted any further.
+//
+// For client calls, the duration runs from the creation of the call to the
+// end of its last attempt, and the events of all attempts are in one
+// timeline. For server calls, it runs from the creation of the call to its
+// end.
+
+namespace grpc_core {
+
+// Receives reports of slow calls. Reports are written from the thread that
+// ends the call, so a sink must not block.
+class SlowCallSink {
+ public:
+  struct Event {
+    // Time from the creation of the call.
+    Duration offset;
+    std::string description;
+  };
+
+  struct Report {
+    bool is_client = false;
+    // The method of the call, if known.
+    std::string method;
+    // The address of the peer, if known.
+    std::string peer;
+    Duration duration;
+    absl::Status status;
+    uint64_t outgoing_bytes = 0;
+    uint64_t incoming_bytes = 0;
+    std::vector<Event> events;
+    // Events beyond the limit of a timeline are dropped and counted here.
+    uint32_t dropped_events = 0;
+  };
+
+  virtual ~SlowCallSink() = default;
+
+  virtual void OnSlowCall(Report report) = 0;
+};
+
+// Writes reports of calls that take at least \a threshold to \a sink, from
+// the calls created from now on. Replaces any sink set before; a null sink
+// turns capture off.
+void SetSlowCallSink(std::shared_ptr<SlowCallSink> sink, Duration threshold);
+
+// Adds slow call capture to a client call for \a path, if a sink is set.
+void MaybeAddSlowCallCaptureClientCallTracer(const Slice& path, Arena* arena);
+
+// Adds slow call capture to a server call, if a sink is set.
+void MaybeAddSlowCallCaptureServerCallTracer(Arena* arena);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_SLOW_CALL_CAPTURE_H
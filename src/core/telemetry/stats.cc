@@ -22,6 +22,8 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/str_cat.h"
@@ -29,6 +31,14 @@
 
 namespace grpc_core {
 
+std::unique_ptr<GlobalStats> GlobalStatsDelta::Delta() {
+  MutexLock lock(&mu_);
+  std::unique_ptr<GlobalStats> now = global_stats().Collect();
+  std::unique_ptr<GlobalStats> delta = now->Diff(*last_);
+  last_ = std::move(now);
+  return delta;
+}
+
 namespace stats_detail {
 
 namespace {
@@ -22,14 +22,17 @@
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "src/core/telemetry/histogram_view.h"
 #include "src/core/telemetry/stats_data.h"
 #include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -37,6 +40,23 @@ inline GlobalStatsCollector& global_stats() {
   return *NoDestructSingleton<GlobalStatsCollector>::Get();
 }
 
+// Snapshots the global stats incrementally: each call to Delta() returns only
+// what changed since the previous call, so that an exporter that reports on
+// a period neither keeps its own baseline nor reports the same increments
+// twice.
+// Thread-safe.
+class GlobalStatsDelta {
+ public:
+  // The first delta is taken against the stats at construction.
+  GlobalStatsDelta() : last_(global_stats().Collect()) {}
+
+  std::unique_ptr<GlobalStats> Delta() ABSL_LOCKS_EXCLUDED(mu_);
+
+ private:
+  Mutex mu_;
+  std::unique_ptr<GlobalStats> last_ ABSL_GUARDED_BY(mu_);
+};
+
 namespace stats_detail {
 std::string StatsAsJson(absl::Span<const uint64_t> counters,
                         absl::Span<const absl::string_view> counter_name,
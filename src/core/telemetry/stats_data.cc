@@ -127,6 +127,7 @@ const absl::string_view
         "client_subchannels_created",
         "server_channels_created",
         "insecure_connections_created",
+        "arena_zone_allocations",
         "rq_connections_dropped",
         "rq_calls_dropped",
         "rq_calls_rejected",
@@ -134,6 +135,11 @@ const absl::string_view
         "syscall_read",
         "tcp_read_alloc_8k",
         "tcp_read_alloc_64k",
+        "tcp_zerocopy_completions",
+        "tcp_zerocopy_copied",
+        "tcp_zerocopy_threshold_changes",
+        "tcp_info_samples",
+        "tcp_info_app_limited_samples",
         "http2_settings_writes",
         "http2_pings_sent",
         "http2_writes_begun",
@@ -158,6 +164,12 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "exec_ctx_flushes",
+        "combiner_offloads",
+        "combiner_batch_deferrals",
+        "combiner_budget_offloads",
+        "party_wakeups",
+        "party_wakeup_offloads",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -167,6 +179,8 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of client subchannels created",
     "Number of server channels created",
     "Number of insecure connections created",
+    "Number of times an arena outgrew its initial zone and allocated another "
+    "one",
     "Number of connections dropped due to resource quota exceeded",
     "Number of calls dropped due to resource quota exceeded",
     "Number of calls rejected (never started) due to resource quota exceeded",
@@ -175,6 +189,14 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of 8k allocations by the TCP subsystem for reading",
     "Number of 64k allocations by the TCP subsystem for reading",
+    "Number of zerocopy sendmsg calls whose completion was read from the error "
+    "queue",
+    "Number of zerocopy sendmsg calls for which the kernel fell back to copying "
+    "the data",
+    "Number of times a connection adapted its zerocopy send threshold",
+    "Number of TCP_INFO samples taken from connections",
+    "Number of TCP_INFO samples whose delivery rate was limited by the "
+    "application",
     "Number of settings frames sent",
     "Number of HTTP2 pings sent by process",
     "Number of HTTP2 writes initiated",
@@ -204,15 +226,32 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of ExecCtx flushes that ran at least one closure",
+    "Number of times a combiner offloaded its queued work to the event "
+    "engine",
+    "Number of times a contended combiner kept draining its queue on the "
+    "current thread instead of offloading, because it was within its batch "
+    "budget",
+    "Number of combiner offloads caused by a batch exceeding its closure or "
+    "time budget",
+    "Number of times a party was woken up to run",
+    "Number of party wakeups that were offloaded to the event engine because "
+    "another party was already queued on the thread",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
         "call_initial_size",
+        "call_final_size",
         "tcp_write_size",
         "tcp_write_iov_size",
         "tcp_read_size",
         "tcp_read_offer",
         "tcp_read_offer_iov_size",
+        "tcp_zerocopy_completion_latency",
+        "tcp_info_srtt",
+        "tcp_info_retransmits",
+        "tcp_info_rwnd_limited_percent",
+        "tcp_info_sndbuf_limited_percent",
         "http2_send_message_size",
         "http2_metadata_size",
         "http2_hpack_entry_lifetime",
@@ -246,15 +285,27 @@ const absl::string_view
         "chaotic_good_tcp_read_offer_control",
         "chaotic_good_tcp_write_size_data",
         "chaotic_good_tcp_write_size_control",
+        "exec_ctx_closures_per_flush",
+        "exec_ctx_flush_depth",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
     "Initial size of the grpc_call arena created at call start",
+    "Number of bytes of the grpc_call arena used by the end of the call",
     "Number of bytes offered to each syscall_write",
     "Number of byte segments offered to each syscall_write",
     "Number of bytes received by each syscall_read",
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
+    "Time in microseconds from a zerocopy sendmsg to its completion "
+    "notification",
+    "Smoothed RTT in microseconds of each TCP_INFO sample",
+    "Number of segments a connection retransmitted since its previous TCP_INFO "
+    "sample",
+    "Percentage of the busy time of a connection since its previous TCP_INFO "
+    "sample that was limited by the receive window of the peer",
+    "Percentage of the busy time of a connection since its previous TCP_INFO "
+    "sample that was limited by its send buffer",
     "Size of messages received by HTTP2 transport",
     "Number of bytes consumed by metadata, according to HPACK accounting rules",
     "Lifetime of HPACK entries in the cache (in milliseconds)",
@@ -290,6 +341,9 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes offered to each syscall_read in the control channel",
     "Number of bytes offered to each syscall_write in the data channel",
     "Number of bytes offered to each syscall_write in the control channel",
+    "Number of closures run by each ExecCtx flush that ran at least one",
+    "Number of batches of closures taken from the closure list by each "
+    "ExecCtx flush that ran at least one closure",
 };
 namespace {
 const int kStatsTable0[21] = {0,    1,    2,    4,     8,     15,    27,
@@ -490,6 +544,7 @@ GlobalStats::GlobalStats()
       client_subchannels_created{0},
       server_channels_created{0},
       insecure_connections_created{0},
+      arena_zone_allocations{0},
       rq_connections_dropped{0},
       rq_calls_dropped{0},
       rq_calls_rejected{0},
@@ -497,6 +552,11 @@ GlobalStats::GlobalStats()
       syscall_read{0},
       tcp_read_alloc_8k{0},
       tcp_read_alloc_64k{0},
+      tcp_zerocopy_completions{0},
+      tcp_zerocopy_copied{0},
+      tcp_zerocopy_threshold_changes{0},
+      tcp_info_samples{0},
+      tcp_info_app_limited_samples{0},
       http2_settings_writes{0},
       http2_pings_sent{0},
       http2_writes_begun{0},
@@ -520,7 +580,13 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      exec_ctx_flushes{0},
+      combiner_offloads{0},
+      combiner_batch_deferrals{0},
+      combiner_budget_offloads{0},
+      party_wakeups{0},
+      party_wakeup_offloads{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -528,6 +594,9 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kCallInitialSize:
       return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
                            call_initial_size.buckets()};
+    case Histogram::kCallFinalSize:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
+                           call_final_size.buckets()};
     case Histogram::kTcpWriteSize:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            tcp_write_size.buckets()};
@@ -543,6 +612,21 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kTcpReadOfferIovSize:
       return HistogramView{&Histogram_80_10::BucketFor, kStatsTable8, 10,
                            tcp_read_offer_iov_size.buckets()};
+    case Histogram::kTcpZerocopyCompletionLatency:
+      return HistogramView{&Histogram_1800000_40::BucketFor, kStatsTable12, 40,
+                           tcp_zerocopy_completion_latency.buckets()};
+    case Histogram::kTcpInfoSrtt:
+      return HistogramView{&Histogram_1800000_40::BucketFor, kStatsTable12, 40,
+                           tcp_info_srtt.buckets()};
+    case Histogram::kTcpInfoRetransmits:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           tcp_info_retransmits.buckets()};
+    case Histogram::kTcpInfoRwndLimitedPercent:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
+                           tcp_info_rwnd_limited_percent.buckets()};
+    case Histogram::kTcpInfoSndbufLimitedPercent:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
+                           tcp_info_sndbuf_limited_percent.buckets()};
     case Histogram::kHttp2SendMessageSize:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            http2_send_message_size.buckets()};
@@ -644,6 +728,12 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kChaoticGoodTcpWriteSizeControl:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            chaotic_good_tcp_write_size_control.buckets()};
+    case Histogram::kExecCtxClosuresPerFlush:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
+                           exec_ctx_closures_per_flush.buckets()};
+    case Histogram::kExecCtxFlushDepth:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
+                           exec_ctx_flush_depth.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -661,6 +751,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.server_channels_created.load(std::memory_order_relaxed);
     result->insecure_connections_created +=
         data.insecure_connections_created.load(std::memory_order_relaxed);
+    result->arena_zone_allocations +=
+        data.arena_zone_allocations.load(std::memory_order_relaxed);
     result->rq_connections_dropped +=
         data.rq_connections_dropped.load(std::memory_order_relaxed);
     result->rq_calls_dropped +=
@@ -673,6 +765,16 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.tcp_read_alloc_8k.load(std::memory_order_relaxed);
     result->tcp_read_alloc_64k +=
         data.tcp_read_alloc_64k.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_completions +=
+        data.tcp_zerocopy_completions.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_copied +=
+        data.tcp_zerocopy_copied.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_threshold_changes +=
+        data.tcp_zerocopy_threshold_changes.load(std::memory_order_relaxed);
+    result->tcp_info_samples +=
+        data.tcp_info_samples.load(std::memory_order_relaxed);
+    result->tcp_info_app_limited_samples +=
+        data.tcp_info_app_limited_samples.load(std::memory_order_relaxed);
     result->http2_settings_writes +=
         data.http2_settings_writes.load(std::memory_order_relaxed);
     result->http2_pings_sent +=
@@ -717,12 +819,32 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->exec_ctx_flushes +=
+        data.exec_ctx_flushes.load(std::memory_order_relaxed);
+    result->combiner_offloads +=
+        data.combiner_offloads.load(std::memory_order_relaxed);
+    result->combiner_batch_deferrals +=
+        data.combiner_batch_deferrals.load(std::memory_order_relaxed);
+    result->combiner_budget_offloads +=
+        data.combiner_budget_offloads.load(std::memory_order_relaxed);
+    result->party_wakeups += data.party_wakeups.load(std::memory_order_relaxed);
+    result->party_wakeup_offloads +=
+        data.party_wakeup_offloads.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
+    data.call_final_size.Collect(&result->call_final_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
     data.tcp_read_size.Collect(&result->tcp_read_size);
     data.tcp_read_offer.Collect(&result->tcp_read_offer);
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
+    data.tcp_zerocopy_completion_latency.Collect(
+        &result->tcp_zerocopy_completion_latency);
+    data.tcp_info_srtt.Collect(&result->tcp_info_srtt);
+    data.tcp_info_retransmits.Collect(&result->tcp_info_retransmits);
+    data.tcp_info_rwnd_limited_percent.Collect(
+        &result->tcp_info_rwnd_limited_percent);
+    data.tcp_info_sndbuf_limited_percent.Collect(
+        &result->tcp_info_sndbuf_limited_percent);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
     data.http2_hpack_entry_lifetime.Collect(
@@ -782,6 +904,9 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->chaotic_good_tcp_write_size_data);
     data.chaotic_good_tcp_write_size_control.Collect(
         &result->chaotic_good_tcp_write_size_control);
+    data.exec_ctx_closures_per_flush.Collect(
+        &result->exec_ctx_closures_per_flush);
+    data.exec_ctx_flush_depth.Collect(&result->exec_ctx_flush_depth);
   }
   return result;
 }
@@ -799,6 +924,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       server_channels_created - other.server_channels_created;
   result->insecure_connections_created =
       insecure_connections_created - other.insecure_connections_created;
+  result->arena_zone_allocations =
+      arena_zone_allocations - other.arena_zone_allocations;
   result->rq_connections_dropped =
       rq_connections_dropped - other.rq_connections_dropped;
   result->rq_calls_dropped = rq_calls_dropped - other.rq_calls_dropped;
@@ -807,6 +934,14 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
   result->tcp_read_alloc_64k = tcp_read_alloc_64k - other.tcp_read_alloc_64k;
+  result->tcp_zerocopy_completions =
+      tcp_zerocopy_completions - other.tcp_zerocopy_completions;
+  result->tcp_zerocopy_copied = tcp_zerocopy_copied - other.tcp_zerocopy_copied;
+  result->tcp_zerocopy_threshold_changes =
+      tcp_zerocopy_threshold_changes - other.tcp_zerocopy_threshold_changes;
+  result->tcp_info_samples = tcp_info_samples - other.tcp_info_samples;
+  result->tcp_info_app_limited_samples =
+      tcp_info_app_limited_samples - other.tcp_info_app_limited_samples;
   result->http2_settings_writes =
       http2_settings_writes - other.http2_settings_writes;
   result->http2_pings_sent = http2_pings_sent - other.http2_pings_sent;
@@ -837,13 +972,32 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->exec_ctx_flushes = exec_ctx_flushes - other.exec_ctx_flushes;
+  result->combiner_offloads = combiner_offloads - other.combiner_offloads;
+  result->combiner_batch_deferrals =
+      combiner_batch_deferrals - other.combiner_batch_deferrals;
+  result->combiner_budget_offloads =
+      combiner_budget_offloads - other.combiner_budget_offloads;
+  result->party_wakeups = party_wakeups - other.party_wakeups;
+  result->party_wakeup_offloads =
+      party_wakeup_offloads - other.party_wakeup_offloads;
   result->call_initial_size = call_initial_size - other.call_initial_size;
+  result->call_final_size = call_final_size - other.call_final_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
   result->tcp_read_size = tcp_read_size - other.tcp_read_size;
   result->tcp_read_offer = tcp_read_offer - other.tcp_read_offer;
   result->tcp_read_offer_iov_size =
       tcp_read_offer_iov_size - other.tcp_read_offer_iov_size;
+  result->tcp_zerocopy_completion_latency =
+      tcp_zerocopy_completion_latency - other.tcp_zerocopy_completion_latency;
+  result->tcp_info_srtt = tcp_info_srtt - other.tcp_info_srtt;
+  result->tcp_info_retransmits =
+      tcp_info_retransmits - other.tcp_info_retransmits;
+  result->tcp_info_rwnd_limited_percent =
+      tcp_info_rwnd_limited_percent - other.tcp_info_rwnd_limited_percent;
+  result->tcp_info_sndbuf_limited_percent =
+      tcp_info_sndbuf_limited_percent - other.tcp_info_sndbuf_limited_percent;
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
@@ -926,6 +1080,10 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->chaotic_good_tcp_write_size_control =
       chaotic_good_tcp_write_size_control -
       other.chaotic_good_tcp_write_size_control;
+  result->exec_ctx_closures_per_flush =
+      exec_ctx_closures_per_flush - other.exec_ctx_closures_per_flush;
+  result->exec_ctx_flush_depth =
+      exec_ctx_flush_depth - other.exec_ctx_flush_depth;
   return result;
 }
 }  // namespace grpc_core
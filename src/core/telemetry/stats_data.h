@@ -204,6 +204,7 @@ struct GlobalStats {
     kClientSubchannelsCreated,
     kServerChannelsCreated,
     kInsecureConnectionsCreated,
+    kArenaZoneAllocations,
     kRqConnectionsDropped,
     kRqCallsDropped,
     kRqCallsRejected,
@@ -211,6 +212,11 @@ struct GlobalStats {
     kSyscallRead,
     kTcpReadAlloc8k,
     kTcpReadAlloc64k,
+    kTcpZerocopyCompletions,
+    kTcpZerocopyCopied,
+    kTcpZerocopyThresholdChanges,
+    kTcpInfoSamples,
+    kTcpInfoAppLimitedSamples,
     kHttp2SettingsWrites,
     kHttp2PingsSent,
     kHttp2WritesBegun,
@@ -235,15 +241,27 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kExecCtxFlushes,
+    kCombinerOffloads,
+    kCombinerBatchDeferrals,
+    kCombinerBudgetOffloads,
+    kPartyWakeups,
+    kPartyWakeupOffloads,
     COUNT
   };
   enum class Histogram {
     kCallInitialSize,
+    kCallFinalSize,
     kTcpWriteSize,
     kTcpWriteIovSize,
     kTcpReadSize,
     kTcpReadOffer,
     kTcpReadOfferIovSize,
+    kTcpZerocopyCompletionLatency,
+    kTcpInfoSrtt,
+    kTcpInfoRetransmits,
+    kTcpInfoRwndLimitedPercent,
+    kTcpInfoSndbufLimitedPercent,
     kHttp2SendMessageSize,
     kHttp2MetadataSize,
     kHttp2HpackEntryLifetime,
@@ -277,6 +295,8 @@ struct GlobalStats {
     kChaoticGoodTcpReadOfferControl,
     kChaoticGoodTcpWriteSizeData,
     kChaoticGoodTcpWriteSizeControl,
+    kExecCtxClosuresPerFlush,
+    kExecCtxFlushDepth,
     COUNT
   };
   GlobalStats();
@@ -294,6 +314,7 @@ struct GlobalStats {
       uint64_t client_subchannels_created;
       uint64_t server_channels_created;
       uint64_t insecure_connections_created;
+      uint64_t arena_zone_allocations;
       uint64_t rq_connections_dropped;
       uint64_t rq_calls_dropped;
       uint64_t rq_calls_rejected;
@@ -301,6 +322,11 @@ struct GlobalStats {
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
       uint64_t tcp_read_alloc_64k;
+      uint64_t tcp_zerocopy_completions;
+      uint64_t tcp_zerocopy_copied;
+      uint64_t tcp_zerocopy_threshold_changes;
+      uint64_t tcp_info_samples;
+      uint64_t tcp_info_app_limited_samples;
       uint64_t http2_settings_writes;
       uint64_t http2_pings_sent;
       uint64_t http2_writes_begun;
@@ -325,15 +351,27 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t exec_ctx_flushes;
+      uint64_t combiner_offloads;
+      uint64_t combiner_batch_deferrals;
+      uint64_t combiner_budget_offloads;
+      uint64_t party_wakeups;
+      uint64_t party_wakeup_offloads;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
   Histogram_65536_26 call_initial_size;
+  Histogram_65536_26 call_final_size;
   Histogram_16777216_20 tcp_write_size;
   Histogram_80_10 tcp_write_iov_size;
   Histogram_16777216_20 tcp_read_size;
   Histogram_16777216_20 tcp_read_offer;
   Histogram_80_10 tcp_read_offer_iov_size;
+  Histogram_1800000_40 tcp_zerocopy_completion_latency;
+  Histogram_1800000_40 tcp_info_srtt;
+  Histogram_100000_20 tcp_info_retransmits;
+  Histogram_100_20 tcp_info_rwnd_limited_percent;
+  Histogram_100_20 tcp_info_sndbuf_limited_percent;
   Histogram_16777216_20 http2_send_message_size;
   Histogram_65536_26 http2_metadata_size;
   Histogram_1800000_40 http2_hpack_entry_lifetime;
@@ -367,6 +405,8 @@ struct GlobalStats {
   Histogram_16777216_20 chaotic_good_tcp_read_offer_control;
   Histogram_16777216_20 chaotic_good_tcp_write_size_data;
   Histogram_16777216_20 chaotic_good_tcp_write_size_control;
+  Histogram_100_20 exec_ctx_closures_per_flush;
+  Histogram_100_20 exec_ctx_flush_depth;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -397,6 +437,10 @@ class GlobalStatsCollector {
     data_.this_cpu().insecure_connections_created.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementArenaZoneAllocations() {
+    data_.this_cpu().arena_zone_allocations.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementRqConnectionsDropped() {
     data_.this_cpu().rq_connections_dropped.fetch_add(
         1, std::memory_order_relaxed);
@@ -419,6 +463,25 @@ class GlobalStatsCollector {
   void IncrementTcpReadAlloc64k() {
     data_.this_cpu().tcp_read_alloc_64k.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementTcpZerocopyCompletions() {
+    data_.this_cpu().tcp_zerocopy_completions.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyCopied() {
+    data_.this_cpu().tcp_zerocopy_copied.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyThresholdChanges() {
+    data_.this_cpu().tcp_zerocopy_threshold_changes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpInfoSamples() {
+    data_.this_cpu().tcp_info_samples.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementTcpInfoAppLimitedSamples() {
+    data_.this_cpu().tcp_info_app_limited_samples.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementHttp2SettingsWrites() {
     data_.this_cpu().http2_settings_writes.fetch_add(1,
                                                      std::memory_order_relaxed);
@@ -499,9 +562,33 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementExecCtxFlushes() {
+    data_.this_cpu().exec_ctx_flushes.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementCombinerOffloads() {
+    data_.this_cpu().combiner_offloads.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementCombinerBatchDeferrals() {
+    data_.this_cpu().combiner_batch_deferrals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCombinerBudgetOffloads() {
+    data_.this_cpu().combiner_budget_offloads.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementPartyWakeups() {
+    data_.this_cpu().party_wakeups.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementPartyWakeupOffloads() {
+    data_.this_cpu().party_wakeup_offloads.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
+  void IncrementCallFinalSize(int value) {
+    data_.this_cpu().call_final_size.Increment(value);
+  }
   void IncrementTcpWriteSize(int value) {
     data_.this_cpu().tcp_write_size.Increment(value);
   }
@@ -517,6 +604,21 @@ class GlobalStatsCollector {
   void IncrementTcpReadOfferIovSize(int value) {
     data_.this_cpu().tcp_read_offer_iov_size.Increment(value);
   }
+  void IncrementTcpZerocopyCompletionLatency(int value) {
+    data_.this_cpu().tcp_zerocopy_completion_latency.Increment(value);
+  }
+  void IncrementTcpInfoSrtt(int value) {
+    data_.this_cpu().tcp_info_srtt.Increment(value);
+  }
+  void IncrementTcpInfoRetransmits(int value) {
+    data_.this_cpu().tcp_info_retransmits.Increment(value);
+  }
+  void IncrementTcpInfoRwndLimitedPercent(int value) {
+    data_.this_cpu().tcp_info_rwnd_limited_percent.Increment(value);
+  }
+  void IncrementTcpInfoSndbufLimitedPercent(int value) {
+    data_.this_cpu().tcp_info_sndbuf_limited_percent.Increment(value);
+  }
   void IncrementHttp2SendMessageSize(int value) {
     data_.this_cpu().http2_send_message_size.Increment(value);
   }
@@ -618,6 +720,12 @@ class GlobalStatsCollector {
   void IncrementChaoticGoodTcpWriteSizeControl(int value) {
     data_.this_cpu().chaotic_good_tcp_write_size_control.Increment(value);
   }
+  void IncrementExecCtxClosuresPerFlush(int value) {
+    data_.this_cpu().exec_ctx_closures_per_flush.Increment(value);
+  }
+  void IncrementExecCtxFlushDepth(int value) {
+    data_.this_cpu().exec_ctx_flush_depth.Increment(value);
+  }
 
  private:
   struct Data {
@@ -627,6 +735,7 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> client_subchannels_created{0};
     std::atomic<uint64_t> server_channels_created{0};
     std::atomic<uint64_t> insecure_connections_created{0};
+    std::atomic<uint64_t> arena_zone_allocations{0};
     std::atomic<uint64_t> rq_connections_dropped{0};
     std::atomic<uint64_t> rq_calls_dropped{0};
     std::atomic<uint64_t> rq_calls_rejected{0};
@@ -634,6 +743,11 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
     std::atomic<uint64_t> tcp_read_alloc_64k{0};
+    std::atomic<uint64_t> tcp_zerocopy_completions{0};
+    std::atomic<uint64_t> tcp_zerocopy_copied{0};
+    std::atomic<uint64_t> tcp_zerocopy_threshold_changes{0};
+    std::atomic<uint64_t> tcp_info_samples{0};
+    std::atomic<uint64_t> tcp_info_app_limited_samples{0};
     std::atomic<uint64_t> http2_settings_writes{0};
     std::atomic<uint64_t> http2_pings_sent{0};
     std::atomic<uint64_t> http2_writes_begun{0};
@@ -658,12 +772,24 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> exec_ctx_flushes{0};
+    std::atomic<uint64_t> combiner_offloads{0};
+    std::atomic<uint64_t> combiner_batch_deferrals{0};
+    std::atomic<uint64_t> combiner_budget_offloads{0};
+    std::atomic<uint64_t> party_wakeups{0};
+    std::atomic<uint64_t> party_wakeup_offloads{0};
     HistogramCollector_65536_26 call_initial_size;
+    HistogramCollector_65536_26 call_final_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
     HistogramCollector_16777216_20 tcp_read_size;
     HistogramCollector_16777216_20 tcp_read_offer;
     HistogramCollector_80_10 tcp_read_offer_iov_size;
+    HistogramCollector_1800000_40 tcp_zerocopy_completion_latency;
+    HistogramCollector_1800000_40 tcp_info_srtt;
+    HistogramCollector_100000_20 tcp_info_retransmits;
+    HistogramCollector_100_20 tcp_info_rwnd_limited_percent;
+    HistogramCollector_100_20 tcp_info_sndbuf_limited_percent;
     HistogramCollector_16777216_20 http2_send_message_size;
     HistogramCollector_65536_26 http2_metadata_size;
     HistogramCollector_1800000_40 http2_hpack_entry_lifetime;
@@ -697,6 +823,8 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20 chaotic_good_tcp_read_offer_control;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_control;
+    HistogramCollector_100_20 exec_ctx_closures_per_flush;
+    HistogramCollector_100_20 exec_ctx_flush_depth;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
@@ -22,8 +22,11 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <list>
+#include <optional>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/numbers.h"
@@ -36,6 +39,7 @@
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 #include "upb/mem/arena.hpp"
 
 #define TSI_ALTS_INITIAL_BUFFER_SIZE 256
@@ -43,6 +47,10 @@
 const int kHandshakerClientOpNum = 4;
 const char kMaxConcurrentStreamsEnvironmentVariable[] =
     "GRPC_ALTS_MAX_CONCURRENT_HANDSHAKES";
+const char kHandshakeLatencyTargetEnvironmentVariable[] =
+    "GRPC_ALTS_HANDSHAKE_LATENCY_TARGET_MS";
+const char kHandshakerChannelsEnvironmentVariable[] =
+    "GRPC_ALTS_HANDSHAKER_CHANNELS";
 
 struct alts_handshaker_client {
   const alts_handshaker_client_vtable* vtable;
@@ -113,6 +121,9 @@ typedef struct alts_grpc_handshaker_client {
   size_t max_frame_size;
   // If non-null, will be populated with an error string upon error.
   std::string* error;
+  // When the request now waiting for the handshaker service's response was
+  // sent, or InfPast if none is waiting.
+  grpc_core::Timestamp request_sent_time = grpc_core::Timestamp::InfPast();
 } alts_grpc_handshaker_client;
 
 static void handshaker_client_send_buffer_destroy(
@@ -195,6 +206,12 @@ static void handle_response_done(alts_grpc_handshaker_client* client,
                           p /* pending_recv_message_result */);
 }
 
+namespace {
+// Reports to the handshake queue how long the handshaker service took to
+// answer the client's last request.
+void HandshakerServiceResponded(alts_grpc_handshaker_client* client);
+}  // namespace
+
 void alts_handshaker_client_handle_response(alts_handshaker_client* c,
                                             bool is_ok) {
   CHECK_NE(c, nullptr);
@@ -241,6 +258,7 @@ void alts_handshaker_client_handle_response(alts_handshaker_client* c,
         nullptr, 0, nullptr);
     return;
   }
+  HandshakerServiceResponded(client);
   upb::Arena arena;
   grpc_gcp_HandshakerResp* resp =
       alts_tsi_utils_deserialize_response(recv_buffer, arena.ptr());
@@ -353,6 +371,7 @@ static tsi_result continue_make_grpc_call(alts_grpc_handshaker_client* client,
   op++;
   CHECK(op - ops <= kHandshakerClientOpNum);
   CHECK_NE(client->grpc_caller, nullptr);
+  client->request_sent_time = grpc_core::Timestamp::Now();
   if (client->grpc_caller(client->call, ops, static_cast<size_t>(op - ops),
                           &client->on_handshaker_service_resp_recv) !=
       GRPC_CALL_OK) {
@@ -369,13 +388,18 @@ namespace {
 
 class HandshakeQueue {
  public:
-  explicit HandshakeQueue(size_t max_outstanding_handshakes)
-      : max_outstanding_handshakes_(max_outstanding_handshakes) {}
+  HandshakeQueue(size_t max_outstanding_handshakes,
+                 grpc_core::Duration latency_target)
+      : max_outstanding_handshakes_(max_outstanding_handshakes) {
+    if (latency_target > grpc_core::Duration::Zero()) {
+      adaptive_limit_.emplace(max_outstanding_handshakes, latency_target);
+    }
+  }
 
   void RequestHandshake(alts_grpc_handshaker_client* client) {
     {
       grpc_core::MutexLock lock(&mu_);
-      if (outstanding_handshakes_ == max_outstanding_handshakes_) {
+      if (outstanding_handshakes_ >= MaxOutstandingHandshakes()) {
         // Max number already running, add to queue.
         queued_handshakes_.push_back(client);
         return;
@@ -383,30 +407,64 @@ class HandshakeQueue {
       // Start the handshake immediately.
       ++outstanding_handshakes_;
     }
-    continue_make_grpc_call(client, true /* is_start */);
+    StartHandshake(client);
   }
 
   void HandshakeDone() {
-    alts_grpc_handshaker_client* client = nullptr;
+    absl::InlinedVector<alts_grpc_handshaker_client*, 1> to_start;
     {
       grpc_core::MutexLock lock(&mu_);
-      if (queued_handshakes_.empty()) {
-        // Nothing more in queue.  Decrement count and return immediately.
-        --outstanding_handshakes_;
-        return;
-      }
-      // Remove next entry from queue and start the handshake.
-      client = queued_handshakes_.front();
-      queued_handshakes_.pop_front();
+      --outstanding_handshakes_;
+      TakeStartableLocked(&to_start);
     }
-    continue_make_grpc_call(client, true /* is_start */);
+    for (alts_grpc_handshaker_client* next : to_start) StartHandshake(next);
+  }
+
+  // Feeds the adaptive limit the time the handshaker service took to answer
+  // one request. The whole RPC would also count the time spent waiting for
+  // the peer's bytes between requests, which says nothing about the service.
+  void ServiceResponded(grpc_core::Duration latency) {
+    absl::InlinedVector<alts_grpc_handshaker_client*, 1> to_start;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      if (!adaptive_limit_.has_value()) return;
+      adaptive_limit_->OnServiceResponse(latency, grpc_core::Timestamp::Now());
+      // The limit may have grown.
+      TakeStartableLocked(&to_start);
+    }
+    for (alts_grpc_handshaker_client* next : to_start) StartHandshake(next);
   }
 
  private:
+  static void StartHandshake(alts_grpc_handshaker_client* client) {
+    continue_make_grpc_call(client, true /* is_start */);
+  }
+
+  // Remove the next entries from the queue that the limit allows to start.
+  void TakeStartableLocked(
+      absl::InlinedVector<alts_grpc_handshaker_client*, 1>* to_start)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    while (!queued_handshakes_.empty() &&
+           outstanding_handshakes_ < MaxOutstandingHandshakes()) {
+      to_start->push_back(queued_handshakes_.front());
+      queued_handshakes_.pop_front();
+      ++outstanding_handshakes_;
+    }
+  }
+
+  size_t MaxOutstandingHandshakes() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return adaptive_limit_.has_value() ? adaptive_limit_->limit()
+                                       : max_outstanding_handshakes_;
+  }
+
   grpc_core::Mutex mu_;
-  std::list<alts_grpc_handshaker_client*> queued_handshakes_;
-  size_t outstanding_handshakes_ = 0;
+  std::list<alts_grpc_handshaker_client*> queued_handshakes_
+      ABSL_GUARDED_BY(mu_);
+  size_t outstanding_handshakes_ ABSL_GUARDED_BY(mu_) = 0;
   const size_t max_outstanding_handshakes_;
+  // Set if the limit adapts to the handshaker service's latency.
+  std::optional<grpc_core::internal::AdaptiveHandshakeLimit> adaptive_limit_
+      ABSL_GUARDED_BY(mu_);
 };
 
 gpr_once g_queued_handshakes_init = GPR_ONCE_INIT;
@@ -424,10 +482,11 @@ HandshakeQueue* g_server_handshake_queue;
 void DoHandshakeQueuesInit(void) {
   const size_t per_queue_max_outstanding_handshakes =
       MaxNumberOfConcurrentHandshakes();
-  g_client_handshake_queue =
-      new HandshakeQueue(per_queue_max_outstanding_handshakes);
-  g_server_handshake_queue =
-      new HandshakeQueue(per_queue_max_outstanding_handshakes);
+  const grpc_core::Duration latency_target = HandshakeLatencyTarget();
+  g_client_handshake_queue = new HandshakeQueue(
+      per_queue_max_outstanding_handshakes, latency_target);
+  g_server_handshake_queue = new HandshakeQueue(
+      per_queue_max_outstanding_handshakes, latency_target);
 }
 
 void RequestHandshake(alts_grpc_handshaker_client* client, bool is_client) {
@@ -437,12 +496,23 @@ void RequestHandshake(alts_grpc_handshaker_client* client, bool is_client) {
   queue->RequestHandshake(client);
 }
 
-void HandshakeDone(bool is_client) {
+void HandshakeDone(alts_grpc_handshaker_client* client) {
   HandshakeQueue* queue =
-      is_client ? g_client_handshake_queue : g_server_handshake_queue;
+      client->is_client ? g_client_handshake_queue : g_server_handshake_queue;
   queue->HandshakeDone();
 }
 
+void HandshakerServiceResponded(alts_grpc_handshaker_client* client) {
+  if (client->request_sent_time == grpc_core::Timestamp::InfPast()) return;
+  const grpc_core::Duration latency =
+      grpc_core::Timestamp::Now() - client->request_sent_time;
+  client->request_sent_time = grpc_core::Timestamp::InfPast();
+  gpr_once_init(&g_queued_handshakes_init, DoHandshakeQueuesInit);
+  HandshakeQueue* queue =
+      client->is_client ? g_client_handshake_queue : g_server_handshake_queue;
+  queue->ServiceResponded(latency);
+}
+
 };  // namespace
 
 ///
@@ -477,7 +547,7 @@ static void on_status_received(void* arg, grpc_error_handle error) {
   }
   maybe_complete_tsi_next(client, true /* receive_status_finished */,
                           nullptr /* pending_recv_message_result */);
-  HandshakeDone(client->is_client);
+  HandshakeDone(client);
   alts_grpc_handshaker_client_unref(client);
 }
 
@@ -941,3 +1011,54 @@ size_t MaxNumberOfConcurrentHandshakes() {
   }
   return max_concurrent_handshakes;
 }
+
+grpc_core::Duration HandshakeLatencyTarget() {
+  std::optional<std::string> env_var_latency_target =
+      grpc_core::GetEnv(kHandshakeLatencyTargetEnvironmentVariable);
+  int64_t latency_target_ms = 0;
+  if (!env_var_latency_target.has_value() ||
+      !absl::SimpleAtoi(*env_var_latency_target, &latency_target_ms) ||
+      latency_target_ms < 0) {
+    return grpc_core::Duration::Zero();
+  }
+  return grpc_core::Duration::Milliseconds(latency_target_ms);
+}
+
+size_t NumberOfHandshakerChannels() {
+  size_t handshaker_channels = 1;
+  std::optional<std::string> env_var_handshaker_channels =
+      grpc_core::GetEnv(kHandshakerChannelsEnvironmentVariable);
+  if (env_var_handshaker_channels.has_value()) {
+    size_t effective_handshaker_channels = 1;
+    if (absl::SimpleAtoi(*env_var_handshaker_channels,
+                         &effective_handshaker_channels) &&
+        effective_handshaker_channels > 0) {
+      handshaker_channels = effective_handshaker_channels;
+    }
+  }
+  return handshaker_channels;
+}
+
+namespace grpc_core {
+namespace internal {
+
+AdaptiveHandshakeLimit::AdaptiveHandshakeLimit(size_t max_limit,
+                                               Duration latency_target)
+    : max_limit_(std::max<double>(max_limit, 1)),
+      latency_target_(latency_target),
+      limit_(max_limit_) {}
+
+void AdaptiveHandshakeLimit::OnServiceResponse(Duration latency,
+                                             Timestamp now) {
+  if (latency > latency_target_) {
+    if (now - last_decrease_ >= latency_target_) {
+      limit_ = std::max(limit_ / 2, 1.0);
+      last_decrease_ = now;
+    }
+    return;
+  }
+  limit_ = std::min(limit_ + 1 / limit_, max_limit_);
+}
+
+}  // namespace internal
+}  // namespace grpc_core
@@ -28,6 +28,7 @@
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/tsi/alts/handshaker/alts_tsi_handshaker.h"
 #include "src/core/tsi/transport_security_interface.h"
+#include "src/core/util/time.h"
 
 #define ALTS_SERVICE_METHOD "/grpc.gcp.HandshakerService/DoHandshake"
 #define ALTS_APPLICATION_PROTOCOL "grpc"
@@ -161,4 +162,46 @@ void alts_handshaker_client_handle_response(alts_handshaker_client* client,
 // Exposed for testing purposes only.
 size_t MaxNumberOfConcurrentHandshakes();
 
+// Returns the handshaker service RPC latency above which the number of
+// concurrent handshakes is cut back, or zero if the number is fixed at
+// MaxNumberOfConcurrentHandshakes().
+//
+// Exposed for testing purposes only.
+grpc_core::Duration HandshakeLatencyTarget();
+
+// Returns the number of channels that handshaker service RPCs are spread
+// across. Each channel has its own connection to the handshaker service.
+//
+// Exposed for testing purposes only.
+size_t NumberOfHandshakerChannels();
+
+namespace grpc_core {
+namespace internal {
+
+// An additive-increase/multiplicative-decrease limit on concurrent
+// handshakes, driven by how long the handshaker service takes to answer each
+// request.
+//
+// The limit starts at its maximum. Each response slower than the latency
+// target halves it, at most once per latency target so that the requests
+// sent before a cut do not cut it again, and each faster response raises it
+// by about one per limit's worth of responses. Not thread-safe.
+class AdaptiveHandshakeLimit {
+ public:
+  AdaptiveHandshakeLimit(size_t max_limit, Duration latency_target);
+
+  size_t limit() const { return static_cast<size_t>(limit_); }
+
+  void OnServiceResponse(Duration latency, Timestamp now);
+
+ private:
+  const double max_limit_;
+  const Duration latency_target_;
+  double limit_;
+  Timestamp last_decrease_ = Timestamp::InfPast();
+};
+
+}  // namespace internal
+}  // namespace grpc_core
+
 #endif  // GRPC_SRC_CORE_TSI_ALTS_HANDSHAKER_ALTS_HANDSHAKER_CLIENT_H
@@ -29,6 +29,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
+
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -42,6 +44,11 @@
 #include "src/core/util/sync.h"
 #include "upb/mem/arena.hpp"
 
+// Selects the connection to the handshaker service that a handshake uses,
+// when there is more than one.
+constexpr char kHandshakerChannelIndexArg[] =
+    "grpc.internal.alts_handshaker_channel_index";
+
 // Main struct for ALTS TSI handshaker.
 struct alts_tsi_handshaker {
   tsi_handshaker base;
@@ -256,7 +263,9 @@ static const tsi_handshaker_result_vtable result_vtable = {
     handshaker_result_create_zero_copy_grpc_protector,
     handshaker_result_create_frame_protector,
     handshaker_result_get_unused_bytes,
-    handshaker_result_destroy};
+    handshaker_result_destroy,
+    nullptr,  // handshaker_result_create_kernel_tls_protector
+};
 
 tsi_result alts_tsi_handshaker_result_create(grpc_gcp_HandshakerResp* resp,
                                              bool is_client,
@@ -497,11 +506,24 @@ static void alts_tsi_handshaker_create_channel(
   alts_tsi_handshaker* handshaker = next_args->handshaker;
   CHECK_EQ(handshaker->channel, nullptr);
   grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  grpc_arg channel_args[2];
   // Disable retries so that we quickly get a signal when the
   // handshake server is not reachable.
-  grpc_arg disable_retries_arg = grpc_channel_arg_integer_create(
+  channel_args[0] = grpc_channel_arg_integer_create(
       const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0);
-  grpc_channel_args args = {1, &disable_retries_arg};
+  grpc_channel_args args = {1, channel_args};
+  // Channels with the same args share a connection to the handshaker
+  // service. To spread handshakes across several connections, each handshake
+  // picks one of them in turn with an otherwise unused arg.
+  static const size_t num_handshaker_channels = NumberOfHandshakerChannels();
+  if (num_handshaker_channels > 1) {
+    static std::atomic<size_t> next_handshaker_channel{0};
+    channel_args[args.num_args++] = grpc_channel_arg_integer_create(
+        const_cast<char*>(kHandshakerChannelIndexArg),
+        static_cast<int>(
+            next_handshaker_channel.fetch_add(1, std::memory_order_relaxed) %
+            num_handshaker_channels));
+  }
   handshaker->channel = grpc_channel_create(
       next_args->handshaker->handshaker_service_url, creds, &args);
   grpc_channel_credentials_release(creds);
@@ -21,6 +21,8 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+
 #include "absl/log/log.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -70,6 +72,73 @@ static tsi_result alts_grpc_privacy_integrity_protect(
   return TSI_OK;
 }
 
+static tsi_result alts_grpc_privacy_integrity_protect_frames(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  // Allocates memory for all output frames at once. Every frame but the last
+  // carries max_unprotected_data_size bytes, and there is always at least one.
+  size_t data_length = unprotected_slices->length;
+  size_t num_frames =
+      data_length == 0
+          ? 1
+          : (data_length + max_unprotected_data_size - 1) /
+                max_unprotected_data_size;
+  size_t frame_overhead = rp->header_length + rp->tag_length;
+  grpc_slice protected_slice =
+      GRPC_SLICE_MALLOC(data_length + num_frames * frame_overhead);
+  unsigned char* protected_frame_start = GRPC_SLICE_START_PTR(protected_slice);
+  // Converts the input once. Each frame is then sealed from a window of
+  // rp->iovec_buf, whose last entry is cut short when the frame ends within
+  // it, and restored to its remainder for the next frame.
+  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp,
+                                                          unprotected_slices);
+  iovec_t* vec = rp->iovec_buf;
+  size_t first = 0;
+  size_t remaining = data_length;
+  do {
+    size_t frame_data_size = std::min(remaining, max_unprotected_data_size);
+    size_t window_length = 0;
+    iovec_t rest = {nullptr, 0};
+    size_t last = first;
+    if (frame_data_size > 0) {
+      size_t covered = 0;
+      while (covered + vec[last].iov_len < frame_data_size) {
+        covered += vec[last].iov_len;
+        ++last;
+      }
+      size_t in_last = frame_data_size - covered;
+      rest.iov_base = static_cast<unsigned char*>(vec[last].iov_base) + in_last;
+      rest.iov_len = vec[last].iov_len - in_last;
+      vec[last].iov_len = in_last;
+      window_length = last - first + 1;
+    }
+    iovec_t protected_iovec = {protected_frame_start,
+                               frame_data_size + frame_overhead};
+    char* error_details = nullptr;
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_protect(
+            rp->iovec_rp, vec + first, window_length, protected_iovec,
+            &error_details);
+    if (status != GRPC_STATUS_OK) {
+      LOG(ERROR) << "Failed to protect, " << error_details;
+      gpr_free(error_details);
+      grpc_core::CSliceUnref(protected_slice);
+      return TSI_INTERNAL_ERROR;
+    }
+    protected_frame_start += protected_iovec.iov_len;
+    remaining -= frame_data_size;
+    if (rest.iov_len > 0) {
+      vec[last] = rest;
+      first = last;
+    } else if (window_length > 0) {
+      first = last + 1;
+    }
+  } while (remaining > 0);
+  grpc_slice_buffer_add(protected_slices, protected_slice);
+  grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  return TSI_OK;
+}
+
 static tsi_result alts_grpc_privacy_integrity_unprotect(
     alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices) {
@@ -115,10 +184,53 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
   return TSI_OK;
 }
 
+static tsi_result alts_grpc_privacy_integrity_unprotect_in_place(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  if (protected_slices->count != 1 ||
+      protected_slices->slices[0].refcount == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  if (protected_slices->length < rp->header_length + rp->tag_length) {
+    LOG(ERROR) << "Protected slices do not have sufficient data.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  // The ciphertext is decrypted onto itself, so the unprotected data starts
+  // right after the frame header, and is followed by the unused tag.
+  grpc_slice protected_slice = protected_slices->slices[0];
+  unsigned char* frame_start = GRPC_SLICE_START_PTR(protected_slice);
+  size_t frame_size = GRPC_SLICE_LENGTH(protected_slice);
+  size_t unprotected_frame_size =
+      frame_size - rp->header_length - rp->tag_length;
+  iovec_t header_iovec = {frame_start, rp->header_length};
+  iovec_t protected_iovec = {frame_start + rp->header_length,
+                             frame_size - rp->header_length};
+  iovec_t unprotected_iovec = {frame_start + rp->header_length,
+                               unprotected_frame_size};
+  char* error_details = nullptr;
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_unprotect(
+          rp->iovec_rp, header_iovec, &protected_iovec, 1, unprotected_iovec,
+          &error_details);
+  if (status != GRPC_STATUS_OK) {
+    LOG(ERROR) << "Failed to unprotect, " << error_details;
+    gpr_free(error_details);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_add(
+      unprotected_slices,
+      grpc_slice_sub(protected_slice, rp->header_length,
+                     rp->header_length + unprotected_frame_size));
+  grpc_slice_buffer_reset_and_unref(protected_slices);
+  return TSI_OK;
+}
+
 static const alts_grpc_record_protocol_vtable
     alts_grpc_privacy_integrity_record_protocol_vtable = {
         alts_grpc_privacy_integrity_protect,
-        alts_grpc_privacy_integrity_unprotect, nullptr};
+        alts_grpc_privacy_integrity_unprotect, nullptr,
+        alts_grpc_privacy_integrity_protect_frames,
+        alts_grpc_privacy_integrity_unprotect_in_place};
 
 tsi_result alts_grpc_privacy_integrity_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
@@ -49,6 +49,27 @@ tsi_result alts_grpc_record_protocol_protect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices);
 
+///
+/// This method protects unprotected data as a sequence of frames, each of
+/// which carries at most max_unprotected_data_size bytes of it, and appends
+/// the frames to protected_slices. It is equivalent to calling
+/// alts_grpc_record_protocol_protect() once per frame, but the frames are
+/// sealed in one pass over unprotected_slices, into a single allocation. The
+/// input unprotected data slice buffer will be cleared.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- unprotected_slices: the unprotected data to be protected.
+///- max_unprotected_data_size: the maximum unprotected data size per frame.
+///- protected_slices: slice buffer where the protected frames are appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// record protocol only protects one frame at a time, or a specific error code
+/// in case of failure.
+///
+tsi_result alts_grpc_record_protocol_protect_frames(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices);
+
 ///
 /// This methods performs unprotect operation on a full frame of protected data
 /// and appends unprotected data to unprotected_slices. It is the caller's
@@ -67,6 +88,26 @@ tsi_result alts_grpc_record_protocol_unprotect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices);
 
+///
+/// This method is the same as alts_grpc_record_protocol_unprotect(), except
+/// that the frame is decrypted in place, and the unprotected data appended to
+/// unprotected_slices references the memory of the protected frame. The frame
+/// has to be in a single slice, and the caller has to ensure that nothing else
+/// reads the bytes of that slice, since they are overwritten.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- protected_slices: a full frame of protected data in a single grpc slice.
+///- unprotected_slices: slice buffer where unprotected data is appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// record protocol cannot decrypt in place or if the frame is in more than one
+/// slice, in which case protected_slices is left unchanged, or a specific error
+/// code in case of failure.
+///
+tsi_result alts_grpc_record_protocol_unprotect_in_place(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices);
+
 ///
 /// This method returns maximum allowed unprotected data size, given maximum
 /// protected frame size.
@@ -39,6 +39,13 @@ struct alts_grpc_record_protocol_vtable {
                           grpc_slice_buffer* protected_slices,
                           grpc_slice_buffer* unprotected_slices);
   void (*destruct)(alts_grpc_record_protocol* self);
+  tsi_result (*protect_frames)(alts_grpc_record_protocol* self,
+                               grpc_slice_buffer* unprotected_slices,
+                               size_t max_unprotected_data_size,
+                               grpc_slice_buffer* protected_slices);
+  tsi_result (*unprotect_in_place)(alts_grpc_record_protocol* self,
+                                   grpc_slice_buffer* protected_slices,
+                                   grpc_slice_buffer* unprotected_slices);
 };
 // Main struct for alts_grpc_record_protocol implementation, shared by both
 // integrity-only record protocol and privacy-integrity record protocol.
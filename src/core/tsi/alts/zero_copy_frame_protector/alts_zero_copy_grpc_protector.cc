@@ -27,6 +27,7 @@
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/tsi/alts/crypt/gsec.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_integrity_only_record_protocol.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_privacy_integrity_record_protocol.h"
@@ -144,6 +145,19 @@ static tsi_result create_alts_grpc_record_protocol(
   return TSI_OK;
 }
 
+///
+/// Returns true if the next frame of frame_size bytes is within the first
+/// slice of protected_sb, and nothing else references the memory of that
+/// slice, so that the frame can be decrypted in place.
+///
+static bool frame_can_be_unprotected_in_place(
+    const grpc_slice_buffer* protected_sb, size_t frame_size) {
+  const grpc_slice& slice = protected_sb->slices[0];
+  return slice.refcount != nullptr &&
+         slice.refcount != grpc_slice_refcount::NoopRefcount() &&
+         slice.refcount->IsUnique() && GRPC_SLICE_LENGTH(slice) >= frame_size;
+}
+
 // --- tsi_zero_copy_grpc_protector methods implementation. ---
 
 static tsi_result alts_zero_copy_grpc_protector_protect(
@@ -156,6 +170,13 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
   }
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
+  // Seals all frames in one pass, if the record protocol supports it.
+  tsi_result result = alts_grpc_record_protocol_protect_frames(
+      protector->record_protocol, unprotected_slices,
+      protector->max_unprotected_data_size, protected_slices);
+  if (result != TSI_UNIMPLEMENTED) {
+    return result;
+  }
   // Calls alts_grpc_record_protocol protect repeatedly.
   while (unprotected_slices->length > protector->max_unprotected_data_size) {
     grpc_slice_buffer_move_first(unprotected_slices,
@@ -195,18 +216,25 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
     }
     if (protector->protected_sb.length < protector->parsed_frame_size) break;
     // At this point, protected_sb contains at least one frame of data.
-    tsi_result status;
-    if (protector->protected_sb.length == protector->parsed_frame_size) {
-      status = alts_grpc_record_protocol_unprotect(protector->unrecord_protocol,
-                                                   &protector->protected_sb,
-                                                   unprotected_slices);
-    } else {
+    // Whether the frame can be decrypted in place has to be checked before it
+    // is split from the rest of protected_sb, which shares its slice.
+    bool in_place = frame_can_be_unprotected_in_place(
+        &protector->protected_sb, protector->parsed_frame_size);
+    grpc_slice_buffer* frame_sb = &protector->protected_sb;
+    if (protector->protected_sb.length != protector->parsed_frame_size) {
       grpc_slice_buffer_move_first(&protector->protected_sb,
                                    protector->parsed_frame_size,
                                    &protector->protected_staging_sb);
+      frame_sb = &protector->protected_staging_sb;
+    }
+    tsi_result status = TSI_UNIMPLEMENTED;
+    if (in_place) {
+      status = alts_grpc_record_protocol_unprotect_in_place(
+          protector->unrecord_protocol, frame_sb, unprotected_slices);
+    }
+    if (status == TSI_UNIMPLEMENTED) {
       status = alts_grpc_record_protocol_unprotect(
-          protector->unrecord_protocol, &protector->protected_staging_sb,
-          unprotected_slices);
+          protector->unrecord_protocol, frame_sb, unprotected_slices);
     }
     protector->parsed_frame_size = 0;
     if (status != TSI_OK) {
@@ -0,0 +1,109 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/handshake_offload/ssl_handshake_offloader.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "src/core/util/no_destruct.h"
+
+namespace tsi {
+
+namespace {
+
+// Leaves half of the cores to the threads that serve established connections.
+size_t SharedOffloaderThreads() {
+  return std::max<size_t>(1, gpr_cpu_num_cores() / 2);
+}
+
+// Enough for a burst of reconnects, without letting a storm grow the queue
+// much beyond what the threads can work through in a few handshake times.
+constexpr size_t kSharedOffloaderQueuedPerThread = 64;
+
+}  // namespace
+
+SslHandshakeOffloader* SslHandshakeOffloader::Shared() {
+  static grpc_core::NoDestruct<SslHandshakeOffloader> offloader(
+      SharedOffloaderThreads(),
+      SharedOffloaderThreads() * kSharedOffloaderQueuedPerThread);
+  return offloader.get();
+}
+
+SslHandshakeOffloader::SslHandshakeOffloader(size_t num_threads,
+                                             size_t max_queued)
+    : max_queued_(max_queued) {
+  CHECK_GT(num_threads, 0u);
+  threads_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    // Not tracked, since the threads of the shared offloader never exit and
+    // would otherwise block fork support.
+    threads_.emplace_back(
+        "tls_handshake_offload", [this]() { ThreadBody(); }, nullptr,
+        grpc_core::Thread::Options().set_tracked(false));
+    threads_.back().Start();
+  }
+}
+
+SslHandshakeOffloader::~SslHandshakeOffloader() {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    shutdown_ = true;
+  }
+  cv_.SignalAll();
+  for (grpc_core::Thread& thread : threads_) {
+    thread.Join();
+  }
+}
+
+bool SslHandshakeOffloader::TryRun(absl::AnyInvocable<void()> callback) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (shutdown_ || queue_.size() >= max_queued_) return false;
+    queue_.push_back(std::move(callback));
+  }
+  cv_.Signal();
+  return true;
+}
+
+size_t SslHandshakeOffloader::QueuedForTesting() {
+  grpc_core::MutexLock lock(&mu_);
+  return queue_.size();
+}
+
+void SslHandshakeOffloader::ThreadBody() {
+  while (true) {
+    absl::AnyInvocable<void()> callback;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      while (queue_.empty() && !shutdown_) {
+        cv_.Wait(&mu_);
+      }
+      if (queue_.empty()) return;
+      callback = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    callback();
+  }
+}
+
+}  // namespace tsi
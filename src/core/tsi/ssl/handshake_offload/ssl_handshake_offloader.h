@@ -0,0 +1,81 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_HANDSHAKE_OFFLOAD_SSL_HANDSHAKE_OFFLOADER_H
+#define GRPC_SRC_CORE_TSI_SSL_HANDSHAKE_OFFLOAD_SSL_HANDSHAKE_OFFLOADER_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <deque>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
+
+/// Runs the CPU-heavy steps of TLS handshakes (signing, key exchange and
+/// certificate verification) on a fixed set of threads, so that handshake
+/// storms do not occupy the threads that serve established connections.
+///
+/// The pool is bounded both in threads and in queued work. When the queue is
+/// full, TryRun() fails and the caller is expected to do the work inline,
+/// which pushes back on the source of new handshakes.
+///
+/// This class is thread safe.
+
+namespace tsi {
+
+class SslHandshakeOffloader {
+ public:
+  /// Returns the process-wide offloader used by channels and servers that set
+  /// GRPC_ARG_TLS_HANDSHAKE_OFFLOAD. Its threads are started on first use.
+  static SslHandshakeOffloader* Shared();
+
+  /// Starts \a num_threads threads, which together accept up to
+  /// \a max_queued callbacks that have not started running yet.
+  SslHandshakeOffloader(size_t num_threads, size_t max_queued);
+  /// Waits for queued callbacks to run, and for the threads to exit.
+  ~SslHandshakeOffloader();
+
+  // Not copyable nor movable.
+  SslHandshakeOffloader(const SslHandshakeOffloader&) = delete;
+  SslHandshakeOffloader& operator=(const SslHandshakeOffloader&) = delete;
+
+  /// Queues \a callback to run on one of the threads. Returns false, and
+  /// drops \a callback, if the queue is full.
+  bool TryRun(absl::AnyInvocable<void()> callback);
+
+  /// Returns the number of callbacks that have not started running yet.
+  size_t QueuedForTesting();
+
+ private:
+  void ThreadBody();
+
+  const size_t max_queued_;
+  grpc_core::Mutex mu_;
+  grpc_core::CondVar cv_;
+  std::deque<absl::AnyInvocable<void()>> queue_ ABSL_GUARDED_BY(mu_);
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  std::vector<grpc_core::Thread> threads_;
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_HANDSHAKE_OFFLOAD_SSL_HANDSHAKE_OFFLOADER_H
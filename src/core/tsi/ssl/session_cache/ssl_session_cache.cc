@@ -21,15 +21,29 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/string_util.h>
 
+#include <algorithm>
+#include <map>
+#include <string>
+
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 #include "src/core/util/crash.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/sync.h"
 
 namespace tsi {
 
+namespace {
+
+// Sized for a process with many channels to many servers.
+constexpr size_t kSharedCacheCapacity = 4096;
+constexpr size_t kSharedCacheShards = 16;
+
+}  // namespace
+
 /// Node for single cached session.
 class SslSessionLRUCache::Node {
  public:
@@ -52,7 +66,7 @@ class SslSessionLRUCache::Node {
   }
 
  private:
-  friend class SslSessionLRUCache;
+  friend class SslSessionLRUCache::Shard;
 
   std::string key_;
   std::unique_ptr<SslCachedSession> session_;
@@ -61,14 +75,81 @@ class SslSessionLRUCache::Node {
   Node* prev_ = nullptr;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
+/// One lock and LRU list, owning the nodes for a subset of the keys.
+class SslSessionLRUCache::Shard {
+ public:
+  Shard() = default;
+  ~Shard();
+
+  // Not copyable nor movable.
+  Shard(const Shard&) = delete;
+  Shard& operator=(const Shard&) = delete;
+
+  void set_capacity(size_t capacity) { capacity_ = capacity; }
+
+  size_t Size();
+  void Put(const std::string& key, SslSessionPtr session);
+  SslSessionPtr Get(const std::string& key);
+
+ private:
+  Node* FindLocked(const std::string& key) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void Remove(Node* node) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void PushFront(Node* node) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void AssertInvariants() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  grpc_core::Mutex lock_;
+  size_t capacity_ = 0;
+
+  Node* use_order_list_head_ ABSL_GUARDED_BY(lock_) = nullptr;
+  Node* use_order_list_tail_ ABSL_GUARDED_BY(lock_) = nullptr;
+  size_t use_order_list_size_ ABSL_GUARDED_BY(lock_) = 0;
+  std::map<std::string, Node*> entry_by_key_ ABSL_GUARDED_BY(lock_);
+};
+
+SslSessionLRUCache::SslSessionLRUCache(size_t capacity, size_t num_shards)
+    : num_shards_(std::max<size_t>(1, std::min(num_shards, capacity))),
+      shards_(new Shard[num_shards_]) {
   if (capacity == 0) {
     LOG(ERROR) << "SslSessionLRUCache capacity is zero. SSL sessions cannot be "
                   "resumed.";
   }
+  for (size_t i = 0; i < num_shards_; ++i) {
+    shards_[i].set_capacity((capacity + num_shards_ - 1) / num_shards_);
+  }
+}
+
+SslSessionLRUCache::~SslSessionLRUCache() = default;
+
+SslSessionLRUCache* SslSessionLRUCache::Shared() {
+  static grpc_core::NoDestruct<grpc_core::RefCountedPtr<SslSessionLRUCache>>
+      cache(Create(kSharedCacheCapacity, kSharedCacheShards));
+  return cache->get();
+}
+
+SslSessionLRUCache::Shard& SslSessionLRUCache::ShardFor(absl::string_view key) {
+  if (num_shards_ == 1) return shards_[0];
+  return shards_[absl::HashOf(key) % num_shards_];
+}
+
+size_t SslSessionLRUCache::Size() {
+  size_t size = 0;
+  for (size_t i = 0; i < num_shards_; ++i) size += shards_[i].Size();
+  return size;
+}
+
+void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
+  if (session == nullptr) {
+    LOG(ERROR) << "Attempted to put null SSL session in session cache.";
+    return;
+  }
+  ShardFor(key).Put(key, std::move(session));
 }
 
-SslSessionLRUCache::~SslSessionLRUCache() {
+SslSessionPtr SslSessionLRUCache::Get(const char* key) {
+  return ShardFor(key).Get(key);
+}
+
+SslSessionLRUCache::Shard::~Shard() {
   Node* node = use_order_list_head_;
   while (node) {
     Node* next = node->next_;
@@ -77,12 +158,12 @@ SslSessionLRUCache::~SslSessionLRUCache() {
   }
 }
 
-size_t SslSessionLRUCache::Size() {
+size_t SslSessionLRUCache::Shard::Size() {
   grpc_core::MutexLock lock(&lock_);
   return use_order_list_size_;
 }
 
-SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
+SslSessionLRUCache::Node* SslSessionLRUCache::Shard::FindLocked(
     const std::string& key) {
   auto it = entry_by_key_.find(key);
   if (it == entry_by_key_.end()) {
@@ -96,11 +177,8 @@ SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
   return node;
 }
 
-void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
-  if (session == nullptr) {
-    LOG(ERROR) << "Attempted to put null SSL session in session cache.";
-    return;
-  }
+void SslSessionLRUCache::Shard::Put(const std::string& key,
+                                    SslSessionPtr session) {
   grpc_core::MutexLock lock(&lock_);
   Node* node = FindLocked(key);
   if (node != nullptr) {
@@ -122,7 +200,7 @@ void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
   }
 }
 
-SslSessionPtr SslSessionLRUCache::Get(const char* key) {
+SslSessionPtr SslSessionLRUCache::Shard::Get(const std::string& key) {
   grpc_core::MutexLock lock(&lock_);
   // Key is only used for lookups.
   Node* node = FindLocked(key);
@@ -132,7 +210,7 @@ SslSessionPtr SslSessionLRUCache::Get(const char* key) {
   return node->CopySession();
 }
 
-void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Shard::Remove(SslSessionLRUCache::Node* node) {
   if (node->prev_ == nullptr) {
     use_order_list_head_ = node->next_;
   } else {
@@ -147,7 +225,7 @@ void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
   use_order_list_size_--;
 }
 
-void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Shard::PushFront(SslSessionLRUCache::Node* node) {
   if (use_order_list_head_ == nullptr) {
     use_order_list_head_ = node;
     use_order_list_tail_ = node;
@@ -163,7 +241,7 @@ void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
 }
 
 #ifndef NDEBUG
-void SslSessionLRUCache::AssertInvariants() {
+void SslSessionLRUCache::Shard::AssertInvariants() {
   size_t size = 0;
   Node* prev = nullptr;
   Node* current = use_order_list_head_;
@@ -181,7 +259,7 @@ void SslSessionLRUCache::AssertInvariants() {
   CHECK(entry_by_key_.size() == use_order_list_size_);
 }
 #else
-void SslSessionLRUCache::AssertInvariants() {}
+void SslSessionLRUCache::Shard::AssertInvariants() {}
 #endif
 
 }  // namespace tsi
@@ -25,13 +25,13 @@
 #include <grpc/support/sync.h>
 #include <openssl/ssl.h>
 
-#include <map>
+#include <memory>
 
+#include "absl/strings/string_view.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 #include "src/core/util/cpp_impl_of.h"
 #include "src/core/util/memory.h"
 #include "src/core/util/ref_counted.h"
-#include "src/core/util/sync.h"
 
 /// Cache for SSL sessions for sessions resumption.
 ///
@@ -49,13 +49,21 @@ class SslSessionLRUCache
                                   struct tsi_ssl_session_cache>,
       public grpc_core::RefCounted<SslSessionLRUCache> {
  public:
-  /// Create new LRU cache with the given capacity.
-  static grpc_core::RefCountedPtr<SslSessionLRUCache> Create(size_t capacity) {
-    return grpc_core::MakeRefCounted<SslSessionLRUCache>(capacity);
+  /// Create new LRU cache with the given capacity, split over \a num_shards
+  /// shards.
+  static grpc_core::RefCountedPtr<SslSessionLRUCache> Create(
+      size_t capacity, size_t num_shards = 1) {
+    return grpc_core::MakeRefCounted<SslSessionLRUCache>(capacity, num_shards);
   }
 
+  /// Returns the process-wide cache used by channels that set
+  /// GRPC_ARG_TLS_SHARED_SESSION_CACHE. Handshaker factories scope their keys
+  /// by trust configuration, so credentials that do not trust the same roots
+  /// never resume each other's sessions.
+  static SslSessionLRUCache* Shared();
+
   // Use Create function instead of using this directly.
-  explicit SslSessionLRUCache(size_t capacity);
+  SslSessionLRUCache(size_t capacity, size_t num_shards);
   ~SslSessionLRUCache() override;
 
   // Not copyable nor movable.
@@ -77,19 +85,12 @@ class SslSessionLRUCache
 
  private:
   class Node;
+  class Shard;
 
-  Node* FindLocked(const std::string& key);
-  void Remove(Node* node);
-  void PushFront(Node* node);
-  void AssertInvariants();
-
-  grpc_core::Mutex lock_;
-  size_t capacity_;
+  Shard& ShardFor(absl::string_view key);
 
-  Node* use_order_list_head_ = nullptr;
-  Node* use_order_list_tail_ = nullptr;
-  size_t use_order_list_size_ = 0;
-  std::map<std::string, Node*> entry_by_key_;
+  const size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
 };
 
 }  // namespace tsi
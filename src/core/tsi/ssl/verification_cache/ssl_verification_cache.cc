@@ -0,0 +1,134 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
+
+#include <grpc/support/port_platform.h>
+#include <openssl/evp.h>
+
+#include <iterator>
+#include <utility>
+
+#include "absl/log/check.h"
+
+namespace tsi {
+
+namespace {
+
+bool DigestCert(EVP_MD_CTX* md_ctx, X509* cert) {
+  unsigned char digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size = 0;
+  return X509_digest(cert, EVP_sha256(), digest, &digest_size) &&
+         EVP_DigestUpdate(md_ctx, digest, digest_size);
+}
+
+}  // namespace
+
+SslVerificationCache::SslVerificationCache(size_t capacity, absl::Duration ttl)
+    : capacity_(capacity), ttl_(ttl) {
+  CHECK_GT(capacity, 0u);
+}
+
+SslVerificationCache::~SslVerificationCache() {
+  for (Entry& entry : entries_) {
+    sk_X509_pop_free(entry.verified_chain, X509_free);
+  }
+}
+
+std::string SslVerificationCache::ComputeKey(X509_STORE_CTX* ctx) {
+  X509* leaf = X509_STORE_CTX_get0_cert(ctx);
+  if (leaf == nullptr) return "";
+  EVP_MD_CTX* md_ctx = EVP_MD_CTX_new();
+  if (md_ctx == nullptr) return "";
+  unsigned char key[EVP_MAX_MD_SIZE];
+  unsigned int key_size = 0;
+  bool ok = EVP_DigestInit_ex(md_ctx, EVP_sha256(), nullptr) &&
+            DigestCert(md_ctx, leaf);
+  // The intermediates the peer sent decide which chain gets built, so they
+  // are part of the key too.
+  STACK_OF(X509)* untrusted = X509_STORE_CTX_get0_untrusted(ctx);
+  if (untrusted != nullptr) {
+    size_t untrusted_length = sk_X509_num(untrusted);
+    for (size_t i = 0; ok && i < untrusted_length; ++i) {
+      ok = DigestCert(md_ctx, sk_X509_value(untrusted, i));
+    }
+  }
+  ok = ok && EVP_DigestFinal_ex(md_ctx, key, &key_size);
+  EVP_MD_CTX_free(md_ctx);
+  if (!ok) return "";
+  return std::string(reinterpret_cast<const char*>(key), key_size);
+}
+
+bool SslVerificationCache::IsWithinValidityPeriod(STACK_OF(X509) * chain) {
+  size_t chain_length = sk_X509_num(chain);
+  for (size_t i = 0; i < chain_length; ++i) {
+    X509* cert = sk_X509_value(chain, i);
+    if (X509_cmp_current_time(X509_get0_notBefore(cert)) >= 0 ||
+        X509_cmp_current_time(X509_get0_notAfter(cert)) <= 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+X509* SslVerificationCache::Lookup(X509_STORE_CTX* ctx) {
+  std::string key = ComputeKey(ctx);
+  if (key.empty()) return nullptr;
+  grpc_core::MutexLock lock(&mu_);
+  auto it = index_.find(key);
+  if (it == index_.end()) return nullptr;
+  std::list<Entry>::iterator entry = it->second;
+  if (absl::Now() >= entry->expiry ||
+      !IsWithinValidityPeriod(entry->verified_chain)) {
+    EraseLocked(entry);
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, entry);
+  size_t chain_length = sk_X509_num(entry->verified_chain);
+  if (chain_length == 0) return nullptr;
+  X509* root = sk_X509_value(entry->verified_chain, chain_length - 1);
+  X509_up_ref(root);
+  return root;
+}
+
+void SslVerificationCache::Insert(X509_STORE_CTX* ctx) {
+  STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(ctx);
+  if (chain == nullptr || sk_X509_num(chain) <= 0) return;
+  std::string key = ComputeKey(ctx);
+  if (key.empty()) return;
+  grpc_core::MutexLock lock(&mu_);
+  auto it = index_.find(key);
+  if (it != index_.end()) EraseLocked(it->second);
+  entries_.push_front(
+      Entry{std::move(key), X509_chain_up_ref(chain), absl::Now() + ttl_});
+  index_.emplace(entries_.front().key, entries_.begin());
+  if (entries_.size() > capacity_) EraseLocked(std::prev(entries_.end()));
+}
+
+size_t SslVerificationCache::Size() {
+  grpc_core::MutexLock lock(&mu_);
+  return entries_.size();
+}
+
+void SslVerificationCache::EraseLocked(std::list<Entry>::iterator it) {
+  index_.erase(it->key);
+  sk_X509_pop_free(it->verified_chain, X509_free);
+  entries_.erase(it);
+}
+
+}  // namespace tsi
@@ -0,0 +1,99 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
+#define GRPC_SRC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
+
+#include <grpc/support/port_platform.h>
+#include <openssl/x509.h>
+#include <stddef.h>
+
+#include <list>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/time/time.h"
+#include "src/core/util/sync.h"
+
+/// Cache of successful certificate chain verifications.
+///
+/// Servers that require client certificates verify every client's chain on
+/// every handshake. The cache remembers the chains that verified, keyed by a
+/// digest of the certificates the peer presented, so that a client that
+/// reconnects skips chain building and signature checks. Cached results are
+/// only reused while every certificate of the verified chain is within its
+/// validity period, and for at most a fixed time after verification.
+///
+/// A cache is only valid for the trust store it was filled against, so it is
+/// owned by the handshaker factory, which is rebuilt when the roots change.
+/// It must not be used when revocation is checked, since CRLs can change
+/// without the roots changing.
+///
+/// This class is thread safe.
+
+namespace tsi {
+
+class SslVerificationCache {
+ public:
+  /// Creates a cache of up to \a capacity chains, each reused for at most
+  /// \a ttl after it was verified.
+  SslVerificationCache(size_t capacity, absl::Duration ttl);
+  ~SslVerificationCache();
+
+  // Not copyable nor movable.
+  SslVerificationCache(const SslVerificationCache&) = delete;
+  SslVerificationCache& operator=(const SslVerificationCache&) = delete;
+
+  /// If the chain presented in \a ctx verified before and the result can
+  /// still be used, returns the root of the verified chain, which the caller
+  /// has to free. Otherwise returns nullptr.
+  X509* Lookup(X509_STORE_CTX* ctx);
+  /// Remembers that the chain presented in \a ctx verified, to the chain that
+  /// X509_verify_cert() built in it.
+  void Insert(X509_STORE_CTX* ctx);
+
+  /// Returns current number of chains in the cache.
+  size_t Size();
+
+ private:
+  struct Entry {
+    std::string key;
+    STACK_OF(X509) * verified_chain;
+    absl::Time expiry;
+  };
+
+  // Returns the digest of the certificates presented in ctx, or an empty
+  // string on failure.
+  static std::string ComputeKey(X509_STORE_CTX* ctx);
+  static bool IsWithinValidityPeriod(STACK_OF(X509) * chain);
+  void EraseLocked(std::list<Entry>::iterator it)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const size_t capacity_;
+  const absl::Duration ttl_;
+  grpc_core::Mutex mu_;
+  // Most recently used first.
+  std::list<Entry> entries_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, std::list<Entry>::iterator> index_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
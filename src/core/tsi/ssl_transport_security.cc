@@ -39,6 +39,8 @@
 
 #include <grpc/grpc_crl_provider.h>
 #include <grpc/grpc_security.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
@@ -47,12 +49,21 @@
 #include <openssl/crypto.h>  // For OPENSSL_free
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "absl/log/check.h"
@@ -60,12 +71,18 @@
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/time/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_crl_provider.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/useful.h"
 
@@ -76,6 +93,8 @@
 #define TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND 1024
 #define TSI_SSL_HANDSHAKER_OUTGOING_BUFFER_INITIAL_SIZE 1024
 const size_t kMaxChainLength = 100;
+const size_t kSslVerificationCacheCapacity = 4096;
+const absl::Duration kSslVerificationCacheTtl = absl::Hours(1);
 
 // Putting a macro like this and littering the source file with #if is really
 // bad practice.
@@ -84,6 +103,15 @@ const size_t kMaxChainLength = 100;
 #define TSI_OPENSSL_ALPN_SUPPORT 1
 #endif
 
+// Kernel TLS needs the traffic secrets, which are only exposed through the
+// keylog callback.
+#if defined(GRPC_LINUX_KTLS) && OPENSSL_VERSION_NUMBER >= 0x10101000 && \
+    !defined(LIBRESSL_VERSION_NUMBER)
+#define TSI_OPENSSL_KTLS_SUPPORT 1
+#else
+#define TSI_OPENSSL_KTLS_SUPPORT 0
+#endif
+
 // TODO(jboeuf): I have not found a way to get this number dynamically from the
 // SSL structure. This is what we would ultimately want though...
 #define TSI_SSL_MAX_PROTECTION_OVERHEAD 100
@@ -107,6 +135,9 @@ struct tsi_ssl_client_handshaker_factory {
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<tsi::SslSessionLRUCache> session_cache;
+  // Prefix of this factory's keys in session_cache: the hex digest of its
+  // trust configuration.
+  char session_cache_scope[2 * EVP_MAX_MD_SIZE + 1];
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
 };
 
@@ -121,6 +152,9 @@ struct tsi_ssl_server_handshaker_factory {
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+      session_ticket_key_provider;
+  std::unique_ptr<tsi::SslVerificationCache> verification_cache;
 };
 
 struct tsi_ssl_handshaker {
@@ -131,6 +165,7 @@ struct tsi_ssl_handshaker {
   unsigned char* outgoing_bytes_buffer;
   size_t outgoing_bytes_buffer_size;
   tsi_ssl_handshaker_factory* factory_ref;
+  tsi::SslHandshakeOffloader* offloader;
 };
 struct tsi_ssl_handshaker_result {
   tsi_handshaker_result base;
@@ -147,6 +182,12 @@ struct tsi_ssl_frame_protector {
   size_t buffer_size;
   size_t buffer_offset;
 };
+struct tsi_ssl_kernel_tls_protector {
+  tsi_zero_copy_grpc_protector base;
+  // Only used to unprotect.
+  tsi_frame_protector* frame_protector;
+  size_t max_frame_size;
+};
 // --- Library Initialization. ---
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
@@ -154,6 +195,9 @@ static int g_ssl_ctx_ex_factory_index = -1;
 static int g_ssl_ctx_ex_crl_provider_index = -1;
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
 static int g_ssl_ex_verified_root_cert_index = -1;
+#if TSI_OPENSSL_KTLS_SUPPORT
+static int g_ssl_ex_write_traffic_secret_index = -1;
+#endif
 #if !defined(OPENSSL_IS_BORINGSSL) && !defined(OPENSSL_NO_ENGINE)
 static const char kSslEnginePrefix[] = "engine:";
 #endif
@@ -186,6 +230,25 @@ static void verified_root_cert_free(void* /*parent*/, void* ptr,
   X509_free(static_cast<X509*>(ptr));
 }
 
+#if TSI_OPENSSL_KTLS_SUPPORT
+static void write_traffic_secret_free(void* /*parent*/, void* ptr,
+                                      CRYPTO_EX_DATA* /*ad*/, int /*index*/,
+                                      long /*argl*/, void* /*argp*/) {
+  std::string* secret = static_cast<std::string*>(ptr);
+  if (secret == nullptr) return;
+  OPENSSL_cleanse(&(*secret)[0], secret->size());
+  delete secret;
+}
+
+// Replaces the secret kept for kernel TLS, which may be null.
+static void ssl_set_write_traffic_secret(SSL* ssl, std::string* secret) {
+  write_traffic_secret_free(
+      nullptr, SSL_get_ex_data(ssl, g_ssl_ex_write_traffic_secret_index),
+      nullptr, 0, 0, nullptr);
+  SSL_set_ex_data(ssl, g_ssl_ex_write_traffic_secret_index, secret);
+}
+#endif
+
 static void init_openssl(void) {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
   OPENSSL_init_ssl(0, nullptr);
@@ -225,6 +288,12 @@ static void init_openssl(void) {
   g_ssl_ex_verified_root_cert_index = SSL_get_ex_new_index(
       0, nullptr, nullptr, nullptr, verified_root_cert_free);
   CHECK_NE(g_ssl_ex_verified_root_cert_index, -1);
+
+#if TSI_OPENSSL_KTLS_SUPPORT
+  g_ssl_ex_write_traffic_secret_index = SSL_get_ex_new_index(
+      0, nullptr, nullptr, nullptr, write_traffic_secret_free);
+  CHECK_NE(g_ssl_ex_write_traffic_secret_index, -1);
+#endif
 }
 
 // --- Ssl utils. ---
@@ -917,32 +986,9 @@ static int NullVerifyCallback(X509_STORE_CTX* /*ctx*/, void* /*arg*/) {
   return 1;
 }
 
-static int RootCertExtractCallback(X509_STORE_CTX* ctx, void* /*arg*/) {
-  int ret = 1;
-  // Verification was successful. Get the verified chain from the X509_STORE_CTX
-  // and put the root on the SSL object so that we have access to it when
-  // populating the tsi_peer. On error extracting the root, we return success
-  // anyway and proceed with the connection, to preserve the behavior of an
-  // older version of this code.
-#if OPENSSL_VERSION_NUMBER >= 0x10100000
-  STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(ctx);
-#else
-  STACK_OF(X509)* chain = X509_STORE_CTX_get_chain(ctx);
-#endif
-  if (chain == nullptr) {
-    return ret;
-  }
-
-  // The root cert is the last in the chain
-  size_t chain_length = sk_X509_num(chain);
-  if (chain_length == 0) {
-    return ret;
-  }
-  X509* root_cert = sk_X509_value(chain, chain_length - 1);
-  if (root_cert == nullptr) {
-    return ret;
-  }
-
+// Puts root_cert on the SSL object of ctx, so that we have access to it when
+// populating the tsi_peer.
+static void SetVerifiedRootCert(X509_STORE_CTX* ctx, X509* root_cert) {
   ERR_clear_error();
   int ssl_index = SSL_get_ex_data_X509_STORE_CTX_idx();
   if (ssl_index < 0) {
@@ -950,11 +996,11 @@ static int RootCertExtractCallback(X509_STORE_CTX* ctx, void* /*arg*/) {
     ERR_error_string_n(ERR_get_error(), err_str, sizeof(err_str));
     LOG(ERROR) << "error getting the SSL index from the X509_STORE_CTX: "
                << err_str;
-    return ret;
+    return;
   }
   SSL* ssl = static_cast<SSL*>(X509_STORE_CTX_get_ex_data(ctx, ssl_index));
   if (ssl == nullptr) {
-    return ret;
+    return;
   }
 
   // Free the old root and save the new one. There should not be an old root,
@@ -976,6 +1022,33 @@ static int RootCertExtractCallback(X509_STORE_CTX* ctx, void* /*arg*/) {
     CRYPTO_add(&root_cert->references, 1, CRYPTO_LOCK_X509);
 #endif
   }
+}
+
+static int RootCertExtractCallback(X509_STORE_CTX* ctx, void* /*arg*/) {
+  int ret = 1;
+  // Verification was successful. Get the verified chain from the X509_STORE_CTX
+  // and put the root on the SSL object. On error extracting the root, we
+  // return success anyway and proceed with the connection, to preserve the
+  // behavior of an older version of this code.
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(ctx);
+#else
+  STACK_OF(X509)* chain = X509_STORE_CTX_get_chain(ctx);
+#endif
+  if (chain == nullptr) {
+    return ret;
+  }
+
+  // The root cert is the last in the chain
+  size_t chain_length = sk_X509_num(chain);
+  if (chain_length == 0) {
+    return ret;
+  }
+  X509* root_cert = sk_X509_value(chain, chain_length - 1);
+  if (root_cert == nullptr) {
+    return ret;
+  }
+  SetVerifiedRootCert(ctx, root_cert);
   return ret;
 }
 
@@ -1155,8 +1228,20 @@ static int CheckChainRevocation(
 // (X509_verify_cert), then also extracts the root certificate in the built
 // chain and does revocation checks when a user has configured CrlProviders.
 // returns 1 on success, indicating a trusted chain to a root of trust was
-// found, 0 if a trusted chain could not be built.
+// found, 0 if a trusted chain could not be built. If arg is a verification
+// cache, chains that verified before are accepted without building them again.
 static int CustomVerificationFunction(X509_STORE_CTX* ctx, void* arg) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  auto* verification_cache = static_cast<tsi::SslVerificationCache*>(arg);
+  if (verification_cache != nullptr) {
+    X509* root_cert = verification_cache->Lookup(ctx);
+    if (root_cert != nullptr) {
+      SetVerifiedRootCert(ctx, root_cert);
+      X509_free(root_cert);
+      return 1;
+    }
+  }
+#endif
   int ret = X509_verify_cert(ctx);
   if (ret <= 0) {
     VLOG(2) << "Failed to verify cert chain.";
@@ -1173,6 +1258,9 @@ static int CustomVerificationFunction(X509_STORE_CTX* ctx, void* arg) {
       return ret;
     }
   }
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  if (verification_cache != nullptr) verification_cache->Insert(ctx);
+#endif
   return RootCertExtractCallback(ctx, arg);
 }
 
@@ -1344,6 +1432,89 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+// --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+static tsi_result ssl_kernel_tls_protector_protect(
+    tsi_zero_copy_grpc_protector* /*self*/,
+    grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  // The kernel encrypts the data as it is written to the socket.
+  grpc_slice_buffer_move_into(unprotected_slices, protected_slices);
+  return TSI_OK;
+}
+
+static tsi_result ssl_kernel_tls_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
+  tsi_ssl_kernel_tls_protector* impl =
+      reinterpret_cast<tsi_ssl_kernel_tls_protector*>(self);
+  tsi_result result = TSI_OK;
+  grpc_slice staging =
+      GRPC_SLICE_MALLOC(TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND);
+  uint8_t* cur = GRPC_SLICE_START_PTR(staging);
+  uint8_t* end = GRPC_SLICE_END_PTR(staging);
+  bool keep_looping = false;
+  for (size_t i = 0; i < protected_slices->count && result == TSI_OK; ++i) {
+    const uint8_t* bytes = GRPC_SLICE_START_PTR(protected_slices->slices[i]);
+    size_t size = GRPC_SLICE_LENGTH(protected_slices->slices[i]);
+    // SSL may hold on to decrypted bytes when staging fills up, so keep
+    // reading for as long as it produces any.
+    while (size > 0 || keep_looping) {
+      size_t processed_size = size;
+      size_t unprotected_size = static_cast<size_t>(end - cur);
+      result = tsi_frame_protector_unprotect(impl->frame_protector, bytes,
+                                             &processed_size, cur,
+                                             &unprotected_size);
+      if (result != TSI_OK) break;
+      bytes += processed_size;
+      size -= processed_size;
+      cur += unprotected_size;
+      if (cur == end) {
+        grpc_slice_buffer_add(unprotected_slices, staging);
+        staging =
+            GRPC_SLICE_MALLOC(TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND);
+        cur = GRPC_SLICE_START_PTR(staging);
+        end = GRPC_SLICE_END_PTR(staging);
+        keep_looping = true;
+      } else {
+        keep_looping = unprotected_size > 0;
+      }
+    }
+  }
+  size_t staged = static_cast<size_t>(cur - GRPC_SLICE_START_PTR(staging));
+  if (staged > 0) {
+    grpc_slice_buffer_add(unprotected_slices,
+                          grpc_slice_split_head(&staging, staged));
+  }
+  grpc_slice_unref(staging);
+  // SSL buffers partial records itself.
+  grpc_slice_buffer_reset_and_unref(protected_slices);
+  if (min_progress_size != nullptr) *min_progress_size = 1;
+  return result;
+}
+
+static void ssl_kernel_tls_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  tsi_ssl_kernel_tls_protector* impl =
+      reinterpret_cast<tsi_ssl_kernel_tls_protector*>(self);
+  tsi_frame_protector_destroy(impl->frame_protector);
+  gpr_free(impl);
+}
+
+static tsi_result ssl_kernel_tls_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  *max_frame_size =
+      reinterpret_cast<tsi_ssl_kernel_tls_protector*>(self)->max_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable kernel_tls_protector_vtable = {
+    ssl_kernel_tls_protector_protect,
+    ssl_kernel_tls_protector_unprotect,
+    ssl_kernel_tls_protector_destroy,
+    ssl_kernel_tls_protector_max_frame_size,
+};
+
 // --- tsi_server_handshaker_factory methods implementation. ---
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1534,6 +1705,10 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
     return TSI_INTERNAL_ERROR;
   }
 
+#if TSI_OPENSSL_KTLS_SUPPORT
+  // The secret is no longer needed once records are protected in user space.
+  ssl_set_write_traffic_secret(impl->ssl, nullptr);
+#endif
   // Transfer ownership of ssl and network_io to the frame protector.
   protector_impl->ssl = impl->ssl;
   impl->ssl = nullptr;
@@ -1554,6 +1729,57 @@ static tsi_result ssl_handshaker_result_get_unused_bytes(
   return TSI_OK;
 }
 
+static tsi_result ssl_handshaker_result_create_kernel_tls_protector(
+    const tsi_handshaker_result* self, int fd,
+    size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+#if TSI_OPENSSL_KTLS_SUPPORT
+  const tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
+  const std::string* secret = static_cast<const std::string*>(
+      SSL_get_ex_data(impl->ssl, g_ssl_ex_write_traffic_secret_index));
+  // Records that SSL has already encrypted but not handed to the network
+  // would be sent after the ones the kernel encrypts.
+  if (secret == nullptr || BIO_pending(impl->network_io) > 0) {
+    return TSI_UNIMPLEMENTED;
+  }
+#ifdef OPENSSL_IS_BORINGSSL
+  uint64_t sequence = SSL_get_write_sequence(impl->ssl);
+#else
+  // OpenSSL does not expose the sequence number. A TLS 1.3 client has not
+  // sent any application data records yet, but a server may have sent
+  // session tickets.
+  if (SSL_is_server(impl->ssl)) return TSI_UNIMPLEMENTED;
+  uint64_t sequence = 0;
+#endif
+  tsi_result result =
+      grpc_core::SslEnableKernelTlsTx(impl->ssl, *secret, sequence, fd);
+  if (result != TSI_OK) return result;
+  tsi_frame_protector* frame_protector = nullptr;
+  result = ssl_handshaker_result_create_frame_protector(
+      self, max_output_protected_frame_size, &frame_protector);
+  // The socket can no longer be written to without kernel TLS.
+  if (result != TSI_OK) return TSI_INTERNAL_ERROR;
+  tsi_ssl_kernel_tls_protector* protector_impl =
+      static_cast<tsi_ssl_kernel_tls_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+  protector_impl->base.vtable = &kernel_tls_protector_vtable;
+  protector_impl->frame_protector = frame_protector;
+  protector_impl->max_frame_size =
+      max_output_protected_frame_size != nullptr
+          ? *max_output_protected_frame_size
+          : TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  *protector = &protector_impl->base;
+  return TSI_OK;
+#else
+  (void)self;
+  (void)fd;
+  (void)max_output_protected_frame_size;
+  (void)protector;
+  return TSI_UNIMPLEMENTED;
+#endif
+}
+
 static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(self);
@@ -1570,6 +1796,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+    ssl_handshaker_result_create_kernel_tls_protector,
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1766,21 +1993,11 @@ static tsi_result ssl_handshaker_write_output_buffer(tsi_handshaker* self,
   return status;
 }
 
-static tsi_result ssl_handshaker_next(tsi_handshaker* self,
-                                      const unsigned char* received_bytes,
-                                      size_t received_bytes_size,
-                                      const unsigned char** bytes_to_send,
-                                      size_t* bytes_to_send_size,
-                                      tsi_handshaker_result** handshaker_result,
-                                      tsi_handshaker_on_next_done_cb /*cb*/,
-                                      void* /*user_data*/, std::string* error) {
-  // Input sanity check.
-  if ((received_bytes_size > 0 && received_bytes == nullptr) ||
-      bytes_to_send == nullptr || bytes_to_send_size == nullptr ||
-      handshaker_result == nullptr) {
-    if (error != nullptr) *error = "invalid argument";
-    return TSI_INVALID_ARGUMENT;
-  }
+static tsi_result ssl_handshaker_do_next(
+    tsi_handshaker* self, const unsigned char* received_bytes,
+    size_t received_bytes_size, const unsigned char** bytes_to_send,
+    size_t* bytes_to_send_size, tsi_handshaker_result** handshaker_result,
+    std::string* error) {
   // If there are received bytes, process them first.
   tsi_ssl_handshaker* impl = reinterpret_cast<tsi_ssl_handshaker*>(self);
   tsi_result status = TSI_OK;
@@ -1862,6 +2079,48 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
   return status;
 }
 
+static tsi_result ssl_handshaker_next(tsi_handshaker* self,
+                                      const unsigned char* received_bytes,
+                                      size_t received_bytes_size,
+                                      const unsigned char** bytes_to_send,
+                                      size_t* bytes_to_send_size,
+                                      tsi_handshaker_result** handshaker_result,
+                                      tsi_handshaker_on_next_done_cb cb,
+                                      void* user_data, std::string* error) {
+  // Input sanity check.
+  if ((received_bytes_size > 0 && received_bytes == nullptr) ||
+      bytes_to_send == nullptr || bytes_to_send_size == nullptr ||
+      handshaker_result == nullptr) {
+    if (error != nullptr) *error = "invalid argument";
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_handshaker* impl = reinterpret_cast<tsi_ssl_handshaker*>(self);
+  if (impl->offloader != nullptr && cb != nullptr) {
+    // The caller keeps the handshaker alive until cb is invoked, but not the
+    // received bytes.
+    std::string received(reinterpret_cast<const char*>(received_bytes),
+                         received_bytes_size);
+    if (impl->offloader->TryRun([self, received = std::move(received), cb,
+                                 user_data, error]() {
+          grpc_core::ExecCtx exec_ctx;
+          const unsigned char* bytes_to_send = nullptr;
+          size_t bytes_to_send_size = 0;
+          tsi_handshaker_result* handshaker_result = nullptr;
+          tsi_result status = ssl_handshaker_do_next(
+              self, reinterpret_cast<const unsigned char*>(received.data()),
+              received.size(), &bytes_to_send, &bytes_to_send_size,
+              &handshaker_result, error);
+          cb(status, user_data, bytes_to_send, bytes_to_send_size,
+             handshaker_result);
+        })) {
+      return TSI_ASYNC;
+    }
+  }
+  return ssl_handshaker_do_next(self, received_bytes, received_bytes_size,
+                                bytes_to_send, bytes_to_send_size,
+                                handshaker_result, error);
+}
+
 static const tsi_handshaker_vtable handshaker_vtable = {
     nullptr,  // get_bytes_to_send_to_peer -- deprecated
     nullptr,  // process_bytes_from_peer   -- deprecated
@@ -1873,15 +2132,69 @@ static const tsi_handshaker_vtable handshaker_vtable = {
     nullptr,  // shutdown
 };
 
+void tsi_ssl_handshaker_set_offloader(tsi_handshaker* handshaker,
+                                      tsi::SslHandshakeOffloader* offloader) {
+  CHECK(handshaker->vtable == &handshaker_vtable);
+  reinterpret_cast<tsi_ssl_handshaker*>(handshaker)->offloader = offloader;
+}
+
 // --- tsi_ssl_handshaker_factory common methods. ---
 
+// Returns the key of the sessions with \a server_name in the factory's cache.
+// The cache may be shared with factories that trust other roots, or present
+// other client certificates, whose sessions this factory must not resume.
+static std::string tsi_ssl_session_cache_key(
+    const tsi_ssl_client_handshaker_factory* factory, const char* server_name) {
+  return absl::StrCat(factory->session_cache_scope, ":", server_name);
+}
+
+// Writes to \a scope the hex SHA-256 digest of everything that determines
+// which servers a client factory accepts and how it authenticates to them.
+static bool tsi_ssl_compute_session_cache_scope(
+    const tsi_ssl_client_handshaker_options* options, char* scope) {
+  EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+  if (ctx == nullptr) return false;
+  bool ok = EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr) == 1;
+  auto add = [&](absl::string_view data) {
+    uint64_t size = data.size();
+    ok = ok && EVP_DigestUpdate(ctx, &size, sizeof(size)) == 1 &&
+         EVP_DigestUpdate(ctx, data.data(), data.size()) == 1;
+  };
+  auto add_pointer = [&](const void* p) {
+    add(absl::string_view(reinterpret_cast<const char*>(&p), sizeof(p)));
+  };
+  add(options->pem_root_certs == nullptr ? "" : options->pem_root_certs);
+  // Root stores and CRL providers are compared by identity.
+  add_pointer(options->root_store);
+  add_pointer(options->crl_provider.get());
+  add(options->crl_directory == nullptr ? "" : options->crl_directory);
+  add(options->pem_key_cert_pair == nullptr ||
+              options->pem_key_cert_pair->cert_chain == nullptr
+          ? ""
+          : options->pem_key_cert_pair->cert_chain);
+  add(options->skip_server_certificate_verification ? "1" : "0");
+  unsigned char digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size = 0;
+  ok = ok && EVP_DigestFinal_ex(ctx, digest, &digest_size) == 1;
+  EVP_MD_CTX_free(ctx);
+  if (!ok) return false;
+  static const char kHexDigits[] = "0123456789abcdef";
+  for (unsigned int i = 0; i < digest_size; ++i) {
+    scope[2 * i] = kHexDigits[digest[i] >> 4];
+    scope[2 * i + 1] = kHexDigits[digest[i] & 0xf];
+  }
+  scope[2 * digest_size] = '\0';
+  return true;
+}
+
 static void tsi_ssl_handshaker_resume_session(
-    SSL* ssl, tsi::SslSessionLRUCache* session_cache) {
+    SSL* ssl, const tsi_ssl_client_handshaker_factory* factory) {
   const char* server_name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
   if (server_name == nullptr) {
     return;
   }
-  tsi::SslSessionPtr session = session_cache->Get(server_name);
+  tsi::SslSessionPtr session = factory->session_cache->Get(
+      tsi_ssl_session_cache_key(factory, server_name).c_str());
   if (session != nullptr) {
     // SSL_set_session internally increments reference counter.
     SSL_set_session(ssl, session.get());
@@ -1933,8 +2246,7 @@ static tsi_result create_tsi_ssl_handshaker(SSL_CTX* ctx, int is_client,
     tsi_ssl_client_handshaker_factory* client_factory =
         reinterpret_cast<tsi_ssl_client_handshaker_factory*>(factory);
     if (client_factory->session_cache != nullptr) {
-      tsi_ssl_handshaker_resume_session(ssl,
-                                        client_factory->session_cache.get());
+      tsi_ssl_handshaker_resume_session(ssl, client_factory);
     }
     ERR_clear_error();
     ssl_result = SSL_do_handshake(ssl);
@@ -2052,6 +2364,13 @@ tsi_result tsi_ssl_server_handshaker_factory_create_handshaker(
                                    &factory->base, handshaker);
 }
 
+tsi_ssl_server_handshaker_factory* tsi_ssl_server_handshaker_factory_ref(
+    tsi_ssl_server_handshaker_factory* server_factory) {
+  if (server_factory == nullptr) return nullptr;
+  return reinterpret_cast<tsi_ssl_server_handshaker_factory*>(
+      tsi_ssl_handshaker_factory_ref(&server_factory->base));
+}
+
 void tsi_ssl_server_handshaker_factory_unref(
     tsi_ssl_server_handshaker_factory* factory) {
   if (factory == nullptr) return;
@@ -2076,6 +2395,8 @@ static void tsi_ssl_server_handshaker_factory_destroy(
   }
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->key_logger.reset();
+  self->session_ticket_key_provider.reset();
+  self->verification_cache.reset();
   gpr_free(self);
 }
 
@@ -2182,19 +2503,124 @@ static int server_handshaker_factory_new_session_callback(
   if (server_name == nullptr) {
     return 0;
   }
-  factory->session_cache->Put(server_name, tsi::SslSessionPtr(session));
+  factory->session_cache->Put(
+      tsi_ssl_session_cache_key(factory, server_name).c_str(),
+      tsi::SslSessionPtr(session));
   // Return 1 to indicate transferred ownership over the given session.
   return 1;
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+using TicketMacCtx = EVP_MAC_CTX;
+
+static bool ssl_init_ticket_mac(EVP_MAC_CTX* ctx, const uint8_t* key,
+                                size_t key_size) {
+  OSSL_PARAM params[] = {
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                       const_cast<char*>("SHA256"), 0),
+      OSSL_PARAM_construct_end()};
+  return EVP_MAC_init(ctx, key, key_size, params) == 1;
+}
+#else
+using TicketMacCtx = HMAC_CTX;
+
+static bool ssl_init_ticket_mac(HMAC_CTX* ctx, const uint8_t* key,
+                                size_t key_size) {
+  return HMAC_Init_ex(ctx, key, static_cast<int>(key_size), EVP_sha256(),
+                      nullptr) == 1;
+}
+#endif
+
+/// This callback is called when the server issues or receives a session
+/// ticket, to set up \a cipher_ctx and \a mac_ctx with a key from the
+/// factory's session ticket key provider.
+///
+/// It returns 1 on success, 2 if a received ticket should be replaced with a
+/// new one, 0 if the received ticket's key is unknown and -1 on error.
+static int server_handshaker_factory_session_ticket_key_callback(
+    SSL* ssl, uint8_t* key_name, uint8_t* iv, EVP_CIPHER_CTX* cipher_ctx,
+    TicketMacCtx* mac_ctx, int encrypt) {
+  static_assert(grpc_core::experimental::SessionTicketKey::kNameSize == 16,
+                "OpenSSL session ticket key names are 16 bytes");
+  SSL_CTX* ssl_context = SSL_get_SSL_CTX(ssl);
+  if (ssl_context == nullptr) return -1;
+  auto* factory = static_cast<tsi_ssl_server_handshaker_factory*>(
+      SSL_CTX_get_ex_data(ssl_context, g_ssl_ctx_ex_factory_index));
+  if (factory == nullptr || factory->session_ticket_key_provider == nullptr) {
+    return -1;
+  }
+  std::optional<grpc_core::experimental::SessionTicketKey> key;
+  bool renew = false;
+  if (encrypt) {
+    key = factory->session_ticket_key_provider->EncryptionKey();
+    memcpy(key_name, key->name, sizeof(key->name));
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1) {
+      OPENSSL_cleanse(&*key, sizeof(*key));
+      return -1;
+    }
+  } else {
+    key = factory->session_ticket_key_provider->DecryptionKey(
+        absl::string_view(reinterpret_cast<const char*>(key_name),
+                          grpc_core::experimental::SessionTicketKey::kNameSize),
+        &renew);
+    if (!key.has_value()) return 0;
+  }
+  bool ok = EVP_CipherInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr,
+                              key->aes_key, iv, encrypt) == 1 &&
+            ssl_init_ticket_mac(mac_ctx, key->hmac_key, sizeof(key->hmac_key));
+  OPENSSL_cleanse(&*key, sizeof(*key));
+  if (!ok) return -1;
+  return renew ? 2 : 1;
+}
+
+#if TSI_OPENSSL_KTLS_SUPPORT
+static int hex_digit_value(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+/// Keeps the secret that |ssl| encrypts application data with, in case the
+/// connection is handed over to kernel TLS. |info| is a line in the NSS key
+/// log format: "<label> <client random> <secret>".
+static void ssl_save_write_traffic_secret(const SSL* ssl, const char* info) {
+  absl::string_view line(info);
+  if (!absl::ConsumePrefix(&line, SSL_is_server(ssl)
+                                      ? "SERVER_TRAFFIC_SECRET_0 "
+                                      : "CLIENT_TRAFFIC_SECRET_0 ")) {
+    return;
+  }
+  size_t space = line.rfind(' ');
+  if (space == absl::string_view::npos) return;
+  absl::string_view hex = line.substr(space + 1);
+  if (hex.empty() || hex.size() % 2 != 0) return;
+  auto* secret = new std::string(hex.size() / 2, '\0');
+  for (size_t i = 0; i < secret->size(); ++i) {
+    int high = hex_digit_value(hex[2 * i]);
+    int low = hex_digit_value(hex[2 * i + 1]);
+    if (high < 0 || low < 0) {
+      write_traffic_secret_free(nullptr, secret, nullptr, 0, 0, nullptr);
+      return;
+    }
+    (*secret)[i] = static_cast<char>((high << 4) | low);
+  }
+  ssl_set_write_traffic_secret(const_cast<SSL*>(ssl), secret);
+}
+#endif
+
 /// This callback is invoked at client or server when ssl/tls handshakes
-/// complete and keylogging is enabled.
+/// complete and keylogging or kernel TLS is enabled.
 template <typename T>
 static void ssl_keylogging_callback(const SSL* ssl, const char* info) {
+#if TSI_OPENSSL_KTLS_SUPPORT
+  ssl_save_write_traffic_secret(ssl, info);
+#endif
   SSL_CTX* ssl_context = SSL_get_SSL_CTX(ssl);
   CHECK_NE(ssl_context, nullptr);
   void* arg = SSL_CTX_get_ex_data(ssl_context, g_ssl_ctx_ex_factory_index);
   T* factory = static_cast<T*>(arg);
+  if (factory == nullptr || factory->key_logger == nullptr) return;
   factory->key_logger->LogSessionKeys(ssl_context, info);
 }
 
@@ -2258,6 +2684,12 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
   impl->base.vtable = &client_handshaker_factory_vtable;
   impl->ssl_context = ssl_context;
   if (options->session_cache != nullptr) {
+    if (!tsi_ssl_compute_session_cache_scope(options,
+                                             impl->session_cache_scope)) {
+      LOG(ERROR) << "Could not compute session cache scope.";
+      tsi_ssl_handshaker_factory_unref(&impl->base);
+      return TSI_INTERNAL_ERROR;
+    }
     // Unref is called manually on factory destruction.
     impl->session_cache =
         reinterpret_cast<tsi::SslSessionLRUCache*>(options->session_cache)
@@ -2270,6 +2702,8 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
 #if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
   if (options->key_logger != nullptr) {
     impl->key_logger = options->key_logger->Ref();
+  }
+  if (options->key_logger != nullptr || TSI_OPENSSL_KTLS_SUPPORT) {
     // SSL_CTX_set_keylog_callback is set here to register callback
     // when ssl/tls handshakes complete.
     SSL_CTX_set_keylog_callback(
@@ -2452,6 +2886,21 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
   if (options->key_logger != nullptr) {
     impl->key_logger = options->key_logger->Ref();
   }
+  impl->session_ticket_key_provider = options->session_ticket_key_provider;
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  // A cached verification cannot observe revocations that happen after it, so
+  // the cache is only used when there are no CRLs to check.
+  if ((options->client_certificate_request ==
+           TSI_REQUEST_CLIENT_CERTIFICATE_AND_VERIFY ||
+       options->client_certificate_request ==
+           TSI_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_AND_VERIFY) &&
+      options->crl_provider == nullptr &&
+      (options->crl_directory == nullptr ||
+       strcmp(options->crl_directory, "") == 0)) {
+    impl->verification_cache = std::make_unique<tsi::SslVerificationCache>(
+        kSslVerificationCacheCapacity, kSslVerificationCacheTtl);
+  }
+#endif
 
   for (i = 0; i < options->num_key_cert_pairs; i++) {
     do {
@@ -2503,7 +2952,36 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         }
       }
 
-      if (options->pem_client_root_certs != nullptr) {
+      if (options->session_ticket_key_provider != nullptr) {
+        // Need to set factory at g_ssl_ctx_ex_factory_index
+        SSL_CTX_set_ex_data(impl->ssl_contexts[i], g_ssl_ctx_ex_factory_index,
+                            impl);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+        SSL_CTX_set_tlsext_ticket_key_evp_cb(
+            impl->ssl_contexts[i],
+            server_handshaker_factory_session_ticket_key_callback);
+#else
+        SSL_CTX_set_tlsext_ticket_key_cb(
+            impl->ssl_contexts[i],
+            server_handshaker_factory_session_ticket_key_callback);
+#endif
+      }
+
+      bool use_client_root_store = false;
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+      // X509_STORE_up_ref is only available since OpenSSL 1.1. The CA list
+      // is extracted while parsing, so it needs the PEM roots.
+      use_client_root_store = options->pem_client_root_certs != nullptr &&
+                              options->client_root_store != nullptr &&
+                              !options->send_client_ca_list;
+      if (use_client_root_store) {
+        X509_STORE_up_ref(options->client_root_store->store);
+        SSL_CTX_set_cert_store(impl->ssl_contexts[i],
+                               options->client_root_store->store);
+      }
+#endif
+      if (options->pem_client_root_certs != nullptr &&
+          !use_client_root_store) {
         STACK_OF(X509_NAME)* root_names = nullptr;
         result = ssl_ctx_load_verification_certs(
             impl->ssl_contexts[i], options->pem_client_root_certs,
@@ -2529,7 +3007,8 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         case TSI_REQUEST_CLIENT_CERTIFICATE_AND_VERIFY:
           SSL_CTX_set_verify(impl->ssl_contexts[i], SSL_VERIFY_PEER, nullptr);
           SSL_CTX_set_cert_verify_callback(impl->ssl_contexts[i],
-                                           CustomVerificationFunction, nullptr);
+                                           CustomVerificationFunction,
+                                           impl->verification_cache.get());
           break;
         case TSI_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_BUT_DONT_VERIFY:
           SSL_CTX_set_verify(impl->ssl_contexts[i],
@@ -2543,7 +3022,8 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
                              SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
                              nullptr);
           SSL_CTX_set_cert_verify_callback(impl->ssl_contexts[i],
-                                           CustomVerificationFunction, nullptr);
+                                           CustomVerificationFunction,
+                                           impl->verification_cache.get());
           break;
       }
 
@@ -2590,6 +3070,8 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         // Need to set factory at g_ssl_ctx_ex_factory_index
         SSL_CTX_set_ex_data(impl->ssl_contexts[i], g_ssl_ctx_ex_factory_index,
                             impl);
+      }
+      if (options->key_logger != nullptr || TSI_OPENSSL_KTLS_SUPPORT) {
         // SSL_CTX_set_keylog_callback is set here to register callback
         // when ssl/tls handshakes complete.
         SSL_CTX_set_keylog_callback(
@@ -21,12 +21,14 @@
 
 #include <grpc/grpc_crl_provider.h>
 #include <grpc/grpc_security_constants.h>
+#include <grpc/grpc_session_ticket_key_provider.h>
 #include <grpc/support/port_platform.h>
 #include <openssl/x509.h>
 
 #include <memory>
 
 #include "absl/strings/string_view.h"
+#include "src/core/tsi/ssl/handshake_offload/ssl_handshake_offloader.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/transport_security_interface.h"
@@ -302,6 +304,12 @@ struct tsi_ssl_server_handshaker_options {
   // of the server root certificates. This parameter may be NULL if the server
   // does not want the client to be authenticated with SSL.
   const char* pem_client_root_certs;
+  // client_root_store is a pointer to the ssl_root_certs_store object holding
+  // the parsed pem_client_root_certs. If it is not nullptr and SSL
+  // implementation permits, it is shared by the SSL contexts instead of parsing
+  // pem_client_root_certs again, unless send_client_ca_list is set.
+  // pem_client_root_certs must still be set when it is used.
+  const tsi_ssl_root_certs_store* client_root_store;
   // client_certificate_request, if set to non-zero will force the client to
   // authenticate with an SSL cert. Note that this option is ignored if
   // pem_client_root_certs is NULL or pem_client_roots_certs_size is 0.
@@ -344,6 +352,13 @@ struct tsi_ssl_server_handshaker_options {
   // options as a shared_ptr.
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider;
 
+  // A provider of the keys that session tickets are encrypted with. If set,
+  // takes precedence over `session_ticket_key`, and is asked for the key on
+  // every ticket the server issues or receives, so that keys can be rotated
+  // while the server is running.
+  std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+      session_ticket_key_provider;
+
   // If true, the SSL server sends a list of CA names to the client in the
   // ServerHello. This list of CA names is extracted from the server's trust
   // bundle, and the client may use this lint as a hint to decide which
@@ -359,6 +374,7 @@ struct tsi_ssl_server_handshaker_options {
       : pem_key_cert_pairs(nullptr),
         num_key_cert_pairs(0),
         pem_client_root_certs(nullptr),
+        client_root_store(nullptr),
         client_certificate_request(TSI_DONT_REQUEST_CLIENT_CERTIFICATE),
         cipher_suites(nullptr),
         alpn_protocols(nullptr),
@@ -394,11 +410,23 @@ tsi_result tsi_ssl_server_handshaker_factory_create_handshaker(
     tsi_ssl_server_handshaker_factory* factory, size_t network_bio_buf_size,
     size_t ssl_bio_buf_size, tsi_handshaker** handshaker);
 
+// Increments reference count of the server handshaker factory.
+tsi_ssl_server_handshaker_factory* tsi_ssl_server_handshaker_factory_ref(
+    tsi_ssl_server_handshaker_factory* server_factory);
+
 // Decrements reference count of the handshaker factory. Handshaker factory will
 // be destroyed once no references exist.
 void tsi_ssl_server_handshaker_factory_unref(
     tsi_ssl_server_handshaker_factory* factory);
 
+// Makes a handshaker created by one of the factories above do the work of
+// tsi_handshaker_next() on the threads of offloader, and complete
+// asynchronously. If the offloader's queue is full, or the caller does not pass
+// a callback, the step is done inline as usual. The offloader must outlive the
+// handshaker.
+void tsi_ssl_handshaker_set_offloader(tsi_handshaker* handshaker,
+                                      tsi::SslHandshakeOffloader* offloader);
+
 // Util that checks that an ssl peer matches a specific name.
 // Still TODO(jboeuf):
 // - handle mixed case.
@@ -24,17 +24,29 @@
 #include <openssl/ec.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
+#include <openssl/hmac.h>
 #include <openssl/pem.h>
 #include <openssl/rsa.h>
 #include <openssl/ssl.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
+#include <string.h>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/tsi/transport_security_interface.h"
+#include "src/core/util/strerror.h"
+
+#ifdef GRPC_LINUX_KTLS
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
 
 namespace grpc_core {
 
@@ -255,6 +267,145 @@ tsi_result SslProtectorUnprotect(const unsigned char* protected_frames_bytes,
   return result;
 }
 
+#if defined(GRPC_LINUX_KTLS) && defined(TLS_1_3_VERSION) && \
+    OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
+namespace {
+
+constexpr size_t kTls13IvSize = 12;
+
+// HKDF-Expand-Label from RFC 8446 section 7.1, with an empty context. |out|
+// must not be longer than the output of |md|, which holds for keys and IVs.
+bool Tls13ExpandLabel(const EVP_MD* md, absl::string_view secret,
+                      absl::string_view label, uint8_t* out, size_t out_size) {
+  constexpr absl::string_view kLabelPrefix = "tls13 ";
+  uint8_t info[2 + 1 + 255 + 1 + 1];
+  size_t label_size = kLabelPrefix.size() + label.size();
+  CHECK_LE(label_size, 255u);
+  size_t n = 0;
+  info[n++] = static_cast<uint8_t>(out_size >> 8);
+  info[n++] = static_cast<uint8_t>(out_size);
+  info[n++] = static_cast<uint8_t>(label_size);
+  memcpy(info + n, kLabelPrefix.data(), kLabelPrefix.size());
+  n += kLabelPrefix.size();
+  memcpy(info + n, label.data(), label.size());
+  n += label.size();
+  info[n++] = 0;  // Empty context.
+  info[n++] = 1;  // The only block of HKDF-Expand that is needed.
+  uint8_t block[EVP_MAX_MD_SIZE];
+  unsigned int block_size = 0;
+  if (HMAC(md, secret.data(), static_cast<int>(secret.size()), info, n, block,
+           &block_size) == nullptr ||
+      block_size < out_size) {
+    return false;
+  }
+  memcpy(out, block, out_size);
+  OPENSSL_cleanse(block, sizeof(block));
+  return true;
+}
+
+// Fills in one of the kernel's tls12_crypto_info_* structures, which despite
+// their name also describe TLS 1.3 keys, and installs it on |fd|.
+template <typename CryptoInfo>
+int SetKernelTlsTxKey(int fd, uint16_t cipher_type, const EVP_MD* md,
+                      absl::string_view traffic_secret, uint64_t sequence) {
+  CryptoInfo crypto_info;
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  crypto_info.info.version = TLS_1_3_VERSION;
+  crypto_info.info.cipher_type = cipher_type;
+  uint8_t iv[kTls13IvSize];
+  if (!Tls13ExpandLabel(md, traffic_secret, "key", crypto_info.key,
+                        sizeof(crypto_info.key)) ||
+      !Tls13ExpandLabel(md, traffic_secret, "iv", iv, sizeof(iv))) {
+    OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+    return -1;
+  }
+  // AES-GCM splits the IV into a fixed salt and an explicit part.
+  if constexpr (sizeof(crypto_info.iv) == kTls13IvSize) {
+    memcpy(crypto_info.iv, iv, sizeof(iv));
+  } else {
+    static_assert(sizeof(crypto_info.salt) + sizeof(crypto_info.iv) ==
+                  kTls13IvSize);
+    memcpy(crypto_info.salt, iv, sizeof(crypto_info.salt));
+    memcpy(crypto_info.iv, iv + sizeof(crypto_info.salt),
+           sizeof(crypto_info.iv));
+  }
+  for (size_t i = 0; i < sizeof(crypto_info.rec_seq); ++i) {
+    crypto_info.rec_seq[i] = static_cast<unsigned char>(
+        sequence >> (8 * (sizeof(crypto_info.rec_seq) - 1 - i)));
+  }
+  int ret = setsockopt(fd, SOL_TLS, TLS_TX, &crypto_info, sizeof(crypto_info));
+  OPENSSL_cleanse(iv, sizeof(iv));
+  OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+  return ret;
+}
+
+}  // namespace
+
+tsi_result SslEnableKernelTlsTx(const SSL* ssl,
+                                absl::string_view traffic_secret,
+                                uint64_t sequence, int fd) {
+  if (SSL_version(ssl) != TLS1_3_VERSION) return TSI_UNIMPLEMENTED;
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (cipher == nullptr) return TSI_UNIMPLEMENTED;
+  int (*set_key)(int, uint16_t, const EVP_MD*, absl::string_view, uint64_t);
+  uint16_t cipher_type;
+  const EVP_MD* md = EVP_sha256();
+  switch (SSL_CIPHER_get_protocol_id(cipher)) {
+    case 0x1301:  // TLS_AES_128_GCM_SHA256
+      set_key = SetKernelTlsTxKey<tls12_crypto_info_aes_gcm_128>;
+      cipher_type = TLS_CIPHER_AES_GCM_128;
+      break;
+#ifdef TLS_CIPHER_AES_GCM_256
+    case 0x1302:  // TLS_AES_256_GCM_SHA384
+      set_key = SetKernelTlsTxKey<tls12_crypto_info_aes_gcm_256>;
+      cipher_type = TLS_CIPHER_AES_GCM_256;
+      md = EVP_sha384();
+      break;
+#endif
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case 0x1303:  // TLS_CHACHA20_POLY1305_SHA256
+      set_key = SetKernelTlsTxKey<tls12_crypto_info_chacha20_poly1305>;
+      cipher_type = TLS_CIPHER_CHACHA20_POLY1305;
+      break;
+#endif
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  if (traffic_secret.size() != static_cast<size_t>(EVP_MD_size(md))) {
+    return TSI_UNIMPLEMENTED;
+  }
+  // Fails if the tls module is not available. The socket is left as it was.
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    VLOG(2) << "Kernel TLS is not available: " << StrError(errno);
+    return TSI_UNIMPLEMENTED;
+  }
+  // Until a key is installed, the tls layer passes writes through as they
+  // are, so the caller can still fall back to encrypting them itself.
+  if (set_key(fd, cipher_type, md, traffic_secret, sequence) != 0) {
+    VLOG(2) << "Kernel TLS does not support this cipher: " << StrError(errno);
+    return TSI_UNIMPLEMENTED;
+  }
+  return TSI_OK;
+}
+
+#else
+
+tsi_result SslEnableKernelTlsTx(const SSL* /*ssl*/,
+                                absl::string_view /*traffic_secret*/,
+                                uint64_t /*sequence*/, int /*fd*/) {
+  return TSI_UNIMPLEMENTED;
+}
+
+#endif
+
 bool VerifyCrlSignature(X509_CRL* crl, X509* issuer) {
   if (issuer == nullptr || crl == nullptr) {
     return false;
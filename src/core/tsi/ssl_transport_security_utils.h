@@ -23,6 +23,7 @@
 #include <grpc/support/port_platform.h>
 #include <openssl/evp.h>
 #include <openssl/x509.h>
+#include <stdint.h>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -142,6 +143,24 @@ tsi_result SslProtectorUnprotect(const unsigned char* protected_frames_bytes,
                                  unsigned char* unprotected_bytes,
                                  size_t* unprotected_bytes_size);
 
+// Hands encryption of the records that |ssl| sends from now on over to the
+// kernel TLS layer of the TCP socket |fd|. Only TLS 1.3 connections using
+// AES-GCM or ChaCha20-Poly1305 can be offloaded.
+//
+// ssl: the |SSL| object whose handshake has completed.
+// traffic_secret: the current application traffic secret of our side of
+//                 |ssl|.
+// sequence: the sequence number of the next record |ssl| would have sent.
+// fd: the socket |ssl| talks to the peer over.
+//
+// return: TSI_OK if the kernel will encrypt everything written to |fd| from
+//         now on, TSI_UNIMPLEMENTED if this connection, the platform or the
+//         kernel does not support it. Writes to |fd| are unaffected in that
+//         case.
+tsi_result SslEnableKernelTlsTx(const SSL* ssl,
+                                absl::string_view traffic_secret,
+                                uint64_t sequence, int fd);
+
 // Verifies that `crl` was signed by `issuer.
 // return: true if valid, false otherwise.
 bool VerifyCrlSignature(X509_CRL* crl, X509* issuer);
@@ -115,6 +115,12 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  // May be null. Creates a zero-copy protector that leaves encrypting outgoing
+  // data to the kernel TLS layer of the socket |fd|.
+  tsi_result (*create_kernel_tls_protector)(
+      const tsi_handshaker_result* self, int fd,
+      size_t* max_output_protected_frame_size,
+      tsi_zero_copy_grpc_protector** protector);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
@@ -31,6 +31,20 @@ tsi_result tsi_handshaker_result_create_zero_copy_grpc_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_zero_copy_grpc_protector** protector);
 
+// This method creates a tsi_zero_copy_grpc_protector object that lets the
+// kernel TLS layer of the TCP socket fd encrypt the data sent on it, so that
+// protect passes data through unchanged. Data received is still unprotected
+// in user space. It may be called instead of creating any other protector,
+// after all bytes from the handshake have been written to fd. It returns
+// TSI_UNIMPLEMENTED, leaving fd untouched, if the negotiated connection, the
+// platform or the kernel does not support it; the caller should then create
+// a protector as usual.
+// The caller is responsible for destroying the protector.
+tsi_result tsi_handshaker_result_create_kernel_tls_protector(
+    const tsi_handshaker_result* self, int fd,
+    size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector);
+
 // -- tsi_zero_copy_grpc_protector object --
 
 // Outputs protected frames.
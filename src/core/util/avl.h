@@ -28,6 +28,8 @@
 
 namespace grpc_core {
 
+// A persistent AVL tree. Keys are ordered by QsortCompare, which must be
+// defined between K and any type that keys are looked up by.
 template <class K, class V = void>
 class AVL {
  public:
@@ -182,9 +184,10 @@ class AVL {
       return nullptr;
     }
 
-    if (node->kv.first > key) {
+    const int cmp = QsortCompare(node->kv.first, key);
+    if (cmp > 0) {
       return Get(node->left, key);
-    } else if (node->kv.first < key) {
+    } else if (cmp < 0) {
       return Get(node->right, key);
     } else {
       return node;
@@ -193,9 +196,10 @@ class AVL {
 
   static NodePtr GetBelow(const NodePtr& node, const K& key) {
     if (!node) return nullptr;
-    if (node->kv.first > key) {
+    const int cmp = QsortCompare(node->kv.first, key);
+    if (cmp > 0) {
       return GetBelow(node->left, key);
-    } else if (node->kv.first < key) {
+    } else if (cmp < 0) {
       NodePtr n = GetBelow(node->right, key);
       if (n == nullptr) n = node;
       return n;
@@ -263,11 +267,12 @@ class AVL {
     if (node == nullptr) {
       return MakeNode(std::move(key), std::move(value), nullptr, nullptr);
     }
-    if (node->kv.first < key) {
+    const int cmp = QsortCompare(node->kv.first, key);
+    if (cmp < 0) {
       return Rebalance(node->kv.first, node->kv.second, node->left,
                        AddKey(node->right, std::move(key), std::move(value)));
     }
-    if (key < node->kv.first) {
+    if (cmp > 0) {
       return Rebalance(node->kv.first, node->kv.second,
                        AddKey(node->left, std::move(key), std::move(value)),
                        node->right);
@@ -294,10 +299,11 @@ class AVL {
     if (node == nullptr) {
       return nullptr;
     }
-    if (key < node->kv.first) {
+    const int cmp = QsortCompare(node->kv.first, key);
+    if (cmp > 0) {
       return Rebalance(node->kv.first, node->kv.second,
                        RemoveKey(node->left, key), node->right);
-    } else if (node->kv.first < key) {
+    } else if (cmp < 0) {
       return Rebalance(node->kv.first, node->kv.second, node->left,
                        RemoveKey(node->right, key));
     } else {
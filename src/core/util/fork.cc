@@ -235,6 +235,7 @@ void Fork::AwaitThreads() {
 }
 
 std::atomic<bool> Fork::support_enabled_(false);
+std::atomic<uint64_t> Fork::fork_generation_(0);
 bool Fork::override_enabled_ = false;
 std::set<Fork::child_postfork_func>* Fork::reset_child_polling_engine_ =
     nullptr;
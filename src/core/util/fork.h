@@ -21,6 +21,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
 #include <atomic>
 #include <set>
 
@@ -80,6 +82,19 @@ class GPR_DLL Fork {
   // Await all core threads to be joined.
   static void AwaitThreads();
 
+  // Called by the postfork child handlers, once a forked child is ready to
+  // run.
+  static void NoteForkedChild() {
+    fork_generation_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Changes whenever the postfork child handlers have run in this process.
+  // Lets state that outlives a fork tell that it was carried over from the
+  // parent.
+  static uint64_t ForkGeneration() {
+    return fork_generation_.load(std::memory_order_relaxed);
+  }
+
   // Test only: overrides environment variables/compile flags
   // Must be called before grpc_init()
   static void Enable(bool enable);
@@ -89,6 +104,7 @@ class GPR_DLL Fork {
   static void DoDecExecCtxCount();
 
   static std::atomic<bool> support_enabled_;
+  static std::atomic<uint64_t> fork_generation_;
   static bool override_enabled_;
   static std::set<child_postfork_func>* reset_child_polling_engine_;
 };
@@ -18,6 +18,7 @@
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <map>
@@ -121,6 +122,8 @@ class JsonReader {
 
   Status Run();
   uint32_t ReadChar();
+  void ReadPlainStringRun();
+  void SkipWhitespace();
   bool IsComplete();
 
   size_t CurrentIndex() const { return input_ - original_input_ - 1; }
@@ -249,6 +252,46 @@ uint32_t JsonReader::ReadChar() {
   return r;
 }
 
+// Appends the run of plain string characters at the current position --
+// ASCII other than control characters, '"' and '\\' -- to string_ in one go.
+// Those need none of the checks in the state machine, and make up nearly all
+// of the strings in service configs and xDS bootstrap files, so this saves
+// going around Run() once per byte. Only called when no UTF-8 sequence or
+// surrogate pair is pending.
+void JsonReader::ReadPlainStringRun() {
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  // Sets the high bit of each byte of x that is zero (and possibly of the
+  // bytes above it, which does not matter here).
+  auto zero_bytes = [](uint64_t x) { return (x - kOnes) & ~x & kHighBits; };
+  const uint8_t* start = input_;
+  const uint8_t* end = input_ + remaining_input_;
+  const uint8_t* p = start;
+  while (end - p >= 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    // Bytes that are non-ASCII, below 0x20, '"' or '\\'.
+    const uint64_t special = (word & kHighBits) |
+                             zero_bytes(word & (0xe0 * kOnes)) |
+                             zero_bytes(word ^ ('"' * kOnes)) |
+                             zero_bytes(word ^ ('\\' * kOnes));
+    if (special != 0) break;
+    p += 8;
+  }
+  while (p != end && *p >= 32 && *p < 0x80 && *p != '"' && *p != '\\') ++p;
+  string_.append(reinterpret_cast<const char*>(start), p - start);
+  input_ = p;
+  remaining_input_ = end - p;
+}
+
+void JsonReader::SkipWhitespace() {
+  while (remaining_input_ != 0 && (*input_ == ' ' || *input_ == '\t' ||
+                                   *input_ == '\n' || *input_ == '\r')) {
+    ++input_;
+    --remaining_input_;
+  }
+}
+
 Json* JsonReader::CreateAndLinkValue() {
   if (stack_.empty()) return &root_value_;
   return MatchMutable(
@@ -351,6 +394,11 @@ JsonReader::Status JsonReader::Run() {
 
   // This state-machine is a strict implementation of ECMA-404
   while (true) {
+    if ((state_ == State::GRPC_JSON_STATE_OBJECT_KEY_STRING ||
+         state_ == State::GRPC_JSON_STATE_VALUE_STRING) &&
+        utf8_bytes_remaining_ == 0 && unicode_high_surrogate_ == 0) {
+      ReadPlainStringRun();
+    }
     c = ReadChar();
     switch (c) {
       // Let's process the error case first.
@@ -383,6 +431,7 @@ JsonReader::Status JsonReader::Run() {
           case State::GRPC_JSON_STATE_VALUE_BEGIN:
           case State::GRPC_JSON_STATE_VALUE_END:
           case State::GRPC_JSON_STATE_END:
+            SkipWhitespace();
             break;
 
           case State::GRPC_JSON_STATE_OBJECT_KEY_STRING:
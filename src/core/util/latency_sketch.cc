@@ -0,0 +1,52 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/latency_sketch.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+namespace {
+
+// Bounds each shard's t-digest to 100 centroids plus a batch of 400 unmerged
+// samples (8KiB once allocated).
+constexpr double kCompression = 50;
+
+}  // namespace
+
+void LatencySketch::Record(double seconds) {
+  Shard& shard = shards_.this_cpu();
+  MutexLock lock(&shard.mu);
+  if (shard.digest.Compression() == 0) shard.digest.Reset(kCompression);
+  shard.digest.Add(seconds);
+}
+
+LatencySketch::Summary LatencySketch::Summarize() {
+  TDigest merged(kCompression);
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    merged.Merge(shard.digest);
+  }
+  Summary summary;
+  summary.count = merged.Count();
+  if (summary.count == 0) return summary;
+  summary.p50 = merged.Quantile(0.5);
+  summary.p90 = merged.Quantile(0.9);
+  summary.p99 = merged.Quantile(0.99);
+  summary.max = merged.Max();
+  return summary;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,69 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_LATENCY_SKETCH_H
+#define GRPC_SRC_CORE_UTIL_LATENCY_SKETCH_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/tdigest.h"
+
+namespace grpc_core {
+
+// A streaming sketch of latencies, from which percentiles can be read at any
+// time.
+//
+// Samples are added to a t-digest for the current CPU, so that recording from
+// many threads does not contend on a single lock. The per-CPU t-digests are
+// merged when the sketch is read. A shard only allocates its t-digest the
+// first time a sample is recorded to it.
+//
+// Thread-safe.
+class LatencySketch final {
+ public:
+  // All latencies are in seconds.
+  struct Summary {
+    int64_t count = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double max = 0;
+  };
+
+  LatencySketch() = default;
+  LatencySketch(const LatencySketch&) = delete;
+  LatencySketch& operator=(const LatencySketch&) = delete;
+
+  // Records a latency of \a seconds.
+  void Record(double seconds);
+
+  // Merges the shards and returns the percentiles of all recorded latencies.
+  Summary Summarize();
+
+ private:
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    Mutex mu;
+    TDigest digest ABSL_GUARDED_BY(mu){0.0};
+  };
+
+  PerCpu<Shard> shards_{PerCpuOptions().SetMaxShards(32)};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_LATENCY_SKETCH_H
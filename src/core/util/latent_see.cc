@@ -15,6 +15,9 @@
 #include "src/core/util/latent_see.h"
 
 #ifdef GRPC_ENABLE_LATENT_SEE
+#include <grpc/support/time.h>
+
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -23,9 +26,12 @@
 #include <vector>
 
 #include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/time.h"
 #include "src/core/util/ring_buffer.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time_precise.h"
 
 namespace grpc_core {
 namespace latent_see {
@@ -38,6 +44,60 @@ std::atomic<uintptr_t> Log::free_bins_{0};
 const std::chrono::steady_clock::time_point start_time =
     std::chrono::steady_clock::now();
 
+namespace {
+
+// Appends one event of a Chrome trace to json, with its timestamp ts in
+// microseconds. batch_id is only reported if it is non-zero.
+void AppendEventJson(std::string* json, const Metadata* metadata,
+                     EventType type, uint64_t id, double ts, uint64_t thread_id,
+                     uint64_t batch_id) {
+  absl::string_view phase;
+  bool has_id;
+  switch (type) {
+    case EventType::kBegin:
+      phase = "B";
+      has_id = false;
+      break;
+    case EventType::kEnd:
+      phase = "E";
+      has_id = false;
+      break;
+    case EventType::kFlowStart:
+      phase = "s";
+      has_id = true;
+      break;
+    case EventType::kFlowEnd:
+      phase = "f";
+      has_id = true;
+      break;
+    case EventType::kMark:
+      phase = "i";
+      has_id = false;
+      break;
+  }
+  if (metadata->name[0] != '"') {
+    absl::StrAppend(json, "{\"name\": \"", metadata->name, "\", \"ph\": \"",
+                    phase, "\", \"ts\": ", absl::StrFormat("%.3f", ts),
+                    ", \"pid\": 0, \"tid\": ", thread_id);
+  } else {
+    absl::StrAppend(json, "{\"name\": ", metadata->name, ", \"ph\": \"", phase,
+                    "\", \"ts\": ", absl::StrFormat("%.3f", ts),
+                    ", \"pid\": 0, \"tid\": ", thread_id);
+  }
+  if (has_id) {
+    absl::StrAppend(json, ", \"id\": ", id);
+  }
+  if (type == EventType::kFlowEnd) {
+    absl::StrAppend(json, ", \"bp\": \"e\"");
+  }
+  absl::StrAppend(json, ", \"args\": {\"file\": \"", metadata->file,
+                  "\", \"line\": ", metadata->line);
+  if (batch_id != 0) absl::StrAppend(json, ", \"batch\": ", batch_id);
+  absl::StrAppend(json, "}}");
+}
+
+}  // namespace
+
 void Log::TryPullEventsAndFlush(
     absl::FunctionRef<void(absl::Span<const RecordedEvent>)> callback) {
   // Try to lock... if we fail then clear the active events.
@@ -83,58 +143,14 @@ std::optional<std::string> Log::TryGenerateJson() {
   TryPullEventsAndFlush([&](absl::Span<const RecordedEvent> events) {
     ++callbacks;
     for (const auto& event : events) {
-      absl::string_view phase;
-      bool has_id;
-      switch (event.event.type) {
-        case EventType::kBegin:
-          phase = "B";
-          has_id = false;
-          break;
-        case EventType::kEnd:
-          phase = "E";
-          has_id = false;
-          break;
-        case EventType::kFlowStart:
-          phase = "s";
-          has_id = true;
-          break;
-        case EventType::kFlowEnd:
-          phase = "f";
-          has_id = true;
-          break;
-        case EventType::kMark:
-          phase = "i";
-          has_id = false;
-          break;
-      }
       if (!first) {
         absl::StrAppend(&json, ",\n");
       }
       first = false;
-      if (event.event.metadata->name[0] != '"') {
-        absl::StrAppend(
-            &json, "{\"name\": \"", event.event.metadata->name,
-            "\", \"ph\": \"", phase, "\", \"ts\": ",
-            Nanos(event.event.timestamp - start_time).count() / 1000.0,
-            ", \"pid\": 0, \"tid\": ", event.thread_id);
-      } else {
-        absl::StrAppend(
-            &json, "{\"name\": ", event.event.metadata->name, ", \"ph\": \"",
-            phase, "\", \"ts\": ",
-            Nanos(event.event.timestamp - start_time).count() / 1000.0,
-            ", \"pid\": 0, \"tid\": ", event.thread_id);
-      }
-
-      if (has_id) {
-        absl::StrAppend(&json, ", \"id\": ", event.event.id);
-      }
-      if (event.event.type == EventType::kFlowEnd) {
-        absl::StrAppend(&json, ", \"bp\": \"e\"");
-      }
-      absl::StrAppend(&json, ", \"args\": {\"file\": \"",
-                      event.event.metadata->file,
-                      "\", \"line\": ", event.event.metadata->line,
-                      ", \"batch\": ", event.batch_id, "}}");
+      AppendEventJson(
+          &json, event.event.metadata, event.event.type, event.event.id,
+          Nanos(event.event.timestamp - start_time).count() / 1000.0,
+          event.thread_id, event.batch_id);
     }
   });
   if (callbacks == 0) return std::nullopt;
@@ -158,6 +174,107 @@ void Log::FlushBin(Bin* bin) {
   bin->events.clear();
 }
 
+#ifdef GRPC_LATENT_SEE_FLIGHT_RECORDER
+thread_local FlightRecorder::Ring* FlightRecorder::ring_ = nullptr;
+thread_local FlightRecorder::RingReleaser FlightRecorder::ring_releaser_;
+const gpr_cycle_counter start_cycles = gpr_get_cycle_counter();
+
+struct FlightRecorder::Registry {
+  static Registry& Get() {
+    static Registry* registry = new Registry();
+    return *registry;
+  }
+
+  Mutex mu;
+  // Every ring that was ever handed out. Rings are never freed.
+  std::vector<Ring*> rings ABSL_GUARDED_BY(mu);
+  std::vector<Ring*> free_rings ABSL_GUARDED_BY(mu);
+};
+
+FlightRecorder::Ring* FlightRecorder::AcquireRing() {
+  // Registers the releaser for this thread.
+  (void)&ring_releaser_;
+  Registry& registry = Registry::Get();
+  MutexLock lock(&registry.mu);
+  if (!registry.free_rings.empty()) {
+    ring_ = registry.free_rings.back();
+    registry.free_rings.pop_back();
+  } else {
+    ring_ = new Ring();
+    ring_->ring_id = registry.rings.size() + 1;
+    registry.rings.push_back(ring_);
+  }
+  return ring_;
+}
+
+FlightRecorder::RingReleaser::~RingReleaser() {
+  if (ring_ == nullptr) return;
+  Registry& registry = Registry::Get();
+  MutexLock lock(&registry.mu);
+  registry.free_rings.push_back(ring_);
+  ring_ = nullptr;
+}
+
+std::string FlightRecorder::SnapshotJson(absl::Duration lookback) {
+  struct RecordedEvent {
+    const Metadata* metadata;
+    gpr_cycle_counter timestamp;
+    uint64_t id;
+    EventType type;
+    uint64_t seq;
+  };
+  const gpr_cycle_counter now = gpr_get_cycle_counter();
+  const gpr_timespec max_age = gpr_time_from_micros(
+      absl::ToInt64Microseconds(lookback), GPR_TIMESPAN);
+  std::vector<Ring*> rings;
+  {
+    Registry& registry = Registry::Get();
+    MutexLock lock(&registry.mu);
+    rings = registry.rings;
+  }
+  std::string json = "[\n";
+  bool first = true;
+  std::vector<RecordedEvent> events;
+  events.reserve(kEventsPerThread);
+  for (Ring* ring : rings) {
+    events.clear();
+    for (Slot& slot : ring->slots) {
+      const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+      if (seq == kEmpty || seq == kWriting) continue;
+      RecordedEvent event{slot.metadata.load(std::memory_order_relaxed),
+                          slot.timestamp.load(std::memory_order_relaxed),
+                          slot.id.load(std::memory_order_relaxed),
+                          slot.type.load(std::memory_order_relaxed), seq};
+      std::atomic_thread_fence(std::memory_order_acquire);
+      // The slot was overwritten while we read it.
+      if (slot.seq.load(std::memory_order_relaxed) != seq) continue;
+      if (gpr_time_cmp(gpr_cycle_counter_sub(now, event.timestamp), max_age) >
+          0) {
+        continue;
+      }
+      events.push_back(event);
+    }
+    std::sort(events.begin(), events.end(),
+              [](const RecordedEvent& a, const RecordedEvent& b) {
+                return a.seq < b.seq;
+              });
+    for (const RecordedEvent& event : events) {
+      if (!first) {
+        absl::StrAppend(&json, ",\n");
+      }
+      first = false;
+      const gpr_timespec ts =
+          gpr_cycle_counter_sub(event.timestamp, start_cycles);
+      AppendEventJson(&json, event.metadata, event.type, event.id,
+                      ts.tv_sec * 1e6 + ts.tv_nsec / 1e3, ring->ring_id,
+                      /*batch_id=*/0);
+    }
+  }
+  absl::StrAppend(&json, "\n]");
+  return json;
+}
+#endif  // GRPC_LATENT_SEE_FLIGHT_RECORDER
+
 }  // namespace latent_see
 }  // namespace grpc_core
 #endif
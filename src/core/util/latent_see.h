@@ -17,6 +17,10 @@
 
 #include <grpc/support/port_platform.h>
 
+#if defined(GRPC_LATENT_SEE_FLIGHT_RECORDER) && !defined(GRPC_ENABLE_LATENT_SEE)
+#define GRPC_ENABLE_LATENT_SEE
+#endif
+
 #ifdef GRPC_ENABLE_LATENT_SEE
 #include <sys/syscall.h>
 #include <unistd.h>
@@ -36,8 +40,11 @@
 #include "absl/functional/function_ref.h"
 #include "absl/log/log.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
 #include "src/core/util/per_cpu.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time_precise.h"
 
 #define TAGGED_POINTER_SIZE_BITS 48
 
@@ -52,6 +59,78 @@ struct Metadata {
 
 enum class EventType : uint8_t { kBegin, kEnd, kFlowStart, kFlowEnd, kMark };
 
+#ifdef GRPC_LATENT_SEE_FLIGHT_RECORDER
+// The flight recorder is an always-on mode, selected with
+// GRPC_LATENT_SEE_FLIGHT_RECORDER, in which events are only kept in memory
+// until they are asked for. Each thread records its most recent
+// kEventsPerThread events into a ring of its own, overwriting the oldest ones.
+// Recording takes no locks, and does not allocate once the thread has a ring.
+// Rings are reused by new threads after their thread exits.
+class FlightRecorder {
+ public:
+  static constexpr size_t kEventsPerThread = 4096;
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static void Append(
+      const Metadata* metadata, EventType type, uint64_t id) {
+    Ring* ring = ring_;
+    if (GPR_UNLIKELY(ring == nullptr)) ring = AcquireRing();
+    ring->Append(metadata, type, id);
+  }
+
+  // Returns the events recorded in the last \a lookback as a Chrome trace,
+  // which Perfetto can also open. Threads are identified by their ring.
+  static std::string SnapshotJson(absl::Duration lookback);
+
+ private:
+  static constexpr uint64_t kEmpty = ~uint64_t{0};
+  static constexpr uint64_t kWriting = kEmpty - 1;
+
+  // A seqlock: seq is the index of the event in the slot, and is kWriting
+  // while the event is being written.
+  struct Slot {
+    std::atomic<uint64_t> seq{kEmpty};
+    std::atomic<const Metadata*> metadata{nullptr};
+    std::atomic<gpr_cycle_counter> timestamp{0};
+    std::atomic<uint64_t> id{0};
+    std::atomic<EventType> type{EventType::kMark};
+  };
+
+  struct Ring {
+    GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void Append(const Metadata* metadata,
+                                                     EventType type,
+                                                     uint64_t id) {
+      Slot& slot = slots[next % kEventsPerThread];
+      slot.seq.store(kWriting, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.metadata.store(metadata, std::memory_order_relaxed);
+      slot.timestamp.store(gpr_get_cycle_counter(), std::memory_order_relaxed);
+      slot.id.store(id, std::memory_order_relaxed);
+      slot.type.store(type, std::memory_order_relaxed);
+      slot.seq.store(next, std::memory_order_release);
+      ++next;
+    }
+
+    uint64_t ring_id = 0;
+    // Only accessed by the thread that owns the ring.
+    uint64_t next = 0;
+    Slot slots[kEventsPerThread];
+  };
+
+  // Gives the ring back when its thread exits.
+  struct RingReleaser {
+    ~RingReleaser();
+  };
+
+  // Owns the rings, and hands them out to threads.
+  struct Registry;
+
+  static Ring* AcquireRing();
+
+  static thread_local Ring* ring_;
+  static thread_local RingReleaser ring_releaser_;
+};
+#endif  // GRPC_LATENT_SEE_FLIGHT_RECORDER
+
 // A bin collects all events that occur within a parent scope.
 struct Bin {
   struct Event {
@@ -62,8 +141,14 @@ struct Bin {
   };
 
   void Append(const Metadata* metadata, EventType type, uint64_t id) {
+#ifdef GRPC_LATENT_SEE_FLIGHT_RECORDER
+    // Events go straight to the flight recorder, so the bin stays empty and
+    // flushing it is a no-op.
+    FlightRecorder::Append(metadata, type, id);
+#else
     events.push_back(
         Event{metadata, std::chrono::steady_clock::now(), id, type});
+#endif
   }
 
   std::vector<Event> events;
@@ -120,6 +205,7 @@ class Log {
 
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static Log& Get() {
     static Log* log = []() {
+#ifndef GRPC_LATENT_SEE_FLIGHT_RECORDER
       atexit([] {
         auto json = log->TryGenerateJson();
         if (!json.has_value()) {
@@ -137,6 +223,7 @@ class Log {
         fprintf(f, "%s", json->c_str());
         fclose(f);
       });
+#endif
       return new Log();
     }();
     return *log;
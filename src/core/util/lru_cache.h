@@ -17,14 +17,24 @@
 #ifndef GRPC_SRC_CORE_UTIL_LRU_CACHE_H
 #define GRPC_SRC_CORE_UTIL_LRU_CACHE_H
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
 #include <list>
+#include <memory>
 #include <optional>
 #include <tuple>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -67,6 +77,86 @@ class LruCache {
   std::list<Key> lru_list_;
 };
 
+// A bounded cache that may be used from several threads at once.
+//
+// Entries are spread over shards by key hash, each shard with its own
+// lock. Within a shard, entries are evicted with the CLOCK approximation
+// of LRU: a hit only marks the entry as referenced, rather than moving it
+// to the back of a list, and eviction sweeps a hand over the entries,
+// giving each referenced entry a second chance.
+//
+// Capacity is measured in charge. By default each entry has a charge of 1,
+// so capacity is a number of entries; a charge function can instead report,
+// say, the size of each entry in bytes.
+template <typename Key, typename Value>
+class ShardedLruCache {
+ public:
+  using ChargeFunc = absl::AnyInvocable<size_t(const Key&, const Value&) const>;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+  };
+
+  // If num_shards is 0, picks a shard count that leaves each shard room for
+  // several entries.
+  explicit ShardedLruCache(size_t capacity, size_t num_shards = 0,
+                           ChargeFunc charge = nullptr);
+
+  // Returns the value for key, or nullopt if not present.
+  std::optional<Value> Get(const Key& key);
+
+  // If key is present in the cache, returns the corresponding value.
+  // Otherwise, inserts a new entry, calling create() to construct the new
+  // value, and evicts entries from its shard as needed to stay within
+  // capacity. create() runs under the shard's lock.
+  Value GetOrInsert(const Key& key,
+                    absl::AnyInvocable<Value(const Key&)> create);
+
+  // Changes the capacity of the cache, evicting entries as needed.
+  void SetCapacity(size_t capacity);
+
+  Stats GetStats() const;
+
+ private:
+  struct Slot {
+    std::optional<Key> key;
+    std::optional<Value> value;
+    size_t charge = 0;
+    bool referenced = false;
+  };
+
+  struct Shard {
+    Mutex mu;
+    size_t capacity ABSL_GUARDED_BY(mu) = 0;
+    size_t charge ABSL_GUARDED_BY(mu) = 0;
+    // Index into slots for each key present.
+    absl::flat_hash_map<Key, size_t> index ABSL_GUARDED_BY(mu);
+    // The clock. Empty slots have no key and are listed in free_slots.
+    std::vector<Slot> slots ABSL_GUARDED_BY(mu);
+    std::vector<size_t> free_slots ABSL_GUARDED_BY(mu);
+    size_t hand ABSL_GUARDED_BY(mu) = 0;
+
+    void EvictUntilFits(size_t extra, std::atomic<uint64_t>* evictions)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+  };
+
+  Shard& ShardFor(const Key& key) {
+    return shards_[absl::HashOf(key) % shards_.size()];
+  }
+  size_t ShardCapacity(size_t capacity) const {
+    return std::max<size_t>(
+        1, (capacity + shards_.size() - 1) / shards_.size());
+  }
+
+  const ChargeFunc charge_;
+  std::vector<Shard> shards_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> evictions_{0};
+};
+
 //
 // implementation -- no user-serviceable parts below
 //
@@ -117,6 +207,112 @@ void LruCache<Key, Value>::RemoveOldestEntry() {
   lru_list_.pop_front();
 }
 
+template <typename Key, typename Value>
+ShardedLruCache<Key, Value>::ShardedLruCache(size_t capacity,
+                                             size_t num_shards,
+                                             ChargeFunc charge)
+    : charge_(std::move(charge)),
+      shards_(num_shards != 0
+                  ? num_shards
+                  : std::clamp<size_t>(capacity / 8, 1, 16)) {
+  CHECK_GT(capacity, 0UL);
+  SetCapacity(capacity);
+}
+
+template <typename Key, typename Value>
+std::optional<Value> ShardedLruCache<Key, Value>::Get(const Key& key) {
+  Shard& shard = ShardFor(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.index.find(key);
+  if (it == shard.index.end()) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = shard.slots[it->second];
+  slot.referenced = true;
+  return *slot.value;
+}
+
+template <typename Key, typename Value>
+Value ShardedLruCache<Key, Value>::GetOrInsert(
+    const Key& key, absl::AnyInvocable<Value(const Key&)> create) {
+  Shard& shard = ShardFor(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.index.find(key);
+  if (it != shard.index.end()) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = shard.slots[it->second];
+    slot.referenced = true;
+    return *slot.value;
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  Value value = create(key);
+  const size_t charge = charge_ != nullptr ? charge_(key, value) : 1;
+  shard.EvictUntilFits(charge, &evictions_);
+  size_t index;
+  if (!shard.free_slots.empty()) {
+    index = shard.free_slots.back();
+    shard.free_slots.pop_back();
+  } else {
+    index = shard.slots.size();
+    shard.slots.emplace_back();
+  }
+  Slot& slot = shard.slots[index];
+  slot.key = key;
+  slot.value = value;
+  slot.charge = charge;
+  // New entries start unreferenced, so that an entry that is never read
+  // again is the first to go.
+  slot.referenced = false;
+  shard.charge += charge;
+  shard.index.emplace(key, index);
+  return value;
+}
+
+template <typename Key, typename Value>
+void ShardedLruCache<Key, Value>::SetCapacity(size_t capacity) {
+  const size_t shard_capacity = ShardCapacity(capacity);
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    shard.capacity = shard_capacity;
+    shard.EvictUntilFits(0, &evictions_);
+  }
+}
+
+template <typename Key, typename Value>
+typename ShardedLruCache<Key, Value>::Stats
+ShardedLruCache<Key, Value>::GetStats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.evictions = evictions_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+template <typename Key, typename Value>
+void ShardedLruCache<Key, Value>::Shard::EvictUntilFits(
+    size_t extra, std::atomic<uint64_t>* evictions) {
+  // Every full turn of the hand clears all referenced bits, so this ends
+  // within two turns once the shard is empty enough.
+  while (!index.empty() && charge + extra > capacity) {
+    Slot& slot = slots[hand];
+    const size_t victim = hand;
+    hand = (hand + 1) % slots.size();
+    if (!slot.key.has_value()) continue;
+    if (slot.referenced) {
+      slot.referenced = false;
+      continue;
+    }
+    index.erase(*slot.key);
+    charge -= slot.charge;
+    slot.key.reset();
+    slot.value.reset();
+    free_slots.push_back(victim);
+    evictions->fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_UTIL_LRU_CACHE_H
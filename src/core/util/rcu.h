@@ -0,0 +1,119 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_RCU_H
+#define GRPC_SRC_CORE_UTIL_RCU_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <utility>
+
+#include "src/core/util/per_cpu.h"
+
+namespace grpc_core {
+
+// Holds a value of type T (typically a RefCountedPtr<> or unique_ptr<>)
+// that is read without a lock, for read-mostly state such as LB pickers.
+//
+// The value lives in one of two slots, chosen by version_ % 2.  Readers
+// count themselves in on their CPU's shard only while they use the value,
+// so they never write to a cache line shared with readers on other CPUs.
+// A new value goes in the other slot, and then version_ is bumped.  Readers
+// that started before that may still be using the old value, so it is only
+// retired once they have drained, which leaves its slot empty.
+//
+// Writers must be serialized by the caller, typically with the mutex that
+// guards the state the value is computed from.  Since writers wait for
+// readers, readers must not block or publish to the same Rcu.
+template <typename T>
+class Rcu {
+ public:
+  Rcu() = default;
+  Rcu(const Rcu&) = delete;
+  Rcu& operator=(const Rcu&) = delete;
+
+  // Calls fn with a const ref to the current value and returns its result.
+  // The value stays alive until fn returns, without taking a ref to it.
+  template <typename F>
+  auto Read(F fn) {
+    Readers& readers = readers_.this_cpu();
+    while (true) {
+      const uint64_t version = version_.load();
+      std::atomic<size_t>& count = readers.count[version % 2];
+      count.fetch_add(1);
+      // If a value was published meanwhile, the slot may be getting
+      // overwritten, so try again.
+      if (version_.load() != version) {
+        count.fetch_sub(1, std::memory_order_release);
+        continue;
+      }
+      ReleaseOnExit release(count);
+      const T& value = slots_[version % 2];
+      return fn(value);
+    }
+  }
+
+  // Returns a copy of the current value (e.g. a new ref to it).
+  T Get() {
+    return Read([](const T& value) { return value; });
+  }
+
+  // Makes value the current value.  Returns the previous value once no
+  // reader can still be using it, so that the caller can destroy it after
+  // releasing its lock.  The Rcu keeps no other copy of it.
+  T Exchange(T value) {
+    const uint64_t version = version_.load(std::memory_order_relaxed);
+    // Readers only use the slot that matches the current version, and the
+    // value in this slot was retired by the previous call, so readers that
+    // still count themselves in on it are about to back out.
+    slots_[(version + 1) % 2] = std::move(value);
+    version_.store(version + 1);
+    const size_t old_slot = version % 2;
+    for (Readers& readers : readers_) {
+      while (readers.count[old_slot].load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+      }
+    }
+    return std::exchange(slots_[old_slot], T());
+  }
+
+ private:
+  struct alignas(GPR_CACHELINE_SIZE) Readers {
+    std::array<std::atomic<size_t>, 2> count{};
+  };
+
+  class ReleaseOnExit {
+   public:
+    explicit ReleaseOnExit(std::atomic<size_t>& count) : count_(count) {}
+    ~ReleaseOnExit() { count_.fetch_sub(1, std::memory_order_release); }
+    ReleaseOnExit(const ReleaseOnExit&) = delete;
+    ReleaseOnExit& operator=(const ReleaseOnExit&) = delete;
+
+   private:
+    std::atomic<size_t>& count_;
+  };
+
+  std::array<T, 2> slots_{};
+  std::atomic<uint64_t> version_{0};
+  PerCpu<Readers> readers_{PerCpuOptions().SetMaxShards(32)};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_RCU_H
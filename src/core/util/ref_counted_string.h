@@ -21,6 +21,7 @@
 #include <stddef.h>
 
 #include <string>
+#include <utility>
 
 #include "absl/strings/string_view.h"
 #include "src/core/util/ref_counted.h"
@@ -78,6 +79,8 @@ class RefCountedStringValue {
   RefCountedStringValue() : str_{} {}
   explicit RefCountedStringValue(absl::string_view str)
       : str_(RefCountedString::Make(str)) {}
+  explicit RefCountedStringValue(RefCountedPtr<RefCountedString> str)
+      : str_(std::move(str)) {}
 
   absl::string_view as_string_view() const {
     return str_ == nullptr ? absl::string_view() : str_->as_string_view();
@@ -85,6 +88,17 @@ class RefCountedStringValue {
 
   const char* c_str() const { return str_ == nullptr ? "" : str_->c_str(); }
 
+  // True if this refers to exactly the string str (not just an equal one).
+  bool SameIdentity(const RefCountedString* str) const {
+    return str_.get() == str;
+  }
+
+  friend int QsortCompare(const RefCountedStringValue& lhs,
+                          const RefCountedStringValue& rhs) {
+    if (lhs.str_ == rhs.str_) return 0;
+    return lhs.as_string_view().compare(rhs.as_string_view());
+  }
+
  private:
   RefCountedPtr<RefCountedString> str_;
 };
@@ -137,6 +151,11 @@ inline bool operator>(const RefCountedStringValue& lhs,
   return lhs.as_string_view() > rhs.as_string_view();
 }
 
+inline int QsortCompare(const RefCountedStringValue& lhs,
+                        absl::string_view rhs) {
+  return lhs.as_string_view().compare(rhs);
+}
+
 // A sorting functor to support heterogeneous lookups in sorted containers.
 struct RefCountedStringValueLessThan {
   using is_transparent = void;
@@ -111,6 +111,34 @@ uint32_t DecodeUInt32FromBytes(const char* buf) {
          (static_cast<uint32_t>(ubuf[3]) << 24);
 }
 
+// Time properties are stored as 8 bytes of Unix nanos, which fit inline in
+// the payload cord, and are only formatted when the status is printed.
+// Older RFC3339 payloads (which are always longer) are still understood.
+constexpr size_t kEncodedTimeSize = 2 * sizeof(uint32_t);
+
+void EncodeTimeToBytes(absl::Time time, char* buf) {
+  const uint64_t nanos = static_cast<uint64_t>(absl::ToUnixNanos(time));
+  EncodeUInt32ToBytes(static_cast<uint32_t>(nanos), buf);
+  EncodeUInt32ToBytes(static_cast<uint32_t>(nanos >> 32),
+                      buf + sizeof(uint32_t));
+}
+
+std::optional<absl::Time> DecodeTime(absl::string_view payload) {
+  if (payload.size() == kEncodedTimeSize) {
+    const uint64_t nanos =
+        DecodeUInt32FromBytes(payload.data()) |
+        (static_cast<uint64_t>(
+             DecodeUInt32FromBytes(payload.data() + sizeof(uint32_t)))
+         << 32);
+    return absl::FromUnixNanos(static_cast<int64_t>(nanos));
+  }
+  absl::Time time;
+  if (absl::ParseTime(absl::RFC3339_full, payload, &time, nullptr)) {
+    return time;
+  }
+  return std::nullopt;
+}
+
 std::vector<absl::Status> ParseChildren(absl::Cord children) {
   std::vector<absl::Status> result;
   upb::Arena arena;
@@ -135,6 +163,8 @@ std::vector<absl::Status> ParseChildren(absl::Cord children) {
 absl::Status StatusCreate(absl::StatusCode code, absl::string_view msg,
                           const DebugLocation& location,
                           std::vector<absl::Status> children) {
+  // An OK status carries no payloads, so skip building them.
+  if (code == absl::StatusCode::kOk) return absl::OkStatus();
   absl::Status s(code, msg);
   if (location.file() != nullptr) {
     StatusSetStr(&s, StatusStrProperty::kFile, location.file());
@@ -152,6 +182,7 @@ absl::Status StatusCreate(absl::StatusCode code, absl::string_view msg,
 }
 
 void StatusSetInt(absl::Status* status, StatusIntProperty key, intptr_t value) {
+  if (status->ok()) return;
   status->SetPayload(GetStatusIntPropertyUrl(key),
                      absl::Cord(std::to_string(value)));
 }
@@ -177,6 +208,7 @@ std::optional<intptr_t> StatusGetInt(const absl::Status& status,
 
 void StatusSetStr(absl::Status* status, StatusStrProperty key,
                   absl::string_view value) {
+  if (status->ok()) return;
   status->SetPayload(GetStatusStrPropertyUrl(key), absl::Cord(value));
 }
 
@@ -191,10 +223,11 @@ std::optional<std::string> StatusGetStr(const absl::Status& status,
 
 void StatusSetTime(absl::Status* status, StatusTimeProperty key,
                    absl::Time time) {
-  std::string time_str =
-      absl::FormatTime(absl::RFC3339_full, time, absl::UTCTimeZone());
+  if (status->ok()) return;
+  char buf[kEncodedTimeSize];
+  EncodeTimeToBytes(time, buf);
   status->SetPayload(GetStatusTimePropertyUrl(key),
-                     absl::Cord(std::move(time_str)));
+                     absl::Cord(absl::string_view(buf, kEncodedTimeSize)));
 }
 
 std::optional<absl::Time> StatusGetTime(const absl::Status& status,
@@ -202,22 +235,14 @@ std::optional<absl::Time> StatusGetTime(const absl::Status& status,
   auto p = status.GetPayload(GetStatusTimePropertyUrl(key));
   if (p.has_value()) {
     auto sv = p->TryFlat();
-    absl::Time time;
-    if (sv.has_value()) {
-      if (absl::ParseTime(absl::RFC3339_full, sv.value(), &time, nullptr)) {
-        return time;
-      }
-    } else {
-      std::string s = std::string(*p);
-      if (absl::ParseTime(absl::RFC3339_full, s, &time, nullptr)) {
-        return time;
-      }
-    }
+    if (sv.has_value()) return DecodeTime(*sv);
+    return DecodeTime(std::string(*p));
   }
   return {};
 }
 
 void StatusAddChild(absl::Status* status, absl::Status child) {
+  if (status->ok()) return;
   upb::Arena arena;
   // Serialize msg to buf
   google_rpc_Status* msg = internal::StatusToProto(child, arena.ptr());
@@ -278,10 +303,10 @@ std::string StatusToString(const absl::Status& status) {
                                    absl::CHexEscape(payload_view), "\""));
       } else if (absl::StartsWith(type_url, kTypeTimeTag)) {
         type_url.remove_prefix(kTypeTimeTag.size());
-        absl::Time t;
-        if (absl::ParseTime(absl::RFC3339_full, payload_view, &t, nullptr)) {
+        std::optional<absl::Time> t = DecodeTime(payload_view);
+        if (t.has_value()) {
           kvs.push_back(
-              absl::StrCat(type_url, ":\"", absl::FormatTime(t), "\""));
+              absl::StrCat(type_url, ":\"", absl::FormatTime(*t), "\""));
         } else {
           kvs.push_back(absl::StrCat(type_url, ":\"",
                                      absl::CHexEscape(payload_view), "\""));
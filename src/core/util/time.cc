@@ -17,8 +17,10 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/time.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <limits>
 #include <string>
 #include <utility>
@@ -28,6 +30,12 @@
 #include "absl/strings/str_format.h"
 #include "src/core/util/no_destruct.h"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define GRPC_HAVE_TSC_CLOCK 1
+#endif
+
 // IWYU pragma: no_include <ratio>
 
 namespace grpc_core {
@@ -37,9 +45,231 @@ namespace {
 std::atomic<int64_t> g_process_epoch_seconds;
 std::atomic<gpr_cycle_counter> g_process_epoch_cycles;
 
+#ifdef GRPC_HAVE_TSC_CLOCK
+// Reads time from the CPU's invariant timestamp counter (TSC), which is much
+// cheaper than clock_gettime on hosts where the vDSO falls back to a syscall.
+//
+// TSC ticks are converted to milliseconds after the process epoch from an
+// anchor, a (ticks, millis) pair, at a rate measured against the monotonic
+// clock. The rate is first measured over kCalibrationInterval, during which
+// the monotonic clock is used. After that, the first reader past each
+// kResyncInterval re-anchors the conversion where the TSC clock is, and
+// re-measures the rate over the last interval. Any offset from the monotonic
+// clock is slewed away over the next interval rather than stepped, so time
+// neither jumps nor stalls. If the TSC goes backwards or strays more than
+// kMaxDriftMillis from the monotonic clock, the TSC clock is disabled for
+// good, and readings stay at or after the last TSC reading until the
+// monotonic clock catches up.
+class TscClock {
+ public:
+  static bool Supported() {
+    unsigned int eax, ebx, ecx, edx;
+    // CPUID.80000007H:EDX[8] is the invariant TSC bit.
+    return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) &&
+           (edx & (1u << 8)) != 0;
+  }
+
+  void Enable() {
+    if (sync_mu_.exchange(true, std::memory_order_acquire)) return;
+    if (state_.load(std::memory_order_relaxed) == kOff) {
+      ReadMonotonic(&sync_ticks_, &sync_nanos_);
+      calibration_done_nanos_ =
+          sync_nanos_ + kCalibrationInterval.millis() * GPR_NS_PER_MS;
+      state_.store(kCalibrating, std::memory_order_release);
+    }
+    sync_mu_.store(false, std::memory_order_release);
+  }
+
+  // Sets *millis to the current time, or returns false if the monotonic
+  // clock must be read instead.
+  bool Now(int64_t* millis) {
+    const int state = state_.load(std::memory_order_acquire);
+    if (GPR_UNLIKELY(state != kOn)) {
+      if (state == kCalibrating) MaybeFinishCalibration();
+      if (state != kDisabled) return false;
+      *millis = DisabledNow();
+      return true;
+    }
+    uint64_t ticks = __rdtsc();
+    if (GPR_UNLIKELY(ticks >=
+                     next_resync_ticks_.load(std::memory_order_relaxed))) {
+      if (!Resync()) {
+        *millis = DisabledNow();
+        return true;
+      }
+    }
+    uint64_t anchor_ticks;
+    double anchor_millis;
+    double millis_per_tick;
+    uint32_t seq;
+    do {
+      seq = seq_.load(std::memory_order_acquire);
+      anchor_ticks = anchor_ticks_.load(std::memory_order_relaxed);
+      anchor_millis = anchor_millis_.load(std::memory_order_relaxed);
+      millis_per_tick = millis_per_tick_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((seq & 1) != 0 || seq != seq_.load(std::memory_order_relaxed));
+    // Ticks read before a concurrent re-anchor map to the anchor.
+    ticks = std::max(ticks, anchor_ticks);
+    *millis = static_cast<int64_t>(
+        anchor_millis +
+        static_cast<double>(ticks - anchor_ticks) * millis_per_tick);
+    return true;
+  }
+
+ private:
+  enum { kOff, kCalibrating, kOn, kDisabled };
+
+  static constexpr Duration kCalibrationInterval = Duration::Milliseconds(100);
+  static constexpr Duration kResyncInterval = Duration::Seconds(1);
+  static constexpr double kMaxDriftMillis = 10;
+
+  // The monotonic clock, kept from going back before the readings handed out
+  // while the TSC clock was on.
+  int64_t DisabledNow() const {
+    return std::max<int64_t>(
+        Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC))
+            .milliseconds_after_process_epoch(),
+        disabled_floor_millis_);
+  }
+
+  // Reads the TSC and the monotonic clock, in nanoseconds, at about the same
+  // time.
+  static void ReadMonotonic(uint64_t* ticks, int64_t* nanos) {
+    const uint64_t before = __rdtsc();
+    gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+    const uint64_t after = __rdtsc();
+    *ticks = before + (after - before) / 2;
+    *nanos = now.tv_sec * GPR_NS_PER_SEC + now.tv_nsec;
+  }
+
+  // Keeps the fraction of a millisecond, so that the TSC clock starts and
+  // re-anchors where the monotonic clock actually is rather than up to a
+  // millisecond behind it.
+  static double NanosToMillisAfterProcessEpoch(int64_t nanos) {
+    // The process epoch is a whole second.
+    return static_cast<double>(
+               Timestamp::FromTimespecRoundDown(
+                   gpr_time_from_nanos(nanos, GPR_CLOCK_MONOTONIC))
+                   .milliseconds_after_process_epoch()) +
+           static_cast<double>(nanos % GPR_NS_PER_MS) / GPR_NS_PER_MS;
+  }
+
+  void MaybeFinishCalibration() {
+    gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+    if (now.tv_sec * GPR_NS_PER_SEC + now.tv_nsec < calibration_done_nanos_) {
+      return;
+    }
+    if (sync_mu_.exchange(true, std::memory_order_acquire)) return;
+    if (state_.load(std::memory_order_relaxed) == kCalibrating) {
+      uint64_t ticks;
+      int64_t nanos;
+      ReadMonotonic(&ticks, &nanos);
+      if (ticks <= sync_ticks_) {
+        Disable("TSC did not advance during calibration", 0);
+      } else {
+        const double millis = NanosToMillisAfterProcessEpoch(nanos);
+        Reanchor(ticks, nanos, millis, millis);
+        state_.store(kOn, std::memory_order_release);
+      }
+    }
+    sync_mu_.store(false, std::memory_order_release);
+  }
+
+  // Returns false if the TSC clock has been disabled.
+  bool Resync() {
+    if (sync_mu_.exchange(true, std::memory_order_acquire)) return true;
+    uint64_t ticks;
+    int64_t nanos;
+    ReadMonotonic(&ticks, &nanos);
+    if (ticks >= next_resync_ticks_.load(std::memory_order_relaxed)) {
+      const double monotonic_millis = NanosToMillisAfterProcessEpoch(nanos);
+      const double tsc_millis =
+          anchor_millis_.load(std::memory_order_relaxed) +
+          static_cast<double>(ticks -
+                              anchor_ticks_.load(std::memory_order_relaxed)) *
+              millis_per_tick_.load(std::memory_order_relaxed);
+      if (ticks <= sync_ticks_) {
+        Disable("TSC went backwards",
+                anchor_millis_.load(std::memory_order_relaxed));
+      } else if (std::abs(tsc_millis - monotonic_millis) > kMaxDriftMillis) {
+        Disable("TSC drifted from the monotonic clock", tsc_millis);
+      } else {
+        Reanchor(ticks, nanos, tsc_millis, monotonic_millis);
+      }
+    }
+    sync_mu_.store(false, std::memory_order_release);
+    return state_.load(std::memory_order_relaxed) == kOn;
+  }
+
+  // Anchors the conversion at (ticks, millis), with the rate measured since
+  // the previous sync, adjusted so that the TSC clock meets the monotonic
+  // clock, which read monotonic_millis at ticks, at the next sync. Requires
+  // sync_mu_.
+  void Reanchor(uint64_t ticks, int64_t nanos, double millis,
+                double monotonic_millis) {
+    const double measured_millis_per_tick =
+        static_cast<double>(nanos - sync_nanos_) / GPR_NS_PER_MS /
+        static_cast<double>(ticks - sync_ticks_);
+    // The offset is at most kMaxDriftMillis, so the rate stays positive.
+    const double interval_millis = kResyncInterval.millis();
+    const double millis_per_tick =
+        measured_millis_per_tick *
+        (interval_millis + monotonic_millis - millis) / interval_millis;
+    const uint32_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    anchor_ticks_.store(ticks, std::memory_order_relaxed);
+    anchor_millis_.store(millis, std::memory_order_relaxed);
+    millis_per_tick_.store(millis_per_tick, std::memory_order_relaxed);
+    seq_.store(seq + 2, std::memory_order_release);
+    sync_ticks_ = ticks;
+    sync_nanos_ = nanos;
+    next_resync_ticks_.store(
+        ticks + static_cast<uint64_t>(interval_millis /
+                                      measured_millis_per_tick),
+        std::memory_order_relaxed);
+  }
+
+  // Falls back to the monotonic clock, clamped to floor_millis, the latest
+  // reading the TSC clock may have handed out.
+  void Disable(const char* reason, double floor_millis) {
+    LOG(INFO) << "Disabling the TSC clock: " << reason;
+    disabled_floor_millis_ = static_cast<int64_t>(std::ceil(floor_millis));
+    state_.store(kDisabled, std::memory_order_release);
+  }
+
+  std::atomic<int> state_{kOff};
+  // Guards the sync state below, and is taken without waiting: readers that
+  // find it held carry on with the current anchor.
+  std::atomic<bool> sync_mu_{false};
+  uint64_t sync_ticks_ = 0;
+  int64_t sync_nanos_ = 0;
+  // Written before the state becomes kCalibrating.
+  int64_t calibration_done_nanos_ = 0;
+  // Written before the state becomes kDisabled.
+  int64_t disabled_floor_millis_ = 0;
+  std::atomic<uint64_t> next_resync_ticks_{0};
+  // The anchor, written under a sequence lock.
+  std::atomic<uint32_t> seq_{0};
+  std::atomic<uint64_t> anchor_ticks_{0};
+  std::atomic<double> anchor_millis_{0};
+  std::atomic<double> millis_per_tick_{0};
+};
+
+std::atomic<TscClock*> g_tsc_clock{nullptr};
+#endif  // GRPC_HAVE_TSC_CLOCK
+
 class GprNowTimeSource final : public Timestamp::Source {
  public:
   Timestamp Now() override {
+#ifdef GRPC_HAVE_TSC_CLOCK
+    TscClock* tsc_clock = g_tsc_clock.load(std::memory_order_acquire);
+    int64_t millis;
+    if (tsc_clock != nullptr && tsc_clock->Now(&millis)) {
+      return Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+    }
+#endif
     return Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC));
   }
 };
@@ -223,6 +453,20 @@ Duration::operator grpc_event_engine::experimental::EventEngine::Duration()
             std::numeric_limits<int64_t>::max() / GPR_NS_PER_MS));
 }
 
+bool EnableTscClock() {
+#ifdef GRPC_HAVE_TSC_CLOCK
+  if (!TscClock::Supported()) return false;
+  // Starts the process epoch before calibrating against it.
+  StartTime();
+  TscClock* tsc_clock = NoDestructSingleton<TscClock>::Get();
+  tsc_clock->Enable();
+  g_tsc_clock.store(tsc_clock, std::memory_order_release);
+  return true;
+#else
+  return false;
+#endif
+}
+
 void TestOnlySetProcessEpoch(gpr_timespec epoch) {
   g_process_epoch_seconds.store(
       gpr_convert_clock_type(epoch, GPR_CLOCK_MONOTONIC).tv_sec);
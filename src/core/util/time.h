@@ -378,6 +378,14 @@ inline Timestamp& Timestamp::operator+=(Duration duration) {
   return *this = (*this + duration);
 }
 
+// Makes Timestamp::Now() read the CPU's invariant timestamp counter (TSC)
+// rather than the monotonic clock, wherever no ScopedSource overrides it.
+// The TSC is calibrated against the monotonic clock, which is used until
+// calibration completes, and is re-synced to it every second. The monotonic
+// clock is used again for good if the TSC proves unstable.
+// Returns false, changing nothing, if the CPU has no invariant TSC.
+bool EnableTscClock();
+
 void TestOnlySetProcessEpoch(gpr_timespec epoch);
 
 }  // namespace grpc_core
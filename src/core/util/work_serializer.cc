@@ -62,6 +62,7 @@ class WorkSerializer::WorkSerializerImpl
           event_engine)
       : event_engine_(std::move(event_engine)) {}
   void Run(absl::AnyInvocable<void()> callback, DebugLocation location);
+  void RunUrgent(absl::AnyInvocable<void()> callback, DebugLocation location);
   void Run() override;
   void Orphan() override;
 
@@ -82,6 +83,15 @@ class WorkSerializer::WorkSerializerImpl
   };
   using CallbackVector = absl::InlinedVector<CallbackWrapper, 1>;
 
+  // Start running with callback as the only item in processing_.
+  void StartRunningLocked(absl::AnyInvocable<void()> callback,
+                          const DebugLocation& location)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Move urgent_incoming_ to the end of processing_, so that those callbacks
+  // run next.
+  void TakeUrgent();
+
   // Refill processing_ from incoming_
   // If processing_ is empty, also update running_ and return false.
   // If additionally orphaned, will also delete this (therefore, it's not safe
@@ -135,6 +145,11 @@ class WorkSerializer::WorkSerializerImpl
   // work item, but as load increases we get some natural batching and the
   // rate of mutex acquisitions per work item tends towards 1.
   CallbackVector incoming_ ABSL_GUARDED_BY(mu_);
+  // Queued urgent callbacks (see RunUrgent()). The work loop moves these into
+  // processing_ ahead of everything else before each callback it runs.
+  // urgent_pending_ lets it check for them without taking mu_.
+  CallbackVector urgent_incoming_ ABSL_GUARDED_BY(mu_);
+  std::atomic<bool> urgent_pending_{false};
 
   GPR_NO_UNIQUE_ADDRESS latent_see::Flow flow_;
 
@@ -169,15 +184,7 @@ void WorkSerializer::WorkSerializerImpl::Run(
   global_stats().IncrementWorkSerializerItemsEnqueued();
   MutexLock lock(&mu_);
   if (!running_) {
-    // If we were previously idle, insert this callback directly into the
-    // empty processing_ list and start running.
-    running_ = true;
-    running_start_time_ = std::chrono::steady_clock::now();
-    items_processed_during_run_ = 0;
-    time_running_items_ = std::chrono::steady_clock::duration();
-    CHECK(processing_.empty());
-    processing_.emplace_back(std::move(callback), location);
-    event_engine_->Run(this);
+    StartRunningLocked(std::move(callback), location);
   } else {
     // We are already running, so add this callback to the incoming_ list.
     // The work loop will eventually get to it.
@@ -185,12 +192,62 @@ void WorkSerializer::WorkSerializerImpl::Run(
   }
 }
 
+void WorkSerializer::WorkSerializerImpl::RunUrgent(
+    absl::AnyInvocable<void()> callback, DebugLocation location) {
+  if (!IsWorkSerializerUrgentLaneEnabled()) {
+    Run(std::move(callback), location);
+    return;
+  }
+  GRPC_TRACE_LOG(work_serializer, INFO)
+      << "WorkSerializer[" << this << "] Scheduling urgent callback ["
+      << location.file() << ":" << location.line() << "]";
+  global_stats().IncrementWorkSerializerItemsEnqueued();
+  MutexLock lock(&mu_);
+  if (!running_) {
+    StartRunningLocked(std::move(callback), location);
+  } else {
+    // We are already running: the work loop picks this up before the next
+    // callback it runs.
+    urgent_incoming_.emplace_back(std::move(callback), location);
+    urgent_pending_.store(true, std::memory_order_relaxed);
+  }
+}
+
+void WorkSerializer::WorkSerializerImpl::StartRunningLocked(
+    absl::AnyInvocable<void()> callback, const DebugLocation& location) {
+  // We were previously idle, so insert this callback directly into the
+  // empty processing_ list and start running.
+  running_ = true;
+  running_start_time_ = std::chrono::steady_clock::now();
+  items_processed_during_run_ = 0;
+  time_running_items_ = std::chrono::steady_clock::duration();
+  CHECK(processing_.empty());
+  processing_.emplace_back(std::move(callback), location);
+  event_engine_->Run(this);
+}
+
+void WorkSerializer::WorkSerializerImpl::TakeUrgent() {
+  CallbackVector urgent;
+  {
+    MutexLock lock(&mu_);
+    urgent.swap(urgent_incoming_);
+    urgent_pending_.store(false, std::memory_order_relaxed);
+  }
+  // processing_ is stored in reverse order, so push the urgent callbacks
+  // last-first to have them run next, in the order they were scheduled.
+  for (auto it = urgent.rbegin(); it != urgent.rend(); ++it) {
+    processing_.emplace_back(std::move(*it));
+  }
+}
+
 // Implementation of EventEngine::Closure::Run - our actual work loop
 void WorkSerializer::WorkSerializerImpl::Run() {
   GRPC_LATENT_SEE_PARENT_SCOPE("WorkSerializer::Run");
   flow_.End();
   // TODO(ctiller): remove these when we can deprecate ExecCtx
   ExecCtx exec_ctx;
+  // Let any urgent callbacks jump the queue.
+  if (urgent_pending_.load(std::memory_order_relaxed)) TakeUrgent();
   // Grab the last element of processing_ - which is the next item in our
   // queue since processing_ is stored in reverse order.
   auto& cb = processing_.back();
@@ -229,8 +286,9 @@ WorkSerializer::WorkSerializerImpl::RefillInner() {
   // Swap incoming_ into processing_ - effectively lets us release memory
   // (outside the lock) once per iteration for the storage vectors.
   processing_.swap(incoming_);
-  // If there were no items, then we've finished running.
-  if (processing_.empty()) {
+  // If there were no items, then we've finished running. Urgent callbacks
+  // still count as work: the next pass of the work loop will take them.
+  if (processing_.empty() && urgent_incoming_.empty()) {
     running_ = false;
     global_stats().IncrementWorkSerializerRunTimeMs(
         std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -289,6 +347,11 @@ void WorkSerializer::Run(absl::AnyInvocable<void()> callback,
   impl_->Run(std::move(callback), location);
 }
 
+void WorkSerializer::RunUrgent(absl::AnyInvocable<void()> callback,
+                               DebugLocation location) {
+  impl_->RunUrgent(std::move(callback), location);
+}
+
 #ifndef NDEBUG
 bool WorkSerializer::RunningInWorkSerializer() const {
   return impl_->RunningInWorkSerializer();
@@ -33,7 +33,8 @@ namespace grpc_core {
 // WorkSerializer is a mechanism to schedule callbacks in a synchronized manner.
 // All callbacks scheduled on a WorkSerializer instance will be executed
 // serially in a borrowed thread. The API provides a FIFO guarantee to the
-// execution of callbacks scheduled on the thread.
+// execution of callbacks scheduled on the thread via Run(); RunUrgent()
+// callbacks are FIFO among themselves and go ahead of pending Run() callbacks.
 // When a thread calls Run() with a callback the callback runs asynchronously.
 class ABSL_LOCKABLE WorkSerializer {
  public:
@@ -65,6 +66,14 @@ class ABSL_LOCKABLE WorkSerializer {
   //   void callback() ABSL_EXCLUSIVE_LOCKS_REQUIRED(work_serializer) { ... }
   void Run(absl::AnyInvocable<void()> callback, DebugLocation location = {});
 
+  // Like Run(), but the callback jumps ahead of any callbacks that were
+  // queued by Run() and have not started yet. Urgent callbacks run in FIFO
+  // order among themselves. Intended for short, latency sensitive work such as
+  // subchannel connectivity state changes, so that they are not held up
+  // behind bulk work like resolver results.
+  void RunUrgent(absl::AnyInvocable<void()> callback,
+                 DebugLocation location = {});
+
 #ifndef NDEBUG
   // Returns true if the current thread is running in the WorkSerializer.
   bool RunningInWorkSerializer() const;
@@ -244,4 +244,27 @@ XdsHttpFaultFilter::GenerateServiceConfig(
   return ServiceConfigJsonEntry{"", ""};
 }
 
+bool XdsHttpFaultFilter::IsNoopConfig(const FilterConfig& config) const {
+  // A policy with neither an abort code nor a delay, fixed or taken from the
+  // request headers, never injects a fault.
+  if (config.config.type() != Json::Type::kObject) return false;
+  const Json::Object& policy = config.config.object();
+  auto value = [&](absl::string_view key) -> const Json* {
+    auto it = policy.find(std::string(key));
+    return it == policy.end() ? nullptr : &it->second;
+  };
+  const Json* abort_code = value("abortCode");
+  if (abort_code != nullptr &&
+      abort_code->string() != grpc_status_code_to_string(GRPC_STATUS_OK)) {
+    return false;
+  }
+  const Json* delay = value("delay");
+  if (delay != nullptr &&
+      delay->string() != Duration::Zero().ToJsonString()) {
+    return false;
+  }
+  return value("abortCodeHeader") == nullptr &&
+         value("delayHeader") == nullptr;
+}
+
 }  // namespace grpc_core
@@ -119,6 +119,12 @@ class XdsHttpFilterImpl {
   virtual absl::StatusOr<ServiceConfigJsonEntry> GenerateServiceConfig(
       const FilterConfig& hcm_filter_config) const = 0;
 
+  // Returns true if calls with \a config are not affected by the filter, so
+  // that it can be left out of filter stacks where it has no other config.
+  virtual bool IsNoopConfig(const FilterConfig& /*config*/) const {
+    return false;
+  }
+
   // Returns true if the filter is supported on clients; false otherwise
   virtual bool IsSupportedOnClients() const = 0;
 
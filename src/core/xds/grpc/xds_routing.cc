@@ -25,12 +25,17 @@
 #include <algorithm>
 #include <cctype>
 #include <utility>
+#include <variant>
+#include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
+#include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/util/matchers.h"
 #include "src/core/xds/grpc/xds_http_filter.h"
@@ -47,35 +52,22 @@ enum MatchType {
 };
 
 // Returns true if match succeeds.
-bool DomainMatch(MatchType match_type, absl::string_view domain_pattern_in,
-                 absl::string_view expected_host_name_in) {
-  // Normalize the args to lower-case. Domain matching is case-insensitive.
-  std::string domain_pattern = std::string(domain_pattern_in);
-  std::string expected_host_name = std::string(expected_host_name_in);
-  std::transform(domain_pattern.begin(), domain_pattern.end(),
-                 domain_pattern.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
-  std::transform(expected_host_name.begin(), expected_host_name.end(),
-                 expected_host_name.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
+bool DomainMatch(MatchType match_type, absl::string_view domain_pattern,
+                 absl::string_view expected_host_name) {
+  // Domain matching is case-insensitive.
   if (match_type == EXACT_MATCH) {
-    return domain_pattern == expected_host_name;
+    return absl::EqualsIgnoreCase(domain_pattern, expected_host_name);
   } else if (match_type == SUFFIX_MATCH) {
     // Asterisk must match at least one char.
     if (expected_host_name.size() < domain_pattern.size()) return false;
-    absl::string_view pattern_suffix(domain_pattern.c_str() + 1);
-    absl::string_view host_suffix(expected_host_name.c_str() +
-                                  expected_host_name.size() -
-                                  pattern_suffix.size());
-    return pattern_suffix == host_suffix;
+    return absl::EndsWithIgnoreCase(expected_host_name,
+                                    domain_pattern.substr(1));
   } else if (match_type == PREFIX_MATCH) {
     // Asterisk must match at least one char.
     if (expected_host_name.size() < domain_pattern.size()) return false;
-    absl::string_view pattern_prefix(domain_pattern.c_str(),
-                                     domain_pattern.size() - 1);
-    absl::string_view host_prefix(expected_host_name.c_str(),
-                                  pattern_prefix.size());
-    return pattern_prefix == host_prefix;
+    return absl::StartsWithIgnoreCase(
+        expected_host_name,
+        domain_pattern.substr(0, domain_pattern.size() - 1));
   } else {
     return match_type == UNIVERSE_MATCH;
   }
@@ -154,6 +146,15 @@ bool UnderFraction(const uint32_t fraction_per_million) {
   return random_number < fraction_per_million;
 }
 
+// Returns true if the header and fraction matchers match.
+bool RouteMatchesRequest(
+    const XdsRouteConfigResource::Route::Matchers& matchers,
+    grpc_metadata_batch* initial_metadata) {
+  return HeadersMatch(matchers.header_matchers, initial_metadata) &&
+         (!matchers.fraction_per_million.has_value() ||
+          UnderFraction(*matchers.fraction_per_million));
+}
+
 }  // namespace
 
 std::optional<size_t> XdsRouting::GetRouteForRequest(
@@ -163,15 +164,126 @@ std::optional<size_t> XdsRouting::GetRouteForRequest(
     const XdsRouteConfigResource::Route::Matchers& matchers =
         route_list_iterator.GetMatchersForRoute(i);
     if (matchers.path_matcher.Match(path) &&
-        HeadersMatch(matchers.header_matchers, initial_metadata) &&
-        (!matchers.fraction_per_million.has_value() ||
-         UnderFraction(*matchers.fraction_per_million))) {
+        RouteMatchesRequest(matchers, initial_metadata)) {
       return i;
     }
   }
   return std::nullopt;
 }
 
+//
+// XdsRouting::RouteTable
+//
+
+XdsRouting::RouteTable::RouteTable(
+    const RouteListIterator& route_list_iterator) {
+  std::vector<std::string> regexes;
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const StringMatcher& path_matcher =
+        route_list_iterator.GetMatchersForRoute(i).path_matcher;
+    switch (path_matcher.type()) {
+      case StringMatcher::Type::kExact:
+        if (path_matcher.case_sensitive()) {
+          exact_routes_[path_matcher.string_matcher()].push_back(i);
+          continue;
+        }
+        break;
+      case StringMatcher::Type::kPrefix:
+        if (path_matcher.case_sensitive()) {
+          prefix_routes_[path_matcher.string_matcher()].push_back(i);
+          continue;
+        }
+        break;
+      case StringMatcher::Type::kSafeRegex:
+        regexes.push_back(path_matcher.regex_matcher()->pattern());
+        regex_routes_.push_back(i);
+        continue;
+      default:
+        break;
+    }
+    other_routes_.push_back(i);
+  }
+  for (const auto& p : prefix_routes_) {
+    prefix_lengths_.push_back(p.first.size());
+  }
+  std::sort(prefix_lengths_.begin(), prefix_lengths_.end());
+  prefix_lengths_.erase(
+      std::unique(prefix_lengths_.begin(), prefix_lengths_.end()),
+      prefix_lengths_.end());
+  if (regexes.empty()) return;
+  // StringMatcher uses RE2::FullMatch() with the default options.
+  regex_set_ =
+      std::make_unique<RE2::Set>(RE2::DefaultOptions, RE2::ANCHOR_BOTH);
+  bool ok = true;
+  for (const std::string& regex : regexes) {
+    std::string error;
+    if (regex_set_->Add(regex, &error) < 0) {
+      LOG(ERROR) << "xDS route regex \"" << regex
+                 << "\" cannot be added to the route table: " << error;
+      ok = false;
+      break;
+    }
+  }
+  if (ok && !regex_set_->Compile()) {
+    LOG(ERROR) << "Failed to compile the " << regexes.size()
+               << " xDS route regexes into a set";
+    ok = false;
+  }
+  // If the set can't be built (e.g., it would use too much memory), fall
+  // back to matching the regexes one by one.
+  if (!ok) {
+    regex_set_.reset();
+    other_routes_.insert(other_routes_.end(), regex_routes_.begin(),
+                         regex_routes_.end());
+    std::sort(other_routes_.begin(), other_routes_.end());
+    regex_routes_.clear();
+  }
+}
+
+std::optional<size_t> XdsRouting::RouteTable::GetRouteForRequest(
+    const RouteListIterator& route_list_iterator, absl::string_view path,
+    grpc_metadata_batch* initial_metadata) const {
+  // Routes whose path matcher may match the request.
+  struct Candidates {
+    absl::Span<const size_t> routes;
+    // If false, the path matcher still needs to be checked.
+    bool path_matched;
+  };
+  absl::InlinedVector<Candidates, 8> candidates;
+  auto it = exact_routes_.find(path);
+  if (it != exact_routes_.end()) candidates.push_back({it->second, true});
+  for (size_t length : prefix_lengths_) {
+    if (length > path.size()) break;
+    it = prefix_routes_.find(path.substr(0, length));
+    if (it != prefix_routes_.end()) candidates.push_back({it->second, true});
+  }
+  // The set is only asked whether any regex matches, which needs no
+  // allocations; if one does, the regex routes are checked one by one.
+  if (regex_set_ != nullptr &&
+      regex_set_->Match(re2::StringPiece(path.data(), path.size()),
+                        nullptr)) {
+    candidates.push_back({regex_routes_, false});
+  }
+  if (!other_routes_.empty()) candidates.push_back({other_routes_, false});
+  // Check the candidates in route order, as the linear scan would.
+  while (true) {
+    Candidates* next = nullptr;
+    for (Candidates& c : candidates) {
+      if (c.routes.empty()) continue;
+      if (next == nullptr || c.routes.front() < next->routes.front()) next = &c;
+    }
+    if (next == nullptr) return std::nullopt;
+    const size_t index = next->routes.front();
+    next->routes.remove_prefix(1);
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(index);
+    if ((next->path_matched || matchers.path_matcher.Match(path)) &&
+        RouteMatchesRequest(matchers, initial_metadata)) {
+      return index;
+    }
+  }
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
@@ -253,8 +365,62 @@ GeneratePerHTTPFilterConfigs(
   return result;
 }
 
+// Returns true if the filter instance has a no-op config for every route and
+// weighted cluster of vhost, once overrides are taken into account.
+bool IsNoopForVirtualHost(
+    const XdsHttpFilterImpl& filter_impl,
+    const XdsListenerResource::HttpConnectionManager::HttpFilter& http_filter,
+    const XdsRouteConfigResource::VirtualHost& vhost) {
+  auto is_noop = [&](const XdsRouteConfigResource::Route& route,
+                     const XdsRouteConfigResource::Route::RouteAction::
+                         ClusterWeight* cluster_weight) {
+    const XdsHttpFilterImpl::FilterConfig* config_override =
+        FindFilterConfigOverride(http_filter.name, vhost, route,
+                                 cluster_weight);
+    return filter_impl.IsNoopConfig(
+        config_override != nullptr ? *config_override : http_filter.config);
+  };
+  for (const auto& route : vhost.routes) {
+    // Calls on routes of other kinds fail before reaching the filters.
+    const auto* route_action =
+        std::get_if<XdsRouteConfigResource::Route::RouteAction>(&route.action);
+    if (route_action == nullptr) continue;
+    const auto* weighted_clusters = std::get_if<
+        std::vector<XdsRouteConfigResource::Route::RouteAction::ClusterWeight>>(
+        &route_action->action);
+    if (weighted_clusters == nullptr) {
+      if (!is_noop(route, nullptr)) return false;
+      continue;
+    }
+    for (const auto& cluster_weight : *weighted_clusters) {
+      if (!is_noop(route, &cluster_weight)) return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace
 
+std::vector<XdsListenerResource::HttpConnectionManager::HttpFilter>
+XdsRouting::ActiveHttpFilters(
+    const XdsHttpFilterRegistry& http_filter_registry,
+    const std::vector<XdsListenerResource::HttpConnectionManager::HttpFilter>&
+        http_filters,
+    const XdsRouteConfigResource::VirtualHost& vhost) {
+  std::vector<XdsListenerResource::HttpConnectionManager::HttpFilter> active;
+  for (const auto& http_filter : http_filters) {
+    // Find filter.  This is guaranteed to succeed, because it's checked
+    // at config validation time in the listener parsing code.
+    const XdsHttpFilterImpl* filter_impl =
+        http_filter_registry.GetFilterForType(
+            http_filter.config.config_proto_type_name);
+    CHECK_NE(filter_impl, nullptr);
+    if (IsNoopForVirtualHost(*filter_impl, http_filter, vhost)) continue;
+    active.push_back(http_filter);
+  }
+  return active;
+}
+
 absl::StatusOr<XdsRouting::GeneratePerHttpFilterConfigsResult>
 XdsRouting::GeneratePerHTTPFilterConfigsForMethodConfig(
     const XdsHttpFilterRegistry& http_filter_registry,
@@ -23,12 +23,15 @@
 #include <stddef.h>
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "re2/set.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/xds/grpc/xds_http_filter_registry.h"
@@ -59,6 +62,40 @@ class XdsRouting final {
         size_t index) const = 0;
   };
 
+  // An index of the path matchers in a route list, built once when the
+  // route list changes, so that finding the route for a request only has
+  // to look at routes whose path matcher matches the request's path:
+  // - Case-sensitive exact path matchers are looked up in a hash map.
+  // - Case-sensitive prefix matchers are looked up in a hash map for each
+  //   prefix length used in the list.
+  // - Regex matchers are skipped at once when none of them match, using an
+  //   RE2::Set.
+  // - Any other path matchers are checked one by one.
+  // The header and fraction matchers of those routes are then checked in
+  // route order, so the result is the same as that of the linear scan.
+  class RouteTable final {
+   public:
+    RouteTable() = default;
+    explicit RouteTable(const RouteListIterator& route_list_iterator);
+
+    // Same as XdsRouting::GetRouteForRequest().  route_list_iterator must
+    // be for the same routes that the table was built from.
+    std::optional<size_t> GetRouteForRequest(
+        const RouteListIterator& route_list_iterator, absl::string_view path,
+        grpc_metadata_batch* initial_metadata) const;
+
+   private:
+    // Each list of route indexes is in ascending order.
+    absl::flat_hash_map<std::string, std::vector<size_t>> exact_routes_;
+    absl::flat_hash_map<std::string, std::vector<size_t>> prefix_routes_;
+    // The lengths of the keys of prefix_routes_, in ascending order.
+    std::vector<size_t> prefix_lengths_;
+    std::unique_ptr<RE2::Set> regex_set_;
+    // The routes with regex path matchers, used if regex_set_ matches.
+    std::vector<size_t> regex_routes_;
+    std::vector<size_t> other_routes_;
+  };
+
   // Returns the index of the selected virtual host in the list.
   static std::optional<size_t> FindVirtualHostForDomain(
       const VirtualHostListIterator& vhost_iterator, absl::string_view domain);
@@ -86,6 +123,19 @@ class XdsRouting final {
     ChannelArgs args;
   };
 
+  // Returns the filters in \a http_filters that do something for at least
+  // one route of \a vhost, leaving out those whose configs and overrides are
+  // all no-ops, so that the filter stack that is built from the result does
+  // not run them for every call. The per-HTTP filter configs must then be
+  // generated from the same list, so that each filter instance finds its
+  // config at the same index.
+  static std::vector<XdsListenerResource::HttpConnectionManager::HttpFilter>
+  ActiveHttpFilters(
+      const XdsHttpFilterRegistry& http_filter_registry,
+      const std::vector<XdsListenerResource::HttpConnectionManager::HttpFilter>&
+          http_filters,
+      const XdsRouteConfigResource::VirtualHost& vhost);
+
   // Generates per-HTTP filter configs for a method config.
   static absl::StatusOr<GeneratePerHttpFilterConfigsResult>
   GeneratePerHTTPFilterConfigsForMethodConfig(
@@ -46,6 +46,8 @@ constexpr absl::string_view kServerFeatureResourceTimerIsTransientFailure =
 constexpr absl::string_view kServerFeatureTrustedXdsServer =
     "trusted_xds_server";
 
+constexpr absl::string_view kServerFeatureDeltaXds = "delta_xds";
+
 }  // namespace
 
 bool GrpcXdsServer::IgnoreResourceDeletion() const {
@@ -64,6 +66,11 @@ bool GrpcXdsServer::ResourceTimerIsTransientFailure() const {
          server_features_.end();
 }
 
+bool GrpcXdsServer::UseDeltaProtocol() const {
+  return server_features_.find(std::string(kServerFeatureDeltaXds)) !=
+         server_features_.end();
+}
+
 bool GrpcXdsServer::TrustedXdsServer() const {
   return server_features_.find(std::string(kServerFeatureTrustedXdsServer)) !=
          server_features_.end();
@@ -147,7 +154,8 @@ void GrpcXdsServer::JsonPostLoad(const Json& json, const JsonArgs& args,
                feature_json.string() == kServerFeatureFailOnDataErrors ||
                feature_json.string() ==
                    kServerFeatureResourceTimerIsTransientFailure ||
-               feature_json.string() == kServerFeatureTrustedXdsServer)) {
+               feature_json.string() == kServerFeatureTrustedXdsServer ||
+               feature_json.string() == kServerFeatureDeltaXds)) {
             server_features_.insert(feature_json.string());
           }
         }
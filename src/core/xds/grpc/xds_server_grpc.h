@@ -38,6 +38,7 @@ class GrpcXdsServer final : public GrpcXdsServerInterface {
   bool IgnoreResourceDeletion() const override;
   bool FailOnDataErrors() const override;
   bool ResourceTimerIsTransientFailure() const override;
+  bool UseDeltaProtocol() const override;
 
   bool TrustedXdsServer() const;
 
@@ -18,6 +18,8 @@
 
 #include <grpc/event_engine/event_engine.h>
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <optional>
 #include <set>
@@ -77,6 +79,21 @@ uint64_t GetAndResetCounter(std::atomic<uint64_t>* from) {
   return from->exchange(0, std::memory_order_relaxed);
 }
 
+// Records one request with the given value for the metric called name.
+// Only allocates the first time the metric is seen.
+void AddNamedMetric(
+    std::map<std::string, LrsClient::ClusterLocalityStats::BackendMetric,
+             std::less<>>& metrics,
+    absl::string_view name, double value) {
+  auto it = metrics.find(name);
+  if (it == metrics.end()) {
+    it = metrics.emplace(std::string(name),
+                         LrsClient::ClusterLocalityStats::BackendMetric())
+             .first;
+  }
+  it->second += LrsClient::ClusterLocalityStats::BackendMetric(1, value);
+}
+
 }  // namespace
 
 //
@@ -112,19 +129,30 @@ LrsClient::ClusterDropStats::~ClusterDropStats() {
 LrsClient::ClusterDropStats::Snapshot
 LrsClient::ClusterDropStats::GetSnapshotAndReset() {
   Snapshot snapshot;
-  snapshot.uncategorized_drops = GetAndResetCounter(&uncategorized_drops_);
-  MutexLock lock(&mu_);
-  snapshot.categorized_drops = std::move(categorized_drops_);
+  for (auto& percpu_stats : stats_) {
+    Snapshot percpu_snapshot;
+    percpu_snapshot.uncategorized_drops =
+        GetAndResetCounter(&percpu_stats.uncategorized_drops);
+    {
+      MutexLock lock(&percpu_stats.mu);
+      percpu_snapshot.categorized_drops =
+          std::move(percpu_stats.categorized_drops);
+      percpu_stats.categorized_drops.clear();
+    }
+    snapshot += percpu_snapshot;
+  }
   return snapshot;
 }
 
 void LrsClient::ClusterDropStats::AddUncategorizedDrops() {
-  uncategorized_drops_.fetch_add(1);
+  stats_.this_cpu().uncategorized_drops.fetch_add(1,
+                                                  std::memory_order_relaxed);
 }
 
 void LrsClient::ClusterDropStats::AddCallDropped(const std::string& category) {
-  MutexLock lock(&mu_);
-  ++categorized_drops_[category];
+  Stats& stats = stats_.this_cpu();
+  MutexLock lock(&stats.mu);
+  ++stats.categorized_drops[category];
 }
 
 //
@@ -187,7 +215,13 @@ LrsClient::ClusterLocalityStats::GetSnapshotAndReset() {
       percpu_snapshot.mem_utilization = std::move(percpu_stats.mem_utilization);
       percpu_snapshot.application_utilization =
           std::move(percpu_stats.application_utilization);
-      percpu_snapshot.backend_metrics = std::move(percpu_stats.backend_metrics);
+      const bool add_prefix = XdsOrcaLrsPropagationChangesEnabled();
+      for (auto& [name, value] : percpu_stats.backend_metrics) {
+        std::string key =
+            add_prefix ? absl::StrCat("named_metrics.", name) : name;
+        percpu_snapshot.backend_metrics[std::move(key)] = std::move(value);
+      }
+      percpu_stats.backend_metrics.clear();
     }
     snapshot += percpu_snapshot;
   }
@@ -208,10 +242,16 @@ void LrsClient::ClusterLocalityStats::AddCallFinished(
   to_increment.fetch_add(1, std::memory_order_relaxed);
   stats.total_requests_in_progress.fetch_add(-1, std::memory_order_acq_rel);
   if (backend_metrics == nullptr) return;
+  // Don't take the lock if there is nothing to record.
+  if (XdsOrcaLrsPropagationChangesEnabled() &&
+      backend_metric_propagation_->propagation_bits == 0 &&
+      backend_metric_propagation_->named_metric_keys.empty()) {
+    return;
+  }
   MutexLock lock(&stats.backend_metrics_mu);
   if (!XdsOrcaLrsPropagationChangesEnabled()) {
     for (const auto& [name, value] : backend_metrics->named_metrics) {
-      stats.backend_metrics[std::string(name)] += BackendMetric(1, value);
+      AddNamedMetric(stats.backend_metrics, name, value);
     }
     return;
   }
@@ -235,8 +275,7 @@ void LrsClient::ClusterLocalityStats::AddCallFinished(
       if (backend_metric_propagation_->propagation_bits &
               BackendMetricPropagation::kNamedMetricsAll ||
           backend_metric_propagation_->named_metric_keys.contains(name)) {
-        stats.backend_metrics[absl::StrCat("named_metrics.", name)] +=
-            BackendMetric(1, value);
+        AddNamedMetric(stats.backend_metrics, name, value);
       }
     }
   }
@@ -20,6 +20,7 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -102,12 +103,17 @@ class LrsClient : public DualRefCounted<LrsClient> {
     absl::string_view lrs_server_;
     absl::string_view cluster_name_;
     absl::string_view eds_service_name_;
-    std::atomic<uint64_t> uncategorized_drops_{0};
-    // Protects categorized_drops_. A mutex is necessary because the length of
-    // dropped_requests can be accessed by both the picker (from data plane
-    // mutex) and the load reporting thread (from the control plane combiner).
-    Mutex mu_;
-    CategorizedDropsMap categorized_drops_ ABSL_GUARDED_BY(mu_);
+    // Sharded per CPU, like the locality stats, since drops are counted
+    // by the picker for every dropped call.
+    struct Stats {
+      std::atomic<uint64_t> uncategorized_drops{0};
+      // Protects categorized_drops. A mutex is necessary because the map can
+      // be accessed by both the picker (from data plane mutex) and the load
+      // reporting thread (from the control plane combiner).
+      Mutex mu;
+      CategorizedDropsMap categorized_drops ABSL_GUARDED_BY(mu);
+    };
+    PerCpu<Stats> stats_{PerCpuOptions().SetMaxShards(32).SetCpusPerShard(4)};
   };
 
   // Locality stats for an xds cluster.
@@ -215,7 +221,10 @@ class LrsClient : public DualRefCounted<LrsClient> {
       BackendMetric cpu_utilization ABSL_GUARDED_BY(backend_metrics_mu);
       BackendMetric mem_utilization ABSL_GUARDED_BY(backend_metrics_mu);
       BackendMetric application_utilization ABSL_GUARDED_BY(backend_metrics_mu);
-      std::map<std::string, BackendMetric> backend_metrics
+      // Keyed by the name reported by the backend, so that recording a
+      // metric that has been seen before does not allocate.  Any
+      // "named_metrics." prefix is added by GetSnapshotAndReset().
+      std::map<std::string, BackendMetric, std::less<>> backend_metrics
           ABSL_GUARDED_BY(backend_metrics_mu);
     };
 
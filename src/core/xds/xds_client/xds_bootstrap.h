@@ -55,6 +55,10 @@ class XdsBootstrap {
     virtual bool FailOnDataErrors() const = 0;
     virtual bool ResourceTimerIsTransientFailure() const = 0;
 
+    // If true, the ADS stream uses the incremental (delta) xDS protocol
+    // instead of the state-of-the-world protocol.
+    virtual bool UseDeltaProtocol() const = 0;
+
     virtual bool Equals(const XdsServer& other) const = 0;
 
     // Returns a key to be used for uniquely identifying this XdsServer.
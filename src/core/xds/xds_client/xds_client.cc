@@ -304,6 +304,15 @@ class XdsClient::XdsChannel::AdsCall final
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // Used only for the delta protocol: subscription changes that have
+    // not yet been sent to the server, and whether we have sent any
+    // request for this type on this stream.
+    std::map<std::string /*authority*/, std::set<XdsResourceKey>>
+        subscribes_to_send;
+    std::map<std::string /*authority*/, std::set<XdsResourceKey>>
+        unsubscribes_to_send;
+    bool sent_delta_request = false;
   };
 
   std::string CreateAdsRequest(absl::string_view type_url,
@@ -312,6 +321,13 @@ class XdsClient::XdsChannel::AdsCall final
                                const std::vector<std::string>& resource_names,
                                absl::Status status) const
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  std::string CreateDeltaAdsRequest(
+      absl::string_view type_url, absl::string_view nonce,
+      const std::vector<std::string>& subscribes,
+      const std::vector<std::string>& unsubscribes,
+      const std::map<std::string, std::string>& initial_resource_versions,
+      absl::Status status) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
@@ -330,19 +346,50 @@ class XdsClient::XdsChannel::AdsCall final
     Timestamp update_time = Timestamp::Now();
     RefCountedPtr<ReadDelayHandle> read_delay_handle;
   };
+  // Cancels the resource-does-not-exist timer for the resource, if any.
+  void MarkResourceSeenLocked(const XdsResourceType* type,
+                              const XdsResourceName& name)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Returns the cache entry for the resource, or null if we don't have a
+  // subscription for it.
+  ResourceState* FindResourceStateLocked(const XdsResourceType* type,
+                                         const XdsResourceName& name)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // If serialized_resource is identical to the cached resource, updates
+  // the cache without decoding it and returns true.
+  bool MaybeReuseCachedResourceLocked(absl::string_view resource_name,
+                                      absl::string_view serialized_resource,
+                                      const std::string& version,
+                                      DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void OnResourceUnchangedLocked(absl::string_view resource_name,
+                                 const ResourceState& resource_state,
+                                 DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   void ParseResource(size_t idx, absl::string_view type_url,
                      absl::string_view resource_name,
                      absl::string_view serialized_resource,
-                     DecodeContext* context)
+                     const std::string& version, DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   void HandleServerReportedResourceError(size_t idx,
                                          absl::string_view resource_name,
                                          absl::Status status,
                                          DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void HandleServerReportedResourceErrors(
+      const envoy_service_discovery_v3_ResourceError* const* errors,
+      size_t num_errors, DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Handles a resource listed in removed_resources of a delta response.
+  void HandleResourceRemoval(size_t idx, absl::string_view resource_name,
+                             DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   absl::Status DecodeAdsResponse(absl::string_view encoded_response,
                                  DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  absl::Status DecodeDeltaAdsResponse(absl::string_view encoded_response,
+                                      DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
@@ -354,10 +401,22 @@ class XdsClient::XdsChannel::AdsCall final
   // request.  Also starts the timer for each resource if needed.
   std::vector<std::string> ResourceNamesForRequest(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Same as ResourceNamesForRequest(), but for the delta protocol:
+  // returns only the subscription changes since the last request, along
+  // with the versions of cached resources on the first request for the
+  // type on this stream.
+  void DeltaChangesForRequest(
+      const XdsResourceType* type, std::vector<std::string>* subscribes,
+      std::vector<std::string>* unsubscribes,
+      std::map<std::string, std::string>* initial_resource_versions)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   // The owning RetryableCall<>.
   RefCountedPtr<RetryableCall<AdsCall>> retryable_call_;
 
+  // Whether this stream uses the delta protocol.
+  const bool use_delta_protocol_;
+
   OrphanablePtr<XdsTransportFactory::XdsTransport::StreamingCall>
       streaming_call_;
 
@@ -708,12 +767,16 @@ XdsClient::XdsChannel::AdsCall::AdsCall(
     RefCountedPtr<RetryableCall<AdsCall>> retryable_call)
     : InternallyRefCounted<AdsCall>(
           GRPC_TRACE_FLAG_ENABLED(xds_client_refcount) ? "AdsCall" : nullptr),
-      retryable_call_(std::move(retryable_call)) {
+      retryable_call_(std::move(retryable_call)),
+      use_delta_protocol_(xds_channel()->server_.UseDeltaProtocol()) {
   CHECK_NE(xds_client(), nullptr);
   // Init the ADS call.
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      use_delta_protocol_
+          ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "DeltaAggregatedResources"
+          : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "StreamAggregatedResources";
   streaming_call_ = xds_channel()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -724,7 +787,8 @@ XdsClient::XdsChannel::AdsCall::AdsCall(
   GRPC_TRACE_LOG(xds_client, INFO)
       << "[xds_client " << xds_client() << "] xds server "
       << xds_channel()->server_.server_uri()
-      << ": starting ADS call (ads_call: " << this
+      << ": starting " << (use_delta_protocol_ ? "delta " : "")
+      << "ADS call (ads_call: " << this
       << ", streaming_call: " << streaming_call_.get() << ")";
   // If this is a reconnect, add any necessary subscriptions from what's
   // already in the cache.
@@ -768,9 +832,18 @@ void XdsClient::XdsChannel::AdsCall::Orphan() {
 
 void XdsClient::XdsChannel::AdsCall::SubscribeLocked(
     const XdsResourceType* type, const XdsResourceName& name, bool delay_send) {
-  auto& state = state_map_[type].subscribed_resources[name.authority][name.key];
+  auto& type_state = state_map_[type];
+  auto& state = type_state.subscribed_resources[name.authority][name.key];
   if (state == nullptr) {
     state = MakeOrphanable<ResourceTimer>(type, name);
+    if (use_delta_protocol_) {
+      type_state.subscribes_to_send[name.authority].insert(name.key);
+      auto it = type_state.unsubscribes_to_send.find(name.authority);
+      if (it != type_state.unsubscribes_to_send.end()) {
+        it->second.erase(name.key);
+        if (it->second.empty()) type_state.unsubscribes_to_send.erase(it);
+      }
+    }
     if (!delay_send) SendMessageLocked(type);
   }
 }
@@ -788,6 +861,14 @@ void XdsClient::XdsChannel::AdsCall::UnsubscribeLocked(
     // because we need to retain the nonce in case a new watch is
     // started for a resource of this type while this stream is still open.
   }
+  if (use_delta_protocol_) {
+    type_state_map.unsubscribes_to_send[name.authority].insert(name.key);
+    auto it = type_state_map.subscribes_to_send.find(name.authority);
+    if (it != type_state_map.subscribes_to_send.end()) {
+      it->second.erase(name.key);
+      if (it->second.empty()) type_state_map.subscribes_to_send.erase(it);
+    }
+  }
   // Don't need to send unsubscription message if this was the last
   // resource we were subscribed to, since we'll be closing the stream
   // immediately in that case.
@@ -826,6 +907,42 @@ std::string SerializeDiscoveryRequest(
   return std::string(output, output_length);
 }
 
+void MaybeLogDeltaDiscoveryRequest(
+    const XdsClient* client, upb_DefPool* def_pool,
+    const envoy_service_discovery_v3_DeltaDiscoveryRequest* request) {
+  if (GRPC_TRACE_FLAG_ENABLED(xds_client) && ABSL_VLOG_IS_ON(2)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_getmsgdef(def_pool);
+    char buf[10240];
+    upb_TextEncode(reinterpret_cast<const upb_Message*>(request), msg_type,
+                   nullptr, 0, buf, sizeof(buf));
+    VLOG(2) << "[xds_client " << client
+            << "] constructed delta ADS request: " << buf;
+  }
+}
+
+std::string SerializeDeltaDiscoveryRequest(
+    upb_Arena* arena,
+    envoy_service_discovery_v3_DeltaDiscoveryRequest* request) {
+  size_t output_length;
+  char* output = envoy_service_discovery_v3_DeltaDiscoveryRequest_serialize(
+      request, arena, &output_length);
+  return std::string(output, output_length);
+}
+
+// Fills in error_detail for a NACK.
+void PopulateErrorDetail(const absl::Status& status,
+                         google_rpc_Status* error_detail) {
+  // Hard-code INVALID_ARGUMENT as the status code.
+  // TODO(roth): If at some point we decide we care about this value,
+  // we could attach a status code to the individual errors where we
+  // generate them in the parsing code, and then use that here.
+  google_rpc_Status_set_code(error_detail, GRPC_STATUS_INVALID_ARGUMENT);
+  // Error description comes from the status that was passed in.
+  google_rpc_Status_set_message(error_detail,
+                                StdStringToUpbString(status.message()));
+}
+
 }  // namespace
 
 std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
@@ -851,21 +968,11 @@ std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
         request, StdStringToUpbString(nonce));
   }
   // Set error_detail if it's a NACK.
-  std::string error_string_storage;
   if (!status.ok()) {
-    google_rpc_Status* error_detail =
+    PopulateErrorDetail(
+        status,
         envoy_service_discovery_v3_DiscoveryRequest_mutable_error_detail(
-            request, arena.ptr());
-    // Hard-code INVALID_ARGUMENT as the status code.
-    // TODO(roth): If at some point we decide we care about this value,
-    // we could attach a status code to the individual errors where we
-    // generate them in the parsing code, and then use that here.
-    google_rpc_Status_set_code(error_detail, GRPC_STATUS_INVALID_ARGUMENT);
-    // Error description comes from the status that was passed in.
-    error_string_storage = std::string(status.message());
-    upb_StringView error_description =
-        StdStringToUpbString(error_string_storage);
-    google_rpc_Status_set_message(error_detail, error_description);
+            request, arena.ptr()));
   }
   // Populate node.
   if (!sent_initial_message_) {
@@ -889,6 +996,60 @@ std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
   return SerializeDiscoveryRequest(arena.ptr(), request);
 }
 
+std::string XdsClient::XdsChannel::AdsCall::CreateDeltaAdsRequest(
+    absl::string_view type_url, absl::string_view nonce,
+    const std::vector<std::string>& subscribes,
+    const std::vector<std::string>& unsubscribes,
+    const std::map<std::string, std::string>& initial_resource_versions,
+    absl::Status status) const {
+  upb::Arena arena;
+  // Create a request.
+  envoy_service_discovery_v3_DeltaDiscoveryRequest* request =
+      envoy_service_discovery_v3_DeltaDiscoveryRequest_new(arena.ptr());
+  // Set type_url.
+  std::string type_url_str = absl::StrCat("type.googleapis.com/", type_url);
+  envoy_service_discovery_v3_DeltaDiscoveryRequest_set_type_url(
+      request, StdStringToUpbString(type_url_str));
+  // Set nonce.
+  if (!nonce.empty()) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_set_response_nonce(
+        request, StdStringToUpbString(nonce));
+  }
+  // Set error_detail if it's a NACK.
+  if (!status.ok()) {
+    PopulateErrorDetail(
+        status,
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_mutable_error_detail(
+            request, arena.ptr()));
+  }
+  // Populate node.
+  if (!sent_initial_message_) {
+    envoy_config_core_v3_Node* node_msg =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_mutable_node(
+            request, arena.ptr());
+    PopulateXdsNode(xds_client()->bootstrap_->node(),
+                    xds_client()->user_agent_name_,
+                    xds_client()->user_agent_version_, node_msg, arena.ptr());
+  }
+  // Add subscription changes.
+  for (const std::string& resource_name : subscribes) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_subscribe(
+        request, StdStringToUpbString(resource_name), arena.ptr());
+  }
+  for (const std::string& resource_name : unsubscribes) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_unsubscribe(
+        request, StdStringToUpbString(resource_name), arena.ptr());
+  }
+  for (const auto& [resource_name, version] : initial_resource_versions) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_initial_resource_versions_set(
+        request, StdStringToUpbString(resource_name),
+        StdStringToUpbString(version), arena.ptr());
+  }
+  MaybeLogDeltaDiscoveryRequest(xds_client(), xds_client()->def_pool_.ptr(),
+                                request);
+  return SerializeDeltaDiscoveryRequest(arena.ptr(), request);
+}
+
 void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
     const XdsResourceType* type)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_) {
@@ -900,16 +1061,36 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
   xds_client()->MaybeRemoveUnsubscribedCacheEntriesForTypeLocked(xds_channel(),
                                                                  type);
   auto& state = state_map_[type];
-  std::string serialized_message = CreateAdsRequest(
-      type->type_url(), xds_channel()->resource_type_version_map_[type],
-      state.nonce, ResourceNamesForRequest(type), state.status);
+  std::string serialized_message;
+  if (use_delta_protocol_) {
+    std::vector<std::string> subscribes;
+    std::vector<std::string> unsubscribes;
+    std::map<std::string, std::string> initial_resource_versions;
+    DeltaChangesForRequest(type, &subscribes, &unsubscribes,
+                           &initial_resource_versions);
+    serialized_message = CreateDeltaAdsRequest(
+        type->type_url(), state.nonce, subscribes, unsubscribes,
+        initial_resource_versions, state.status);
+    GRPC_TRACE_LOG(xds_client, INFO)
+        << "[xds_client " << xds_client() << "] xds server "
+        << xds_channel()->server_.server_uri()
+        << ": sending delta ADS request: type=" << type->type_url()
+        << " subscribe=" << subscribes.size()
+        << " unsubscribe=" << unsubscribes.size()
+        << " initial_versions=" << initial_resource_versions.size()
+        << " nonce=" << state.nonce << " error=" << state.status;
+  } else {
+    serialized_message = CreateAdsRequest(
+        type->type_url(), xds_channel()->resource_type_version_map_[type],
+        state.nonce, ResourceNamesForRequest(type), state.status);
+    GRPC_TRACE_LOG(xds_client, INFO)
+        << "[xds_client " << xds_client() << "] xds server "
+        << xds_channel()->server_.server_uri()
+        << ": sending ADS request: type=" << type->type_url()
+        << " version=" << xds_channel()->resource_type_version_map_[type]
+        << " nonce=" << state.nonce << " error=" << state.status;
+  }
   sent_initial_message_ = true;
-  GRPC_TRACE_LOG(xds_client, INFO)
-      << "[xds_client " << xds_client() << "] xds server "
-      << xds_channel()->server_.server_uri()
-      << ": sending ADS request: type=" << type->type_url()
-      << " version=" << xds_channel()->resource_type_version_map_[type]
-      << " nonce=" << state.nonce << " error=" << state.status;
   state.status = absl::OkStatus();
   streaming_call_->SendMessage(std::move(serialized_message));
   send_message_pending_ = type;
@@ -948,9 +1129,77 @@ void XdsClient::XdsChannel::AdsCall::OnRequestSent(bool ok) {
   }
 }
 
+void XdsClient::XdsChannel::AdsCall::MarkResourceSeenLocked(
+    const XdsResourceType* type, const XdsResourceName& name) {
+  auto it = state_map_.find(type);
+  if (it == state_map_.end()) return;
+  auto& subscribed_resources = it->second.subscribed_resources;
+  auto authority_it = subscribed_resources.find(name.authority);
+  if (authority_it == subscribed_resources.end()) return;
+  auto res_it = authority_it->second.find(name.key);
+  if (res_it != authority_it->second.end()) res_it->second->MarkSeen();
+}
+
+XdsClient::ResourceState*
+XdsClient::XdsChannel::AdsCall::FindResourceStateLocked(
+    const XdsResourceType* type, const XdsResourceName& name) {
+  // Lookup the authority in the cache.
+  auto authority_it = xds_client()->authority_state_map_.find(name.authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return nullptr;
+  AuthorityState& authority_state = authority_it->second;
+  // Found authority, so look up type.
+  auto type_it = authority_state.type_map.find(type);
+  if (type_it == authority_state.type_map.end()) return nullptr;
+  auto& type_map = type_it->second;
+  // Found type, so look up resource key.
+  auto res_it = type_map.find(name.key);
+  if (res_it == type_map.end()) return nullptr;
+  return &res_it->second;
+}
+
+bool XdsClient::XdsChannel::AdsCall::MaybeReuseCachedResourceLocked(
+    absl::string_view resource_name, absl::string_view serialized_resource,
+    const std::string& version, DecodeContext* context) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, context->type);
+  if (!parsed_resource_name.ok()) return false;
+  ResourceState* resource_state =
+      FindResourceStateLocked(context->type, *parsed_resource_name);
+  if (resource_state == nullptr ||
+      !resource_state->CachedResourceMatches(serialized_resource,
+                                             xds_channel()->server_)) {
+    return false;
+  }
+  MarkResourceSeenLocked(context->type, *parsed_resource_name);
+  if (context->type->AllResourcesRequiredInSotW()) {
+    context->resources_seen[parsed_resource_name->authority].insert(
+        parsed_resource_name->key);
+  }
+  ++context->num_valid_resources;
+  resource_state->SetAckedUnchanged(version, context->update_time);
+  OnResourceUnchangedLocked(resource_name, *resource_state, context);
+  return true;
+}
+
+void XdsClient::XdsChannel::AdsCall::OnResourceUnchangedLocked(
+    absl::string_view resource_name, const ResourceState& resource_state,
+    DecodeContext* context) {
+  GRPC_TRACE_LOG(xds_client, INFO)
+      << "[xds_client " << xds_client() << "] " << context->type_url
+      << " resource " << resource_name << " identical to current, ignoring.";
+  // If we previously had connectivity problems, notify watchers that
+  // the ambient error has been cleared.
+  if (!xds_channel()->status().ok()) {
+    xds_client()->NotifyWatchersOnAmbientError(absl::OkStatus(),
+                                               resource_state.watchers(),
+                                               context->read_delay_handle);
+  }
+}
+
 void XdsClient::XdsChannel::AdsCall::ParseResource(
     size_t idx, absl::string_view type_url, absl::string_view resource_name,
-    absl::string_view serialized_resource, DecodeContext* context) {
+    absl::string_view serialized_resource, const std::string& version,
+    DecodeContext* context) {
   std::string error_prefix = absl::StrCat(
       "resource index ", idx, ": ",
       resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
@@ -962,6 +1211,16 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     ++context->num_invalid_resources;
     return;
   }
+  // If the Resource wrapper gave us the name, check whether the resource
+  // is identical to the one we have cached, and if so skip decoding and
+  // comparing it.  Delta responses always wrap their resources; SotW
+  // responses only do if the server chooses to, and unwrapped resources
+  // have to be decoded to learn their name.
+  if (!resource_name.empty() &&
+      MaybeReuseCachedResourceLocked(resource_name, serialized_resource,
+                                     version, context)) {
+    return;
+  }
   // Parse the resource.
   XdsResourceType::DecodeContext resource_type_context = {
       xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
@@ -1000,37 +1259,13 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     return;
   }
   // Cancel resource-does-not-exist timer, if needed.
-  if (auto it = state_map_.find(context->type); it != state_map_.end()) {
-    auto& resource_type_state = it->second;
-    auto authority_it = resource_type_state.subscribed_resources.find(
-        parsed_resource_name->authority);
-    if (authority_it != resource_type_state.subscribed_resources.end()) {
-      auto& resource_map = authority_it->second;
-      auto res_it = resource_map.find(parsed_resource_name->key);
-      if (res_it != resource_map.end()) {
-        res_it->second->MarkSeen();
-      }
-    }
-  }
-  // Lookup the authority in the cache.
-  auto authority_it =
-      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
-  if (authority_it == xds_client()->authority_state_map_.end()) {
+  MarkResourceSeenLocked(context->type, *parsed_resource_name);
+  ResourceState* resource_state_ptr =
+      FindResourceStateLocked(context->type, *parsed_resource_name);
+  if (resource_state_ptr == nullptr) {
     return;  // Skip resource -- we don't have a subscription for it.
   }
-  AuthorityState& authority_state = authority_it->second;
-  // Found authority, so look up type.
-  auto type_it = authority_state.type_map.find(context->type);
-  if (type_it == authority_state.type_map.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
-  auto& type_map = type_it->second;
-  // Found type, so look up resource key.
-  auto res_it = type_map.find(parsed_resource_name->key);
-  if (res_it == type_map.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
-  ResourceState& resource_state = res_it->second;
+  ResourceState& resource_state = *resource_state_ptr;
   // If needed, record that we've seen this resource.
   if (context->type->AllResourcesRequiredInSotW()) {
     context->resources_seen[parsed_resource_name->authority].insert(
@@ -1043,7 +1278,7 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     // existing cached resource, if any.
     const bool drop_cached_resource = XdsDataErrorHandlingEnabled() &&
                                       xds_channel()->server_.FailOnDataErrors();
-    resource_state.SetNacked(context->version, decode_status.message(),
+    resource_state.SetNacked(version, decode_status.message(),
                              context->update_time, drop_cached_resource);
     xds_client()->NotifyWatchersOnError(resource_state,
                                         context->read_delay_handle);
@@ -1062,20 +1297,11 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
   if (resource_identical) decode_result.resource = resource_state.resource();
   // Update the resource state.
   resource_state.SetAcked(std::move(*decode_result.resource),
-                          std::string(serialized_resource), context->version,
-                          context->update_time);
+                          std::string(serialized_resource), version,
+                          context->update_time, xds_channel()->server_);
   // If the resource didn't change, inhibit watcher notifications.
   if (resource_identical) {
-    GRPC_TRACE_LOG(xds_client, INFO)
-        << "[xds_client " << xds_client() << "] " << context->type_url
-        << " resource " << resource_name << " identical to current, ignoring.";
-    // If we previously had connectivity problems, notify watchers that
-    // the ambient error has been cleared.
-    if (!xds_channel()->status().ok()) {
-      xds_client()->NotifyWatchersOnAmbientError(absl::OkStatus(),
-                                                 resource_state.watchers(),
-                                                 context->read_delay_handle);
-    }
+    OnResourceUnchangedLocked(resource_name, resource_state, context);
     return;
   }
   // Notify watchers.
@@ -1112,17 +1338,7 @@ void XdsClient::XdsChannel::AdsCall::HandleServerReportedResourceError(
     return;
   }
   // Cancel resource-does-not-exist timer, if needed.
-  auto timer_it = state_map_.find(context->type);
-  if (timer_it != state_map_.end()) {
-    auto it = timer_it->second.subscribed_resources.find(
-        parsed_resource_name->authority);
-    if (it != timer_it->second.subscribed_resources.end()) {
-      auto res_it = it->second.find(parsed_resource_name->key);
-      if (res_it != it->second.end()) {
-        res_it->second->MarkSeen();
-      }
-    }
-  }
+  MarkResourceSeenLocked(context->type, *parsed_resource_name);
   // Lookup the authority in the cache.
   auto authority_it =
       xds_client()->authority_state_map_.find(parsed_resource_name->authority);
@@ -1184,6 +1400,20 @@ void MaybeLogDiscoveryResponse(
   }
 }
 
+void MaybeLogDeltaDiscoveryResponse(
+    const XdsClient* client, upb_DefPool* def_pool,
+    const envoy_service_discovery_v3_DeltaDiscoveryResponse* response) {
+  if (GRPC_TRACE_FLAG_ENABLED(xds_client) && ABSL_VLOG_IS_ON(2)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryResponse_getmsgdef(def_pool);
+    char buf[10240];
+    upb_TextEncode(reinterpret_cast<const upb_Message*>(response), msg_type,
+                   nullptr, 0, buf, sizeof(buf));
+    VLOG(2) << "[xds_client " << client
+            << "] received delta response: " << buf;
+  }
+}
+
 }  // namespace
 
 absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
@@ -1267,9 +1497,16 @@ absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
       resource_name = UpbStringToAbsl(
           envoy_service_discovery_v3_Resource_name(resource_wrapper));
     }
-    ParseResource(i, type_url, resource_name, serialized_resource, context);
+    ParseResource(i, type_url, resource_name, serialized_resource,
+                  context->version, context);
   }
-  // Process each error.
+  HandleServerReportedResourceErrors(errors, num_errors, context);
+  return absl::OkStatus();
+}
+
+void XdsClient::XdsChannel::AdsCall::HandleServerReportedResourceErrors(
+    const envoy_service_discovery_v3_ResourceError* const* errors,
+    size_t num_errors, DecodeContext* context) {
   for (size_t i = 0; i < num_errors; ++i) {
     absl::string_view name;
     {
@@ -1292,6 +1529,149 @@ absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
     }
     HandleServerReportedResourceError(i, name, std::move(status), context);
   }
+}
+
+void XdsClient::XdsChannel::AdsCall::HandleResourceRemoval(
+    size_t idx, absl::string_view resource_name, DecodeContext* context) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, context->type);
+  if (!parsed_resource_name.ok()) {
+    context->errors.emplace_back(
+        absl::StrCat("removed_resources index ", idx, ": ", resource_name,
+                     ": Cannot parse xDS resource name"));
+    return;
+  }
+  // The server has told us that the resource does not exist, so there
+  // is no need to wait for the timer to fire.
+  MarkResourceSeenLocked(context->type, *parsed_resource_name);
+  // Lookup the authority in the cache.
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  AuthorityState& authority_state = authority_it->second;
+  // Skip authorities that are not using this xDS channel.
+  if (authority_state.xds_channels.back() != xds_channel()) return;
+  // Found authority, so look up type.
+  auto type_it = authority_state.type_map.find(context->type);
+  if (type_it == authority_state.type_map.end()) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  auto& type_map = type_it->second;
+  // Found type, so look up resource key.
+  auto it = type_map.find(parsed_resource_name->key);
+  if (it == type_map.end()) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  ResourceState& resource_state = it->second;
+  // Unlike SotW, where only deletions of LDS and CDS resources can be
+  // detected, the delta protocol reports deletions for every resource
+  // type.  We handle them all the same way.
+  const bool drop_cached_resource =
+      XdsDataErrorHandlingEnabled()
+          ? xds_channel()->server_.FailOnDataErrors()
+          : !xds_channel()->server_.IgnoreResourceDeletion();
+  resource_state.SetDoesNotExistOnLdsOrCdsDeletion(
+      context->version, context->update_time, drop_cached_resource);
+  xds_client()->NotifyWatchersOnError(resource_state,
+                                      context->read_delay_handle);
+}
+
+absl::Status XdsClient::XdsChannel::AdsCall::DecodeDeltaAdsResponse(
+    absl::string_view encoded_response, DecodeContext* context) {
+  // Decode the response.
+  const envoy_service_discovery_v3_DeltaDiscoveryResponse* response =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_parse(
+          encoded_response.data(), encoded_response.size(),
+          context->arena.ptr());
+  // If decoding fails, report a fatal error and return.
+  if (response == nullptr) {
+    return absl::InvalidArgumentError("Can't decode DeltaDiscoveryResponse.");
+  }
+  MaybeLogDeltaDiscoveryResponse(xds_client(), xds_client()->def_pool_.ptr(),
+                                 response);
+  // Get the type_url, version, nonce, number of resources, number of
+  // removed resources, and number of errors.
+  context->type_url = std::string(absl::StripPrefix(
+      UpbStringToAbsl(
+          envoy_service_discovery_v3_DeltaDiscoveryResponse_type_url(
+              response)),
+      "type.googleapis.com/"));
+  context->version = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_system_version_info(
+          response));
+  context->nonce = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_nonce(response));
+  size_t num_resources;
+  const envoy_service_discovery_v3_Resource* const* resources =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_resources(
+          response, &num_resources);
+  size_t num_removed;
+  const upb_StringView* removed =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_removed_resources(
+          response, &num_removed);
+  size_t num_removed_names;
+  const envoy_service_discovery_v3_ResourceName* const* removed_names =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_removed_resource_names(
+          response, &num_removed_names);
+  size_t num_errors = 0;
+  const envoy_service_discovery_v3_ResourceError* const* errors = nullptr;
+  if (XdsDataErrorHandlingEnabled()) {
+    errors = envoy_service_discovery_v3_DeltaDiscoveryResponse_resource_errors(
+        response, &num_errors);
+  }
+  GRPC_TRACE_LOG(xds_client, INFO)
+      << "[xds_client " << xds_client() << "] xds server "
+      << xds_channel()->server_.server_uri()
+      << ": received delta ADS response: type_url=" << context->type_url
+      << ", system_version=" << context->version
+      << ", nonce=" << context->nonce << ", num_resources=" << num_resources
+      << ", num_removed=" << num_removed + num_removed_names
+      << ", num_errors=" << num_errors;
+  context->type = xds_client()->GetResourceTypeLocked(context->type_url);
+  if (context->type == nullptr) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("unknown resource type ", context->type_url));
+  }
+  context->read_delay_handle = MakeRefCounted<AdsReadDelayHandle>(Ref());
+  // Process each resource.  In the delta protocol, every resource is
+  // wrapped in a Resource message that carries its name and version.
+  for (size_t i = 0; i < num_resources; ++i) {
+    absl::string_view resource_name =
+        UpbStringToAbsl(envoy_service_discovery_v3_Resource_name(resources[i]));
+    const auto* resource =
+        envoy_service_discovery_v3_Resource_resource(resources[i]);
+    if (resource == nullptr) {
+      context->errors.emplace_back(absl::StrCat(
+          "resource index ", i, ": ",
+          resource_name.empty() ? "" : absl::StrCat(resource_name, ": "),
+          "No resource present in Resource proto"));
+      ++context->num_invalid_resources;
+      continue;
+    }
+    absl::string_view type_url = absl::StripPrefix(
+        UpbStringToAbsl(google_protobuf_Any_type_url(resource)),
+        "type.googleapis.com/");
+    absl::string_view serialized_resource =
+        UpbStringToAbsl(google_protobuf_Any_value(resource));
+    std::string version = UpbStringToStdString(
+        envoy_service_discovery_v3_Resource_version(resources[i]));
+    ParseResource(i, type_url, resource_name, serialized_resource, version,
+                  context);
+  }
+  // Process each removed resource.
+  for (size_t i = 0; i < num_removed; ++i) {
+    HandleResourceRemoval(i, UpbStringToAbsl(removed[i]), context);
+  }
+  for (size_t i = 0; i < num_removed_names; ++i) {
+    HandleResourceRemoval(
+        num_removed + i,
+        UpbStringToAbsl(
+            envoy_service_discovery_v3_ResourceName_name(removed_names[i])),
+        context);
+  }
+  HandleServerReportedResourceErrors(errors, num_errors, context);
   return absl::OkStatus();
 }
 
@@ -1302,7 +1682,9 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
   MutexLock lock(&xds_client()->mu_);
   if (!IsCurrentCallOnChannel()) return;
   // Parse and validate the response.
-  absl::Status status = DecodeAdsResponse(payload, &context);
+  absl::Status status = use_delta_protocol_
+                            ? DecodeDeltaAdsResponse(payload, &context)
+                            : DecodeAdsResponse(payload, &context);
   if (!status.ok()) {
     // Ignore unparsable response.
     LOG(ERROR) << "[xds_client " << xds_client() << "] xds server "
@@ -1326,8 +1708,10 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
                  << ", will NACK: nonce=" << state.nonce
                  << " status=" << state.status;
     }
-    // Delete resources not seen in update if needed.
-    if (context.type->AllResourcesRequiredInSotW()) {
+    // Delete resources not seen in update if needed.  This does not
+    // apply to the delta protocol, where the server reports deletions
+    // explicitly.
+    if (!use_delta_protocol_ && context.type->AllResourcesRequiredInSotW()) {
       for (auto& [authority, authority_state] :
            xds_client()->authority_state_map_) {
         // Skip authorities that are not using this xDS channel.
@@ -1435,16 +1819,72 @@ XdsClient::XdsChannel::AdsCall::ResourceNamesForRequest(
   return resource_names;
 }
 
+void XdsClient::XdsChannel::AdsCall::DeltaChangesForRequest(
+    const XdsResourceType* type, std::vector<std::string>* subscribes,
+    std::vector<std::string>* unsubscribes,
+    std::map<std::string, std::string>* initial_resource_versions) {
+  auto& state = state_map_[type];
+  for (const auto& [authority, resource_keys] : state.subscribes_to_send) {
+    auto subscribed_it = state.subscribed_resources.find(authority);
+    // On the first request for this type on the stream, tell the server
+    // which versions we already have cached, so that it does not need to
+    // send them again.
+    const std::map<XdsResourceKey, ResourceState>* cached_resources = nullptr;
+    if (!state.sent_delta_request) {
+      auto authority_it = xds_client()->authority_state_map_.find(authority);
+      if (authority_it != xds_client()->authority_state_map_.end()) {
+        auto type_it = authority_it->second.type_map.find(type);
+        if (type_it != authority_it->second.type_map.end()) {
+          cached_resources = &type_it->second;
+        }
+      }
+    }
+    for (const XdsResourceKey& resource_key : resource_keys) {
+      std::string resource_name = XdsClient::ConstructFullXdsResourceName(
+          authority, type->type_url(), resource_key);
+      if (subscribed_it != state.subscribed_resources.end()) {
+        auto timer_it = subscribed_it->second.find(resource_key);
+        if (timer_it != subscribed_it->second.end()) {
+          timer_it->second->MarkSubscriptionSendStarted();
+        }
+      }
+      if (cached_resources != nullptr) {
+        auto it = cached_resources->find(resource_key);
+        if (it != cached_resources->end() && it->second.HasResource()) {
+          (*initial_resource_versions)[resource_name] = it->second.version();
+        }
+      }
+      subscribes->push_back(std::move(resource_name));
+    }
+  }
+  state.subscribes_to_send.clear();
+  for (const auto& [authority, resource_keys] : state.unsubscribes_to_send) {
+    for (const XdsResourceKey& resource_key : resource_keys) {
+      unsubscribes->push_back(XdsClient::ConstructFullXdsResourceName(
+          authority, type->type_url(), resource_key));
+    }
+  }
+  state.unsubscribes_to_send.clear();
+  state.sent_delta_request = true;
+}
+
 //
 // XdsClient::ResourceState
 //
 
 void XdsClient::ResourceState::SetAcked(
     std::shared_ptr<const XdsResourceType::ResourceData> resource,
-    std::string serialized_proto, std::string version, Timestamp update_time) {
+    std::string serialized_proto, std::string version, Timestamp update_time,
+    const XdsBootstrap::XdsServer& server) {
   resource_ = std::move(resource);
-  client_status_ = ClientResourceStatus::ACKED;
   serialized_proto_ = std::move(serialized_proto);
+  server_ = &server;
+  SetAckedUnchanged(std::move(version), update_time);
+}
+
+void XdsClient::ResourceState::SetAckedUnchanged(std::string version,
+                                                 Timestamp update_time) {
+  client_status_ = ClientResourceStatus::ACKED;
   update_time_ = update_time;
   version_ = std::move(version);
   failed_version_.clear();
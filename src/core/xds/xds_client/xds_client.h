@@ -308,7 +308,10 @@ class XdsClient : public DualRefCounted<XdsClient> {
 
     void SetAcked(std::shared_ptr<const XdsResourceType::ResourceData> resource,
                   std::string serialized_proto, std::string version,
-                  Timestamp update_time);
+                  Timestamp update_time, const XdsBootstrap::XdsServer& server);
+    // Like SetAcked(), for an update whose serialized bytes are identical
+    // to the cached resource.
+    void SetAckedUnchanged(std::string version, Timestamp update_time);
     void SetNacked(const std::string& version, absl::string_view details,
                    Timestamp update_time, bool drop_cached_resource);
     void SetReceivedError(const std::string& version, absl::Status status,
@@ -323,6 +326,15 @@ class XdsClient : public DualRefCounted<XdsClient> {
     absl::string_view CacheStateString() const;
 
     bool HasResource() const { return resource_ != nullptr; }
+    const std::string& version() const { return version_; }
+    // Returns true if serialized_proto is identical to the cached resource,
+    // which was decoded with the same server.  Decoding it again would
+    // produce the same result.
+    bool CachedResourceMatches(absl::string_view serialized_proto,
+                               const XdsBootstrap::XdsServer& server) const {
+      return HasResource() && server_ == &server &&
+             serialized_proto_ == serialized_proto;
+    }
     std::shared_ptr<const XdsResourceType::ResourceData> resource() const {
       return resource_;
     }
@@ -341,6 +353,9 @@ class XdsClient : public DualRefCounted<XdsClient> {
     ClientResourceStatus client_status_ = REQUESTED;
     // The serialized bytes of the last successfully updated raw xDS resource.
     std::string serialized_proto_;
+    // The server whose decode context was used for resource_.  Decoding
+    // depends on it, e.g. for trusted_xds_server.
+    const XdsBootstrap::XdsServer* server_ = nullptr;
     // The timestamp when the resource was last successfully updated.
     Timestamp update_time_;
     // The last successfully updated version of the resource.
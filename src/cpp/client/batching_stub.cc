@@ -0,0 +1,278 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/generic/batching_stub.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/status.h>
+#include <grpcpp/support/stub_options.h>
+#include <stdint.h>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/cpp/common/batch_framing.h"
+
+namespace grpc {
+namespace experimental {
+
+struct BatchingStub::Call {
+  const ByteBuffer* request;
+  ByteBuffer* response;
+  std::function<void(Status)> on_completion;
+};
+
+// One batch stream. It takes calls until its reads end or it has taken
+// max_stream_calls of them, and then stays alive until the server finishes
+// it.
+class BatchingStub::Stream final
+    : public ClientBidiReactor<ByteBuffer, ByteBuffer> {
+ public:
+  Stream(BatchingStub* stub, std::string method)
+      : stub_(stub), method_(std::move(method)) {
+    stub_->generic_stub_.PrepareBidiStreamingCall(
+        &context_, method_ + internal::kBatchMethodSuffix, StubOptions(),
+        this);
+    StartRead(&read_buffer_);
+    // Released when the reads end, so that the stream cannot be done while
+    // Enqueue may still start a write.
+    AddHold();
+  }
+
+  const std::string& method() const { return method_; }
+
+  // Moves *call onto the stream, unless the stream takes no more calls.
+  bool Enqueue(Call* call) {
+    internal::MutexLock lock(&mu_);
+    if (closed_ || closing_ ||
+        calls_taken_ == stub_->options_.max_stream_calls) {
+      return false;
+    }
+    ++calls_taken_;
+    queued_.push_back(std::move(*call));
+    MaybeWriteLocked();
+    return true;
+  }
+
+  // Half-closes the stream once the queued calls have been sent.
+  void Close() {
+    internal::MutexLock lock(&mu_);
+    closing_ = true;
+    MaybeWriteLocked();
+  }
+
+  bool answered() {
+    internal::MutexLock lock(&mu_);
+    return answered_;
+  }
+
+  // Takes the calls that got no result. Only called once the stream is done.
+  std::vector<Call> TakeUnansweredCalls() {
+    internal::MutexLock lock(&mu_);
+    std::vector<Call> calls;
+    calls.reserve(queued_.size() + sent_.size());
+    for (auto& entry : sent_) calls.push_back(std::move(entry.second));
+    for (Call& call : queued_) calls.push_back(std::move(call));
+    sent_.clear();
+    queued_.clear();
+    return calls;
+  }
+
+  void OnWriteDone(bool /*ok*/) override {
+    internal::MutexLock lock(&mu_);
+    writing_ = false;
+    MaybeWriteLocked();
+  }
+
+  void OnReadDone(bool ok) override {
+    if (ok) {
+      if (DeliverResults()) {
+        StartRead(&read_buffer_);
+        return;
+      }
+      context_.TryCancel();
+    }
+    {
+      internal::MutexLock lock(&mu_);
+      closed_ = true;
+    }
+    RemoveHold();
+  }
+
+  void OnDone(const Status& status) override {
+    stub_->StreamDone(this, status);
+    delete this;
+  }
+
+ private:
+  void MaybeWriteLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (writing_ || closed_) return;
+    if (queued_.empty()) {
+      if (closing_ && !writes_done_) {
+        writes_done_ = true;
+        StartWritesDone();
+      }
+      return;
+    }
+    const BatchingStubOptions& options = stub_->options_;
+    internal::BatchWriter writer;
+    while (!queued_.empty() && writer.num_entries() < options.max_batch_calls &&
+           (writer.num_entries() == 0 ||
+            writer.size() + queued_.front().request->Length() <=
+                options.max_batch_bytes)) {
+      const uint64_t id = next_id_++;
+      writer.AddCall(id, *queued_.front().request);
+      sent_.emplace(id, std::move(queued_.front()));
+      queued_.pop_front();
+    }
+    write_buffer_ = writer.Finish();
+    writing_ = true;
+    StartWrite(&write_buffer_);
+  }
+
+  // Completes the calls whose results are in read_buffer_. Returns false if
+  // the message is malformed.
+  bool DeliverResults() {
+    internal::BatchReader reader(read_buffer_);
+    std::vector<std::pair<Call, Status>> completed;
+    bool ok = true;
+    {
+      internal::MutexLock lock(&mu_);
+      while (!reader.Done()) {
+        uint64_t id;
+        Status status;
+        ByteBuffer response;
+        auto it = sent_.end();
+        if (!reader.ReadResult(&id, &status, &response) ||
+            (it = sent_.find(id)) == sent_.end()) {
+          ok = false;
+          break;
+        }
+        it->second.response->Swap(&response);
+        completed.emplace_back(std::move(it->second), std::move(status));
+        sent_.erase(it);
+      }
+      answered_ = answered_ || !completed.empty();
+    }
+    for (auto& call : completed) call.first.on_completion(call.second);
+    return ok;
+  }
+
+  BatchingStub* const stub_;
+  const std::string method_;
+  ClientContext context_;
+  ByteBuffer read_buffer_;
+  ByteBuffer write_buffer_;
+  internal::Mutex mu_;
+  // Calls not sent yet, and calls sent and waiting for their results.
+  std::deque<Call> queued_ ABSL_GUARDED_BY(mu_);
+  std::map<uint64_t, Call> sent_ ABSL_GUARDED_BY(mu_);
+  uint64_t next_id_ ABSL_GUARDED_BY(mu_) = 0;
+  size_t calls_taken_ ABSL_GUARDED_BY(mu_) = 0;
+  bool writing_ ABSL_GUARDED_BY(mu_) = false;
+  bool writes_done_ ABSL_GUARDED_BY(mu_) = false;
+  // Set by Close.
+  bool closing_ ABSL_GUARDED_BY(mu_) = false;
+  // Set when the reads end.
+  bool closed_ ABSL_GUARDED_BY(mu_) = false;
+  bool answered_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+BatchingStub::BatchingStub(std::shared_ptr<ChannelInterface> channel,
+                           BatchingStubOptions options)
+    : generic_stub_(std::move(channel)), options_(options) {}
+
+BatchingStub::~BatchingStub() {
+  internal::MutexLock lock(&mu_);
+  for (auto& entry : streams_) entry.second->Close();
+  while (live_streams_ != 0) cv_.Wait(&mu_);
+}
+
+void BatchingStub::UnaryCall(const std::string& method,
+                             const ByteBuffer* request, ByteBuffer* response,
+                             std::function<void(Status)> on_completion) {
+  Call call{request, response, std::move(on_completion)};
+  {
+    internal::MutexLock lock(&mu_);
+    if (unbatched_methods_.count(method) == 0) {
+      Stream*& stream = streams_[method];
+      if (stream != nullptr) {
+        if (stream->Enqueue(&call)) return;
+        // The stream's reads have ended, or it has taken its share of calls
+        // and is half-closed once the calls queued on it are sent.
+        stream->Close();
+      }
+      // Start another stream. The call is queued before the stream starts, so
+      // it cannot be refused.
+      stream = new Stream(this, method);
+      ++live_streams_;
+      stream->Enqueue(&call);
+      stream->StartCall();
+      return;
+    }
+  }
+  SendUnbatched(method, std::move(call));
+}
+
+void BatchingStub::SendUnbatched(const std::string& method, Call call) {
+  auto* context = new ClientContext;
+  generic_stub_.UnaryCall(
+      context, method, StubOptions(), call.request, call.response,
+      [context,
+       on_completion = std::move(call.on_completion)](Status status) {
+        delete context;
+        on_completion(std::move(status));
+      });
+}
+
+void BatchingStub::StreamDone(Stream* stream, const Status& status) {
+  // A server without BatchingGenericService rejects the stream before
+  // answering any call on it.
+  const bool unbatched = status.error_code() == StatusCode::UNIMPLEMENTED &&
+                         !stream->answered();
+  {
+    internal::MutexLock lock(&mu_);
+    auto it = streams_.find(stream->method());
+    if (it != streams_.end() && it->second == stream) streams_.erase(it);
+    if (unbatched) unbatched_methods_.insert(stream->method());
+  }
+  const Status error =
+      status.ok() ? Status(StatusCode::UNAVAILABLE,
+                           "batch stream ended before the call completed")
+                  : status;
+  for (Call& call : stream->TakeUnansweredCalls()) {
+    if (unbatched) {
+      SendUnbatched(stream->method(), std::move(call));
+    } else {
+      call.on_completion(error);
+    }
+  }
+  internal::MutexLock lock(&mu_);
+  --live_streams_;
+  cv_.SignalAll();
+}
+
+}  // namespace experimental
+}  // namespace grpc
@@ -150,7 +150,9 @@ grpc::internal::Call Channel::CreateCallInternal(
       interceptor_creators_, interceptor_pos);
   context->set_call(c_call, shared_from_this());
 
-  return grpc::internal::Call(c_call, this, cq, info);
+  grpc::internal::Call call(c_call, this, cq, info);
+  call.set_pass_message_objects(pass_message_objects_);
+  return call;
 }
 
 grpc::internal::Call Channel::CreateCall(
@@ -80,6 +80,34 @@ ClientContext::~ClientContext() {
   g_client_callbacks->Destructor(this);
 }
 
+void ClientContext::Reset() {
+  g_client_callbacks->Destructor(this);
+  if (call_) {
+    grpc_call_unref(call_);
+    call_ = nullptr;
+  }
+  initial_metadata_received_ = false;
+  wait_for_ready_ = false;
+  wait_for_ready_explicitly_set_ = false;
+  channel_.reset();
+  call_canceled_ = false;
+  deadline_ = gpr_inf_future(GPR_CLOCK_REALTIME);
+  authority_.clear();
+  creds_.reset();
+  auth_context_.reset();
+  census_context_ = nullptr;
+  send_initial_metadata_.clear();
+  recv_initial_metadata_.Reset();
+  trailing_metadata_.Reset();
+  propagate_from_call_ = nullptr;
+  propagation_options_ = PropagationOptions();
+  compression_algorithm_ = GRPC_COMPRESS_NONE;
+  initial_metadata_corked_ = false;
+  debug_error_string_.clear();
+  rpc_info_.Reset();
+  g_client_callbacks->DefaultConstructor(this);
+}
+
 void ClientContext::set_credentials(
     const std::shared_ptr<CallCredentials>& creds) {
   creds_ = creds;
@@ -101,6 +129,27 @@ std::unique_ptr<ClientContext> ClientContext::FromInternalServerContext(
   std::unique_ptr<ClientContext> ctx(new ClientContext);
   ctx->propagate_from_call_ = context.call_.call;
   ctx->propagation_options_ = options;
+  // The core takes the earlier of the server call's deadline and ours, so
+  // the budget only needs to be applied here.
+  const gpr_timespec deadline = context.raw_deadline();
+  if ((options.c_bitmask() & GRPC_PROPAGATE_DEADLINE) != 0 &&
+      gpr_time_cmp(deadline, gpr_inf_future(deadline.clock_type)) != 0 &&
+      (options.deadline_reserve().count() > 0 ||
+       options.min_deadline_budget().count() > 0)) {
+    const gpr_timespec now = gpr_now(deadline.clock_type);
+    gpr_timespec budget_deadline = gpr_time_sub(
+        deadline, gpr_time_from_micros(options.deadline_reserve().count(),
+                                       GPR_TIMESPAN));
+    const gpr_timespec min_budget_deadline = gpr_time_add(
+        now, gpr_time_from_micros(options.min_deadline_budget().count(),
+                                  GPR_TIMESPAN));
+    // With too little time left, the call would only add load downstream
+    // before failing.  Give it a deadline that has already passed instead.
+    if (gpr_time_cmp(budget_deadline, min_budget_deadline) < 0) {
+      budget_deadline = now;
+    }
+    ctx->deadline_ = budget_deadline;
+  }
   return ctx;
 }
 
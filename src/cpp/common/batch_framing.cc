@@ -0,0 +1,131 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/cpp/common/batch_framing.h"
+
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+#include <grpcpp/support/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace grpc {
+namespace internal {
+
+void BatchWriter::AddCall(uint64_t id, const ByteBuffer& request) {
+  AppendVarint(id);
+  AppendPayload(request);
+  ++num_entries_;
+}
+
+void BatchWriter::AddResult(uint64_t id, const Status& status,
+                            const ByteBuffer& response) {
+  AppendVarint(id);
+  AppendVarint(static_cast<uint64_t>(status.error_code()));
+  AppendVarint(status.error_message().size());
+  header_.append(status.error_message());
+  AppendPayload(response);
+  ++num_entries_;
+}
+
+ByteBuffer BatchWriter::Finish() {
+  FlushHeader();
+  ByteBuffer message(slices_.data(), slices_.size());
+  slices_.clear();
+  num_entries_ = 0;
+  size_ = 0;
+  return message;
+}
+
+void BatchWriter::AppendVarint(uint64_t value) {
+  while (value >= 0x80) {
+    header_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  header_.push_back(static_cast<char>(value));
+}
+
+void BatchWriter::AppendPayload(const ByteBuffer& payload) {
+  std::vector<Slice> slices;
+  if (payload.Valid()) payload.Dump(&slices);
+  AppendVarint(payload.Length());
+  FlushHeader();
+  size_ += payload.Length();
+  for (Slice& slice : slices) slices_.push_back(std::move(slice));
+}
+
+void BatchWriter::FlushHeader() {
+  if (header_.empty()) return;
+  size_ += header_.size();
+  slices_.emplace_back(header_);
+  header_.clear();
+}
+
+BatchReader::BatchReader(const ByteBuffer& message) {
+  if (message.Valid()) message.DumpToSingleSlice(&message_);
+}
+
+bool BatchReader::ReadCall(uint64_t* id, ByteBuffer* request) {
+  Slice bytes;
+  if (!ReadVarint(id) || !ReadBytes(&bytes)) return false;
+  *request = ByteBuffer(&bytes, 1);
+  return true;
+}
+
+bool BatchReader::ReadResult(uint64_t* id, Status* status,
+                             ByteBuffer* response) {
+  uint64_t code;
+  Slice message;
+  Slice bytes;
+  if (!ReadVarint(id) || !ReadVarint(&code) ||
+      code > static_cast<uint64_t>(StatusCode::UNAUTHENTICATED) ||
+      !ReadBytes(&message) || !ReadBytes(&bytes)) {
+    return false;
+  }
+  *status = Status(static_cast<StatusCode>(code),
+                   std::string(reinterpret_cast<const char*>(message.begin()),
+                               message.size()));
+  *response = ByteBuffer(&bytes, 1);
+  return true;
+}
+
+bool BatchReader::ReadVarint(uint64_t* value) {
+  *value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (pos_ == message_.size()) return false;
+    const uint8_t byte = message_.begin()[pos_++];
+    *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+bool BatchReader::ReadBytes(Slice* bytes) {
+  uint64_t length;
+  if (!ReadVarint(&length) || length > message_.size() - pos_) return false;
+  *bytes = message_.sub(pos_, pos_ + length);
+  pos_ += length;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace grpc
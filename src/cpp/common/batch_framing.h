@@ -0,0 +1,95 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CPP_COMMON_BATCH_FRAMING_H
+#define GRPC_SRC_CPP_COMMON_BATCH_FRAMING_H
+
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+#include <grpcpp/support/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// The framing of the batch streams of BatchingStub and
+// BatchingGenericService.
+//
+// The batch stream for a method is a bidi stream to the method's path with
+// kBatchMethodSuffix appended. Each message the client sends is a sequence
+// of calls, each a varint call id followed by the length-prefixed request.
+// Each message the server sends is a sequence of results, each a varint
+// call id, a varint status code, the length-prefixed status message and the
+// length-prefixed response. Lengths are varints too. Results may come in
+// any order and in any message.
+
+namespace grpc {
+namespace internal {
+
+// Method paths have two segments, so this never names a registered method.
+inline constexpr char kBatchMethodSuffix[] = "/batch";
+
+// Builds a message of a batch stream. The payloads are not copied.
+class BatchWriter {
+ public:
+  void AddCall(uint64_t id, const ByteBuffer& request);
+  void AddResult(uint64_t id, const Status& status, const ByteBuffer& response);
+
+  size_t num_entries() const { return num_entries_; }
+  size_t size() const { return size_; }
+
+  // Returns the message, leaving the writer empty.
+  ByteBuffer Finish();
+
+ private:
+  void AppendVarint(uint64_t value);
+  void AppendPayload(const ByteBuffer& payload);
+  void FlushHeader();
+
+  // Framing bytes not yet added to slices_.
+  std::string header_;
+  std::vector<Slice> slices_;
+  size_t num_entries_ = 0;
+  size_t size_ = 0;
+};
+
+// Reads the entries of a message of a batch stream. The payloads share the
+// message's memory.
+class BatchReader {
+ public:
+  explicit BatchReader(const ByteBuffer& message);
+
+  bool Done() const { return pos_ == message_.size(); }
+
+  // Each returns false if the message is malformed.
+  bool ReadCall(uint64_t* id, ByteBuffer* request);
+  bool ReadResult(uint64_t* id, Status* status, ByteBuffer* response);
+
+ private:
+  bool ReadVarint(uint64_t* value);
+  bool ReadBytes(Slice* bytes);
+
+  Slice message_;
+  size_t pos_ = 0;
+};
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPC_SRC_CPP_COMMON_BATCH_FRAMING_H
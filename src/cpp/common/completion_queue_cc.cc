@@ -23,6 +23,7 @@
 #include <grpcpp/impl/completion_queue_tag.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -163,6 +164,34 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+size_t CompletionQueue::NextBatch(void** tags, bool* oks, size_t max_events) {
+  CHECK_GT(max_events, 0u);
+  constexpr size_t kMaxEventsPerCall = 64;
+  grpc_event events[kMaxEventsPerCall];
+  size_t num_returned = 0;
+  // Events whose tags swallow them in FinalizeResult() are not returned,
+  // so keep going until there is at least one that is.
+  while (num_returned == 0) {
+    const size_t num_events = grpc_completion_queue_next_batch(
+        cq_, events, std::min(max_events, kMaxEventsPerCall),
+        gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    // With an infinite deadline, a timeout means the queue was shut down.
+    if (events[0].type != GRPC_OP_COMPLETE) return 0;
+    for (size_t i = 0; i < num_events; ++i) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = events[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[num_returned] = tag;
+        oks[num_returned] = ok;
+        ++num_returned;
+      }
+    }
+  }
+  return num_returned;
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
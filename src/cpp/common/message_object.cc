@@ -0,0 +1,117 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/byte_buffer.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpcpp/impl/message_object.h>
+#include <grpcpp/support/status.h>
+
+#include "src/core/lib/slice/slice_refcount.h"
+
+namespace grpc {
+namespace internal {
+namespace {
+
+// Every wrapped object is carried by a single slice of these bytes. Nothing
+// else can produce a slice that starts here, so a peer in another process,
+// or a client that did not opt in, cannot make a buffer look like one.
+constexpr uint8_t kMessageObjectBytes[] = {'g', 'r', 'p', 'c', 'o', 'b', 'j'};
+
+// Owns the object for as long as the slice is referenced.
+class MessageObjectRefcount final : public grpc_slice_refcount {
+ public:
+  MessageObjectRefcount(void* object, const MessageObjectOps* ops)
+      : grpc_slice_refcount(Destroy), object_(object), ops_(ops) {}
+
+  void* object() const { return object_; }
+  const MessageObjectOps* ops() const { return ops_; }
+
+  void* Take() {
+    void* object = object_;
+    object_ = nullptr;
+    return object;
+  }
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* self = static_cast<MessageObjectRefcount*>(p);
+    if (self->object_ != nullptr) self->ops_->destroy(self->object_);
+    delete self;
+  }
+
+  void* object_;
+  const MessageObjectOps* const ops_;
+};
+
+MessageObjectRefcount* GetMessageObject(grpc_byte_buffer* buffer) {
+  if (buffer->type != GRPC_BB_RAW) return nullptr;
+  const grpc_slice_buffer& slices = buffer->data.raw.slice_buffer;
+  if (slices.count != 1) return nullptr;
+  const grpc_slice& slice = slices.slices[0];
+  if (slice.refcount == nullptr ||
+      slice.refcount == grpc_slice_refcount::NoopRefcount() ||
+      slice.data.refcounted.bytes != kMessageObjectBytes) {
+    return nullptr;
+  }
+  return static_cast<MessageObjectRefcount*>(slice.refcount);
+}
+
+}  // namespace
+
+grpc_byte_buffer* WrapMessageObject(void* object, const MessageObjectOps* ops) {
+  grpc_slice slice;
+  slice.refcount = new MessageObjectRefcount(object, ops);
+  slice.data.refcounted.bytes = const_cast<uint8_t*>(kMessageObjectBytes);
+  slice.data.refcounted.length = sizeof(kMessageObjectBytes);
+  grpc_byte_buffer* buffer = grpc_raw_byte_buffer_create(&slice, 1);
+  grpc_slice_unref(slice);
+  return buffer;
+}
+
+bool IsMessageObject(grpc_byte_buffer* buffer) {
+  return GetMessageObject(buffer) != nullptr;
+}
+
+void* TakeMessageObject(grpc_byte_buffer* buffer, const MessageObjectOps* ops) {
+  MessageObjectRefcount* refcount = GetMessageObject(buffer);
+  if (refcount == nullptr || refcount->ops() != ops) return nullptr;
+  return refcount->Take();
+}
+
+Status MaterializeMessageObject(grpc_byte_buffer* buffer) {
+  MessageObjectRefcount* refcount = GetMessageObject(buffer);
+  if (refcount == nullptr) return Status::OK;
+  if (refcount->object() == nullptr) {
+    return Status(StatusCode::INTERNAL, "Message object was already taken");
+  }
+  grpc_byte_buffer* bytes = nullptr;
+  Status status = refcount->ops()->serialize(refcount->object(), &bytes);
+  if (bytes != nullptr) {
+    if (status.ok()) {
+      grpc_slice_buffer_swap(&buffer->data.raw.slice_buffer,
+                             &bytes->data.raw.slice_buffer);
+    }
+    // Also releases the object, if it was swapped out of buffer.
+    grpc_byte_buffer_destroy(bytes);
+  }
+  return status;
+}
+
+}  // namespace internal
+}  // namespace grpc
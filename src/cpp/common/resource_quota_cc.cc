@@ -22,6 +22,9 @@
 
 #include <string>
 
+#include "src/core/lib/resource_quota/method_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+
 namespace grpc {
 
 ResourceQuota::ResourceQuota() : impl_(grpc_resource_quota_create(nullptr)) {}
@@ -40,4 +43,25 @@ ResourceQuota& ResourceQuota::SetMaxThreads(int new_max_threads) {
   grpc_resource_quota_set_max_threads(impl_, new_max_threads);
   return *this;
 }
+
+ResourceQuota& ResourceQuota::SetMethodBudget(const std::string& method,
+                                              size_t max_bytes,
+                                              MethodPriority priority) {
+  grpc_core::MethodQuotas::Budget budget;
+  budget.max_bytes = max_bytes;
+  switch (priority) {
+    case MethodPriority::kLow:
+      budget.priority = grpc_core::MethodQuotas::Priority::kLow;
+      break;
+    case MethodPriority::kNormal:
+      budget.priority = grpc_core::MethodQuotas::Priority::kNormal;
+      break;
+    case MethodPriority::kHigh:
+      budget.priority = grpc_core::MethodQuotas::Priority::kHigh;
+      break;
+  }
+  grpc_core::ResourceQuota::FromC(impl_)->method_quotas()->SetBudget(method,
+                                                                    budget);
+  return *this;
+}
 }  // namespace grpc
@@ -20,6 +20,7 @@
 #include <grpc/grpc_crl_provider.h>
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
+#include <grpc/grpc_session_ticket_key_provider.h>
 #include <grpcpp/security/tls_certificate_provider.h>
 #include <grpcpp/security/tls_certificate_verifier.h>
 #include <grpcpp/security/tls_credentials_options.h>
@@ -27,6 +28,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "absl/log/check.h"
 
@@ -150,5 +152,13 @@ void TlsServerCredentialsOptions::set_send_client_ca_list(
                                                        send_client_ca_list);
 }
 
+void TlsServerCredentialsOptions::set_session_ticket_key_provider(
+    std::shared_ptr<SessionTicketKeyProvider> session_ticket_key_provider) {
+  grpc_tls_credentials_options* options = mutable_c_credentials_options();
+  CHECK_NE(options, nullptr);
+  grpc_tls_credentials_options_set_session_ticket_key_provider(
+      options, std::move(session_ticket_key_provider));
+}
+
 }  // namespace experimental
 }  // namespace grpc
@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <unordered_map>
 #include <variant>
@@ -35,6 +36,7 @@
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
+#include "google/protobuf/struct.upb.h"
 #include "opentelemetry/sdk/resource/semantic_conventions.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -42,6 +44,7 @@
 #include "src/core/util/env.h"
 #include "src/cpp/ext/otel/key_value_iterable.h"
 #include "upb/base/string_view.h"
+#include "upb/mem/arena.hpp"
 
 namespace grpc {
 namespace internal {
@@ -85,7 +88,7 @@ constexpr absl::string_view kGceType = "gcp_compute_engine";
 
 // A helper method that decodes the remote metadata \a slice as a protobuf
 // Struct allocated on \a arena.
-google_protobuf_Struct* DecodeMetadata(grpc_core::Slice slice,
+google_protobuf_Struct* DecodeMetadata(absl::string_view slice,
                                        upb_Arena* arena) {
   // Treat an empty slice as an invalid metadata value.
   if (slice.empty()) {
@@ -93,8 +96,7 @@ google_protobuf_Struct* DecodeMetadata(grpc_core::Slice slice,
   }
   // Decode the slice.
   std::string decoded_metadata;
-  bool metadata_decoded =
-      absl::Base64Unescape(slice.as_string_view(), &decoded_metadata);
+  bool metadata_decoded = absl::Base64Unescape(slice, &decoded_metadata);
   if (metadata_decoded) {
     return google_protobuf_Struct_parse(decoded_metadata.c_str(),
                                         decoded_metadata.size(), arena);
@@ -201,22 +203,38 @@ absl::Span<const RemoteAttribute> GetAttributesForType(
   }
 }
 
-std::optional<std::pair<absl::string_view, absl::string_view>>
-NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
-                      size_t start_index, size_t curr,
-                      google_protobuf_Struct* decoded_metadata,
-                      upb_Arena* arena) {
-  DCHECK_GE(curr, start_index);
-  const size_t index = curr - start_index;
-  if (index >= attributes.size()) return std::nullopt;
-  const auto& attribute = attributes[index];
-  return std::pair(attribute.otel_attribute,
-                   GetStringValueFromUpbStruct(
-                       decoded_metadata, attribute.metadata_attribute, arena));
-}
+// Peers sending more distinct values than this are not expected; if there
+// are, the cache is simply dropped and refilled.
+constexpr size_t kMaxCachedPeerLabels = 64;
 
 }  // namespace
 
+//
+// MeshPeerLabels
+//
+
+std::shared_ptr<const MeshPeerLabels> MeshPeerLabels::Decode(
+    absl::string_view remote_metadata) {
+  auto result = std::make_shared<MeshPeerLabels>();
+  upb::Arena arena;
+  google_protobuf_Struct* struct_pb =
+      DecodeMetadata(remote_metadata, arena.ptr());
+  result->got_remote_labels = struct_pb != nullptr;
+  auto add_labels = [&](absl::Span<const RemoteAttribute> attributes) {
+    for (const auto& attribute : attributes) {
+      result->labels.emplace_back(
+          attribute.otel_attribute,
+          GetStringValueFromUpbStruct(
+              struct_pb, attribute.metadata_attribute, arena.ptr()));
+    }
+  };
+  add_labels(kFixedAttributes);
+  add_labels(GetAttributesForType(StringToGcpResourceType(
+      GetStringValueFromUpbStruct(struct_pb, kMetadataExchangeTypeKey,
+                                  arena.ptr()))));
+  return result;
+}
+
 //
 // MeshLabelsIterable
 //
@@ -224,10 +242,13 @@ NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
 MeshLabelsIterable::MeshLabelsIterable(
     const std::vector<std::pair<absl::string_view, std::string>>& local_labels,
     grpc_core::Slice remote_metadata)
-    : struct_pb_(DecodeMetadata(std::move(remote_metadata), arena_.ptr())),
-      local_labels_(local_labels),
-      remote_type_(StringToGcpResourceType(GetStringValueFromUpbStruct(
-          struct_pb_, kMetadataExchangeTypeKey, arena_.ptr()))) {}
+    : MeshLabelsIterable(local_labels, MeshPeerLabels::Decode(
+                                           remote_metadata.as_string_view())) {}
+
+MeshLabelsIterable::MeshLabelsIterable(
+    const std::vector<std::pair<absl::string_view, std::string>>& local_labels,
+    std::shared_ptr<const MeshPeerLabels> remote_labels)
+    : local_labels_(local_labels), remote_labels_(std::move(remote_labels)) {}
 
 std::optional<std::pair<absl::string_view, absl::string_view>>
 MeshLabelsIterable::Next() {
@@ -235,20 +256,14 @@ MeshLabelsIterable::Next() {
   if (pos_ < local_labels_size) {
     return local_labels_[pos_++];
   }
-  const size_t fixed_attribute_end =
-      local_labels_size + kFixedAttributes.size();
-  if (pos_ < fixed_attribute_end) {
-    return NextFromAttributeList(kFixedAttributes, local_labels_size, pos_++,
-                                 struct_pb_, arena_.ptr());
-  }
-  return NextFromAttributeList(GetAttributesForType(remote_type_),
-                               fixed_attribute_end, pos_++, struct_pb_,
-                               arena_.ptr());
+  const size_t index = pos_ - local_labels_size;
+  if (index >= remote_labels_->labels.size()) return std::nullopt;
+  ++pos_;
+  return remote_labels_->labels[index];
 }
 
 size_t MeshLabelsIterable::Size() const {
-  return local_labels_.size() + kFixedAttributes.size() +
-         GetAttributesForType(remote_type_).size();
+  return local_labels_.size() + remote_labels_->labels.size();
 }
 
 //
@@ -324,8 +339,23 @@ std::unique_ptr<LabelsIterable> ServiceMeshLabelsInjector::GetLabels(
   auto peer_metadata =
       incoming_initial_metadata->Take(grpc_core::XEnvoyPeerMetadata());
   return std::make_unique<MeshLabelsIterable>(
-      local_labels_, peer_metadata.has_value() ? *std::move(peer_metadata)
-                                               : grpc_core::Slice());
+      local_labels_, GetPeerLabels(peer_metadata.has_value()
+                                       ? peer_metadata->as_string_view()
+                                       : absl::string_view()));
+}
+
+std::shared_ptr<const MeshPeerLabels> ServiceMeshLabelsInjector::GetPeerLabels(
+    absl::string_view remote_metadata) const {
+  {
+    grpc_core::MutexLock lock(&peer_labels_mu_);
+    auto it = peer_labels_.find(remote_metadata);
+    if (it != peer_labels_.end()) return it->second;
+  }
+  auto labels = MeshPeerLabels::Decode(remote_metadata);
+  grpc_core::MutexLock lock(&peer_labels_mu_);
+  if (peer_labels_.size() >= kMaxCachedPeerLabels) peer_labels_.clear();
+  peer_labels_.emplace(remote_metadata, labels);
+  return labels;
 }
 
 void ServiceMeshLabelsInjector::AddLabels(
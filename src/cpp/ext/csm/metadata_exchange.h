@@ -26,17 +26,30 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
-#include "google/protobuf/struct.upb.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/util/sync.h"
 #include "src/cpp/ext/otel/otel_plugin.h"
-#include "upb/mem/arena.hpp"
 
 namespace grpc {
 namespace internal {
 
+// The peer labels decoded from an "x-envoy-peer-metadata" value. EXPOSED FOR
+// TESTING PURPOSES ONLY.
+struct MeshPeerLabels {
+  // Decodes \a remote_metadata, the base64 encoded metadata sent by the peer.
+  static std::shared_ptr<const MeshPeerLabels> Decode(
+      absl::string_view remote_metadata);
+
+  // True if the peer sent a non-empty valid value.
+  bool got_remote_labels = false;
+  std::vector<std::pair<absl::string_view, std::string>> labels;
+};
+
 class ServiceMeshLabelsInjector : public LabelsInjector {
  public:
   explicit ServiceMeshLabelsInjector(
@@ -78,8 +91,18 @@ class ServiceMeshLabelsInjector : public LabelsInjector {
   }
 
  private:
+  // Returns the decoded labels for the raw peer metadata value.
+  std::shared_ptr<const MeshPeerLabels> GetPeerLabels(
+      absl::string_view remote_metadata) const;
+
   std::vector<std::pair<absl::string_view, std::string>> local_labels_;
   grpc_core::Slice serialized_labels_to_send_;
+  // Peers usually send one of a few values, so the decoded labels are cached
+  // by the raw value.
+  mutable grpc_core::Mutex peer_labels_mu_;
+  mutable absl::flat_hash_map<std::string,
+                              std::shared_ptr<const MeshPeerLabels>>
+      peer_labels_ ABSL_GUARDED_BY(peer_labels_mu_);
 };
 
 // A LabelsIterable class provided by ServiceMeshLabelsInjector. EXPOSED FOR
@@ -93,6 +116,11 @@ class MeshLabelsIterable : public LabelsIterable {
           local_labels,
       grpc_core::Slice remote_metadata);
 
+  MeshLabelsIterable(
+      const std::vector<std::pair<absl::string_view, std::string>>&
+          local_labels,
+      std::shared_ptr<const MeshPeerLabels> remote_labels);
+
   std::optional<std::pair<absl::string_view, absl::string_view>> Next()
       override;
 
@@ -102,13 +130,11 @@ class MeshLabelsIterable : public LabelsIterable {
 
   // Returns true if the peer sent a non-empty base64 encoded
   // "x-envoy-peer-metadata" metadata.
-  bool GotRemoteLabels() const { return struct_pb_ != nullptr; }
+  bool GotRemoteLabels() const { return remote_labels_->got_remote_labels; }
 
  private:
-  upb::Arena arena_;
-  google_protobuf_Struct* struct_pb_ = nullptr;
   const std::vector<std::pair<absl::string_view, std::string>>& local_labels_;
-  GcpResourceType remote_type_ = GcpResourceType::kUnknown;
+  std::shared_ptr<const MeshPeerLabels> remote_labels_;
   uint32_t pos_ = 0;
 };
 
@@ -110,6 +110,7 @@ GcpObservabilityConfig::CloudLogging::RpcEventConfiguration::JsonLoader(
                          &RpcEventConfiguration::max_metadata_bytes)
           .OptionalField("max_message_bytes",
                          &RpcEventConfiguration::max_message_bytes)
+          .OptionalField("sampling_rate", &RpcEventConfiguration::sampling_rate)
           .Finish();
   return loader;
 }
@@ -117,6 +118,10 @@ GcpObservabilityConfig::CloudLogging::RpcEventConfiguration::JsonLoader(
 void GcpObservabilityConfig::CloudLogging::RpcEventConfiguration::JsonPostLoad(
     const grpc_core::Json& /* json */, const grpc_core::JsonArgs& /* args */,
     grpc_core::ValidationErrors* errors) {
+  if (sampling_rate < 0 || sampling_rate > 1) {
+    grpc_core::ValidationErrors::ScopedField field(errors, ".sampling_rate");
+    errors->AddError("must be between 0 and 1");
+  }
   grpc_core::ValidationErrors::ScopedField methods_field(errors, ".methods");
   parsed_methods.reserve(qualified_methods.size());
   for (size_t i = 0; i < qualified_methods.size(); ++i) {
@@ -47,6 +47,8 @@ struct GcpObservabilityConfig {
       bool exclude = false;
       uint32_t max_metadata_bytes = 0;
       uint32_t max_message_bytes = 0;
+      // The fraction of matching calls that are logged, as whole calls.
+      float sampling_rate = 1;
 
       static const grpc_core::JsonLoaderInterface* JsonLoader(
           const grpc_core::JsonArgs&);
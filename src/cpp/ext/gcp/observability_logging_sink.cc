@@ -27,12 +27,15 @@
 #include <grpcpp/support/status.h>
 
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <utility>
 
 #include "absl/log/log.h"
 #include "absl/numeric/int128.h"
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_format.h"
@@ -91,6 +94,14 @@ LoggingSink::Config ObservabilityLoggingSink::FindMatch(
         if (config.exclude) {
           return LoggingSink::Config();
         }
+        // Calls are sampled as a whole, so that the entries of a call that
+        // is logged are all there, and those that are not cost nothing.
+        if (config.sampling_rate < 1) {
+          thread_local absl::InsecureBitGen gen;
+          if (!absl::Bernoulli(gen, config.sampling_rate)) {
+            return LoggingSink::Config();
+          }
+        }
         return LoggingSink::Config(config.max_metadata_bytes,
                                    config.max_message_bytes);
       }
@@ -235,6 +246,11 @@ void EntryToJsonStructProto(LoggingSink::Entry entry,
 
 namespace {
 
+constexpr uint64_t kMaxEntriesBeforeDump = 100000;
+constexpr uint64_t kMaxMemoryFootprintBeforeDump = 10 * 1024 * 1024;
+constexpr uint64_t kMinEntriesBeforeFlush = 1000;
+constexpr uint64_t kMinMemoryFootprintBeforeFlush = 1 * 1024 * 1024;
+
 uint64_t EstimateEntrySize(const LoggingSink::Entry& entry) {
   uint64_t size = sizeof(entry);
   for (const auto& pair : entry.payload.metadata) {
@@ -252,12 +268,44 @@ uint64_t EstimateEntrySize(const LoggingSink::Entry& entry) {
 }  // namespace
 
 void ObservabilityLoggingSink::LogEntry(Entry entry) {
+  if (sink_closed_.load()) return;
   auto entry_size = EstimateEntrySize(entry);
-  grpc_core::MutexLock lock(&mu_);
-  if (sink_closed_) return;
-  entries_.push_back(std::move(entry));
-  entries_memory_footprint_ += entry_size;
-  MaybeTriggerFlushLocked();
+  uint64_t entries;
+  uint64_t memory_footprint;
+  Shard& shard = shards_.this_cpu();
+  {
+    grpc_core::MutexLock lock(&shard.mu);
+    shard.entries.push_back(std::move(entry));
+    shard.memory_footprint += entry_size;
+    // Counted under the shard's lock, so that TakeEntries() never takes
+    // away more than has been counted.
+    entries = buffered_entries_.fetch_add(1) + 1;
+    memory_footprint =
+        buffered_memory_footprint_.fetch_add(entry_size) + entry_size;
+  }
+  if (!flush_scheduled_.load() || entries >= kMinEntriesBeforeFlush ||
+      memory_footprint >= kMinMemoryFootprintBeforeFlush) {
+    MaybeTriggerFlush();
+  }
+}
+
+std::vector<LoggingSink::Entry> ObservabilityLoggingSink::TakeEntries() {
+  std::vector<Entry> entries;
+  for (Shard& shard : shards_) {
+    grpc_core::MutexLock lock(&shard.mu);
+    if (shard.entries.empty()) continue;
+    buffered_entries_.fetch_sub(shard.entries.size());
+    buffered_memory_footprint_.fetch_sub(shard.memory_footprint);
+    shard.memory_footprint = 0;
+    if (entries.empty()) {
+      entries = std::move(shard.entries);
+    } else {
+      std::move(shard.entries.begin(), shard.entries.end(),
+                std::back_inserter(entries));
+    }
+    shard.entries.clear();
+  }
+  return entries;
 }
 
 void ObservabilityLoggingSink::RegisterEnvironmentResource(
@@ -269,9 +317,11 @@ void ObservabilityLoggingSink::RegisterEnvironmentResource(
 
 void ObservabilityLoggingSink::FlushAndClose() {
   grpc_core::MutexLock lock(&mu_);
-  sink_closed_ = true;
-  if (entries_.empty()) return;
+  sink_closed_.store(true);
+  if (buffered_entries_.load() == 0) return;
   MaybeTriggerFlushLocked();
+  // Nothing is left to wait for if the entries were dumped instead.
+  if (buffered_entries_.load() == 0 && !flush_in_progress_) return;
   sink_flushed_after_close_.Wait(&mu_);
 }
 
@@ -308,8 +358,7 @@ void ObservabilityLoggingSink::Flush() {
           CreateCustomChannel(endpoint, GoogleDefaultCredentials(), args));
     }
     stub = stub_.get();
-    entries = std::move(entries_);
-    entries_memory_footprint_ = 0;
+    entries = TakeEntries();
     resource = resource_;
   }
   FlushEntriesHelper(stub, std::move(entries), resource);
@@ -378,7 +427,7 @@ void ObservabilityLoggingSink::FlushEntriesHelper(
         delete call;
         grpc_core::MutexLock lock(&mu_);
         flush_in_progress_ = false;
-        if (sink_closed_ && entries_.empty()) {
+        if (sink_closed_.load() && buffered_entries_.load() == 0) {
           sink_flushed_after_close_.SignalAll();
         } else {
           MaybeTriggerFlushLocked();
@@ -392,10 +441,9 @@ void ObservabilityLoggingSink::MaybeTriggerFlush() {
 }
 
 void ObservabilityLoggingSink::MaybeTriggerFlushLocked() {
-  constexpr int kMaxEntriesBeforeDump = 100000;
-  constexpr int kMaxMemoryFootprintBeforeDump = 10 * 1024 * 1024;
-  constexpr int kMinEntriesBeforeFlush = 1000;
-  constexpr int kMinMemoryFootprintBeforeFlush = 1 * 1024 * 1024;
+  // Cleared before the buffer is looked at, so that an entry that LogEntry()
+  // adds after the counts are read triggers another call.
+  flush_scheduled_.store(false);
   // Use this opportunity to fetch environment resource if not fetched already
   if (resource_ == nullptr && !registered_env_fetch_notification_) {
     auto& env_autodetect = EnvironmentAutoDetect::Get();
@@ -408,12 +456,13 @@ void ObservabilityLoggingSink::MaybeTriggerFlushLocked() {
       });
     }
   }
-  if (entries_.empty()) return;
-  if (entries_.size() > kMaxEntriesBeforeDump ||
-      entries_memory_footprint_ > kMaxMemoryFootprintBeforeDump) {
+  const uint64_t entries = buffered_entries_.load();
+  const uint64_t memory_footprint = buffered_memory_footprint_.load();
+  if (entries > kMaxEntriesBeforeDump ||
+      memory_footprint > kMaxMemoryFootprintBeforeDump) {
     // Buffer limits have been reached. Dump entries with LOG
     LOG(INFO) << "Buffer limit reached. Dumping log entries.";
-    for (auto& entry : entries_) {
+    for (auto& entry : TakeEntries()) {
       google::protobuf::Struct proto;
       std::string timestamp = entry.timestamp.ToString();
       EntryToJsonStructProto(std::move(entry), &proto);
@@ -422,14 +471,12 @@ void ObservabilityLoggingSink::MaybeTriggerFlushLocked() {
       LOG(INFO) << "Log Entry recorded at time: " << timestamp << " : "
                 << output;
     }
-    entries_.clear();
-    entries_memory_footprint_ = 0;
-  } else if (resource_ != nullptr && !flush_in_progress_) {
+  } else if (entries != 0 && resource_ != nullptr && !flush_in_progress_) {
     // Environment resource has been detected. Trigger flush if conditions
     // suffice.
-    if ((entries_.size() >= kMinEntriesBeforeFlush ||
-         entries_memory_footprint_ >= kMinMemoryFootprintBeforeFlush ||
-         sink_closed_) &&
+    if ((entries >= kMinEntriesBeforeFlush ||
+         memory_footprint >= kMinMemoryFootprintBeforeFlush ||
+         sink_closed_.load()) &&
         !flush_triggered_) {
       // It is fine even if there were a flush with a timer in progress. What is
       // important is that a flush is triggered.
@@ -441,6 +488,10 @@ void ObservabilityLoggingSink::MaybeTriggerFlushLocked() {
                               [this]() { Flush(); });
     }
   }
+  // Each of these ends in another call.
+  flush_scheduled_.store(
+      flush_triggered_ || flush_in_progress_ || flush_timer_in_progress_ ||
+      (resource_ == nullptr && registered_env_fetch_notification_));
 }
 
 ObservabilityLoggingSink::Configuration::Configuration(
@@ -448,7 +499,8 @@ ObservabilityLoggingSink::Configuration::Configuration(
         rpc_event_config)
     : exclude(rpc_event_config.exclude),
       max_metadata_bytes(rpc_event_config.max_metadata_bytes),
-      max_message_bytes(rpc_event_config.max_message_bytes) {
+      max_message_bytes(rpc_event_config.max_message_bytes),
+      sampling_rate(rpc_event_config.sampling_rate) {
   for (auto& parsed_method : rpc_event_config.parsed_methods) {
     parsed_methods.emplace_back(ParsedMethod{
         std::string(parsed_method.service), std::string(parsed_method.method)});
@@ -23,6 +23,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -33,6 +34,7 @@
 #include "absl/strings/string_view.h"
 #include "google/logging/v2/logging.grpc.pb.h"
 #include "src/core/ext/filters/logging/logging_sink.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/sync.h"
 #include "src/cpp/ext/gcp/environment_autodetect.h"
 #include "src/cpp/ext/gcp/observability_config.h"
@@ -41,6 +43,9 @@ namespace grpc {
 namespace internal {
 
 // Interface for a logging sink that will be used by the logging filter.
+// Entries are buffered in per-CPU shards, so that calls logging at the same
+// time do not contend on one lock, and are converted to protos and written
+// to Cloud Logging in batches, off the calls' threads.
 class ObservabilityLoggingSink : public grpc_core::LoggingSink {
  public:
   ObservabilityLoggingSink(GcpObservabilityConfig::CloudLogging logging_config,
@@ -71,6 +76,13 @@ class ObservabilityLoggingSink : public grpc_core::LoggingSink {
     bool exclude = false;
     uint32_t max_metadata_bytes = 0;
     uint32_t max_message_bytes = 0;
+    float sampling_rate = 1;
+  };
+
+  struct Shard {
+    grpc_core::Mutex mu;
+    std::vector<Entry> entries ABSL_GUARDED_BY(mu);
+    uint64_t memory_footprint ABSL_GUARDED_BY(mu) = 0;
   };
 
   void RegisterEnvironmentResource(
@@ -84,6 +96,9 @@ class ObservabilityLoggingSink : public grpc_core::LoggingSink {
       std::vector<Entry> entries,
       const EnvironmentAutoDetect::ResourceType* resource);
 
+  // Moves the entries out of all shards.
+  std::vector<Entry> TakeEntries();
+
   void MaybeTriggerFlush();
   void MaybeTriggerFlushLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
@@ -98,14 +113,20 @@ class ObservabilityLoggingSink : public grpc_core::LoggingSink {
       mu_) event_engine_;
   std::unique_ptr<google::logging::v2::LoggingServiceV2::StubInterface> stub_
       ABSL_GUARDED_BY(mu_);
-  std::vector<Entry> entries_ ABSL_GUARDED_BY(mu_);
-  uint64_t entries_memory_footprint_ ABSL_GUARDED_BY(mu_) = 0;
+  grpc_core::PerCpu<Shard> shards_{
+      grpc_core::PerCpuOptions().SetCpusPerShard(2).SetMaxShards(32)};
+  // Totals over shards_, updated without mu_.
+  std::atomic<uint64_t> buffered_entries_{0};
+  std::atomic<uint64_t> buffered_memory_footprint_{0};
   const EnvironmentAutoDetect::ResourceType* resource_ ABSL_GUARDED_BY(mu_) =
       nullptr;
   bool flush_triggered_ ABSL_GUARDED_BY(mu_) = false;
   bool flush_in_progress_ ABSL_GUARDED_BY(mu_) = false;
   bool flush_timer_in_progress_ ABSL_GUARDED_BY(mu_) = false;
-  bool sink_closed_ ABSL_GUARDED_BY(mu_) = false;
+  // Whether something already calls MaybeTriggerFlushLocked() later on, so
+  // that LogEntry() only takes mu_ when the buffer passes a threshold.
+  std::atomic<bool> flush_scheduled_{false};
+  std::atomic<bool> sink_closed_{false};
   grpc_core::CondVar sink_flushed_after_close_;
 };
 
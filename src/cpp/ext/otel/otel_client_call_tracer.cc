@@ -42,6 +42,8 @@
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/metrics/sync_instruments.h"
 #include "opentelemetry/trace/context.h"
+#include "opentelemetry/trace/default_span.h"
+#include "opentelemetry/trace/span_context.h"
 #include "opentelemetry/trace/tracer.h"
 #include "src/core/client_channel/client_channel_filter.h"
 #include "src/core/lib/channel/channel_stack.h"
@@ -86,7 +88,7 @@ OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::CallAttemptTracer(
                /*optional_labels=*/{},
                /*is_client=*/true, parent_->otel_plugin_));
   }
-  if (parent_->otel_plugin_->tracer_ != nullptr) {
+  if (parent_->sampled_) {
     std::array<std::pair<opentelemetry::nostd::string_view,
                          opentelemetry::common::AttributeValue>,
                2>
@@ -123,10 +125,13 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
         return true;
       },
       parent_->otel_plugin_);
-  if (span_ != nullptr) {
+  // Attempts of calls that are not sampled propagate the context of the call,
+  // so that the server does not sample them either.
+  const auto& span = span_ != nullptr ? span_ : parent_->span_;
+  if (span != nullptr) {
     GrpcTextMapCarrier carrier(send_initial_metadata);
     opentelemetry::context::Context context;
-    context = opentelemetry::trace::SetSpan(context, span_);
+    context = opentelemetry::trace::SetSpan(context, span);
     parent_->otel_plugin_->text_map_propagator_->Inject(carrier, context);
   }
 }
@@ -330,6 +335,14 @@ OpenTelemetryPluginImpl::ClientCallTracer::ClientCallTracer(
       registered_method_(registered_method),
       otel_plugin_(otel_plugin),
       scope_config_(std::move(scope_config)) {
+  absl::string_view method = absl::StripPrefix(path_.as_string_view(), "/");
+  if (registered_method_ ||
+      (otel_plugin_->generic_method_attribute_filter() != nullptr &&
+       otel_plugin_->generic_method_attribute_filter()(method))) {
+    method_for_stats_ = method;
+  } else {
+    method_for_stats_ = "other";
+  }
   if (otel_plugin_->tracer_ != nullptr) {
     opentelemetry::trace::StartSpanOptions options;
     // Get the parent span from the parent call if available, otherwise fall
@@ -344,14 +357,21 @@ OpenTelemetryPluginImpl::ClientCallTracer::ClientCallTracer(
     // contexts for the same call.
     auto* parent_span = reinterpret_cast<opentelemetry::trace::Span*>(
         arena->GetContext<census_context>());
-    if (parent_span != nullptr) {
-      options.parent = parent_span->GetContext();
+    opentelemetry::trace::SpanContext parent_context =
+        parent_span != nullptr
+            ? parent_span->GetContext()
+            : opentelemetry::trace::Tracer::GetCurrentSpan()->GetContext();
+    if (parent_context.IsValid() && !parent_context.IsSampled()) {
+      // The parent was not sampled, so neither is this call. Skip the tracer
+      // altogether and only keep the parent's context to propagate it.
+      span_ = opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span>(
+          new opentelemetry::trace::DefaultSpan(std::move(parent_context)));
     } else {
-      options.parent =
-          opentelemetry::trace::Tracer::GetCurrentSpan()->GetContext();
+      options.parent = std::move(parent_context);
+      span_ = otel_plugin_->tracer_->StartSpan(
+          absl::StrCat("Sent.", GetMethodFromPath(path_)), options);
+      sampled_ = span_->IsRecording();
     }
-    span_ = otel_plugin_->tracer_->StartSpan(
-        absl::StrCat("Sent.", GetMethodFromPath(path_)), options);
   }
 }
 
@@ -389,20 +409,9 @@ OpenTelemetryPluginImpl::ClientCallTracer::StartNewAttempt(
                                /*arena_allocated=*/false);
 }
 
-absl::string_view OpenTelemetryPluginImpl::ClientCallTracer::MethodForStats()
-    const {
-  absl::string_view method = absl::StripPrefix(path_.as_string_view(), "/");
-  if (registered_method_ ||
-      (otel_plugin_->generic_method_attribute_filter() != nullptr &&
-       otel_plugin_->generic_method_attribute_filter()(method))) {
-    return method;
-  }
-  return "other";
-}
-
 void OpenTelemetryPluginImpl::ClientCallTracer::RecordAnnotation(
     absl::string_view annotation) {
-  if (span_ != nullptr) {
+  if (sampled_) {
     span_->AddEvent(AbslStringViewToNoStdStringView(annotation));
   }
 }
@@ -118,6 +118,7 @@ class OpenTelemetryPluginImpl::ClientCallTracer
     // the call's party.
     std::atomic<uint64_t> incoming_bytes_{0};
     std::atomic<uint64_t> outgoing_bytes_{0};
+    // Only set if the call is sampled.
     opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span_;
     uint64_t send_seq_num_ = 0;
     uint64_t recv_seq_num_ = 0;
@@ -149,7 +150,7 @@ class OpenTelemetryPluginImpl::ClientCallTracer
   void RecordAnnotation(const Annotation& /*annotation*/) override;
 
  private:
-  absl::string_view MethodForStats() const;
+  absl::string_view MethodForStats() const { return method_for_stats_; }
 
   // Client method.
   grpc_core::Slice path_;
@@ -157,12 +158,21 @@ class OpenTelemetryPluginImpl::ClientCallTracer
   const bool registered_method_;
   OpenTelemetryPluginImpl* otel_plugin_;
   std::shared_ptr<OpenTelemetryPluginImpl::ClientScopeConfig> scope_config_;
+  // The method label, computed once per call since the generic method filter
+  // may be expensive. Points into path_ or to a literal.
+  absl::string_view method_for_stats_;
   grpc_core::Mutex mu_;
   // Non-transparent attempts per call (including first attempt)
   uint64_t retries_ ABSL_GUARDED_BY(&mu_) = 0;
   // Transparent retries per call
   uint64_t transparent_retries_ ABSL_GUARDED_BY(&mu_) = 0;
+  // The call's span. If the call is not sampled, this is either a span that
+  // does not record or, when the parent was not sampled, a span that only
+  // carries the parent's context so that it can be propagated.
   opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span_;
+  // Whether the call is sampled, decided when it starts. Attempts of calls
+  // that are not sampled do not start spans or build any span attributes.
+  bool sampled_ = false;
 };
 
 }  // namespace internal
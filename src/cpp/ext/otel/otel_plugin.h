@@ -170,6 +170,8 @@ class OpenTelemetryPluginBuilderImpl {
   OpenTelemetryPluginBuilderImpl& AddOptionalLabel(
       absl::string_view optional_label_key);
   // If `SetTracerProvider()` is not called, no traces are collected.
+  // Calls whose parent span is not sampled are not sampled either, and no
+  // spans are started for them, whatever the sampler of \a tracer_provider.
   OpenTelemetryPluginBuilderImpl& SetTracerProvider(
       std::shared_ptr<opentelemetry::trace::TracerProvider> tracer_provider);
   // Set one or multiple text map propagators for span context propagation,
@@ -34,6 +34,8 @@
 #include "absl/types/span.h"
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/trace/context.h"
+#include "opentelemetry/trace/span_context.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -68,8 +70,9 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordReceivedInitialMetadata(
   registered_method_ =
       recv_initial_metadata->get(grpc_core::GrpcRegisteredMethod())
           .value_or(nullptr) != nullptr;
+  ComputeMethodForStats();
   std::array<std::pair<absl::string_view, absl::string_view>, 1>
-      additional_labels = {{{OpenTelemetryMethodKey(), MethodForStats()}}};
+      additional_labels = {{{OpenTelemetryMethodKey(), method_for_stats_}}};
   if (otel_plugin_->server_.call.started != nullptr) {
     // We might not have all the injected labels that we want at this point, so
     // avoid recording a subset of injected labels here.
@@ -83,22 +86,33 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordReceivedInitialMetadata(
     GrpcTextMapCarrier carrier(recv_initial_metadata);
     opentelemetry::context::Context context;
     context = otel_plugin_->text_map_propagator_->Extract(carrier, context);
-    opentelemetry::trace::StartSpanOptions options;
-    options.parent = context;
-    span_ = otel_plugin_->tracer_->StartSpan(
-        absl::StrCat("Recv.", GetMethodFromPath(path_)), options);
+    opentelemetry::trace::SpanContext parent_context =
+        opentelemetry::trace::GetSpan(context)->GetContext();
+    opentelemetry::trace::Span* span;
+    if (parent_context.IsValid() && !parent_context.IsSampled()) {
+      // The client's span was not sampled, so neither is this call. Skip the
+      // tracer altogether.
+      span = &unsampled_parent_span_.emplace(std::move(parent_context));
+    } else {
+      opentelemetry::trace::StartSpanOptions options;
+      options.parent = context;
+      span_ = otel_plugin_->tracer_->StartSpan(
+          absl::StrCat("Recv.", GetMethodFromPath(path_)), options);
+      sampled_ = span_->IsRecording();
+      span = span_.get();
+    }
     // We are intentionally reusing census_context to save opentelemetry's Span
     // on the context to avoid introducing a new type for opentelemetry inside
     // gRPC Core. There's no risk of collisions since we do not allow multiple
     // tracing systems active for the same call.
     grpc_core::SetContext<census_context>(
-        reinterpret_cast<census_context*>(span_.get()));
+        reinterpret_cast<census_context*>(span));
   }
 }
 
 void OpenTelemetryPluginImpl::ServerCallTracer::RecordReceivedMessage(
     const grpc_core::Message& recv_message) {
-  if (span_ != nullptr) {
+  if (sampled_) {
     std::array<std::pair<opentelemetry::nostd::string_view,
                          opentelemetry::common::AttributeValue>,
                2>
@@ -120,7 +134,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordReceivedMessage(
 void OpenTelemetryPluginImpl::ServerCallTracer::
     RecordReceivedDecompressedMessage(
         const grpc_core::Message& recv_decompressed_message) {
-  if (span_ != nullptr) {
+  if (sampled_) {
     std::array<std::pair<opentelemetry::nostd::string_view,
                          opentelemetry::common::AttributeValue>,
                2>
@@ -152,7 +166,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordSendInitialMetadata(
 
 void OpenTelemetryPluginImpl::ServerCallTracer::RecordSendMessage(
     const grpc_core::Message& send_message) {
-  if (span_ != nullptr) {
+  if (sampled_) {
     std::array<std::pair<opentelemetry::nostd::string_view,
                          opentelemetry::common::AttributeValue>,
                2>
@@ -164,7 +178,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordSendMessage(
 }
 void OpenTelemetryPluginImpl::ServerCallTracer::RecordSendCompressedMessage(
     const grpc_core::Message& send_compressed_message) {
-  if (span_ != nullptr) {
+  if (sampled_) {
     std::array<std::pair<opentelemetry::nostd::string_view,
                          opentelemetry::common::AttributeValue>,
                2>
@@ -189,7 +203,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordEnd(
     const grpc_call_final_info* final_info) {
   std::array<std::pair<absl::string_view, absl::string_view>, 2>
       additional_labels = {
-          {{OpenTelemetryMethodKey(), MethodForStats()},
+          {{OpenTelemetryMethodKey(), method_for_stats_},
            {OpenTelemetryStatusKey(),
             grpc_status_code_to_string(final_info->final_status)}}};
   // Currently we do not have any optional labels on the server side.
@@ -218,7 +232,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordEnd(
             : final_info->stats.transport_stream_stats.incoming.data_bytes,
         labels, opentelemetry::context::Context{});
   }
-  if (span_ != nullptr) {
+  if (sampled_) {
     if (final_info->final_status == GRPC_STATUS_OK) {
       span_->SetStatus(opentelemetry::trace::StatusCode::kOk);
     } else {
@@ -228,8 +242,8 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordEnd(
                        final_info->error_string)
               .ToString());
     }
-    span_->End();
   }
+  if (span_ != nullptr) span_->End();
 }
 
 void OpenTelemetryPluginImpl::ServerCallTracer::RecordIncomingBytes(
@@ -244,7 +258,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordOutgoingBytes(
 
 void OpenTelemetryPluginImpl::ServerCallTracer::RecordAnnotation(
     absl::string_view annotation) {
-  if (span_ != nullptr) {
+  if (sampled_) {
     span_->AddEvent(AbslStringViewToNoStdStringView(annotation));
   }
 }
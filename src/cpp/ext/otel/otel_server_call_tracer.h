@@ -21,7 +21,10 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <optional>
+
 #include "absl/strings/strip.h"
+#include "opentelemetry/trace/default_span.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/cpp/ext/otel/otel_plugin.h"
@@ -102,20 +105,24 @@ class OpenTelemetryPluginImpl::ServerCallTracer
   }
 
  private:
-  absl::string_view MethodForStats() const {
+  void ComputeMethodForStats() {
     absl::string_view method = absl::StripPrefix(path_.as_string_view(), "/");
     if (registered_method_ ||
         (otel_plugin_->generic_method_attribute_filter() != nullptr &&
          otel_plugin_->generic_method_attribute_filter()(method))) {
-      return method;
+      method_for_stats_ = method;
+    } else {
+      method_for_stats_ = "other";
     }
-    return "other";
   }
 
   absl::Time start_time_;
   absl::Duration elapsed_time_;
   grpc_core::Slice path_;
   bool registered_method_;
+  // The method label, computed once per call since the generic method filter
+  // may be expensive. Points into path_ or to a literal.
+  absl::string_view method_for_stats_ = "other";
   std::vector<std::unique_ptr<LabelsIterable>>
       injected_labels_from_plugin_options_;
   OpenTelemetryPluginImpl* otel_plugin_;
@@ -126,7 +133,12 @@ class OpenTelemetryPluginImpl::ServerCallTracer
   // the call's party.
   std::atomic<uint64_t> incoming_bytes_{0};
   std::atomic<uint64_t> outgoing_bytes_{0};
+  // Not set if the client's span was not sampled.
   opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span_;
+  // When the client's span was not sampled, carries its context to the child
+  // calls of this call so that they are not sampled either.
+  std::optional<opentelemetry::trace::DefaultSpan> unsampled_parent_span_;
+  bool sampled_ = false;
   uint64_t send_seq_num_ = 0;
   uint64_t recv_seq_num_ = 0;
 };
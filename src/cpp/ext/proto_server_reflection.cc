@@ -22,6 +22,7 @@
 #include <grpcpp/support/interceptor.h>
 #include <grpcpp/support/sync_stream.h>
 
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -181,17 +182,26 @@ void ProtoServerReflectionBackend::FillFileDescriptorResponse(
     return;
   }
 
-  protobuf::FileDescriptorProto file_desc_proto;
-  std::string data;
-  file_desc->CopyTo(&file_desc_proto);
-  file_desc_proto.SerializeToString(&data);
-  response->mutable_file_descriptor_response()->add_file_descriptor_proto(data);
+  response->mutable_file_descriptor_response()->add_file_descriptor_proto(
+      SerializedFileDescriptor(file_desc));
 
   for (int i = 0; i < file_desc->dependency_count(); ++i) {
     FillFileDescriptorResponse(file_desc->dependency(i), response, seen_files);
   }
 }
 
+const std::string& ProtoServerReflectionBackend::SerializedFileDescriptor(
+    const protobuf::FileDescriptor* file_desc) const {
+  internal::MutexLock lock(&mu_);
+  std::string& data = serialized_files_[file_desc];
+  if (data.empty()) {
+    protobuf::FileDescriptorProto file_desc_proto;
+    file_desc->CopyTo(&file_desc_proto);
+    file_desc_proto.SerializeToString(&data);
+  }
+  return data;
+}
+
 Status ProtoServerReflection::ServerReflectionInfo(
     ServerContext* /* context */,
     ServerReaderWriter<reflection::v1alpha::ServerReflectionResponse,
@@ -21,16 +21,19 @@
 
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/impl/sync.h>
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/status.h>
 #include <grpcpp/support/sync_stream.h>
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "src/proto/grpc/reflection/v1/reflection.grpc.pb.h"
 #include "src/proto/grpc/reflection/v1alpha/reflection.grpc.pb.h"
 
@@ -76,8 +79,17 @@ class ProtoServerReflectionBackend {
   template <typename Response>
   void FillErrorResponse(const Status& status, Response* error_response) const;
 
+  // Returns the serialized FileDescriptorProto of file_desc. Descriptors in
+  // the pool never change, so each is only serialized once.
+  const std::string& SerializedFileDescriptor(
+      const protobuf::FileDescriptor* file_desc) const;
+
   const protobuf::DescriptorPool* descriptor_pool_;
   const std::vector<string>* services_;
+  mutable internal::Mutex mu_;
+  // Keyed by descriptors from descriptor_pool_, which outlive this.
+  mutable std::unordered_map<const protobuf::FileDescriptor*, std::string>
+      serialized_files_ ABSL_GUARDED_BY(mu_);
 };
 
 class ProtoServerReflection final
@@ -23,6 +23,7 @@
 // TODO(lidiz) build a real registration system that can pull in services
 // automatically with minimum amount of code.
 #include "src/cpp/server/channelz/channelz_service.h"
+#include "src/cpp/server/latent_see/latent_see_service.h"
 #if !defined(GRPC_NO_XDS) && !defined(DISABLED_XDS_PROTO_IN_CC)
 #include "src/cpp/server/csds/csds.h"
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
@@ -31,6 +32,7 @@ namespace grpc {
 namespace {
 
 auto* g_channelz_service = new ChannelzService();
+auto* g_latent_see_service = new experimental::LatentSeeService();
 #if !defined(GRPC_NO_XDS) && !defined(DISABLED_XDS_PROTO_IN_CC)
 auto* g_csds = new xds::experimental::ClientStatusDiscoveryService();
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
@@ -39,6 +41,7 @@ auto* g_csds = new xds::experimental::ClientStatusDiscoveryService();
 
 void AddAdminServices(ServerBuilder* builder) {
   builder->RegisterService(g_channelz_service);
+  builder->RegisterService(g_latent_see_service);
 #if !defined(GRPC_NO_XDS) && !defined(DISABLED_XDS_PROTO_IN_CC)
   builder->RegisterService(g_csds);
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
@@ -16,6 +16,7 @@
 
 #include "src/cpp/server/backend_metric_recorder.h"
 
+#include <grpc/support/cpu.h>
 #include <grpcpp/ext/call_metric_recorder.h>
 #include <grpcpp/ext/server_metric_recorder.h>
 #include <inttypes.h>
@@ -29,6 +30,8 @@
 #include "absl/log/log.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/telemetry/call_cpu_accounting.h"
+#include "src/core/util/latency_sketch.h"
 
 using grpc_core::BackendMetricData;
 
@@ -44,6 +47,21 @@ bool IsUtilizationValid(double utilization) {
 // Rate values (qps and eps) must be in [0, infy).
 bool IsRateValid(double rate) { return rate >= 0.0; }
 
+constexpr absl::string_view kCallLatencyP50 = "grpc.server.call_latency.p50";
+constexpr absl::string_view kCallLatencyP90 = "grpc.server.call_latency.p90";
+constexpr absl::string_view kCallLatencyP99 = "grpc.server.call_latency.p99";
+constexpr int64_t kCallLatencyRefreshIntervalMs = 1000;
+constexpr int64_t kCallCpuRefreshIntervalMs = 1000;
+
+int64_t NowMillis() {
+  return gpr_time_to_millis(gpr_now(GPR_CLOCK_MONOTONIC));
+}
+
+int64_t NowNanos() {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  return static_cast<int64_t>(now.tv_sec) * GPR_NS_PER_SEC + now.tv_nsec;
+}
+
 }  // namespace
 
 namespace grpc {
@@ -56,6 +74,10 @@ std::unique_ptr<ServerMetricRecorder> ServerMetricRecorder::Create() {
 ServerMetricRecorder::ServerMetricRecorder()
     : metric_state_(std::make_shared<const BackendMetricDataState>()) {}
 
+ServerMetricRecorder::~ServerMetricRecorder() {
+  delete call_latency_.load(std::memory_order_relaxed);
+}
+
 void ServerMetricRecorder::UpdateBackendMetricDataState(
     std::function<void(BackendMetricData*)> updater) {
   internal::MutexLock lock(&mu_);
@@ -154,6 +176,89 @@ void ServerMetricRecorder::SetAllNamedUtilization(
       });
 }
 
+void ServerMetricRecorder::EnableCallLatencyPercentiles() {
+  internal::MutexLock lock(&mu_);
+  if (call_latency_.load(std::memory_order_relaxed) != nullptr) return;
+  call_latency_.store(new grpc_core::LatencySketch(),
+                      std::memory_order_release);
+  GRPC_TRACE_LOG(backend_metric, INFO)
+      << "[" << this << "] Call latency percentiles enabled.";
+}
+
+void ServerMetricRecorder::RecordCallLatency(double seconds) {
+  grpc_core::LatencySketch* call_latency =
+      call_latency_.load(std::memory_order_acquire);
+  if (call_latency == nullptr || seconds < 0) return;
+  call_latency->Record(seconds);
+  // Computing the percentiles merges the whole sketch, so only one call per
+  // refresh interval does it.
+  const int64_t now = NowMillis();
+  int64_t next_refresh =
+      next_call_latency_refresh_ms_.load(std::memory_order_relaxed);
+  if (now < next_refresh ||
+      !next_call_latency_refresh_ms_.compare_exchange_strong(
+          next_refresh, now + kCallLatencyRefreshIntervalMs,
+          std::memory_order_relaxed)) {
+    return;
+  }
+  grpc_core::LatencySketch::Summary summary = call_latency->Summarize();
+  UpdateBackendMetricDataState([&summary](BackendMetricData* data) {
+    data->named_metrics[kCallLatencyP50] = summary.p50;
+    data->named_metrics[kCallLatencyP90] = summary.p90;
+    data->named_metrics[kCallLatencyP99] = summary.p99;
+  });
+  GRPC_TRACE_LOG(backend_metric, INFO)
+      << "[" << this << "] Call latency percentiles refreshed: p50:"
+      << summary.p50 << " p90:" << summary.p90 << " p99:" << summary.p99;
+}
+
+void ServerMetricRecorder::EnableCallCpuUtilization() {
+  grpc_core::CallCpuAccounting::EnableForAllServerCalls();
+  {
+    internal::MutexLock lock(&mu_);
+    last_call_cpu_nanos_ = grpc_core::CallCpuAccounting::TotalNanos();
+    last_call_cpu_time_nanos_ = NowNanos();
+  }
+  next_call_cpu_refresh_ms_.store(NowMillis() + kCallCpuRefreshIntervalMs,
+                                  std::memory_order_relaxed);
+  call_cpu_utilization_.store(true, std::memory_order_release);
+  GRPC_TRACE_LOG(backend_metric, INFO)
+      << "[" << this << "] Call CPU utilization enabled.";
+}
+
+void ServerMetricRecorder::MaybeRefreshCallCpuUtilization() {
+  if (!call_cpu_utilization_.load(std::memory_order_acquire)) return;
+  const int64_t now = NowMillis();
+  int64_t next_refresh =
+      next_call_cpu_refresh_ms_.load(std::memory_order_relaxed);
+  if (now < next_refresh ||
+      !next_call_cpu_refresh_ms_.compare_exchange_strong(
+          next_refresh, now + kCallCpuRefreshIntervalMs,
+          std::memory_order_relaxed)) {
+    return;
+  }
+  const int64_t cpu_nanos = grpc_core::CallCpuAccounting::TotalNanos();
+  const int64_t time_nanos = NowNanos();
+  double utilization = -1;
+  {
+    internal::MutexLock lock(&mu_);
+    const int64_t elapsed = time_nanos - last_call_cpu_time_nanos_;
+    if (elapsed > 0) {
+      utilization = static_cast<double>(cpu_nanos - last_call_cpu_nanos_) /
+                    (static_cast<double>(elapsed) * gpr_cpu_num_cores());
+      auto new_state = std::make_shared<BackendMetricDataState>(*metric_state_);
+      new_state->data.cpu_utilization = utilization;
+      ++new_state->sequence_number;
+      metric_state_ = std::move(new_state);
+    }
+    last_call_cpu_nanos_ = cpu_nanos;
+    last_call_cpu_time_nanos_ = time_nanos;
+  }
+  GRPC_TRACE_LOG(backend_metric, INFO)
+      << "[" << this << "] CPU utilization refreshed from calls: "
+      << utilization;
+}
+
 void ServerMetricRecorder::ClearCpuUtilization() {
   UpdateBackendMetricDataState(
       [](BackendMetricData* data) { data->cpu_utilization = -1; });
@@ -325,54 +430,91 @@ experimental::CallMetricRecorder& BackendMetricState::RecordNamedMetric(
 }
 
 BackendMetricData BackendMetricState::GetBackendMetricData() {
-  // Merge metrics from the ServerMetricRecorder first since metrics recorded
-  // to CallMetricRecorder takes a higher precedence.
+  // Metrics recorded to CallMetricRecorder take precedence over the ones
+  // from the ServerMetricRecorder.
+  BackendMetricData call_data;
+  std::shared_ptr<const BackendMetricData> shared_data =
+      GetSplitBackendMetricData(&call_data);
   BackendMetricData data;
+  if (shared_data != nullptr) data = *shared_data;
+  if (call_data.cpu_utilization != -1) {
+    data.cpu_utilization = call_data.cpu_utilization;
+  }
+  if (call_data.mem_utilization != -1) {
+    data.mem_utilization = call_data.mem_utilization;
+  }
+  if (call_data.application_utilization != -1) {
+    data.application_utilization = call_data.application_utilization;
+  }
+  if (call_data.qps != -1) data.qps = call_data.qps;
+  if (call_data.eps != -1) data.eps = call_data.eps;
+  for (const auto& u : call_data.utilization) {
+    data.utilization[u.first] = u.second;
+  }
+  for (const auto& r : call_data.request_cost) {
+    data.request_cost[r.first] = r.second;
+  }
+  for (const auto& r : call_data.named_metrics) {
+    data.named_metrics[r.first] = r.second;
+  }
+  return data;
+}
+
+std::shared_ptr<const BackendMetricData>
+BackendMetricState::GetSplitBackendMetricData(BackendMetricData* call_data) {
+  std::shared_ptr<const BackendMetricData> shared_data;
   if (server_metric_recorder_ != nullptr) {
-    data = server_metric_recorder_->GetMetrics();
+    server_metric_recorder_->RecordCallLatency(
+        gpr_timespec_to_micros(
+            gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_)) /
+        GPR_US_PER_SEC);
+    server_metric_recorder_->MaybeRefreshCallCpuUtilization();
+    // The recorder replaces its state on every update, so the state is
+    // immutable and can be shared without a copy.
+    auto state = server_metric_recorder_->GetMetricsIfChanged();
+    shared_data = std::shared_ptr<const BackendMetricData>(state, &state->data);
   }
-  // Only overwrite if the value is set i.e. in the valid range.
+  // Only set the values that are in the valid range.
   const double cpu = cpu_utilization_.load(std::memory_order_relaxed);
   if (IsUtilizationWithSoftLimitsValid(cpu)) {
-    data.cpu_utilization = cpu;
+    call_data->cpu_utilization = cpu;
   }
   const double mem = mem_utilization_.load(std::memory_order_relaxed);
   if (IsUtilizationValid(mem)) {
-    data.mem_utilization = mem;
+    call_data->mem_utilization = mem;
   }
   const double app_util =
       application_utilization_.load(std::memory_order_relaxed);
   if (IsUtilizationWithSoftLimitsValid(app_util)) {
-    data.application_utilization = app_util;
+    call_data->application_utilization = app_util;
   }
   const double qps = qps_.load(std::memory_order_relaxed);
   if (IsRateValid(qps)) {
-    data.qps = qps;
+    call_data->qps = qps;
   }
   const double eps = eps_.load(std::memory_order_relaxed);
   if (IsRateValid(eps)) {
-    data.eps = eps;
+    call_data->eps = eps;
   }
   {
     internal::MutexLock lock(&mu_);
-    for (const auto& u : utilization_) {
-      data.utilization[u.first] = u.second;
-    }
-    for (const auto& r : request_cost_) {
-      data.request_cost[r.first] = r.second;
-    }
-    for (const auto& r : named_metrics_) {
-      data.named_metrics[r.first] = r.second;
-    }
+    call_data->utilization = utilization_;
+    call_data->request_cost = request_cost_;
+    call_data->named_metrics = named_metrics_;
   }
   GRPC_TRACE_LOG(backend_metric, INFO)
       << "[" << this
-      << "] Backend metric data returned: cpu:" << data.cpu_utilization
-      << " mem:" << data.mem_utilization << " qps:" << data.qps
-      << " eps:" << data.eps << " utilization size:" << data.utilization.size()
-      << " request_cost size:" << data.request_cost.size()
-      << "named_metrics size:" << data.named_metrics.size();
-  return data;
+      << "] Call backend metric data returned: cpu:"
+      << call_data->cpu_utilization << " mem:" << call_data->mem_utilization
+      << " qps:" << call_data->qps << " eps:" << call_data->eps
+      << " utilization size:" << call_data->utilization.size()
+      << " request_cost size:" << call_data->request_cost.size()
+      << " named_metrics size:" << call_data->named_metrics.size();
+  return shared_data;
+}
+
+double ServerCpuUtilizationSource::CpuUtilization() {
+  return server_metric_recorder_->GetMetricsIfChanged()->data.cpu_utilization;
 }
 
 }  // namespace grpc
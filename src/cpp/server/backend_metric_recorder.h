@@ -27,11 +27,14 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
+#include "src/core/lib/resource_quota/connection_quota.h"
 #include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/util/time_precise.h"
 
 namespace grpc {
 namespace experimental {
@@ -66,11 +69,15 @@ class BackendMetricState : public grpc_core::BackendMetricProvider,
       string_ref name, double value) override;
   experimental::CallMetricRecorder& RecordNamedMetric(string_ref name,
                                                       double value) override;
-  // This clears metrics currently recorded. Don't call twice.
+  // These are called as the call sends its trailing metadata. Call only one
+  // of them, once.
   grpc_core::BackendMetricData GetBackendMetricData() override;
+  std::shared_ptr<const grpc_core::BackendMetricData> GetSplitBackendMetricData(
+      grpc_core::BackendMetricData* call_data) override;
 
  private:
   experimental::ServerMetricRecorder* server_metric_recorder_;
+  const gpr_cycle_counter start_ = gpr_get_cycle_counter();
   std::atomic<double> cpu_utilization_{-1.0};
   std::atomic<double> mem_utilization_{-1.0};
   std::atomic<double> application_utilization_{-1.0};
@@ -82,6 +89,21 @@ class BackendMetricState : public grpc_core::BackendMetricProvider,
   std::map<absl::string_view, double> named_metrics_ ABSL_GUARDED_BY(mu_);
 };
 
+// Lets the server's listeners refuse connections based on the CPU
+// utilization recorded to `server_metric_recorder`, which must outlive this.
+class ServerCpuUtilizationSource : public grpc_core::CpuUtilizationSource {
+ public:
+  explicit ServerCpuUtilizationSource(
+      experimental::ServerMetricRecorder* server_metric_recorder)
+      : server_metric_recorder_(server_metric_recorder) {}
+
+  // Returns -1 if no CPU utilization has been recorded.
+  double CpuUtilization() override;
+
+ private:
+  experimental::ServerMetricRecorder* const server_metric_recorder_;
+};
+
 }  // namespace grpc
 
 #endif  // GRPC_SRC_CPP_SERVER_BACKEND_METRIC_RECORDER_H
@@ -0,0 +1,299 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/generic/batching_generic_service.h>
+#include <grpcpp/generic/generic_stub_callback.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/security/auth_context.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/channel_arguments.h>
+#include <grpcpp/support/status.h>
+#include <grpcpp/support/string_ref.h>
+#include <grpcpp/support/stub_options.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "src/cpp/common/batch_framing.h"
+
+namespace grpc {
+namespace experimental {
+
+namespace {
+
+// Carries the tag under which BatchingGenericService keeps the caller of a
+// batched call.
+constexpr absl::string_view kCallerTagKey = "x-batching-caller-tag";
+
+// Whether the batch stream's client metadata entry with this key is copied
+// to the calls in the batch. Reserved and transport-level keys are not.
+bool ForwardedToBatchedCalls(absl::string_view key) {
+  return !absl::StartsWith(key, ":") && !absl::StartsWith(key, "grpc-") &&
+         key != "user-agent" && key != "content-type" && key != "te" &&
+         key != kCallerTagKey;
+}
+
+}  // namespace
+
+// Serves one batch stream. Each call read from it is run as a unary call,
+// and the results are written back as the calls complete, batched while a
+// previous write is in flight.
+class BatchingGenericService::Reactor final : public ServerGenericBidiReactor {
+ public:
+  Reactor(BatchingGenericService* service,
+          GenericCallbackServerContext* context, std::string method,
+          std::shared_ptr<Channel> channel)
+      : service_(service),
+        context_(context),
+        method_(std::move(method)),
+        stub_(channel),
+        caller_tag_(service->AddCaller(context->peer(),
+                                       context->auth_context())) {
+    StartRead(&read_buffer_);
+  }
+
+  ~Reactor() override { service_->RemoveCaller(caller_tag_); }
+
+  void OnReadDone(bool ok) override {
+    std::vector<Call*> calls;
+    bool malformed = false;
+    if (ok) {
+      internal::BatchReader reader(read_buffer_);
+      while (!reader.Done()) {
+        auto call = std::make_unique<Call>();
+        if (!reader.ReadCall(&call->id, &call->request)) {
+          malformed = true;
+          break;
+        }
+        // Propagates the deadline and cancellation of the stream.
+        call->context = ClientContext::FromCallbackServerContext(*context_);
+        for (const auto& entry : context_->client_metadata()) {
+          absl::string_view key(entry.first.data(), entry.first.size());
+          if (!ForwardedToBatchedCalls(key)) continue;
+          call->context->AddMetadata(std::string(key),
+                                     std::string(entry.second.data(),
+                                                 entry.second.size()));
+        }
+        call->context->AddMetadata(std::string(kCallerTagKey),
+                                   absl::StrCat(caller_tag_));
+        calls.push_back(call.release());
+      }
+    }
+    bool read_more;
+    {
+      internal::MutexLock lock(&mu_);
+      outstanding_ += calls.size();
+      if (!ok || malformed) reads_done_ = true;
+      if (malformed) {
+        finish_status_ = Status(StatusCode::INTERNAL, "malformed batch");
+      }
+      // At the cap, the next read waits for calls to complete, which pushes
+      // back on the client through flow control.
+      read_more = !reads_done_ &&
+                  outstanding_ < service_->options_.max_outstanding_calls;
+      read_paused_ = !reads_done_ && !read_more;
+    }
+    for (Call* call : calls) {
+      stub_.UnaryCall(call->context.get(), method_, StubOptions(),
+                      &call->request, &call->response,
+                      [this, call](Status status) {
+                        OnCallDone(call, status);
+                      });
+    }
+    if (read_more) {
+      StartRead(&read_buffer_);
+      return;
+    }
+    // Paused: the call that brings outstanding_ under the cap reads again.
+    if (ok && !malformed) return;
+    Status status;
+    bool finish;
+    {
+      internal::MutexLock lock(&mu_);
+      finish = ShouldFinishLocked(&status);
+    }
+    if (finish) Finish(status);
+  }
+
+  void OnWriteDone(bool /*ok*/) override {
+    Status status;
+    bool finish;
+    {
+      internal::MutexLock lock(&mu_);
+      writing_ = false;
+      MaybeWriteLocked();
+      finish = ShouldFinishLocked(&status);
+    }
+    if (finish) Finish(status);
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  struct Call {
+    uint64_t id;
+    std::unique_ptr<ClientContext> context;
+    ByteBuffer request;
+    ByteBuffer response;
+  };
+
+  // Once another thread may finish the stream, the reactor must not be
+  // touched again, so each thread decides under the lock whether it is the
+  // one to finish it.
+  void OnCallDone(Call* call, const Status& status) {
+    Status finish_status;
+    bool finish;
+    bool resume_reading = false;
+    {
+      internal::MutexLock lock(&mu_);
+      results_.AddResult(call->id, status, call->response);
+      --outstanding_;
+      if (read_paused_ &&
+          outstanding_ < service_->options_.max_outstanding_calls) {
+        read_paused_ = false;
+        resume_reading = true;
+      }
+      MaybeWriteLocked();
+      finish = ShouldFinishLocked(&finish_status);
+    }
+    delete call;
+    if (resume_reading) StartRead(&read_buffer_);
+    if (finish) Finish(finish_status);
+  }
+
+  void MaybeWriteLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (writing_ || results_.num_entries() == 0) return;
+    write_buffer_ = results_.Finish();
+    writing_ = true;
+    StartWrite(&write_buffer_);
+  }
+
+  // Returns true, once, when the reads have ended and all the results have
+  // been written, and the caller is to finish the stream with *status.
+  bool ShouldFinishLocked(Status* status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (!reads_done_ || outstanding_ != 0 || writing_ ||
+        results_.num_entries() != 0 || finished_) {
+      return false;
+    }
+    finished_ = true;
+    *status = finish_status_;
+    return true;
+  }
+
+  BatchingGenericService* const service_;
+  GenericCallbackServerContext* const context_;
+  const std::string method_;
+  GenericStubCallback stub_;
+  const uint64_t caller_tag_;
+  ByteBuffer read_buffer_;
+  ByteBuffer write_buffer_;
+  internal::Mutex mu_;
+  internal::BatchWriter results_ ABSL_GUARDED_BY(mu_);
+  size_t outstanding_ ABSL_GUARDED_BY(mu_) = 0;
+  bool reads_done_ ABSL_GUARDED_BY(mu_) = false;
+  // Set while no read is pending because of max_outstanding_calls.
+  bool read_paused_ ABSL_GUARDED_BY(mu_) = false;
+  bool writing_ ABSL_GUARDED_BY(mu_) = false;
+  bool finished_ ABSL_GUARDED_BY(mu_) = false;
+  Status finish_status_ ABSL_GUARDED_BY(mu_);
+};
+
+BatchingGenericService::BatchingGenericService(
+    BatchingGenericServiceOptions options)
+    : options_(options) {}
+
+BatchingGenericService::~BatchingGenericService() = default;
+
+ServerGenericBidiReactor* BatchingGenericService::CreateReactor(
+    GenericCallbackServerContext* ctx) {
+  absl::string_view method = ctx->method();
+  if (!absl::ConsumeSuffix(&method, internal::kBatchMethodSuffix)) {
+    return CallbackGenericService::CreateReactor(ctx);
+  }
+  return new Reactor(this, ctx, std::string(method), InProcessChannel());
+}
+
+std::string BatchingGenericService::CallerPeer(const ServerContextBase& ctx) {
+  internal::MutexLock lock(&mu_);
+  const Caller* caller = FindCallerLocked(ctx);
+  return caller != nullptr ? caller->peer : ctx.peer();
+}
+
+std::shared_ptr<const AuthContext> BatchingGenericService::CallerAuthContext(
+    const ServerContextBase& ctx) {
+  internal::MutexLock lock(&mu_);
+  const Caller* caller = FindCallerLocked(ctx);
+  return caller != nullptr ? caller->auth_context : ctx.auth_context();
+}
+
+uint64_t BatchingGenericService::AddCaller(
+    std::string peer, std::shared_ptr<const AuthContext> auth_context) {
+  // The tags are random so that a client cannot claim another caller's
+  // identity by sending a tag of its own.
+  absl::BitGen bitgen;
+  internal::MutexLock lock(&mu_);
+  uint64_t tag;
+  do {
+    tag = absl::Uniform<uint64_t>(bitgen);
+  } while (callers_.count(tag) != 0);
+  callers_.emplace(tag, Caller{std::move(peer), std::move(auth_context)});
+  return tag;
+}
+
+void BatchingGenericService::RemoveCaller(uint64_t tag) {
+  internal::MutexLock lock(&mu_);
+  callers_.erase(tag);
+}
+
+const BatchingGenericService::Caller* BatchingGenericService::FindCallerLocked(
+    const ServerContextBase& ctx) {
+  auto it = ctx.client_metadata().find(std::string(kCallerTagKey));
+  if (it == ctx.client_metadata().end()) return nullptr;
+  uint64_t tag;
+  if (!absl::SimpleAtoi(absl::string_view(it->second.data(), it->second.size()),
+                        &tag)) {
+    return nullptr;
+  }
+  auto caller = callers_.find(tag);
+  return caller != callers_.end() ? &caller->second : nullptr;
+}
+
+std::shared_ptr<Channel> BatchingGenericService::InProcessChannel() {
+  internal::MutexLock lock(&mu_);
+  if (channel_ == nullptr) {
+    channel_ = server_->InProcessChannel(ChannelArguments());
+  }
+  return channel_;
+}
+
+}  // namespace experimental
+}  // namespace grpc
@@ -37,6 +37,9 @@ grpc::protobuf::util::Status ParseJson(const char* json_str,
                                        grpc::protobuf::Message* message) {
   grpc::protobuf::json::JsonParseOptions options;
   options.case_insensitive_enum_parsing = true;
+  // Core renders some data that has no field in the channelz proto yet, such
+  // as call latency percentiles.
+  options.ignore_unknown_fields = true;
   return grpc::protobuf::json::JsonStringToMessage(json_str, message, options);
 }
 
@@ -0,0 +1,246 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/generic/callback_generic_service.h>
+#include <grpcpp/generic/generic_proxy.h>
+#include <grpcpp/generic/generic_stub_callback.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/status.h>
+#include <grpcpp/support/string_ref.h>
+#include <grpcpp/support/stub_options.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc {
+namespace experimental {
+namespace {
+
+bool IsForwardedByDefault(string_ref key) {
+  absl::string_view k(key.data(), key.size());
+  return !k.empty() && k[0] != ':' && !absl::StartsWith(k, "grpc-") &&
+         k != "content-type" && k != "user-agent" && k != "te";
+}
+
+std::string ToString(string_ref s) { return std::string(s.data(), s.size()); }
+
+// Forwards one call. The downstream call is served by this reactor, and the
+// upstream call is made by upstream_. Each direction moves one message at a
+// time through its own buffer: a message read from one call is written to
+// the other before the next one is read.
+//
+// The upstream call has two holds, one per direction, so that it cannot be
+// done while an operation may still be started on it. The downstream call
+// is finished when the upstream call is done, which comes after both holds
+// have been released.
+class GenericProxyReactor final : public ServerGenericBidiReactor {
+ public:
+  GenericProxyReactor(GenericCallbackServerContext* context,
+                      GenericStubCallback* stub, GenericProxyOptions options)
+      : context_(context),
+        options_(std::move(options)),
+        upstream_context_(ClientContext::FromCallbackServerContext(*context)),
+        upstream_(this) {
+    if (options_.rewrite_request_metadata) {
+      options_.rewrite_request_metadata(*context_, upstream_context_.get());
+    } else {
+      for (const auto& md : context_->client_metadata()) {
+        if (IsForwardedByDefault(md.first)) {
+          upstream_context_->AddMetadata(ToString(md.first),
+                                         ToString(md.second));
+        }
+      }
+    }
+    stub->PrepareBidiStreamingCall(
+        upstream_context_.get(),
+        options_.method.empty() ? context_->method() : options_.method,
+        StubOptions(), &upstream_);
+    upstream_.AddMultipleHolds(2);
+    StartRead(&request_);
+    upstream_.StartCall();
+  }
+
+  // Downstream to upstream.
+
+  void OnReadDone(bool ok) override {
+    Forward(
+        [this, ok] {
+          if (ok) {
+            upstream_.StartWrite(&request_);
+          } else {
+            upstream_.StartWritesDone();
+          }
+        },
+        /*close=*/!ok);
+  }
+
+  void OnUpstreamWriteDone(bool ok) {
+    if (!ok) {
+      CloseForwarding();
+      return;
+    }
+    Forward([this] { StartRead(&request_); }, /*close=*/false);
+  }
+
+  // Upstream to downstream.
+
+  void OnUpstreamInitialMetadataDone(bool ok) {
+    if (!ok) {
+      EndUpstreamReads();
+      return;
+    }
+    AddResponseMetadata(options_.rewrite_initial_metadata,
+                        upstream_context_->GetServerInitialMetadata(),
+                        &ServerContextBase::AddInitialMetadata);
+    StartSendInitialMetadata();
+    upstream_.StartRead(&response_);
+  }
+
+  void OnUpstreamReadDone(bool ok) {
+    if (!ok) {
+      EndUpstreamReads();
+      return;
+    }
+    StartWrite(&response_);
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (!ok) {
+      // The client is gone.
+      upstream_context_->TryCancel();
+      EndUpstreamReads();
+      return;
+    }
+    upstream_.StartRead(&response_);
+  }
+
+  void OnUpstreamDone(const Status& status) {
+    AddResponseMetadata(options_.rewrite_trailing_metadata,
+                        upstream_context_->GetServerTrailingMetadata(),
+                        &ServerContextBase::AddTrailingMetadata);
+    Finish(status);
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  class Upstream final : public ClientBidiReactor<ByteBuffer, ByteBuffer> {
+   public:
+    explicit Upstream(GenericProxyReactor* proxy) : proxy_(proxy) {}
+
+    void OnReadInitialMetadataDone(bool ok) override {
+      proxy_->OnUpstreamInitialMetadataDone(ok);
+    }
+    void OnReadDone(bool ok) override { proxy_->OnUpstreamReadDone(ok); }
+    void OnWriteDone(bool ok) override { proxy_->OnUpstreamWriteDone(ok); }
+    void OnDone(const Status& status) override {
+      proxy_->OnUpstreamDone(status);
+    }
+
+   private:
+    GenericProxyReactor* const proxy_;
+  };
+
+  void AddResponseMetadata(
+      const GenericProxyOptions::ResponseMetadataRewriter& rewrite,
+      const std::multimap<string_ref, string_ref>& upstream_metadata,
+      void (ServerContextBase::*add)(const std::string&, const std::string&)) {
+    if (rewrite) {
+      rewrite(upstream_metadata, context_);
+      return;
+    }
+    for (const auto& md : upstream_metadata) {
+      if (IsForwardedByDefault(md.first)) {
+        (context_->*add)(ToString(md.first), ToString(md.second));
+      }
+    }
+  }
+
+  // Runs start, which starts an operation of the downstream-to-upstream
+  // direction, unless that direction has been closed. Closes it afterwards
+  // if close is true. The hold of the direction is not released while an
+  // operation is being started.
+  template <typename F>
+  void Forward(F start, bool close) {
+    {
+      internal::MutexLock lock(&mu_);
+      if (forwarding_closed_) return;
+      starting_ = true;
+    }
+    start();
+    {
+      internal::MutexLock lock(&mu_);
+      starting_ = false;
+      if (!close && !close_pending_) return;
+      forwarding_closed_ = true;
+    }
+    upstream_.RemoveHold();
+  }
+
+  // Closes the downstream-to-upstream direction, once no operation of it is
+  // being started.
+  void CloseForwarding() {
+    {
+      internal::MutexLock lock(&mu_);
+      if (forwarding_closed_) return;
+      if (starting_) {
+        close_pending_ = true;
+        return;
+      }
+      forwarding_closed_ = true;
+    }
+    upstream_.RemoveHold();
+  }
+
+  // The upstream call has no more messages, so nothing more is sent to it
+  // either.
+  void EndUpstreamReads() {
+    CloseForwarding();
+    upstream_.RemoveHold();
+  }
+
+  GenericCallbackServerContext* const context_;
+  const GenericProxyOptions options_;
+  std::unique_ptr<ClientContext> upstream_context_;
+  Upstream upstream_;
+  ByteBuffer request_;
+  ByteBuffer response_;
+  internal::Mutex mu_;
+  bool starting_ ABSL_GUARDED_BY(mu_) = false;
+  bool close_pending_ ABSL_GUARDED_BY(mu_) = false;
+  bool forwarding_closed_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+}  // namespace
+
+ServerGenericBidiReactor* NewGenericProxyReactor(
+    GenericCallbackServerContext* context, GenericStubCallback* stub,
+    GenericProxyOptions options) {
+  return new GenericProxyReactor(context, stub, std::move(options));
+}
+
+}  // namespace experimental
+}  // namespace grpc
@@ -26,6 +26,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
@@ -224,22 +225,33 @@ bool DefaultHealthCheckService::HealthCheckServiceImpl::DecodeRequest(
 
 bool DefaultHealthCheckService::HealthCheckServiceImpl::EncodeResponse(
     ServingStatus status, ByteBuffer* response) {
-  upb::Arena arena;
-  grpc_health_v1_HealthCheckResponse* response_struct =
-      grpc_health_v1_HealthCheckResponse_new(arena.ptr());
-  grpc_health_v1_HealthCheckResponse_set_status(
-      response_struct,
-      status == NOT_FOUND ? grpc_health_v1_HealthCheckResponse_SERVICE_UNKNOWN
-      : status == SERVING ? grpc_health_v1_HealthCheckResponse_SERVING
-                          : grpc_health_v1_HealthCheckResponse_NOT_SERVING);
-  size_t buf_length;
-  char* buf = grpc_health_v1_HealthCheckResponse_serialize(
-      response_struct, arena.ptr(), &buf_length);
-  if (buf == nullptr) {
+  // There are only three possible responses, so each is serialized once and
+  // then sent from static storage by every Check() and Watch() call.
+  static const std::string* const kEncodedResponses = [] {
+    auto* encoded = new std::string[3];
+    // Indexed by ServingStatus.
+    const grpc_health_v1_HealthCheckResponse_ServingStatus statuses[] = {
+        grpc_health_v1_HealthCheckResponse_SERVICE_UNKNOWN,
+        grpc_health_v1_HealthCheckResponse_SERVING,
+        grpc_health_v1_HealthCheckResponse_NOT_SERVING};
+    for (int i = 0; i < 3; ++i) {
+      upb::Arena arena;
+      grpc_health_v1_HealthCheckResponse* response_struct =
+          grpc_health_v1_HealthCheckResponse_new(arena.ptr());
+      grpc_health_v1_HealthCheckResponse_set_status(response_struct,
+                                                    statuses[i]);
+      size_t buf_length;
+      char* buf = grpc_health_v1_HealthCheckResponse_serialize(
+          response_struct, arena.ptr(), &buf_length);
+      if (buf != nullptr) encoded[i].assign(buf, buf_length);
+    }
+    return encoded;
+  }();
+  const std::string& encoded = kEncodedResponses[status];
+  if (encoded.empty()) {
     return false;
   }
-  grpc_slice response_slice = grpc_slice_from_copied_buffer(buf, buf_length);
-  Slice encoded_response(response_slice, Slice::STEAL_REF);
+  Slice encoded_response(encoded.data(), encoded.size(), Slice::STATIC_SLICE);
   ByteBuffer response_buffer(&encoded_response, 1);
   response->Swap(&response_buffer);
   return true;
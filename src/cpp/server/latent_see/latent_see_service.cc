@@ -0,0 +1,53 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/cpp/server/latent_see/latent_see_service.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/time/time.h"
+#include "src/core/util/latent_see.h"
+
+namespace grpc {
+namespace experimental {
+
+Status LatentSeeService::GetTrace(
+    ServerContext* /*context*/, const latent_see::v1::GetTraceRequest* request,
+    latent_see::v1::GetTraceResponse* response) {
+#ifdef GRPC_LATENT_SEE_FLIGHT_RECORDER
+  absl::Duration lookback = absl::InfiniteDuration();
+  if (request->has_lookback()) {
+    lookback = absl::Seconds(request->lookback().seconds()) +
+               absl::Nanoseconds(request->lookback().nanos());
+    if (lookback < absl::ZeroDuration()) {
+      return Status(StatusCode::INVALID_ARGUMENT, "lookback is negative");
+    }
+  }
+  response->set_trace_json(
+      grpc_core::latent_see::FlightRecorder::SnapshotJson(lookback));
+  return Status::OK;
+#else
+  (void)request;
+  (void)response;
+  return Status(StatusCode::UNIMPLEMENTED,
+                "Not built with GRPC_LATENT_SEE_FLIGHT_RECORDER");
+#endif
+}
+
+}  // namespace experimental
+}  // namespace grpc
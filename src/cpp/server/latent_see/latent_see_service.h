@@ -0,0 +1,43 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CPP_SERVER_LATENT_SEE_LATENT_SEE_SERVICE_H
+#define GRPC_SRC_CPP_SERVER_LATENT_SEE_LATENT_SEE_SERVICE_H
+
+#include <grpc/support/port_platform.h>
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/support/status.h>
+
+#include "src/proto/grpc/latent_see/v1/latent_see.grpc.pb.h"
+
+namespace grpc {
+namespace experimental {
+
+// Dumps the latent_see flight recorder of this process.
+class LatentSeeService final : public latent_see::v1::LatentSee::Service {
+ public:
+  // implementation of GetTrace rpc
+  Status GetTrace(ServerContext* /*context*/,
+                  const latent_see::v1::GetTraceRequest* request,
+                  latent_see::v1::GetTraceResponse* response) override;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPC_SRC_CPP_SERVER_LATENT_SEE_LATENT_SEE_SERVICE_H
@@ -29,7 +29,10 @@
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 #include <stddef.h>
+#include <stdint.h>
 
+#include <chrono>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <optional>
@@ -54,6 +57,50 @@
 namespace grpc {
 namespace experimental {
 
+namespace {
+
+bool ValueChanged(double old_value, double new_value, double threshold) {
+  return std::abs(new_value - old_value) > threshold * std::abs(old_value);
+}
+
+// Unset values are -1.
+bool OptionalValueChanged(double old_value, double new_value,
+                          double threshold) {
+  if (old_value == -1 || new_value == -1) return old_value != new_value;
+  return ValueChanged(old_value, new_value, threshold);
+}
+
+bool MapChanged(const std::map<absl::string_view, double>& old_map,
+                const std::map<absl::string_view, double>& new_map,
+                double threshold) {
+  if (old_map.size() != new_map.size()) return true;
+  for (auto old_it = old_map.begin(), new_it = new_map.begin();
+       old_it != old_map.end(); ++old_it, ++new_it) {
+    if (old_it->first != new_it->first ||
+        ValueChanged(old_it->second, new_it->second, threshold)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MetricsChanged(const grpc_core::BackendMetricData& old_data,
+                    const grpc_core::BackendMetricData& new_data,
+                    double threshold) {
+  return OptionalValueChanged(old_data.cpu_utilization,
+                              new_data.cpu_utilization, threshold) ||
+         OptionalValueChanged(old_data.mem_utilization,
+                              new_data.mem_utilization, threshold) ||
+         OptionalValueChanged(old_data.application_utilization,
+                              new_data.application_utilization, threshold) ||
+         OptionalValueChanged(old_data.qps, new_data.qps, threshold) ||
+         OptionalValueChanged(old_data.eps, new_data.eps, threshold) ||
+         MapChanged(old_data.utilization, new_data.utilization, threshold) ||
+         MapChanged(old_data.named_metrics, new_data.named_metrics, threshold);
+}
+
+}  // namespace
+
 //
 // OrcaService::Reactor
 //
@@ -98,7 +145,9 @@ OrcaService::Reactor::Reactor(OrcaService* service, absl::string_view peer,
       service_->min_report_duration_ / absl::Milliseconds(1));
   report_interval_ = std::max(report_interval, min_interval);
   // Send initial response.
-  SendResponse();
+  uint64_t generation;
+  Slice response_slice = service_->GetOrCreateSerializedResponse(&generation);
+  SendResponse(std::move(response_slice), generation);
 }
 
 void OrcaService::Reactor::OnWriteDone(bool ok) {
@@ -130,8 +179,10 @@ void OrcaService::Reactor::FinishRpc(grpc::Status status) {
   Finish(status);
 }
 
-void OrcaService::Reactor::SendResponse() {
-  Slice response_slice = service_->GetOrCreateSerializedResponse();
+void OrcaService::Reactor::SendResponse(Slice response_slice,
+                                        uint64_t generation) {
+  reported_generation_ = generation;
+  last_report_time_ = std::chrono::steady_clock::now();
   ByteBuffer response_buffer(&response_slice, 1);
   response_.Swap(&response_buffer);
   if (hook_ != nullptr) {
@@ -140,13 +191,24 @@ void OrcaService::Reactor::SendResponse() {
   StartWrite(&response_);
 }
 
+bool OrcaService::Reactor::ReportDue(uint64_t generation) const {
+  return !service_->change_threshold_.has_value() ||
+         generation != reported_generation_ ||
+         std::chrono::steady_clock::now() - last_report_time_ >=
+             absl::ToChronoNanoseconds(service_->max_report_duration_);
+}
+
 bool OrcaService::Reactor::MaybeScheduleTimer() {
   grpc::internal::MutexLock lock(&timer_mu_);
   if (cancelled_) return false;
+  ScheduleTimerLocked();
+  return true;
+}
+
+void OrcaService::Reactor::ScheduleTimerLocked() {
   timer_handle_ = engine_->RunAfter(
       report_interval_,
       [self = Ref(DEBUG_LOCATION, "Orca Service")] { self->OnTimer(); });
-  return true;
 }
 
 bool OrcaService::Reactor::MaybeCancelTimer() {
@@ -161,9 +223,22 @@ bool OrcaService::Reactor::MaybeCancelTimer() {
 
 void OrcaService::Reactor::OnTimer() {
   grpc_core::ExecCtx exec_ctx;
-  grpc::internal::MutexLock lock(&timer_mu_);
-  timer_handle_.reset();
-  SendResponse();
+  uint64_t generation;
+  Slice response_slice = service_->GetOrCreateSerializedResponse(&generation);
+  {
+    grpc::internal::MutexLock lock(&timer_mu_);
+    timer_handle_.reset();
+    if (ReportDue(generation)) {
+      SendResponse(std::move(response_slice), generation);
+      return;
+    }
+    // Nothing worth reporting yet: check again after another interval.
+    if (!cancelled_) {
+      ScheduleTimerLocked();
+      return;
+    }
+  }
+  FinishRpc(Status(StatusCode::UNKNOWN, "call cancelled by client"));
 }
 
 //
@@ -173,7 +248,9 @@ void OrcaService::Reactor::OnTimer() {
 OrcaService::OrcaService(ServerMetricRecorder* const server_metric_recorder,
                          Options options)
     : server_metric_recorder_(server_metric_recorder),
-      min_report_duration_(options.min_report_duration) {
+      min_report_duration_(options.min_report_duration),
+      change_threshold_(options.change_threshold),
+      max_report_duration_(options.max_report_duration) {
   CHECK_NE(server_metric_recorder_, nullptr);
   AddMethod(new internal::RpcServiceMethod(
       "/xds.service.orca.v3.OpenRcaService/StreamCoreMetrics",
@@ -185,7 +262,7 @@ OrcaService::OrcaService(ServerMetricRecorder* const server_metric_recorder,
              }));
 }
 
-Slice OrcaService::GetOrCreateSerializedResponse() {
+Slice OrcaService::GetOrCreateSerializedResponse(uint64_t* generation) {
   grpc::internal::MutexLock lock(&mu_);
   std::shared_ptr<const ServerMetricRecorder::BackendMetricDataState> result =
       server_metric_recorder_->GetMetricsIfChanged();
@@ -219,12 +296,27 @@ Slice OrcaService::GetOrCreateSerializedResponse() {
           upb_StringView_FromDataAndSize(u.first.data(), u.first.size()),
           u.second, arena.ptr());
     }
+    for (const auto& m : data.named_metrics) {
+      xds_data_orca_v3_OrcaLoadReport_named_metrics_set(
+          response,
+          upb_StringView_FromDataAndSize(m.first.data(), m.first.size()),
+          m.second, arena.ptr());
+    }
     size_t buf_length;
     char* buf = xds_data_orca_v3_OrcaLoadReport_serialize(response, arena.ptr(),
                                                           &buf_length);
     response_slice_.emplace(buf, buf_length);
     response_slice_seq_ = result->sequence_number;
+    if (!change_threshold_.has_value()) {
+      ++generation_;
+    } else if (significant_state_ == nullptr ||
+               MetricsChanged(significant_state_->data, data,
+                              *change_threshold_)) {
+      significant_state_ = std::move(result);
+      ++generation_;
+    }
   }
+  *generation = generation_;
   return Slice(*response_slice_);
 }
 
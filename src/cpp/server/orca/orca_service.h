@@ -25,6 +25,8 @@
 #include <grpcpp/support/status.h>
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <optional>
 
@@ -52,10 +54,15 @@ class OrcaService::Reactor
  private:
   void FinishRpc(grpc::Status status);
 
-  void SendResponse();
+  void SendResponse(Slice response_slice, uint64_t generation);
+
+  // Whether the metrics of the given generation should be sent now.
+  bool ReportDue(uint64_t generation) const;
 
   bool MaybeScheduleTimer();
 
+  void ScheduleTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&timer_mu_);
+
   bool MaybeCancelTimer();
 
   void OnTimer();
@@ -68,6 +75,9 @@ class OrcaService::Reactor
   bool cancelled_ ABSL_GUARDED_BY(&timer_mu_) = false;
 
   grpc_event_engine::experimental::EventEngine::Duration report_interval_;
+  // The generation and time of the last report sent.
+  uint64_t reported_generation_ = 0;
+  std::chrono::steady_clock::time_point last_report_time_;
   ByteBuffer response_;
   std::shared_ptr<ReactorHook> hook_;
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
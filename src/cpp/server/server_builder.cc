@@ -47,6 +47,7 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/ext/transport/chttp2/server/chttp2_server.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/server/server.h"
 #include "src/core/util/string.h"
 #include "src/core/util/useful.h"
@@ -211,6 +212,9 @@ ServerBuilder& ServerBuilder::SetSyncServerOption(
     case CQ_TIMEOUT_MSEC:
       sync_server_settings_.cq_timeout_msec = val;
       break;
+    case MAX_QUEUE_TIME_MSEC:
+      sync_server_settings_.max_queue_time_msec = val;
+      break;
   }
   return *this;
 }
@@ -317,6 +321,17 @@ ChannelArguments ServerBuilder::BuildChannelArgs() {
 std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
   ChannelArguments args = BuildChannelArgs();
 
+  // Both order the handlers of new calls, each in its own way.
+  const grpc_channel_args c_args = args.c_channel_args();
+  if (grpc_channel_args_find_bool(
+          &c_args, GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING, false) &&
+      grpc_channel_args_find_bool(
+          &c_args, GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH, false)) {
+    LOG(ERROR) << "GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING cannot be combined "
+                  "with GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH";
+    return nullptr;
+  }
+
   // == Determine if the server has any syncrhonous methods ==
   bool has_sync_methods = false;
   for (const auto& value : services_) {
@@ -390,7 +405,13 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     VLOG(2) << "Synchronous server. Num CQs: " << sync_server_settings_.num_cqs
             << ", Min pollers: " << sync_server_settings_.min_pollers
             << ", Max Pollers: " << sync_server_settings_.max_pollers
-            << ", CQ timeout (msec): " << sync_server_settings_.cq_timeout_msec;
+            << ", CQ timeout (msec): " << sync_server_settings_.cq_timeout_msec
+            << ", Max queue time (msec): "
+            << sync_server_settings_.max_queue_time_msec;
+    if (sync_server_settings_.max_queue_time_msec > 0) {
+      args.SetInt(GRPC_ARG_SYNC_SERVER_MAX_QUEUE_TIME_MS,
+                  sync_server_settings_.max_queue_time_msec);
+    }
   }
 
   if (has_callback_methods) {
@@ -21,7 +21,7 @@ namespace grpc {
 namespace internal {
 
 void ServerCallbackCall::ScheduleOnDone(bool inline_ondone) {
-  if (inline_ondone) {
+  if (inline_ondone || inline_reactions_) {
     CallOnDone();
     return;
   }
@@ -29,7 +29,7 @@ void ServerCallbackCall::ScheduleOnDone(bool inline_ondone) {
 }
 
 void ServerCallbackCall::CallOnCancel(ServerReactor* reactor) {
-  if (reactor->InternalInlineable()) {
+  if (inline_reactions_ || reactor->InternalInlineable()) {
     reactor->OnCancel();
     return;
   }
@@ -16,9 +16,12 @@
 //
 
 #include <grpc/byte_buffer.h>
+#include <grpc/byte_buffer_reader.h>
 #include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 #include <grpcpp/channel.h>
@@ -30,6 +33,7 @@
 #include <grpcpp/impl/call_op_set_interface.h>
 #include <grpcpp/impl/completion_queue_tag.h>
 #include <grpcpp/impl/interceptor_common.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/impl/metadata_map.h>
 #include <grpcpp/impl/rpc_method.h>
 #include <grpcpp/impl/rpc_service_method.h>
@@ -63,17 +67,33 @@
 #include <utility>
 #include <vector>
 
+#include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/resource_quota/api.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/server/server.h"
+#include "src/core/server/tenant_scheduler.h"
+#include "src/core/telemetry/call_cpu_accounting.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/util/manual_constructor.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
 #include "src/cpp/client/create_channel_internal.h"
+#include "src/cpp/server/backend_metric_recorder.h"
 #include "src/cpp/server/external_connection_acceptor_impl.h"
 #include "src/cpp/server/health/default_health_check_service.h"
 #include "src/cpp/thread_manager/thread_manager.h"
@@ -127,6 +147,56 @@ class PhonyTag : public internal::CompletionQueueTag {
   }
 };
 
+// Keeps the memory of freed objects of one size for reuse, so that a server
+// taking calls at a steady rate does not go to the heap for every call. The
+// free objects are sharded by CPU, so that threads taking calls in parallel
+// don't all contend on one lock.
+class FreeList {
+ public:
+  explicit FreeList(size_t size) : size_(size) {
+    for (Shard& shard : shards_) shard.free.reserve(kMaxFreePerShard);
+  }
+
+  void* Get(size_t size) {
+    CHECK_EQ(size, size_);
+    Shard& shard = shards_.this_cpu();
+    {
+      grpc::internal::MutexLock lock(&shard.mu);
+      if (!shard.free.empty()) {
+        void* p = shard.free.back();
+        shard.free.pop_back();
+        return p;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  void Put(void* p) {
+    Shard& shard = shards_.this_cpu();
+    {
+      grpc::internal::MutexLock lock(&shard.mu);
+      if (shard.free.size() < kMaxFreePerShard) {
+        shard.free.push_back(p);
+        return;
+      }
+    }
+    ::operator delete(p);
+  }
+
+ private:
+  // Bounds the memory kept after a burst of calls has finished.
+  static constexpr size_t kMaxFreePerShard = 128;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    grpc::internal::Mutex mu;
+    std::vector<void*> free ABSL_GUARDED_BY(mu);
+  };
+
+  const size_t size_;
+  grpc_core::PerCpu<Shard> shards_{
+      grpc_core::PerCpuOptions().SetCpusPerShard(2).SetMaxShards(16)};
+};
+
 class UnimplementedAsyncRequestContext {
  protected:
   UnimplementedAsyncRequestContext() : generic_stream_(&server_context_) {}
@@ -135,6 +205,29 @@ class UnimplementedAsyncRequestContext {
   GenericServerAsyncReaderWriter generic_stream_;
 };
 
+// Returns the CPU accounting of `call`, or nullptr if it does not do CPU
+// accounting.
+grpc_core::CallCpuAccounting* CallCpuAccountingOf(grpc_call* call) {
+  return grpc_call_get_arena(call)->GetContext<grpc_core::CallCpuAccounting>();
+}
+
+const auto kMetricServerCallDispatchQueueTime =
+    grpc_core::GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.dispatch_queue_time",
+        "EXPERIMENTAL.  Time a callback call waited to be dispatched in "
+        "deadline order, including calls failed because their deadline "
+        "passed.",
+        "s", false)
+        .Build();
+
+const auto kMetricServerCallDispatchDeadlineExceeded =
+    grpc_core::GlobalInstrumentsRegistry::RegisterUInt64Counter(
+        "grpc.server.call.dispatch_deadline_exceeded",
+        "EXPERIMENTAL.  Number of callback calls failed without running their "
+        "handler because their deadline passed while they were queued.",
+        "{call}", false)
+        .Build();
+
 }  // namespace
 
 ServerInterface::BaseAsyncRequest::BaseAsyncRequest(
@@ -415,6 +508,15 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     return true;
   }
 
+  // Whether the call arrived at the server more than max_msec ago.  Only
+  // valid once core has handed the call over.
+  bool QueuedLongerThan(int max_msec) const {
+    gpr_timespec waited = gpr_cycle_counter_sub(
+        gpr_get_cycle_counter(), grpc_core::Call::FromC(call_)->start_time());
+    return gpr_time_cmp(waited, gpr_time_from_millis(max_msec,
+                                                     GPR_TIMESPAN)) > 0;
+  }
+
   void Run(const std::shared_ptr<GlobalCallbacks>& global_callbacks,
            bool resources) {
     ctx_.Init(deadline_, &request_metadata_);
@@ -422,6 +524,9 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
         call_, server_, &cq_, server_->max_receive_message_size(),
         ctx_->ctx.set_server_rpc_info(method_->name(), method_->method_type(),
                                       server_->interceptor_creators_));
+    wrapped_call_->set_pass_message_objects(
+        has_request_payload_ && request_payload_ != nullptr &&
+        grpc::internal::IsMessageObject(request_payload_));
     ctx_->ctx.set_call(call_, server_->call_metric_recording_enabled(),
                        server_->server_metric_recorder());
     ctx_->ctx.cq_ = &cq_;
@@ -466,9 +571,14 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     global_callbacks_->PreSynchronousRequest(&ctx_->ctx);
     auto* handler = resources_ ? method_->handler()
                                : server_->resource_exhausted_handler_.get();
-    handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
-        &*wrapped_call_, &ctx_->ctx, deserialized_request_, request_status_,
-        nullptr, nullptr));
+    {
+      grpc_core::CallCpuAccounting::Scope cpu_scope(
+          CallCpuAccountingOf(call_),
+          grpc_core::CallCpuAccounting::Phase::kHandler);
+      handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
+          &*wrapped_call_, &ctx_->ctx, deserialized_request_, request_status_,
+          nullptr, nullptr));
+    }
     global_callbacks_->PostSynchronousRequest(&ctx_->ctx);
 
     cq_.Shutdown();
@@ -542,6 +652,153 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   grpc_core::ManualConstructor<internal::Call> wrapped_call_;
 };
 
+// Each queued call schedules one run on the EventEngine, and each run takes
+// whichever queued call has the earliest deadline at that time. So the
+// EventEngine's thread pool still bounds the concurrency, but under overload
+// the calls closest to their deadlines go first, and the calls that can no
+// longer succeed are shed without running their handlers.
+class Server::CallbackDispatchQueue {
+ public:
+  // Called with true if the call's deadline passed while it was queued.
+  using Dispatch = absl::AnyInvocable<void(bool deadline_exceeded)>;
+
+  // Runs on the server's EventEngine.
+  explicit CallbackDispatchQueue(const grpc_core::ChannelArgs& args)
+      : engine_(args.GetObjectRef<
+                grpc_event_engine::experimental::EventEngine>()),
+        stats_plugin_group_(
+            grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForServer(
+                args)) {}
+
+  void Add(gpr_timespec deadline, Dispatch dispatch) {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      queue_.push_back(
+          Entry{grpc_core::Timestamp::FromTimespecRoundUp(deadline),
+                next_sequence_++, grpc_core::Timestamp::Now(),
+                std::move(dispatch)});
+      std::push_heap(queue_.begin(), queue_.end(), Later());
+    }
+    engine_->Run([this] { RunEarliest(); });
+  }
+
+ private:
+  struct Entry {
+    grpc_core::Timestamp deadline;
+    // Calls with equal deadlines, such as those without one, run in the
+    // order they arrived.
+    uint64_t sequence;
+    grpc_core::Timestamp queued_at;
+    Dispatch dispatch;
+  };
+
+  struct Later {
+    bool operator()(const Entry& a, const Entry& b) const {
+      if (a.deadline != b.deadline) return a.deadline > b.deadline;
+      return a.sequence > b.sequence;
+    }
+  };
+
+  // There is always an entry to run, since each entry schedules one run. The
+  // entry holds a ref to the server, which keeps this queue alive.
+  void RunEarliest() {
+    grpc_core::ExecCtx exec_ctx;
+    Entry entry;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      CHECK(!queue_.empty());
+      std::pop_heap(queue_.begin(), queue_.end(), Later());
+      entry = std::move(queue_.back());
+      queue_.pop_back();
+    }
+    const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+    const bool deadline_exceeded = entry.deadline < now;
+    stats_plugin_group_.RecordHistogram(kMetricServerCallDispatchQueueTime,
+                                        (now - entry.queued_at).seconds(), {},
+                                        {});
+    if (deadline_exceeded) {
+      stats_plugin_group_.AddCounter(kMetricServerCallDispatchDeadlineExceeded,
+                                     1, {}, {});
+    }
+    entry.dispatch(deadline_exceeded);
+  }
+
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
+  grpc_core::GlobalStatsPluginRegistry::StatsPluginGroup stats_plugin_group_;
+  grpc_core::Mutex mu_;
+  // A min-heap on (deadline, sequence).
+  std::vector<Entry> queue_ ABSL_GUARDED_BY(mu_);
+  uint64_t next_sequence_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+// Callback calls are started on the EventEngine through the scheduler, which
+// picks the call to start from the tenant that has used the least of its
+// share of the CPU. Sync calls are not scheduled: their handlers may block,
+// and one blocked while holding a slot of the scheduler would keep the calls
+// queued behind it from starting for as long as it likes. The sync server's
+// thread pool bounds them instead.
+class Server::TenantDispatcher {
+ public:
+  explicit TenantDispatcher(const grpc_core::ChannelArgs& args)
+      : metadata_key_(args.GetOwnedString(GRPC_ARG_SERVER_TENANT_METADATA_KEY)
+                          .value_or("")),
+        engine_(grpc_event_engine::experimental::GetDefaultEventEngine()),
+        scheduler_(std::make_shared<grpc_core::TenantScheduler>(
+            args.GetInt(GRPC_ARG_SERVER_TENANT_MAX_CONCURRENCY)
+                .value_or(gpr_cpu_num_cores()))) {}
+
+  // Queues a callback call, to be started on the EventEngine.
+  void DispatchCallback(grpc_call* call, const grpc_metadata_array& metadata,
+                        absl::AnyInvocable<void()> dispatch) {
+    scheduler_->Add(TenantOf(call, metadata), std::move(dispatch));
+    // Starting a call may drop the last ref to the server, and so this, but
+    // the scheduler is still used once it returns.
+    engine_->Run([scheduler = scheduler_] {
+      grpc_core::ExecCtx exec_ctx;
+      scheduler->RunNext();
+    });
+  }
+
+  grpc_core::TenantScheduler* scheduler() const { return scheduler_.get(); }
+
+ private:
+  std::string TenantOf(grpc_call* call,
+                       const grpc_metadata_array& metadata) const {
+    std::string identity = PeerIdentity(call);
+    if (metadata_key_.empty()) return identity;
+    for (size_t i = 0; i < metadata.count; ++i) {
+      if (grpc_core::StringViewFromSlice(metadata.metadata[i].key) ==
+          metadata_key_) {
+        absl::string_view value =
+            grpc_core::StringViewFromSlice(metadata.metadata[i].value);
+        // The client picks the value, so it only chooses among the tenants of
+        // its own identity, and cannot spend another client's share.
+        if (identity.empty()) return std::string(value);
+        return absl::StrCat(identity, "/", value);
+      }
+    }
+    return identity;
+  }
+
+  static std::string PeerIdentity(grpc_call* call) {
+    grpc_auth_context* auth_context = grpc_call_auth_context(call);
+    if (auth_context == nullptr) return "";
+    std::string tenant;
+    grpc_auth_property_iterator it =
+        grpc_auth_context_peer_identity(auth_context);
+    const grpc_auth_property* property = grpc_auth_property_iterator_next(&it);
+    if (property != nullptr) {
+      tenant.assign(property->value, property->value_length);
+    }
+    grpc_auth_context_release(auth_context);
+    return tenant;
+  }
+
+  const std::string metadata_key_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
+  const std::shared_ptr<grpc_core::TenantScheduler> scheduler_;
+};
+
 template <class ServerContextType>
 class Server::CallbackRequest final
     : public grpc::internal::CompletionQueueTag {
@@ -579,7 +836,6 @@ class Server::CallbackRequest final
       : server_(server),
         method_(nullptr),
         has_request_payload_(false),
-        call_details_(new grpc_call_details),
         cq_(cq),
         tag_(this),
         ctx_(server_->context_allocator() != nullptr
@@ -587,12 +843,16 @@ class Server::CallbackRequest final
                        ->NewGenericCallbackServerContext()
                  : nullptr) {
     CommonSetup(server, data);
-    grpc_call_details_init(call_details_);
-    data->details = call_details_;
+    grpc_call_details_init(&call_details_);
+    data->details = &call_details_;
   }
 
+  // A CallbackRequest, which holds the ServerContext, is allocated for every
+  // call and freed once the call is done, so its memory is recycled.
+  static void* operator new(std::size_t size) { return Pool()->Get(size); }
+  static void operator delete(void* p) { Pool()->Put(p); }
+
   ~CallbackRequest() override {
-    delete call_details_;
     grpc_metadata_array_destroy(&request_metadata_);
     if (has_request_payload_ && request_payload_) {
       grpc_byte_buffer_destroy(request_payload_);
@@ -608,6 +868,11 @@ class Server::CallbackRequest final
   bool FinalizeResult(void** tag, bool* status) override;
 
  private:
+  static FreeList* Pool() {
+    static FreeList* pool = new FreeList(sizeof(CallbackRequest));
+    return pool;
+  }
+
   // method_name needs to be specialized between named method and generic
   const char* method_name() const;
 
@@ -650,6 +915,39 @@ class Server::CallbackRequest final
         return;
       }
 
+      if (req_->server_->tenant_dispatcher_ != nullptr) {
+        req_->server_->tenant_dispatcher_->DispatchCallback(
+            req_->call_, req_->request_metadata_, [this] { Dispatch(); });
+        return;
+      }
+      if (req_->server_->callback_dispatch_queue_ != nullptr) {
+        req_->server_->callback_dispatch_queue_->Add(
+            req_->deadline_, [this](bool deadline_exceeded) {
+              if (deadline_exceeded) {
+                FailDeadlineExceeded();
+              } else {
+                Dispatch();
+              }
+            });
+        return;
+      }
+      Dispatch();
+    }
+
+    // Fails a call whose deadline passed while it was queued, without
+    // running its handler.
+    void FailDeadlineExceeded() {
+      grpc_call_cancel_with_status(req_->call_, GRPC_STATUS_DEADLINE_EXCEEDED,
+                                   "Deadline Exceeded while queued", nullptr);
+      grpc_call_unref(req_->call_);
+      if (!req_->ctx_alloc_by_default_ &&
+          req_->server_->context_allocator() != nullptr) {
+        req_->server_->context_allocator()->Release(req_->ctx_);
+      }
+      delete req_;
+    }
+
+    void Dispatch() {
       // Bind the call, deadline, and metadata from what we got
       req_->ctx_->set_call(req_->call_,
                            req_->server_->call_metric_recording_enabled(),
@@ -671,6 +969,9 @@ class Server::CallbackRequest final
                           ? req_->method_->method_type()
                           : grpc::internal::RpcMethod::BIDI_STREAMING,
                       req_->server_->interceptor_creators_));
+      call_->set_pass_message_objects(
+          req_->has_request_payload_ && req_->request_payload_ != nullptr &&
+          grpc::internal::IsMessageObject(req_->request_payload_));
 
       req_->interceptor_methods_.SetCall(call_);
       req_->interceptor_methods_.SetReverse();
@@ -682,6 +983,24 @@ class Server::CallbackRequest final
           &req_->ctx_->client_metadata_);
 
       if (req_->has_request_payload_) {
+        if (req_->method_->coalesced() && req_->request_payload_ != nullptr) {
+          // Take the key before interceptors get a chance to see the request.
+          // The key is made of the serialized bytes.
+          grpc_byte_buffer_reader reader;
+          if (grpc::internal::MaterializeMessageObject(req_->request_payload_)
+                  .ok() &&
+              grpc_byte_buffer_reader_init(&reader, req_->request_payload_)) {
+            grpc_slice slice;
+            while (grpc_byte_buffer_reader_next(&reader, &slice)) {
+              req_->coalescing_key_.append(
+                  reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(slice)),
+                  GRPC_SLICE_LENGTH(slice));
+              grpc_slice_unref(slice);
+            }
+            grpc_byte_buffer_reader_destroy(&reader);
+            req_->has_coalescing_key_ = true;
+          }
+        }
         // Set interception point for RECV MESSAGE
         req_->request_ = req_->method_->handler()->Deserialize(
             req_->call_, req_->request_payload_, &req_->request_status_,
@@ -707,9 +1026,21 @@ class Server::CallbackRequest final
       auto* handler = (req_->method_ != nullptr)
                           ? req_->method_->handler()
                           : req_->server_->generic_handler_.get();
-      handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
-          call_, req_->ctx_, req_->request_, req_->request_status_,
-          req_->handler_data_, [this] { delete req_; }));
+      // The handler may finish the call, and delete this, before it returns,
+      // so hold a ref to the call until the CPU accounting scope ends.
+      grpc_call* call = call_->call();
+      grpc_core::CallCpuAccounting* cpu_accounting = CallCpuAccountingOf(call);
+      if (cpu_accounting != nullptr) grpc_call_ref(call);
+      {
+        grpc_core::CallCpuAccounting::Scope cpu_scope(
+            cpu_accounting, grpc_core::CallCpuAccounting::Phase::kHandler);
+        handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
+            call_, req_->ctx_, req_->request_, req_->request_status_,
+            req_->handler_data_, [this] { delete req_; },
+            req_->method_ != nullptr && req_->method_->non_blocking(),
+            req_->has_coalescing_key_ ? &req_->coalescing_key_ : nullptr));
+      }
+      if (cpu_accounting != nullptr) grpc_call_unref(call);
     }
   };
 
@@ -736,7 +1067,12 @@ class Server::CallbackRequest final
   void* request_ = nullptr;
   void* handler_data_ = nullptr;
   grpc::Status request_status_;
-  grpc_call_details* const call_details_ = nullptr;
+  // The serialized request, if the method is coalesced.
+  std::string coalescing_key_;
+  bool has_coalescing_key_ = false;
+  // Only used by generic services. Kept inline so that it is recycled along
+  // with the rest of the request.
+  grpc_call_details call_details_;
   grpc_call* call_;
   gpr_timespec deadline_;
   grpc_metadata_array request_metadata_;
@@ -759,13 +1095,13 @@ bool Server::CallbackRequest<
     grpc::GenericCallbackServerContext>::FinalizeResult(void** /*tag*/,
                                                         bool* status) {
   if (*status) {
-    deadline_ = call_details_->deadline;
+    deadline_ = call_details_.deadline;
     // TODO(yangg) remove the copy here
-    ctx_->method_ = grpc::StringFromCopiedSlice(call_details_->method);
-    ctx_->host_ = grpc::StringFromCopiedSlice(call_details_->host);
+    ctx_->method_ = grpc::StringFromCopiedSlice(call_details_.method);
+    ctx_->host_ = grpc::StringFromCopiedSlice(call_details_.host);
   }
-  grpc_slice_unref(call_details_->method);
-  grpc_slice_unref(call_details_->host);
+  grpc_slice_unref(call_details_.method);
+  grpc_slice_unref(call_details_.host);
   return false;
 }
 
@@ -789,11 +1125,13 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   SyncRequestThreadManager(Server* server, grpc::CompletionQueue* server_cq,
                            std::shared_ptr<GlobalCallbacks> global_callbacks,
                            grpc_resource_quota* rq, int min_pollers,
-                           int max_pollers, int cq_timeout_msec)
+                           int max_pollers, int cq_timeout_msec,
+                           int max_queue_time_msec)
       : ThreadManager("SyncServer", rq, min_pollers, max_pollers),
         server_(server),
         server_cq_(server_cq),
         cq_timeout_msec_(cq_timeout_msec),
+        max_queue_time_msec_(max_queue_time_msec),
         global_callbacks_(std::move(global_callbacks)) {}
 
   WorkStatus PollForWork(void** tag, bool* ok) override {
@@ -825,6 +1163,13 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
     DCHECK_NE(sync_req, nullptr);
     DCHECK(ok);
 
+    // A call that has waited too long for a thread is failed just as one that
+    // cannot get a thread at all: its client has likely given up on it, and
+    // running it would only delay the calls queued behind it.
+    if (resources && max_queue_time_msec_ > 0 &&
+        sync_req->QueuedLongerThan(max_queue_time_msec_)) {
+      resources = false;
+    }
     sync_req->Run(global_callbacks_, resources);
   }
 
@@ -879,6 +1224,7 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   Server* server_;
   grpc::CompletionQueue* server_cq_;
   int cq_timeout_msec_;
+  int max_queue_time_msec_;
   bool has_sync_method_ = false;
   std::unique_ptr<grpc::internal::RpcServiceMethod> unknown_method_;
   std::shared_ptr<Server::GlobalCallbacks> global_callbacks_;
@@ -913,6 +1259,14 @@ Server::Server(
   global_callbacks_->UpdateArguments(args);
 
   if (sync_server_cqs_ != nullptr) {
+    int max_queue_time_msec;
+    {
+      grpc_channel_args channel_args;
+      args->SetChannelArgs(&channel_args);
+      max_queue_time_msec = grpc_channel_args_find_integer(
+          &channel_args, GRPC_ARG_SYNC_SERVER_MAX_QUEUE_TIME_MS,
+          {0, 0, INT_MAX});
+    }
     bool default_rq_created = false;
     if (server_rq == nullptr) {
       server_rq = grpc_resource_quota_create("SyncServer-default-rq");
@@ -924,7 +1278,7 @@ Server::Server(
     for (const auto& it : *sync_server_cqs_) {
       sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec, max_queue_time_msec));
     }
 
     if (default_rq_created) {
@@ -936,6 +1290,20 @@ Server::Server(
     acceptor->SetToChannelArgs(args);
   }
 
+  if (server_metric_recorder_ != nullptr) {
+    // Lets GRPC_ARG_MAX_CPU_UTILIZATION_FOR_INCOMING_CONNECTIONS_PERCENT act
+    // on the CPU utilization recorded by the application.
+    grpc_core::RefCountedPtr<grpc_core::CpuUtilizationSource>
+        cpu_utilization_source =
+            grpc_core::MakeRefCounted<ServerCpuUtilizationSource>(
+                server_metric_recorder_);
+    args->SetPointerWithVtable(
+        std::string(grpc_core::CpuUtilizationSource::ChannelArgName()),
+        cpu_utilization_source.get(),
+        grpc_core::ChannelArgTypeTraits<
+            grpc_core::CpuUtilizationSource>::VTable());
+  }
+
   grpc_channel_args channel_args;
   args->SetChannelArgs(&channel_args);
 
@@ -961,6 +1329,21 @@ Server::Server(
   }
   server_ = grpc_server_create(&channel_args, nullptr);
   grpc_server_set_config_fetcher(server_, server_config_fetcher);
+  if (grpc_channel_args_find_bool(
+          &channel_args, GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH,
+          false)) {
+    callback_dispatch_queue_ = std::make_unique<CallbackDispatchQueue>(
+        grpc_core::Server::FromC(server_)->channel_args());
+  }
+  if (grpc_channel_args_find_bool(
+          &channel_args, GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING, false)) {
+    // ServerBuilder::BuildAndStart() refuses to build such a server.
+    CHECK(callback_dispatch_queue_ == nullptr)
+        << "GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING cannot be combined with "
+           "GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH";
+    tenant_dispatcher_ = std::make_unique<TenantDispatcher>(
+        grpc_core::Server::FromC(server_)->channel_args());
+  }
 }
 
 Server::~Server() {
@@ -1002,13 +1385,27 @@ void Server::SetGlobalCallbacks(GlobalCallbacks* callbacks) {
 
 grpc_server* Server::c_server() { return server_; }
 
+namespace {
+
+// Message objects can only be passed on in-process channels, so the argument
+// is not looked at anywhere else.
+bool PassMessageObjects(const grpc_channel_args* channel_args) {
+  return grpc_core::ChannelArgs::FromC(channel_args)
+      .GetBool(GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS)
+      .value_or(false);
+}
+
+}  // namespace
+
 std::shared_ptr<grpc::Channel> Server::InProcessChannel(
     const grpc::ChannelArguments& args) {
   grpc_channel_args channel_args = args.c_channel_args();
-  return grpc::CreateChannelInternal(
+  std::shared_ptr<grpc::Channel> channel = grpc::CreateChannelInternal(
       "inproc", grpc_inproc_channel_create(server_, &channel_args, nullptr),
       std::vector<std::unique_ptr<
           grpc::experimental::ClientInterceptorFactoryInterface>>());
+  channel->pass_message_objects_ = PassMessageObjects(&channel_args);
+  return channel;
 }
 
 std::shared_ptr<grpc::Channel>
@@ -1018,10 +1415,31 @@ Server::experimental_type::InProcessChannelWithInterceptors(
         std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
         interceptor_creators) {
   grpc_channel_args channel_args = args.c_channel_args();
-  return grpc::CreateChannelInternal(
+  std::shared_ptr<grpc::Channel> channel = grpc::CreateChannelInternal(
       "inproc",
       grpc_inproc_channel_create(server_->server_, &channel_args, nullptr),
       std::move(interceptor_creators));
+  channel->pass_message_objects_ = PassMessageObjects(&channel_args);
+  return channel;
+}
+
+void Server::experimental_type::SetTenantWeight(const std::string& tenant,
+                                                double weight) {
+  if (server_->tenant_dispatcher_ == nullptr) return;
+  server_->tenant_dispatcher_->scheduler()->SetWeight(tenant, weight);
+}
+
+std::vector<Server::experimental_type::TenantStats>
+Server::experimental_type::GetTenantStats() {
+  std::vector<TenantStats> stats;
+  if (server_->tenant_dispatcher_ == nullptr) return stats;
+  for (const grpc_core::TenantScheduler::TenantStats& tenant :
+       server_->tenant_dispatcher_->scheduler()->GetStats()) {
+    stats.push_back(TenantStats{tenant.tenant, tenant.weight, tenant.items_run,
+                                tenant.items_queued, tenant.cpu_time_nanos,
+                                tenant.queue_time.millis()});
+  }
+  return stats;
 }
 
 static grpc_server_register_method_payload_handling PayloadHandlingForMethod(
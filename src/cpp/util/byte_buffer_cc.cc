@@ -26,10 +26,20 @@
 #include <grpcpp/support/status.h>
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+
 namespace grpc {
 
+namespace {
+// Slices this small are cheaper to copy into a cord than to reference from one
+// (this matches absl::Cord's own threshold for copying appended data).
+constexpr size_t kMaxBytesToCopyIntoCord = 511;
+}  // namespace
+
 Status ByteBuffer::TrySingleSlice(Slice* slice) const {
   if (!buffer_) {
     return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
@@ -50,6 +60,7 @@ Status ByteBuffer::DumpToSingleSlice(Slice* slice) const {
   if (!buffer_) {
     return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
   }
+  if (TrySingleSlice(slice).ok()) return Status::OK;
   grpc_byte_buffer_reader reader;
   if (!grpc_byte_buffer_reader_init(&reader, buffer_)) {
     return Status(StatusCode::INTERNAL,
@@ -61,6 +72,34 @@ Status ByteBuffer::DumpToSingleSlice(Slice* slice) const {
   return Status::OK;
 }
 
+Status ByteBuffer::TryGetCord(absl::Cord* cord) const {
+  if (!buffer_) {
+    return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
+  }
+  if ((buffer_->type != GRPC_BB_RAW) ||
+      (buffer_->data.raw.compression != GRPC_COMPRESS_NONE)) {
+    return Status(StatusCode::FAILED_PRECONDITION, "Buffer is compressed.");
+  }
+  absl::Cord result;
+  const grpc_slice_buffer& slice_buffer = buffer_->data.raw.slice_buffer;
+  for (size_t i = 0; i < slice_buffer.count; i++) {
+    const grpc_slice& slice = slice_buffer.slices[i];
+    absl::string_view data(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(slice)),
+        GRPC_SLICE_LENGTH(slice));
+    // Inlined slices carry their data with them, so must always be copied.
+    if (slice.refcount == nullptr || data.size() <= kMaxBytesToCopyIntoCord) {
+      result.Append(data);
+      continue;
+    }
+    grpc_slice ref = grpc_slice_ref(slice);
+    result.Append(absl::MakeCordFromExternal(
+        data, [ref](absl::string_view) { grpc_slice_unref(ref); }));
+  }
+  *cord = std::move(result);
+  return Status::OK;
+}
+
 Status ByteBuffer::Dump(std::vector<Slice>* slices) const {
   slices->clear();
   if (!buffer_) {
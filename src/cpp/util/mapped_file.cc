@@ -0,0 +1,166 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/support/port_platform.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/mapped_file.h>
+#include <grpcpp/support/slice.h>
+#include <grpcpp/support/status.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/strerror.h"
+
+#ifndef GPR_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace grpc {
+namespace experimental {
+
+// The mapped data, released once the MappedFile and all of its slices are
+// gone.
+class MappedFile::Mapping : public grpc_core::RefCounted<Mapping> {
+ public:
+  Mapping(void* data, size_t size) : data_(data), size_(size) {}
+
+  ~Mapping() override {
+    if (data_ == nullptr) return;
+#ifndef GPR_WINDOWS
+    munmap(data_, size_);
+#else
+    free(data_);
+#endif
+  }
+
+  void* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  void* const data_;
+  const size_t size_;
+};
+
+namespace {
+
+Status FileError(const std::string& path, const char* op, int error) {
+  return Status(StatusCode::UNAVAILABLE,
+                absl::StrCat(op, " ", path, ": ", grpc_core::StrError(error)));
+}
+
+}  // namespace
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path,
+                                             Status* status) {
+#ifndef GPR_WINDOWS
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    *status = FileError(path, "open", errno);
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    *status = FileError(path, "fstat", errno);
+    close(fd);
+    return nullptr;
+  }
+  size_t size = static_cast<size_t>(st.st_size);
+  void* data = nullptr;
+  // Empty files cannot be mapped.
+  if (size > 0) {
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      *status = FileError(path, "mmap", errno);
+      close(fd);
+      return nullptr;
+    }
+#ifdef MADV_SEQUENTIAL
+    // Files are usually streamed from front to back, so read ahead.
+    madvise(data, size, MADV_SEQUENTIAL);
+#endif
+  }
+  // The mapping keeps the file's pages alive on its own.
+  close(fd);
+#else
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    *status = FileError(path, "fopen", errno);
+    return nullptr;
+  }
+  long end = -1;
+  if (fseek(file, 0, SEEK_END) == 0) end = ftell(file);
+  if (end < 0 || fseek(file, 0, SEEK_SET) != 0) {
+    *status = FileError(path, "fseek", errno);
+    fclose(file);
+    return nullptr;
+  }
+  size_t size = static_cast<size_t>(end);
+  void* data = nullptr;
+  if (size > 0) {
+    data = malloc(size);
+    if (fread(data, 1, size, file) != size) {
+      *status = FileError(path, "fread", errno);
+      free(data);
+      fclose(file);
+      return nullptr;
+    }
+  }
+  fclose(file);
+#endif
+  *status = Status::OK;
+  return absl::WrapUnique(new MappedFile(new Mapping(data, size)));
+}
+
+MappedFile::MappedFile(Mapping* mapping) : mapping_(mapping) {}
+
+MappedFile::~MappedFile() { mapping_->Unref(); }
+
+size_t MappedFile::size() const { return mapping_->size(); }
+
+Slice MappedFile::Region(size_t offset, size_t length) const {
+  offset = std::min(offset, mapping_->size());
+  length = std::min(length, mapping_->size() - offset);
+  if (length == 0) return Slice();
+  // The slice's reference on the mapping is dropped with the slice.
+  Mapping* ref = mapping_->Ref().release();
+  return Slice(static_cast<char*>(ref->data()) + offset, length, UnrefMapping,
+               ref);
+}
+
+void MappedFile::UnrefMapping(void* mapping) {
+  static_cast<Mapping*>(mapping)->Unref();
+}
+
+ByteBuffer MappedFile::RegionBuffer(size_t offset, size_t length) const {
+  Slice slice = Region(offset, length);
+  return ByteBuffer(&slice, 1);
+}
+
+}  // namespace experimental
+}  // namespace grpc
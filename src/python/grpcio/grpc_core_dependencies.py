@@ -37,6 +37,7 @@ CORE_SOURCE_FILES = [
     'src/core/client_channel/retry_service_config.cc',
     'src/core/client_channel/retry_throttle.cc',
     'src/core/client_channel/subchannel.cc',
+    'src/core/client_channel/subchannel_connect_coordinator.cc',
     'src/core/client_channel/subchannel_pool_interface.cc',
     'src/core/client_channel/subchannel_stream_client.cc',
     'src/core/config/config_vars.cc',
@@ -57,6 +58,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/http/message_compress/compression_filter.cc',
     'src/core/ext/filters/http/server/http_server_filter.cc',
     'src/core/ext/filters/message_size/message_size_filter.cc',
+    'src/core/ext/filters/method_admission/method_admission_filter.cc',
     'src/core/ext/filters/rbac/rbac_filter.cc',
     'src/core/ext/filters/rbac/rbac_service_config_parser.cc',
     'src/core/ext/filters/stateful_session/stateful_session_filter.cc',
@@ -83,12 +85,16 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/hpack_parse_result.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parser.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parser_table.cc',
+    'src/core/ext/transport/chttp2/transport/http2_client_transport.cc',
+    'src/core/ext/transport/chttp2/transport/http2_server_transport.cc',
     'src/core/ext/transport/chttp2/transport/http2_settings.cc',
+    'src/core/ext/transport/chttp2/transport/http2_transport.cc',
     'src/core/ext/transport/chttp2/transport/huffsyms.cc',
     'src/core/ext/transport/chttp2/transport/parsing.cc',
     'src/core/ext/transport/chttp2/transport/ping_abuse_policy.cc',
     'src/core/ext/transport/chttp2/transport/ping_callbacks.cc',
     'src/core/ext/transport/chttp2/transport/ping_rate_policy.cc',
+    'src/core/ext/transport/chttp2/transport/shared_keepalive.cc',
     'src/core/ext/transport/chttp2/transport/stream_lists.cc',
     'src/core/ext/transport/chttp2/transport/varint.cc',
     'src/core/ext/transport/chttp2/transport/write_size_policy.cc',
@@ -426,6 +432,7 @@ CORE_SOURCE_FILES = [
     'src/core/handshaker/proxy_mapper_registry.cc',
     'src/core/handshaker/security/secure_endpoint.cc',
     'src/core/handshaker/security/security_handshaker.cc',
+    'src/core/handshaker/shm/shm_handshaker.cc',
     'src/core/handshaker/tcp_connect/tcp_connect_handshaker.cc',
     'src/core/lib/address_utils/parse_address.cc',
     'src/core/lib/address_utils/sockaddr_utils.cc',
@@ -440,6 +447,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/compression/compression.cc',
     'src/core/lib/compression/compression_internal.cc',
     'src/core/lib/compression/message_compress.cc',
+    'src/core/lib/compression/zstd_dictionary.cc',
     'src/core/lib/debug/trace.cc',
     'src/core/lib/debug/trace_flags.cc',
     'src/core/lib/event_engine/ares_resolver.cc',
@@ -452,6 +460,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -461,6 +470,8 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/posix_engine.cc',
     'src/core/lib/event_engine/posix_engine/posix_engine_listener.cc',
     'src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.cc',
+    'src/core/lib/event_engine/posix_engine/shm_endpoint.cc',
+    'src/core/lib/event_engine/posix_engine/shm_ring.cc',
     'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
@@ -489,6 +500,8 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/mpmc_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/iomgr/buffer_list.cc',
@@ -568,7 +581,9 @@ CORE_SOURCE_FILES = [
     'src/core/lib/resource_quota/api.cc',
     'src/core/lib/resource_quota/arena.cc',
     'src/core/lib/resource_quota/connection_quota.cc',
+    'src/core/lib/resource_quota/hugepage_slab.cc',
     'src/core/lib/resource_quota/memory_quota.cc',
+    'src/core/lib/resource_quota/method_quota.cc',
     'src/core/lib/resource_quota/periodic_update.cc',
     'src/core/lib/resource_quota/resource_quota.cc',
     'src/core/lib/resource_quota/thread_quota.cc',
@@ -618,6 +633,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/credentials/tls/grpc_tls_certificate_verifier.cc',
     'src/core/lib/security/credentials/tls/grpc_tls_credentials_options.cc',
     'src/core/lib/security/credentials/tls/grpc_tls_crl_provider.cc',
+    'src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.cc',
     'src/core/lib/security/credentials/tls/tls_credentials.cc',
     'src/core/lib/security/credentials/tls/tls_utils.cc',
     'src/core/lib/security/credentials/token_fetcher/token_fetcher_credentials.cc',
@@ -678,6 +694,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/transport/metadata_batch.cc',
     'src/core/lib/transport/metadata_info.cc',
     'src/core/lib/transport/parsed_metadata.cc',
+    'src/core/lib/transport/promise_endpoint.cc',
     'src/core/lib/transport/status_conversion.cc',
     'src/core/lib/transport/timeout_encoding.cc',
     'src/core/lib/transport/transport.cc',
@@ -694,8 +711,11 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/health_check_client.cc',
     'src/core/load_balancing/lb_policy.cc',
     'src/core/load_balancing/lb_policy_registry.cc',
+    'src/core/load_balancing/least_request/least_request.cc',
+    'src/core/load_balancing/locality_aware/locality_aware.cc',
     'src/core/load_balancing/oob_backend_metric.cc',
     'src/core/load_balancing/outlier_detection/outlier_detection.cc',
+    'src/core/load_balancing/peak_ewma/peak_ewma.cc',
     'src/core/load_balancing/pick_first/pick_first.cc',
     'src/core/load_balancing/priority/priority.cc',
     'src/core/load_balancing/ring_hash/ring_hash.cc',
@@ -719,6 +739,7 @@ CORE_SOURCE_FILES = [
     'src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
     'src/core/resolver/dns/dns_resolver_plugin.cc',
     'src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc',
+    'src/core/resolver/dns/event_engine/hostname_cache.cc',
     'src/core/resolver/dns/event_engine/service_config_helper.cc',
     'src/core/resolver/dns/native/dns_resolver.cc',
     'src/core/resolver/endpoint_addresses.cc',
@@ -734,14 +755,18 @@ CORE_SOURCE_FILES = [
     'src/core/server/server.cc',
     'src/core/server/server_call_tracer_filter.cc',
     'src/core/server/server_config_selector_filter.cc',
+    'src/core/server/tenant_scheduler.cc',
     'src/core/server/xds_channel_stack_modifier.cc',
     'src/core/server/xds_server_config_fetcher.cc',
     'src/core/service_config/service_config_channel_arg_filter.cc',
     'src/core/service_config/service_config_impl.cc',
     'src/core/service_config/service_config_parser.cc',
+    'src/core/telemetry/call_cpu_accounting.cc',
     'src/core/telemetry/call_tracer.cc',
     'src/core/telemetry/histogram_view.cc',
+    'src/core/telemetry/latency_breakdown.cc',
     'src/core/telemetry/metrics.cc',
+    'src/core/telemetry/slow_call_capture.cc',
     'src/core/telemetry/stats.cc',
     'src/core/telemetry/stats_data.cc',
     'src/core/tsi/alts/crypt/aes_gcm.cc',
@@ -765,10 +790,12 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/alts/zero_copy_frame_protector/alts_zero_copy_grpc_protector.cc',
     'src/core/tsi/fake_transport_security.cc',
     'src/core/tsi/local_transport_security.cc',
+    'src/core/tsi/ssl/handshake_offload/ssl_handshake_offloader.cc',
     'src/core/tsi/ssl/key_logging/ssl_key_logging.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+    'src/core/tsi/ssl/verification_cache/ssl_verification_cache.cc',
     'src/core/tsi/ssl_transport_security.cc',
     'src/core/tsi/ssl_transport_security_utils.cc',
     'src/core/tsi/transport_security.cc',
@@ -798,6 +825,7 @@ CORE_SOURCE_FILES = [
     'src/core/util/json/json_reader.cc',
     'src/core/util/json/json_util.cc',
     'src/core/util/json/json_writer.cc',
+    'src/core/util/latency_sketch.cc',
     'src/core/util/latent_see.cc',
     'src/core/util/linux/cpu.cc',
     'src/core/util/linux/env.cc',
@@ -824,6 +852,7 @@ CORE_SOURCE_FILES = [
     'src/core/util/sync.cc',
     'src/core/util/sync_abseil.cc',
     'src/core/util/tchar.cc',
+    'src/core/util/tdigest.cc',
     'src/core/util/time.cc',
     'src/core/util/time_averaged_stats.cc',
     'src/core/util/time_precise.cc',
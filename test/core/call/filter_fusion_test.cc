@@ -16,11 +16,25 @@
 
 #include <grpc/impl/grpc_types.h>
 
+#include <memory>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/ext/filters/http/client/http_client_filter.h"
+#include "src/core/ext/filters/http/message_compress/compression_filter.h"
+#include "src/core/filter/filter_args.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/call_final_info.h"
+#include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 
 using testing::ElementsAre;
@@ -253,8 +267,6 @@ TEST(FusedFilterTest, ClientFilterTest) {
   auto message = Arena::MakePooled<Message>();
   auto server_metadata_handle = Arena::MakePooled<ServerMetadata>();
   auto server_trailing_metadata_handle = Arena::MakePooled<ServerMetadata>();
-  auto server_trailing_metadata_handle_half_close =
-      Arena::MakePooled<ServerMetadata>();
   auto client_metadata_handle = Arena::MakePooled<ClientMetadata>();
   struct grpc_call_final_info info;
   message = RunSuccessfulPromise<Message>(
@@ -265,10 +277,10 @@ TEST(FusedFilterTest, ClientFilterTest) {
       call.OnServerInitialMetadata(std::move(server_metadata_handle), &filter));
   RunSuccessfulPromise<ClientMetadata>(
       call.OnClientInitialMetadata(std::move(client_metadata_handle), &filter));
-  RunSuccessfulPromise<ServerMetadata>(call.OnServerTrailingMetadata(
-      std::move(server_trailing_metadata_handle), &filter));
-  RunSuccessfulPromise<ServerMetadata>(call.OnClientToServerHalfClose(
-      std::move(server_trailing_metadata_handle_half_close)));
+  EXPECT_NE(call.OnServerTrailingMetadata(
+                std::move(server_trailing_metadata_handle), &filter),
+            nullptr);
+  call.OnClientToServerHalfClose();
   call.OnFinalize(&info, &filter);
   EXPECT_THAT(
       history,
@@ -306,6 +318,216 @@ TEST(FusedFilterTest, ClientFilterTest) {
                           "Test3::GetChannelInfo", "Test4::GetChannelInfo"));
 }
 
+// A filter with state on the channel, that its calls are constructed from.
+template <int kId>
+class StatefulFilter {
+ public:
+  static absl::StatusOr<std::unique_ptr<StatefulFilter>> Create(
+      const ChannelArgs&, FilterArgs) {
+    return std::make_unique<StatefulFilter>(absl::StrCat("f", kId));
+  }
+
+  explicit StatefulFilter(std::string name) : name_(std::move(name)) {}
+
+  class Call {
+   public:
+    explicit Call(StatefulFilter* filter) : filter_(filter) {}
+    void OnClientInitialMetadata(ClientMetadata&, StatefulFilter* filter) {
+      history.push_back(
+          absl::StrCat(filter->name_, ":OnClientInitialMetadata"));
+    }
+    static inline const NoInterceptor OnServerInitialMetadata;
+    static inline const NoInterceptor OnClientToServerMessage;
+    static inline const NoInterceptor OnServerToClientMessage;
+    void OnClientToServerHalfClose() {
+      history.push_back(
+          absl::StrCat(filter_->name_, ":OnClientToServerHalfClose"));
+    }
+    void OnServerTrailingMetadata(ServerMetadata&, StatefulFilter* filter) {
+      history.push_back(
+          absl::StrCat(filter->name_, ":OnServerTrailingMetadata"));
+    }
+    void OnFinalize(const grpc_call_final_info*) {
+      history.push_back(absl::StrCat(filter_->name_, ":OnFinalize"));
+    }
+
+   private:
+    StatefulFilter* const filter_;
+  };
+
+  bool StartTransportOp(grpc_transport_op*) { return false; }
+  bool GetChannelInfo(const grpc_channel_info*) { return false; }
+
+ private:
+  const std::string name_;
+};
+
+class FailingFilter {
+ public:
+  static absl::StatusOr<std::unique_ptr<FailingFilter>> Create(
+      const ChannelArgs&, FilterArgs) {
+    return absl::InvalidArgumentError("no");
+  }
+
+  class Call {
+   public:
+    static inline const NoInterceptor OnClientInitialMetadata;
+    static inline const NoInterceptor OnServerInitialMetadata;
+    static inline const NoInterceptor OnClientToServerMessage;
+    static inline const NoInterceptor OnServerToClientMessage;
+    static inline const NoInterceptor OnClientToServerHalfClose;
+    static inline const NoInterceptor OnServerTrailingMetadata;
+    static inline const NoInterceptor OnFinalize;
+  };
+
+  bool StartTransportOp(grpc_transport_op*) { return false; }
+  bool GetChannelInfo(const grpc_channel_info*) { return false; }
+};
+
+TEST(FusedFilterTest, CreateFailsIfAnyFilterFails) {
+  auto filter = FusedFilter<StatefulFilter<1>, FailingFilter>::Create(
+      ChannelArgs(), FilterArgs(0));
+  EXPECT_EQ(filter.status(), absl::InvalidArgumentError("no"));
+}
+
+TEST(FusedFilterTest, OneOperationPerInterceptionPoint) {
+  using Filter = FusedFilter<StatefulFilter<1>, StatefulFilter<2>>;
+  auto filter = Filter::Create(ChannelArgs(), FilterArgs(0));
+  ASSERT_TRUE(filter.ok()) << filter.status();
+  Filter* channel_data = filter->get();
+  filters_detail::StackData d;
+  const size_t call_offset = d.AddFilter(channel_data);
+  d.AddClientInitialMetadataOp(channel_data, call_offset);
+  d.AddServerInitialMetadataOp(channel_data, call_offset);
+  d.AddClientToServerMessageOp(channel_data, call_offset);
+  d.AddClientToServerHalfClose(channel_data, call_offset);
+  d.AddServerToClientMessageOp(channel_data, call_offset);
+  d.AddServerTrailingMetadataOp(channel_data, call_offset);
+  d.AddFinalizer(channel_data, call_offset, &Filter::Call::OnFinalize);
+  ASSERT_EQ(d.filter_constructor.size(), 1u);
+  ASSERT_EQ(d.client_initial_metadata.ops.size(), 1u);
+  EXPECT_EQ(d.server_initial_metadata.ops.size(), 0u);
+  EXPECT_EQ(d.client_to_server_messages.ops.size(), 0u);
+  ASSERT_EQ(d.client_to_server_half_close.size(), 1u);
+  EXPECT_EQ(d.server_to_client_messages.ops.size(), 0u);
+  ASSERT_EQ(d.server_trailing_metadata.size(), 1u);
+  ASSERT_EQ(d.finalizers.size(), 1u);
+  history.clear();
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  std::vector<char> call_data(d.call_data_size);
+  d.filter_constructor[0].call_init(call_data.data(), channel_data);
+  std::vector<char> promise_data(d.client_initial_metadata.promise_size);
+  auto r = d.client_initial_metadata.ops[0].promise_init(
+      promise_data.data(), call_data.data(), channel_data,
+      Arena::MakePooledForOverwrite<ClientMetadata>());
+  ASSERT_TRUE(r.ready());
+  EXPECT_NE(r.value().ok, nullptr);
+  d.client_to_server_half_close[0].half_close(call_data.data(), channel_data);
+  auto md = d.server_trailing_metadata[0].server_trailing_metadata(
+      call_data.data(), channel_data,
+      Arena::MakePooledForOverwrite<ServerMetadata>());
+  EXPECT_NE(md, nullptr);
+  d.finalizers[0].final(call_data.data(), channel_data, nullptr);
+  for (const auto& destructor : d.filter_destructor) {
+    destructor.call_destroy(call_data.data());
+  }
+  EXPECT_THAT(history,
+              ElementsAre("f1:OnClientInitialMetadata",
+                          "f2:OnClientInitialMetadata",
+                          "f1:OnClientToServerHalfClose",
+                          "f2:OnClientToServerHalfClose",
+                          "f2:OnServerTrailingMetadata",
+                          "f1:OnServerTrailingMetadata", "f1:OnFinalize",
+                          "f2:OnFinalize"));
+}
+
+// Fails server trailing metadata that has no status yet.
+template <int kId>
+class TrailingMetadataFilter {
+ public:
+  class Call {
+   public:
+    static inline const NoInterceptor OnClientInitialMetadata;
+    static inline const NoInterceptor OnServerInitialMetadata;
+    static inline const NoInterceptor OnClientToServerMessage;
+    static inline const NoInterceptor OnServerToClientMessage;
+    void OnClientToServerHalfClose(TrailingMetadataFilter*) {
+      history.push_back(absl::StrCat("t", kId, ":OnClientToServerHalfClose"));
+    }
+    absl::Status OnServerTrailingMetadata(ServerMetadata& md) {
+      history.push_back(absl::StrCat("t", kId, ":OnServerTrailingMetadata"));
+      if (md.get(GrpcStatusMetadata()).has_value()) return absl::OkStatus();
+      return absl::UnavailableError(absl::StrCat("t", kId));
+    }
+    static inline const NoInterceptor OnFinalize;
+  };
+
+  bool StartTransportOp(grpc_transport_op*) { return false; }
+  bool GetChannelInfo(const grpc_channel_info*) { return false; }
+};
+
+TEST(FusedFilterTest, FailedTrailingMetadataIsSeenByEarlierFilters) {
+  using Filter =
+      FusedFilter<TrailingMetadataFilter<1>, TrailingMetadataFilter<2>>;
+  Filter filter(std::make_unique<TrailingMetadataFilter<1>>(),
+                std::make_unique<TrailingMetadataFilter<2>>());
+  Filter::Call call(&filter);
+  history.clear();
+  // The last filter fails, and the first one sees the metadata it failed
+  // with, as it would if the filters were not fused.
+  ServerMetadataHandle md = call.OnServerTrailingMetadata(
+      Arena::MakePooledForOverwrite<ServerMetadata>());
+  ASSERT_NE(md, nullptr);
+  EXPECT_EQ(md->get(GrpcStatusMetadata()), GRPC_STATUS_UNAVAILABLE);
+  EXPECT_EQ(md->get(GrpcCallWasCancelled()), true);
+  ASSERT_NE(md->get_pointer(GrpcMessageMetadata()), nullptr);
+  EXPECT_EQ(md->get_pointer(GrpcMessageMetadata())->as_string_view(), "t2");
+  call.OnClientToServerHalfClose(&filter);
+  EXPECT_THAT(history, ElementsAre("t2:OnServerTrailingMetadata",
+                                   "t1:OnServerTrailingMetadata",
+                                   "t1:OnClientToServerHalfClose",
+                                   "t2:OnClientToServerHalfClose"));
+}
+
+TEST(FusedFilterTest, HttpClientFiltersFuse) {
+  using Filter = FusedFilter<HttpClientFilter, ClientCompressionFilter>;
+  EXPECT_EQ(Filter::TypeName(), "http-client+compression");
+  Filter filter(std::make_unique<HttpClientFilter>(
+                    HttpSchemeMetadata::kHttp, Slice::FromStaticString("test"),
+                    /*test_only_use_put_requests=*/false),
+                std::make_unique<ClientCompressionFilter>(ChannelArgs()));
+  filters_detail::StackData d;
+  const size_t call_offset = d.AddFilter(&filter);
+  d.AddClientInitialMetadataOp(&filter, call_offset);
+  d.AddServerInitialMetadataOp(&filter, call_offset);
+  d.AddClientToServerMessageOp(&filter, call_offset);
+  d.AddClientToServerHalfClose(&filter, call_offset);
+  d.AddServerToClientMessageOp(&filter, call_offset);
+  d.AddServerTrailingMetadataOp(&filter, call_offset);
+  d.AddFinalizer(&filter, call_offset, &Filter::Call::OnFinalize);
+  EXPECT_EQ(d.client_initial_metadata.ops.size(), 1u);
+  EXPECT_EQ(d.server_initial_metadata.ops.size(), 1u);
+  EXPECT_EQ(d.client_to_server_messages.ops.size(), 1u);
+  EXPECT_EQ(d.client_to_server_half_close.size(), 0u);
+  EXPECT_EQ(d.server_to_client_messages.ops.size(), 1u);
+  EXPECT_EQ(d.server_trailing_metadata.size(), 1u);
+  EXPECT_EQ(d.finalizers.size(), 0u);
+  // A trailing metadata failure in HttpClientFilter is reported the way
+  // CallFilters reports it for the unfused filter.
+  std::vector<char> call_data(d.call_data_size);
+  d.filter_constructor[0].call_init(call_data.data(), &filter);
+  auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+  md->Set(HttpStatusMetadata(), 500);
+  md = d.server_trailing_metadata[0].server_trailing_metadata(
+      call_data.data(), &filter, std::move(md));
+  ASSERT_NE(md, nullptr);
+  EXPECT_EQ(md->get(GrpcStatusMetadata()), GRPC_STATUS_UNKNOWN);
+  EXPECT_EQ(md->get(GrpcCallWasCancelled()), true);
+  for (const auto& destructor : d.filter_destructor) {
+    destructor.call_destroy(call_data.data());
+  }
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -87,6 +87,59 @@ TEST(ChannelArgsTest, RemoveAllKeysWithPrefix) {
   EXPECT_EQ(modified.GetInt("bar"), 4);
 }
 
+TEST(ChannelArgsTest, Hash) {
+  // Built in different orders, so that they do not share a tree.
+  ChannelArgs a = ChannelArgs().Set("answer", 42).Set("foo", "bar");
+  ChannelArgs b = ChannelArgs().Set("foo", "bar").Set("answer", 42);
+  ASSERT_EQ(a, b);
+  EXPECT_EQ(a.Hash(), b.Hash());
+  EXPECT_NE(a.Hash(), a.Set("answer", 43).Hash());
+  EXPECT_NE(a.Hash(), a.Set("foo", "baz").Hash());
+  EXPECT_NE(a.Hash(), a.Set("bar", "foo").Hash());
+  EXPECT_NE(a.Hash(), a.Remove("answer").Hash());
+}
+
+TEST(ChannelArgsTest, TypedKeys) {
+  static const ChannelArgKey<int> kInt("int");
+  static const ChannelArgKey<bool> kBool("bool");
+  static const ChannelArgKey<Duration> kDuration("duration");
+  static const ChannelArgKey<absl::string_view> kString("string");
+  ChannelArgs args;
+  EXPECT_FALSE(args.Contains(kInt));
+  EXPECT_EQ(args.Get(kInt), std::nullopt);
+  args = args.Set(kInt, 42)
+             .Set(kBool, true)
+             .Set(kDuration, Duration::Seconds(3))
+             .Set(kString, "hello")
+             .Set("other", 1);
+  EXPECT_TRUE(args.Contains(kInt));
+  EXPECT_EQ(args.Get(kInt), 42);
+  EXPECT_EQ(args.Get(kBool), true);
+  EXPECT_EQ(args.Get(kDuration), Duration::Seconds(3));
+  EXPECT_EQ(args.Get(kString), "hello");
+  // Typed keys and names refer to the same args.
+  EXPECT_EQ(args.GetInt("int"), 42);
+  EXPECT_EQ(args.GetBool("bool"), true);
+  EXPECT_EQ(args.GetDurationFromIntMillis("duration"), Duration::Seconds(3));
+  EXPECT_EQ(args.GetString("string"), "hello");
+  EXPECT_EQ(args, ChannelArgs()
+                      .Set("string", "hello")
+                      .Set("int", 42)
+                      .Set("other", 1)
+                      .Set("duration", 3000)
+                      .Set("bool", 1));
+  args = args.Set("int", 7).Remove("bool");
+  EXPECT_EQ(args.Get(kInt), 7);
+  EXPECT_EQ(args.Get(kBool), std::nullopt);
+  // A value of the wrong type reads as unset.
+  EXPECT_EQ(args.Set("int", "seven").Get(kInt), std::nullopt);
+  // Durations out of range of int milliseconds saturate to infinity.
+  EXPECT_EQ(args.Set(kDuration, Duration::Infinity()).Get(kDuration),
+            Duration::Infinity());
+  EXPECT_EQ(args.Set(kDuration, Duration::Hours(24 * 365)).Get(kDuration),
+            Duration::Infinity());
+}
+
 TEST(ChannelArgsTest, StoreRefCountedPtr) {
   struct Test : public RefCounted<Test> {
     explicit Test(int n) : n(n) {}
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -127,6 +128,62 @@ TEST_F(ChannelzRegistryTest, TestUnregistration) {
   }
 }
 
+TEST_F(ChannelzRegistryTest, LazyRegistration) {
+  auto node = MakeRefCounted<SocketNode>("local", "remote", "socket", nullptr,
+                                         BaseNode::Registration::kLazy);
+  // The lazy node only gets a uuid when it is first asked for one, so a node
+  // registered after it was created still gets a smaller uuid.
+  RefCountedPtr<BaseNode> eager_node = CreateTestNode();
+  intptr_t uuid = node->uuid();
+  EXPECT_GT(uuid, eager_node->uuid());
+  EXPECT_EQ(node->uuid(), uuid);
+  EXPECT_EQ(ChannelzRegistry::Get(uuid), node);
+  node.reset();
+  EXPECT_EQ(ChannelzRegistry::Get(uuid), nullptr);
+}
+
+TEST_F(ChannelzRegistryTest, ConcurrentLazyRegistration) {
+  constexpr int kNumThreads = 8;
+  auto node = MakeRefCounted<SocketNode>("local", "remote", "socket", nullptr,
+                                         BaseNode::Registration::kLazy);
+  std::vector<intptr_t> uuids(kNumThreads);
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&node, &uuids, i]() { uuids[i] = node->uuid(); });
+  }
+  for (auto& thread : threads) thread.join();
+  // Every thread sees the uuid of the one registration that won.
+  for (intptr_t uuid : uuids) EXPECT_EQ(uuid, node->uuid());
+  EXPECT_EQ(ChannelzRegistry::Get(node->uuid()), node);
+}
+
+TEST_F(ChannelzRegistryTest, ConcurrentRegistration) {
+  constexpr int kNumThreads = 8;
+  constexpr int kNodesPerThread = 100;
+  std::vector<std::vector<RefCountedPtr<BaseNode>>> nodes(kNumThreads);
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&nodes, i]() {
+      for (int j = 0; j < kNodesPerThread; ++j) {
+        nodes[i].push_back(CreateTestNode());
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  std::vector<intptr_t> uuids;
+  for (auto& thread_nodes : nodes) {
+    for (auto& node : thread_nodes) {
+      EXPECT_EQ(ChannelzRegistry::Get(node->uuid()), node);
+      uuids.push_back(node->uuid());
+    }
+  }
+  std::sort(uuids.begin(), uuids.end());
+  EXPECT_EQ(std::adjacent_find(uuids.begin(), uuids.end()), uuids.end())
+      << "Uuids must be unique";
+}
+
 }  // namespace testing
 }  // namespace channelz
 }  // namespace grpc_core
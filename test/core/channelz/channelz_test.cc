@@ -31,7 +31,10 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <map>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -41,7 +44,9 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/surface/channel.h"
+#include "src/core/lib/transport/call_arena_allocator.h"
 #include "src/core/server/server.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_reader.h"
@@ -182,13 +187,16 @@ class ChannelFixture {
 
 class ServerFixture {
  public:
-  explicit ServerFixture(int max_tracer_event_memory = 0) {
+  explicit ServerFixture(int max_tracer_event_memory = 0,
+                         bool call_latency = false) {
     grpc_arg server_a[] = {
         grpc_channel_arg_integer_create(
             const_cast<char*>(GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE),
             max_tracer_event_memory),
         grpc_channel_arg_integer_create(
             const_cast<char*>(GRPC_ARG_ENABLE_CHANNELZ), true),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_CHANNELZ_CALL_LATENCY), call_latency),
     };
     grpc_channel_args server_args = {GPR_ARRAY_SIZE(server_a), server_a};
     server_ = grpc_server_create(&server_args, nullptr);
@@ -577,6 +585,62 @@ TEST(ChannelzServerTest, BasicServerAPIFunctionality) {
   ValidateServer(channelz_server, {3, 3, 3});
 }
 
+Json::Object ServerData(ServerNode* channelz_server) {
+  Json json = channelz_server->RenderJson();
+  return json.object().find("data")->second.object();
+}
+
+TEST(ChannelzServerTest, CallLatencyIsOffByDefault) {
+  ExecCtx exec_ctx;
+  ServerFixture server;
+  ServerNode* channelz_server = Server::FromC(server.server())->channelz_node();
+  EXPECT_FALSE(channelz_server->call_latency_enabled());
+  channelz_server->RecordCallLatency("/foo.Bar/Baz", 0.1);
+  EXPECT_EQ(ServerData(channelz_server).count("callLatency"), 0);
+}
+
+TEST(ChannelzServerTest, RendersCallLatencyOfRegisteredMethods) {
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  {
+    ServerFixture server(0, /*call_latency=*/true);
+    grpc_server_register_method(server.server(), "/foo.Bar/Baz", nullptr,
+                                GRPC_SRM_PAYLOAD_NONE, 0);
+    grpc_server_register_completion_queue(server.server(), cq, nullptr);
+    grpc_server_start(server.server());
+    ServerNode* channelz_server =
+        Server::FromC(server.server())->channelz_node();
+    {
+      ExecCtx exec_ctx;
+      EXPECT_EQ(ServerData(channelz_server).count("callLatency"), 0);
+      for (int i = 1; i <= 100; ++i) {
+        channelz_server->RecordCallLatency("/foo.Bar/Baz", i / 1000.0);
+      }
+      // Not registered, so only counted in the overall latency.
+      channelz_server->RecordCallLatency("/foo.Bar/Qux", 1.0);
+      Json::Object object = ServerData(channelz_server);
+      const Json::Object& latency = object["callLatency"].object();
+      EXPECT_EQ(latency.at("count").string(), "101");
+      EXPECT_EQ(latency.at("max").string(), "1.000000s");
+      const Json::Array& methods = object["methodCallLatency"].array();
+      ASSERT_EQ(methods.size(), 1);
+      EXPECT_EQ(methods[0].object().at("method").string(), "/foo.Bar/Baz");
+      EXPECT_EQ(methods[0].object().at("count").string(), "100");
+      EXPECT_EQ(methods[0].object().at("max").string(), "0.100000s");
+    }
+    grpc_server_shutdown_and_notify(server.server(), cq, nullptr);
+    EXPECT_EQ(grpc_completion_queue_next(
+                  cq, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr)
+                  .type,
+              GRPC_OP_COMPLETE);
+  }
+  grpc_completion_queue_shutdown(cq);
+  EXPECT_EQ(grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                       nullptr)
+                .type,
+            GRPC_QUEUE_SHUTDOWN);
+  grpc_completion_queue_destroy(cq);
+}
+
 TEST_F(ChannelzRegistryBasedTest, BasicGetServersTest) {
   ExecCtx exec_ctx;
   ServerFixture server;
@@ -595,6 +659,75 @@ TEST_F(ChannelzRegistryBasedTest, ManyServersTest) {
   ValidateGetServers(10);
 }
 
+TEST(ChannelzSocketTest, ReportsMemoryAsSocketOptions) {
+  auto memory_quota = MakeMemoryQuota("socket_test");
+  MemoryOwner owner = memory_quota->CreateMemoryOwner();
+  std::optional<MemoryAllocator::Reservation> reservation =
+      owner.MakeReservation(1024);
+  auto arena_allocator = MakeRefCounted<CallArenaAllocator>(
+      memory_quota->CreateMemoryAllocator("arena"), 1024);
+  arena_allocator->MakeArena()->Alloc(4096);
+  auto socket = MakeRefCounted<SocketNode>("", "", "socket", nullptr);
+  socket->AddMemoryOwner("transport", owner);
+  socket->SetCallArenaAllocator(arena_allocator);
+  auto options = [&socket]() {
+    std::map<std::string, std::string> options;
+    Json json = socket->RenderJson();
+    auto data = json.object().find("data");
+    if (data == json.object().end()) return options;
+    auto option = data->second.object().find("option");
+    if (option == data->second.object().end()) return options;
+    for (const Json& entry : option->second.array()) {
+      options[entry.object().at("name").string()] =
+          entry.object().at("value").string();
+    }
+    return options;
+  };
+  auto before = options();
+  ASSERT_TRUE(before.count("grpc.memory.transport.reserved_bytes"));
+  EXPECT_GE(std::stoul(before["grpc.memory.transport.reserved_bytes"]), 1024);
+  EXPECT_GE(std::stoul(before["grpc.memory.call_arena.high_water_bytes"]),
+            4096);
+  EXPECT_GE(std::stoul(before["grpc.memory.call_arena.estimate_bytes"]), 4096);
+  // Once the owner is gone, so is its report.
+  reservation.reset();
+  owner.Reset();
+  auto after = options();
+  EXPECT_FALSE(after.count("grpc.memory.transport.reserved_bytes"));
+  EXPECT_TRUE(after.count("grpc.memory.call_arena.high_water_bytes"));
+}
+
+TEST(ChannelzSocketTest, ReportsTcpInfoAsSocketOptions) {
+  auto socket = MakeRefCounted<SocketNode>("", "", "socket", nullptr);
+  auto options = [&socket]() {
+    std::map<std::string, std::string> options;
+    Json json = socket->RenderJson();
+    auto data = json.object().find("data");
+    if (data == json.object().end()) return options;
+    auto option = data->second.object().find("option");
+    if (option == data->second.object().end()) return options;
+    for (const Json& entry : option->second.array()) {
+      options[entry.object().at("name").string()] =
+          entry.object().at("value").string();
+    }
+    return options;
+  };
+  EXPECT_FALSE(options().count("grpc.tcp_info.srtt_usec"));
+  TcpTracerInterface::ConnectionMetrics metrics;
+  metrics.srtt = 250;
+  metrics.congestion_window = 10;
+  socket->SetTcpInfo(metrics);
+  auto first = options();
+  EXPECT_EQ(first["grpc.tcp_info.srtt_usec"], "250");
+  EXPECT_EQ(first["grpc.tcp_info.congestion_window"], "10");
+  // Metrics the sample does not have are not reported.
+  EXPECT_FALSE(first.count("grpc.tcp_info.busy_usec"));
+  // A new sample replaces the previous one.
+  metrics.srtt = 500;
+  socket->SetTcpInfo(metrics);
+  EXPECT_EQ(options()["grpc.tcp_info.srtt_usec"], "500");
+}
+
 INSTANTIATE_TEST_SUITE_P(ChannelzChannelTestSweep, ChannelzChannelTest,
                          ::testing::Values(0, 8, 64, 1024, 1024 * 1024));
 
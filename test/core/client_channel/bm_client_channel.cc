@@ -16,16 +16,27 @@
 #include <grpc/grpc.h>
 
 #include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "src/core/client_channel/client_channel.h"
+#include "src/core/client_channel/config_selector.h"
+#include "src/core/client_channel/load_balanced_call_destination.h"
 #include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/service_config/service_config_impl.h"
 #include "test/core/transport/call_spine_benchmarks.h"
 
 namespace grpc_core {
 
 namespace {
 const Slice kTestPath = Slice::FromExternalString("/foo/bar");
-}
+// Channel args understood by TestResolver: when the LB policy is set, it
+// returns a service config selecting it, along with a config selector adding
+// the given number of dynamic filters.
+const char kTestLbPolicyArg[] = "grpc.testing.lb_policy";
+const char kTestDynamicFiltersArg[] = "grpc.testing.dynamic_filters";
+}  // namespace
 
 class ClientChannelTraits {
  public:
@@ -129,6 +140,61 @@ class TestResolver final : public Resolver {
   void ShutdownLocked() override {}
 
  private:
+  // Does nothing, but still has to be run for every call.
+  class NoopFilter {
+   public:
+    class Call {
+     public:
+      void OnClientInitialMetadata(ClientMetadata&) {}
+      static inline const NoInterceptor OnServerInitialMetadata;
+      static inline const NoInterceptor OnClientToServerMessage;
+      static inline const NoInterceptor OnClientToServerHalfClose;
+      static inline const NoInterceptor OnServerToClientMessage;
+      static inline const NoInterceptor OnServerTrailingMetadata;
+      static inline const NoInterceptor OnFinalize;
+    };
+
+    static absl::StatusOr<std::unique_ptr<NoopFilter>> Create(
+        const ChannelArgs&, ChannelFilter::Args) {
+      return std::make_unique<NoopFilter>();
+    }
+  };
+
+  class TestConfigSelector final : public ConfigSelector {
+   public:
+    TestConfigSelector(RefCountedPtr<ServiceConfig> service_config,
+                       int num_filters)
+        : service_config_(std::move(service_config)),
+          num_filters_(num_filters) {}
+
+    UniqueTypeName name() const override {
+      static UniqueTypeName::Factory kFactory("test");
+      return kFactory.Create();
+    }
+
+    void AddFilters(InterceptionChainBuilder& builder) override {
+      for (int i = 0; i < num_filters_; ++i) builder.Add<NoopFilter>();
+    }
+
+    absl::Status GetCallConfig(GetCallConfigArgs args) override {
+      Slice* path = args.initial_metadata->get_pointer(HttpPathMetadata());
+      CHECK_NE(path, nullptr);
+      args.service_config_call_data->SetServiceConfig(
+          service_config_,
+          service_config_->GetMethodParsedConfigVector(path->c_slice()));
+      return absl::OkStatus();
+    }
+
+   private:
+    bool Equals(const ConfigSelector* other) const override {
+      return num_filters_ ==
+             static_cast<const TestConfigSelector*>(other)->num_filters_;
+    }
+
+    const RefCountedPtr<ServiceConfig> service_config_;
+    const int num_filters_;
+  };
+
   Resolver::Result MakeSuccessfulResolutionResult(
       absl::string_view endpoint_address) {
     Resolver::Result result;
@@ -136,6 +202,16 @@ class TestResolver final : public Resolver {
     grpc_resolved_address address;
     CHECK(grpc_parse_uri(URI::Parse(endpoint_address).value(), &address));
     result.addresses = EndpointAddressesList({EndpointAddresses{address, {}}});
+    auto lb_policy = args_.GetOwnedString(kTestLbPolicyArg);
+    if (lb_policy.has_value()) {
+      auto service_config = ServiceConfigImpl::Create(
+          args_, absl::StrCat(R"({"loadBalancingConfig": [{")", *lb_policy,
+                              R"(": {}}]})"));
+      CHECK_OK(service_config);
+      result.args = result.args.SetObject(MakeRefCounted<TestConfigSelector>(
+          *service_config, args_.GetInt(kTestDynamicFiltersArg).value_or(0)));
+      result.service_config = std::move(service_config);
+    }
     return result;
   }
 
@@ -156,6 +232,192 @@ class TestResolverFactory final : public ResolverFactory {
   bool IsValidUri(const URI&) const override { return true; }
 };
 
+// Runs calls through the whole client channel: config selector, dynamic
+// filters, LB pick and LoadBalancedCallDestination, down to a fake transport
+// on a connected subchannel.
+template <typename LbPolicy, int kNumDynamicFilters>
+class ClientChannelCallPathFixture {
+ public:
+  ClientChannelCallPathFixture() {
+    auto channel = ClientChannel::Create(
+        "test:///target",
+        ChannelArgs()
+            .SetObject(&client_channel_factory_)
+            .SetObject(&call_destination_factory_)
+            .SetObject(ResourceQuota::Default())
+            .SetObject(event_engine_)
+            .Set(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, true)
+            .Set(kTestLbPolicyArg, LbPolicy::kName)
+            .Set(kTestDynamicFiltersArg, kNumDynamicFilters)
+            // TODO(ctiller): remove once v3 supports retries
+            .Set(GRPC_ARG_ENABLE_RETRIES, 0));
+    CHECK_OK(channel);
+    channel_ = std::move(*channel);
+  }
+
+  ~ClientChannelCallPathFixture() {
+    ExecCtx exec_ctx;
+    channel_.reset();
+    arena_allocator_.reset();
+  }
+
+  BenchmarkCall MakeCall() {
+    auto arena = arena_allocator_->MakeArena();
+    arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+        event_engine_.get());
+    auto md = Arena::MakePooledForOverwrite<ClientMetadata>();
+    md->Set(HttpPathMetadata(), kTestPath.Copy());
+    auto p = MakeCallPair(std::move(md), std::move(arena));
+    p.handler.SpawnInfallible("initiator_setup", [&]() {
+      channel_->StartCall(std::move(p.handler));
+    });
+    return {std::move(p.initiator), sink_->TakeHandler()};
+  }
+
+  ServerMetadataHandle MakeServerInitialMetadata() {
+    return Arena::MakePooledForOverwrite<ServerMetadata>();
+  }
+
+  MessageHandle MakePayload() { return Arena::MakePooled<Message>(); }
+
+  ServerMetadataHandle MakeServerTrailingMetadata() {
+    return Arena::MakePooledForOverwrite<ServerMetadata>();
+  }
+
+ private:
+  // Collects the calls the transport is asked to start.
+  class CallSink : public RefCounted<CallSink> {
+   public:
+    void Push(CallHandler handler) {
+      MutexLock lock(&mu_);
+      handler_ = std::move(handler);
+    }
+
+    CallHandler TakeHandler() {
+      mu_.LockWhen(absl::Condition(
+          +[](CallSink* sink) ABSL_EXCLUSIVE_LOCKS_REQUIRED(sink->mu_) {
+            return sink->handler_.has_value();
+          },
+          this));
+      auto h = std::move(*handler_);
+      handler_.reset();
+      mu_.Unlock();
+      return h;
+    }
+
+   private:
+    absl::Mutex mu_;
+    std::optional<CallHandler> handler_ ABSL_GUARDED_BY(mu_);
+  };
+
+  class TestTransport final : public ClientTransport {
+   public:
+    explicit TestTransport(RefCountedPtr<CallSink> sink)
+        : sink_(std::move(sink)) {}
+
+    void Orphan() override {
+      state_tracker_.SetState(GRPC_CHANNEL_SHUTDOWN, absl::OkStatus(),
+                              "transport-orphaned");
+      Unref();
+    }
+
+    FilterStackTransport* filter_stack_transport() override { return nullptr; }
+    ClientTransport* client_transport() override { return this; }
+    ServerTransport* server_transport() override { return nullptr; }
+    absl::string_view GetTransportName() const override { return "test"; }
+    void SetPollset(grpc_stream*, grpc_pollset*) override {}
+    void SetPollsetSet(grpc_stream*, grpc_pollset_set*) override {}
+    void PerformOp(grpc_transport_op* op) override {
+      if (op->start_connectivity_watch != nullptr) {
+        state_tracker_.AddWatcher(op->start_connectivity_watch_state,
+                                  std::move(op->start_connectivity_watch));
+      }
+      ExecCtx::Run(DEBUG_LOCATION, op->on_consumed, absl::OkStatus());
+    }
+
+    void StartCall(CallHandler call_handler) override {
+      sink_->Push(std::move(call_handler));
+    }
+
+   private:
+    const RefCountedPtr<CallSink> sink_;
+    ConnectivityStateTracker state_tracker_{"test-transport"};
+  };
+
+  class TestConnector final : public SubchannelConnector {
+   public:
+    explicit TestConnector(RefCountedPtr<CallSink> sink)
+        : sink_(std::move(sink)) {}
+
+    void Connect(const Args& args, Result* result,
+                 grpc_closure* notify) override {
+      result->channel_args = args.channel_args;
+      result->transport = MakeOrphanable<TestTransport>(sink_).release();
+      ExecCtx::Run(DEBUG_LOCATION, notify, absl::OkStatus());
+    }
+
+    void Shutdown(grpc_error_handle) override {}
+
+   private:
+    const RefCountedPtr<CallSink> sink_;
+  };
+
+  class TestClientChannelFactory final : public ClientChannelFactory {
+   public:
+    explicit TestClientChannelFactory(RefCountedPtr<CallSink> sink)
+        : sink_(std::move(sink)) {}
+
+    RefCountedPtr<Subchannel> CreateSubchannel(
+        const grpc_resolved_address& address,
+        const ChannelArgs& args) override {
+      return Subchannel::Create(MakeOrphanable<TestConnector>(sink_), address,
+                                args);
+    }
+
+   private:
+    const RefCountedPtr<CallSink> sink_;
+  };
+
+  class TestCallDestinationFactory final
+      : public ClientChannel::CallDestinationFactory {
+   public:
+    RefCountedPtr<UnstartedCallDestination> CreateCallDestination(
+        ClientChannel::PickerObservable picker) override {
+      return MakeRefCounted<LoadBalancedCallDestination>(std::move(picker));
+    }
+  };
+
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_ =
+      grpc_event_engine::experimental::GetDefaultEventEngine();
+  RefCountedPtr<CallArenaAllocator> arena_allocator_ =
+      MakeRefCounted<CallArenaAllocator>(
+          ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+              "test-allocator"),
+          1024);
+  RefCountedPtr<CallSink> sink_ = MakeRefCounted<CallSink>();
+  TestClientChannelFactory client_channel_factory_{sink_};
+  TestCallDestinationFactory call_destination_factory_;
+  RefCountedPtr<UnstartedCallDestination> channel_;
+};
+
+struct PickFirst {
+  static constexpr const char* kName = "pick_first";
+};
+struct RoundRobin {
+  static constexpr const char* kName = "round_robin";
+};
+
+using PickFirstCallPath = ClientChannelCallPathFixture<PickFirst, 0>;
+using RoundRobinCallPath = ClientChannelCallPathFixture<RoundRobin, 0>;
+using PickFirstCallPathWith4Filters =
+    ClientChannelCallPathFixture<PickFirst, 4>;
+using PickFirstCallPathWith16Filters =
+    ClientChannelCallPathFixture<PickFirst, 16>;
+GRPC_CALL_SPINE_BENCHMARK(PickFirstCallPath);
+GRPC_CALL_SPINE_BENCHMARK(RoundRobinCallPath);
+GRPC_CALL_SPINE_BENCHMARK(PickFirstCallPathWith4Filters);
+GRPC_CALL_SPINE_BENCHMARK(PickFirstCallPathWith16Filters);
+
 void BM_CreateClientChannel(benchmark::State& state) {
   class FinalDestination : public UnstartedCallDestination {
    public:
@@ -15,17 +15,25 @@
 #include "src/core/client_channel/client_channel.h"
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 
 #include <atomic>
 #include <memory>
 
+#include "absl/functional/any_invocable.h"
+#include "absl/functional/function_ref.h"
 #include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/service_config/service_config_impl.h"
+#include "src/core/util/json/json.h"
 #include "test/core/call/yodel/yodel_test.h"
 
 namespace grpc_core {
@@ -36,6 +44,7 @@ namespace {
 const absl::string_view kTestScheme = "test";
 const absl::string_view kTestTarget = "/target";
 const absl::string_view kTestPath = "/test_method";
+const absl::string_view kTestLbPolicy = "client_channel_test_lb";
 std::string TestTarget() {
   return absl::StrCat(kTestScheme, "://", kTestTarget);
 }
@@ -98,6 +107,43 @@ class ClientChannelTest : public YodelTest {
     return result;
   }
 
+  // Returns a result whose service config selects the test LB policy.
+  Resolver::Result MakeTestLbPolicyResolutionResult() {
+    auto service_config = ServiceConfigImpl::Create(
+        ChannelArgs(),
+        absl::StrCat("{\"loadBalancingConfig\": [{\"", kTestLbPolicy,
+                     "\": {}}]}"));
+    CHECK_OK(service_config);
+    return MakeSuccessfulResolutionResult("ipv4:127.0.0.1:1234",
+                                          std::move(service_config));
+  }
+
+  // Returns the picker that the channel currently offers to calls.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> CurrentPicker() {
+    auto next = picker_->NextWhen(
+        [](const RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>&) {
+          return true;
+        });
+    auto picker = next();
+    CHECK(picker.ready());
+    return std::move(picker.value());
+  }
+
+  // Waits for the channel to create the test LB policy, then runs \a fn
+  // with its helper on the work serializer and waits for that to finish.
+  void RunInTestLbPolicy(
+      absl::FunctionRef<void(LoadBalancingPolicy::ChannelControlHelper*)>
+          fn) {
+    TickUntilTrue([this]() { return lb_policy_ != nullptr; });
+    bool done = false;
+    lb_policy_->Run(
+        [fn, &done](LoadBalancingPolicy::ChannelControlHelper* helper) {
+          fn(helper);
+          done = true;
+        });
+    TickUntilTrue([&done]() { return done; });
+  }
+
  private:
   class TestConnector final : public SubchannelConnector {
    public:
@@ -222,6 +268,61 @@ class ClientChannelTest : public YodelTest {
     ClientChannelTest* const test_;
   };
 
+  // An LB policy whose picker updates are made by the test.
+  class TestLbPolicy final : public LoadBalancingPolicy {
+   public:
+    class Config final : public LoadBalancingPolicy::Config {
+     public:
+      absl::string_view name() const override { return kTestLbPolicy; }
+    };
+
+    TestLbPolicy(Args args, ClientChannelTest* test)
+        : LoadBalancingPolicy(std::move(args)), test_(test) {}
+
+    absl::string_view name() const override { return kTestLbPolicy; }
+
+    absl::Status UpdateLocked(UpdateArgs /*args*/) override {
+      test_->lb_policy_ = this;
+      return absl::OkStatus();
+    }
+
+    void ResetBackoffLocked() override {}
+
+    void Run(absl::AnyInvocable<void(ChannelControlHelper*)> fn) {
+      work_serializer()->Run([self = RefAsSubclass<TestLbPolicy>(),
+                              fn = std::move(fn)]() mutable {
+        fn(self->channel_control_helper());
+      });
+    }
+
+   private:
+    void ShutdownLocked() override {
+      if (test_->lb_policy_ == this) test_->lb_policy_ = nullptr;
+    }
+
+    ClientChannelTest* const test_;
+  };
+
+  class TestLbPolicyFactory final : public LoadBalancingPolicyFactory {
+   public:
+    explicit TestLbPolicyFactory(ClientChannelTest* test) : test_(test) {}
+
+    OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+        LoadBalancingPolicy::Args args) const override {
+      return MakeOrphanable<TestLbPolicy>(std::move(args), test_);
+    }
+
+    absl::string_view name() const override { return kTestLbPolicy; }
+
+    absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+    ParseLoadBalancingConfig(const Json& /*json*/) const override {
+      return MakeRefCounted<TestLbPolicy::Config>();
+    }
+
+   private:
+    ClientChannelTest* const test_;
+  };
+
   ChannelArgs CompleteArgs(const ChannelArgs& args) {
     return args.SetObject(&call_destination_factory_)
         .SetObject(&client_channel_factory_)
@@ -237,6 +338,8 @@ class ClientChannelTest : public YodelTest {
         [this](CoreConfiguration::Builder* builder) {
           builder->resolver_registry()->RegisterResolverFactory(
               std::make_unique<TestResolverFactory>(this));
+          builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+              std::make_unique<TestLbPolicyFactory>(this));
         });
   }
 
@@ -257,6 +360,7 @@ class ClientChannelTest : public YodelTest {
   // instantiated.
   std::queue<Resolver::Result> early_resolver_results_;
   TestResolver* resolver_ = nullptr;
+  TestLbPolicy* lb_policy_ = nullptr;
 };
 
 #define CLIENT_CHANNEL_TEST(name) YODEL_TEST(ClientChannelTest, name)
@@ -278,6 +382,40 @@ CLIENT_CHANNEL_TEST(StartCall) {
   WaitForAllPendingWork();
 }
 
+CLIENT_CHANNEL_TEST(WarmIdleReusesResolverResult) {
+  auto& channel =
+      InitChannel(ChannelArgs()
+                      .Set(GRPC_ARG_EXPERIMENTAL_CLIENT_CHANNEL_WARM_IDLE, true)
+                      .Set(GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS, 1000));
+  auto start_call = [&channel, this]() {
+    auto arena = channel.call_arena_allocator()->MakeArena();
+    arena->SetContext<EventEngine>(channel.event_engine());
+    auto call = MakeCallPair(MakeClientInitialMetadata(), std::move(arena));
+    channel.StartCall(std::move(call.handler));
+    return call.initiator;
+  };
+  auto call_initiator = start_call();
+  QueueNameResolutionResult(
+      MakeSuccessfulResolutionResult("ipv4:127.0.0.1:1234"));
+  auto call_handler = TickUntilCallStarted();
+  SpawnTestSeq(call_initiator, "cancel", [call_initiator]() mutable {
+    call_initiator.Cancel();
+  });
+  WaitForAllPendingWork();
+  TickUntilTrue([&channel]() {
+    return channel.CheckConnectivityState(/*try_to_connect=*/false) ==
+           GRPC_CHANNEL_IDLE;
+  });
+  // The new resolver has no result to report, so the call can only start
+  // with the one from before IDLE.
+  call_initiator = start_call();
+  call_handler = TickUntilCallStarted();
+  SpawnTestSeq(call_initiator, "cancel", [call_initiator]() mutable {
+    call_initiator.Cancel();
+  });
+  WaitForAllPendingWork();
+}
+
 // A filter that adds metadata foo=bar.
 class TestFilter {
  public:
@@ -364,6 +502,64 @@ CLIENT_CHANNEL_TEST(ConfigSelectorWithDynamicFilters) {
   WaitForAllPendingWork();
 }
 
+// A picker whose identity is all that matters to the tests.
+class TestPicker final : public LoadBalancingPolicy::SubchannelPicker {
+ public:
+  LoadBalancingPolicy::PickResult Pick(
+      LoadBalancingPolicy::PickArgs /*args*/) override {
+    return LoadBalancingPolicy::PickResult::Queue();
+  }
+};
+
+CLIENT_CHANNEL_TEST(PickerUpdatesAreCoalesced) {
+  auto& channel = InitChannel(ChannelArgs().Set(
+      GRPC_ARG_EXPERIMENTAL_PICKER_UPDATE_COALESCING_WINDOW_MS, 1000));
+  channel.CheckConnectivityState(/*try_to_connect=*/true);
+  QueueNameResolutionResult(MakeTestLbPolicyResolutionResult());
+  auto ready = MakeRefCounted<TestPicker>();
+  RunInTestLbPolicy([&](LoadBalancingPolicy::ChannelControlHelper* helper) {
+    helper->UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(), ready);
+    EXPECT_EQ(CurrentPicker(), ready);
+  });
+  // The first update that keeps the state is used right away.  Of those
+  // that follow within the window, only the last one is used, once the
+  // window ends.
+  auto first = MakeRefCounted<TestPicker>();
+  auto second = MakeRefCounted<TestPicker>();
+  auto third = MakeRefCounted<TestPicker>();
+  RunInTestLbPolicy([&](LoadBalancingPolicy::ChannelControlHelper* helper) {
+    helper->UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(), first);
+    EXPECT_EQ(CurrentPicker(), first);
+    helper->UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(), second);
+    helper->UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(), third);
+    EXPECT_EQ(CurrentPicker(), first);
+  });
+  TickUntilTrue([&]() { return CurrentPicker() == third; });
+  // A state change is never held back, and drops any held picker.
+  auto held = MakeRefCounted<TestPicker>();
+  auto failure = MakeRefCounted<TestPicker>();
+  RunInTestLbPolicy([&](LoadBalancingPolicy::ChannelControlHelper* helper) {
+    helper->UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(), held);
+    helper->UpdateState(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                        absl::UnavailableError("failed"), failure);
+    EXPECT_EQ(CurrentPicker(), failure);
+  });
+}
+
+CLIENT_CHANNEL_TEST(PickerUpdatesAreNotCoalescedByDefault) {
+  auto& channel = InitChannel(ChannelArgs());
+  channel.CheckConnectivityState(/*try_to_connect=*/true);
+  QueueNameResolutionResult(MakeTestLbPolicyResolutionResult());
+  auto first = MakeRefCounted<TestPicker>();
+  auto second = MakeRefCounted<TestPicker>();
+  RunInTestLbPolicy([&](LoadBalancingPolicy::ChannelControlHelper* helper) {
+    helper->UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(), first);
+    EXPECT_EQ(CurrentPicker(), first);
+    helper->UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(), second);
+    EXPECT_EQ(CurrentPicker(), second);
+  });
+}
+
 // TODO(ctiller, roth): MANY more test cases
 // - Resolver returns an error for the initial result, then returns a valid
 // result.
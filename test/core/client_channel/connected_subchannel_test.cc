@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 
 #include <atomic>
 #include <memory>
@@ -41,6 +42,11 @@ class ConnectedSubchannelTest : public YodelTest {
   using YodelTest::YodelTest;
 
   RefCountedPtr<ConnectedSubchannel> InitChannel(const ChannelArgs& args) {
+    return InitSubchannel(args)->connected_subchannel();
+  }
+
+  // Returns a subchannel that is connected.
+  RefCountedPtr<Subchannel> InitSubchannel(const ChannelArgs& args) {
     grpc_resolved_address addr;
     CHECK(grpc_parse_uri(URI::Parse(kTestAddress).value(), &addr));
     auto subchannel = Subchannel::Create(MakeOrphanable<TestConnector>(this),
@@ -49,14 +55,27 @@ class ConnectedSubchannelTest : public YodelTest {
       ExecCtx exec_ctx;
       subchannel->RequestConnection();
     }
-    return TickUntil<RefCountedPtr<ConnectedSubchannel>>(
-        [subchannel]() -> Poll<RefCountedPtr<ConnectedSubchannel>> {
-          auto connected_subchannel = subchannel->connected_subchannel();
-          if (connected_subchannel != nullptr) return connected_subchannel;
-          return Pending();
-        });
+    TickUntilTrue([subchannel]() {
+      return subchannel->connected_subchannel() != nullptr;
+    });
+    return subchannel;
+  }
+
+  // Starts a call on connected_subchannel, and returns its handler.
+  CallHandler StartCall(
+      RefCountedPtr<ConnectedSubchannel> connected_subchannel) {
+    auto call = MakeCall(MakeClientInitialMetadata());
+    SpawnTestSeq(call.handler, "start-call",
+                 [connected_subchannel = std::move(connected_subchannel),
+                  handler = call.handler]() mutable {
+                   connected_subchannel->unstarted_call_destination()
+                       ->StartCall(std::move(handler));
+                 });
+    return TickUntilCallStarted();
   }
 
+  int connection_attempts() const { return connection_attempts_; }
+
   ClientMetadataHandle MakeClientInitialMetadata() {
     auto client_initial_metadata =
         Arena::MakePooledForOverwrite<ClientMetadata>();
@@ -122,6 +141,7 @@ class ConnectedSubchannelTest : public YodelTest {
 
     void Connect(const Args& args, Result* result,
                  grpc_closure* notify) override {
+      ++test_->connection_attempts_;
       result->channel_args = args.channel_args;
       result->transport = MakeOrphanable<TestTransport>(test_).release();
       ExecCtx::Run(DEBUG_LOCATION, notify, absl::OkStatus());
@@ -152,6 +172,7 @@ class ConnectedSubchannelTest : public YodelTest {
   }
 
   std::queue<CallHandler> handlers_;
+  int connection_attempts_ = 0;
 };
 
 #define CONNECTED_SUBCHANNEL_CHANNEL_TEST(name) \
@@ -170,4 +191,57 @@ CONNECTED_SUBCHANNEL_CHANNEL_TEST(StartCall) {
   WaitForAllPendingWork();
 }
 
+CONNECTED_SUBCHANNEL_CHANNEL_TEST(CountsActiveCalls) {
+  auto channel = InitChannel(ChannelArgs());
+  EXPECT_EQ(channel->active_calls(), 0);
+  auto handler = StartCall(channel);
+  EXPECT_EQ(channel->active_calls(), 1);
+  WaitForAllPendingWork();
+}
+
+CONNECTED_SUBCHANNEL_CHANNEL_TEST(OneConnectionByDefault) {
+  auto subchannel = InitSubchannel(
+      ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_STREAMS_PER_CONNECTION,
+                        1));
+  auto connected_subchannel = subchannel->PickConnectedSubchannel();
+  auto handler = StartCall(connected_subchannel);
+  EXPECT_EQ(subchannel->PickConnectedSubchannel(), connected_subchannel);
+  WaitForAllPendingWork();
+  EXPECT_EQ(subchannel->PickConnectedSubchannel(), connected_subchannel);
+  EXPECT_EQ(connection_attempts(), 1);
+}
+
+CONNECTED_SUBCHANNEL_CHANNEL_TEST(OpensConnectionWhenSaturated) {
+  auto subchannel = InitSubchannel(
+      ChannelArgs()
+          .Set(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MAX_CONNECTIONS, 2)
+          .Set(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_STREAMS_PER_CONNECTION, 1));
+  auto first = subchannel->PickConnectedSubchannel();
+  auto first_handler = StartCall(first);
+  // The only connection is saturated, so another one gets opened for the
+  // calls that follow.
+  EXPECT_EQ(subchannel->PickConnectedSubchannel(), first);
+  auto second = TickUntil<RefCountedPtr<ConnectedSubchannel>>(
+      [subchannel, first]() -> Poll<RefCountedPtr<ConnectedSubchannel>> {
+        auto picked = subchannel->PickConnectedSubchannel();
+        if (picked != first) return picked;
+        return Pending();
+      });
+  EXPECT_EQ(connection_attempts(), 2);
+  auto second_handler = StartCall(second);
+  // Both connections are saturated, and there may be no more.
+  subchannel->PickConnectedSubchannel();
+  WaitForAllPendingWork();
+  EXPECT_EQ(connection_attempts(), 2);
+}
+
+CONNECTED_SUBCHANNEL_CHANNEL_TEST(OpensMinConnections) {
+  auto subchannel = InitSubchannel(
+      ChannelArgs()
+          .Set(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MIN_CONNECTIONS, 3)
+          .Set(GRPC_ARG_EXPERIMENTAL_SUBCHANNEL_MAX_CONNECTIONS, 4));
+  WaitForAllPendingWork();
+  EXPECT_EQ(connection_attempts(), 3);
+}
+
 }  // namespace grpc_core
@@ -26,6 +26,7 @@
 #include "gtest/gtest.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/service_config/service_config.h"
 #include "src/core/service_config/service_config_impl.h"
 #include "src/core/service_config/service_config_parser.h"
@@ -112,6 +113,63 @@ TEST_F(RetryParserTest, InvalidRetryThrottlingInvalidTokenRatio) {
             "could not parse as a number]");
 }
 
+TEST_F(RetryParserTest, ValidRetryBudget) {
+  const char* test_json =
+      "{\n"
+      "  \"retryThrottling\": {\n"
+      "    \"budgetPercent\": 20,\n"
+      "    \"minRetriesPerSecond\": 5,\n"
+      "    \"budgetWindow\": \"30s\"\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* parsed_config = static_cast<internal::RetryGlobalConfig*>(
+      (*service_config)->GetGlobalParsedConfig(parser_index_));
+  ASSERT_NE(parsed_config, nullptr);
+  EXPECT_EQ(parsed_config->budget_percent(), 20);
+  EXPECT_EQ(parsed_config->min_retries_per_second(), 5);
+  EXPECT_EQ(parsed_config->budget_window(), Duration::Seconds(30));
+}
+
+TEST_F(RetryParserTest, RetryBudgetDefaults) {
+  const char* test_json =
+      "{\n"
+      "  \"retryThrottling\": {\n"
+      "    \"budgetPercent\": 20\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* parsed_config = static_cast<internal::RetryGlobalConfig*>(
+      (*service_config)->GetGlobalParsedConfig(parser_index_));
+  ASSERT_NE(parsed_config, nullptr);
+  EXPECT_EQ(parsed_config->budget_percent(), 20);
+  EXPECT_EQ(parsed_config->min_retries_per_second(), 10);
+  EXPECT_EQ(parsed_config->budget_window(), Duration::Seconds(10));
+}
+
+TEST_F(RetryParserTest, InvalidRetryBudget) {
+  const char* test_json =
+      "{\n"
+      "  \"retryThrottling\": {\n"
+      "    \"budgetPercent\": 0,\n"
+      "    \"budgetWindow\": \"120s\",\n"
+      "    \"maxTokens\": 2\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:retryThrottling.budgetPercent error:must be greater than 0; "
+            "field:retryThrottling.budgetWindow error:"
+            "must be between 1s and 60s; "
+            "field:retryThrottling.maxTokens error:"
+            "cannot be combined with budgetPercent]")
+      << service_config.status();
+}
+
 TEST_F(RetryParserTest, ValidRetryPolicy) {
   const char* test_json =
       "{\n"
@@ -697,6 +755,150 @@ TEST_F(RetryParserTest, InvalidRetryPolicyPerAttemptRecvTimeoutBadValue) {
       << service_config.status();
 }
 
+class HedgingParserTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    parser_index_ =
+        CoreConfiguration::Get().service_config_parser().GetParserIndex(
+            "hedging");
+  }
+
+  size_t parser_index_;
+};
+
+TEST_F(HedgingParserTest, ValidHedgingPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3,\n"
+      "      \"hedgingDelay\": \"0.5s\",\n"
+      "      \"nonFatalStatusCodes\": [\"UNAVAILABLE\"]\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, 1);
+  auto service_config = ServiceConfigImpl::Create(args, test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  const auto* parsed_config = static_cast<internal::HedgingMethodConfig*>(
+      ((*vector_ptr)[parser_index_]).get());
+  ASSERT_NE(parsed_config, nullptr);
+  EXPECT_EQ(parsed_config->max_attempts(), 3);
+  EXPECT_EQ(parsed_config->hedging_delay(), Duration::Milliseconds(500));
+  EXPECT_TRUE(parsed_config->non_fatal_status_codes().Contains(
+      GRPC_STATUS_UNAVAILABLE));
+  EXPECT_FALSE(
+      parsed_config->non_fatal_status_codes().Contains(GRPC_STATUS_ABORTED));
+}
+
+TEST_F(HedgingParserTest, HedgingPolicyIgnoredWhenHedgingDisabled) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  EXPECT_EQ(((*vector_ptr)[parser_index_]).get(), nullptr);
+}
+
+TEST_F(HedgingParserTest, InvalidHedgingPolicyMaxAttemptsBadValue) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 1,\n"
+      "      \"nonFatalStatusCodes\": [\"FOO\"]\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, 1);
+  auto service_config = ServiceConfigImpl::Create(args, test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].hedgingPolicy.maxAttempts "
+            "error:must be at least 2; "
+            "field:methodConfig[0].hedgingPolicy.nonFatalStatusCodes[0] "
+            "error:failed to parse status code]")
+      << service_config.status();
+}
+
+TEST_F(HedgingParserTest, InvalidHedgingPolicyWithRetryPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"retryPolicy\": {\n"
+      "      \"maxAttempts\": 2,\n"
+      "      \"initialBackoff\": \"1s\",\n"
+      "      \"maxBackoff\": \"120s\",\n"
+      "      \"backoffMultiplier\": 1.6,\n"
+      "      \"retryableStatusCodes\": [\"ABORTED\"]\n"
+      "    },\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, 1);
+  auto service_config = ServiceConfigImpl::Create(args, test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].hedgingPolicy "
+            "error:may not be specified together with retryPolicy]")
+      << service_config.status();
+}
+
+TEST(RetryBufferSizeTest, ShrinksPastHalfMemoryPressure) {
+  EXPECT_EQ(internal::RetryBufferSizeUnderMemoryPressure(1000, 0), 1000);
+  EXPECT_EQ(internal::RetryBufferSizeUnderMemoryPressure(1000, 0.5), 1000);
+  EXPECT_EQ(internal::RetryBufferSizeUnderMemoryPressure(1000, 0.75), 500);
+  EXPECT_EQ(internal::RetryBufferSizeUnderMemoryPressure(1000, 1), 0);
+}
+
+TEST(RetryBufferSizeTest, NothingIsBufferedWhenTheQuotaIsExhausted) {
+  MemoryQuota memory_quota("retry_buffer");
+  memory_quota.SetSize(1024 * 1024);
+  EXPECT_EQ(internal::RetryBufferSizeUnderMemoryPressure(
+                1000, memory_quota.GetPressure()),
+            1000);
+  auto owner = memory_quota.CreateMemoryOwner();
+  owner.Reserve(1024 * 1024);
+  EXPECT_EQ(internal::RetryBufferSizeUnderMemoryPressure(
+                1000, memory_quota.GetPressure()),
+            0);
+  owner.Release(1024 * 1024);
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -385,6 +386,128 @@ FUZZ_TEST(MyTestSuite, NeverExceedMaxBackoff)
     .WithDomains(AnyRetryMethodConfig(), VectorOf(AnyServerMetadata()),
                  AnyServerThrottleData());
 
+internal::HedgingMethodConfig MakeHedgingPolicy(absl::string_view json) {
+  auto json_obj = JsonParse(json);
+  CHECK_OK(json_obj) << json;
+  auto obj = LoadFromJson<internal::HedgingMethodConfig>(*json_obj);
+  CHECK_OK(obj) << json;
+  return std::move(*obj);
+}
+
+ServerMetadataHandle MakeTrailers(grpc_status_code status,
+                                  std::optional<Duration> pushback = {}) {
+  auto md = Arena::MakePooled<ServerMetadata>();
+  md->Set(GrpcStatusMetadata(), status);
+  if (pushback.has_value()) md->Set(GrpcRetryPushbackMsMetadata(), *pushback);
+  return md;
+}
+
+constexpr absl::string_view kHedgingPolicy =
+    "{\"maxAttempts\":3,\"hedgingDelay\":\"1s\","
+    "\"nonFatalStatusCodes\":[\"UNAVAILABLE\"]}";
+
+TEST(HedgingStateTest, SendsUpToMaxAttempts) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  HedgingState hedging_state(&policy, nullptr);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+              HedgingState::NextHedge::kSend);
+  }
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kDone);
+  EXPECT_EQ(hedging_state.num_attempts_started(), 3);
+}
+
+TEST(HedgingStateTest, CommittedCallSendsNoMoreHedges) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  HedgingState hedging_state(&policy, nullptr);
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kSend);
+  EXPECT_EQ(hedging_state.ShouldSendHedge(true),
+            HedgingState::NextHedge::kDone);
+}
+
+TEST(HedgingStateTest, OkAndFatalStatusesAreFinal) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  HedgingState hedging_state(&policy, nullptr);
+  EXPECT_EQ(hedging_state.AttemptFinished(*MakeTrailers(GRPC_STATUS_OK),
+                                          FuzzerDebugTag),
+            std::nullopt);
+  EXPECT_EQ(hedging_state.AttemptFinished(
+                *MakeTrailers(GRPC_STATUS_INVALID_ARGUMENT), FuzzerDebugTag),
+            std::nullopt);
+}
+
+TEST(HedgingStateTest, NonFatalFailureSendsNextHedgeAtOnce) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  HedgingState hedging_state(&policy, nullptr);
+  EXPECT_EQ(hedging_state.AttemptFinished(
+                *MakeTrailers(GRPC_STATUS_UNAVAILABLE), FuzzerDebugTag),
+            Duration::Zero());
+}
+
+TEST(HedgingStateTest, ThrottlingSuppressesOnlyFurtherHedges) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  // One failure uses up half of the tokens, which throttles.
+  auto throttle_data =
+      MakeRefCounted<internal::ServerRetryThrottleData>(2000, 1000, nullptr);
+  HedgingState hedging_state(&policy, throttle_data);
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kSend);
+  EXPECT_EQ(hedging_state.AttemptFinished(
+                *MakeTrailers(GRPC_STATUS_UNAVAILABLE), FuzzerDebugTag),
+            Duration::Zero());
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kThrottled);
+  EXPECT_EQ(hedging_state.num_attempts_started(), 1);
+  // Once throttling lifts, the remaining hedges may still be sent.
+  throttle_data->RecordSuccess();
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kSend);
+  EXPECT_EQ(hedging_state.num_attempts_started(), 2);
+}
+
+TEST(HedgingStateTest, FirstAttemptIsNeverThrottled) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  auto throttle_data =
+      MakeRefCounted<internal::ServerRetryThrottleData>(2000, 1000, nullptr);
+  throttle_data->RecordFailure();
+  ASSERT_TRUE(throttle_data->IsThrottled());
+  HedgingState hedging_state(&policy, throttle_data);
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kSend);
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kThrottled);
+}
+
+TEST(HedgingStateTest, ServerPushbackDelaysNextHedge) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  HedgingState hedging_state(&policy, nullptr);
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kSend);
+  EXPECT_EQ(
+      hedging_state.AttemptFinished(
+          *MakeTrailers(GRPC_STATUS_UNAVAILABLE, Duration::Seconds(5)),
+          FuzzerDebugTag),
+      Duration::Seconds(5));
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kSend);
+}
+
+TEST(HedgingStateTest, NegativeServerPushbackStopsHedging) {
+  auto policy = MakeHedgingPolicy(kHedgingPolicy);
+  HedgingState hedging_state(&policy, nullptr);
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kSend);
+  EXPECT_EQ(
+      hedging_state.AttemptFinished(
+          *MakeTrailers(GRPC_STATUS_UNAVAILABLE, Duration::Milliseconds(-1)),
+          FuzzerDebugTag),
+      Duration::Infinity());
+  EXPECT_EQ(hedging_state.ShouldSendHedge(false),
+            HedgingState::NextHedge::kDone);
+}
+
 }  // namespace
 }  // namespace retry_detail
 }  // namespace grpc_core
@@ -19,6 +19,7 @@
 #include "src/core/client_channel/retry_throttle.h"
 
 #include "gtest/gtest.h"
+#include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc_core {
@@ -95,6 +96,115 @@ TEST(ServerRetryThrottleData, Replacement) {
   EXPECT_FALSE(throttle_data->RecordFailure());
 }
 
+TEST(ServerRetryThrottleData, IsThrottled) {
+  // Max token count is 4, so threshold for retrying is 2.
+  // Each failure decrements by 1.  Each success increments by 1.
+  auto old_throttle_data =
+      MakeRefCounted<ServerRetryThrottleData>(4000, 1000, nullptr);
+  // token_count=4.  Checking does not consume a token.
+  EXPECT_FALSE(old_throttle_data->IsThrottled());
+  EXPECT_FALSE(old_throttle_data->IsThrottled());
+  // Failure: token_count=3.
+  EXPECT_TRUE(old_throttle_data->RecordFailure());
+  EXPECT_FALSE(old_throttle_data->IsThrottled());
+  // Failure: token_count=2.  At threshold.
+  EXPECT_FALSE(old_throttle_data->RecordFailure());
+  EXPECT_TRUE(old_throttle_data->IsThrottled());
+  // Success: token_count=3.
+  old_throttle_data->RecordSuccess();
+  EXPECT_FALSE(old_throttle_data->IsThrottled());
+  // Create new throttle data with the same parameters.
+  // Token count starts at 3 (ratio inherited from old_throttle_data).
+  auto throttle_data = MakeRefCounted<ServerRetryThrottleData>(
+      4000, 1000, old_throttle_data.get());
+  // Failure: token_count=2.  Seen via old_throttle_data.
+  EXPECT_FALSE(throttle_data->RecordFailure());
+  EXPECT_TRUE(old_throttle_data->IsThrottled());
+}
+
+// Records a failure and, if that allows it, the retry sent for it.
+bool TryRetry(ServerRetryThrottleData* throttle_data) {
+  if (!throttle_data->RecordFailure()) return false;
+  throttle_data->RecordRetry();
+  return true;
+}
+
+TEST(ServerRetryThrottleData, Budget) {
+  ScopedTimeCache time_cache;
+  auto set_now = [&](int64_t seconds) {
+    time_cache.TestOnlySetNow(Timestamp::FromMillisecondsAfterProcessEpoch(
+        seconds * 1000));
+  };
+  set_now(0);
+  // Retries may be up to half of the successes of the last 8s, which are
+  // counted in buckets of 1s.
+  auto throttle_data = MakeRefCounted<ServerRetryThrottleData>(
+      ServerRetryThrottleData::BudgetParams{50, 0, Duration::Seconds(8)},
+      nullptr);
+  // No successes yet, so no retries.
+  EXPECT_TRUE(throttle_data->IsThrottled());
+  EXPECT_FALSE(TryRetry(throttle_data.get()));
+  // 4 successes allow 2 retries.
+  for (int i = 0; i < 4; ++i) throttle_data->RecordSuccess();
+  EXPECT_FALSE(throttle_data->IsThrottled());
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_FALSE(TryRetry(throttle_data.get()));
+  EXPECT_TRUE(throttle_data->IsThrottled());
+  // 2 more successes a second later allow 1 more retry.
+  set_now(1);
+  throttle_data->RecordSuccess();
+  throttle_data->RecordSuccess();
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_FALSE(TryRetry(throttle_data.get()));
+  // Once the first second leaves the window, 2 successes and 1 retry are
+  // left in it.
+  set_now(8);
+  EXPECT_TRUE(throttle_data->IsThrottled());
+  throttle_data->RecordSuccess();
+  throttle_data->RecordSuccess();
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_FALSE(TryRetry(throttle_data.get()));
+  // After a whole window without successes, retries are throttled again.
+  set_now(16);
+  EXPECT_TRUE(throttle_data->IsThrottled());
+}
+
+TEST(ServerRetryThrottleData, BudgetMinRetriesPerSecond) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::FromMillisecondsAfterProcessEpoch(0));
+  // 1 retry per second over a 2s window allows 2 retries without any
+  // successes.
+  auto throttle_data = MakeRefCounted<ServerRetryThrottleData>(
+      ServerRetryThrottleData::BudgetParams{10, 1, Duration::Seconds(2)},
+      nullptr);
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_FALSE(TryRetry(throttle_data.get()));
+  // 10 successes allow 1 more.
+  for (int i = 0; i < 10; ++i) throttle_data->RecordSuccess();
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_FALSE(TryRetry(throttle_data.get()));
+}
+
+TEST(ServerRetryThrottleData, BudgetOnlyChargesRetriesSent) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::FromMillisecondsAfterProcessEpoch(0));
+  auto throttle_data = MakeRefCounted<ServerRetryThrottleData>(
+      ServerRetryThrottleData::BudgetParams{50, 0, Duration::Seconds(8)},
+      nullptr);
+  // 2 successes allow 1 retry.
+  throttle_data->RecordSuccess();
+  throttle_data->RecordSuccess();
+  // Failures that are not retried, e.g. because the call has no attempts
+  // left, do not use it up.
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(throttle_data->RecordFailure());
+  EXPECT_FALSE(throttle_data->IsThrottled());
+  throttle_data->RecordRetry();
+  EXPECT_TRUE(throttle_data->IsThrottled());
+  EXPECT_FALSE(throttle_data->RecordFailure());
+}
+
 TEST(ServerRetryThrottleMap, Replacement) {
   const std::string kServerName = "server_name";
   // Create old throttle data.
@@ -127,6 +237,31 @@ TEST(ServerRetryThrottleMap, Replacement) {
   EXPECT_FALSE(throttle_data->RecordFailure());
 }
 
+TEST(ServerRetryThrottleMap, ReplaceTokensWithBudget) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::FromMillisecondsAfterProcessEpoch(0));
+  const std::string kServerName = "budget_server_name";
+  const ServerRetryThrottleData::BudgetParams kBudget = {
+      50, 0, Duration::Seconds(10)};
+  auto old_throttle_data =
+      ServerRetryThrottleMap::Get()->GetDataForServer(kServerName, 4000, 1000);
+  EXPECT_FALSE(old_throttle_data->IsThrottled());
+  auto throttle_data =
+      ServerRetryThrottleMap::Get()->GetBudgetForServer(kServerName, kBudget);
+  EXPECT_NE(throttle_data, old_throttle_data);
+  ASSERT_NE(throttle_data->budget_params(), nullptr);
+  // The old entry uses the new budget, which starts out empty.
+  EXPECT_TRUE(old_throttle_data->IsThrottled());
+  old_throttle_data->RecordSuccess();
+  old_throttle_data->RecordSuccess();
+  EXPECT_TRUE(TryRetry(throttle_data.get()));
+  EXPECT_FALSE(TryRetry(throttle_data.get()));
+  // The same parameters get the same budget.
+  EXPECT_EQ(
+      ServerRetryThrottleMap::Get()->GetBudgetForServer(kServerName, kBudget),
+      throttle_data);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc_core
@@ -0,0 +1,137 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/client_channel/subchannel_connect_coordinator.h"
+
+#include <optional>
+
+#include "gtest/gtest.h"
+#include "src/core/util/backoff.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+BackOff::Options TestBackoffOptions() {
+  return BackOff::Options()
+      .set_initial_backoff(Duration::Seconds(1))
+      .set_multiplier(2.0)
+      .set_jitter(0.0)
+      .set_max_backoff(Duration::Seconds(10));
+}
+
+Timestamp At(int64_t millis) {
+  return Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+}
+
+// Records the delay a retry callback is invoked with.
+class Retry {
+ public:
+  SubchannelConnectCoordinator::RetryCallback Callback() {
+    return [this](Duration delay) { delay_ = delay; };
+  }
+
+  std::optional<Duration> delay() const { return delay_; }
+
+ private:
+  std::optional<Duration> delay_;
+};
+
+TEST(SubchannelConnectCoordinator, SharedPerAddress) {
+  auto a = SubchannelConnectCoordinator::ForAddress("ipv4:127.0.0.1:1",
+                                                    TestBackoffOptions());
+  auto b = SubchannelConnectCoordinator::ForAddress("ipv4:127.0.0.1:1",
+                                                    TestBackoffOptions());
+  auto c = SubchannelConnectCoordinator::ForAddress("ipv4:127.0.0.1:2",
+                                                    TestBackoffOptions());
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+}
+
+TEST(SubchannelConnectCoordinator, OneAttemptAtATime) {
+  auto coordinator = SubchannelConnectCoordinator::ForAddress(
+      "ipv4:127.0.0.1:3", TestBackoffOptions());
+  Retry first;
+  Retry second;
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(0), first.Callback()));
+  EXPECT_FALSE(coordinator->TryStartAttempt(At(10), second.Callback()));
+  EXPECT_FALSE(first.delay().has_value());
+  EXPECT_FALSE(second.delay().has_value());
+  // Once the attempt succeeds, the waiter goes ahead right away.
+  coordinator->AttemptFinished(At(20), /*connected=*/true);
+  EXPECT_FALSE(first.delay().has_value());
+  EXPECT_EQ(second.delay(), Duration::Zero());
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(20), second.Callback()));
+}
+
+TEST(SubchannelConnectCoordinator, HoldAfterFailure) {
+  auto coordinator = SubchannelConnectCoordinator::ForAddress(
+      "ipv4:127.0.0.1:4", TestBackoffOptions());
+  Retry first;
+  Retry waiter;
+  Retry late;
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(0), first.Callback()));
+  EXPECT_FALSE(coordinator->TryStartAttempt(At(0), waiter.Callback()));
+  coordinator->AttemptFinished(At(0), /*connected=*/false);
+  // The waiter comes back after the 1s hold, spread over another 20%.
+  ASSERT_TRUE(waiter.delay().has_value());
+  EXPECT_GE(*waiter.delay(), Duration::Seconds(1));
+  EXPECT_LE(*waiter.delay(), Duration::Milliseconds(1200));
+  // So does a subchannel asking during the hold.
+  EXPECT_FALSE(coordinator->TryStartAttempt(At(500), late.Callback()));
+  ASSERT_TRUE(late.delay().has_value());
+  EXPECT_GE(*late.delay(), Duration::Milliseconds(500));
+  EXPECT_LE(*late.delay(), Duration::Milliseconds(700));
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(1000), first.Callback()));
+}
+
+TEST(SubchannelConnectCoordinator, BackoffSharedAcrossSubchannels) {
+  auto coordinator = SubchannelConnectCoordinator::ForAddress(
+      "ipv4:127.0.0.1:5", TestBackoffOptions());
+  Retry retry;
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(0), retry.Callback()));
+  coordinator->AttemptFinished(At(0), /*connected=*/false);
+  // Another subchannel's attempt fails too: the hold doubles.
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(1000), retry.Callback()));
+  coordinator->AttemptFinished(At(1000), /*connected=*/false);
+  EXPECT_FALSE(coordinator->TryStartAttempt(At(2999), retry.Callback()));
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(3000), retry.Callback()));
+  // A success resets the backoff.
+  coordinator->AttemptFinished(At(3000), /*connected=*/true);
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(3000), retry.Callback()));
+  coordinator->AttemptFinished(At(3000), /*connected=*/false);
+  EXPECT_FALSE(coordinator->TryStartAttempt(At(3999), retry.Callback()));
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(4000), retry.Callback()));
+}
+
+TEST(SubchannelConnectCoordinator, ResetBackoff) {
+  auto coordinator = SubchannelConnectCoordinator::ForAddress(
+      "ipv4:127.0.0.1:6", TestBackoffOptions());
+  Retry retry;
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(0), retry.Callback()));
+  coordinator->AttemptFinished(At(0), /*connected=*/false);
+  coordinator->ResetBackoff();
+  EXPECT_TRUE(coordinator->TryStartAttempt(At(1), retry.Callback()));
+  EXPECT_FALSE(retry.delay().has_value());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
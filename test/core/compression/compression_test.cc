@@ -25,16 +25,19 @@
 
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/test_config.h"
 
 TEST(CompressionTest, CompressionAlgorithmParse) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
+      GRPC_COMPRESS_LZ4,
   };
   const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
 
@@ -64,11 +67,13 @@ TEST(CompressionTest, CompressionAlgorithmName) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
+      GRPC_COMPRESS_LZ4,
   };
 
   VLOG(2) << "test_compression_algorithm_name";
@@ -205,6 +210,65 @@ TEST(CompressionTest, CompressionAlgorithmForLevel) {
   }
 }
 
+TEST(CompressionTest, CompressionAlgorithmForLevelWithZstdAndLz4) {
+  const grpc_core::CompressionAlgorithmSet supported =
+      grpc_core::CompressionAlgorithmSet::Supported();
+
+  {
+    // zstd is preferred at every level, if it is built in
+    uint32_t accepted_encodings = 0;
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_NONE);  // always
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_GZIP);
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_DEFLATE);
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_LZ4);
+    const bool zstd = supported.IsSet(GRPC_COMPRESS_ZSTD);
+
+    ASSERT_EQ(GRPC_COMPRESS_NONE,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_NONE,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(zstd ? GRPC_COMPRESS_ZSTD : GRPC_COMPRESS_GZIP,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(zstd ? GRPC_COMPRESS_ZSTD : GRPC_COMPRESS_DEFLATE,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_MED,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(zstd ? GRPC_COMPRESS_ZSTD : GRPC_COMPRESS_DEFLATE,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                   accepted_encodings));
+  }
+
+  {
+    // lz4 is only used when nothing else is accepted
+    uint32_t accepted_encodings = 0;
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_NONE);  // always
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_LZ4);
+    const grpc_compression_algorithm expected =
+        supported.IsSet(GRPC_COMPRESS_LZ4) ? GRPC_COMPRESS_LZ4
+                                           : GRPC_COMPRESS_NONE;
+
+    ASSERT_EQ(GRPC_COMPRESS_NONE,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_NONE,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(expected,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(expected,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                   accepted_encodings));
+
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_GZIP);
+    ASSERT_EQ(GRPC_COMPRESS_GZIP,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                   accepted_encodings));
+  }
+}
+
 TEST(CompressionTest, CompressionEnableDisableAlgorithm) {
   grpc_compression_options options;
   grpc_compression_algorithm algorithm;
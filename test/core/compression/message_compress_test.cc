@@ -19,16 +19,22 @@
 #include "src/core/lib/compression/message_compress.h"
 
 #include <grpc/compression.h>
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/slice_buffer.h>
 #include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <memory>
+#include <string>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/slice_splitter.h"
 #include "test/core/test_util/test_config.h"
@@ -251,6 +257,155 @@ TEST(MessageCompressTest, BadDecompressionDataStream) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, DecompressionAfterBadData) {
+  grpc_core::ExecCtx exec_ctx;
+  for (grpc_compression_algorithm algorithm :
+       {GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP}) {
+    grpc_slice_buffer bad;
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&bad);
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&bad,
+                          grpc_slice_from_copied_buffer("\x78\xda\xff\xff", 4));
+    grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+    // The streams reused between messages must not keep the failure.
+    ASSERT_EQ(0, grpc_msg_decompress(algorithm, &bad, &output));
+    ASSERT_EQ(1, grpc_msg_compress(algorithm, &input, &compressed));
+    ASSERT_EQ(1, grpc_msg_decompress(algorithm, &compressed, &output));
+    grpc_slice joined = grpc_slice_merge(output.slices, output.count);
+    ASSERT_TRUE(grpc_slice_eq(joined, input.slices[0]));
+
+    grpc_slice_unref(joined);
+    grpc_slice_buffer_destroy(&bad);
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
+TEST(MessageCompressTest, SampleEntropy) {
+  grpc_slice_buffer repetitive;
+  grpc_slice_buffer text;
+  grpc_slice_buffer random;
+  grpc_slice_buffer_init(&repetitive);
+  grpc_slice_buffer_init(&text);
+  grpc_slice_buffer_init(&random);
+  grpc_slice_buffer_add(&repetitive, create_test_value(ONE_MB_A));
+  for (int i = 0; i < 1000; i++) {
+    grpc_slice_buffer_add(
+        &text, grpc_slice_from_copied_string("the quick brown fox jumps "));
+  }
+  // Small slices, so that the sample spans several of them.
+  uint32_t state = 1;
+  for (int i = 0; i < 1000; i++) {
+    grpc_slice slice = grpc_slice_malloc(100);
+    for (size_t j = 0; j < GRPC_SLICE_LENGTH(slice); j++) {
+      state = state * 1103515245 + 12345;
+      GRPC_SLICE_START_PTR(slice)[j] = static_cast<uint8_t>(state >> 24);
+    }
+    grpc_slice_buffer_add(&random, slice);
+  }
+
+  EXPECT_EQ(grpc_msg_sample_entropy(&repetitive), 0);
+  EXPECT_LT(grpc_msg_sample_entropy(&text), 5);
+  EXPECT_GT(grpc_msg_sample_entropy(&random), 7.5);
+
+  grpc_slice_buffer_destroy(&repetitive);
+  grpc_slice_buffer_destroy(&text);
+  grpc_slice_buffer_destroy(&random);
+}
+
+TEST(MessageCompressTest, DecompressionLimit) {
+  grpc_core::ExecCtx exec_ctx;
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const auto algorithm = static_cast<grpc_compression_algorithm>(i);
+    if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(algorithm)) {
+      continue;
+    }
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+    grpc_msg_compress(algorithm, &input, &compressed);
+
+    // A megabyte that compresses to almost nothing is refused before it is
+    // all decompressed.
+    EXPECT_EQ(-1, grpc_msg_decompress_with_limit(algorithm, &compressed,
+                                                 &output, input.length - 1));
+    EXPECT_EQ(output.length, 0);
+    EXPECT_EQ(output.count, 0);
+    ASSERT_EQ(1, grpc_msg_decompress_with_limit(algorithm, &compressed,
+                                                &output, input.length));
+    EXPECT_EQ(output.length, input.length);
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
+TEST(MessageCompressTest, ParallelCompression) {
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  grpc_core::ExecCtx exec_ctx;
+  // Compressible, but not so repetitive that a block can stand for the rest.
+  std::string value;
+  uint32_t state = 1;
+  while (value.size() < 5 * 1024 * 1024) {
+    state = state * 1103515245 + 12345;
+    absl::StrAppend(&value, "field", (state >> 16) % 1000, ",");
+  }
+  for (grpc_compression_algorithm algorithm :
+       {GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_ZSTD}) {
+    if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(algorithm)) {
+      continue;
+    }
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice slice =
+        grpc_slice_from_copied_buffer(value.data(), value.size());
+    grpc_split_slices_to_buffer(GRPC_SLICE_SPLIT_IDENTITY, &slice, 1, &input);
+    grpc_slice_unref(slice);
+
+    ASSERT_EQ(1, grpc_msg_compress_parallel(algorithm, GRPC_COMPRESS_LEVEL_MED,
+                                            &input, &compressed,
+                                            event_engine.get()));
+    // Both the usual and the parallel decompression read it.
+    for (bool parallel : {false, true}) {
+      grpc_slice_buffer output;
+      grpc_slice_buffer_init(&output);
+      ASSERT_EQ(1, parallel ? grpc_msg_decompress_parallel(
+                                  algorithm, &compressed, &output,
+                                  value.size(), event_engine.get())
+                            : grpc_msg_decompress(algorithm, &compressed,
+                                                  &output));
+      grpc_slice joined = grpc_slice_merge(output.slices, output.count);
+      EXPECT_EQ(grpc_core::StringViewFromSlice(joined), value);
+      grpc_slice_unref(joined);
+      grpc_slice_buffer_destroy(&output);
+    }
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&output);
+    EXPECT_EQ(-1, grpc_msg_decompress_parallel(algorithm, &compressed, &output,
+                                               value.size() - 1,
+                                               event_engine.get()));
+    EXPECT_EQ(output.length, 0);
+    grpc_slice_buffer_destroy(&output);
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+  }
+}
+
 TEST(MessageCompressTest, BadCompressionAlgorithm) {
   grpc_slice_buffer input;
   grpc_slice_buffer output;
@@ -312,6 +467,11 @@ int main(int argc, char** argv) {
                                                     GRPC_SLICE_SPLIT_IDENTITY,
                                                     GRPC_SLICE_SPLIT_ONE_BYTE};
   for (i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    // Algorithms this build does not have never compress.
+    if (!grpc_core::CompressionAlgorithmSet::Supported().IsSet(
+            static_cast<grpc_compression_algorithm>(i))) {
+      continue;
+    }
     for (j = 0; j < GPR_ARRAY_SIZE(uncompressed_split_modes); j++) {
       for (k = 0; k < GPR_ARRAY_SIZE(compressed_split_modes); k++) {
         for (m = 0; m < TEST_VALUE_COUNT; m++) {
@@ -0,0 +1,129 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/lib/compression/zstd_dictionary.h"
+
+#include <grpc/slice_buffer.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+std::string ExampleMessage(int i) {
+  return absl::StrCat("{\"user\":\"", i * 7919 % 100000,
+                      "\",\"region\":\"europe-west\",\"status\":\"ACTIVE\","
+                      "\"replica_of\":\"primary-cluster-a\",\"seq\":",
+                      i, "}");
+}
+
+std::string Flatten(SliceBuffer& buffer) {
+  return std::string(buffer.JoinIntoSlice().as_string_view());
+}
+
+class ZstdDictionaryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!CompressionAlgorithmSet::Supported().IsSet(GRPC_COMPRESS_ZSTD)) {
+      GTEST_SKIP() << "gRPC was built without zstd";
+    }
+  }
+
+  void TearDown() override { ResetZstdDictionariesForTesting(); }
+};
+
+TEST(ZstdDictionaryWithoutZstdTest, FailsIfNotBuiltIn) {
+  if (CompressionAlgorithmSet::Supported().IsSet(GRPC_COMPRESS_ZSTD)) {
+    GTEST_SKIP() << "gRPC was built with zstd";
+  }
+  EXPECT_EQ(ZstdDictionary::Create("abc", "content").status().code(),
+            absl::StatusCode::kUnimplemented);
+}
+
+TEST_F(ZstdDictionaryTest, RejectsInvalidIds) {
+  EXPECT_FALSE(ZstdDictionary::Create("", "content").ok());
+  EXPECT_FALSE(ZstdDictionary::Create("a,b", "content").ok());
+  EXPECT_FALSE(ZstdDictionary::Create("a b", "content").ok());
+  EXPECT_FALSE(ZstdDictionary::Create(std::string(65, 'a'), "content").ok());
+  EXPECT_TRUE(ZstdDictionary::Create("orders-v1.2_b", "content").ok());
+}
+
+TEST_F(ZstdDictionaryTest, Registry) {
+  EXPECT_TRUE(RegisteredZstdDictionaryIds().empty());
+  EXPECT_EQ(FindZstdDictionary("b"), nullptr);
+  RegisterZstdDictionary(*ZstdDictionary::Create("b", "content"));
+  RegisterZstdDictionary(*ZstdDictionary::Create("a", "content"));
+  EXPECT_EQ(RegisteredZstdDictionaryIds().as_string_view(), "a,b");
+  auto replacement = *ZstdDictionary::Create("b", "other content");
+  RegisterZstdDictionary(replacement);
+  EXPECT_EQ(FindZstdDictionary("b"), replacement);
+  EXPECT_EQ(RegisteredZstdDictionaryIds().as_string_view(), "a,b");
+}
+
+TEST_F(ZstdDictionaryTest, CompressesSmallMessagesBetter) {
+  std::vector<std::string> samples;
+  for (int i = 0; i < 2000; ++i) samples.push_back(ExampleMessage(i));
+  auto dictionary = ZstdDictionary::Train("orders", samples, 4096);
+  ASSERT_TRUE(dictionary.ok()) << dictionary.status();
+  for (grpc_compression_level level :
+       {GRPC_COMPRESS_LEVEL_LOW, GRPC_COMPRESS_LEVEL_MED,
+        GRPC_COMPRESS_LEVEL_HIGH}) {
+    const std::string message = ExampleMessage(123456);
+    SliceBuffer input;
+    input.Append(Slice::FromCopiedString(message));
+    SliceBuffer compressed;
+    ASSERT_EQ(grpc_msg_compress_zstd_with_dictionary(
+                  **dictionary, level, input.c_slice_buffer(),
+                  compressed.c_slice_buffer()),
+              1);
+    EXPECT_LT(compressed.Length() * 2, message.size());
+    SliceBuffer without_dictionary;
+    grpc_msg_compress_with_level(GRPC_COMPRESS_ZSTD, level,
+                                 input.c_slice_buffer(),
+                                 without_dictionary.c_slice_buffer());
+    EXPECT_LT(compressed.Length(), without_dictionary.Length());
+    // Only the dictionary decompresses it.
+    SliceBuffer output;
+    EXPECT_EQ(grpc_msg_decompress(GRPC_COMPRESS_ZSTD,
+                                  compressed.c_slice_buffer(),
+                                  output.c_slice_buffer()),
+              0);
+    ASSERT_EQ(grpc_msg_decompress_zstd_with_dictionary(
+                  **dictionary, compressed.c_slice_buffer(),
+                  output.c_slice_buffer(), message.size()),
+              1);
+    EXPECT_EQ(Flatten(output), message);
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
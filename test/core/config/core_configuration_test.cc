@@ -16,11 +16,18 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <memory>
 #include <thread>
 #include <vector>
 
+#include "absl/status/status.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/util/json/json.h"
+
 namespace grpc_core {
 
 // Allow substitution of config builder - in real code this would iterate
@@ -65,6 +72,56 @@ TEST(ConfigTest, ThreadedInit) {
   g_mock_builder = nullptr;
   CoreConfiguration::Get();
 }
+
+constexpr absl::string_view kLazyPolicy = "lazy_test";
+
+std::atomic<int> g_lazy_factories_created{0};
+
+class LazyFactory final : public LoadBalancingPolicyFactory {
+ public:
+  LazyFactory() { g_lazy_factories_created.fetch_add(1); }
+
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args) const override {
+    return nullptr;
+  }
+
+  absl::string_view name() const override { return kLazyPolicy; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json&) const override {
+    return absl::UnimplementedError("not parsed in this test");
+  }
+};
+
+TEST(ConfigTest, LazyLbPolicyFactoryIsCreatedOnFirstLookup) {
+  g_lazy_factories_created.store(0);
+  InitConfigWithBuilder([](CoreConfiguration::Builder* builder) {
+    builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+        kLazyPolicy, [] { return std::make_unique<LazyFactory>(); });
+  });
+  const auto& registry = CoreConfiguration::Get().lb_policy_registry();
+  EXPECT_EQ(g_lazy_factories_created.load(), 0);
+  // Existence checks alone do not need the factory.
+  EXPECT_TRUE(registry.LoadBalancingPolicyExists(kLazyPolicy, nullptr));
+  EXPECT_FALSE(registry.LoadBalancingPolicyExists("unknown", nullptr));
+  EXPECT_EQ(g_lazy_factories_created.load(), 0);
+  std::vector<std::thread> threads;
+  threads.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    threads.push_back(std::thread([&registry]() {
+      bool requires_config = false;
+      EXPECT_TRUE(
+          registry.LoadBalancingPolicyExists(kLazyPolicy, &requires_config));
+      EXPECT_TRUE(requires_config);
+    }));
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  EXPECT_EQ(g_lazy_factories_created.load(), 1);
+  CoreConfiguration::Reset();
+}
 }  // namespace
 
 }  // namespace grpc_core
@@ -29,6 +29,7 @@
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/util/bitset.h"
 #include "src/core/util/time.h"
 #include "test/core/end2end/end2end_tests.h"
@@ -133,7 +134,8 @@ class TestConfigurator {
     auto s = test_.RequestCall(100);
     test_.Expect(100, true);
     test_.Step();
-    EXPECT_TRUE(s.GetEncodingsAcceptedByPeer().all());
+    EXPECT_EQ(s.GetEncodingsAcceptedByPeer().ToInt<uint32_t>(),
+              CompressionAlgorithmSet::Supported().ToLegacyBitmask());
     IncomingCloseOnServer client_close;
     s.NewBatch(101).SendInitialMetadata({}).RecvCloseOnServer(client_close);
     for (int i = 0; i < 2; i++) {
@@ -185,7 +187,8 @@ class TestConfigurator {
     auto s = test_.RequestCall(100);
     test_.Expect(100, true);
     test_.Step();
-    EXPECT_TRUE(s.GetEncodingsAcceptedByPeer().all());
+    EXPECT_EQ(s.GetEncodingsAcceptedByPeer().ToInt<uint32_t>(),
+              CompressionAlgorithmSet::Supported().ToLegacyBitmask());
     IncomingCloseOnServer client_close;
     s.NewBatch(101).SendInitialMetadata({}).RecvCloseOnServer(client_close);
     for (int i = 0; i < 2; i++) {
@@ -235,7 +238,8 @@ class TestConfigurator {
     auto s = test_.RequestCall(100);
     test_.Expect(100, true);
     test_.Step();
-    EXPECT_TRUE(s.GetEncodingsAcceptedByPeer().all());
+    EXPECT_EQ(s.GetEncodingsAcceptedByPeer().ToInt<uint32_t>(),
+              CompressionAlgorithmSet::Supported().ToLegacyBitmask());
     IncomingCloseOnServer client_close;
     s.NewBatch(101)
         .SendInitialMetadata({}, 0, server_compression_level)
@@ -378,7 +382,9 @@ CORE_END2END_TEST(Http2SingleHopTests, RequestWithServerLevelDecompressInCore) {
 CORE_END2END_TEST(Http2SingleHopTests, RequestWithServerLevelDecompressInApp) {
   TestConfigurator(*this)
       .DecompressInApp()
-      .ExpectedAlgorithmFromServer(GRPC_COMPRESS_DEFLATE)
+      .ExpectedAlgorithmFromServer(
+          CompressionAlgorithmSet::Supported().CompressionAlgorithmForLevel(
+              GRPC_COMPRESS_LEVEL_HIGH))
       .RequestWithServerLevel(GRPC_COMPRESS_LEVEL_HIGH);
 }
 
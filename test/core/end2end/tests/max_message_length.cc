@@ -184,6 +184,38 @@ CORE_END2END_TEST(CoreEnd2endTests,
   TestMaxMessageLengthOnServerOnRequest(*this);
 }
 
+CORE_END2END_TEST(CoreEnd2endTests,
+                  MaxMessageLengthOnServerOnLargeRequestViaChannelArg) {
+  SKIP_IF_MINSTACK();
+  // Spans many DATA frames, so the transport sees the length prefix long
+  // before the message is complete.
+  InitServer(ChannelArgs().Set(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, 1024));
+  InitClient(ChannelArgs());
+  auto c = NewClientCall("/service/method").Create();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessage(std::string(1024 * 1024, 'a'))
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s = RequestCall(101);
+  Expect(101, true);
+  Step();
+  IncomingCloseOnServer client_close;
+  IncomingMessage client_message;
+  s.NewBatch(102).RecvCloseOnServer(client_close).RecvMessage(client_message);
+  Expect(102, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(s.method(), "/service/method");
+  EXPECT_TRUE(client_close.was_cancelled());
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_RESOURCE_EXHAUSTED);
+  EXPECT_EQ(server_status.message(),
+            "SERVER: Received message larger than max (1048576 vs. 1024)");
+}
+
 CORE_END2END_TEST(CoreEnd2endTests,
                   MaxMessageLengthOnClientOnResponseViaChannelArg) {
   SKIP_IF_MINSTACK();
@@ -0,0 +1,127 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/status.h>
+
+#include <optional>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/util/time.h"
+#include "test/core/end2end/end2end_tests.h"
+
+namespace grpc_core {
+namespace {
+
+ChannelArgs HedgingClientArgs() {
+  return ChannelArgs()
+      .Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, true)
+      .Set(GRPC_ARG_SERVICE_CONFIG,
+           "{\n"
+           "  \"methodConfig\": [ {\n"
+           "    \"name\": [\n"
+           "      { \"service\": \"service\", \"method\": \"method\" }\n"
+           "    ],\n"
+           "    \"hedgingPolicy\": {\n"
+           "      \"maxAttempts\": 2,\n"
+           "      \"hedgingDelay\": \"0s\",\n"
+           "      \"nonFatalStatusCodes\": [ \"UNAVAILABLE\" ]\n"
+           "    }\n"
+           "  } ]\n"
+           "}");
+}
+
+// Tests that both hedges are sent at once, and that a non-fatal failure of
+// one of them does not fail the call while the other is still in flight.
+// - 2 attempts, no hedging delay, UNAVAILABLE is non-fatal
+// - first attempt gets UNAVAILABLE
+// - second attempt succeeds
+CORE_END2END_TEST(RetryTests, RetryHedgingNonFatalFailure) {
+  if (!(test_config()->feature_mask & FEATURE_MASK_IS_CALL_V3) ||
+      !IsRetryInCallv3Enabled()) {
+    GTEST_SKIP() << "hedging is only supported by the v3 call stack";
+  }
+  InitServer(ChannelArgs());
+  InitClient(HedgingClientArgs());
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Seconds(5)).Create();
+  IncomingMetadata server_initial_metadata;
+  IncomingMessage server_message;
+  IncomingStatusOnClient server_status;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessage("foo")
+      .RecvMessage(server_message)
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  std::optional<IncomingCall> s1 = RequestCall(101);
+  Expect(101, true);
+  Step();
+  std::optional<IncomingCall> s2 = RequestCall(201);
+  Expect(201, true);
+  Step();
+  // A trailers-only response, since server initial metadata would commit the
+  // call to this attempt.
+  IncomingCloseOnServer client_close1;
+  s1->NewBatch(102)
+      .SendStatusFromServer(GRPC_STATUS_UNAVAILABLE, "xyz", {})
+      .RecvCloseOnServer(client_close1);
+  Expect(102, true);
+  Step();
+  IncomingMessage client_message;
+  s2->NewBatch(202).RecvMessage(client_message);
+  Expect(202, true);
+  Step();
+  IncomingCloseOnServer client_close2;
+  s2->NewBatch(203)
+      .SendInitialMetadata({})
+      .SendMessage("bar")
+      .SendStatusFromServer(GRPC_STATUS_OK, "xyz", {})
+      .RecvCloseOnServer(client_close2);
+  Expect(203, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+  EXPECT_EQ(server_message.payload(), "bar");
+  EXPECT_EQ(client_message.payload(), "foo");
+  EXPECT_EQ(s2->method(), "/service/method");
+  EXPECT_FALSE(client_close2.was_cancelled());
+}
+
+// Tests that the legacy stack, which cannot hedge, fails hedged calls
+// rather than sending them as unhedged ones.
+CORE_END2END_TEST(RetryTests, RetryHedgingUnsupportedOnLegacyStack) {
+  if (test_config()->feature_mask & FEATURE_MASK_IS_CALL_V3) {
+    GTEST_SKIP() << "the v3 call stack supports hedging";
+  }
+  InitServer(ChannelArgs());
+  InitClient(HedgingClientArgs());
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Seconds(5)).Create();
+  IncomingMetadata server_initial_metadata;
+  IncomingStatusOnClient server_status;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_UNIMPLEMENTED);
+}
+
+}  // namespace
+}  // namespace grpc_core
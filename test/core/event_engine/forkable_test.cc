@@ -29,6 +29,7 @@
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
 #include "src/core/config/config_vars.h"
+#include "src/core/util/fork.h"
 #include "src/core/util/no_destruct.h"
 
 namespace {
@@ -151,14 +152,17 @@ TEST_F(ForkableTest, NonPthreadManualForkOperations) {
   forkable_manager.RegisterForkable(forkable, NoopForkCallbackMethods::Prefork,
                                     NoopForkCallbackMethods::PostforkParent,
                                     NoopForkCallbackMethods::PostforkChild);
+  const uint64_t fork_generation = grpc_core::Fork::ForkGeneration();
   forkable->AssertStates(/*prepare=*/false, /*parent=*/false, /*child=*/false);
   forkable_manager.Prefork();
   forkable->AssertStates(/*prepare=*/true, /*parent=*/false, /*child=*/false);
   forkable_manager.PostforkParent();
   forkable->AssertStates(/*prepare=*/true, /*parent=*/true, /*child=*/false);
+  EXPECT_EQ(grpc_core::Fork::ForkGeneration(), fork_generation);
   forkable_manager.Prefork();
   forkable_manager.PostforkChild();
   forkable->AssertStates(/*prepare=*/true, /*parent=*/true, /*child=*/true);
+  EXPECT_NE(grpc_core::Fork::ForkGeneration(), fork_generation);
 }
 
 int main(int argc, char** argv) {
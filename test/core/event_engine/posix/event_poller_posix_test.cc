@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/grpc.h>
 #include <stdint.h>
 #include <sys/select.h>
@@ -21,6 +23,8 @@
 #include <chrono>
 #include <cstring>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "absl/status/statusor.h"
@@ -52,6 +56,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "src/core/lib/event_engine/common_closures.h"
@@ -697,6 +702,210 @@ TEST_F(EventPollerTest, TestMultipleHandles) {
   worker->Wait();
 }
 
+// Runs Work() until done() returns true, failing the test after 10 seconds.
+template <typename F>
+void WorkUntil(F done) {
+  auto deadline = std::chrono::steady_clock::now() + 10s;
+  while (!done()) {
+    ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+    g_event_poller->Work(100ms, []() {});
+  }
+}
+
+// Completions that carry no event, such as those of orphaned handles, must
+// not restart the timeout of Work().
+TEST_F(EventPollerTest, TestWorkTimeoutSurvivesIgnoredCompletions) {
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  std::atomic<bool> stop{false};
+  std::thread churn([&stop]() {
+    while (!stop.load()) {
+      int sv[2];
+      CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+      EventHandle* handle =
+          g_event_poller->CreateHandle(sv[0], "churn", false);
+      handle->OrphanHandle(nullptr, nullptr, "");
+      close(sv[1]);
+      std::this_thread::sleep_for(10ms);
+    }
+  });
+  const auto start = std::chrono::steady_clock::now();
+  auto result = g_event_poller->Work(100ms, []() {});
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  stop.store(true);
+  churn.join();
+  // Pollers that kick themselves on new handles return early.
+  if (g_event_poller->Name() == "io_uring") {
+    EXPECT_EQ(result, Poller::WorkResult::kDeadlineExceeded);
+  }
+  EXPECT_LT(elapsed, 1s);
+}
+
+// The io_uring poller accepts connections on its own, and hands them out
+// through TakeAcceptedFd().
+TEST_F(EventPollerTest, TestMultishotAccept) {
+  if (g_event_poller == nullptr || g_event_poller->Name() != "io_uring") {
+    GTEST_SKIP() << "Only the io_uring poller accepts connections itself";
+  }
+  static constexpr int kNumConnections = 3;
+  int listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+  ASSERT_GE(listen_fd, 0);
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t len = sizeof(addr);
+  ASSERT_EQ(bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), len), 0);
+  ASSERT_EQ(listen(listen_fd, MAX_NUM_FD), 0);
+  ASSERT_EQ(getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &len),
+            0);
+  EventHandle* handle = g_event_poller->CreateHandle(listen_fd, "listener",
+                                                     false);
+  ASSERT_TRUE(handle->StartMultishotAccept());
+  std::vector<int> clients;
+  for (int i = 0; i < kNumConnections; ++i) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(connect(fd, reinterpret_cast<sockaddr*>(&addr), len), 0);
+    clients.push_back(fd);
+  }
+  std::vector<int> accepted;
+  WorkUntil([&]() {
+    int fd;
+    while ((fd = handle->TakeAcceptedFd()) >= 0) accepted.push_back(fd);
+    EXPECT_EQ(errno, EAGAIN);
+    return accepted.size() == kNumConnections;
+  });
+  for (int fd : accepted) {
+    EXPECT_NE(fcntl(fd, F_GETFL) & O_NONBLOCK, 0);
+    close(fd);
+  }
+  for (int fd : clients) close(fd);
+  handle->ShutdownHandle(absl::CancelledError("done"));
+  handle->OrphanHandle(nullptr, nullptr, "");
+}
+
+// The io_uring poller receives into its own buffers, and RecvMsg() copies out
+// of them, then reports the end of the stream.
+TEST_F(EventPollerTest, TestMultishotRecv) {
+  if (g_event_poller == nullptr || g_event_poller->Name() != "io_uring") {
+    GTEST_SKIP() << "Only the io_uring poller receives itself";
+  }
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+  EventHandle* handle = g_event_poller->CreateHandle(sv[0], "recv", false);
+  if (!handle->StartMultishotRecv()) {
+    handle->OrphanHandle(nullptr, nullptr, "");
+    close(sv[1]);
+    GTEST_SKIP() << "The kernel can't provide receive buffers";
+  }
+  const std::string kData = "hello from the other side";
+  ASSERT_EQ(write(sv[1], kData.data(), kData.size()),
+            static_cast<ssize_t>(kData.size()));
+  std::string received;
+  auto recv = [&]() {
+    char buf[8];
+    iovec iov{buf, sizeof(buf)};
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    int64_t n = handle->RecvMsg(&msg);
+    if (n > 0) received.append(buf, n);
+    return n;
+  };
+  WorkUntil([&]() {
+    while (recv() > 0) {
+    }
+    return received.size() == kData.size();
+  });
+  EXPECT_EQ(received, kData);
+  close(sv[1]);
+  int64_t result = -1;
+  WorkUntil([&]() {
+    result = recv();
+    return result >= 0 || errno != EAGAIN;
+  });
+  EXPECT_EQ(result, 0);
+  handle->ShutdownHandle(absl::CancelledError("done"));
+  handle->OrphanHandle(nullptr, nullptr, "");
+}
+
+// The io_uring poller sends data it is handed with its next submission, and
+// reports the bytes sent through TakeSendResult().
+TEST_F(EventPollerTest, TestSendAsync) {
+  if (g_event_poller == nullptr || g_event_poller->Name() != "io_uring") {
+    GTEST_SKIP() << "Only the io_uring poller sends itself";
+  }
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+  EventHandle* handle = g_event_poller->CreateHandle(sv[0], "send", false);
+  ASSERT_TRUE(handle->CanSendAsync());
+  SliceBuffer data;
+  data.Append(Slice::FromCopiedString("hello "));
+  data.Append(Slice::FromCopiedString("world"));
+  ASSERT_TRUE(handle->SendAsync(data));
+  EXPECT_EQ(data.Length(), 0u);
+  int64_t result = 0;
+  WorkUntil([&]() { return handle->TakeSendResult(&result); });
+  EXPECT_EQ(result, 11);
+  char buf[16];
+  ASSERT_EQ(read(sv[1], buf, sizeof(buf)), 11);
+  EXPECT_EQ(absl::string_view(buf, 11), "hello world");
+  close(sv[1]);
+  handle->ShutdownHandle(absl::CancelledError("done"));
+  handle->OrphanHandle(nullptr, nullptr, "");
+}
+
+// Data the io_uring poller already received can't be handed back to the
+// socket, so releasing the fd closes it instead of giving it away with a hole
+// in the stream.
+TEST_F(EventPollerTest, TestReleaseWithReceivedDataClosesFd) {
+  if (g_event_poller == nullptr || g_event_poller->Name() != "io_uring") {
+    GTEST_SKIP() << "Only the io_uring poller receives itself";
+  }
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+  EventHandle* handle = g_event_poller->CreateHandle(sv[0], "release", false);
+  if (!handle->StartMultishotRecv()) {
+    handle->OrphanHandle(nullptr, nullptr, "");
+    close(sv[1]);
+    GTEST_SKIP() << "The kernel can't provide receive buffers";
+  }
+  std::atomic<bool> readable{false};
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&readable](absl::Status /*status*/) { readable.store(true); }));
+  ASSERT_EQ(write(sv[1], "unread", 6), 6);
+  WorkUntil([&]() { return readable.load(); });
+  handle->ShutdownHandle(absl::CancelledError("done"));
+  int release_fd = sv[0];
+  handle->OrphanHandle(nullptr, &release_fd, "");
+  EXPECT_EQ(release_fd, -1);
+  EXPECT_EQ(fcntl(sv[0], F_GETFD), -1);
+  close(sv[1]);
+}
+
+// A handle orphaned while the kernel still has its send leaves the op to the
+// poller, which frees it when the cancellation completes or, as here, when
+// the ring is closed before that. Leak checkers catch a missing free.
+TEST_F(EventPollerTest, TestOrphanedSendIsFreed) {
+  if (g_event_poller == nullptr || g_event_poller->Name() != "io_uring") {
+    GTEST_SKIP() << "Only the io_uring poller sends itself";
+  }
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+  EventHandle* handle = g_event_poller->CreateHandle(sv[0], "send", false);
+  ASSERT_TRUE(handle->CanSendAsync());
+  // Nobody reads the other end, so the send can't complete.
+  SliceBuffer data;
+  data.Append(Slice::FromCopiedString(std::string(16 * 1024 * 1024, 'a')));
+  ASSERT_TRUE(handle->SendAsync(data));
+  handle->ShutdownHandle(absl::CancelledError("done"));
+  handle->OrphanHandle(nullptr, nullptr, "");
+  close(sv[1]);
+}
+
 }  // namespace
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -76,7 +76,9 @@ struct Connection {
 std::list<Connection> CreateConnectedEndpoints(
     PosixEventPoller& poller, bool is_zero_copy_enabled, int num_connections,
     std::shared_ptr<EventEngine> posix_ee,
-    std::shared_ptr<EventEngine> oracle_ee) {
+    std::shared_ptr<EventEngine> oracle_ee,
+    bool is_shared_read_buffer_enabled = false,
+    int read_buffer_idle_timeout_ms = 0) {
   std::list<Connection> connections;
   auto memory_quota = std::make_unique<grpc_core::MemoryQuota>("bar");
   std::string target_addr = absl::StrCat(
@@ -101,6 +103,13 @@ std::list<Connection> CreateConnectedEndpoints(
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
   }
+  if (is_shared_read_buffer_enabled) {
+    args = args.Set(GRPC_ARG_TCP_SHARED_READ_BUFFER, 1);
+  }
+  if (read_buffer_idle_timeout_ms > 0) {
+    args = args.Set(GRPC_ARG_TCP_READ_BUFFER_IDLE_TIMEOUT_MS,
+                    read_buffer_idle_timeout_ms);
+  }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
       std::move(accept_cb),
@@ -266,6 +275,64 @@ TEST_P(PosixEndpointTest, ConnectExchangeBidiDataTransferTest) {
   worker->Wait();
 }
 
+// Same as above, with the client endpoints reading through the shared read
+// buffer, interleaving reads across connections.
+TEST_P(PosixEndpointTest, SharedReadBufferExchangeDataTransferTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), kNumConnections, GetPosixEE(),
+        GetOracleEE(), /*is_shared_read_buffer_enabled=*/true);
+    for (int i = 0; i < kNumExchangedMessages; i++) {
+      for (auto& connection : connections) {
+        ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                        connection.server_endpoint.get(),
+                                        connection.client_endpoint.get())
+                        .ok());
+        ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                        connection.client_endpoint.get(),
+                                        connection.server_endpoint.get())
+                        .ok());
+      }
+    }
+  }
+  worker->Wait();
+}
+
+// Same as above, with the client endpoints trimming their read buffers
+// whenever they go idle between exchanges, including while a read is pending.
+TEST_P(PosixEndpointTest, IdleReadBufferTrimExchangeDataTransferTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), kNumConnections, GetPosixEE(),
+        GetOracleEE(), /*is_shared_read_buffer_enabled=*/false,
+        /*read_buffer_idle_timeout_ms=*/1);
+    for (int i = 0; i < kNumExchangedMessages; i++) {
+      for (auto& connection : connections) {
+        ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                        connection.server_endpoint.get(),
+                                        connection.client_endpoint.get())
+                        .ok());
+        ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                        connection.client_endpoint.get(),
+                                        connection.server_endpoint.get())
+                        .ok());
+      }
+      if (i % 10 == 0) std::this_thread::sleep_for(5ms);
+    }
+  }
+  worker->Wait();
+}
+
 // Create  N connections and exchange and verify random number of messages over
 // each connection in parallel.
 TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
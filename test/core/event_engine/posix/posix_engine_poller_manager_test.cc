@@ -0,0 +1,155 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+namespace grpc_event_engine::experimental {
+namespace {
+
+using ::testing::ElementsAre;
+
+// Keeps the closures it is given until the test runs them.
+class QueueingThreadPool : public ThreadPool {
+ public:
+  void Quiesce() override {}
+  void Run(absl::AnyInvocable<void()> callback) override {
+    Run(SelfDeletingClosure::Create(std::move(callback)));
+  }
+  void Run(EventEngine::Closure* closure) override {
+    grpc_core::MutexLock lock(&mu_);
+    closures_.push_back(closure);
+  }
+  void PrepareFork() override {}
+  void PostforkParent() override {}
+  void PostforkChild() override {}
+
+  size_t size() {
+    grpc_core::MutexLock lock(&mu_);
+    return closures_.size();
+  }
+  void RunAll() {
+    std::vector<EventEngine::Closure*> closures;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      closures.swap(closures_);
+    }
+    for (EventEngine::Closure* closure : closures) closure->Run();
+  }
+
+ private:
+  grpc_core::Mutex mu_;
+  std::vector<EventEngine::Closure*> closures_ ABSL_GUARDED_BY(mu_);
+};
+
+class PosixEnginePollerManagerTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<QueueingThreadPool> executor_ =
+      std::make_shared<QueueingThreadPool>();
+  std::shared_ptr<PosixEnginePollerManager> poller_manager_ =
+      std::make_shared<PosixEnginePollerManager>(executor_);
+};
+
+TEST_F(PosixEnginePollerManagerTest, RunsDeferredClosuresOnThisThread) {
+  std::vector<EventEngine::Closure*> deferred;
+  std::vector<int> ran;
+  poller_manager_->DeferClosuresOnThisThread(&deferred);
+  for (int i = 0; i < 3; ++i) {
+    poller_manager_->Run([&ran, i] { ran.push_back(i); });
+  }
+  EXPECT_EQ(deferred.size(), 3u);
+  EXPECT_TRUE(ran.empty());
+  poller_manager_->RunDeferredClosures();
+  EXPECT_THAT(ran, ElementsAre(0, 1, 2));
+  EXPECT_EQ(executor_->size(), 0u);
+}
+
+TEST_F(PosixEnginePollerManagerTest, HandsClosuresOverTheCapToTheExecutor) {
+  constexpr int kInline = PosixEnginePollerManager::kMaxInlineClosures;
+  std::vector<EventEngine::Closure*> deferred;
+  std::vector<int> ran;
+  size_t queued_when_first_ran = 0;
+  poller_manager_->DeferClosuresOnThisThread(&deferred);
+  poller_manager_->Run([&] {
+    queued_when_first_ran = executor_->size();
+    ran.push_back(0);
+  });
+  for (int i = 1; i < kInline + 3; ++i) {
+    poller_manager_->Run([&ran, i] { ran.push_back(i); });
+  }
+  poller_manager_->RunDeferredClosures();
+  // The overflow was queued before any closure ran here.
+  EXPECT_EQ(queued_when_first_ran, 3u);
+  ASSERT_EQ(ran.size(), static_cast<size_t>(kInline));
+  EXPECT_EQ(ran.back(), kInline - 1);
+  EXPECT_EQ(executor_->size(), 3u);
+  executor_->RunAll();
+  EXPECT_THAT(std::vector<int>(ran.begin() + kInline, ran.end()),
+              ElementsAre(kInline, kInline + 1, kInline + 2));
+}
+
+TEST_F(PosixEnginePollerManagerTest, StopsDeferringAfterRunningDeferred) {
+  std::vector<EventEngine::Closure*> deferred;
+  poller_manager_->DeferClosuresOnThisThread(&deferred);
+  poller_manager_->RunDeferredClosures();
+  bool ran = false;
+  poller_manager_->Run([&ran] { ran = true; });
+  EXPECT_TRUE(deferred.empty());
+  EXPECT_FALSE(ran);
+  EXPECT_EQ(executor_->size(), 1u);
+  executor_->RunAll();
+  EXPECT_TRUE(ran);
+}
+
+TEST_F(PosixEnginePollerManagerTest, OnlyDefersClosuresFromThePollingThread) {
+  std::vector<EventEngine::Closure*> deferred;
+  poller_manager_->DeferClosuresOnThisThread(&deferred);
+  std::thread other([this] { poller_manager_->Run([] {}); });
+  other.join();
+  EXPECT_TRUE(deferred.empty());
+  EXPECT_EQ(executor_->size(), 1u);
+  poller_manager_->RunDeferredClosures();
+  executor_->RunAll();
+}
+
+}  // namespace
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
@@ -0,0 +1,173 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_format.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/ares_resolver.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/wait_for_single_owner.h"
+#include "test/core/test_util/fake_udp_and_tcp_server.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using grpc_core::testing::FakeUdpAndTcpServer;
+
+// A lookup that never gets an answer from its DNS server, so that it only
+// completes when its c-ares resolver is shut down.
+class PendingLookup {
+ public:
+  explicit PendingLookup(EventEngine::DNSResolver& resolver) {
+    resolver.LookupHostname(
+        [this](absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+                   result) {
+          status_ = result.status();
+          done_.Notify();
+        },
+        "never-resolved.test.com:443", "443");
+  }
+
+  bool done() { return done_.HasBeenNotified(); }
+
+  absl::Status WaitForStatus() {
+    done_.WaitForNotification();
+    return status_;
+  }
+
+ private:
+  absl::Status status_;
+  grpc_core::Notification done_;
+};
+
+class SharedDnsResolverTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(grpc_core::IsSharedAresResolverEnabled());
+    if (!ShouldUseAresDnsResolver()) {
+      GTEST_SKIP() << "The engine only shares c-ares resolvers.";
+    }
+  }
+
+  static std::unique_ptr<FakeUdpAndTcpServer> NewNonResponsiveServer() {
+    return std::make_unique<FakeUdpAndTcpServer>(
+        FakeUdpAndTcpServer::AcceptMode::kWaitForClientToSendFirstBytes,
+        FakeUdpAndTcpServer::CloseSocketUponCloseFromPeer);
+  }
+
+  static std::unique_ptr<EventEngine::DNSResolver> NewResolver(
+      EventEngine& engine, FakeUdpAndTcpServer& server) {
+    EventEngine::DNSResolver::ResolverOptions options;
+    options.dns_server = absl::StrFormat("[::1]:%d", server.port());
+    auto resolver = engine.GetDNSResolver(options);
+    if (!resolver.ok()) {
+      ADD_FAILURE() << resolver.status();
+      return nullptr;
+    }
+    return std::move(*resolver);
+  }
+};
+
+TEST_F(SharedDnsResolverTest, ResolversForOneServerShareLookups) {
+  auto server = NewNonResponsiveServer();
+  auto engine = std::make_shared<PosixEventEngine>();
+  auto first = NewResolver(*engine, *server);
+  auto second = NewResolver(*engine, *server);
+  PendingLookup lookup(*first);
+  // The second resolver still uses the c-ares resolver of the first one, so
+  // destroying the first does not cancel its lookup.
+  first.reset();
+  absl::SleepFor(absl::Milliseconds(100));
+  EXPECT_FALSE(lookup.done());
+  // Destroying the last one does.
+  second.reset();
+  EXPECT_EQ(lookup.WaitForStatus().code(), absl::StatusCode::kCancelled);
+  grpc_core::WaitForSingleOwner(std::move(engine));
+}
+
+TEST_F(SharedDnsResolverTest, ResolversForDifferentServersAreNotShared) {
+  auto first_server = NewNonResponsiveServer();
+  auto second_server = NewNonResponsiveServer();
+  auto engine = std::make_shared<PosixEventEngine>();
+  auto first = NewResolver(*engine, *first_server);
+  auto second = NewResolver(*engine, *second_server);
+  PendingLookup lookup(*first);
+  first.reset();
+  EXPECT_EQ(lookup.WaitForStatus().code(), absl::StatusCode::kCancelled);
+  second.reset();
+  grpc_core::WaitForSingleOwner(std::move(engine));
+}
+
+TEST_F(SharedDnsResolverTest, SharedResolverOutlivesTheCallersEngineRef) {
+  auto server = NewNonResponsiveServer();
+  auto engine = std::make_shared<PosixEventEngine>();
+  auto first = NewResolver(*engine, *server);
+  auto second = NewResolver(*engine, *server);
+  // The shared c-ares resolver keeps the engine alive.
+  engine.reset();
+  PendingLookup lookup(*second);
+  second.reset();
+  EXPECT_FALSE(lookup.done());
+  first.reset();
+  EXPECT_EQ(lookup.WaitForStatus().code(), absl::StatusCode::kCancelled);
+}
+
+TEST_F(SharedDnsResolverTest, NewResolverAfterTheLastOneIsDestroyed) {
+  auto server = NewNonResponsiveServer();
+  auto engine = std::make_shared<PosixEventEngine>();
+  auto first = NewResolver(*engine, *server);
+  PendingLookup first_lookup(*first);
+  first.reset();
+  EXPECT_EQ(first_lookup.WaitForStatus().code(),
+            absl::StatusCode::kCancelled);
+  // The engine makes a new c-ares resolver rather than handing out the
+  // orphaned one.
+  auto second = NewResolver(*engine, *server);
+  PendingLookup second_lookup(*second);
+  absl::SleepFor(absl::Milliseconds(100));
+  EXPECT_FALSE(second_lookup.done());
+  second.reset();
+  EXPECT_EQ(second_lookup.WaitForStatus().code(),
+            absl::StatusCode::kCancelled);
+  grpc_core::WaitForSingleOwner(std::move(engine));
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  grpc_core::ForceEnableExperiment("shared_ares_resolver", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
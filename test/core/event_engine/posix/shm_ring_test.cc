@@ -0,0 +1,195 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/shm_ring.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+absl::Span<const uint8_t> Bytes(absl::string_view s) {
+  return absl::MakeConstSpan(reinterpret_cast<const uint8_t*>(s.data()),
+                             s.size());
+}
+
+std::string AsString(absl::StatusOr<absl::Span<const uint8_t>> bytes) {
+  EXPECT_TRUE(bytes.ok()) << bytes.status();
+  if (!bytes.ok()) return "";
+  return std::string(reinterpret_cast<const char*>(bytes->data()),
+                     bytes->size());
+}
+
+bool IsReadable(int fd) {
+  struct pollfd pfd = {fd, POLLIN, 0};
+  return poll(&pfd, 1, 0) == 1;
+}
+
+// Attaches a second mapping of the ring, as the peer process would.
+std::unique_ptr<ShmRing> AttachPeer(const ShmRing& ring) {
+  auto peer = ShmRing::Attach(dup(ring.memfd()), dup(ring.data_fd()),
+                              dup(ring.space_fd()));
+  EXPECT_TRUE(peer.ok()) << peer.status();
+  return std::move(*peer);
+}
+
+TEST(ShmRingTest, CapacityIsRoundedUpToPages) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  const size_t page = sysconf(_SC_PAGESIZE);
+  EXPECT_EQ((*ring)->capacity(), page);
+  ring = ShmRing::Create(3 * page);
+  ASSERT_TRUE(ring.ok());
+  EXPECT_EQ((*ring)->capacity(), 4 * page);
+}
+
+TEST(ShmRingTest, BytesAreVisibleToPeer) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  std::unique_ptr<ShmRing> peer = AttachPeer(**ring);
+  EXPECT_FALSE(IsReadable(peer->data_fd()));
+  EXPECT_EQ(*(*ring)->Write(Bytes("hello ")), 6);
+  EXPECT_TRUE(IsReadable(peer->data_fd()));
+  EXPECT_EQ(*(*ring)->Write(Bytes("world")), 5);
+  EXPECT_EQ(AsString(peer->Peek()), "hello world");
+  peer->Consume(6);
+  EXPECT_EQ(AsString(peer->Peek()), "world");
+  peer->Consume(5);
+  EXPECT_EQ(AsString(peer->Peek()), "");
+  EXPECT_TRUE(peer->ConsumeDataWakeup().ok());
+  EXPECT_FALSE(IsReadable(peer->data_fd()));
+}
+
+TEST(ShmRingTest, OnlyWritesToEmptyRingSignal) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  ASSERT_TRUE((*ring)->Write(Bytes("a")).ok());
+  ASSERT_TRUE((*ring)->ConsumeDataWakeup().ok());
+  ASSERT_TRUE((*ring)->Write(Bytes("b")).ok());
+  EXPECT_FALSE(IsReadable((*ring)->data_fd()));
+  (*ring)->Consume(2);
+  ASSERT_TRUE((*ring)->Write(Bytes("c")).ok());
+  EXPECT_TRUE(IsReadable((*ring)->data_fd()));
+}
+
+TEST(ShmRingTest, ReadableBytesAreContiguousAcrossTheEnd) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  const size_t capacity = (*ring)->capacity();
+  std::string filler(capacity - 3, 'x');
+  EXPECT_EQ(*(*ring)->Write(Bytes(filler)), filler.size());
+  (*ring)->Consume(filler.size());
+  EXPECT_EQ(*(*ring)->Write(Bytes("0123456789")), 10);
+  EXPECT_EQ(AsString((*ring)->Peek()), "0123456789");
+}
+
+TEST(ShmRingTest, FullRingSignalsSpaceWhenConsumed) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  std::unique_ptr<ShmRing> peer = AttachPeer(**ring);
+  const size_t capacity = (*ring)->capacity();
+  std::string data(capacity + 10, 'y');
+  EXPECT_EQ(*(*ring)->Write(Bytes(data)), capacity);
+  EXPECT_EQ(*(*ring)->Write(Bytes("z")), 0);
+  EXPECT_FALSE(IsReadable((*ring)->space_fd()));
+  peer->Consume(1);
+  EXPECT_TRUE(IsReadable((*ring)->space_fd()));
+  EXPECT_TRUE((*ring)->ConsumeSpaceWakeup().ok());
+  peer->Consume(1);
+  EXPECT_FALSE(IsReadable((*ring)->space_fd()));
+  EXPECT_EQ(*(*ring)->Write(Bytes("zzz")), 2);
+}
+
+// Overwrites the ring's positions, as a misbehaving peer could. The control
+// block is the first page of the memfd: head, then tail 64 bytes later.
+void CorruptPositions(const ShmRing& ring, uint64_t head, uint64_t tail) {
+  void* control = mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_WRITE,
+                       MAP_SHARED, ring.memfd(), 0);
+  ASSERT_NE(control, MAP_FAILED);
+  static_cast<std::atomic<uint64_t>*>(control)->store(head);
+  reinterpret_cast<std::atomic<uint64_t>*>(static_cast<char*>(control) + 64)
+      ->store(tail);
+  munmap(control, sysconf(_SC_PAGESIZE));
+}
+
+TEST(ShmRingTest, ConsumerFailsRingWithImpossiblePositions) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  CorruptPositions(**ring, 0, (*ring)->capacity() + 1);
+  EXPECT_EQ((*ring)->Peek().status().code(), absl::StatusCode::kDataLoss);
+  // The ring stays failed even once the positions look valid again.
+  CorruptPositions(**ring, 0, 0);
+  EXPECT_EQ((*ring)->Peek().status().code(), absl::StatusCode::kDataLoss);
+  EXPECT_EQ((*ring)->Write(Bytes("a")).status().code(),
+            absl::StatusCode::kDataLoss);
+}
+
+TEST(ShmRingTest, ProducerFailsRingWithHeadPastTail) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  CorruptPositions(**ring, 10, 0);
+  EXPECT_EQ((*ring)->Write(Bytes("a")).status().code(),
+            absl::StatusCode::kDataLoss);
+}
+
+TEST(ShmRingTest, RingCannotBeResized) {
+  auto ring = ShmRing::Create(1);
+  if (!ring.ok()) GTEST_SKIP() << ring.status();
+  EXPECT_NE(ftruncate((*ring)->memfd(), 100), 0);
+}
+
+TEST(ShmRingTest, AttachRejectsUnsealedMemfd) {
+  const size_t page = sysconf(_SC_PAGESIZE);
+  int memfd = memfd_create("test", MFD_CLOEXEC);
+  if (memfd < 0) GTEST_SKIP() << "memfd_create failed";
+  ASSERT_EQ(ftruncate(memfd, 2 * page), 0);
+  auto peer = ShmRing::Attach(memfd, eventfd(0, EFD_CLOEXEC),
+                              eventfd(0, EFD_CLOEXEC));
+  EXPECT_EQ(peer.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST(ShmRingTest, AttachRejectsBadSize) {
+  int memfd = memfd_create("test", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (memfd < 0) GTEST_SKIP() << "memfd_create failed";
+  ASSERT_EQ(ftruncate(memfd, 100), 0);
+  ASSERT_EQ(fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW), 0);
+  auto peer = ShmRing::Attach(memfd, eventfd(0, EFD_CLOEXEC),
+                              eventfd(0, EFD_CLOEXEC));
+  EXPECT_EQ(peer.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
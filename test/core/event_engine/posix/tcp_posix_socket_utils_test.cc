@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <grpc/grpc.h>
+#include <sched.h>
+#include <string.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -169,6 +171,75 @@ TEST(TcpPosixSocketUtilsTest, SocketOptionsTest) {
   close(sock);
 }
 
+#ifdef GPR_LINUX
+TEST(TcpPosixSocketUtilsTest, ReusePortCpuSteeringTest) {
+  if (!PosixSocketWrapper::IsSocketReusePortSupported()) {
+    GTEST_SKIP() << "SO_REUSEPORT is not supported";
+  }
+  // Keep both ends of the loopback connections on one CPU, so that they are
+  // all received there.
+  cpu_set_t allowed;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+  int cpu = 0;
+  while (!CPU_ISSET(cpu, &allowed)) ++cpu;
+  cpu_set_t pinned;
+  CPU_ZERO(&pinned);
+  CPU_SET(cpu, &pinned);
+  ASSERT_EQ(sched_setaffinity(0, sizeof(pinned), &pinned), 0);
+  constexpr int kNumListeners = 2;
+  int listeners[kNumListeners];
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  for (int i = 0; i < kNumListeners; ++i) {
+    listeners[i] = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GT(listeners[i], 0);
+    PosixSocketWrapper sock(listeners[i]);
+    ASSERT_TRUE(sock.SetSocketReusePort(1).ok());
+    ASSERT_TRUE(sock.SetSocketNonBlocking(1).ok());
+    ASSERT_EQ(bind(listeners[i], reinterpret_cast<sockaddr*>(&addr),
+                   sizeof(addr)),
+              0);
+    ASSERT_EQ(listen(listeners[i], 16), 0);
+    if (i == 0) {
+      // The rest of the group binds to the port the first one got.
+      socklen_t len = sizeof(addr);
+      ASSERT_EQ(
+          getsockname(listeners[i], reinterpret_cast<sockaddr*>(&addr), &len),
+          0);
+    }
+  }
+  auto status =
+      PosixSocketWrapper(listeners[0]).SetSocketReusePortCpuSteering(
+          kNumListeners);
+  if (!status.ok()) {
+    for (int fd : listeners) close(fd);
+    ASSERT_EQ(sched_setaffinity(0, sizeof(allowed), &allowed), 0);
+    GTEST_SKIP() << status;
+  }
+  constexpr int kNumConnections = 8;
+  for (int i = 0; i < kNumConnections; ++i) {
+    int client = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GT(client, 0);
+    ASSERT_EQ(
+        connect(client, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    close(client);
+  }
+  int accepted[kNumListeners] = {0, 0};
+  for (int i = 0; i < kNumListeners; ++i) {
+    int fd;
+    while ((fd = accept(listeners[i], nullptr, nullptr)) >= 0) {
+      ++accepted[i];
+      close(fd);
+    }
+  }
+  EXPECT_EQ(accepted[cpu % kNumListeners], kNumConnections);
+  for (int fd : listeners) close(fd);
+  ASSERT_EQ(sched_setaffinity(0, sizeof(allowed), &allowed), 0);
+}
+#endif  // GPR_LINUX
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
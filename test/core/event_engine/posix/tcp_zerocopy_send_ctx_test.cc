@@ -0,0 +1,143 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include <cstdint>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/test_util/test_config.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+namespace grpc_event_engine::experimental {
+namespace {
+
+constexpr size_t kThreshold = TcpZerocopySendCtx::kDefaultSendBytesThreshold;
+constexpr uint32_t kWindow = TcpZerocopySendCtx::kAdaptWindow;
+
+class TcpZerocopySendCtxTest : public ::testing::Test {
+ protected:
+  // Starts a write that is sent with num_sends sendmsg() calls, the first of
+  // which gets the next sequence number.
+  TcpZerocopySendRecord* Write(int num_sends) {
+    TcpZerocopySendRecord* record = ctx_.GetSendRecord();
+    EXPECT_NE(record, nullptr);
+    SliceBuffer slices;
+    slices.Append(Slice::FromCopiedString(std::string(kThreshold + 1, 'a')));
+    record->PrepareForSends(slices);
+    for (int i = 0; i < num_sends; ++i) ctx_.NoteSend(record);
+    // Drop the reference held by the write itself, as the endpoint does once
+    // all of its data has been handed to the kernel.
+    EXPECT_FALSE(record->Unref());
+    return record;
+  }
+
+  // Processes one error queue notification for [lo, hi], as
+  // PosixEndpointImpl::ProcessZerocopy() does. Returns whether the threshold
+  // changed.
+  bool Complete(uint32_t lo, uint32_t hi, bool copied) {
+    for (uint32_t seq = lo; seq != hi + 1; ++seq) {
+      TcpZerocopySendRecord* record = ctx_.ReleaseSendRecord(seq);
+      EXPECT_NE(record, nullptr);
+      if (record->Unref()) ctx_.PutSendRecord(record);
+    }
+    return ctx_.NoteCompletions(hi - lo + 1, copied);
+  }
+
+  TcpZerocopySendCtx ctx_{/*zerocopy_enabled=*/true};
+};
+
+TEST_F(TcpZerocopySendCtxTest, CoalescedRangeReleasesEverySend) {
+  Write(3);
+  Write(2);
+  EXPECT_FALSE(ctx_.AllSendRecordsEmpty());
+  EXPECT_FALSE(Complete(0, 4, /*copied=*/false));
+  EXPECT_TRUE(ctx_.AllSendRecordsEmpty());
+}
+
+TEST_F(TcpZerocopySendCtxTest, OutOfOrderRangesReleaseTheirOwnRecords) {
+  Write(2);
+  TcpZerocopySendRecord* second = Write(2);
+  EXPECT_EQ(ctx_.ReleaseSendRecord(2), second);
+  EXPECT_FALSE(second->Unref());
+  EXPECT_EQ(ctx_.ReleaseSendRecord(3), second);
+  EXPECT_TRUE(second->Unref());
+  ctx_.PutSendRecord(second);
+  // The first write is still in flight.
+  EXPECT_FALSE(ctx_.AllSendRecordsEmpty());
+  EXPECT_FALSE(Complete(0, 1, /*copied=*/false));
+  EXPECT_TRUE(ctx_.AllSendRecordsEmpty());
+}
+
+TEST_F(TcpZerocopySendCtxTest, CoalescedCompletionsFillTheWindow) {
+  // One notification covering a whole window adapts the threshold at once.
+  EXPECT_TRUE(ctx_.NoteCompletions(kWindow, /*copied=*/true));
+  EXPECT_EQ(ctx_.ThresholdBytes(), 2 * kThreshold);
+  // A notification that overshoots the window counts all of its completions,
+  // and the next window starts empty.
+  EXPECT_TRUE(ctx_.NoteCompletions(kWindow + 10, /*copied=*/false));
+  EXPECT_EQ(ctx_.ThresholdBytes(), kThreshold);
+  EXPECT_FALSE(ctx_.NoteCompletions(kWindow - 1, /*copied=*/true));
+  EXPECT_TRUE(ctx_.NoteCompletions(1, /*copied=*/true));
+  EXPECT_EQ(ctx_.ThresholdBytes(), 2 * kThreshold);
+}
+
+TEST_F(TcpZerocopySendCtxTest, CompletionOrderDoesNotMatter) {
+  TcpZerocopySendCtx copied_last(/*zerocopy_enabled=*/true);
+  TcpZerocopySendCtx copied_first(/*zerocopy_enabled=*/true);
+  // More than half of the window is copied either way.
+  EXPECT_FALSE(copied_last.NoteCompletions(kWindow / 2 - 1, false));
+  EXPECT_TRUE(copied_last.NoteCompletions(kWindow / 2 + 1, true));
+  EXPECT_FALSE(copied_first.NoteCompletions(kWindow / 2 + 1, true));
+  EXPECT_TRUE(copied_first.NoteCompletions(kWindow / 2 - 1, false));
+  EXPECT_EQ(copied_last.ThresholdBytes(), copied_first.ThresholdBytes());
+  EXPECT_EQ(copied_last.ThresholdBytes(), 2 * kThreshold);
+}
+
+TEST_F(TcpZerocopySendCtxTest, OutOfOrderRangesFeedTheSameWindow) {
+  for (int i = 0; i < 4; ++i) Write(kWindow / 4);
+  // Each write completes as one coalesced range, the later ones first. Only
+  // the last notification completes the window.
+  EXPECT_FALSE(Complete(3 * kWindow / 4, kWindow - 1, /*copied=*/true));
+  EXPECT_FALSE(Complete(kWindow / 2, 3 * kWindow / 4 - 1, /*copied=*/true));
+  EXPECT_FALSE(Complete(kWindow / 4, kWindow / 2 - 1, /*copied=*/false));
+  EXPECT_EQ(ctx_.ThresholdBytes(), kThreshold);
+  EXPECT_TRUE(Complete(0, kWindow / 4 - 1, /*copied=*/true));
+  EXPECT_EQ(ctx_.ThresholdBytes(), 2 * kThreshold);
+  EXPECT_TRUE(ctx_.AllSendRecordsEmpty());
+}
+
+TEST_F(TcpZerocopySendCtxTest, ThresholdStaysWithinItsBounds) {
+  EXPECT_FALSE(ctx_.NoteCompletions(kWindow, /*copied=*/false));
+  EXPECT_EQ(ctx_.ThresholdBytes(), kThreshold);
+  while (ctx_.NoteCompletions(kWindow, /*copied=*/true)) {
+  }
+  EXPECT_EQ(ctx_.ThresholdBytes(), TcpZerocopySendCtx::kMaxSendBytesThreshold);
+}
+
+}  // namespace
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -238,6 +238,203 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
   EXPECT_TRUE(timer_list.TimerCancel(&timers[3]));
 }
 
+TEST(TimerWheelTest, Add) {
+  Timer timers[20];
+  StrictMock<MockClosure> closures[20];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100);
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TimerWheel timer_wheel(&host);
+
+  // Only the first timer is the new earliest deadline.
+  EXPECT_CALL(host, Kick());
+  for (int i = 0; i < 10; i++) {
+    timer_wheel.TimerInit(&timers[i],
+                          kStart + grpc_core::Duration::Milliseconds(10),
+                          &closures[i]);
+  }
+  for (int i = 10; i < 20; i++) {
+    timer_wheel.TimerInit(&timers[i],
+                          kStart + grpc_core::Duration::Milliseconds(1010),
+                          &closures[i]);
+  }
+  Mock::VerifyAndClearExpectations(&host);
+
+  // collect timers.  Only the first batch should be ready.
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(500)));
+  for (int i = 0; i < 10; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(&next)),
+            CheckResult::kTimersFired);
+  for (int i = 0; i < 10; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+  EXPECT_GT(next, kStart + grpc_core::Duration::Milliseconds(500));
+  EXPECT_LE(next, kStart + grpc_core::Duration::Milliseconds(1010));
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(1009)));
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+
+  // collect the rest of the timers
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(1010)));
+  for (int i = 10; i < 20; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  for (int i = 10; i < 20; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(1600)));
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+}
+
+TEST(TimerWheelTest, Cancel) {
+  Timer timers[3];
+  StrictMock<MockClosure> closures[3];
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now())
+      .WillOnce(
+          Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0)));
+  TimerWheel timer_wheel(&host);
+
+  EXPECT_CALL(host, Kick()).Times(2);
+  timer_wheel.TimerInit(
+      &timers[0], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100),
+      &closures[0]);
+  timer_wheel.TimerInit(
+      &timers[1], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(3),
+      &closures[1]);
+  timer_wheel.TimerInit(
+      &timers[2], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100),
+      &closures[2]);
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[2]));
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timers[2]));
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(
+          Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(50)));
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(
+          Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100)));
+  EXPECT_CALL(closures[0], Run());
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timers[0]));
+}
+
+// Timers spread over every level of the wheel, and beyond it, must each run
+// at the first check at or after their deadline.
+TEST(TimerWheelTest, CascadesThroughLevels) {
+  class ManualHost final : public TimerListHost {
+   public:
+    grpc_core::Timestamp Now() override { return now; }
+    void Kick() override {}
+    grpc_core::Timestamp now;
+  };
+  class RecordingClosure final : public experimental::EventEngine::Closure {
+   public:
+    void Run() override { ran_at = host->now; }
+    ManualHost* host;
+    std::optional<grpc_core::Timestamp> ran_at;
+  };
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(k25Days.millis());
+  ManualHost host;
+  host.now = kStart;
+  TimerWheel timer_wheel(&host);
+
+  constexpr int kNumTimers = 64;
+  Timer timers[kNumTimers];
+  RecordingClosure closures[kNumTimers];
+  for (int i = 0; i < kNumTimers; i++) {
+    closures[i].host = &host;
+    // Deadlines from 1ms to ~1500 days, so the last few overflow the wheel.
+    const int64_t delay = int64_t{1} << (i * 37 / kNumTimers);
+    timer_wheel.TimerInit(&timers[i],
+                          kStart + grpc_core::Duration::Milliseconds(delay + i),
+                          &closures[i]);
+  }
+
+  // Follow the wheel's own estimate of the next deadline, as the timer
+  // manager does.
+  int checks = 0;
+  while (true) {
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    auto result = timer_wheel.TimerCheck(&next);
+    ASSERT_TRUE(result.has_value());
+    FinishCheck(std::move(result));
+    if (next == grpc_core::Timestamp::InfFuture()) break;
+    ASSERT_GT(next, host.now);
+    host.now = next;
+    ++checks;
+  }
+  for (int i = 0; i < kNumTimers; i++) {
+    ASSERT_TRUE(closures[i].ran_at.has_value()) << i;
+    EXPECT_EQ(closures[i].ran_at->milliseconds_after_process_epoch(),
+              timers[i].deadline)
+        << i;
+  }
+  // Cascading adds a bounded number of wakeups per timer.
+  EXPECT_LE(checks, kNumTimers * 8);
+}
+
+// The wheel version of TimerListTest.LongRunningServiceCleanup.
+TEST(TimerWheelTest, LongRunningServiceCleanup) {
+  Timer timers[4];
+  StrictMock<MockClosure> closures[4];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(k25Days.millis());
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TimerWheel timer_wheel(&host);
+
+  EXPECT_CALL(host, Kick()).Times(2);
+  timer_wheel.TimerInit(&timers[0], kStart + k25Days, &closures[0]);
+  timer_wheel.TimerInit(
+      &timers[1], kStart + grpc_core::Duration::Milliseconds(3), &closures[1]);
+  timer_wheel.TimerInit(&timers[2],
+                        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                            std::numeric_limits<int64_t>::max() - 1),
+                        &closures[2]);
+
+  gpr_timespec deadline_spec =
+      (kStart + k25Days).as_timespec(gpr_clock_type::GPR_CLOCK_MONOTONIC);
+  timer_wheel.TimerInit(
+      &timers[3], grpc_core::Timestamp::FromTimespecRoundUp(deadline_spec),
+      &closures[3]);
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(4)));
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[0]));
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[2]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[3]));
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
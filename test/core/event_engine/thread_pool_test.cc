@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <tuple>
 #include <vector>
@@ -473,6 +474,27 @@ TEST_F(LivingThreadCountTest, BlockUntilThreadCountTest) {
   ASSERT_EQ(living_thread_count.count(), 0);
 }
 
+TEST(NumaTopologyTest, ParseCpuList) {
+  using NumaTopology = WorkStealingThreadPool::NumaTopology;
+  EXPECT_EQ(NumaTopology::ParseCpuList("0-3,8,10-11\n"),
+            std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(NumaTopology::ParseCpuList("5"), std::vector<int>({5}));
+  EXPECT_EQ(NumaTopology::ParseCpuList("\n"), std::vector<int>());
+  EXPECT_EQ(NumaTopology::ParseCpuList("0-"), std::nullopt);
+  EXPECT_EQ(NumaTopology::ParseCpuList("3-1"), std::nullopt);
+  EXPECT_EQ(NumaTopology::ParseCpuList("0,,1"), std::nullopt);
+  EXPECT_EQ(NumaTopology::ParseCpuList("a-b"), std::nullopt);
+}
+
+TEST(NumaTopologyTest, HostTopologyIsUsable) {
+  const auto& topology = WorkStealingThreadPool::NumaTopology::Get();
+  ASSERT_GE(topology.num_nodes(), 1);
+  // Either a single node without CPUs, or nodes that all have some.
+  if (topology.num_nodes() > 1) {
+    for (const auto& cpus : topology.node_cpus) EXPECT_FALSE(cpus.empty());
+  }
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -0,0 +1,136 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
+using ::grpc_event_engine::experimental::EventEngine;
+
+class NoopClosure : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+TEST(ChaseLevWorkQueueTest, StartsEmpty) {
+  ChaseLevWorkQueue queue;
+  ASSERT_TRUE(queue.Empty());
+  ASSERT_EQ(queue.PopMostRecent(), nullptr);
+  ASSERT_EQ(queue.PopOldest(), nullptr);
+}
+
+TEST(ChaseLevWorkQueueTest, TakesAnyInvocables) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  queue.Add([&ran] { ran = true; });
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, PopMostRecentIsLIFOAndPopOldestIsFIFO) {
+  ChaseLevWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.Add([&flag] { flag |= 4; });
+  queue.PopMostRecent()->Run();
+  EXPECT_EQ(flag, 4);
+  queue.PopOldest()->Run();
+  EXPECT_EQ(flag, 5);
+  queue.PopOldest()->Run();
+  EXPECT_EQ(flag, 7);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, Grows) {
+  ChaseLevWorkQueue queue;
+  constexpr int kCount = 10000;
+  std::vector<NoopClosure> closures(kCount);
+  for (auto& closure : closures) queue.Add(&closure);
+  EXPECT_EQ(queue.Size(), kCount);
+  for (int i = 0; i < kCount / 2; i++) {
+    EXPECT_EQ(queue.PopOldest(), &closures[i]);
+  }
+  for (int i = kCount - 1; i >= kCount / 2; i--) {
+    EXPECT_EQ(queue.PopMostRecent(), &closures[i]);
+  }
+  ASSERT_TRUE(queue.Empty());
+}
+
+// One owner adding and popping, with thieves stealing at the same time. Every
+// closure must be run exactly once.
+TEST(ChaseLevWorkQueueTest, ThreadedStress) {
+  ChaseLevWorkQueue queue;
+  constexpr int kThiefCount = 8;
+  constexpr int kElementCount = 200000;
+  std::atomic<int> run_count{0};
+  class TestClosure : public EventEngine::Closure {
+   public:
+    explicit TestClosure(std::atomic<int>* run_count)
+        : run_count_(run_count) {}
+    void Run() override {
+      run_count_->fetch_add(1, std::memory_order_relaxed);
+      delete this;
+    }
+
+   private:
+    std::atomic<int>* run_count_;
+  };
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  thieves.reserve(kThiefCount);
+  for (int i = 0; i < kThiefCount; i++) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire)) {
+        if (auto* c = queue.PopOldest()) c->Run();
+      }
+    });
+  }
+  for (int i = 0; i < kElementCount; i++) {
+    queue.Add(new TestClosure(&run_count));
+    // Take some back, as a worker thread would.
+    if (i % 3 == 0) {
+      if (auto* c = queue.PopMostRecent()) c->Run();
+    }
+  }
+  while (auto* c = queue.PopMostRecent()) c->Run();
+  while (run_count.load(std::memory_order_relaxed) < kElementCount) {
+    std::this_thread::yield();
+  }
+  done.store(true, std::memory_order_release);
+  for (auto& thd : thieves) thd.join();
+  EXPECT_EQ(run_count.load(), kElementCount);
+  EXPECT_TRUE(queue.Empty());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
@@ -0,0 +1,123 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/mpmc_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::MpmcWorkQueue;
+
+class NoopClosure : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+TEST(MpmcWorkQueueTest, StartsEmpty) {
+  MpmcWorkQueue queue;
+  ASSERT_TRUE(queue.Empty());
+  ASSERT_EQ(queue.PopMostRecent(), nullptr);
+  ASSERT_EQ(queue.PopOldest(), nullptr);
+}
+
+TEST(MpmcWorkQueueTest, TakesAnyInvocables) {
+  MpmcWorkQueue queue;
+  bool ran = false;
+  queue.Add([&ran] { ran = true; });
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopOldest();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(MpmcWorkQueueTest, IsFIFO) {
+  MpmcWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopMostRecent()->Run();
+  EXPECT_EQ(flag, 1);
+  queue.PopOldest()->Run();
+  EXPECT_EQ(flag, 3);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(MpmcWorkQueueTest, SpillsOverWhenFullInOrder) {
+  MpmcWorkQueue queue(nullptr, 8);
+  constexpr int kCount = 100;
+  std::vector<NoopClosure> closures(kCount);
+  for (auto& closure : closures) queue.Add(&closure);
+  EXPECT_EQ(queue.Size(), kCount);
+  for (int i = 0; i < kCount; i++) {
+    EXPECT_EQ(queue.PopOldest(), &closures[i]) << i;
+  }
+  ASSERT_TRUE(queue.Empty());
+}
+
+// Many producers and consumers; every closure must be run exactly once.
+// A small ring makes sure the overflow path is exercised too.
+TEST(MpmcWorkQueueTest, ThreadedStress) {
+  MpmcWorkQueue queue(nullptr, 64);
+  constexpr int thd_count = 16;
+  constexpr int element_count_per_thd = 20000;
+  std::atomic<int> run_count{0};
+  class TestClosure : public EventEngine::Closure {
+   public:
+    explicit TestClosure(std::atomic<int>* run_count)
+        : run_count_(run_count) {}
+    void Run() override {
+      run_count_->fetch_add(1, std::memory_order_relaxed);
+      delete this;
+    }
+
+   private:
+    std::atomic<int>* run_count_;
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(thd_count * 2);
+  for (int i = 0; i < thd_count; i++) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < element_count_per_thd; j++) {
+        queue.Add(new TestClosure(&run_count));
+      }
+    });
+    threads.emplace_back([&] {
+      while (run_count.load(std::memory_order_relaxed) <
+             thd_count * element_count_per_thd) {
+        if (auto* c = queue.PopOldest()) c->Run();
+      }
+    });
+  }
+  for (auto& thd : threads) thd.join();
+  EXPECT_EQ(run_count.load(), thd_count * element_count_per_thd);
+  EXPECT_TRUE(queue.Empty());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
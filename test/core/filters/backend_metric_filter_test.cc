@@ -0,0 +1,166 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/backend_metrics/backend_metric_filter.h"
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/load_balancing/backend_metric_parser.h"
+#include "test/core/filters/filter_test.h"
+
+using ::testing::_;
+
+namespace grpc_core {
+namespace {
+
+class FakeBackendMetricProvider : public BackendMetricProvider {
+ public:
+  FakeBackendMetricProvider(std::shared_ptr<const BackendMetricData> shared,
+                            BackendMetricData call)
+      : shared_(std::move(shared)), call_(std::move(call)) {}
+
+  BackendMetricData GetBackendMetricData() override { return call_; }
+
+  std::shared_ptr<const BackendMetricData> GetSplitBackendMetricData(
+      BackendMetricData* call_data) override {
+    *call_data = call_;
+    return shared_;
+  }
+
+ private:
+  std::shared_ptr<const BackendMetricData> shared_;
+  BackendMetricData call_;
+};
+
+class TestAllocator : public BackendMetricAllocatorInterface {
+ public:
+  BackendMetricData* AllocateBackendMetricData() override { return &data_; }
+
+  char* AllocateString(size_t size) override {
+    return strings_.emplace_back(size, '\0').data();
+  }
+
+ private:
+  BackendMetricData data_;
+  std::list<std::string> strings_;
+};
+
+class BackendMetricFilterTest : public FilterTest<BackendMetricFilter> {
+ protected:
+  // Runs a call reporting the given metrics and returns the serialized
+  // report from its trailers, if any.
+  std::optional<std::string> RunCall(
+      Channel& channel, std::shared_ptr<const BackendMetricData> shared,
+      BackendMetricData call_data) {
+    FakeBackendMetricProvider provider(std::move(shared), std::move(call_data));
+    Call call(channel);
+    call.arena()->SetContext<BackendMetricProvider>(&provider);
+    std::optional<std::string> report;
+    EXPECT_EVENT(Started(&call, _));
+    call.Start(call.NewClientMetadata());
+    call.FinishNextFilter(call.NewServerMetadata());
+    EXPECT_EVENT(Finished(&call, _))
+        .WillOnce([&](Call*, const ServerMetadata& md) {
+          const Slice* value = md.get_pointer(EndpointLoadMetricsBinMetadata());
+          if (value != nullptr) report = std::string(value->as_string_view());
+        });
+    Step();
+    return report;
+  }
+};
+
+std::shared_ptr<const BackendMetricData> ServerMetrics() {
+  auto data = std::make_shared<BackendMetricData>();
+  data->cpu_utilization = 0.5;
+  data->mem_utilization = 0.25;
+  data->utilization["foo"] = 0.5;
+  return data;
+}
+
+TEST_F(BackendMetricFilterTest, ServerMetricsAreReported) {
+  auto channel = MakeChannel(ChannelArgs()).value();
+  auto report = RunCall(channel, ServerMetrics(), BackendMetricData());
+  ASSERT_TRUE(report.has_value());
+  TestAllocator allocator;
+  const BackendMetricData* parsed = ParseBackendMetricData(*report, &allocator);
+  ASSERT_NE(parsed, nullptr);
+  EXPECT_EQ(parsed->cpu_utilization, 0.5);
+  EXPECT_EQ(parsed->mem_utilization, 0.25);
+  EXPECT_EQ(parsed->utilization.at("foo"), 0.5);
+}
+
+TEST_F(BackendMetricFilterTest, CachedSerializationFollowsServerMetrics) {
+  auto channel = MakeChannel(ChannelArgs()).value();
+  auto shared = ServerMetrics();
+  auto first = RunCall(channel, shared, BackendMetricData());
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(RunCall(channel, shared, BackendMetricData()), first);
+  auto updated = std::make_shared<BackendMetricData>(*shared);
+  updated->cpu_utilization = 0.75;
+  auto report = RunCall(channel, updated, BackendMetricData());
+  ASSERT_TRUE(report.has_value());
+  TestAllocator allocator;
+  const BackendMetricData* parsed = ParseBackendMetricData(*report, &allocator);
+  ASSERT_NE(parsed, nullptr);
+  EXPECT_EQ(parsed->cpu_utilization, 0.75);
+}
+
+TEST_F(BackendMetricFilterTest, CallMetricsOverrideServerMetrics) {
+  auto channel = MakeChannel(ChannelArgs()).value();
+  BackendMetricData call_data;
+  call_data.mem_utilization = 0.125;
+  call_data.utilization["foo"] = 0.75;
+  call_data.utilization["bar"] = 0.25;
+  auto report = RunCall(channel, ServerMetrics(), call_data);
+  ASSERT_TRUE(report.has_value());
+  TestAllocator allocator;
+  const BackendMetricData* parsed = ParseBackendMetricData(*report, &allocator);
+  ASSERT_NE(parsed, nullptr);
+  EXPECT_EQ(parsed->cpu_utilization, 0.5);
+  EXPECT_EQ(parsed->mem_utilization, 0.125);
+  EXPECT_EQ(parsed->utilization.at("foo"), 0.75);
+  EXPECT_EQ(parsed->utilization.at("bar"), 0.25);
+}
+
+TEST_F(BackendMetricFilterTest, ZeroCallMetricsOverrideServerMetrics) {
+  auto channel = MakeChannel(ChannelArgs()).value();
+  BackendMetricData call_data;
+  call_data.cpu_utilization = 0;
+  call_data.utilization["foo"] = 0;
+  auto report = RunCall(channel, ServerMetrics(), call_data);
+  ASSERT_TRUE(report.has_value());
+  TestAllocator allocator;
+  const BackendMetricData* parsed = ParseBackendMetricData(*report, &allocator);
+  ASSERT_NE(parsed, nullptr);
+  EXPECT_EQ(parsed->cpu_utilization, 0);
+  EXPECT_EQ(parsed->mem_utilization, 0.25);
+  EXPECT_EQ(parsed->utilization.at("foo"), 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,278 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Runs calls over "shm:" targets, whose connections move their bytes through
+// shared memory rings, and checks that clients that do not ask for the rings
+// still get through to a server that offers them.
+
+#include <dirent.h>
+#include <grpc/byte_buffer.h>
+#include <grpc/byte_buffer_reader.h>
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/impl/propagation_bits.h>
+#include <grpc/slice.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+// Larger than the rings, so that messages have to wait for the peer to make
+// room.
+constexpr size_t kMessageSize = 256 * 1024;
+constexpr int kRingSize = 16 * 1024;
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+grpc_event Next(grpc_completion_queue* cq) {
+  grpc_event event = grpc_completion_queue_next(
+      cq, grpc_timeout_seconds_to_deadline(30), nullptr);
+  CHECK(event.type == GRPC_OP_COMPLETE);
+  return event;
+}
+
+// Returns the number of shared memory rings mapped by this process.
+int CountShmRings() {
+  DIR* dir = opendir("/proc/self/fd");
+  if (dir == nullptr) return 0;
+  int rings = 0;
+  while (dirent* entry = readdir(dir)) {
+    char target[256];
+    const ssize_t length =
+        readlink(absl::StrCat("/proc/self/fd/", entry->d_name).c_str(), target,
+                 sizeof(target));
+    if (length > 0 && absl::string_view(target, length)
+                              .find("memfd:grpc_shm_ring") !=
+                          absl::string_view::npos) {
+      ++rings;
+    }
+  }
+  closedir(dir);
+  return rings;
+}
+
+std::string Payload(char fill) { return std::string(kMessageSize, fill); }
+
+std::string ToString(grpc_byte_buffer* buffer) {
+  grpc_byte_buffer_reader reader;
+  CHECK(grpc_byte_buffer_reader_init(&reader, buffer));
+  grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+  std::string result(grpc_core::StringViewFromSlice(slice));
+  grpc_slice_unref(slice);
+  grpc_byte_buffer_reader_destroy(&reader);
+  return result;
+}
+
+grpc_byte_buffer* ToByteBuffer(const std::string& s) {
+  grpc_slice slice = grpc_slice_from_copied_buffer(s.data(), s.size());
+  grpc_byte_buffer* buffer = grpc_raw_byte_buffer_create(&slice, 1);
+  grpc_slice_unref(slice);
+  return buffer;
+}
+
+// Echoes the request of one call back to the client.
+void EchoCall(grpc_server* server, grpc_completion_queue* cq) {
+  grpc_call_details call_details;
+  grpc_call_details_init(&call_details);
+  grpc_metadata_array request_metadata;
+  grpc_metadata_array_init(&request_metadata);
+  grpc_call* call;
+  CHECK_EQ(grpc_server_request_call(server, &call, &call_details,
+                                    &request_metadata, cq, cq, Tag(1)),
+           GRPC_CALL_OK);
+  grpc_event event = Next(cq);
+  CHECK(event.success);
+  CHECK(event.tag == Tag(1));
+  grpc_call_details_destroy(&call_details);
+  grpc_metadata_array_destroy(&request_metadata);
+  grpc_byte_buffer* request = nullptr;
+  grpc_op ops[4];
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_RECV_MESSAGE;
+  ops[1].data.recv_message.recv_message = &request;
+  CHECK_EQ(grpc_call_start_batch(call, ops, 2, Tag(2), nullptr), GRPC_CALL_OK);
+  event = Next(cq);
+  CHECK(event.success);
+  CHECK(event.tag == Tag(2));
+  CHECK_NE(request, nullptr);
+  grpc_slice status_details = grpc_slice_from_static_string("done");
+  int was_cancelled;
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_SEND_MESSAGE;
+  ops[0].data.send_message.send_message = request;
+  ops[1].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  ops[1].data.send_status_from_server.status = GRPC_STATUS_OK;
+  ops[1].data.send_status_from_server.status_details = &status_details;
+  ops[2].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  ops[2].data.recv_close_on_server.cancelled = &was_cancelled;
+  CHECK_EQ(grpc_call_start_batch(call, ops, 3, Tag(3), nullptr), GRPC_CALL_OK);
+  event = Next(cq);
+  CHECK(event.success);
+  CHECK(event.tag == Tag(3));
+  grpc_byte_buffer_destroy(request);
+  grpc_call_unref(call);
+}
+
+// Sends \a request and returns the response.
+std::string Call(grpc_channel* channel, grpc_completion_queue* cq,
+                 const std::string& request) {
+  grpc_call* call = grpc_channel_create_call(
+      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+      grpc_slice_from_static_string("/echo"), nullptr,
+      grpc_timeout_seconds_to_deadline(30), nullptr);
+  grpc_byte_buffer* request_buffer = ToByteBuffer(request);
+  grpc_byte_buffer* response_buffer = nullptr;
+  grpc_metadata_array initial_metadata;
+  grpc_metadata_array_init(&initial_metadata);
+  grpc_metadata_array trailing_metadata;
+  grpc_metadata_array_init(&trailing_metadata);
+  grpc_status_code status = GRPC_STATUS_UNKNOWN;
+  grpc_slice details;
+  grpc_op ops[6];
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_SEND_MESSAGE;
+  ops[1].data.send_message.send_message = request_buffer;
+  ops[2].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  ops[3].op = GRPC_OP_RECV_INITIAL_METADATA;
+  ops[3].data.recv_initial_metadata.recv_initial_metadata = &initial_metadata;
+  ops[4].op = GRPC_OP_RECV_MESSAGE;
+  ops[4].data.recv_message.recv_message = &response_buffer;
+  ops[5].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  ops[5].data.recv_status_on_client.trailing_metadata = &trailing_metadata;
+  ops[5].data.recv_status_on_client.status = &status;
+  ops[5].data.recv_status_on_client.status_details = &details;
+  CHECK_EQ(grpc_call_start_batch(call, ops, 6, Tag(4), nullptr), GRPC_CALL_OK);
+  grpc_event event = Next(cq);
+  CHECK(event.success);
+  CHECK(event.tag == Tag(4));
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+  std::string response;
+  if (response_buffer != nullptr) response = ToString(response_buffer);
+  grpc_byte_buffer_destroy(request_buffer);
+  grpc_byte_buffer_destroy(response_buffer);
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata);
+  grpc_metadata_array_destroy(&trailing_metadata);
+  grpc_call_unref(call);
+  return response;
+}
+
+class ShmHandshakerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = absl::StrCat("/tmp/shm_handshaker_test.", getpid());
+    unlink(path_.c_str());
+    server_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    client_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    auto server_args = grpc_core::ChannelArgs()
+                           .Set(GRPC_ARG_SHM_TRANSPORT, true)
+                           .Set(GRPC_ARG_SHM_TRANSPORT_RING_SIZE, kRingSize);
+    server_ = grpc_server_create(server_args.ToC().get(), nullptr);
+    grpc_server_register_completion_queue(server_, server_cq_, nullptr);
+    grpc_server_credentials* server_creds =
+        grpc_insecure_server_credentials_create();
+    CHECK(grpc_server_add_http2_port(
+        server_, absl::StrCat("unix:", path_).c_str(), server_creds));
+    grpc_server_credentials_release(server_creds);
+    grpc_server_start(server_);
+  }
+
+  void TearDown() override {
+    grpc_server_shutdown_and_notify(server_, server_cq_, Tag(5));
+    grpc_event event = Next(server_cq_);
+    CHECK(event.tag == Tag(5));
+    grpc_server_destroy(server_);
+    for (grpc_completion_queue* cq : {server_cq_, client_cq_}) {
+      grpc_completion_queue_shutdown(cq);
+      while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                        nullptr)
+                 .type != GRPC_QUEUE_SHUTDOWN) {
+      }
+      grpc_completion_queue_destroy(cq);
+    }
+    unlink(path_.c_str());
+  }
+
+  grpc_channel* CreateChannel(absl::string_view scheme) {
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    grpc_channel* channel = grpc_channel_create(
+        absl::StrCat(scheme, ":", path_).c_str(), creds, nullptr);
+    grpc_channel_credentials_release(creds);
+    return channel;
+  }
+
+  // Runs a few echo calls over \a channel.
+  void EchoCalls(grpc_channel* channel) {
+    for (char fill : {'a', 'b', 'c'}) {
+      std::thread server_thread(EchoCall, server_, server_cq_);
+      EXPECT_EQ(Call(channel, client_cq_, Payload(fill)), Payload(fill));
+      server_thread.join();
+    }
+  }
+
+  std::string path_;
+  grpc_completion_queue* server_cq_;
+  grpc_completion_queue* client_cq_;
+  grpc_server* server_;
+};
+
+TEST_F(ShmHandshakerTest, ShmClientMovesBytesOverRings) {
+#ifndef GPR_LINUX
+  GTEST_SKIP() << "shared memory rings are only supported on Linux";
+#endif
+  const int rings_before = CountShmRings();
+  grpc_channel* channel = CreateChannel("shm");
+  EchoCalls(channel);
+  // Each side holds both rings of the connection.
+  EXPECT_EQ(CountShmRings(), rings_before + 4);
+  grpc_channel_destroy(channel);
+}
+
+TEST_F(ShmHandshakerTest, UnixClientStaysOnSocket) {
+  const int rings_before = CountShmRings();
+  grpc_channel* channel = CreateChannel("unix");
+  EchoCalls(channel);
+  // Rings of earlier connections may still be going away.
+  EXPECT_LE(CountShmRings(), rings_before);
+  grpc_channel_destroy(channel);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
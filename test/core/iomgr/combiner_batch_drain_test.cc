@@ -0,0 +1,126 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/grpc.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/iomgr/combiner.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/notification.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// The closures of this test: more than fit in one batch.
+constexpr size_t kClosures = 200;
+
+// An ExecCtx that always wants to finish, as one on a borrowed application
+// thread would.  A contended combiner running under it would offload its
+// queue after every closure without the experiment.
+class FinishingExecCtx : public ExecCtx {
+ protected:
+  bool CheckReadyToFinish() override { return true; }
+};
+
+TEST(CombinerBatchDrainTest, ContendedCombinerDrainsABatchBeforeOffloading) {
+  ASSERT_TRUE(IsCombinerBatchDrainEnabled());
+  Combiner* lock = grpc_combiner_create(
+      grpc_event_engine::experimental::CreateEventEngine());
+  const auto start_thread = std::this_thread::get_id();
+  // Only touched under the combiner.
+  size_t ran = 0;
+  size_t ran_on_start_thread = 0;
+  bool in_order = true;
+  Notification done;
+  auto before = global_stats().Collect();
+  {
+    FinishingExecCtx exec_ctx;
+    lock->Run(NewClosure([&](grpc_error_handle) {
+                ++ran_on_start_thread;
+                // Queue closures from another ExecCtx, which makes the
+                // combiner contended.
+                ExecCtx other_exec_ctx;
+                for (size_t i = 0; i < kClosures; ++i) {
+                  lock->Run(NewClosure([&, i](grpc_error_handle) {
+                              if (ran != i) in_order = false;
+                              ++ran;
+                              if (std::this_thread::get_id() == start_thread) {
+                                ++ran_on_start_thread;
+                              }
+                              if (ran == kClosures) done.Notify();
+                            }),
+                            absl::OkStatus());
+                }
+              }),
+              absl::OkStatus());
+    exec_ctx.Flush();
+    // The rest of the queue has been offloaded by now.
+    done.WaitForNotification();
+  }
+  EXPECT_TRUE(in_order);
+  // More than one closure ran on this thread, but no more than one batch.
+  EXPECT_GT(ran_on_start_thread, 1u);
+  EXPECT_LE(ran_on_start_thread, 64u);
+  auto diff = global_stats().Collect()->Diff(*before);
+  EXPECT_GE(diff->combiner_batch_deferrals, 1u);
+  EXPECT_GE(diff->combiner_budget_offloads, 1u);
+  ExecCtx exec_ctx;
+  GRPC_COMBINER_UNREF(lock, "test_batch_drain");
+}
+
+TEST(CombinerBatchDrainTest, ForceOffloadSkipsTheBatch) {
+  Combiner* lock = grpc_combiner_create(
+      grpc_event_engine::experimental::CreateEventEngine());
+  const auto start_thread = std::this_thread::get_id();
+  Notification done;
+  {
+    FinishingExecCtx exec_ctx;
+    lock->Run(NewClosure([&](grpc_error_handle) {
+                ExecCtx other_exec_ctx;
+                lock->ForceOffload();
+                lock->Run(NewClosure([&](grpc_error_handle) {
+                            EXPECT_NE(start_thread, std::this_thread::get_id());
+                            done.Notify();
+                          }),
+                          absl::OkStatus());
+              }),
+              absl::OkStatus());
+    exec_ctx.Flush();
+    done.WaitForNotification();
+  }
+  ExecCtx exec_ctx;
+  GRPC_COMBINER_UNREF(lock, "test_force_offload");
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc_core::ForceEnableExperiment("combiner_batch_drain", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestGrpcScope grpc_scope;
+  return RUN_ALL_TESTS();
+}
@@ -15,9 +15,13 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "absl/strings/string_view.h"
+#include "src/core/client_channel/client_channel_internal.h"
 #include "src/core/client_channel/subchannel_interface_internal.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/address_utils/parse_address.h"
@@ -26,7 +30,9 @@
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/load_balancing/health_check_client_internal.h"
 #include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/ring_hash/ring_hash.h"
 #include "src/core/util/json/json_reader.h"
+#include "src/core/util/notification.h"
 #include "test/core/test_util/build.h"
 
 namespace grpc_core {
@@ -50,11 +56,29 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
     config_ = std::move(*config_parsed);
   }
 
+  // Returns the picker once the LB policy has seen every endpoint become
+  // READY.  Connectivity updates are delivered on the work serializer, so
+  // drain it until the policy stops publishing new pickers; otherwise we
+  // would benchmark a picker over only the first endpoints to connect.
   RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetPicker() {
-    MutexLock lock(&mu_);
-    while (picker_ == nullptr) {
-      cv_.Wait(&mu_);
+    int quiet_drains = 0;
+    while (quiet_drains < 2) {
+      uint64_t picker_updates;
+      {
+        MutexLock lock(&mu_);
+        picker_updates = picker_updates_;
+      }
+      Notification drained;
+      work_serializer_->Run([&drained]() { drained.Notify(); });
+      drained.WaitForNotification();
+      MutexLock lock(&mu_);
+      if (picker_ != nullptr && picker_updates_ == picker_updates) {
+        ++quiet_drains;
+      } else {
+        quiet_drains = 0;
+      }
     }
+    MutexLock lock(&mu_);
     return picker_;
   }
 
@@ -153,7 +177,7 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
         RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) override {
       MutexLock lock(&helper_->mu_);
       helper_->picker_ = std::move(picker);
-      helper_->cv_.SignalAll();
+      ++helper_->picker_updates_;
     }
 
     void RequestReresolution() override { LOG(FATAL) << "unimplemented"; }
@@ -201,9 +225,9 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
                                            ChannelArgs()});
   RefCountedPtr<LoadBalancingPolicy::Config> config_;
   Mutex mu_;
-  CondVar cv_;
   RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
       ABSL_GUARDED_BY(mu_);
+  uint64_t picker_updates_ ABSL_GUARDED_BY(mu_) = 0;
   absl::flat_hash_set<
       std::shared_ptr<SubchannelInterface::ConnectivityStateWatcherInterface>>
       connectivity_watchers_ ABSL_GUARDED_BY(mu_);
@@ -215,14 +239,57 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
                   ChannelArgs{}}));
 };
 
+// Initial metadata with no entries.
+class BenchmarkMetadata final : public LoadBalancingPolicy::MetadataInterface {
+ public:
+  std::optional<absl::string_view> Lookup(absl::string_view /*key*/,
+                                          std::string* /*buffer*/)
+      const override {
+    return std::nullopt;
+  }
+};
+
+// Call state carrying the request hash that the xDS resolver would attach
+// for ring_hash.
+class BenchmarkCallState final : public ClientChannelLbCallState {
+ public:
+  void* Alloc(size_t /*size*/) override { LOG(FATAL) << "unimplemented"; }
+
+  ServiceConfigCallData::CallAttributeInterface* GetCallAttribute(
+      UniqueTypeName type) const override {
+    if (type == RequestHashAttribute::TypeName()) return &request_hash_;
+    return nullptr;
+  }
+
+  ClientCallTracer::CallAttemptTracer* GetCallAttemptTracer() const override {
+    return nullptr;
+  }
+
+  void set_request_hash(uint64_t request_hash) {
+    request_hash_ = RequestHashAttribute(request_hash);
+  }
+
+ private:
+  mutable RequestHashAttribute request_hash_{0};
+};
+
+// Picks are made on the benchmark thread with the result dropped straight
+// away, so this measures the cost of Pick() plus that of destroying the
+// result (e.g. a subchannel call tracker), which is what every RPC pays.
 void BM_Pick(benchmark::State& state, BenchmarkHelper& helper) {
   helper.UpdateLbPolicy(state.range(0));
   auto picker = helper.GetPicker();
+  BenchmarkMetadata metadata;
+  BenchmarkCallState call_state;
+  uint64_t request_hash = 0;
   for (auto _ : state) {
+    // Spread requests over the whole ring.
+    request_hash += 0x9e3779b97f4a7c15;
+    call_state.set_request_hash(request_hash);
     picker->Pick(LoadBalancingPolicy::PickArgs{
         "/foo/bar",
-        nullptr,
-        nullptr,
+        &metadata,
+        &call_state,
     });
   }
 }
@@ -237,9 +304,15 @@ void BM_Pick(benchmark::State& state, BenchmarkHelper& helper) {
       ->Range(1, IsSlowBuild() ? 1000 : 100000)
 
 PICKER_BENCHMARK(pick_first, "[{\"pick_first\":{}}]");
+PICKER_BENCHMARK(round_robin, "[{\"round_robin\":{}}]");
 PICKER_BENCHMARK(
     weighted_round_robin,
     "[{\"weighted_round_robin\":{\"enableOobLoadReport\":false}}]");
+PICKER_BENCHMARK(ring_hash_experimental, "[{\"ring_hash_experimental\":{}}]");
+PICKER_BENCHMARK(least_request, "[{\"least_request\":{}}]");
+PICKER_BENCHMARK(peak_ewma, "[{\"peak_ewma\":{}}]");
+PICKER_BENCHMARK(locality_aware,
+                 "[{\"locality_aware\":{\"localZone\":\"local\"}}]");
 
 }  // namespace
 }  // namespace grpc_core
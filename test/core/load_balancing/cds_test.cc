@@ -0,0 +1,186 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/resolver/xds/xds_config.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/xds/grpc/xds_cluster.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+
+extern void RegisterCdsLbPolicy(CoreConfiguration::Builder* builder);
+
+namespace testing {
+namespace {
+
+constexpr absl::string_view kPriority = "priority_experimental";
+
+// Stands in for the priority policy that CDS delegates to, and counts the
+// updates it gets.
+class CountingPriorityLb final : public LoadBalancingPolicy {
+ public:
+  class Config final : public LoadBalancingPolicy::Config {
+   public:
+    absl::string_view name() const override { return kPriority; }
+  };
+
+  explicit CountingPriorityLb(Args args)
+      : LoadBalancingPolicy(std::move(args)) {}
+
+  static std::atomic<int> updates;
+
+  absl::string_view name() const override { return kPriority; }
+
+  absl::Status UpdateLocked(UpdateArgs /*args*/) override {
+    updates.fetch_add(1, std::memory_order_relaxed);
+    return absl::OkStatus();
+  }
+
+  void ExitIdleLocked() override {}
+  void ResetBackoffLocked() override {}
+
+ private:
+  void ShutdownLocked() override {}
+};
+
+std::atomic<int> CountingPriorityLb::updates{0};
+
+class CountingPriorityLbFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<CountingPriorityLb>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kPriority; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& /*json*/) const override {
+    return MakeRefCounted<CountingPriorityLb::Config>();
+  }
+};
+
+class CdsTest : public LoadBalancingPolicyTest {
+ protected:
+  CdsTest() : LoadBalancingPolicyTest("cds_experimental") {}
+
+  void SetUp() override {
+    builder_ = std::make_unique<CoreConfiguration::WithSubstituteBuilder>(
+        [](CoreConfiguration::Builder* builder) {
+          RegisterCdsLbPolicy(builder);
+          builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+              std::make_unique<CountingPriorityLbFactory>());
+        });
+    CountingPriorityLb::updates.store(0, std::memory_order_relaxed);
+    LoadBalancingPolicyTest::SetUp();
+  }
+
+  void TearDown() override {
+    LoadBalancingPolicyTest::TearDown();
+    builder_.reset();
+  }
+
+  // The clusters of an aggregate cluster "aggregate" with leaf clusters
+  // "leaf0" and "leaf1".  Updates that reuse these resources carry an
+  // unchanged config.
+  struct Clusters {
+    std::shared_ptr<const XdsClusterResource> aggregate =
+        std::make_shared<XdsClusterResource>();
+    std::shared_ptr<const XdsClusterResource> leaf0 =
+        std::make_shared<XdsClusterResource>();
+    std::shared_ptr<const XdsClusterResource> leaf1 =
+        std::make_shared<XdsClusterResource>();
+  };
+
+  static RefCountedPtr<XdsConfig> MakeXdsConfig(const Clusters& clusters) {
+    auto xds_config = MakeRefCounted<XdsConfig>();
+    xds_config->clusters["aggregate"].emplace(
+        clusters.aggregate, std::vector<absl::string_view>{"leaf0", "leaf1"});
+    xds_config->clusters["leaf0"].emplace(clusters.leaf0, nullptr, "");
+    xds_config->clusters["leaf1"].emplace(clusters.leaf1, nullptr, "");
+    return xds_config;
+  }
+
+  absl::Status UpdateCds(RefCountedPtr<const XdsConfig> xds_config) {
+    auto config = MakeConfig(Json::FromArray({Json::FromObject(
+        {{"cds_experimental",
+          Json::FromObject({{"cluster", Json::FromString("aggregate")}})}})}));
+    return ApplyUpdate(
+        BuildUpdate(absl::Span<const EndpointAddresses>(), std::move(config),
+                    ChannelArgs().SetObject(std::move(xds_config))),
+        lb_policy());
+  }
+
+ private:
+  std::unique_ptr<CoreConfiguration::WithSubstituteBuilder> builder_;
+};
+
+TEST_F(CdsTest, UnchangedAggregateClusterSkipsTheChildUpdate) {
+  Clusters clusters;
+  EXPECT_EQ(UpdateCds(MakeXdsConfig(clusters)), absl::OkStatus());
+  EXPECT_EQ(CountingPriorityLb::updates.load(), 1);
+  // A new XdsConfig, e.g. for a change to an unrelated cluster, with the
+  // same resources for the aggregate cluster and its leaves.
+  EXPECT_EQ(UpdateCds(MakeXdsConfig(clusters)), absl::OkStatus());
+  EXPECT_EQ(CountingPriorityLb::updates.load(), 1);
+}
+
+TEST_F(CdsTest, ChangedLeafClusterUpdatesTheChild) {
+  Clusters clusters;
+  EXPECT_EQ(UpdateCds(MakeXdsConfig(clusters)), absl::OkStatus());
+  EXPECT_EQ(CountingPriorityLb::updates.load(), 1);
+  clusters.leaf1 = std::make_shared<XdsClusterResource>();
+  EXPECT_EQ(UpdateCds(MakeXdsConfig(clusters)), absl::OkStatus());
+  EXPECT_EQ(CountingPriorityLb::updates.load(), 2);
+}
+
+TEST_F(CdsTest, FailedLeafClusterUpdatesTheChild) {
+  Clusters clusters;
+  EXPECT_EQ(UpdateCds(MakeXdsConfig(clusters)), absl::OkStatus());
+  EXPECT_EQ(CountingPriorityLb::updates.load(), 1);
+  auto xds_config = MakeXdsConfig(clusters);
+  xds_config->clusters["leaf0"] =
+      absl::UnavailableError("leaf0 is unavailable");
+  EXPECT_EQ(UpdateCds(std::move(xds_config)), absl::OkStatus());
+  EXPECT_EQ(CountingPriorityLb::updates.load(), 2);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
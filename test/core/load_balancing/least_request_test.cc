@@ -0,0 +1,205 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : LoadBalancingPolicyTest("least_request") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeLeastRequestConfig(
+      Json::Object fields = {}) {
+    return MakeConfig(Json::FromArray(
+        {Json::FromObject({{"least_request", Json::FromObject(fields)}})}));
+  }
+
+  // Connects to every address and returns the picker reported once all of
+  // them are READY.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses) {
+    std::vector<SubchannelState*> subchannels;
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      EXPECT_NE(subchannel, nullptr) << address;
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannels.push_back(subchannel);
+    }
+    for (size_t i = 0; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) ExpectConnectingUpdate();
+    }
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = i == 0 ? WaitForConnected() : ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  // Does num_picks picks, each of which completes immediately, and returns
+  // the number of picks for each address.
+  std::map<std::string, size_t> CountPicks(
+      LoadBalancingPolicy::SubchannelPicker* picker, size_t num_picks) {
+    std::map<std::string, size_t> counts;
+    auto picks = GetCompletePicks(picker, num_picks);
+    EXPECT_TRUE(picks.has_value());
+    if (!picks.has_value()) return counts;
+    for (const std::string& address : *picks) ++counts[address];
+    return counts;
+  }
+
+  // Picks until a call goes to address, then starts that call and returns
+  // its tracker.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+  StartCallTo(LoadBalancingPolicy::SubchannelPicker* picker,
+              absl::string_view address) {
+    for (size_t i = 0; i < 100; ++i) {
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          tracker;
+      auto picked = ExpectPickComplete(picker, {}, {}, &tracker);
+      EXPECT_TRUE(picked.has_value());
+      if (!picked.has_value()) return nullptr;
+      EXPECT_NE(tracker, nullptr);
+      if (tracker == nullptr) return nullptr;
+      tracker->Start();
+      if (*picked == address) return tracker;
+      FinishCall(std::move(tracker), *picked);
+    }
+    ADD_FAILURE() << "never picked " << address;
+    return nullptr;
+  }
+
+  static void FinishCall(
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          tracker,
+      absl::string_view address,
+      std::optional<BackendMetricData> backend_metric_data = std::nullopt) {
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor(
+        std::move(backend_metric_data));
+    LoadBalancingPolicy::SubchannelCallTrackerInterface::FinishArgs args = {
+        address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+    tracker->Finish(args);
+  }
+};
+
+TEST_F(LeastRequestTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig()),
+                  lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // With no calls in flight, every endpoint gets picks.
+  auto counts = CountPicks(picker.get(), 300);
+  for (absl::string_view address : kAddresses) {
+    EXPECT_GT(counts[std::string(address)], 0u) << address;
+  }
+}
+
+TEST_F(LeastRequestTest, AvoidsEndpointWithCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig()),
+                  lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto tracker = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  // The busy endpoint is only picked when both choices land on it, which
+  // happens for a quarter of picks.
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_LT(counts[std::string(kAddresses[0])], 400u);
+  // Once the call finishes, both endpoints are equally good again.
+  FinishCall(std::move(tracker), kAddresses[0]);
+  counts = CountPicks(picker.get(), 1000);
+  EXPECT_GT(counts[std::string(kAddresses[0])], 400u);
+  EXPECT_GT(counts[std::string(kAddresses[1])], 400u);
+}
+
+TEST_F(LeastRequestTest, UtilizationWeighting) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(
+      ApplyUpdate(
+          BuildUpdate(kAddresses,
+                      MakeLeastRequestConfig({{"enableUtilizationWeighting",
+                                               Json::FromBool(true)}})),
+          lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  BackendMetricData busy;
+  busy.application_utilization = 0.9;
+  auto tracker = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  FinishCall(std::move(tracker), kAddresses[0], busy);
+  // No calls are in flight, but the endpoint reporting high utilization
+  // still loses every comparison.
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_LT(counts[std::string(kAddresses[0])], 400u);
+}
+
+TEST(LeastRequestConfigTest, RejectsChoiceCountBelowTwo) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"least_request",
+                Json::FromObject({{"choiceCount", Json::FromNumber(1)}})}})}));
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(config.status().message(),
+            "errors validating least_request LB policy config: "
+            "[field:choiceCount error:must be at least 2]")
+      << config.status();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,187 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Endpoints in zone "a" followed by endpoints in zone "b".
+constexpr std::array<absl::string_view, 4> kAddresses = {
+    "ipv4:127.0.0.1:443", "ipv4:127.0.0.2:443", "ipv4:127.0.1.1:443",
+    "ipv4:127.0.1.2:443"};
+
+class LocalityAwareTest : public LoadBalancingPolicyTest {
+ protected:
+  LocalityAwareTest() : LoadBalancingPolicyTest("locality_aware") {}
+
+  // Puts 127.0.0.0/24 in zone "a" and 127.0.1.0/24 in zone "b".
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeLocalityAwareConfig(
+      absl::string_view local_zone) {
+    auto zone = [](absl::string_view name, absl::string_view prefix) {
+      return Json::FromObject(
+          {{"name", Json::FromString(std::string(name))},
+           {"addressPrefixes",
+            Json::FromArray({Json::FromString(std::string(prefix))})}});
+    };
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"locality_aware",
+          Json::FromObject(
+              {{"localZone", Json::FromString(std::string(local_zone))},
+               {"zones", Json::FromArray({zone("a", "127.0.0.0/24"),
+                                          zone("b", "127.0.1.0/24")})}})}})}));
+  }
+
+  // Connects to every address and returns the picker reported once all of
+  // them are READY.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses) {
+    std::vector<SubchannelState*> subchannels;
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      EXPECT_NE(subchannel, nullptr) << address;
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannels.push_back(subchannel);
+    }
+    for (size_t i = 0; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) ExpectConnectingUpdate();
+    }
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = i == 0 ? WaitForConnected() : ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  // Disconnects the endpoint at address and returns the latest picker,
+  // which no longer uses it.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> Disconnect(
+      absl::string_view address) {
+    auto* subchannel = FindSubchannel(address);
+    EXPECT_NE(subchannel, nullptr) << address;
+    if (subchannel == nullptr) return nullptr;
+    subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+    ExpectReresolutionRequest();
+    EXPECT_TRUE(subchannel->ConnectionRequested());
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    while (!helper_->QueueEmpty()) picker = ExpectState(GRPC_CHANNEL_READY);
+    return picker;
+  }
+
+  // Does num_picks picks, each of which completes immediately, and returns
+  // the number of picks for each address.
+  std::map<std::string, size_t> CountPicks(
+      LoadBalancingPolicy::SubchannelPicker* picker, size_t num_picks) {
+    std::map<std::string, size_t> counts;
+    auto picks = GetCompletePicks(picker, num_picks);
+    EXPECT_TRUE(picks.has_value());
+    if (!picks.has_value()) return counts;
+    for (const std::string& address : *picks) ++counts[address];
+    return counts;
+  }
+};
+
+TEST_F(LocalityAwareTest, PrefersLocalZone) {
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLocalityAwareConfig("b")),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  ExpectRoundRobinPicks(picker.get(), {kAddresses[2], kAddresses[3]});
+}
+
+TEST_F(LocalityAwareTest, SpillsOverAsLocalCapacityIsLost) {
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLocalityAwareConfig("a")),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  ExpectRoundRobinPicks(picker.get(), {kAddresses[0], kAddresses[1]});
+  // With half of the local capacity gone, half of the picks go to the
+  // other zone.
+  picker = Disconnect(kAddresses[0]);
+  ASSERT_NE(picker, nullptr);
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_EQ(counts[std::string(kAddresses[0])], 0u);
+  EXPECT_GT(counts[std::string(kAddresses[1])], 400u);
+  EXPECT_LT(counts[std::string(kAddresses[1])], 600u);
+  EXPECT_GT(counts[std::string(kAddresses[2])], 200u);
+  EXPECT_GT(counts[std::string(kAddresses[3])], 200u);
+  // With none of it left, every pick goes to the other zone.
+  picker = Disconnect(kAddresses[1]);
+  ASSERT_NE(picker, nullptr);
+  ExpectRoundRobinPicks(picker.get(), {kAddresses[2], kAddresses[3]});
+}
+
+TEST_F(LocalityAwareTest, UnknownZoneIsRemote) {
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLocalityAwareConfig("c")),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  ExpectRoundRobinPicks(picker.get(), kAddresses);
+}
+
+TEST(LocalityAwareConfigTest, RejectsBadAddressPrefix) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"locality_aware",
+                Json::FromObject(
+                    {{"localZone", Json::FromString("a")},
+                     {"zones",
+                      Json::FromArray({Json::FromObject(
+                          {{"name", Json::FromString("a")},
+                           {"addressPrefixes",
+                            Json::FromArray(
+                                {Json::FromString("10.0.0.0")})}})})}})}})}));
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(config.status().message(),
+            "errors validating locality_aware LB policy config: "
+            "[field:zones[0].addressPrefixes[0] "
+            "error:not a valid CIDR range]")
+      << config.status();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,239 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class PeakEwmaTest : public LoadBalancingPolicyTest {
+ protected:
+  PeakEwmaTest() : LoadBalancingPolicyTest("peak_ewma") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakePeakEwmaConfig(
+      Json::Object fields = {}) {
+    return MakeConfig(Json::FromArray(
+        {Json::FromObject({{"peak_ewma", Json::FromObject(fields)}})}));
+  }
+
+  // Connects to every address and returns the picker reported once all of
+  // them are READY.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses) {
+    std::vector<SubchannelState*> subchannels;
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      EXPECT_NE(subchannel, nullptr) << address;
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannels.push_back(subchannel);
+    }
+    for (size_t i = 0; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) ExpectConnectingUpdate();
+    }
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = i == 0 ? WaitForConnected() : ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  // Does num_picks picks, each of which completes immediately, and returns
+  // the number of picks for each address.
+  std::map<std::string, size_t> CountPicks(
+      LoadBalancingPolicy::SubchannelPicker* picker, size_t num_picks) {
+    std::map<std::string, size_t> counts;
+    auto picks = GetCompletePicks(picker, num_picks);
+    EXPECT_TRUE(picks.has_value());
+    if (!picks.has_value()) return counts;
+    for (const std::string& address : *picks) ++counts[address];
+    return counts;
+  }
+
+  // Picks until a call goes to address, then starts that call and returns
+  // its tracker.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+  StartCallTo(LoadBalancingPolicy::SubchannelPicker* picker,
+              absl::string_view address) {
+    for (size_t i = 0; i < 100; ++i) {
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          tracker;
+      auto picked = ExpectPickComplete(picker, {}, {}, &tracker);
+      EXPECT_TRUE(picked.has_value());
+      if (!picked.has_value()) return nullptr;
+      EXPECT_NE(tracker, nullptr);
+      if (tracker == nullptr) return nullptr;
+      tracker->Start();
+      if (*picked == address) return tracker;
+      FinishCall(std::move(tracker), *picked);
+    }
+    ADD_FAILURE() << "never picked " << address;
+    return nullptr;
+  }
+
+  static void FinishCall(
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          tracker,
+      absl::string_view address, absl::Status status = absl::OkStatus()) {
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor(std::nullopt);
+    LoadBalancingPolicy::SubchannelCallTrackerInterface::FinishArgs args = {
+        address, std::move(status), &metadata, &backend_metric_accessor};
+    tracker->Finish(args);
+  }
+};
+
+TEST_F(PeakEwmaTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // With nothing known about latency, every endpoint gets picks.
+  auto counts = CountPicks(picker.get(), 300);
+  for (absl::string_view address : kAddresses) {
+    EXPECT_GT(counts[std::string(address)], 0u) << address;
+  }
+}
+
+TEST_F(PeakEwmaTest, AvoidsSlowEndpoint) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto tracker = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  IncrementTimeBy(Duration::Milliseconds(100));
+  FinishCall(std::move(tracker), kAddresses[0]);
+  // The slow endpoint is only picked when both choices land on it, which
+  // happens for a quarter of picks.
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_LT(counts[std::string(kAddresses[0])], 400u);
+}
+
+TEST_F(PeakEwmaTest, AvoidsUnmeasuredEndpointWithCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Until its first call completes, an endpoint with a call in flight is
+  // treated as slower than any measured one.
+  auto tracker = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  auto fast = StartCallTo(picker.get(), kAddresses[1]);
+  ASSERT_NE(fast, nullptr);
+  IncrementTimeBy(Duration::Milliseconds(10));
+  FinishCall(std::move(fast), kAddresses[1]);
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_LT(counts[std::string(kAddresses[0])], 400u);
+  FinishCall(std::move(tracker), kAddresses[0]);
+}
+
+TEST_F(PeakEwmaTest, AvoidsFailingEndpoint) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // The failing endpoint answers at once, and the other one takes a while.
+  auto failing = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(failing, nullptr);
+  FinishCall(std::move(failing), kAddresses[0],
+             absl::UnavailableError("backend down"));
+  auto slow = StartCallTo(picker.get(), kAddresses[1]);
+  ASSERT_NE(slow, nullptr);
+  IncrementTimeBy(Duration::Milliseconds(100));
+  FinishCall(std::move(slow), kAddresses[1]);
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_LT(counts[std::string(kAddresses[0])], 400u);
+}
+
+TEST_F(PeakEwmaTest, CancelledCallsAreNotPenalized) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto cancelled = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(cancelled, nullptr);
+  FinishCall(std::move(cancelled), kAddresses[0],
+             absl::CancelledError("cancelled by the application"));
+  auto slow = StartCallTo(picker.get(), kAddresses[1]);
+  ASSERT_NE(slow, nullptr);
+  IncrementTimeBy(Duration::Milliseconds(100));
+  FinishCall(std::move(slow), kAddresses[1]);
+  // The endpoint of the cancelled call still looks faster.
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_GT(counts[std::string(kAddresses[0])], 600u);
+}
+
+TEST(PeakEwmaConfigTest, RejectsZeroDecayTime) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"peak_ewma",
+                Json::FromObject({{"decayTime", Json::FromString("0s")}})}})}));
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(config.status().message(),
+            "errors validating peak_ewma LB policy config: "
+            "[field:decayTime error:must be greater than zero]")
+      << config.status();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1449,6 +1449,50 @@ TEST_F(PickFirstTest, MetricValues) {
       ::testing::Optional(1));
 }
 
+class PickFirstAdaptiveConnectionAttemptDelayTest : public PickFirstTest {
+ protected:
+  PickFirstAdaptiveConnectionAttemptDelayTest()
+      : PickFirstTest(ChannelArgs().Set(
+            GRPC_ARG_EXPERIMENTAL_HAPPY_EYEBALLS_ADAPTIVE_CONNECTION_ATTEMPT_DELAY,
+            true)) {}
+};
+
+TEST_F(PickFirstAdaptiveConnectionAttemptDelayTest,
+       DelayFollowsPastConnectionTimes) {
+  if (!IsPickFirstNewEnabled()) return;
+  constexpr std::array<absl::string_view, 2> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, MakePickFirstConfig(false)), lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto* subchannel = FindSubchannel(kAddresses[0]);
+  ASSERT_NE(subchannel, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel2, nullptr);
+  // The first attempt uses the configured delay, and connects in 30ms.
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  IncrementTimeBy(Duration::Milliseconds(30));
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  // The connection fails.  The next Happy Eyeballs pass uses twice the
+  // connection time, raised to the 100ms minimum.
+  SetExpectedTimerDuration(std::chrono::milliseconds(100));
+  subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  ExpectReresolutionRequest();
+  ExpectStateAndQueuingPicker(GRPC_CHANNEL_IDLE);
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  EXPECT_FALSE(subchannel2->ConnectionRequested());
+  IncrementTimeBy(Duration::Milliseconds(100));
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+}
+
 class PickFirstHealthCheckingEnabledTest : public PickFirstTest {
  protected:
   PickFirstHealthCheckingEnabledTest()
@@ -32,6 +32,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
 #include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
@@ -356,6 +357,103 @@ TEST_F(RingHashTest, EndpointHashKeys) {
   EXPECT_EQ(address, kAddresses[1]);
 }
 
+TEST_F(RingHashTest, EndpointChurnKeepsExistingPoints) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeRingHashConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  auto* address0_attribute = MakeHashAttribute(kAddresses[0]);
+  ExpectPickQueued(picker.get(), {address0_attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  auto* subchannel = FindSubchannel(kAddresses[0]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  EXPECT_EQ(ExpectPickComplete(picker.get(), {address0_attribute}),
+            kAddresses[0]);
+  // Adding and removing endpoints rebuilds the ring from the previous one.
+  // The first point of the first endpoint is still there, so the same hash
+  // still picks it.
+  const std::array<absl::string_view, 3> kNewAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kNewAddresses, MakeRingHashConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  EXPECT_EQ(ExpectPickComplete(picker.get(), {address0_attribute}),
+            kAddresses[0]);
+  // Removing that endpoint takes its points off the ring, so the hash now
+  // lands on another endpoint, which is asked to connect.
+  const std::array<absl::string_view, 2> kRemainingAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kRemainingAddresses, MakeRingHashConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  picker = ExpectState(GRPC_CHANNEL_IDLE);
+  ExpectPickQueued(picker.get(), {address0_attribute});
+}
+
+TEST_F(RingHashTest, MaglevLookupTable) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto config = MakeConfig(Json::FromArray({Json::FromObject(
+      {{"ring_hash_experimental",
+        Json::FromObject({{"lookupTable", Json::FromString("maglev")},
+                          {"maglevTableSize", Json::FromNumber(257)}})}})}));
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, config), lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  auto* hash_attribute = MakeHashAttributeForString("some_request");
+  ExpectPickQueued(picker.get(), {hash_attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  // The table entry for the request's hash determines which endpoint is
+  // connected to; only that one should be.
+  SubchannelState* subchannel = nullptr;
+  for (absl::string_view address : kAddresses) {
+    auto* candidate = FindSubchannel(address);
+    if (candidate == nullptr) continue;
+    EXPECT_EQ(subchannel, nullptr) << "second subchannel created: " << address;
+    subchannel = candidate;
+  }
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get(), {hash_attribute});
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto address = ExpectPickComplete(picker.get(), {hash_attribute});
+  ASSERT_TRUE(address.has_value());
+  EXPECT_EQ(FindSubchannel(*address), subchannel);
+  // Picks for the same hash keep going to the same endpoint.
+  for (size_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(ExpectPickComplete(picker.get(), {hash_attribute}), address);
+  }
+}
+
+TEST(RingHashConfigTest, MaglevTableSizeMustBePrime) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"ring_hash_experimental",
+                Json::FromObject(
+                    {{"lookupTable", Json::FromString("maglev")},
+                     {"maglevTableSize", Json::FromNumber(65536)}})}})}));
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(config.status().message(),
+            "errors validating ring_hash LB policy config: "
+            "[field:maglevTableSize error:must be a prime no larger than "
+            "5000011]")
+      << config.status();
+}
+
 TEST_F(RingHashTest, PickFailsWithoutRequestHashAttribute) {
   const std::array<absl::string_view, 3> kAddresses = {
       "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
@@ -16,16 +16,21 @@
 
 #include <grpc/grpc.h>
 
+#include <algorithm>
 #include <array>
 #include <memory>
+#include <string>
 
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
 #include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
 #include "test/core/load_balancing/lb_policy_test_lib.h"
 #include "test/core/test_util/test_config.h"
 
@@ -36,6 +41,42 @@ namespace {
 class RoundRobinTest : public LoadBalancingPolicyTest {
  protected:
   RoundRobinTest() : LoadBalancingPolicyTest("round_robin") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeSlowStartConfig(
+      absl::string_view slow_start_window, double min_weight_percent) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"round_robin",
+          Json::FromObject(
+              {{"slowStartConfig",
+                Json::FromObject(
+                    {{"slowStartWindow", Json::FromString(
+                                             std::string(slow_start_window))},
+                     {"minWeightPercent",
+                      Json::FromNumber(min_weight_percent)}})}})}})}));
+  }
+
+  // Returns the picker from the last of the queued state updates, all of
+  // which must be READY.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> DrainToLatestPicker() {
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    while (!helper_->QueueEmpty()) {
+      auto update = helper_->GetNextStateUpdate();
+      EXPECT_TRUE(update.has_value());
+      if (!update.has_value()) return nullptr;
+      EXPECT_EQ(update->state, GRPC_CHANNEL_READY);
+      picker = std::move(update->picker);
+    }
+    return picker;
+  }
+
+  // Returns how many of num_picks picks went to address.
+  size_t CountPicksTo(LoadBalancingPolicy::SubchannelPicker* picker,
+                      absl::string_view address, size_t num_picks) {
+    auto picks = GetCompletePicks(picker, num_picks);
+    EXPECT_TRUE(picks.has_value());
+    if (!picks.has_value()) return 0;
+    return std::count(picks->begin(), picks->end(), address);
+  }
 };
 
 TEST_F(RoundRobinTest, Basic) {
@@ -147,6 +188,61 @@ TEST_F(RoundRobinTest, MultipleAddressesPerEndpoint) {
 // - empty address list
 // - subchannels failing connection attempts
 
+TEST_F(RoundRobinTest, SlowStart) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto config = MakeSlowStartConfig("10s", 10);
+  // The initial endpoints do not warm up: there is nothing else to send
+  // their traffic to.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(absl::MakeSpan(kAddresses).first(2),
+                                    config),
+                        lb_policy()),
+            absl::OkStatus());
+  ExpectRoundRobinStartup(absl::MakeSpan(kAddresses).first(2));
+  // Add an endpoint.  Once it is READY, it starts out with a small share of
+  // the traffic.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, config), lb_policy()),
+            absl::OkStatus());
+  auto* subchannel = FindSubchannel(kAddresses[2]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = DrainToLatestPicker();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_LT(CountPicksTo(picker.get(), kAddresses[2], 900), 150u);
+  // Half way through the window, it gets about half its share.
+  IncrementTimeBy(Duration::Seconds(5));
+  const size_t half_way = CountPicksTo(picker.get(), kAddresses[2], 900);
+  EXPECT_GT(half_way, 100u);
+  EXPECT_LT(half_way, 280u);
+  // Once the window is over, it gets its full share.
+  IncrementTimeBy(Duration::Seconds(5));
+  ExpectRoundRobinPicks(picker.get(), kAddresses);
+}
+
+TEST(RoundRobinConfigTest, RejectsBadSlowStartConfig) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"round_robin",
+                Json::FromObject({{"slowStartConfig",
+                                   Json::FromObject({
+                                       {"slowStartWindow",
+                                        Json::FromString("10s")},
+                                       {"aggression", Json::FromNumber(0)},
+                                       {"minWeightPercent",
+                                        Json::FromNumber(101)},
+                                   })}})}})}));
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(config.status().message(),
+            "errors validating round_robin LB policy config: ["
+            "field:slowStartConfig.aggression error:must be greater than zero; "
+            "field:slowStartConfig.minWeightPercent error:must be between 0 "
+            "and 100]")
+      << config.status();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -21,12 +21,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -993,6 +995,89 @@ TEST_F(WeightedRoundRobinTest, MultipleAddressesPerEndpoint) {
   EXPECT_FALSE(subchannel3_1->ConnectionRequested());
 }
 
+TEST_F(WeightedRoundRobinTest, ConcurrentPicksFollowWeights) {
+  // Send address list to LB policy.
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = SendInitialUpdateAndWaitForConnected(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  WaitForWeightedRoundRobinPicks(
+      &picker,
+      {{kAddresses[0], MakeBackendMetricData(/*app_utilization=*/0.9,
+                                             /*qps=*/100.0, /*eps=*/0.0)},
+       {kAddresses[1], MakeBackendMetricData(/*app_utilization=*/0.3,
+                                             /*qps=*/100.0, /*eps=*/0.0)},
+       {kAddresses[2], MakeBackendMetricData(/*app_utilization=*/0.45,
+                                             /*qps=*/100.0, /*eps=*/0.0)}},
+      {{kAddresses[0], 1}, {kAddresses[1], 3}, {kAddresses[2], 2}});
+  // Each thread's picks advance the sequence of the CPU it runs on, so the
+  // threads do not share one sequence, but together they should still
+  // follow the weights.
+  constexpr size_t kNumThreads = 4;
+  constexpr size_t kPicksPerThread = 6000;
+  std::array<std::vector<std::string>, kNumThreads> picks;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      auto thread_picks = GetCompletePicks(picker.get(), kPicksPerThread);
+      if (thread_picks.has_value()) picks[i] = std::move(*thread_picks);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  std::map<absl::string_view, size_t> actual;
+  for (const auto& thread_picks : picks) {
+    ASSERT_EQ(thread_picks.size(), kPicksPerThread);
+    for (const auto& address : thread_picks) ++actual[address];
+  }
+  LOG(INFO) << "Pick map: " << PickMapString(actual);
+  constexpr size_t kNumPicks = kNumThreads * kPicksPerThread;
+  EXPECT_NEAR(actual[kAddresses[0]], kNumPicks / 6, kNumPicks / 100);
+  EXPECT_NEAR(actual[kAddresses[1]], kNumPicks / 2, kNumPicks / 100);
+  EXPECT_NEAR(actual[kAddresses[2]], kNumPicks / 3, kNumPicks / 100);
+}
+
+TEST_F(WeightedRoundRobinTest, PicksDoNotBlockSchedulerUpdates) {
+  // Send address list to LB policy.
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = SendInitialUpdateAndWaitForConnected(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  WaitForWeightedRoundRobinPicks(
+      &picker,
+      {{kAddresses[0], MakeBackendMetricData(/*app_utilization=*/0.9,
+                                             /*qps=*/100.0, /*eps=*/0.0)},
+       {kAddresses[1], MakeBackendMetricData(/*app_utilization=*/0.3,
+                                             /*qps=*/100.0, /*eps=*/0.0)}},
+      {{kAddresses[0], 1}, {kAddresses[1], 3}, {kAddresses[2], 2}});
+  // Keep picking on other threads while the weight update timer publishes
+  // new schedulers. Publishing waits for the picks using the slot it
+  // overwrites, so this would hang if a pick never released its slot.
+  constexpr size_t kNumThreads = 4;
+  std::atomic<bool> done{false};
+  std::array<size_t, kNumThreads> num_picks{};
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      while (!done.load(std::memory_order_relaxed)) {
+        auto address = ExpectPickComplete(picker.get());
+        if (!address.has_value()) return;
+        EXPECT_NE(std::find(kAddresses.begin(), kAddresses.end(), *address),
+                  kAddresses.end())
+            << *address;
+        ++num_picks[i];
+      }
+    });
+  }
+  for (size_t i = 0; i < 10; ++i) IncrementTimeBy(Duration::Seconds(1));
+  done.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) thread.join();
+  for (size_t count : num_picks) EXPECT_GT(count, 0u);
+  // The weights are unchanged by the updates.
+  WaitForWeightedRoundRobinPicks(
+      &picker, {},
+      {{kAddresses[0], 1}, {kAddresses[1], 3}, {kAddresses[2], 2}});
+}
+
 TEST_F(WeightedRoundRobinTest, MetricDefinitionRrFallback) {
   const auto* descriptor =
       GlobalInstrumentsRegistryTestPeer::FindMetricDescriptorByName(
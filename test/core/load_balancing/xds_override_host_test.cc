@@ -327,6 +327,37 @@ TEST_F(XdsOverrideHostTest,
                                      {kAddresses[0], kAddresses[2]});
 }
 
+TEST_F(XdsOverrideHostTest, OverrideHostFollowsSubchannelStateInOldPicker) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = ExpectStartupWithRoundRobin(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto* address1_attribute = MakeOverrideHostAttribute(kAddresses[1]);
+  ExpectOverridePicks(picker.get(), address1_attribute, kAddresses[1]);
+  // Subchannel for address 1 becomes disconnected.
+  auto subchannel = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel, nullptr);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  ExpectReresolutionRequest();
+  auto old_picker = std::move(picker);
+  picker =
+      WaitForRoundRobinListChange(kAddresses, {kAddresses[0], kAddresses[2]});
+  // The picker from before the disconnection does not pick address 1
+  // either.
+  ExpectPickQueued(old_picker.get(), {address1_attribute});
+  // The subchannel reconnects.
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = WaitForRoundRobinListChange({kAddresses[0], kAddresses[2]},
+                                       kAddresses);
+  // Both the old and the new picker pick address 1 again.
+  ExpectOverridePicks(old_picker.get(), address1_attribute, kAddresses[1]);
+  ExpectOverridePicks(picker.get(), address1_attribute, kAddresses[1]);
+}
+
 TEST_F(XdsOverrideHostTest, DrainingState) {
   const std::array<absl::string_view, 3> kAddresses = {
       "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
@@ -15,6 +15,10 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/promise/party.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -62,6 +66,39 @@ void BM_WakeupParticipant(benchmark::State& state) {
 }
 BENCHMARK(BM_WakeupParticipant);
 
+// Spawns state.range(0) participants that stay pending until all of them have
+// been spawned, so that those beyond the participant limit have to wait for a
+// slot, then releases them all.
+void BM_SpawnPendingParticipants(benchmark::State& state) {
+  const int num_participants = state.range(0);
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  for (auto _ : state) {
+    auto arena = SimpleArenaAllocator()->MakeArena();
+    arena->SetContext(event_engine.get());
+    auto party = Party::Make(std::move(arena));
+    bool release = false;
+    std::vector<Waker> wakers;
+    int done = 0;
+    for (int i = 0; i < num_participants; i++) {
+      party->Spawn(
+          "participant",
+          [&release, &wakers]() -> Poll<StatusFlag> {
+            if (release) return Success{};
+            wakers.push_back(GetContext<Activity>()->MakeOwningWaker());
+            return Pending{};
+          },
+          [&done](StatusFlag) { ++done; });
+    }
+    release = true;
+    // Waking a participant runs the party inline, which completes the woken
+    // participants and starts any that were waiting for a slot.
+    for (auto& waker : std::exchange(wakers, {})) waker.Wakeup();
+    CHECK_EQ(done, num_participants);
+  }
+  state.SetItemsProcessed(state.iterations() * num_participants);
+}
+BENCHMARK(BM_SpawnPendingParticipants)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -16,6 +16,7 @@
 
 #include <grpc/support/log.h>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -75,6 +76,20 @@ struct Payload {
 };
 Payload MakePayload(int value) { return Payload{std::make_unique<int>(value)}; }
 
+// A payload that is charged by its size.
+struct SizedPayload {
+  uint64_t size;
+};
+
+}  // namespace
+
+template <>
+struct MpscTokens<SizedPayload> {
+  static uint64_t Of(const SizedPayload& payload) { return payload.size; }
+};
+
+namespace {
+
 TEST(MpscTest, NoOp) { MpscReceiver<Payload> receiver(1); }
 
 TEST(MpscTest, MakeSender) {
@@ -204,6 +219,113 @@ TEST(MpscTest, CloseFailsNext) {
   activity.Deactivate();
 }
 
+TEST(MpscTest, NextBatchReceivesEverythingQueued) {
+  StrictMock<MockActivity> activity;
+  MpscReceiver<Payload> receiver(10);
+  MpscSender<Payload> sender = receiver.MakeSender();
+  activity.Activate();
+  for (int i = 0; i < 4; i++) {
+    EXPECT_THAT(sender.Send(MakePayload(i))(), IsReady(true));
+  }
+  auto batch = receiver.NextBatch()();
+  ASSERT_TRUE(batch.ready());
+  ASSERT_TRUE(batch.value().ok());
+  EXPECT_THAT(*batch.value(),
+              ::testing::ElementsAre(MakePayload(0), MakePayload(1),
+                                     MakePayload(2), MakePayload(3)));
+  auto next = receiver.NextBatch();
+  EXPECT_THAT(next(), IsPending());
+  EXPECT_CALL(activity, WakeupRequested());
+  EXPECT_THAT(sender.Send(MakePayload(4))(), IsReady(true));
+  Mock::VerifyAndClearExpectations(&activity);
+  auto batch2 = next();
+  ASSERT_TRUE(batch2.ready());
+  EXPECT_THAT(*batch2.value(), ::testing::ElementsAre(MakePayload(4)));
+  activity.Deactivate();
+}
+
+TEST(MpscTest, NextBatchTakesWhatNextLeftBuffered) {
+  MpscReceiver<Payload> receiver(10);
+  MpscSender<Payload> sender = receiver.MakeSender();
+  for (int i = 0; i < 3; i++) {
+    EXPECT_THAT(sender.Send(MakePayload(i))(), IsReady(true));
+  }
+  EXPECT_THAT(receiver.Next()(), IsReady(MakePayload(0)));
+  auto batch = receiver.NextBatch()();
+  ASSERT_TRUE(batch.ready());
+  EXPECT_THAT(*batch.value(),
+              ::testing::ElementsAre(MakePayload(1), MakePayload(2)));
+}
+
+TEST(MpscTest, BufferIsLimitedByTokens) {
+  StrictMock<MockActivity> activity;
+  // Twice the center's limit of 1000 tokens.
+  MpscReceiver<SizedPayload> receiver(2000);
+  MpscSender<SizedPayload> sender = receiver.MakeSender();
+  activity.Activate();
+  EXPECT_THAT(sender.Send(SizedPayload{600})(), IsReady(true));
+  EXPECT_THAT(sender.Send(SizedPayload{400})(), IsReady(true));
+  auto send = sender.Send(SizedPayload{1});
+  EXPECT_THAT(send(), IsPending());
+  EXPECT_CALL(activity, WakeupRequested());
+  auto batch = receiver.NextBatch()();
+  ASSERT_TRUE(batch.ready());
+  EXPECT_EQ(batch.value()->size(), 3);
+  EXPECT_THAT(send(), IsReady(true));
+  // An item bigger than the whole buffer still goes into an empty one.
+  EXPECT_THAT(sender.Send(SizedPayload{5000})(), IsReady(true));
+  activity.Deactivate();
+}
+
+TEST(MpscTest, CloseFailsWaitingSenders) {
+  StrictMock<MockActivity> activity;
+  MpscReceiver<Payload> receiver(1);
+  MpscSender<Payload> sender = receiver.MakeSender();
+  activity.Activate();
+  auto send = sender.SendAcked(MakePayload(1));
+  EXPECT_THAT(send(), IsPending());
+  EXPECT_CALL(activity, WakeupRequested());
+  receiver.MarkClosed();
+  EXPECT_THAT(send(), IsReady(false));
+  EXPECT_FALSE(sender.UnbufferedImmediateSend(MakePayload(2)));
+  activity.Deactivate();
+}
+
+TEST(MpscTest, ReusedItemsCarryTheirOwnValues) {
+  StrictMock<MockActivity> activity;
+  activity.Activate();
+  MpscReceiver<Payload> receiver(4);
+  MpscSender<Payload> sender = receiver.MakeSender();
+  for (int i = 0; i < 100; i += 3) {
+    EXPECT_THAT(sender.Send(MakePayload(i))(), IsReady(true));
+    EXPECT_TRUE(sender.UnbufferedImmediateSend(MakePayload(i + 1)));
+    auto send = sender.SendAcked(MakePayload(i + 2));
+    EXPECT_THAT(send(), IsPending());
+    EXPECT_CALL(activity, WakeupRequested());
+    EXPECT_THAT(receiver.Next()(), IsReady(MakePayload(i)));
+    EXPECT_THAT(receiver.Next()(), IsReady(MakePayload(i + 1)));
+    EXPECT_THAT(receiver.Next()(), IsReady(MakePayload(i + 2)));
+    Mock::VerifyAndClearExpectations(&activity);
+    EXPECT_THAT(send(), IsReady(true));
+  }
+  activity.Deactivate();
+}
+
+TEST(MpscTest, ReceiverIsWokenAfterEveryWait) {
+  StrictMock<MockActivity> activity;
+  activity.Activate();
+  MpscReceiver<Payload> receiver(1);
+  MpscSender<Payload> sender = receiver.MakeSender();
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_THAT(receiver.Next()(), IsPending());
+    EXPECT_CALL(activity, WakeupRequested());
+    EXPECT_THAT(sender.Send(MakePayload(i))(), IsReady(true));
+    Mock::VerifyAndClearExpectations(&activity);
+    EXPECT_THAT(receiver.Next()(), IsReady(MakePayload(i)));
+  }
+  activity.Deactivate();
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -164,9 +164,9 @@ TEST_F(PartyTest, Test16SpawnedPendingPromises) {
   // 2. A Party is able to spawn the Nth Promise even if (N-1) are Pending for
   //    N<=16.
   // 3. on_done callback is never called for a Promise that is not resolved.
-  // Note : If we try to spawn more than 16 Pending Promises on one Party, the
-  // code hangs because it is waiting for the Promises to resolve (Promises in
-  // this test will never resolve).
+  // Note : If we spawn more than 16 Pending Promises on one Party, the extra
+  // Promises wait for a slot, and would never run here since the Promises in
+  // this test never resolve (see SpawnBeyond16PendingPromises).
   const int kNumPromises = 16;
   std::string execution_order;
   auto party = MakeParty();
@@ -183,6 +183,86 @@ TEST_F(PartyTest, Test16SpawnedPendingPromises) {
   VLOG(2) << "Execution order : " << execution_order;
 }
 
+TEST_F(PartyTest, SpawnBeyond16PendingPromises) {
+  // Promises spawned while all 16 slots hold Pending Promises wait for a slot,
+  // and run as soon as the earlier Promises resolve.
+  const int kNumPending = 16;
+  const int kNumExtra = 8;
+  auto party = MakeParty();
+  std::atomic<bool> release{false};
+  Mutex mu;
+  std::vector<Waker> wakers;
+  std::atomic<int> extra_done{0};
+  Notification all_done;
+  for (int i = 0; i < kNumPending; ++i) {
+    party->Spawn(
+        absl::StrCat("pending", i),
+        [&]() -> Poll<Empty> {
+          if (release.load()) return Empty{};
+          MutexLock lock(&mu);
+          wakers.push_back(GetContext<Activity>()->MakeOwningWaker());
+          return Pending{};
+        },
+        [](Empty) {});
+  }
+  for (int i = 0; i < kNumExtra; ++i) {
+    party->Spawn(
+        absl::StrCat("extra", i), []() { return Empty{}; },
+        [&](Empty) {
+          if (extra_done.fetch_add(1) + 1 == kNumExtra) all_done.Notify();
+        });
+  }
+  EXPECT_EQ(extra_done.load(), 0);
+  release.store(true);
+  std::vector<Waker> to_wake;
+  {
+    MutexLock lock(&mu);
+    to_wake.swap(wakers);
+  }
+  EXPECT_EQ(to_wake.size(), kNumPending);
+  for (Waker& waker : to_wake) waker.Wakeup();
+  all_done.WaitForNotification();
+  EXPECT_EQ(extra_done.load(), kNumExtra);
+}
+
+TEST_F(PartyTest, WakeupBatchRunsPartiesInOneClosure) {
+  // Parties woken asynchronously under a WakeupBatch do not run until the batch
+  // goes out of scope, and then all run from the same closure.
+  const int kNumParties = 4;
+  std::vector<RefCountedPtr<Party>> parties;
+  std::vector<Waker> wakers(kNumParties);
+  std::atomic<bool> woken{false};
+  Mutex mu;
+  std::vector<std::thread::id> run_on;
+  Notification all_done;
+  for (int i = 0; i < kNumParties; ++i) {
+    parties.push_back(MakeParty());
+    parties.back()->Spawn(
+        absl::StrCat("party", i),
+        [&, i]() -> Poll<Empty> {
+          if (!woken.load()) {
+            wakers[i] = GetContext<Activity>()->MakeOwningWaker();
+            return Pending{};
+          }
+          MutexLock lock(&mu);
+          run_on.push_back(std::this_thread::get_id());
+          if (run_on.size() == kNumParties) all_done.Notify();
+          return Empty{};
+        },
+        [](Empty) {});
+  }
+  woken.store(true);
+  {
+    Party::WakeupBatch batch;
+    for (Waker& waker : wakers) waker.WakeupAsync();
+    MutexLock lock(&mu);
+    EXPECT_TRUE(run_on.empty());
+  }
+  all_done.WaitForNotification();
+  MutexLock lock(&mu);
+  for (const std::thread::id& id : run_on) EXPECT_EQ(id, run_on[0]);
+}
+
 TEST_F(PartyTest, SpawnWaitableAndRunTwoParties) {
   // Test to run two Promises on two parties named party1 and party2.
   // The Promise spawned on party1 will in turn spawn a Promise on party2.
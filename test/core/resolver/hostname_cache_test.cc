@@ -0,0 +1,282 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/resolver/dns/event_engine/hostname_cache.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/util/time.h"
+#include "test/core/event_engine/mock_event_engine.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::MockEventEngine;
+using ::grpc_event_engine::experimental::ResolvedAddressToURI;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+using ::testing::_;
+using ::testing::NiceMock;
+
+constexpr Duration kTtl = Duration::Seconds(10);
+constexpr Duration kMaxStale = Duration::Seconds(5);
+constexpr Duration kQueryTimeout = Duration::Seconds(20);
+
+// Holds hostname queries until the test completes them.
+class FakeDNSResolver final : public EventEngine::DNSResolver {
+ public:
+  explicit FakeDNSResolver(std::vector<LookupHostnameCallback>* queries)
+      : queries_(queries) {}
+
+  void LookupHostname(LookupHostnameCallback on_resolve,
+                      absl::string_view /*name*/,
+                      absl::string_view /*default_port*/) override {
+    queries_->push_back(std::move(on_resolve));
+  }
+
+  void LookupSRV(LookupSRVCallback /*on_resolve*/,
+                 absl::string_view /*name*/) override {
+    LOG(FATAL) << "unimplemented";
+  }
+
+  void LookupTXT(LookupTXTCallback /*on_resolve*/,
+                 absl::string_view /*name*/) override {
+    LOG(FATAL) << "unimplemented";
+  }
+
+ private:
+  std::vector<LookupHostnameCallback>* queries_;
+};
+
+class HostnameCacheTest : public ::testing::Test {
+ protected:
+  HostnameCacheTest() {
+    time_cache_.TestOnlySetNow(Timestamp::Now());
+    ON_CALL(*event_engine_, Run(::testing::An<absl::AnyInvocable<void()>>()))
+        .WillByDefault([this](absl::AnyInvocable<void()> closure) {
+          closures_.push_back(std::move(closure));
+        });
+    ON_CALL(*event_engine_, GetDNSResolver(_))
+        .WillByDefault([this](const EventEngine::DNSResolver::
+                                  ResolverOptions& /*options*/) {
+          return std::make_unique<FakeDNSResolver>(&queries_);
+        });
+    ON_CALL(*event_engine_,
+            RunAfter(_, ::testing::An<absl::AnyInvocable<void()>>()))
+        .WillByDefault([this](EventEngine::Duration when,
+                              absl::AnyInvocable<void()> closure) {
+          EXPECT_EQ(when, EventEngine::Duration(kQueryTimeout));
+          const intptr_t id = next_timer_id_++;
+          timers_.emplace(id, std::move(closure));
+          return EventEngine::TaskHandle{id, 0};
+        });
+    ON_CALL(*event_engine_, Cancel(_))
+        .WillByDefault([this](EventEngine::TaskHandle handle) {
+          return timers_.erase(handle.keys[0]) == 1;
+        });
+  }
+
+  // Starts a lookup of name, and returns where its result will be stored:
+  // either the address or the status of the failure.
+  std::shared_ptr<std::optional<std::string>> Lookup(absl::string_view name) {
+    auto result = std::make_shared<std::optional<std::string>>();
+    cache_.LookupHostname(
+        event_engine_, "", name, "443", {kTtl, kMaxStale, kQueryTimeout},
+        [result](absl::StatusOr<HostnameCache::ResolvedAddresses> addresses) {
+          if (!addresses.ok()) {
+            *result = addresses.status().ToString();
+          } else if (addresses->size() != 1) {
+            *result = "expected one address";
+          } else {
+            *result = ResolvedAddressToURI((*addresses)[0]).value();
+          }
+        });
+    RunClosures();
+    return result;
+  }
+
+  // Completes the oldest query in flight.
+  void CompleteQuery(absl::StatusOr<std::string> address) {
+    ASSERT_FALSE(queries_.empty());
+    auto on_resolve = std::move(queries_.front());
+    queries_.erase(queries_.begin());
+    if (!address.ok()) {
+      on_resolve(address.status());
+    } else {
+      on_resolve(HostnameCache::ResolvedAddresses{
+          URIToResolvedAddress(*address).value()});
+    }
+    RunClosures();
+  }
+
+  void RunClosures() {
+    while (!closures_.empty()) {
+      auto closure = std::move(closures_.front());
+      closures_.erase(closures_.begin());
+      closure();
+    }
+  }
+
+  // Runs the query timers that have not been cancelled.
+  void FireTimers() {
+    auto timers = std::move(timers_);
+    timers_.clear();
+    for (auto& [id, closure] : timers) closure();
+    RunClosures();
+  }
+
+  void AdvanceTime(Duration duration) {
+    time_cache_.TestOnlySetNow(Timestamp::Now() + duration);
+  }
+
+  ScopedTimeCache time_cache_;
+  std::shared_ptr<NiceMock<MockEventEngine>> event_engine_ =
+      std::make_shared<NiceMock<MockEventEngine>>();
+  std::vector<absl::AnyInvocable<void()>> closures_;
+  std::vector<EventEngine::DNSResolver::LookupHostnameCallback> queries_;
+  std::map<intptr_t, absl::AnyInvocable<void()>> timers_;
+  intptr_t next_timer_id_ = 1;
+  HostnameCache cache_;
+};
+
+TEST_F(HostnameCacheTest, CoalescesConcurrentLookups) {
+  auto first = Lookup("foo.example.com");
+  auto second = Lookup("foo.example.com");
+  EXPECT_EQ(queries_.size(), 1u);
+  EXPECT_FALSE(first->has_value());
+  CompleteQuery("ipv4:10.0.0.1:443");
+  EXPECT_EQ(*first, "ipv4:10.0.0.1:443");
+  EXPECT_EQ(*second, "ipv4:10.0.0.1:443");
+}
+
+TEST_F(HostnameCacheTest, DifferentNamesAreQueriedSeparately) {
+  Lookup("foo.example.com");
+  Lookup("bar.example.com");
+  EXPECT_EQ(queries_.size(), 2u);
+}
+
+TEST_F(HostnameCacheTest, FreshResultIsReused) {
+  Lookup("foo.example.com");
+  CompleteQuery("ipv4:10.0.0.1:443");
+  AdvanceTime(kTtl - Duration::Seconds(1));
+  auto result = Lookup("foo.example.com");
+  EXPECT_TRUE(queries_.empty());
+  EXPECT_EQ(*result, "ipv4:10.0.0.1:443");
+}
+
+TEST_F(HostnameCacheTest, StaleResultIsServedWhileRefreshing) {
+  Lookup("foo.example.com");
+  CompleteQuery("ipv4:10.0.0.1:443");
+  AdvanceTime(kTtl + Duration::Seconds(1));
+  auto stale = Lookup("foo.example.com");
+  EXPECT_EQ(*stale, "ipv4:10.0.0.1:443");
+  // Only one refresh is started, however many stale lookups there are.
+  Lookup("foo.example.com");
+  EXPECT_EQ(queries_.size(), 1u);
+  CompleteQuery("ipv4:10.0.0.2:443");
+  auto refreshed = Lookup("foo.example.com");
+  EXPECT_TRUE(queries_.empty());
+  EXPECT_EQ(*refreshed, "ipv4:10.0.0.2:443");
+}
+
+TEST_F(HostnameCacheTest, ResultTooStaleIsNotServed) {
+  Lookup("foo.example.com");
+  CompleteQuery("ipv4:10.0.0.1:443");
+  AdvanceTime(kTtl + kMaxStale + Duration::Seconds(1));
+  auto result = Lookup("foo.example.com");
+  EXPECT_FALSE(result->has_value());
+  CompleteQuery("ipv4:10.0.0.2:443");
+  EXPECT_EQ(*result, "ipv4:10.0.0.2:443");
+}
+
+TEST_F(HostnameCacheTest, FailuresAreNotCached) {
+  auto failed = Lookup("foo.example.com");
+  CompleteQuery(absl::UnavailableError("no DNS"));
+  EXPECT_EQ(*failed, "UNAVAILABLE: no DNS");
+  auto retried = Lookup("foo.example.com");
+  EXPECT_EQ(queries_.size(), 1u);
+  CompleteQuery("ipv4:10.0.0.1:443");
+  EXPECT_EQ(*retried, "ipv4:10.0.0.1:443");
+}
+
+TEST_F(HostnameCacheTest, FailedRefreshKeepsStaleResult) {
+  Lookup("foo.example.com");
+  CompleteQuery("ipv4:10.0.0.1:443");
+  AdvanceTime(kTtl + Duration::Seconds(1));
+  Lookup("foo.example.com");
+  CompleteQuery(absl::UnavailableError("no DNS"));
+  auto result = Lookup("foo.example.com");
+  EXPECT_EQ(*result, "ipv4:10.0.0.1:443");
+}
+
+TEST_F(HostnameCacheTest, ExpiredEntriesAreSwept) {
+  Lookup("foo.example.com");
+  CompleteQuery("ipv4:10.0.0.1:443");
+  EXPECT_EQ(cache_.TestOnlySize(), 1u);
+  AdvanceTime(Duration::Minutes(2));
+  Lookup("bar.example.com");
+  // Only the entry just added remains.
+  EXPECT_EQ(cache_.TestOnlySize(), 1u);
+}
+
+TEST_F(HostnameCacheTest, CompletedQueryCancelsItsTimer) {
+  Lookup("foo.example.com");
+  EXPECT_EQ(timers_.size(), 1u);
+  CompleteQuery("ipv4:10.0.0.1:443");
+  EXPECT_TRUE(timers_.empty());
+}
+
+TEST_F(HostnameCacheTest, TimedOutQueryFailsAllWaiters) {
+  auto first = Lookup("foo.example.com");
+  auto second = Lookup("foo.example.com");
+  FireTimers();
+  EXPECT_EQ(*first, "DEADLINE_EXCEEDED: hostname lookup timed out");
+  EXPECT_EQ(*second, "DEADLINE_EXCEEDED: hostname lookup timed out");
+  // The key is no longer wedged: the next lookup starts a new query.
+  auto retried = Lookup("foo.example.com");
+  ASSERT_EQ(queries_.size(), 2u);
+  // The abandoned query completing late does not complete the new one.
+  CompleteQuery("ipv4:10.0.0.1:443");
+  EXPECT_FALSE(retried->has_value());
+  CompleteQuery("ipv4:10.0.0.2:443");
+  EXPECT_EQ(*retried, "ipv4:10.0.0.2:443");
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/resolver/resolver_registry.h"
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/resolver/resolver_factory.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/uri.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Accepts any URI with a non-empty path.
+class TestResolverFactory final : public ResolverFactory {
+ public:
+  explicit TestResolverFactory(absl::string_view scheme) : scheme_(scheme) {}
+
+  absl::string_view scheme() const override { return scheme_; }
+  bool IsValidUri(const URI& uri) const override {
+    return !uri.path().empty();
+  }
+  OrphanablePtr<Resolver> CreateResolver(
+      ResolverArgs /*args*/) const override {
+    return nullptr;
+  }
+
+ private:
+  const std::string scheme_;
+};
+
+ResolverRegistry BuildRegistry() {
+  ResolverRegistry::Builder builder;
+  builder.SetDefaultPrefix("test:///");
+  builder.RegisterResolverFactory(
+      std::make_unique<TestResolverFactory>("test"));
+  builder.RegisterResolverFactory(
+      std::make_unique<TestResolverFactory>("other"));
+  return builder.Build();
+}
+
+TEST(ResolverRegistryTest, LookupsOfATargetAreCached) {
+  ResolverRegistry registry = BuildRegistry();
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 0);
+  EXPECT_TRUE(registry.IsValidTarget("other:///foo.example.com:443"));
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 1);
+  // Later lookups of the same target hit the cache, and see what the first
+  // one found.
+  EXPECT_TRUE(registry.IsValidTarget("other:///foo.example.com:443"));
+  EXPECT_EQ(registry.GetDefaultAuthority("other:///foo.example.com:443"),
+            "foo.example.com:443");
+  EXPECT_EQ(registry.AddDefaultPrefixIfNeeded("other:///foo.example.com:443"),
+            "other:///foo.example.com:443");
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 1);
+  EXPECT_TRUE(registry.IsValidTarget("other:///bar.example.com:443"));
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 2);
+}
+
+TEST(ResolverRegistryTest, CacheHitKeepsTheDefaultPrefix) {
+  ResolverRegistry registry = BuildRegistry();
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(registry.AddDefaultPrefixIfNeeded("foo.example.com:443"),
+              "test:///foo.example.com:443");
+    EXPECT_EQ(registry.GetDefaultAuthority("foo.example.com:443"),
+              "foo.example.com:443");
+    EXPECT_TRUE(registry.IsValidTarget("foo.example.com:443"));
+  }
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 1);
+}
+
+TEST(ResolverRegistryTest, FailedLookupsAreNotCached) {
+  ResolverRegistry::Builder builder;
+  // No default prefix, so targets without a known scheme find no factory.
+  builder.SetDefaultPrefix("");
+  builder.RegisterResolverFactory(
+      std::make_unique<TestResolverFactory>("test"));
+  ResolverRegistry registry = builder.Build();
+  EXPECT_FALSE(registry.IsValidTarget("unknown:///foo.example.com:443"));
+  EXPECT_FALSE(registry.IsValidTarget("unknown:///foo.example.com:443"));
+  EXPECT_EQ(registry.AddDefaultPrefixIfNeeded("unknown:///foo.example.com"),
+            "unknown:///foo.example.com");
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 0);
+}
+
+TEST(ResolverRegistryTest, InvalidUriIsStillRejectedOnCacheHit) {
+  ResolverRegistry registry = BuildRegistry();
+  // The factory is found, but rejects the URI.  The lookup is cached, and
+  // the factory still gets to check the URI every time.
+  EXPECT_FALSE(registry.IsValidTarget("other:"));
+  EXPECT_FALSE(registry.IsValidTarget("other:"));
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 1);
+}
+
+TEST(ResolverRegistryTest, FullCacheIsEmptied) {
+  ResolverRegistry registry = BuildRegistry();
+  constexpr size_t kTargets = 1024;
+  for (size_t i = 0; i < kTargets; ++i) {
+    EXPECT_TRUE(registry.IsValidTarget(absl::StrCat("test:///host", i)));
+  }
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), kTargets);
+  EXPECT_TRUE(registry.IsValidTarget("test:///one.more.host"));
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 1);
+  // Lookups keep working after the cache was emptied.
+  EXPECT_EQ(registry.AddDefaultPrefixIfNeeded("host0"), "test:///host0");
+  EXPECT_EQ(registry.TestOnlyLookupCacheSize(), 2);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -35,6 +35,7 @@
 #include "gtest/gtest.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/thd.h"
 #include "test/core/test_util/test_config.h"
@@ -140,6 +141,52 @@ typedef struct {
 
 TEST(ArenaTest, NoOp) { SimpleArenaAllocator()->MakeArena(); }
 
+// The block cache tests use a single shard, so that every block freed is
+// seen by the next Alloc() whichever cpu the test runs on.
+TEST(ArenaBlockCacheTest, ReusesFreedBlocksOfTheSameSizeClass) {
+  arena_detail::ArenaBlockCache cache(PerCpuOptions().SetMaxShards(1));
+  void* block = cache.Alloc(1000);
+  cache.Free(block, 1000);
+  // 1000 and 1024 bytes are both served from 1KB blocks.
+  EXPECT_EQ(cache.Alloc(1024), block);
+  cache.Free(block, 1024);
+  // A larger size class does not get the block.
+  void* larger = cache.Alloc(2048);
+  EXPECT_NE(larger, block);
+  cache.Free(larger, 2048);
+}
+
+TEST(ArenaBlockCacheTest, KeepsALimitedNumberOfBlocksPerSizeClass) {
+  using arena_detail::ArenaBlockCache;
+  ArenaBlockCache cache(PerCpuOptions().SetMaxShards(1));
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < ArenaBlockCache::kMaxBlocksPerClass + 1; ++i) {
+    blocks.push_back(cache.Alloc(256));
+  }
+  for (void* block : blocks) cache.Free(block, 256);
+  // Only the first kMaxBlocksPerClass blocks freed are kept, and they are
+  // reused most recently freed first.
+  for (size_t i = ArenaBlockCache::kMaxBlocksPerClass; i > 0; --i) {
+    EXPECT_EQ(cache.Alloc(256), blocks[i - 1]);
+  }
+  for (size_t i = 0; i < ArenaBlockCache::kMaxBlocksPerClass; ++i) {
+    cache.Free(blocks[i], 256);
+  }
+}
+
+TEST(ArenaBlockCacheTest, LargeBlocksAreNotCached) {
+  using arena_detail::ArenaBlockCache;
+  ArenaBlockCache cache(PerCpuOptions().SetMaxShards(1));
+  void* small = cache.Alloc(256);
+  cache.Free(small, 256);
+  void* large = cache.Alloc(ArenaBlockCache::kMaxBlockSize + 1);
+  EXPECT_NE(large, small);
+  cache.Free(large, ArenaBlockCache::kMaxBlockSize + 1);
+  // The cached small block is still there.
+  EXPECT_EQ(cache.Alloc(256), small);
+  cache.Free(small, 256);
+}
+
 TEST(ArenaTest, ManagedNew) {
   ExecCtx exec_ctx;
   auto arena = SimpleArenaAllocator(1)->MakeArena();
@@ -0,0 +1,95 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/connection_quota.h"
+
+#include <atomic>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class FakeCpuUtilizationSource : public CpuUtilizationSource {
+ public:
+  double CpuUtilization() override {
+    return utilization_.load(std::memory_order_relaxed);
+  }
+
+  void Set(double utilization) {
+    utilization_.store(utilization, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<double> utilization_{-1};
+};
+
+TEST(ConnectionQuotaTest, MaxIncomingConnections) {
+  auto memory_quota = MakeMemoryQuota("connection_quota_test");
+  auto quota = MakeRefCounted<ConnectionQuota>();
+  quota->SetMaxIncomingConnections(2);
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_FALSE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_EQ(quota->TestOnlyActiveIncomingConnections(), 2);
+  quota->ReleaseConnections(1);
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  quota->ReleaseConnections(2);
+}
+
+TEST(ConnectionQuotaTest, ConnectionsAreRefusedWhileCpuIsOverloaded) {
+  auto memory_quota = MakeMemoryQuota("connection_quota_test");
+  auto source = MakeRefCounted<FakeCpuUtilizationSource>();
+  auto quota = MakeRefCounted<ConnectionQuota>();
+  quota->SetMaxCpuUtilization(source, 0.8);
+  // Nothing recorded yet.
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  source->Set(0.5);
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  source->Set(0.8);
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  source->Set(0.9);
+  EXPECT_FALSE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  source->Set(0.5);
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+}
+
+TEST(ConnectionQuotaTest, RefusedConnectionsDoNotUseTheMaxConnections) {
+  auto memory_quota = MakeMemoryQuota("connection_quota_test");
+  auto source = MakeRefCounted<FakeCpuUtilizationSource>();
+  auto quota = MakeRefCounted<ConnectionQuota>();
+  quota->SetMaxIncomingConnections(1);
+  quota->SetMaxCpuUtilization(source, 0.8);
+  source->Set(0.9);
+  EXPECT_FALSE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_EQ(quota->TestOnlyActiveIncomingConnections(), 0);
+  source->Set(0.5);
+  EXPECT_TRUE(quota->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_EQ(quota->TestOnlyActiveIncomingConnections(), 1);
+  quota->ReleaseConnections(1);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
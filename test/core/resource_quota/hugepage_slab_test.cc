@@ -0,0 +1,120 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/hugepage_slab.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+
+using Slabs = HugePageSlabAllocator;
+
+TEST(HugePageSlabTest, ChunkPayloadSize) {
+  EXPECT_EQ(Slabs::ChunkPayloadSize(Slabs::kMinChunkPayload - 1), 0);
+  EXPECT_EQ(Slabs::ChunkPayloadSize(Slabs::kMinChunkPayload),
+            Slabs::kMinChunkPayload);
+  EXPECT_EQ(Slabs::ChunkPayloadSize(Slabs::kMinChunkPayload + 1),
+            2 * Slabs::kMinChunkPayload);
+  EXPECT_EQ(Slabs::ChunkPayloadSize(100000), 128 * 1024);
+  EXPECT_EQ(Slabs::ChunkPayloadSize(Slabs::kMaxChunkPayload),
+            Slabs::kMaxChunkPayload);
+  EXPECT_EQ(Slabs::ChunkPayloadSize(Slabs::kMaxChunkPayload + 1), 0);
+  EXPECT_EQ(Slabs::Get().Alloc(Slabs::kMaxChunkPayload + 1), nullptr);
+}
+
+TEST(HugePageSlabTest, ChunksAreAlignedAndWritable) {
+  auto& slabs = Slabs::Get();
+  for (size_t size = Slabs::kMinChunkPayload; size <= Slabs::kMaxChunkPayload;
+       size *= 2) {
+    char* chunk = static_cast<char*>(slabs.Alloc(size));
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(chunk) % 64, 0);
+    memset(chunk, 0xab, Slabs::kChunkHeaderSize + size);
+    slabs.Free(chunk);
+  }
+}
+
+TEST(HugePageSlabTest, FreedChunksAreReused) {
+  auto& slabs = Slabs::Get();
+  std::vector<void*> chunks;
+  std::set<void*> distinct;
+  for (int i = 0; i < 40; ++i) {
+    void* chunk = slabs.Alloc(60 * 1024);
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_TRUE(distinct.insert(chunk).second);
+    chunks.push_back(chunk);
+  }
+  void* freed = chunks.back();
+  chunks.pop_back();
+  slabs.Free(freed);
+  void* chunk = slabs.Alloc(50 * 1024);
+  EXPECT_EQ(chunk, freed);
+  chunks.push_back(chunk);
+  for (void* c : chunks) slabs.Free(c);
+}
+
+TEST(HugePageSlabTest, EmptySlabsAreCachedUntilReleased) {
+  auto& slabs = Slabs::Get();
+  slabs.ReleaseEmptySlabs();
+  EXPECT_EQ(slabs.NumEmptySlabs(), 0);
+  const size_t base_slabs = slabs.NumSlabs();
+  void* chunk = slabs.Alloc(Slabs::kMaxChunkPayload);
+  ASSERT_NE(chunk, nullptr);
+  EXPECT_EQ(slabs.NumSlabs(), base_slabs + 1);
+  slabs.Free(chunk);
+  EXPECT_EQ(slabs.NumSlabs(), base_slabs + 1);
+  EXPECT_EQ(slabs.NumEmptySlabs(), 1);
+  // An empty slab can be reformatted for another size class.
+  chunk = slabs.Alloc(Slabs::kMinChunkPayload);
+  ASSERT_NE(chunk, nullptr);
+  EXPECT_EQ(slabs.NumSlabs(), base_slabs + 1);
+  EXPECT_EQ(slabs.NumEmptySlabs(), 0);
+  slabs.Free(chunk);
+  EXPECT_EQ(slabs.ReleaseEmptySlabs(), Slabs::kSlabSize);
+  EXPECT_EQ(slabs.NumSlabs(), base_slabs);
+  EXPECT_EQ(slabs.NumEmptySlabs(), 0);
+}
+
+TEST(HugePageSlabTest, EmptySlabCacheIsBounded) {
+  auto& slabs = Slabs::Get();
+  slabs.ReleaseEmptySlabs();
+  const size_t base_slabs = slabs.NumSlabs();
+  // Fill more slabs than the cache holds.
+  std::vector<void*> chunks;
+  while (slabs.NumSlabs() < base_slabs + Slabs::kMaxEmptySlabs + 2) {
+    void* chunk = slabs.Alloc(Slabs::kMaxChunkPayload);
+    ASSERT_NE(chunk, nullptr);
+    chunks.push_back(chunk);
+  }
+  for (void* c : chunks) slabs.Free(c);
+  EXPECT_EQ(slabs.NumEmptySlabs(), Slabs::kMaxEmptySlabs);
+  EXPECT_EQ(slabs.NumSlabs(), base_slabs + Slabs::kMaxEmptySlabs);
+  slabs.ReleaseEmptySlabs();
+  EXPECT_EQ(slabs.NumSlabs(), base_slabs);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,6 +16,7 @@
 
 #include <grpc/slice.h>
 #include <grpc/support/log.h>
+#include <string.h>
 
 #include <algorithm>
 #include <atomic>
@@ -139,6 +140,25 @@ TEST(MemoryQuotaTest, MakeSlice) {
   }
 }
 
+TEST(MemoryQuotaTest, MakeLargeSlice) {
+  MemoryQuota memory_quota("foo");
+  auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+  std::vector<grpc_slice> slices;
+  for (size_t min = 8192; min < 512 * 1024; min += 12345) {
+    ExecCtx exec_ctx;
+    size_t max = 2 * min;
+    grpc_slice slice = memory_allocator.MakeSlice(MemoryRequest(min, max));
+    EXPECT_GE(GRPC_SLICE_LENGTH(slice), min);
+    EXPECT_LE(GRPC_SLICE_LENGTH(slice), max);
+    memset(GRPC_SLICE_START_PTR(slice), 0xab, GRPC_SLICE_LENGTH(slice));
+    slices.push_back(slice);
+  }
+  ExecCtx exec_ctx;
+  for (grpc_slice slice : slices) {
+    grpc_slice_unref(slice);
+  }
+}
+
 TEST(MemoryQuotaTest, ContainerAllocator) {
   ExecCtx exec_ctx;
   MemoryQuota memory_quota("foo");
@@ -203,6 +223,32 @@ TEST(MemoryQuotaTest, ContainerMemoryAccountedFor) {
   SetContainerMemoryPressure(0.0);
 }
 
+TEST(MemoryQuotaTest, PressureAccurateAfterConcurrentReturns) {
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(64 * 1024 * 1024);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&memory_quota, i]() {
+      std::mt19937 rng(i);
+      for (int j = 0; j < 100; j++) {
+        ExecCtx exec_ctx;
+        auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+        std::vector<size_t> reserved;
+        for (int k = 0; k < 20; k++) {
+          reserved.push_back(memory_allocator.Reserve(
+              MemoryRequest(std::uniform_int_distribution<size_t>(
+                  1, 256 * 1024)(rng))));
+        }
+        for (size_t n : reserved) memory_allocator.Release(n);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  // Free bytes parked per cpu may hide up to 1/64th of the quota.
+  auto owner = memory_quota.CreateMemoryOwner();
+  EXPECT_LE(owner.GetPressureInfo().instantaneous_pressure, 1.0 / 64 + 0.01);
+}
+
 }  // namespace testing
 
 namespace memory_quota_detail {
@@ -0,0 +1,140 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/method_quota.h"
+
+#include <vector>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+
+using Priority = MethodQuotas::Priority;
+
+constexpr size_t kEstimate = MethodQuotas::kInitialCallEstimate;
+
+TEST(MethodQuotaTest, MethodsWithoutBudgetAreAdmitted) {
+  MethodQuotas quotas;
+  EXPECT_FALSE(quotas.has_budgets());
+  EXPECT_TRUE(quotas.Admit("/foo.Bar/Baz", 1.0).ok());
+  quotas.SetBudget("/foo.Bar/Baz", {0, Priority::kLow});
+  EXPECT_TRUE(quotas.has_budgets());
+  auto admission = quotas.Admit("/foo.Bar/Other", 1.0);
+  ASSERT_TRUE(admission.ok());
+  EXPECT_EQ(admission->charge(), 0);
+}
+
+TEST(MethodQuotaTest, BudgetIsEnforcedAndReleased) {
+  MethodQuotas quotas;
+  // Room for four calls before early detection kicks in.
+  quotas.SetBudget("/foo.Bar/Baz", {kEstimate * 16, Priority::kHigh});
+  std::vector<MethodQuotas::Admission> admissions;
+  for (int i = 0; i < 4; i++) {
+    auto admission = quotas.Admit("/foo.Bar/Baz", 0.0);
+    ASSERT_TRUE(admission.ok()) << admission.status();
+    admissions.push_back(std::move(*admission));
+  }
+  EXPECT_EQ(quotas.TestOnlyInFlightBytes("/foo.Bar/Baz"), 4 * kEstimate);
+  // Keep going until the budget is used up: even the luckiest run of early
+  // detection has to stop there.
+  int rejected = 0;
+  while (admissions.size() < 64) {
+    auto admission = quotas.Admit("/foo.Bar/Baz", 0.0);
+    if (!admission.ok()) {
+      EXPECT_EQ(admission.status().code(), absl::StatusCode::kResourceExhausted);
+      ++rejected;
+      if (admissions.size() == 15) break;
+      continue;
+    }
+    admissions.push_back(std::move(*admission));
+  }
+  EXPECT_GT(rejected, 0);
+  EXPECT_LE(admissions.size(), 15);
+  EXPECT_FALSE(quotas.Admit("/foo.Bar/Baz", 0.0).ok());
+  // Rejected calls leave nothing charged.
+  EXPECT_EQ(quotas.TestOnlyInFlightBytes("/foo.Bar/Baz"),
+            admissions.size() * kEstimate);
+  admissions.clear();
+  EXPECT_EQ(quotas.TestOnlyInFlightBytes("/foo.Bar/Baz"), 0);
+  EXPECT_TRUE(quotas.Admit("/foo.Bar/Baz", 0.0).ok());
+}
+
+TEST(MethodQuotaTest, ServiceBudgetCoversItsMethods) {
+  MethodQuotas quotas;
+  quotas.SetBudget("/foo.Bar/", {kEstimate, Priority::kHigh});
+  quotas.SetBudget("/foo.Bar/Own", {kEstimate * 100, Priority::kHigh});
+  // "/foo.Bar/Baz" and "/foo.Bar/Qux" share the service budget, which only
+  // ever has room for one of them...
+  auto baz = quotas.Admit("/foo.Bar/Baz", 0.0);
+  EXPECT_FALSE(baz.ok());
+  // ... while "/foo.Bar/Own" has its own.
+  EXPECT_TRUE(quotas.Admit("/foo.Bar/Own", 0.0).ok());
+  EXPECT_TRUE(quotas.Admit("/foo.Other/Baz", 0.0).ok());
+}
+
+TEST(MethodQuotaTest, ReportedUsageRefinesEstimate) {
+  MethodQuotas quotas;
+  quotas.SetBudget("/foo.Bar/Baz", {kEstimate * 1000, Priority::kHigh});
+  for (int i = 0; i < 100; i++) {
+    auto admission = quotas.Admit("/foo.Bar/Baz", 0.0);
+    ASSERT_TRUE(admission.ok());
+    admission->ReportUsage(kEstimate * 4);
+  }
+  auto admission = quotas.Admit("/foo.Bar/Baz", 0.0);
+  ASSERT_TRUE(admission.ok());
+  EXPECT_GT(admission->charge(), kEstimate * 3);
+  EXPECT_LE(admission->charge(), kEstimate * 4);
+}
+
+TEST(MethodQuotaTest, LowPriorityIsShedFirst) {
+  MethodQuotas quotas;
+  quotas.SetBudget("/foo.Bar/Low", {MethodQuotas::Budget().max_bytes,
+                                    Priority::kLow});
+  quotas.SetBudget("/foo.Bar/Normal", {});
+  quotas.SetBudget("/foo.Bar/High", {MethodQuotas::Budget().max_bytes,
+                                     Priority::kHigh});
+  auto admitted = [&](absl::string_view method, double pressure) {
+    int n = 0;
+    for (int i = 0; i < 1000; i++) {
+      if (quotas.Admit(method, pressure).ok()) ++n;
+    }
+    return n;
+  };
+  // Below any threshold everything gets in.
+  EXPECT_EQ(admitted("/foo.Bar/Low", 0.5), 1000);
+  EXPECT_EQ(admitted("/foo.Bar/Normal", 0.5), 1000);
+  // Low priority calls start being shed first...
+  const int low = admitted("/foo.Bar/Low", 0.85);
+  EXPECT_GT(low, 0);
+  EXPECT_LT(low, 1000);
+  EXPECT_EQ(admitted("/foo.Bar/Normal", 0.85), 1000);
+  // ... and are all shed by the time normal ones start to be.
+  EXPECT_EQ(admitted("/foo.Bar/Low", 0.95), 0);
+  const int normal = admitted("/foo.Bar/Normal", 0.95);
+  EXPECT_GT(normal, 0);
+  EXPECT_LT(normal, 1000);
+  // High priority calls are never shed for memory pressure.
+  EXPECT_EQ(admitted("/foo.Bar/Normal", 1.0), 0);
+  EXPECT_EQ(admitted("/foo.Bar/High", 1.0), 1000);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -28,6 +28,7 @@
 #include "src/core/lib/security/credentials/composite/composite_credentials.h"
 #include "src/core/lib/security/credentials/fake/fake_credentials.h"
 #include "src/core/lib/security/credentials/insecure/insecure_credentials.h"
+#include "src/core/lib/security/credentials/local/local_credentials.h"
 #include "src/core/lib/security/credentials/tls/tls_credentials.h"
 #include "test/core/test_util/test_config.h"
 
@@ -110,6 +111,10 @@ TEST_F(ChannelCredsRegistryTest, InsecureCreds) {
   TestCreds("insecure", InsecureCredentials::Type());
 }
 
+TEST_F(ChannelCredsRegistryTest, LocalCreds) {
+  TestCreds("local", grpc_local_credentials::Type());
+}
+
 TEST_F(ChannelCredsRegistryTest, FakeCreds) {
   TestCreds("fake", grpc_fake_channel_credentials::Type());
 }
@@ -1464,6 +1464,37 @@ TEST_F(CredentialsTest, TestJwtCredsSuccess) {
   grpc_jwt_encode_and_sign_set_override(nullptr);
 }
 
+TEST_F(CredentialsTest, TestJwtCredsCachePerServiceUrl) {
+  char* json_key_string = test_json_key_str();
+  ExecCtx exec_ctx;
+  std::string emd = absl::StrCat("authorization: Bearer ", test_signed_jwt);
+  grpc_call_credentials* creds =
+      grpc_service_account_jwt_access_credentials_create(
+          json_key_string, grpc_max_auth_token_lifetime(), nullptr);
+  // Jwts are signed once for each service url.
+  grpc_jwt_encode_and_sign_set_override(encode_and_sign_jwt_success);
+  auto state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestOtherAuthority,
+                                kTestOtherPath);
+  ExecCtx::Get()->Flush();
+  // Requests to either service url are served from the cache.
+  grpc_jwt_encode_and_sign_set_override(
+      encode_and_sign_jwt_should_not_be_called);
+  state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestOtherAuthority,
+                                kTestOtherPath);
+  ExecCtx::Get()->Flush();
+  creds->Unref();
+  gpr_free(json_key_string);
+  grpc_jwt_encode_and_sign_set_override(nullptr);
+}
+
 TEST_F(CredentialsTest, TestJwtCredsSigningFailure) {
   const char expected_creds_debug_string_prefix[] =
       "JWTAccessCredentials{ExpirationTime:";
@@ -2389,13 +2420,32 @@ int aws_external_account_creds_httpcli_post_success(
 
 class TokenFetcherCredentialsTest : public ::testing::Test {
  protected:
+  static TokenFetcherRefreshOptions NoProactiveRefresh() {
+    TokenFetcherRefreshOptions options;
+    options.enabled = false;
+    return options;
+  }
+
+  // Refreshes half way through each token's lifetime, without jitter.
+  static TokenFetcherRefreshOptions HalfLifetimeRefresh() {
+    TokenFetcherRefreshOptions options;
+    options.enabled = true;
+    options.lifetime_fraction = 0.5;
+    options.jitter = 0;
+    return options;
+  }
+
   class TestTokenFetcherCredentials final : public TokenFetcherCredentials {
    public:
     explicit TestTokenFetcherCredentials(
         std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-            event_engine = nullptr)
+            event_engine = nullptr,
+        TokenFetcherRefreshOptions refresh_options = NoProactiveRefresh(),
+        std::string token_cache_key = "")
         : TokenFetcherCredentials(std::move(event_engine),
-                                  /*test_only_use_backoff_jitter=*/false) {}
+                                  /*test_only_use_backoff_jitter=*/false,
+                                  refresh_options),
+          token_cache_key_(std::move(token_cache_key)) {}
 
     ~TestTokenFetcherCredentials() override { CHECK_EQ(queue_.size(), 0); }
 
@@ -2440,6 +2490,8 @@ class TokenFetcherCredentialsTest : public ::testing::Test {
           event_engine(), std::move(on_done), std::move(result));
     }
 
+    std::string TokenCacheKey() const override { return token_cache_key_; }
+
     std::string debug_string() override {
       return "TestTokenFetcherCredentials";
     }
@@ -2449,6 +2501,8 @@ class TokenFetcherCredentialsTest : public ::testing::Test {
       return kFactory.Create();
     }
 
+    const std::string token_cache_key_;
+
     Mutex mu_;
     std::deque<absl::StatusOr<RefCountedPtr<Token>>> queue_
         ABSL_GUARDED_BY(&mu_);
@@ -2693,6 +2747,102 @@ TEST_F(TokenFetcherCredentialsTest, ShutdownWhileBackoffTimerPending) {
   // Do nothing else.  Make sure the creds shut down correctly.
 }
 
+TEST_F(TokenFetcherCredentialsTest, ProactiveRefresh) {
+  const auto kExpirationTime = Timestamp::Now() + Duration::Hours(1);
+  std::optional<FuzzingEventEngine::Duration> run_after_duration;
+  event_engine_->SetRunAfterDurationCallback(
+      [&](FuzzingEventEngine::Duration duration) {
+        run_after_duration = duration;
+      });
+  ExecCtx exec_ctx;
+  auto creds = MakeRefCounted<TestTokenFetcherCredentials>(
+      event_engine_, HalfLifetimeRefresh());
+  creds->AddResult(MakeToken("foo", kExpirationTime));
+  auto state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: foo", /*expect_delay=*/true);
+  state->RunRequestMetadataTest(creds.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  EXPECT_EQ(creds->num_fetches(), 1);
+  // When the fetch completes, a refresh is scheduled half way to the
+  // token's adjusted expiration.
+  while (!run_after_duration.has_value()) event_engine_->Tick();
+  EXPECT_LE(*run_after_duration, std::chrono::seconds(1785));
+  EXPECT_GT(*run_after_duration, std::chrono::seconds(1780));
+  // The token was used, so it is refreshed without waiting for a call.
+  creds->AddResult(MakeToken("bar"));
+  event_engine_->TickUntilIdle();
+  EXPECT_EQ(creds->num_fetches(), 2);
+  state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: bar", /*expect_delay=*/false);
+  state->RunRequestMetadataTest(creds.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  EXPECT_EQ(creds->num_fetches(), 2);
+}
+
+TEST_F(TokenFetcherCredentialsTest, ProactiveRefreshSkipsUnusedToken) {
+  const auto kStartTime = Timestamp::Now();
+  std::optional<FuzzingEventEngine::Duration> run_after_duration;
+  event_engine_->SetRunAfterDurationCallback(
+      [&](FuzzingEventEngine::Duration duration) {
+        run_after_duration = duration;
+      });
+  ExecCtx exec_ctx;
+  auto creds = MakeRefCounted<TestTokenFetcherCredentials>(
+      event_engine_, HalfLifetimeRefresh());
+  creds->AddResult(MakeToken("foo", kStartTime + Duration::Hours(1)));
+  auto state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: foo", /*expect_delay=*/true);
+  state->RunRequestMetadataTest(creds.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  while (!run_after_duration.has_value()) event_engine_->Tick();
+  // The first refresh happens, but no call uses the new token, so it is not
+  // refreshed again.
+  creds->AddResult(MakeToken("bar", kStartTime + Duration::Hours(2)));
+  event_engine_->TickUntilIdle();
+  EXPECT_EQ(creds->num_fetches(), 2);
+}
+
+TEST_F(TokenFetcherCredentialsTest, ProactiveRefreshSharesTokens) {
+  const auto kExpirationTime = Timestamp::Now() + Duration::Hours(1);
+  std::optional<FuzzingEventEngine::Duration> run_after_duration;
+  event_engine_->SetRunAfterDurationCallback(
+      [&](FuzzingEventEngine::Duration duration) {
+        run_after_duration = duration;
+      });
+  ExecCtx exec_ctx;
+  auto creds1 = MakeRefCounted<TestTokenFetcherCredentials>(
+      event_engine_, HalfLifetimeRefresh(), "shared");
+  auto creds2 = MakeRefCounted<TestTokenFetcherCredentials>(
+      event_engine_, HalfLifetimeRefresh(), "shared");
+  auto creds3 = MakeRefCounted<TestTokenFetcherCredentials>(
+      event_engine_, HalfLifetimeRefresh(), "other");
+  creds1->AddResult(MakeToken("foo", kExpirationTime));
+  auto state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: foo", /*expect_delay=*/true);
+  state->RunRequestMetadataTest(creds1.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  while (!run_after_duration.has_value()) event_engine_->Tick();
+  // Credentials with the same key use the token without fetching it.
+  state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: foo", /*expect_delay=*/false);
+  state->RunRequestMetadataTest(creds2.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  EXPECT_EQ(creds2->num_fetches(), 0);
+  // Credentials with a different key fetch their own.
+  run_after_duration.reset();
+  creds3->AddResult(MakeToken("bar", kExpirationTime));
+  state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: bar", /*expect_delay=*/true);
+  state->RunRequestMetadataTest(creds3.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  EXPECT_EQ(creds3->num_fetches(), 1);
+  while (!run_after_duration.has_value()) event_engine_->Tick();
+  // Shutting down cancels the refresh timers.
+  creds1.reset();
+  creds2.reset();
+  creds3.reset();
+}
+
 // The subclass of ExternalAccountCredentials for testing.
 // ExternalAccountCredentials is an abstract class so we can't directly test
 // against it.
@@ -75,6 +75,21 @@ TEST_F(EvaluateArgsTest, GetHeaderValueAliasesHost) {
   EXPECT_EQ(value.value(), "test.google.com");
 }
 
+TEST_F(EvaluateArgsTest, GetMemoizedHeaderValue) {
+  util_.AddPairToMetadata("key123", "value1");
+  util_.AddPairToMetadata("key123", "value2");
+  EvaluateArgs args = util_.MakeEvaluateArgs();
+  std::optional<absl::string_view> value = args.GetHeaderValue("key123");
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), "value1,value2");
+  EXPECT_EQ(args.GetHeaderValue("other_key"), std::nullopt);
+  // Memoized values stay valid when other keys are looked up.
+  std::optional<absl::string_view> value_again = args.GetHeaderValue("key123");
+  ASSERT_TRUE(value_again.has_value());
+  EXPECT_EQ(value_again->data(), value->data());
+  EXPECT_EQ(value.value(), "value1,value2");
+}
+
 TEST_F(EvaluateArgsTest, TestLocalAddressAndPort) {
   util_.SetLocalEndpoint("ipv6:[2001:0db8:85a3:0000:0000:8a2e:0370:7334]:456");
   EvaluateArgs args = util_.MakeEvaluateArgs();
@@ -215,6 +215,50 @@ TEST_F(GrpcAuthorizationEngineTest, AuditLoggerOnAllowNotInvoked) {
   EXPECT_EQ(audit_logs_.size(), 0);
 }
 
+TEST_F(GrpcAuthorizationEngineTest, PathIndexedPoliciesKeepPolicyOrder) {
+  auto path_permission = [](absl::string_view path) {
+    return std::make_unique<Rbac::Permission>(
+        Rbac::Permission::MakePathPermission(
+            StringMatcher::Create(StringMatcher::Type::kExact, path).value()));
+  };
+  std::vector<std::unique_ptr<Rbac::Permission>> other_paths;
+  other_paths.push_back(path_permission("/foo.Bar/Other"));
+  other_paths.push_back(path_permission("/foo.Bar/Another"));
+  std::vector<std::unique_ptr<Rbac::Permission>> paths;
+  paths.push_back(path_permission("/foo.Bar/Other"));
+  paths.push_back(path_permission(kRpcMethod));
+  std::vector<std::unique_ptr<Rbac::Permission>> path_and_any;
+  path_and_any.push_back(path_permission(kRpcMethod));
+  path_and_any.push_back(std::make_unique<Rbac::Permission>(
+      Rbac::Permission::MakeAnyPermission()));
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakeOrPermission(std::move(other_paths)),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["policy2"] = Rbac::Policy(
+      Rbac::Permission::MakeNotPermission(
+          Rbac::Permission::MakeAnyPermission()),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["policy3"] = Rbac::Policy(
+      Rbac::Permission::MakeAndPermission(std::move(path_and_any)),
+      Rbac::Principal::MakeNotPrincipal(Rbac::Principal::MakeAnyPrincipal()));
+  policies["policy4"] =
+      Rbac::Policy(Rbac::Permission::MakeOrPermission(std::move(paths)),
+                   Rbac::Principal::MakeAnyPrincipal());
+  policies["policy5"] = Rbac::Policy(Rbac::Permission::MakeAnyPermission(),
+                                     Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  GrpcAuthorizationEngine engine(std::move(rbac));
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy4");
+  // A request without a path only matches unindexed policies.
+  decision = engine.Evaluate(EvaluateArgs(nullptr, nullptr));
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy5");
+}
+
 TEST_F(GrpcAuthorizationEngineTest, AuditLoggerOnAllowInvoked) {
   Rbac::Policy policy1(Rbac::Permission::MakeAnyPermission(),
                        Rbac::Principal::MakeAnyPrincipal());
@@ -173,6 +173,16 @@ TEST(TlsCredentialsOptionsComparatorTest, DifferentCrlProvider) {
   delete options_1;
   delete options_2;
 }
+TEST(TlsCredentialsOptionsComparatorTest, DifferentSessionTicketKeyProvider) {
+  auto* options_1 = grpc_tls_credentials_options_create();
+  auto* options_2 = grpc_tls_credentials_options_create();
+  options_1->set_session_ticket_key_provider(*experimental::CreateRotatingSessionTicketKeyProvider(std::string(32, 'a')));
+  options_2->set_session_ticket_key_provider(*experimental::CreateRotatingSessionTicketKeyProvider(std::string(32, 'a')));
+  EXPECT_FALSE(*options_1 == *options_2);
+  EXPECT_FALSE(*options_2 == *options_1);
+  delete options_1;
+  delete options_2;
+}
 TEST(TlsCredentialsOptionsComparatorTest, DifferentSendClientCaListValues) {
   auto* options_1 = grpc_tls_credentials_options_create();
   auto* options_2 = grpc_tls_credentials_options_create();
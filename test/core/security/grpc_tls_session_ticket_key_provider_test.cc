@@ -0,0 +1,126 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.h"
+
+#include <grpc/grpc_session_ticket_key_provider.h>
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace experimental {
+namespace {
+
+absl::string_view Name(const SessionTicketKey& key) {
+  return absl::string_view(reinterpret_cast<const char*>(key.name),
+                           sizeof(key.name));
+}
+
+bool SameKey(const SessionTicketKey& a, const SessionTicketKey& b) {
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+std::shared_ptr<RotatingSessionTicketKeyProvider> CreateProvider(
+    absl::string_view secret) {
+  auto provider = CreateRotatingSessionTicketKeyProvider(secret);
+  EXPECT_TRUE(provider.ok()) << provider.status();
+  return *provider;
+}
+
+TEST(RotatingSessionTicketKeyProviderTest, RejectsShortSecret) {
+  EXPECT_EQ(CreateRotatingSessionTicketKeyProvider(std::string(31, 'a'))
+                .status()
+                .code(),
+            absl::StatusCode::kInvalidArgument);
+  auto provider = CreateProvider(std::string(32, 'a'));
+  SessionTicketKey key = provider->EncryptionKey();
+  EXPECT_EQ(provider->Rotate("short").code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_TRUE(SameKey(provider->EncryptionKey(), key));
+}
+
+TEST(RotatingSessionTicketKeyProviderTest, SameSecretSameKey) {
+  auto provider_1 = CreateProvider(std::string(32, 'a'));
+  auto provider_2 = CreateProvider(std::string(32, 'a'));
+  auto provider_3 = CreateProvider(std::string(32, 'b'));
+  EXPECT_TRUE(
+      SameKey(provider_1->EncryptionKey(), provider_2->EncryptionKey()));
+  EXPECT_FALSE(
+      SameKey(provider_1->EncryptionKey(), provider_3->EncryptionKey()));
+  // Another server's tickets can be decrypted without renewal.
+  bool renew = true;
+  std::optional<SessionTicketKey> key =
+      provider_2->DecryptionKey(Name(provider_1->EncryptionKey()), &renew);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_TRUE(SameKey(*key, provider_1->EncryptionKey()));
+  EXPECT_FALSE(renew);
+  EXPECT_FALSE(
+      provider_3->DecryptionKey(Name(provider_1->EncryptionKey()), &renew)
+          .has_value());
+}
+
+TEST(RotatingSessionTicketKeyProviderTest, RotationKeepsPreviousKey) {
+  auto provider = CreateProvider(std::string(32, 'a'));
+  SessionTicketKey key_a = provider->EncryptionKey();
+  ASSERT_TRUE(provider->Rotate(std::string(32, 'b')).ok());
+  SessionTicketKey key_b = provider->EncryptionKey();
+  EXPECT_FALSE(SameKey(key_a, key_b));
+  bool renew = false;
+  std::optional<SessionTicketKey> key =
+      provider->DecryptionKey(Name(key_a), &renew);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_TRUE(SameKey(*key, key_a));
+  EXPECT_TRUE(renew);
+  key = provider->DecryptionKey(Name(key_b), &renew);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_FALSE(renew);
+  // A second rotation retires the first key.
+  ASSERT_TRUE(provider->Rotate(std::string(32, 'c')).ok());
+  EXPECT_FALSE(provider->DecryptionKey(Name(key_a), &renew).has_value());
+  EXPECT_TRUE(provider->DecryptionKey(Name(key_b), &renew).has_value());
+  EXPECT_TRUE(renew);
+}
+
+TEST(RotatingSessionTicketKeyProviderTest, RotationToCurrentSecretIsNoop) {
+  auto provider = CreateProvider(std::string(32, 'a'));
+  SessionTicketKey key_a = provider->EncryptionKey();
+  ASSERT_TRUE(provider->Rotate(std::string(32, 'b')).ok());
+  ASSERT_TRUE(provider->Rotate(std::string(32, 'b')).ok());
+  bool renew = false;
+  EXPECT_TRUE(provider->DecryptionKey(Name(key_a), &renew).has_value());
+  EXPECT_TRUE(renew);
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
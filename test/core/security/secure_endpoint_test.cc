@@ -24,6 +24,8 @@
 #include <gtest/gtest.h>
 #include <sys/types.h>
 
+#include <string>
+
 #include "absl/log/log.h"
 #include "src/core/lib/iomgr/endpoint_pair.h"
 #include "src/core/lib/iomgr/iomgr.h"
@@ -300,6 +302,107 @@ static void test_leftover(grpc_endpoint_test_config config, size_t slice_size) {
   clean_up();
 }
 
+// An endpoint that records what is written to it.
+typedef struct capture_endpoint {
+  grpc_endpoint base;
+  grpc_slice_buffer written;
+} capture_endpoint;
+
+static void ce_write(grpc_endpoint* ep, grpc_slice_buffer* slices,
+                     grpc_closure* cb, void* /*arg*/, int /*max_frame_size*/) {
+  capture_endpoint* c = reinterpret_cast<capture_endpoint*>(ep);
+  for (size_t i = 0; i < slices->count; i++) {
+    grpc_slice_buffer_add(&c->written, grpc_slice_ref(slices->slices[i]));
+  }
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, absl::OkStatus());
+}
+
+static void ce_destroy(grpc_endpoint* ep) {
+  capture_endpoint* c = reinterpret_cast<capture_endpoint*>(ep);
+  grpc_slice_buffer_destroy(&c->written);
+  gpr_free(c);
+}
+
+static const grpc_endpoint_vtable capture_vtable = {me_read,
+                                                    ce_write,
+                                                    me_add_to_pollset,
+                                                    me_add_to_pollset_set,
+                                                    me_delete_from_pollset_set,
+                                                    ce_destroy,
+                                                    me_get_peer,
+                                                    me_get_local_address,
+                                                    me_get_fd,
+                                                    me_can_track_err};
+
+static std::string slice_buffer_to_string(grpc_slice_buffer* sb) {
+  std::string out;
+  for (size_t i = 0; i < sb->count; i++) {
+    out.append(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(sb->slices[i])),
+        GRPC_SLICE_LENGTH(sb->slices[i]));
+  }
+  return out;
+}
+
+static void test_handshake_bytes_to_send(bool use_zero_copy_protector) {
+  grpc_core::ExecCtx exec_ctx;
+  capture_endpoint* capture =
+      static_cast<capture_endpoint*>(gpr_malloc(sizeof(*capture)));
+  capture->base.vtable = &capture_vtable;
+  grpc_slice_buffer_init(&capture->written);
+  const std::string handshake_bytes = "end of the handshake";
+  grpc_slice_buffer handshake_sb;
+  grpc_slice_buffer_init(&handshake_sb);
+  grpc_slice_buffer_add(&handshake_sb, grpc_slice_from_copied_buffer(
+                                           handshake_bytes.data(),
+                                           handshake_bytes.size()));
+  grpc_resource_quota* resource_quota = grpc_resource_quota_create("test");
+  grpc_arg a;
+  a.key = const_cast<char*>(GRPC_ARG_RESOURCE_QUOTA);
+  a.type = GRPC_ARG_POINTER;
+  a.value.pointer.p = resource_quota;
+  a.value.pointer.vtable = grpc_resource_quota_arg_vtable();
+  grpc_channel_args args = {1, &a};
+  tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
+  if (use_zero_copy_protector) {
+    zero_copy_protector = tsi_create_fake_zero_copy_grpc_protector(nullptr);
+  }
+  grpc_core::OrphanablePtr<grpc_endpoint> ep = grpc_secure_endpoint_create(
+      tsi_create_fake_frame_protector(nullptr), zero_copy_protector,
+      grpc_core::OrphanablePtr<grpc_endpoint>(&capture->base), nullptr, &args,
+      0, &handshake_sb);
+  grpc_resource_quota_unref(resource_quota);
+  // The bytes were moved into the endpoint.
+  ASSERT_EQ(handshake_sb.length, 0u);
+  int n = 0;
+  grpc_closure done_closure;
+  GRPC_CLOSURE_INIT(&done_closure, inc_call_ctr, &n, grpc_schedule_on_exec_ctx);
+  grpc_slice_buffer outgoing;
+  grpc_slice_buffer_init(&outgoing);
+  grpc_slice_buffer_add(&outgoing, grpc_slice_from_copied_string("preface"));
+  grpc_endpoint_write(ep.get(), &outgoing, &done_closure, nullptr,
+                      /*max_frame_size=*/INT_MAX);
+  grpc_core::ExecCtx::Get()->Flush();
+  ASSERT_EQ(n, 1);
+  // The handshake bytes are sent unprotected, ahead of the protected data.
+  std::string written = slice_buffer_to_string(&capture->written);
+  ASSERT_GT(written.size(), handshake_bytes.size());
+  ASSERT_EQ(written.substr(0, handshake_bytes.size()), handshake_bytes);
+  size_t first_write_size = written.size();
+  // They are only sent once.
+  grpc_slice_buffer_reset_and_unref(&capture->written);
+  grpc_slice_buffer_add(&outgoing, grpc_slice_from_copied_string("preface"));
+  grpc_endpoint_write(ep.get(), &outgoing, &done_closure, nullptr,
+                      /*max_frame_size=*/INT_MAX);
+  grpc_core::ExecCtx::Get()->Flush();
+  ASSERT_EQ(n, 2);
+  ASSERT_EQ(capture->written.length,
+            first_write_size - handshake_bytes.size());
+  ep.reset();
+  grpc_slice_buffer_destroy(&outgoing);
+  grpc_slice_buffer_destroy(&handshake_sb);
+}
+
 static void destroy_pollset(void* p, grpc_error_handle /*error*/) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
@@ -316,6 +419,8 @@ TEST(SecureEndpointTest, MainTest) {
     grpc_endpoint_tests(configs[1], g_pollset, g_mu);
     test_leftover(configs[2], 1);
     test_leftover(configs[3], 1);
+    test_handshake_bytes_to_send(/*use_zero_copy_protector=*/false);
+    test_handshake_bytes_to_send(/*use_zero_copy_protector=*/true);
     GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
                       grpc_schedule_on_exec_ctx);
     grpc_pollset_shutdown(g_pollset, &destroyed);
@@ -0,0 +1,303 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/alloc.h>
+
+#include <atomic>
+#include <climits>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/handshaker/handshaker.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/security/credentials/ssl/ssl_credentials.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "test/core/test_util/test_config.h"
+#include "test/core/test_util/tls_utils.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr char kCaCertPath[] = "src/core/tsi/test_creds/ca.pem";
+constexpr char kServerCertPath[] = "src/core/tsi/test_creds/server1.pem";
+constexpr char kServerKeyPath[] = "src/core/tsi/test_creds/server1.key";
+
+// An endpoint that counts the writes on the endpoint it wraps.
+struct CountingEndpoint {
+  grpc_endpoint base;
+  grpc_endpoint* wrapped;
+  std::atomic<int>* writes;
+};
+
+grpc_endpoint* Wrapped(grpc_endpoint* ep) {
+  return reinterpret_cast<CountingEndpoint*>(ep)->wrapped;
+}
+
+void CeRead(grpc_endpoint* ep, grpc_slice_buffer* slices, grpc_closure* cb,
+            bool urgent, int min_progress_size) {
+  grpc_endpoint_read(Wrapped(ep), slices, cb, urgent, min_progress_size);
+}
+
+void CeWrite(grpc_endpoint* ep, grpc_slice_buffer* slices, grpc_closure* cb,
+             void* arg, int max_frame_size) {
+  reinterpret_cast<CountingEndpoint*>(ep)->writes->fetch_add(1);
+  grpc_endpoint_write(Wrapped(ep), slices, cb, arg, max_frame_size);
+}
+
+void CeAddToPollset(grpc_endpoint* ep, grpc_pollset* pollset) {
+  grpc_endpoint_add_to_pollset(Wrapped(ep), pollset);
+}
+
+void CeAddToPollsetSet(grpc_endpoint* ep, grpc_pollset_set* pollset_set) {
+  grpc_endpoint_add_to_pollset_set(Wrapped(ep), pollset_set);
+}
+
+void CeDeleteFromPollsetSet(grpc_endpoint* ep, grpc_pollset_set* pollset_set) {
+  grpc_endpoint_delete_from_pollset_set(Wrapped(ep), pollset_set);
+}
+
+void CeDestroy(grpc_endpoint* ep) {
+  grpc_endpoint_destroy(Wrapped(ep));
+  gpr_free(ep);
+}
+
+absl::string_view CeGetPeer(grpc_endpoint* ep) {
+  return grpc_endpoint_get_peer(Wrapped(ep));
+}
+
+absl::string_view CeGetLocalAddress(grpc_endpoint* ep) {
+  return grpc_endpoint_get_local_address(Wrapped(ep));
+}
+
+// Keeps the handshaker off the socket, so that it cannot use kernel TLS.
+int CeGetFd(grpc_endpoint* /*ep*/) { return -1; }
+
+bool CeCanTrackErr(grpc_endpoint* /*ep*/) { return false; }
+
+const grpc_endpoint_vtable kCountingVtable = {CeRead,
+                                              CeWrite,
+                                              CeAddToPollset,
+                                              CeAddToPollsetSet,
+                                              CeDeleteFromPollsetSet,
+                                              CeDestroy,
+                                              CeGetPeer,
+                                              CeGetLocalAddress,
+                                              CeGetFd,
+                                              CeCanTrackErr};
+
+OrphanablePtr<grpc_endpoint> MakeCountingEndpoint(grpc_endpoint* wrapped,
+                                                  std::atomic<int>* writes) {
+  auto* ep =
+      static_cast<CountingEndpoint*>(gpr_malloc(sizeof(CountingEndpoint)));
+  ep->base.vtable = &kCountingVtable;
+  ep->wrapped = wrapped;
+  ep->writes = writes;
+  return OrphanablePtr<grpc_endpoint>(&ep->base);
+}
+
+// The result of one side of a handshake.
+struct Side {
+  absl::Notification done;
+  absl::Status status;
+  OrphanablePtr<grpc_endpoint> endpoint;
+  std::atomic<int> writes{0};
+
+  void OnDone(absl::StatusOr<HandshakerArgs*> result) {
+    if (result.ok()) {
+      endpoint = std::move((*result)->endpoint);
+    } else {
+      status = result.status();
+    }
+    done.Notify();
+  }
+};
+
+class SecurityHandshakerTest : public ::testing::Test {
+ protected:
+  // Starts an SSL handshake between a client and a server over a socket pair.
+  void StartHandshake(grpc_tls_version tls_version,
+                      const ChannelArgs& extra_client_args,
+                      const ChannelArgs& extra_server_args) {
+    ExecCtx exec_ctx;
+    ChannelArgs args = CoreConfiguration::Get()
+                           .channel_args_preconditioning()
+                           .PreconditionChannelArgs(nullptr);
+    std::string ca_cert = testing::GetFileContents(kCaCertPath);
+    std::string server_cert = testing::GetFileContents(kServerCertPath);
+    std::string server_key = testing::GetFileContents(kServerKeyPath);
+    grpc_ssl_pem_key_cert_pair pem_key_cert_pair = {server_key.c_str(),
+                                                    server_cert.c_str()};
+    auto* client_creds = reinterpret_cast<grpc_ssl_credentials*>(
+        grpc_ssl_credentials_create(ca_cert.c_str(), nullptr, nullptr,
+                                    nullptr));
+    client_creds->set_min_tls_version(tls_version);
+    client_creds->set_max_tls_version(tls_version);
+    auto* server_creds = reinterpret_cast<grpc_ssl_server_credentials*>(
+        grpc_ssl_server_credentials_create(nullptr, &pem_key_cert_pair, 1, 0,
+                                           nullptr));
+    server_creds->set_min_tls_version(tls_version);
+    server_creds->set_max_tls_version(tls_version);
+    ChannelArgs client_args = extra_client_args.UnionWith(args);
+    auto client_connector = client_creds->create_security_connector(
+        nullptr, "foo.test.google.fr", &client_args);
+    auto server_connector = server_creds->create_security_connector(args);
+    grpc_channel_credentials_release(client_creds);
+    grpc_server_credentials_release(server_creds);
+    ASSERT_NE(client_connector, nullptr);
+    ASSERT_NE(server_connector, nullptr);
+    grpc_endpoint_pair pair =
+        grpc_iomgr_create_endpoint_pair("handshake", args.ToC().get());
+    auto client_mgr = MakeRefCounted<HandshakeManager>();
+    client_connector->add_handshakers(client_args, nullptr, client_mgr.get());
+    // The server goes through the registered factories, like the chttp2
+    // server does.
+    ChannelArgs server_args =
+        extra_server_args.UnionWith(args).SetObject(server_connector);
+    auto server_mgr = MakeRefCounted<HandshakeManager>();
+    CoreConfiguration::Get().handshaker_registry().AddHandshakers(
+        HANDSHAKER_SERVER, server_args, nullptr, server_mgr.get());
+    const Timestamp deadline = Timestamp::Now() + Duration::Seconds(30);
+    client_mgr->DoHandshake(
+        MakeCountingEndpoint(pair.client, &client_.writes), client_args,
+        deadline, nullptr,
+        [this, client_mgr](absl::StatusOr<HandshakerArgs*> result) {
+          client_.OnDone(std::move(result));
+        });
+    server_mgr->DoHandshake(
+        MakeCountingEndpoint(pair.server, &server_.writes), server_args,
+        deadline, nullptr,
+        [this, server_mgr](absl::StatusOr<HandshakerArgs*> result) {
+          server_.OnDone(std::move(result));
+        });
+  }
+
+  void TearDown() override {
+    ExecCtx exec_ctx;
+    client_.endpoint.reset();
+    server_.endpoint.reset();
+  }
+
+  static void Await(Side& side) {
+    ASSERT_TRUE(side.done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+    ASSERT_TRUE(side.status.ok()) << side.status;
+  }
+
+  // Writes \a data on the client's secure endpoint.
+  void ClientWrite(absl::string_view data) {
+    ExecCtx exec_ctx;
+    SliceBuffer outgoing;
+    outgoing.Append(Slice::FromCopiedString(data));
+    absl::Notification written;
+    grpc_endpoint_write(
+        client_.endpoint.get(), outgoing.c_slice_buffer(),
+        NewClosure([&written](absl::Status status) {
+          EXPECT_TRUE(status.ok()) << status;
+          written.Notify();
+        }),
+        nullptr, /*max_frame_size=*/INT_MAX);
+    ExecCtx::Get()->Flush();
+    ASSERT_TRUE(written.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  }
+
+  // Reads from the server's secure endpoint until \a size bytes arrived.
+  std::string ServerRead(size_t size) {
+    std::string data;
+    while (data.size() < size) {
+      ExecCtx exec_ctx;
+      SliceBuffer incoming;
+      absl::Notification read;
+      grpc_endpoint_read(server_.endpoint.get(), incoming.c_slice_buffer(),
+                         NewClosure([&read](absl::Status status) {
+                           EXPECT_TRUE(status.ok()) << status;
+                           read.Notify();
+                         }),
+                         /*urgent=*/true, /*min_progress_size=*/1);
+      ExecCtx::Get()->Flush();
+      if (!read.WaitForNotificationWithTimeout(absl::Seconds(30)) ||
+          incoming.Length() == 0) {
+        break;
+      }
+      data += incoming.JoinIntoString();
+    }
+    return data;
+  }
+
+  Side client_;
+  Side server_;
+};
+
+TEST_F(SecurityHandshakerTest, ClientSendsFinalFlightOnItsOwn) {
+  StartHandshake(grpc_tls_version::TLS1_3, ChannelArgs(), ChannelArgs());
+  Await(client_);
+  Await(server_);
+  // The first flight and the last one.
+  EXPECT_EQ(client_.writes.load(), 2);
+  ClientWrite("hello");
+  EXPECT_EQ(ServerRead(5), "hello");
+  EXPECT_EQ(client_.writes.load(), 3);
+}
+
+TEST_F(SecurityHandshakerTest, ClientFinalFlightGoesOutWithFirstWrite) {
+  StartHandshake(
+      grpc_tls_version::TLS1_3,
+      ChannelArgs().Set(GRPC_ARG_SECURITY_HANDSHAKE_COALESCE_FINAL_FLIGHT,
+                        true),
+      ChannelArgs());
+  Await(client_);
+  // Only the first flight was written.
+  EXPECT_EQ(client_.writes.load(), 1);
+  // The server needs the client's last flight to finish.
+  EXPECT_FALSE(server_.done.HasBeenNotified());
+  ClientWrite("hello");
+  EXPECT_EQ(client_.writes.load(), 2);
+  Await(server_);
+  EXPECT_EQ(ServerRead(5), "hello");
+}
+
+// In a full TLS 1.2 handshake the server sends the last flight, which the
+// client waits for before it can write anything. If the server held it back
+// for its first write, the client would never finish.
+TEST_F(SecurityHandshakerTest, ServerIgnoresCoalescing) {
+  const ChannelArgs coalesce =
+      ChannelArgs().Set(GRPC_ARG_SECURITY_HANDSHAKE_COALESCE_FINAL_FLIGHT,
+                        true);
+  StartHandshake(grpc_tls_version::TLS1_2, coalesce, coalesce);
+  Await(server_);
+  Await(client_);
+  EXPECT_EQ(server_.writes.load(), 2);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
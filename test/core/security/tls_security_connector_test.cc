@@ -791,6 +791,62 @@ TEST_F(TlsSecurityConnectorTest,
   EXPECT_EQ(tls_connector->KeyCertPairListForTesting(), identity_pairs_1_);
 }
 
+TEST_F(TlsSecurityConnectorTest,
+       ReplacedServerHandshakerFactoryOutlivesCertsUpdate) {
+  RefCountedPtr<grpc_tls_certificate_distributor> distributor =
+      MakeRefCounted<grpc_tls_certificate_distributor>();
+  distributor->SetKeyMaterials(kRootCertName, root_cert_0_, std::nullopt);
+  distributor->SetKeyMaterials(kIdentityCertName, std::nullopt,
+                               identity_pairs_0_);
+  RefCountedPtr<grpc_tls_certificate_provider> provider =
+      MakeRefCounted<TlsTestCertificateProvider>(distributor);
+  RefCountedPtr<grpc_tls_credentials_options> options =
+      MakeRefCounted<grpc_tls_credentials_options>();
+  options->set_certificate_provider(provider);
+  options->set_watch_root_cert(true);
+  options->set_watch_identity_pair(true);
+  options->set_root_cert_name(kRootCertName);
+  options->set_identity_cert_name(kIdentityCertName);
+  options->set_cert_request_type(
+      GRPC_SSL_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_AND_VERIFY);
+  RefCountedPtr<TlsServerCredentials> credential =
+      MakeRefCounted<TlsServerCredentials>(options);
+  RefCountedPtr<grpc_server_security_connector> connector =
+      credential->create_security_connector(ChannelArgs());
+  ASSERT_NE(connector, nullptr);
+  TlsServerSecurityConnector* tls_connector =
+      static_cast<TlsServerSecurityConnector*>(connector.get());
+  // Hold on to the factory, as a handshake in flight would.
+  tsi_ssl_server_handshaker_factory* old_factory =
+      tsi_ssl_server_handshaker_factory_ref(
+          tls_connector->ServerHandshakerFactoryForTesting());
+  ASSERT_NE(old_factory, nullptr);
+  // Only updating the identity certs reuses the parsed roots.
+  distributor->SetKeyMaterials(kIdentityCertName, std::nullopt,
+                               identity_pairs_1_);
+  tsi_ssl_server_handshaker_factory* new_factory =
+      tls_connector->ServerHandshakerFactoryForTesting();
+  EXPECT_NE(new_factory, nullptr);
+  EXPECT_NE(new_factory, old_factory);
+  distributor->SetKeyMaterials(kRootCertName, root_cert_1_, std::nullopt);
+  EXPECT_NE(tls_connector->ServerHandshakerFactoryForTesting(), nullptr);
+  // The replaced factory still creates handshakers, as does the current one.
+  tsi_handshaker* handshaker = nullptr;
+  EXPECT_EQ(tsi_ssl_server_handshaker_factory_create_handshaker(
+                old_factory, /*network_bio_buf_size=*/0,
+                /*ssl_bio_buf_size=*/0, &handshaker),
+            TSI_OK);
+  tsi_handshaker_destroy(handshaker);
+  tsi_ssl_server_handshaker_factory_unref(old_factory);
+  handshaker = nullptr;
+  EXPECT_EQ(tsi_ssl_server_handshaker_factory_create_handshaker(
+                tls_connector->ServerHandshakerFactoryForTesting(),
+                /*network_bio_buf_size=*/0,
+                /*ssl_bio_buf_size=*/0, &handshaker),
+            TSI_OK);
+  tsi_handshaker_destroy(handshaker);
+}
+
 // Note that on server side, we don't have tests watching root certs only,
 // because in TLS, the identity certs should always be presented. If we don't
 // provide, it will try to load certs from some default system locations, and
@@ -0,0 +1,188 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/server/tenant_scheduler.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using ::testing::ElementsAre;
+
+// Runs the scheduler's items on a fake CPU clock, which each item advances
+// by its cost.
+class TenantSchedulerTest : public ::testing::Test {
+ protected:
+  TenantSchedulerTest() : scheduler_(1, [this] { return now_; }) {}
+
+  void Add(const std::string& tenant, int64_t cost) {
+    scheduler_.Add(tenant, [this, tenant, cost] {
+      now_ += cost;
+      ran_.push_back(tenant);
+    });
+  }
+
+  void RunNext(int n) {
+    for (int i = 0; i < n; ++i) scheduler_.RunNext();
+  }
+
+  int64_t now_ = 0;
+  std::vector<std::string> ran_;
+  TenantScheduler scheduler_;
+};
+
+TEST_F(TenantSchedulerTest, HeavyTenantWaitsBehindLightTenant) {
+  for (int i = 0; i < 4; ++i) Add("heavy", 100);
+  for (int i = 0; i < 4; ++i) Add("light", 10);
+  RunNext(8);
+  EXPECT_THAT(ran_, ElementsAre("heavy", "light", "light", "light", "light",
+                                "heavy", "heavy", "heavy"));
+}
+
+TEST_F(TenantSchedulerTest, TenantsShareCpuByWeight) {
+  scheduler_.SetWeight("a", 3);
+  for (int i = 0; i < 40; ++i) {
+    Add("a", 10);
+    Add("b", 10);
+  }
+  RunNext(40);
+  int a = 0;
+  for (const std::string& tenant : ran_) {
+    if (tenant == "a") ++a;
+  }
+  EXPECT_NEAR(a, 30, 1);
+  RunNext(40);
+}
+
+TEST_F(TenantSchedulerTest, IdleTenantDoesNotBankCredit) {
+  for (int i = 0; i < 10; ++i) Add("busy", 10);
+  RunNext(10);
+  ran_.clear();
+  for (int i = 0; i < 4; ++i) {
+    Add("busy", 10);
+    Add("idle", 10);
+  }
+  RunNext(4);
+  // Had the idle tenant kept the credit of the time it was idle, it would have
+  // taken all of these.
+  EXPECT_THAT(ran_, ::testing::Contains("busy"));
+  EXPECT_THAT(ran_, ::testing::Contains("idle"));
+  RunNext(4);
+}
+
+TEST_F(TenantSchedulerTest, RunOverQuotaIsLeftToRunningCall) {
+  scheduler_.Add("a", [this] {
+    ran_.push_back("outer start");
+    Add("b", 1);
+    // Only one item may run at once, so this leaves b's item to the call
+    // running this one.
+    scheduler_.RunNext();
+    ran_.push_back("outer end");
+  });
+  scheduler_.RunNext();
+  EXPECT_THAT(ran_, ElementsAre("outer start", "outer end", "b"));
+}
+
+TEST_F(TenantSchedulerTest, Stats) {
+  scheduler_.SetWeight("b", 2);
+  Add("a", 100);
+  Add("a", 100);
+  Add("b", 50);
+  RunNext(2);
+  std::vector<TenantScheduler::TenantStats> stats = scheduler_.GetStats();
+  ASSERT_EQ(stats.size(), 2);
+  EXPECT_EQ(stats[0].tenant, "a");
+  EXPECT_EQ(stats[0].weight, 1);
+  EXPECT_EQ(stats[0].items_run, 1);
+  EXPECT_EQ(stats[0].items_queued, 1);
+  EXPECT_EQ(stats[0].cpu_time_nanos, 100);
+  EXPECT_EQ(stats[1].tenant, "b");
+  EXPECT_EQ(stats[1].weight, 2);
+  EXPECT_EQ(stats[1].items_run, 1);
+  EXPECT_EQ(stats[1].items_queued, 0);
+  EXPECT_EQ(stats[1].cpu_time_nanos, 50);
+  RunNext(1);
+}
+
+TEST_F(TenantSchedulerTest, TenantsPastLimitShareDefaultTenant) {
+  for (size_t i = 0; i <= TenantScheduler::kMaxTenants; ++i) {
+    Add(absl::StrCat("tenant", i), 1);
+  }
+  RunNext(TenantScheduler::kMaxTenants + 1);
+  std::vector<TenantScheduler::TenantStats> stats = scheduler_.GetStats();
+  ASSERT_EQ(stats.size(), TenantScheduler::kMaxTenants + 1);
+  EXPECT_EQ(stats[0].tenant, "");
+  EXPECT_EQ(stats[0].items_run, 1);
+}
+
+TEST_F(TenantSchedulerTest, IdleTenantsMakeRoomForNewOnes) {
+  for (size_t i = 0; i < TenantScheduler::kMaxTenants; ++i) {
+    Add(absl::StrCat("tenant", i), 1);
+  }
+  RunNext(TenantScheduler::kMaxTenants);
+  scheduler_.SetWeight("tenant0", 2);
+  Add("new", 1);
+  Add("newer", 1);
+  RunNext(2);
+  // Two idle tenants were forgotten, neither of them the weighted one, and
+  // no one had to share the default tenant.
+  std::vector<std::string> tenants;
+  for (const auto& stats : scheduler_.GetStats()) {
+    tenants.push_back(stats.tenant);
+  }
+  EXPECT_EQ(tenants.size(), TenantScheduler::kMaxTenants);
+  EXPECT_THAT(tenants, ::testing::Contains("tenant0"));
+  EXPECT_THAT(tenants, ::testing::Contains("new"));
+  EXPECT_THAT(tenants, ::testing::Contains("newer"));
+  EXPECT_THAT(tenants, ::testing::Not(::testing::Contains("")));
+}
+
+TEST_F(TenantSchedulerTest, BusyAndWeightedTenantsAreKept) {
+  scheduler_.SetWeight("weighted", 2);
+  Add("weighted", 1);
+  RunNext(1);
+  for (size_t i = 1; i < TenantScheduler::kMaxTenants; ++i) {
+    Add(absl::StrCat("tenant", i), 1);
+  }
+  // Every tracked tenant has an item queued or a weight, so this one has to
+  // share the default tenant.
+  Add("late", 1);
+  std::vector<TenantScheduler::TenantStats> stats = scheduler_.GetStats();
+  ASSERT_EQ(stats.size(), TenantScheduler::kMaxTenants + 1);
+  EXPECT_EQ(stats[0].tenant, "");
+  EXPECT_EQ(stats[0].items_queued, 1);
+  RunNext(TenantScheduler::kMaxTenants);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -325,6 +325,29 @@ TEST_F(ServiceConfigTest, Parser2BasicTest) {
   EXPECT_EQ(static_cast<TestParsedConfig1*>(parsed_config)->value(), 5);
 }
 
+TEST_F(ServiceConfigTest, Parser2MethodLookupPrecedence) {
+  const char* test_json =
+      "{\"methodConfig\": ["
+      "  {\"name\":[{}], \"method_param\":1},"
+      "  {\"name\":[{\"service\":\"TestServ\"}], \"method_param\":2},"
+      "  {\"name\":[{\"service\":\"TestServ\", \"method\":\"Exact\"}],"
+      "   \"method_param\":3}"
+      "]}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  auto method_param = [&](const char* path) -> int {
+    const auto* vector_ptr =
+        (*service_config)
+            ->GetMethodParsedConfigVector(grpc_slice_from_static_string(path));
+    EXPECT_NE(vector_ptr, nullptr) << path;
+    if (vector_ptr == nullptr) return -1;
+    return static_cast<TestParsedConfig2*>(((*vector_ptr)[1]).get())->value();
+  };
+  EXPECT_EQ(method_param("/TestServ/Exact"), 3);
+  EXPECT_EQ(method_param("/TestServ/Other"), 2);
+  EXPECT_EQ(method_param("/OtherServ/Exact"), 1);
+}
+
 TEST_F(ServiceConfigTest, Parser2DisabledViaChannelArg) {
   const ChannelArgs args = ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1);
   const char* test_json =
@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
@@ -76,6 +77,90 @@ TEST(SliceBufferTest, SliceRefTest) {
   sb.Clear();
 }
 
+TEST(SliceBufferTest, ReserveSlicesTest) {
+  SliceBuffer sb;
+  Slice first_slice = MakeSlice(kNewSliceLength);
+  Slice first_slice_copy = first_slice.Copy();
+  sb.Append(std::move(first_slice));
+  // Leave a gap at the front of the slice array so that reserving has to
+  // account for the offset.
+  sb.Append(MakeSlice(kNewSliceLength));
+  Slice popped = sb.TakeFirst();
+  ASSERT_EQ(popped, first_slice_copy);
+  grpc_slice_buffer* c_sb = sb.c_slice_buffer();
+  grpc_slice_buffer_reserve_slices(c_sb, 100);
+  ASSERT_EQ(c_sb->slices, c_sb->base_slices);
+  ASSERT_GE(c_sb->capacity, 101);
+  ASSERT_EQ(sb.Count(), 1);
+  ASSERT_EQ(sb.Length(), kNewSliceLength);
+  const grpc_slice* base = c_sb->base_slices;
+  for (int i = 0; i < 100; i++) {
+    sb.Append(MakeSlice(kNewSliceLength));
+  }
+  // All appends fit in the reserved space: no regrowth.
+  ASSERT_EQ(c_sb->base_slices, base);
+  ASSERT_EQ(sb.Count(), 101);
+  ASSERT_EQ(sb.Length(), 101 * kNewSliceLength);
+  // Reserving less than the remaining capacity is a no-op.
+  const size_t capacity = c_sb->capacity;
+  grpc_slice_buffer_reserve_slices(c_sb, capacity - sb.Count());
+  ASSERT_EQ(c_sb->capacity, capacity);
+  ASSERT_EQ(c_sb->base_slices, base);
+  sb.Clear();
+}
+
+TEST(SliceBufferTest, AddContiguousPacksSmallAdditions) {
+  SliceBuffer sb;
+  std::string expected;
+  for (int i = 0; i < 20; i++) {
+    std::string piece(10 + i, 'a' + i);
+    sb.AppendCopied(piece);
+    expected += piece;
+  }
+  // 390 bytes, all packed into a single slice.
+  ASSERT_EQ(sb.Count(), 1);
+  ASSERT_EQ(sb.Length(), expected.size());
+  ASSERT_EQ(sb.JoinIntoString(), expected);
+  // Anything else appended breaks the run...
+  sb.Append(MakeSlice(kNewSliceLength));
+  expected += std::string(kNewSliceLength, 'a');
+  sb.AppendCopied("xyz");
+  expected += "xyz";
+  ASSERT_EQ(sb.Count(), 3);
+  // ... and overflowing the block starts a new one.
+  sb.AppendCopied(std::string(200, 'z'));
+  expected += std::string(200, 'z');
+  ASSERT_EQ(sb.Count(), 4);
+  // Big additions get a slice of their own.
+  sb.AppendCopied(std::string(SliceBuffer::kContiguousBlockSize, 'q'));
+  expected += std::string(SliceBuffer::kContiguousBlockSize, 'q');
+  ASSERT_EQ(sb.Count(), 5);
+  ASSERT_EQ(sb.JoinIntoString(), expected);
+}
+
+TEST(SliceBufferTest, AddContiguousLeavesOtherSlicesAlone) {
+  SliceBuffer sb;
+  sb.AppendCopied("hello");
+  // A reference to the block's last slice, held elsewhere, must not see (or
+  // be extended by) later additions.
+  Slice hello = sb.RefSlice(0);
+  SliceBuffer moved;
+  sb.MoveFirstNBytesIntoSliceBuffer(5, moved);
+  sb.AppendCopied(" world");
+  ASSERT_EQ(hello.as_string_view(), "hello");
+  ASSERT_EQ(moved.JoinIntoString(), "hello");
+  ASSERT_EQ(sb.JoinIntoString(), " world");
+  // The block outlives the buffer that filled it for as long as its slices
+  // do.
+  SliceBuffer other(std::move(sb));
+  other.AppendCopied("!");
+  ASSERT_EQ(other.Count(), 1);
+  other.Clear();
+  SliceBuffer().Swap(&other);
+  ASSERT_EQ(hello.as_string_view(), "hello");
+  ASSERT_EQ(moved.JoinIntoString(), "hello");
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
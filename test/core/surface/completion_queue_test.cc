@@ -170,6 +170,58 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   }
 }
 
+TEST(GrpcCompletionQueueTest, TestNextBatch) {
+  grpc_event events[2];
+  grpc_completion_queue* cc;
+  grpc_cq_completion completions[3];
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr = {};
+  void* tags[3];
+
+  LOG_TEST("test_next_batch");
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    grpc_core::ExecCtx exec_ctx;
+    attr.cq_polling_type = polling_types[i];
+    cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, GPR_ARRAY_SIZE(events),
+                  gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              1u);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_TIMEOUT);
+
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(completions); j++) {
+      tags[j] = create_test_tag();
+      ASSERT_TRUE(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], absl::OkStatus(), do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, GPR_ARRAY_SIZE(events),
+                  gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              2u);
+    for (size_t j = 0; j < 2; j++) {
+      ASSERT_EQ(events[j].type, GRPC_OP_COMPLETE);
+      ASSERT_EQ(events[j].tag, tags[j]);
+      ASSERT_TRUE(events[j].success);
+    }
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, GPR_ARRAY_SIZE(events),
+                  gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              1u);
+    ASSERT_EQ(events[0].type, GRPC_OP_COMPLETE);
+    ASSERT_EQ(events[0].tag, tags[2]);
+
+    shutdown_and_destroy(cc);
+  }
+}
+
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_event ev;
   grpc_completion_queue* cc;
@@ -0,0 +1,154 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/telemetry/call_cpu_accounting.h"
+
+#include <optional>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/down_cast.h"
+#include "test/core/test_util/fake_stats_plugin.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Gt;
+using ::testing::Optional;
+
+// Uses the CPU of the calling thread for at least \a nanos.
+void BurnCpu(int64_t nanos) {
+  const int64_t end = ThreadCpuTimeNanos() + nanos;
+  volatile uint64_t sink = 0;
+  while (ThreadCpuTimeNanos() < end) {
+    for (int i = 0; i < 1000; ++i) sink = sink + i;
+  }
+}
+
+class TestCallCpuAccounting final : public CallCpuAccounting {};
+
+class CallCpuAccountingTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (ThreadCpuTimeNanos() < 0) {
+      GTEST_SKIP() << "thread CPU time is not supported on this platform";
+    }
+  }
+
+  void TearDown() override {
+    GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+  }
+
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+};
+
+TEST_F(CallCpuAccountingTest, ScopeAccountsToPhase) {
+  TestCallCpuAccounting accounting;
+  const int64_t total_before = CallCpuAccounting::TotalNanos();
+  {
+    CallCpuAccounting::Scope scope(&accounting,
+                                   CallCpuAccounting::Phase::kHandler);
+    BurnCpu(1000000);
+  }
+  EXPECT_GE(accounting.handler_nanos(), 1000000);
+  EXPECT_EQ(accounting.core_nanos(), 0);
+  EXPECT_GE(CallCpuAccounting::TotalNanos() - total_before,
+            accounting.handler_nanos());
+}
+
+TEST_F(CallCpuAccountingTest, NestedScopesAreNotDoubleCounted) {
+  TestCallCpuAccounting accounting;
+  const int64_t start = ThreadCpuTimeNanos();
+  {
+    CallCpuAccounting::Scope handler_scope(&accounting,
+                                           CallCpuAccounting::Phase::kHandler);
+    BurnCpu(1000000);
+    {
+      // A scope without accounting does not pause the enclosing one.
+      CallCpuAccounting::Scope no_scope(nullptr,
+                                        CallCpuAccounting::Phase::kCore);
+      CallCpuAccounting::Scope core_scope(&accounting,
+                                          CallCpuAccounting::Phase::kCore);
+      BurnCpu(5000000);
+    }
+    BurnCpu(1000000);
+  }
+  const int64_t elapsed = ThreadCpuTimeNanos() - start;
+  EXPECT_GE(accounting.core_nanos(), 5000000);
+  EXPECT_GE(accounting.handler_nanos(), 2000000);
+  EXPECT_LE(accounting.core_nanos() + accounting.handler_nanos(), elapsed);
+}
+
+TEST_F(CallCpuAccountingTest, NotAddedUnlessEnabled) {
+  FakeStatsPluginBuilder().BuildAndRegister();
+  auto stats_plugins =
+      GlobalStatsPluginRegistry::GetStatsPluginsForServer(ChannelArgs());
+  MaybeAddCallCpuAccounting(stats_plugins, arena_.get());
+  EXPECT_EQ(arena_->GetContext<CallCpuAccounting>(), nullptr);
+  EXPECT_EQ(arena_->GetContext<CallTracerAnnotationInterface>(), nullptr);
+}
+
+TEST_F(CallCpuAccountingTest, RecordsHistogramsAtEnd) {
+  auto plugin = FakeStatsPluginBuilder()
+                    .UseDisabledByDefaultMetrics(true)
+                    .BuildAndRegister();
+  auto stats_plugins =
+      GlobalStatsPluginRegistry::GetStatsPluginsForServer(ChannelArgs());
+  MaybeAddCallCpuAccounting(stats_plugins, arena_.get());
+  auto* accounting = arena_->GetContext<CallCpuAccounting>();
+  ASSERT_NE(accounting, nullptr);
+  auto* call_tracer = DownCast<ServerCallTracer*>(
+      arena_->GetContext<CallTracerAnnotationInterface>());
+  ASSERT_NE(call_tracer, nullptr);
+  // The method is not registered, so it is recorded as "other".
+  grpc_metadata_batch metadata;
+  metadata.Set(HttpPathMetadata(), Slice::FromStaticString("/foo/bar"));
+  call_tracer->RecordReceivedInitialMetadata(&metadata);
+  {
+    CallCpuAccounting::Scope scope(accounting,
+                                   CallCpuAccounting::Phase::kCore);
+    BurnCpu(1000000);
+  }
+  call_tracer->RecordEnd(nullptr);
+  auto core_handle =
+      GlobalInstrumentsRegistryTestPeer::FindDoubleHistogramHandleByName(
+          "grpc.server.call.core_cpu_time");
+  ASSERT_TRUE(core_handle.has_value());
+  EXPECT_THAT(plugin->GetDoubleHistogramValue(*core_handle, {"other"}, {}),
+              Optional(ElementsAre(Gt(0.0))));
+  auto handler_handle =
+      GlobalInstrumentsRegistryTestPeer::FindDoubleHistogramHandleByName(
+          "grpc.server.call.handler_cpu_time");
+  ASSERT_TRUE(handler_handle.has_value());
+  EXPECT_THAT(plugin->GetDoubleHistogramValue(*handler_handle, {"other"}, {}),
+              Optional(ElementsAre(0.0)));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
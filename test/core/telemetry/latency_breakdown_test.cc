@@ -0,0 +1,181 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/telemetry/latency_breakdown.h"
+
+#include <memory>
+#include <optional>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/down_cast.h"
+#include "test/core/test_util/fake_stats_plugin.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using experimental::StatsPluginChannelScope;
+using ::testing::Each;
+using ::testing::Ge;
+using ::testing::Optional;
+using ::testing::SizeIs;
+
+class LatencyBreakdownTest : public ::testing::Test {
+ protected:
+  LatencyBreakdownTest() : endpoint_config_(ChannelArgs()) {}
+
+  void TearDown() override {
+    GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+  }
+
+  GlobalStatsPluginRegistry::StatsPluginGroup ChannelStatsPlugins() {
+    return GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+        StatsPluginChannelScope("dns:///localhost", "", endpoint_config_));
+  }
+
+  // Returns the values recorded by \a plugin to the histogram named \a name.
+  static std::optional<std::vector<double>> Values(FakeStatsPlugin& plugin,
+                                                   absl::string_view name) {
+    auto handle =
+        GlobalInstrumentsRegistryTestPeer::FindDoubleHistogramHandleByName(
+            name);
+    if (!handle.has_value()) return std::nullopt;
+    return plugin.GetDoubleHistogramValue(*handle, {}, {});
+  }
+
+  grpc_event_engine::experimental::ChannelArgsEndpointConfig endpoint_config_;
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+};
+
+TEST_F(LatencyBreakdownTest, NotAddedUnlessEnabled) {
+  FakeStatsPluginBuilder().BuildAndRegister();
+  auto client_plugins = ChannelStatsPlugins();
+  MaybeAddLatencyBreakdownClientCallTracer(client_plugins, arena_.get());
+  auto server_plugins =
+      GlobalStatsPluginRegistry::GetStatsPluginsForServer(ChannelArgs());
+  MaybeAddLatencyBreakdownServerCallTracer(server_plugins, arena_.get());
+  EXPECT_EQ(arena_->GetContext<CallTracerAnnotationInterface>(), nullptr);
+}
+
+TEST_F(LatencyBreakdownTest, ClientStages) {
+  auto plugin = FakeStatsPluginBuilder()
+                    .UseDisabledByDefaultMetrics(true)
+                    .BuildAndRegister();
+  auto stats_plugins = ChannelStatsPlugins();
+  MaybeAddLatencyBreakdownClientCallTracer(stats_plugins, arena_.get());
+  auto* call_tracer = DownCast<ClientCallTracer*>(
+      arena_->GetContext<CallTracerAnnotationInterface>());
+  ASSERT_NE(call_tracer, nullptr);
+  auto* attempt_tracer = call_tracer->StartNewAttempt(false);
+  EXPECT_THAT(Values(*plugin, "grpc.client.call.setup_duration"),
+              Optional(SizeIs(1)));
+  attempt_tracer->RecordAnnotation(kDelayedLbPickCompleteAnnotation);
+  grpc_metadata_batch send_initial_metadata;
+  attempt_tracer->RecordSendInitialMetadata(&send_initial_metadata);
+  auto tcp_tracer = attempt_tracer->StartNewTcpTrace();
+  ASSERT_NE(tcp_tracer, nullptr);
+  absl::Time handed_to_transport = absl::Now();
+  tcp_tracer->RecordEvent(TcpTracerInterface::Type::kSendMsg,
+                          handed_to_transport + absl::Seconds(1), 0,
+                          std::nullopt);
+  tcp_tracer->RecordEvent(TcpTracerInterface::Type::kSent,
+                          handed_to_transport + absl::Seconds(3), 0,
+                          std::nullopt);
+  // Only the first byte of the attempt matters.
+  tcp_tracer->RecordEvent(TcpTracerInterface::Type::kSent,
+                          handed_to_transport + absl::Seconds(10), 100,
+                          std::nullopt);
+  attempt_tracer->RecordReceivedTrailingMetadata(absl::OkStatus(), nullptr,
+                                                 nullptr);
+  attempt_tracer->RecordEnd(gpr_timespec());
+  EXPECT_THAT(Values(*plugin, "grpc.client.attempt.pick_duration"),
+              Optional(SizeIs(1)));
+  EXPECT_THAT(Values(*plugin, "grpc.client.attempt.response_duration"),
+              Optional(SizeIs(1)));
+  auto write_queue =
+      Values(*plugin, "grpc.client.attempt.write_queue_duration");
+  ASSERT_THAT(write_queue, Optional(SizeIs(1)));
+  EXPECT_GE((*write_queue)[0], 1.0);
+  EXPECT_LT((*write_queue)[0], 1.5);
+  EXPECT_THAT(Values(*plugin, "grpc.client.attempt.wire_duration"),
+              Optional(::testing::ElementsAre(2.0)));
+}
+
+TEST_F(LatencyBreakdownTest, ClientStagesWithoutTcpTimestamps) {
+  auto plugin = FakeStatsPluginBuilder()
+                    .UseDisabledByDefaultMetrics(true)
+                    .BuildAndRegister();
+  auto stats_plugins = ChannelStatsPlugins();
+  MaybeAddLatencyBreakdownClientCallTracer(stats_plugins, arena_.get());
+  auto* attempt_tracer =
+      DownCast<ClientCallTracer*>(
+          arena_->GetContext<CallTracerAnnotationInterface>())
+          ->StartNewAttempt(false);
+  grpc_metadata_batch send_initial_metadata;
+  attempt_tracer->RecordSendInitialMetadata(&send_initial_metadata);
+  attempt_tracer->RecordReceivedTrailingMetadata(absl::OkStatus(), nullptr,
+                                                 nullptr);
+  attempt_tracer->RecordEnd(gpr_timespec());
+  // The pick was not delayed.
+  EXPECT_THAT(Values(*plugin, "grpc.client.attempt.pick_duration"),
+              Optional(::testing::ElementsAre(0.0)));
+  EXPECT_THAT(Values(*plugin, "grpc.client.attempt.response_duration"),
+              Optional(Each(Ge(0.0))));
+  EXPECT_EQ(Values(*plugin, "grpc.client.attempt.write_queue_duration"),
+            std::nullopt);
+  EXPECT_EQ(Values(*plugin, "grpc.client.attempt.wire_duration"),
+            std::nullopt);
+}
+
+TEST_F(LatencyBreakdownTest, ServerStages) {
+  auto plugin = FakeStatsPluginBuilder()
+                    .UseDisabledByDefaultMetrics(true)
+                    .BuildAndRegister();
+  auto stats_plugins =
+      GlobalStatsPluginRegistry::GetStatsPluginsForServer(ChannelArgs());
+  MaybeAddLatencyBreakdownServerCallTracer(stats_plugins, arena_.get());
+  auto* call_tracer = DownCast<ServerCallTracer*>(
+      arena_->GetContext<CallTracerAnnotationInterface>());
+  ASSERT_NE(call_tracer, nullptr);
+  grpc_metadata_batch metadata;
+  call_tracer->RecordReceivedInitialMetadata(&metadata);
+  EXPECT_THAT(Values(*plugin, "grpc.server.call.filter_duration"),
+              Optional(SizeIs(1)));
+  EXPECT_EQ(Values(*plugin, "grpc.server.call.handler_duration"),
+            std::nullopt);
+  call_tracer->RecordSendTrailingMetadata(&metadata);
+  EXPECT_THAT(Values(*plugin, "grpc.server.call.handler_duration"),
+              Optional(SizeIs(1)));
+  call_tracer->RecordEnd(nullptr);
+  EXPECT_THAT(Values(*plugin, "grpc.server.call.write_duration"),
+              Optional(SizeIs(1)));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -634,6 +634,81 @@ TEST_F(MetricsTest, DisableByDefaultMetricIsNotRecordedByFakeStatsPlugin) {
             std::nullopt);
 }
 
+TEST_F(MetricsTest, PreAggregatedUInt64Counter) {
+  auto uint64_counter_handle =
+      GlobalInstrumentsRegistry::RegisterUInt64Counter(
+          "uint64_counter", "A simple uint64 counter.", "unit", true)
+          .Labels("label_key_1", "label_key_2")
+          .OptionalLabels("optional_label_key_1")
+          .Build();
+  std::array<absl::string_view, 2> kLabelValues = {"label_value_1",
+                                                   "label_value_2"};
+  std::array<absl::string_view, 1> kOptionalLabelValues = {
+      "optional_label_value_1"};
+  constexpr absl::string_view kDomain = "domain1.domain2";
+  auto aggregating_plugin =
+      FakeStatsPluginBuilder().UsePreAggregation(true).BuildAndRegister();
+  auto plugin = FakeStatsPluginBuilder().BuildAndRegister();
+  auto stats_plugin_group =
+      GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+          StatsPluginChannelScope(kDomain, "", endpoint_config_));
+  auto metric = stats_plugin_group.BindLabels(
+      uint64_counter_handle, kLabelValues, kOptionalLabelValues);
+  EXPECT_EQ(aggregating_plugin->NumPreAggregatedMetrics(), 1);
+  EXPECT_EQ(plugin->NumPreAggregatedMetrics(), 0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&metric] {
+      for (int j = 0; j < 1000; ++j) metric->Add(uint64_t(1));
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(metric->UInt64CounterValue(), 8000);
+  // The plugin that does not read pre-aggregated metrics got every addition.
+  EXPECT_THAT(plugin->GetUInt64CounterValue(uint64_counter_handle, kLabelValues,
+                                            kOptionalLabelValues),
+              ::testing::Optional(8000));
+  // The other one only sees the total when it collects.
+  EXPECT_EQ(aggregating_plugin->GetUInt64CounterValue(
+                uint64_counter_handle, kLabelValues, kOptionalLabelValues),
+            std::nullopt);
+  aggregating_plugin->CollectPreAggregatedMetrics();
+  EXPECT_THAT(aggregating_plugin->GetUInt64CounterValue(
+                  uint64_counter_handle, kLabelValues, kOptionalLabelValues),
+              ::testing::Optional(8000));
+  metric.reset();
+  EXPECT_EQ(aggregating_plugin->NumPreAggregatedMetrics(), 0);
+}
+
+TEST_F(MetricsTest, PreAggregatedDoubleHistogram) {
+  auto double_histogram_handle =
+      GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+          "double_histogram", "A simple double histogram.", "unit", true)
+          .Labels("label_key_1")
+          .Build();
+  std::array<absl::string_view, 1> kLabelValues = {"label_value_1"};
+  constexpr absl::string_view kDomain = "domain1.domain2";
+  auto aggregating_plugin =
+      FakeStatsPluginBuilder().UsePreAggregation(true).BuildAndRegister();
+  auto stats_plugin_group =
+      GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+          StatsPluginChannelScope(kDomain, "", endpoint_config_));
+  constexpr double kBoundaries[] = {1, 10, 100};
+  auto metric = stats_plugin_group.BindLabels(double_histogram_handle,
+                                              kLabelValues, {}, kBoundaries);
+  for (double value : {0.5, 1.0, 5.0, 50.0, 500.0, 5000.0}) {
+    metric->Record(value);
+  }
+  auto data = metric->GetHistogramData();
+  EXPECT_THAT(data.bucket_boundaries, ::testing::ElementsAre(1, 10, 100));
+  EXPECT_THAT(data.bucket_counts, ::testing::ElementsAre(2, 1, 1, 2));
+  EXPECT_EQ(data.count, 6);
+  EXPECT_DOUBLE_EQ(data.sum, 5556.5);
+  EXPECT_EQ(aggregating_plugin->GetDoubleHistogramValue(
+                double_histogram_handle, kLabelValues, {}),
+            std::nullopt);
+}
+
 TEST_F(MetricsTest, FindInstrumentByName) {
   auto uint64_counter_handle =
       GlobalInstrumentsRegistry::RegisterUInt64Counter(
@@ -0,0 +1,191 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/telemetry/slow_call_capture.h"
+
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/transport/message.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/down_cast.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::Contains;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using ::testing::SizeIs;
+
+class FakeSlowCallSink final : public SlowCallSink {
+ public:
+  void OnSlowCall(Report report) override {
+    MutexLock lock(&mu_);
+    reports_.push_back(std::move(report));
+  }
+
+  std::vector<Report> reports() {
+    MutexLock lock(&mu_);
+    return std::move(reports_);
+  }
+
+ private:
+  Mutex mu_;
+  std::vector<Report> reports_ ABSL_GUARDED_BY(mu_);
+};
+
+Message MakeMessage(absl::string_view payload) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(payload));
+  return Message(std::move(buffer), 0);
+}
+
+class SlowCallCaptureTest : public ::testing::Test {
+ protected:
+  void TearDown() override { SetSlowCallSink(nullptr, Duration::Zero()); }
+
+  std::shared_ptr<FakeSlowCallSink> sink_ =
+      std::make_shared<FakeSlowCallSink>();
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+};
+
+TEST_F(SlowCallCaptureTest, NotAddedWithoutSink) {
+  MaybeAddSlowCallCaptureServerCallTracer(arena_.get());
+  MaybeAddSlowCallCaptureClientCallTracer(Slice::FromStaticString("/foo/bar"),
+                                          arena_.get());
+  EXPECT_EQ(arena_->GetContext<CallTracerAnnotationInterface>(), nullptr);
+}
+
+TEST_F(SlowCallCaptureTest, ReportsSlowServerCall) {
+  SetSlowCallSink(sink_, Duration::Zero());
+  MaybeAddSlowCallCaptureServerCallTracer(arena_.get());
+  auto* call_tracer = DownCast<ServerCallTracer*>(
+      arena_->GetContext<CallTracerAnnotationInterface>());
+  ASSERT_NE(call_tracer, nullptr);
+  grpc_metadata_batch metadata;
+  metadata.Set(HttpPathMetadata(), Slice::FromStaticString("/foo/bar"));
+  metadata.Set(PeerString(), Slice::FromStaticString("ipv4:127.0.0.1:1234"));
+  call_tracer->RecordReceivedInitialMetadata(&metadata);
+  call_tracer->RecordReceivedMessage(MakeMessage("hello"));
+  call_tracer->RecordAnnotation("handler started");
+  CallTracerInterface::TransportByteSize bytes;
+  bytes.data_bytes = 5;
+  bytes.framing_bytes = 9;
+  call_tracer->RecordIncomingBytes(bytes);
+  grpc_call_final_info final_info;
+  final_info.final_status = GRPC_STATUS_UNAVAILABLE;
+  call_tracer->RecordEnd(&final_info);
+  auto reports = sink_->reports();
+  ASSERT_THAT(reports, SizeIs(1));
+  const auto& report = reports[0];
+  EXPECT_FALSE(report.is_client);
+  EXPECT_EQ(report.method, "/foo/bar");
+  EXPECT_EQ(report.peer, "ipv4:127.0.0.1:1234");
+  EXPECT_EQ(report.status.code(), absl::StatusCode::kUnavailable);
+  EXPECT_EQ(report.incoming_bytes, 14);
+  EXPECT_EQ(report.outgoing_bytes, 0);
+  EXPECT_THAT(
+      report.events,
+      ElementsAre(Field(&SlowCallSink::Event::description,
+                        "received initial metadata"),
+                  Field(&SlowCallSink::Event::description,
+                        "received message (5 bytes)"),
+                  Field(&SlowCallSink::Event::description, "handler started"),
+                  Field(&SlowCallSink::Event::description, "ended")));
+  EXPECT_EQ(report.dropped_events, 0);
+}
+
+TEST_F(SlowCallCaptureTest, DoesNotReportFastCall) {
+  SetSlowCallSink(sink_, Duration::Hours(1));
+  MaybeAddSlowCallCaptureServerCallTracer(arena_.get());
+  auto* call_tracer = DownCast<ServerCallTracer*>(
+      arena_->GetContext<CallTracerAnnotationInterface>());
+  ASSERT_NE(call_tracer, nullptr);
+  call_tracer->RecordAnnotation("handler started");
+  call_tracer->RecordEnd(nullptr);
+  EXPECT_THAT(sink_->reports(), IsEmpty());
+}
+
+TEST_F(SlowCallCaptureTest, ReportsAllAttemptsOfClientCall) {
+  SetSlowCallSink(sink_, Duration::Zero());
+  MaybeAddSlowCallCaptureClientCallTracer(Slice::FromStaticString("/foo/bar"),
+                                          arena_.get());
+  auto* call_tracer = DownCast<ClientCallTracer*>(
+      arena_->GetContext<CallTracerAnnotationInterface>());
+  ASSERT_NE(call_tracer, nullptr);
+  auto* first = call_tracer->StartNewAttempt(/*is_transparent_retry=*/false);
+  first->RecordSendMessage(MakeMessage("hi"));
+  first->RecordReceivedTrailingMetadata(absl::UnavailableError("gone"),
+                                        nullptr, nullptr);
+  first->RecordEnd(gpr_time_0(GPR_TIMESPAN));
+  auto* second = call_tracer->StartNewAttempt(/*is_transparent_retry=*/true);
+  second->RecordReceivedTrailingMetadata(absl::OkStatus(), nullptr, nullptr);
+  second->RecordEnd(gpr_time_0(GPR_TIMESPAN));
+  // The call is only reported once no more attempts can be started.
+  EXPECT_THAT(sink_->reports(), IsEmpty());
+  arena_.reset();
+  auto reports = sink_->reports();
+  ASSERT_THAT(reports, SizeIs(1));
+  const auto& report = reports[0];
+  EXPECT_TRUE(report.is_client);
+  EXPECT_EQ(report.method, "/foo/bar");
+  EXPECT_TRUE(report.status.ok());
+  EXPECT_THAT(report.events,
+              Contains(Field(&SlowCallSink::Event::description,
+                             "attempt 0: sent message (2 bytes)")));
+  EXPECT_THAT(report.events,
+              Contains(Field(&SlowCallSink::Event::description,
+                             HasSubstr("attempt 0: received trailing "
+                                       "metadata: UNAVAILABLE:gone"))));
+  EXPECT_THAT(report.events,
+              Contains(Field(&SlowCallSink::Event::description,
+                             "started attempt 1 (transparent retry)")));
+}
+
+TEST_F(SlowCallCaptureTest, CountsDroppedEvents) {
+  SetSlowCallSink(sink_, Duration::Zero());
+  MaybeAddSlowCallCaptureServerCallTracer(arena_.get());
+  auto* call_tracer = DownCast<ServerCallTracer*>(
+      arena_->GetContext<CallTracerAnnotationInterface>());
+  ASSERT_NE(call_tracer, nullptr);
+  for (int i = 0; i < 100; ++i) {
+    call_tracer->RecordReceivedMessage(MakeMessage("x"));
+  }
+  call_tracer->RecordEnd(nullptr);
+  auto reports = sink_->reports();
+  ASSERT_THAT(reports, SizeIs(1));
+  EXPECT_THAT(reports[0].events, SizeIs(64));
+  EXPECT_EQ(reports[0].dropped_events, 37);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -51,6 +51,23 @@ TEST(StatsTest, IncSpecificCounter) {
   EXPECT_EQ(snapshot->delta()->client_calls_created, 1);
 }
 
+TEST(StatsTest, DeltaOnlyReportsNewIncrements) {
+  GlobalStatsDelta delta;
+  ExecCtx exec_ctx;
+  global_stats().IncrementClientCallsCreated();
+  global_stats().IncrementCallFinalSize(1024);
+  auto first = delta.Delta();
+  EXPECT_EQ(first->client_calls_created, 1);
+  EXPECT_EQ(first->histogram(GlobalStats::Histogram::kCallFinalSize).Count(),
+            1);
+  global_stats().IncrementClientCallsCreated();
+  global_stats().IncrementClientCallsCreated();
+  auto second = delta.Delta();
+  EXPECT_EQ(second->client_calls_created, 2);
+  EXPECT_EQ(second->histogram(GlobalStats::Histogram::kCallFinalSize).Count(),
+            0);
+}
+
 TEST(StatsTest, IncrementHttp2MetadataSize) {
   ExecCtx exec_ctx;
   global_stats().IncrementHttp2MetadataSize(0);
@@ -0,0 +1,183 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test/core/test_util/emulated_link_endpoint.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// An Ethernet-sized TCP segment.
+constexpr size_t kSegmentBytes = 1448;
+// Segments reach the reader in batches of up to this many bytes, all at the
+// arrival time of the batch's last segment, to keep the number of timers down.
+constexpr size_t kBatchBytes = 64 * 1024;
+// Timers may fire this early.
+constexpr auto kTimerSlack = std::chrono::milliseconds(1);
+
+}  // namespace
+
+EmulatedLinkEndpoint::Direction::Direction(const LinkConfig& config, int port,
+                                           uint32_t seed)
+    : config(config),
+      address(URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", port))
+                  .value()),
+      rng(seed),
+      link_free_at(Clock::now()),
+      last_arrival(link_free_at) {}
+
+EmulatedLinkEndpoint::EmulatedLinkEndpointPair
+EmulatedLinkEndpoint::MakeEmulatedLinkEndpointPair(const LinkConfig& config) {
+  auto to_server = grpc_core::MakeRefCounted<Direction>(config, 1, config.seed);
+  auto to_client =
+      grpc_core::MakeRefCounted<Direction>(config, 2, config.seed + 1);
+  auto client = std::unique_ptr<EmulatedLinkEndpoint>(
+      new EmulatedLinkEndpoint(to_server, to_client));
+  auto server = std::unique_ptr<EmulatedLinkEndpoint>(
+      new EmulatedLinkEndpoint(to_client, to_server));
+  return {std::move(client), std::move(server)};
+}
+
+EmulatedLinkEndpoint::~EmulatedLinkEndpoint() {
+  send_->Close();
+  recv_->Close();
+}
+
+bool EmulatedLinkEndpoint::Read(absl::AnyInvocable<void(absl::Status)> on_read,
+                                SliceBuffer* buffer, const ReadArgs*) {
+  grpc_core::MutexLock lock(&recv_->mu);
+  if (recv_->closed) {
+    recv_->event_engine->Run([on_read = std::move(on_read)]() mutable {
+      on_read(absl::CancelledError());
+    });
+    return false;
+  }
+  if (recv_->arrived.Length() > 0) {
+    buffer->Clear();
+    buffer->Swap(recv_->arrived);
+    return true;
+  }
+  recv_->read_buffer = buffer;
+  recv_->on_read = std::move(on_read);
+  return false;
+}
+
+bool EmulatedLinkEndpoint::Write(
+    absl::AnyInvocable<void(absl::Status)> on_write, SliceBuffer* buffer,
+    const WriteArgs*) {
+  const Clock::time_point now = Clock::now();
+  const LinkConfig& config = send_->config;
+  auto link_time = [&config](size_t bytes) {
+    return std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(bytes / config.bytes_per_second));
+  };
+  grpc_core::MutexLock lock(&send_->mu);
+  if (send_->closed) {
+    send_->event_engine->Run([on_write = std::move(on_write)]() mutable {
+      on_write(absl::CancelledError());
+    });
+    return false;
+  }
+  std::bernoulli_distribution lost(config.loss);
+  send_->link_free_at = std::max(send_->link_free_at, now);
+  SliceBuffer batch;
+  while (buffer->Length() > 0) {
+    const size_t n = std::min(kSegmentBytes, buffer->Length());
+    buffer->MoveFirstNBytesIntoSliceBuffer(n, batch);
+    send_->link_free_at += link_time(n);
+    Clock::time_point arrival = send_->link_free_at + config.rtt / 2;
+    if (lost(send_->rng)) {
+      send_->link_free_at += link_time(n);
+      arrival += config.rtt;
+    }
+    send_->last_arrival = std::max(send_->last_arrival, arrival);
+    if (batch.Length() >= kBatchBytes || buffer->Length() == 0) {
+      send_->in_flight.push_back({send_->last_arrival, std::move(batch)});
+      send_->event_engine->RunAfter(
+          send_->last_arrival - now,
+          [direction = send_->Ref(), due = send_->last_arrival]() {
+            direction->Deliver(due);
+          });
+    }
+  }
+  const Clock::time_point done =
+      send_->link_free_at - link_time(config.send_buffer_bytes);
+  if (done <= now) return true;
+  send_->on_write = std::move(on_write);
+  send_->event_engine->RunAfter(done - now, [direction = send_->Ref()]() {
+    absl::AnyInvocable<void(absl::Status)> on_write;
+    {
+      grpc_core::MutexLock lock(&direction->mu);
+      on_write = std::exchange(direction->on_write, nullptr);
+    }
+    if (on_write != nullptr) on_write(absl::OkStatus());
+  });
+  return false;
+}
+
+void EmulatedLinkEndpoint::Direction::Deliver(Clock::time_point due) {
+  absl::AnyInvocable<void(absl::Status)> callback;
+  {
+    grpc_core::MutexLock lock(&mu);
+    if (closed) return;
+    const Clock::time_point now = Clock::now() + kTimerSlack;
+    if (due > now) {
+      event_engine->RunAfter(due - now, [direction = Ref(), due]() {
+        direction->Deliver(due);
+      });
+      return;
+    }
+    while (!in_flight.empty() && in_flight.front().arrival <= now) {
+      SliceBuffer& data = in_flight.front().data;
+      data.MoveFirstNBytesIntoSliceBuffer(data.Length(), arrived);
+      in_flight.pop_front();
+    }
+    if (arrived.Length() == 0 || on_read == nullptr) return;
+    read_buffer->Clear();
+    read_buffer->Swap(arrived);
+    read_buffer = nullptr;
+    callback = std::exchange(on_read, nullptr);
+  }
+  callback(absl::OkStatus());
+}
+
+void EmulatedLinkEndpoint::Direction::Close() {
+  absl::AnyInvocable<void(absl::Status)> read_callback;
+  absl::AnyInvocable<void(absl::Status)> write_callback;
+  {
+    grpc_core::MutexLock lock(&mu);
+    closed = true;
+    in_flight.clear();
+    arrived.Clear();
+    read_buffer = nullptr;
+    read_callback = std::exchange(on_read, nullptr);
+    write_callback = std::exchange(on_write, nullptr);
+  }
+  for (auto* callback : {&read_callback, &write_callback}) {
+    if (*callback == nullptr) continue;
+    event_engine->Run([callback = std::move(*callback)]() mutable {
+      callback(absl::CancelledError());
+    });
+  }
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
@@ -0,0 +1,127 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_TEST_CORE_TEST_UTIL_EMULATED_LINK_ENDPOINT_H
+#define GRPC_TEST_CORE_TEST_UTIL_EMULATED_LINK_ENDPOINT_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// A pair of connected in-memory endpoints that behave like the two ends of a
+// network link with limited bandwidth, a round trip time, and packet loss,
+// for measuring how well a transport keeps such a link busy.
+//
+// Writes are cut into segments that go out back to back at the link rate,
+// and each arrives half a round trip after it went out. A lost segment costs
+// link time twice and arrives one round trip late, as after a fast
+// retransmit; like TCP, it holds up everything written after it. A write
+// completes once what is left of it to send fits in the send buffer.
+// Congestion control is not emulated. Delays are real time, and as precise
+// as EventEngine timers (about a millisecond).
+class EmulatedLinkEndpoint final : public EventEngine::Endpoint {
+ public:
+  struct LinkConfig {
+    // Capacity of the link, in each direction.
+    double bytes_per_second = 125e6;
+    std::chrono::nanoseconds rtt = std::chrono::milliseconds(1);
+    // Fraction of segments lost.
+    double loss = 0;
+    // Bytes a writer may have queued on the link before its write blocks.
+    size_t send_buffer_bytes = 4 * 1024 * 1024;
+    // Seeds the loss pattern, so runs can be repeated.
+    uint32_t seed = 1;
+  };
+
+  struct EmulatedLinkEndpointPair {
+    std::unique_ptr<EmulatedLinkEndpoint> client;
+    std::unique_ptr<EmulatedLinkEndpoint> server;
+  };
+  static EmulatedLinkEndpointPair MakeEmulatedLinkEndpointPair(
+      const LinkConfig& config);
+
+  ~EmulatedLinkEndpoint() override;
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read, SliceBuffer* buffer,
+            const ReadArgs* args) override;
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_write,
+             SliceBuffer* buffer, const WriteArgs* args) override;
+
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return recv_->address;
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return send_->address;
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // One direction of the link.
+  struct Direction : public grpc_core::RefCounted<Direction> {
+    Direction(const LinkConfig& config, int port, uint32_t seed);
+
+    // Moves what has arrived by now to the reader. Called by the timer of the
+    // batch due at due.
+    void Deliver(Clock::time_point due);
+    void Close();
+
+    const LinkConfig config;
+    const std::shared_ptr<EventEngine> event_engine = GetDefaultEventEngine();
+    EventEngine::ResolvedAddress address;
+
+    grpc_core::Mutex mu;
+    bool closed ABSL_GUARDED_BY(mu) = false;
+    std::mt19937 rng ABSL_GUARDED_BY(mu);
+    // When the link is done sending everything written so far.
+    Clock::time_point link_free_at ABSL_GUARDED_BY(mu);
+    // When the last segment written so far arrives.
+    Clock::time_point last_arrival ABSL_GUARDED_BY(mu);
+    struct InFlight {
+      Clock::time_point arrival;
+      SliceBuffer data;
+    };
+    std::deque<InFlight> in_flight ABSL_GUARDED_BY(mu);
+    SliceBuffer arrived ABSL_GUARDED_BY(mu);
+    SliceBuffer* read_buffer ABSL_GUARDED_BY(mu) = nullptr;
+    absl::AnyInvocable<void(absl::Status)> on_read ABSL_GUARDED_BY(mu);
+    absl::AnyInvocable<void(absl::Status)> on_write ABSL_GUARDED_BY(mu);
+  };
+
+  EmulatedLinkEndpoint(grpc_core::RefCountedPtr<Direction> send,
+                       grpc_core::RefCountedPtr<Direction> recv)
+      : send_(std::move(send)), recv_(std::move(recv)) {}
+
+  grpc_core::RefCountedPtr<Direction> send_;
+  grpc_core::RefCountedPtr<Direction> recv_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_TEST_CORE_TEST_UTIL_EMULATED_LINK_ENDPOINT_H
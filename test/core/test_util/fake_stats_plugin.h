@@ -216,9 +216,11 @@ class FakeStatsPlugin : public StatsPlugin {
       absl::AnyInvocable<
           bool(const experimental::StatsPluginChannelScope& /*scope*/) const>
           channel_filter = nullptr,
-      bool use_disabled_by_default_metrics = false)
+      bool use_disabled_by_default_metrics = false,
+      bool use_pre_aggregation = false)
       : channel_filter_(std::move(channel_filter)),
-        use_disabled_by_default_metrics_(use_disabled_by_default_metrics) {
+        use_disabled_by_default_metrics_(use_disabled_by_default_metrics),
+        use_pre_aggregation_(use_pre_aggregation) {
     GlobalInstrumentsRegistry::ForEach(
         [&](const GlobalInstrumentsRegistry::GlobalInstrumentDescriptor&
                 descriptor) {
@@ -361,6 +363,20 @@ class FakeStatsPlugin : public StatsPlugin {
     MutexLock lock(&callback_mu_);
     callbacks_.erase(callback);
   }
+  bool AddPreAggregatedMetric(PreAggregatedMetric* metric) override {
+    VLOG(2) << "FakeStatsPlugin[" << this << "]::AddPreAggregatedMetric("
+            << metric << ")";
+    if (!use_pre_aggregation_) return false;
+    MutexLock lock(&mu_);
+    pre_aggregated_metrics_.insert(metric);
+    return true;
+  }
+  void RemovePreAggregatedMetric(PreAggregatedMetric* metric) override {
+    VLOG(2) << "FakeStatsPlugin[" << this << "]::RemovePreAggregatedMetric("
+            << metric << ")";
+    MutexLock lock(&mu_);
+    pre_aggregated_metrics_.erase(metric);
+  }
 
   ClientCallTracer* GetClientCallTracer(
       const Slice& /*path*/, bool /*registered_method*/,
@@ -431,6 +447,26 @@ class FakeStatsPlugin : public StatsPlugin {
     }
     VLOG(2) << "FakeStatsPlugin[" << this << "]::TriggerCallbacks(): END";
   }
+  // Sets the counters bound with pre-aggregation to their current totals.
+  // Histograms are left to be read from the metrics themselves.
+  void CollectPreAggregatedMetrics() {
+    MutexLock lock(&mu_);
+    for (PreAggregatedMetric* metric : pre_aggregated_metrics_) {
+      if (auto iter = uint64_counters_.find(metric->handle().index);
+          iter != uint64_counters_.end()) {
+        iter->second.Set(metric->UInt64CounterValue(), metric->label_values(),
+                         metric->optional_label_values());
+      } else if (auto iter = double_counters_.find(metric->handle().index);
+                 iter != double_counters_.end()) {
+        iter->second.Set(metric->DoubleCounterValue(), metric->label_values(),
+                         metric->optional_label_values());
+      }
+    }
+  }
+  size_t NumPreAggregatedMetrics() {
+    MutexLock lock(&mu_);
+    return pre_aggregated_metrics_.size();
+  }
   std::optional<int64_t> GetInt64CallbackGaugeValue(
       GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
       absl::Span<const absl::string_view> label_values,
@@ -517,6 +553,12 @@ class FakeStatsPlugin : public StatsPlugin {
       }
     }
 
+    void Set(T t, absl::Span<const absl::string_view> label_values,
+             absl::Span<const absl::string_view> optional_values) {
+      storage_[MakeLabelString(label_keys_, label_values, optional_label_keys_,
+                               optional_values)] = t;
+    }
+
     std::optional<T> GetValue(
         absl::Span<const absl::string_view> label_values,
         absl::Span<const absl::string_view> optional_values) {
@@ -620,6 +662,7 @@ class FakeStatsPlugin : public StatsPlugin {
       const experimental::StatsPluginChannelScope& /*scope*/) const>
       channel_filter_;
   bool use_disabled_by_default_metrics_;
+  bool use_pre_aggregation_;
   // Instruments.
   Mutex mu_;
   absl::flat_hash_map<uint32_t, Counter<uint64_t>> uint64_counters_
@@ -630,6 +673,7 @@ class FakeStatsPlugin : public StatsPlugin {
       ABSL_GUARDED_BY(&mu_);
   absl::flat_hash_map<uint32_t, Histogram<double>> double_histograms_
       ABSL_GUARDED_BY(&mu_);
+  std::set<PreAggregatedMetric*> pre_aggregated_metrics_ ABSL_GUARDED_BY(&mu_);
   Mutex callback_mu_;
   absl::flat_hash_map<uint32_t, Gauge<int64_t>> int64_callback_gauges_
       ABSL_GUARDED_BY(&callback_mu_);
@@ -653,9 +697,15 @@ class FakeStatsPluginBuilder {
     return *this;
   }
 
+  FakeStatsPluginBuilder& UsePreAggregation(bool value) {
+    use_pre_aggregation_ = value;
+    return *this;
+  }
+
   std::shared_ptr<FakeStatsPlugin> BuildAndRegister() {
     auto f = std::make_shared<FakeStatsPlugin>(
-        std::move(channel_filter_), use_disabled_by_default_metrics_);
+        std::move(channel_filter_), use_disabled_by_default_metrics_,
+        use_pre_aggregation_);
     GlobalStatsPluginRegistry::RegisterStatsPlugin(f);
     return f;
   }
@@ -665,6 +715,7 @@ class FakeStatsPluginBuilder {
       const experimental::StatsPluginChannelScope& /*scope*/) const>
       channel_filter_;
   bool use_disabled_by_default_metrics_ = false;
+  bool use_pre_aggregation_ = false;
 };
 
 std::shared_ptr<FakeStatsPlugin> MakeStatsPluginForTarget(
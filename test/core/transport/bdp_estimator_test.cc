@@ -35,11 +35,12 @@ namespace grpc_core {
 namespace testing {
 namespace {
 std::atomic<int> g_clock{123};
+std::atomic<int> g_clock_nsec{0};
 
 gpr_timespec fake_gpr_now(gpr_clock_type clock_type) {
   gpr_timespec ts;
   ts.tv_sec = g_clock.load();
-  ts.tv_nsec = 0;
+  ts.tv_nsec = g_clock_nsec.load();
   ts.clock_type = clock_type;
   return ts;
 }
@@ -96,6 +97,56 @@ TEST(BdpEstimatorTest, GetEstimate3Samples) {
   est.EstimateBdp();
 }
 
+TEST(BdpEstimatorTest, PathModel) {
+  BdpEstimator est("test");
+  ExecCtx exec_ctx;
+  EXPECT_EQ(est.min_rtt_us(), 0);
+  EXPECT_EQ(est.PacingRate(), 0);
+  auto ping = [&est](int rtt_seconds) {
+    est.AddIncomingBytes(1);
+    est.SchedulePing();
+    est.StartPing();
+    est.AddIncomingBytes(3000000);
+    g_clock.fetch_add(rtt_seconds);
+    est.CompletePing();
+  };
+  ping(2);
+  ping(1);
+  ping(3);
+  EXPECT_EQ(est.min_rtt_us(), 1000000);
+  EXPECT_EQ(est.smoothed_rtt_us(), 2015625);
+  EXPECT_GT(est.rtt_variance_us(), 0);
+  EXPECT_EQ(est.DeliveryRate(), 3000000.0);
+  EXPECT_EQ(est.PacingRate(), 3750000.0);
+  EXPECT_EQ(est.DeliveryRateBdp(), 3000000);
+  // A stale minimum gives way to newer samples.
+  g_clock.fetch_add(30);
+  ping(3);
+  EXPECT_EQ(est.min_rtt_us(), 3000000);
+}
+
+TEST(BdpEstimatorTest, SubMillisecondRtt) {
+  BdpEstimator est("test");
+  ExecCtx exec_ctx;
+  auto ping = [&est](int rtt_us) {
+    est.AddIncomingBytes(1);
+    est.SchedulePing();
+    est.StartPing();
+    est.AddIncomingBytes(1000);
+    g_clock_nsec.fetch_add(rtt_us * 1000);
+    est.CompletePing();
+  };
+  ping(250);
+  ping(150);
+  EXPECT_EQ(est.min_rtt_us(), 150);
+  EXPECT_EQ(est.smoothed_rtt_us(), 237);
+  EXPECT_EQ(est.rtt_variance_us(), 118);
+  // 1000 bytes in 150us.
+  EXPECT_NEAR(est.DeliveryRateBdp(), 1000, 1);
+  g_clock.fetch_add(1);
+  g_clock_nsec.store(0);
+}
+
 namespace {
 int64_t NextPow2(int64_t v) {
   v--;
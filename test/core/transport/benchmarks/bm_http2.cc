@@ -0,0 +1,86 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include "src/core/ext/transport/chttp2/transport/http2_client_transport.h"
+#include "src/core/ext/transport/chttp2/transport/http2_server_transport.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "test/core/test_util/passthrough_endpoint.h"
+#include "test/core/transport/call_spine_benchmarks.h"
+
+namespace grpc_core {
+namespace {
+
+const Slice kTestPath = Slice::FromExternalString("/foo/bar");
+
+class Http2Traits {
+ public:
+  BenchmarkTransport MakeTransport() {
+    auto channel_args = CoreConfiguration::Get()
+                            .channel_args_preconditioning()
+                            .PreconditionChannelArgs(nullptr);
+    auto event_engine =
+        grpc_event_engine::experimental::GetDefaultEventEngine();
+    auto endpoints = grpc_event_engine::experimental::PassthroughEndpoint::
+        MakePassthroughEndpoint(1, 2, true);
+    auto client = MakeOrphanable<http2::Http2ClientTransport>(
+        PromiseEndpoint(std::move(endpoints.client), SliceBuffer()),
+        channel_args, event_engine);
+    auto server = MakeOrphanable<http2::Http2ServerTransport>(
+        PromiseEndpoint(std::move(endpoints.server), SliceBuffer()),
+        channel_args, event_engine);
+    return {std::move(client), std::move(server)};
+  }
+
+  ClientMetadataHandle MakeClientInitialMetadata() {
+    auto md = Arena::MakePooledForOverwrite<ClientMetadata>();
+    md->Set(HttpPathMetadata(), kTestPath.Copy());
+    return md;
+  }
+
+  ServerMetadataHandle MakeServerInitialMetadata() {
+    return Arena::MakePooledForOverwrite<ServerMetadata>();
+  }
+
+  MessageHandle MakePayload() { return Arena::MakePooled<Message>(); }
+
+  ServerMetadataHandle MakeServerTrailingMetadata() {
+    auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+    return md;
+  }
+};
+GRPC_CALL_SPINE_BENCHMARK(TransportFixture<Http2Traits>);
+GRPC_CALL_SPINE_CONCURRENCY_BENCHMARK(TransportFixture<Http2Traits>);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  {
+    auto ee = grpc_event_engine::experimental::GetDefaultEventEngine();
+    benchmark::RunTheBenchmarksNamespaced();
+  }
+  grpc_shutdown();
+  return 0;
+}
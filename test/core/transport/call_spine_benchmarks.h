@@ -15,7 +15,11 @@
 #ifndef GRPC_TEST_CORE_TRANSPORT_CALL_SPINE_BENCHMARKS_H
 #define GRPC_TEST_CORE_TRANSPORT_CALL_SPINE_BENCHMARKS_H
 
+#include <atomic>
+#include <cstddef>
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
@@ -35,61 +39,108 @@ struct BenchmarkCall {
   CallHandler handler;
 };
 
+// Notified once Done() was called count times.
+class CallsDone {
+ public:
+  explicit CallsDone(size_t count) : remaining_(count) {
+    if (count == 0) done_.Notify();
+  }
+
+  void Done() {
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      done_.Notify();
+    }
+  }
+  void Wait() { done_.WaitForNotification(); }
+
+ private:
+  std::atomic<size_t> remaining_;
+  Notification done_;
+};
+
+// Runs a unary call with one spawn on each end of the spine.
+template <typename Fixture>
+void SpawnUnaryCall(Fixture& fixture, BenchmarkCall& call,
+                    CallsDone& handler_done, CallsDone& initiator_done) {
+  call.handler.SpawnInfallible("handler", [handler = call.handler, &fixture,
+                                           &handler_done]() mutable {
+    handler.PushServerInitialMetadata(fixture.MakeServerInitialMetadata());
+    return Map(
+        AllOk<StatusFlag>(
+            Map(handler.PullClientInitialMetadata(),
+                [](ValueOrFailure<ClientMetadataHandle> md) {
+                  return md.status();
+                }),
+            Map(handler.PullMessage(),
+                [](ClientToServerNextMessage msg) { return msg.status(); }),
+            handler.PushMessage(fixture.MakePayload())),
+        [&handler_done, &fixture, handler](StatusFlag status) mutable {
+          CHECK(status.ok());
+          handler.PushServerTrailingMetadata(
+              fixture.MakeServerTrailingMetadata());
+          handler_done.Done();
+        });
+  });
+  call.initiator.SpawnInfallible("initiator", [initiator = call.initiator,
+                                               &fixture,
+                                               &initiator_done]() mutable {
+    return Map(
+        AllOk<StatusFlag>(
+            Map(initiator.PushMessage(fixture.MakePayload()),
+                [](StatusFlag) { return Success{}; }),
+            Map(initiator.PullServerInitialMetadata(),
+                [](std::optional<ServerMetadataHandle> md) {
+                  return Success{};
+                }),
+            Map(initiator.PullMessage(),
+                [](ServerToClientNextMessage msg) { return msg.status(); }),
+            Map(initiator.PullServerTrailingMetadata(),
+                [](ServerMetadataHandle) { return Success(); })),
+        [&initiator_done](StatusFlag result) {
+          CHECK(result.ok());
+          initiator_done.Done();
+        });
+  });
+}
+
 // Unary call with one spawn on each end of the spine.
 template <typename Fixture>
 void BM_UnaryWithSpawnPerEnd(benchmark::State& state) {
   Fixture fixture;
   for (auto _ : state) {
-    Notification handler_done;
-    Notification initiator_done;
+    CallsDone handler_done(1);
+    CallsDone initiator_done(1);
     {
       ExecCtx exec_ctx;
       BenchmarkCall call = fixture.MakeCall();
-      call.handler.SpawnInfallible("handler", [handler = call.handler, &fixture,
-                                               &handler_done]() mutable {
-        handler.PushServerInitialMetadata(fixture.MakeServerInitialMetadata());
-        return Map(
-            AllOk<StatusFlag>(
-                Map(handler.PullClientInitialMetadata(),
-                    [](ValueOrFailure<ClientMetadataHandle> md) {
-                      return md.status();
-                    }),
-                Map(handler.PullMessage(),
-                    [](ClientToServerNextMessage msg) { return msg.status(); }),
-                handler.PushMessage(fixture.MakePayload())),
-            [&handler_done, &fixture, handler](StatusFlag status) mutable {
-              CHECK(status.ok());
-              handler.PushServerTrailingMetadata(
-                  fixture.MakeServerTrailingMetadata());
-              handler_done.Notify();
-            });
-      });
-      call.initiator.SpawnInfallible("initiator", [initiator = call.initiator,
-                                                   &fixture,
-                                                   &initiator_done]() mutable {
-        return Map(
-            AllOk<StatusFlag>(
-                Map(initiator.PushMessage(fixture.MakePayload()),
-                    [](StatusFlag) { return Success{}; }),
-                Map(initiator.PullServerInitialMetadata(),
-                    [](std::optional<ServerMetadataHandle> md) {
-                      return Success{};
-                    }),
-                Map(initiator.PullMessage(),
-                    [](ServerToClientNextMessage msg) { return msg.status(); }),
-                Map(initiator.PullServerTrailingMetadata(),
-                    [](ServerMetadataHandle) { return Success(); })),
-            [&initiator_done](StatusFlag result) {
-              CHECK(result.ok());
-              initiator_done.Notify();
-            });
-      });
+      SpawnUnaryCall(fixture, call, handler_done, initiator_done);
     }
-    handler_done.WaitForNotification();
-    initiator_done.WaitForNotification();
+    handler_done.Wait();
+    initiator_done.Wait();
   }
 }
 
+// Unary calls, state.range(0) of them in flight at once.
+template <typename Fixture>
+void BM_ConcurrentUnary(benchmark::State& state) {
+  Fixture fixture;
+  const size_t num_calls = state.range(0);
+  for (auto _ : state) {
+    CallsDone handlers_done(num_calls);
+    CallsDone initiators_done(num_calls);
+    {
+      ExecCtx exec_ctx;
+      std::vector<BenchmarkCall> calls = fixture.MakeCalls(num_calls);
+      for (BenchmarkCall& call : calls) {
+        SpawnUnaryCall(fixture, call, handlers_done, initiators_done);
+      }
+    }
+    handlers_done.Wait();
+    initiators_done.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * num_calls);
+}
+
 template <typename Fixture>
 void BM_ClientToServerStreaming(benchmark::State& state) {
   Fixture fixture;
@@ -142,6 +193,80 @@ void BM_ClientToServerStreaming(benchmark::State& state) {
   });
 }
 
+// One message on each of state.range(0) client to server streams at once.
+template <typename Fixture>
+void BM_ConcurrentClientToServerStreaming(benchmark::State& state) {
+  Fixture fixture;
+  const size_t num_calls = state.range(0);
+  std::vector<BenchmarkCall> calls;
+  {
+    ExecCtx exec_ctx;
+    calls = fixture.MakeCalls(num_calls);
+  }
+  CallsDone handlers_metadata_done(num_calls);
+  CallsDone initiators_metadata_done(num_calls);
+  for (BenchmarkCall& call : calls) {
+    call.handler.SpawnInfallible(
+        "handler-initial-metadata",
+        [&fixture, &handlers_metadata_done, handler = call.handler]() mutable {
+          return Map(handler.PullClientInitialMetadata(),
+                     [&fixture, &handlers_metadata_done, handler](
+                         ValueOrFailure<ClientMetadataHandle> md) mutable {
+                       CHECK(md.ok());
+                       handler.PushServerInitialMetadata(
+                           fixture.MakeServerInitialMetadata());
+                       handlers_metadata_done.Done();
+                     });
+        });
+    call.initiator.SpawnInfallible(
+        "initiator-initial-metadata",
+        [&initiators_metadata_done, initiator = call.initiator]() mutable {
+          return Map(initiator.PullServerInitialMetadata(),
+                     [&initiators_metadata_done](
+                         std::optional<ServerMetadataHandle> md) {
+                       CHECK(md.has_value());
+                       initiators_metadata_done.Done();
+                     });
+        });
+  }
+  handlers_metadata_done.Wait();
+  initiators_metadata_done.Wait();
+  for (auto _ : state) {
+    CallsDone handlers_done(num_calls);
+    CallsDone initiators_done(num_calls);
+    for (BenchmarkCall& call : calls) {
+      call.handler.SpawnInfallible(
+          "handler", [&handlers_done, handler = call.handler]() mutable {
+            return Map(handler.PullMessage(),
+                       [&handlers_done](ClientToServerNextMessage msg) {
+                         CHECK(msg.ok());
+                         handlers_done.Done();
+                       });
+          });
+      call.initiator.SpawnInfallible(
+          "initiator",
+          [&fixture, &initiators_done, initiator = call.initiator]() mutable {
+            return Map(initiator.PushMessage(fixture.MakePayload()),
+                       [&initiators_done](StatusFlag result) {
+                         CHECK(result.ok());
+                         initiators_done.Done();
+                       });
+          });
+    }
+    handlers_done.Wait();
+    initiators_done.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * num_calls);
+  for (BenchmarkCall& call : calls) {
+    call.initiator.SpawnInfallible(
+        "done", [initiator = call.initiator]() mutable { initiator.Cancel(); });
+    call.handler.SpawnInfallible("done", [handler = call.handler]() mutable {
+      handler.PushServerTrailingMetadata(
+          CancelledServerMetadataFromStatus(GRPC_STATUS_CANCELLED));
+    });
+  }
+}
+
 // Base class for fixtures that wrap a single filter.
 // Traits should have MakeClientInitialMetadata, MakeServerInitialMetadata,
 // MakePayload, MakeServerTrailingMetadata, MakeChannelArgs and a type named
@@ -308,6 +433,40 @@ class TransportFixture {
     return {std::move(p.initiator), std::move(*started_handler)};
   }
 
+  // Starts n calls before waiting for any of them to reach the server, so
+  // that they are in flight on the transport together. Initiators and
+  // handlers are paired in the order the calls reach the server, which need
+  // not be the order they started in: benchmarks drive the two ends of a
+  // call independently.
+  std::vector<BenchmarkCall> MakeCalls(size_t n) {
+    std::vector<CallInitiator> initiators;
+    initiators.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      auto arena = arena_allocator_->MakeArena();
+      arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+          event_engine_.get());
+      auto p =
+          MakeCallPair(traits_.MakeClientInitialMetadata(), std::move(arena));
+      transport_.client->StartCall(p.handler.StartCall());
+      initiators.push_back(std::move(p.initiator));
+    }
+    std::vector<BenchmarkCall> calls;
+    calls.reserve(n);
+    for (CallInitiator& initiator : initiators) {
+      auto handler = acceptor_->TakeHandler();
+      std::optional<CallHandler> started_handler;
+      Notification started;
+      handler.SpawnInfallible("handler_setup", [&]() {
+        started_handler = handler.StartCall();
+        started.Notify();
+      });
+      started.WaitForNotification();
+      CHECK(started_handler.has_value());
+      calls.push_back({std::move(initiator), std::move(*started_handler)});
+    }
+    return calls;
+  }
+
   ServerMetadataHandle MakeServerInitialMetadata() {
     return traits_.MakeServerInitialMetadata();
   }
@@ -323,24 +482,24 @@ class TransportFixture {
    public:
     void StartCall(UnstartedCallHandler handler) override {
       MutexLock lock(&mu_);
-      handler_ = std::move(handler);
+      handlers_.push_back(std::move(handler));
     }
     void Orphaned() override {}
 
     UnstartedCallHandler TakeHandler() {
       mu_.LockWhen(absl::Condition(
           +[](Acceptor* dest) ABSL_EXCLUSIVE_LOCKS_REQUIRED(dest->mu_) {
-            return dest->handler_.has_value();
+            return !dest->handlers_.empty();
           },
           this));
-      auto h = std::move(*handler_);
-      handler_.reset();
+      auto h = std::move(handlers_.front());
+      handlers_.pop_front();
       mu_.Unlock();
       return h;
     }
 
     absl::Mutex mu_;
-    std::optional<UnstartedCallHandler> handler_ ABSL_GUARDED_BY(mu_);
+    std::deque<UnstartedCallHandler> handlers_ ABSL_GUARDED_BY(mu_);
   };
 
   Traits traits_;
@@ -363,4 +522,17 @@ class TransportFixture {
   BENCHMARK(BM_UnaryWithSpawnPerEnd<Fixture>); \
   BENCHMARK(BM_ClientToServerStreaming<Fixture>)
 
+// Declare benchmarks with many calls in flight at once, for fixtures that can
+// make calls in bulk (TransportFixture).
+// Must be called within the grpc_core namespace
+#define GRPC_CALL_SPINE_CONCURRENCY_BENCHMARK(Fixture)       \
+  BENCHMARK(BM_ConcurrentUnary<Fixture>)                     \
+      ->Arg(1)                                               \
+      ->Arg(100)                                             \
+      ->Arg(10000);                                          \
+  BENCHMARK(BM_ConcurrentClientToServerStreaming<Fixture>)   \
+      ->Arg(1)                                               \
+      ->Arg(100)                                             \
+      ->Arg(10000)
+
 #endif  // GRPC_TEST_CORE_TRANSPORT_CALL_SPINE_BENCHMARKS_H
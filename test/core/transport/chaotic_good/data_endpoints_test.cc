@@ -114,6 +114,27 @@ DATA_ENDPOINTS_TEST(CanRead) {
   WaitForAllPendingWork();
 }
 
+TEST(OutputBufferTest, MeasuresThroughput) {
+  chaotic_good::data_endpoints_detail::OutputBuffer buffer;
+  EXPECT_EQ(buffer.bytes_per_second(), 0);
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  SliceBuffer first(Slice::FromCopiedString(std::string(1000, 'a')));
+  EXPECT_TRUE(buffer.Accept(first));
+  EXPECT_EQ(buffer.outstanding_bytes(), 1000u);
+  buffer.TakePending(start);
+  // Bytes being written still count against the endpoint.
+  EXPECT_EQ(buffer.outstanding_bytes(), 1000u);
+  buffer.WriteCompleted(start + Duration::Seconds(1));
+  EXPECT_EQ(buffer.outstanding_bytes(), 0u);
+  EXPECT_EQ(buffer.bytes_per_second(), 1000);
+  // Later writes move the estimate part of the way.
+  SliceBuffer second(Slice::FromCopiedString(std::string(1000, 'a')));
+  EXPECT_TRUE(buffer.Accept(second));
+  buffer.TakePending(start + Duration::Seconds(2));
+  buffer.WriteCompleted(start + Duration::Milliseconds(2500));
+  EXPECT_EQ(buffer.bytes_per_second(), 1250);
+}
+
 namespace {
 yodel::Msg ParseTestProto(const std::string& text) {
   yodel::Msg msg;
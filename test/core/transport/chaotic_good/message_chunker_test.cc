@@ -89,5 +89,28 @@ void MessageChunkerTest(uint32_t max_chunk_size, uint32_t alignment,
 }
 FUZZ_TEST(MyTestSuite, MessageChunkerTest);
 
+TEST(MessageChunkerTest, OneDataEndpoint) {
+  chaotic_good::MessageChunker chunker(1024 * 1024, 64);
+  EXPECT_EQ(chunker.ChunkSize(300 * 1024), 0);
+  EXPECT_EQ(chunker.ChunkSize(1024 * 1024), 0);
+  EXPECT_EQ(chunker.ChunkSize(1536 * 1024), 768 * 1024);
+}
+
+TEST(MessageChunkerTest, SpreadsOverDataEndpoints) {
+  chaotic_good::MessageChunker chunker(1024 * 1024, 64, 4);
+  // Too small to be worth splitting.
+  EXPECT_EQ(chunker.ChunkSize(100 * 1024), 0);
+  // Split, though below the maximum chunk size, in as many chunks as there
+  // are endpoints if they would not be too small.
+  EXPECT_EQ(chunker.ChunkSize(150 * 1024), 75 * 1024);
+  EXPECT_EQ(chunker.ChunkSize(300 * 1024), 75 * 1024);
+  EXPECT_EQ(chunker.ChunkSize(4 * 1024 * 1024), 1024 * 1024);
+  // Five maximum sized chunks would leave three endpoints idle for the last
+  // one, so use eight smaller ones.
+  EXPECT_EQ(chunker.ChunkSize(5 * 1024 * 1024), 640 * 1024);
+  // Chunks keep to the alignment.
+  EXPECT_EQ(chunker.ChunkSize(300 * 1024 + 1) % 64, 0);
+}
+
 }  // namespace
 }  // namespace grpc_core
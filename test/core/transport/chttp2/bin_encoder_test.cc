@@ -24,8 +24,12 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "absl/log/log.h"
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/util/string.h"
 #include "test/core/test_util/test_config.h"
@@ -173,6 +177,87 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+// Straightforward bit at a time encoder to check the optimized one against.
+static std::vector<uint8_t> ReferenceHuffmanCompress(
+    const std::vector<uint8_t>& input) {
+  std::vector<uint8_t> output;
+  uint8_t cur = 0;
+  int nbits = 0;
+  auto push_bit = [&](bool bit) {
+    cur = static_cast<uint8_t>((cur << 1) | (bit ? 1 : 0));
+    if (++nbits == 8) {
+      output.push_back(cur);
+      cur = 0;
+      nbits = 0;
+    }
+  };
+  for (uint8_t c : input) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[c];
+    for (int i = static_cast<int>(sym.length) - 1; i >= 0; --i) {
+      push_bit((sym.bits >> i) & 1);
+    }
+  }
+  // Pad with the most significant bits of the EOS symbol (all ones).
+  while (nbits != 0) push_bit(true);
+  return output;
+}
+
+TEST(BinEncoderTest, HuffmanCompressMatchesReference) {
+  std::vector<uint8_t> input;
+  // Exercise every symbol, including the long 28 and 30 bit codes, at every
+  // alignment with respect to the four byte output batches.
+  for (int len = 0; len < 600; len++) {
+    input.push_back(static_cast<uint8_t>((len * 131) ^ (len >> 2)));
+    grpc_slice slice = grpc_slice_from_copied_buffer(
+        reinterpret_cast<const char*>(input.data()), input.size());
+    grpc_slice got = grpc_chttp2_huffman_compress(slice);
+    std::vector<uint8_t> want = ReferenceHuffmanCompress(input);
+    EXPECT_EQ(std::vector<uint8_t>(GRPC_SLICE_START_PTR(got),
+                                   GRPC_SLICE_END_PTR(got)),
+              want)
+        << "len=" << input.size();
+    EXPECT_EQ(grpc_chttp2_huffman_compressed_length(input.data(), input.size()),
+              want.size());
+    std::vector<uint8_t> into(want.size());
+    EXPECT_EQ(grpc_chttp2_huffman_compress_into(input.data(), input.size(),
+                                                into.data()),
+              into.data() + into.size());
+    EXPECT_EQ(into, want) << "len=" << input.size();
+    grpc_slice_unref(got);
+    grpc_slice_unref(slice);
+  }
+}
+
+TEST(BinEncoderTest, Base64MatchesReference) {
+  static const char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::vector<uint8_t> input;
+  // Check every tail case, and the combined encoder at every alignment of its
+  // symbols with respect to the four byte output batches.
+  for (int len = 0; len < 300; len++) {
+    std::string want;
+    for (size_t i = 0; i < input.size() * 8; i += 6) {
+      int bits = 0;
+      for (size_t j = i; j < i + 6; j++) {
+        bits <<= 1;
+        if (j < input.size() * 8) bits |= (input[j / 8] >> (7 - j % 8)) & 1;
+      }
+      want.push_back(kAlphabet[bits]);
+    }
+    grpc_slice slice = grpc_slice_from_copied_buffer(
+        reinterpret_cast<const char*>(input.data()), input.size());
+    grpc_slice got = grpc_chttp2_base64_encode(slice);
+    EXPECT_EQ(std::string(grpc_core::StringViewFromSlice(got)), want)
+        << "len=" << input.size();
+    grpc_slice_unref(got);
+    grpc_slice_unref(slice);
+    expect_combined_equiv(reinterpret_cast<const char*>(input.data()),
+                          input.size(), __LINE__);
+    input.push_back(static_cast<uint8_t>((len * 167) ^ (len >> 3)));
+  }
+  EXPECT_TRUE(all_ok);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
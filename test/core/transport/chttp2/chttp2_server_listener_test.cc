@@ -17,11 +17,18 @@
 //
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <memory>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/transport/chttp2/server/chttp2_server.h"
 #include "src/core/lib/security/credentials/credentials.h"
@@ -30,6 +37,7 @@
 #include "src/core/lib/security/credentials/tls/tls_credentials.h"
 #include "src/core/server/server.h"
 #include "src/core/util/host_port.h"
+#include "src/core/util/sync.h"
 #include "test/core/end2end/cq_verifier.h"
 #include "test/core/test_util/mock_endpoint.h"
 #include "test/core/test_util/port.h"
@@ -164,6 +172,18 @@ class ListenerStateTestPeer {
     return listener_state_->connections_.size();
   }
 
+  void AddConnection(
+      OrphanablePtr<Server::ListenerInterface::LogicalConnection> connection) {
+    MutexLock lock(&listener_state_->mu_);
+    listener_state_->connections_.insert(std::move(connection));
+  }
+
+  // Drains the connections, as on an update from the config fetcher.
+  void DrainConnections() {
+    MutexLock lock(&listener_state_->mu_);
+    listener_state_->DrainConnectionsLocked();
+  }
+
  private:
   Server::ListenerState* listener_state_;
 };
@@ -173,10 +193,11 @@ namespace {
 class Chttp2ServerListenerTest : public ::testing::Test {
  protected:
   void SetUpServer(const RefCountedPtr<grpc_server_credentials>& creds =
-                       MakeRefCounted<InsecureServerCredentials>()) {
-    args_ = CoreConfiguration::Get()
-                .channel_args_preconditioning()
-                .PreconditionChannelArgs(nullptr);
+                       MakeRefCounted<InsecureServerCredentials>(),
+                   const ChannelArgs& server_args = ChannelArgs()) {
+    args_ = server_args.UnionWith(CoreConfiguration::Get()
+                                      .channel_args_preconditioning()
+                                      .PreconditionChannelArgs(nullptr));
     server_ = MakeOrphanable<Server>(args_);
     grpc_server_add_http2_port(
         server_->c_ptr(),
@@ -270,6 +291,139 @@ TEST_F(Chttp2ServerListenerTest, ConnectionRefusedAfterShutdown) {
   cqv.Verify();
 }
 
+// Records the GOAWAYs and disconnections of FakeLogicalConnections.
+class DrainRecorder {
+ public:
+  void GoAwaySent(int id) {
+    MutexLock lock(&mu_);
+    goaways_.push_back({id, absl::Now()});
+    cv_.SignalAll();
+  }
+
+  void Disconnected() {
+    MutexLock lock(&mu_);
+    ++disconnected_;
+    cv_.SignalAll();
+  }
+
+  // Returns the ids of the connections sent a GOAWAY so far, in order.
+  std::vector<int> GoAwayIds() {
+    MutexLock lock(&mu_);
+    std::vector<int> ids;
+    for (const auto& goaway : goaways_) ids.push_back(goaway.first);
+    return ids;
+  }
+
+  // Waits for \a count GOAWAYs, and returns the times at which they were sent.
+  std::vector<absl::Time> WaitForGoAways(size_t count) {
+    MutexLock lock(&mu_);
+    const absl::Time deadline = absl::Now() + absl::Seconds(30);
+    while (goaways_.size() < count && !cv_.WaitWithDeadline(&mu_, deadline)) {
+    }
+    std::vector<absl::Time> times;
+    for (const auto& goaway : goaways_) times.push_back(goaway.second);
+    return times;
+  }
+
+  bool WaitForDisconnected(int count) {
+    MutexLock lock(&mu_);
+    const absl::Time deadline = absl::Now() + absl::Seconds(30);
+    while (disconnected_ < count) {
+      if (cv_.WaitWithDeadline(&mu_, deadline)) return false;
+    }
+    return true;
+  }
+
+ private:
+  Mutex mu_;
+  CondVar cv_;
+  std::vector<std::pair<int, absl::Time>> goaways_ ABSL_GUARDED_BY(mu_);
+  int disconnected_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+class FakeLogicalConnection final
+    : public Server::ListenerInterface::LogicalConnection {
+ public:
+  FakeLogicalConnection(std::shared_ptr<DrainRecorder> recorder, int id)
+      : recorder_(std::move(recorder)), id_(id) {}
+
+  void Orphan() override { Unref(); }
+
+  void SendGoAway() override { recorder_->GoAwaySent(id_); }
+
+  void DisconnectImmediately() override { recorder_->Disconnected(); }
+
+ private:
+  std::shared_ptr<DrainRecorder> recorder_;
+  const int id_;
+};
+
+class ListenerStateDrainTest : public Chttp2ServerListenerTest {
+ protected:
+  // Starts the server with the given GOAWAY stagger window, or none if 0, and
+  // adds \a count fake connections to the listener.  Drained connections are
+  // disconnected as soon as their GOAWAY is due.
+  void SetUpServerWithConnections(int stagger_window_ms, int count) {
+    SetUpServer(
+        MakeRefCounted<InsecureServerCredentials>(),
+        ChannelArgs()
+            .Set(GRPC_ARG_SERVER_DRAIN_GOAWAY_STAGGER_WINDOW_MS,
+                 stagger_window_ms)
+            .Set(GRPC_ARG_SERVER_CONFIG_CHANGE_DRAIN_GRACE_TIME_MS, 0));
+    for (int i = 0; i < count; ++i) {
+      auto connection = MakeOrphanable<FakeLogicalConnection>(recorder_, i);
+      connections_.push_back(connection.get());
+      ListenerStateTestPeer(listener_state_)
+          .AddConnection(std::move(connection));
+    }
+  }
+
+  std::shared_ptr<DrainRecorder> recorder_ = std::make_shared<DrainRecorder>();
+  std::vector<FakeLogicalConnection*> connections_;
+};
+
+TEST_F(ListenerStateDrainTest, GoAwaysAreSentAtOnceByDefault) {
+  SetUpServerWithConnections(/*stagger_window_ms=*/0, /*count=*/3);
+  ExecCtx exec_ctx;
+  ListenerStateTestPeer(listener_state_).DrainConnections();
+  EXPECT_EQ(recorder_->GoAwayIds().size(), 3);
+  EXPECT_TRUE(recorder_->WaitForDisconnected(3));
+}
+
+TEST_F(ListenerStateDrainTest, GoAwaysAreStaggeredOverTheWindow) {
+  // One GOAWAY every second.
+  SetUpServerWithConnections(/*stagger_window_ms=*/3000, /*count=*/3);
+  ExecCtx exec_ctx;
+  ListenerStateTestPeer(listener_state_).DrainConnections();
+  // The first GOAWAY is sent right away, and the others once they are due.
+  EXPECT_EQ(recorder_->GoAwayIds().size(), 1);
+  std::vector<absl::Time> times = recorder_->WaitForGoAways(3);
+  ASSERT_EQ(times.size(), 3);
+  EXPECT_GE(times[1] - times[0], absl::Milliseconds(900));
+  EXPECT_GE(times[2] - times[1], absl::Milliseconds(900));
+  std::vector<int> ids = recorder_->GoAwayIds();
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ(ids, (std::vector<int>{0, 1, 2}));
+  EXPECT_TRUE(recorder_->WaitForDisconnected(3));
+}
+
+TEST_F(ListenerStateDrainTest, ClosedConnectionsAreNotSentAGoAway) {
+  SetUpServerWithConnections(/*stagger_window_ms=*/3000, /*count=*/3);
+  ExecCtx exec_ctx;
+  ListenerStateTestPeer(listener_state_).DrainConnections();
+  std::vector<int> ids = recorder_->GoAwayIds();
+  ASSERT_EQ(ids.size(), 1);
+  // Close one of the connections that are still waiting for their GOAWAY.
+  const int closed = ids[0] == 0 ? 1 : 0;
+  listener_state_->RemoveLogicalConnection(connections_[closed]);
+  // The remaining connections are disconnected at the end of the window, by
+  // which time every GOAWAY is due.
+  EXPECT_TRUE(recorder_->WaitForDisconnected(2));
+  ids = recorder_->GoAwayIds();
+  EXPECT_EQ(ids.size(), 2);
+  EXPECT_EQ(std::count(ids.begin(), ids.end(), closed), 0);
+}
+
 using Chttp2ActiveConnectionTest = Chttp2ServerListenerTest;
 
 TEST_F(Chttp2ActiveConnectionTest, CloseWithoutHandshakeStarting) {
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <google/protobuf/text_format.h>
 #include <grpc/event_engine/memory_request.h>
 #include <grpc/support/time.h>
 #include <inttypes.h>
@@ -25,6 +26,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -33,6 +35,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_join.h"
 #include "fuzztest/fuzztest.h"
+#include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/lib/experiments/config.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -72,10 +75,11 @@ void InitGlobals() {
 
 class FlowControlFuzzer {
  public:
-  explicit FlowControlFuzzer(bool enable_bdp) {
+  explicit FlowControlFuzzer(bool enable_bdp, uint32_t bulk_stream_threshold) {
     ExecCtx exec_ctx;
     tfc_ = std::make_unique<TransportFlowControl>("fuzzer", enable_bdp,
                                                   &memory_owner_);
+    tfc_->set_bulk_stream_threshold(bulk_stream_threshold);
   }
 
   ~FlowControlFuzzer() {
@@ -213,7 +217,9 @@ void FlowControlFuzzer::Perform(const flow_control_fuzzer::Action& action) {
                   stream_update.id, stream_update.size, s->window_delta);
         }
         s->window_delta += stream_update.size;
-        CHECK(s->window_delta <= chttp2::kMaxWindowDelta);
+        CHECK(s->window_delta <= (tfc_->bulk_stream_threshold() == 0
+                                      ? chttp2::kMaxWindowDelta
+                                      : chttp2::kMaxBulkStreamWindowDelta));
       }
       remote_transport_window_size_ += sent_to_remote.transport_window_update;
       send_to_remote_.pop_front();
@@ -475,7 +481,8 @@ void Test(flow_control_fuzzer::Msg msg) {
   ApplyFuzzConfigVars(msg.config_vars());
   TestOnlyReloadExperimentsFromConfigVariables();
   chttp2::InitGlobals();
-  chttp2::FlowControlFuzzer fuzzer(msg.enable_bdp());
+  chttp2::FlowControlFuzzer fuzzer(msg.enable_bdp(),
+                                   msg.bulk_stream_threshold());
   for (const auto& action : msg.actions()) {
     if (!squelch) {
       fprintf(stderr, "%s\n", action.DebugString().c_str());
@@ -489,6 +496,46 @@ FUZZ_TEST(FlowControl, Test)
     .WithDomains(::fuzztest::Arbitrary<flow_control_fuzzer::Msg>()
                      .WithProtobufField("config_vars", AnyConfigVars()));
 
+flow_control_fuzzer::Msg ParseTestProto(const std::string& proto) {
+  flow_control_fuzzer::Msg msg;
+  CHECK(google::protobuf::TextFormat::ParseFromString(proto, &msg));
+  return msg;
+}
+
+// A large upload sharing the transport with a short unary call, with bulk
+// stream classification enabled: the upload crosses the threshold and grows
+// its window while the unary stream keeps reading.
+TEST(FlowControl, BulkStreamAlongsideUnary) {
+  Test(ParseTestProto(R"pb(
+    enable_bdp: true
+    bulk_stream_threshold: 65536
+    actions { stream_write { id: 1 size: 67108864 } }
+    actions { stream_write { id: 3 size: 100 } }
+    actions { set_min_progress_size { id: 1 size: 16777216 } }
+    actions { set_min_progress_size { id: 3 size: 100 } }
+    actions { perform_send_to_remote {} }
+    actions { read_send_to_remote {} }
+    actions { perform_send_from_remote {} }
+    actions { read_send_from_remote {} }
+    actions { perform_send_to_remote {} }
+    actions { read_send_to_remote {} }
+    actions { perform_send_from_remote {} }
+    actions { read_send_from_remote {} }
+    actions { set_min_progress_size { id: 1 size: 16777216 } }
+    actions { perform_send_to_remote {} }
+    actions { read_send_to_remote {} }
+    actions { perform_send_from_remote {} }
+    actions { read_send_from_remote {} }
+    actions { periodic_update {} }
+    actions { set_memory_quota: 1 }
+    actions { periodic_update {} }
+    actions { perform_send_to_remote {} }
+    actions { read_send_to_remote {} }
+    actions { perform_send_from_remote {} }
+    actions { read_send_from_remote {} }
+  )pb"));
+}
+
 }  // namespace
 }  // namespace chttp2
 }  // namespace grpc_core
@@ -263,6 +263,91 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST_F(FlowControlTest, StallLikelyOnlyWhenReaderWaitsOnSmallWindow) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  StreamFlowControl sfc(&tfc);
+  EXPECT_FALSE(sfc.StallLikely());
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(32768), absl::OkStatus());
+    std::ignore = sfc_upd.MakeAction();
+  }
+  // Plenty of window left, but nobody is reading yet.
+  EXPECT_FALSE(sfc.StallLikely());
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    sfc_upd.SetMinProgressSize(5);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_FALSE(sfc.StallLikely());
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(4), absl::OkStatus());
+    EXPECT_EQ(sfc_upd.RecvData(20000), absl::OkStatus());
+    sfc_upd.SetMinProgressSize(5);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_TRUE(sfc.StallLikely());
+  sfc.MaybeSendUpdate();
+  EXPECT_FALSE(sfc.StallLikely());
+}
+
+TEST_F(FlowControlTest, BulkStreamsGetLargerWindows) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  tfc.set_bulk_stream_threshold(16384);
+  StreamFlowControl unary(&tfc);
+  StreamFlowControl bulk(&tfc);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&unary);
+    EXPECT_EQ(sfc_upd.RecvData(1024), absl::OkStatus());
+    sfc_upd.SetMinProgressSize(5);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_FALSE(unary.is_bulk());
+  EXPECT_EQ(unary.MaybeSendUpdate(), 1024 + 5);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&bulk);
+    EXPECT_EQ(sfc_upd.RecvData(16384), absl::OkStatus());
+    sfc_upd.SetMinProgressSize(5);
+    EXPECT_EQ(sfc_upd.MakeAction().send_stream_update(),
+              FlowControlAction::Urgency::UPDATE_IMMEDIATELY);
+  }
+  EXPECT_TRUE(bulk.is_bulk());
+  EXPECT_EQ(bulk.MaybeSendUpdate(), 16384 + kMaxWindowDelta);
+  EXPECT_EQ(bulk.announced_window_delta(), kMaxWindowDelta);
+  tfc.MaybeSendUpdate(true);
+  // Consuming the whole window doubles it.
+  for (int64_t received = 0; received < kMaxWindowDelta; received += 65536) {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&bulk);
+    EXPECT_EQ(sfc_upd.RecvData(65536), absl::OkStatus());
+    std::ignore = sfc_upd.MakeAction();
+    tfc.MaybeSendUpdate(true);
+  }
+  EXPECT_EQ(bulk.stats().bulk_window_delta, 2 * kMaxWindowDelta);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&bulk);
+    sfc_upd.SetMinProgressSize(5);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(bulk.MaybeSendUpdate(), 2 * kMaxWindowDelta);
+}
+
+TEST_F(FlowControlTest, BulkStreamsDisabledByDefault) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  StreamFlowControl sfc(&tfc);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(65535), absl::OkStatus());
+    sfc_upd.SetMinProgressSize(5);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_FALSE(sfc.is_bulk());
+  EXPECT_EQ(sfc.MaybeSendUpdate(), 65535 + 5);
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
@@ -27,9 +27,12 @@
 #include <string>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
@@ -413,6 +416,112 @@ TEST(HpackEncoderTest, EncodeBinaryAsTrueBinary) {
   EXPECT_EQ(compressor.test_only_table_size(), 114);
 }
 
+TEST(HpackEncoderTest, SharedLiteralCache) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_core::HPackCompressor::EncodeHeaderOptions hopt{
+      0xdeadbeef,  // stream_id
+      false,       // is_eof
+      false,       // use_true_binary_metadata
+      16384,       // max_frame_size
+      &call_tracer};
+  // user-agent is static table entry 58, and "value" huffman codes to four
+  // bytes.
+  const grpc_core::Slice expect(
+      grpc_core::ParseHexstring("000006 0104 deadbeef 7a 84 ee3a2d2f"));
+  // Two compressors (standing in for two connections) produce the same
+  // encoding, and account for the entry in their own tables.
+  for (int i = 0; i < 2; i++) {
+    grpc_core::HPackCompressor compressor;
+    compressor.EnableSharedLiteralCache();
+    grpc_metadata_batch b;
+    b.Append(grpc_core::UserAgentMetadata::key(),
+             grpc_core::Slice::FromStaticString("value"), CrashOnAppendError);
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&output);
+    compressor.EncodeHeaders(hopt, b, &output);
+    verify_frames(output, false);
+    const grpc_core::Slice merged(
+        grpc_slice_merge(output.slices, output.count));
+    grpc_slice_buffer_destroy(&output);
+    EXPECT_EQ(merged, expect);
+    EXPECT_EQ(compressor.test_only_table_size(), 10 + 5 + 32);
+  }
+}
+
+TEST(HpackEncoderTest, SharedLiteralCacheKeepsShortValuesUnhuffmaned) {
+  // Huffman coding a single digit does not save anything: the literal name
+  // and raw value are kept.
+  EXPECT_EQ(grpc_core::hpack_encoder_detail::SharedLiteralCache::Encode(
+                "x-custom", "0"),
+            grpc_core::Slice(
+                grpc_core::ParseHexstring("40 08 782d637573746f6d 01 30")));
+}
+
+TEST(HpackEncoderTest, SharedLiteralCacheSkipsVolatileAndSensitiveKeys) {
+  using grpc_core::hpack_encoder_detail::SharedLiteralCache;
+  SharedLiteralCache cache;
+  for (absl::string_view key :
+       {"authorization", "cookie", "grpc-timeout", "proxy-authorization"}) {
+    EXPECT_TRUE(
+        cache.Lookup(key, grpc_core::Slice::FromStaticString("secret")).empty())
+        << key;
+  }
+  EXPECT_TRUE(cache
+                  .Lookup("x-custom",
+                          grpc_core::Slice::FromCopiedString(std::string(
+                              SharedLiteralCache::kMaxValueLength + 1, 'a')))
+                  .empty());
+  EXPECT_EQ(cache.TestOnlySize(), 0);
+}
+
+TEST(HpackEncoderTest, SharedLiteralCacheEvictsLeastRecentlyUsed) {
+  using grpc_core::hpack_encoder_detail::SharedLiteralCache;
+  SharedLiteralCache cache;
+  const grpc_core::Slice hot =
+      cache.Lookup("x-hot", grpc_core::Slice::FromStaticString("hot"));
+  ASSERT_FALSE(hot.empty());
+  for (size_t i = 0; i < 4 * SharedLiteralCache::kMaxEntries; ++i) {
+    cache.Lookup("x-cold", grpc_core::Slice::FromCopiedString(absl::StrCat(i)));
+    EXPECT_EQ(cache.Lookup("x-hot", grpc_core::Slice::FromStaticString("hot"))
+                  .data(),
+              hot.data());
+  }
+  EXPECT_LE(cache.TestOnlySize(), SharedLiteralCache::kMaxEntries);
+}
+
+TEST(HpackEncoderTest, ContiguousOutputPacksSmallHeaders) {
+  if (!grpc_core::IsHpackEncoderContiguousOutputEnabled()) {
+    GTEST_SKIP() << "hpack_encoder_contiguous_output experiment is disabled";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  grpc_metadata_batch b;
+  b.Append("a", grpc_core::Slice::FromStaticString("a"), CrashOnAppendError);
+  b.Append("b", grpc_core::Slice::FromStaticString("c"), CrashOnAppendError);
+  b.Append("x-custom", grpc_core::Slice::FromStaticString("0123456789"),
+           CrashOnAppendError);
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_core::HPackCompressor::EncodeHeaderOptions hopt{
+      0xdeadbeef,  // stream_id
+      false,       // is_eof
+      false,       // use_true_binary_metadata
+      16384,       // max_frame_size
+      &call_tracer};
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  compressor.EncodeHeaders(hopt, b, &output);
+  // The frame header, and then the whole header block in one slice.
+  EXPECT_EQ(output.count, 2);
+  grpc_core::Slice merged(grpc_slice_merge(output.slices, output.count));
+  EXPECT_EQ(merged,
+            grpc_core::ParseHexstring("00001f 0104 deadbeef"
+                                      "00 0161 0161 00 0162 0163"
+                                      "00 08 782d637573746f6d"
+                                      "0a 30313233343536373839"));
+  grpc_slice_buffer_destroy(&output);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
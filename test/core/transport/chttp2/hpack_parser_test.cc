@@ -521,6 +521,27 @@ INSTANTIATE_TEST_SUITE_P(
               {"400274650767617262616765",
                absl::InternalError("Error parsing 'te' metadata"), 0},
               {"be", absl::InternalError("Error parsing 'te' metadata"), 0}}},
+        Test{"LiteralWithIndexedDynamicName",
+             {},
+             {},
+             {
+                 // te: trailers (added as 62)
+                 {"4002746508747261696c657273", "te: trailers\n",
+                  kEndOfHeaders},
+                 // foo: bar (added as 62, te moves to 63)
+                 {"4003666f6f03626172", "foo: bar\n", kEndOfHeaders},
+                 // name 63 (te), new value
+                 {"7f0008747261696c657273", "te: trailers\n", kEndOfHeaders},
+                 // name 63 (foo), new value
+                 {"7f000362617a", "foo: baz\n", kEndOfHeaders},
+                 // name 63 (te), bad value
+                 {"7f0003626164",
+                  absl::InternalError("Error parsing 'te' metadata"),
+                  kEndOfHeaders},
+                 // Earlier entries are untouched
+                 {"c1", "foo: bar\n", kEndOfHeaders},
+                 {"bf", "foo: baz\n", kEndOfHeaders},
+             }},
         Test{"MetadataSizeLimitCheck",
              {},
              128,
@@ -21,27 +21,31 @@
 #include "gtest/gtest.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/transport/http2_errors.h"
+#include "test/core/test_util/passthrough_endpoint.h"
 #include "test/core/transport/chttp2/http2_frame_test_helper.h"
-#include "test/core/transport/util/mock_promise_endpoint.h"
 
 using grpc_core::transport::testing::Http2FrameTestHelper;
-using grpc_core::util::testing::MockPromiseEndpoint;
 using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::PassthroughEndpoint;
 
 namespace grpc_core {
 namespace http2 {
 namespace testing {
 
 TEST(Http2ClientTransportTest, TestHttp2ClientTransportObjectCreation) {
-  MockPromiseEndpoint endpoint(1);
+  // The transport starts its read and write loops right away, so it needs a
+  // peer to talk to, even if nothing answers.
+  auto endpoints = PassthroughEndpoint::MakePassthroughEndpoint(1, 2, true);
   std::shared_ptr<EventEngine> event_engine =
       grpc_event_engine::experimental::GetDefaultEventEngine();
 
-  Http2ClientTransport transport(std::move(endpoint.promise_endpoint),
-                                 CoreConfiguration::Get()
-                                     .channel_args_preconditioning()
-                                     .PreconditionChannelArgs(nullptr),
-                                 event_engine);
+  auto transport = MakeOrphanable<Http2ClientTransport>(
+      PromiseEndpoint(std::move(endpoints.client), SliceBuffer()),
+      CoreConfiguration::Get()
+          .channel_args_preconditioning()
+          .PreconditionChannelArgs(nullptr),
+      event_engine);
+  EXPECT_EQ(transport->GetTransportName(), "http2");
   // TODO(tjagtap) : [PH2][P1] : Remove this when the test is completed.
   Http2FrameTestHelper helper1;
   VLOG(4)
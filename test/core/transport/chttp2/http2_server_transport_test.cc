@@ -20,26 +20,172 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <variant>
+
+#include "absl/status/status.h"
+#include "absl/synchronization/notification.h"
+#include "absl/types/span.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
-#include "test/core/transport/util/mock_promise_endpoint.h"
+#include "src/core/lib/transport/call_destination.h"
+#include "src/core/lib/transport/http2_errors.h"
+#include "test/core/test_util/passthrough_endpoint.h"
 
-using grpc_core::util::testing::MockPromiseEndpoint;
 using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::PassthroughEndpoint;
 
 namespace grpc_core {
 namespace http2 {
 namespace testing {
 
 TEST(Http2ClientTransportTest, TestHttp2ServerTransportObjectCreation) {
-  MockPromiseEndpoint endpoint(1);
+  // The transport starts its write loop right away, so it needs a peer to
+  // talk to, even if nothing answers.
+  auto endpoints = PassthroughEndpoint::MakePassthroughEndpoint(1, 2, true);
   std::shared_ptr<EventEngine> event_engine =
       grpc_event_engine::experimental::GetDefaultEventEngine();
 
-  Http2ServerTransport transport(std::move(endpoint.promise_endpoint),
-                                 CoreConfiguration::Get()
-                                     .channel_args_preconditioning()
-                                     .PreconditionChannelArgs(nullptr),
-                                 event_engine);
+  auto transport = MakeOrphanable<Http2ServerTransport>(
+      PromiseEndpoint(std::move(endpoints.server), SliceBuffer()),
+      CoreConfiguration::Get()
+          .channel_args_preconditioning()
+          .PreconditionChannelArgs(nullptr),
+      event_engine);
+  EXPECT_EQ(transport->GetTransportName(), "http2");
+}
+
+// Plays the client of an Http2ServerTransport, one frame at a time.
+class Http2ServerTransportFrameTest : public ::testing::Test {
+ protected:
+  class NoCallsDestination final : public UnstartedCallDestination {
+   public:
+    void StartCall(UnstartedCallHandler) override {
+      ADD_FAILURE() << "No call was expected";
+    }
+    void Orphaned() override {}
+  };
+
+  Http2ServerTransportFrameTest() {
+    auto endpoints = PassthroughEndpoint::MakePassthroughEndpoint(1, 2, true);
+    client_ = std::move(endpoints.client);
+    transport_ = MakeOrphanable<Http2ServerTransport>(
+        PromiseEndpoint(std::move(endpoints.server), SliceBuffer()),
+        CoreConfiguration::Get()
+            .channel_args_preconditioning()
+            .PreconditionChannelArgs(nullptr),
+        grpc_event_engine::experimental::GetDefaultEventEngine());
+    transport_->SetCallDestination(MakeRefCounted<NoCallsDestination>());
+    // Connection preface, then an empty SETTINGS.
+    SliceBuffer preface;
+    preface.Append(
+        Slice::FromStaticString("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"));
+    WriteBytes(std::move(preface));
+    Write(Http2SettingsFrame{});
+  }
+
+  ~Http2ServerTransportFrameTest() override {
+    transport_.reset();
+    client_.reset();
+  }
+
+  void Write(Http2Frame frame) {
+    SliceBuffer bytes;
+    Serialize(absl::Span<Http2Frame>(&frame, 1), bytes);
+    WriteBytes(std::move(bytes));
+  }
+
+  // Reads frames from the transport until it sends GOAWAY, and returns it.
+  // Returns nullopt if the transport closes the connection first.
+  std::optional<Http2GoawayFrame> ReadGoaway() {
+    while (true) {
+      if (!ReadAtLeast(kFrameHeaderSize)) return std::nullopt;
+      uint8_t header_bytes[kFrameHeaderSize];
+      grpc_slice_buffer_copy_first_into_buffer(read_buffer_.c_slice_buffer(),
+                                               kFrameHeaderSize, header_bytes);
+      Http2FrameHeader header = Http2FrameHeader::Parse(header_bytes);
+      if (!ReadAtLeast(kFrameHeaderSize + header.length)) return std::nullopt;
+      read_buffer_.MoveFirstNBytesIntoBuffer(kFrameHeaderSize, header_bytes);
+      SliceBuffer payload;
+      read_buffer_.MoveFirstNBytesIntoSliceBuffer(header.length, payload);
+      auto frame = ParseFramePayload(header, std::move(payload));
+      EXPECT_TRUE(frame.ok()) << frame.status();
+      if (!frame.ok()) return std::nullopt;
+      if (auto* goaway = std::get_if<Http2GoawayFrame>(&*frame)) {
+        return std::move(*goaway);
+      }
+    }
+  }
+
+ private:
+  void WriteBytes(SliceBuffer bytes) {
+    auto buffer = grpc_event_engine::experimental::SliceBuffer::TakeCSliceBuffer(
+        *bytes.c_slice_buffer());
+    absl::Notification done;
+    absl::Status status;
+    if (client_->Write(
+            [&](absl::Status s) {
+              status = std::move(s);
+              done.Notify();
+            },
+            &buffer, nullptr)) {
+      return;
+    }
+    done.WaitForNotification();
+    ASSERT_TRUE(status.ok()) << status;
+  }
+
+  bool ReadAtLeast(size_t bytes) {
+    while (read_buffer_.Length() < bytes) {
+      grpc_event_engine::experimental::SliceBuffer buffer;
+      absl::Notification done;
+      absl::Status status;
+      if (!client_->Read(
+              [&](absl::Status s) {
+                status = std::move(s);
+                done.Notify();
+              },
+              &buffer, nullptr)) {
+        done.WaitForNotification();
+      }
+      if (!status.ok()) return false;
+      grpc_slice_buffer_move_into(buffer.c_slice_buffer(),
+                                  read_buffer_.c_slice_buffer());
+    }
+    return true;
+  }
+
+  std::unique_ptr<PassthroughEndpoint> client_;
+  OrphanablePtr<Http2ServerTransport> transport_;
+  SliceBuffer read_buffer_;
+};
+
+TEST_F(Http2ServerTransportFrameTest, ZeroWindowUpdateIsAProtocolError) {
+  Write(Http2WindowUpdateFrame{0, 0});
+  auto goaway = ReadGoaway();
+  ASSERT_TRUE(goaway.has_value());
+  EXPECT_EQ(goaway->error_code, GRPC_HTTP2_PROTOCOL_ERROR);
+}
+
+TEST_F(Http2ServerTransportFrameTest, WindowOverflowIsAFlowControlError) {
+  // The connection window starts at 65535, so this takes it past 2^31-1.
+  Write(Http2WindowUpdateFrame{0, 0x7fffffff});
+  auto goaway = ReadGoaway();
+  ASSERT_TRUE(goaway.has_value());
+  EXPECT_EQ(goaway->error_code, GRPC_HTTP2_FLOW_CONTROL_ERROR);
+}
+
+TEST_F(Http2ServerTransportFrameTest, TooManyPingsEndTheConnection) {
+  // With no calls, the default policy allows one ping every two hours and
+  // two strikes.
+  for (uint64_t i = 0; i < 4; ++i) Write(Http2PingFrame{false, i});
+  auto goaway = ReadGoaway();
+  ASSERT_TRUE(goaway.has_value());
+  EXPECT_EQ(goaway->error_code, GRPC_HTTP2_ENHANCE_YOUR_CALM);
+  EXPECT_EQ(goaway->debug_data.as_string_view(), "too_many_pings");
 }
 
 }  // namespace testing
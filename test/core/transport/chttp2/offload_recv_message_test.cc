@@ -0,0 +1,233 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Checks that with GRPC_ARG_HTTP2_OFFLOAD_RECV_MESSAGE_BYTES, a stream's
+// trailing metadata is not delivered before all of its messages, even when
+// the application asks for each message from the completion of the previous
+// one, so that offloads of consecutive messages overlap.
+
+#include <grpc/byte_buffer.h>
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/impl/propagation_bits.h>
+#include <grpc/slice.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+#include <string.h>
+
+#include <string>
+#include <thread>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/util/host_port.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+constexpr int kMessagesPerCall = 20;
+constexpr size_t kMessageSize = 4096;
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+grpc_event Next(grpc_completion_queue* cq) {
+  grpc_event event = grpc_completion_queue_next(
+      cq, grpc_timeout_seconds_to_deadline(30), nullptr);
+  CHECK(event.type == GRPC_OP_COMPLETE);
+  return event;
+}
+
+// Sends kMessagesPerCall messages and then the status. The last message goes
+// in the same batch as the status, so that it usually arrives in the same read
+// as the trailers.
+void ServeCall(grpc_server* server, grpc_completion_queue* cq) {
+  grpc_call_details call_details;
+  grpc_call_details_init(&call_details);
+  grpc_metadata_array request_metadata;
+  grpc_metadata_array_init(&request_metadata);
+  grpc_call* call;
+  CHECK_EQ(grpc_server_request_call(server, &call, &call_details,
+                                    &request_metadata, cq, cq, Tag(1)),
+           GRPC_CALL_OK);
+  grpc_event event = Next(cq);
+  CHECK(event.success);
+  CHECK(event.tag == Tag(1));
+  grpc_call_details_destroy(&call_details);
+  grpc_metadata_array_destroy(&request_metadata);
+  grpc_slice payload_slice = grpc_slice_malloc(kMessageSize);
+  memset(GRPC_SLICE_START_PTR(payload_slice), 'a', kMessageSize);
+  grpc_byte_buffer* payload = grpc_raw_byte_buffer_create(&payload_slice, 1);
+  grpc_slice status_details = grpc_slice_from_static_string("done");
+  int was_cancelled;
+  for (int i = 0; i < kMessagesPerCall; ++i) {
+    const bool last = i == kMessagesPerCall - 1;
+    grpc_op ops[4];
+    memset(ops, 0, sizeof(ops));
+    grpc_op* op = ops;
+    if (i == 0) {
+      op->op = GRPC_OP_SEND_INITIAL_METADATA;
+      op++;
+    }
+    op->op = GRPC_OP_SEND_MESSAGE;
+    op->data.send_message.send_message = payload;
+    op++;
+    if (last) {
+      op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+      op->data.send_status_from_server.status = GRPC_STATUS_OK;
+      op->data.send_status_from_server.status_details = &status_details;
+      op++;
+      op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+      op->data.recv_close_on_server.cancelled = &was_cancelled;
+      op++;
+    }
+    CHECK_EQ(grpc_call_start_batch(call, ops, static_cast<size_t>(op - ops),
+                                   Tag(2), nullptr),
+             GRPC_CALL_OK);
+    event = Next(cq);
+    CHECK(event.success);
+    CHECK(event.tag == Tag(2));
+  }
+  grpc_byte_buffer_destroy(payload);
+  grpc_slice_unref(payload_slice);
+  grpc_call_unref(call);
+}
+
+// Reads the call's messages, asking for each one as soon as the previous one
+// has arrived, with the status requested up front. Returns the number of
+// messages that had arrived when the status did.
+int ReadCall(grpc_channel* channel, grpc_completion_queue* cq) {
+  grpc_call* call = grpc_channel_create_call(
+      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+      grpc_slice_from_static_string("/foo"), nullptr,
+      gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+  grpc_metadata_array initial_metadata;
+  grpc_metadata_array_init(&initial_metadata);
+  grpc_metadata_array trailing_metadata;
+  grpc_metadata_array_init(&trailing_metadata);
+  grpc_status_code status = GRPC_STATUS_UNKNOWN;
+  grpc_slice details;
+  grpc_op ops[3];
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  ops[2].op = GRPC_OP_RECV_INITIAL_METADATA;
+  ops[2].data.recv_initial_metadata.recv_initial_metadata = &initial_metadata;
+  CHECK_EQ(grpc_call_start_batch(call, ops, 3, Tag(1), nullptr), GRPC_CALL_OK);
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  ops[0].data.recv_status_on_client.trailing_metadata = &trailing_metadata;
+  ops[0].data.recv_status_on_client.status = &status;
+  ops[0].data.recv_status_on_client.status_details = &details;
+  CHECK_EQ(grpc_call_start_batch(call, ops, 1, Tag(2), nullptr), GRPC_CALL_OK);
+  grpc_byte_buffer* message = nullptr;
+  auto request_message = [&]() {
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_RECV_MESSAGE;
+    ops[0].data.recv_message.recv_message = &message;
+    CHECK_EQ(grpc_call_start_batch(call, ops, 1, Tag(3), nullptr),
+             GRPC_CALL_OK);
+  };
+  request_message();
+  int messages = 0;
+  int messages_at_status = -1;
+  bool reading = true;
+  bool started = false;
+  while (reading || messages_at_status < 0 || !started) {
+    grpc_event event = Next(cq);
+    switch (reinterpret_cast<intptr_t>(event.tag)) {
+      case 1:
+        started = true;
+        break;
+      case 2:
+        messages_at_status = messages;
+        break;
+      case 3:
+        if (message == nullptr) {
+          reading = false;
+        } else {
+          EXPECT_EQ(grpc_byte_buffer_length(message), kMessageSize);
+          grpc_byte_buffer_destroy(message);
+          message = nullptr;
+          ++messages;
+          request_message();
+        }
+        break;
+    }
+  }
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+  EXPECT_EQ(messages, kMessagesPerCall);
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata);
+  grpc_metadata_array_destroy(&trailing_metadata);
+  grpc_call_unref(call);
+  return messages_at_status;
+}
+
+TEST(OffloadRecvMessageTest, TrailersFollowAllOffloadedMessages) {
+  grpc_completion_queue* server_cq =
+      grpc_completion_queue_create_for_next(nullptr);
+  grpc_completion_queue* client_cq =
+      grpc_completion_queue_create_for_next(nullptr);
+  auto channel_args =
+      grpc_core::ChannelArgs().Set(GRPC_ARG_HTTP2_OFFLOAD_RECV_MESSAGE_BYTES, 1);
+  grpc_server* server = grpc_server_create(channel_args.ToC().get(), nullptr);
+  std::string address =
+      grpc_core::JoinHostPort("[::1]", grpc_pick_unused_port_or_die());
+  grpc_server_register_completion_queue(server, server_cq, nullptr);
+  grpc_server_credentials* server_creds =
+      grpc_insecure_server_credentials_create();
+  CHECK(grpc_server_add_http2_port(server, address.c_str(), server_creds));
+  grpc_server_credentials_release(server_creds);
+  grpc_server_start(server);
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  grpc_channel* channel =
+      grpc_channel_create(absl::StrCat("ipv6:", address).c_str(), creds,
+                          channel_args.ToC().get());
+  grpc_channel_credentials_release(creds);
+  for (int i = 0; i < 20; ++i) {
+    std::thread server_thread(ServeCall, server, server_cq);
+    EXPECT_EQ(ReadCall(channel, client_cq), kMessagesPerCall);
+    server_thread.join();
+  }
+  grpc_channel_destroy(channel);
+  grpc_server_shutdown_and_notify(server, server_cq, Tag(4));
+  grpc_event event = Next(server_cq);
+  CHECK(event.tag == Tag(4));
+  grpc_server_destroy(server);
+  for (grpc_completion_queue* cq : {server_cq, client_cq}) {
+    grpc_completion_queue_shutdown(cq);
+    while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(cq);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -0,0 +1,63 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/shared_keepalive.h"
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+Timestamp At(int64_t millis) {
+  return Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+}
+
+TEST(SharedKeepalive, StartsWithoutActivity) {
+  auto shared = SharedKeepalive::ForPeer("ipv4:127.0.0.1:1");
+  EXPECT_EQ(shared->last_activity(), Timestamp::InfPast());
+}
+
+TEST(SharedKeepalive, SharedBySamePeer) {
+  auto a = SharedKeepalive::ForPeer("ipv4:127.0.0.1:2");
+  auto b = SharedKeepalive::ForPeer("ipv4:127.0.0.1:2");
+  auto other = SharedKeepalive::ForPeer("ipv4:127.0.0.1:3");
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, other);
+  a->RecordActivity(At(1000));
+  EXPECT_EQ(b->last_activity(), At(1000));
+  EXPECT_EQ(other->last_activity(), Timestamp::InfPast());
+}
+
+TEST(SharedKeepalive, ForgottenWithLastConnection) {
+  SharedKeepalive::ForPeer("ipv4:127.0.0.1:4")->RecordActivity(At(1000));
+  EXPECT_EQ(SharedKeepalive::ForPeer("ipv4:127.0.0.1:4")->last_activity(),
+            Timestamp::InfPast());
+}
+
+TEST(SharedKeepalive, RecordsAtMostEvery100Millis) {
+  auto shared = SharedKeepalive::ForPeer("ipv4:127.0.0.1:5");
+  shared->RecordActivity(At(1000));
+  shared->RecordActivity(At(1099));
+  EXPECT_EQ(shared->last_activity(), At(1000));
+  shared->RecordActivity(At(1100));
+  EXPECT_EQ(shared->last_activity(), At(1100));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,290 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Frames DATA for a set of writable streams with grpc_chttp2_begin_write and
+// checks the order, and the size of each visit, that the priority classes
+// and weights give them.
+
+#include <grpc/grpc.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/stream_lists.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Pair;
+using Class = GrpcWritePriority::Class;
+
+// HTTP/2 frame header: 24 bit length, type, flags, 31 bit stream id.
+constexpr size_t kFrameHeaderSize = 9;
+constexpr uint8_t kDataFrameType = 0;
+
+class WritePriorityTest : public ::testing::Test {
+ protected:
+  WritePriorityTest() {
+    auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+    auto controller =
+        grpc_event_engine::experimental::MockEndpointController::Create(engine);
+    controller->NoMoreReads();
+    // Server side, so that there is no connection preface in the writes.
+    t_ = reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        ChannelArgs()
+            .SetObject(ResourceQuota::Default())
+            .SetObject(std::move(engine)),
+        OrphanablePtr<grpc_endpoint>(controller->TakeCEndpoint()),
+        /*is_client=*/false));
+  }
+
+  ~WritePriorityTest() override {
+    for (auto& stream : streams_) {
+      grpc_chttp2_stream* s = stream->s;
+      if (grpc_chttp2_list_remove_writable_stream(t_, s)) {
+        GRPC_CHTTP2_STREAM_UNREF(s, "test");
+      }
+      s->write_closed = true;
+      s->read_closed = true;
+      t_->DestroyStream(reinterpret_cast<grpc_stream*>(s), &stream->destroyed);
+    }
+    t_->Orphan();
+    // Nothing ran on the transport's combiner until now, so no write could
+    // race with the ones the tests start by hand.
+    exec_ctx_.Flush();
+  }
+
+  // Adds a stream of the given class and weight with bytes of DATA to send.
+  grpc_chttp2_stream* AddStream(Class priority_class, uint8_t weight,
+                                size_t bytes) {
+    auto stream = std::make_unique<TestStream>();
+    stream->arena = SimpleArenaAllocator()->MakeArena();
+    GRPC_STREAM_REF_INIT(&stream->refcount, 1, DoNothing, nullptr, "test");
+    GRPC_CLOSURE_INIT(&stream->destroyed, DoNothing, nullptr, nullptr);
+    auto* gs =
+        static_cast<grpc_stream*>(stream->arena->Alloc(t_->SizeOfStream()));
+    t_->InitStream(gs, &stream->refcount, nullptr, stream->arena.get());
+    grpc_chttp2_stream* s = reinterpret_cast<grpc_chttp2_stream*>(gs);
+    s->id = next_stream_id_;
+    next_stream_id_ += 2;
+    s->write_priority.priority_class = priority_class;
+    s->write_priority.weight = weight;
+    s->sent_initial_metadata = true;
+    grpc_slice_buffer_add(&s->flow_controlled_buffer,
+                          grpc_slice_malloc(bytes));
+    stream->s = s;
+    streams_.push_back(std::move(stream));
+    return s;
+  }
+
+  // Queues s for writing, the way the transport does when a stream has
+  // something to send.
+  bool MarkWritable(grpc_chttp2_stream* s) {
+    GRPC_CHTTP2_STREAM_REF(s, "test");
+    if (!grpc_chttp2_list_add_writable_stream(t_, s)) {
+      GRPC_CHTTP2_STREAM_UNREF(s, "test");
+      return false;
+    }
+    return true;
+  }
+
+  // Runs one write and returns the stream id and length of each DATA frame
+  // in it, in order.
+  std::vector<std::pair<uint32_t, uint32_t>> Write() {
+    grpc_chttp2_begin_write(t_);
+    const std::string bytes = t_->outbuf.JoinIntoString();
+    grpc_chttp2_end_write(t_, absl::OkStatus());
+    std::vector<std::pair<uint32_t, uint32_t>> frames;
+    size_t pos = 0;
+    while (pos + kFrameHeaderSize <= bytes.size()) {
+      auto byte = [&](size_t i) {
+        return static_cast<uint32_t>(static_cast<uint8_t>(bytes[pos + i]));
+      };
+      const uint32_t length = (byte(0) << 16) | (byte(1) << 8) | byte(2);
+      const uint32_t stream_id = ((byte(5) & 0x7f) << 24) | (byte(6) << 16) |
+                                 (byte(7) << 8) | byte(8);
+      if (byte(3) == kDataFrameType) frames.emplace_back(stream_id, length);
+      pos += kFrameHeaderSize + length;
+    }
+    EXPECT_EQ(pos, bytes.size());
+    return frames;
+  }
+
+  grpc_chttp2_transport* t_;
+
+ private:
+  struct TestStream {
+    RefCountedPtr<Arena> arena;
+    grpc_stream_refcount refcount;
+    grpc_closure destroyed;
+    grpc_chttp2_stream* s = nullptr;
+  };
+
+  static void DoNothing(void*, grpc_error_handle) {}
+
+  // Declared before exec_ctx_, so that the streams outlive the flush that
+  // destroys them.
+  std::vector<std::unique_ptr<TestStream>> streams_;
+  uint32_t next_stream_id_ = 1;
+  ExecCtx exec_ctx_;
+};
+
+TEST_F(WritePriorityTest, PopsHigherClassesFirst) {
+  grpc_chttp2_stream* normal = AddStream(Class::kNormal, 16, 1);
+  grpc_chttp2_stream* bulk = AddStream(Class::kBulk, 16, 1);
+  grpc_chttp2_stream* high = AddStream(Class::kHigh, 16, 1);
+  grpc_chttp2_stream* normal2 = AddStream(Class::kNormal, 16, 1);
+  for (grpc_chttp2_stream* s : {normal, bulk, high, normal2}) {
+    EXPECT_TRUE(MarkWritable(s));
+  }
+  EXPECT_EQ(grpc_chttp2_list_writable_stream_count(t_), 4u);
+  std::vector<grpc_chttp2_stream*> popped;
+  grpc_chttp2_stream* s;
+  while (grpc_chttp2_list_pop_writable_stream(t_, &s)) {
+    popped.push_back(s);
+    GRPC_CHTTP2_STREAM_UNREF(s, "test");
+  }
+  EXPECT_THAT(popped, ElementsAre(high, normal, normal2, bulk));
+}
+
+TEST_F(WritePriorityTest, StreamIsWritableOnceAcrossClasses) {
+  grpc_chttp2_stream* s = AddStream(Class::kBulk, 16, 1);
+  EXPECT_TRUE(MarkWritable(s));
+  EXPECT_FALSE(MarkWritable(s));
+  // A stream whose class changed while it was queued is still only queued
+  // once.
+  s->write_priority.priority_class = Class::kHigh;
+  EXPECT_FALSE(MarkWritable(s));
+  EXPECT_EQ(grpc_chttp2_list_writable_stream_count(t_), 1u);
+}
+
+TEST_F(WritePriorityTest, PeersAreStreamsOfTheSameClass) {
+  grpc_chttp2_stream* high = AddStream(Class::kHigh, 16, 1);
+  grpc_chttp2_stream* normal = AddStream(Class::kNormal, 16, 1);
+  grpc_chttp2_stream* bulk = AddStream(Class::kBulk, 16, 1);
+  EXPECT_TRUE(MarkWritable(high));
+  EXPECT_TRUE(MarkWritable(bulk));
+  EXPECT_TRUE(grpc_chttp2_list_have_writable_peers(t_, high));
+  EXPECT_FALSE(grpc_chttp2_list_have_writable_peers(t_, normal));
+  EXPECT_TRUE(grpc_chttp2_list_have_writable_peers(t_, bulk));
+}
+
+TEST_F(WritePriorityTest, WritesHigherClassesFirst) {
+  grpc_chttp2_stream* normal = AddStream(Class::kNormal, 16, 100);
+  grpc_chttp2_stream* bulk = AddStream(Class::kBulk, 16, 100);
+  grpc_chttp2_stream* high = AddStream(Class::kHigh, 16, 100);
+  for (grpc_chttp2_stream* s : {normal, bulk, high}) {
+    EXPECT_TRUE(MarkWritable(s));
+  }
+  EXPECT_THAT(Write(), ElementsAre(Pair(high->id, 100u), Pair(normal->id, 100u),
+                                   Pair(bulk->id, 100u)));
+}
+
+TEST_F(WritePriorityTest, StreamAloneInItsClassFillsTheWrite) {
+  grpc_chttp2_stream* normal = AddStream(Class::kNormal, 1, 20000);
+  grpc_chttp2_stream* bulk = AddStream(Class::kBulk, 1, 100);
+  EXPECT_TRUE(MarkWritable(normal));
+  EXPECT_TRUE(MarkWritable(bulk));
+  // Not cut to the 1KB a weight of 1 gets when sharing the class, only to
+  // the peer's max frame size.
+  EXPECT_THAT(Write(),
+              ElementsAre(Pair(normal->id, 16384u), Pair(normal->id, 3616u),
+                          Pair(bulk->id, 100u)));
+  EXPECT_EQ(grpc_chttp2_list_writable_stream_count(t_), 0u);
+}
+
+TEST_F(WritePriorityTest, StreamsSharingAClassTakeTurns) {
+  grpc_chttp2_stream* a = AddStream(Class::kNormal, 1, 3000);
+  grpc_chttp2_stream* b = AddStream(Class::kNormal, 1, 3000);
+  EXPECT_TRUE(MarkWritable(a));
+  EXPECT_TRUE(MarkWritable(b));
+  // Each visit spends the 1KB budget and requeues the stream behind the
+  // other one, until what is left fits in a visit.
+  EXPECT_THAT(Write(), ElementsAre(Pair(a->id, 1024u), Pair(b->id, 1024u),
+                                   Pair(a->id, 1024u), Pair(b->id, 1024u),
+                                   Pair(a->id, 952u), Pair(b->id, 952u)));
+  EXPECT_EQ(a->flow_controlled_buffer.length, 0u);
+  EXPECT_EQ(b->flow_controlled_buffer.length, 0u);
+  EXPECT_EQ(grpc_chttp2_list_writable_stream_count(t_), 0u);
+}
+
+TEST_F(WritePriorityTest, BudgetIsProportionalToWeight) {
+  grpc_chttp2_stream* heavy = AddStream(Class::kNormal, 2, 8192);
+  grpc_chttp2_stream* light = AddStream(Class::kNormal, 1, 8192);
+  EXPECT_TRUE(MarkWritable(heavy));
+  EXPECT_TRUE(MarkWritable(light));
+  // 2:1 while both are queued; once heavy is done, light has the class to
+  // itself and sends the rest at once.
+  EXPECT_THAT(
+      Write(),
+      ElementsAre(Pair(heavy->id, 2048u), Pair(light->id, 1024u),
+                  Pair(heavy->id, 2048u), Pair(light->id, 1024u),
+                  Pair(heavy->id, 2048u), Pair(light->id, 1024u),
+                  Pair(heavy->id, 2048u), Pair(light->id, 5120u)));
+}
+
+TEST_F(WritePriorityTest, LowerClassWaitsForHigherClassToDrain) {
+  grpc_chttp2_stream* bulk = AddStream(Class::kBulk, 255, 100);
+  grpc_chttp2_stream* high = AddStream(Class::kHigh, 1, 40000);
+  EXPECT_TRUE(MarkWritable(bulk));
+  EXPECT_TRUE(MarkWritable(high));
+  // Weights only matter within a class.
+  EXPECT_THAT(Write(),
+              ElementsAre(Pair(high->id, 16384u), Pair(high->id, 16384u),
+                          Pair(high->id, 7232u), Pair(bulk->id, 100u)));
+}
+
+TEST_F(WritePriorityTest, HigherClassCanStarveLowerClassOfWindow) {
+  grpc_chttp2_stream* bulk = AddStream(Class::kBulk, 16, 100);
+  grpc_chttp2_stream* high = AddStream(Class::kHigh, 16, 70000);
+  EXPECT_TRUE(MarkWritable(bulk));
+  EXPECT_TRUE(MarkWritable(high));
+  // The high priority stream takes the whole 64KB connection window, and the
+  // bulk stream stalls on the transport without sending anything.
+  EXPECT_THAT(Write(),
+              ElementsAre(Pair(high->id, 16384u), Pair(high->id, 16384u),
+                          Pair(high->id, 16384u), Pair(high->id, 16383u)));
+  EXPECT_EQ(bulk->flow_controlled_buffer.length, 100u);
+  EXPECT_EQ(grpc_chttp2_list_writable_stream_count(t_), 0u);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
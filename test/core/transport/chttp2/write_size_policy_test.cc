@@ -116,6 +116,57 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+TEST(WriteSizePolicyTest, PacingRateJumpsTargetOnFastWrites) {
+  ScopedTimeCache time_cache;
+  auto timestamp = [&time_cache](int i) {
+    time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                              Duration::Milliseconds(i));
+  };
+  Chttp2WriteSizePolicy policy;
+  // 10MiB/s over the 300ms target write time.
+  policy.SetPacingRate(10 * 1024 * 1024);
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+  timestamp(10);
+  policy.BeginWrite(131072);
+  timestamp(20);
+  policy.EndWrite(true);
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+  timestamp(30);
+  policy.BeginWrite(131072);
+  timestamp(40);
+  policy.EndWrite(true);
+  EXPECT_EQ(policy.WriteTargetSize(), 3145728);
+  // Slow writes still close things up.
+  timestamp(10000);
+  policy.BeginWrite(3145728);
+  timestamp(20000);
+  policy.EndWrite(true);
+  timestamp(30000);
+  policy.BeginWrite(3145728);
+  timestamp(40000);
+  policy.EndWrite(true);
+  EXPECT_EQ(policy.WriteTargetSize(), 1048576);
+}
+
+TEST(WriteSizePolicyTest, UnknownPacingRateKeepsStepGrowth) {
+  ScopedTimeCache time_cache;
+  auto timestamp = [&time_cache](int i) {
+    time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                              Duration::Milliseconds(i));
+  };
+  Chttp2WriteSizePolicy policy;
+  policy.SetPacingRate(0);
+  timestamp(10);
+  policy.BeginWrite(131072);
+  timestamp(20);
+  policy.EndWrite(true);
+  timestamp(30);
+  policy.BeginWrite(131072);
+  timestamp(40);
+  policy.EndWrite(true);
+  EXPECT_EQ(policy.WriteTargetSize(), 196608);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -146,6 +146,70 @@ TEST(MetadataMapTest, NonTraitKeyWithMultipleValues) {
   EXPECT_EQ(map.GetStringValue(kKey, &buffer), "value1,value2");
 }
 
+// Target for MetadataMap::Encode that notes down the keys, in order.
+struct KeyEncoder {
+  void Encode(const Slice&, const Slice&) {}
+  template <typename Which>
+  void Encode(Which, const typename Which::ValueType&) {
+    keys.emplace_back(Which::key());
+  }
+  std::vector<std::string> keys;
+};
+
+TEST(MetadataMapTest, RarelySetTraits) {
+  static_assert(metadata_detail::IsRarelySetTrait<LbTokenMetadata>::value);
+  static_assert(!metadata_detail::IsRarelySetTrait<HttpPathMetadata>::value);
+  grpc_metadata_batch map;
+  map.Set(HttpPathMetadata(), Slice::FromStaticString("/foo/bar"));
+  EXPECT_EQ(map.get_pointer(LbTokenMetadata()), nullptr);
+  map.Remove(LbTokenMetadata());
+  EXPECT_EQ(map.count(), 1);
+  map.Set(LbTokenMetadata(), Slice::FromStaticString("token"));
+  map.Set(GrpcStatusMetadata(), GRPC_STATUS_OK);
+  map.Set(GrpcStatusContext(), "context");
+  EXPECT_EQ(map.count(), 4);
+  EXPECT_EQ(map.get_pointer(LbTokenMetadata())->as_string_view(), "token");
+  // Encoding still follows trait order, wherever the values are stored.
+  KeyEncoder encoder;
+  map.Encode(&encoder);
+  EXPECT_EQ(encoder.keys,
+            std::vector<std::string>({":path", "grpc-status", "lb-token"}));
+  grpc_metadata_batch copy = map.Copy();
+  grpc_metadata_batch moved = std::move(map);
+  EXPECT_EQ(moved.DebugString(), copy.DebugString());
+  EXPECT_EQ(moved.Take(LbTokenMetadata())->as_string_view(), "token");
+  EXPECT_EQ(moved.count(), 3);
+  moved.Clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(copy.get_pointer(LbTokenMetadata())->as_string_view(), "token");
+  EXPECT_EQ(copy.count(), 4);
+}
+
+TEST(MetadataMapTest, NameLookup) {
+  using Table = metadata_detail::NameLookupTable<
+      HttpPathMetadata, HttpAuthorityMetadata, GrpcStatusMetadata,
+      GrpcMessageMetadata, LbTokenMetadata, TeMetadata>;
+  EXPECT_EQ(Table::Find(":path"), 0);
+  EXPECT_EQ(Table::Find(":authority"), 1);
+  EXPECT_EQ(Table::Find("grpc-status"), 2);
+  EXPECT_EQ(Table::Find("grpc-message"), 3);
+  EXPECT_EQ(Table::Find("lb-token"), 4);
+  EXPECT_EQ(Table::Find("te"), 5);
+  EXPECT_EQ(Table::Find(""), Table::kNotFound);
+  EXPECT_EQ(Table::Find(":pat"), Table::kNotFound);
+  EXPECT_EQ(Table::Find("grpc-statuz"), Table::kNotFound);
+  EXPECT_EQ(Table::Find(":status"), Table::kNotFound);
+  grpc_metadata_batch map;
+  auto on_error = [](absl::string_view error, const Slice& value) {
+    LOG(ERROR) << error << " value:" << value.as_string_view();
+  };
+  map.Append("te", Slice::FromStaticString("trailers"), on_error);
+  map.Append("tf", Slice::FromStaticString("value"), on_error);
+  EXPECT_EQ(map.get(TeMetadata()), TeMetadata::kTrailers);
+  std::string buffer;
+  EXPECT_EQ(map.GetStringValue("tf", &buffer), "value");
+}
+
 TEST(DebugStringBuilderTest, OneAddAfterRedaction) {
   metadata_detail::DebugStringBuilder b;
   b.AddAfterRedaction(ContentTypeMetadata::key(), "AddValue01");
@@ -0,0 +1,41 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/ext/transport/chttp2/transport/http2_client_transport.h"
+#include "src/core/ext/transport/chttp2/transport/http2_server_transport.h"
+#include "test/core/transport/test_suite/chaotic_good_fixture_helpers.h"
+
+namespace grpc_core {
+
+TRANSPORT_FIXTURE(Http2) {
+  auto resource_quota = MakeResourceQuota("test");
+  EndpointPair endpoints =
+      CreateEndpointPair(event_engine.get(), resource_quota.get(), 1234);
+  auto channel_args =
+      ChannelArgs()
+          .SetObject(resource_quota)
+          .SetObject(
+              std::static_pointer_cast<
+                  grpc_event_engine::experimental::EventEngine>(event_engine));
+  auto client_transport = MakeOrphanable<http2::Http2ClientTransport>(
+      std::move(endpoints.client), channel_args, event_engine);
+  auto server_transport = MakeOrphanable<http2::Http2ServerTransport>(
+      std::move(endpoints.server), channel_args, event_engine);
+  return ClientAndServerTransportPair{std::move(client_transport),
+                                      std::move(server_transport)};
+}
+
+}  // namespace grpc_core
@@ -42,6 +42,10 @@
 
 const char kMaxConcurrentStreamsEnvironmentVariable[] =
     "GRPC_ALTS_MAX_CONCURRENT_HANDSHAKES";
+const char kHandshakeLatencyTargetEnvironmentVariable[] =
+    "GRPC_ALTS_HANDSHAKE_LATENCY_TARGET_MS";
+const char kHandshakerChannelsEnvironmentVariable[] =
+    "GRPC_ALTS_HANDSHAKER_CHANNELS";
 const size_t kHandshakerClientOpNum = 4;
 const size_t kMaxRpcVersionMajor = 3;
 const size_t kMaxRpcVersionMinor = 2;
@@ -530,6 +534,85 @@ TEST(MaxNumberOfConcurrentHandshakesTest, EnvVarSuccess) {
   EXPECT_EQ(MaxNumberOfConcurrentHandshakes(), 10);
 }
 
+TEST(HandshakeLatencyTargetTest, Default) {
+  grpc_core::UnsetEnv(kHandshakeLatencyTargetEnvironmentVariable);
+  EXPECT_EQ(HandshakeLatencyTarget(), grpc_core::Duration::Zero());
+}
+
+TEST(HandshakeLatencyTargetTest, EnvVarNegative) {
+  grpc_core::SetEnv(kHandshakeLatencyTargetEnvironmentVariable, "-10");
+  EXPECT_EQ(HandshakeLatencyTarget(), grpc_core::Duration::Zero());
+}
+
+TEST(HandshakeLatencyTargetTest, EnvVarSuccess) {
+  grpc_core::SetEnv(kHandshakeLatencyTargetEnvironmentVariable, "250");
+  EXPECT_EQ(HandshakeLatencyTarget(), grpc_core::Duration::Milliseconds(250));
+  grpc_core::UnsetEnv(kHandshakeLatencyTargetEnvironmentVariable);
+}
+
+TEST(NumberOfHandshakerChannelsTest, Default) {
+  grpc_core::UnsetEnv(kHandshakerChannelsEnvironmentVariable);
+  EXPECT_EQ(NumberOfHandshakerChannels(), 1);
+}
+
+TEST(NumberOfHandshakerChannelsTest, EnvVarZero) {
+  grpc_core::SetEnv(kHandshakerChannelsEnvironmentVariable, "0");
+  EXPECT_EQ(NumberOfHandshakerChannels(), 1);
+}
+
+TEST(NumberOfHandshakerChannelsTest, EnvVarSuccess) {
+  grpc_core::SetEnv(kHandshakerChannelsEnvironmentVariable, "4");
+  EXPECT_EQ(NumberOfHandshakerChannels(), 4);
+  grpc_core::UnsetEnv(kHandshakerChannelsEnvironmentVariable);
+}
+
+TEST(AdaptiveHandshakeLimitTest, DecreasesOncePerLatencyTarget) {
+  const grpc_core::Duration target = grpc_core::Duration::Milliseconds(100);
+  grpc_core::internal::AdaptiveHandshakeLimit limit(64, target);
+  EXPECT_EQ(limit.limit(), 64);
+  grpc_core::Timestamp now =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  limit.OnServiceResponse(grpc_core::Duration::Seconds(1), now);
+  EXPECT_EQ(limit.limit(), 32);
+  // Slow handshakes finishing within the same window were started before
+  // the cut.
+  limit.OnServiceResponse(grpc_core::Duration::Seconds(1), now + target / 2);
+  EXPECT_EQ(limit.limit(), 32);
+  limit.OnServiceResponse(grpc_core::Duration::Seconds(1), now + target);
+  EXPECT_EQ(limit.limit(), 16);
+}
+
+TEST(AdaptiveHandshakeLimitTest, IncreasesAdditively) {
+  const grpc_core::Duration target = grpc_core::Duration::Milliseconds(100);
+  grpc_core::internal::AdaptiveHandshakeLimit limit(8, target);
+  grpc_core::Timestamp now =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  limit.OnServiceResponse(grpc_core::Duration::Seconds(1), now);
+  EXPECT_EQ(limit.limit(), 4);
+  // About a limit's worth of fast handshakes raises it by one.
+  for (int i = 0; i < 5; ++i) {
+    limit.OnServiceResponse(grpc_core::Duration::Milliseconds(10), now);
+  }
+  EXPECT_EQ(limit.limit(), 5);
+  // The limit never exceeds its maximum.
+  for (int i = 0; i < 1000; ++i) {
+    limit.OnServiceResponse(grpc_core::Duration::Milliseconds(10), now);
+  }
+  EXPECT_EQ(limit.limit(), 8);
+}
+
+TEST(AdaptiveHandshakeLimitTest, NeverDropsBelowOne) {
+  const grpc_core::Duration target = grpc_core::Duration::Milliseconds(100);
+  grpc_core::internal::AdaptiveHandshakeLimit limit(4, target);
+  grpc_core::Timestamp now =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  for (int i = 0; i < 10; ++i) {
+    now += target;
+    limit.OnServiceResponse(grpc_core::Duration::Seconds(1), now);
+  }
+  EXPECT_EQ(limit.limit(), 1);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
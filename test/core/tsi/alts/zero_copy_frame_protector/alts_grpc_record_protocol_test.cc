@@ -18,12 +18,16 @@
 
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_record_protocol.h"
 
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <gtest/gtest.h>
+#include <string.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "absl/types/span.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_integrity_only_record_protocol.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_privacy_integrity_record_protocol.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_iovec_record_protocol.h"
@@ -342,6 +346,94 @@ static void empty_seal_unseal(alts_grpc_record_protocol* sender,
   }
 }
 
+static void frames_seal_unseal(alts_grpc_record_protocol* sender,
+                               alts_grpc_record_protocol* receiver) {
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_grpc_record_protocol_test_var* var =
+        alts_grpc_record_protocol_test_var_create();
+    // Seals as frames of at most max_frame_data_size bytes each.
+    size_t data_length = var->original_sb.length;
+    size_t max_frame_data_size =
+        gsec_test_bias_random_uint32(kMaxSliceLength) + 1;
+    tsi_result status = alts_grpc_record_protocol_protect_frames(
+        sender, &var->original_sb, max_frame_data_size, &var->protected_sb);
+    if (status == TSI_UNIMPLEMENTED) {
+      alts_grpc_record_protocol_test_var_destroy(var);
+      return;
+    }
+    ASSERT_EQ(status, TSI_OK);
+    ASSERT_EQ(var->original_sb.length, 0u);
+    size_t num_frames =
+        (data_length + max_frame_data_size - 1) / max_frame_data_size;
+    size_t frame_overhead = var->header_length + var->tag_length;
+    ASSERT_EQ(var->protected_sb.length,
+              data_length + num_frames * frame_overhead);
+    // Unseals the frames one at a time.
+    grpc_slice_buffer frame_sb;
+    grpc_slice_buffer_init(&frame_sb);
+    size_t remaining = data_length;
+    while (remaining > 0) {
+      size_t frame_data_size = std::min(remaining, max_frame_data_size);
+      grpc_slice_buffer_move_first(&var->protected_sb,
+                                   frame_data_size + frame_overhead, &frame_sb);
+      status = alts_grpc_record_protocol_unprotect(receiver, &frame_sb,
+                                                   &var->unprotected_sb);
+      ASSERT_EQ(status, TSI_OK);
+      remaining -= frame_data_size;
+    }
+    grpc_slice_buffer_destroy(&frame_sb);
+    ASSERT_EQ(var->protected_sb.length, 0u);
+    ASSERT_TRUE(
+        are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+    alts_grpc_record_protocol_test_var_destroy(var);
+  }
+}
+
+static void in_place_seal_unseal(alts_grpc_record_protocol* sender,
+                                 alts_grpc_record_protocol* receiver) {
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_grpc_record_protocol_test_var* var =
+        alts_grpc_record_protocol_test_var_create();
+    tsi_result status = alts_grpc_record_protocol_protect(
+        sender, &var->original_sb, &var->protected_sb);
+    ASSERT_EQ(status, TSI_OK);
+    // Moves the frame into a single slice, which is then exclusively owned.
+    grpc_slice frame = grpc_slice_buffer_take_first(&var->protected_sb);
+    if (var->protected_sb.length > 0) {
+      grpc_slice merged = GRPC_SLICE_MALLOC(GRPC_SLICE_LENGTH(frame) +
+                                            var->protected_sb.length);
+      memcpy(GRPC_SLICE_START_PTR(merged), GRPC_SLICE_START_PTR(frame),
+             GRPC_SLICE_LENGTH(frame));
+      grpc_slice_buffer_move_first_into_buffer(
+          &var->protected_sb, var->protected_sb.length,
+          GRPC_SLICE_START_PTR(merged) + GRPC_SLICE_LENGTH(frame));
+      grpc_core::CSliceUnref(frame);
+      frame = merged;
+    }
+    uint8_t* frame_start = GRPC_SLICE_START_PTR(frame);
+    grpc_slice_buffer_add(&var->protected_sb, frame);
+    status = alts_grpc_record_protocol_unprotect_in_place(
+        receiver, &var->protected_sb, &var->unprotected_sb);
+    if (status == TSI_UNIMPLEMENTED) {
+      // The frame is left for the regular unprotect.
+      ASSERT_EQ(var->protected_sb.count, 1u);
+      alts_grpc_record_protocol_test_var_destroy(var);
+      return;
+    }
+    ASSERT_EQ(status, TSI_OK);
+    ASSERT_EQ(var->protected_sb.length, 0u);
+    ASSERT_TRUE(
+        are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+    if (var->unprotected_sb.length > GRPC_SLICE_INLINED_SIZE) {
+      // The unprotected data was decrypted into the frame.
+      ASSERT_EQ(var->unprotected_sb.count, 1u);
+      ASSERT_EQ(GRPC_SLICE_START_PTR(var->unprotected_sb.slices[0]),
+                frame_start + var->header_length);
+    }
+    alts_grpc_record_protocol_test_var_destroy(var);
+  }
+}
+
 static void unsync_seal_unseal(alts_grpc_record_protocol* sender,
                                alts_grpc_record_protocol* receiver) {
   tsi_result status;
@@ -425,6 +517,18 @@ static void alts_grpc_record_protocol_empty_seal_unseal_tests(
   empty_seal_unseal(fixture->server_protect, fixture->client_unprotect);
 }
 
+static void alts_grpc_record_protocol_frames_seal_unseal_tests(
+    alts_grpc_record_protocol_test_fixture* fixture) {
+  frames_seal_unseal(fixture->client_protect, fixture->server_unprotect);
+  frames_seal_unseal(fixture->server_protect, fixture->client_unprotect);
+}
+
+static void alts_grpc_record_protocol_in_place_seal_unseal_tests(
+    alts_grpc_record_protocol_test_fixture* fixture) {
+  in_place_seal_unseal(fixture->client_protect, fixture->server_unprotect);
+  in_place_seal_unseal(fixture->server_protect, fixture->client_unprotect);
+}
+
 static void alts_grpc_record_protocol_unsync_seal_unseal_tests(
     alts_grpc_record_protocol_test_fixture* fixture) {
   unsync_seal_unseal(fixture->client_protect, fixture->server_unprotect);
@@ -463,6 +567,14 @@ static void alts_grpc_record_protocol_tests(
   auto* fixture_5 = fixture_create();
   alts_grpc_record_protocol_input_check_tests(fixture_5);
   alts_grpc_record_protocol_test_fixture_destroy(fixture_5);
+
+  auto* fixture_6 = fixture_create();
+  alts_grpc_record_protocol_frames_seal_unseal_tests(fixture_6);
+  alts_grpc_record_protocol_test_fixture_destroy(fixture_6);
+
+  auto* fixture_7 = fixture_create();
+  alts_grpc_record_protocol_in_place_seal_unseal_tests(fixture_7);
+  alts_grpc_record_protocol_test_fixture_destroy(fixture_7);
 }
 
 TEST(AltsGrpcRecordProtocolTest, MainTest) {
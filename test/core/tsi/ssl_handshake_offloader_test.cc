@@ -0,0 +1,108 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/handshake_offload/ssl_handshake_offloader.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/thd_id.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <set>
+
+#include "absl/synchronization/notification.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+
+namespace {
+
+TEST(SslHandshakeOffloaderTest, RunsCallbacksOffThread) {
+  tsi::SslHandshakeOffloader offloader(/*num_threads=*/2, /*max_queued=*/16);
+  const gpr_thd_id caller = gpr_thd_currentid();
+  Mutex mu;
+  std::set<gpr_thd_id> threads;
+  std::atomic<int> remaining{10};
+  absl::Notification done;
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(offloader.TryRun([&]() {
+      {
+        MutexLock lock(&mu);
+        threads.insert(gpr_thd_currentid());
+      }
+      if (remaining.fetch_sub(1) == 1) done.Notify();
+    }));
+  }
+  done.WaitForNotification();
+  MutexLock lock(&mu);
+  EXPECT_EQ(threads.count(caller), 0u);
+  EXPECT_LE(threads.size(), 2u);
+}
+
+TEST(SslHandshakeOffloaderTest, RejectsCallbacksWhenQueueIsFull) {
+  tsi::SslHandshakeOffloader offloader(/*num_threads=*/1, /*max_queued=*/2);
+  absl::Notification started;
+  absl::Notification release;
+  ASSERT_TRUE(offloader.TryRun([&]() {
+    started.Notify();
+    release.WaitForNotification();
+  }));
+  started.WaitForNotification();
+  EXPECT_TRUE(offloader.TryRun([]() {}));
+  EXPECT_TRUE(offloader.TryRun([]() {}));
+  EXPECT_EQ(offloader.QueuedForTesting(), 2u);
+  bool ran = false;
+  EXPECT_FALSE(offloader.TryRun([&ran]() { ran = true; }));
+  release.Notify();
+  EXPECT_FALSE(ran);
+}
+
+TEST(SslHandshakeOffloaderTest, DestructionRunsQueuedCallbacks) {
+  std::atomic<int> ran{0};
+  {
+    tsi::SslHandshakeOffloader offloader(/*num_threads=*/1,
+                                         /*max_queued=*/8);
+    for (int i = 0; i < 8; ++i) {
+      ASSERT_TRUE(offloader.TryRun([&ran]() { ran.fetch_add(1); }));
+    }
+  }
+  EXPECT_EQ(ran.load(), 8);
+}
+
+TEST(SslHandshakeOffloaderTest, SharedOffloader) {
+  tsi::SslHandshakeOffloader* offloader = tsi::SslHandshakeOffloader::Shared();
+  ASSERT_NE(offloader, nullptr);
+  EXPECT_EQ(offloader, tsi::SslHandshakeOffloader::Shared());
+  absl::Notification done;
+  ASSERT_TRUE(offloader->TryRun([&done]() { done.Notify(); }));
+  done.WaitForNotification();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
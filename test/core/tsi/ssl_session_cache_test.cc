@@ -182,6 +182,46 @@ TEST(SslSessionCacheTest, CapacityZeroCache) {
   SSL_CTX_free(ssl_ctx);
 }
 
+TEST(SslSessionCacheTest, ShardedCache) {
+  SessionTracker tracker;
+  {
+    RefCountedPtr<tsi::SslSessionLRUCache> cache =
+        tsi::SslSessionLRUCache::Create(1000, 8);
+    for (long id = 0; id < 100; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      cache->Put(domain.c_str(), tracker.NewSession(id));
+    }
+    EXPECT_EQ(cache->Size(), 100);
+    for (long id = 0; id < 100; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      EXPECT_NE(cache->Get(domain.c_str()), nullptr) << domain;
+    }
+    EXPECT_EQ(tracker.AliveCount(), 100);
+  }
+  EXPECT_EQ(tracker.AliveCount(), 0);
+}
+
+TEST(SslSessionCacheTest, ShardedCacheEvicts) {
+  SessionTracker tracker;
+  RefCountedPtr<tsi::SslSessionLRUCache> cache =
+      tsi::SslSessionLRUCache::Create(8, 4);
+  for (long id = 0; id < 100; id++) {
+    std::string domain = std::to_string(id) + ".random.domain";
+    cache->Put(domain.c_str(), tracker.NewSession(id));
+  }
+  // Each shard holds up to a quarter of the capacity.
+  EXPECT_LE(cache->Size(), 8);
+  EXPECT_EQ(tracker.AliveCount(), cache->Size());
+  // The most recent session of a shard is never evicted.
+  EXPECT_NE(cache->Get("99.random.domain"), nullptr);
+}
+
+TEST(SslSessionCacheTest, SharedCache) {
+  tsi::SslSessionLRUCache* cache = tsi::SslSessionLRUCache::Shared();
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache, tsi::SslSessionLRUCache::Shared());
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -18,7 +18,10 @@
 
 #include "src/core/tsi/ssl_transport_security.h"
 
+#include <arpa/inet.h>
 #include <grpc/grpc.h>
+#include <grpc/grpc_session_ticket_key_provider.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 #include <gtest/gtest.h>
@@ -28,10 +31,18 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <utility>
 
 #include "absl/log/log.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/tsi/ssl/handshake_offload/ssl_handshake_offloader.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/memory.h"
 #include "test/core/test_util/build.h"
@@ -311,6 +322,16 @@ class SslTransportSecurityTest
       session_ticket_key_size_ = session_ticket_key_size;
     }
 
+    void SetSessionTicketKeyProvider(
+        std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+            provider) {
+      session_ticket_key_provider_ = std::move(provider);
+    }
+
+    void SetOffloader(tsi::SslHandshakeOffloader* offloader) {
+      offloader_ = offloader;
+    }
+
     void SetBioBufSizes(size_t network_bio_buf_size, size_t ssl_bio_buf_size) {
       network_bio_buf_size_ = network_bio_buf_size;
       ssl_bio_buf_size_ = ssl_bio_buf_size;
@@ -392,6 +413,8 @@ class SslTransportSecurityTest
       server_options.session_ticket_key = ssl_fixture->session_ticket_key_;
       server_options.session_ticket_key_size =
           ssl_fixture->session_ticket_key_size_;
+      server_options.session_ticket_key_provider =
+          ssl_fixture->session_ticket_key_provider_;
       server_options.min_tls_version = ssl_fixture->tls_version_;
       server_options.max_tls_version = ssl_fixture->tls_version_;
       ASSERT_EQ(tsi_create_ssl_server_handshaker_factory_with_options(
@@ -411,6 +434,12 @@ class SslTransportSecurityTest
                     ssl_fixture->ssl_bio_buf_size_,
                     &ssl_fixture->base_.server_handshaker),
                 TSI_OK);
+      if (ssl_fixture->offloader_ != nullptr) {
+        tsi_ssl_handshaker_set_offloader(ssl_fixture->base_.client_handshaker,
+                                         ssl_fixture->offloader_);
+        tsi_ssl_handshaker_set_offloader(ssl_fixture->base_.server_handshaker,
+                                         ssl_fixture->offloader_);
+      }
     }
 
     static void CheckAlpn(SslTsiTestFixture* ssl_fixture,
@@ -650,6 +679,9 @@ class SslTransportSecurityTest
     bool session_reused_;
     const char* session_ticket_key_ = nullptr;
     size_t session_ticket_key_size_;
+    std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+        session_ticket_key_provider_;
+    tsi::SslHandshakeOffloader* offloader_ = nullptr;
     size_t network_bio_buf_size_;
     size_t ssl_bio_buf_size_;
     bool verify_root_cert_subject_;
@@ -734,6 +766,18 @@ TEST_P(SslTransportSecurityTest, DoHandshake) {
   DoHandshake();
 }
 
+TEST_P(SslTransportSecurityTest, DoHandshakeOffloaded) {
+  LOG(INFO) << "ssl_tsi_test_do_handshake_offloaded";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  tsi::SslHandshakeOffloader offloader(/*num_threads=*/2, /*max_queued=*/4);
+  ssl_fixture_->SetOffloader(&offloader);
+  ssl_tsi_test_fixture_->handshake_buffer_size =
+      TSI_TEST_SMALL_HANDSHAKE_BUFFER_SIZE;
+  DoHandshake();
+  DestroyFixture();
+}
+
 TEST_P(SslTransportSecurityTest, DoHandshakeWithRootStore) {
   LOG(INFO) << "ssl_tsi_test_do_handshake_with_root_store";
   SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
@@ -984,6 +1028,46 @@ TEST_P(SslTransportSecurityTest, DoHandshakeSessionCache) {
   do_handshake(true);
   tsi_ssl_session_cache_unref(session_cache);
 }
+
+TEST_P(SslTransportSecurityTest, DoHandshakeSessionTicketKeyProvider) {
+  LOG(INFO) << "ssl_tsi_test_do_handshake_session_ticket_key_provider";
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  auto provider = grpc_core::experimental::
+      CreateRotatingSessionTicketKeyProvider(std::string(32, 'a'));
+  ASSERT_TRUE(provider.ok());
+  auto do_handshake =
+      [this, &session_cache](
+          std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>
+              provider,
+          bool session_reused) {
+        SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                        /*send_client_ca_list=*/std::get<1>(GetParam()));
+        ssl_fixture_->SetServerNameIndication(
+            const_cast<char*>("waterzooi.test.google.be"));
+        ssl_fixture_->SetSessionTicketKeyProvider(std::move(provider));
+        tsi_ssl_session_cache_ref(session_cache);
+        ssl_fixture_->SetSessionCache(session_cache);
+        ssl_fixture_->SetSessionReused(session_reused);
+        DoRoundTrip();
+        DestroyFixture();
+      };
+  do_handshake(*provider, false);
+  do_handshake(*provider, true);
+  // A server with the same secret accepts the tickets of the first one.
+  auto other_provider = grpc_core::experimental::
+      CreateRotatingSessionTicketKeyProvider(std::string(32, 'a'));
+  ASSERT_TRUE(other_provider.ok());
+  do_handshake(*other_provider, true);
+  // Tickets issued before a rotation are still accepted.
+  ASSERT_TRUE((*provider)->Rotate(std::string(32, 'b')).ok());
+  do_handshake(*provider, true);
+  // A server with another secret does not.
+  other_provider = grpc_core::experimental::
+      CreateRotatingSessionTicketKeyProvider(std::string(32, 'd'));
+  ASSERT_TRUE(other_provider.ok());
+  do_handshake(*other_provider, false);
+  tsi_ssl_session_cache_unref(session_cache);
+}
 #endif  // OPENSSL_IS_BORINGSSL
 
 TEST_P(SslTransportSecurityTest, DoHandshakeAlpnServerNoClient) {
@@ -1015,6 +1099,117 @@ TEST_P(SslTransportSecurityTest, DoHandshakeWithCustomBioPair) {
   DoHandshake();
 }
 
+// Connects two TCP sockets over the loopback interface.
+static bool ssl_tsi_test_connect_tcp_sockets(int* client_fd, int* server_fd) {
+  int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd < 0) return false;
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addr_len = sizeof(addr);
+  bool ok = bind(listen_fd, reinterpret_cast<sockaddr*>(&addr),
+                 sizeof(addr)) == 0 &&
+            listen(listen_fd, 1) == 0 &&
+            getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr),
+                        &addr_len) == 0;
+  *client_fd = ok ? socket(AF_INET, SOCK_STREAM, 0) : -1;
+  ok = *client_fd >= 0 &&
+       connect(*client_fd, reinterpret_cast<sockaddr*>(&addr),
+               sizeof(addr)) == 0;
+  *server_fd = ok ? accept(listen_fd, nullptr, nullptr) : -1;
+  close(listen_fd);
+  if (*server_fd < 0) {
+    if (*client_fd >= 0) close(*client_fd);
+    return false;
+  }
+  return true;
+}
+
+// Reads from |fd| until |size| bytes have been received.
+static std::string ssl_tsi_test_read_exactly(int fd, size_t size) {
+  std::string bytes(size, '\0');
+  size_t offset = 0;
+  while (offset < size) {
+    ssize_t n = read(fd, &bytes[offset], size - offset);
+    if (n <= 0) break;
+    offset += static_cast<size_t>(n);
+  }
+  bytes.resize(offset);
+  return bytes;
+}
+
+TEST_P(SslTransportSecurityTest, KernelTlsProtector) {
+  LOG(INFO) << "ssl_tsi_test_kernel_tls_protector";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  DoHandshake();
+  tsi_handshaker_result* client_result = ssl_tsi_test_fixture_->client_result;
+  tsi_handshaker_result* server_result = ssl_tsi_test_fixture_->server_result;
+  ASSERT_NE(client_result, nullptr);
+  ASSERT_NE(server_result, nullptr);
+  tsi_zero_copy_grpc_protector* client_protector = nullptr;
+  // Only TCP sockets can be offloaded. Failing leaves the result usable.
+  int unix_fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, unix_fds), 0);
+  EXPECT_EQ(tsi_handshaker_result_create_kernel_tls_protector(
+                client_result, unix_fds[0], nullptr, &client_protector),
+            TSI_UNIMPLEMENTED);
+  close(unix_fds[0]);
+  close(unix_fds[1]);
+  int client_fd;
+  int server_fd;
+  ASSERT_TRUE(ssl_tsi_test_connect_tcp_sockets(&client_fd, &server_fd));
+  tsi_result result = tsi_handshaker_result_create_kernel_tls_protector(
+      client_result, client_fd, nullptr, &client_protector);
+  if (result == TSI_UNIMPLEMENTED) {
+    close(client_fd);
+    close(server_fd);
+    GTEST_SKIP() << "kernel TLS is not available for this connection";
+  }
+  ASSERT_EQ(result, TSI_OK);
+  tsi_frame_protector* server_protector = nullptr;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                server_result, nullptr, &server_protector),
+            TSI_OK);
+  const std::string message = "kernel encrypted message";
+  // Protecting leaves the data as it is, and the kernel encrypts it.
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_add(&unprotected,
+                        grpc_slice_from_copied_string(message.c_str()));
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(
+                client_protector, &unprotected, &protected_slices),
+            TSI_OK);
+  ASSERT_EQ(protected_slices.count, 1u);
+  grpc_slice plain = protected_slices.slices[0];
+  ASSERT_EQ(write(client_fd, GRPC_SLICE_START_PTR(plain),
+                  GRPC_SLICE_LENGTH(plain)),
+            static_cast<ssize_t>(message.size()));
+  grpc_slice_buffer_reset_and_unref(&protected_slices);
+  // A TLS 1.3 record adds a 5 byte header, the content type and a 16 byte tag.
+  std::string record =
+      ssl_tsi_test_read_exactly(server_fd, message.size() + 22);
+  size_t record_size = record.size();
+  unsigned char received[1024];
+  size_t received_size = sizeof(received);
+  ASSERT_EQ(tsi_frame_protector_unprotect(
+                server_protector,
+                reinterpret_cast<const unsigned char*>(record.data()),
+                &record_size, received, &received_size),
+            TSI_OK);
+  EXPECT_EQ(std::string(reinterpret_cast<char*>(received), received_size),
+            message);
+  grpc_slice_buffer_destroy(&unprotected);
+  grpc_slice_buffer_destroy(&protected_slices);
+  tsi_frame_protector_destroy(server_protector);
+  tsi_zero_copy_grpc_protector_destroy(client_protector);
+  close(client_fd);
+  close(server_fd);
+}
+
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
 static bool handshaker_factory_destructor_called;
 
@@ -0,0 +1,150 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
+
+#include <gtest/gtest.h>
+#include <openssl/bio.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/time/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/core/test_util/tls_utils.h"
+
+#define SSL_TSI_TEST_CREDENTIALS_DIR "src/core/tsi/test_creds/"
+
+namespace tsi {
+namespace {
+
+X509* LoadCert(const std::string& name) {
+  std::string pem = grpc_core::testing::GetFileContents(
+      std::string(SSL_TSI_TEST_CREDENTIALS_DIR) + name);
+  BIO* bio = BIO_new_mem_buf(pem.data(), static_cast<int>(pem.size()));
+  X509* cert = PEM_read_bio_X509(bio, nullptr, nullptr, nullptr);
+  BIO_free(bio);
+  EXPECT_NE(cert, nullptr) << name;
+  return cert;
+}
+
+class SslVerificationCacheTest : public ::testing::Test {
+ protected:
+  SslVerificationCacheTest() {
+    root_ = LoadCert("ca.pem");
+    store_ = X509_STORE_new();
+    X509_STORE_add_cert(store_, root_);
+    untrusted_ = sk_X509_new_null();
+  }
+
+  ~SslVerificationCacheTest() override {
+    for (X509_STORE_CTX* ctx : contexts_) X509_STORE_CTX_free(ctx);
+    for (X509* leaf : leaves_) X509_free(leaf);
+    sk_X509_pop_free(untrusted_, X509_free);
+    X509_STORE_free(store_);
+    X509_free(root_);
+  }
+
+  // Returns a context for verifying the leaf read from leaf_name. The context
+  // does not own the leaf, so both are freed with the fixture.
+  X509_STORE_CTX* NewContext(const std::string& leaf_name,
+                             STACK_OF(X509) * untrusted = nullptr) {
+    X509* leaf = LoadCert(leaf_name);
+    X509_STORE_CTX* ctx = X509_STORE_CTX_new();
+    EXPECT_EQ(X509_STORE_CTX_init(ctx, store_, leaf, untrusted), 1);
+    leaves_.push_back(leaf);
+    contexts_.push_back(ctx);
+    return ctx;
+  }
+
+  // Verifies the leaf read from leaf_name and inserts the result in cache.
+  void VerifyAndInsert(SslVerificationCache* cache,
+                       const std::string& leaf_name,
+                       STACK_OF(X509) * untrusted = nullptr) {
+    X509_STORE_CTX* ctx = NewContext(leaf_name, untrusted);
+    ASSERT_EQ(X509_verify_cert(ctx), 1) << leaf_name;
+    cache->Insert(ctx);
+  }
+
+  // Whether looking up the leaf read from leaf_name finds the test root.
+  bool Hits(SslVerificationCache* cache, const std::string& leaf_name,
+            STACK_OF(X509) * untrusted = nullptr) {
+    X509* root = cache->Lookup(NewContext(leaf_name, untrusted));
+    if (root == nullptr) return false;
+    EXPECT_EQ(X509_cmp(root, root_), 0);
+    X509_free(root);
+    return true;
+  }
+
+  X509* root_;
+  X509_STORE* store_;
+  STACK_OF(X509) * untrusted_;
+  std::vector<X509*> leaves_;
+  std::vector<X509_STORE_CTX*> contexts_;
+};
+
+TEST_F(SslVerificationCacheTest, InsertedChainIsFound) {
+  SslVerificationCache cache(16, absl::Hours(1));
+  EXPECT_FALSE(Hits(&cache, "client.pem"));
+  VerifyAndInsert(&cache, "client.pem");
+  EXPECT_EQ(cache.Size(), 1u);
+  EXPECT_TRUE(Hits(&cache, "client.pem"));
+  EXPECT_FALSE(Hits(&cache, "server1.pem"));
+  // Reinserting the same chain replaces its entry.
+  VerifyAndInsert(&cache, "client.pem");
+  EXPECT_EQ(cache.Size(), 1u);
+}
+
+TEST_F(SslVerificationCacheTest, ExpiredChainIsNotReused) {
+  SslVerificationCache cache(16, absl::ZeroDuration());
+  VerifyAndInsert(&cache, "client.pem");
+  EXPECT_EQ(cache.Size(), 1u);
+  EXPECT_FALSE(Hits(&cache, "client.pem"));
+  EXPECT_EQ(cache.Size(), 0u);
+}
+
+TEST_F(SslVerificationCacheTest, LeastRecentlyUsedChainIsEvicted) {
+  SslVerificationCache cache(2, absl::Hours(1));
+  VerifyAndInsert(&cache, "client.pem");
+  VerifyAndInsert(&cache, "server1.pem");
+  EXPECT_TRUE(Hits(&cache, "client.pem"));
+  VerifyAndInsert(&cache, "server0.pem");
+  EXPECT_EQ(cache.Size(), 2u);
+  EXPECT_TRUE(Hits(&cache, "client.pem"));
+  EXPECT_FALSE(Hits(&cache, "server1.pem"));
+  EXPECT_TRUE(Hits(&cache, "server0.pem"));
+}
+
+TEST_F(SslVerificationCacheTest, IntermediatesArePartOfTheKey) {
+  SslVerificationCache cache(16, absl::Hours(1));
+  sk_X509_push(untrusted_, LoadCert("intermediate_ca.pem"));
+  VerifyAndInsert(&cache, "leaf_signed_by_intermediate.pem", untrusted_);
+  EXPECT_TRUE(Hits(&cache, "leaf_signed_by_intermediate.pem", untrusted_));
+  EXPECT_FALSE(Hits(&cache, "leaf_signed_by_intermediate.pem"));
+}
+
+}  // namespace
+}  // namespace tsi
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
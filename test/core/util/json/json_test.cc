@@ -164,6 +164,20 @@ TEST(Json, EscapesAndControlCharactersInKeyStrings) {
                  "{\"\":0,\"\\u007f\\u007f\\n\\r\\\"\\f\\b\\\\a , b\":1}");
 }
 
+TEST(Json, LongStrings) {
+  // Plain runs longer than a word, broken up by escapes and UTF-8.
+  RunSuccessTest(
+      "{\"service_config_key\": \"abcdefghijklmnop\\n\u00dfqrstuvwxyz0123"
+      "\\u0041\\ud834\\udd1e456789\\\"ABCDEFGHIJ\"}",
+      Json::FromObject(
+          {{"service_config_key",
+            Json::FromString("abcdefghijklmnop\n\u00dfqrstuvwxyz0123A"
+                             "\xf0\x9d\x84\x9e"
+                             "456789\"ABCDEFGHIJ")}}),
+      "{\"service_config_key\":\"abcdefghijklmnop\\n\\u00dfqrstuvwxyz0123"
+      "A\\ud834\\udd1e456789\\\"ABCDEFGHIJ\"}");
+}
+
 TEST(Json, WriterCutsOffInvalidUtf8) {
   EXPECT_EQ(JsonDump(Json::FromString("abc\xf0\x9d\x24")), "\"abc\"");
   EXPECT_EQ(JsonDump(Json::FromString("\xff")), "\"\"");
@@ -248,6 +262,13 @@ TEST(Json, EmbeddedInvalidWhitechars) {
   RunParseFailureTest("\"\t\"");
 }
 
+TEST(Json, InvalidLongStrings) {
+  RunParseFailureTest("\"abcdefghijklmnop\nqrstuvwxyz\"");
+  RunParseFailureTest("\"abcdefghijklmnop\xc0\xbcqrstuvwxyz\"");
+  RunParseFailureTest("\"abcdefghijklmnop\\ud834qrstuvwxyz\"");
+  RunParseFailureTest("\"abcdefghijklmnopqrstuvwxyz");
+}
+
 TEST(Json, EmptyString) { RunParseFailureTest(""); }
 
 TEST(Json, ExtraCharsAtEndOfParsing) {
@@ -0,0 +1,68 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/latency_sketch.h"
+
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::DoubleNear;
+
+TEST(LatencySketchTest, Empty) {
+  LatencySketch sketch;
+  LatencySketch::Summary summary = sketch.Summarize();
+  EXPECT_EQ(summary.count, 0);
+  EXPECT_EQ(summary.p99, 0);
+  EXPECT_EQ(summary.max, 0);
+}
+
+TEST(LatencySketchTest, Percentiles) {
+  LatencySketch sketch;
+  for (int i = 1; i <= 10000; ++i) sketch.Record(i / 10000.0);
+  LatencySketch::Summary summary = sketch.Summarize();
+  EXPECT_EQ(summary.count, 10000);
+  EXPECT_THAT(summary.p50, DoubleNear(0.5, 0.01));
+  EXPECT_THAT(summary.p90, DoubleNear(0.9, 0.01));
+  EXPECT_THAT(summary.p99, DoubleNear(0.99, 0.005));
+  EXPECT_EQ(summary.max, 1.0);
+}
+
+TEST(LatencySketchTest, MergesThreads) {
+  LatencySketch sketch;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&sketch, t]() {
+      for (int i = 0; i < 1000; ++i) sketch.Record(t == 0 ? 1.0 : 0.01);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  LatencySketch::Summary summary = sketch.Summarize();
+  EXPECT_EQ(summary.count, 8000);
+  EXPECT_THAT(summary.p50, DoubleNear(0.01, 1e-9));
+  EXPECT_EQ(summary.max, 1.0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
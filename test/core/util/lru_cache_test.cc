@@ -16,6 +16,10 @@
 
 #include "src/core/util/lru_cache.h"
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "absl/log/check.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
@@ -99,6 +103,94 @@ TEST(LruCache, SetMaxSize) {
   }
 }
 
+TEST(ShardedLruCache, Basic) {
+  std::vector<int> created_list;
+  auto create = [&](const std::string& key) {
+    int value;
+    CHECK(absl::SimpleAtoi(key, &value));
+    created_list.push_back(value);
+    return value;
+  };
+  // One shard, so that eviction order is predictable.
+  ShardedLruCache<std::string, int> cache(4, /*num_shards=*/1);
+  for (int i = 0; i < 4; ++i) {
+    std::string key = absl::StrCat(i);
+    EXPECT_EQ(std::nullopt, cache.Get(key));
+    EXPECT_EQ(i, cache.GetOrInsert(key, create));
+  }
+  EXPECT_THAT(created_list, ::testing::ElementsAre(0, 1, 2, 3));
+  created_list.clear();
+  // Read 0 and 1, so that they get a second chance.
+  EXPECT_EQ(0, cache.Get("0"));
+  EXPECT_EQ(1, cache.GetOrInsert("1", create));
+  EXPECT_THAT(created_list, ::testing::ElementsAre());
+  // Inserting a new entry evicts the first entry that was not read.
+  EXPECT_EQ(9, cache.GetOrInsert("9", create));
+  EXPECT_THAT(created_list, ::testing::ElementsAre(9));
+  EXPECT_EQ(0, cache.Get("0"));
+  EXPECT_EQ(1, cache.Get("1"));
+  EXPECT_EQ(std::nullopt, cache.Get("2"));
+  EXPECT_EQ(3, cache.Get("3"));
+  EXPECT_EQ(9, cache.Get("9"));
+  auto stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 6);
+  EXPECT_EQ(stats.misses, 10);
+  EXPECT_EQ(stats.evictions, 1);
+}
+
+TEST(ShardedLruCache, SetCapacity) {
+  auto create = [&](const std::string& key) {
+    int value;
+    CHECK(absl::SimpleAtoi(key, &value));
+    return value;
+  };
+  ShardedLruCache<std::string, int> cache(10, /*num_shards=*/1);
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_EQ(i, cache.GetOrInsert(absl::StrCat(i), create));
+  }
+  cache.SetCapacity(6);
+  int present = 0;
+  for (int i = 1; i <= 10; ++i) {
+    if (cache.Get(absl::StrCat(i)).has_value()) ++present;
+  }
+  EXPECT_EQ(present, 6);
+  EXPECT_EQ(cache.GetStats().evictions, 4);
+}
+
+TEST(ShardedLruCache, ChargeLimitsSize) {
+  // Each entry is charged the length of its value.
+  ShardedLruCache<int, std::string> cache(
+      10, /*num_shards=*/1,
+      [](const int&, const std::string& value) { return value.size(); });
+  auto create = [](const int& key) { return std::string(key, 'x'); };
+  EXPECT_EQ(cache.GetOrInsert(4, create), "xxxx");
+  EXPECT_EQ(cache.GetOrInsert(5, create), "xxxxx");
+  EXPECT_EQ(cache.GetStats().evictions, 0);
+  // 4 + 5 + 3 is over 10, so the oldest entry goes.
+  EXPECT_EQ(cache.GetOrInsert(3, create), "xxx");
+  EXPECT_EQ(cache.Get(4), std::nullopt);
+  EXPECT_EQ(cache.Get(5), "xxxxx");
+  EXPECT_EQ(cache.Get(3), "xxx");
+}
+
+TEST(ShardedLruCache, ConcurrentUse) {
+  ShardedLruCache<int, int> cache(64, /*num_shards=*/4);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache]() {
+      for (int i = 0; i < 10000; ++i) {
+        int value =
+            cache.GetOrInsert(i % 100, [](const int& key) { return key * 2; });
+        EXPECT_EQ(value, (i % 100) * 2);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  auto stats = cache.GetStats();
+  EXPECT_EQ(stats.hits + stats.misses, 40000);
+  EXPECT_GE(stats.misses, 100);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
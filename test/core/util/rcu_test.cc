@@ -0,0 +1,117 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/util/rcu.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+namespace {
+
+class Value : public RefCounted<Value> {
+ public:
+  explicit Value(int value) : value_(value) {}
+  ~Value() override { value_ = -1; }
+
+  int value() const { return value_; }
+
+ private:
+  int value_;
+};
+
+TEST(RcuTest, StartsEmpty) {
+  Rcu<RefCountedPtr<Value>> rcu;
+  EXPECT_EQ(rcu.Get(), nullptr);
+}
+
+TEST(RcuTest, ExchangeReturnsPreviousValue) {
+  Rcu<RefCountedPtr<Value>> rcu;
+  EXPECT_EQ(rcu.Exchange(MakeRefCounted<Value>(1)), nullptr);
+  EXPECT_EQ(rcu.Get()->value(), 1);
+  RefCountedPtr<Value> displaced = rcu.Exchange(MakeRefCounted<Value>(2));
+  ASSERT_NE(displaced, nullptr);
+  EXPECT_EQ(displaced->value(), 1);
+  EXPECT_EQ(rcu.Get()->value(), 2);
+}
+
+TEST(RcuTest, ExchangeRetiresPreviousValue) {
+  Rcu<std::shared_ptr<int>> rcu;
+  auto first = std::make_shared<int>(1);
+  rcu.Exchange(first);
+  EXPECT_EQ(first.use_count(), 2);
+  // The caller gets the only copy left of the displaced value.
+  std::shared_ptr<int> displaced = rcu.Exchange(std::make_shared<int>(2));
+  EXPECT_EQ(displaced, first);
+  EXPECT_EQ(first.use_count(), 2);
+  displaced.reset();
+  EXPECT_EQ(first.use_count(), 1);
+}
+
+TEST(RcuTest, ReadDoesNotCopy) {
+  Rcu<std::unique_ptr<int>> rcu;
+  rcu.Exchange(std::make_unique<int>(3));
+  EXPECT_EQ(rcu.Read([](const std::unique_ptr<int>& value) { return *value; }),
+            3);
+}
+
+struct Tracked {
+  explicit Tracked(int value) : value(value) {}
+  ~Tracked() { value = -1; }
+  int value;
+};
+
+TEST(RcuTest, ReadersNeverSeeDestroyedValues) {
+  Rcu<std::unique_ptr<Tracked>> rcu;
+  rcu.Exchange(std::make_unique<Tracked>(0));
+  auto read = [&rcu]() {
+    return rcu.Read(
+        [](const std::unique_ptr<Tracked>& tracked) { return tracked->value; });
+  };
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&]() {
+      int last = 0;
+      while (!done.load()) {
+        // Destroyed values read as -1, and values only ever increase.
+        const int value = read();
+        EXPECT_GE(value, last);
+        last = value;
+      }
+    });
+  }
+  for (int i = 1; i <= 10000; ++i) {
+    rcu.Exchange(std::make_unique<Tracked>(i));
+  }
+  done.store(true);
+  for (auto& reader : readers) reader.join();
+  EXPECT_EQ(read(), 10000);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -17,6 +17,11 @@
 #include "src/core/util/status_helper.h"
 
 #include <stddef.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <new>
+#include <string>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
@@ -27,6 +32,19 @@
 #include "gtest/gtest.h"
 #include "upb/mem/arena.hpp"
 
+// Counts allocations, so that tests can check that OK statuses stay cheap.
+static std::atomic<size_t> g_allocations{0};
+
+void* operator new(size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
 namespace grpc_core {
 namespace {
 
@@ -76,6 +94,30 @@ TEST(StatusUtilTest, SetAndGetTime) {
   EXPECT_EQ(t, StatusGetTime(s, StatusTimeProperty::kCreated));
 }
 
+TEST(StatusUtilTest, TimeRoundTripsThroughProto) {
+  absl::Status s = absl::CancelledError();
+  absl::Time t = absl::Now();
+  StatusSetTime(&s, StatusTimeProperty::kCreated, t);
+  upb::Arena arena;
+  absl::Status s2 =
+      internal::StatusFromProto(internal::StatusToProto(s, arena.ptr()));
+  EXPECT_EQ(t, StatusGetTime(s2, StatusTimeProperty::kCreated));
+}
+
+TEST(StatusUtilTest, OkStatusDoesNotAllocate) {
+  const std::string long_str(100, 'x');
+  absl::Status child = absl::CancelledError(long_str);
+  const size_t before = g_allocations.load();
+  absl::Status s = StatusCreate(absl::StatusCode::kOk, long_str,
+                                DEBUG_LOCATION, {});
+  StatusSetInt(&s, StatusIntProperty::kStreamId, 2021);
+  StatusSetStr(&s, StatusStrProperty::kDescription, long_str);
+  StatusSetTime(&s, StatusTimeProperty::kCreated, absl::Now());
+  StatusAddChild(&s, child);
+  EXPECT_EQ(g_allocations.load(), before);
+  EXPECT_TRUE(s.ok());
+}
+
 TEST(StatusUtilTest, GetTimeNotExistent) {
   absl::Status s = absl::CancelledError();
   EXPECT_EQ(std::optional<absl::Time>(),
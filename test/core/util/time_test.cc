@@ -104,6 +104,27 @@ TEST(DurationTest, ToString) {
   EXPECT_EQ(Duration::NegativeInfinity().ToString(), "-∞");
 }
 
+TEST(TscClockTest, TracksMonotonicClock) {
+  if (!EnableTscClock()) GTEST_SKIP() << "No invariant TSC";
+  auto monotonic_now = []() {
+    return Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC));
+  };
+  // Runs past calibration and the first re-sync.
+  const Timestamp end = monotonic_now() + Duration::Milliseconds(1500);
+  Timestamp last = Timestamp::ProcessEpoch();
+  for (Timestamp before = monotonic_now(); before < end;
+       before = monotonic_now()) {
+    const Timestamp now = Timestamp::Now();
+    const Timestamp after = monotonic_now();
+    ASSERT_GE(now, last);
+    last = now;
+    // Skips readings that were interrupted.
+    if (after - before > Duration::Milliseconds(1)) continue;
+    ASSERT_GE(now, before - Duration::Milliseconds(1));
+    ASSERT_LE(now, after + Duration::Milliseconds(1));
+  }
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
@@ -265,6 +265,35 @@ TEST(WorkSerializerTest, WorkSerializerDestructionRaceMultipleThreads) {
   WaitForSingleOwner(GetDefaultEventEngine());
 }
 
+TEST(WorkSerializerTest, RunUrgentJumpsQueue) {
+  auto lock = std::make_unique<WorkSerializer>(GetDefaultEventEngine());
+  Notification started;
+  Notification release;
+  std::vector<int> order;
+  lock->Run(
+      [&]() {
+        started.Notify();
+        release.WaitForNotification();
+      },
+      DEBUG_LOCATION);
+  started.WaitForNotification();
+  lock->Run([&order]() { order.push_back(1); }, DEBUG_LOCATION);
+  lock->Run([&order]() { order.push_back(2); }, DEBUG_LOCATION);
+  lock->RunUrgent([&order]() { order.push_back(3); }, DEBUG_LOCATION);
+  lock->RunUrgent([&order]() { order.push_back(4); }, DEBUG_LOCATION);
+  Notification done;
+  lock->Run([&done]() { done.Notify(); }, DEBUG_LOCATION);
+  release.Notify();
+  done.WaitForNotification();
+  if (IsWorkSerializerUrgentLaneEnabled()) {
+    EXPECT_EQ(order, (std::vector<int>{3, 4, 1, 2}));
+  } else {
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4}));
+  }
+  lock.reset();
+  WaitForSingleOwner(GetDefaultEventEngine());
+}
+
 TEST(WorkSerializerTest, MetricsWork) {
   auto serializer = std::make_unique<WorkSerializer>(GetDefaultEventEngine());
   auto schedule_sleep = [&serializer](absl::Duration how_long) {
@@ -711,6 +711,7 @@ TEST(XdsBootstrapTest, XdsServerToJsonAndParse) {
       "      ],"
       "      \"ignore\": 0,"
       "      \"server_features\": ["
+      "        \"delta_xds\","
       "        \"fail_on_data_errors\","
       "        \"ignore_resource_deletion\","
       "        \"trusted_xds_server\""
@@ -720,6 +721,7 @@ TEST(XdsBootstrapTest, XdsServerToJsonAndParse) {
   ASSERT_TRUE(json.ok()) << json.status();
   auto xds_server = LoadFromJson<GrpcXdsServer>(*json);
   ASSERT_TRUE(xds_server.ok()) << xds_server.status();
+  EXPECT_TRUE(xds_server->UseDeltaProtocol());
   Json output = xds_server->ToJson();
   auto output_xds_server = LoadFromJson<GrpcXdsServer>(output);
   ASSERT_TRUE(output_xds_server.ok()) << output_xds_server.status();
@@ -27,6 +27,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <fstream>
 #include <map>
@@ -71,6 +72,8 @@
 // IWYU pragma: no_include "google/protobuf/util/json_util.h"
 
 using envoy::admin::v3::ClientResourceStatus;
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 using envoy::service::status::v3::ClientConfig;
@@ -140,11 +143,13 @@ class XdsClientTest : public ::testing::Test {
       explicit FakeXdsServer(
           absl::string_view server_uri = kDefaultXdsServerUrl,
           bool fail_on_data_errors = false,
-          bool resource_timer_is_transient_failure = false)
+          bool resource_timer_is_transient_failure = false,
+          bool use_delta_protocol = false)
           : server_uri_(server_uri),
             fail_on_data_errors_(fail_on_data_errors),
             resource_timer_is_transient_failure_(
-                resource_timer_is_transient_failure) {}
+                resource_timer_is_transient_failure),
+            use_delta_protocol_(use_delta_protocol) {}
       const std::string& server_uri() const override { return server_uri_; }
       bool IgnoreResourceDeletion() const override {
         return !fail_on_data_errors_;
@@ -153,19 +158,23 @@ class XdsClientTest : public ::testing::Test {
       bool ResourceTimerIsTransientFailure() const override {
         return resource_timer_is_transient_failure_;
       }
+      bool UseDeltaProtocol() const override { return use_delta_protocol_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return server_uri_ == o.server_uri_ &&
-               fail_on_data_errors_ == o.fail_on_data_errors_;
+               fail_on_data_errors_ == o.fail_on_data_errors_ &&
+               use_delta_protocol_ == o.use_delta_protocol_;
       }
       std::string Key() const override {
-        return absl::StrCat(server_uri_, "#", fail_on_data_errors_);
+        return absl::StrCat(server_uri_, "#", fail_on_data_errors_, "#",
+                            use_delta_protocol_);
       }
 
      private:
       std::string server_uri_;
       bool fail_on_data_errors_ = false;
       bool resource_timer_is_transient_failure_ = false;
+      bool use_delta_protocol_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -444,6 +453,7 @@ class XdsClientTest : public ::testing::Test {
     XdsResourceType::DecodeResult Decode(
         const XdsResourceType::DecodeContext& /*context*/,
         absl::string_view serialized_resource) const override {
+      num_decodes_.fetch_add(1, std::memory_order_relaxed);
       auto json = JsonParse(serialized_resource);
       XdsResourceType::DecodeResult result;
       if (!json.ok()) {
@@ -466,6 +476,11 @@ class XdsClientTest : public ::testing::Test {
     }
     void InitUpbSymtab(XdsClient*, upb_DefPool* /*symtab*/) const override {}
 
+    // The number of times Decode() has been called, for any instance.
+    static size_t num_decodes() {
+      return num_decodes_.load(std::memory_order_relaxed);
+    }
+
     static google::protobuf::Any EncodeAsAny(const ResourceStruct& resource) {
       google::protobuf::Any any;
       any.set_type_url(
@@ -473,6 +488,9 @@ class XdsClientTest : public ::testing::Test {
       any.set_value(resource.AsJsonString());
       return any;
     }
+
+   private:
+    static inline std::atomic<size_t> num_decodes_{0};
   };
 
   // A fake "Foo" xDS resource type.
@@ -665,6 +683,42 @@ class XdsClientTest : public ::testing::Test {
     DiscoveryResponse response_;
   };
 
+  // A helper class to build and serialize a DeltaDiscoveryResponse.
+  class DeltaResponseBuilder {
+   public:
+    explicit DeltaResponseBuilder(absl::string_view type_url) {
+      response_.set_type_url(absl::StrCat("type.googleapis.com/", type_url));
+    }
+
+    DeltaResponseBuilder& set_nonce(absl::string_view nonce) {
+      response_.set_nonce(std::string(nonce));
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddFooResource(const XdsFooResource& resource,
+                                         absl::string_view version) {
+      auto* res = response_.add_resources();
+      res->set_name(resource.name);
+      res->set_version(std::string(version));
+      *res->mutable_resource() = XdsFooResourceType::EncodeAsAny(resource);
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddRemovedResource(absl::string_view name) {
+      response_.add_removed_resources(std::string(name));
+      return *this;
+    }
+
+    std::string Serialize() {
+      std::string serialized_response;
+      EXPECT_TRUE(response_.SerializeToString(&serialized_response));
+      return serialized_response;
+    }
+
+   private:
+    DeltaDiscoveryResponse response_;
+  };
+
   class MetricsReporter : public XdsMetricsReporter {
    public:
     using ResourceUpdateMap = std::map<
@@ -861,6 +915,13 @@ class XdsClientTest : public ::testing::Test {
     return WaitForAdsStream(*xds_client_->bootstrap().servers().front());
   }
 
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall>
+  WaitForDeltaAdsStream() {
+    return transport_factory_->WaitForStream(
+        *xds_client_->bootstrap().servers().front(),
+        FakeXdsTransportFactory::kDeltaAdsMethod);
+  }
+
   void TriggerConnectionFailure(const XdsBootstrap::XdsServer& xds_server,
                                 absl::Status status) {
     transport_factory_->TriggerConnectionFailure(xds_server, std::move(status));
@@ -880,6 +941,51 @@ class XdsClientTest : public ::testing::Test {
     return std::move(request);
   }
 
+  // Gets the latest request sent to the fake xDS server on a delta stream.
+  std::optional<DeltaDiscoveryRequest> WaitForDeltaRequest(
+      FakeXdsTransportFactory::FakeStreamingCall* stream,
+      SourceLocation location = SourceLocation()) {
+    auto message = stream->WaitForMessageFromClient();
+    if (!message.has_value()) return std::nullopt;
+    DeltaDiscoveryRequest request;
+    bool success = request.ParseFromString(*message);
+    EXPECT_TRUE(success) << "Failed to deserialize DeltaDiscoveryRequest at "
+                         << location.file() << ":" << location.line();
+    if (!success) return std::nullopt;
+    return std::move(request);
+  }
+
+  // Helper function to check the fields of a DeltaDiscoveryRequest.
+  void CheckDeltaRequest(const DeltaDiscoveryRequest& request,
+                         absl::string_view type_url,
+                         absl::string_view response_nonce,
+                         const absl::Status& error_detail,
+                         const std::set<absl::string_view>& subscribe,
+                         const std::set<absl::string_view>& unsubscribe,
+                         SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(request.type_url(),
+              absl::StrCat("type.googleapis.com/", type_url))
+        << location.file() << ":" << location.line();
+    EXPECT_EQ(request.response_nonce(), response_nonce)
+        << location.file() << ":" << location.line();
+    if (error_detail.ok()) {
+      EXPECT_FALSE(request.has_error_detail())
+          << location.file() << ":" << location.line();
+    } else {
+      EXPECT_EQ(request.error_detail().code(),
+                static_cast<int>(error_detail.code()))
+          << location.file() << ":" << location.line();
+      EXPECT_EQ(request.error_detail().message(), error_detail.message())
+          << location.file() << ":" << location.line();
+    }
+    EXPECT_THAT(request.resource_names_subscribe(),
+                ::testing::UnorderedElementsAreArray(subscribe))
+        << location.file() << ":" << location.line();
+    EXPECT_THAT(request.resource_names_unsubscribe(),
+                ::testing::UnorderedElementsAreArray(unsubscribe))
+        << location.file() << ":" << location.line();
+  }
+
   // Helper function to check the fields of a DiscoveryRequest.
   void CheckRequest(const DiscoveryRequest& request, absl::string_view type_url,
                     absl::string_view version_info,
@@ -3532,6 +3638,121 @@ TEST_F(XdsClientTest, StreamClosedByServer) {
   EXPECT_TRUE(stream->IsOrphaned());
 }
 
+TEST_F(XdsClientTest, DeltaProtocol) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl,
+                                       /*fail_on_data_errors=*/false,
+                                       /*resource_timer_is_transient_failure=*/
+                                       false,
+                                       /*use_delta_protocol=*/true)}));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created a delta ADS stream.
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have subscribed to the resource.
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  CheckNode(request->node());  // Should be present on the first request.
+  // Server sends the resource with its own version.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // CSDS reports the per-resource version.
+  ClientConfig csds = DumpCsds();
+  EXPECT_THAT(csds.generic_xds_configs(),
+              ::testing::ElementsAre(CsdsResourceAcked(
+                  XdsFooResourceType::Get()->type_url(), "foo1",
+                  resource->AsJsonString(), "v1", TimestampProtoEq(kTime0))));
+  // The ACK carries no subscription changes.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  EXPECT_FALSE(request->has_node());
+  // Start a watch for "foo2".  Only the new name is sent.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo2"}, /*unsubscribe=*/{});
+  // Server says that foo2 does not exist.  Watchers do not have to wait
+  // for the does-not-exist timer.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .AddRemovedResource("foo2")
+          .Serialize());
+  EXPECT_TRUE(watcher2->WaitForDoesNotExist());
+  EXPECT_FALSE(watcher->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // Cancel the watch for foo2.  Only the removed name is sent.
+  CancelFooWatch(watcher2.get(), "foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{"foo2"});
+  // Cancel the last watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
+TEST_F(XdsClientTest, DeltaProtocolSendsInitialResourceVersionsOnRestart) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl,
+                                       /*fail_on_data_errors=*/false,
+                                       /*resource_timer_is_transient_failure=*/
+                                       false,
+                                       /*use_delta_protocol=*/true)}));
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(request->initial_resource_versions(), ::testing::IsEmpty());
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Server closes the stream.
+  stream->MaybeSendStatusToClient(absl::OkStatus());
+  EXPECT_TRUE(stream->IsOrphaned());
+  // On the new stream, XdsClient resubscribes and tells the server which
+  // version it already has.
+  stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  EXPECT_THAT(request->initial_resource_versions(),
+              ::testing::ElementsAre(::testing::Pair("foo1", "v1")));
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
 TEST_F(XdsClientTest, StreamClosedByServerWithoutSeeingResponse) {
   InitXdsClient();
   // Metrics should initially be empty.
@@ -4981,6 +5202,78 @@ TEST_F(XdsClientTest, ResourceWrappedInResourceMessage) {
   EXPECT_TRUE(stream->IsOrphaned());
 }
 
+TEST_F(XdsClientTest, IdenticalWrappedResourceIsNotDecodedAgain) {
+  InitXdsClient();
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response with the resource wrapped in a Resource message.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Send the same resource again in a new version.  It should be ACKed
+  // without being decoded.
+  const size_t num_decodes = XdsFooResourceType::num_decodes();
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"B",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  EXPECT_EQ(XdsFooResourceType::num_decodes(), num_decodes);
+  EXPECT_TRUE(watcher->ExpectNoEvent());
+  // Check CSDS data.
+  ClientConfig csds = DumpCsds();
+  EXPECT_THAT(csds.generic_xds_configs(),
+              ::testing::UnorderedElementsAre(CsdsResourceAcked(
+                  XdsFooResourceType::Get()->type_url(), "foo1",
+                  resource->AsJsonString(), "2", TimestampProtoEq(kTime0))));
+  // A changed resource is decoded as usual.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("3")
+          .set_nonce("C")
+          .AddFooResource(XdsFooResource("foo1", 7),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 7);
+  EXPECT_EQ(XdsFooResourceType::num_decodes(), num_decodes + 1);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"3", /*response_nonce=*/"C",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
 TEST_F(XdsClientTest, MultipleResourceTypes) {
   InitXdsClient();
   // Start a watch for "foo1".
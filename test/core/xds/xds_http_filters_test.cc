@@ -331,6 +331,23 @@ TEST_F(XdsFaultInjectionFilterTest, GenerateServiceConfig) {
   EXPECT_EQ(service_config->element, "");
 }
 
+TEST_F(XdsFaultInjectionFilterTest, IsNoopConfig) {
+  auto is_noop = [&](Json::Object policy) {
+    XdsHttpFilterImpl::FilterConfig config;
+    config.config = Json::FromObject(std::move(policy));
+    return filter_->IsNoopConfig(config);
+  };
+  EXPECT_TRUE(is_noop({}));
+  EXPECT_TRUE(is_noop({{"abortCode", Json::FromString("OK")},
+                       {"maxFaults", Json::FromNumber(3)}}));
+  EXPECT_TRUE(is_noop({{"delay", Json::FromString("0.000000000s")}}));
+  EXPECT_FALSE(is_noop({{"abortCode", Json::FromString("UNAVAILABLE")}}));
+  EXPECT_FALSE(is_noop({{"abortCode", Json::FromString("OK")},
+                        {"abortCodeHeader", Json::FromString("x-abort")}}));
+  EXPECT_FALSE(is_noop({{"delay", Json::FromString("1.000000000s")}}));
+  EXPECT_FALSE(is_noop({{"delayHeader", Json::FromString("x-delay")}}));
+}
+
 // For the fault injection filter, GenerateFilterConfig() and
 // GenerateFilterConfigOverride() accept the same input, so we want to
 // run all tests for both.
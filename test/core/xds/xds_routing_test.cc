@@ -0,0 +1,254 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/xds/grpc/xds_routing.h"
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/matchers.h"
+#include "src/core/xds/grpc/xds_http_filter.h"
+#include "src/core/xds/grpc/xds_http_filter_registry.h"
+#include "src/core/xds/grpc/xds_listener.h"
+#include "src/core/xds/grpc/xds_route_config.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using Matchers = XdsRouteConfigResource::Route::Matchers;
+
+class RouteList final : public XdsRouting::RouteListIterator {
+ public:
+  size_t Size() const override { return routes_.size(); }
+
+  const Matchers& GetMatchersForRoute(size_t index) const override {
+    return routes_[index];
+  }
+
+  RouteList& Add(StringMatcher::Type type, absl::string_view path,
+                 bool case_sensitive = true,
+                 std::vector<HeaderMatcher> header_matchers = {}) {
+    Matchers matchers;
+    matchers.path_matcher =
+        StringMatcher::Create(type, path, case_sensitive).value();
+    matchers.header_matchers = std::move(header_matchers);
+    routes_.push_back(std::move(matchers));
+    return *this;
+  }
+
+ private:
+  std::vector<Matchers> routes_;
+};
+
+class XdsRoutingTest : public ::testing::Test {
+ protected:
+  // Returns the route picked by the route table, after checking that the
+  // linear scan picks the same one.
+  std::optional<size_t> GetRoute(const RouteList& routes,
+                                 absl::string_view path) {
+    XdsRouting::RouteTable table(routes);
+    auto expected = XdsRouting::GetRouteForRequest(routes, path, &metadata_);
+    auto actual = table.GetRouteForRequest(routes, path, &metadata_);
+    EXPECT_EQ(actual, expected) << path;
+    return actual;
+  }
+
+  grpc_metadata_batch metadata_;
+};
+
+TEST_F(XdsRoutingTest, ExactMatch) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Baz");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz"), 1);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Qux"), std::nullopt);
+}
+
+TEST_F(XdsRoutingTest, FirstMatchingRouteWins) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/foo.Service/")
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kPrefix, "");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar"), 0);
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/Bar"), 2);
+}
+
+TEST_F(XdsRoutingTest, LongerPrefixAfterShorterOne) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kPrefix, "/foo.");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar"), 0);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz"), 1);
+  EXPECT_EQ(GetRoute(routes, "/fo"), std::nullopt);
+}
+
+TEST_F(XdsRoutingTest, CaseInsensitiveMatchers) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/FOO.Service/Bar",
+             /*case_sensitive=*/false)
+      .Add(StringMatcher::Type::kPrefix, "/BAR.", /*case_sensitive=*/false);
+  EXPECT_EQ(GetRoute(routes, "/foo.service/bar"), 0);
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/Bar"), 1);
+}
+
+TEST_F(XdsRoutingTest, RegexMatchers) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kSafeRegex, "/foo\\..*/Bar")
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kSafeRegex, "/foo\\.Service/.*");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar"), 0);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz"), 2);
+  // Regexes must match the whole path.
+  EXPECT_EQ(GetRoute(routes, "/x/foo.Service/Baz"), std::nullopt);
+}
+
+TEST_F(XdsRoutingTest, OtherPathMatchers) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kSuffix, "/Bar")
+      .Add(StringMatcher::Type::kContains, "Service");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar"), 0);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz"), 1);
+  EXPECT_EQ(GetRoute(routes, "/foo.Other/Baz"), std::nullopt);
+}
+
+TEST_F(XdsRoutingTest, HeaderMatchersAreChecked) {
+  RouteList routes;
+  routes
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Bar",
+           /*case_sensitive=*/true,
+           {HeaderMatcher::Create("x-env", HeaderMatcher::Type::kExact,
+                                  "canary")
+                .value()})
+      .Add(StringMatcher::Type::kPrefix, "/foo.");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar"), 1);
+  metadata_.Append("x-env", Slice::FromStaticString("canary"),
+                   [](absl::string_view, const Slice&) { abort(); });
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar"), 0);
+}
+
+class VirtualHostList final : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostList(std::vector<std::vector<std::string>> domains)
+      : domains_(std::move(domains)) {}
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+TEST(XdsRoutingDomainTest, FindVirtualHostForDomain) {
+  VirtualHostList vhosts({{"*"},
+                          {"FOO.example.com"},
+                          {"*.example.com"},
+                          {"foo.*", "*.bar.example.com"}});
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, "foo.EXAMPLE.com"),
+            1);
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, "a.bar.Example.com"),
+            3);
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, "b.example.com"), 2);
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, "Foo.net"), 3);
+  // The asterisk must match at least one character.
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, ".example.com"), 0);
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, "foo."), 0);
+}
+
+class XdsActiveHttpFiltersTest : public ::testing::Test {
+ protected:
+  using HttpFilter = XdsListenerResource::HttpConnectionManager::HttpFilter;
+  using RouteAction = XdsRouteConfigResource::Route::RouteAction;
+
+  static XdsHttpFilterImpl::FilterConfig FaultConfig(
+      absl::string_view abort_code) {
+    Json::Object policy;
+    if (!abort_code.empty()) {
+      policy["abortCode"] = Json::FromString(std::string(abort_code));
+    }
+    return {"envoy.extensions.filters.http.fault.v3.HTTPFault",
+            Json::FromObject(std::move(policy))};
+  }
+
+  XdsActiveHttpFiltersTest() {
+    http_filters_.push_back({"fault", FaultConfig("")});
+    http_filters_.push_back({"router",
+                             {"envoy.extensions.filters.http.router.v3.Router",
+                              Json::FromObject({})}});
+    XdsRouteConfigResource::Route route;
+    route.action.emplace<RouteAction>().action =
+        RouteAction::ClusterName{"cluster"};
+    vhost_.routes.push_back(std::move(route));
+  }
+
+  std::vector<std::string> ActiveFilterNames() {
+    std::vector<std::string> names;
+    for (const HttpFilter& http_filter : XdsRouting::ActiveHttpFilters(
+             registry_, http_filters_, vhost_)) {
+      names.push_back(http_filter.name);
+    }
+    return names;
+  }
+
+  XdsHttpFilterRegistry registry_;
+  std::vector<HttpFilter> http_filters_;
+  XdsRouteConfigResource::VirtualHost vhost_;
+};
+
+TEST_F(XdsActiveHttpFiltersTest, LeavesOutNoopFilters) {
+  EXPECT_THAT(ActiveFilterNames(), ::testing::ElementsAre("router"));
+  http_filters_[0].config = FaultConfig("UNAVAILABLE");
+  EXPECT_THAT(ActiveFilterNames(), ::testing::ElementsAre("fault", "router"));
+}
+
+TEST_F(XdsActiveHttpFiltersTest, ChecksOverrides) {
+  // An override on a weighted cluster of one route is enough.
+  std::vector<RouteAction::ClusterWeight> weighted_clusters(2);
+  weighted_clusters[1].typed_per_filter_config["fault"] =
+      FaultConfig("UNAVAILABLE");
+  std::get<RouteAction>(vhost_.routes[0].action).action =
+      std::move(weighted_clusters);
+  EXPECT_THAT(ActiveFilterNames(), ::testing::ElementsAre("fault", "router"));
+  // Nothing is left once the route overrides it with a no-op.
+  http_filters_[0].config = FaultConfig("UNAVAILABLE");
+  std::get<RouteAction>(vhost_.routes[0].action).action =
+      RouteAction::ClusterName{"cluster"};
+  vhost_.routes[0].typed_per_filter_config["fault"] = FaultConfig("OK");
+  EXPECT_THAT(ActiveFilterNames(), ::testing::ElementsAre("router"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
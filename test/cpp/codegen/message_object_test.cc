@@ -0,0 +1,139 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <google/protobuf/wrappers.pb.h>
+#include <grpc/byte_buffer.h>
+#include <grpcpp/impl/message_object.h>
+#include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "src/proto/grpc/testing/simple_messages.pb.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace internal {
+
+// Provide access to ByteBuffer internals.
+class GrpcByteBufferPeer {
+ public:
+  explicit GrpcByteBufferPeer(ByteBuffer* bb) : bb_(bb) {}
+  grpc_byte_buffer* c_buffer() { return bb_->c_buffer(); }
+  void set_buffer(grpc_byte_buffer* buffer) { bb_->set_buffer(buffer); }
+
+ private:
+  ByteBuffer* bb_;
+};
+
+namespace {
+
+using testing::StringValue;
+
+StringValue MakeMessage() {
+  StringValue message;
+  message.set_message(std::string(1000, 'a'));
+  return message;
+}
+
+ByteBuffer Wrap(const StringValue& message) {
+  ByteBuffer buffer;
+  GrpcByteBufferPeer(&buffer).set_buffer(
+      MessageObjects::Wrap<StringValue>(&message));
+  return buffer;
+}
+
+bool IsMessageObject(ByteBuffer* buffer) {
+  return internal::IsMessageObject(GrpcByteBufferPeer(buffer).c_buffer());
+}
+
+TEST(MessageObjectsTest, ObjectIsMovedToSameType) {
+  const StringValue message = MakeMessage();
+  ByteBuffer buffer = Wrap(message);
+  EXPECT_TRUE(IsMessageObject(&buffer));
+  // The object is not serialized.
+  EXPECT_LT(buffer.Length(), 16u);
+  StringValue received;
+  ASSERT_TRUE(MessageObjects::Deserialize(&buffer, &received).ok());
+  EXPECT_FALSE(buffer.Valid());
+  EXPECT_EQ(received.message(), message.message());
+}
+
+TEST(MessageObjectsTest, OtherTypeReceivesSerializedBytes) {
+  const StringValue message = MakeMessage();
+  ByteBuffer buffer = Wrap(message);
+  // The well-known StringValue has the same field number and type.
+  google::protobuf::StringValue received;
+  ASSERT_TRUE(MessageObjects::Deserialize(&buffer, &received).ok());
+  EXPECT_FALSE(buffer.Valid());
+  EXPECT_EQ(received.value(), message.message());
+}
+
+TEST(MessageObjectsTest, ByteBufferReceivesSerializedBytes) {
+  const StringValue message = MakeMessage();
+  ByteBuffer buffer = Wrap(message);
+  ByteBuffer received;
+  ASSERT_TRUE(MessageObjects::Deserialize(&buffer, &received).ok());
+  // As with other types, the caller forgets the consumed buffer.
+  buffer.Release();
+  EXPECT_FALSE(IsMessageObject(&received));
+  Slice slice;
+  ASSERT_TRUE(received.DumpToSingleSlice(&slice).ok());
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(slice.begin()),
+                        slice.size()),
+            message.SerializeAsString());
+}
+
+TEST(MessageObjectsTest, SerializedBytesAreNotObjects) {
+  const StringValue message = MakeMessage();
+  ByteBuffer buffer;
+  bool own_buffer;
+  ASSERT_TRUE(SerializationTraits<StringValue>::Serialize(message, &buffer,
+                                                          &own_buffer)
+                  .ok());
+  EXPECT_FALSE(IsMessageObject(&buffer));
+  StringValue received;
+  ASSERT_TRUE(MessageObjects::Deserialize(&buffer, &received).ok());
+  EXPECT_EQ(received.message(), message.message());
+}
+
+TEST(MessageObjectsTest, CopiesShareTheObject) {
+  const StringValue message = MakeMessage();
+  ByteBuffer buffer = Wrap(message);
+  ByteBuffer copy(buffer);
+  StringValue received;
+  ASSERT_TRUE(MessageObjects::Deserialize(&buffer, &received).ok());
+  EXPECT_EQ(received.message(), message.message());
+  // The first one to be received took it.
+  EXPECT_FALSE(MessageObjects::Deserialize(&copy, &received).ok());
+}
+
+TEST(MessageObjectsTest, UnreceivedObjectIsDestroyed) {
+  // Leaks are caught by the sanitizers.
+  ByteBuffer buffer = Wrap(MakeMessage());
+  buffer.Clear();
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,12 +16,15 @@
 //
 //
 
+#include <google/protobuf/wrappers.pb.h>
 #include <grpc/byte_buffer.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/impl/proto_utils.h>
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "test/core/test_util/test_config.h"
 
 namespace grpc {
@@ -85,6 +88,34 @@ TEST_F(ProtoUtilsTest, TinyBackupThenNext) {
   EXPECT_EQ(block_size, size);
 }
 
+TEST_F(ProtoUtilsTest, SerializeIntoExactlySizedSlices) {
+  for (size_t length : {size_t{10}, size_t{10000},
+                        size_t{kProtoBufferWriterMaxBufferLength} * 2}) {
+    google::protobuf::StringValue msg;
+    msg.set_value(std::string(length, 'x'));
+    ByteBuffer bb;
+    bool own_buffer;
+    ASSERT_TRUE(SerializationTraits<google::protobuf::StringValue>::Serialize(
+                    msg, &bb, &own_buffer)
+                    .ok());
+    grpc_slice_buffer* slices =
+        &GrpcByteBufferPeer(&bb).c_buffer()->data.raw.slice_buffer;
+    EXPECT_EQ(slices->length, msg.ByteSizeLong());
+    // Messages that fit in one block take exactly one slice.
+    if (msg.ByteSizeLong() <=
+        static_cast<size_t>(kProtoBufferWriterMaxBufferLength)) {
+      EXPECT_EQ(slices->count, 1u);
+    } else {
+      EXPECT_GT(slices->count, 1u);
+    }
+    google::protobuf::StringValue parsed;
+    ASSERT_TRUE(SerializationTraits<google::protobuf::StringValue>::Deserialize(
+                    &bb, &parsed)
+                    .ok());
+    EXPECT_EQ(parsed.value(), msg.value());
+  }
+}
+
 namespace {
 
 // Set backup_size to 0 to indicate no backup is needed.
@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include "absl/strings/str_cat.h"
+#include "src/proto/grpc/latent_see/v1/latent_see.grpc.pb.h"
 #include "src/proto/grpc/reflection/v1alpha/reflection.grpc.pb.h"
 #include "test/core/test_util/port.h"
 #include "test/core/test_util/test_config.h"
@@ -42,8 +43,9 @@ class AdminServicesTest : public ::testing::Test {
     grpc::AddAdminServices(&builder);
     server_ = builder.BuildAndStart();
     // Create channel
-    auto reflection_stub = reflection::v1alpha::ServerReflection::NewStub(
-        CreateChannel(address, InsecureChannelCredentials()));
+    channel_ = CreateChannel(address, InsecureChannelCredentials());
+    auto reflection_stub =
+        reflection::v1alpha::ServerReflection::NewStub(channel_);
     stream_ = reflection_stub->ServerReflectionInfo(&reflection_ctx_);
   }
 
@@ -60,6 +62,9 @@ class AdminServicesTest : public ::testing::Test {
     return services;
   }
 
+ protected:
+  std::shared_ptr<Channel> channel_;
+
  private:
   std::unique_ptr<Server> server_;
   ClientContext reflection_ctx_;
@@ -76,6 +81,7 @@ TEST_F(AdminServicesTest, ValidateRegisteredServices) {
       GetServiceList(),
       ::testing::AllOf(
           ::testing::Contains("grpc.channelz.v1.Channelz"),
+          ::testing::Contains("grpc.latent_see.v1.LatentSee"),
           ::testing::Contains("grpc.reflection.v1alpha.ServerReflection")));
 #if defined(GRPC_NO_XDS) || defined(DISABLED_XDS_PROTO_IN_CC)
   EXPECT_THAT(GetServiceList(),
@@ -88,6 +94,22 @@ TEST_F(AdminServicesTest, ValidateRegisteredServices) {
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
 }
 
+TEST_F(AdminServicesTest, GetLatentSeeTrace) {
+  auto stub = latent_see::v1::LatentSee::NewStub(channel_);
+  latent_see::v1::GetTraceRequest request;
+  request.mutable_lookback()->set_seconds(10);
+  latent_see::v1::GetTraceResponse response;
+  ClientContext context;
+  Status status = stub->GetTrace(&context, request, &response);
+#ifdef GRPC_LATENT_SEE_FLIGHT_RECORDER
+  ASSERT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.trace_json().front(), '[');
+  EXPECT_EQ(response.trace_json().back(), ']');
+#else
+  EXPECT_EQ(status.error_code(), StatusCode::UNIMPLEMENTED);
+#endif
+}
+
 }  // namespace testing
 }  // namespace grpc
 
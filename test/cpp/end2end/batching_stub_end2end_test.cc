@@ -0,0 +1,294 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/generic/batching_generic_service.h>
+#include <grpcpp/generic/batching_stub.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/support/server_interceptor.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+#include "test/cpp/util/byte_buffer_proto_helper.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+constexpr char kEchoMethod[] = "/grpc.testing.EchoTestService/Echo";
+
+// Counts the batch streams the server has seen.
+class BatchStreamCountingInterceptorFactory
+    : public experimental::ServerInterceptorFactoryInterface {
+ public:
+  experimental::Interceptor* CreateServerInterceptor(
+      experimental::ServerRpcInfo* info) override {
+    if (absl::EndsWith(info->method(), "/batch")) ++batch_streams_;
+    return nullptr;
+  }
+
+  int batch_streams() const { return batch_streams_.load(); }
+
+ private:
+  std::atomic<int> batch_streams_{0};
+};
+
+// Echoes the peer that BatchingGenericService reports for the caller, and
+// records how many calls ran at once.
+class CallerEchoService : public EchoTestService::Service {
+ public:
+  explicit CallerEchoService(experimental::BatchingGenericService* batching)
+      : batching_(batching) {}
+
+  Status Echo(ServerContext* context, const EchoRequest* /*request*/,
+              EchoResponse* response) override {
+    const int active = ++active_calls_;
+    int max = max_active_calls_.load();
+    while (active > max &&
+           !max_active_calls_.compare_exchange_weak(max, active)) {
+    }
+    response->set_message(batching_->CallerPeer(*context));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    --active_calls_;
+    return Status::OK;
+  }
+
+  int max_active_calls() const { return max_active_calls_.load(); }
+
+ private:
+  experimental::BatchingGenericService* const batching_;
+  std::atomic<int> active_calls_{0};
+  std::atomic<int> max_active_calls_{0};
+};
+
+class BatchingStubEnd2endTest : public ::testing::Test {
+ protected:
+  struct PendingCall {
+    std::unique_ptr<ByteBuffer> request;
+    ByteBuffer response;
+    Status status;
+    bool done = false;
+  };
+
+  void StartServer(bool with_batching_service,
+                   experimental::BatchingStubOptions stub_options =
+                       experimental::BatchingStubOptions(),
+                   experimental::BatchingGenericServiceOptions
+                       service_options =
+                           experimental::BatchingGenericServiceOptions(),
+                   bool over_tcp = false) {
+    batching_service_ =
+        std::make_unique<experimental::BatchingGenericService>(
+            service_options);
+    caller_service_ =
+        std::make_unique<CallerEchoService>(batching_service_.get());
+    ServerBuilder builder;
+    if (over_tcp) {
+      builder.RegisterService(caller_service_.get());
+    } else {
+      builder.RegisterService(&service_);
+    }
+    if (with_batching_service) {
+      builder.RegisterCallbackGenericService(batching_service_.get());
+    }
+    const std::string address =
+        absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+    if (over_tcp) {
+      builder.AddListeningPort(address, InsecureServerCredentials());
+    }
+    std::vector<
+        std::unique_ptr<experimental::ServerInterceptorFactoryInterface>>
+        creators;
+    auto counter = std::make_unique<BatchStreamCountingInterceptorFactory>();
+    batch_stream_counter_ = counter.get();
+    creators.push_back(std::move(counter));
+    builder.experimental().SetInterceptorCreators(std::move(creators));
+    server_ = builder.BuildAndStart();
+    stub_ = std::make_unique<experimental::BatchingStub>(
+        over_tcp ? CreateChannel(address, InsecureChannelCredentials())
+                 : server_->InProcessChannel({}),
+        stub_options);
+  }
+
+  void TearDown() override {
+    stub_.reset();
+    server_->Shutdown();
+  }
+
+  PendingCall* StartEcho(const EchoRequest& request) {
+    calls_.push_back(std::make_unique<PendingCall>());
+    PendingCall* call = calls_.back().get();
+    call->request = SerializeToByteBuffer(&request);
+    stub_->UnaryCall(kEchoMethod, call->request.get(), &call->response,
+                     [this, call](Status status) {
+                       std::lock_guard<std::mutex> lock(mu_);
+                       call->status = std::move(status);
+                       call->done = true;
+                       cv_.notify_all();
+                     });
+    return call;
+  }
+
+  PendingCall* StartEcho(const std::string& message) {
+    EchoRequest request;
+    request.set_message(message);
+    return StartEcho(request);
+  }
+
+  void WaitForAllCalls() {
+    std::unique_lock<std::mutex> lock(mu_);
+    for (const auto& call : calls_) {
+      cv_.wait(lock, [&] { return call->done; });
+    }
+  }
+
+  static std::string ResponseMessage(PendingCall* call) {
+    EchoResponse response;
+    EXPECT_TRUE(ParseFromByteBuffer(&call->response, &response));
+    return response.message();
+  }
+
+  TestServiceImpl service_;
+  std::unique_ptr<experimental::BatchingGenericService> batching_service_;
+  std::unique_ptr<CallerEchoService> caller_service_;
+  BatchStreamCountingInterceptorFactory* batch_stream_counter_ = nullptr;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<experimental::BatchingStub> stub_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  std::vector<std::unique_ptr<PendingCall>> calls_;
+};
+
+TEST_F(BatchingStubEnd2endTest, CallsShareOneStream) {
+  StartServer(/*with_batching_service=*/true);
+  for (int i = 0; i < 100; ++i) StartEcho("hello " + std::to_string(i));
+  WaitForAllCalls();
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(calls_[i]->status.ok()) << calls_[i]->status.error_message();
+    EXPECT_EQ(ResponseMessage(calls_[i].get()), "hello " + std::to_string(i));
+  }
+  EXPECT_EQ(batch_stream_counter_->batch_streams(), 1);
+}
+
+TEST_F(BatchingStubEnd2endTest, StatusIsPerCall) {
+  StartServer(/*with_batching_service=*/true);
+  EchoRequest failing;
+  failing.set_message("fail");
+  failing.mutable_param()->mutable_expected_error()->set_code(
+      StatusCode::FAILED_PRECONDITION);
+  failing.mutable_param()->mutable_expected_error()->set_error_message(
+      "expected");
+  PendingCall* failed = StartEcho(failing);
+  PendingCall* succeeded = StartEcho("succeed");
+  WaitForAllCalls();
+  EXPECT_EQ(failed->status.error_code(), StatusCode::FAILED_PRECONDITION);
+  EXPECT_EQ(failed->status.error_message(), "expected");
+  EXPECT_TRUE(succeeded->status.ok()) << succeeded->status.error_message();
+  EXPECT_EQ(ResponseMessage(succeeded), "succeed");
+}
+
+TEST_F(BatchingStubEnd2endTest, FallsBackToUnaryCallsWithoutBatchingService) {
+  StartServer(/*with_batching_service=*/false);
+  for (int i = 0; i < 10; ++i) StartEcho("hello " + std::to_string(i));
+  WaitForAllCalls();
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(calls_[i]->status.ok()) << calls_[i]->status.error_message();
+    EXPECT_EQ(ResponseMessage(calls_[i].get()), "hello " + std::to_string(i));
+  }
+  // Once the batch stream has been rejected, calls no longer try one.
+  StartEcho("unbatched");
+  WaitForAllCalls();
+  EXPECT_TRUE(calls_.back()->status.ok());
+  EXPECT_LE(batch_stream_counter_->batch_streams(), 1);
+}
+
+TEST_F(BatchingStubEnd2endTest, StreamsAreReplacedAfterMaxStreamCalls) {
+  experimental::BatchingStubOptions options;
+  options.max_stream_calls = 10;
+  StartServer(/*with_batching_service=*/true, options);
+  for (int i = 0; i < 35; ++i) StartEcho("hello " + std::to_string(i));
+  WaitForAllCalls();
+  for (int i = 0; i < 35; ++i) {
+    EXPECT_TRUE(calls_[i]->status.ok()) << calls_[i]->status.error_message();
+    EXPECT_EQ(ResponseMessage(calls_[i].get()), "hello " + std::to_string(i));
+  }
+  EXPECT_EQ(batch_stream_counter_->batch_streams(), 4);
+}
+
+TEST_F(BatchingStubEnd2endTest, OutstandingCallsPerStreamAreCapped) {
+  experimental::BatchingStubOptions stub_options;
+  // One call per message, so that the cap is checked between calls.
+  stub_options.max_batch_calls = 1;
+  experimental::BatchingGenericServiceOptions service_options;
+  service_options.max_outstanding_calls = 2;
+  StartServer(/*with_batching_service=*/true, stub_options, service_options,
+              /*over_tcp=*/true);
+  for (int i = 0; i < 20; ++i) StartEcho("hello");
+  WaitForAllCalls();
+  for (const auto& call : calls_) {
+    EXPECT_TRUE(call->status.ok()) << call->status.error_message();
+  }
+  EXPECT_LE(caller_service_->max_active_calls(), 2);
+  EXPECT_EQ(batch_stream_counter_->batch_streams(), 1);
+}
+
+TEST_F(BatchingStubEnd2endTest, HandlersSeeTheBatchStreamPeer) {
+  StartServer(/*with_batching_service=*/true,
+              experimental::BatchingStubOptions(),
+              experimental::BatchingGenericServiceOptions(),
+              /*over_tcp=*/true);
+  StartEcho("hello");
+  WaitForAllCalls();
+  ASSERT_TRUE(calls_[0]->status.ok()) << calls_[0]->status.error_message();
+  // The handler runs on the in-process channel, but reports the TCP peer of
+  // the batch stream.
+  const std::string peer = ResponseMessage(calls_[0].get());
+  EXPECT_TRUE(absl::StartsWith(peer, "ipv4:") ||
+              absl::StartsWith(peer, "ipv6:"))
+      << peer;
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -846,6 +846,59 @@ TEST_P(ClientCallbackEnd2endTest, UnaryReactor) {
   }
 }
 
+TEST_P(ClientCallbackEnd2endTest, UnaryReactorReuse) {
+  ResetStub();
+  class UnaryClient : public grpc::ClientUnaryReactor {
+   public:
+    void Start(grpc::testing::EchoTestService::Stub* stub, int i) {
+      cli_ctx_.Reset();
+      value_ = std::to_string(i);
+      cli_ctx_.AddMetadata("key", value_);
+      request_.mutable_param()->set_echo_metadata_initially(true);
+      request_.set_message("Hello " + value_);
+      done_ = false;
+      stub->async()->Echo(&cli_ctx_, &request_, &response_, this);
+      StartCall();
+    }
+    void OnReadInitialMetadataDone(bool ok) override {
+      EXPECT_TRUE(ok);
+      // Metadata from the previous rpc must not be seen again.
+      EXPECT_EQ(1u, cli_ctx_.GetServerInitialMetadata().count("key"));
+      EXPECT_EQ(value_,
+                ToString(
+                    cli_ctx_.GetServerInitialMetadata().find("key")->second));
+    }
+    void OnDone(const Status& s) override {
+      EXPECT_TRUE(s.ok());
+      EXPECT_EQ(request_.message(), response_.message());
+      std::unique_lock<std::mutex> l(mu_);
+      done_ = true;
+      cv_.notify_one();
+    }
+    void Await() {
+      std::unique_lock<std::mutex> l(mu_);
+      while (!done_) {
+        cv_.wait(l);
+      }
+    }
+
+   private:
+    EchoRequest request_;
+    EchoResponse response_;
+    ClientContext cli_ctx_;
+    std::string value_;
+    std::mutex mu_;
+    std::condition_variable cv_;
+    bool done_{false};
+  };
+
+  UnaryClient client;
+  for (int i = 0; i < 10; i++) {
+    client.Start(stub_.get(), i);
+    client.Await();
+  }
+}
+
 TEST_P(ClientCallbackEnd2endTest, GenericUnaryReactor) {
   const std::string kMethodName("/grpc.testing.EchoTestService/Echo");
   constexpr char kSuffixForStats[] = "TestSuffixForStats";
@@ -29,6 +29,7 @@
 #include <grpcpp/support/client_interceptor.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -705,6 +706,39 @@ class LoggingInterceptorFactory
   }
 };
 
+// Only intercepts POST_RECV_STATUS, so it must never see any other batch.
+class StatusOnlyInterceptor : public experimental::Interceptor {
+ public:
+  bool InterceptsHookPoint(experimental::InterceptionHookPoints type) override {
+    return type == experimental::InterceptionHookPoints::POST_RECV_STATUS;
+  }
+
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    EXPECT_TRUE(methods->QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::POST_RECV_STATUS));
+    EXPECT_TRUE(methods->GetRecvStatus()->ok());
+    num_times_run_++;
+    methods->Proceed();
+  }
+
+  static void Reset() { num_times_run_.store(0); }
+  static int GetNumTimesRun() { return num_times_run_.load(); }
+
+ private:
+  static std::atomic<int> num_times_run_;
+};
+
+std::atomic<int> StatusOnlyInterceptor::num_times_run_;
+
+class StatusOnlyInterceptorFactory
+    : public experimental::ClientInterceptorFactoryInterface {
+ public:
+  experimental::Interceptor* CreateClientInterceptor(
+      experimental::ClientRpcInfo* /*info*/) override {
+    return new StatusOnlyInterceptor();
+  }
+};
+
 class TestScenario {
  public:
   explicit TestScenario(const ChannelType& channel_type,
@@ -899,6 +933,24 @@ TEST_F(ClientInterceptorsEnd2endTest, ClientInterceptorHijackingTest) {
   EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 20);
 }
 
+TEST_F(ClientInterceptorsEnd2endTest, ClientInterceptorSkipsUninterestingHooks) {
+  ChannelArguments args;
+  StatusOnlyInterceptor::Reset();
+  PhonyInterceptor::Reset();
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(std::make_unique<StatusOnlyInterceptorFactory>());
+  creators.push_back(std::make_unique<PhonyInterceptorFactory>());
+  creators.push_back(std::make_unique<StatusOnlyInterceptorFactory>());
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, InsecureChannelCredentials(), args, std::move(creators));
+  MakeCall(channel);
+  MakeBidiStreamingCall(channel);
+  EXPECT_EQ(StatusOnlyInterceptor::GetNumTimesRun(), 4);
+  // Interceptors that skip a hook point do not hide it from the others.
+  EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 2);
+}
+
 TEST_F(ClientInterceptorsEnd2endTest, ClientInterceptorLogThenHijackTest) {
   ChannelArguments args;
   std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
@@ -31,6 +31,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <deque>
 #include <memory>
@@ -39,6 +40,7 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -54,6 +56,7 @@
 #include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/iomgr/tcp_client.h"
 #include "src/core/lib/security/credentials/fake/fake_credentials.h"
 #include "src/core/lib/transport/connectivity_state.h"
@@ -227,7 +230,6 @@ class FakeResolverResponseGeneratorWrapper {
     return response_generator_.get();
   }
 
- private:
   static grpc_core::Resolver::Result BuildFakeResults(
       const std::vector<int>& ports, const char* service_config_json = nullptr,
       const grpc_core::ChannelArgs& per_address_args =
@@ -253,6 +255,7 @@ class FakeResolverResponseGeneratorWrapper {
     return result;
   }
 
+ private:
   grpc_core::RefCountedPtr<grpc_core::FakeResolverResponseGenerator>
       response_generator_;
 };
@@ -1569,6 +1572,53 @@ TEST_F(RoundRobinTest, ProcessPending) {
   CheckRpcSendOk(DEBUG_LOCATION, second_stub);
 }
 
+TEST_F(RoundRobinTest, RetriesManyQueuedPicks) {
+  // More than the channel resumes in one batch when the picker changes.
+  constexpr size_t kNumRpcs = 200;
+  ConnectionAttemptInjector injector;
+  StartServers(1);
+  auto hold = injector.AddHold(servers_[0]->port_);
+  FakeResolverResponseGeneratorWrapper response_generator;
+  auto channel = BuildChannel("round_robin", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  hold->Wait();
+  // Start the RPCs while the connection attempt is held, so that their
+  // picks are queued.
+  struct Rpc {
+    ClientContext context;
+    EchoRequest request;
+    EchoResponse response;
+    Status status;
+  };
+  std::vector<Rpc> rpcs(kNumRpcs);
+  std::atomic<size_t> num_done{0};
+  grpc_core::Notification all_done;
+  for (Rpc& rpc : rpcs) {
+    rpc.context.set_wait_for_ready(true);
+    rpc.context.set_deadline(grpc_timeout_seconds_to_deadline(30));
+    rpc.request.set_message(kRequestMessage);
+    stub->async()->Echo(&rpc.context, &rpc.request, &rpc.response,
+                        [&rpc, &num_done, &all_done](Status status) {
+                          rpc.status = std::move(status);
+                          if (num_done.fetch_add(1) + 1 == kNumRpcs) {
+                            all_done.Notify();
+                          }
+                        });
+  }
+  // Give the RPCs time to reach the LB policy.
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(500));
+  EXPECT_EQ(channel->GetState(/*try_to_connect=*/false),
+            GRPC_CHANNEL_CONNECTING);
+  hold->Resume();
+  all_done.WaitForNotification();
+  for (const Rpc& rpc : rpcs) {
+    EXPECT_TRUE(rpc.status.ok()) << rpc.status.error_code() << ": "
+                                 << rpc.status.error_message();
+  }
+  EXPECT_EQ(servers_[0]->service_.request_count(), kNumRpcs);
+}
+
 TEST_F(RoundRobinTest, Updates) {
   // Start servers.
   const int kNumServers = 3;
@@ -2866,6 +2916,24 @@ TEST_F(ClientLbInterceptTrailingMetadataTest, BackendMetricDataMerge) {
       ++total_num_rpcs;
     }
   }
+  // Server metrics updated between calls are reported on the next call.
+  {
+    OrcaLoadReport load_report =
+        OrcaLoadReportBuilder().SetUtilization("foo", 0.5).Build();
+    for (size_t i = 0; i < kNumRpcs; ++i) {
+      const double cpu_utilization = 0.1 * i;
+      servers_[0]->server_metric_recorder_->SetCpuUtilization(cpu_utilization);
+      auto expected = OrcaLoadReportBuilder(per_server_load)
+                          .SetCpuUtilization(cpu_utilization)
+                          .SetUtilization("foo", 0.5)
+                          .Build();
+      CheckRpcSendOk(DEBUG_LOCATION, stub, false, &load_report);
+      auto actual = backend_load_report();
+      ASSERT_TRUE(actual.has_value());
+      CheckLoadReportAsExpected(*actual, expected);
+      ++total_num_rpcs;
+    }
+  }
   // Check LB policy name for the channel.
   EXPECT_EQ("intercept_trailing_metadata_lb",
             channel->GetLoadBalancingPolicyName());
@@ -3155,6 +3223,119 @@ TEST_F(ControlPlaneStatusRewritingTest, RewritesFromConfigSelector) {
       "ABORTED: nope");
 }
 
+//
+// DynamicFiltersTest
+//
+
+// Counts the dynamic filter stacks that it is part of.
+class CountingFilter
+    : public grpc_core::ImplementChannelFilter<CountingFilter> {
+ public:
+  static const grpc_channel_filter kFilter;
+  static absl::string_view TypeName() { return "counting_filter"; }
+  static absl::StatusOr<std::unique_ptr<CountingFilter>> Create(
+      const grpc_core::ChannelArgs&, ChannelFilter::Args) {
+    stacks_built_.fetch_add(1);
+    return std::make_unique<CountingFilter>();
+  }
+
+  static int stacks_built() { return stacks_built_.load(); }
+
+  class Call {
+   public:
+    static const grpc_core::NoInterceptor OnClientInitialMetadata;
+    static const grpc_core::NoInterceptor OnServerInitialMetadata;
+    static const grpc_core::NoInterceptor OnServerTrailingMetadata;
+    static const grpc_core::NoInterceptor OnClientToServerMessage;
+    static const grpc_core::NoInterceptor OnClientToServerHalfClose;
+    static const grpc_core::NoInterceptor OnServerToClientMessage;
+    static const grpc_core::NoInterceptor OnFinalize;
+  };
+
+ private:
+  static std::atomic<int> stacks_built_;
+};
+
+std::atomic<int> CountingFilter::stacks_built_{0};
+const grpc_core::NoInterceptor CountingFilter::Call::OnClientInitialMetadata;
+const grpc_core::NoInterceptor CountingFilter::Call::OnServerInitialMetadata;
+const grpc_core::NoInterceptor CountingFilter::Call::OnServerTrailingMetadata;
+const grpc_core::NoInterceptor CountingFilter::Call::OnClientToServerMessage;
+const grpc_core::NoInterceptor
+    CountingFilter::Call::OnClientToServerHalfClose;
+const grpc_core::NoInterceptor CountingFilter::Call::OnServerToClientMessage;
+const grpc_core::NoInterceptor CountingFilter::Call::OnFinalize;
+const grpc_channel_filter CountingFilter::kFilter =
+    grpc_core::MakePromiseBasedFilter<CountingFilter,
+                                      grpc_core::FilterEndpoint::kClient>();
+
+// Adds CountingFilter to the dynamic filter stack.  ConfigSelectors with
+// different versions are not equal, so each new version is a
+// ConfigSelector update for the channel.
+class CountingConfigSelector : public grpc_core::ConfigSelector {
+ public:
+  CountingConfigSelector(
+      int version, grpc_core::RefCountedPtr<grpc_core::ServiceConfig> config)
+      : version_(version), default_selector_(std::move(config)) {}
+
+  grpc_core::UniqueTypeName name() const override {
+    static grpc_core::UniqueTypeName::Factory kFactory(
+        "CountingConfigSelector");
+    return kFactory.Create();
+  }
+  bool Equals(const ConfigSelector* other) const override {
+    return version_ ==
+           static_cast<const CountingConfigSelector*>(other)->version_;
+  }
+  std::vector<const grpc_channel_filter*> GetFilters() override {
+    return {&CountingFilter::kFilter};
+  }
+  absl::Status GetCallConfig(GetCallConfigArgs args) override {
+    return default_selector_.GetCallConfig(args);
+  }
+
+ private:
+  const int version_;
+  grpc_core::DefaultConfigSelector default_selector_;
+};
+
+class DynamicFiltersTest : public ClientLbEnd2endTest {
+ protected:
+  static grpc_core::Resolver::Result BuildResult(
+      const std::vector<int>& ports, const char* service_config_json,
+      int config_selector_version) {
+    grpc_core::Resolver::Result result =
+        FakeResolverResponseGeneratorWrapper::BuildFakeResults(
+            ports, service_config_json);
+    result.args = grpc_core::ChannelArgs().SetObject(
+        grpc_core::MakeRefCounted<CountingConfigSelector>(
+            config_selector_version, *result.service_config));
+    return result;
+  }
+};
+
+TEST_F(DynamicFiltersTest, StackIsReusedUntilServiceConfigChanges) {
+  StartServers(1);
+  FakeResolverResponseGeneratorWrapper response_generator;
+  auto channel = BuildChannel("pick_first", response_generator);
+  auto stub = BuildStub(channel);
+  const int initial_stacks = CountingFilter::stacks_built();
+  response_generator.SetResponse(BuildResult(GetServersPorts(), "{}", 1));
+  CheckRpcSendOk(DEBUG_LOCATION, stub, /*wait_for_ready=*/true);
+  EXPECT_EQ(CountingFilter::stacks_built(), initial_stacks + 1);
+  // A new ConfigSelector with the same filters, args and service config
+  // keeps the current stack.
+  response_generator.SetResponse(BuildResult(GetServersPorts(), "{}", 2));
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  EXPECT_EQ(CountingFilter::stacks_built(), initial_stacks + 1);
+  // A new service config builds a new stack.
+  response_generator.SetResponse(BuildResult(
+      GetServersPorts(), "{\"loadBalancingConfig\": [{\"pick_first\": {}}]}",
+      3));
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  EXPECT_EQ(CountingFilter::stacks_built(), initial_stacks + 2);
+}
+
 //
 // WeightedRoundRobinTest
 //
@@ -0,0 +1,277 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/impl/server_builder_option.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/channel_arguments.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/time.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+
+// Forwards to the default EventEngine, except that closures passed to Run()
+// can be held back, as if every thread of the engine were busy.
+class GatedEventEngine final : public EventEngine {
+ public:
+  void Hold() {
+    absl::MutexLock lock(&mu_);
+    holding_ = true;
+  }
+
+  // Waits until at least \a count closures are held.
+  bool WaitForHeld(size_t count) {
+    absl::MutexLock lock(&mu_);
+    const absl::Time deadline = absl::Now() + absl::Seconds(30);
+    while (held_.size() < count) {
+      if (cv_.WaitWithDeadline(&mu_, deadline)) return false;
+    }
+    return true;
+  }
+
+  // Runs the held closures one after the other on the default EventEngine,
+  // and stops holding new ones. Returns once they have all run.
+  void Release() {
+    std::vector<absl::AnyInvocable<void()>> held;
+    {
+      absl::MutexLock lock(&mu_);
+      holding_ = false;
+      held.swap(held_);
+    }
+    absl::Notification done;
+    engine_->Run([&held, &done] {
+      for (auto& closure : held) closure();
+      done.Notify();
+    });
+    done.WaitForNotification();
+  }
+
+  bool IsWorkerThread() override { return engine_->IsWorkerThread(); }
+  absl::StatusOr<std::unique_ptr<Listener>> CreateListener(
+      Listener::AcceptCallback on_accept,
+      absl::AnyInvocable<void(absl::Status)> on_shutdown,
+      const EndpointConfig& config,
+      std::unique_ptr<MemoryAllocatorFactory> memory_allocator_factory)
+      override {
+    return engine_->CreateListener(std::move(on_accept),
+                                   std::move(on_shutdown), config,
+                                   std::move(memory_allocator_factory));
+  }
+  ConnectionHandle Connect(OnConnectCallback on_connect,
+                           const ResolvedAddress& addr,
+                           const EndpointConfig& args,
+                           MemoryAllocator memory_allocator,
+                           Duration timeout) override {
+    return engine_->Connect(std::move(on_connect), addr, args,
+                            std::move(memory_allocator), timeout);
+  }
+  bool CancelConnect(ConnectionHandle handle) override {
+    return engine_->CancelConnect(handle);
+  }
+  absl::StatusOr<std::unique_ptr<DNSResolver>> GetDNSResolver(
+      const DNSResolver::ResolverOptions& options) override {
+    return engine_->GetDNSResolver(options);
+  }
+  void Run(Closure* closure) override {
+    Run([closure] { closure->Run(); });
+  }
+  void Run(absl::AnyInvocable<void()> closure) override {
+    {
+      absl::MutexLock lock(&mu_);
+      if (holding_) {
+        held_.push_back(std::move(closure));
+        cv_.SignalAll();
+        return;
+      }
+    }
+    engine_->Run(std::move(closure));
+  }
+  TaskHandle RunAfter(Duration when, Closure* closure) override {
+    return engine_->RunAfter(when, closure);
+  }
+  TaskHandle RunAfter(Duration when,
+                      absl::AnyInvocable<void()> closure) override {
+    return engine_->RunAfter(when, std::move(closure));
+  }
+  bool Cancel(TaskHandle handle) override { return engine_->Cancel(handle); }
+
+ private:
+  const std::shared_ptr<EventEngine> engine_ =
+      grpc_event_engine::experimental::GetDefaultEventEngine();
+  absl::Mutex mu_;
+  absl::CondVar cv_;
+  bool holding_ ABSL_GUARDED_BY(mu_) = false;
+  std::vector<absl::AnyInvocable<void()>> held_ ABSL_GUARDED_BY(mu_);
+};
+
+// Makes the server use the given EventEngine.
+class EventEngineOption final : public ServerBuilderOption {
+ public:
+  explicit EventEngineOption(std::shared_ptr<EventEngine> engine)
+      : engine_(std::move(engine)) {}
+
+  void UpdateArguments(ChannelArguments* args) override {
+    args->SetPointerWithVtable(
+        GRPC_INTERNAL_ARG_EVENT_ENGINE, &engine_,
+        grpc_core::ChannelArgTypeTraits<
+            std::shared_ptr<EventEngine>>::VTable());
+  }
+
+  void UpdatePlugins(
+      std::vector<std::unique_ptr<ServerBuilderPlugin>>* /*plugins*/) override {
+  }
+
+ private:
+  std::shared_ptr<EventEngine> engine_;
+};
+
+// Records the order in which its handlers start.
+class RecordingEchoService : public EchoTestService::CallbackService {
+ public:
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    {
+      absl::MutexLock lock(&mu_);
+      started_.push_back(request->message());
+    }
+    response->set_message(request->message());
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  std::vector<std::string> started() {
+    absl::MutexLock lock(&mu_);
+    return started_;
+  }
+
+ private:
+  absl::Mutex mu_;
+  std::vector<std::string> started_ ABSL_GUARDED_BY(mu_);
+};
+
+// A call started with the callback API.
+struct PendingCall {
+  ClientContext context;
+  EchoRequest request;
+  EchoResponse response;
+  Status status;
+  absl::Notification done;
+};
+
+class DeadlineOrderedDispatchEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ServerBuilder builder;
+    builder.AddChannelArgument(
+        GRPC_ARG_CALLBACK_SERVER_DEADLINE_ORDERED_DISPATCH, 1);
+    builder.SetOption(std::make_unique<EventEngineOption>(engine_));
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    ASSERT_NE(server_, nullptr);
+    stub_ = EchoTestService::NewStub(
+        server_->InProcessChannel(ChannelArguments()));
+  }
+
+  void TearDown() override {
+    engine_->Release();
+    server_->Shutdown();
+  }
+
+  void StartCall(PendingCall* call, const std::string& message,
+                 std::chrono::milliseconds timeout) {
+    call->context.set_deadline(std::chrono::system_clock::now() + timeout);
+    call->request.set_message(message);
+    stub_->async()->Echo(&call->context, &call->request, &call->response,
+                         [call](Status status) {
+                           call->status = std::move(status);
+                           call->done.Notify();
+                         });
+  }
+
+  std::shared_ptr<GatedEventEngine> engine_ =
+      std::make_shared<GatedEventEngine>();
+  RecordingEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(DeadlineOrderedDispatchEnd2endTest, CallsStartInDeadlineOrder) {
+  engine_->Hold();
+  PendingCall calls[3];
+  // The latest deadline arrives first.
+  StartCall(&calls[0], "30", std::chrono::seconds(30));
+  StartCall(&calls[1], "20", std::chrono::seconds(20));
+  StartCall(&calls[2], "10", std::chrono::seconds(10));
+  // Each queued call schedules one run.
+  ASSERT_TRUE(engine_->WaitForHeld(3));
+  engine_->Release();
+  for (PendingCall& call : calls) {
+    ASSERT_TRUE(call.done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+    EXPECT_TRUE(call.status.ok()) << call.status.error_message();
+    EXPECT_EQ(call.response.message(), call.request.message());
+  }
+  EXPECT_EQ(service_.started(), (std::vector<std::string>{"10", "20", "30"}));
+}
+
+TEST_F(DeadlineOrderedDispatchEnd2endTest, ExpiredCallsSkipTheHandler) {
+  engine_->Hold();
+  PendingCall expired;
+  StartCall(&expired, "expired", std::chrono::milliseconds(500));
+  ASSERT_TRUE(engine_->WaitForHeld(1));
+  ASSERT_TRUE(expired.done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  EXPECT_EQ(expired.status.error_code(), StatusCode::DEADLINE_EXCEEDED);
+  // The call's deadline passed while it was queued, so its handler is not
+  // run once the engine gets to it.
+  engine_->Release();
+  EXPECT_TRUE(service_.started().empty());
+  // Later calls are dispatched as usual.
+  PendingCall call;
+  StartCall(&call, "in time", std::chrono::seconds(30));
+  ASSERT_TRUE(call.done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  EXPECT_TRUE(call.status.ok()) << call.status.error_message();
+  EXPECT_EQ(service_.started(), std::vector<std::string>{"in time"});
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
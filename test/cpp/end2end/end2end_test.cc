@@ -250,18 +250,21 @@ const char TestAuthMetadataProcessor::kIdentityPropName[] = "novel identity";
 
 class Proxy : public grpc::testing::EchoTestService::Service {
  public:
-  explicit Proxy(const std::shared_ptr<Channel>& channel)
-      : stub_(grpc::testing::EchoTestService::NewStub(channel)) {}
+  explicit Proxy(const std::shared_ptr<Channel>& channel,
+                 PropagationOptions options = PropagationOptions())
+      : stub_(grpc::testing::EchoTestService::NewStub(channel)),
+        options_(options) {}
 
   Status Echo(ServerContext* server_context, const EchoRequest* request,
               EchoResponse* response) override {
     std::unique_ptr<ClientContext> client_context =
-        ClientContext::FromServerContext(*server_context);
+        ClientContext::FromServerContext(*server_context, options_);
     return stub_->Echo(client_context.get(), *request, response);
   }
 
  private:
   std::unique_ptr<grpc::testing::EchoTestService::Stub> stub_;
+  const PropagationOptions options_;
 };
 
 class TestServiceImplDupPkg
@@ -440,7 +443,8 @@ class End2endTest : public ::testing::TestWithParam<TestScenario> {
           interceptor_creators = {}) {
     ResetChannel(std::move(interceptor_creators));
     if (GetParam().use_proxy()) {
-      proxy_service_ = std::make_unique<Proxy>(channel_);
+      proxy_service_ =
+          std::make_unique<Proxy>(channel_, proxy_propagation_options_);
       int port = grpc_pick_unused_port_or_die();
       std::ostringstream proxyaddr;
       proxyaddr << "localhost:" << port;
@@ -468,6 +472,7 @@ class End2endTest : public ::testing::TestWithParam<TestScenario> {
   std::unique_ptr<Server> server_;
   std::unique_ptr<Server> proxy_server_;
   std::unique_ptr<Proxy> proxy_service_;
+  PropagationOptions proxy_propagation_options_;
   std::ostringstream server_address_;
   const int kMaxMessageSize_;
   TestServiceImpl service_;
@@ -1624,6 +1629,55 @@ TEST_P(ProxyEnd2endTest, EchoDeadline) {
   EXPECT_GE(response.param().request_deadline() - sent_deadline.tv_sec, -1);
 }
 
+// The proxy holds back part of the deadline from the backend.
+TEST_P(ProxyEnd2endTest, EchoDeadlineWithReserve) {
+  if (!GetParam().use_proxy()) return;
+  proxy_propagation_options_.set_deadline_reserve(std::chrono::seconds(10));
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("Hello");
+  request.mutable_param()->set_echo_deadline(true);
+
+  ClientContext context;
+  std::chrono::system_clock::time_point deadline =
+      std::chrono::system_clock::now() + std::chrono::seconds(100);
+  context.set_deadline(deadline);
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(response.message(), request.message());
+  EXPECT_TRUE(s.ok());
+  gpr_timespec sent_deadline;
+  Timepoint2Timespec(deadline - std::chrono::seconds(10), &sent_deadline);
+  EXPECT_LE(response.param().request_deadline() - sent_deadline.tv_sec, 2);
+  EXPECT_GE(response.param().request_deadline() - sent_deadline.tv_sec, -1);
+}
+
+// The proxy fails the call itself when the backend would have too little
+// time for it.
+TEST_P(ProxyEnd2endTest, FailBelowMinDeadlineBudget) {
+  if (!GetParam().use_proxy()) return;
+  proxy_propagation_options_.set_deadline_reserve(std::chrono::seconds(1))
+      .set_min_deadline_budget(std::chrono::seconds(10));
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("Hello");
+
+  ClientContext context;
+  const auto start = std::chrono::system_clock::now();
+  context.set_deadline(start + std::chrono::seconds(10));
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(StatusCode::DEADLINE_EXCEEDED, s.error_code());
+  EXPECT_LT(std::chrono::system_clock::now() - start, std::chrono::seconds(5));
+  // Leaving enough time for the backend, the call goes through.
+  ClientContext context2;
+  context2.set_deadline(std::chrono::system_clock::now() +
+                        std::chrono::seconds(100));
+  s = stub_->Echo(&context2, request, &response);
+  EXPECT_TRUE(s.ok());
+  EXPECT_EQ(response.message(), request.message());
+}
+
 // Ask server to echo back the deadline it sees. The rpc has no deadline.
 TEST_P(ProxyEnd2endTest, EchoDeadlineForNoDeadlineRpc) {
   ResetStub();
@@ -0,0 +1,176 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/generic/callback_generic_service.h>
+#include <grpcpp/generic/generic_proxy.h>
+#include <grpcpp/generic/generic_stub_callback.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Forwards every call to the backend.
+class ProxyService : public CallbackGenericService {
+ public:
+  explicit ProxyService(std::shared_ptr<Channel> backend)
+      : stub_(std::move(backend)) {}
+
+  experimental::GenericProxyOptions options;
+
+ private:
+  ServerGenericBidiReactor* CreateReactor(
+      GenericCallbackServerContext* context) override {
+    return experimental::NewGenericProxyReactor(context, &stub_, options);
+  }
+
+  GenericStubCallback stub_;
+};
+
+class GenericProxyEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ServerBuilder backend_builder;
+    backend_builder.RegisterService(&service_);
+    backend_ = backend_builder.BuildAndStart();
+    proxy_service_ =
+        std::make_unique<ProxyService>(backend_->InProcessChannel({}));
+    ServerBuilder proxy_builder;
+    proxy_builder.RegisterCallbackGenericService(proxy_service_.get());
+    proxy_ = proxy_builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(proxy_->InProcessChannel({}));
+  }
+
+  void TearDown() override {
+    proxy_->Shutdown();
+    backend_->Shutdown();
+  }
+
+  TestServiceImpl service_;
+  std::unique_ptr<Server> backend_;
+  std::unique_ptr<ProxyService> proxy_service_;
+  std::unique_ptr<Server> proxy_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(GenericProxyEnd2endTest, UnaryCall) {
+  EchoRequest request;
+  request.set_message("hello");
+  EchoResponse response;
+  ClientContext context;
+  Status status = stub_->Echo(&context, request, &response);
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.message(), "hello");
+}
+
+TEST_F(GenericProxyEnd2endTest, ForwardsStatus) {
+  EchoRequest request;
+  request.set_message("fail");
+  request.mutable_param()->mutable_expected_error()->set_code(
+      StatusCode::FAILED_PRECONDITION);
+  request.mutable_param()->mutable_expected_error()->set_error_message(
+      "expected");
+  EchoResponse response;
+  ClientContext context;
+  Status status = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(status.error_code(), StatusCode::FAILED_PRECONDITION);
+  EXPECT_EQ(status.error_message(), "expected");
+}
+
+TEST_F(GenericProxyEnd2endTest, BidiStream) {
+  ClientContext context;
+  auto stream = stub_->BidiStream(&context);
+  EchoRequest request;
+  EchoResponse response;
+  for (int i = 0; i < 10; ++i) {
+    request.set_message("message " + std::to_string(i));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  stream->WritesDone();
+  EXPECT_FALSE(stream->Read(&response));
+  Status status = stream->Finish();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+}
+
+TEST_F(GenericProxyEnd2endTest, ForwardsMetadata) {
+  EchoRequest request;
+  request.set_message("hello");
+  request.mutable_param()->set_echo_metadata(true);
+  request.mutable_param()->set_echo_metadata_initially(true);
+  EchoResponse response;
+  ClientContext context;
+  context.AddMetadata("custom-key", "custom-value");
+  Status status = stub_->Echo(&context, request, &response);
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  auto initial = context.GetServerInitialMetadata().find("custom-key");
+  ASSERT_NE(initial, context.GetServerInitialMetadata().end());
+  EXPECT_EQ(initial->second, "custom-value");
+  auto trailing = context.GetServerTrailingMetadata().find("custom-key");
+  ASSERT_NE(trailing, context.GetServerTrailingMetadata().end());
+  EXPECT_EQ(trailing->second, "custom-value");
+}
+
+TEST_F(GenericProxyEnd2endTest, RewritesMetadata) {
+  proxy_service_->options.rewrite_request_metadata =
+      [](const GenericCallbackServerContext& /*downstream*/,
+         ClientContext* upstream) {
+        upstream->AddMetadata("custom-key", "from-proxy");
+      };
+  proxy_service_->options.rewrite_trailing_metadata =
+      [](const std::multimap<string_ref, string_ref>& /*upstream*/,
+         GenericCallbackServerContext* downstream) {
+        downstream->AddTrailingMetadata("proxied", "true");
+      };
+  EchoRequest request;
+  request.set_message("hello");
+  request.mutable_param()->set_echo_metadata(true);
+  EchoResponse response;
+  ClientContext context;
+  context.AddMetadata("custom-key", "from-client");
+  Status status = stub_->Echo(&context, request, &response);
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  const auto& trailing = context.GetServerTrailingMetadata();
+  EXPECT_EQ(trailing.find("custom-key"), trailing.end());
+  auto proxied = trailing.find("proxied");
+  ASSERT_NE(proxied, trailing.end());
+  EXPECT_EQ(proxied->second, "true");
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -309,6 +309,46 @@ TEST_F(HealthServiceEnd2endTest, DefaultHealthService) {
                      Status(StatusCode::INVALID_ARGUMENT, ""));
 }
 
+// Each response is serialized once and reused, so every Check and Watch
+// must still see the status as of its own write.
+TEST_F(HealthServiceEnd2endTest, DefaultHealthServiceFollowsStatusChanges) {
+  EnableDefaultHealthCheckService(true);
+  EXPECT_TRUE(DefaultHealthCheckServiceEnabled());
+  SetUpServer(true, false, false, nullptr);
+  HealthCheckServiceInterface* service = server_->GetHealthCheckService();
+  ASSERT_NE(service, nullptr);
+  ResetStubs();
+  const std::string kServiceName("flapping_service");
+  // Two watchers share the responses.
+  ClientContext contexts[2];
+  std::unique_ptr<grpc::ClientReaderInterface<HealthCheckResponse>>
+      readers[2];
+  HealthCheckRequest request;
+  request.set_service(kServiceName);
+  for (int i = 0; i < 2; ++i) {
+    readers[i] = hc_stub_->Watch(&contexts[i], request);
+    HealthCheckResponse response;
+    EXPECT_TRUE(readers[i]->Read(&response));
+    EXPECT_EQ(response.status(), HealthCheckResponse::SERVICE_UNKNOWN);
+  }
+  for (int round = 0; round < 3; ++round) {
+    for (bool serving : {true, false}) {
+      const HealthCheckResponse::ServingStatus expected =
+          serving ? HealthCheckResponse::SERVING
+                  : HealthCheckResponse::NOT_SERVING;
+      service->SetServingStatus(kServiceName, serving);
+      for (auto& reader : readers) {
+        HealthCheckResponse response;
+        EXPECT_TRUE(reader->Read(&response));
+        EXPECT_EQ(response.status(), expected);
+      }
+      SendHealthCheckRpc(kServiceName, Status::OK, expected);
+      SendHealthCheckRpc(kServiceName, Status::OK, expected);
+    }
+  }
+  for (auto& context : contexts) context.TryCancel();
+}
+
 TEST_F(HealthServiceEnd2endTest, DefaultHealthServiceShutdown) {
   EnableDefaultHealthCheckService(true);
   EXPECT_TRUE(DefaultHealthCheckServiceEnabled());
@@ -21,13 +21,17 @@
 #include <grpcpp/client_context.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/impl/sync.h>
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -849,6 +853,75 @@ TEST_P(HybridEnd2endTest, CallbackGenericEcho) {
   TestAllMethods();
 }
 
+// Each call to a callback generic service sees its own method and deadline,
+// even though the server recycles the memory of the requests it serves.
+TEST_P(HybridEnd2endTest, CallbackGenericCallDetails) {
+  EchoTestService::WithGenericMethod_Echo<
+      EchoTestService::WithGenericMethod_Echo1<TestServiceImpl>>
+      service;
+  class DetailsService : public CallbackGenericService {
+   public:
+    std::vector<std::chrono::system_clock::time_point> deadlines() {
+      grpc::internal::MutexLock lock(&mu_);
+      return deadlines_;
+    }
+
+   private:
+    ServerGenericBidiReactor* CreateReactor(
+        GenericCallbackServerContext* context) override {
+      {
+        grpc::internal::MutexLock lock(&mu_);
+        deadlines_.push_back(context->deadline());
+      }
+      class Reactor : public ServerGenericBidiReactor {
+       public:
+        explicit Reactor(const std::string& method) {
+          Finish(Status(StatusCode::FAILED_PRECONDITION, method));
+        }
+
+       private:
+        void OnDone() override { delete this; }
+      };
+      return new Reactor(context->method());
+    }
+
+    grpc::internal::Mutex mu_;
+    std::vector<std::chrono::system_clock::time_point> deadlines_;
+  } generic_service;
+
+  if (!SetUpServer(&service, nullptr, nullptr, &generic_service)) {
+    return;
+  }
+  ResetStub();
+  std::vector<std::chrono::system_clock::time_point> deadlines;
+  for (int i = 0; i < 10; ++i) {
+    ClientContext context;
+    deadlines.push_back(std::chrono::system_clock::now() +
+                        std::chrono::seconds(100 + 10 * i));
+    context.set_deadline(deadlines.back());
+    EchoRequest request;
+    EchoResponse response;
+    Status status;
+    const char* method;
+    if (i % 2 == 0) {
+      status = stub_->Echo(&context, request, &response);
+      method = "/grpc.testing.EchoTestService/Echo";
+    } else {
+      status = stub_->Echo1(&context, request, &response);
+      method = "/grpc.testing.EchoTestService/Echo1";
+    }
+    EXPECT_EQ(status.error_code(), StatusCode::FAILED_PRECONDITION);
+    EXPECT_EQ(status.error_message(), method);
+  }
+  std::vector<std::chrono::system_clock::time_point> seen =
+      generic_service.deadlines();
+  ASSERT_EQ(seen.size(), deadlines.size());
+  for (size_t i = 0; i < seen.size(); ++i) {
+    EXPECT_LT(std::chrono::abs(seen[i] - deadlines[i]), std::chrono::seconds(1))
+        << "call " << i;
+  }
+}
+
 TEST_F(HybridEnd2endTest, GenericEchoAsyncRequestStream) {
   typedef EchoTestService::WithAsyncMethod_RequestStream<
       EchoTestService::WithGenericMethod_Echo<TestServiceImpl>>
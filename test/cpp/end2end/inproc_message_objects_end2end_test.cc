@@ -0,0 +1,146 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/channel_arguments.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Smaller than any message of these tests, but larger than the placeholder
+// that carries a message object.  Only calls that pass objects get through.
+constexpr int kMaxMessageSize = 16;
+
+// Well over kMaxMessageSize.
+const std::string kLargeMessage(1024, 'x');
+
+class InprocMessageObjectsEnd2endTest
+    : public ::testing::TestWithParam<bool /*callback_server*/> {
+ protected:
+  void SetUp() override {
+    ServerBuilder builder;
+    builder.SetMaxReceiveMessageSize(kMaxMessageSize);
+    if (GetParam()) {
+      builder.RegisterService(&callback_service_);
+    } else {
+      builder.RegisterService(&sync_service_);
+    }
+    server_ = builder.BuildAndStart();
+    ASSERT_NE(server_, nullptr);
+  }
+
+  void TearDown() override { server_->Shutdown(); }
+
+  std::unique_ptr<EchoTestService::Stub> NewStub(
+      bool pass_message_objects, int max_receive_message_size = -1) {
+    ChannelArguments args;
+    if (pass_message_objects) {
+      args.SetInt(GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS, 1);
+    }
+    if (max_receive_message_size >= 0) {
+      args.SetMaxReceiveMessageSize(max_receive_message_size);
+    }
+    return EchoTestService::NewStub(server_->InProcessChannel(args));
+  }
+
+  TestServiceImpl sync_service_;
+  CallbackTestServiceImpl callback_service_;
+  std::unique_ptr<Server> server_;
+};
+
+TEST_P(InprocMessageObjectsEnd2endTest, UnaryCallPassesObjects) {
+  auto stub = NewStub(/*pass_message_objects=*/true, kMaxMessageSize);
+  for (int i = 0; i < 3; ++i) {
+    EchoRequest request;
+    request.set_message(absl::StrCat(kLargeMessage, i));
+    EchoResponse response;
+    ClientContext context;
+    Status status = stub->Echo(&context, request, &response);
+    ASSERT_TRUE(status.ok()) << status.error_message();
+    EXPECT_EQ(response.message(), request.message());
+  }
+}
+
+TEST_P(InprocMessageObjectsEnd2endTest, UnaryCallSerializesWithoutTheArg) {
+  auto stub = NewStub(/*pass_message_objects=*/false);
+  EchoRequest request;
+  request.set_message(kLargeMessage);
+  EchoResponse response;
+  ClientContext context;
+  Status status = stub->Echo(&context, request, &response);
+  EXPECT_EQ(status.error_code(), StatusCode::RESOURCE_EXHAUSTED)
+      << status.error_message();
+}
+
+TEST_P(InprocMessageObjectsEnd2endTest, ServerStreamingRepliesWithObjects) {
+  auto stub = NewStub(/*pass_message_objects=*/true, kMaxMessageSize);
+  EchoRequest request;
+  request.set_message(kLargeMessage);
+  ClientContext context;
+  auto reader = stub->ResponseStream(&context, request);
+  EchoResponse response;
+  int responses = 0;
+  while (reader->Read(&response)) {
+    EXPECT_EQ(response.message(), absl::StrCat(kLargeMessage, responses));
+    ++responses;
+  }
+  Status status = reader->Finish();
+  ASSERT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(responses, kServerDefaultResponseStreamsToSend);
+}
+
+TEST_P(InprocMessageObjectsEnd2endTest, ClientStreamingPassesRequestObjects) {
+  // The response is serialized, so the client takes messages of any size.
+  auto stub = NewStub(/*pass_message_objects=*/true);
+  ClientContext context;
+  EchoResponse response;
+  auto writer = stub->RequestStream(&context, &response);
+  EchoRequest request;
+  request.set_message(kLargeMessage);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(writer->Write(request));
+  }
+  writer->WritesDone();
+  Status status = writer->Finish();
+  ASSERT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.message(),
+            absl::StrCat(kLargeMessage, kLargeMessage, kLargeMessage));
+}
+
+INSTANTIATE_TEST_SUITE_P(InprocMessageObjectsEnd2endTest,
+                         InprocMessageObjectsEnd2endTest, ::testing::Bool());
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -203,6 +203,21 @@ TEST_P(NullAllocatorTest, SimpleRpc) {
   SendRpcs(1);
 }
 
+TEST_P(NullAllocatorTest, MessagesShareProtobufArena) {
+  std::atomic_int arena_count{0};
+  auto mutator = [&arena_count](RpcAllocatorState* /*allocator_state*/,
+                                const EchoRequest* req, EchoResponse* resp) {
+    EXPECT_NE(req->GetArena(), nullptr);
+    EXPECT_EQ(req->GetArena(), resp->GetArena());
+    arena_count++;
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  CreateServer(nullptr);
+  ResetStub();
+  SendRpcs(3);
+  EXPECT_EQ(arena_count, 3);
+}
+
 class SimpleAllocatorTest : public MessageAllocatorEnd2endTestBase {
  public:
   class SimpleAllocator : public MessageAllocator<EchoRequest, EchoResponse> {
@@ -0,0 +1,131 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/resource_quota.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+class CountingEchoService : public EchoTestService::Service {
+ public:
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    ++calls_;
+    response->set_message(request->message());
+    return Status::OK;
+  }
+
+  Status Echo1(ServerContext* context, const EchoRequest* request,
+               EchoResponse* response) override {
+    return Echo(context, request, response);
+  }
+
+  int calls() const { return calls_.load(); }
+
+ private:
+  std::atomic<int> calls_{0};
+};
+
+class MethodBudgetEnd2endTest : public ::testing::Test {
+ protected:
+  void StartServer(const ResourceQuota& quota) {
+    server_address_ = absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address_, InsecureServerCredentials());
+    builder.SetResourceQuota(quota);
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    ASSERT_NE(server_, nullptr);
+    stub_ = EchoTestService::NewStub(
+        grpc::CreateChannel(server_address_, InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    if (server_ != nullptr) server_->Shutdown();
+  }
+
+  Status Echo() {
+    ClientContext context;
+    EchoRequest request;
+    request.set_message("hello");
+    EchoResponse response;
+    return stub_->Echo(&context, request, &response);
+  }
+
+  Status Echo1() {
+    ClientContext context;
+    EchoRequest request;
+    request.set_message("hello");
+    EchoResponse response;
+    return stub_->Echo1(&context, request, &response);
+  }
+
+  CountingEchoService service_;
+  std::string server_address_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(MethodBudgetEnd2endTest, CallsOverBudgetAreRejectedBeforeTheHandler) {
+  ResourceQuota quota("method_budget");
+  // Less than any call is estimated to use.
+  quota.SetMethodBudget("/grpc.testing.EchoTestService/Echo", 1);
+  StartServer(quota);
+  Status status = Echo();
+  EXPECT_EQ(status.error_code(), StatusCode::RESOURCE_EXHAUSTED)
+      << status.error_message();
+  EXPECT_EQ(service_.calls(), 0);
+  // Other methods of the service have no budget.
+  EXPECT_TRUE(Echo1().ok());
+  EXPECT_EQ(service_.calls(), 1);
+}
+
+TEST_F(MethodBudgetEnd2endTest, ServiceBudgetAdmitsCallsWithinIt) {
+  ResourceQuota quota("service_budget");
+  quota.SetMethodBudget("/grpc.testing.EchoTestService/", 1024 * 1024,
+                        ResourceQuota::MethodPriority::kHigh);
+  StartServer(quota);
+  for (int i = 0; i < 10; ++i) {
+    Status status = Echo();
+    EXPECT_TRUE(status.ok()) << status.error_message();
+  }
+  EXPECT_EQ(service_.calls(), 10);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
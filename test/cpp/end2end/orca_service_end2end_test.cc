@@ -238,6 +238,71 @@ TEST_F(OrcaServiceEnd2endTest, Basic) {
   });
 }
 
+TEST_F(OrcaServiceEnd2endTest, CallLatencyPercentiles) {
+  auto stub = OpenRcaService::NewStub(channel_);
+  // Latencies are not recorded until percentiles are enabled.
+  server_metric_recorder_->RecordCallLatency(5);
+  server_metric_recorder_->EnableCallLatencyPercentiles();
+  server_metric_recorder_->RecordCallLatency(0.25);
+  Stream stream(stub.get(), grpc_core::Duration::Milliseconds(1000));
+  OrcaLoadReport response = stream.ReadResponse();
+  EXPECT_THAT(response.named_metrics(),
+              ::testing::UnorderedElementsAre(
+                  ::testing::Pair("grpc.server.call_latency.p50", 0.25),
+                  ::testing::Pair("grpc.server.call_latency.p90", 0.25),
+                  ::testing::Pair("grpc.server.call_latency.p99", 0.25)));
+}
+
+TEST_F(OrcaServiceEnd2endTest, ReportsOnlySignificantChanges) {
+  // A service that skips reports with no change of more than 10%, but sends
+  // one at least every 3 seconds.
+  OrcaService orca_service(server_metric_recorder_.get(),
+                           OrcaService::Options()
+                               .set_min_report_duration(absl::ZeroDuration())
+                               .set_change_threshold(0.1)
+                               .set_max_report_duration(absl::Seconds(3)));
+  ServerBuilder builder;
+  builder.RegisterService(&orca_service);
+  auto server = builder.BuildAndStart();
+  auto stub = OpenRcaService::NewStub(server->InProcessChannel({}));
+  ClientContext context;
+  OrcaLoadReportRequest request;
+  request.mutable_report_interval()->set_nanos(500000000);
+  auto stream = stub->StreamCoreMetrics(&context, request);
+  const grpc_core::Duration fudge_factor =
+      grpc_core::Duration::Milliseconds(750) * grpc_test_slowdown_factor();
+  auto read_response = [&](grpc_core::Duration expected_wait) {
+    auto start = grpc_core::Timestamp::FromTimespecRoundDown(
+        gpr_now(GPR_CLOCK_MONOTONIC));
+    OrcaLoadReport response;
+    EXPECT_TRUE(stream->Read(&response));
+    auto elapsed = grpc_core::Timestamp::FromTimespecRoundDown(
+                       gpr_now(GPR_CLOCK_MONOTONIC)) -
+                   start;
+    EXPECT_GE(elapsed, expected_wait - fudge_factor) << elapsed.ToString();
+    EXPECT_LE(elapsed, expected_wait + fudge_factor) << elapsed.ToString();
+    return response;
+  };
+  // The initial report is sent right away.
+  read_response(grpc_core::Duration::Zero());
+  // Setting a metric is a significant change.
+  server_metric_recorder_->SetCpuUtilization(0.5);
+  EXPECT_EQ(read_response(grpc_core::Duration::Milliseconds(500))
+                .cpu_utilization(),
+            0.5);
+  // A 4% change waits for the heartbeat, which carries the current value.
+  server_metric_recorder_->SetCpuUtilization(0.52);
+  EXPECT_EQ(read_response(grpc_core::Duration::Seconds(3)).cpu_utilization(),
+            0.52);
+  // A 50% change is reported at the next interval.
+  server_metric_recorder_->SetCpuUtilization(0.78);
+  EXPECT_EQ(read_response(grpc_core::Duration::Milliseconds(500))
+                .cpu_utilization(),
+            0.78);
+  context.TryCancel();
+  server->Shutdown();
+}
+
 TEST_F(OrcaServiceEnd2endTest, ClientClosesBeforeSendingMessage) {
   auto stub = std::make_unique<GenericStub>(channel_);
   GenericOrcaClientReactor reactor(stub.get());
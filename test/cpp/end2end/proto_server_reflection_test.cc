@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "src/proto/grpc/reflection/v1/reflection.grpc.pb.h"
@@ -209,6 +210,50 @@ TEST_F(ProtoServerReflectionTest, V1ApiInstalled) {
       << response.DebugString();
 }
 
+// File descriptors are serialized once and then reused, so later requests,
+// on the same stream or on another, must get the same bytes.
+TEST_F(ProtoServerReflectionTest, RepeatedFileRequestsGetTheSameDescriptors) {
+  ResetStub();
+  using Service = reflection::v1::ServerReflection;
+  using Request = reflection::v1::ServerReflectionRequest;
+  using Response = reflection::v1::ServerReflectionResponse;
+  const protobuf::FileDescriptor* file_desc =
+      ref_desc_pool_->FindFileContainingSymbol(
+          EchoTestService::service_full_name());
+  ASSERT_NE(file_desc, nullptr);
+  ASSERT_GT(file_desc->dependency_count(), 0);
+  Service::Stub stub(channel_);
+  std::vector<std::string> first_files;
+  for (int stream = 0; stream < 2; ++stream) {
+    ClientContext context;
+    auto reader_writer = stub.ServerReflectionInfo(&context);
+    for (int i = 0; i < 2; ++i) {
+      Request request;
+      request.set_file_by_filename(std::string(file_desc->name()));
+      ASSERT_TRUE(reader_writer->Write(request));
+      Response response;
+      ASSERT_TRUE(reader_writer->Read(&response));
+      const auto& files =
+          response.file_descriptor_response().file_descriptor_proto();
+      // The file itself and its transitive dependencies.
+      ASSERT_GT(files.size(), file_desc->dependency_count());
+      std::vector<std::string> received(files.begin(), files.end());
+      if (first_files.empty()) {
+        first_files = received;
+        protobuf::FileDescriptorProto expected;
+        file_desc->CopyTo(&expected);
+        protobuf::FileDescriptorProto actual;
+        ASSERT_TRUE(actual.ParseFromString(received[0]));
+        EXPECT_EQ(actual.SerializeAsString(), expected.SerializeAsString());
+      } else {
+        EXPECT_EQ(received, first_files);
+      }
+    }
+    reader_writer->WritesDone();
+    EXPECT_TRUE(reader_writer->Finish().ok());
+  }
+}
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -0,0 +1,259 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/server_interceptor.h>
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Echoes the request, tagged with the number of times the handler has run,
+// and holds every call open until the test releases it.
+class CoalescedEchoService : public EchoTestService::CallbackService {
+ public:
+  CoalescedEchoService() { MarkMethodCoalesced(0); }
+
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    std::lock_guard<std::mutex> lock(mu_);
+    ++handler_calls_;
+    cv_.notify_all();
+    response->set_message(request->message() + "/" +
+                          std::to_string(handler_calls_));
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    held_.push_back(reactor);
+    return reactor;
+  }
+
+  int handler_calls() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return handler_calls_;
+  }
+
+  void WaitForHandlerCalls(int count) {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [&] { return handler_calls_ >= count; });
+  }
+
+  void ReleaseAll(const Status& status) {
+    std::vector<ServerUnaryReactor*> held;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      held.swap(held_);
+    }
+    for (ServerUnaryReactor* reactor : held) reactor->Finish(status);
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int handler_calls_ = 0;
+  std::vector<ServerUnaryReactor*> held_;
+};
+
+// Counts the calls that have got past the interceptors, which is when a
+// coalesced call either runs the handler or starts waiting for another one.
+class ArrivalCounter {
+ public:
+  void Add() {
+    std::lock_guard<std::mutex> lock(mu_);
+    ++count_;
+    cv_.notify_all();
+  }
+
+  void WaitFor(int count) {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [&] { return count_ >= count; });
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int count_ = 0;
+};
+
+class ArrivalCountingInterceptor : public experimental::Interceptor {
+ public:
+  explicit ArrivalCountingInterceptor(ArrivalCounter* counter)
+      : counter_(counter) {}
+
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    const bool received = methods->QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::POST_RECV_MESSAGE);
+    // For the last interceptor, Proceed() runs the method handler.
+    methods->Proceed();
+    if (received) counter_->Add();
+  }
+
+ private:
+  ArrivalCounter* const counter_;
+};
+
+class ArrivalCountingInterceptorFactory
+    : public experimental::ServerInterceptorFactoryInterface {
+ public:
+  explicit ArrivalCountingInterceptorFactory(ArrivalCounter* counter)
+      : counter_(counter) {}
+
+  experimental::Interceptor* CreateServerInterceptor(
+      experimental::ServerRpcInfo* /*info*/) override {
+    return new ArrivalCountingInterceptor(counter_);
+  }
+
+ private:
+  ArrivalCounter* const counter_;
+};
+
+class RequestCoalescingEnd2endTest : public ::testing::Test {
+ protected:
+  struct PendingCall {
+    ClientContext context;
+    EchoRequest request;
+    EchoResponse response;
+    Status status;
+    bool done = false;
+  };
+
+  void SetUp() override {
+    ServerBuilder builder;
+    builder.RegisterService(&service_);
+    std::vector<
+        std::unique_ptr<experimental::ServerInterceptorFactoryInterface>>
+        creators;
+    creators.push_back(
+        std::make_unique<ArrivalCountingInterceptorFactory>(&arrivals_));
+    builder.experimental().SetInterceptorCreators(std::move(creators));
+    server_ = builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(server_->InProcessChannel({}));
+  }
+
+  void TearDown() override { server_->Shutdown(); }
+
+  PendingCall* StartEcho(const std::string& message) {
+    calls_.push_back(std::make_unique<PendingCall>());
+    PendingCall* call = calls_.back().get();
+    call->request.set_message(message);
+    stub_->async()->Echo(&call->context, &call->request, &call->response,
+                         [this, call](Status status) {
+                           std::lock_guard<std::mutex> lock(mu_);
+                           call->status = std::move(status);
+                           call->done = true;
+                           cv_.notify_all();
+                         });
+    return call;
+  }
+
+  void WaitForAllCalls() {
+    std::unique_lock<std::mutex> lock(mu_);
+    for (const auto& call : calls_) {
+      cv_.wait(lock, [&] { return call->done; });
+    }
+  }
+
+  CoalescedEchoService service_;
+  ArrivalCounter arrivals_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  std::vector<std::unique_ptr<PendingCall>> calls_;
+};
+
+TEST_F(RequestCoalescingEnd2endTest, IdenticalRequestsShareOneResponse) {
+  PendingCall* first = StartEcho("foo");
+  PendingCall* second = StartEcho("foo");
+  PendingCall* third = StartEcho("foo");
+  PendingCall* other = StartEcho("bar");
+  arrivals_.WaitFor(4);
+  EXPECT_EQ(service_.handler_calls(), 2);
+  service_.ReleaseAll(Status::OK);
+  WaitForAllCalls();
+  for (PendingCall* call : {first, second, third, other}) {
+    EXPECT_TRUE(call->status.ok()) << call->status.error_message();
+  }
+  EXPECT_EQ(first->response.message(), second->response.message());
+  EXPECT_EQ(first->response.message(), third->response.message());
+  EXPECT_NE(first->response.message(), other->response.message());
+  // Once the response has been sent, the next identical request runs the
+  // handler again.
+  PendingCall* later = StartEcho("foo");
+  arrivals_.WaitFor(5);
+  EXPECT_EQ(service_.handler_calls(), 3);
+  service_.ReleaseAll(Status::OK);
+  WaitForAllCalls();
+  EXPECT_EQ(later->response.message(), "foo/3");
+}
+
+TEST_F(RequestCoalescingEnd2endTest, ErrorIsShared) {
+  PendingCall* first = StartEcho("foo");
+  PendingCall* second = StartEcho("foo");
+  arrivals_.WaitFor(2);
+  EXPECT_EQ(service_.handler_calls(), 1);
+  service_.ReleaseAll(Status(StatusCode::UNAVAILABLE, "try again"));
+  WaitForAllCalls();
+  for (PendingCall* call : {first, second}) {
+    EXPECT_EQ(call->status.error_code(), StatusCode::UNAVAILABLE);
+    EXPECT_EQ(call->status.error_message(), "try again");
+    EXPECT_EQ(call->response.message(), "");
+  }
+}
+
+TEST_F(RequestCoalescingEnd2endTest, CancelledCallLeavesWaitersToRerun) {
+  PendingCall* first = StartEcho("foo");
+  PendingCall* second = StartEcho("foo");
+  arrivals_.WaitFor(2);
+  EXPECT_EQ(service_.handler_calls(), 1);
+  // The call running the handler runs out of its own deadline, which says
+  // nothing about the call waiting for it. That one runs the handler itself.
+  service_.ReleaseAll(Status(StatusCode::DEADLINE_EXCEEDED, "too late"));
+  service_.WaitForHandlerCalls(2);
+  service_.ReleaseAll(Status::OK);
+  WaitForAllCalls();
+  // Either call may have been the first to run the handler.
+  PendingCall* leader = first->status.ok() ? second : first;
+  PendingCall* waiter = first->status.ok() ? first : second;
+  EXPECT_EQ(leader->status.error_code(), StatusCode::DEADLINE_EXCEEDED);
+  EXPECT_TRUE(waiter->status.ok()) << waiter->status.error_message();
+  EXPECT_EQ(waiter->response.message(), "foo/2");
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
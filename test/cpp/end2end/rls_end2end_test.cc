@@ -1234,6 +1234,66 @@ TEST_F(RlsEnd2endTest, CacheSizeLimit) {
   EXPECT_EQ(backends_[1]->service_.request_count(), 2);
 }
 
+TEST_F(RlsEnd2endTest, CacheSizeLimitEvictsLeastRecentlyUsedEntry) {
+  const char* kTestValue2 = "test_value_2";
+  StartBackends(2);
+  auto service_config_builder = MakeServiceConfigBuilder().AddKeyBuilder(
+      absl::StrFormat("\"names\":[{"
+                      "  \"service\":\"%s\","
+                      "  \"method\":\"%s\""
+                      "}],"
+                      "\"headers\":["
+                      "  {"
+                      "    \"key\":\"%s\","
+                      "    \"names\":["
+                      "      \"key1\""
+                      "    ]"
+                      "  }"
+                      "]",
+                      kServiceValue, kMethodValue, kTestKey));
+  SetNextResolution(service_config_builder.Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)}));
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue2}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[1]->port_)}));
+  // Create the entry for kTestValue and wait for min_eviction_time to
+  // elapse, so that it can be evicted.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(6));
+  // Create the entry for kTestValue2, which is held by min_eviction_time.
+  // The entry for kTestValue is now the least recently used one.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue2}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  // Use the entry for kTestValue again, which makes the entry for
+  // kTestValue2 the least recently used one. The second RPC uses the entry
+  // that is already the most recently used one.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 3);
+  EXPECT_EQ(backends_[1]->service_.request_count(), 1);
+  // Shrink the cache so that it is not even big enough for one entry.
+  // Eviction starts at the least recently used entry and stops at the first
+  // one that cannot be evicted yet. That is the entry for kTestValue2, so
+  // both entries are kept.
+  SetNextResolution(service_config_builder.set_cache_size_bytes(1).Build());
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue2}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  EXPECT_EQ(rls_server_->service_.response_count(), 2);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 4);
+  EXPECT_EQ(backends_[1]->service_.request_count(), 2);
+}
+
 TEST_F(RlsEnd2endTest, MultipleTargets) {
   StartBackends(1);
   SetNextResolution(
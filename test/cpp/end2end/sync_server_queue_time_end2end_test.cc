@@ -0,0 +1,152 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/util/byte_buffer_proto_helper.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+constexpr char kEchoMethod[] = "/grpc.testing.EchoTestService/Echo";
+
+void* tag(int i) { return reinterpret_cast<void*>(i); }
+
+class CountingEchoService : public EchoTestService::Service {
+ public:
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    ++calls_;
+    response->set_message(request->message());
+    return Status::OK;
+  }
+
+  int calls() const { return calls_.load(); }
+
+ private:
+  std::atomic<int> calls_{0};
+};
+
+class SyncServerQueueTimeEnd2endTest : public ::testing::Test {
+ protected:
+  // Starts the server with the given queue time limit, or none if 0.
+  void StartServer(int max_queue_time_msec) {
+    std::string server_address =
+        absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address, InsecureServerCredentials());
+    if (max_queue_time_msec > 0) {
+      builder.SetSyncServerOption(ServerBuilder::MAX_QUEUE_TIME_MSEC,
+                                  max_queue_time_msec);
+    }
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    ASSERT_NE(server_, nullptr);
+    generic_stub_ = std::make_unique<GenericStub>(
+        grpc::CreateChannel(server_address, InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    if (server_ != nullptr) server_->Shutdown();
+  }
+
+  // Makes an Echo call whose request message is sent \a delay after the
+  // call has started.  The server cannot run the handler before it has the
+  // request, so the call waits on the server for at least that long.
+  Status EchoWithDelayedRequest(absl::Duration delay) {
+    CompletionQueue cq;
+    ClientContext context;
+    auto call = generic_stub_->PrepareCall(&context, kEchoMethod, &cq);
+    auto next = [&cq](void* expected_tag) {
+      void* got_tag;
+      bool ok;
+      EXPECT_TRUE(cq.Next(&got_tag, &ok));
+      EXPECT_EQ(got_tag, expected_tag);
+    };
+    call->StartCall(tag(1));
+    next(tag(1));
+    absl::SleepFor(delay);
+    EchoRequest request;
+    request.set_message("hello");
+    call->Write(*SerializeToByteBuffer(&request), tag(2));
+    next(tag(2));
+    call->WritesDone(tag(3));
+    next(tag(3));
+    ByteBuffer response;
+    call->Read(&response, tag(4));
+    next(tag(4));
+    Status status;
+    call->Finish(&status, tag(5));
+    next(tag(5));
+    cq.Shutdown();
+    void* ignored_tag;
+    bool ignored_ok;
+    while (cq.Next(&ignored_tag, &ignored_ok)) {
+    }
+    return status;
+  }
+
+  CountingEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<GenericStub> generic_stub_;
+};
+
+TEST_F(SyncServerQueueTimeEnd2endTest, LateCallsAreRejectedBeforeTheHandler) {
+  StartServer(/*max_queue_time_msec=*/200);
+  Status status = EchoWithDelayedRequest(absl::Seconds(1));
+  EXPECT_EQ(status.error_code(), StatusCode::RESOURCE_EXHAUSTED)
+      << status.error_message();
+  EXPECT_EQ(service_.calls(), 0);
+  // Calls that get a thread in time are run as usual.
+  status = EchoWithDelayedRequest(absl::ZeroDuration());
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(service_.calls(), 1);
+}
+
+TEST_F(SyncServerQueueTimeEnd2endTest, CallsAreNotLimitedByDefault) {
+  StartServer(/*max_queue_time_msec=*/0);
+  Status status = EchoWithDelayedRequest(absl::Seconds(1));
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(service_.calls(), 1);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
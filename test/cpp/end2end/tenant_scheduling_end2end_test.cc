@@ -0,0 +1,163 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+constexpr char kTenantKey[] = "x-tenant";
+
+// Blocks each call until kCalls of them are in their handlers at once.
+class BlockingEchoService : public EchoTestService::Service {
+ public:
+  static constexpr int kCalls = 3;
+
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    std::unique_lock<std::mutex> lock(mu_);
+    ++in_handler_;
+    cv_.notify_all();
+    if (!cv_.wait_for(lock, std::chrono::seconds(10),
+                      [this] { return in_handler_ >= kCalls; })) {
+      return Status(StatusCode::DEADLINE_EXCEEDED, "handlers did not overlap");
+    }
+    response->set_message(request->message());
+    return Status::OK;
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int in_handler_ = 0;
+};
+
+class CallbackEchoService : public EchoTestService::CallbackService {
+ public:
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    response->set_message(request->message());
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+};
+
+class TenantSchedulingEnd2endTest : public ::testing::Test {
+ protected:
+  void StartServer(Service* service) {
+    int port = grpc_pick_unused_port_or_die();
+    server_address_ = absl::StrCat("localhost:", port);
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address_, InsecureServerCredentials());
+    builder.AddChannelArgument(GRPC_ARG_SERVER_TENANT_FAIR_SCHEDULING, 1);
+    builder.AddChannelArgument(GRPC_ARG_SERVER_TENANT_MAX_CONCURRENCY, 1);
+    builder.AddChannelArgument(GRPC_ARG_SERVER_TENANT_METADATA_KEY,
+                               std::string(kTenantKey));
+    builder.RegisterService(service);
+    server_ = builder.BuildAndStart();
+    ASSERT_NE(server_, nullptr);
+    stub_ = EchoTestService::NewStub(
+        grpc::CreateChannel(server_address_, InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    if (server_ != nullptr) server_->Shutdown();
+  }
+
+  Status Echo(const std::string& tenant) {
+    ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() +
+                         std::chrono::seconds(30));
+    if (!tenant.empty()) context.AddMetadata(kTenantKey, tenant);
+    EchoRequest request;
+    request.set_message("hello");
+    EchoResponse response;
+    return stub_->Echo(&context, request, &response);
+  }
+
+  std::string server_address_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+// Sync handlers may block for as long as they like, and the sync server's
+// thread pool already bounds them, so a handler blocked in its thread must
+// not keep the others of the same tenant from starting.
+TEST_F(TenantSchedulingEnd2endTest, BlockedSyncHandlersDoNotStallOthers) {
+  BlockingEchoService service;
+  StartServer(&service);
+  std::vector<std::thread> threads;
+  std::vector<Status> statuses(BlockingEchoService::kCalls);
+  for (int i = 0; i < BlockingEchoService::kCalls; ++i) {
+    threads.emplace_back([this, &statuses, i] { statuses[i] = Echo("a"); });
+  }
+  for (std::thread& thread : threads) thread.join();
+  for (const Status& status : statuses) {
+    EXPECT_TRUE(status.ok()) << status.error_message();
+  }
+  // Sync calls are not scheduled by tenant.
+  EXPECT_TRUE(server_->experimental().GetTenantStats().empty());
+}
+
+TEST_F(TenantSchedulingEnd2endTest, CallbackCallsAreChargedToTheirTenant) {
+  CallbackEchoService service;
+  StartServer(&service);
+  ASSERT_TRUE(Echo("a").ok());
+  ASSERT_TRUE(Echo("a").ok());
+  ASSERT_TRUE(Echo("b").ok());
+  std::map<std::string, uint64_t> calls_started;
+  for (const auto& stats : server_->experimental().GetTenantStats()) {
+    calls_started[stats.tenant] = stats.calls_started;
+  }
+  EXPECT_EQ(calls_started["a"], 2u);
+  EXPECT_EQ(calls_started["b"], 1u);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -558,6 +558,33 @@ TEST(MeshLabelsIterableTest, TestResetIteratorPosition) {
   EXPECT_THAT(labels, expected_labels_matcher) << PrettyPrintLabels(labels);
 }
 
+TEST(ServiceMeshLabelsInjectorTest, RepeatedPeerMetadata) {
+  grpc::internal::ServiceMeshLabelsInjector injector(
+      TestGkeResource().GetAttributes());
+  grpc_core::Slice remote_metadata =
+      RemoteMetadataSliceFromResource(TestGceResource());
+  std::vector<std::vector<std::pair<std::string, std::string>>> results;
+  for (int i = 0; i < 3; ++i) {
+    grpc_metadata_batch incoming_metadata;
+    // The last call gets a value that does not decode.
+    incoming_metadata.Set(grpc_core::XEnvoyPeerMetadata(),
+                          i == 2 ? grpc_core::Slice::FromCopiedString("junk")
+                                 : remote_metadata.Ref());
+    auto iterable = injector.GetLabels(&incoming_metadata);
+    std::vector<std::pair<std::string, std::string>> labels;
+    while (auto label = iterable->Next()) {
+      labels.emplace_back(label->first, label->second);
+    }
+    results.push_back(std::move(labels));
+  }
+  EXPECT_THAT(results[0], ::testing::Contains(Pair("csm.remote_workload_type",
+                                                   "gcp_compute_engine")));
+  // The cached labels are the same as the decoded ones.
+  EXPECT_EQ(results[0], results[1]);
+  EXPECT_THAT(results[2],
+              ::testing::Contains(Pair("csm.remote_workload_type", "unknown")));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     MetadataExchange, MetadataExchangeTest,
     ::testing::Values(TestScenario(TestScenario::ResourceType::kGke),
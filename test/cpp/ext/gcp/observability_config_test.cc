@@ -233,6 +233,46 @@ TEST(GcpObservabilityConfigJsonParsingTest,
               "error:Wildcard specified for method in incorrect manner")));
 }
 
+TEST(GcpObservabilityConfigJsonParsingTest, LoggingConfigSamplingRate) {
+  const char* json_str = R"json({
+      "cloud_logging": {
+        "client_rpc_events": [
+          {
+            "methods": ["*"]
+          },
+          {
+            "methods": ["service/method"],
+            "sampling_rate": 0.25
+          }
+        ],
+        "server_rpc_events": [
+          {
+            "methods": ["*"],
+            "sampling_rate": 1.5
+          }
+        ]
+      }
+    })json";
+  auto json = grpc_core::JsonParse(json_str);
+  ASSERT_TRUE(json.ok()) << json.status();
+  grpc_core::ValidationErrors errors;
+  auto config = grpc_core::LoadFromJson<GcpObservabilityConfig>(
+      *json, grpc_core::JsonArgs(), &errors);
+  EXPECT_THAT(
+      errors.status(absl::StatusCode::kInvalidArgument, "Parsing error")
+          .ToString(),
+      ::testing::AllOf(
+          ::testing::HasSubstr(
+              "field:cloud_logging.server_rpc_events[0].sampling_rate "
+              "error:must be between 0 and 1"),
+          ::testing::Not(::testing::HasSubstr("client_rpc_events"))));
+  ASSERT_TRUE(config.cloud_logging.has_value());
+  ASSERT_EQ(config.cloud_logging->client_rpc_events.size(), 2);
+  EXPECT_FLOAT_EQ(config.cloud_logging->client_rpc_events[0].sampling_rate, 1);
+  EXPECT_FLOAT_EQ(config.cloud_logging->client_rpc_events[1].sampling_rate,
+                  0.25);
+}
+
 TEST(GcpObservabilityConfigJsonParsingTest, SamplingRateDefaults) {
   const char* json_str = R"json({
       "cloud_trace": {
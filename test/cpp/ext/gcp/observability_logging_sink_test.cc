@@ -77,6 +77,39 @@ TEST(GcpObservabilityLoggingSinkTest, LoggingConfigClientWildCardEntries) {
   EXPECT_FALSE(sink.FindMatch(false, "foo", "bar").ShouldLog());
 }
 
+TEST(GcpObservabilityLoggingSinkTest, LoggingConfigSamplingRate) {
+  const char* json_str = R"json({
+      "cloud_logging": {
+        "client_rpc_events": [
+          {
+            "methods": ["foo/*"],
+            "sampling_rate": 0
+          },
+          {
+            "methods": ["*"],
+            "max_metadata_bytes": 1024,
+            "max_message_bytes": 4096,
+            "sampling_rate": 1
+          }
+        ]
+      }
+    })json";
+  auto json = grpc_core::JsonParse(json_str);
+  ASSERT_TRUE(json.ok()) << json.status();
+  grpc_core::ValidationErrors errors;
+  auto config = grpc_core::LoadFromJson<GcpObservabilityConfig>(
+      *json, grpc_core::JsonArgs(), &errors);
+  ASSERT_TRUE(errors.ok()) << errors.status(absl::StatusCode::kInvalidArgument,
+                                            "unexpected errors");
+  ObservabilityLoggingSink sink(config.cloud_logging.value(), "test", {});
+  // An unsampled call does not fall through to the next entry.
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_FALSE(sink.FindMatch(true, "foo", "bar").ShouldLog());
+    EXPECT_EQ(sink.FindMatch(true, "baz", "bar"),
+              LoggingSink::Config(1024, 4096));
+  }
+}
+
 TEST(GcpObservabilityLoggingSinkTest, LoggingConfigBadPath) {
   const char* json_str = R"json({
       "cloud_logging": {
@@ -26,6 +26,7 @@
 #include "opentelemetry/sdk/trace/simple_processor_factory.h"
 #include "opentelemetry/sdk/trace/tracer.h"
 #include "opentelemetry/sdk/trace/tracer_provider.h"
+#include "opentelemetry/trace/default_span.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/telemetry/call_tracer.h"
@@ -731,6 +732,33 @@ TEST_F(OTelTracingTest, PropagationParentToChild) {
   EXPECT_EQ((*server_span)->GetTraceId(), (*test_span)->GetTraceId());
 }
 
+// Tests that no spans are started for calls whose parent is not sampled, and
+// that the parent's context still flows to the servers and child calls.
+TEST_F(OTelTracingTest, UnsampledParentStartsNoSpans) {
+  {
+    grpc::ServerBuilder builder;
+    int port = grpc_pick_unused_port_or_die();
+    builder.AddListeningPort(grpc_core::JoinHostPort("0.0.0.0", port),
+                             grpc::InsecureServerCredentials(), nullptr);
+    PropagatingEchoTestServiceImpl service(stub_.get());
+    builder.RegisterService(&service);
+    auto server = builder.BuildAndStart();
+    auto channel = grpc::CreateChannel(absl::StrCat("localhost:", port),
+                                       grpc::InsecureChannelCredentials());
+    auto stub = EchoTestService::NewStub(channel);
+    const uint8_t trace_id[opentelemetry::trace::TraceId::kSize] = {1};
+    const uint8_t span_id[opentelemetry::trace::SpanId::kSize] = {1};
+    opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span(
+        new opentelemetry::trace::DefaultSpan(opentelemetry::trace::SpanContext(
+            opentelemetry::trace::TraceId(trace_id),
+            opentelemetry::trace::SpanId(span_id),
+            opentelemetry::trace::TraceFlags(), /*is_remote=*/false)));
+    auto scope = opentelemetry::sdk::trace::Tracer::WithActiveSpan(span);
+    SendRPC(stub.get());
+  }
+  EXPECT_THAT(GetSpans(1, absl::Seconds(1)), ::testing::IsEmpty());
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
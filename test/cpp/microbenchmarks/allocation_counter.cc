@@ -0,0 +1,301 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "test/cpp/microbenchmarks/allocation_counter.h"
+
+#include <errno.h>
+#include <grpc/support/port_platform.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/debugging/symbolize.h"
+#include "absl/flags/flag.h"
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
+
+ABSL_FLAG(bool, allocation_counts, false,
+          "Count heap allocations per benchmark iteration (slow: every "
+          "allocation records its stack)");
+ABSL_FLAG(int32_t, allocation_stack_prefix_depth, 4,
+          "Number of frames, outside of the allocator, that make up the stack "
+          "prefix allocations are broken down by");
+ABSL_FLAG(int32_t, allocation_stack_prefixes, 10,
+          "Number of top allocating stack prefixes to log per benchmark");
+
+#if defined(__GLIBC__) && !defined(GRPC_ASAN_ENABLED) && \
+    !defined(GRPC_TSAN_ENABLED) && !defined(ABSL_HAVE_MEMORY_SANITIZER)
+#define GRPC_ALLOCATION_COUNTER_INTERPOSE
+#include <execinfo.h>
+#endif
+
+namespace {
+
+constexpr int kMaxStackDepth = 64;
+
+struct Counts {
+  uint64_t allocs = 0;
+  uint64_t bytes = 0;
+};
+
+std::atomic<bool> g_counting{false};
+// Set while the hook itself runs, so its own allocations are not counted.
+thread_local bool g_in_hook = false;
+// std::mutex never allocates, unlike absl::Mutex under contention.
+std::mutex g_mu;
+absl::flat_hash_map<std::vector<void*>, Counts>* g_stacks = nullptr;
+
+#ifdef GRPC_ALLOCATION_COUNTER_INTERPOSE
+ABSL_ATTRIBUTE_NOINLINE void RecordAllocation(size_t size) {
+  if (!g_counting.load(std::memory_order_relaxed) || g_in_hook) return;
+  g_in_hook = true;
+  // backtrace() unwinds with the eh_frame data, so unlike a frame pointer walk
+  // it sees through libstdc++'s operator new.
+  void* pcs[kMaxStackDepth];
+  int depth = backtrace(pcs, kMaxStackDepth);
+  // Skip this function and the interposed allocator entry point.
+  constexpr int kSkip = 2;
+  {
+    std::lock_guard<std::mutex> lock(g_mu);
+    if (g_stacks != nullptr && depth > kSkip) {
+      Counts& counts =
+          (*g_stacks)[std::vector<void*>(pcs + kSkip, pcs + depth)];
+      ++counts.allocs;
+      counts.bytes += size;
+    }
+  }
+  g_in_hook = false;
+}
+#endif  // GRPC_ALLOCATION_COUNTER_INTERPOSE
+
+// Frames that only forward to the allocator; the stack prefix starts at the
+// first frame that is none of these.
+bool IsAllocatorFrame(absl::string_view name) {
+  for (absl::string_view prefix :
+       {"operator new", "gpr_malloc", "gpr_zalloc", "gpr_realloc", "std::",
+        "__gnu_cxx::", "__libc_", "malloc", "calloc", "realloc"}) {
+    if (absl::StartsWith(name, prefix)) return true;
+  }
+  return false;
+}
+
+enum class Side { kClient, kServer, kOther };
+
+// The nearest frame that belongs to one side of the call decides.
+Side Classify(const std::vector<std::string>& frames) {
+  static const char* const kServerMarkers[] = {
+      "grpc::Server",     "grpc_core::Server", "ServerCall",
+      "grpc::ServerAsync", "grpc_server_"};
+  static const char* const kClientMarkers[] = {
+      "grpc::Channel",         "grpc::ClientContext",
+      "grpc::ClientAsync",     "grpc::internal::BlockingUnaryCall",
+      "grpc_core::ClientChannel", "ClientCall",
+      "LoadBalancedCall",      "grpc_channel_",
+      "Stub::"};
+  for (const std::string& frame : frames) {
+    for (const char* marker : kServerMarkers) {
+      if (absl::StrContains(frame, marker)) return Side::kServer;
+    }
+    for (const char* marker : kClientMarkers) {
+      if (absl::StrContains(frame, marker)) return Side::kClient;
+    }
+  }
+  return Side::kOther;
+}
+
+const char* SideName(Side side) {
+  switch (side) {
+    case Side::kClient:
+      return "client";
+    case Side::kServer:
+      return "server";
+    case Side::kOther:
+      return "other";
+  }
+  return "";
+}
+
+}  // namespace
+
+#ifdef GRPC_ALLOCATION_COUNTER_INTERPOSE
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t n, size_t size);
+void* __libc_realloc(void* p, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+void* malloc(size_t size) noexcept {
+  RecordAllocation(size);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t n, size_t size) noexcept {
+  size_t total;
+  if (__builtin_mul_overflow(n, size, &total)) {
+    errno = ENOMEM;
+    return nullptr;
+  }
+  RecordAllocation(total);
+  return __libc_calloc(n, size);
+}
+
+void* realloc(void* p, size_t size) noexcept {
+  RecordAllocation(size);
+  return __libc_realloc(p, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+  RecordAllocation(size);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) noexcept {
+  // The alignment must be a power of two multiple of sizeof(void*).
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0 ||
+      alignment % sizeof(void*) != 0) {
+    return EINVAL;
+  }
+  RecordAllocation(size);
+  void* p = __libc_memalign(alignment, size);
+  if (p == nullptr) return ENOMEM;
+  *out = p;
+  return 0;
+}
+}
+#endif  // GRPC_ALLOCATION_COUNTER_INTERPOSE
+
+namespace grpc {
+namespace testing {
+
+AllocationCounter::AllocationCounter(benchmark::State& state,
+                                     absl::string_view unit)
+    : state_(state),
+      unit_(unit),
+      counting_(absl::GetFlag(FLAGS_allocation_counts)) {
+  if (!counting_) return;
+#ifndef GRPC_ALLOCATION_COUNTER_INTERPOSE
+  LOG_FIRST_N(WARNING, 1)
+      << "--allocation_counts needs glibc and no sanitizers, ignoring it";
+  counting_ = false;
+  return;
+#endif
+  std::lock_guard<std::mutex> lock(g_mu);
+  CHECK_EQ(g_stacks, nullptr) << "Only one AllocationCounter at a time";
+  g_stacks = new absl::flat_hash_map<std::vector<void*>, Counts>();
+  g_counting.store(true, std::memory_order_relaxed);
+}
+
+void AllocationCounter::Finish() {
+  if (!counting_) return;
+  counting_ = false;
+  g_counting.store(false, std::memory_order_relaxed);
+  absl::flat_hash_map<std::vector<void*>, Counts>* stacks;
+  {
+    std::lock_guard<std::mutex> lock(g_mu);
+    stacks = std::exchange(g_stacks, nullptr);
+  }
+  const size_t prefix_depth = std::max<int32_t>(
+      1, absl::GetFlag(FLAGS_allocation_stack_prefix_depth));
+  absl::flat_hash_map<void*, std::string> symbols;
+  auto symbolize = [&symbols](void* pc) -> const std::string& {
+    auto it = symbols.find(pc);
+    if (it != symbols.end()) return it->second;
+    char buf[1024];
+    // pc is a return address, look up the call instruction before it.
+    std::string name =
+        absl::Symbolize(static_cast<char*>(pc) - 1, buf, sizeof(buf))
+            ? buf
+            : absl::StrFormat("%p", pc);
+    return symbols.emplace(pc, std::move(name)).first->second;
+  };
+  Counts total;
+  Counts by_side[3];
+  struct Prefix {
+    Side side;
+    Counts counts;
+  };
+  absl::flat_hash_map<std::string, Prefix> prefixes;
+  for (const auto& [pcs, counts] : *stacks) {
+    std::vector<std::string> frames;
+    frames.reserve(pcs.size());
+    for (void* pc : pcs) frames.push_back(symbolize(pc));
+    Side side = Classify(frames);
+    auto first = std::find_if_not(frames.begin(), frames.end(),
+                                  IsAllocatorFrame);
+    auto last = first + std::min<size_t>(prefix_depth, frames.end() - first);
+    Prefix& prefix =
+        prefixes
+            .try_emplace(absl::StrJoin(first, last, " <- "), Prefix{side, {}})
+            .first->second;
+    for (Counts* c : {&total, &by_side[static_cast<int>(side)],
+                      &prefix.counts}) {
+      c->allocs += counts.allocs;
+      c->bytes += counts.bytes;
+    }
+  }
+  delete stacks;
+
+  auto per_iteration = [](uint64_t n) {
+    return benchmark::Counter(static_cast<double>(n),
+                              benchmark::Counter::kAvgIterations);
+  };
+  state_.counters[absl::StrCat("allocs_per_", unit_)] =
+      per_iteration(total.allocs);
+  state_.counters[absl::StrCat("alloc_bytes_per_", unit_)] =
+      per_iteration(total.bytes);
+  for (Side side : {Side::kClient, Side::kServer, Side::kOther}) {
+    state_.counters[absl::StrCat(SideName(side), "_allocs_per_", unit_)] =
+        per_iteration(by_side[static_cast<int>(side)].allocs);
+  }
+
+  std::vector<std::pair<std::string, Prefix>> top(prefixes.begin(),
+                                                  prefixes.end());
+  std::sort(top.begin(), top.end(), [](const auto& a, const auto& b) {
+    return a.second.counts.allocs > b.second.counts.allocs;
+  });
+  top.resize(std::min<size_t>(
+      top.size(),
+      std::max<int32_t>(0, absl::GetFlag(FLAGS_allocation_stack_prefixes))));
+  const double iterations =
+      std::max<double>(1, static_cast<double>(state_.iterations()));
+  std::string report;
+  for (const auto& [name, prefix] : top) {
+    absl::StrAppendFormat(&report, "\n  %10.2f %12.1f  %-6s  %s",
+                          prefix.counts.allocs / iterations,
+                          prefix.counts.bytes / iterations,
+                          SideName(prefix.side), name);
+  }
+  LOG(INFO) << "Top allocating stack prefixes (allocs/bytes per " << unit_
+            << "):" << report;
+}
+
+}  // namespace testing
+}  // namespace grpc
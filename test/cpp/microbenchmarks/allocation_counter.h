@@ -0,0 +1,66 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_TEST_CPP_MICROBENCHMARKS_ALLOCATION_COUNTER_H
+#define GRPC_TEST_CPP_MICROBENCHMARKS_ALLOCATION_COUNTER_H
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc {
+namespace testing {
+
+// Counts heap allocations made by the process between construction and
+// Finish(), when the benchmark runs with --allocation_counts. Counting works
+// by interposing malloc and friends, and so is only available with glibc and
+// without sanitizers; elsewhere it reports nothing.
+//
+// Every allocation is attributed to the client, the server, or neither
+// ("other": transport, polling, timers) by the nearest grpc::Channel /
+// grpc::Server (and similar) frame on its stack. Reported as benchmark
+// counters per iteration, where unit names what an iteration is ("rpc",
+// "msg"):
+//   allocs_per_<unit>, alloc_bytes_per_<unit>,
+//   client_allocs_per_<unit>, server_allocs_per_<unit>,
+//   other_allocs_per_<unit>
+// The stack prefixes allocating the most are logged, see
+// --allocation_stack_prefix_depth and --allocation_stack_prefixes.
+class AllocationCounter {
+ public:
+  AllocationCounter(benchmark::State& state, absl::string_view unit);
+  ~AllocationCounter() { Finish(); }
+
+  AllocationCounter(const AllocationCounter&) = delete;
+  AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+  // Stops counting and reports to state. Idempotent.
+  void Finish();
+
+ private:
+  benchmark::State& state_;
+  const std::string unit_;
+  bool counting_;
+};
+
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // GRPC_TEST_CPP_MICROBENCHMARKS_ALLOCATION_COUNTER_H
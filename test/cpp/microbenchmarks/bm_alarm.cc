@@ -16,7 +16,8 @@
 //
 //
 
-// This benchmark exists to ensure that immediately-firing alarms are fast
+// This benchmark exists to ensure that immediately-firing alarms are fast,
+// and compares the PosixEventEngine timer list implementations.
 
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
@@ -24,6 +25,13 @@
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -44,6 +52,83 @@ static void BM_Alarm_Tag_Immediate(benchmark::State& state) {
 }
 BENCHMARK(BM_Alarm_Tag_Immediate);
 
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::Timer;
+using grpc_event_engine::experimental::TimerList;
+using grpc_event_engine::experimental::TimerListHost;
+using grpc_event_engine::experimental::TimerWheel;
+
+class FakeTimerListHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now; }
+  void Kick() override {}
+
+  grpc_core::Timestamp now =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+// Start and cancel a timer, with state.range(0) other timers pending at
+// deadlines spread over the next few minutes, as with per-call deadlines and
+// keepalive timers on a busy server.
+template <typename TimerListType>
+static void BM_TimerInitCancel(benchmark::State& state) {
+  FakeTimerListHost host;
+  TimerListType timer_list(&host);
+  NoopClosure closure;
+  std::vector<Timer> background(state.range(0));
+  for (size_t i = 0; i < background.size(); ++i) {
+    timer_list.TimerInit(
+        &background[i],
+        host.now + grpc_core::Duration::Milliseconds(1 + (i * 7919) % 300000),
+        &closure);
+  }
+  Timer timer;
+  for (auto _ : state) {
+    timer_list.TimerInit(&timer,
+                         host.now + grpc_core::Duration::Milliseconds(20000),
+                         &closure);
+    CHECK(timer_list.TimerCancel(&timer));
+  }
+  for (Timer& t : background) CHECK(timer_list.TimerCancel(&t));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_TimerInitCancel, TimerList)->Range(0, 100000);
+BENCHMARK_TEMPLATE(BM_TimerInitCancel, TimerWheel)->Range(0, 100000);
+
+// Start state.range(0) timers due over the next second, and run them all by
+// checking once a millisecond.
+template <typename TimerListType>
+static void BM_TimerExpire(benchmark::State& state) {
+  FakeTimerListHost host;
+  TimerListType timer_list(&host);
+  NoopClosure closure;
+  std::vector<Timer> timers(state.range(0));
+  for (auto _ : state) {
+    const grpc_core::Timestamp start = host.now;
+    for (size_t i = 0; i < timers.size(); ++i) {
+      timer_list.TimerInit(
+          &timers[i],
+          start + grpc_core::Duration::Milliseconds(1 + (i * 7919) % 1000),
+          &closure);
+    }
+    size_t fired = 0;
+    while (fired < timers.size()) {
+      host.now += grpc_core::Duration::Milliseconds(1);
+      auto closures = timer_list.TimerCheck(nullptr);
+      CHECK(closures.has_value());
+      fired += closures->size();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TimerExpire, TimerList)->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_TimerExpire, TimerWheel)->Range(1, 100000);
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -15,11 +15,14 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <deque>
 
 #include "absl/log/check.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/mpmc_work_queue.h"
 #include "src/core/util/sync.h"
 #include "test/core/test_util/test_config.h"
 
@@ -27,10 +30,15 @@ namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::MpmcWorkQueue;
 
 grpc_core::Mutex globalMu;
 BasicWorkQueue globalWorkQueue;
+MpmcWorkQueue globalMpmcWorkQueue;
+ChaseLevWorkQueue globalChaseLevWorkQueue;
+std::atomic<int> globalStolen{0};
 std::deque<EventEngine::Closure*> globalDeque;
 
 // --- Multithreaded Tests ---------------------------------------------------
@@ -98,6 +106,62 @@ void BM_MultithreadedWorkQueuePopMostRecent(benchmark::State& state) {
 BENCHMARK(BM_MultithreadedWorkQueuePopMostRecent)
     ->Apply(MultithreadedTestArguments);
 
+void BM_MultithreadedMpmcWorkQueuePop(benchmark::State& state) {
+  AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  double pop_attempts = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < element_count; i++) globalMpmcWorkQueue.Add(&closure);
+    int cnt = 0;
+    do {
+      if (++pop_attempts && globalMpmcWorkQueue.PopOldest() != nullptr) ++cnt;
+    } while (cnt < element_count);
+  }
+  state.counters["added"] = element_count * state.iterations();
+  state.counters["pop_rate"] = benchmark::Counter(
+      element_count * state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["pop_attempts"] = pop_attempts;
+  state.counters["hit_rate"] =
+      benchmark::Counter(element_count * state.iterations() / pop_attempts,
+                         benchmark::Counter::kAvgThreads);
+  if (state.thread_index() == 0) {
+    CHECK(globalMpmcWorkQueue.Empty());
+  }
+}
+BENCHMARK(BM_MultithreadedMpmcWorkQueuePop)
+    ->Apply(MultithreadedTestArguments);
+
+// Thread 0 owns the queue, adding and popping its most recent closures, while
+// every other thread steals the oldest ones. This is how the thread pool uses
+// its per-thread queues.
+void BM_MultithreadedChaseLevWorkQueueSteal(benchmark::State& state) {
+  AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  int popped = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      for (int i = 0; i < element_count; i++) {
+        globalChaseLevWorkQueue.Add(&closure);
+      }
+      while (globalChaseLevWorkQueue.PopMostRecent() != nullptr) ++popped;
+    } else if (globalChaseLevWorkQueue.PopOldest() != nullptr) {
+      globalStolen.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  if (state.thread_index() == 0) {
+    state.counters["popped"] = popped;
+    state.counters["stolen"] = globalStolen.exchange(0);
+    CHECK(globalChaseLevWorkQueue.Empty());
+  }
+}
+BENCHMARK(BM_MultithreadedChaseLevWorkQueueSteal)
+    ->Range(1, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime()
+    ->Threads(2)
+    ->Threads(4)
+    ->ThreadPerCpu();
+
 void BM_MultithreadedStdDequeLIFO(benchmark::State& state) {
   int element_count = state.range(0);
   AnyInvocableClosure closure([] {});
@@ -145,6 +209,27 @@ BENCHMARK(BM_WorkQueueIntptrPopMostRecent)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
 
+void BM_ChaseLevWorkQueueIntptrPopMostRecent(benchmark::State& state) {
+  ChaseLevWorkQueue queue;
+  grpc_event_engine::experimental::AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  for (auto _ : state) {
+    int cnt = 0;
+    for (int i = 0; i < element_count; i++) queue.Add(&closure);
+    do {
+      if (queue.PopMostRecent() != nullptr) ++cnt;
+    } while (cnt < element_count);
+  }
+  state.counters["Added"] = element_count * state.iterations();
+  state.counters["Popped"] = state.counters["Added"];
+  state.counters["Pop Rate"] =
+      benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ChaseLevWorkQueueIntptrPopMostRecent)
+    ->Range(1, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
 void BM_WorkQueueClosureExecution(benchmark::State& state) {
   BasicWorkQueue queue;
   int element_count = state.range(0);
@@ -0,0 +1,130 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Microbenchmarks around CHTTP2 DATA frame deframing of large messages
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/ext/transport/chttp2/transport/frame_data.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+// Size of each endpoint read.
+constexpr size_t kReadSize = 64 * 1024;
+// Size of each DATA frame (the default SETTINGS_MAX_FRAME_SIZE).
+constexpr size_t kFrameSize = 16 * 1024;
+
+// One length-prefixed gRPC message of `message_size` bytes, laid out in
+// endpoint-read-sized slices as the transport would receive it.
+std::vector<grpc_slice> MakeReadSlices(size_t message_size) {
+  std::vector<uint8_t> wire(message_size + GRPC_HEADER_SIZE_IN_BYTES, 'x');
+  wire[0] = 0;
+  wire[1] = static_cast<uint8_t>(message_size >> 24);
+  wire[2] = static_cast<uint8_t>(message_size >> 16);
+  wire[3] = static_cast<uint8_t>(message_size >> 8);
+  wire[4] = static_cast<uint8_t>(message_size);
+  std::vector<grpc_slice> reads;
+  for (size_t i = 0; i < wire.size(); i += kReadSize) {
+    const size_t n = std::min(kReadSize, wire.size() - i);
+    grpc_slice s = grpc_slice_malloc(n);
+    memcpy(GRPC_SLICE_START_PTR(s), wire.data() + i, n);
+    reads.push_back(s);
+  }
+  return reads;
+}
+
+// Feed the read slices to the deframer a DATA frame at a time, as
+// grpc_chttp2_data_parser_parse does, and deframe the message once complete.
+void BM_DeframeLargeMessage(benchmark::State& state) {
+  const size_t message_size = state.range(0);
+  std::vector<grpc_slice> reads = MakeReadSlices(message_size);
+  for (auto _ : state) {
+    grpc_slice_buffer frame_storage;
+    grpc_slice_buffer_init(&frame_storage);
+    grpc_core::SliceBuffer message;
+    bool done = false;
+    for (const grpc_slice& read : reads) {
+      for (size_t i = 0; i < GRPC_SLICE_LENGTH(read); i += kFrameSize) {
+        const size_t n = std::min(kFrameSize, GRPC_SLICE_LENGTH(read) - i);
+        grpc_slice_buffer_add(&frame_storage, grpc_slice_sub(read, i, i + n));
+        int64_t min_progress_size;
+        done = grpc_chttp2_deframe_message(&frame_storage, &min_progress_size,
+                                           &message, nullptr, nullptr)
+                   .ready();
+      }
+    }
+    CHECK(done);
+    CHECK_EQ(message.Length(), message_size);
+    // The payload must still reference the read buffers.
+    CHECK(GRPC_SLICE_START_PTR(message.c_slice_buffer()->slices[0]) ==
+          GRPC_SLICE_START_PTR(reads[0]) + GRPC_HEADER_SIZE_IN_BYTES);
+    grpc_slice_buffer_destroy(&frame_storage);
+  }
+  for (grpc_slice& read : reads) grpc_core::CSliceUnref(read);
+  state.SetBytesProcessed(state.iterations() * message_size);
+}
+BENCHMARK(BM_DeframeLargeMessage)->Range(1024 * 1024, 64 * 1024 * 1024);
+
+// For comparison: what flattening the same message into a contiguous buffer
+// costs.
+void BM_CopyLargeMessage(benchmark::State& state) {
+  const size_t message_size = state.range(0);
+  std::vector<grpc_slice> reads = MakeReadSlices(message_size);
+  std::vector<uint8_t> out(message_size + GRPC_HEADER_SIZE_IN_BYTES);
+  for (auto _ : state) {
+    uint8_t* p = out.data();
+    for (const grpc_slice& read : reads) {
+      memcpy(p, GRPC_SLICE_START_PTR(read), GRPC_SLICE_LENGTH(read));
+      p += GRPC_SLICE_LENGTH(read);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  for (grpc_slice& read : reads) grpc_core::CSliceUnref(read);
+  state.SetBytesProcessed(state.iterations() * message_size);
+}
+BENCHMARK(BM_CopyLargeMessage)->Range(1024 * 1024, 64 * 1024 * 1024);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,251 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmarks chttp2 flow control over emulated network links: how much of
+// the link's capacity a bulk stream gets, and how much memory the transports
+// hold meanwhile. Meant for evaluating changes to BdpEstimator and
+// TransportFlowControl.
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/resource_quota.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/emulated_link_endpoint.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+using ::grpc_event_engine::experimental::EmulatedLinkEndpoint;
+using ::grpc_event_engine::experimental::grpc_event_engine_endpoint_create;
+using Clock = std::chrono::steady_clock;
+
+// Large enough never to limit the transports, so that the quota only
+// measures them.
+constexpr size_t kQuotaBytes = 1024 * 1024 * 1024;
+constexpr size_t kMessageBytes = 256 * 1024;
+
+static void* tag(intptr_t x) { return reinterpret_cast<void*>(x); }
+
+class EmulatedLinkConfiguration : public FixtureConfiguration {
+ public:
+  explicit EmulatedLinkConfiguration(const ResourceQuota& quota)
+      : quota_(quota) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetResourceQuota(quota_);
+  }
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->SetResourceQuota(quota_);
+  }
+
+ private:
+  const ResourceQuota& quota_;
+};
+
+class EmulatedLink : public EndpointPairFixture {
+ public:
+  EmulatedLink(Service* service, const EmulatedLinkEndpoint::LinkConfig& link,
+               const FixtureConfiguration& fixture_configuration)
+      : EndpointPairFixture(service, MakeEndpoints(link),
+                            fixture_configuration) {}
+
+ private:
+  static grpc_endpoint_pair MakeEndpoints(
+      const EmulatedLinkEndpoint::LinkConfig& link) {
+    auto endpoints = EmulatedLinkEndpoint::MakeEmulatedLinkEndpointPair(link);
+    return {grpc_event_engine_endpoint_create(std::move(endpoints.client)),
+            grpc_event_engine_endpoint_create(std::move(endpoints.server))};
+  }
+};
+
+// Samples how much of a resource quota is in use, at most every 10ms.
+class QuotaUsage {
+ public:
+  explicit QuotaUsage(absl::string_view name) {
+    for (const auto& quota : grpc_core::AllMemoryQuotas()) {
+      if (quota->name() == name) quota_ = quota;
+    }
+    CHECK(quota_ != nullptr);
+  }
+
+  void Sample() {
+    const Clock::time_point now = Clock::now();
+    if (now < next_sample_) return;
+    next_sample_ = now + std::chrono::milliseconds(10);
+    const double used =
+        quota_->GetPressureInfo().instantaneous_pressure * kQuotaBytes;
+    peak_ = std::max(peak_, used);
+    sum_ += used;
+    ++samples_;
+  }
+
+  double peak() const { return peak_; }
+  double mean() const { return samples_ == 0 ? 0 : sum_ / samples_; }
+
+ private:
+  std::shared_ptr<grpc_core::BasicMemoryQuota> quota_;
+  Clock::time_point next_sample_;
+  double peak_ = 0;
+  double sum_ = 0;
+  int samples_ = 0;
+};
+
+// Streams kMessageBytes messages from client to server over a link of
+// range(0) Mbps with a range(1) ms round trip, losing range(2) segments in a
+// million.
+static void BM_BulkStreamOverLink(benchmark::State& state) {
+  EmulatedLinkEndpoint::LinkConfig link;
+  link.bytes_per_second = state.range(0) * 1e6 / 8;
+  link.rtt = std::chrono::milliseconds(state.range(1));
+  link.loss = state.range(2) / 1e6;
+  static std::atomic<int> quota_id{0};
+  const std::string quota_name =
+      absl::StrCat("bm_chttp2_flow_control_", quota_id.fetch_add(1));
+  ResourceQuota quota(quota_name);
+  quota.Resize(kQuotaBytes);
+  EmulatedLinkConfiguration configuration(quota);
+  EchoTestService::AsyncService service;
+  std::unique_ptr<EmulatedLink> fixture(
+      new EmulatedLink(&service, link, configuration));
+  QuotaUsage usage(quota_name);
+  size_t received = 0;
+  Clock::duration elapsed{};
+  {
+    EchoRequest send_request;
+    EchoRequest recv_request;
+    send_request.set_message(std::string(kMessageBytes, 'a'));
+    ServerContext svr_ctx;
+    ServerAsyncReaderWriter<EchoResponse, EchoRequest> response_rw(&svr_ctx);
+    service.RequestBidiStream(&svr_ctx, &response_rw, fixture->cq(),
+                              fixture->cq(), tag(0));
+    std::unique_ptr<EchoTestService::Stub> stub(
+        EchoTestService::NewStub(fixture->channel()));
+    ClientContext cli_ctx;
+    auto request_rw = stub->AsyncBidiStream(&cli_ctx, fixture->cq(), tag(1));
+    int need_tags = (1 << 0) | (1 << 1);
+    void* t;
+    bool ok;
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      CHECK(ok);
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    const Clock::time_point start = Clock::now();
+    // Counts a message the server read, and reads the next one.
+    auto on_read = [&]() {
+      received += recv_request.message().size();
+      elapsed = Clock::now() - start;
+      usage.Sample();
+      response_rw.Read(&recv_request, tag(0));
+    };
+    response_rw.Read(&recv_request, tag(0));
+    for (auto _ : state) {
+      request_rw->Write(send_request, tag(1));
+      while (true) {
+        CHECK(fixture->cq()->Next(&t, &ok));
+        if (t == tag(0)) {
+          on_read();
+        } else if (t == tag(1)) {
+          break;
+        } else {
+          grpc_core::Crash("unreachable");
+        }
+      }
+    }
+    // Messages still on the link count too.
+    request_rw->WritesDone(tag(1));
+    need_tags = (1 << 0) | (1 << 1);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      if (t == tag(0) && ok) {
+        on_read();
+        continue;
+      }
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    response_rw.Finish(Status::OK, tag(0));
+    Status final_status;
+    request_rw->Finish(&final_status, tag(1));
+    need_tags = (1 << 0) | (1 << 1);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    CHECK(final_status.ok());
+  }
+  fixture.reset();
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  const double goodput = seconds > 0 ? received / seconds : 0;
+  state.counters["goodput_mbps"] = goodput * 8 / 1e6;
+  state.counters["goodput_fraction"] = goodput / link.bytes_per_second;
+  state.counters["quota_peak_bytes"] = usage.peak();
+  state.counters["quota_mean_bytes"] = usage.mean();
+  state.SetBytesProcessed(received);
+}
+BENCHMARK(BM_BulkStreamOverLink)
+    ->ArgNames({"mbps", "rtt_ms", "loss_ppm"})
+    ->Args({1000, 1, 0})       // same datacenter
+    ->Args({1000, 10, 0})      // same region
+    ->Args({1000, 50, 0})      // high bandwidth-delay product
+    ->Args({100, 100, 0})      // between continents
+    ->Args({100, 100, 1000})   // ... losing 0.1%
+    ->Args({100, 100, 10000})  // ... losing 1%
+    ->Args({10, 300, 0})       // satellite
+    ->Args({10, 300, 10000})   // ... losing 1%
+    ->MinTime(5)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
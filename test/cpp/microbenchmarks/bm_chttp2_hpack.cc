@@ -23,12 +23,20 @@
 #include <grpc/support/alloc.h>
 #include <string.h>
 
+#include <iterator>
 #include <memory>
+#include <random>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -167,6 +175,39 @@ static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   grpc_slice_buffer_destroy(&outbuf);
 }
 
+// Encodes a trace of header blocks, one per iteration, on a single compressor,
+// so that the dynamic table fills and evicts as it does on a long connection.
+template <class Trace>
+static void BM_HpackEncoderEncodeTrace(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  auto trace = Trace::Record();
+
+  grpc_core::HPackCompressor c;
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  size_t call = 0;
+  size_t encoded_bytes = 0;
+  for (auto _ : state) {
+    c.EncodeHeaders(
+        grpc_core::HPackCompressor::EncodeHeaderOptions{
+            static_cast<uint32_t>(state.iterations()),
+            false,
+            Trace::kEnableTrueBinary,
+            size_t{16384},
+            &call_tracer,
+        },
+        *trace[call], &outbuf);
+    encoded_bytes += outbuf.length;
+    if (++call == trace.size()) call = 0;
+    grpc_slice_buffer_reset_and_unref(&outbuf);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_slice_buffer_destroy(&outbuf);
+  state.counters["encoded_bytes"] = benchmark::Counter(
+      encoded_bytes, benchmark::Counter::kAvgIterations);
+}
+
 namespace hpack_encoder_fixtures {
 
 class EmptyBatch {
@@ -310,6 +351,167 @@ class RepresentativeServerTrailingMetadata {
   }
 };
 
+// Stand-in for a recorded header-block trace. Values are drawn from a fixed
+// seed, so every run (and every revision) sees the same sequence.
+class TraceValues {
+ public:
+  explicit TraceValues(uint32_t seed) : rng_(seed) {}
+
+  std::string Random(absl::string_view alphabet, size_t length) {
+    std::string out(length, '\0');
+    for (char& c : out) {
+      c = alphabet[absl::Uniform<size_t>(rng_, 0, alphabet.size())];
+    }
+    return out;
+  }
+  std::string Hex(size_t length) { return Random("0123456789abcdef", length); }
+  std::string Uuid() {
+    return absl::StrCat(Hex(8), "-", Hex(4), "-4", Hex(3), "-a", Hex(3), "-",
+                        Hex(12));
+  }
+  // A JWT the size of a typical OIDC access token: RS256 header, a few hundred
+  // bytes of claims and a 256 byte signature, all base64url.
+  std::string BearerJwt() {
+    static constexpr absl::string_view kBase64Url =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    return absl::StrCat(
+        "Bearer eyJhbGciOiJSUzI1NiIsImtpZCI6IjFlOWdkazcifQ.",
+        Random(kBase64Url, 420), ".", Random(kBase64Url, 342));
+  }
+  // Skewed choice in [0, n), the way calls spread over the methods of a
+  // service in practice.
+  size_t Zipf(size_t n) { return absl::Zipf<size_t>(rng_, n - 1); }
+  bool OneIn(int n) { return absl::Uniform<int>(rng_, 0, n) == 0; }
+  uint32_t Uniform(uint32_t lo, uint32_t hi) {
+    return absl::Uniform<uint32_t>(rng_, lo, hi);
+  }
+
+ private:
+  std::mt19937 rng_;
+};
+
+// Client initial metadata of a service mesh sidecar talking to one backend
+// over a long lived connection: a skewed mix over 64 methods (enough :path
+// values to overflow the 4k dynamic table), a bearer JWT refreshed every
+// 256 calls, W3C traceparent and request ids unique per call, tracestate on
+// some calls, and baggage and tenant headers that change per session.
+class ProductionClientTrace {
+ public:
+  static constexpr bool kEnableTrueBinary = false;
+  static std::vector<std::unique_ptr<grpc_metadata_batch>> Record() {
+    static constexpr absl::string_view kServices[] = {
+        "checkout.v1.Checkout", "inventory.v1.Inventory",
+        "payments.v1.Payments", "profile.v1.Profile",
+        "search.v1.Search",     "shipping.v1.Shipping",
+        "catalog.v1.Catalog",   "ledger.v2.Ledger"};
+    static constexpr absl::string_view kMethods[] = {
+        "Get",      "List",  "Create",   "Update",
+        "BatchGet", "Watch", "Validate", "Delete"};
+    static constexpr absl::string_view kTenants[] = {
+        "acme-prod", "globex", "initech", "umbrella-eu", "hooli"};
+    static constexpr size_t kCalls = 1024;
+    static constexpr size_t kCallsPerToken = 256;
+    static constexpr size_t kCallsPerSession = 32;
+    std::vector<std::string> paths;
+    for (absl::string_view method : kMethods) {
+      for (absl::string_view service : kServices) {
+        paths.push_back(absl::StrCat("/com.example.", service, "Service/",
+                                     method));
+      }
+    }
+    TraceValues v(1);
+    std::string token;
+    std::string tenant;
+    std::string baggage;
+    std::vector<std::unique_ptr<grpc_metadata_batch>> trace;
+    for (size_t call = 0; call < kCalls; call++) {
+      if (call % kCallsPerToken == 0) token = v.BearerJwt();
+      if (call % kCallsPerSession == 0) {
+        tenant = std::string(kTenants[v.Uniform(0, std::size(kTenants))]);
+        baggage = absl::StrCat("user.id=", v.Uniform(1, 10000000),
+                               ",session.id=", v.Hex(16), ",tenant=", tenant,
+                               ",region=us-east1");
+      }
+      auto b = std::make_unique<grpc_metadata_batch>();
+      b->Set(grpc_core::HttpSchemeMetadata(),
+             grpc_core::HttpSchemeMetadata::kHttps);
+      b->Set(grpc_core::HttpMethodMetadata(),
+             grpc_core::HttpMethodMetadata::kPost);
+      b->Set(grpc_core::HttpPathMetadata(),
+             grpc_core::Slice::FromCopiedString(paths[v.Zipf(paths.size())]));
+      b->Set(grpc_core::HttpAuthorityMetadata(),
+             grpc_core::Slice::FromStaticString("api.internal.example.com"));
+      b->Set(grpc_core::TeMetadata(), grpc_core::TeMetadata::kTrailers);
+      b->Set(grpc_core::ContentTypeMetadata(),
+             grpc_core::ContentTypeMetadata::kApplicationGrpc);
+      b->Set(grpc_core::GrpcAcceptEncodingMetadata(),
+             grpc_core::CompressionAlgorithmSet(
+                 {GRPC_COMPRESS_NONE, GRPC_COMPRESS_DEFLATE,
+                  GRPC_COMPRESS_GZIP}));
+      b->Set(grpc_core::UserAgentMetadata(),
+             grpc_core::Slice::FromStaticString(
+                 "grpc-java-netty/1.62.2 envoy/1.29.1"));
+      b->Append("authorization", grpc_core::Slice::FromCopiedString(token),
+                CrashOnAppendError);
+      b->Append("traceparent",
+                grpc_core::Slice::FromCopiedString(absl::StrCat(
+                    "00-", v.Hex(32), "-", v.Hex(16),
+                    v.OneIn(10) ? "-01" : "-00")),
+                CrashOnAppendError);
+      if (v.OneIn(3)) {
+        b->Append("tracestate",
+                  grpc_core::Slice::FromCopiedString(
+                      absl::StrCat("congo=", v.Hex(16), ",rojo=00f067aa0ba9")),
+                  CrashOnAppendError);
+      }
+      b->Append("baggage", grpc_core::Slice::FromCopiedString(baggage),
+                CrashOnAppendError);
+      b->Append("x-request-id", grpc_core::Slice::FromCopiedString(v.Uuid()),
+                CrashOnAppendError);
+      b->Append("x-tenant-id", grpc_core::Slice::FromCopiedString(tenant),
+                CrashOnAppendError);
+      b->Append("x-client-version",
+                grpc_core::Slice::FromStaticString("storefront-web/4.18.2"),
+                CrashOnAppendError);
+      trace.push_back(std::move(b));
+    }
+    return trace;
+  }
+};
+
+// The matching server trailing metadata: mostly OK, with the occasional
+// UNAVAILABLE from an overloaded upstream, and per call timing and request id
+// headers.
+class ProductionServerTrailingTrace {
+ public:
+  static constexpr bool kEnableTrueBinary = true;
+  static std::vector<std::unique_ptr<grpc_metadata_batch>> Record() {
+    static constexpr size_t kCalls = 1024;
+    TraceValues v(2);
+    std::vector<std::unique_ptr<grpc_metadata_batch>> trace;
+    for (size_t call = 0; call < kCalls; call++) {
+      auto b = std::make_unique<grpc_metadata_batch>();
+      if (v.OneIn(50)) {
+        b->Set(grpc_core::GrpcStatusMetadata(), GRPC_STATUS_UNAVAILABLE);
+        b->Set(grpc_core::GrpcMessageMetadata(),
+               grpc_core::Slice::FromStaticString(
+                   "upstream connect error or disconnect/reset before "
+                   "headers. reset reason: overflow"));
+      } else {
+        b->Set(grpc_core::GrpcStatusMetadata(), GRPC_STATUS_OK);
+      }
+      b->Append("server-timing",
+                grpc_core::Slice::FromCopiedString(absl::StrCat(
+                    "app;dur=", v.Uniform(1, 500), ".", v.Uniform(0, 10))),
+                CrashOnAppendError);
+      b->Append("x-request-id", grpc_core::Slice::FromCopiedString(v.Uuid()),
+                CrashOnAppendError);
+      trace.push_back(std::move(b));
+    }
+    return trace;
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({0, 16384});
 // test with eof (shouldn't affect anything)
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({1, 16384});
@@ -327,6 +529,9 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<31, false>)
     ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<100, false>)
     ->Args({0, 16384});
+// Shaped like grpc-status-details-bin carrying a rich error.
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<4096, false>)
+    ->Args({0, 16384});
 // test with a tiny frame size, to highlight continuation costs
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleNonBinaryElem)
     ->Args({0, 1});
@@ -343,9 +548,123 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerTrailingMetadata)
     ->Args({1, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeTrace, ProductionClientTrace);
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeTrace, ProductionServerTrailingTrace);
 
 }  // namespace hpack_encoder_fixtures
 
+////////////////////////////////////////////////////////////////////////////////
+// HPACK huffman encoder
+//
+
+namespace hpack_huffman_fixtures {
+
+// Values shaped like the long headers that dominate encoder time in practice.
+class BearerToken {
+ public:
+  static constexpr char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_.";
+};
+class HexTraceId {
+ public:
+  static constexpr char kAlphabet[] = "0123456789abcdef";
+};
+
+template <class Fixture>
+static grpc_slice MakeValue(size_t length) {
+  absl::BitGen bitgen;
+  grpc_slice s = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(s);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = Fixture::kAlphabet[absl::Uniform<size_t>(
+        bitgen, 0, sizeof(Fixture::kAlphabet) - 1)];
+  }
+  return s;
+}
+
+template <class Fixture>
+static void BM_HpackHuffmanCompress(benchmark::State& state) {
+  grpc_slice value = MakeValue<Fixture>(state.range(0));
+  for (auto _ : state) {
+    grpc_slice out = grpc_chttp2_huffman_compress(value);
+    benchmark::DoNotOptimize(GRPC_SLICE_START_PTR(out));
+    grpc_slice_unref(out);
+  }
+  state.SetBytesProcessed(state.iterations() * GRPC_SLICE_LENGTH(value));
+  grpc_slice_unref(value);
+}
+
+template <class Fixture>
+static void BM_HpackHuffmanCompressedLength(benchmark::State& state) {
+  grpc_slice value = MakeValue<Fixture>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_chttp2_huffman_compressed_length(
+        GRPC_SLICE_START_PTR(value), GRPC_SLICE_LENGTH(value)));
+  }
+  state.SetBytesProcessed(state.iterations() * GRPC_SLICE_LENGTH(value));
+  grpc_slice_unref(value);
+}
+
+BENCHMARK_TEMPLATE(BM_HpackHuffmanCompress, BearerToken)->Range(16, 4096);
+BENCHMARK_TEMPLATE(BM_HpackHuffmanCompress, HexTraceId)->Range(16, 4096);
+BENCHMARK_TEMPLATE(BM_HpackHuffmanCompressedLength, BearerToken)
+    ->Range(16, 4096);
+BENCHMARK_TEMPLATE(BM_HpackHuffmanCompressedLength, HexTraceId)
+    ->Range(16, 4096);
+
+// Binary metadata values, as base64 encoded for peers without true binary.
+class RandomBytes {
+ public:
+  static constexpr char kAlphabet[] =
+      "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+      "\x80\x91\xa2\xb3\xc4\xd5\xe6\xf7\xff\xee\xdd\xcc\xbb\xaa\x99\x88"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+};
+
+static void BM_HpackBase64Encode(benchmark::State& state) {
+  grpc_slice value = MakeValue<RandomBytes>(state.range(0));
+  for (auto _ : state) {
+    grpc_slice out = grpc_chttp2_base64_encode(value);
+    benchmark::DoNotOptimize(GRPC_SLICE_START_PTR(out));
+    grpc_slice_unref(out);
+  }
+  state.SetBytesProcessed(state.iterations() * GRPC_SLICE_LENGTH(value));
+  grpc_slice_unref(value);
+}
+
+static void BM_HpackBase64EncodeAndHuffmanCompress(benchmark::State& state) {
+  grpc_slice value = MakeValue<RandomBytes>(state.range(0));
+  for (auto _ : state) {
+    uint32_t wire_size;
+    grpc_slice out =
+        grpc_chttp2_base64_encode_and_huffman_compress(value, &wire_size);
+    benchmark::DoNotOptimize(GRPC_SLICE_START_PTR(out));
+    grpc_slice_unref(out);
+  }
+  state.SetBytesProcessed(state.iterations() * GRPC_SLICE_LENGTH(value));
+  grpc_slice_unref(value);
+}
+
+static void BM_HpackBase64Decode(benchmark::State& state) {
+  grpc_slice value = MakeValue<RandomBytes>(state.range(0));
+  grpc_slice encoded = grpc_chttp2_base64_encode(value);
+  for (auto _ : state) {
+    grpc_slice out = grpc_chttp2_base64_decode_with_length(
+        encoded, GRPC_SLICE_LENGTH(value));
+    benchmark::DoNotOptimize(GRPC_SLICE_START_PTR(out));
+    grpc_slice_unref(out);
+  }
+  state.SetBytesProcessed(state.iterations() * GRPC_SLICE_LENGTH(value));
+  grpc_slice_unref(encoded);
+  grpc_slice_unref(value);
+}
+
+BENCHMARK(BM_HpackBase64Encode)->Range(16, 16384);
+BENCHMARK(BM_HpackBase64EncodeAndHuffmanCompress)->Range(16, 16384);
+BENCHMARK(BM_HpackBase64Decode)->Range(16, 16384);
+
+}  // namespace hpack_huffman_fixtures
+
 ////////////////////////////////////////////////////////////////////////////////
 // HPACK parser
 //
@@ -396,6 +715,74 @@ static void BM_HpackParserParseHeader(benchmark::State& state) {
   for (auto slice : benchmark_slices) grpc_slice_unref(slice);
 }
 
+// Parses a whole encoded trace per iteration. Blocks refer to dynamic table
+// entries inserted by the blocks before them, so each pass needs a fresh
+// parser and has to replay the trace in order.
+template <class Trace>
+static void BM_HpackParserParseTrace(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  std::vector<std::vector<grpc_slice>> blocks;
+  {
+    auto trace = Trace::Record();
+    grpc_core::HPackCompressor c;
+    grpc_core::FakeCallTracer call_tracer;
+    for (size_t i = 0; i < trace.size(); i++) {
+      grpc_slice_buffer outbuf;
+      grpc_slice_buffer_init(&outbuf);
+      c.EncodeHeaders(
+          grpc_core::HPackCompressor::EncodeHeaderOptions{
+              static_cast<uint32_t>(2 * i + 1),
+              false,
+              Trace::kEnableTrueBinary,
+              1024 * 1024,
+              &call_tracer,
+          },
+          *trace[i], &outbuf);
+      std::vector<grpc_slice> block;
+      for (size_t s = 0; s < outbuf.count; s++) {
+        block.push_back(grpc_slice_ref(outbuf.slices[s]));
+      }
+      grpc_slice_buffer_destroy(&outbuf);
+      // Remove the HTTP header.
+      CHECK(!block.empty());
+      CHECK_GT(GRPC_SLICE_LENGTH(block[0]), 9);
+      block[0] =
+          grpc_slice_sub_no_ref(block[0], 9, GRPC_SLICE_LENGTH(block[0]));
+      blocks.push_back(std::move(block));
+    }
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_core::ManualConstructor<grpc_metadata_batch> b;
+  b.Init();
+  absl::BitGen bitgen;
+  for (auto _ : state) {
+    grpc_core::HPackParser p;
+    for (size_t i = 0; i < blocks.size(); i++) {
+      const std::vector<grpc_slice>& block = blocks[i];
+      b->Clear();
+      p.BeginFrame(&*b, std::numeric_limits<uint32_t>::max(),
+                   std::numeric_limits<uint32_t>::max(),
+                   grpc_core::HPackParser::Boundary::EndOfHeaders,
+                   grpc_core::HPackParser::Priority::None,
+                   grpc_core::HPackParser::LogInfo{
+                       static_cast<uint32_t>(2 * i + 1),
+                       grpc_core::HPackParser::LogInfo::kHeaders, false});
+      for (size_t s = 0; s < block.size(); ++s) {
+        auto error = p.Parse(block[s], s == block.size() - 1,
+                             absl::BitGenRef(bitgen), /*call_tracer=*/nullptr);
+        CHECK_OK(error);
+      }
+    }
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  state.SetItemsProcessed(state.iterations() * blocks.size());
+  // Clean up
+  b.Destroy();
+  for (auto& block : blocks) {
+    for (auto slice : block) grpc_slice_unref(slice);
+  }
+}
+
 namespace hpack_parser_fixtures {
 
 template <class EncoderFixture>
@@ -659,6 +1046,10 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
+BENCHMARK_TEMPLATE(BM_HpackParserParseTrace,
+                   hpack_encoder_fixtures::ProductionClientTrace);
+BENCHMARK_TEMPLATE(BM_HpackParserParseTrace,
+                   hpack_encoder_fixtures::ProductionServerTrailingTrace);
 
 }  // namespace hpack_parser_fixtures
 
@@ -0,0 +1,266 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks for how late EventEngine timers fire and closures start, with
+// the thread pool saturated by other work, with many outstanding timers, and
+// with most timers cancelled before they fire, as deadline timers are.
+//
+// Each benchmark reports the distribution of lateness (actual minus scheduled
+// time, or start minus Run() time) as p50/p99/p999/max counters, in
+// microseconds.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/cpu.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/notification.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+using Clock = std::chrono::steady_clock;
+
+// Timers (or closures) measured per benchmark iteration.
+constexpr int kBatch = 1000;
+
+double Micros(Clock::duration d) {
+  return std::chrono::duration<double, std::micro>(d).count();
+}
+
+// Keeps every thread of the engine's pool busy: each closure spins for a
+// while and then schedules itself again, until Stop().
+class PoolSaturator {
+ public:
+  PoolSaturator(std::shared_ptr<EventEngine> engine, bool enable)
+      : engine_(std::move(engine)) {
+    if (!enable) return;
+    // More closures than cores, so the run queues never drain.
+    const int closures = 2 * gpr_cpu_num_cores();
+    running_.store(closures);
+    for (int i = 0; i < closures; i++) Spin();
+  }
+  ~PoolSaturator() { Stop(); }
+
+  void Stop() {
+    stop_.store(true);
+    while (running_.load() != 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+ private:
+  void Spin() {
+    engine_->Run([this]() {
+      const Clock::time_point until =
+          Clock::now() + std::chrono::microseconds(50);
+      while (Clock::now() < until) {
+      }
+      if (stop_.load(std::memory_order_relaxed)) {
+        running_.fetch_sub(1);
+        return;
+      }
+      Spin();
+    });
+  }
+
+  std::shared_ptr<EventEngine> engine_;
+  std::atomic<bool> stop_{false};
+  std::atomic<int> running_{0};
+};
+
+// Timers scheduled far in the future, so that the benchmark timers share the
+// timer structures with them. Cancelled on destruction.
+class OutstandingTimers {
+ public:
+  OutstandingTimers(EventEngine* engine, int count) : engine_(engine) {
+    handles_.reserve(count);
+    for (int i = 0; i < count; i++) {
+      // Spread deadlines out, as a server's keepalive and deadline timers are.
+      handles_.push_back(engine_->RunAfter(
+          std::chrono::hours(1) + std::chrono::milliseconds(i), []() {}));
+    }
+  }
+  ~OutstandingTimers() {
+    for (const EventEngine::TaskHandle& handle : handles_) {
+      CHECK(engine_->Cancel(handle));
+    }
+  }
+
+ private:
+  EventEngine* const engine_;
+  std::vector<EventEngine::TaskHandle> handles_;
+};
+
+// Collects lateness samples, and reports their distribution.
+class Lateness {
+ public:
+  void Add(const std::vector<double>& samples) {
+    samples_.insert(samples_.end(), samples.begin(), samples.end());
+  }
+
+  void Report(benchmark::State& state, absl::string_view prefix) {
+    if (samples_.empty()) return;
+    std::sort(samples_.begin(), samples_.end());
+    auto percentile = [this](double p) {
+      size_t i = static_cast<size_t>(p / 100 * (samples_.size() - 1));
+      return samples_[i];
+    };
+    state.counters[absl::StrCat(prefix, "_p50_us")] = percentile(50);
+    state.counters[absl::StrCat(prefix, "_p99_us")] = percentile(99);
+    state.counters[absl::StrCat(prefix, "_p999_us")] = percentile(99.9);
+    state.counters[absl::StrCat(prefix, "_max_us")] = samples_.back();
+  }
+
+ private:
+  std::vector<double> samples_;
+};
+
+// Schedules kBatch timers 1-10ms out, cancels cancel_percent of them right
+// away, and returns the lateness of each timer that fired.
+std::vector<double> FireTimers(EventEngine* engine, int cancel_percent) {
+  std::vector<double> late(kBatch);
+  std::vector<bool> cancelled(kBatch);
+  std::vector<EventEngine::TaskHandle> handles(kBatch);
+  std::atomic<int> pending{kBatch};
+  grpc_core::Notification done;
+  auto finish_one = [&pending, &done]() {
+    if (pending.fetch_sub(1) == 1) done.Notify();
+  };
+  for (int i = 0; i < kBatch; i++) {
+    const auto delay = std::chrono::milliseconds(1 + i % 10);
+    const Clock::time_point deadline = Clock::now() + delay;
+    handles[i] = engine->RunAfter(delay, [&late, &finish_one, i, deadline]() {
+      late[i] = Micros(Clock::now() - deadline);
+      finish_one();
+    });
+  }
+  for (int i = 0; i < kBatch; i++) {
+    // A timer that already fired cannot be cancelled, and is measured.
+    if (i % 100 < cancel_percent && engine->Cancel(handles[i])) {
+      cancelled[i] = true;
+      finish_one();
+    }
+  }
+  done.WaitForNotification();
+  std::vector<double> fired;
+  for (int i = 0; i < kBatch; i++) {
+    if (!cancelled[i]) fired.push_back(late[i]);
+  }
+  return fired;
+}
+
+// How late RunAfter callbacks run, by number of other outstanding timers and
+// by whether the pool is saturated.
+void BM_EventEngine_RunAfterLateness(benchmark::State& state) {
+  auto engine = GetDefaultEventEngine();
+  OutstandingTimers outstanding(engine.get(), state.range(0));
+  PoolSaturator saturator(engine, state.range(1) != 0);
+  Lateness lateness;
+  for (auto _ : state) {
+    lateness.Add(FireTimers(engine.get(), /*cancel_percent=*/0));
+  }
+  saturator.Stop();
+  lateness.Report(state, "timer_late");
+  state.SetItemsProcessed(kBatch * state.iterations());
+}
+BENCHMARK(BM_EventEngine_RunAfterLateness)
+    ->ArgNames({"outstanding", "saturated"})
+    ->ArgsProduct({{0, 1000000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
+// Deadline timers mostly get cancelled, as their RPCs complete first. Mixes
+// cancelled and fired timers, and reports the lateness of the fired ones.
+void BM_EventEngine_RunAfterCancelAndFire(benchmark::State& state) {
+  auto engine = GetDefaultEventEngine();
+  PoolSaturator saturator(engine, state.range(1) != 0);
+  Lateness lateness;
+  for (auto _ : state) {
+    lateness.Add(FireTimers(engine.get(), state.range(0)));
+  }
+  saturator.Stop();
+  lateness.Report(state, "timer_late");
+  state.SetItemsProcessed(kBatch * state.iterations());
+}
+BENCHMARK(BM_EventEngine_RunAfterCancelAndFire)
+    ->ArgNames({"cancel_percent", "saturated"})
+    ->ArgsProduct({{50, 90, 99}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
+// Time from Run() until the closure starts running.
+void BM_EventEngine_RunLatency(benchmark::State& state) {
+  auto engine = GetDefaultEventEngine();
+  PoolSaturator saturator(engine, state.range(0) != 0);
+  Lateness lateness;
+  for (auto _ : state) {
+    std::vector<double> late(kBatch);
+    std::atomic<int> pending{kBatch};
+    grpc_core::Notification done;
+    for (int i = 0; i < kBatch; i++) {
+      const Clock::time_point scheduled = Clock::now();
+      engine->Run([&late, &pending, &done, i, scheduled]() {
+        late[i] = Micros(Clock::now() - scheduled);
+        if (pending.fetch_sub(1) == 1) done.Notify();
+      });
+    }
+    done.WaitForNotification();
+    lateness.Add(late);
+  }
+  saturator.Stop();
+  lateness.Report(state, "run_late");
+  state.SetItemsProcessed(kBatch * state.iterations());
+}
+BENCHMARK(BM_EventEngine_RunLatency)
+    ->ArgNames({"saturated"})
+    ->Arg(0)
+    ->Arg(1)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,305 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark the promise based HTTP/2 transport against the legacy chttp2
+// transport, with one and with many calls in flight on the connection.
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/support/client_callback.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/ext/transport/chttp2/transport/http2_client_transport.h"
+#include "src/core/ext/transport/chttp2/transport/http2_server_transport.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/transport/promise_endpoint.h"
+#include "test/cpp/microbenchmarks/callback_test_service.h"
+#include "test/cpp/microbenchmarks/fullstack_unary_ping_pong.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+using grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::EventEngineSupportsFdExtension;
+using grpc_event_engine::experimental::QueryExtension;
+
+// Like SockPair, but with the promise based HTTP/2 transport on both ends of
+// the socket pair.
+class PromiseHttp2SockPair : public BaseFixture {
+ public:
+  explicit PromiseHttp2SockPair(
+      Service* service,
+      const FixtureConfiguration& fixture_configuration =
+          FixtureConfiguration()) {
+    ServerBuilder b;
+    cq_ = b.AddCompletionQueue(true);
+    b.RegisterService(service);
+    fixture_configuration.ApplyCommonServerBuilderConfig(&b);
+    server_ = b.BuildAndStart();
+    int fds[2];
+    CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    grpc_core::ExecCtx exec_ctx;
+    {
+      grpc_core::Server* core_server =
+          grpc_core::Server::FromC(server_->c_server());
+      grpc_core::ChannelArgs server_args = core_server->channel_args();
+      auto* server_transport = new grpc_core::http2::Http2ServerTransport(
+          MakeEndpoint(fds[0], server_args), server_args,
+          server_args.GetObjectRef<EventEngine>());
+      CHECK(GRPC_LOG_IF_ERROR(
+          "SetupTransport", core_server->SetupTransport(
+                                server_transport, nullptr, server_args,
+                                nullptr)));
+    }
+    {
+      grpc_core::ChannelArgs c_args;
+      {
+        ChannelArguments args;
+        args.SetString(GRPC_ARG_DEFAULT_AUTHORITY, "test.authority");
+        fixture_configuration.ApplyCommonChannelArguments(&args);
+        // precondition
+        grpc_channel_args tmp_args;
+        args.SetChannelArgs(&tmp_args);
+        c_args = grpc_core::CoreConfiguration::Get()
+                     .channel_args_preconditioning()
+                     .PreconditionChannelArgs(&tmp_args)
+                     .Set(GRPC_ARG_USE_V3_STACK, true);
+      }
+      auto* client_transport = new grpc_core::http2::Http2ClientTransport(
+          MakeEndpoint(fds[1], c_args), c_args,
+          c_args.GetObjectRef<EventEngine>());
+      grpc_channel* channel =
+          grpc_core::ChannelCreate("target", c_args, GRPC_CLIENT_DIRECT_CHANNEL,
+                                   client_transport)
+              ->release()
+              ->c_ptr();
+      channel_ = grpc::CreateChannelInternal(
+          "", channel,
+          std::vector<std::unique_ptr<
+              experimental::ClientInterceptorFactoryInterface>>());
+    }
+  }
+
+  ~PromiseHttp2SockPair() override {
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    cq_->Shutdown();
+    void* tag;
+    bool ok;
+    while (cq_->Next(&tag, &ok)) {
+    }
+  }
+
+  ServerCompletionQueue* cq() { return cq_.get(); }
+  std::shared_ptr<Channel> channel() { return channel_; }
+
+ private:
+  static grpc_core::PromiseEndpoint MakeEndpoint(
+      int fd, const grpc_core::ChannelArgs& args) {
+    auto* supports_fd = QueryExtension<EventEngineSupportsFdExtension>(
+        args.GetObjectRef<EventEngine>().get());
+    CHECK_NE(supports_fd, nullptr);
+    return grpc_core::PromiseEndpoint(
+        supports_fd->CreateEndpointFromFd(fd, ChannelArgsEndpointConfig(args)),
+        grpc_core::SliceBuffer());
+  }
+
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<ServerCompletionQueue> cq_;
+  std::shared_ptr<Channel> channel_;
+};
+
+// Waits until Done() was called count times.
+class CallsDone {
+ public:
+  explicit CallsDone(int count) : remaining_(count) {}
+
+  void Done() {
+    std::lock_guard<std::mutex> l(mu_);
+    if (--remaining_ == 0) cv_.notify_one();
+  }
+  void Wait() {
+    std::unique_lock<std::mutex> l(mu_);
+    while (remaining_ > 0) cv_.wait(l);
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int remaining_;
+};
+
+//******************************************************************************
+// BENCHMARKING KERNELS
+//
+
+// Unary calls, state.range(0) of them in flight at once.
+template <class Fixture>
+static void BM_ConcurrentUnary(benchmark::State& state) {
+  const int num_calls = state.range(0);
+  CallbackStreamingTestService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest request;
+  std::vector<EchoResponse> responses(num_calls);
+  for (auto _ : state) {
+    std::vector<std::unique_ptr<ClientContext>> contexts;
+    contexts.reserve(num_calls);
+    CallsDone calls_done(num_calls);
+    for (int i = 0; i < num_calls; ++i) {
+      contexts.push_back(std::make_unique<ClientContext>());
+      stub->async()->Echo(contexts.back().get(), &request, &responses[i],
+                          [&calls_done](Status s) {
+                            CHECK(s.ok());
+                            calls_done.Done();
+                          });
+    }
+    calls_done.Wait();
+  }
+  fixture.reset();
+  state.SetItemsProcessed(state.iterations() * num_calls);
+}
+
+// A bidi stream that sends one message and waits for its echo per PingPong().
+class PingPongStream : public ClientBidiReactor<EchoRequest, EchoResponse> {
+ public:
+  explicit PingPongStream(EchoTestService::Stub* stub) {
+    stub->async()->BidiStream(&context_, this);
+    StartCall();
+  }
+
+  void PingPong(CallsDone* done) {
+    done_ = done;
+    pending_.store(2, std::memory_order_relaxed);
+    StartRead(&response_);
+    StartWrite(&request_);
+  }
+
+  void Finish() {
+    StartWritesDone();
+    finished_.Wait();
+  }
+
+  void OnWriteDone(bool ok) override {
+    CHECK(ok);
+    Arrive();
+  }
+  void OnReadDone(bool ok) override {
+    CHECK(ok);
+    Arrive();
+  }
+  void OnDone(const Status& s) override {
+    CHECK(s.ok());
+    finished_.Done();
+  }
+
+ private:
+  void Arrive() {
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) done_->Done();
+  }
+
+  ClientContext context_;
+  EchoRequest request_;
+  EchoResponse response_;
+  CallsDone* done_ = nullptr;
+  std::atomic<int> pending_{0};
+  CallsDone finished_{1};
+};
+
+// One ping pong on each of state.range(0) bidi streams at once.
+template <class Fixture>
+static void BM_ConcurrentStreamingPingPong(benchmark::State& state) {
+  const int num_calls = state.range(0);
+  CallbackStreamingTestService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  std::vector<std::unique_ptr<PingPongStream>> streams;
+  streams.reserve(num_calls);
+  for (int i = 0; i < num_calls; ++i) {
+    streams.push_back(std::make_unique<PingPongStream>(stub.get()));
+  }
+  for (auto _ : state) {
+    CallsDone ping_pongs_done(num_calls);
+    for (auto& stream : streams) stream->PingPong(&ping_pongs_done);
+    ping_pongs_done.Wait();
+  }
+  for (auto& stream : streams) stream->Finish();
+  fixture.reset();
+  state.SetItemsProcessed(state.iterations() * num_calls);
+}
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+// Replace "benchmark::internal::Benchmark" with "::testing::Benchmark" to use
+// internal microbenchmarking tooling
+static void SweepSizesArgs(benchmark::internal::Benchmark* b) {
+  b->Args({0, 0});
+  for (int i = 1; i <= 16 * 1024 * 1024; i *= 8) {
+    b->Args({i, 0});
+    b->Args({0, i});
+    b->Args({i, i});
+  }
+}
+
+static void ConcurrencyArgs(benchmark::internal::Benchmark* b) {
+  b->Arg(1)->Arg(100)->Arg(10000);
+}
+
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, SockPair, NoOpMutator, NoOpMutator)
+    ->Apply(SweepSizesArgs);
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, PromiseHttp2SockPair, NoOpMutator,
+                   NoOpMutator)
+    ->Apply(SweepSizesArgs);
+BENCHMARK_TEMPLATE(BM_ConcurrentUnary, SockPair)->Apply(ConcurrencyArgs);
+BENCHMARK_TEMPLATE(BM_ConcurrentUnary, PromiseHttp2SockPair)
+    ->Apply(ConcurrencyArgs);
+BENCHMARK_TEMPLATE(BM_ConcurrentStreamingPingPong, SockPair)
+    ->Apply(ConcurrencyArgs);
+BENCHMARK_TEMPLATE(BM_ConcurrentStreamingPingPong, PromiseHttp2SockPair)
+    ->Apply(ConcurrencyArgs);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -20,6 +20,7 @@
 // TODO(ctiller): fold back into bm_fullstack_unary_ping_pong.cc once chaotic
 // good can run without custom experiment configuration.
 
+#include "src/core/ext/transport/chaotic_good/server/chaotic_good_server.h"
 #include "src/cpp/ext/chaotic_good.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/fullstack_unary_ping_pong.h"
@@ -79,6 +80,25 @@ class ChaoticGoodFixture : public BaseFixture {
   int port_;
 };
 
+// Chaotic good with several data connections, to see how large messages get
+// spread over them.
+template <int kDataConnections>
+class ChaoticGoodDataConnectionsFixture : public ChaoticGoodFixture {
+ public:
+  explicit ChaoticGoodDataConnectionsFixture(Service* service)
+      : ChaoticGoodFixture(service, DataConnectionsConfiguration()) {}
+
+ private:
+  class DataConnectionsConfiguration : public FixtureConfiguration {
+   public:
+    void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+      b->AddChannelArgument(GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS,
+                            kDataConnections);
+      FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+    }
+  };
+};
+
 //******************************************************************************
 // CONFIGURATIONS
 //
@@ -98,6 +118,20 @@ BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodFixture, NoOpMutator,
                    NoOpMutator)
     ->Apply(SweepSizesArgs);
 
+static void SweepLargeSizesArgs(benchmark::internal::Benchmark* b) {
+  for (int i = 64 * 1024; i <= 64 * 1024 * 1024; i *= 4) {
+    b->Args({i, 0});
+    b->Args({0, i});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodDataConnectionsFixture<1>,
+                   NoOpMutator, NoOpMutator)
+    ->Apply(SweepLargeSizesArgs);
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodDataConnectionsFixture<4>,
+                   NoOpMutator, NoOpMutator)
+    ->Apply(SweepLargeSizesArgs);
+
 }  // namespace testing
 }  // namespace grpc
 
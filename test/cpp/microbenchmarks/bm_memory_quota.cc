@@ -0,0 +1,79 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark memory quota accounting from many threads at once
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/no_destruct.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+grpc_core::MemoryQuota& SharedQuota() {
+  static grpc_core::NoDestruct<grpc_core::MemoryQuota> quota("bm");
+  return *quota;
+}
+
+}  // namespace
+
+// Every call gets its own allocator: creating and destroying it takes from and
+// returns to the quota.
+static void BM_MemoryQuota_AllocatorPerCall(benchmark::State& state) {
+  auto& quota = SharedQuota();
+  for (auto _ : state) {
+    grpc_core::ExecCtx exec_ctx;
+    auto allocator = quota.CreateMemoryAllocator("call");
+    benchmark::DoNotOptimize(allocator.Reserve(state.range(0)));
+  }
+}
+BENCHMARK(BM_MemoryQuota_AllocatorPerCall)
+    ->Range(64, 64 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+// A long lived allocator per thread whose reservations swing well past what it
+// keeps cached locally, so that it keeps replenishing from and donating back
+// to the quota.
+static void BM_MemoryQuota_ReserveRelease(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  auto allocator = SharedQuota().CreateMemoryAllocator("endpoint");
+  const size_t size = state.range(0);
+  for (auto _ : state) {
+    size_t reserved = allocator.Reserve(size);
+    allocator.Release(reserved);
+  }
+}
+BENCHMARK(BM_MemoryQuota_ReserveRelease)
+    ->Range(4 * 1024, 4 * 1024 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,209 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Microbenchmarks around protobuf message serialization into and out of
+// ByteBuffers, over payload corpora shaped like production traffic
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/proto/grpc/testing/echo_messages.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+namespace {
+
+// Values are drawn from a fixed seed, so every run (and every revision)
+// serializes the same corpus.
+class CorpusValues {
+ public:
+  explicit CorpusValues(uint32_t seed) : rng_(seed) {}
+
+  std::string Text(size_t length) {
+    static constexpr absl::string_view kWords[] = {
+        "order",  "status", "pending", "shipped", "customer", "the",
+        "amount", "region", "of",      "item",    "a",        "delivery"};
+    std::string out;
+    while (out.size() < length) {
+      absl::StrAppend(&out, kWords[absl::Uniform<size_t>(
+                                rng_, 0, std::size(kWords))],
+                      " ");
+    }
+    out.resize(length);
+    return out;
+  }
+  uint32_t Uniform(uint32_t lo, uint32_t hi) {
+    return absl::Uniform<uint32_t>(rng_, lo, hi);
+  }
+  double Fraction() { return absl::Uniform<double>(rng_, 0, 1); }
+
+ private:
+  std::mt19937 rng_;
+};
+
+// Most production unary calls carry a small message with a handful of scalar
+// fields set.
+void FillSmall(CorpusValues* v, EchoRequest* request) {
+  request->set_message(v->Text(v->Uniform(16, 128)));
+  request->mutable_param()->set_echo_deadline(true);
+  request->mutable_param()->set_response_message_length(v->Uniform(16, 512));
+  request->mutable_param()->set_backend_channel_idx(v->Uniform(0, 4));
+}
+
+// A few kilobytes with nested messages, repeated strings and maps, as in
+// requests that carry a record and some diagnostics.
+void FillMedium(CorpusValues* v, EchoRequest* request) {
+  request->set_message(v->Text(v->Uniform(512, 2048)));
+  RequestParams* param = request->mutable_param();
+  param->set_echo_metadata(true);
+  param->set_response_message_length(v->Uniform(512, 4096));
+  param->set_expected_client_identity("spiffe://example.com/ns/prod/sa/api");
+  for (uint32_t i = 0, n = v->Uniform(4, 16); i < n; i++) {
+    param->mutable_debug_info()->add_stack_entries(
+        absl::StrCat("com.example.orders.OrderService.handle(",
+                     "OrderService.java:", v->Uniform(10, 900), ")"));
+  }
+  auto* metrics = param->mutable_backend_metrics();
+  metrics->set_cpu_utilization(v->Fraction());
+  metrics->set_mem_utilization(v->Fraction());
+  metrics->set_rps_fractional(v->Uniform(100, 5000));
+  (*metrics->mutable_request_cost())["db.latency_ms"] = v->Uniform(1, 200);
+  (*metrics->mutable_request_cost())["cache.misses"] = v->Uniform(0, 8);
+  (*metrics->mutable_utilization())["queue"] = v->Fraction();
+  (*metrics->mutable_named_metrics())["shard"] = v->Uniform(0, 64);
+}
+
+// Occasional bulk payloads: exports, batched writes, blobs.
+void FillLarge(CorpusValues* v, EchoRequest* request) {
+  request->set_message(v->Text(v->Uniform(32 * 1024, 256 * 1024)));
+}
+
+// The mix of sizes a typical service sees: mostly small messages, some
+// medium, a few large.
+std::vector<EchoRequest> MakeProductionCorpus() {
+  static constexpr size_t kMessages = 256;
+  CorpusValues v(1);
+  std::vector<EchoRequest> corpus(kMessages);
+  for (EchoRequest& request : corpus) {
+    uint32_t bucket = v.Uniform(0, 100);
+    if (bucket < 80) {
+      FillSmall(&v, &request);
+    } else if (bucket < 98) {
+      FillMedium(&v, &request);
+    } else {
+      FillLarge(&v, &request);
+    }
+  }
+  return corpus;
+}
+
+template <void (*kFill)(CorpusValues*, EchoRequest*)>
+std::vector<EchoRequest> MakeCorpus() {
+  static constexpr size_t kMessages = 64;
+  CorpusValues v(2);
+  std::vector<EchoRequest> corpus(kMessages);
+  for (EchoRequest& request : corpus) kFill(&v, &request);
+  return corpus;
+}
+
+using CorpusFactory = std::vector<EchoRequest> (*)();
+
+}  // namespace
+
+template <CorpusFactory kCorpus>
+static void BM_ProtoSerialize(benchmark::State& state) {
+  std::vector<EchoRequest> corpus = kCorpus();
+  size_t i = 0;
+  size_t bytes = 0;
+  for (auto _ : state) {
+    ByteBuffer buffer;
+    bool own_buffer;
+    CHECK(SerializationTraits<EchoRequest>::Serialize(corpus[i], &buffer,
+                                                      &own_buffer)
+              .ok());
+    bytes += buffer.Length();
+    if (++i == corpus.size()) i = 0;
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+template <CorpusFactory kCorpus>
+static void BM_ProtoDeserialize(benchmark::State& state) {
+  std::vector<ByteBuffer> corpus;
+  for (const EchoRequest& request : kCorpus()) {
+    ByteBuffer buffer;
+    bool own_buffer;
+    CHECK(SerializationTraits<EchoRequest>::Serialize(request, &buffer,
+                                                      &own_buffer)
+              .ok());
+    corpus.push_back(std::move(buffer));
+  }
+  size_t i = 0;
+  size_t bytes = 0;
+  EchoRequest request;
+  for (auto _ : state) {
+    // Deserialize() consumes its input, copying only takes a reference.
+    ByteBuffer buffer(corpus[i]);
+    bytes += buffer.Length();
+    CHECK(SerializationTraits<EchoRequest>::Deserialize(&buffer, &request)
+              .ok());
+    if (++i == corpus.size()) i = 0;
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK_TEMPLATE(BM_ProtoSerialize, MakeCorpus<FillSmall>);
+BENCHMARK_TEMPLATE(BM_ProtoSerialize, MakeCorpus<FillMedium>);
+BENCHMARK_TEMPLATE(BM_ProtoSerialize, MakeCorpus<FillLarge>);
+BENCHMARK_TEMPLATE(BM_ProtoSerialize, MakeProductionCorpus);
+BENCHMARK_TEMPLATE(BM_ProtoDeserialize, MakeCorpus<FillSmall>);
+BENCHMARK_TEMPLATE(BM_ProtoDeserialize, MakeCorpus<FillMedium>);
+BENCHMARK_TEMPLATE(BM_ProtoDeserialize, MakeCorpus<FillLarge>);
+BENCHMARK_TEMPLATE(BM_ProtoDeserialize, MakeProductionCorpus);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
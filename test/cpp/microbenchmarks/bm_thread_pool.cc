@@ -22,9 +22,13 @@
 #include <vector>
 
 #include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/useful.h"
@@ -239,6 +243,24 @@ void BM_ThreadPool_Closure_FanOut(benchmark::State& state) {
 }
 BENCHMARK(BM_ThreadPool_Closure_FanOut)->Apply(FanoutTestArguments);
 
+// Report the NUMA layout the pool sees alongside the results, so that runs
+// with and without GRPC_EXPERIMENTS=work_stealing_numa_affinity can be
+// compared across hosts.
+void AddNumaTopologyContext() {
+  const auto& topology =
+      grpc_event_engine::experimental::WorkStealingThreadPool::NumaTopology::
+          Get();
+  benchmark::AddCustomContext("numa_nodes",
+                              absl::StrCat(topology.num_nodes()));
+  for (size_t i = 0; i < topology.num_nodes(); ++i) {
+    benchmark::AddCustomContext(absl::StrCat("numa_node_", i, "_cpus"),
+                                absl::StrJoin(topology.node_cpus[i], ","));
+  }
+  benchmark::AddCustomContext(
+      "numa_affinity",
+      grpc_core::IsWorkStealingNumaAffinityEnabled() ? "on" : "off");
+}
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
@@ -252,6 +274,7 @@ int main(int argc, char** argv) {
   LibraryInitializer libInit;
   benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
+  AddNumaTopologyContext();
 
   benchmark::RunTheBenchmarksNamespaced();
   return 0;
@@ -0,0 +1,215 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark raw-bytes streaming through the callback generic API, to compare
+// with the codegen'd async API in fullstack_streaming_pump.h
+
+#ifndef GRPC_TEST_CPP_MICROBENCHMARKS_CALLBACK_GENERIC_STREAMING_PUMP_H
+#define GRPC_TEST_CPP_MICROBENCHMARKS_CALLBACK_GENERIC_STREAMING_PUMP_H
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/generic/callback_generic_service.h>
+#include <grpcpp/generic/generic_stub_callback.h>
+#include <grpcpp/impl/service_type.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include "absl/log/check.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+
+namespace grpc {
+namespace testing {
+
+//******************************************************************************
+// BENCHMARKING KERNELS
+//
+
+constexpr char kPumpMethod[] = "/grpc.testing.Pump/Stream";
+
+inline ByteBuffer MakePumpMessage(size_t size) {
+  std::string payload(size, 'a');
+  Slice slice(payload);
+  return ByteBuffer(&slice, 1);
+}
+
+// Signals from a reactor to the benchmark loop.
+class PumpEvent {
+ public:
+  void Notify() {
+    std::lock_guard<std::mutex> lock(mu_);
+    ++count_;
+    cv_.notify_one();
+  }
+
+  void WaitFor(int count) {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [&] { return count_ >= count; });
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  int count_ = 0;
+};
+
+// Reads every message from the client, and writes `message` to it until the
+// client goes away.
+class PumpServerReactor : public ServerGenericBidiReactor {
+ public:
+  explicit PumpServerReactor(const ByteBuffer* message) : message_(message) {
+    StartRead(&recv_);
+    if (message_ != nullptr) StartWrite(message_);
+  }
+
+  void OnReadDone(bool ok) override {
+    if (ok) {
+      StartRead(&recv_);
+    } else if (message_ == nullptr) {
+      Finish(Status::OK);
+    }
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (ok) {
+      StartWrite(message_);
+    } else {
+      Finish(Status::OK);
+    }
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  const ByteBuffer* const message_;
+  ByteBuffer recv_;
+};
+
+class PumpService : public CallbackGenericService {
+ public:
+  // If `message` is set, it is streamed to every client.
+  explicit PumpService(const ByteBuffer* message) : message_(message) {}
+
+  ServerGenericBidiReactor* CreateReactor(
+      GenericCallbackServerContext* /*ctx*/) override {
+    return new PumpServerReactor(message_);
+  }
+
+ private:
+  const ByteBuffer* const message_;
+};
+
+class PumpConfiguration : public FixtureConfiguration {
+ public:
+  explicit PumpConfiguration(PumpService* service) : service_(service) {}
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->RegisterCallbackGenericService(service_);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+
+ private:
+  PumpService* const service_;
+};
+
+class PumpClientReactor : public ClientBidiReactor<ByteBuffer, ByteBuffer> {
+ public:
+  void OnReadDone(bool ok) override {
+    if (ok) StartRead(&recv_);
+    reads_.Notify();
+  }
+  void OnWriteDone(bool ok) override {
+    CHECK(ok);
+    writes_.Notify();
+  }
+  void OnDone(const Status& /*s*/) override { done_.Notify(); }
+
+  void StartReading() { StartRead(&recv_); }
+
+  PumpEvent& reads() { return reads_; }
+  PumpEvent& writes() { return writes_; }
+  PumpEvent& done() { return done_; }
+
+ private:
+  ByteBuffer recv_;
+  PumpEvent reads_;
+  PumpEvent writes_;
+  PumpEvent done_;
+};
+
+template <class Fixture>
+static void BM_CallbackGenericPumpStreamClientToServer(
+    benchmark::State& state) {
+  PumpService service(nullptr);
+  // The fixtures register a service of their own; this one has no methods.
+  Service unused_service;
+  std::unique_ptr<Fixture> fixture(
+      new Fixture(&unused_service, PumpConfiguration(&service)));
+  {
+    const ByteBuffer send_message = MakePumpMessage(state.range(0));
+    GenericStubCallback stub(fixture->channel());
+    ClientContext cli_ctx;
+    PumpClientReactor reactor;
+    stub.PrepareBidiStreamingCall(&cli_ctx, kPumpMethod, StubOptions(),
+                                  &reactor);
+    reactor.StartCall();
+    int writes = 0;
+    for (auto _ : state) {
+      reactor.StartWrite(&send_message);
+      reactor.writes().WaitFor(++writes);
+    }
+    reactor.StartWritesDone();
+    reactor.done().WaitFor(1);
+  }
+  fixture.reset();
+  state.SetBytesProcessed(state.range(0) * state.iterations());
+}
+
+template <class Fixture>
+static void BM_CallbackGenericPumpStreamServerToClient(
+    benchmark::State& state) {
+  const ByteBuffer send_message = MakePumpMessage(state.range(0));
+  PumpService service(&send_message);
+  // The fixtures register a service of their own; this one has no methods.
+  Service unused_service;
+  std::unique_ptr<Fixture> fixture(
+      new Fixture(&unused_service, PumpConfiguration(&service)));
+  {
+    GenericStubCallback stub(fixture->channel());
+    ClientContext cli_ctx;
+    PumpClientReactor reactor;
+    stub.PrepareBidiStreamingCall(&cli_ctx, kPumpMethod, StubOptions(),
+                                  &reactor);
+    reactor.StartReading();
+    reactor.StartCall();
+    int reads = 0;
+    for (auto _ : state) {
+      reactor.reads().WaitFor(++reads);
+    }
+    cli_ctx.TryCancel();
+    reactor.done().WaitFor(1);
+  }
+  fixture.reset();
+  state.SetBytesProcessed(state.range(0) * state.iterations());
+}
+
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // GRPC_TEST_CPP_MICROBENCHMARKS_CALLBACK_GENERIC_STREAMING_PUMP_H
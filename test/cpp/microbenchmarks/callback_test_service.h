@@ -36,7 +36,11 @@ const char* const kServerMessageSize = "server_message_size";
 
 class CallbackStreamingTestService : public EchoTestService::CallbackService {
  public:
-  CallbackStreamingTestService() {}
+  // If non_blocking is set, the reactions of every method are run inline on
+  // the thread that completed the operation.
+  explicit CallbackStreamingTestService(bool non_blocking = false) {
+    if (non_blocking) MarkAllMethodsNonBlocking();
+  }
 
   ServerUnaryReactor* Echo(CallbackServerContext* context,
                            const EchoRequest* request,
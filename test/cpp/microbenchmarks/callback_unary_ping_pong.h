@@ -61,11 +61,12 @@ inline void SendCallbackUnaryPingPong(
       });
 };
 
-template <class Fixture, class ClientContextMutator, class ServerContextMutator>
+template <class Fixture, class ClientContextMutator, class ServerContextMutator,
+          bool kNonBlocking = false>
 static void BM_CallbackUnaryPingPong(benchmark::State& state) {
   int request_msgs_size = state.range(0);
   int response_msgs_size = state.range(1);
-  CallbackStreamingTestService service;
+  CallbackStreamingTestService service(kNonBlocking);
   std::unique_ptr<Fixture> fixture(new Fixture(&service));
   std::unique_ptr<EchoTestService::Stub> stub_(
       EchoTestService::NewStub(fixture->channel()));
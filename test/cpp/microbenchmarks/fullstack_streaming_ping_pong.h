@@ -27,6 +27,7 @@
 
 #include "absl/log/check.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/cpp/microbenchmarks/allocation_counter.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
 #include "test/cpp/microbenchmarks/fullstack_fixtures.h"
 
@@ -67,6 +68,7 @@ static void BM_StreamingPingPong(benchmark::State& state) {
     std::unique_ptr<EchoTestService::Stub> stub(
         EchoTestService::NewStub(fixture->channel()));
 
+    AllocationCounter allocation_counter(state, "stream");
     for (auto _ : state) {
       ServerContext svr_ctx;
       ServerContextMutator svr_ctx_mut(&svr_ctx);
@@ -131,6 +133,7 @@ static void BM_StreamingPingPong(benchmark::State& state) {
 
       CHECK(recv_status.ok());
     }
+    allocation_counter.Finish();
   }
 
   fixture.reset();
@@ -181,6 +184,8 @@ static void BM_StreamingPingPongMsgs(benchmark::State& state) {
       need_tags &= ~(1 << i);
     }
 
+    // One iteration is one ping pong: a message each way.
+    AllocationCounter allocation_counter(state, "ping_pong");
     for (auto _ : state) {
       request_rw->Write(send_request, tag(0));   // Start client send
       response_rw.Read(&recv_request, tag(1));   // Start server recv
@@ -201,6 +206,7 @@ static void BM_StreamingPingPongMsgs(benchmark::State& state) {
         need_tags &= ~(1 << i);
       }
     }
+    allocation_counter.Finish();
 
     request_rw->WritesDone(tag(0));
     response_rw.Finish(Status::OK, tag(1));
@@ -261,6 +267,7 @@ static void BM_StreamingPingPongWithCoalescingApi(benchmark::State& state) {
     std::unique_ptr<EchoTestService::Stub> stub(
         EchoTestService::NewStub(fixture->channel()));
 
+    AllocationCounter allocation_counter(state, "stream");
     for (auto _ : state) {
       ServerContext svr_ctx;
       ServerContextMutator svr_ctx_mut(&svr_ctx);
@@ -391,6 +398,7 @@ static void BM_StreamingPingPongWithCoalescingApi(benchmark::State& state) {
 
       CHECK(recv_status.ok());
     }
+    allocation_counter.Finish();
   }
 
   fixture.reset();
@@ -27,6 +27,7 @@
 
 #include "absl/log/check.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/cpp/microbenchmarks/allocation_counter.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
 #include "test/cpp/microbenchmarks/fullstack_fixtures.h"
 
@@ -74,6 +75,7 @@ static void BM_UnaryPingPong(benchmark::State& state) {
                       fixture->cq(), tag(1));
   std::unique_ptr<EchoTestService::Stub> stub(
       EchoTestService::NewStub(fixture->channel()));
+  AllocationCounter allocation_counter(state, "rpc");
   for (auto _ : state) {
     GRPC_LATENT_SEE_PARENT_SCOPE("OneRequest");
     recv_response.Clear();
@@ -114,6 +116,7 @@ static void BM_UnaryPingPong(benchmark::State& state) {
                           tag(slot));
     }
   }
+  allocation_counter.Finish();
   stub.reset();
   fixture.reset();
   server_env[0]->~ServerEnv();
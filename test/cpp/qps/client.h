@@ -28,6 +28,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <cmath>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -142,6 +143,24 @@ class HistogramEntry final {
   int status_;
 };
 
+// Returns the time an RPC scheduled to be issued at `issue_time` is considered
+// to have started at when latency is measured from the intended start, in the
+// same clock and units as UsageTimer::Now().
+inline double IntendedStartTime(gpr_timespec issue_time) {
+  const gpr_timespec t = gpr_convert_clock_type(issue_time, GPR_CLOCK_REALTIME);
+  return t.tv_sec + (1e-9 * t.tv_nsec);
+}
+
+// Returns how many of the client channels issue RPCs; the others only stay
+// connected.
+inline int ActiveClientChannels(const ClientConfig& config) {
+  if (config.active_client_channels() <= 0 ||
+      config.active_client_channels() > config.client_channels()) {
+    return config.client_channels();
+  }
+  return config.active_client_channels();
+}
+
 typedef std::unordered_map<int, int64_t> StatusHistogram;
 
 inline void MergeStatusHistogram(const StatusHistogram& from,
@@ -219,7 +238,10 @@ class Client {
     stats.set_time_elapsed(timer_result.wall);
     stats.set_time_system(timer_result.system);
     stats.set_time_user(timer_result.user);
+    UsageTimer::FillHostStats(timer_result, stats.mutable_host_stats());
     stats.set_cq_poll_count(poll_count);
+    stats.set_channels_connected(channels_connected_);
+    stats.set_channel_connect_seconds(channel_connect_seconds_);
     return stats;
   }
 
@@ -249,10 +271,10 @@ class Client {
 
   gpr_timespec NextIssueTime(int thread_idx) {
     const gpr_timespec result = next_time_[thread_idx];
-    next_time_[thread_idx] =
+    next_time_[thread_idx] = SkipOffPeriod(
         gpr_time_add(next_time_[thread_idx],
                      gpr_time_from_nanos(interarrival_timer_.next(thread_idx),
-                                         GPR_TIMESPAN));
+                                         GPR_TIMESPAN)));
     return result;
   }
 
@@ -340,8 +362,14 @@ class Client {
 
  protected:
   bool closed_loop_;
+  // Whether latency is measured from the time an RPC was scheduled to be
+  // issued instead of the time it was issued. Only set for open-loop loads.
+  bool latency_from_intended_start_ = false;
   gpr_atm thread_pool_done_;
   double median_latency_collection_interval_seconds_;  // In seconds
+  // Number of channels connected before the benchmark, and how long it took.
+  size_t channels_connected_ = 0;
+  double channel_connect_seconds_ = 0;
 
   void StartThreads(size_t num_threads) {
     gpr_atm_rel_store(&thread_pool_done_, static_cast<gpr_atm>(false));
@@ -371,6 +399,16 @@ class Client {
         random_dist = std::make_unique<ExpDist>(load.poisson().offered_load() /
                                                 num_threads);
         break;
+      case LoadParams::kConstantRate:
+        random_dist = std::make_unique<ConstDist>(
+            load.constant_rate().offered_load() / num_threads);
+        break;
+      case LoadParams::kOnOff:
+        random_dist = std::make_unique<ExpDist>(load.on_off().offered_load() /
+                                                num_threads);
+        on_seconds_ = load.on_off().on_seconds();
+        off_seconds_ = load.on_off().off_seconds();
+        break;
       default:
         grpc_core::Crash("unreachable");
     }
@@ -380,17 +418,35 @@ class Client {
       closed_loop_ = true;
     } else {
       closed_loop_ = false;
+      latency_from_intended_start_ = load.latency_from_intended_start();
       // set up interarrival timer according to random dist
       interarrival_timer_.init(*random_dist, num_threads);
       const auto now = gpr_now(GPR_CLOCK_MONOTONIC);
+      load_start_ = now;
       for (size_t i = 0; i < num_threads; i++) {
-        next_time_.push_back(gpr_time_add(
+        next_time_.push_back(SkipOffPeriod(gpr_time_add(
             now,
-            gpr_time_from_nanos(interarrival_timer_.next(i), GPR_TIMESPAN)));
+            gpr_time_from_nanos(interarrival_timer_.next(i), GPR_TIMESPAN))));
       }
     }
   }
 
+  // For on-off loads, moves an issue time that falls into an off period to
+  // the start of the next on period. All threads share the same periods, so
+  // that their bursts line up.
+  gpr_timespec SkipOffPeriod(gpr_timespec t) const {
+    if (off_seconds_ <= 0) return t;
+    const gpr_timespec elapsed = gpr_time_sub(t, load_start_);
+    const double period = on_seconds_ + off_seconds_;
+    const double into_period = std::fmod(
+        elapsed.tv_sec + (1e-9 * elapsed.tv_nsec), period);
+    if (into_period < on_seconds_) return t;
+    return gpr_time_add(
+        t, gpr_time_from_nanos(
+               static_cast<int64_t>(1e9 * (period - into_period)),
+               GPR_TIMESPAN));
+  }
+
   std::function<gpr_timespec()> NextIssuer(int thread_idx) {
     return closed_loop_ ? std::function<gpr_timespec()>()
                         : std::bind(&Client::NextIssueTime, this, thread_idx);
@@ -403,6 +459,9 @@ class Client {
 
   InterarrivalTimer interarrival_timer_;
   std::vector<gpr_timespec> next_time_;
+  gpr_timespec load_start_;
+  double on_seconds_ = 0;
+  double off_seconds_ = 0;
 
   std::mutex thread_completion_mu_;
   size_t threads_remaining_;
@@ -436,12 +495,15 @@ class ClientImpl : public Client {
              std::function<std::unique_ptr<StubType>(std::shared_ptr<Channel>)>
                  create_stub)
       : cores_(gpr_cpu_num_cores()), create_stub_(create_stub) {
+    const double connect_start = UsageTimer::Now();
     for (int i = 0; i < config.client_channels(); i++) {
       channels_.emplace_back(
           config.server_targets(i % config.server_targets_size()), config,
           create_stub_, i);
     }
     WaitForChannelsToConnect();
+    channels_connected_ = channels_.size();
+    channel_connect_seconds_ = UsageTimer::Now() - connect_start;
     median_latency_collection_interval_seconds_ =
         config.median_latency_collection_interval_millis() / 1e3;
     ClientRequestCreator<RequestType> create_req(&request_,
@@ -61,6 +61,28 @@ class ClientRpcContext {
 
   virtual void Start(CompletionQueue* cq, const ClientConfig& config) = 0;
   virtual void TryCancel() = 0;
+
+  void set_latency_from_intended_start(bool latency_from_intended_start) {
+    latency_from_intended_start_ = latency_from_intended_start;
+  }
+
+ protected:
+  // Returns the time to issue the next RPC at, remembering it as the time
+  // that RPC was intended to start.
+  gpr_timespec ScheduleIssue(const std::function<gpr_timespec()>& next_issue) {
+    intended_start_ = next_issue();
+    return intended_start_;
+  }
+  // Returns the time the latency of the RPC being issued now counts from.
+  double StartTime() const {
+    return latency_from_intended_start_ ? IntendedStartTime(intended_start_)
+                                        : UsageTimer::Now();
+  }
+
+  bool latency_from_intended_start_ = false;
+
+ private:
+  gpr_timespec intended_start_;
 };
 
 template <class RequestType, class ResponseType>
@@ -92,7 +114,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   bool RunNextState(bool /*ok*/, HistogramEntry* entry) override {
     switch (next_state_) {
       case State::READY:
-        start_ = UsageTimer::Now();
+        start_ = StartTime();
         response_reader_ = prepare_req_(stub_, &context_, req_, cq_);
         response_reader_->StartCall();
         next_state_ = State::RESP_DONE;
@@ -114,6 +136,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextUnaryImpl(stub_, req_, next_issue_,
                                                 prepare_req_, callback_);
+    clone->set_latency_from_intended_start(latency_from_intended_start_);
     clone->StartInternal(cq);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -144,7 +167,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       RunNextState(true, nullptr);
     } else {  // wait for the issue time
       alarm_ = std::make_unique<Alarm>();
-      alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+      alarm_->Set(cq_, ScheduleIssue(next_issue_), ClientRpcContext::tag(this));
     }
   }
 };
@@ -155,6 +178,7 @@ class AsyncClient : public ClientImpl<StubType, RequestType> {
   // member name resolution until the template types are fully resolved
  public:
   using Client::closed_loop_;
+  using Client::latency_from_intended_start_;
   using Client::NextIssuer;
   using Client::SetupLoadTest;
   using ClientImpl<StubType, RequestType>::cores_;
@@ -184,11 +208,12 @@ class AsyncClient : public ClientImpl<StubType, RequestType> {
     }
 
     int t = 0;
-    for (int ch = 0; ch < config.client_channels(); ch++) {
+    for (int ch = 0; ch < ActiveClientChannels(config); ch++) {
       for (int i = 0; i < config.outstanding_rpcs_per_channel(); i++) {
         auto* cq = cli_cqs_[t].get();
         auto ctx =
             setup_ctx(channels_[ch].get_stub(), next_issuers_[t], request_);
+        ctx->set_latency_from_intended_start(latency_from_intended_start_);
         ctx->Start(cq, config);
       }
       t = (t + 1) % cli_cqs_.size();
@@ -373,13 +398,14 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, ScheduleIssue(next_issue_),
+                      ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = StartTime();
           next_state_ = State::WRITE_DONE;
           if (coalesce_ && messages_issued_ == messages_per_stream_ - 1) {
             stream_->WriteLast(req_, WriteOptions(),
@@ -429,6 +455,7 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextStreamingPingPongImpl(
         stub_, req_, next_issue_, prepare_req_, callback_);
+    clone->set_latency_from_intended_start(latency_from_intended_start_);
     clone->StartInternal(cq, messages_per_stream_, coalesce_);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -558,14 +585,15 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
           break;  // loop around, don't return
         case State::WAIT:
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, ScheduleIssue(next_issue_),
+                      ClientRpcContext::tag(this));
           next_state_ = State::READY_TO_WRITE;
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = StartTime();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
@@ -585,6 +613,7 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextStreamingFromClientImpl(
         stub_, req_, next_issue_, prepare_req_, callback_);
+    clone->set_latency_from_intended_start(latency_from_intended_start_);
     clone->StartInternal(cq);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -806,13 +835,14 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, ScheduleIssue(next_issue_),
+                      ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = StartTime();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
@@ -850,6 +880,7 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextGenericStreamingImpl(
         stub_, req_, next_issue_, prepare_req_, callback_);
+    clone->set_latency_from_intended_start(latency_from_intended_start_);
     clone->StartInternal(cq, messages_per_stream_);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -74,7 +74,7 @@ class CallbackClient
     //  only bootstrap the RPCs
     SetupLoadTest(config, 1);
     total_outstanding_rpcs_ =
-        config.client_channels() * config.outstanding_rpcs_per_channel();
+        ActiveClientChannels(config) * config.outstanding_rpcs_per_channel();
   }
 
   ~CallbackClient() override {}
@@ -146,7 +146,7 @@ class CallbackUnaryClient final : public CallbackClient {
  public:
   explicit CallbackUnaryClient(const ClientConfig& config)
       : CallbackClient(config) {
-    for (int ch = 0; ch < config.client_channels(); ch++) {
+    for (int ch = 0; ch < ActiveClientChannels(config); ch++) {
       for (int i = 0; i < config.outstanding_rpcs_per_channel(); i++) {
         ctx_.emplace_back(
             new CallbackClientRpcContext(channels_[ch].get_stub()));
@@ -217,7 +217,7 @@ class CallbackStreamingClient : public CallbackClient {
   explicit CallbackStreamingClient(const ClientConfig& config)
       : CallbackClient(config),
         messages_per_stream_(config.messages_per_stream()) {
-    for (int ch = 0; ch < config.client_channels(); ch++) {
+    for (int ch = 0; ch < ActiveClientChannels(config); ch++) {
       for (int i = 0; i < config.outstanding_rpcs_per_channel(); i++) {
         ctx_.emplace_back(
             new CallbackClientRpcContext(channels_[ch].get_stub()));
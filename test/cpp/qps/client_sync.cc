@@ -54,9 +54,11 @@ class SynchronousClient
   explicit SynchronousClient(const ClientConfig& config)
       : ClientImpl<BenchmarkService::Stub, SimpleRequest>(
             config, BenchmarkStubCreator) {
+    num_active_channels_ = ActiveClientChannels(config);
     num_threads_ =
-        config.outstanding_rpcs_per_channel() * config.client_channels();
+        config.outstanding_rpcs_per_channel() * num_active_channels_;
     responses_.resize(num_threads_);
+    intended_start_.resize(num_threads_);
     SetupLoadTest(config, num_threads_);
   }
 
@@ -85,6 +87,7 @@ class SynchronousClient
   bool WaitToIssue(int thread_idx) {
     if (!closed_loop_) {
       const gpr_timespec next_issue_time = NextIssueTime(thread_idx);
+      intended_start_[thread_idx] = next_issue_time;
       // Avoid sleeping for too long continuously because we might
       // need to terminate before then. This is an issue since
       // exponential distribution can occasionally produce bad outliers
@@ -106,8 +109,18 @@ class SynchronousClient
     return true;
   }
 
+  // Returns the time the latency of the RPC thread_idx is issuing now counts
+  // from.
+  double StartTime(int thread_idx) const {
+    return latency_from_intended_start_
+               ? IntendedStartTime(intended_start_[thread_idx])
+               : UsageTimer::Now();
+  }
+
+  size_t num_active_channels_;
   size_t num_threads_;
   std::vector<SimpleResponse> responses_;
+  std::vector<gpr_timespec> intended_start_;
 };
 
 class SynchronousUnaryClient final : public SynchronousClient {
@@ -124,8 +137,8 @@ class SynchronousUnaryClient final : public SynchronousClient {
     if (!WaitToIssue(thread_idx)) {
       return true;
     }
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
-    double start = UsageTimer::Now();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
+    double start = StartTime(thread_idx);
     grpc::ClientContext context;
     grpc::Status s =
         stub->UnaryCall(&context, request_, &responses_[thread_idx]);
@@ -228,7 +241,7 @@ class SynchronousStreamingPingPongClient final
 
  private:
   bool InitThreadFuncImpl(size_t thread_idx) override {
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     if (!shutdown_[thread_idx].val) {
       stream_[thread_idx] = stub->StreamingCall(&context_[thread_idx]);
@@ -243,7 +256,7 @@ class SynchronousStreamingPingPongClient final
     if (!WaitToIssue(thread_idx)) {
       return true;
     }
-    double start = UsageTimer::Now();
+    double start = StartTime(thread_idx);
     if (stream_[thread_idx]->Write(request_) &&
         stream_[thread_idx]->Read(&responses_[thread_idx])) {
       entry->set_value((UsageTimer::Now() - start) * 1e9);
@@ -259,7 +272,7 @@ class SynchronousStreamingPingPongClient final
     }
     stream_[thread_idx]->WritesDone();
     FinishStream(entry, thread_idx);
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     if (!shutdown_[thread_idx].val) {
       stream_[thread_idx] = stub->StreamingCall(&context_[thread_idx]);
@@ -286,7 +299,7 @@ class SynchronousStreamingFromClientClient final
   std::vector<double> last_issue_;
 
   bool InitThreadFuncImpl(size_t thread_idx) override {
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     if (!shutdown_[thread_idx].val) {
       stream_[thread_idx] = stub->StreamingFromClient(&context_[thread_idx],
@@ -311,7 +324,7 @@ class SynchronousStreamingFromClientClient final
     }
     stream_[thread_idx]->WritesDone();
     FinishStream(entry, thread_idx);
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     if (!shutdown_[thread_idx].val) {
       stream_[thread_idx] = stub->StreamingFromClient(&context_[thread_idx],
@@ -335,7 +348,7 @@ class SynchronousStreamingFromServerClient final
   std::vector<double> last_recv_;
 
   bool InitThreadFuncImpl(size_t thread_idx) override {
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     if (!shutdown_[thread_idx].val) {
       stream_[thread_idx] =
@@ -355,7 +368,7 @@ class SynchronousStreamingFromServerClient final
       return true;
     }
     FinishStream(entry, thread_idx);
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     if (!shutdown_[thread_idx].val) {
       stream_[thread_idx] =
@@ -381,7 +394,7 @@ class SynchronousStreamingBothWaysClient final
 
  private:
   bool InitThreadFuncImpl(size_t thread_idx) override {
-    auto* stub = channels_[thread_idx % channels_.size()].get_stub();
+    auto* stub = channels_[thread_idx % num_active_channels_].get_stub();
     std::lock_guard<std::mutex> l(stream_mu_[thread_idx]);
     if (!shutdown_[thread_idx].val) {
       stream_[thread_idx] = stub->StreamingBothWays(&context_[thread_idx]);
@@ -24,6 +24,7 @@
 #include <grpcpp/client_context.h>
 #include <grpcpp/create_channel.h>
 
+#include <algorithm>
 #include <cinttypes>
 #include <deque>
 #include <list>
@@ -113,6 +114,56 @@ static double ServerTotalCpuTime(const ServerStats& s) {
 static double ServerIdleCpuTime(const ServerStats& s) {
   return s.idle_cpu_time();
 }
+static double ServerRss(const ServerStats& s) { return s.rss_bytes(); }
+static double ServerRssGrowth(const ServerStats& s) {
+  return static_cast<double>(s.rss_bytes()) - s.initial_rss_bytes();
+}
+static double ServerConnections(const ServerStats& s) {
+  return s.connections_accepted();
+}
+static double ServerWallTime(const ServerStats& s) { return s.time_elapsed(); }
+static double ConnectionsPerSecond(const ClientStats& s) {
+  if (s.channel_connect_seconds() <= 0) return 0;
+  return s.channels_connected() / s.channel_connect_seconds();
+}
+template <class Stats>
+static double NetworkBytes(const Stats& s) {
+  return static_cast<double>(s.host_stats().net_in_bytes()) +
+         s.host_stats().net_out_bytes();
+}
+template <class Stats>
+static double NetworkPackets(const Stats& s) {
+  return static_cast<double>(s.host_stats().net_in_packets()) +
+         s.host_stats().net_out_packets();
+}
+template <class Stats>
+static double TcpOutSegments(const Stats& s) {
+  return s.host_stats().tcp_out_segments();
+}
+template <class Stats>
+static double TcpRetransmits(const Stats& s) {
+  return s.host_stats().tcp_retransmitted_segments();
+}
+template <class Stats>
+static double ContextSwitches(const Stats& s) {
+  return static_cast<double>(s.host_stats().voluntary_context_switches()) +
+         s.host_stats().involuntary_context_switches();
+}
+template <class Stats>
+static double HostCpuTime(const Stats& s) {
+  return s.host_stats().total_cpu_time();
+}
+template <class Stats>
+static double InterruptCpuTime(const Stats& s) {
+  return static_cast<double>(s.host_stats().irq_cpu_time()) +
+         s.host_stats().softirq_cpu_time();
+}
+template <class Stats>
+static double MaxCoreUtilization(const Stats& s) {
+  double max = 0;
+  for (double u : s.host_stats().core_utilization()) max = std::max(max, u);
+  return max;
+}
 static int Cores(int n) { return n; }
 
 static bool IsSuccess(const Status& s) {
@@ -222,6 +273,84 @@ static void postprocess_scenario_result(ScenarioResult* result) {
       server_queries_per_cpu_sec);
   result->mutable_summary()->set_client_queries_per_cpu_sec(
       client_queries_per_cpu_sec);
+
+  // Connection scaling metrics
+  const double server_connections =
+      sum(result->server_stats(), ServerConnections);
+  result->mutable_summary()->set_server_rss_bytes(
+      sum(result->server_stats(), ServerRss));
+  result->mutable_summary()->set_server_connections(server_connections);
+  if (server_connections > 0) {
+    result->mutable_summary()->set_server_bytes_per_connection(
+        sum(result->server_stats(), ServerRssGrowth) / server_connections);
+  }
+  result->mutable_summary()->set_client_connections_per_second(
+      sum(result->client_stats(), ConnectionsPerSecond));
+  const double server_time = average(result->server_stats(), ServerWallTime);
+  if (server_time > 0) {
+    result->mutable_summary()->set_server_polls_per_second(
+        sum(result->server_stats(), SvrPollCount) / server_time);
+  }
+
+  // Network and interrupt load, to spot runs that are not cpu bound
+  ScenarioResultSummary* summary = result->mutable_summary();
+  const double client_time = average(result->client_stats(), WallTime);
+  if (server_time > 0) {
+    summary->set_server_network_bytes_per_second(
+        sum(result->server_stats(), NetworkBytes<ServerStats>) / server_time);
+    summary->set_server_network_packets_per_second(
+        sum(result->server_stats(), NetworkPackets<ServerStats>) /
+        server_time);
+  }
+  if (client_time > 0) {
+    summary->set_client_network_bytes_per_second(
+        sum(result->client_stats(), NetworkBytes<ClientStats>) / client_time);
+    summary->set_client_network_packets_per_second(
+        sum(result->client_stats(), NetworkPackets<ClientStats>) /
+        client_time);
+  }
+  const double tcp_out_segments =
+      sum(result->server_stats(), TcpOutSegments<ServerStats>) +
+      sum(result->client_stats(), TcpOutSegments<ClientStats>);
+  if (tcp_out_segments > 0) {
+    summary->set_tcp_retransmit_percent(
+        100 *
+        (sum(result->server_stats(), TcpRetransmits<ServerStats>) +
+         sum(result->client_stats(), TcpRetransmits<ClientStats>)) /
+        tcp_out_segments);
+  }
+  if (histogram.Count() > 0) {
+    summary->set_server_context_switches_per_request(
+        sum(result->server_stats(), ContextSwitches<ServerStats>) /
+        histogram.Count());
+    summary->set_client_context_switches_per_request(
+        sum(result->client_stats(), ContextSwitches<ClientStats>) /
+        histogram.Count());
+  }
+  const double server_host_cpu_time =
+      sum(result->server_stats(), HostCpuTime<ServerStats>);
+  if (server_host_cpu_time > 0) {
+    summary->set_server_interrupt_cpu_usage(
+        100 * sum(result->server_stats(), InterruptCpuTime<ServerStats>) /
+        server_host_cpu_time);
+  }
+  const double client_host_cpu_time =
+      sum(result->client_stats(), HostCpuTime<ClientStats>);
+  if (client_host_cpu_time > 0) {
+    summary->set_client_interrupt_cpu_usage(
+        100 * sum(result->client_stats(), InterruptCpuTime<ClientStats>) /
+        client_host_cpu_time);
+  }
+  for (const ServerStats& s : result->server_stats()) {
+    summary->set_server_max_core_utilization(
+        std::max(summary->server_max_core_utilization(),
+                 100 * MaxCoreUtilization(s)));
+  }
+  for (const ClientStats& s : result->client_stats()) {
+    summary->set_client_max_core_utilization(
+        std::max(summary->client_max_core_utilization(),
+                 100 * MaxCoreUtilization(s)));
+  }
 }
 
 struct ClientData {
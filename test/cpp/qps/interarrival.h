@@ -67,6 +67,19 @@ class ExpDist final : public RandomDistInterface {
   double lambda_recip_;
 };
 
+// ConstDist spaces arrivals evenly at a rate of lambda. It is the
+// interarrival distribution of an ideal constant-rate load generator.
+
+class ConstDist final : public RandomDistInterface {
+ public:
+  explicit ConstDist(double lambda) : lambda_recip_(1.0 / lambda) {}
+  ~ConstDist() override {}
+  double transform(double /*uni*/) const override { return lambda_recip_; }
+
+ private:
+  double lambda_recip_;
+};
+
 // A class library for generating pseudo-random interarrival times
 // in an efficient re-entrant way. The random table is built at construction
 // time, and each call must include the thread id of the invoker
@@ -49,6 +49,7 @@ static void RunTest(RandomDistInterface&& r, int threads,
   grpc_histogram_destroy(h);
 }
 
+using grpc::testing::ConstDist;
 using grpc::testing::ExpDist;
 
 int main(int argc, char** argv) {
@@ -56,5 +57,6 @@ int main(int argc, char** argv) {
   grpc::testing::InitTest(&argc, &argv, true);
 
   RunTest(ExpDist(10.0), 5, std::string("Exponential(10)"));
+  RunTest(ConstDist(10.0), 5, std::string("Constant(10)"));
   return 0;
 }
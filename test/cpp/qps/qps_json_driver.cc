@@ -145,6 +145,8 @@ static std::unique_ptr<ScenarioResult> RunAndReport(
   GetReporter()->ReportCpuUsage(*result);
   GetReporter()->ReportPollCount(*result);
   GetReporter()->ReportQueriesPerCpuSec(*result);
+  GetReporter()->ReportConnections(*result);
+  GetReporter()->ReportHostStats(*result);
 
   for (int i = 0; *success && i < result->client_success_size(); i++) {
     *success = result->client_success(i);
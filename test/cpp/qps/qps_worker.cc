@@ -26,6 +26,12 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 
+#ifdef GPR_LINUX
+#include <dirent.h>
+#include <sched.h>
+#endif
+
+#include <cstdio>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -36,6 +42,11 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/memory/memory.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/host_port.h"
 #include "src/proto/grpc/testing/worker_service.grpc.pb.h"
@@ -88,6 +99,71 @@ static std::unique_ptr<Server> CreateServer(const ServerConfig& config) {
   }
 }
 
+#ifdef GPR_LINUX
+// Adds the cpus of a sysfs cpu list ("0-3,8,10-11") to set.
+static void AddCpuList(absl::string_view list, cpu_set_t* set) {
+  for (absl::string_view range :
+       absl::StrSplit(list, ',', absl::SkipWhitespace())) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(absl::StripAsciiWhitespace(range), '-');
+    int lo, hi;
+    if (!absl::SimpleAtoi(bounds.first, &lo)) continue;
+    if (bounds.second.empty() || !absl::SimpleAtoi(bounds.second, &hi)) {
+      hi = lo;
+    }
+    for (int cpu = lo; cpu <= hi && cpu < CPU_SETSIZE; cpu++) {
+      CPU_SET(cpu, set);
+    }
+  }
+}
+#endif
+
+// Restricts every thread of the worker process to the cores in core_list and
+// to those of the NUMA nodes in numa_nodes. Threads started later, including
+// the ones of the client or server about to be created, inherit the mask.
+// Memory is not bound; it lands on the pinned node through first touch.
+template <class Config>
+static void PinToCores(const Config& config) {
+  if (config.core_list().empty() && config.numa_nodes().empty()) return;
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : config.core_list()) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+  }
+  for (int node : config.numa_nodes()) {
+    std::string path =
+        absl::StrCat("/sys/devices/system/node/node", node, "/cpulist");
+    FILE* file = fopen(path.c_str(), "r");
+    if (file == nullptr) {
+      LOG(ERROR) << "No such NUMA node: " << node;
+      continue;
+    }
+    char buf[4096];
+    size_t n = fread(buf, 1, sizeof(buf), file);
+    fclose(file);
+    AddCpuList(absl::string_view(buf, n), &set);
+  }
+  if (CPU_COUNT(&set) == 0) {
+    LOG(ERROR) << "Not pinning, no cores selected";
+    return;
+  }
+  DIR* tasks = opendir("/proc/self/task");
+  if (tasks == nullptr) return;
+  while (struct dirent* task = readdir(tasks)) {
+    int tid;
+    if (!absl::SimpleAtoi(task->d_name, &tid)) continue;
+    if (sched_setaffinity(tid, sizeof(set), &set) != 0) {
+      LOG(ERROR) << "Failed to pin thread " << tid;
+    }
+  }
+  closedir(tasks);
+  LOG(INFO) << "Pinned to " << CPU_COUNT(&set) << " cores";
+#else
+  LOG(ERROR) << "Core pinning is only supported on Linux";
+#endif
+}
+
 class ScopedProfile final {
  public:
   ScopedProfile(const char* filename, bool enable) : enable_(enable) {
@@ -194,6 +270,7 @@ class WorkerServiceImpl final : public WorkerService::Service {
       return Status(StatusCode::INVALID_ARGUMENT, "Invalid setup arg");
     }
     LOG(INFO) << "RunClientBody: about to create client";
+    PinToCores(args.setup());
     std::unique_ptr<Client> client = CreateClient(args.setup());
     if (!client) {
       return Status(StatusCode::INVALID_ARGUMENT, "Couldn't create client");
@@ -237,6 +314,7 @@ class WorkerServiceImpl final : public WorkerService::Service {
       args.mutable_setup()->set_port(server_port_);
     }
     LOG(INFO) << "RunServerBody: about to create server";
+    PinToCores(args.setup());
     std::unique_ptr<Server> server = CreateServer(args.setup());
     if (g_inproc_servers != nullptr) {
       g_inproc_servers->push_back(server.get());
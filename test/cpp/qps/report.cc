@@ -20,12 +20,15 @@
 
 #include <grpcpp/client_context.h>
 
+#include <cmath>
 #include <fstream>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_format.h"
 #include "src/core/util/crash.h"
 #include "src/proto/grpc/testing/report_qps_scenario_service.grpc.pb.h"
 #include "test/cpp/qps/driver.h"
+#include "test/cpp/qps/histogram.h"
 #include "test/cpp/qps/parse_json.h"
 #include "test/cpp/qps/stats.h"
 
@@ -78,6 +81,18 @@ void CompositeReporter::ReportQueriesPerCpuSec(const ScenarioResult& result) {
   }
 }
 
+void CompositeReporter::ReportConnections(const ScenarioResult& result) {
+  for (size_t i = 0; i < reporters_.size(); ++i) {
+    reporters_[i]->ReportConnections(result);
+  }
+}
+
+void CompositeReporter::ReportHostStats(const ScenarioResult& result) {
+  for (size_t i = 0; i < reporters_.size(); ++i) {
+    reporters_[i]->ReportHostStats(result);
+  }
+}
+
 void GprLogReporter::ReportQPS(const ScenarioResult& result) {
   LOG(INFO) << "QPS: " << result.summary().qps();
   if (result.summary().failed_requests_per_second() > 0) {
@@ -100,6 +115,25 @@ void GprLogReporter::ReportLatency(const ScenarioResult& result) {
             << result.summary().latency_95() / 1000 << "/"
             << result.summary().latency_99() / 1000 << "/"
             << result.summary().latency_999() / 1000 << " us";
+  if (result.latencies().count() == 0) return;
+  // Percentile distribution in the layout HdrHistogram tools plot, halving
+  // the distance to 100% on every row so that the tail is well resolved.
+  Histogram histogram;
+  histogram.MergeProto(result.latencies());
+  const double count = histogram.Count();
+  LOG(INFO) << "Latency percentile distribution:";
+  LOG(INFO) << absl::StrFormat("%12s %14s %10s %14s", "Value(us)",
+                               "Percentile", "TotalCount", "1/(1-Percentile)");
+  for (double remaining = 1; remaining * count >= 1; remaining /= 2) {
+    const double percentile = 1 - remaining;
+    LOG(INFO) << absl::StrFormat(
+        "%12.3f %14.12f %10.0f %14.2f",
+        histogram.Percentile(percentile * 100) / 1000, percentile,
+        std::floor(percentile * count), 1 / remaining);
+  }
+  LOG(INFO) << absl::StrFormat("%12.3f %14.12f %10.0f %14s",
+                               histogram.Percentile(100) / 1000, 1.0, count,
+                               "inf");
 }
 
 void GprLogReporter::ReportTimes(const ScenarioResult& result) {
@@ -127,6 +161,38 @@ void GprLogReporter::ReportQueriesPerCpuSec(const ScenarioResult& result) {
             << result.summary().client_queries_per_cpu_sec();
 }
 
+void GprLogReporter::ReportConnections(const ScenarioResult& result) {
+  LOG(INFO) << "Server connections: " << result.summary().server_connections();
+  LOG(INFO) << "Server RSS: " << result.summary().server_rss_bytes()
+            << " bytes ("
+            << result.summary().server_bytes_per_connection()
+            << " bytes/connection)";
+  LOG(INFO) << "Server Polls per second: "
+            << result.summary().server_polls_per_second();
+  LOG(INFO) << "Client connections per second: "
+            << result.summary().client_connections_per_second();
+}
+
+void GprLogReporter::ReportHostStats(const ScenarioResult& result) {
+  const ScenarioResultSummary& summary = result.summary();
+  LOG(INFO) << "Server network: " << summary.server_network_bytes_per_second()
+            << " bytes/s, " << summary.server_network_packets_per_second()
+            << " packets/s";
+  LOG(INFO) << "Client network: " << summary.client_network_bytes_per_second()
+            << " bytes/s, " << summary.client_network_packets_per_second()
+            << " packets/s";
+  LOG(INFO) << "TCP retransmits: " << summary.tcp_retransmit_percent() << "%";
+  LOG(INFO) << "Context switches per Request (server/client): "
+            << summary.server_context_switches_per_request() << "/"
+            << summary.client_context_switches_per_request();
+  LOG(INFO) << "Interrupt CPU usage (server/client): "
+            << summary.server_interrupt_cpu_usage() << "/"
+            << summary.client_interrupt_cpu_usage();
+  LOG(INFO) << "Busiest core usage (server/client): "
+            << summary.server_max_core_utilization() << "/"
+            << summary.client_max_core_utilization();
+}
+
 void JsonReporter::ReportQPS(const ScenarioResult& result) {
   std::string json_string =
       SerializeJson(result, "type.googleapis.com/grpc.testing.ScenarioResult");
@@ -159,6 +225,14 @@ void JsonReporter::ReportQueriesPerCpuSec(const ScenarioResult& /*result*/) {
   // NOP - all reporting is handled by ReportQPS.
 }
 
+void JsonReporter::ReportConnections(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
+void JsonReporter::ReportHostStats(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
 void RpcReporter::ReportQPS(const ScenarioResult& result) {
   grpc::ClientContext context;
   grpc::Status status;
@@ -199,5 +273,13 @@ void RpcReporter::ReportQueriesPerCpuSec(const ScenarioResult& /*result*/) {
   // NOP - all reporting is handled by ReportQPS.
 }
 
+void RpcReporter::ReportConnections(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
+void RpcReporter::ReportHostStats(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
 }  // namespace testing
 }  // namespace grpc
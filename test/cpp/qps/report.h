@@ -66,6 +66,13 @@ class Reporter {
   /// Reports queries per cpu-sec.
   virtual void ReportQueriesPerCpuSec(const ScenarioResult& result) = 0;
 
+  /// Reports server memory and poller usage per connection, and how fast
+  /// clients connected.
+  virtual void ReportConnections(const ScenarioResult& result) = 0;
+
+  /// Reports network, interrupt and per core load of the worker hosts.
+  virtual void ReportHostStats(const ScenarioResult& result) = 0;
+
  private:
   const string name_;
 };
@@ -85,6 +92,8 @@ class CompositeReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
+  void ReportHostStats(const ScenarioResult& result) override;
 
  private:
   std::vector<std::unique_ptr<Reporter> > reporters_;
@@ -103,6 +112,8 @@ class GprLogReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
+  void ReportHostStats(const ScenarioResult& result) override;
 };
 
 /// Dumps the report to a JSON file.
@@ -119,6 +130,8 @@ class JsonReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
+  void ReportHostStats(const ScenarioResult& result) override;
 
   const string report_file_;
 };
@@ -136,6 +149,8 @@ class RpcReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
+  void ReportHostStats(const ScenarioResult& result) override;
 
   std::unique_ptr<ReportQpsScenarioService::Stub> stub_;
 };
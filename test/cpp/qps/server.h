@@ -28,6 +28,8 @@
 #include <vector>
 
 #include "absl/log/log.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/proto/grpc/testing/control.pb.h"
 #include "src/proto/grpc/testing/messages.pb.h"
@@ -42,7 +44,10 @@ namespace testing {
 class Server {
  public:
   explicit Server(const ServerConfig& config)
-      : timer_(new UsageTimer), last_reset_poll_count_(0) {
+      : timer_(new UsageTimer),
+        last_reset_poll_count_(0),
+        initial_rss_bytes_(UsageTimer::ResidentSetSizeBytes()),
+        initial_channels_created_(ServerChannelsCreated()) {
     cores_ = gpr_cpu_num_cores();
     if (config.port()) {  // positive for a fixed port, negative for inproc
       port_ = config.port();
@@ -72,6 +77,11 @@ class Server {
     stats.set_total_cpu_time(timer_result.total_cpu_time);
     stats.set_idle_cpu_time(timer_result.idle_cpu_time);
     stats.set_cq_poll_count(poll_count);
+    stats.set_rss_bytes(UsageTimer::ResidentSetSizeBytes());
+    stats.set_initial_rss_bytes(initial_rss_bytes_);
+    stats.set_connections_accepted(ServerChannelsCreated() -
+                                   initial_channels_created_);
+    UsageTimer::FillHostStats(timer_result, stats.mutable_host_stats());
     return stats;
   }
 
@@ -143,8 +153,16 @@ class Server {
  private:
   int port_;
   int cores_;
+  // A server channel is created for each connection once its handshake is
+  // done.
+  static uint64_t ServerChannelsCreated() {
+    return grpc_core::global_stats().Collect()->server_channels_created;
+  }
+
   std::unique_ptr<UsageTimer> timer_;
   int last_reset_poll_count_;
+  const unsigned long long initial_rss_bytes_;
+  const uint64_t initial_channels_created_;
 };
 
 std::unique_ptr<Server> CreateSynchronousServer(const ServerConfig& config);
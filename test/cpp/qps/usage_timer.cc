@@ -21,6 +21,7 @@
 #include <grpc/support/time.h>
 
 #include <fstream>
+#include <map>
 #include <sstream>
 #include <string>
 
@@ -29,6 +30,7 @@
 #ifdef __linux__
 #include <sys/resource.h>
 #include <sys/time.h>
+#include <unistd.h>
 
 static double time_double(struct timeval* tv) {
   return tv->tv_sec + (1e-6 * tv->tv_usec);
@@ -42,49 +44,111 @@ double UsageTimer::Now() {
   return ts.tv_sec + (1e-9 * ts.tv_nsec);
 }
 
-static void get_resource_usage(double* utime, double* stime) {
+static void get_resource_usage(UsageTimer::Result* r) {
 #ifdef __linux__
   struct rusage usage;
   getrusage(RUSAGE_SELF, &usage);
-  *utime = time_double(&usage.ru_utime);
-  *stime = time_double(&usage.ru_stime);
+  r->user = time_double(&usage.ru_utime);
+  r->system = time_double(&usage.ru_stime);
+  r->voluntary_context_switches = usage.ru_nvcsw;
+  r->involuntary_context_switches = usage.ru_nivcsw;
 #else
-  *utime = 0;
-  *stime = 0;
+  r->user = 0;
+  r->system = 0;
 #endif
 }
 
-static void get_cpu_usage(unsigned long long* total_cpu_time,
-                          unsigned long long* idle_cpu_time) {
+static void get_cpu_usage(UsageTimer::Result* r) {
 #ifdef __linux__
+  // The aggregate "cpu" line comes first, then one "cpuN" line per core:
+  // user nice system idle iowait irq softirq steal guest guest_nice
   std::ifstream proc_stat("/proc/stat");
-  proc_stat.ignore(5);
-  std::string cpu_time_str;
-  std::string first_line;
-  std::getline(proc_stat, first_line);
-  std::stringstream first_line_s(first_line);
-  for (int i = 0; i < 10; ++i) {
-    std::getline(first_line_s, cpu_time_str, ' ');
-    *total_cpu_time += std::stol(cpu_time_str);
-    if (i == 3) {
-      *idle_cpu_time = std::stol(cpu_time_str);
+  std::string line;
+  while (std::getline(proc_stat, line) && line.compare(0, 3, "cpu") == 0) {
+    std::istringstream fields(line);
+    std::string name;
+    fields >> name;
+    unsigned long long total = 0;
+    unsigned long long idle = 0;
+    unsigned long long value;
+    for (int i = 0; i < 10 && fields >> value; ++i) {
+      total += value;
+      if (i == 3) idle = value;
+      if (name == "cpu" && i == 5) r->irq_cpu_time = value;
+      if (name == "cpu" && i == 6) r->softirq_cpu_time = value;
+    }
+    if (name == "cpu") {
+      r->total_cpu_time = total;
+      r->idle_cpu_time = idle;
+    } else {
+      r->core_total_cpu_time.push_back(total);
+      r->core_idle_cpu_time.push_back(idle);
     }
   }
 #else
   // Use the parameters to avoid unused-parameter warning
-  (void)total_cpu_time;
-  (void)idle_cpu_time;
+  (void)r;
   LOG(INFO) << "get_cpu_usage(): Non-linux platform is not supported.";
 #endif
 }
 
+// Reads /proc/net/snmp or /proc/net/netstat, which hold pairs of
+// "Section: Name1 Name2..." and "Section: Value1 Value2..." lines, into
+// "Section.Name" -> value.
+static std::map<std::string, unsigned long long> get_net_counters(
+    const char* path) {
+  std::map<std::string, unsigned long long> counters;
+#ifdef __linux__
+  std::ifstream proc_net(path);
+  std::string names_line;
+  std::string values_line;
+  while (std::getline(proc_net, names_line) &&
+         std::getline(proc_net, values_line)) {
+    std::istringstream names(names_line);
+    std::istringstream values(values_line);
+    std::string section;
+    std::string values_section;
+    names >> section;
+    values >> values_section;
+    if (section != values_section || section.empty()) break;
+    section.pop_back();  // the ':'
+    std::string name;
+    long long value;  // a few (Tcp MaxConn) can be -1
+    while (names >> name && values >> value) {
+      counters[section + "." + name] = static_cast<unsigned long long>(value);
+    }
+  }
+#else
+  (void)path;
+#endif
+  return counters;
+}
+
+unsigned long long UsageTimer::ResidentSetSizeBytes() {
+#ifdef __linux__
+  std::ifstream proc_statm("/proc/self/statm");
+  unsigned long long size_pages = 0;
+  unsigned long long resident_pages = 0;
+  if (!(proc_statm >> size_pages >> resident_pages)) return 0;
+  return resident_pages * sysconf(_SC_PAGESIZE);
+#else
+  return 0;
+#endif
+}
+
 UsageTimer::Result UsageTimer::Sample() {
-  Result r;
+  Result r{};
   r.wall = Now();
-  get_resource_usage(&r.user, &r.system);
-  r.total_cpu_time = 0;
-  r.idle_cpu_time = 0;
-  get_cpu_usage(&r.total_cpu_time, &r.idle_cpu_time);
+  get_resource_usage(&r);
+  get_cpu_usage(&r);
+  auto snmp = get_net_counters("/proc/net/snmp");
+  auto netstat = get_net_counters("/proc/net/netstat");
+  r.net_in_bytes = netstat["IpExt.InOctets"];
+  r.net_out_bytes = netstat["IpExt.OutOctets"];
+  r.net_in_packets = snmp["Ip.InReceives"];
+  r.net_out_packets = snmp["Ip.OutRequests"];
+  r.tcp_out_segments = snmp["Tcp.OutSegs"];
+  r.tcp_retransmitted_segments = snmp["Tcp.RetransSegs"];
   return r;
 }
 
@@ -96,6 +160,50 @@ UsageTimer::Result UsageTimer::Mark() const {
   r.system = s.system - start_.system;
   r.total_cpu_time = s.total_cpu_time - start_.total_cpu_time;
   r.idle_cpu_time = s.idle_cpu_time - start_.idle_cpu_time;
+  r.irq_cpu_time = s.irq_cpu_time - start_.irq_cpu_time;
+  r.softirq_cpu_time = s.softirq_cpu_time - start_.softirq_cpu_time;
+  // Cores can come and go (hotplug); only report them if they did not.
+  if (s.core_total_cpu_time.size() == start_.core_total_cpu_time.size()) {
+    for (size_t i = 0; i < s.core_total_cpu_time.size(); ++i) {
+      r.core_total_cpu_time.push_back(s.core_total_cpu_time[i] -
+                                      start_.core_total_cpu_time[i]);
+      r.core_idle_cpu_time.push_back(s.core_idle_cpu_time[i] -
+                                     start_.core_idle_cpu_time[i]);
+    }
+  }
+  r.voluntary_context_switches =
+      s.voluntary_context_switches - start_.voluntary_context_switches;
+  r.involuntary_context_switches =
+      s.involuntary_context_switches - start_.involuntary_context_switches;
+  r.net_in_bytes = s.net_in_bytes - start_.net_in_bytes;
+  r.net_out_bytes = s.net_out_bytes - start_.net_out_bytes;
+  r.net_in_packets = s.net_in_packets - start_.net_in_packets;
+  r.net_out_packets = s.net_out_packets - start_.net_out_packets;
+  r.tcp_out_segments = s.tcp_out_segments - start_.tcp_out_segments;
+  r.tcp_retransmitted_segments =
+      s.tcp_retransmitted_segments - start_.tcp_retransmitted_segments;
 
   return r;
 }
+
+void UsageTimer::FillHostStats(const Result& result,
+                               grpc::testing::HostStats* stats) {
+  stats->set_net_in_bytes(result.net_in_bytes);
+  stats->set_net_out_bytes(result.net_out_bytes);
+  stats->set_net_in_packets(result.net_in_packets);
+  stats->set_net_out_packets(result.net_out_packets);
+  stats->set_tcp_out_segments(result.tcp_out_segments);
+  stats->set_tcp_retransmitted_segments(result.tcp_retransmitted_segments);
+  stats->set_voluntary_context_switches(result.voluntary_context_switches);
+  stats->set_involuntary_context_switches(result.involuntary_context_switches);
+  stats->set_total_cpu_time(result.total_cpu_time);
+  stats->set_irq_cpu_time(result.irq_cpu_time);
+  stats->set_softirq_cpu_time(result.softirq_cpu_time);
+  for (size_t i = 0; i < result.core_total_cpu_time.size(); ++i) {
+    const unsigned long long total = result.core_total_cpu_time[i];
+    stats->add_core_utilization(
+        total == 0 ? 0
+                   : 1 - static_cast<double>(result.core_idle_cpu_time[i]) /
+                             total);
+  }
+}
@@ -19,6 +19,10 @@
 #ifndef GRPC_TEST_CPP_QPS_USAGE_TIMER_H
 #define GRPC_TEST_CPP_QPS_USAGE_TIMER_H
 
+#include <vector>
+
+#include "src/proto/grpc/testing/stats.pb.h"
+
 class UsageTimer {
  public:
   UsageTimer();
@@ -29,12 +33,32 @@ class UsageTimer {
     double system;
     unsigned long long total_cpu_time;
     unsigned long long idle_cpu_time;
+    // See grpc.testing.HostStats for what these measure.
+    unsigned long long irq_cpu_time;
+    unsigned long long softirq_cpu_time;
+    std::vector<unsigned long long> core_total_cpu_time;
+    std::vector<unsigned long long> core_idle_cpu_time;
+    unsigned long long voluntary_context_switches;
+    unsigned long long involuntary_context_switches;
+    unsigned long long net_in_bytes;
+    unsigned long long net_out_bytes;
+    unsigned long long net_in_packets;
+    unsigned long long net_out_packets;
+    unsigned long long tcp_out_segments;
+    unsigned long long tcp_retransmitted_segments;
   };
 
   Result Mark() const;
 
+  // Fills in the host counters of a Mark() result
+  static void FillHostStats(const Result& result,
+                            grpc::testing::HostStats* stats);
+
   static double Now();
 
+  // Resident set size of this process in bytes, or 0 where unsupported.
+  static unsigned long long ResidentSetSizeBytes();
+
  private:
   static Result Sample();
 
@@ -19,13 +19,21 @@
 #include <grpc++/support/byte_buffer.h>
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
+#include <grpc/support/alloc.h>
 #include <grpcpp/impl/grpc_library.h>
+#include <grpcpp/support/mapped_file.h>
 #include <grpcpp/support/slice.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <cstring>
+#include <string>
 #include <vector>
 
+#include "absl/strings/cord.h"
+#include "absl/strings/str_cat.h"
+
+#include "src/core/util/tmpfile.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc {
@@ -149,6 +157,103 @@ TEST_F(ByteBufferTest, DumpToSingleSlice) {
   EXPECT_EQ(strlen(kContent1) + strlen(kContent2), slice.size());
 }
 
+TEST_F(ByteBufferTest, DumpToSingleSliceWithSingleSliceDoesNotCopy) {
+  Slice content(kContent1);
+  ByteBuffer buffer(&content, 1);
+  Slice slice;
+  EXPECT_TRUE(buffer.DumpToSingleSlice(&slice).ok());
+  EXPECT_EQ(slice.begin(), content.begin());
+}
+
+TEST_F(ByteBufferTest, TryGetCord) {
+  std::string big(4096, 'z');
+  std::vector<Slice> slices;
+  slices.emplace_back(kContent1);
+  slices.emplace_back(big);
+  slices.emplace_back(kContent2);
+  ByteBuffer buffer(&slices[0], slices.size());
+  const char* big_data = reinterpret_cast<const char*>(slices[1].begin());
+  absl::Cord cord;
+  EXPECT_TRUE(buffer.TryGetCord(&cord).ok());
+  EXPECT_EQ(std::string(cord), absl::StrCat(kContent1, big, kContent2));
+  // The large slice is referenced rather than copied, and stays alive for as
+  // long as the cord does.
+  buffer.Clear();
+  slices.clear();
+  bool found = false;
+  for (absl::string_view chunk : cord.Chunks()) {
+    if (chunk.data() == big_data) found = true;
+  }
+  EXPECT_TRUE(found);
+  EXPECT_EQ(std::string(cord), absl::StrCat(kContent1, big, kContent2));
+}
+
+TEST_F(ByteBufferTest, TryGetCordUninitialized) {
+  ByteBuffer buffer;
+  absl::Cord cord;
+  EXPECT_FALSE(buffer.TryGetCord(&cord).ok());
+}
+
+// Writes contents to a new temporary file and returns its name.
+std::string WriteTmpFile(const std::string& contents) {
+  char* name = nullptr;
+  FILE* file = gpr_tmpfile("byte_buffer_test", &name);
+  EXPECT_NE(file, nullptr);
+  EXPECT_EQ(fwrite(contents.data(), 1, contents.size(), file),
+            contents.size());
+  fclose(file);
+  std::string path = name;
+  gpr_free(name);
+  return path;
+}
+
+TEST_F(ByteBufferTest, MappedFileRegion) {
+  std::string contents = absl::StrCat(kContent1, std::string(8192, 'z'));
+  std::string path = WriteTmpFile(contents);
+  Status status;
+  auto file = experimental::MappedFile::Open(path, &status);
+  ASSERT_TRUE(status.ok()) << status.error_message();
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(file->size(), contents.size());
+  Slice slice = file->Region(6, 100);
+  EXPECT_EQ(std::string(slice.begin(), slice.end()), contents.substr(6, 100));
+  // Regions reference the mapping and outlive the file.
+  ByteBuffer buffer = file->RegionBuffer(0, contents.size());
+  file.reset();
+  remove(path.c_str());
+  Slice single;
+  EXPECT_TRUE(buffer.TrySingleSlice(&single).ok());
+  EXPECT_EQ(std::string(single.begin(), single.end()), contents);
+  EXPECT_EQ(std::string(slice.begin(), slice.end()), contents.substr(6, 100));
+}
+
+TEST_F(ByteBufferTest, MappedFileRegionIsClamped) {
+  std::string path = WriteTmpFile(kContent1);
+  Status status;
+  auto file = experimental::MappedFile::Open(path, &status);
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(file->Region(4, 1000).size(), strlen(kContent1) - 4);
+  EXPECT_EQ(file->Region(1000, 10).size(), 0);
+  remove(path.c_str());
+}
+
+TEST_F(ByteBufferTest, MappedFileEmpty) {
+  std::string path = WriteTmpFile("");
+  Status status;
+  auto file = experimental::MappedFile::Open(path, &status);
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(file->size(), 0);
+  EXPECT_EQ(file->RegionBuffer(0, 10).Length(), 0);
+  remove(path.c_str());
+}
+
+TEST_F(ByteBufferTest, MappedFileMissing) {
+  Status status;
+  auto file = experimental::MappedFile::Open("/does/not/exist", &status);
+  EXPECT_EQ(file, nullptr);
+  EXPECT_FALSE(status.ok());
+}
+
 }  // namespace
 }  // namespace grpc
 
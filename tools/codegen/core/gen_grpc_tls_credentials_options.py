@@ -230,6 +230,25 @@ _DATA_MEMBERS = [
         test_value_1=("*experimental::CreateStaticCrlProvider({})"),
         test_value_2=("*experimental::CreateStaticCrlProvider({})"),
     ),
+    DataMember(
+        name="session_ticket_key_provider",
+        type="std::shared_ptr<grpc_core::experimental::SessionTicketKeyProvider>",
+        getter_comment=(
+            "Returns the provider of the keys that the server encrypts session"
+            " tickets with. Only used on the server side."
+        ),
+        setter_move_semantics=True,
+        special_comparator=(
+            "(session_ticket_key_provider_ == other.session_ticket_key_provider_)"
+        ),
+        test_name="DifferentSessionTicketKeyProvider",
+        test_value_1=(
+            "*experimental::CreateRotatingSessionTicketKeyProvider(std::string(32, 'a'))"
+        ),
+        test_value_2=(
+            "*experimental::CreateRotatingSessionTicketKeyProvider(std::string(32, 'a'))"
+        ),
+    ),
     DataMember(
         name="send_client_ca_list",
         type="bool",
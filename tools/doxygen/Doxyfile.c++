@@ -900,6 +900,7 @@ include/grpc/grpc_crl_provider.h \
 include/grpc/grpc_posix.h \
 include/grpc/grpc_security.h \
 include/grpc/grpc_security_constants.h \
+include/grpc/grpc_session_ticket_key_provider.h \
 include/grpc/impl/call.h \
 include/grpc/impl/channel_arg_names.h \
 include/grpc/impl/codegen/atm.h \
@@ -965,7 +966,10 @@ include/grpcpp/ext/call_metric_recorder.h \
 include/grpcpp/ext/health_check_service_server_builder_option.h \
 include/grpcpp/ext/server_metric_recorder.h \
 include/grpcpp/generic/async_generic_service.h \
+include/grpcpp/generic/batching_generic_service.h \
+include/grpcpp/generic/batching_stub.h \
 include/grpcpp/generic/callback_generic_service.h \
+include/grpcpp/generic/generic_proxy.h \
 include/grpcpp/generic/generic_stub.h \
 include/grpcpp/generic/generic_stub_callback.h \
 include/grpcpp/grpcpp.h \
@@ -1033,6 +1037,7 @@ include/grpcpp/impl/generic_stub_internal.h \
 include/grpcpp/impl/grpc_library.h \
 include/grpcpp/impl/intercepted_channel.h \
 include/grpcpp/impl/interceptor_common.h \
+include/grpcpp/impl/message_object.h \
 include/grpcpp/impl/metadata_map.h \
 include/grpcpp/impl/method_handler_impl.h \
 include/grpcpp/impl/proto_utils.h \
@@ -1075,6 +1080,7 @@ include/grpcpp/support/client_interceptor.h \
 include/grpcpp/support/config.h \
 include/grpcpp/support/global_callback_hook.h \
 include/grpcpp/support/interceptor.h \
+include/grpcpp/support/mapped_file.h \
 include/grpcpp/support/message_allocator.h \
 include/grpcpp/support/method_handler.h \
 include/grpcpp/support/proto_buffer_reader.h \
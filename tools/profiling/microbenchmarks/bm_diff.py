@@ -0,0 +1,449 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Compares microbenchmark results between two revisions.
+
+Builds a curated set of microbenchmarks at the current revision and at the
+diff base, then runs both builds in alternation, pinned to one cpu, so that
+machine noise affects both sides alike. Each benchmark is reported as changed
+only when a Mann-Whitney U test over the per-run cpu times is significant
+and the change in median is above a threshold. With --perf, a differential
+flame graph is also recorded for every changed benchmark. With --allocations,
+the fullstack benchmarks are also run with --allocation_counts, and any rise
+in allocations per iteration beyond --allocation_budget is a regression.
+
+Raw results are stored under --results_dir, keyed by commit, so that runs
+can be compared across upgrades.
+"""
+
+import argparse
+import collections
+import json
+import math
+import multiprocessing
+import os
+import shutil
+import subprocess
+import sys
+
+sys.path.append(
+    os.path.join(
+        os.path.dirname(sys.argv[0]), "..", "..", "run_tests", "python_utils"
+    )
+)
+import check_on_pr
+
+_BENCHMARKS = [
+    "bm_arena",
+    "bm_chttp2_hpack",
+    "bm_cq",
+    "bm_fullstack_streaming_ping_pong",
+    "bm_fullstack_streaming_pump",
+    "bm_fullstack_unary_ping_pong",
+    "bm_proto_serialization",
+    "bm_thread_pool",
+]
+
+# Benchmarks linking test/cpp/microbenchmarks/allocation_counter.
+_ALLOCATION_BENCHMARKS = [
+    "bm_fullstack_streaming_ping_pong",
+    "bm_fullstack_unary_ping_pong",
+]
+
+argp = argparse.ArgumentParser(
+    description="Perform diff on microbenchmarks between two revisions"
+)
+argp.add_argument(
+    "-d",
+    "--diff_base",
+    type=str,
+    help="Commit or branch to compare the current one to",
+)
+argp.add_argument(
+    "-b",
+    "--benchmarks",
+    nargs="+",
+    choices=_BENCHMARKS,
+    default=_BENCHMARKS,
+    help="Which benchmarks to run",
+)
+argp.add_argument(
+    "-l",
+    "--loops",
+    type=int,
+    default=20,
+    help="Number of times to run each benchmark binary at each revision",
+)
+argp.add_argument(
+    "-f",
+    "--benchmark_filter",
+    type=str,
+    default=".*",
+    help="Passed to every benchmark binary",
+)
+argp.add_argument(
+    "--cpu",
+    type=int,
+    default=multiprocessing.cpu_count() - 1,
+    help="Cpu to pin benchmarks to (with taskset), -1 to not pin",
+)
+argp.add_argument(
+    "--p_value",
+    type=float,
+    default=0.01,
+    help="Significance level of the Mann-Whitney U test",
+)
+argp.add_argument(
+    "--threshold",
+    type=float,
+    default=3,
+    help="Smallest change in median cpu time (in percent) to report",
+)
+argp.add_argument(
+    "--results_dir",
+    type=str,
+    default="bm_diff_results",
+    help="Where to store raw results, flame graphs and the summary",
+)
+argp.add_argument(
+    "--perf",
+    default=False,
+    action="store_const",
+    const=True,
+    help="Record a differential flame graph for every changed benchmark",
+)
+argp.add_argument(
+    "--flamegraph_dir",
+    type=str,
+    default=os.path.expanduser("~/FlameGraph"),
+    help="Checkout of https://github.com/brendangregg/FlameGraph",
+)
+argp.add_argument(
+    "--allocations",
+    default=False,
+    action="store_const",
+    const=True,
+    help="Also compare heap allocations per iteration (--allocation_counts)",
+)
+argp.add_argument(
+    "--allocation_budget",
+    type=float,
+    default=1,
+    help="Largest increase in allocations per iteration (in percent) allowed",
+)
+argp.add_argument("-j", "--jobs", type=int, default=multiprocessing.cpu_count())
+
+args = argp.parse_args()
+
+
+def _git_rev():
+    return (
+        subprocess.check_output(["git", "rev-parse", "--short", "HEAD"])
+        .decode()
+        .strip()
+    )
+
+
+def _build(name):
+    """Builds the benchmarks and copies them to results_dir/<name>/bin."""
+    subprocess.check_call(
+        [
+            "tools/bazel",
+            "build",
+            "-c",
+            "opt",
+            "--copt=-gmlt",
+            "--jobs=%d" % args.jobs,
+        ]
+        + ["//test/cpp/microbenchmarks:%s" % bm for bm in args.benchmarks]
+    )
+    bin_dir = os.path.join(args.results_dir, name, "bin")
+    shutil.rmtree(bin_dir, ignore_errors=True)
+    os.makedirs(bin_dir)
+    for bm in args.benchmarks:
+        shutil.copy(
+            os.path.join("bazel-bin/test/cpp/microbenchmarks", bm), bin_dir
+        )
+    return bin_dir
+
+
+def _pinned(argv):
+    if args.cpu < 0 or shutil.which("taskset") is None:
+        return argv
+    return ["taskset", "-c", str(args.cpu)] + argv
+
+
+def _run_once(bin_dir, bm, out_file):
+    subprocess.check_call(
+        _pinned(
+            [
+                os.path.join(bin_dir, bm),
+                "--benchmark_filter=%s" % args.benchmark_filter,
+                "--benchmark_out=%s" % out_file,
+                "--benchmark_out_format=json",
+            ]
+        ),
+        stdout=subprocess.DEVNULL,
+    )
+    with open(out_file) as f:
+        results = json.load(f)
+    return {
+        b["name"]: b["cpu_time"]
+        for b in results["benchmarks"]
+        if b.get("run_type", "iteration") == "iteration"
+    }
+
+
+def _run(bin_dirs):
+    """Runs every build in alternation; returns {build: {name: [samples]}}."""
+    samples = {
+        build: collections.defaultdict(list) for build in bin_dirs.keys()
+    }
+    for bm in args.benchmarks:
+        for loop in range(args.loops):
+            for build, bin_dir in bin_dirs.items():
+                out_dir = os.path.join(args.results_dir, build, "json")
+                os.makedirs(out_dir, exist_ok=True)
+                out_file = os.path.join(out_dir, "%s.%d.json" % (bm, loop))
+                for name, cpu_time in _run_once(bin_dir, bm, out_file).items():
+                    samples[build]["%s/%s" % (bm, name)].append(cpu_time)
+    return samples
+
+
+def _allocation_counts(bin_dirs):
+    """Runs every build once with --allocation_counts.
+
+    Allocation counts hardly vary between runs, so one run is enough. Returns
+    {build: {name/counter: value}} for the allocs_per_<unit> counters.
+    """
+    counts = {}
+    for build, bin_dir in bin_dirs.items():
+        counts[build] = {}
+        out_dir = os.path.join(args.results_dir, build, "json")
+        os.makedirs(out_dir, exist_ok=True)
+        for bm in args.benchmarks:
+            if bm not in _ALLOCATION_BENCHMARKS:
+                continue
+            out_file = os.path.join(out_dir, "%s.allocations.json" % bm)
+            subprocess.check_call(
+                [
+                    os.path.join(bin_dir, bm),
+                    "--benchmark_filter=%s" % args.benchmark_filter,
+                    "--benchmark_out=%s" % out_file,
+                    "--benchmark_out_format=json",
+                    "--allocation_counts",
+                ],
+                stdout=subprocess.DEVNULL,
+            )
+            with open(out_file) as f:
+                results = json.load(f)
+            for b in results["benchmarks"]:
+                for counter, value in b.items():
+                    if counter.startswith("allocs_per_"):
+                        counts[build][
+                            "%s/%s:%s" % (bm, b["name"], counter)
+                        ] = value
+    return counts
+
+
+def _mann_whitney_u(xs, ys):
+    """Two-sided p-value of the Mann-Whitney U test (normal approximation)."""
+    n1, n2 = len(xs), len(ys)
+    ranked = sorted([(v, 0) for v in xs] + [(v, 1) for v in ys])
+    ranks = [0.0] * len(ranked)
+    tie_term = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        tie_term += (j - i + 1) ** 3 - (j - i + 1)
+        i = j + 1
+    r1 = sum(rank for rank, (_, side) in zip(ranks, ranked) if side == 0)
+    u = r1 - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    sigma = math.sqrt(n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1))))
+    if sigma == 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / sigma
+    return math.erfc(max(z, 0) / math.sqrt(2))
+
+
+def _median(xs):
+    xs = sorted(xs)
+    mid = len(xs) // 2
+    return xs[mid] if len(xs) % 2 else (xs[mid - 1] + xs[mid]) / 2.0
+
+
+def _flame_diff(bin_dirs, bm, name):
+    """Writes results_dir/flame/<bm>.<name>.svg, a differential flame graph."""
+    flame_dir = os.path.join(args.results_dir, "flame")
+    os.makedirs(flame_dir, exist_ok=True)
+    base = os.path.join(flame_dir, "%s.%s" % (bm, name.replace("/", "_")))
+    folded = {}
+    for build, bin_dir in bin_dirs.items():
+        perf_data = "%s.%s.perf.data" % (base, build)
+        subprocess.check_call(
+            ["perf", "record", "-g", "-o", perf_data, "--"]
+            + _pinned(
+                [
+                    os.path.join(bin_dir, bm),
+                    "--benchmark_filter=^%s$" % name,
+                    "--benchmark_min_time=1s",
+                ]
+            ),
+            stdout=subprocess.DEVNULL,
+        )
+        script = subprocess.check_output(
+            ["perf", "script", "-i", perf_data]
+        )
+        folded[build] = "%s.%s.folded" % (base, build)
+        with open(folded[build], "wb") as f:
+            f.write(
+                subprocess.check_output(
+                    [
+                        os.path.join(
+                            args.flamegraph_dir, "stackcollapse-perf.pl"
+                        )
+                    ],
+                    input=script,
+                )
+            )
+    diff = subprocess.check_output(
+        [
+            os.path.join(args.flamegraph_dir, "difffolded.pl"),
+            "-n",
+            folded["old"],
+            folded["new"],
+        ]
+    )
+    with open(base + ".svg", "wb") as f:
+        f.write(
+            subprocess.check_output(
+                [os.path.join(args.flamegraph_dir, "flamegraph.pl")],
+                input=diff,
+            )
+        )
+    return base + ".svg"
+
+
+new_rev = _git_rev()
+bin_dirs = {"new": _build("new")}
+old_rev = None
+if args.diff_base:
+    where_am_i = (
+        subprocess.check_output(["git", "rev-parse", "--abbrev-ref", "HEAD"])
+        .decode()
+        .strip()
+    )
+    # checkout the diff base (="old")
+    subprocess.check_call(["git", "checkout", args.diff_base])
+    try:
+        old_rev = _git_rev()
+        bin_dirs["old"] = _build("old")
+    finally:
+        # restore the original revision (="new")
+        subprocess.check_call(["git", "checkout", where_am_i])
+
+samples = _run(bin_dirs)
+
+summary = {
+    "new_rev": new_rev,
+    "old_rev": old_rev,
+    "samples": {build: dict(s) for build, s in samples.items()},
+    "changes": [],
+}
+text = ""
+regressions = 0
+improvements = 0
+if old_rev is None:
+    for name, values in sorted(samples["new"].items()):
+        text += "{}: {:.1f}\n".format(name, _median(values))
+else:
+    for name, new_values in sorted(samples["new"].items()):
+        old_values = samples["old"].get(name)
+        if not old_values:
+            continue
+        old_median = _median(old_values)
+        new_median = _median(new_values)
+        change = 100.0 * (new_median - old_median) / old_median
+        p = _mann_whitney_u(old_values, new_values)
+        if p > args.p_value or abs(change) < args.threshold:
+            continue
+        if change > 0:
+            regressions += 1
+        else:
+            improvements += 1
+        entry = {
+            "name": name,
+            "old": old_median,
+            "new": new_median,
+            "change": change,
+            "p": p,
+        }
+        line = "{}: {:.1f} -> {:.1f} ({:+.1f}%, p={:.4f})".format(
+            name, old_median, new_median, change, p
+        )
+        if args.perf:
+            bm, bm_name = name.split("/", 1)
+            entry["flame_graph"] = _flame_diff(bin_dirs, bm, bm_name)
+            line += " " + entry["flame_graph"]
+        summary["changes"].append(entry)
+        text += line + "\n"
+    if args.allocations:
+        allocations = _allocation_counts(bin_dirs)
+        summary["allocations"] = allocations
+        for name, new_count in sorted(allocations["new"].items()):
+            old_count = allocations["old"].get(name)
+            if not old_count:
+                continue
+            change = 100.0 * (new_count - old_count) / old_count
+            if abs(change) <= args.allocation_budget:
+                continue
+            if change > 0:
+                regressions += 1
+            else:
+                improvements += 1
+            summary["changes"].append(
+                {
+                    "name": name,
+                    "old": old_count,
+                    "new": new_count,
+                    "change": change,
+                }
+            )
+            text += "{}: {:.1f} -> {:.1f} ({:+.1f}%)\n".format(
+                name, old_count, new_count, change
+            )
+    if not text:
+        text = "No significant changes\n"
+
+os.makedirs(args.results_dir, exist_ok=True)
+with open(os.path.join(args.results_dir, "%s.json" % new_rev), "w") as f:
+    json.dump(summary, f, indent=2)
+
+print(text)
+if old_rev is not None:
+    print("%d regressions, %d improvements" % (regressions, improvements))
+    # Flag regressions before improvements, as for memory_diff.py.
+    if regressions > 0:
+        check_on_pr.label_increase_decrease_on_pr("microbenchmarks", 1)
+    elif improvements > 0:
+        check_on_pr.label_increase_decrease_on_pr("microbenchmarks", -1)
+    else:
+        check_on_pr.label_increase_decrease_on_pr("microbenchmarks", 0)
+check_on_pr.check_on_pr("Microbenchmarks", "```\n%s\n```" % text)
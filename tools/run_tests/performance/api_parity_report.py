@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# Copyright 2025 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Tabulates the results of the api_parity scenarios, putting the sync, async
+# and callback API runs of each workload side by side.
+#
+# Example usage:
+#
+# tools/run_tests/run_performance_tests.py -l c++ --category=api_parity \
+#     --scenario_result_dir=api_parity_results
+# tools/run_tests/performance/api_parity_report.py api_parity_results/*.json
+
+import argparse
+import collections
+import json
+import sys
+
+_APIS = ["sync", "async", "callback"]
+
+# Columns reported for each API: title, function of the result summary.
+_METRICS = [
+    ("qps", lambda s: s.get("qps", 0)),
+    ("p50_us", lambda s: s.get("latency50", 0) / 1000),
+    ("p99_us", lambda s: s.get("latency99", 0) / 1000),
+    ("p999_us", lambda s: s.get("latency999", 0) / 1000),
+    ("srv_cpu_us/rpc", lambda s: _cpu_us_per_rpc(s, "server")),
+    ("cli_cpu_us/rpc", lambda s: _cpu_us_per_rpc(s, "client")),
+]
+
+
+def _cpu_us_per_rpc(summary, side):
+    queries_per_cpu_sec = summary.get("%sQueriesPerCpuSec" % side, 0)
+    return 1e6 / queries_per_cpu_sec if queries_per_cpu_sec else 0
+
+
+def _workload(scenario):
+    """Returns (api, (rpc type, outstanding rpcs, message size))."""
+    # Proto3 JSON leaves out fields with default values.
+    client = scenario["clientConfig"]
+    api = client.get("clientType", "SYNC_CLIENT")
+    api = api[: -len("_CLIENT")].lower()
+    outstanding = client.get("outstandingRpcsPerChannel", 0) * client.get(
+        "clientChannels", 0
+    )
+    simple_params = client.get("payloadConfig", {}).get("simpleParams", {})
+    workload = (
+        client.get("rpcType", "UNARY").lower(),
+        outstanding,
+        simple_params.get("reqSize", 0),
+    )
+    return api, workload
+
+
+def main():
+    argp = argparse.ArgumentParser(
+        description="Compares api_parity scenario results side by side."
+    )
+    argp.add_argument(
+        "results",
+        nargs="+",
+        help="Scenario result files, as written by qps_json_driver",
+    )
+    args = argp.parse_args()
+
+    summaries = collections.defaultdict(dict)
+    for path in args.results:
+        with open(path) as f:
+            result = json.load(f)
+        api, workload = _workload(result["scenario"])
+        summaries[workload][api] = result["summary"]
+
+    header = ["rpc", "outstanding", "bytes"]
+    for title, _ in _METRICS:
+        header.extend("%s %s" % (api, title) for api in _APIS)
+    rows = [header]
+    for workload in sorted(summaries):
+        row = [str(field) for field in workload]
+        for _, metric in _METRICS:
+            for api in _APIS:
+                summary = summaries[workload].get(api)
+                row.append("-" if summary is None else "%.1f" % metric(summary))
+        rows.append(row)
+
+    widths = [max(len(row[i]) for row in rows) for i in range(len(header))]
+    for row in rows:
+        print("  ".join(cell.rjust(width) for cell, width in zip(row, widths)))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -466,6 +466,9 @@ def main() -> None:
             "sweep",
             "psm",
             "dashboard",
+            "scale",
+            "numa",
+            "api_parity",
         ],
         default="all",
         help="Select a category of tests to run.",
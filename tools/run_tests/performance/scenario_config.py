@@ -26,6 +26,15 @@ SCALABLE = "scalable"
 INPROC = "inproc"
 SWEEP = "sweep"
 PSM = "psm"
+# Many-connection scenarios, meant to be run on dedicated machines with raised
+# file descriptor limits.
+SCALE = "scale"
+# Scenarios pinning workers to NUMA nodes, meant to be run on multi-socket
+# machines.
+NUMA = "numa"
+# The same unary and streaming workloads on the sync, async and callback C++
+# APIs, for comparing them side by side (see api_parity_report.py).
+API_PARITY = "api_parity"
 # A small superset of the benchmarks required to produce
 # https://grafana-dot-grpc-testing.appspot.com/
 DASHBOARD = "dashboard"
@@ -120,6 +129,93 @@ def _add_channel_arg(config, key, value):
     channel_args.append(arg)
 
 
+def _idle_connections_scenario(
+    name, secure, channels_per_client, active_fraction, num_clients=None
+):
+    """Creates a scenario keeping many mostly idle connections to one server.
+
+    Each client connects channels_per_client channels, and only
+    active_fraction of them issue RPCs, one at a time. The other connections
+    stay idle, only sending keepalive pings, so that the scenario measures what
+    each connection costs the server in memory and poller CPU.
+    """
+    active_channels = max(1, int(channels_per_client * active_fraction))
+    scenario = _ping_pong_scenario(
+        name,
+        rpc_type="UNARY",
+        client_type="ASYNC_CLIENT",
+        server_type="ASYNC_SERVER",
+        unconstrained_client="async",
+        secure=secure,
+        channels=channels_per_client,
+        outstanding=channels_per_client,
+        num_clients=num_clients,
+        categories=[SCALE],
+        warmup_seconds=CXX_WARMUP_SECONDS,
+    )
+    scenario["client_config"]["active_client_channels"] = active_channels
+    _add_channel_arg(scenario["client_config"], "grpc.keepalive_time_ms", 60000)
+    _add_channel_arg(
+        scenario["client_config"], "grpc.keepalive_permit_without_calls", 1
+    )
+    _add_channel_arg(
+        scenario["server_config"], "grpc.keepalive_permit_without_calls", 1
+    )
+    _add_channel_arg(
+        scenario["server_config"],
+        "grpc.http2.min_ping_interval_without_data_ms",
+        30000,
+    )
+    return scenario
+
+
+def _numa_pinned_scenario(name, secure, server_node, client_node):
+    """Creates an unconstrained streaming scenario with pinned workers.
+
+    The server and client workers are restricted to the cores of server_node
+    and client_node, so that same-node and cross-node runs show what crossing
+    the interconnect costs.
+    """
+    scenario = _ping_pong_scenario(
+        name,
+        rpc_type="STREAMING",
+        client_type="ASYNC_CLIENT",
+        server_type="ASYNC_GENERIC_SERVER",
+        unconstrained_client="async",
+        use_generic_payload=True,
+        secure=secure,
+        categories=[NUMA],
+        warmup_seconds=CXX_WARMUP_SECONDS,
+    )
+    scenario["server_config"]["numa_nodes"] = [server_node]
+    scenario["client_config"]["numa_nodes"] = [client_node]
+    return scenario
+
+
+def _api_parity_scenario(rpc_type, api, concurrency, size):
+    """Creates a scenario of the sync/async/callback API comparison matrix.
+
+    Exactly concurrency RPCs (or streams) are kept outstanding, by a single
+    client, so that scenarios differing only in api are comparable.
+    """
+    return _ping_pong_scenario(
+        "cpp_protobuf_%s_%s_api_parity_%d_outstanding_%db_insecure"
+        % (api, rpc_type, concurrency, size),
+        rpc_type=rpc_type.upper(),
+        client_type="%s_CLIENT" % api.upper(),
+        server_type="%s_SERVER" % api.upper(),
+        unconstrained_client=api,
+        secure=False,
+        req_size=size,
+        resp_size=size,
+        channels=min(concurrency, WIDE),
+        outstanding=concurrency,
+        num_clients=1,
+        categories=[API_PARITY],
+        warmup_seconds=CXX_WARMUP_SECONDS,
+    )
+
+
 def _ping_pong_scenario(
     name,
     rpc_type,
@@ -713,6 +809,32 @@ class CXXLanguage(Language):
                                 warmup_seconds=CXX_WARMUP_SECONDS,
                             )
 
+            for channels_per_client in [1000, 10000, 25000]:
+                yield _idle_connections_scenario(
+                    "cpp_protobuf_async_unary_%d_idle_channels_per_client_%s"
+                    % (channels_per_client, secstr),
+                    secure=secure,
+                    channels_per_client=channels_per_client,
+                    active_fraction=0.01,
+                )
+
+            for placement, client_node in [("same", 0), ("cross", 1)]:
+                yield _numa_pinned_scenario(
+                    "cpp_generic_async_streaming_qps_unconstrained_%s_numa_node_%s"
+                    % (placement, secstr),
+                    secure=secure,
+                    server_node=0,
+                    client_node=client_node,
+                )
+
+        for rpc_type in ["unary", "streaming"]:
+            for api in ["sync", "async", "callback"]:
+                for concurrency in [1, 64, 1024]:
+                    for size in [0, 1024, 1024 * 1024]:
+                        yield _api_parity_scenario(
+                            rpc_type, api, concurrency, size
+                        )
+
     def __str__(self):
         return "c++"
 
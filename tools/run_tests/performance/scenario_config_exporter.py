@@ -196,6 +196,9 @@ def main() -> None:
             "sweep",
             "psm",
             "dashboard",
+            "scale",
+            "numa",
+            "api_parity",
         ],
         help="Select scenarios for a category of tests.",
     )
@@ -114,17 +114,26 @@ def create_scenario_jobspec(
     remote_host=None,
     bq_result_table=None,
     server_cpu_load=0,
+    scenario_result_dir=None,
 ):
     """Runs one scenario using QPS driver."""
     # setting QPS_WORKERS env variable here makes sure it works with SSH too.
     cmd = 'QPS_WORKERS="%s" ' % ",".join(workers)
+    if scenario_result_dir:
+        cmd = "mkdir -p %s && %s" % (shlex.quote(scenario_result_dir), cmd)
     if bq_result_table:
         cmd += 'BQ_RESULT_TABLE="%s" ' % bq_result_table
     cmd += "tools/run_tests/performance/run_qps_driver.sh "
     cmd += "--scenarios_json=%s " % shlex.quote(
         json.dumps({"scenarios": [scenario_json]})
     )
-    cmd += "--scenario_result_file=scenario_result.json "
+    if scenario_result_dir:
+        result_file = os.path.join(
+            scenario_result_dir, "%s.json" % scenario_json["name"]
+        )
+    else:
+        result_file = "scenario_result.json"
+    cmd += "--scenario_result_file=%s " % shlex.quote(result_file)
     if server_cpu_load != 0:
         cmd += (
             "--search_param=offered_load --initial_search_value=1000"
@@ -393,6 +402,7 @@ def create_scenarios(
     netperf=False,
     netperf_hosts=[],
     server_cpu_load=0,
+    scenario_result_dir=None,
 ):
     """Create jobspecs for scenarios to run."""
     all_workers = [
@@ -493,6 +503,7 @@ def create_scenarios(
                             remote_host=remote_host,
                             bq_result_table=bq_result_table,
                             server_cpu_load=server_cpu_load,
+                            scenario_result_dir=scenario_result_dir,
                         ),
                         workers,
                         scenario_json["name"],
@@ -605,7 +616,15 @@ def main():
     )
     argp.add_argument(
         "--category",
-        choices=["smoketest", "all", "scalable", "sweep"],
+        choices=[
+            "smoketest",
+            "all",
+            "scalable",
+            "sweep",
+            "scale",
+            "numa",
+            "api_parity",
+        ],
         default="all",
         help="Select a category of tests to run.",
     )
@@ -624,6 +643,17 @@ def main():
             "Select a targeted server cpu load to run. 0 means ignore this flag"
         ),
     )
+    argp.add_argument(
+        "--scenario_result_dir",
+        default=None,
+        type=str,
+        help=(
+            "Directory, relative to the repository root, to keep the result"
+            " of each scenario in, as <scenario name>.json. Results are"
+            " otherwise overwritten by the next scenario. Cannot be combined"
+            " with --bq_result_table."
+        ),
+    )
     argp.add_argument(
         "-x",
         "--xml_report",
@@ -684,6 +714,8 @@ def main():
     )
 
     args = argp.parse_args()
+    if args.scenario_result_dir and args.bq_result_table:
+        argp.error("--scenario_result_dir and --bq_result_table conflict")
 
     global _REMOTE_HOST_USERNAME
     if args.remote_host_username:
@@ -748,6 +780,7 @@ def main():
         netperf=args.netperf,
         netperf_hosts=args.remote_worker_host,
         server_cpu_load=args.server_cpu_load,
+        scenario_result_dir=args.scenario_result_dir,
     )
 
     if not scenarios:
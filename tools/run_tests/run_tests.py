@@ -64,7 +64,7 @@ _FORCE_ENVIRON_FOR_WRAPPERS = {
 }
 
 _POLLING_STRATEGIES = {
-    "linux": ["epoll1", "poll"],
+    "linux": ["epoll1", "poll", "io_uring"],
     "mac": ["poll"],
 }
 